@@ -0,0 +1,905 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#include "AssetLoader.h"
+
+#include "AssetPack.h"
+#include "BlockCompression.h"
+#include "CopyableFootprints.h"
+#include "DiskCache.h"
+#include "Hash.h"
+#include "ImageIO.h"
+#include "ImageResampler.h"
+#include "MipChain.h"
+#include "PixelConversion.h"
+#include "SupercompressedTexture.h"
+#include "TextureContainer.h"
+#include "TextureUploadBatch.h"
+#include "Utility.h"
+
+#include "d3dx12.h"
+#include <algorithm>
+#include <stdexcept>
+
+using namespace Microsoft::WRL;
+
+namespace AMD {
+///////////////////////////////////////////////////////////////////////////////
+struct TextureLoadState
+{
+	std::mutex mutex;
+	std::condition_variable done;
+
+	TextureHandle::Status status = TextureHandle::Status::Pending;
+	std::exception_ptr error;
+
+	ComPtr<ID3D12Resource> resource;
+	DXGI_FORMAT format = DXGI_FORMAT_UNKNOWN;
+	int mipLevelCount = 0;
+
+	// Called once the status is no longer pending
+	std::vector<std::function<void ()>> callbacks;
+};
+
+namespace {
+///////////////////////////////////////////////////////////////////////////////
+/**
+Wake up waiters and run the callbacks, after the status has been set.
+*/
+void NotifyDone (TextureLoadState& state,
+	std::vector<std::function<void ()>>& callbacks)
+{
+	state.done.notify_all ();
+
+	for (const auto& callback : callbacks) {
+		callback ();
+	}
+}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TextureHandle::Status TextureHandle::GetStatus () const
+{
+	std::lock_guard<std::mutex> lock (state_->mutex);
+	return state_->status;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void TextureHandle::Wait () const
+{
+	std::unique_lock<std::mutex> lock (state_->mutex);
+	state_->done.wait (lock, [this] () {
+		return state_->status != Status::Pending;
+	});
+
+	if (state_->error) {
+		std::rethrow_exception (state_->error);
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void TextureHandle::OnDone (std::function<void ()> callback) const
+{
+	{
+		std::lock_guard<std::mutex> lock (state_->mutex);
+		if (state_->status == Status::Pending) {
+			state_->callbacks.push_back (std::move (callback));
+			return;
+		}
+	}
+
+	callback ();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+ID3D12Resource* TextureHandle::GetResource () const
+{
+	std::lock_guard<std::mutex> lock (state_->mutex);
+	return (state_->status == Status::Ready) ? state_->resource.Get () : nullptr;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+DXGI_FORMAT TextureHandle::GetFormat () const
+{
+	std::lock_guard<std::mutex> lock (state_->mutex);
+	return state_->format;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int TextureHandle::GetMipLevelCount () const
+{
+	std::lock_guard<std::mutex> lock (state_->mutex);
+	return state_->mipLevelCount;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void StagingBudget::Acquire (const std::uint64_t size)
+{
+	std::unique_lock<std::mutex> lock (mutex_);
+	released_.wait (lock, [this, size] () {
+		return used_ == 0 || used_ + size <= budget_;
+	});
+
+	used_ += size;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void StagingBudget::Release (const std::uint64_t size)
+{
+	{
+		std::lock_guard<std::mutex> lock (mutex_);
+		used_ -= size;
+	}
+
+	released_.notify_all ();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+One texture on its way through the pipeline. Each stage consumes the
+output of the previous one and frees it as soon as possible.
+*/
+struct AssetLoader::TextureJob
+{
+	std::shared_ptr<TextureLoadState> state;
+	TextureLoadOptions options;
+
+	// Source, either a file, an asset pack entry or memory owned by the
+	// caller
+	std::string path;
+	const AssetPack* pack = nullptr;
+	int packEntry = -1;
+	const void* sourceData = nullptr;
+	std::size_t sourceSize = 0;
+
+	// Read stage
+	std::vector<std::uint8_t> fileData;
+	AssetData packData;
+
+	// Reserved from the staging budget before decoding
+	std::uint64_t stagingSize = 0;
+
+	// Hash of the source and options, if there is a disk cache
+	std::uint64_t cacheKey = 0;
+	// Set on a cache hit, the subresources point into it
+	std::unique_ptr<TextureContainer> cachedTexture;
+
+	// Decode stage
+	int width = 0;
+	int height = 0;
+	std::vector<std::uint8_t> image;
+
+	// Convert stage, one entry per mip level
+	DXGI_FORMAT format = DXGI_FORMAT_UNKNOWN;
+	std::vector<std::vector<std::uint8_t>> levels;
+	std::vector<D3D12_SUBRESOURCE_DATA> subresources;
+
+	// Set if the image was decoded straight into its upload buffer, which
+	// has to live until the copy has finished
+	ComPtr<ID3D12Resource> uploadBuffer;
+	D3D12_PLACED_SUBRESOURCE_FOOTPRINT uploadLayout = {};
+
+	// Upload stage
+	ComPtr<ID3D12Resource> resource;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+One ExecuteCommandLists call on the copy queue.
+*/
+struct AssetLoader::Submission
+{
+	UINT64 fenceValue;
+	ComPtr<ID3D12CommandAllocator> allocator;
+	ComPtr<ID3D12Resource> uploadBuffer;
+	std::vector<std::unique_ptr<TextureJob>> jobs;
+};
+
+namespace {
+// Command allocators cycle between the uploader and the retirer; with more
+// than one, the next batch can be recorded while the previous one copies
+const int UPLOAD_ALLOCATOR_COUNT = 3;
+
+// Upper limit for the staging memory used by a single submission
+const std::uint64_t MAXIMUM_SUBMISSION_SIZE = 64 << 20;
+
+DXGI_FORMAT GetBlockCompressedFormat (const BlockFormat format)
+{
+	switch (format) {
+	case BlockFormat::BC1: return DXGI_FORMAT_BC1_UNORM_SRGB;
+	case BlockFormat::BC3: return DXGI_FORMAT_BC3_UNORM_SRGB;
+	case BlockFormat::BC7: return DXGI_FORMAT_BC7_UNORM_SRGB;
+	}
+
+	return DXGI_FORMAT_UNKNOWN;
+}
+
+/**
+Mixed into the cache key, so different load options get different entries.
+*/
+std::uint64_t GetCacheSeed (const TextureLoadOptions& options)
+{
+	// Bump this whenever the conversion output changes, so stale entries
+	// don't get used
+	static const std::uint64_t CACHE_VERSION = 2;
+
+	return (CACHE_VERSION << 32) |
+		(static_cast<std::uint64_t> (options.maximumDimension) << 2) |
+		(options.generateMips ? 2 : 0) |
+		(options.blockCompression ? 1 : 0);
+}
+
+int GetWorkerCount ()
+{
+	return static_cast<int> ((std::max) (1u, std::thread::hardware_concurrency ()));
+}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AssetLoader::AssetLoader (ID3D12Device* device, DiskCache* diskCache,
+	const std::uint64_t stagingBudget)
+	: device_ (device)
+	, diskCache_ (diskCache)
+	, stagingBudget_ (stagingBudget)
+	, readQueue_ (64)
+	, decodeQueue_ (2 * GetWorkerCount ())
+	, convertQueue_ (2 * GetWorkerCount ())
+	, uploadQueue_ (2 * GetWorkerCount ())
+	, retireQueue_ (UPLOAD_ALLOCATOR_COUNT)
+	, freeAllocators_ (UPLOAD_ALLOCATOR_COUNT)
+{
+	// Uploads go through a copy queue so they can overlap with rendering.
+	// Copy queues only handle the COPY_* and COMMON states, which is why
+	// textures are handed out in COMMON
+	D3D12_COMMAND_QUEUE_DESC queueDesc = {};
+	queueDesc.Type = D3D12_COMMAND_LIST_TYPE_COPY;
+	device_->CreateCommandQueue (&queueDesc, IID_PPV_ARGS (&copyQueue_));
+
+	ComPtr<ID3D12CommandAllocator> allocators [UPLOAD_ALLOCATOR_COUNT];
+	for (int i = 0; i < UPLOAD_ALLOCATOR_COUNT; ++i) {
+		device_->CreateCommandAllocator (D3D12_COMMAND_LIST_TYPE_COPY,
+			IID_PPV_ARGS (&allocators [i]));
+	}
+
+	device_->CreateCommandList (0, D3D12_COMMAND_LIST_TYPE_COPY,
+		allocators [0].Get (), nullptr, IID_PPV_ARGS (&copyCommandList_));
+	copyCommandList_->Close ();
+
+	for (int i = 0; i < UPLOAD_ALLOCATOR_COUNT; ++i) {
+		freeAllocators_.Push (allocators [i]);
+	}
+
+	device_->CreateFence (0, D3D12_FENCE_FLAG_NONE, IID_PPV_ARGS (&copyFence_));
+
+	// Reading is bound by the storage device, a few threads are enough to
+	// keep it busy
+	for (int i = 0; i < 2; ++i) {
+		readers_.emplace_back ([this] () { RunReader (); });
+	}
+
+	for (int i = 0; i < GetWorkerCount (); ++i) {
+		decoders_.emplace_back ([this] () { RunDecoder (); });
+		converters_.emplace_back ([this] () { RunConverter (); });
+	}
+
+	// Recording goes into a single command list, so there is only one
+	// uploader
+	uploader_ = std::thread ([this] () { RunUploader (); });
+	retirer_ = std::thread ([this] () { RunRetirer (); });
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AssetLoader::~AssetLoader ()
+{
+	// Shut down front to back, so each stage drains before the next one
+	// gets closed
+	readQueue_.Close ();
+	for (auto& thread : readers_) {
+		thread.join ();
+	}
+
+	decodeQueue_.Close ();
+	for (auto& thread : decoders_) {
+		thread.join ();
+	}
+
+	convertQueue_.Close ();
+	for (auto& thread : converters_) {
+		thread.join ();
+	}
+
+	uploadQueue_.Close ();
+	uploader_.join ();
+
+	retireQueue_.Close ();
+	retirer_.join ();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TextureHandle AssetLoader::LoadTextureFromFile (const char* path,
+	const TextureLoadOptions& options)
+{
+	std::unique_ptr<TextureJob> job (new TextureJob);
+	job->options = options;
+	job->path = path;
+
+	return Enqueue (job);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TextureHandle AssetLoader::LoadTextureFromMemory (const void* data,
+	const std::size_t size, const TextureLoadOptions& options)
+{
+	std::unique_ptr<TextureJob> job (new TextureJob);
+	job->options = options;
+	job->sourceData = data;
+	job->sourceSize = size;
+
+	return Enqueue (job);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TextureHandle AssetLoader::LoadTextureFromPack (const AssetPack& pack,
+	const char* name, const TextureLoadOptions& options)
+{
+	const auto index = pack.Find (name);
+	if (index < 0) {
+		throw std::runtime_error (std::string ("Asset not found: ") + name);
+	}
+
+	std::unique_ptr<TextureJob> job (new TextureJob);
+	job->options = options;
+	job->pack = &pack;
+	job->packEntry = index;
+
+	return Enqueue (job);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TextureHandle AssetLoader::Enqueue (std::unique_ptr<TextureJob>& job)
+{
+	job->state = std::make_shared<TextureLoadState> ();
+
+	TextureHandle handle;
+	handle.state_ = job->state;
+
+	// Memory sources have nothing to read
+	if (job->path.empty () && job->pack == nullptr) {
+		decodeQueue_.Push (job);
+	} else {
+		readQueue_.Push (job);
+	}
+
+	return handle;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void AssetLoader::Fail (TextureJob& job, const std::exception_ptr& error)
+{
+	stagingBudget_.Release (job.stagingSize);
+	job.stagingSize = 0;
+
+	std::vector<std::function<void ()>> callbacks;
+	{
+		std::lock_guard<std::mutex> lock (job.state->mutex);
+		job.state->status = TextureHandle::Status::Failed;
+		job.state->error = error;
+		callbacks.swap (job.state->callbacks);
+	}
+
+	NotifyDone (*job.state, callbacks);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+On a hit, map the cache entry and point the subresources into it, so the
+job can go straight to the upload stage.
+*/
+bool AssetLoader::LoadFromCache (TextureJob& job)
+{
+	std::string path;
+	if (!diskCache_->Find (job.cacheKey, &path)) {
+		return false;
+	}
+
+	try {
+		job.cachedTexture.reset (new TextureContainer (path.c_str ()));
+	} catch (...) {
+		// Evicted in the meantime or corrupt, either way we have to decode
+		diskCache_->Remove (job.cacheKey);
+		return false;
+	}
+
+	const auto& header = job.cachedTexture->GetHeader ();
+
+	// The mapped entry and the upload buffer
+	job.stagingSize = header.dataSize * 2;
+	stagingBudget_.Acquire (job.stagingSize);
+
+	job.width = header.width;
+	job.height = header.height;
+	job.format = static_cast<DXGI_FORMAT> (header.format);
+
+	for (std::uint32_t i = 0; i < header.mipLevels; ++i) {
+		job.subresources.push_back (job.cachedTexture->GetSubresourceData (i));
+	}
+
+	job.fileData = std::vector<std::uint8_t> ();
+	job.packData = AssetData ();
+	job.sourceData = nullptr;
+
+	return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Transcode a supercompressed texture into BC7, which keeps the blocks
+bit-exact, and point the subresources at the transcoded levels.
+*/
+bool AssetLoader::LoadSupercompressed (TextureJob& job)
+{
+	int width, height;
+	if (!GetSupercompressedTextureInfo (job.sourceData, job.sourceSize, &width, &height)) {
+		return false;
+	}
+
+	// One byte per texel in BC7, plus the mip chain, twice for the upload
+	// buffer
+	job.stagingSize = RoundToNextMultiple<std::uint64_t> (width, 4) *
+		RoundToNextMultiple<std::uint64_t> (height, 4) * 4 / 3 * 2;
+	stagingBudget_.Acquire (job.stagingSize);
+
+	auto texture = TranscodeSupercompressedTexture (job.sourceData, job.sourceSize,
+		BlockFormat::BC7);
+
+	// Drop levels which are too large. Block compressed textures need a
+	// top level which is a multiple of the block size, so we can only drop
+	// down to a level which is one as well
+	std::size_t firstLevel = 0;
+	while (firstLevel + 1 < texture.levels.size () &&
+		(std::max) (texture.width >> firstLevel, texture.height >> firstLevel) >
+			job.options.maximumDimension &&
+		((texture.width >> (firstLevel + 1)) % 4) == 0 &&
+		((texture.height >> (firstLevel + 1)) % 4) == 0) {
+		++firstLevel;
+	}
+
+	job.width = texture.width >> firstLevel;
+	job.height = texture.height >> firstLevel;
+	job.format = GetBlockCompressedFormat (texture.format);
+
+	if (job.width % 4 != 0 || job.height % 4 != 0) {
+		throw std::runtime_error ("Supercompressed texture size must be a multiple of 4");
+	}
+
+	for (std::size_t i = firstLevel; i < texture.levels.size (); ++i) {
+		job.levels.push_back (std::move (texture.levels [i]));
+	}
+
+	for (std::size_t i = 0; i < job.levels.size (); ++i) {
+		const auto levelWidth = (std::max) (1, job.width >> i);
+		const auto levelHeight = (std::max) (1, job.height >> i);
+
+		D3D12_SUBRESOURCE_DATA subresource;
+		subresource.pData = job.levels [i].data ();
+		subresource.RowPitch = ((levelWidth + 3) / 4) * GetBlockSize (texture.format);
+		subresource.SlicePitch = subresource.RowPitch * ((levelHeight + 3) / 4);
+		job.subresources.push_back (subresource);
+	}
+
+	job.fileData = std::vector<std::uint8_t> ();
+	job.packData = AssetData ();
+	job.sourceData = nullptr;
+
+	return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Images which go through no conversion (opaque, fitting, no mip-maps and no
+block compression) are decoded straight into an upload buffer of their own,
+with the rows at the pitch of the copyable footprint. This skips the decoded
+image in system memory and the copy out of it.
+*/
+bool AssetLoader::LoadIntoUploadBuffer (TextureJob& job)
+{
+	if (job.options.generateMips) {
+		return false;
+	}
+
+	const auto info = GetImageInfoFromMemory (job.sourceData, job.sourceSize);
+	int fittedWidth, fittedHeight;
+	GetFittedImageSize (info.width, info.height,
+		job.options.maximumDimension, &fittedWidth, &fittedHeight);
+
+	const bool useBlockCompression = job.options.blockCompression &&
+		(info.width % 4 == 0) && (info.height % 4 == 0);
+
+	// Premultiplying alpha would have to read back the upload memory
+	if (info.hasAlpha || useBlockCompression ||
+		fittedWidth != info.width || fittedHeight != info.height) {
+		return false;
+	}
+
+	job.width = info.width;
+	job.height = info.height;
+	job.format = DXGI_FORMAT_R8G8B8A8_UNORM_SRGB;
+
+	const auto resourceDesc = CD3DX12_RESOURCE_DESC::Tex2D (job.format,
+		job.width, job.height, 1, 1);
+	UINT rowCount;
+	UINT64 rowSize, uploadSize;
+	GetCopyableFootprints (resourceDesc, 0, 1, 0,
+		&job.uploadLayout, &rowCount, &rowSize, &uploadSize);
+
+	// The upload buffer is all the staging memory this needs
+	job.stagingSize = uploadSize;
+	stagingBudget_.Acquire (job.stagingSize);
+
+	static const auto uploadHeapProperties = CD3DX12_HEAP_PROPERTIES (D3D12_HEAP_TYPE_UPLOAD);
+	const auto uploadBufferDesc = CD3DX12_RESOURCE_DESC::Buffer (uploadSize);
+
+	if (FAILED (device_->CreateCommittedResource (&uploadHeapProperties,
+		D3D12_HEAP_FLAG_NONE,
+		&uploadBufferDesc,
+		D3D12_RESOURCE_STATE_GENERIC_READ,
+		nullptr,
+		IID_PPV_ARGS (&job.uploadBuffer)))) {
+		throw std::runtime_error ("Could not create upload buffer");
+	}
+
+	const CD3DX12_RANGE readRange (0, 0);
+	void* data;
+	if (FAILED (job.uploadBuffer->Map (0, &readRange, &data))) {
+		throw std::runtime_error ("Could not map upload buffer");
+	}
+
+	try {
+		LoadImageFromMemoryInto (job.sourceData, job.sourceSize,
+			static_cast<std::uint8_t*> (data) + job.uploadLayout.Offset,
+			job.uploadLayout.Footprint.RowPitch, static_cast<std::size_t> (uploadSize));
+	} catch (...) {
+		job.uploadBuffer->Unmap (0, nullptr);
+		throw;
+	}
+
+	job.uploadBuffer->Unmap (0, nullptr);
+
+	job.fileData = std::vector<std::uint8_t> ();
+	job.packData = AssetData ();
+	job.sourceData = nullptr;
+
+	return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void AssetLoader::StoreInCache (const TextureJob& job)
+{
+	std::vector<TextureContainerSource> sources (job.subresources.size ());
+	const bool blockCompressed = job.format != DXGI_FORMAT_R8G8B8A8_UNORM_SRGB;
+
+	for (std::size_t i = 0; i < sources.size (); ++i) {
+		const auto levelWidth = (std::max) (1, job.width >> i);
+		const auto levelHeight = (std::max) (1, job.height >> i);
+
+		auto& source = sources [i];
+		source.data = job.subresources [i].pData;
+		source.rowPitch = job.subresources [i].RowPitch;
+		source.width = levelWidth;
+		source.height = levelHeight;
+		source.rowCount = blockCompressed ? (levelHeight + 3) / 4 : levelHeight;
+		source.rowSize = static_cast<int> (job.subresources [i].RowPitch);
+	}
+
+	// The cache is an optimization, failing to write it must not fail the
+	// load
+	try {
+		diskCache_->Store (job.cacheKey, [&] (const char* path) -> void {
+			WriteTextureContainer (path, job.format, job.width, job.height,
+				1, static_cast<int> (sources.size ()), sources.data ());
+		});
+	} catch (...) {
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void AssetLoader::RunReader ()
+{
+	std::unique_ptr<TextureJob> job;
+
+	while (readQueue_.Pop (job)) {
+		try {
+			if (job->pack) {
+				job->packData = job->pack->Load (job->packEntry);
+				job->sourceData = job->packData.GetData ();
+				job->sourceSize = job->packData.GetSize ();
+			} else {
+				job->fileData = ReadFile (job->path.c_str ());
+				job->sourceData = job->fileData.data ();
+				job->sourceSize = job->fileData.size ();
+			}
+		} catch (...) {
+			Fail (*job, std::current_exception ());
+			continue;
+		}
+
+		decodeQueue_.Push (job);
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void AssetLoader::RunDecoder ()
+{
+	std::unique_ptr<TextureJob> job;
+
+	while (decodeQueue_.Pop (job)) {
+		try {
+			// Transcoding is about as fast as reading a cache entry, so
+			// these bypass the cache
+			if (LoadSupercompressed (*job)) {
+				uploadQueue_.Push (job);
+				continue;
+			}
+
+			// Nothing to convert, so nothing the cache could save
+			if (LoadIntoUploadBuffer (*job)) {
+				uploadQueue_.Push (job);
+				continue;
+			}
+
+			if (diskCache_) {
+				job->cacheKey = HashXXH3 (job->sourceData, job->sourceSize,
+					GetCacheSeed (job->options));
+
+				if (LoadFromCache (*job)) {
+					uploadQueue_.Push (job);
+					continue;
+				}
+			}
+
+			// The header tells us the final size, so we can reserve all
+			// staging memory before decoding: the image, its mip chain (1/3
+			// on top) and the same again in the upload buffer
+			const auto info = GetImageInfoFromMemory (job->sourceData, job->sourceSize);
+			int fittedWidth, fittedHeight;
+			GetFittedImageSize (info.width, info.height,
+				job->options.maximumDimension, &fittedWidth, &fittedHeight);
+
+			const auto imageSize = static_cast<std::uint64_t> (fittedWidth) * fittedHeight * 4;
+			job->stagingSize = imageSize * 4 / 3 * 2;
+			stagingBudget_.Acquire (job->stagingSize);
+
+			job->image = LoadImageFromMemoryFitted (job->sourceData, job->sourceSize,
+				job->options.maximumDimension, &job->width, &job->height);
+
+			job->fileData = std::vector<std::uint8_t> ();
+			job->packData = AssetData ();
+			job->sourceData = nullptr;
+		} catch (...) {
+			Fail (*job, std::current_exception ());
+			continue;
+		}
+
+		convertQueue_.Push (job);
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void AssetLoader::RunConverter ()
+{
+	std::unique_ptr<TextureJob> job;
+
+	while (convertQueue_.Pop (job)) {
+		try {
+			const auto width = job->width;
+			const auto height = job->height;
+			auto& image = job->image;
+
+			// The pipeline blends with premultiplied alpha
+			PremultiplyAlphaSrgb (image.data (), image.size () / 4);
+
+			std::vector<MipLevel> mipChain;
+			if (job->options.generateMips) {
+				mipChain = GenerateMipChain (image.data (), width, height,
+					width * 4, AlphaMode::Premultiplied);
+			}
+
+			// Block compression needs a top level which is a multiple of the
+			// block size. If that is the case, compress all levels: BC1 if
+			// the image is opaque, BC3 otherwise
+			const bool useBlockCompression = job->options.blockCompression &&
+				(width % 4 == 0) && (height % 4 == 0);
+			auto blockFormat = BlockFormat::BC1;
+
+			if (useBlockCompression) {
+				static const auto quality = BlockCompressionQuality::Normal;
+
+				blockFormat = ChooseBlockFormat (image.data (),
+					width, height, width * 4, quality);
+				job->format = GetBlockCompressedFormat (blockFormat);
+
+				job->levels.push_back (CompressImage (image.data (),
+					width, height, width * 4, blockFormat, quality));
+
+				for (const auto& level : mipChain) {
+					job->levels.push_back (CompressImage (level.data.data (),
+						level.width, level.height, level.width * 4, blockFormat, quality));
+				}
+			} else {
+				job->format = DXGI_FORMAT_R8G8B8A8_UNORM_SRGB;
+
+				job->levels.push_back (std::move (image));
+
+				for (auto& level : mipChain) {
+					job->levels.push_back (std::move (level.data));
+				}
+			}
+
+			job->image = std::vector<std::uint8_t> ();
+
+			for (std::size_t i = 0; i < job->levels.size (); ++i) {
+				const auto levelWidth = (i == 0) ? width : mipChain [i - 1].width;
+				const auto levelHeight = (i == 0) ? height : mipChain [i - 1].height;
+
+				D3D12_SUBRESOURCE_DATA subresource;
+				subresource.pData = job->levels [i].data ();
+
+				if (useBlockCompression) {
+					subresource.RowPitch = ((levelWidth + 3) / 4) * GetBlockSize (blockFormat);
+					subresource.SlicePitch = subresource.RowPitch * ((levelHeight + 3) / 4);
+				} else {
+					subresource.RowPitch = levelWidth * 4;
+					subresource.SlicePitch = levelWidth * levelHeight * 4;
+				}
+
+				job->subresources.push_back (subresource);
+			}
+
+			if (diskCache_) {
+				StoreInCache (*job);
+			}
+		} catch (...) {
+			Fail (*job, std::current_exception ());
+			continue;
+		}
+
+		uploadQueue_.Push (job);
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void AssetLoader::RunUploader ()
+{
+	std::unique_ptr<TextureJob> job;
+
+	while (uploadQueue_.Pop (job)) {
+		std::unique_ptr<Submission> submission (new Submission);
+		TextureUploadBatch batch;
+
+		// Take everything that is ready right now into one submission
+		do {
+			try {
+				static const auto defaultHeapProperties = CD3DX12_HEAP_PROPERTIES (D3D12_HEAP_TYPE_DEFAULT);
+				// Images decoded into their upload buffer have no subresources
+				// in system memory, and only the top level
+				const auto mipLevelCount = job->uploadBuffer
+					? static_cast<UINT16> (1) : static_cast<UINT16> (job->subresources.size ());
+				const auto resourceDesc = CD3DX12_RESOURCE_DESC::Tex2D (job->format,
+					job->width, job->height, 1, mipLevelCount);
+
+				if (FAILED (device_->CreateCommittedResource (&defaultHeapProperties,
+					D3D12_HEAP_FLAG_NONE,
+					&resourceDesc,
+					D3D12_RESOURCE_STATE_COPY_DEST,
+					nullptr,
+					IID_PPV_ARGS (&job->resource)))) {
+					throw std::runtime_error ("Could not create texture");
+				}
+
+				if (job->uploadBuffer) {
+					batch.AddStaged (job->resource.Get (), job->uploadBuffer.Get (),
+						job->uploadLayout, D3D12_RESOURCE_STATE_COMMON);
+				} else {
+					batch.Add (job->resource.Get (), job->subresources.data (),
+						mipLevelCount, D3D12_RESOURCE_STATE_COMMON);
+				}
+				submission->jobs.push_back (std::move (job));
+			} catch (...) {
+				Fail (*job, std::current_exception ());
+			}
+		} while (batch.GetUploadSize () < MAXIMUM_SUBMISSION_SIZE &&
+			uploadQueue_.TryPop (job));
+
+		if (batch.IsEmpty ()) {
+			continue;
+		}
+
+		// Blocks until the GPU is done with an earlier submission
+		freeAllocators_.Pop (submission->allocator);
+
+		try {
+			submission->allocator->Reset ();
+			copyCommandList_->Reset (submission->allocator.Get (), nullptr);
+			submission->uploadBuffer = batch.Record (device_.Get (), copyCommandList_.Get ());
+			copyCommandList_->Close ();
+		} catch (...) {
+			const auto error = std::current_exception ();
+			for (auto& failedJob : submission->jobs) {
+				Fail (*failedJob, error);
+			}
+
+			copyCommandList_->Close ();
+			freeAllocators_.Push (submission->allocator);
+			continue;
+		}
+
+		ID3D12CommandList* commandLists [] = { copyCommandList_.Get () };
+		copyQueue_->ExecuteCommandLists (std::extent<decltype(commandLists)>::value, commandLists);
+		copyQueue_->Signal (copyFence_.Get (), ++copyFenceValue_);
+		submission->fenceValue = copyFenceValue_;
+
+		// The source data has been copied into the upload buffer
+		for (auto& uploadedJob : submission->jobs) {
+			uploadedJob->cachedTexture.reset ();
+			uploadedJob->levels = std::vector<std::vector<std::uint8_t>> ();
+			uploadedJob->subresources = std::vector<D3D12_SUBRESOURCE_DATA> ();
+		}
+
+		retireQueue_.Push (submission);
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void AssetLoader::RunRetirer ()
+{
+	auto waitEvent = CreateEvent (nullptr, FALSE, FALSE, nullptr);
+
+	std::unique_ptr<Submission> submission;
+
+	while (retireQueue_.Pop (submission)) {
+		if (copyFence_->GetCompletedValue () < submission->fenceValue) {
+			copyFence_->SetEventOnCompletion (submission->fenceValue, waitEvent);
+			WaitForSingleObject (waitEvent, INFINITE);
+		}
+
+		for (auto& job : submission->jobs) {
+			stagingBudget_.Release (job->stagingSize);
+
+			std::vector<std::function<void ()>> callbacks;
+			{
+				std::lock_guard<std::mutex> lock (job->state->mutex);
+				job->state->resource = job->resource;
+				job->state->format = job->format;
+				job->state->mipLevelCount = static_cast<int> (job->resource->GetDesc ().MipLevels);
+				job->state->status = TextureHandle::Status::Ready;
+				callbacks.swap (job->state->callbacks);
+			}
+
+			NotifyDone (*job->state, callbacks);
+		}
+
+		freeAllocators_.Push (submission->allocator);
+	}
+
+	CloseHandle (waitEvent);
+}
+}
@@ -0,0 +1,238 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#ifndef ANTERU_D3D12_SAMPLE_ASSETLOADER_H_
+#define ANTERU_D3D12_SAMPLE_ASSETLOADER_H_
+
+#include "BoundedQueue.h"
+
+#include <d3d12.h>
+#include <wrl.h>
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace AMD {
+class AssetPack;
+class DiskCache;
+struct TextureLoadState;
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Completion handle for a texture load. Copies refer to the same load.
+
+The resource becomes available once the copy into it has finished executing
+on the GPU, so it can be used by any queue from then on. It is left in the
+COMMON state and gets promoted to a shader resource on first use.
+*/
+class TextureHandle
+{
+public:
+	enum class Status
+	{
+		Pending,
+		Ready,
+		Failed
+	};
+
+	Status GetStatus () const;
+
+	bool IsReady () const
+	{
+		return GetStatus () == Status::Ready;
+	}
+
+	/**
+	Block until the load is done. Rethrows the error if the load failed.
+	*/
+	void Wait () const;
+
+	/**
+	Call callback once the load is done, successfully or not. It runs on a
+	loader thread, or right away if the load is done already, so it should
+	only hand work off.
+	*/
+	void OnDone (std::function<void ()> callback) const;
+
+	/**
+	nullptr until the texture is ready.
+	*/
+	ID3D12Resource* GetResource () const;
+	DXGI_FORMAT GetFormat () const;
+	int GetMipLevelCount () const;
+
+private:
+	friend class AssetLoader;
+	std::shared_ptr<TextureLoadState> state_;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+struct TextureLoadOptions
+{
+	// Larger images are scaled down to fit
+	int maximumDimension = D3D12_REQ_TEXTURE2D_U_OR_V_DIMENSION;
+	// Compress to BC1/BC3 when the size allows it
+	bool blockCompression = true;
+	// Without mip-maps and block compression, opaque images which fit are
+	// decoded straight into their upload buffer
+	bool generateMips = true;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Bytes of staging memory in use. Acquire blocks while the budget is exhausted,
+except if nothing is in use, so a single asset larger than the budget can
+still be loaded.
+*/
+class StagingBudget
+{
+public:
+	explicit StagingBudget (const std::uint64_t budget)
+		: budget_ (budget)
+	{
+	}
+
+	void Acquire (const std::uint64_t size);
+	void Release (const std::uint64_t size);
+
+private:
+	const std::uint64_t budget_;
+	std::uint64_t used_ = 0;
+
+	std::mutex mutex_;
+	std::condition_variable released_;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Loads textures in the background through a pipeline of four stages:
+
+- I/O: read the file into memory
+- Decode: decode the image and fit it into the maximum size
+- Convert: premultiply alpha, generate mip-maps and block compress
+- Upload: create the resources and record the copies on a copy queue
+
+Each stage has its own threads, with bounded queues in between, so all
+stages work on different assets at the same time. Decoding and conversion
+use one thread per core. Before an asset gets decoded, its staging memory
+(decoded image, mip-maps and upload buffer) is reserved from the staging
+budget and only returned once the GPU copy has finished; this stalls the
+pipeline when too much data is in flight.
+
+With a disk cache, the converted texture is stored under the hash of the
+source bytes and the load options. Later loads of the same image skip
+decoding and conversion and upload straight from the memory-mapped cache
+entry.
+
+Supercompressed textures (see SupercompressedTexture.h) are transcoded to
+BC7 in the decode stage and skip conversion and the cache. They are uploaded
+as stored, so their color must be premultiplied by alpha already.
+
+Opaque images which need no conversion at all (no mip-maps, no block
+compression, no scaling) are decoded straight into their own upload buffer
+and skip conversion and the cache as well.
+
+The destructor finishes all loads that have been started.
+*/
+class AssetLoader
+{
+public:
+	AssetLoader (const AssetLoader&) = delete;
+	AssetLoader& operator= (const AssetLoader&) = delete;
+
+	/**
+	diskCache is optional and must outlive the loader.
+	*/
+	explicit AssetLoader (ID3D12Device* device, DiskCache* diskCache = nullptr,
+		const std::uint64_t stagingBudget = 256 << 20);
+	~AssetLoader ();
+
+	TextureHandle LoadTextureFromFile (const char* path,
+		const TextureLoadOptions& options = TextureLoadOptions ());
+
+	/**
+	data is not copied and must stay valid until the load has finished.
+	*/
+	TextureHandle LoadTextureFromMemory (const void* data, const std::size_t size,
+		const TextureLoadOptions& options = TextureLoadOptions ());
+
+	/**
+	Uncompressed entries are decoded straight from the mapping, compressed
+	ones are decompressed by the I/O stage. pack must stay valid until the
+	load has finished. Throws if there is no entry with this name.
+	*/
+	TextureHandle LoadTextureFromPack (const AssetPack& pack, const char* name,
+		const TextureLoadOptions& options = TextureLoadOptions ());
+
+private:
+	struct TextureJob;
+	struct Submission;
+
+	TextureHandle Enqueue (std::unique_ptr<TextureJob>& job);
+
+	void RunReader ();
+	void RunDecoder ();
+	void RunConverter ();
+	void RunUploader ();
+	void RunRetirer ();
+
+	void Fail (TextureJob& job, const std::exception_ptr& error);
+
+	bool LoadSupercompressed (TextureJob& job);
+	bool LoadIntoUploadBuffer (TextureJob& job);
+	bool LoadFromCache (TextureJob& job);
+	void StoreInCache (const TextureJob& job);
+
+	Microsoft::WRL::ComPtr<ID3D12Device> device_;
+	DiskCache* diskCache_;
+
+	StagingBudget stagingBudget_;
+
+	BoundedQueue<std::unique_ptr<TextureJob>> readQueue_;
+	BoundedQueue<std::unique_ptr<TextureJob>> decodeQueue_;
+	BoundedQueue<std::unique_ptr<TextureJob>> convertQueue_;
+	BoundedQueue<std::unique_ptr<TextureJob>> uploadQueue_;
+	// Uploads waiting for the GPU
+	BoundedQueue<std::unique_ptr<Submission>> retireQueue_;
+
+	Microsoft::WRL::ComPtr<ID3D12CommandQueue> copyQueue_;
+	Microsoft::WRL::ComPtr<ID3D12GraphicsCommandList> copyCommandList_;
+	// Allocators which are not in use by the GPU
+	BoundedQueue<Microsoft::WRL::ComPtr<ID3D12CommandAllocator>> freeAllocators_;
+	Microsoft::WRL::ComPtr<ID3D12Fence> copyFence_;
+	UINT64 copyFenceValue_ = 0;
+
+	std::vector<std::thread> readers_;
+	std::vector<std::thread> decoders_;
+	std::vector<std::thread> converters_;
+	std::thread uploader_;
+	std::thread retirer_;
+};
+}
+
+#endif
@@ -0,0 +1,257 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#include "AssetPack.h"
+
+#include "Hash.h"
+#include "Lz4.h"
+#include "Parallel.h"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+namespace AMD {
+namespace {
+const char ASSET_PACK_MAGIC [4] = { 'A', 'P', 'A', 'K' };
+const std::uint32_t ASSET_PACK_VERSION = 1;
+
+// Each byte of an LZ4 block produces at most 255 bytes of output, so larger
+// sizes cannot be right
+const std::uint64_t MAXIMUM_LZ4_RATIO = 255;
+
+bool CompareHash (const AssetPackEntry& entry, const std::uint64_t hash)
+{
+	return entry.nameHash < hash;
+}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AssetData::AssetData ()
+	: data_ (nullptr)
+	, size_ (0)
+{
+}
+
+///////////////////////////////////////////////////////////////////////////////
+const void* AssetData::GetData () const
+{
+	// Decompressed data is resolved on access, so copies stay valid
+	return storage_.empty () ? data_ : storage_.data ();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::size_t AssetData::GetSize () const
+{
+	return size_;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AssetPack::AssetPack (const char* filename)
+	: file_ (new MappedFile (filename))
+{
+	const auto size = file_->GetSize ();
+
+	if (size < sizeof (AssetPackHeader)) {
+		throw std::runtime_error ("Asset pack is truncated");
+	}
+
+	header_ = static_cast<const AssetPackHeader*> (file_->GetData ());
+
+	if (std::memcmp (header_->magic, ASSET_PACK_MAGIC, sizeof (header_->magic)) != 0 ||
+		header_->version != ASSET_PACK_VERSION) {
+		throw std::runtime_error ("Not an asset pack");
+	}
+
+	if (header_->alignment == 0 ||
+		header_->indexOffset % sizeof (std::uint64_t) != 0) {
+		throw std::runtime_error ("Asset pack is corrupt");
+	}
+
+	// GetRange throws if the index or the names do not fit
+	entries_ = reinterpret_cast<const AssetPackEntry*> (file_->GetRange (
+		static_cast<std::size_t> (header_->indexOffset),
+		sizeof (AssetPackEntry) * header_->entryCount).data);
+
+	if (header_->namesOffset > size) {
+		throw std::runtime_error ("Asset pack is corrupt");
+	}
+
+	names_ = static_cast<const std::uint8_t*> (file_->GetData ()) + header_->namesOffset;
+	const auto namesSize = size - static_cast<std::size_t> (header_->namesOffset);
+
+	for (std::uint32_t i = 0; i < header_->entryCount; ++i) {
+		const auto& entry = entries_ [i];
+
+		if ((i > 0 && entries_ [i - 1].nameHash > entry.nameHash) ||
+			static_cast<std::uint64_t> (entry.nameOffset) + entry.nameLength > namesSize ||
+			entry.offset > size || entry.storedSize > size - entry.offset ||
+			entry.offset % header_->alignment != 0 ||
+			entry.size > (std::numeric_limits<std::size_t>::max) ()) {
+			throw std::runtime_error ("Asset pack is corrupt");
+		}
+
+		switch (entry.compression) {
+		case AssetPackCompression::None:
+			if (entry.storedSize != entry.size) {
+				throw std::runtime_error ("Asset pack is corrupt");
+			}
+			break;
+
+		case AssetPackCompression::Lz4:
+			// Blocks end with a token, so they are never empty. Checked here,
+			// so a corrupt size does not turn into a huge allocation later
+			if (entry.storedSize == 0 ||
+				entry.size > entry.storedSize * MAXIMUM_LZ4_RATIO) {
+				throw std::runtime_error ("Asset pack is corrupt");
+			}
+			break;
+
+		default:
+			throw std::runtime_error ("Unknown asset pack compression");
+		}
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AssetPack::~AssetPack ()
+{
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int AssetPack::Find (const char* name) const
+{
+	const auto nameLength = std::strlen (name);
+	const auto hash = HashFNV1a (name, nameLength);
+
+	const auto end = entries_ + header_->entryCount;
+	for (auto entry = std::lower_bound (entries_, end, hash, CompareHash);
+		entry != end && entry->nameHash == hash; ++entry) {
+		// Compare the names as well, in case two of them collide
+		if (entry->nameLength == nameLength &&
+			std::memcmp (names_ + entry->nameOffset, name, nameLength) == 0) {
+			return static_cast<int> (entry - entries_);
+		}
+	}
+
+	return -1;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int AssetPack::GetEntryCount () const
+{
+	return static_cast<int> (header_->entryCount);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+const AssetPackEntry& AssetPack::GetEntry (const int index) const
+{
+	return entries_ [index];
+}
+
+///////////////////////////////////////////////////////////////////////////////
+ByteRange AssetPack::GetName (const int index) const
+{
+	const ByteRange result = { names_ + entries_ [index].nameOffset,
+		entries_ [index].nameLength };
+	return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+ByteRange AssetPack::GetStoredData (const int index) const
+{
+	return file_->GetRange (static_cast<std::size_t> (entries_ [index].offset),
+		static_cast<std::size_t> (entries_ [index].storedSize));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void AssetPack::LoadInto (const int index, void* destination,
+	const std::size_t size) const
+{
+	const auto& entry = entries_ [index];
+	const auto stored = GetStoredData (index);
+
+	if (size != entry.size) {
+		throw std::runtime_error ("Destination size does not match the asset size");
+	}
+
+	if (entry.compression == AssetPackCompression::None) {
+		std::memcpy (destination, stored.data, stored.size);
+	} else {
+		Lz4Decompress (stored.data, stored.size, destination, size);
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AssetData AssetPack::Load (const int index) const
+{
+	const auto& entry = entries_ [index];
+
+	AssetData result;
+	result.size_ = static_cast<std::size_t> (entry.size);
+
+	if (entry.compression == AssetPackCompression::None) {
+		result.data_ = GetStoredData (index).data;
+	} else {
+		result.storage_.resize (result.size_);
+		LoadInto (index, result.storage_.data (), result.size_);
+	}
+
+	return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AssetData AssetPack::Load (const char* name) const
+{
+	const auto index = Find (name);
+
+	if (index < 0) {
+		throw std::runtime_error (std::string ("Asset not found: ") + name);
+	}
+
+	return Load (index);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::vector<AssetData> AssetPack::Load (const std::vector<int>& indices) const
+{
+	const auto count = static_cast<int> (indices.size ());
+
+	// Start reading everything, so the decompression below does not wait for
+	// one page fault after the other
+	for (const auto index : indices) {
+		file_->Prefetch (static_cast<std::size_t> (entries_ [index].offset),
+			static_cast<std::size_t> (entries_ [index].storedSize));
+	}
+
+	std::vector<AssetData> result (count);
+	ParallelFor (count, 1, [&] (const int begin, const int end) {
+		for (int i = begin; i < end; ++i) {
+			result [i] = Load (indices [i]);
+		}
+	});
+
+	return result;
+}
+}
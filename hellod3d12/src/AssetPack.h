@@ -0,0 +1,157 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#ifndef ANTERU_D3D12_SAMPLE_ASSETPACK_H_
+#define ANTERU_D3D12_SAMPLE_ASSETPACK_H_
+
+#include "Utility.h"
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace AMD {
+///////////////////////////////////////////////////////////////////////////////
+/**
+Asset packs are written by tools/packAssets.py. All values are little-endian.
+
+The header is followed by the index, sorted by name hash, and the names. The
+entry data comes last, each entry starts at a multiple of the alignment stored
+in the header, so uncompressed entries can be used in place from the mapping.
+*/
+struct AssetPackHeader
+{
+	char magic [4];
+	std::uint32_t version;
+	std::uint32_t entryCount;
+	std::uint32_t alignment;
+	std::uint64_t indexOffset;
+	std::uint64_t namesOffset;
+};
+
+enum class AssetPackCompression : std::uint32_t
+{
+	None,
+	Lz4
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+nameHash is HashFNV1a of the name, names are relative paths using forward
+slashes. The name is not zero terminated.
+*/
+struct AssetPackEntry
+{
+	std::uint64_t nameHash;
+	std::uint64_t offset;
+	std::uint64_t storedSize;
+	std::uint64_t size;
+	std::uint32_t nameOffset;
+	std::uint32_t nameLength;
+	AssetPackCompression compression;
+	std::uint32_t reserved;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+The contents of one asset. Uncompressed entries point into the pack mapping,
+which must outlive this object; compressed ones own their decompressed data.
+*/
+class AssetData
+{
+public:
+	AssetData ();
+
+	const void* GetData () const;
+	std::size_t GetSize () const;
+
+private:
+	friend class AssetPack;
+
+	const void* data_;
+	std::size_t size_;
+	std::vector<std::uint8_t> storage_;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Read-only access to a memory-mapped asset pack. Lookups are a binary search
+over the mapped index, nothing is read until an entry is accessed. All
+methods are const and can be called from several threads at once.
+
+The contents can be passed straight to the memory loaders, for instance:
+
+	const auto image = pack.Load ("ruby.jpg");
+	LoadImageFromMemory (image.GetData (), image.GetSize (), ...);
+*/
+class AssetPack
+{
+public:
+	AssetPack (const AssetPack&) = delete;
+	AssetPack& operator= (const AssetPack&) = delete;
+
+	explicit AssetPack (const char* filename);
+	~AssetPack ();
+
+	/**
+	Index of the entry with this name, or -1 if there is none.
+	*/
+	int Find (const char* name) const;
+
+	int GetEntryCount () const;
+	const AssetPackEntry& GetEntry (const int index) const;
+	ByteRange GetName (const int index) const;
+
+	/**
+	The stored bytes of an entry, which are compressed unless the entry's
+	compression is None.
+	*/
+	ByteRange GetStoredData (const int index) const;
+
+	/**
+	Decompress an entry into caller-provided memory, for instance a mapped
+	upload buffer. size must match the entry size.
+	*/
+	void LoadInto (const int index, void* destination, const std::size_t size) const;
+
+	AssetData Load (const int index) const;
+
+	/**
+	Throws if there is no entry with this name.
+	*/
+	AssetData Load (const char* name) const;
+
+	/**
+	Load several entries at once. The pages of all entries are prefetched
+	up front, and compressed entries are decompressed in parallel.
+	*/
+	std::vector<AssetData> Load (const std::vector<int>& indices) const;
+
+private:
+	std::unique_ptr<MappedFile> file_;
+	const AssetPackHeader* header_;
+	const AssetPackEntry* entries_;
+	const std::uint8_t* names_;
+};
+}
+
+#endif
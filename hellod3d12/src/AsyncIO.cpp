@@ -0,0 +1,770 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#include "AsyncIO.h"
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#ifdef _WIN32
+#include <Windows.h>
+#include <malloc.h>
+#else
+#include <fcntl.h>
+#include <stdlib.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#ifdef __linux__
+#if __has_include (<linux/io_uring.h>)
+#define AMD_HAVE_IO_URING 1
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <cerrno>
+#endif
+#endif
+
+namespace AMD {
+///////////////////////////////////////////////////////////////////////////////
+AlignedBuffer::AlignedBuffer (const std::size_t size, const std::size_t alignment)
+	: size_ (size)
+{
+#ifdef _WIN32
+	data_ = static_cast<std::uint8_t*> (::_aligned_malloc (size, alignment));
+#else
+	void* data = nullptr;
+	if (::posix_memalign (&data, alignment, size) != 0) {
+		data = nullptr;
+	}
+	data_ = static_cast<std::uint8_t*> (data);
+#endif
+
+	if (data_ == nullptr) {
+		throw std::runtime_error ("Could not allocate aligned buffer");
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AlignedBuffer::~AlignedBuffer ()
+{
+#ifdef _WIN32
+	::_aligned_free (data_);
+#else
+	::free (data_);
+#endif
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AsyncFile::AsyncFile (const char* filename, const bool directIo)
+	: directIo_ (directIo)
+{
+#ifdef _WIN32
+	const auto handle = ::CreateFileA (filename, GENERIC_READ, FILE_SHARE_READ, nullptr,
+		OPEN_EXISTING, directIo ? FILE_FLAG_NO_BUFFERING : FILE_ATTRIBUTE_NORMAL, nullptr);
+
+	if (handle == INVALID_HANDLE_VALUE) {
+		throw std::runtime_error ("Could not open file");
+	}
+
+	LARGE_INTEGER fileSize;
+	::GetFileSizeEx (handle, &fileSize);
+
+	handle_ = reinterpret_cast<std::intptr_t> (handle);
+	size_ = static_cast<std::uint64_t> (fileSize.QuadPart);
+#else
+	int flags = O_RDONLY;
+#ifdef O_DIRECT
+	if (directIo) {
+		flags |= O_DIRECT;
+	}
+#endif
+
+	const int fd = ::open (filename, flags);
+
+	if (fd == -1) {
+		throw std::runtime_error ("Could not open file");
+	}
+
+	struct stat fileStatus;
+	if (::fstat (fd, &fileStatus) != 0) {
+		::close (fd);
+		throw std::runtime_error ("Could not query file size");
+	}
+
+	handle_ = fd;
+	size_ = static_cast<std::uint64_t> (fileStatus.st_size);
+#endif
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AsyncFile::~AsyncFile ()
+{
+#ifdef _WIN32
+	::CloseHandle (reinterpret_cast<HANDLE> (handle_));
+#else
+	::close (static_cast<int> (handle_));
+#endif
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Common part of all backends: tracks the number of requests in flight, so
+submission can block once the queue is full, and the number of callbacks
+which have not returned yet, so WaitIdle has something to wait on.
+*/
+class AsyncIOBackend
+{
+public:
+	struct Request
+	{
+		std::intptr_t handle;
+		void* buffer;
+		std::uint64_t offset;
+		std::size_t size;
+		// Reads stop here even if the file returns less than asked for
+		std::uint64_t fileSize;
+		AsyncIOEngine::Callback callback;
+		// Bytes read so far, if the read takes several calls
+		std::size_t bytesRead = 0;
+	};
+
+	explicit AsyncIOBackend (const int queueDepth)
+		: queueDepth_ (queueDepth)
+	{
+	}
+
+	virtual ~AsyncIOBackend ()
+	{
+	}
+
+	virtual AsyncIOEngine::Backend GetType () const = 0;
+
+	virtual void RegisterBuffer (void* /* buffer */, const std::size_t /* size */)
+	{
+	}
+
+	void Submit (Request request)
+	{
+		{
+			std::unique_lock<std::mutex> lock (inFlightMutex_);
+			inFlightChanged_.wait (lock, [this] () {
+				return inFlight_ < queueDepth_;
+			});
+			++inFlight_;
+			++pending_;
+		}
+
+		SubmitImpl (std::move (request));
+	}
+
+	void WaitIdle ()
+	{
+		std::unique_lock<std::mutex> lock (inFlightMutex_);
+		inFlightChanged_.wait (lock, [this] () {
+			return pending_ == 0;
+		});
+	}
+
+protected:
+	/**
+	Must be called exactly once per submitted request, from any thread.
+	*/
+	void Complete (Request& request, const std::size_t bytesRead, const bool success)
+	{
+		// Free the slot first: the callback may submit the next read, which
+		// would wait forever on a full queue otherwise
+		{
+			std::lock_guard<std::mutex> lock (inFlightMutex_);
+			--inFlight_;
+		}
+
+		inFlightChanged_.notify_all ();
+
+		request.callback (bytesRead, success);
+
+		{
+			std::lock_guard<std::mutex> lock (inFlightMutex_);
+			--pending_;
+		}
+
+		inFlightChanged_.notify_all ();
+	}
+
+	virtual void SubmitImpl (Request request) = 0;
+
+	const int queueDepth_;
+
+private:
+	std::mutex inFlightMutex_;
+	std::condition_variable inFlightChanged_;
+	int inFlight_ = 0;
+	// Requests whose callback has not returned yet
+	int pending_ = 0;
+};
+
+namespace {
+///////////////////////////////////////////////////////////////////////////////
+/**
+Blocking positional reads on a set of I/O threads. The number of threads
+determines how many reads are actually in flight at the device.
+*/
+class ThreadPoolBackend : public AsyncIOBackend
+{
+public:
+	explicit ThreadPoolBackend (const int queueDepth)
+		: AsyncIOBackend (queueDepth)
+	{
+		// Beyond this, more threads only add contention
+		const int maximumThreadCount = 32;
+		const int threadCount = (std::min) (queueDepth, maximumThreadCount);
+
+		for (int i = 0; i < threadCount; ++i) {
+			threads_.emplace_back ([this] () {
+				Run ();
+			});
+		}
+	}
+
+	~ThreadPoolBackend ()
+	{
+		{
+			std::lock_guard<std::mutex> lock (queueMutex_);
+			stop_ = true;
+		}
+
+		queueChanged_.notify_all ();
+
+		for (auto& thread : threads_) {
+			thread.join ();
+		}
+	}
+
+	AsyncIOEngine::Backend GetType () const override
+	{
+		return AsyncIOEngine::Backend::ThreadPool;
+	}
+
+private:
+	void SubmitImpl (Request request) override
+	{
+		{
+			std::lock_guard<std::mutex> lock (queueMutex_);
+			queue_.push_back (std::move (request));
+		}
+
+		queueChanged_.notify_one ();
+	}
+
+	void Run ()
+	{
+		for (;;) {
+			Request request;
+
+			{
+				std::unique_lock<std::mutex> lock (queueMutex_);
+				queueChanged_.wait (lock, [this] () {
+					return stop_ || !queue_.empty ();
+				});
+
+				// Drain the queue before stopping
+				if (queue_.empty ()) {
+					return;
+				}
+
+				request = std::move (queue_.front ());
+				queue_.pop_front ();
+			}
+
+			std::size_t bytesRead = 0;
+			const bool success = ReadAt (request, &bytesRead);
+			Complete (request, bytesRead, success);
+		}
+	}
+
+	static bool ReadAt (const Request& request, std::size_t* bytesRead)
+	{
+		auto output = static_cast<std::uint8_t*> (request.buffer);
+
+		// A single call can return less than requested, keep going until
+		// we hit the end of the file
+		while (*bytesRead < request.size &&
+			request.offset + *bytesRead < request.fileSize) {
+			const auto offset = request.offset + *bytesRead;
+			const auto remaining = request.size - *bytesRead;
+
+#ifdef _WIN32
+			OVERLAPPED overlapped = {};
+			overlapped.Offset = static_cast<DWORD> (offset);
+			overlapped.OffsetHigh = static_cast<DWORD> (offset >> 32);
+
+			DWORD count = 0;
+			const DWORD toRead = static_cast<DWORD> ((std::min) (remaining,
+				static_cast<std::size_t> (1u << 30)));
+
+			if (!::ReadFile (reinterpret_cast<HANDLE> (request.handle),
+				output + *bytesRead, toRead, &count, &overlapped)) {
+				return ::GetLastError () == ERROR_HANDLE_EOF;
+			}
+#else
+			const auto count = ::pread (static_cast<int> (request.handle),
+				output + *bytesRead, remaining, static_cast<off_t> (offset));
+
+			if (count < 0) {
+				return false;
+			}
+#endif
+
+			if (count == 0) {
+				break;
+			}
+
+			*bytesRead += static_cast<std::size_t> (count);
+		}
+
+		return true;
+	}
+
+	std::vector<std::thread> threads_;
+	std::mutex queueMutex_;
+	std::condition_variable queueChanged_;
+	std::deque<Request> queue_;
+	bool stop_ = false;
+};
+
+#ifdef AMD_HAVE_IO_URING
+// Per queue entry, the length is only 32 bits
+static const std::size_t MAXIMUM_READ_SIZE = 1 << 30;
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+io_uring through the raw system calls, so we don't depend on liburing.
+
+Requests are written into the submission queue by the submitting thread;
+a completion thread waits on the completion queue and runs the callbacks.
+The queue depth limit in the base class guarantees we never have more
+requests in flight than there are queue entries.
+
+Each queue entry reads at most MAXIMUM_READ_SIZE bytes. Reads which come back short before the end of the
+file, and larger reads, are resubmitted from the completion thread for the
+remaining bytes; they keep their slot in the meantime.
+*/
+class IoUringBackend : public AsyncIOBackend
+{
+public:
+	/**
+	Returns nullptr if io_uring is not supported, for instance because the
+	kernel is too old or the system call is blocked. IORING_OP_READ needs
+	Linux 5.6; older kernels have io_uring but fail every read with EINVAL.
+	*/
+	static std::unique_ptr<AsyncIOBackend> Create (const int queueDepth)
+	{
+		std::unique_ptr<IoUringBackend> backend (new IoUringBackend (queueDepth));
+
+		if (!backend->Initialize ()) {
+			return nullptr;
+		}
+
+		return std::unique_ptr<AsyncIOBackend> (backend.release ());
+	}
+
+	~IoUringBackend ()
+	{
+		if (completionThread_.joinable ()) {
+			// All requests are done, the no-op wakes up the completion
+			// thread which then exits
+			WaitIdle ();
+			std::lock_guard<std::mutex> lock (submitMutex_);
+			io_uring_sqe* sqe = GetNextSqe ();
+			sqe->opcode = IORING_OP_NOP;
+			sqe->user_data = 0;
+			SubmitSqes (1);
+			completionThread_.join ();
+		}
+
+		if (sqes_) {
+			::munmap (sqes_, sqesSize_);
+		}
+
+		if (cqRing_ && cqRing_ != sqRing_) {
+			::munmap (cqRing_, cqRingSize_);
+		}
+
+		if (sqRing_) {
+			::munmap (sqRing_, sqRingSize_);
+		}
+
+		if (ringFd_ != -1) {
+			::close (ringFd_);
+		}
+	}
+
+	AsyncIOEngine::Backend GetType () const override
+	{
+		return AsyncIOEngine::Backend::IoUring;
+	}
+
+	void RegisterBuffer (void* buffer, const std::size_t size) override
+	{
+		if (!registeredBuffers_.empty ()) {
+			throw std::runtime_error ("Only one buffer can be registered");
+		}
+
+		iovec vector;
+		vector.iov_base = buffer;
+		vector.iov_len = size;
+
+		if (::syscall (__NR_io_uring_register, ringFd_,
+			IORING_REGISTER_BUFFERS, &vector, 1) != 0) {
+			throw std::runtime_error ("Could not register buffer");
+		}
+
+		registeredBuffers_.push_back (vector);
+	}
+
+private:
+	explicit IoUringBackend (const int queueDepth)
+		: AsyncIOBackend (queueDepth)
+	{
+	}
+
+	bool Initialize ()
+	{
+		io_uring_params params = {};
+		ringFd_ = static_cast<int> (::syscall (__NR_io_uring_setup,
+			static_cast<unsigned> (queueDepth_), &params));
+
+		if (ringFd_ < 0) {
+			ringFd_ = -1;
+			return false;
+		}
+
+		sqRingSize_ = params.sq_off.array + params.sq_entries * sizeof (unsigned);
+		cqRingSize_ = params.cq_off.cqes + params.cq_entries * sizeof (io_uring_cqe);
+
+		const bool singleMapping = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+		if (singleMapping) {
+			sqRingSize_ = cqRingSize_ = (std::max) (sqRingSize_, cqRingSize_);
+		}
+
+		sqRing_ = Map (sqRingSize_, IORING_OFF_SQ_RING);
+		if (sqRing_ == nullptr) {
+			return false;
+		}
+
+		cqRing_ = singleMapping ? sqRing_ : Map (cqRingSize_, IORING_OFF_CQ_RING);
+		if (cqRing_ == nullptr) {
+			return false;
+		}
+
+		sqesSize_ = params.sq_entries * sizeof (io_uring_sqe);
+		sqes_ = static_cast<io_uring_sqe*> (Map (sqesSize_, IORING_OFF_SQES));
+		if (sqes_ == nullptr) {
+			return false;
+		}
+
+		auto sq = static_cast<std::uint8_t*> (sqRing_);
+		sqTail_ = reinterpret_cast<unsigned*> (sq + params.sq_off.tail);
+		sqMask_ = *reinterpret_cast<unsigned*> (sq + params.sq_off.ring_mask);
+		sqArray_ = reinterpret_cast<unsigned*> (sq + params.sq_off.array);
+
+		auto cq = static_cast<std::uint8_t*> (cqRing_);
+		cqHead_ = reinterpret_cast<unsigned*> (cq + params.cq_off.head);
+		cqTail_ = reinterpret_cast<unsigned*> (cq + params.cq_off.tail);
+		cqMask_ = *reinterpret_cast<unsigned*> (cq + params.cq_off.ring_mask);
+		cqes_ = reinterpret_cast<io_uring_cqe*> (cq + params.cq_off.cqes);
+
+		if (!IsReadSupported ()) {
+			return false;
+		}
+
+		completionThread_ = std::thread ([this] () {
+			RunCompletions ();
+		});
+
+		return true;
+	}
+
+	/**
+	IORING_REGISTER_PROBE came with the same kernel as IORING_OP_READ, so if
+	probing fails, reads are not supported either.
+	*/
+	bool IsReadSupported () const
+	{
+		const unsigned operationCount = 256;
+		std::vector<std::uint8_t> storage (sizeof (io_uring_probe) +
+			operationCount * sizeof (io_uring_probe_op));
+		auto probe = reinterpret_cast<io_uring_probe*> (storage.data ());
+
+		if (::syscall (__NR_io_uring_register, ringFd_,
+			IORING_REGISTER_PROBE, probe, operationCount) != 0) {
+			return false;
+		}
+
+		return IORING_OP_READ <= probe->last_op &&
+			(probe->ops [IORING_OP_READ].flags & IO_URING_OP_SUPPORTED) != 0;
+	}
+
+	void* Map (const std::size_t size, const std::uint64_t offset)
+	{
+		void* result = ::mmap (nullptr, size, PROT_READ | PROT_WRITE,
+			MAP_SHARED | MAP_POPULATE, ringFd_, static_cast<off_t> (offset));
+		return (result == MAP_FAILED) ? nullptr : result;
+	}
+
+	io_uring_sqe* GetNextSqe ()
+	{
+		const unsigned tail = *sqTail_;
+		const unsigned index = tail & sqMask_;
+
+		io_uring_sqe* sqe = &sqes_ [index];
+		*sqe = io_uring_sqe ();
+		sqArray_ [index] = index;
+
+		// Published by SubmitSqes
+		pendingTail_ = tail + 1;
+		return sqe;
+	}
+
+	void SubmitSqes (const unsigned count)
+	{
+		__atomic_store_n (sqTail_, pendingTail_, __ATOMIC_RELEASE);
+		::syscall (__NR_io_uring_enter, ringFd_, count, 0, 0, nullptr, 0);
+	}
+
+	void SubmitImpl (Request request) override
+	{
+		// Owned by the ring until the completion comes back
+		SubmitRead (new Request (std::move (request)));
+	}
+
+	/**
+	Queue the next part of pending, starting at pending->bytesRead.
+	*/
+	void SubmitRead (Request* pending)
+	{
+		const auto buffer = static_cast<std::uint8_t*> (pending->buffer) + pending->bytesRead;
+		const auto size = (std::min) (pending->size - pending->bytesRead, MAXIMUM_READ_SIZE);
+
+		std::lock_guard<std::mutex> lock (submitMutex_);
+		io_uring_sqe* sqe = GetNextSqe ();
+
+		sqe->opcode = IORING_OP_READ;
+		sqe->fd = static_cast<int> (pending->handle);
+		sqe->addr = reinterpret_cast<std::uint64_t> (buffer);
+		sqe->len = static_cast<unsigned> (size);
+		sqe->off = pending->offset + pending->bytesRead;
+		sqe->user_data = reinterpret_cast<std::uint64_t> (pending);
+
+		// Reads which land in the registered buffer skip the page pinning
+		for (std::size_t i = 0; i < registeredBuffers_.size (); ++i) {
+			const auto begin = static_cast<std::uint8_t*> (registeredBuffers_ [i].iov_base);
+			const auto end = begin + registeredBuffers_ [i].iov_len;
+
+			if (buffer >= begin && buffer + size <= end) {
+				sqe->opcode = IORING_OP_READ_FIXED;
+				sqe->buf_index = static_cast<std::uint16_t> (i);
+				break;
+			}
+		}
+
+		SubmitSqes (1);
+	}
+
+	void RunCompletions ()
+	{
+		for (;;) {
+			unsigned head = *cqHead_;
+			const unsigned tail = __atomic_load_n (cqTail_, __ATOMIC_ACQUIRE);
+
+			if (head == tail) {
+				const auto result = ::syscall (__NR_io_uring_enter, ringFd_, 0, 1,
+					IORING_ENTER_GETEVENTS, nullptr, 0);
+
+				if (result < 0 && errno != EINTR) {
+					return;
+				}
+
+				continue;
+			}
+
+			bool stop = false;
+			for (; head != tail; ++head) {
+				const io_uring_cqe& cqe = cqes_ [head & cqMask_];
+
+				if (cqe.user_data == 0) {
+					stop = true;
+					continue;
+				}
+
+				std::unique_ptr<Request> request (
+					reinterpret_cast<Request*> (cqe.user_data));
+				const int result = cqe.res;
+
+				// Free the queue entry before the callback runs, it may
+				// submit new reads
+				__atomic_store_n (cqHead_, head + 1, __ATOMIC_RELEASE);
+
+				if (result < 0) {
+					Complete (*request, 0, false);
+					continue;
+				}
+
+				request->bytesRead += static_cast<std::size_t> (result);
+
+				// Nothing returned means end of file; the file size check
+				// avoids an unaligned read at the end of direct files
+				if (result > 0 && request->bytesRead < request->size &&
+					request->offset + request->bytesRead < request->fileSize) {
+					SubmitRead (request.release ());
+				} else {
+					Complete (*request, request->bytesRead, true);
+				}
+			}
+
+			__atomic_store_n (cqHead_, head, __ATOMIC_RELEASE);
+
+			if (stop) {
+				return;
+			}
+		}
+	}
+
+	int ringFd_ = -1;
+	void* sqRing_ = nullptr;
+	void* cqRing_ = nullptr;
+	io_uring_sqe* sqes_ = nullptr;
+	std::size_t sqRingSize_ = 0;
+	std::size_t cqRingSize_ = 0;
+	std::size_t sqesSize_ = 0;
+
+	unsigned* sqTail_ = nullptr;
+	unsigned* sqArray_ = nullptr;
+	unsigned sqMask_ = 0;
+	unsigned pendingTail_ = 0;
+
+	unsigned* cqHead_ = nullptr;
+	unsigned* cqTail_ = nullptr;
+	unsigned cqMask_ = 0;
+	io_uring_cqe* cqes_ = nullptr;
+
+	std::vector<iovec> registeredBuffers_;
+	std::mutex submitMutex_;
+	std::thread completionThread_;
+};
+#endif
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AsyncIOEngine::AsyncIOEngine (const int queueDepth, const Backend preferredBackend)
+{
+	if (queueDepth <= 0) {
+		throw std::runtime_error ("Queue depth must be positive");
+	}
+
+#ifdef AMD_HAVE_IO_URING
+	if (preferredBackend == Backend::IoUring) {
+		backend_ = IoUringBackend::Create (queueDepth);
+	}
+#else
+	(void) preferredBackend;
+#endif
+
+	if (!backend_) {
+		backend_.reset (new ThreadPoolBackend (queueDepth));
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AsyncIOEngine::~AsyncIOEngine ()
+{
+	backend_->WaitIdle ();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AsyncIOEngine::Backend AsyncIOEngine::GetBackend () const
+{
+	return backend_->GetType ();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void AsyncIOEngine::RegisterBuffer (void* buffer, const std::size_t size)
+{
+	backend_->RegisterBuffer (buffer, size);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void AsyncIOEngine::Read (const AsyncFile& file, void* buffer,
+	const std::uint64_t offset, const std::size_t size,
+	Callback callback)
+{
+	if (file.IsDirect () && (
+		reinterpret_cast<std::uintptr_t> (buffer) % DIRECT_IO_ALIGNMENT != 0 ||
+		offset % DIRECT_IO_ALIGNMENT != 0 ||
+		size % DIRECT_IO_ALIGNMENT != 0)) {
+		throw std::runtime_error ("Direct reads must be aligned");
+	}
+
+	AsyncIOBackend::Request request;
+	request.handle = file.GetNativeHandle ();
+	request.buffer = buffer;
+	request.offset = offset;
+	request.size = size;
+	request.fileSize = file.GetSize ();
+	request.callback = std::move (callback);
+
+	backend_->Submit (std::move (request));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::future<std::size_t> AsyncIOEngine::Read (const AsyncFile& file, void* buffer,
+	const std::uint64_t offset, const std::size_t size)
+{
+	// std::function needs a copyable callable, so share the promise
+	auto promise = std::make_shared<std::promise<std::size_t>> ();
+	auto result = promise->get_future ();
+
+	Read (file, buffer, offset, size, [promise] (const std::size_t bytesRead,
+		const bool success) -> void {
+		if (success) {
+			promise->set_value (bytesRead);
+		} else {
+			promise->set_exception (std::make_exception_ptr (
+				std::runtime_error ("Asynchronous read failed")));
+		}
+	});
+
+	return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void AsyncIOEngine::WaitIdle ()
+{
+	backend_->WaitIdle ();
+}
+}
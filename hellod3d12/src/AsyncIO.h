@@ -0,0 +1,179 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#ifndef ANTERU_D3D12_SAMPLE_ASYNCIO_H_
+#define ANTERU_D3D12_SAMPLE_ASYNCIO_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <memory>
+
+namespace AMD {
+///////////////////////////////////////////////////////////////////////////////
+/**
+Unbuffered (direct) reads must use buffers, offsets and sizes which are
+multiples of this.
+*/
+static const std::size_t DIRECT_IO_ALIGNMENT = 4096;
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Heap memory with a given alignment, for direct reads into staging memory.
+*/
+class AlignedBuffer
+{
+public:
+	AlignedBuffer (const AlignedBuffer&) = delete;
+	AlignedBuffer& operator= (const AlignedBuffer&) = delete;
+
+	AlignedBuffer (const std::size_t size,
+		const std::size_t alignment = DIRECT_IO_ALIGNMENT);
+	~AlignedBuffer ();
+
+	std::uint8_t* GetData () const
+	{
+		return data_;
+	}
+
+	std::size_t GetSize () const
+	{
+		return size_;
+	}
+
+private:
+	std::uint8_t* data_;
+	std::size_t size_;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+A file opened for asynchronous reads. With directIo set, reads bypass the OS
+file cache (O_DIRECT, FILE_FLAG_NO_BUFFERING), which requires every read to
+be DIRECT_IO_ALIGNMENT aligned.
+*/
+class AsyncFile
+{
+public:
+	AsyncFile (const AsyncFile&) = delete;
+	AsyncFile& operator= (const AsyncFile&) = delete;
+
+	explicit AsyncFile (const char* filename, const bool directIo = false);
+	~AsyncFile ();
+
+	std::uint64_t GetSize () const
+	{
+		return size_;
+	}
+
+	bool IsDirect () const
+	{
+		return directIo_;
+	}
+
+	/**
+	File descriptor on POSIX, HANDLE on Windows.
+	*/
+	std::intptr_t GetNativeHandle () const
+	{
+		return handle_;
+	}
+
+private:
+	std::intptr_t handle_;
+	std::uint64_t size_;
+	bool directIo_;
+};
+
+class AsyncIOBackend;
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Asynchronous positional reads with many requests in flight.
+
+On Linux, io_uring is used if the kernel supports it (5.6 or later),
+submitting requests directly from the calling thread. Everywhere else, or if
+io_uring is not available, a pool of I/O threads performs blocking
+positional reads.
+
+Completion callbacks are invoked on an internal I/O thread and must not
+block for long. They may issue further reads. The engine must outlive all files and buffers used in reads
+that are still in flight; the destructor waits for all of them.
+*/
+class AsyncIOEngine
+{
+public:
+	enum class Backend
+	{
+		ThreadPool,
+		IoUring
+	};
+
+	/**
+	bytesRead can be less than requested when reading past the end of the
+	file. success is false if the read failed.
+	*/
+	typedef std::function<void (const std::size_t bytesRead, const bool success)> Callback;
+
+	AsyncIOEngine (const AsyncIOEngine&) = delete;
+	AsyncIOEngine& operator= (const AsyncIOEngine&) = delete;
+
+	/**
+	queueDepth is the maximum number of reads in flight, further reads
+	block until a slot frees up.
+	*/
+	explicit AsyncIOEngine (const int queueDepth = 64,
+		const Backend preferredBackend = Backend::IoUring);
+	~AsyncIOEngine ();
+
+	Backend GetBackend () const;
+
+	/**
+	Register a buffer with the kernel once, so reads into it don't have to
+	map the pages for every request. Only has an effect with io_uring, and
+	must be called before the first read.
+	*/
+	void RegisterBuffer (void* buffer, const std::size_t size);
+
+	void Read (const AsyncFile& file, void* buffer,
+		const std::uint64_t offset, const std::size_t size,
+		Callback callback);
+
+	/**
+	The future throws a std::runtime_error if the read failed.
+	*/
+	std::future<std::size_t> Read (const AsyncFile& file, void* buffer,
+		const std::uint64_t offset, const std::size_t size);
+
+	/**
+	Block until all reads issued so far have completed and their callbacks
+	have returned.
+	*/
+	void WaitIdle ();
+
+private:
+	std::unique_ptr<AsyncIOBackend> backend_;
+};
+}
+
+#endif
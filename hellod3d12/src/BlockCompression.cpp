@@ -0,0 +1,766 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#include "BlockCompression.h"
+
+#include "Parallel.h"
+
+#include <cmath>
+#include <cstring>
+#include <stdexcept>
+#include <emmintrin.h>
+
+namespace AMD {
+namespace {
+///////////////////////////////////////////////////////////////////////////////
+/**
+One 4x4 block as floats in 0..255, four channels per texel.
+*/
+struct Block
+{
+	float texels [16][4];
+};
+
+///////////////////////////////////////////////////////////////////////////////
+void LoadBlock (const std::uint8_t* data, const int width, const int height,
+	const std::size_t rowPitch, const int blockX, const int blockY, Block& block)
+{
+	for (int y = 0; y < 4; ++y) {
+		const int sourceY = (std::min) (blockY * 4 + y, height - 1);
+
+		for (int x = 0; x < 4; ++x) {
+			const int sourceX = (std::min) (blockX * 4 + x, width - 1);
+			const std::uint8_t* texel = data + sourceY * rowPitch + sourceX * 4;
+
+			for (int c = 0; c < 4; ++c) {
+				block.texels [y * 4 + x][c] = texel [c];
+			}
+		}
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+float SquaredDistance (const __m128 a, const __m128 b)
+{
+	const __m128 d = _mm_sub_ps (a, b);
+	const __m128 d2 = _mm_mul_ps (d, d);
+	const __m128 s = _mm_add_ps (d2, _mm_movehl_ps (d2, d2));
+	return _mm_cvtss_f32 (_mm_add_ss (s, _mm_shuffle_ps (s, s, 1)));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Find the closest palette entry for every texel and return the total error.
+channelMask zeroes channels which must not contribute, for instance alpha
+for BC1/BC3 colors.
+*/
+float AssignIndices (const Block& block, const __m128* palette, const int paletteSize,
+	const __m128 channelMask, int* indices)
+{
+	float totalError = 0;
+
+	for (int i = 0; i < 16; ++i) {
+		const __m128 texel = _mm_and_ps (_mm_loadu_ps (block.texels [i]), channelMask);
+
+		float bestError = SquaredDistance (texel, _mm_and_ps (palette [0], channelMask));
+		int bestIndex = 0;
+
+		for (int p = 1; p < paletteSize; ++p) {
+			const float error = SquaredDistance (texel, _mm_and_ps (palette [p], channelMask));
+			if (error < bestError) {
+				bestError = error;
+				bestIndex = p;
+			}
+		}
+
+		indices [i] = bestIndex;
+		totalError += bestError;
+	}
+
+	return totalError;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Compute endpoints along the principal axis of the texels. With
+useBoundingBox, the per-channel minimum/maximum is used instead, which is
+cheaper but less accurate.
+*/
+void ComputeEndpoints (const Block& block, const int channelCount,
+	const bool useBoundingBox, float* endpoint0, float* endpoint1)
+{
+	if (useBoundingBox) {
+		for (int c = 0; c < channelCount; ++c) {
+			float minimum = 255, maximum = 0;
+			for (int i = 0; i < 16; ++i) {
+				minimum = (std::min) (minimum, block.texels [i][c]);
+				maximum = (std::max) (maximum, block.texels [i][c]);
+			}
+
+			// Inset a bit, the extremes are rarely hit by the interpolated
+			// palette entries anyway
+			const float inset = (maximum - minimum) / 16.0f;
+			endpoint0 [c] = minimum + inset;
+			endpoint1 [c] = maximum - inset;
+		}
+
+		return;
+	}
+
+	float mean [4] = {};
+	for (int i = 0; i < 16; ++i) {
+		for (int c = 0; c < channelCount; ++c) {
+			mean [c] += block.texels [i][c] / 16.0f;
+		}
+	}
+
+	float covariance [4][4] = {};
+	for (int i = 0; i < 16; ++i) {
+		for (int a = 0; a < channelCount; ++a) {
+			for (int b = 0; b < channelCount; ++b) {
+				covariance [a][b] += (block.texels [i][a] - mean [a]) *
+					(block.texels [i][b] - mean [b]);
+			}
+		}
+	}
+
+	// Power iteration, starting from the covariance row of the channel with
+	// the largest variance. Starting along the diagonal fails when channels
+	// are anti-correlated, as the diagonal is then orthogonal to the axis
+	int largest = 0;
+	for (int c = 1; c < channelCount; ++c) {
+		if (covariance [c][c] > covariance [largest][largest]) {
+			largest = c;
+		}
+	}
+
+	float axis [4] = { 1, 1, 1, 1 };
+	if (covariance [largest][largest] > 0) {
+		for (int c = 0; c < channelCount; ++c) {
+			axis [c] = covariance [largest][c] / covariance [largest][largest];
+		}
+	}
+
+	for (int iteration = 0; iteration < 8; ++iteration) {
+		float next [4] = {};
+		float length = 0;
+
+		for (int a = 0; a < channelCount; ++a) {
+			for (int b = 0; b < channelCount; ++b) {
+				next [a] += covariance [a][b] * axis [b];
+			}
+			length = (std::max) (length, std::abs (next [a]));
+		}
+
+		if (length < 1e-6f) {
+			break;
+		}
+
+		for (int c = 0; c < channelCount; ++c) {
+			axis [c] = next [c] / length;
+		}
+	}
+
+	float axisLengthSquared = 0;
+	for (int c = 0; c < channelCount; ++c) {
+		axisLengthSquared += axis [c] * axis [c];
+	}
+
+	float minimumT = 0, maximumT = 0;
+	for (int i = 0; i < 16; ++i) {
+		float t = 0;
+		for (int c = 0; c < channelCount; ++c) {
+			t += (block.texels [i][c] - mean [c]) * axis [c];
+		}
+		t /= axisLengthSquared;
+
+		minimumT = (std::min) (minimumT, t);
+		maximumT = (std::max) (maximumT, t);
+	}
+
+	for (int c = 0; c < channelCount; ++c) {
+		endpoint0 [c] = (std::min) (255.0f, (std::max) (0.0f, mean [c] + minimumT * axis [c]));
+		endpoint1 [c] = (std::min) (255.0f, (std::max) (0.0f, mean [c] + maximumT * axis [c]));
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Least-squares fit of the endpoints given the current index assignment.
+weights [i] is how far palette entry i is from endpoint0 towards endpoint1.
+Returns false if the system is degenerate (all texels on one index).
+*/
+bool RefineEndpoints (const Block& block, const int channelCount,
+	const int* indices, const float* weights, float* endpoint0, float* endpoint1)
+{
+	float aa = 0, ab = 0, bb = 0;
+	float ax [4] = {}, bx [4] = {};
+
+	for (int i = 0; i < 16; ++i) {
+		const float b = weights [indices [i]];
+		const float a = 1 - b;
+
+		aa += a * a;
+		ab += a * b;
+		bb += b * b;
+
+		for (int c = 0; c < channelCount; ++c) {
+			ax [c] += a * block.texels [i][c];
+			bx [c] += b * block.texels [i][c];
+		}
+	}
+
+	const float determinant = aa * bb - ab * ab;
+	if (std::abs (determinant) < 1e-6f) {
+		return false;
+	}
+
+	const float inverse = 1 / determinant;
+	for (int c = 0; c < channelCount; ++c) {
+		endpoint0 [c] = (std::min) (255.0f, (std::max) (0.0f,
+			(bb * ax [c] - ab * bx [c]) * inverse));
+		endpoint1 [c] = (std::min) (255.0f, (std::max) (0.0f,
+			(aa * bx [c] - ab * ax [c]) * inverse));
+	}
+
+	return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::uint16_t To565 (const float* color)
+{
+	const auto r = static_cast<int> (color [0] * 31 / 255 + 0.5f);
+	const auto g = static_cast<int> (color [1] * 63 / 255 + 0.5f);
+	const auto b = static_cast<int> (color [2] * 31 / 255 + 0.5f);
+
+	return static_cast<std::uint16_t> ((r << 11) | (g << 5) | b);
+}
+
+__m128 From565 (const std::uint16_t color)
+{
+	const int r = (color >> 11) & 31;
+	const int g = (color >> 5) & 63;
+	const int b = color & 31;
+
+	return _mm_setr_ps (
+		static_cast<float> ((r << 3) | (r >> 2)),
+		static_cast<float> ((g << 2) | (g >> 4)),
+		static_cast<float> ((b << 3) | (b >> 2)),
+		0);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+float EvaluateColorBlock (const Block& block, const std::uint16_t color0,
+	const std::uint16_t color1, int* indices)
+{
+	const __m128 c0 = From565 (color0);
+	const __m128 c1 = From565 (color1);
+	const __m128 third = _mm_set1_ps (1.0f / 3.0f);
+
+	// Palette order as stored in the block: c0, c1, 2/3 c0 + 1/3 c1, 1/3 c0 + 2/3 c1
+	const __m128 palette [4] = {
+		c0, c1,
+		_mm_mul_ps (_mm_add_ps (_mm_add_ps (c0, c0), c1), third),
+		_mm_mul_ps (_mm_add_ps (_mm_add_ps (c1, c1), c0), third)
+	};
+
+	const __m128 rgbMask = _mm_castsi128_ps (_mm_setr_epi32 (-1, -1, -1, 0));
+	return AssignIndices (block, palette, 4, rgbMask, indices);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Move each 565 channel of both endpoints up or down by one step, keeping
+every change which lowers the error, until no single step helps anymore.
+Rounding the fitted endpoints to 565 independently per channel is often not
+the best combination, this recovers most of the difference.
+*/
+float SearchColorEndpoints (const Block& block, std::uint16_t* color0,
+	std::uint16_t* color1, int* indices, float error)
+{
+	// Shift and maximum of the r, g, b fields
+	static const int shifts [3] = { 11, 5, 0 };
+	static const int maximums [3] = { 31, 63, 31 };
+
+	for (int pass = 0; pass < 4; ++pass) {
+		bool improved = false;
+
+		for (int endpoint = 0; endpoint < 2; ++endpoint) {
+			for (int c = 0; c < 3; ++c) {
+				for (int step = -1; step <= 1; step += 2) {
+					std::uint16_t candidate [2] = { *color0, *color1 };
+					const int value = ((candidate [endpoint] >> shifts [c]) & maximums [c]) + step;
+					if (value < 0 || value > maximums [c]) {
+						continue;
+					}
+
+					candidate [endpoint] = static_cast<std::uint16_t> (
+						(candidate [endpoint] & ~(maximums [c] << shifts [c])) |
+						(value << shifts [c]));
+
+					if (candidate [0] == candidate [1]) {
+						continue;
+					}
+
+					if (candidate [0] < candidate [1]) {
+						std::swap (candidate [0], candidate [1]);
+					}
+
+					int candidateIndices [16];
+					const float candidateError = EvaluateColorBlock (block,
+						candidate [0], candidate [1], candidateIndices);
+
+					if (candidateError < error) {
+						error = candidateError;
+						*color0 = candidate [0];
+						*color1 = candidate [1];
+						std::memcpy (indices, candidateIndices, sizeof (candidateIndices));
+						improved = true;
+					}
+				}
+			}
+		}
+
+		if (!improved) {
+			break;
+		}
+	}
+
+	return error;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Write a BC1 color block, always using the four color mode.
+
+Normal refines the endpoints once with a least-squares fit. High repeats the
+fit until it stops improving and then searches the neighboring 565
+endpoints.
+*/
+void CompressColorBlock (const Block& block, const BlockCompressionQuality quality,
+	std::uint8_t* output)
+{
+	float endpoint0 [4], endpoint1 [4];
+	ComputeEndpoints (block, 3, quality == BlockCompressionQuality::Fast,
+		endpoint0, endpoint1);
+
+	// Four color mode requires color0 > color1, so the brighter endpoint
+	// goes first
+	auto color0 = To565 (endpoint1);
+	auto color1 = To565 (endpoint0);
+	if (color0 < color1) {
+		std::swap (color0, color1);
+	}
+
+	int indices [16];
+	float error = EvaluateColorBlock (block, color0, color1, indices);
+
+	const int refinementCount = (quality == BlockCompressionQuality::High) ? 4
+		: ((quality == BlockCompressionQuality::Normal) ? 1 : 0);
+
+	for (int refinement = 0; refinement < refinementCount && color0 != color1; ++refinement) {
+		// Weights towards endpoint1 for palette entries 0..3
+		static const float weights [4] = { 0, 1, 1.0f / 3.0f, 2.0f / 3.0f };
+
+		float refined0 [4], refined1 [4];
+		if (!RefineEndpoints (block, 3, indices, weights, refined0, refined1)) {
+			break;
+		}
+
+		auto refinedColor0 = To565 (refined0);
+		auto refinedColor1 = To565 (refined1);
+		if (refinedColor0 < refinedColor1) {
+			std::swap (refinedColor0, refinedColor1);
+		}
+
+		int refinedIndices [16];
+		const float refinedError = EvaluateColorBlock (block,
+			refinedColor0, refinedColor1, refinedIndices);
+
+		if (refinedError >= error || refinedColor0 == refinedColor1) {
+			break;
+		}
+
+		error = refinedError;
+		color0 = refinedColor0;
+		color1 = refinedColor1;
+		std::memcpy (indices, refinedIndices, sizeof (indices));
+	}
+
+	if (quality == BlockCompressionQuality::High && color0 != color1) {
+		error = SearchColorEndpoints (block, &color0, &color1, indices, error);
+	}
+
+	std::uint32_t indexBits = 0;
+	if (color0 != color1) {
+		for (int i = 0; i < 16; ++i) {
+			indexBits |= static_cast<std::uint32_t> (indices [i]) << (i * 2);
+		}
+	}
+
+	std::memcpy (output, &color0, 2);
+	std::memcpy (output + 2, &color1, 2);
+	std::memcpy (output + 4, &indexBits, 4);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Pick the closest of the eight palette entries for every alpha value.
+Returns the total squared error.
+*/
+float AssignAlphaIndices (const Block& block, const float* palette, int* indices)
+{
+	float totalError = 0;
+
+	for (int i = 0; i < 16; ++i) {
+		float bestError = 1e30f;
+		for (int p = 0; p < 8; ++p) {
+			const float d = block.texels [i][3] - palette [p];
+			if (d * d < bestError) {
+				bestError = d * d;
+				indices [i] = p;
+			}
+		}
+
+		totalError += bestError;
+	}
+
+	return totalError;
+}
+
+/**
+The six alpha mode (alpha0 <= alpha1) interpolates between the extremes of
+the texels other than 0 and 255, which are stored exactly. This is better
+than the eight alpha mode for blocks mixing fully transparent or opaque
+texels with a few intermediate ones, like anti-aliased cutouts.
+*/
+float CompressSixAlphaBlock (const Block& block, std::uint8_t* output)
+{
+	float minimum = 255, maximum = 0;
+	for (int i = 0; i < 16; ++i) {
+		const float alpha = block.texels [i][3];
+		if (alpha > 0 && alpha < 255) {
+			minimum = (std::min) (minimum, alpha);
+			maximum = (std::max) (maximum, alpha);
+		}
+	}
+
+	if (minimum > maximum) {
+		minimum = maximum = 0;
+	}
+
+	const auto alpha0 = static_cast<std::uint8_t> (minimum + 0.5f);
+	const auto alpha1 = static_cast<std::uint8_t> (maximum + 0.5f);
+
+	float palette [8] = { static_cast<float> (alpha0), static_cast<float> (alpha1) };
+	for (int i = 1; i < 5; ++i) {
+		palette [1 + i] = ((5 - i) * alpha0 + i * alpha1) / 5.0f;
+	}
+	palette [6] = 0;
+	palette [7] = 255;
+
+	int indices [16];
+	const float error = AssignAlphaIndices (block, palette, indices);
+
+	std::uint64_t indexBits = 0;
+	for (int i = 0; i < 16; ++i) {
+		indexBits |= static_cast<std::uint64_t> (indices [i]) << (i * 3);
+	}
+
+	output [0] = alpha0;
+	output [1] = alpha1;
+	for (int i = 0; i < 6; ++i) {
+		output [2 + i] = static_cast<std::uint8_t> (indexBits >> (i * 8));
+	}
+
+	return error;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Write a BC3 alpha block using the eight alpha mode (alpha0 > alpha1). High
+quality also tries the six alpha mode and keeps whichever is closer.
+*/
+void CompressAlphaBlock (const Block& block, const BlockCompressionQuality quality,
+	std::uint8_t* output)
+{
+	float minimum = 255, maximum = 0;
+	for (int i = 0; i < 16; ++i) {
+		minimum = (std::min) (minimum, block.texels [i][3]);
+		maximum = (std::max) (maximum, block.texels [i][3]);
+	}
+
+	const auto alpha0 = static_cast<std::uint8_t> (maximum + 0.5f);
+	const auto alpha1 = static_cast<std::uint8_t> (minimum + 0.5f);
+
+	std::uint64_t indexBits = 0;
+	if (alpha0 != alpha1) {
+		const float scale = 7.0f / (alpha0 - alpha1);
+
+		for (int i = 0; i < 16; ++i) {
+			// Step 0 is alpha0, step 7 is alpha1, the block stores them as
+			// indices 0 and 1 followed by the interpolated steps
+			const int step = static_cast<int> ((alpha0 - block.texels [i][3]) * scale + 0.5f);
+			const int index = (step == 0) ? 0 : ((step == 7) ? 1 : step + 1);
+
+			indexBits |= static_cast<std::uint64_t> (index) << (i * 3);
+		}
+	}
+
+	output [0] = alpha0;
+	output [1] = alpha1;
+	for (int i = 0; i < 6; ++i) {
+		output [2 + i] = static_cast<std::uint8_t> (indexBits >> (i * 8));
+	}
+
+	if (quality != BlockCompressionQuality::High || alpha0 == alpha1) {
+		return;
+	}
+
+	float palette [8] = { static_cast<float> (alpha0), static_cast<float> (alpha1) };
+	for (int i = 1; i < 7; ++i) {
+		palette [1 + i] = ((7 - i) * alpha0 + i * alpha1) / 7.0f;
+	}
+
+	int indices [16];
+	const float eightAlphaError = AssignAlphaIndices (block, palette, indices);
+
+	std::uint8_t sixAlphaBlock [8];
+	if (CompressSixAlphaBlock (block, sixAlphaBlock) < eightAlphaError) {
+		std::memcpy (output, sixAlphaBlock, sizeof (sixAlphaBlock));
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Little-endian bit writer for BC7 blocks.
+*/
+class BitWriter
+{
+public:
+	explicit BitWriter (std::uint8_t* output)
+		: output_ (output)
+	{
+		std::memset (output_, 0, 16);
+	}
+
+	void Write (const std::uint32_t value, const int bitCount)
+	{
+		for (int i = 0; i < bitCount; ++i) {
+			if (value & (1u << i)) {
+				output_ [position_ / 8] |= static_cast<std::uint8_t> (1u << (position_ % 8));
+			}
+			++position_;
+		}
+	}
+
+private:
+	std::uint8_t* output_;
+	int position_ = 0;
+};
+
+const int BC7_WEIGHTS [16] = {
+	0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Quantize an endpoint to 7 bits per channel plus a shared p-bit, as used by
+BC7 mode 6.
+*/
+void QuantizeMode6Endpoint (const float* endpoint, const int pBit, int* quantized)
+{
+	for (int c = 0; c < 4; ++c) {
+		const int value = static_cast<int> ((endpoint [c] - pBit) / 2 + 0.5f);
+		quantized [c] = (std::min) (127, (std::max) (0, value));
+	}
+}
+
+float EvaluateMode6 (const Block& block, const int* quantized0, const int pBit0,
+	const int* quantized1, const int pBit1, int* indices)
+{
+	float e0 [4], e1 [4];
+	for (int c = 0; c < 4; ++c) {
+		e0 [c] = static_cast<float> ((quantized0 [c] << 1) | pBit0);
+		e1 [c] = static_cast<float> ((quantized1 [c] << 1) | pBit1);
+	}
+
+	__m128 palette [16];
+	for (int i = 0; i < 16; ++i) {
+		float entry [4];
+		for (int c = 0; c < 4; ++c) {
+			entry [c] = static_cast<float> (((64 - BC7_WEIGHTS [i]) * static_cast<int> (e0 [c]) +
+				BC7_WEIGHTS [i] * static_cast<int> (e1 [c]) + 32) >> 6);
+		}
+		palette [i] = _mm_loadu_ps (entry);
+	}
+
+	const __m128 allMask = _mm_castsi128_ps (_mm_set1_epi32 (-1));
+	return AssignIndices (block, palette, 16, allMask, indices);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Write a BC7 mode 6 block: one subset, RGBA 7.7.7.7 endpoints with unique
+p-bits and 4 bit indices.
+*/
+void CompressBC7Block (const Block& block, std::uint8_t* output)
+{
+	float endpoint0 [4], endpoint1 [4];
+	ComputeEndpoints (block, 4, false, endpoint0, endpoint1);
+
+	int best0 [4] = {}, best1 [4] = {}, bestIndices [16] = {};
+	int bestP0 = 0, bestP1 = 0;
+	float bestError = -1;
+
+	for (int refinement = 0; refinement < 2; ++refinement) {
+		// Try all p-bit combinations, they change the rounding quite a bit
+		for (int p = 0; p < 4; ++p) {
+			const int p0 = p & 1, p1 = p >> 1;
+
+			int q0 [4], q1 [4], indices [16];
+			QuantizeMode6Endpoint (endpoint0, p0, q0);
+			QuantizeMode6Endpoint (endpoint1, p1, q1);
+
+			const float error = EvaluateMode6 (block, q0, p0, q1, p1, indices);
+			if (bestError < 0 || error < bestError) {
+				bestError = error;
+				bestP0 = p0;
+				bestP1 = p1;
+				std::memcpy (best0, q0, sizeof (q0));
+				std::memcpy (best1, q1, sizeof (q1));
+				std::memcpy (bestIndices, indices, sizeof (indices));
+			}
+		}
+
+		float weights [16];
+		for (int i = 0; i < 16; ++i) {
+			weights [i] = BC7_WEIGHTS [i] / 64.0f;
+		}
+
+		if (!RefineEndpoints (block, 4, bestIndices, weights, endpoint0, endpoint1)) {
+			break;
+		}
+	}
+
+	// The anchor index (texel 0) has its MSB implied to be zero, so flip
+	// the endpoints if necessary
+	if (bestIndices [0] >= 8) {
+		std::swap (best0, best1);
+		std::swap (bestP0, bestP1);
+		for (int i = 0; i < 16; ++i) {
+			bestIndices [i] = 15 - bestIndices [i];
+		}
+	}
+
+	BitWriter writer (output);
+	// Mode 6 is encoded as six zero bits followed by a one
+	writer.Write (1 << 6, 7);
+	for (int c = 0; c < 4; ++c) {
+		writer.Write (best0 [c], 7);
+		writer.Write (best1 [c], 7);
+	}
+	writer.Write (bestP0, 1);
+	writer.Write (bestP1, 1);
+	writer.Write (bestIndices [0], 3);
+	for (int i = 1; i < 16; ++i) {
+		writer.Write (bestIndices [i], 4);
+	}
+}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int GetBlockSize (const BlockFormat format)
+{
+	return (format == BlockFormat::BC1) ? 8 : 16;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+BlockFormat ChooseBlockFormat (const void* data,
+	const int width, const int height, const std::size_t rowPitch,
+	const BlockCompressionQuality quality)
+{
+	if (quality == BlockCompressionQuality::High) {
+		return BlockFormat::BC7;
+	}
+
+	const auto bytes = static_cast<const std::uint8_t*> (data);
+	for (int y = 0; y < height; ++y) {
+		for (int x = 0; x < width; ++x) {
+			if (bytes [y * rowPitch + x * 4 + 3] != 255) {
+				return BlockFormat::BC3;
+			}
+		}
+	}
+
+	return BlockFormat::BC1;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::vector<std::uint8_t> CompressImage (const void* data,
+	const int width, const int height, const std::size_t rowPitch,
+	const BlockFormat format, const BlockCompressionQuality quality)
+{
+	if (width <= 0 || height <= 0) {
+		throw std::runtime_error ("Cannot compress an empty image");
+	}
+
+	const int blocksWide = (width + 3) / 4;
+	const int blocksHigh = (height + 3) / 4;
+	const int blockSize = GetBlockSize (format);
+	const std::size_t blockRowPitch = static_cast<std::size_t> (blocksWide) * blockSize;
+
+	std::vector<std::uint8_t> result (blockRowPitch * blocksHigh);
+	const auto input = static_cast<const std::uint8_t*> (data);
+
+	ParallelFor (blocksHigh, 4, [&] (const int begin, const int end) {
+		Block block;
+
+		for (int blockY = begin; blockY < end; ++blockY) {
+			std::uint8_t* output = result.data () + blockY * blockRowPitch;
+
+			for (int blockX = 0; blockX < blocksWide; ++blockX) {
+				LoadBlock (input, width, height, rowPitch, blockX, blockY, block);
+
+				switch (format) {
+				case BlockFormat::BC1:
+					CompressColorBlock (block, quality, output);
+					break;
+
+				case BlockFormat::BC3:
+					CompressAlphaBlock (block, quality, output);
+					CompressColorBlock (block, quality, output + 8);
+					break;
+
+				case BlockFormat::BC7:
+					CompressBC7Block (block, output);
+					break;
+				}
+
+				output += blockSize;
+			}
+		}
+	});
+
+	return result;
+}
+}
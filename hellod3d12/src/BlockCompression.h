@@ -0,0 +1,77 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#ifndef ANTERU_D3D12_SAMPLE_BLOCKCOMPRESSION_H_
+#define ANTERU_D3D12_SAMPLE_BLOCKCOMPRESSION_H_
+
+#include <cstdint>
+#include <vector>
+
+namespace AMD {
+///////////////////////////////////////////////////////////////////////////////
+enum class BlockFormat
+{
+	// RGB, 1 bit alpha not used. 8 bytes per 4x4 block
+	BC1,
+	// RGB + interpolated alpha. 16 bytes per 4x4 block
+	BC3,
+	// RGBA, only mode 6 is written. 16 bytes per 4x4 block
+	BC7
+};
+
+///////////////////////////////////////////////////////////////////////////////
+enum class BlockCompressionQuality
+{
+	// Bounding box endpoints, no refinement
+	Fast,
+	// Principal axis endpoints refined with a least-squares fit
+	Normal,
+	// Iterated fit plus a search of the neighboring endpoints for BC1/BC3,
+	// BC3 alpha also tries the six alpha mode. Prefers BC7 over BC1/BC3
+	High
+};
+
+int GetBlockSize (const BlockFormat format);
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Pick the format for an RGBA image: BC1 if the image is opaque, BC3 otherwise.
+With BlockCompressionQuality::High, BC7 is used in both cases.
+*/
+BlockFormat ChooseBlockFormat (const void* data,
+	const int width, const int height, const std::size_t rowPitch,
+	const BlockCompressionQuality quality);
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Compress an 8 bit per channel RGBA image into 4x4 blocks. The image size does
+not have to be a multiple of 4, partial blocks replicate the edge texels.
+
+The result contains (width + 3) / 4 blocks per row, rows are tightly packed.
+Block rows are compressed in parallel.
+*/
+std::vector<std::uint8_t> CompressImage (const void* data,
+	const int width, const int height, const std::size_t rowPitch,
+	const BlockFormat format, const BlockCompressionQuality quality);
+}
+
+#endif
@@ -0,0 +1,141 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#ifndef ANTERU_D3D12_SAMPLE_BOUNDEDQUEUE_H_
+#define ANTERU_D3D12_SAMPLE_BOUNDEDQUEUE_H_
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <mutex>
+
+namespace AMD {
+///////////////////////////////////////////////////////////////////////////////
+/**
+A first-in, first-out queue with a fixed capacity, safe to use from any
+number of producer and consumer threads.
+
+Push blocks while the queue is full, which throttles producers to the speed
+of the consumers. After Close, Push fails and Pop returns the remaining items
+before failing as well, so consumers can drain the queue and exit.
+*/
+template <typename T>
+class BoundedQueue
+{
+public:
+	BoundedQueue (const BoundedQueue&) = delete;
+	BoundedQueue& operator= (const BoundedQueue&) = delete;
+
+	explicit BoundedQueue (const std::size_t capacity)
+		: capacity_ (capacity)
+	{
+	}
+
+	/**
+	Returns false if the queue has been closed, in which case item is left
+	unchanged.
+	*/
+	bool Push (T& item)
+	{
+		{
+			std::unique_lock<std::mutex> lock (mutex_);
+			notFull_.wait (lock, [this] () {
+				return closed_ || items_.size () < capacity_;
+			});
+
+			if (closed_) {
+				return false;
+			}
+
+			items_.push_back (std::move (item));
+		}
+
+		notEmpty_.notify_one ();
+		return true;
+	}
+
+	/**
+	Returns false once the queue is closed and empty.
+	*/
+	bool Pop (T& item)
+	{
+		{
+			std::unique_lock<std::mutex> lock (mutex_);
+			notEmpty_.wait (lock, [this] () {
+				return closed_ || !items_.empty ();
+			});
+
+			if (items_.empty ()) {
+				return false;
+			}
+
+			item = std::move (items_.front ());
+			items_.pop_front ();
+		}
+
+		notFull_.notify_one ();
+		return true;
+	}
+
+	/**
+	Like Pop, but returns false instead of blocking if the queue is empty.
+	*/
+	bool TryPop (T& item)
+	{
+		{
+			std::lock_guard<std::mutex> lock (mutex_);
+
+			if (items_.empty ()) {
+				return false;
+			}
+
+			item = std::move (items_.front ());
+			items_.pop_front ();
+		}
+
+		notFull_.notify_one ();
+		return true;
+	}
+
+	void Close ()
+	{
+		{
+			std::lock_guard<std::mutex> lock (mutex_);
+			closed_ = true;
+		}
+
+		notFull_.notify_all ();
+		notEmpty_.notify_all ();
+	}
+
+private:
+	const std::size_t capacity_;
+
+	std::mutex mutex_;
+	std::condition_variable notFull_;
+	std::condition_variable notEmpty_;
+	std::deque<T> items_;
+	bool closed_ = false;
+};
+}
+
+#endif
@@ -0,0 +1,98 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+
+#include "CommandBundle.h"
+
+#include <stdexcept>
+
+namespace AMD {
+///////////////////////////////////////////////////////////////////////////////
+CommandBundle::CommandBundle (ID3D12Device* device, const int slotCount,
+	RecordFunction record)
+	: device_ (device)
+	, record_ (std::move (record))
+	, slots_ (slotCount)
+	, recordCount_ (0)
+{
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void CommandBundle::Invalidate ()
+{
+	for (auto& slot : slots_) {
+		slot.valid = false;
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void CommandBundle::Execute (ID3D12GraphicsCommandList* commandList,
+	const int slot, const std::uint64_t inputKey)
+{
+	auto& entry = slots_ [slot];
+
+	if (!entry.valid || entry.inputKey != inputKey) {
+		Record (entry);
+		entry.inputKey = inputKey;
+		entry.valid = true;
+	}
+
+	commandList->ExecuteBundle (entry.bundle.Get ());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int CommandBundle::GetRecordCount () const
+{
+	return recordCount_;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void CommandBundle::Record (Slot& slot)
+{
+	if (slot.bundle) {
+		slot.allocator->Reset ();
+		slot.bundle->Reset (slot.allocator.Get (), nullptr);
+	} else {
+		if (FAILED (device_->CreateCommandAllocator (D3D12_COMMAND_LIST_TYPE_BUNDLE,
+			IID_PPV_ARGS (&slot.allocator)))) {
+			throw std::runtime_error ("Could not create bundle allocator");
+		}
+
+		if (FAILED (device_->CreateCommandList (0, D3D12_COMMAND_LIST_TYPE_BUNDLE,
+			slot.allocator.Get (), nullptr, IID_PPV_ARGS (&slot.bundle)))) {
+			throw std::runtime_error ("Could not create bundle");
+		}
+	}
+
+	try {
+		record_ (slot.bundle.Get ());
+	} catch (...) {
+		// Leave it closed, so it can be reset on the next attempt
+		slot.bundle->Close ();
+		throw;
+	}
+
+	slot.bundle->Close ();
+
+	++recordCount_;
+}
+}
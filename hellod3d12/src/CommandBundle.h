@@ -0,0 +1,98 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+
+#ifndef ANTERU_D3D12_SAMPLE_COMMANDBUNDLE_H_
+#define ANTERU_D3D12_SAMPLE_COMMANDBUNDLE_H_
+
+#include <d3d12.h>
+#include <wrl.h>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace AMD {
+///////////////////////////////////////////////////////////////////////////////
+/**
+A sequence of commands which rarely changes, recorded once into a bundle and
+replayed with ExecuteBundle every frame.
+
+There is one bundle per queue slot, so a bundle can be re-recorded while the
+GPU may still execute the one of another frame. A slot's bundle is recorded
+again on its next use after Invalidate, or when the input key passed to
+Execute differs from the one it was recorded with. The input key is meant to
+be a hash of everything the recorded commands depend on, like the pipeline
+state and buffer views, so changes are picked up without having to track
+them.
+
+Bundles inherit the root signature and root arguments from the command list
+they are executed on, but not the pipeline state or primitive topology, so
+the record function has to set those.
+*/
+class CommandBundle
+{
+public:
+	typedef std::function<void (ID3D12GraphicsCommandList*)> RecordFunction;
+
+	CommandBundle (const CommandBundle&) = delete;
+	CommandBundle& operator= (const CommandBundle&) = delete;
+
+	CommandBundle (ID3D12Device* device, const int slotCount,
+		RecordFunction record);
+
+	/**
+	Record all bundles again on their next use.
+	*/
+	void Invalidate ();
+
+	/**
+	Execute the bundle of slot on commandList, recording it first if needed.
+	The commands of slot must have finished on the GPU, like for the command
+	allocator of a queue slot.
+	*/
+	void Execute (ID3D12GraphicsCommandList* commandList, const int slot,
+		const std::uint64_t inputKey = 0);
+
+	/**
+	How many times a bundle has been recorded.
+	*/
+	int GetRecordCount () const;
+
+private:
+	struct Slot
+	{
+		Microsoft::WRL::ComPtr<ID3D12CommandAllocator> allocator;
+		Microsoft::WRL::ComPtr<ID3D12GraphicsCommandList> bundle;
+		std::uint64_t inputKey = 0;
+		bool valid = false;
+	};
+
+	void Record (Slot& slot);
+
+	Microsoft::WRL::ComPtr<ID3D12Device> device_;
+	RecordFunction record_;
+	std::vector<Slot> slots_;
+	int recordCount_;
+};
+}
+
+#endif
@@ -0,0 +1,259 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#include "CopyableFootprints.h"
+
+#include "Utility.h"
+
+#include <cstring>
+#include <stdexcept>
+#include <vector>
+
+namespace AMD {
+namespace {
+///////////////////////////////////////////////////////////////////////////////
+/**
+DXGI formats are grouped by layout, so a few ranges cover everything. The
+ranges include the single-plane depth formats D32_FLOAT and D16_UNORM;
+planar formats like D24_UNORM_S8_UINT are not supported.
+*/
+struct FormatRange
+{
+	DXGI_FORMAT first;
+	DXGI_FORMAT last;
+	UINT blockSize;
+	UINT bytesPerBlock;
+};
+
+const FormatRange FORMAT_RANGES [] = {
+	{ DXGI_FORMAT_R32G32B32A32_TYPELESS, DXGI_FORMAT_R32G32B32A32_SINT, 1, 16 },
+	{ DXGI_FORMAT_R32G32B32_TYPELESS, DXGI_FORMAT_R32G32B32_SINT, 1, 12 },
+	{ DXGI_FORMAT_R16G16B16A16_TYPELESS, DXGI_FORMAT_R16G16B16A16_SINT, 1, 8 },
+	{ DXGI_FORMAT_R32G32_TYPELESS, DXGI_FORMAT_R32G32_SINT, 1, 8 },
+	{ DXGI_FORMAT_R10G10B10A2_TYPELESS, DXGI_FORMAT_R11G11B10_FLOAT, 1, 4 },
+	{ DXGI_FORMAT_R8G8B8A8_TYPELESS, DXGI_FORMAT_R8G8B8A8_SINT, 1, 4 },
+	{ DXGI_FORMAT_R16G16_TYPELESS, DXGI_FORMAT_R16G16_SINT, 1, 4 },
+	{ DXGI_FORMAT_R32_TYPELESS, DXGI_FORMAT_R32_SINT, 1, 4 },
+	{ DXGI_FORMAT_R8G8_TYPELESS, DXGI_FORMAT_R8G8_SINT, 1, 2 },
+	{ DXGI_FORMAT_R16_TYPELESS, DXGI_FORMAT_R16_SINT, 1, 2 },
+	{ DXGI_FORMAT_R8_TYPELESS, DXGI_FORMAT_A8_UNORM, 1, 1 },
+	{ DXGI_FORMAT_R9G9B9E5_SHAREDEXP, DXGI_FORMAT_R9G9B9E5_SHAREDEXP, 1, 4 },
+	{ DXGI_FORMAT_BC1_TYPELESS, DXGI_FORMAT_BC1_UNORM_SRGB, 4, 8 },
+	{ DXGI_FORMAT_BC2_TYPELESS, DXGI_FORMAT_BC3_UNORM_SRGB, 4, 16 },
+	{ DXGI_FORMAT_BC4_TYPELESS, DXGI_FORMAT_BC4_SNORM, 4, 8 },
+	{ DXGI_FORMAT_BC5_TYPELESS, DXGI_FORMAT_BC5_SNORM, 4, 16 },
+	{ DXGI_FORMAT_B5G6R5_UNORM, DXGI_FORMAT_B5G5R5A1_UNORM, 1, 2 },
+	{ DXGI_FORMAT_B8G8R8A8_UNORM, DXGI_FORMAT_B8G8R8X8_UNORM_SRGB, 1, 4 },
+	{ DXGI_FORMAT_BC6H_TYPELESS, DXGI_FORMAT_BC7_UNORM_SRGB, 4, 16 },
+	{ DXGI_FORMAT_B4G4R4A4_UNORM, DXGI_FORMAT_B4G4R4A4_UNORM, 1, 2 }
+};
+
+UINT GetMipSize (const UINT64 size, const UINT mipLevel)
+{
+	const auto result = static_cast<UINT> (size >> mipLevel);
+	return (result > 0) ? result : 1;
+}
+
+UINT GetFullMipChainLength (const D3D12_RESOURCE_DESC& desc)
+{
+	UINT64 size = desc.Width;
+	if (desc.Dimension != D3D12_RESOURCE_DIMENSION_TEXTURE1D && desc.Height > size) {
+		size = desc.Height;
+	}
+	if (desc.Dimension == D3D12_RESOURCE_DIMENSION_TEXTURE3D && desc.DepthOrArraySize > size) {
+		size = desc.DepthOrArraySize;
+	}
+
+	UINT levels = 1;
+	while (size > 1) {
+		size /= 2;
+		++levels;
+	}
+
+	return levels;
+}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+bool GetFormatBlockInfo (const DXGI_FORMAT format, FormatBlockInfo* info)
+{
+	for (const auto& range : FORMAT_RANGES) {
+		if (format >= range.first && format <= range.last) {
+			info->blockWidth = range.blockSize;
+			info->blockHeight = range.blockSize;
+			info->bytesPerBlock = range.bytesPerBlock;
+			return true;
+		}
+	}
+
+	return false;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void GetCopyableFootprints (const D3D12_RESOURCE_DESC& desc,
+	const UINT firstSubresource, const UINT subresourceCount,
+	const UINT64 baseOffset,
+	D3D12_PLACED_SUBRESOURCE_FOOTPRINT* layouts, UINT* rowCounts,
+	UINT64* rowSizes, UINT64* totalBytes)
+{
+	if (desc.Dimension == D3D12_RESOURCE_DIMENSION_BUFFER) {
+		if (firstSubresource != 0 || subresourceCount > 1) {
+			throw std::runtime_error ("Buffers have a single subresource");
+		}
+
+		if (subresourceCount == 1) {
+			if (layouts) {
+				layouts [0].Offset = baseOffset;
+				layouts [0].Footprint.Format = DXGI_FORMAT_UNKNOWN;
+				layouts [0].Footprint.Width = static_cast<UINT> (desc.Width);
+				layouts [0].Footprint.Height = 1;
+				layouts [0].Footprint.Depth = 1;
+				layouts [0].Footprint.RowPitch = RoundToNextMultiple<UINT> (
+					static_cast<UINT> (desc.Width), D3D12_TEXTURE_DATA_PITCH_ALIGNMENT);
+			}
+			if (rowCounts) {
+				rowCounts [0] = 1;
+			}
+			if (rowSizes) {
+				rowSizes [0] = desc.Width;
+			}
+		}
+
+		if (totalBytes) {
+			*totalBytes = (subresourceCount == 1) ? desc.Width : 0;
+		}
+
+		return;
+	}
+
+	FormatBlockInfo blockInfo;
+	if (!GetFormatBlockInfo (desc.Format, &blockInfo)) {
+		throw std::runtime_error ("Unsupported format for footprint calculation");
+	}
+
+	const UINT mipLevels = (desc.MipLevels == 0) ? GetFullMipChainLength (desc) : desc.MipLevels;
+	const UINT arraySize = (desc.Dimension == D3D12_RESOURCE_DIMENSION_TEXTURE3D)
+		? 1 : desc.DepthOrArraySize;
+
+	if (firstSubresource + subresourceCount > mipLevels * arraySize) {
+		throw std::runtime_error ("Subresource range exceeds the resource");
+	}
+
+	UINT64 offset = 0;
+	UINT64 total = 0;
+
+	for (UINT i = 0; i < subresourceCount; ++i) {
+		const UINT mipLevel = (firstSubresource + i) % mipLevels;
+
+		const UINT width = GetMipSize (desc.Width, mipLevel);
+		const UINT height = (desc.Dimension == D3D12_RESOURCE_DIMENSION_TEXTURE1D)
+			? 1 : GetMipSize (desc.Height, mipLevel);
+		const UINT depth = (desc.Dimension == D3D12_RESOURCE_DIMENSION_TEXTURE3D)
+			? GetMipSize (desc.DepthOrArraySize, mipLevel) : 1;
+
+		const UINT blocksWide = (width + blockInfo.blockWidth - 1) / blockInfo.blockWidth;
+		const UINT blocksHigh = (height + blockInfo.blockHeight - 1) / blockInfo.blockHeight;
+
+		const UINT64 rowSize = static_cast<UINT64> (blocksWide) * blockInfo.bytesPerBlock;
+		const UINT rowPitch = RoundToNextMultiple<UINT> (static_cast<UINT> (rowSize),
+			D3D12_TEXTURE_DATA_PITCH_ALIGNMENT);
+
+		offset = RoundToNextMultiple<UINT64> (offset, D3D12_TEXTURE_DATA_PLACEMENT_ALIGNMENT);
+
+		if (layouts) {
+			layouts [i].Offset = baseOffset + offset;
+			layouts [i].Footprint.Format = desc.Format;
+			layouts [i].Footprint.Width = blocksWide * blockInfo.blockWidth;
+			layouts [i].Footprint.Height = blocksHigh * blockInfo.blockHeight;
+			layouts [i].Footprint.Depth = depth;
+			layouts [i].Footprint.RowPitch = rowPitch;
+		}
+		if (rowCounts) {
+			rowCounts [i] = blocksHigh;
+		}
+		if (rowSizes) {
+			rowSizes [i] = rowSize;
+		}
+
+		const UINT64 rowsTotal = static_cast<UINT64> (blocksHigh) * depth;
+		total = offset + rowPitch * (rowsTotal - 1) + rowSize;
+		offset += rowPitch * rowsTotal;
+	}
+
+	if (totalBytes) {
+		*totalBytes = total;
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+UINT64 GetUploadBufferSize (const D3D12_RESOURCE_DESC& desc,
+	const UINT firstSubresource, const UINT subresourceCount)
+{
+	UINT64 result = 0;
+	GetCopyableFootprints (desc, firstSubresource, subresourceCount, 0,
+		nullptr, nullptr, nullptr, &result);
+	return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+bool CheckCopyableFootprints (ID3D12Device* device,
+	const D3D12_RESOURCE_DESC& desc,
+	const UINT firstSubresource, const UINT subresourceCount)
+{
+	std::vector<D3D12_PLACED_SUBRESOURCE_FOOTPRINT> expectedLayouts (subresourceCount);
+	std::vector<UINT> expectedRowCounts (subresourceCount);
+	std::vector<UINT64> expectedRowSizes (subresourceCount);
+	UINT64 expectedTotalBytes = 0;
+
+	device->GetCopyableFootprints (&desc, firstSubresource, subresourceCount, 0,
+		expectedLayouts.data (), expectedRowCounts.data (),
+		expectedRowSizes.data (), &expectedTotalBytes);
+
+	std::vector<D3D12_PLACED_SUBRESOURCE_FOOTPRINT> layouts (subresourceCount);
+	std::vector<UINT> rowCounts (subresourceCount);
+	std::vector<UINT64> rowSizes (subresourceCount);
+	UINT64 totalBytes = 0;
+
+	GetCopyableFootprints (desc, firstSubresource, subresourceCount, 0,
+		layouts.data (), rowCounts.data (), rowSizes.data (), &totalBytes);
+
+	if (totalBytes != expectedTotalBytes || rowCounts != expectedRowCounts ||
+		rowSizes != expectedRowSizes) {
+		return false;
+	}
+
+	for (UINT i = 0; i < subresourceCount; ++i) {
+		const auto& a = layouts [i];
+		const auto& b = expectedLayouts [i];
+
+		if (a.Offset != b.Offset || a.Footprint.Format != b.Footprint.Format ||
+			a.Footprint.Width != b.Footprint.Width ||
+			a.Footprint.Height != b.Footprint.Height ||
+			a.Footprint.Depth != b.Footprint.Depth ||
+			a.Footprint.RowPitch != b.Footprint.RowPitch) {
+			return false;
+		}
+	}
+
+	return true;
+}
+}
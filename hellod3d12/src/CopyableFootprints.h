@@ -0,0 +1,88 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#ifndef ANTERU_D3D12_SAMPLE_COPYABLEFOOTPRINTS_H_
+#define ANTERU_D3D12_SAMPLE_COPYABLEFOOTPRINTS_H_
+
+#include <d3d12.h>
+
+namespace AMD {
+///////////////////////////////////////////////////////////////////////////////
+/**
+Size of one element of a format: a single texel for uncompressed formats, a
+4x4 block for block-compressed ones.
+*/
+struct FormatBlockInfo
+{
+	UINT blockWidth;
+	UINT blockHeight;
+	UINT bytesPerBlock;
+};
+
+/**
+Returns false for formats which are not supported by the calculator below,
+for instance planar depth/stencil or video formats.
+*/
+bool GetFormatBlockInfo (const DXGI_FORMAT format, FormatBlockInfo* info);
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+CPU implementation of ID3D12Device::GetCopyableFootprints with the same
+signature and output, so upload buffers and container files can be sized
+without a device. Supports buffers and 1D/2D/3D textures including mip
+chains and arrays in all formats GetFormatBlockInfo knows about. A mip level
+count of 0 in the desc means a full chain, just like for resource creation.
+
+The placement follows the D3D12 rules: each subresource starts at a multiple
+of D3D12_TEXTURE_DATA_PLACEMENT_ALIGNMENT (relative to baseOffset), rows
+are D3D12_TEXTURE_DATA_PITCH_ALIGNMENT aligned, and block-compressed
+footprints are rounded up to whole blocks. The total size does not include
+the padding after the last row of the last subresource.
+
+All output pointers are optional. Throws for unsupported formats or
+subresource ranges outside of the resource.
+*/
+void GetCopyableFootprints (const D3D12_RESOURCE_DESC& desc,
+	const UINT firstSubresource, const UINT subresourceCount,
+	const UINT64 baseOffset,
+	D3D12_PLACED_SUBRESOURCE_FOOTPRINT* layouts, UINT* rowCounts,
+	UINT64* rowSizes, UINT64* totalBytes);
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Like GetRequiredIntermediateSize from d3dx12.h, but computed on the CPU from
+the resource description.
+*/
+UINT64 GetUploadBufferSize (const D3D12_RESOURCE_DESC& desc,
+	const UINT firstSubresource, const UINT subresourceCount);
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Compare GetCopyableFootprints against the device. Returns true if both agree
+on every layout, row count, row size and the total size.
+*/
+bool CheckCopyableFootprints (ID3D12Device* device,
+	const D3D12_RESOURCE_DESC& desc,
+	const UINT firstSubresource, const UINT subresourceCount);
+}
+
+#endif
@@ -0,0 +1,463 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#ifndef ANTERU_D3D12_SAMPLE_COROUTINE_H_
+#define ANTERU_D3D12_SAMPLE_COROUTINE_H_
+
+// Coroutines need C++20. With older compilers this header is empty, and the
+// callback based FenceService and TextureHandle::OnDone remain available
+#if defined(__cpp_impl_coroutine) && __cpp_impl_coroutine >= 201902L
+#define AMD_HAS_COROUTINES 1
+#endif
+
+#ifdef AMD_HAS_COROUTINES
+#include "AssetLoader.h"
+#include "FenceService.h"
+#include "TaskScheduler.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <coroutine>
+#include <cstdint>
+#include <exception>
+#include <mutex>
+#include <optional>
+#include <utility>
+
+namespace AMD {
+namespace Detail {
+///////////////////////////////////////////////////////////////////////////////
+/**
+The state is RUNNING, DONE, DETACHED or the address of the coroutine
+awaiting the result. Whoever changes it last takes care of resuming the
+awaiting coroutine or destroying the frame.
+*/
+class AsyncTaskPromiseBase
+{
+public:
+	static const std::uintptr_t RUNNING = 0;
+	static const std::uintptr_t DONE = 1;
+	static const std::uintptr_t DETACHED = 2;
+
+	struct FinalAwaiter
+	{
+		bool await_ready () noexcept
+		{
+			return false;
+		}
+
+		template <typename Promise>
+		std::coroutine_handle<> await_suspend (std::coroutine_handle<Promise> coroutine) noexcept
+		{
+			const auto previous = coroutine.promise ().state_.exchange (DONE);
+
+			if (previous == DETACHED) {
+				coroutine.destroy ();
+				return std::noop_coroutine ();
+			} else if (previous == RUNNING) {
+				return std::noop_coroutine ();
+			}
+
+			return std::coroutine_handle<>::from_address (
+				reinterpret_cast<void*> (previous));
+		}
+
+		void await_resume () noexcept
+		{
+		}
+	};
+
+	// Tasks start right away, like a function call
+	std::suspend_never initial_suspend () noexcept
+	{
+		return {};
+	}
+
+	FinalAwaiter final_suspend () noexcept
+	{
+		return {};
+	}
+
+	void unhandled_exception ()
+	{
+		exception_ = std::current_exception ();
+	}
+
+	std::atomic<std::uintptr_t> state_ { RUNNING };
+
+protected:
+	void RethrowIfFailed ()
+	{
+		if (exception_) {
+			std::rethrow_exception (exception_);
+		}
+	}
+
+private:
+	std::exception_ptr exception_;
+};
+
+template <typename T>
+class AsyncTaskPromise : public AsyncTaskPromiseBase
+{
+public:
+	void return_value (T value)
+	{
+		value_.emplace (std::move (value));
+	}
+
+	T GetResult ()
+	{
+		RethrowIfFailed ();
+		return std::move (*value_);
+	}
+
+private:
+	std::optional<T> value_;
+};
+
+template <>
+class AsyncTaskPromise<void> : public AsyncTaskPromiseBase
+{
+public:
+	void return_void ()
+	{
+	}
+
+	void GetResult ()
+	{
+		RethrowIfFailed ();
+	}
+};
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Result of a coroutine. The coroutine starts running when it is called, and
+runs until it finishes or suspends in a co_await.
+
+Awaiting the task suspends the caller until the result is available, then
+returns it or rethrows the exception the coroutine exited with. The result
+can be retrieved once. If the task is destroyed before the coroutine has
+finished, the coroutine keeps running detached and cleans up after itself;
+its result or exception is dropped.
+*/
+template <typename T>
+class AsyncTask
+{
+public:
+	struct promise_type : public Detail::AsyncTaskPromise<T>
+	{
+		AsyncTask get_return_object ()
+		{
+			return AsyncTask (std::coroutine_handle<promise_type>::from_promise (*this));
+		}
+	};
+
+	AsyncTask (const AsyncTask&) = delete;
+	AsyncTask& operator= (const AsyncTask&) = delete;
+
+	AsyncTask (AsyncTask&& other) noexcept
+		: coroutine_ (std::exchange (other.coroutine_, nullptr))
+	{
+	}
+
+	AsyncTask& operator= (AsyncTask&& other) noexcept
+	{
+		if (this != &other) {
+			Release ();
+			coroutine_ = std::exchange (other.coroutine_, nullptr);
+		}
+
+		return *this;
+	}
+
+	~AsyncTask ()
+	{
+		Release ();
+	}
+
+	/**
+	Moved-from tasks are not valid, and can't be awaited.
+	*/
+	bool IsValid () const
+	{
+		return static_cast<bool> (coroutine_);
+	}
+
+	/**
+	False for moved-from tasks.
+	*/
+	bool IsDone () const
+	{
+		return coroutine_ &&
+			coroutine_.promise ().state_.load () == promise_type::DONE;
+	}
+
+	bool await_ready () const noexcept
+	{
+		return IsDone ();
+	}
+
+	/**
+	Registers the awaiting coroutine, unless the task finished in the
+	meantime, in which case the awaiting coroutine continues right away.
+	*/
+	bool await_suspend (std::coroutine_handle<> awaiting) noexcept
+	{
+		auto expected = promise_type::RUNNING;
+		return coroutine_.promise ().state_.compare_exchange_strong (expected,
+			reinterpret_cast<std::uintptr_t> (awaiting.address ()));
+	}
+
+	T await_resume ()
+	{
+		return coroutine_.promise ().GetResult ();
+	}
+
+private:
+	explicit AsyncTask (std::coroutine_handle<promise_type> coroutine)
+		: coroutine_ (coroutine)
+	{
+	}
+
+	void Release ()
+	{
+		if (!coroutine_) {
+			return;
+		}
+
+		// Either the coroutine is done and we clean up, or it cleans up once
+		// it is
+		if (coroutine_.promise ().state_.exchange (promise_type::DETACHED) ==
+			promise_type::DONE) {
+			coroutine_.destroy ();
+		}
+
+		coroutine_ = nullptr;
+	}
+
+	std::coroutine_handle<promise_type> coroutine_;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Block the calling thread until the task is done and return its result. This
+is the bridge from normal code into coroutines, for instance on the main
+thread at startup. Don't call it from inside a task scheduled on the same
+scheduler the awaited coroutines resume on, if that has only one worker.
+*/
+template <typename T>
+T BlockingWait (AsyncTask<T>& task)
+{
+	struct DoneAwaiter
+	{
+		AsyncTask<T>& task;
+
+		bool await_ready ()
+		{
+			return task.await_ready ();
+		}
+
+		bool await_suspend (std::coroutine_handle<> awaiting)
+		{
+			return task.await_suspend (awaiting);
+		}
+
+		// The result is retrieved by BlockingWait itself
+		void await_resume ()
+		{
+		}
+	};
+
+	std::mutex mutex;
+	std::condition_variable condition;
+	bool done = false;
+
+	auto notifier = [] (DoneAwaiter awaiter, std::mutex& mutex,
+		std::condition_variable& condition, bool& done) -> AsyncTask<void> {
+		co_await awaiter;
+
+		// Notify under the lock, so the waiting thread can't return and
+		// destroy the condition variable while we still use it
+		std::lock_guard<std::mutex> lock (mutex);
+		done = true;
+		condition.notify_all ();
+	} (DoneAwaiter { task }, mutex, condition, done);
+
+	{
+		std::unique_lock<std::mutex> lock (mutex);
+		condition.wait (lock, [&done] () {
+			return done;
+		});
+	}
+
+	return task.await_resume ();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+co_await Resume (scheduler) continues the coroutine on a worker.
+*/
+class ResumeAwaiter
+{
+public:
+	explicit ResumeAwaiter (TaskScheduler& scheduler)
+		: scheduler_ (scheduler)
+	{
+	}
+
+	bool await_ready () const noexcept
+	{
+		return false;
+	}
+
+	void await_suspend (std::coroutine_handle<> coroutine)
+	{
+		scheduler_.Submit ([coroutine] () {
+			coroutine.resume ();
+		});
+	}
+
+	void await_resume () const noexcept
+	{
+	}
+
+private:
+	TaskScheduler& scheduler_;
+};
+
+inline ResumeAwaiter Resume (TaskScheduler& scheduler = TaskScheduler::GetDefault ())
+{
+	return ResumeAwaiter (scheduler);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+co_await fence.Value (n) suspends until the fence has reached n, and resumes
+on a worker of the fence service's scheduler. No thread is blocked in the
+meantime.
+*/
+class AwaitableFence
+{
+public:
+	class ValueAwaiter
+	{
+	public:
+		ValueAwaiter (FenceService& service, FenceSource& fence, const std::uint64_t value)
+			: service_ (service)
+			, fence_ (fence)
+			, value_ (value)
+		{
+		}
+
+		bool await_ready () const
+		{
+			return fence_.GetCompletedValue () >= value_;
+		}
+
+		void await_suspend (std::coroutine_handle<> coroutine)
+		{
+			service_.WhenReached (fence_, value_, [coroutine] () {
+				coroutine.resume ();
+			});
+		}
+
+		void await_resume () const noexcept
+		{
+		}
+
+	private:
+		FenceService& service_;
+		FenceSource& fence_;
+		const std::uint64_t value_;
+	};
+
+	AwaitableFence (FenceService& service, FenceSource& fence)
+		: service_ (service)
+		, fence_ (fence)
+	{
+	}
+
+	ValueAwaiter Value (const std::uint64_t value) const
+	{
+		return ValueAwaiter (service_, fence_, value);
+	}
+
+private:
+	FenceService& service_;
+	FenceSource& fence_;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+co_await on a texture load suspends until the load is done, and resumes on a
+worker of the scheduler. Returns the handle, or rethrows if the load failed.
+*/
+class TextureAwaiter
+{
+public:
+	TextureAwaiter (const TextureHandle& handle, TaskScheduler& scheduler)
+		: handle_ (handle)
+		, scheduler_ (scheduler)
+	{
+	}
+
+	bool await_ready () const
+	{
+		return handle_.GetStatus () != TextureHandle::Status::Pending;
+	}
+
+	void await_suspend (std::coroutine_handle<> coroutine)
+	{
+		// OnDone runs on a loader thread, which must not be held up by
+		// whatever the coroutine does next
+		auto scheduler = &scheduler_;
+		handle_.OnDone ([scheduler, coroutine] () {
+			scheduler->Submit ([coroutine] () {
+				coroutine.resume ();
+			});
+		});
+	}
+
+	TextureHandle await_resume () const
+	{
+		// Doesn't block, the load is done; rethrows if it failed
+		handle_.Wait ();
+		return handle_;
+	}
+
+private:
+	TextureHandle handle_;
+	TaskScheduler& scheduler_;
+};
+
+inline TextureAwaiter LoadTextureAsync (AssetLoader& loader, const char* path,
+	const TextureLoadOptions& options = TextureLoadOptions (),
+	TaskScheduler& scheduler = TaskScheduler::GetDefault ())
+{
+	return TextureAwaiter (loader.LoadTextureFromFile (path, options), scheduler);
+}
+}
+#endif
+
+#endif
@@ -22,10 +22,7 @@
 
 #include "D3D12AnimatedQuad.h"
 
-#include "Shaders.h"
-
 #include "d3dx12.h"
-#include <d3dcompiler.h>
 #include <cmath>
 
 using namespace Microsoft::WRL;
@@ -64,13 +61,14 @@ void D3D12AnimatedQuad::CreateConstantBuffer ()
 ///////////////////////////////////////////////////////////////////////////////
 void D3D12AnimatedQuad::UpdateConstantBuffer ()
 {
-	static int counter = 0;
-	counter++;
+	// Driven by the simulation, so the animation advances once per
+	// simulation step however fast we render
+	const auto step = GetFrameSnapshot ().step;
 
 	void* p;
 	constantBuffers_[GetQueueSlot ()]->Map (0, nullptr, &p);
 	float* f = static_cast<float*>(p);
-	f[0] = std::abs (std::sin (static_cast<float> (counter) / 64.0f));
+	f[0] = std::abs (std::sin (static_cast<float> (step) / 64.0f));
 	constantBuffers_[GetQueueSlot ()]->Unmap (0, nullptr);
 }
 
@@ -211,14 +209,8 @@ void D3D12AnimatedQuad::CreatePipelineStateObject ()
 	};
 
 	ComPtr<ID3DBlob> vertexShader;
-	D3DCompile (Shaders, sizeof (Shaders),
-		"", macros, nullptr,
-		"VS_main", "vs_5_0", 0, 0, &vertexShader, nullptr);
-
 	ComPtr<ID3DBlob> pixelShader;
-	D3DCompile (Shaders, sizeof (Shaders),
-		"", macros, nullptr,
-		"PS_main", "ps_5_0", 0, 0, &pixelShader, nullptr);
+	CompileShaders (macros, &vertexShader, &pixelShader);
 
 	D3D12_GRAPHICS_PIPELINE_STATE_DESC psoDesc = {};
 	psoDesc.VS.BytecodeLength = vertexShader->GetBufferSize ();
@@ -233,9 +225,9 @@ void D3D12AnimatedQuad::CreatePipelineStateObject ()
 	psoDesc.InputLayout.pInputElementDescs = layout;
 	psoDesc.RasterizerState = CD3DX12_RASTERIZER_DESC (D3D12_DEFAULT);
 	psoDesc.BlendState = CD3DX12_BLEND_DESC (D3D12_DEFAULT);
-	// Simple alpha blending
+	// Premultiplied alpha blending
 	psoDesc.BlendState.RenderTarget[0].BlendEnable = true;
-	psoDesc.BlendState.RenderTarget[0].SrcBlend = D3D12_BLEND_SRC_ALPHA;
+	psoDesc.BlendState.RenderTarget[0].SrcBlend = D3D12_BLEND_ONE;
 	psoDesc.BlendState.RenderTarget[0].DestBlend = D3D12_BLEND_INV_SRC_ALPHA;
 	psoDesc.BlendState.RenderTarget[0].BlendOp = D3D12_BLEND_OP_ADD;
 	psoDesc.BlendState.RenderTarget[0].SrcBlendAlpha = D3D12_BLEND_ONE;
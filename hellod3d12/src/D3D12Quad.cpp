@@ -22,23 +22,72 @@
 
 #include "D3D12Quad.h"
 
-#include "Shaders.h"
+#include "CommandBundle.h"
+#include "Hash.h"
 
 #include "d3dx12.h"
-#include <d3dcompiler.h>
 
 using namespace Microsoft::WRL;
 
 namespace AMD {
+///////////////////////////////////////////////////////////////////////////////
+D3D12Quad::D3D12Quad ()
+{
+}
+
+///////////////////////////////////////////////////////////////////////////////
+D3D12Quad::~D3D12Quad ()
+{
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 void D3D12Quad::RenderImpl (ID3D12GraphicsCommandList * commandList)
 {
-	D3D12Sample::RenderImpl (commandList);
+	// Nothing changes from frame to frame, so everything but the root
+	// signature comes from a bundle which is only recorded once per slot
+	commandList->SetGraphicsRootSignature (rootSignature_.Get ());
+
+	drawBundle_->Execute (commandList, GetQueueSlot (), GetDrawInputKey ());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+The quad is opaque and covers the whole screen, so there's no need to
+clear.
+*/
+RenderPassLoadOp D3D12Quad::GetBackBufferLoadOp () const
+{
+	return RenderPassLoadOp::Discard;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void D3D12Quad::RecordDraw (ID3D12GraphicsCommandList* bundle)
+{
+	bundle->SetPipelineState (pso_.Get ());
+	bundle->IASetPrimitiveTopology (D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+	bundle->IASetVertexBuffers (0, 1, &vertexBufferView_);
+	bundle->IASetIndexBuffer (&indexBufferView_);
+	bundle->DrawIndexedInstanced (6, 1, 0, 0, 0);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Everything RecordDraw depends on. If any of it changes, the bundle gets
+recorded again.
+*/
+std::uint64_t D3D12Quad::GetDrawInputKey () const
+{
+	const std::uint64_t inputs [] = {
+		reinterpret_cast<std::uintptr_t> (pso_.Get ()),
+		vertexBufferView_.BufferLocation,
+		vertexBufferView_.SizeInBytes,
+		vertexBufferView_.StrideInBytes,
+		indexBufferView_.BufferLocation,
+		indexBufferView_.SizeInBytes,
+		indexBufferView_.Format
+	};
 
-	commandList->IASetPrimitiveTopology (D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
-	commandList->IASetVertexBuffers (0, 1, &vertexBufferView_);
-	commandList->IASetIndexBuffer (&indexBufferView_);
-	commandList->DrawIndexedInstanced (6, 1, 0, 0, 0);
+	return HashFNV1a (inputs, sizeof (inputs));
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -49,6 +98,11 @@ void D3D12Quad::InitializeImpl (ID3D12GraphicsCommandList * uploadCommandList)
 	CreateRootSignature ();
 	CreatePipelineStateObject ();
 	CreateMeshBuffers (uploadCommandList);
+
+	drawBundle_.reset (new CommandBundle (device_.Get (), GetQueueSlotCount (),
+		[this] (ID3D12GraphicsCommandList* bundle) {
+			RecordDraw (bundle);
+		}));
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -163,14 +217,8 @@ void D3D12Quad::CreatePipelineStateObject ()
 	};
 
 	ComPtr<ID3DBlob> vertexShader;
-	D3DCompile (Shaders, sizeof (Shaders),
-		"", macros, nullptr,
-		"VS_main", "vs_5_0", 0, 0, &vertexShader, nullptr);
-
 	ComPtr<ID3DBlob> pixelShader;
-	D3DCompile (Shaders, sizeof (Shaders),
-		"", macros, nullptr,
-		"PS_main", "ps_5_0", 0, 0, &pixelShader, nullptr);
+	CompileShaders (macros, &vertexShader, &pixelShader);
 
 	D3D12_GRAPHICS_PIPELINE_STATE_DESC psoDesc = {};
 	psoDesc.VS.BytecodeLength = vertexShader->GetBufferSize ();
@@ -185,9 +233,9 @@ void D3D12Quad::CreatePipelineStateObject ()
 	psoDesc.InputLayout.pInputElementDescs = layout;
 	psoDesc.RasterizerState = CD3DX12_RASTERIZER_DESC (D3D12_DEFAULT);
 	psoDesc.BlendState = CD3DX12_BLEND_DESC (D3D12_DEFAULT);
-	// Simple alpha blending
+	// Premultiplied alpha blending
 	psoDesc.BlendState.RenderTarget[0].BlendEnable = true;
-	psoDesc.BlendState.RenderTarget[0].SrcBlend = D3D12_BLEND_SRC_ALPHA;
+	psoDesc.BlendState.RenderTarget[0].SrcBlend = D3D12_BLEND_ONE;
 	psoDesc.BlendState.RenderTarget[0].DestBlend = D3D12_BLEND_INV_SRC_ALPHA;
 	psoDesc.BlendState.RenderTarget[0].BlendOp = D3D12_BLEND_OP_ADD;
 	psoDesc.BlendState.RenderTarget[0].SrcBlendAlpha = D3D12_BLEND_ONE;
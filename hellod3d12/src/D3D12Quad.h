@@ -25,15 +25,27 @@
 
 #include "D3D12Sample.h"
 
+#include <memory>
+
 namespace AMD {
+class CommandBundle;
+
 class D3D12Quad : public D3D12Sample
 {
+public:
+	D3D12Quad ();
+	~D3D12Quad ();
+
 private:
 	void CreateRootSignature ();
 	void CreatePipelineStateObject ();
 	void CreateMeshBuffers (ID3D12GraphicsCommandList* uploadCommandList);
 	void RenderImpl (ID3D12GraphicsCommandList* commandList) override;
 	void InitializeImpl (ID3D12GraphicsCommandList* uploadCommandList) override;
+	RenderPassLoadOp GetBackBufferLoadOp () const override;
+
+	void RecordDraw (ID3D12GraphicsCommandList* bundle);
+	std::uint64_t GetDrawInputKey () const;
 
 	Microsoft::WRL::ComPtr<ID3D12Resource> uploadBuffer_;
 
@@ -42,6 +54,8 @@ private:
 
 	Microsoft::WRL::ComPtr<ID3D12Resource> indexBuffer_;
 	D3D12_INDEX_BUFFER_VIEW indexBufferView_;
+
+	std::unique_ptr<CommandBundle> drawBundle_;
 };
 }
 
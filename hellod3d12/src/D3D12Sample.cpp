@@ -26,10 +26,18 @@
 #include "d3dx12.h"
 #include <iostream>
 #include <d3dcompiler.h>
-#include "Shaders.h"
 #include <algorithm>
+#include <cstring>
+#include <stdexcept>
 
+#include "AssetPack.h"
+#include "EmbeddedAsset.h"
+#include "FrameGraph.h"
 #include "ImageIO.h"
+#include "PassScheduler.h"
+#include "Shaders.h"
+#include "SubmissionBatcher.h"
+#include "TaskScheduler.h"
 #include "Window.h"
 
 #ifdef max 
@@ -44,18 +52,20 @@ struct RenderEnvironment
 {
 	ComPtr<ID3D12Device> device;
 	ComPtr<ID3D12CommandQueue> queue;
+	std::vector<ComPtr<ID3D12CommandQueue>> computeQueues;
 	ComPtr<IDXGISwapChain> swapChain;
 };
 
 ///////////////////////////////////////////////////////////////////////////////
 /**
 Create everything we need for rendering, this includes a device, a command queue,
-and a swap chain.
+optionally some compute queues, and a swap chain.
 */
 RenderEnvironment CreateDeviceAndSwapChainHelper (
 	_In_opt_ IDXGIAdapter* adapter,
 	D3D_FEATURE_LEVEL minimumFeatureLevel,
-	_In_ const DXGI_SWAP_CHAIN_DESC* swapChainDesc)
+	_In_ const DXGI_SWAP_CHAIN_DESC* swapChainDesc,
+	const int computeQueueCount)
 {
 	RenderEnvironment result;
 
@@ -76,6 +86,17 @@ RenderEnvironment CreateDeviceAndSwapChainHelper (
 		throw std::runtime_error ("Command queue creation failed.");
 	}
 
+	queueDesc.Type = D3D12_COMMAND_LIST_TYPE_COMPUTE;
+	result.computeQueues.resize (computeQueueCount);
+
+	for (auto& computeQueue : result.computeQueues) {
+		hr = result.device->CreateCommandQueue (&queueDesc, IID_PPV_ARGS (&computeQueue));
+
+		if (FAILED (hr)) {
+			throw std::runtime_error ("Compute queue creation failed.");
+		}
+	}
+
 	ComPtr<IDXGIFactory4> dxgiFactory;
 	hr = CreateDXGIFactory1 (IID_PPV_ARGS (&dxgiFactory));
 
@@ -110,53 +131,21 @@ D3D12Sample::~D3D12Sample ()
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void D3D12Sample::PrepareRender ()
+void D3D12Sample::Render ()
 {
-	commandAllocators_ [currentBackBuffer_]->Reset ();
-
-	auto commandList = commandLists_ [currentBackBuffer_].Get ();
-	commandList->Reset (
-		commandAllocators_ [currentBackBuffer_].Get (), nullptr);
-
-	D3D12_CPU_DESCRIPTOR_HANDLE renderTargetHandle;
-	CD3DX12_CPU_DESCRIPTOR_HANDLE::InitOffsetted (renderTargetHandle,
-		renderTargetDescriptorHeap_->GetCPUDescriptorHandleForHeapStart (),
-		currentBackBuffer_, renderTargetViewDescriptorSize_);
-
-	commandList->OMSetRenderTargets (1, &renderTargetHandle, true, nullptr);
-	commandList->RSSetViewports (1, &viewport_);
-	commandList->RSSetScissorRects (1, &rectScissor_);
-
-	// Transition back buffer
-	D3D12_RESOURCE_BARRIER barrier;
-	barrier.Transition.pResource = renderTargets_ [currentBackBuffer_].Get ();
-	barrier.Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION;
-	barrier.Flags = D3D12_RESOURCE_BARRIER_FLAG_NONE;
-	barrier.Transition.StateBefore = D3D12_RESOURCE_STATE_PRESENT;
-	barrier.Transition.StateAfter = D3D12_RESOURCE_STATE_RENDER_TARGET;
-	barrier.Transition.Subresource = D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES;
-
-	commandList->ResourceBarrier (1, &barrier);
-
-	static const float clearColor [] = {
-		0.042f, 0.042f, 0.042f,
-		1
-	};
+	static const D3D12_RESOURCE_STATES presentState = D3D12_RESOURCE_STATE_PRESENT;
 
-	commandList->ClearRenderTargetView (renderTargetHandle,
-		clearColor, 0, nullptr);
-}
+	const auto backBuffer = frameGraph_->ImportResource (
+		renderTargets_ [currentBackBuffer_].Get (), presentState, &presentState);
 
-///////////////////////////////////////////////////////////////////////////////
-void D3D12Sample::Render ()
-{
-	PrepareRender ();
-	
-	auto commandList = commandLists_ [currentBackBuffer_].Get ();
+	SetupFrameGraph (*frameGraph_, backBuffer);
 
-	RenderImpl (commandList);
-	
-	FinalizeRender ();
+	frameGraph_->Record (currentBackBuffer_);
+
+	// Gets executed together with everything else submitted for this frame
+	// when presenting, after the passes added while setting up the graph
+	const auto passes = passScheduler_->Execute (currentBackBuffer_);
+	frameGraph_->Submit (passes);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -170,25 +159,56 @@ void D3D12Sample::RenderImpl (ID3D12GraphicsCommandList* commandList)
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void D3D12Sample::FinalizeRender ()
+RenderPassLoadOp D3D12Sample::GetBackBufferLoadOp () const
 {
-	// Transition the swap chain back to present
-	D3D12_RESOURCE_BARRIER barrier;
-	barrier.Transition.pResource = renderTargets_ [currentBackBuffer_].Get ();
-	barrier.Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION;
-	barrier.Flags = D3D12_RESOURCE_BARRIER_FLAG_NONE;
-	barrier.Transition.StateBefore = D3D12_RESOURCE_STATE_RENDER_TARGET;
-	barrier.Transition.StateAfter = D3D12_RESOURCE_STATE_PRESENT;
-	barrier.Transition.Subresource = D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES;
-
-	auto commandList = commandLists_ [currentBackBuffer_].Get ();
-	commandList->ResourceBarrier (1, &barrier);
-
-	commandList->Close ();
-
-	// Execute our commands
-	ID3D12CommandList* commandLists [] = { commandList };
-	commandQueue_->ExecuteCommandLists (std::extent<decltype(commandLists)>::value, commandLists);
+	return RenderPassLoadOp::Clear;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void D3D12Sample::SetupFrameGraph (FrameGraph& graph, const int backBuffer)
+{
+	const auto loadOp = GetBackBufferLoadOp ();
+
+	FrameGraphPassDesc pass;
+	pass.writes.push_back (PassResourceUse ());
+	pass.writes [0].resource = backBuffer;
+	pass.writes [0].state = D3D12_RESOURCE_STATE_RENDER_TARGET;
+
+	// Loading keeps what was there, so the pass doesn't overwrite the back
+	// buffer completely
+	if (loadOp == RenderPassLoadOp::Load) {
+		pass.reads = pass.writes;
+	}
+
+	graph.AddPass (pass, [this, backBuffer, loadOp] (
+		ID3D12GraphicsCommandList* commandList, const FrameGraph& frameGraph) {
+		commandList->RSSetViewports (1, &viewport_);
+		commandList->RSSetScissorRects (1, &rectScissor_);
+
+		static const float clearColor [] = {
+			0.042f, 0.042f, 0.042f,
+			1
+		};
+
+		// The back buffer gets presented, so it's always stored. Same format
+		// as the render target views, see SetupRenderTargets
+		RenderPassDesc renderPass;
+		renderPass.renderTargets.resize (1);
+
+		auto& renderTarget = renderPass.renderTargets [0];
+		CD3DX12_CPU_DESCRIPTOR_HANDLE::InitOffsetted (renderTarget.view,
+			renderTargetDescriptorHeap_->GetCPUDescriptorHandleForHeapStart (),
+			currentBackBuffer_, renderTargetViewDescriptorSize_);
+		renderTarget.resource = frameGraph.GetResource (backBuffer);
+		renderTarget.format = DXGI_FORMAT_R8G8B8A8_UNORM_SRGB;
+		renderTarget.loadOp = loadOp;
+		::memcpy (renderTarget.clearColor, clearColor, sizeof (clearColor));
+
+		const auto mode = GetRenderPassMode (commandList);
+		BeginRenderPass (commandList, renderPass, mode);
+		RenderImpl (commandList);
+		EndRenderPass (commandList, renderPass, mode);
+	});
 }
 
 namespace {
@@ -201,19 +221,120 @@ void WaitForFence (ID3D12Fence* fence, UINT64 completionValue, HANDLE waitEvent)
 }
 }
 
+///////////////////////////////////////////////////////////////////////////////
+void D3D12Sample::SetFramePipelineOptions (const FramePipelineOptions& options)
+{
+	if (options.maxFramesInFlight < 1 || options.maxFramesInFlight > GetQueueSlotCount ()) {
+		throw std::runtime_error ("Frames in flight must be between 1 and the queue slot count");
+	}
+
+	pipelineOptions_ = options;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void D3D12Sample::SetComputeQueueCount (const int count)
+{
+	if (count < 0) {
+		throw std::runtime_error ("Compute queue count must not be negative");
+	}
+
+	computeQueueCount_ = count;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void D3D12Sample::SetAssetPack (const AssetPack* pack)
+{
+	assetPack_ = pack;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void D3D12Sample::CompileShaders (const D3D_SHADER_MACRO* macros,
+	ID3DBlob** vertexShader, ID3DBlob** pixelShader) const
+{
+	// Only one of them is used, it has to stay alive while compiling
+	AssetData packedSource;
+	EmbeddedAssetView embeddedSource;
+
+	const void* source;
+	std::size_t sourceSize;
+
+	if (assetPack_ && assetPack_->Find ("shaders.hlsl") >= 0) {
+		packedSource = assetPack_->Load ("shaders.hlsl");
+		source = packedSource.GetData ();
+		sourceSize = packedSource.GetSize ();
+	} else {
+		embeddedSource = EmbeddedAssetView (Shaders);
+		source = embeddedSource.GetData ();
+		sourceSize = embeddedSource.GetSize ();
+	}
+
+	D3DCompile (source, sourceSize,
+		"", macros, nullptr,
+		"VS_main", "vs_5_0", 0, 0, vertexShader, nullptr);
+
+	D3DCompile (source, sourceSize,
+		"", macros, nullptr,
+		"PS_main", "ps_5_0", 0, 0, pixelShader, nullptr);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void D3D12Sample::SimulateImpl (FrameSnapshot& snapshot)
+{
+	++snapshot.step;
+	snapshot.time += std::chrono::duration<double> (pipelineOptions_.simulationStep).count ();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Wait until the command allocator of the current queue slot can be reused,
+and until no more than the allowed number of frames is in flight.
+*/
+void D3D12Sample::WaitForQueueSlot ()
+{
+	WaitForFence (frameFences_[GetQueueSlot ()].Get (), 
+		fenceValues_[GetQueueSlot ()], frameFenceEvents_[GetQueueSlot ()]);
+
+	// The slot used maxFramesInFlight frames ago. With all slots in flight,
+	// that's the current slot and we're done already
+	const auto oldestSlot = (GetQueueSlot () + GetQueueSlotCount ()
+		- pipelineOptions_.maxFramesInFlight) % GetQueueSlotCount ();
+
+	if (oldestSlot != GetQueueSlot ()) {
+		WaitForFence (frameFences_[oldestSlot].Get (),
+			fenceValues_[oldestSlot], frameFenceEvents_[oldestSlot]);
+	}
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 void D3D12Sample::Run (const int frameCount)
 {
+	// Make sure the scheduler gets created here, so this thread becomes its
+	// main thread
+	auto& taskScheduler = TaskScheduler::GetDefault ();
+
 	Initialize ();
 
+	// Frame i + 1 gets simulated while frame i is recorded on this thread
+	FramePipeline<FrameSnapshot> pipeline (pipelineOptions_, FrameSnapshot (),
+		[this] (FrameSnapshot& snapshot) {
+			SimulateImpl (snapshot);
+		});
+
 	for (int i = 0; i < frameCount; ++i) {
-		WaitForFence (frameFences_[GetQueueSlot ()].Get (), 
-			fenceValues_[GetQueueSlot ()], frameFenceEvents_[GetQueueSlot ()]);
+		WaitForQueueSlot ();
+
+		taskScheduler.RunMainThreadTasks ();
+
+		// Pick up the snapshot only once we can start recording, so we
+		// render the newest one
+		frameSnapshot_ = pipeline.AcquireSnapshot ();
 		
 		Render ();
 		Present ();
 	}
 
+	pipeline.Stop ();
+
 	// Drain the queue, wait for everything to finish
 	for (int i = 0; i < GetQueueSlotCount (); ++i) {
 		WaitForFence (frameFences_[i].Get (), fenceValues_[i], frameFenceEvents_[i]);
@@ -262,6 +383,8 @@ next back buffer and also signal the fence for the current queue slot entry.
 */
 void D3D12Sample::Present ()
 {
+	submissionBatcher_->Flush ();
+
 	swapChain_->Present (1, 0);
 
 	// Mark the fence for the current frame.
@@ -305,15 +428,11 @@ void D3D12Sample::Initialize ()
 	window_.reset (new Window ("AMD HelloD3D12", 1280, 720));
 
 	CreateDeviceAndSwapChain ();
-	CreateAllocatorsAndCommandLists ();
 	CreateViewportScissor ();
 	
-	// Create our upload fence, command list and command allocator
+	// Create our upload command list and command allocator
 	// This will be only used while creating the mesh buffer and the texture
 	// to upload data to the GPU.
-	ComPtr<ID3D12Fence> uploadFence;
-	device_->CreateFence (0, D3D12_FENCE_FLAG_NONE, IID_PPV_ARGS (&uploadFence));
-
 	ComPtr<ID3D12CommandAllocator> uploadCommandAllocator;
 	device_->CreateCommandAllocator (D3D12_COMMAND_LIST_TYPE_DIRECT,
 		IID_PPV_ARGS (&uploadCommandAllocator));
@@ -327,9 +446,9 @@ void D3D12Sample::Initialize ()
 	uploadCommandList->Close ();
 
 	// Execute the upload and finish the command list
-	ID3D12CommandList* commandLists [] = { uploadCommandList.Get () };
-	commandQueue_->ExecuteCommandLists (std::extent<decltype(commandLists)>::value, commandLists);
-	commandQueue_->Signal (uploadFence.Get (), 1);
+	submissionBatcher_->Submit (DIRECT_QUEUE, uploadCommandList.Get ());
+	submissionBatcher_->Flush ();
+	const auto uploadFenceValue = submissionBatcher_->Signal (DIRECT_QUEUE);
 
 	auto waitEvent = CreateEvent (nullptr, FALSE, FALSE, nullptr);
 
@@ -337,7 +456,8 @@ void D3D12Sample::Initialize ()
 		throw std::runtime_error ("Could not create wait event.");
 	}
 
-	WaitForFence (uploadFence.Get (), 1, waitEvent);
+	WaitForFence (submissionBatcher_->GetFence (DIRECT_QUEUE), uploadFenceValue,
+		waitEvent);
 
 	// Cleanup our upload handle
 	uploadCommandAllocator->Reset ();
@@ -387,31 +507,38 @@ void D3D12Sample::CreateDeviceAndSwapChain ()
 	swapChainDesc.Windowed = true;
 
 	auto renderEnv = CreateDeviceAndSwapChainHelper (nullptr, D3D_FEATURE_LEVEL_11_0,
-		&swapChainDesc);
+		&swapChainDesc, computeQueueCount_);
 
 	device_ = renderEnv.device;
 	commandQueue_ = renderEnv.queue;
+	computeQueues_ = renderEnv.computeQueues;
 	swapChain_ = renderEnv.swapChain;
 
+	submissionBatcher_.reset (new SubmissionBatcher (device_.Get ()));
+
+	std::vector<int> passQueues;
+	std::vector<QueueType> passQueueTypes;
+
+	passQueues.push_back (submissionBatcher_->AddQueue (commandQueue_.Get ()));
+	passQueueTypes.push_back (QueueType::Graphics);
+
+	for (const auto& computeQueue : computeQueues_) {
+		passQueues.push_back (submissionBatcher_->AddQueue (computeQueue.Get ()));
+		passQueueTypes.push_back (QueueType::Compute);
+	}
+
+	passScheduler_.reset (new PassScheduler (device_.Get (), *submissionBatcher_,
+		passQueues, passQueueTypes, GetQueueSlotCount ()));
+
+	frameGraph_.reset (new FrameGraph (device_.Get (), *submissionBatcher_,
+		DIRECT_QUEUE, GetQueueSlotCount ()));
+
 	renderTargetViewDescriptorSize_ =
 		device_->GetDescriptorHandleIncrementSize (D3D12_DESCRIPTOR_HEAP_TYPE_RTV);
 
 	SetupSwapChain ();
 }
 
-///////////////////////////////////////////////////////////////////////////////
-void D3D12Sample::CreateAllocatorsAndCommandLists ()
-{
-	for (int i = 0; i < GetQueueSlotCount (); ++i) {
-		device_->CreateCommandAllocator (D3D12_COMMAND_LIST_TYPE_DIRECT,
-			IID_PPV_ARGS (&commandAllocators_ [i]));
-		device_->CreateCommandList (0, D3D12_COMMAND_LIST_TYPE_DIRECT,
-			commandAllocators_ [i].Get (), nullptr,
-			IID_PPV_ARGS (&commandLists_ [i]));
-		commandLists_ [i]->Close ();
-	}
-}
-
 ///////////////////////////////////////////////////////////////////////////////
 void D3D12Sample::CreateViewportScissor ()
 {
@@ -26,11 +26,38 @@
 #include <d3d12.h>
 #include <dxgi.h>
 #include <wrl.h>
+#include <cstdint>
 #include <memory>
+#include <vector>
+
+#include "FramePipeline.h"
+#include "RenderPass.h"
 
 namespace AMD {
+class AssetPack;
+class FrameGraph;
+class PassScheduler;
+class SubmissionBatcher;
 class Window;
 
+///////////////////////////////////////////////////////////////////////////////
+/**
+State of the simulation at one step, handed from the simulation thread to
+the render thread.
+*/
+struct FrameSnapshot
+{
+	/**
+	Number of simulation steps so far.
+	*/
+	std::int64_t step = 0;
+
+	/**
+	Simulated time in seconds.
+	*/
+	double time = 0;
+};
+
 ///////////////////////////////////////////////////////////////////////////////
 class D3D12Sample
 {
@@ -41,6 +68,31 @@ public:
 	D3D12Sample ();
 	virtual ~D3D12Sample ();
 
+	/**
+	Must be called before Run. Throws if maxFramesInFlight is not between 1
+	and the number of queue slots.
+	*/
+	void SetFramePipelineOptions (const FramePipelineOptions& options);
+
+	/**
+	Must be called before Run. Compute passes added to the pass scheduler
+	run on these queues, overlapping the graphics work. Without compute
+	queues, they run on the graphics queue.
+	*/
+	void SetComputeQueueCount (const int count);
+
+	/**
+	Must be called before Run. Assets found in pack are used instead of the
+	copies embedded into the executable, so shaders and textures can be
+	changed without rebuilding. pack must outlive the sample.
+	*/
+	void SetAssetPack (const AssetPack* pack);
+
+	/**
+	Render frameCount frames. The calling thread records and submits the
+	command lists, while the simulation runs on a separate thread, see
+	FramePipeline.
+	*/
 	void Run (const int frameCount);
 
 protected:
@@ -63,6 +115,27 @@ protected:
 	Microsoft::WRL::ComPtr<ID3D12Resource> renderTargets_ [QUEUE_SLOT_COUNT];
 	Microsoft::WRL::ComPtr<ID3D12CommandQueue> commandQueue_;
 
+	/**
+	Command lists for commandQueue_ go through the batcher as queue
+	DIRECT_QUEUE. It submits everything at once when presenting.
+	*/
+	std::unique_ptr<SubmissionBatcher> submissionBatcher_;
+	static const int DIRECT_QUEUE = 0;
+
+	std::vector<Microsoft::WRL::ComPtr<ID3D12CommandQueue>> computeQueues_;
+
+	/**
+	Passes added while setting up the frame graph get recorded and submitted
+	before the frame graph's command lists, which wait for all of them.
+	*/
+	std::unique_ptr<PassScheduler> passScheduler_;
+
+	/**
+	Records the graphics work of every frame on DIRECT_QUEUE, see
+	SetupFrameGraph.
+	*/
+	std::unique_ptr<FrameGraph> frameGraph_;
+
 	HANDLE frameFenceEvents_ [QUEUE_SLOT_COUNT];
 	Microsoft::WRL::ComPtr<ID3D12Fence> frameFences_ [QUEUE_SLOT_COUNT];
 	UINT64 currentFenceValue_;
@@ -73,21 +146,64 @@ protected:
 	Microsoft::WRL::ComPtr<ID3D12RootSignature> rootSignature_;
 	Microsoft::WRL::ComPtr<ID3D12PipelineState> pso_;
 
+	const AssetPack* GetAssetPack () const
+	{
+		return assetPack_;
+	}
+
+	/**
+	Compile VS_main and PS_main from shaders.hlsl, taken from the asset pack
+	if it has it.
+	*/
+	void CompileShaders (const D3D_SHADER_MACRO* macros,
+		ID3DBlob** vertexShader, ID3DBlob** pixelShader) const;
+
 	virtual void InitializeImpl (ID3D12GraphicsCommandList* uploadCommandList);
 	virtual void RenderImpl (ID3D12GraphicsCommandList* commandList);
 
+	/**
+	Add the passes of the current frame to graph. backBuffer is the current
+	back buffer, imported in the present state, which it has to be in again
+	once all passes are done.
+
+	The default adds one pass, which renders into the back buffer with
+	RenderImpl. Passes may record in parallel, so they must not add passes
+	to the pass scheduler; add those here.
+	*/
+	virtual void SetupFrameGraph (FrameGraph& graph, const int backBuffer);
+
+	/**
+	What happens to the back buffer before RenderImpl in the default frame
+	graph. Clears by default; samples which write every pixel should return
+	Discard to save the bandwidth.
+	*/
+	virtual RenderPassLoadOp GetBackBufferLoadOp () const;
+
+	/**
+	Advance the simulation by one step. Called on the simulation thread, so
+	it must not touch anything the render thread uses, and only communicate
+	through the snapshot.
+	*/
+	virtual void SimulateImpl (FrameSnapshot& snapshot);
+
+	/**
+	The snapshot the current frame is rendered from.
+	*/
+	const FrameSnapshot& GetFrameSnapshot () const
+	{
+		return frameSnapshot_;
+	}
+
 private:
 	void Initialize ();
 	void Shutdown ();
 
-	void PrepareRender ();
-	void FinalizeRender ();
-
 	void Render ();
 	void Present ();
 
+	void WaitForQueueSlot ();
+
 	void CreateDeviceAndSwapChain ();
-	void CreateAllocatorsAndCommandLists ();
 	void CreateViewportScissor ();
 	void CreatePipelineStateObject ();
 	void SetupSwapChain ();
@@ -95,10 +211,12 @@ private:
 
 	std::unique_ptr<Window> window_;
 
-	Microsoft::WRL::ComPtr<ID3D12CommandAllocator> commandAllocators_[QUEUE_SLOT_COUNT];
-	Microsoft::WRL::ComPtr<ID3D12GraphicsCommandList> commandLists_[QUEUE_SLOT_COUNT];
-
 	int currentBackBuffer_ = 0;
+
+	FramePipelineOptions pipelineOptions_;
+	int computeQueueCount_ = 0;
+	const AssetPack* assetPack_ = nullptr;
+	FrameSnapshot frameSnapshot_;
 	
 	std::int32_t renderTargetViewDescriptorSize_;
 };
@@ -22,68 +22,14 @@
 
 #include "D3D12TexturedQuad.h"
 
-#include "ImageIO.h"
 #include "RubyTexture.h"
-#include "Shaders.h"
 
 #include "d3dx12.h"
-#include <d3dcompiler.h>
 #include <cmath>
 
 using namespace Microsoft::WRL;
 
 namespace AMD {
-///////////////////////////////////////////////////////////////////////////////
-void D3D12TexturedQuad::CreateTexture (ID3D12GraphicsCommandList * uploadCommandList)
-{
-	int width = 0, height = 0;
-
-	imageData_ = LoadImageFromMemory (RubyTexture, sizeof (RubyTexture),
-		1 /* tight row packing */, &width, &height);
-
-	static const auto defaultHeapProperties = CD3DX12_HEAP_PROPERTIES (D3D12_HEAP_TYPE_DEFAULT);
-	const auto resourceDesc = CD3DX12_RESOURCE_DESC::Tex2D (DXGI_FORMAT_R8G8B8A8_UNORM_SRGB, width, height, 1, 1);
-
-	device_->CreateCommittedResource (&defaultHeapProperties,
-		D3D12_HEAP_FLAG_NONE,
-		&resourceDesc,
-		D3D12_RESOURCE_STATE_COPY_DEST,
-		nullptr,
-		IID_PPV_ARGS (&image_));
-
-	static const auto uploadHeapProperties = CD3DX12_HEAP_PROPERTIES (D3D12_HEAP_TYPE_UPLOAD);
-	const auto uploadBufferSize = GetRequiredIntermediateSize (image_.Get (), 0, 1);
-	const auto uploadBufferDesc = CD3DX12_RESOURCE_DESC::Buffer (uploadBufferSize);
-
-	device_->CreateCommittedResource (&uploadHeapProperties,
-		D3D12_HEAP_FLAG_NONE,
-		&uploadBufferDesc,
-		D3D12_RESOURCE_STATE_GENERIC_READ,
-		nullptr,
-		IID_PPV_ARGS (&uploadImage_));
-
-	D3D12_SUBRESOURCE_DATA srcData;
-	srcData.pData = imageData_.data ();
-	srcData.RowPitch = width * 4;
-	srcData.SlicePitch = width * height * 4;
-
-	UpdateSubresources (uploadCommandList, image_.Get (), uploadImage_.Get (), 0, 0, 1, &srcData);
-	const auto transition = CD3DX12_RESOURCE_BARRIER::Transition (image_.Get (),
-		D3D12_RESOURCE_STATE_COPY_DEST, D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE);
-	uploadCommandList->ResourceBarrier (1, &transition);
-
-	D3D12_SHADER_RESOURCE_VIEW_DESC shaderResourceViewDesc = {};
-	shaderResourceViewDesc.ViewDimension = D3D12_SRV_DIMENSION_TEXTURE2D;
-	shaderResourceViewDesc.Shader4ComponentMapping = D3D12_DEFAULT_SHADER_4_COMPONENT_MAPPING;
-	shaderResourceViewDesc.Format = DXGI_FORMAT_R8G8B8A8_UNORM_SRGB;
-	shaderResourceViewDesc.Texture2D.MipLevels = 1;
-	shaderResourceViewDesc.Texture2D.MostDetailedMip = 0;
-	shaderResourceViewDesc.Texture2D.ResourceMinLODClamp = 0.0f;
-
-	device_->CreateShaderResourceView (image_.Get (), &shaderResourceViewDesc,
-		srvDescriptorHeap_->GetCPUDescriptorHandleForHeapStart ());
-}
-
 ///////////////////////////////////////////////////////////////////////////////
 void D3D12TexturedQuad::RenderImpl (ID3D12GraphicsCommandList * commandList)
 {
@@ -91,14 +37,20 @@ void D3D12TexturedQuad::RenderImpl (ID3D12GraphicsCommandList * commandList)
 
 	UpdateConstantBuffer ();
 
+	if (!image_.IsReady ()) {
+		return;
+	}
+
+	// Rethrows if the load failed
+	const auto& image = image_.Get ();
+
 	// Set the descriptor heap containing the texture srv
 	ID3D12DescriptorHeap* heaps[] = { srvDescriptorHeap_.Get () };
 	commandList->SetDescriptorHeaps (1, heaps);
 
 	// Set slot 0 of our root signature to point to our descriptor heap with
 	// the texture SRV
-	commandList->SetGraphicsRootDescriptorTable (0,
-		srvDescriptorHeap_->GetGPUDescriptorHandleForHeapStart ());
+	commandList->SetGraphicsRootDescriptorTable (0, image.shaderResourceView);
 
 	// Set slot 1 of our root signature to the constant buffer view
 	commandList->SetGraphicsRootConstantBufferView (1,
@@ -126,11 +78,33 @@ void D3D12TexturedQuad::InitializeImpl (ID3D12GraphicsCommandList * uploadComman
 
 	device_->CreateDescriptorHeap (&descriptorHeapDesc, IID_PPV_ARGS (&srvDescriptorHeap_));
 
+	// Start loading the texture before setting up the rest, so it decodes
+	// in the meantime. Textures are shared by content through the texture
+	// cache, which places their views into our descriptor heap
+	diskCache_.reset (new DiskCache ("TextureCache", TEXTURE_CACHE_SIZE));
+	assetLoader_.reset (new AssetLoader (device_.Get (), diskCache_.get ()));
+	textureFactory_.reset (new D3D12TextureFactory (device_.Get (), assetLoader_.get (),
+		srvDescriptorHeap_.Get (), 0, descriptorHeapDesc.NumDescriptors));
+	textureCache_.reset (new TextureCache (textureFactory_.get ()));
+
+	TextureLoadOptions textureOptions;
+	textureOptions.maximumDimension = MAXIMUM_TEXTURE_DIMENSION;
+
+	const auto assetPack = GetAssetPack ();
+	if (assetPack && assetPack->Find ("ruby.jpg") >= 0) {
+		packedImageSource_ = assetPack->Load ("ruby.jpg");
+		image_ = textureCache_->Acquire (packedImageSource_.GetData (),
+			packedImageSource_.GetSize (), textureOptions);
+	} else {
+		imageSource_ = EmbeddedAssetView (RubyTexture);
+		image_ = textureCache_->Acquire (imageSource_.GetData (), imageSource_.GetSize (),
+			textureOptions);
+	}
+
 	CreateRootSignature ();
 	CreatePipelineStateObject ();
 	CreateConstantBuffer ();
 	CreateMeshBuffers (uploadCommandList);
-	CreateTexture (uploadCommandList);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -258,13 +232,14 @@ void D3D12TexturedQuad::CreateConstantBuffer ()
 ///////////////////////////////////////////////////////////////////////////////
 void D3D12TexturedQuad::UpdateConstantBuffer ()
 {
-	static int counter = 0;
-	counter++;
+	// Driven by the simulation, so the animation advances once per
+	// simulation step however fast we render
+	const auto step = GetFrameSnapshot ().step;
 
 	void* p;
 	constantBuffers_[GetQueueSlot ()]->Map (0, nullptr, &p);
 	float* f = static_cast<float*>(p);
-	f[0] = std::abs (std::sin (static_cast<float> (counter) / 64.0f));
+	f[0] = std::abs (std::sin (static_cast<float> (step) / 64.0f));
 	constantBuffers_[GetQueueSlot ()]->Unmap (0, nullptr);
 }
 
@@ -285,7 +260,7 @@ void D3D12TexturedQuad::CreateRootSignature ()
 	// We don't use another descriptor heap for the sampler, instead we use a
 	// static sampler
 	CD3DX12_STATIC_SAMPLER_DESC samplers[1];
-	samplers[0].Init (0, D3D12_FILTER_MIN_MAG_LINEAR_MIP_POINT);
+	samplers[0].Init (0, D3D12_FILTER_MIN_MAG_MIP_LINEAR);
 
 	CD3DX12_ROOT_SIGNATURE_DESC descRootSignature;
 
@@ -320,14 +295,8 @@ void D3D12TexturedQuad::CreatePipelineStateObject ()
 	};
 
 	ComPtr<ID3DBlob> vertexShader;
-	D3DCompile (Shaders, sizeof (Shaders),
-		"", macros, nullptr,
-		"VS_main", "vs_5_0", 0, 0, &vertexShader, nullptr);
-
 	ComPtr<ID3DBlob> pixelShader;
-	D3DCompile (Shaders, sizeof (Shaders),
-		"", macros, nullptr,
-		"PS_main", "ps_5_0", 0, 0, &pixelShader, nullptr);
+	CompileShaders (macros, &vertexShader, &pixelShader);
 
 	D3D12_GRAPHICS_PIPELINE_STATE_DESC psoDesc = {};
 	psoDesc.VS.BytecodeLength = vertexShader->GetBufferSize ();
@@ -342,9 +311,9 @@ void D3D12TexturedQuad::CreatePipelineStateObject ()
 	psoDesc.InputLayout.pInputElementDescs = layout;
 	psoDesc.RasterizerState = CD3DX12_RASTERIZER_DESC (D3D12_DEFAULT);
 	psoDesc.BlendState = CD3DX12_BLEND_DESC (D3D12_DEFAULT);
-	// Simple alpha blending
+	// Premultiplied alpha blending
 	psoDesc.BlendState.RenderTarget[0].BlendEnable = true;
-	psoDesc.BlendState.RenderTarget[0].SrcBlend = D3D12_BLEND_SRC_ALPHA;
+	psoDesc.BlendState.RenderTarget[0].SrcBlend = D3D12_BLEND_ONE;
 	psoDesc.BlendState.RenderTarget[0].DestBlend = D3D12_BLEND_INV_SRC_ALPHA;
 	psoDesc.BlendState.RenderTarget[0].BlendOp = D3D12_BLEND_OP_ADD;
 	psoDesc.BlendState.RenderTarget[0].SrcBlendAlpha = D3D12_BLEND_ONE;
@@ -23,15 +23,26 @@
 #ifndef AMD_TEXTURED_QUAD_D3D12_SAMPLE_H_
 #define AMD_TEXTURED_QUAD_D3D12_SAMPLE_H_
 
+#include "AssetLoader.h"
+#include "AssetPack.h"
 #include "D3D12Sample.h"
+#include "DiskCache.h"
+#include "EmbeddedAsset.h"
+#include "TextureCache.h"
 
-#include <vector>
+#include <memory>
 
 namespace AMD {
 class D3D12TexturedQuad : public D3D12Sample
 {
 private:
-	void CreateTexture (ID3D12GraphicsCommandList* uploadCommandList);
+	// Larger textures are scaled down on load to stay within the memory
+	// budget. This must not be below the window size (1280x720), otherwise
+	// a full screen quad magnifies the texture
+	static const int MAXIMUM_TEXTURE_DIMENSION = 2048;
+	// Converted textures are cached on disk, so later runs skip decoding
+	static const std::uint64_t TEXTURE_CACHE_SIZE = 256 << 20;
+
 	void CreateMeshBuffers (ID3D12GraphicsCommandList* uploadCommandList);
 	void CreateConstantBuffer ();
 	void UpdateConstantBuffer ();
@@ -48,9 +59,19 @@ private:
 	Microsoft::WRL::ComPtr<ID3D12Resource> indexBuffer_;
 	D3D12_INDEX_BUFFER_VIEW indexBufferView_;
 
-	Microsoft::WRL::ComPtr<ID3D12Resource>	image_;
-	Microsoft::WRL::ComPtr<ID3D12Resource>	uploadImage_;
-	std::vector<std::uint8_t>				imageData_;
+	// Declared in dependency order, so they get destroyed in reverse. The
+	// image sources must outlive any load reading from them. The packed
+	// one is used if the asset pack has the image
+	EmbeddedAssetView imageSource_;
+	AssetData packedImageSource_;
+	std::unique_ptr<DiskCache> diskCache_;
+	std::unique_ptr<AssetLoader> assetLoader_;
+	std::unique_ptr<D3D12TextureFactory> textureFactory_;
+	std::unique_ptr<TextureCache> textureCache_;
+
+	// The texture loads in the background, the quad gets drawn once it
+	// is ready
+	TextureReference image_;
 
 	Microsoft::WRL::ComPtr<ID3D12Resource> constantBuffers_[QUEUE_SLOT_COUNT];
 
@@ -0,0 +1,463 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#include "DiskCache.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <stdexcept>
+#include <vector>
+
+#ifdef _WIN32
+#include <Windows.h>
+#else
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <sys/time.h>
+#include <unistd.h>
+#endif
+
+namespace AMD {
+namespace {
+const char ENTRY_EXTENSION [] = ".bin";
+const char TEMPORARY_EXTENSION [] = ".tmp";
+
+struct FileInfo
+{
+	std::string name;
+	std::uint64_t size;
+	// Modification time, in some platform specific unit
+	std::uint64_t time;
+};
+
+bool EndsWith (const std::string& s, const char* suffix)
+{
+	const auto length = std::strlen (suffix);
+	return s.size () >= length && s.compare (s.size () - length, length, suffix) == 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Entries are named after their key as 16 lower-case hex digits.
+*/
+std::string GetEntryName (const std::uint64_t key)
+{
+	static const char digits [] = "0123456789abcdef";
+
+	std::string name (16, '0');
+	for (int i = 0; i < 16; ++i) {
+		name [15 - i] = digits [(key >> (4 * i)) & 0xF];
+	}
+
+	return name + ENTRY_EXTENSION;
+}
+
+bool ParseEntryName (const std::string& name, std::uint64_t* key)
+{
+	if (name.size () != 16 + std::strlen (ENTRY_EXTENSION) ||
+		!EndsWith (name, ENTRY_EXTENSION)) {
+		return false;
+	}
+
+	std::uint64_t result = 0;
+	for (int i = 0; i < 16; ++i) {
+		const char c = name [i];
+		int digit;
+
+		if (c >= '0' && c <= '9') {
+			digit = c - '0';
+		} else if (c >= 'a' && c <= 'f') {
+			digit = c - 'a' + 10;
+		} else {
+			return false;
+		}
+
+		result = (result << 4) | static_cast<std::uint64_t> (digit);
+	}
+
+	*key = result;
+	return true;
+}
+
+#ifdef _WIN32
+///////////////////////////////////////////////////////////////////////////////
+void CreateDirectoryIfMissing (const std::string& path)
+{
+	if (!::CreateDirectoryA (path.c_str (), nullptr) &&
+		::GetLastError () != ERROR_ALREADY_EXISTS) {
+		throw std::runtime_error ("Could not create cache directory");
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::vector<FileInfo> ListFiles (const std::string& directory)
+{
+	std::vector<FileInfo> result;
+
+	WIN32_FIND_DATAA findData;
+	const auto handle = ::FindFirstFileA ((directory + "\\*").c_str (), &findData);
+
+	if (handle == INVALID_HANDLE_VALUE) {
+		return result;
+	}
+
+	do {
+		if (findData.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) {
+			continue;
+		}
+
+		FileInfo info;
+		info.name = findData.cFileName;
+		info.size = (static_cast<std::uint64_t> (findData.nFileSizeHigh) << 32) |
+			findData.nFileSizeLow;
+		info.time = (static_cast<std::uint64_t> (findData.ftLastWriteTime.dwHighDateTime) << 32) |
+			findData.ftLastWriteTime.dwLowDateTime;
+		result.push_back (info);
+	} while (::FindNextFileA (handle, &findData));
+
+	::FindClose (handle);
+	return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::uint64_t GetEntrySize (const std::string& path)
+{
+	WIN32_FILE_ATTRIBUTE_DATA data;
+	if (!::GetFileAttributesExA (path.c_str (), GetFileExInfoStandard, &data)) {
+		throw std::runtime_error ("Could not query cache entry size");
+	}
+
+	return (static_cast<std::uint64_t> (data.nFileSizeHigh) << 32) | data.nFileSizeLow;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void FlushFile (const std::string& path)
+{
+	const auto handle = ::CreateFileA (path.c_str (), GENERIC_WRITE, 0, nullptr,
+		OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+
+	if (handle == INVALID_HANDLE_VALUE) {
+		throw std::runtime_error ("Could not open cache entry");
+	}
+
+	const bool ok = ::FlushFileBuffers (handle) != 0;
+	::CloseHandle (handle);
+
+	if (!ok) {
+		throw std::runtime_error ("Could not flush cache entry");
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+bool MoveIntoPlace (const std::string& from, const std::string& to)
+{
+	return ::MoveFileExA (from.c_str (), to.c_str (),
+		MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH) != 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void TouchFile (const std::string& path)
+{
+	const auto handle = ::CreateFileA (path.c_str (), FILE_WRITE_ATTRIBUTES,
+		FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr,
+		OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+
+	if (handle == INVALID_HANDLE_VALUE) {
+		return;
+	}
+
+	FILETIME now;
+	::GetSystemTimeAsFileTime (&now);
+	::SetFileTime (handle, nullptr, nullptr, &now);
+	::CloseHandle (handle);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int GetProcessIdentifier ()
+{
+	return static_cast<int> (::GetCurrentProcessId ());
+}
+#else
+///////////////////////////////////////////////////////////////////////////////
+void CreateDirectoryIfMissing (const std::string& path)
+{
+	if (::mkdir (path.c_str (), 0755) != 0 && errno != EEXIST) {
+		throw std::runtime_error ("Could not create cache directory");
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::vector<FileInfo> ListFiles (const std::string& directory)
+{
+	std::vector<FileInfo> result;
+
+	auto dir = ::opendir (directory.c_str ());
+	if (dir == nullptr) {
+		return result;
+	}
+
+	while (auto entry = ::readdir (dir)) {
+		struct stat fileStatus;
+		const auto path = directory + "/" + entry->d_name;
+
+		if (::stat (path.c_str (), &fileStatus) != 0 || !S_ISREG (fileStatus.st_mode)) {
+			continue;
+		}
+
+		FileInfo info;
+		info.name = entry->d_name;
+		info.size = static_cast<std::uint64_t> (fileStatus.st_size);
+		info.time = static_cast<std::uint64_t> (fileStatus.st_mtim.tv_sec) * 1000000000ull +
+			static_cast<std::uint64_t> (fileStatus.st_mtim.tv_nsec);
+		result.push_back (info);
+	}
+
+	::closedir (dir);
+	return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::uint64_t GetEntrySize (const std::string& path)
+{
+	struct stat fileStatus;
+	if (::stat (path.c_str (), &fileStatus) != 0) {
+		throw std::runtime_error ("Could not query cache entry size");
+	}
+
+	return static_cast<std::uint64_t> (fileStatus.st_size);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void FlushFile (const std::string& path)
+{
+	const int fd = ::open (path.c_str (), O_RDONLY);
+
+	if (fd == -1) {
+		throw std::runtime_error ("Could not open cache entry");
+	}
+
+	const bool ok = ::fsync (fd) == 0;
+	::close (fd);
+
+	if (!ok) {
+		throw std::runtime_error ("Could not flush cache entry");
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+bool MoveIntoPlace (const std::string& from, const std::string& to)
+{
+	return ::rename (from.c_str (), to.c_str ()) == 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void TouchFile (const std::string& path)
+{
+	::utimes (path.c_str (), nullptr);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int GetProcessIdentifier ()
+{
+	return static_cast<int> (::getpid ());
+}
+#endif
+}
+
+///////////////////////////////////////////////////////////////////////////////
+DiskCache::DiskCache (const char* directory, const std::uint64_t sizeLimit)
+	: directory_ (directory)
+	, sizeLimit_ (sizeLimit)
+{
+	CreateDirectoryIfMissing (directory_);
+
+	auto files = ListFiles (directory_);
+
+	// Oldest first, so the use counter reproduces the order of the last run
+	std::sort (files.begin (), files.end (), [] (const FileInfo& a, const FileInfo& b) {
+		return a.time < b.time;
+	});
+
+	for (const auto& file : files) {
+		if (EndsWith (file.name, TEMPORARY_EXTENSION)) {
+			// Left behind by a crashed writer. Another process using the
+			// same cache may still be writing it, in which case its rename
+			// fails and the entry just doesn't get stored
+			std::remove ((directory_ + "/" + file.name).c_str ());
+			continue;
+		}
+
+		std::uint64_t key;
+		if (!ParseEntryName (file.name, &key)) {
+			continue;
+		}
+
+		Entry entry;
+		entry.size = file.size;
+		entry.lastUse = ++useCounter_;
+		entries_ [key] = entry;
+		size_ += file.size;
+	}
+
+	std::lock_guard<std::mutex> lock (mutex_);
+	EvictLocked (0);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+bool DiskCache::Find (const std::uint64_t key, std::string* path)
+{
+	{
+		std::lock_guard<std::mutex> lock (mutex_);
+
+		auto it = entries_.find (key);
+		if (it == entries_.end ()) {
+			return false;
+		}
+
+		it->second.lastUse = ++useCounter_;
+	}
+
+	*path = GetEntryPath (key);
+	TouchFile (*path);
+
+	return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void DiskCache::Store (const std::uint64_t key,
+	const std::function<void (const char* path)>& write)
+{
+	const auto path = GetEntryPath (key);
+
+	std::string temporaryPath;
+	{
+		std::lock_guard<std::mutex> lock (mutex_);
+
+		// Unique across threads and processes sharing the directory
+		temporaryPath = path + "." + std::to_string (GetProcessIdentifier ()) +
+			"." + std::to_string (++temporaryCounter_) + TEMPORARY_EXTENSION;
+	}
+
+	std::uint64_t size;
+
+	try {
+		write (temporaryPath.c_str ());
+
+		// Without the flush, a crash shortly after the rename can leave the
+		// new name pointing at incomplete contents
+		FlushFile (temporaryPath);
+		size = GetEntrySize (temporaryPath);
+
+		if (!MoveIntoPlace (temporaryPath, path)) {
+			throw std::runtime_error ("Could not move cache entry into place");
+		}
+	} catch (...) {
+		std::remove (temporaryPath.c_str ());
+		throw;
+	}
+
+	std::lock_guard<std::mutex> lock (mutex_);
+
+	auto it = entries_.find (key);
+	if (it != entries_.end ()) {
+		size_ -= it->second.size;
+	}
+
+	Entry entry;
+	entry.size = size;
+	entry.lastUse = ++useCounter_;
+	entries_ [key] = entry;
+	size_ += size;
+
+	EvictLocked (key);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void DiskCache::Remove (const std::uint64_t key)
+{
+	std::lock_guard<std::mutex> lock (mutex_);
+
+	auto it = entries_.find (key);
+	if (it == entries_.end ()) {
+		return;
+	}
+
+	std::remove (GetEntryPath (key).c_str ());
+	size_ -= it->second.size;
+	entries_.erase (it);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::uint64_t DiskCache::GetSize () const
+{
+	std::lock_guard<std::mutex> lock (mutex_);
+	return size_;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::string DiskCache::GetEntryPath (const std::uint64_t key) const
+{
+	return directory_ + "/" + GetEntryName (key);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Remove the least recently used entries until the cache fits into its limit.
+The entry for keep stays, even if it is larger than the limit on its own.
+*/
+void DiskCache::EvictLocked (const std::uint64_t keep)
+{
+	if (size_ <= sizeLimit_) {
+		return;
+	}
+
+	std::vector<std::pair<std::uint64_t, std::uint64_t>> candidates;
+	candidates.reserve (entries_.size ());
+
+	for (const auto& entry : entries_) {
+		if (entry.first != keep) {
+			candidates.push_back (std::make_pair (entry.second.lastUse, entry.first));
+		}
+	}
+
+	std::sort (candidates.begin (), candidates.end ());
+
+	for (const auto& candidate : candidates) {
+		if (size_ <= sizeLimit_) {
+			break;
+		}
+
+		// Files which are in use cannot be deleted on Windows, those stay
+		// until the next eviction
+		if (std::remove (GetEntryPath (candidate.second).c_str ()) != 0) {
+			continue;
+		}
+
+		auto it = entries_.find (candidate.second);
+		size_ -= it->second.size;
+		entries_.erase (it);
+	}
+}
+}
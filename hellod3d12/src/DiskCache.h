@@ -0,0 +1,99 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#ifndef ANTERU_D3D12_SAMPLE_DISKCACHE_H_
+#define ANTERU_D3D12_SAMPLE_DISKCACHE_H_
+
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace AMD {
+///////////////////////////////////////////////////////////////////////////////
+/**
+A directory of files keyed by a 64-bit content hash, limited in size.
+
+Entries are written to a temporary file first, flushed to disk and then
+renamed into place, so a crash while writing never leaves a partial entry
+behind; leftover temporary files are deleted on startup. Once the cache
+grows beyond its size limit, the least recently used entries are evicted.
+Use order is kept in the file modification times, so it persists across
+runs.
+
+All functions can be called from any thread.
+*/
+class DiskCache
+{
+public:
+	DiskCache (const DiskCache&) = delete;
+	DiskCache& operator= (const DiskCache&) = delete;
+
+	/**
+	The directory is created if it does not exist yet.
+	*/
+	DiskCache (const char* directory, const std::uint64_t sizeLimit);
+
+	/**
+	If there is an entry for key, store its path and mark it as used. An
+	entry can get evicted at any time, so opening it may still fail.
+	*/
+	bool Find (const std::uint64_t key, std::string* path);
+
+	/**
+	write must create the file at the path it receives and throw on
+	failure. An existing entry for key gets replaced.
+	*/
+	void Store (const std::uint64_t key,
+		const std::function<void (const char* path)>& write);
+
+	/**
+	Drop an entry, for instance because it turned out to be corrupt.
+	*/
+	void Remove (const std::uint64_t key);
+
+	std::uint64_t GetSize () const;
+
+private:
+	struct Entry
+	{
+		std::uint64_t size;
+		// Larger is more recent
+		std::uint64_t lastUse;
+	};
+
+	std::string GetEntryPath (const std::uint64_t key) const;
+	void EvictLocked (const std::uint64_t keep);
+
+	const std::string directory_;
+	const std::uint64_t sizeLimit_;
+
+	mutable std::mutex mutex_;
+	std::unordered_map<std::uint64_t, Entry> entries_;
+	std::uint64_t size_ = 0;
+	std::uint64_t useCounter_ = 0;
+	std::uint64_t temporaryCounter_ = 0;
+};
+}
+
+#endif
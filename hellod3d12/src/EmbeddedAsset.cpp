@@ -0,0 +1,73 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#include "EmbeddedAsset.h"
+
+#include "Lz4.h"
+
+#include <stdexcept>
+
+namespace AMD {
+///////////////////////////////////////////////////////////////////////////////
+EmbeddedAssetView::EmbeddedAssetView ()
+	: data_ (nullptr)
+	, size_ (0)
+{
+}
+
+///////////////////////////////////////////////////////////////////////////////
+EmbeddedAssetView::EmbeddedAssetView (const EmbeddedAsset& asset)
+	: data_ (asset.data)
+	, size_ (asset.size)
+{
+	// Decompressed assets point into storage_, which is resolved on access so
+	// the view stays valid when copied
+	switch (asset.compression) {
+	case EmbeddedAssetCompression::None:
+		if (asset.storedSize != asset.size) {
+			throw std::runtime_error ("Embedded asset is corrupt");
+		}
+		break;
+
+	case EmbeddedAssetCompression::Lz4:
+		storage_.resize (asset.size);
+		Lz4Decompress (asset.data, asset.storedSize, storage_.data (), storage_.size ());
+		data_ = nullptr;
+		break;
+
+	default:
+		throw std::runtime_error ("Unknown embedded asset compression");
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+const void* EmbeddedAssetView::GetData () const
+{
+	return storage_.empty () ? data_ : storage_.data ();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::size_t EmbeddedAssetView::GetSize () const
+{
+	return size_;
+}
+}
@@ -0,0 +1,73 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#ifndef ANTERU_D3D12_SAMPLE_EMBEDDEDASSET_H_
+#define ANTERU_D3D12_SAMPLE_EMBEDDEDASSET_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace AMD {
+enum class EmbeddedAssetCompression
+{
+	None,
+	Lz4
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+A file compiled into the executable, generated by tools/embedAsset.py. The
+data is stored as little-endian 64-bit words, so it is 8-byte aligned; only
+the first storedSize bytes are meaningful. Use EmbeddedAssetView to access
+the contents.
+*/
+struct EmbeddedAsset
+{
+	const std::uint64_t* data;
+	std::size_t storedSize;
+	std::size_t size;
+	EmbeddedAssetCompression compression;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+The contents of an embedded asset. Uncompressed assets are referenced in
+place, compressed ones are decompressed into memory owned by the view.
+*/
+class EmbeddedAssetView
+{
+public:
+	EmbeddedAssetView ();
+	explicit EmbeddedAssetView (const EmbeddedAsset& asset);
+
+	const void* GetData () const;
+	std::size_t GetSize () const;
+
+private:
+	const void* data_;
+	std::size_t size_;
+	std::vector<std::uint8_t> storage_;
+};
+}
+
+#endif
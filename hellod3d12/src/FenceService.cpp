@@ -0,0 +1,160 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#include "FenceService.h"
+
+#include "TaskScheduler.h"
+
+#include <vector>
+
+namespace AMD {
+///////////////////////////////////////////////////////////////////////////////
+FenceSource::~FenceSource ()
+{
+}
+
+///////////////////////////////////////////////////////////////////////////////
+D3D12FenceSource::D3D12FenceSource (ID3D12Fence* fence)
+	: fence_ (fence)
+{
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::uint64_t D3D12FenceSource::GetCompletedValue ()
+{
+	return fence_->GetCompletedValue ();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+FunctionFenceSource::FunctionFenceSource (std::function<std::uint64_t ()> function)
+	: function_ (std::move (function))
+{
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::uint64_t FunctionFenceSource::GetCompletedValue ()
+{
+	return function_ ();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+FenceService::FenceService (TaskScheduler& scheduler,
+	const std::chrono::microseconds pollInterval)
+	: scheduler_ (scheduler)
+	, pollInterval_ (pollInterval)
+	, pendingCount_ (0)
+	, stop_ (false)
+{
+	pollThread_ = std::thread (&FenceService::PollThreadMain, this);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+FenceService::~FenceService ()
+{
+	{
+		std::lock_guard<std::mutex> lock (mutex_);
+		stop_ = true;
+	}
+
+	wakeUp_.notify_one ();
+	pollThread_.join ();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void FenceService::WhenReached (FenceSource& fence, const std::uint64_t value,
+	std::function<void ()> continuation)
+{
+	if (fence.GetCompletedValue () >= value) {
+		scheduler_.Submit (std::move (continuation));
+		return;
+	}
+
+	bool wasIdle;
+	{
+		std::lock_guard<std::mutex> lock (mutex_);
+		waits_ [&fence].emplace (value, std::move (continuation));
+		wasIdle = (pendingCount_++ == 0);
+	}
+
+	if (wasIdle) {
+		wakeUp_.notify_one ();
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int FenceService::GetPendingCount () const
+{
+	std::lock_guard<std::mutex> lock (mutex_);
+	return pendingCount_;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void FenceService::PollThreadMain ()
+{
+	std::vector<std::function<void ()>> completed;
+
+	std::unique_lock<std::mutex> lock (mutex_);
+	for (;;) {
+		wakeUp_.wait (lock, [this] () {
+			return stop_ || pendingCount_ > 0;
+		});
+
+		if (stop_) {
+			return;
+		}
+
+		for (auto fence = waits_.begin (); fence != waits_.end (); ) {
+			const auto completedValue = fence->first->GetCompletedValue ();
+			auto& fenceWaits = fence->second;
+
+			const auto end = fenceWaits.upper_bound (completedValue);
+			for (auto wait = fenceWaits.begin (); wait != end; ++wait) {
+				completed.push_back (std::move (wait->second));
+			}
+			fenceWaits.erase (fenceWaits.begin (), end);
+
+			if (fenceWaits.empty ()) {
+				fence = waits_.erase (fence);
+			} else {
+				++fence;
+			}
+		}
+
+		pendingCount_ -= static_cast<int> (completed.size ());
+
+		// Submitting may run into the scheduler's locks, don't block
+		// WhenReached meanwhile
+		lock.unlock ();
+		for (auto& continuation : completed) {
+			scheduler_.Submit (std::move (continuation));
+		}
+		completed.clear ();
+		lock.lock ();
+
+		if (pendingCount_ > 0 && !stop_) {
+			wakeUp_.wait_for (lock, pollInterval_, [this] () {
+				return stop_;
+			});
+		}
+	}
+}
+}
@@ -0,0 +1,135 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#ifndef ANTERU_D3D12_SAMPLE_FENCESERVICE_H_
+#define ANTERU_D3D12_SAMPLE_FENCESERVICE_H_
+
+#include <d3d12.h>
+#include <wrl.h>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <thread>
+
+namespace AMD {
+class TaskScheduler;
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Something which reports a monotonically increasing completed value, like a
+GPU fence.
+*/
+class FenceSource
+{
+public:
+	virtual ~FenceSource ();
+
+	virtual std::uint64_t GetCompletedValue () = 0;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+class D3D12FenceSource : public FenceSource
+{
+public:
+	explicit D3D12FenceSource (ID3D12Fence* fence);
+
+	std::uint64_t GetCompletedValue () override;
+
+private:
+	Microsoft::WRL::ComPtr<ID3D12Fence> fence_;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Fence source backed by a function, used to simulate fences in tests or to
+wait on anything else that counts up.
+*/
+class FunctionFenceSource : public FenceSource
+{
+public:
+	explicit FunctionFenceSource (std::function<std::uint64_t ()> function);
+
+	std::uint64_t GetCompletedValue () override;
+
+private:
+	std::function<std::uint64_t ()> function_;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Runs continuations once fences reach a value, without blocking a thread per
+wait. A single thread polls every fence with pending waits once per poll
+interval, and hands the continuations of all waits which are done to the
+task scheduler. It sleeps while nothing is pending.
+
+Waits are sorted by value per fence, so each poll costs one query per fence
+plus the waits which actually completed, however many are pending.
+
+Fence sources must stay alive until all of their waits have completed.
+*/
+class FenceService
+{
+public:
+	FenceService (const FenceService&) = delete;
+	FenceService& operator= (const FenceService&) = delete;
+
+	explicit FenceService (TaskScheduler& scheduler,
+		const std::chrono::microseconds pollInterval = std::chrono::microseconds (250));
+
+	/**
+	Pending waits are dropped without running their continuations, so
+	coroutines suspended on them are never resumed.
+	*/
+	~FenceService ();
+
+	/**
+	Submit continuation to the scheduler once fence reaches value. If it has
+	already, the continuation is submitted right away.
+	*/
+	void WhenReached (FenceSource& fence, const std::uint64_t value,
+		std::function<void ()> continuation);
+
+	/**
+	Number of waits which have not completed yet.
+	*/
+	int GetPendingCount () const;
+
+private:
+	void PollThreadMain ();
+
+	TaskScheduler& scheduler_;
+	const std::chrono::microseconds pollInterval_;
+
+	mutable std::mutex mutex_;
+	std::condition_variable wakeUp_;
+	std::map<FenceSource*, std::multimap<std::uint64_t, std::function<void ()>>> waits_;
+	int pendingCount_;
+	bool stop_;
+
+	std::thread pollThread_;
+};
+}
+
+#endif
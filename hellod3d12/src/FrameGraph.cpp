@@ -0,0 +1,797 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+
+#include "FrameGraph.h"
+
+#include "Parallel.h"
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+namespace AMD {
+namespace {
+///////////////////////////////////////////////////////////////////////////////
+struct MergedUse
+{
+	int resource;
+	D3D12_RESOURCE_STATES state;
+	bool read;
+	bool written;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+void AddUse (std::vector<MergedUse>& uses, const PassResourceUse& use,
+	const bool write, const int resourceCount)
+{
+	if (use.resource < 0 || use.resource >= resourceCount) {
+		throw std::runtime_error ("Pass resource out of range");
+	}
+
+	for (auto& merged : uses) {
+		if (merged.resource != use.resource) {
+			continue;
+		}
+
+		if (merged.state != use.state) {
+			if (write || merged.written) {
+				throw std::runtime_error ("Pass writes a resource it also uses in another state");
+			}
+
+			merged.state = static_cast<D3D12_RESOURCE_STATES> (merged.state | use.state);
+		}
+
+		merged.read = merged.read || !write;
+		merged.written = merged.written || write;
+		return;
+	}
+
+	MergedUse merged;
+	merged.resource = use.resource;
+	merged.state = use.state;
+	merged.read = !write;
+	merged.written = write;
+	uses.push_back (merged);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::uint64_t AlignUp (const std::uint64_t value, const std::uint64_t alignment)
+{
+	if (alignment == 0) {
+		return value;
+	}
+
+	return (value + alignment - 1) / alignment * alignment;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+bool IsSameDesc (const D3D12_RESOURCE_DESC& a, const D3D12_RESOURCE_DESC& b)
+{
+	return a.Dimension == b.Dimension
+		&& a.Alignment == b.Alignment
+		&& a.Width == b.Width
+		&& a.Height == b.Height
+		&& a.DepthOrArraySize == b.DepthOrArraySize
+		&& a.MipLevels == b.MipLevels
+		&& a.Format == b.Format
+		&& a.SampleDesc.Count == b.SampleDesc.Count
+		&& a.SampleDesc.Quality == b.SampleDesc.Quality
+		&& a.Layout == b.Layout
+		&& a.Flags == b.Flags;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+bool IsSameClearValue (const D3D12_CLEAR_VALUE& a, const D3D12_CLEAR_VALUE& b,
+	const D3D12_RESOURCE_DESC& desc)
+{
+	if (a.Format != b.Format) {
+		return false;
+	}
+
+	if (desc.Flags & D3D12_RESOURCE_FLAG_ALLOW_DEPTH_STENCIL) {
+		return a.DepthStencil.Depth == b.DepthStencil.Depth &&
+			a.DepthStencil.Stencil == b.DepthStencil.Stencil;
+	}
+
+	return ::memcmp (a.Color, b.Color, sizeof (a.Color)) == 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void AddTransitionBarriers (std::vector<D3D12_RESOURCE_BARRIER>& barriers,
+	const std::vector<ResourceTransition>& transitions, const FrameGraph& graph)
+{
+	for (const auto& transition : transitions) {
+		D3D12_RESOURCE_BARRIER barrier = {};
+		barrier.Flags = D3D12_RESOURCE_BARRIER_FLAG_NONE;
+
+		if (transition.before == transition.after) {
+			barrier.Type = D3D12_RESOURCE_BARRIER_TYPE_UAV;
+			barrier.UAV.pResource = graph.GetResource (transition.resource);
+		} else {
+			barrier.Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION;
+			barrier.Transition.pResource = graph.GetResource (transition.resource);
+			barrier.Transition.StateBefore = transition.before;
+			barrier.Transition.StateAfter = transition.after;
+			barrier.Transition.Subresource = D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES;
+		}
+
+		barriers.push_back (barrier);
+	}
+}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TransientHeapType GetTransientHeapType (const D3D12_RESOURCE_DESC& desc)
+{
+	if (desc.Dimension == D3D12_RESOURCE_DIMENSION_BUFFER) {
+		return TransientHeapType::Buffer;
+	}
+
+	if (desc.Flags & (D3D12_RESOURCE_FLAG_ALLOW_RENDER_TARGET | D3D12_RESOURCE_FLAG_ALLOW_DEPTH_STENCIL)) {
+		return TransientHeapType::RenderTargetTexture;
+	}
+
+	return TransientHeapType::Texture;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::uint64_t PackTransientAllocations (
+	const std::vector<TransientAllocationRequest>& requests,
+	std::vector<std::uint64_t>& offsets)
+{
+	const int count = static_cast<int> (requests.size ());
+
+	std::vector<int> order (count);
+	for (int i = 0; i < count; ++i) {
+		order [i] = i;
+	}
+
+	// Large allocations first, they are the hardest to fit in between
+	std::stable_sort (order.begin (), order.end (), [&] (const int a, const int b) {
+		return requests [a].size > requests [b].size;
+	});
+
+	offsets.assign (count, 0);
+	std::uint64_t totalSize = 0;
+
+	std::vector<int> placed;
+	std::vector<int> overlapping;
+
+	for (const auto index : order) {
+		const auto& request = requests [index];
+
+		overlapping.clear ();
+		for (const auto other : placed) {
+			if (requests [other].begin <= request.end && request.begin <= requests [other].end) {
+				overlapping.push_back (other);
+			}
+		}
+
+		std::sort (overlapping.begin (), overlapping.end (), [&] (const int a, const int b) {
+			return offsets [a] < offsets [b];
+		});
+
+		// The first gap between allocations in use at the same time which is
+		// large enough
+		std::uint64_t offset = 0;
+		for (const auto other : overlapping) {
+			if (AlignUp (offset, request.alignment) + request.size <= offsets [other]) {
+				break;
+			}
+
+			offset = (std::max) (offset, offsets [other] + requests [other].size);
+		}
+
+		offsets [index] = AlignUp (offset, request.alignment);
+		totalSize = (std::max) (totalSize, offsets [index] + request.size);
+		placed.push_back (index);
+	}
+
+	return totalSize;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+CompiledFrameGraph CompileFrameGraph (const std::vector<FrameGraphPassDesc>& passes,
+	const std::vector<FrameGraphResourceDesc>& resources)
+{
+	const int passCount = static_cast<int> (passes.size ());
+	const int resourceCount = static_cast<int> (resources.size ());
+
+	std::vector<std::vector<MergedUse>> uses (passCount);
+	for (int i = 0; i < passCount; ++i) {
+		for (const auto& read : passes [i].reads) {
+			AddUse (uses [i], read, false, resourceCount);
+		}
+
+		for (const auto& write : passes [i].writes) {
+			AddUse (uses [i], write, true, resourceCount);
+		}
+	}
+
+	// Walk backwards from the outputs. A resource is needed if a pass kept
+	// later reads it before anyone overwrites it
+	std::vector<bool> needed (resourceCount);
+	for (int i = 0; i < resourceCount; ++i) {
+		needed [i] = resources [i].imported;
+	}
+
+	std::vector<bool> kept (passCount, false);
+	for (int i = passCount - 1; i >= 0; --i) {
+		bool keep = passes [i].sideEffects;
+		for (const auto& use : uses [i]) {
+			if (use.written && needed [use.resource]) {
+				keep = true;
+			}
+		}
+
+		if (!keep) {
+			continue;
+		}
+
+		kept [i] = true;
+
+		for (const auto& use : uses [i]) {
+			if (use.written && !use.read) {
+				needed [use.resource] = resources [use.resource].imported;
+			}
+		}
+
+		for (const auto& use : uses [i]) {
+			if (use.read) {
+				needed [use.resource] = true;
+			}
+		}
+	}
+
+	CompiledFrameGraph compiled;
+	compiled.placements.resize (resourceCount);
+
+	std::vector<ScheduledPassDesc> scheduledPasses;
+	for (int i = 0; i < passCount; ++i) {
+		if (!kept [i]) {
+			continue;
+		}
+
+		const int index = static_cast<int> (compiled.passes.size ());
+
+		CompiledFrameGraphPass pass;
+		pass.pass = i;
+		compiled.passes.push_back (pass);
+
+		ScheduledPassDesc scheduled;
+		for (const auto& use : uses [i]) {
+			PassResourceUse resourceUse;
+			resourceUse.resource = use.resource;
+			resourceUse.state = use.state;
+			scheduled.uses.push_back (resourceUse);
+
+			auto& placement = compiled.placements [use.resource];
+			if (placement.firstPass == -1) {
+				placement.firstPass = index;
+			}
+			placement.lastPass = index;
+		}
+
+		scheduledPasses.push_back (scheduled);
+	}
+
+	// Place the transient resources which are used, per heap type
+	for (int type = 0; type < TRANSIENT_HEAP_TYPE_COUNT; ++type) {
+		std::vector<int> members;
+		std::vector<TransientAllocationRequest> requests;
+
+		for (int i = 0; i < resourceCount; ++i) {
+			const auto& resource = resources [i];
+			const auto& placement = compiled.placements [i];
+
+			if (resource.imported || placement.firstPass == -1 ||
+				static_cast<int> (resource.heapType) != type) {
+				continue;
+			}
+
+			TransientAllocationRequest request;
+			request.size = resource.size;
+			request.alignment = resource.alignment;
+			request.begin = placement.firstPass;
+			request.end = placement.lastPass;
+
+			members.push_back (i);
+			requests.push_back (request);
+		}
+
+		std::vector<std::uint64_t> offsets;
+		compiled.heapSizes [type] = PackTransientAllocations (requests, offsets);
+
+		for (std::size_t i = 0; i < members.size (); ++i) {
+			compiled.placements [members [i]].offset = offsets [i];
+		}
+	}
+
+	// One graphics queue can do every transition, so the schedule has one
+	// pass for every pass kept, and only begin transitions
+	std::vector<D3D12_RESOURCE_STATES> initialStates (resourceCount);
+	for (int i = 0; i < resourceCount; ++i) {
+		initialStates [i] = resources [i].initialState;
+	}
+
+	const auto schedule = SchedulePasses (scheduledPasses,
+		std::vector<QueueType> (1, QueueType::Graphics), initialStates);
+
+	for (std::size_t i = 0; i < schedule.passes.size (); ++i) {
+		compiled.passes [i].beginTransitions = schedule.passes [i].beginTransitions;
+	}
+
+	compiled.finalStates = schedule.finalStates;
+
+	for (int i = 0; i < resourceCount; ++i) {
+		const auto& resource = resources [i];
+		const auto& placement = compiled.placements [i];
+
+		if (resource.imported || placement.firstPass == -1) {
+			continue;
+		}
+
+		// Activate the memory. The resource which used it before is the one
+		// which ended last among those overlapping it, provided it took over
+		// the memory of all the others
+		std::vector<int> previous;
+		for (int j = 0; j < resourceCount; ++j) {
+			const auto& other = resources [j];
+			const auto& otherPlacement = compiled.placements [j];
+
+			if (other.imported || otherPlacement.firstPass == -1 ||
+				other.heapType != resource.heapType ||
+				otherPlacement.lastPass >= placement.firstPass) {
+				continue;
+			}
+
+			if (otherPlacement.offset < placement.offset + resource.size &&
+				placement.offset < otherPlacement.offset + other.size) {
+				previous.push_back (j);
+			}
+		}
+
+		FrameGraphAliasingBarrier aliasing;
+		aliasing.before = -1;
+		aliasing.after = i;
+
+		for (const auto j : previous) {
+			if (aliasing.before == -1 ||
+				compiled.placements [j].lastPass > compiled.placements [aliasing.before].lastPass) {
+				aliasing.before = j;
+			}
+		}
+
+		for (const auto j : previous) {
+			if (aliasing.before == -1 || j == aliasing.before) {
+				continue;
+			}
+
+			const auto& last = compiled.placements [aliasing.before];
+			const auto& other = compiled.placements [j];
+			const auto begin = (std::max) (other.offset, placement.offset);
+			const auto end = (std::min) (other.offset + resources [j].size,
+				placement.offset + resource.size);
+
+			if (other.lastPass >= last.firstPass || begin < last.offset ||
+				end > last.offset + resources [aliasing.before].size) {
+				aliasing.before = -1;
+			}
+		}
+
+		auto& firstPass = compiled.passes [placement.firstPass];
+		firstPass.aliasingBarriers.push_back (aliasing);
+
+		// Render targets and depth stencils must be initialized after an
+		// aliasing barrier. If the first pass writes them through something
+		// else, it has to take care of that itself
+		if (resource.heapType == TransientHeapType::RenderTargetTexture) {
+			for (const auto& use : scheduledPasses [placement.firstPass].uses) {
+				if (use.resource == i && (use.state == D3D12_RESOURCE_STATE_RENDER_TARGET ||
+					use.state == D3D12_RESOURCE_STATE_DEPTH_WRITE)) {
+					firstPass.discards.push_back (i);
+				}
+			}
+		}
+
+		// Transient resources are always left in their initial state, so
+		// the placed resources can be reused next frame
+		if (compiled.finalStates [i] != resource.initialState) {
+			ResourceTransition transition;
+			transition.resource = i;
+			transition.before = compiled.finalStates [i];
+			transition.after = resource.initialState;
+
+			compiled.passes [placement.lastPass].endTransitions.push_back (transition);
+			compiled.finalStates [i] = resource.initialState;
+		}
+	}
+
+	for (int i = 0; i < resourceCount; ++i) {
+		const auto& resource = resources [i];
+
+		if (!resource.imported || !resource.hasFinalState ||
+			compiled.finalStates [i] == resource.finalState) {
+			continue;
+		}
+
+		ResourceTransition transition;
+		transition.resource = i;
+		transition.before = compiled.finalStates [i];
+		transition.after = resource.finalState;
+
+		if (compiled.passes.empty ()) {
+			CompiledFrameGraphPass pass;
+			pass.pass = -1;
+			compiled.passes.push_back (pass);
+		}
+
+		compiled.passes.back ().endTransitions.push_back (transition);
+		compiled.finalStates [i] = resource.finalState;
+	}
+
+	return compiled;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+FrameGraph::FrameGraph (ID3D12Device* device, SubmissionBatcher& batcher,
+	const int queue, const int slotCount)
+	: device_ (device)
+	, batcher_ (batcher)
+	, queue_ (queue)
+	, slots_ (slotCount)
+	, currentSlot_ (-1)
+	, recordedCount_ (0)
+{
+	for (auto& slot : slots_) {
+		for (int i = 0; i < TRANSIENT_HEAP_TYPE_COUNT; ++i) {
+			slot.heapAlignments [i] = 0;
+		}
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+FrameGraph::~FrameGraph ()
+{
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int FrameGraph::ImportResource (ID3D12Resource* resource,
+	const D3D12_RESOURCE_STATES state, const D3D12_RESOURCE_STATES* finalState)
+{
+	Resource entry;
+	entry.desc.imported = true;
+	entry.desc.initialState = state;
+
+	if (finalState) {
+		entry.desc.hasFinalState = true;
+		entry.desc.finalState = *finalState;
+	}
+
+	entry.resource = resource;
+	entry.hasClearValue = false;
+	entry.cacheEntry = -1;
+
+	resources_.push_back (entry);
+	return static_cast<int> (resources_.size ()) - 1;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int FrameGraph::CreateTransientResource (const D3D12_RESOURCE_DESC& desc,
+	const D3D12_CLEAR_VALUE* clearValue)
+{
+	auto allocationInfo = device_->GetResourceAllocationInfo (0, 1, &desc);
+
+	Resource entry;
+	entry.desc.heapType = GetTransientHeapType (desc);
+	entry.desc.size = allocationInfo.SizeInBytes;
+	entry.desc.alignment = allocationInfo.Alignment;
+
+	// The state placed resources are created in, and returned to after
+	// their last pass
+	if (desc.Flags & D3D12_RESOURCE_FLAG_ALLOW_RENDER_TARGET) {
+		entry.desc.initialState = D3D12_RESOURCE_STATE_RENDER_TARGET;
+	} else if (desc.Flags & D3D12_RESOURCE_FLAG_ALLOW_DEPTH_STENCIL) {
+		entry.desc.initialState = D3D12_RESOURCE_STATE_DEPTH_WRITE;
+	}
+
+	entry.resourceDesc = desc;
+	entry.hasClearValue = (clearValue != nullptr);
+	if (clearValue) {
+		entry.clearValue = *clearValue;
+	} else {
+		::memset (&entry.clearValue, 0, sizeof (entry.clearValue));
+	}
+	entry.cacheEntry = -1;
+
+	resources_.push_back (entry);
+	return static_cast<int> (resources_.size ()) - 1;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void FrameGraph::AddPass (const FrameGraphPassDesc& desc, RecordFunction record)
+{
+	Pass pass;
+	pass.desc = desc;
+	pass.record = std::move (record);
+	passes_.push_back (std::move (pass));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+ID3D12Resource* FrameGraph::GetResource (const int resource) const
+{
+	return resources_ [resource].resource.Get ();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void FrameGraph::Record (const int slot)
+{
+	std::vector<FrameGraphPassDesc> passDescs;
+	for (const auto& pass : passes_) {
+		passDescs.push_back (pass.desc);
+	}
+
+	std::vector<FrameGraphResourceDesc> resourceDescs;
+	for (const auto& resource : resources_) {
+		resourceDescs.push_back (resource.desc);
+	}
+
+	const auto compiled = CompileFrameGraph (passDescs, resourceDescs);
+
+	auto& slotData = slots_ [slot];
+	AllocateTransientResources (slotData, compiled);
+
+	// Lists are handed out up front, only the recording runs in parallel
+	const int count = static_cast<int> (compiled.passes.size ());
+	std::vector<ID3D12GraphicsCommandList*> commandLists (count);
+	for (int i = 0; i < count; ++i) {
+		commandLists [i] = GetCommandList (slotData, i);
+	}
+
+	ParallelFor (count, 1, [&] (const int begin, const int end) {
+		for (int i = begin; i < end; ++i) {
+			RecordPass (commandLists [i], compiled.passes [i]);
+		}
+	});
+
+	currentSlot_ = slot;
+	recordedCount_ = count;
+
+	statistics_ = Statistics ();
+	for (const auto& pass : compiled.passes) {
+		if (pass.pass != -1) {
+			++statistics_.passes;
+		}
+
+		statistics_.barriers += static_cast<int> (pass.aliasingBarriers.size ()
+			+ pass.beginTransitions.size () + pass.endTransitions.size ());
+	}
+	statistics_.culledPasses = static_cast<int> (passes_.size ()) - statistics_.passes;
+
+	for (int i = 0; i < TRANSIENT_HEAP_TYPE_COUNT; ++i) {
+		statistics_.transientMemory += compiled.heapSizes [i];
+	}
+
+	for (std::size_t i = 0; i < resources_.size (); ++i) {
+		if (!resources_ [i].desc.imported && compiled.placements [i].firstPass != -1) {
+			statistics_.unaliasedTransientMemory += resources_ [i].desc.size;
+		}
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void FrameGraph::Submit (const std::vector<SubmissionHandle>& dependencies)
+{
+	if (currentSlot_ == -1) {
+		throw std::runtime_error ("Nothing recorded to submit");
+	}
+
+	auto& slot = slots_ [currentSlot_];
+	for (int i = 0; i < recordedCount_; ++i) {
+		batcher_.Submit (queue_, slot.commandLists [i].commandList.Get (),
+			(i == 0) ? dependencies : std::vector<SubmissionHandle> ());
+	}
+
+	currentSlot_ = -1;
+	recordedCount_ = 0;
+	resources_.clear ();
+	passes_.clear ();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+const FrameGraph::Statistics& FrameGraph::GetStatistics () const
+{
+	return statistics_;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void FrameGraph::AllocateTransientResources (Slot& slot,
+	const CompiledFrameGraph& compiled)
+{
+	for (int type = 0; type < TRANSIENT_HEAP_TYPE_COUNT; ++type) {
+		std::uint64_t alignment = D3D12_DEFAULT_RESOURCE_PLACEMENT_ALIGNMENT;
+		for (std::size_t i = 0; i < resources_.size (); ++i) {
+			const auto& desc = resources_ [i].desc;
+			if (!desc.imported && static_cast<int> (desc.heapType) == type &&
+				compiled.placements [i].firstPass != -1) {
+				alignment = (std::max) (alignment, desc.alignment);
+			}
+		}
+
+		auto& heap = slot.heaps [type];
+		const auto size = AlignUp (compiled.heapSizes [type], alignment);
+
+		if (size == 0 || (heap && heap->GetDesc ().SizeInBytes >= size &&
+			slot.heapAlignments [type] >= alignment)) {
+			continue;
+		}
+
+		// The resources placed in the old heap go away with it
+		slot.cache.erase (std::remove_if (slot.cache.begin (), slot.cache.end (),
+			[type] (const CachedResource& cached) {
+				return static_cast<int> (cached.heapType) == type;
+			}), slot.cache.end ());
+
+		static const D3D12_HEAP_FLAGS heapFlags [TRANSIENT_HEAP_TYPE_COUNT] = {
+			D3D12_HEAP_FLAG_ALLOW_ONLY_BUFFERS,
+			D3D12_HEAP_FLAG_ALLOW_ONLY_RT_DS_TEXTURES,
+			D3D12_HEAP_FLAG_ALLOW_ONLY_NON_RT_DS_TEXTURES
+		};
+
+		D3D12_HEAP_DESC heapDesc = {};
+		heapDesc.SizeInBytes = size;
+		heapDesc.Properties.Type = D3D12_HEAP_TYPE_DEFAULT;
+		heapDesc.Alignment = alignment;
+		heapDesc.Flags = heapFlags [type];
+
+		heap.Reset ();
+		if (FAILED (device_->CreateHeap (&heapDesc, IID_PPV_ARGS (&heap)))) {
+			throw std::runtime_error ("Could not create transient heap");
+		}
+
+		slot.heapAlignments [type] = alignment;
+	}
+
+	for (auto& cached : slot.cache) {
+		cached.used = false;
+	}
+
+	for (std::size_t i = 0; i < resources_.size (); ++i) {
+		auto& resource = resources_ [i];
+		const auto& placement = compiled.placements [i];
+
+		if (resource.desc.imported || placement.firstPass == -1) {
+			continue;
+		}
+
+		CachedResource* match = nullptr;
+		for (auto& cached : slot.cache) {
+			if (!cached.used && cached.heapType == resource.desc.heapType &&
+				cached.offset == placement.offset &&
+				cached.hasClearValue == resource.hasClearValue &&
+				IsSameDesc (cached.desc, resource.resourceDesc) &&
+				(!cached.hasClearValue || IsSameClearValue (cached.clearValue,
+					resource.clearValue, cached.desc))) {
+				match = &cached;
+				break;
+			}
+		}
+
+		if (!match) {
+			CachedResource cached;
+			cached.desc = resource.resourceDesc;
+			cached.clearValue = resource.clearValue;
+			cached.hasClearValue = resource.hasClearValue;
+			cached.heapType = resource.desc.heapType;
+			cached.offset = placement.offset;
+			cached.state = resource.desc.initialState;
+
+			if (FAILED (device_->CreatePlacedResource (
+				slot.heaps [static_cast<int> (cached.heapType)].Get (), cached.offset,
+				&cached.desc, cached.state,
+				cached.hasClearValue ? &cached.clearValue : nullptr,
+				IID_PPV_ARGS (&cached.resource)))) {
+				throw std::runtime_error ("Could not create transient resource");
+			}
+
+			slot.cache.push_back (cached);
+			match = &slot.cache.back ();
+		}
+
+		match->used = true;
+		resource.resource = match->resource;
+	}
+
+	// Whatever wasn't needed this time likely won't be next time either
+	slot.cache.erase (std::remove_if (slot.cache.begin (), slot.cache.end (),
+		[] (const CachedResource& cached) {
+			return !cached.used;
+		}), slot.cache.end ());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+ID3D12GraphicsCommandList* FrameGraph::GetCommandList (Slot& slot, const int index)
+{
+	if (index < static_cast<int> (slot.commandLists.size ())) {
+		auto& entry = slot.commandLists [index];
+		entry.allocator->Reset ();
+		entry.commandList->Reset (entry.allocator.Get (), nullptr);
+		return entry.commandList.Get ();
+	}
+
+	CommandList entry;
+	if (FAILED (device_->CreateCommandAllocator (D3D12_COMMAND_LIST_TYPE_DIRECT,
+		IID_PPV_ARGS (&entry.allocator)))) {
+		throw std::runtime_error ("Could not create frame graph command allocator");
+	}
+
+	if (FAILED (device_->CreateCommandList (0, D3D12_COMMAND_LIST_TYPE_DIRECT,
+		entry.allocator.Get (), nullptr, IID_PPV_ARGS (&entry.commandList)))) {
+		throw std::runtime_error ("Could not create frame graph command list");
+	}
+
+	slot.commandLists.push_back (entry);
+	return slot.commandLists.back ().commandList.Get ();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void FrameGraph::RecordPass (ID3D12GraphicsCommandList* commandList,
+	const CompiledFrameGraphPass& pass)
+{
+	std::vector<D3D12_RESOURCE_BARRIER> barriers;
+
+	for (const auto& aliasing : pass.aliasingBarriers) {
+		D3D12_RESOURCE_BARRIER barrier = {};
+		barrier.Type = D3D12_RESOURCE_BARRIER_TYPE_ALIASING;
+		barrier.Flags = D3D12_RESOURCE_BARRIER_FLAG_NONE;
+		barrier.Aliasing.pResourceBefore = (aliasing.before == -1)
+			? nullptr : GetResource (aliasing.before);
+		barrier.Aliasing.pResourceAfter = GetResource (aliasing.after);
+
+		barriers.push_back (barrier);
+	}
+
+	AddTransitionBarriers (barriers, pass.beginTransitions, *this);
+
+	if (!barriers.empty ()) {
+		commandList->ResourceBarrier (static_cast<UINT> (barriers.size ()), barriers.data ());
+	}
+
+	for (const auto resource : pass.discards) {
+		commandList->DiscardResource (GetResource (resource), nullptr);
+	}
+
+	if (pass.pass != -1) {
+		passes_ [pass.pass].record (commandList, *this);
+	}
+
+	barriers.clear ();
+	AddTransitionBarriers (barriers, pass.endTransitions, *this);
+
+	if (!barriers.empty ()) {
+		commandList->ResourceBarrier (static_cast<UINT> (barriers.size ()), barriers.data ());
+	}
+
+	commandList->Close ();
+}
+}
@@ -0,0 +1,367 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+
+#ifndef ANTERU_D3D12_SAMPLE_FRAMEGRAPH_H_
+#define ANTERU_D3D12_SAMPLE_FRAMEGRAPH_H_
+
+#include "PassScheduler.h"
+#include "SubmissionBatcher.h"
+
+#include <d3d12.h>
+#include <wrl.h>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace AMD {
+///////////////////////////////////////////////////////////////////////////////
+/**
+Transient resources are placed into one heap per type, as GPUs with
+resource heap tier 1 can't mix these in one heap.
+*/
+enum class TransientHeapType
+{
+	Buffer,
+	RenderTargetTexture,
+	Texture
+};
+
+static const int TRANSIENT_HEAP_TYPE_COUNT = 3;
+
+TransientHeapType GetTransientHeapType (const D3D12_RESOURCE_DESC& desc);
+
+///////////////////////////////////////////////////////////////////////////////
+struct FrameGraphResourceDesc
+{
+	/**
+	Imported resources are owned by someone else and their contents are
+	kept. Transient resources only live while the graph executes, and share
+	memory with other transient resources which are not in use at the same
+	time.
+	*/
+	bool imported = false;
+
+	D3D12_RESOURCE_STATES initialState = D3D12_RESOURCE_STATE_COMMON;
+
+	/**
+	Imported resources only. If set, the resource is transitioned into
+	finalState after the last pass, otherwise it stays in the state the last
+	pass using it needed.
+	*/
+	bool hasFinalState = false;
+	D3D12_RESOURCE_STATES finalState = D3D12_RESOURCE_STATE_COMMON;
+
+	/**
+	Transient resources only, see ID3D12Device::GetResourceAllocationInfo.
+	*/
+	TransientHeapType heapType = TransientHeapType::Buffer;
+	std::uint64_t size = 0;
+	std::uint64_t alignment = 0;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+A pass which writes a resource without reading it overwrites it completely,
+so earlier writes nobody reads get culled. Passes which only update parts of
+a resource must read it as well.
+*/
+struct FrameGraphPassDesc
+{
+	std::vector<PassResourceUse> reads;
+	std::vector<PassResourceUse> writes;
+
+	/**
+	The pass does something outside of the graph, like writing to a
+	readback buffer, so it must not be culled.
+	*/
+	bool sideEffects = false;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Makes the memory of a transient resource available to after. before is the
+resource which used the memory last, or -1 if that could be several.
+*/
+struct FrameGraphAliasingBarrier
+{
+	int before;
+	int after;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+struct CompiledFrameGraphPass
+{
+	/**
+	Index of the pass description, or -1 if this pass only transitions
+	imported resources into their final states.
+	*/
+	int pass;
+
+	/**
+	Recorded before the pass, in this order. Discards initialize transient
+	render targets and depth stencils after their memory was used by other
+	resources, as required by D3D12.
+	*/
+	std::vector<FrameGraphAliasingBarrier> aliasingBarriers;
+	std::vector<ResourceTransition> beginTransitions;
+	std::vector<int> discards;
+
+	/**
+	Recorded after the pass.
+	*/
+	std::vector<ResourceTransition> endTransitions;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+struct TransientPlacement
+{
+	/**
+	First and last compiled pass using the resource, -1 if none does.
+	*/
+	int firstPass = -1;
+	int lastPass = -1;
+
+	/**
+	Offset into the heap of the resource's heap type.
+	*/
+	std::uint64_t offset = 0;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+struct CompiledFrameGraph
+{
+	/**
+	The passes which were not culled, in order.
+	*/
+	std::vector<CompiledFrameGraphPass> passes;
+
+	/**
+	One per resource, only meaningful for transient resources.
+	*/
+	std::vector<TransientPlacement> placements;
+
+	/**
+	Size of the heap of each TransientHeapType.
+	*/
+	std::uint64_t heapSizes [TRANSIENT_HEAP_TYPE_COUNT];
+
+	/**
+	The state of each resource after all passes.
+	*/
+	std::vector<D3D12_RESOURCE_STATES> finalStates;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+struct TransientAllocationRequest
+{
+	std::uint64_t size;
+	std::uint64_t alignment;
+
+	/**
+	The allocation is in use from pass begin to pass end, inclusive.
+	*/
+	int begin;
+	int end;
+};
+
+/**
+Find offsets for allocations so those in use at the same time don't
+overlap, and return the size of the memory needed. This is interval graph
+coloring with sizes: allocations are placed largest first, each at the
+lowest offset which doesn't overlap an allocation placed already whose
+lifetime overlaps.
+*/
+std::uint64_t PackTransientAllocations (
+	const std::vector<TransientAllocationRequest>& requests,
+	std::vector<std::uint64_t>& offsets);
+
+/**
+Cull passes nothing depends on, place transient resources into heaps and
+work out the barriers between passes, without touching the GPU.
+
+A pass is kept if it has side effects, writes an imported resource, or
+writes a resource a later kept pass reads. Transient resources nobody uses
+don't get any memory.
+
+Throws if a pass uses a resource which doesn't exist, or uses one resource
+in two different states of which one is written.
+*/
+CompiledFrameGraph CompileFrameGraph (const std::vector<FrameGraphPassDesc>& passes,
+	const std::vector<FrameGraphResourceDesc>& resources);
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Frame graph executed on one graphics queue. Passes, imported and transient
+resources are declared anew every frame; Record compiles the graph, and
+records every pass that survives into a command list of its own, in
+parallel on the task scheduler. Barriers are computed up front, so passes
+don't depend on each other while recording.
+
+Transient resources are placed resources in heaps kept per queue slot.
+They, and the heaps, are reused from frame to frame as long as they fit.
+A transient resource's contents are undefined when its first pass begins.
+
+Compute passes which should overlap with graphics work go through the
+PassScheduler instead.
+*/
+class FrameGraph
+{
+public:
+	typedef std::function<void (ID3D12GraphicsCommandList*, const FrameGraph&)> RecordFunction;
+
+	struct Statistics
+	{
+		int passes = 0;
+		int culledPasses = 0;
+		int barriers = 0;
+
+		/**
+		Memory of the transient heaps, and what the transient resources
+		would have needed without aliasing.
+		*/
+		std::uint64_t transientMemory = 0;
+		std::uint64_t unaliasedTransientMemory = 0;
+	};
+
+	FrameGraph (const FrameGraph&) = delete;
+	FrameGraph& operator= (const FrameGraph&) = delete;
+
+	/**
+	queue is the index of a graphics queue in batcher.
+	*/
+	FrameGraph (ID3D12Device* device, SubmissionBatcher& batcher,
+		const int queue, const int slotCount);
+
+	~FrameGraph ();
+
+	/**
+	state is the state the resource is in. If finalState is not null, the
+	resource is transitioned into it at the end.
+	*/
+	int ImportResource (ID3D12Resource* resource, const D3D12_RESOURCE_STATES state,
+		const D3D12_RESOURCE_STATES* finalState = nullptr);
+
+	/**
+	clearValue is the optimized clear value, it may be null.
+	*/
+	int CreateTransientResource (const D3D12_RESOURCE_DESC& desc,
+		const D3D12_CLEAR_VALUE* clearValue = nullptr);
+
+	void AddPass (const FrameGraphPassDesc& desc, RecordFunction record);
+
+	/**
+	The resource while passes record. Transient resources may be different
+	objects every frame.
+	*/
+	ID3D12Resource* GetResource (const int resource) const;
+
+	/**
+	Compile the graph and record the passes. The commands previously
+	submitted for slot must have finished.
+	*/
+	void Record (const int slot);
+
+	/**
+	Submit the recorded passes, after dependencies, and clear the graph for
+	the next frame.
+	*/
+	void Submit (const std::vector<SubmissionHandle>& dependencies);
+
+	/**
+	Of the last frame recorded.
+	*/
+	const Statistics& GetStatistics () const;
+
+private:
+	struct Resource
+	{
+		FrameGraphResourceDesc desc;
+
+		Microsoft::WRL::ComPtr<ID3D12Resource> resource;
+
+		// Transient resources only
+		D3D12_RESOURCE_DESC resourceDesc;
+		D3D12_CLEAR_VALUE clearValue;
+		bool hasClearValue;
+		int cacheEntry;
+	};
+
+	struct Pass
+	{
+		FrameGraphPassDesc desc;
+		RecordFunction record;
+	};
+
+	/**
+	A placed resource of an earlier frame, which is reused if a transient
+	resource with the same description ends up at the same place.
+	*/
+	struct CachedResource
+	{
+		Microsoft::WRL::ComPtr<ID3D12Resource> resource;
+		D3D12_RESOURCE_DESC desc;
+		D3D12_CLEAR_VALUE clearValue;
+		bool hasClearValue;
+		TransientHeapType heapType;
+		std::uint64_t offset;
+		D3D12_RESOURCE_STATES state;
+		bool used;
+	};
+
+	struct CommandList
+	{
+		Microsoft::WRL::ComPtr<ID3D12CommandAllocator> allocator;
+		Microsoft::WRL::ComPtr<ID3D12GraphicsCommandList> commandList;
+	};
+
+	struct Slot
+	{
+		Microsoft::WRL::ComPtr<ID3D12Heap> heaps [TRANSIENT_HEAP_TYPE_COUNT];
+		std::uint64_t heapAlignments [TRANSIENT_HEAP_TYPE_COUNT];
+		std::vector<CachedResource> cache;
+
+		// One per pass, so they can be recorded in parallel
+		std::vector<CommandList> commandLists;
+	};
+
+	void AllocateTransientResources (Slot& slot, const CompiledFrameGraph& compiled);
+	ID3D12GraphicsCommandList* GetCommandList (Slot& slot, const int index);
+	void RecordPass (ID3D12GraphicsCommandList* commandList,
+		const CompiledFrameGraphPass& pass);
+
+	Microsoft::WRL::ComPtr<ID3D12Device> device_;
+	SubmissionBatcher& batcher_;
+	const int queue_;
+
+	std::vector<Resource> resources_;
+	std::vector<Pass> passes_;
+
+	std::vector<Slot> slots_;
+	int currentSlot_;
+	int recordedCount_;
+
+	Statistics statistics_;
+};
+}
+
+#endif
@@ -0,0 +1,293 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+
+#ifndef ANTERU_D3D12_SAMPLE_FRAMEPIPELINE_H_
+#define ANTERU_D3D12_SAMPLE_FRAMEPIPELINE_H_
+
+#include "TripleBuffer.h"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+
+namespace AMD {
+///////////////////////////////////////////////////////////////////////////////
+enum class FramePacing
+{
+	/**
+	The simulation runs one step ahead of the renderer: it computes the next
+	snapshot while the current one is being rendered, then waits until the
+	renderer picks it up. Every snapshot gets rendered exactly once.
+	*/
+	Lockstep,
+
+	/**
+	The simulation steps at a fixed rate, independent of the renderer, which
+	always takes the newest snapshot. Snapshots may be skipped or rendered
+	more than once, but none is older than one step.
+	*/
+	FixedStep
+};
+
+///////////////////////////////////////////////////////////////////////////////
+struct FramePipelineOptions
+{
+	FramePacing pacing = FramePacing::Lockstep;
+
+	/**
+	Simulated time per step. With FixedStep pacing, this is also the real
+	time between two steps.
+	*/
+	std::chrono::microseconds simulationStep = std::chrono::microseconds (16667);
+
+	/**
+	Number of frames the GPU may lag behind the frame being recorded. Lower
+	values reduce the latency from simulation to screen, higher ones make it
+	less likely that the GPU runs dry.
+	*/
+	int maxFramesInFlight = 3;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Two-stage pipeline between a simulation thread and the render thread.
+
+The simulation thread owns the simulation state and advances it by calling
+the simulate function. After each step, it copies the state into a snapshot
+and hands it to the render thread through a triple buffer, so the renderer
+always reads a consistent snapshot which is never modified underneath it,
+and neither side takes a lock to exchange data. Waiting only happens to pace
+the threads in lockstep mode.
+
+The render thread is whichever thread calls AcquireSnapshot.
+*/
+template <typename Snapshot>
+class FramePipeline
+{
+public:
+	typedef std::function<void (Snapshot&)> SimulateFunction;
+
+	FramePipeline (const FramePipeline&) = delete;
+	FramePipeline& operator= (const FramePipeline&) = delete;
+
+	/**
+	Start the simulation thread. initial is the state before the first step,
+	and is the snapshot until the first step is published.
+	*/
+	FramePipeline (const FramePipelineOptions& options, const Snapshot& initial,
+		SimulateFunction simulate)
+		: options_ (options)
+		, simulate_ (std::move (simulate))
+		, frames_ (Frame (initial))
+		, latency_ (0)
+		, stop_ (false)
+		, failed_ (false)
+	{
+		if (options_.simulationStep.count () <= 0) {
+			throw std::runtime_error ("Simulation step must be positive");
+		}
+
+		thread_ = std::thread (&FramePipeline::SimulationThreadMain, this, initial);
+	}
+
+	~FramePipeline ()
+	{
+		Stop ();
+	}
+
+	/**
+	Stop the simulation thread after its current step.
+	*/
+	void Stop ()
+	{
+		{
+			std::lock_guard<std::mutex> lock (mutex_);
+			stop_ = true;
+		}
+
+		condition_.notify_all ();
+
+		if (thread_.joinable ()) {
+			thread_.join ();
+		}
+	}
+
+	/**
+	Render thread only. Take the newest snapshot, which stays valid until the
+	next call. With lockstep pacing, this waits for the simulation to finish
+	the next step. Rethrows the exception the simulation failed with, if
+	any.
+	*/
+	const Snapshot& AcquireSnapshot ()
+	{
+		if (options_.pacing == FramePacing::Lockstep && !frames_.HasPending ()) {
+			std::unique_lock<std::mutex> lock (mutex_);
+			condition_.wait (lock, [this] () {
+				return frames_.HasPending () || failed_.load () || stop_;
+			});
+		}
+
+		if (failed_.load ()) {
+			std::rethrow_exception (exception_);
+		}
+
+		if (frames_.Consume ()) {
+			latency_ = std::chrono::steady_clock::now () - frames_.GetFrontBuffer ().published;
+
+			if (options_.pacing == FramePacing::Lockstep) {
+				Notify ();
+			}
+		}
+
+		return frames_.GetFrontBuffer ().snapshot;
+	}
+
+	/**
+	Render thread only. Number of simulation steps which led to the current
+	snapshot, 0 for the initial one.
+	*/
+	std::uint64_t GetSequence () const
+	{
+		return frames_.GetFrontBuffer ().sequence;
+	}
+
+	/**
+	Render thread only. Time between publishing the current snapshot and
+	acquiring it.
+	*/
+	std::chrono::steady_clock::duration GetLatency () const
+	{
+		return latency_;
+	}
+
+	const FramePipelineOptions& GetOptions () const
+	{
+		return options_;
+	}
+
+private:
+	struct Frame
+	{
+		Frame ()
+			: sequence (0)
+		{
+		}
+
+		explicit Frame (const Snapshot& snapshot)
+			: snapshot (snapshot)
+			, sequence (0)
+			, published (std::chrono::steady_clock::now ())
+		{
+		}
+
+		Snapshot snapshot;
+		std::uint64_t sequence;
+		std::chrono::steady_clock::time_point published;
+	};
+
+	void Notify ()
+	{
+		// Lock once so a waiter can't miss the notification between checking
+		// its condition and going to sleep
+		{
+			std::lock_guard<std::mutex> lock (mutex_);
+		}
+
+		condition_.notify_all ();
+	}
+
+	void SimulationThreadMain (Snapshot state)
+	{
+		std::uint64_t sequence = 0;
+		auto nextStep = std::chrono::steady_clock::now ();
+
+		for (;;) {
+			try {
+				simulate_ (state);
+			} catch (...) {
+				exception_ = std::current_exception ();
+				failed_.store (true);
+				Notify ();
+				return;
+			}
+
+			auto& frame = frames_.GetBackBuffer ();
+			frame.snapshot = state;
+			frame.sequence = ++sequence;
+			frame.published = std::chrono::steady_clock::now ();
+			frames_.Publish ();
+
+			std::unique_lock<std::mutex> lock (mutex_);
+			if (options_.pacing == FramePacing::Lockstep) {
+				lock.unlock ();
+				condition_.notify_all ();
+				lock.lock ();
+
+				condition_.wait (lock, [this] () {
+					return stop_ || !frames_.HasPending ();
+				});
+			} else {
+				nextStep += options_.simulationStep;
+
+				// Don't try to catch up if a step took longer than the
+				// step size, just continue from now
+				const auto now = std::chrono::steady_clock::now ();
+				if (nextStep < now) {
+					nextStep = now;
+				}
+
+				condition_.wait_until (lock, nextStep, [this] () {
+					return stop_;
+				});
+			}
+
+			if (stop_) {
+				return;
+			}
+		}
+	}
+
+	const FramePipelineOptions options_;
+	SimulateFunction simulate_;
+
+	TripleBuffer<Frame> frames_;
+	std::chrono::steady_clock::duration latency_;
+
+	std::mutex mutex_;
+	std::condition_variable condition_;
+	bool stop_;
+
+	std::atomic<bool> failed_;
+	std::exception_ptr exception_;
+
+	std::thread thread_;
+};
+}
+
+#endif
@@ -0,0 +1,391 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#include "Hash.h"
+
+#include <cstring>
+
+#if defined(_M_X64) || defined(__SSE2__)
+#include <emmintrin.h>
+#define AMD_HASH_SSE2 1
+#endif
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+namespace AMD {
+namespace {
+const std::uint32_t PRIME32_1 = 0x9E3779B1U;
+const std::uint32_t PRIME32_2 = 0x85EBCA77U;
+const std::uint32_t PRIME32_3 = 0xC2B2AE3DU;
+
+const std::uint64_t PRIME64_1 = 0x9E3779B185EBCA87ULL;
+const std::uint64_t PRIME64_2 = 0xC2B2AE3D27D4EB4FULL;
+const std::uint64_t PRIME64_3 = 0x165667B19E3779F9ULL;
+const std::uint64_t PRIME64_4 = 0x85EBCA77C2B2AE63ULL;
+const std::uint64_t PRIME64_5 = 0x27D4EB2F165667C5ULL;
+
+const std::uint64_t PRIME_MX1 = 0x165667919E3779F9ULL;
+const std::uint64_t PRIME_MX2 = 0x9FB21C651E98DF25ULL;
+
+const int SECRET_SIZE = 192;
+const int SECRET_SIZE_MIN = 136;
+const int STRIPE_SIZE = 64;
+const int SECRET_CONSUME_RATE = 8;
+const int ACCUMULATOR_COUNT = 8;
+
+const std::uint8_t DEFAULT_SECRET [SECRET_SIZE] = {
+	0xb8, 0xfe, 0x6c, 0x39, 0x23, 0xa4, 0x4b, 0xbe, 0x7c, 0x01, 0x81, 0x2c, 0xf7, 0x21, 0xad, 0x1c,
+	0xde, 0xd4, 0x6d, 0xe9, 0x83, 0x90, 0x97, 0xdb, 0x72, 0x40, 0xa4, 0xa4, 0xb7, 0xb3, 0x67, 0x1f,
+	0xcb, 0x79, 0xe6, 0x4e, 0xcc, 0xc0, 0xe5, 0x78, 0x82, 0x5a, 0xd0, 0x7d, 0xcc, 0xff, 0x72, 0x21,
+	0xb8, 0x08, 0x46, 0x74, 0xf7, 0x43, 0x24, 0x8e, 0xe0, 0x35, 0x90, 0xe6, 0x81, 0x3a, 0x26, 0x4c,
+	0x3c, 0x28, 0x52, 0xbb, 0x91, 0xc3, 0x00, 0xcb, 0x88, 0xd0, 0x65, 0x8b, 0x1b, 0x53, 0x2e, 0xa3,
+	0x71, 0x64, 0x48, 0x97, 0xa2, 0x0d, 0xf9, 0x4e, 0x38, 0x19, 0xef, 0x46, 0xa9, 0xde, 0xac, 0xd8,
+	0xa8, 0xfa, 0x76, 0x3f, 0xe3, 0x9c, 0x34, 0x3f, 0xf9, 0xdc, 0xbb, 0xc7, 0xc7, 0x0b, 0x4f, 0x1d,
+	0x8a, 0x51, 0xe0, 0x4b, 0xcd, 0xb4, 0x59, 0x31, 0xc8, 0x9f, 0x7e, 0xc9, 0xd9, 0x78, 0x73, 0x64,
+	0xea, 0xc5, 0xac, 0x83, 0x34, 0xd3, 0xeb, 0xc3, 0xc5, 0x81, 0xa0, 0xff, 0xfa, 0x13, 0x63, 0xeb,
+	0x17, 0x0d, 0xdd, 0x51, 0xb7, 0xf0, 0xda, 0x49, 0xd3, 0x16, 0x55, 0x26, 0x29, 0xd4, 0x68, 0x9e,
+	0x2b, 0x16, 0xbe, 0x58, 0x7d, 0x47, 0xa1, 0xfc, 0x8f, 0xf8, 0xb8, 0xd1, 0x7a, 0xd0, 0x31, 0xce,
+	0x45, 0xcb, 0x3a, 0x8f, 0x95, 0x16, 0x04, 0x28, 0xaf, 0xd7, 0xfb, 0xca, 0xbb, 0x4b, 0x40, 0x7e,
+};
+
+// All targets we care about are little-endian
+inline std::uint32_t Read32 (const std::uint8_t* p)
+{
+	std::uint32_t result;
+	::memcpy (&result, p, sizeof (result));
+	return result;
+}
+
+inline std::uint64_t Read64 (const std::uint8_t* p)
+{
+	std::uint64_t result;
+	::memcpy (&result, p, sizeof (result));
+	return result;
+}
+
+inline std::uint64_t Rotl64 (const std::uint64_t v, const int shift)
+{
+	return (v << shift) | (v >> (64 - shift));
+}
+
+inline std::uint32_t Swap32 (const std::uint32_t v)
+{
+	return ((v << 24) & 0xff000000) | ((v << 8) & 0x00ff0000) |
+		((v >> 8) & 0x0000ff00) | ((v >> 24) & 0x000000ff);
+}
+
+inline std::uint64_t Swap64 (const std::uint64_t v)
+{
+	return (static_cast<std::uint64_t> (Swap32 (static_cast<std::uint32_t> (v))) << 32) |
+		Swap32 (static_cast<std::uint32_t> (v >> 32));
+}
+
+/**
+Multiply to 128 bits and fold the upper half onto the lower one.
+*/
+inline std::uint64_t MultiplyFold64 (const std::uint64_t lhs, const std::uint64_t rhs)
+{
+#if defined(_MSC_VER) && defined(_M_X64)
+	std::uint64_t high;
+	const std::uint64_t low = _umul128 (lhs, rhs, &high);
+	return low ^ high;
+#else
+	const unsigned __int128 product = static_cast<unsigned __int128> (lhs) * rhs;
+	return static_cast<std::uint64_t> (product) ^ static_cast<std::uint64_t> (product >> 64);
+#endif
+}
+
+inline std::uint64_t XorShift64 (const std::uint64_t v, const int shift)
+{
+	return v ^ (v >> shift);
+}
+
+std::uint64_t Avalanche (std::uint64_t h)
+{
+	h = XorShift64 (h, 37);
+	h *= PRIME_MX1;
+	return XorShift64 (h, 32);
+}
+
+std::uint64_t Avalanche64 (std::uint64_t h)
+{
+	h ^= h >> 33;
+	h *= PRIME64_2;
+	h ^= h >> 29;
+	h *= PRIME64_3;
+	return h ^ (h >> 32);
+}
+
+std::uint64_t Rrmxmx (std::uint64_t h, const std::uint64_t size)
+{
+	h ^= Rotl64 (h, 49) ^ Rotl64 (h, 24);
+	h *= PRIME_MX2;
+	h ^= (h >> 35) + size;
+	h *= PRIME_MX2;
+	return XorShift64 (h, 28);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::uint64_t Hash0To16 (const std::uint8_t* input, const std::size_t size,
+	const std::uint8_t* secret, std::uint64_t seed)
+{
+	if (size > 8) {
+		const auto bitflip1 = (Read64 (secret + 24) ^ Read64 (secret + 32)) + seed;
+		const auto bitflip2 = (Read64 (secret + 40) ^ Read64 (secret + 48)) - seed;
+		const auto low = Read64 (input) ^ bitflip1;
+		const auto high = Read64 (input + size - 8) ^ bitflip2;
+		const auto accumulator = size + Swap64 (low) + high + MultiplyFold64 (low, high);
+		return Avalanche (accumulator);
+	} else if (size >= 4) {
+		seed ^= static_cast<std::uint64_t> (Swap32 (static_cast<std::uint32_t> (seed))) << 32;
+		const std::uint64_t input1 = Read32 (input);
+		const std::uint64_t input2 = Read32 (input + size - 4);
+		const auto bitflip = (Read64 (secret + 8) ^ Read64 (secret + 16)) - seed;
+		const auto keyed = (input2 + (input1 << 32)) ^ bitflip;
+		return Rrmxmx (keyed, size);
+	} else if (size > 0) {
+		const std::uint32_t c1 = input [0];
+		const std::uint32_t c2 = input [size >> 1];
+		const std::uint32_t c3 = input [size - 1];
+		const std::uint32_t combined = (c1 << 16) | (c2 << 24) | c3 |
+			(static_cast<std::uint32_t> (size) << 8);
+		const std::uint64_t bitflip = (Read32 (secret) ^ Read32 (secret + 4)) + seed;
+		return Avalanche64 (combined ^ bitflip);
+	} else {
+		return Avalanche64 (seed ^ (Read64 (secret + 56) ^ Read64 (secret + 64)));
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+inline std::uint64_t Mix16 (const std::uint8_t* input, const std::uint8_t* secret,
+	const std::uint64_t seed)
+{
+	return MultiplyFold64 (Read64 (input) ^ (Read64 (secret) + seed),
+		Read64 (input + 8) ^ (Read64 (secret + 8) - seed));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::uint64_t Hash17To128 (const std::uint8_t* input, const std::size_t size,
+	const std::uint8_t* secret, const std::uint64_t seed)
+{
+	std::uint64_t accumulator = size * PRIME64_1;
+
+	if (size > 32) {
+		if (size > 64) {
+			if (size > 96) {
+				accumulator += Mix16 (input + 48, secret + 96, seed);
+				accumulator += Mix16 (input + size - 64, secret + 112, seed);
+			}
+			accumulator += Mix16 (input + 32, secret + 64, seed);
+			accumulator += Mix16 (input + size - 48, secret + 80, seed);
+		}
+		accumulator += Mix16 (input + 16, secret + 32, seed);
+		accumulator += Mix16 (input + size - 32, secret + 48, seed);
+	}
+	accumulator += Mix16 (input, secret, seed);
+	accumulator += Mix16 (input + size - 16, secret + 16, seed);
+
+	return Avalanche (accumulator);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::uint64_t Hash129To240 (const std::uint8_t* input, const std::size_t size,
+	const std::uint8_t* secret, const std::uint64_t seed)
+{
+	static const int START_OFFSET = 3;
+	static const int LAST_OFFSET = 17;
+
+	std::uint64_t accumulator = size * PRIME64_1;
+	const int roundCount = static_cast<int> (size) / 16;
+
+	for (int i = 0; i < 8; ++i) {
+		accumulator += Mix16 (input + 16 * i, secret + 16 * i, seed);
+	}
+
+	accumulator = Avalanche (accumulator);
+
+	std::uint64_t accumulatorEnd = Mix16 (input + size - 16,
+		secret + SECRET_SIZE_MIN - LAST_OFFSET, seed);
+
+	for (int i = 8; i < roundCount; ++i) {
+		accumulatorEnd += Mix16 (input + 16 * i,
+			secret + 16 * (i - 8) + START_OFFSET, seed);
+	}
+
+	return Avalanche (accumulator + accumulatorEnd);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Process one 64 byte stripe. SSE2 is always there on x64; everything else
+uses the scalar code, which produces the same result.
+*/
+inline void Accumulate512 (std::uint64_t* accumulators, const std::uint8_t* input,
+	const std::uint8_t* secret)
+{
+#ifdef AMD_HASH_SSE2
+	__m128i* vectors = reinterpret_cast<__m128i*> (accumulators);
+
+	for (int i = 0; i < 4; ++i) {
+		const __m128i data = _mm_loadu_si128 (reinterpret_cast<const __m128i*> (input) + i);
+		const __m128i key = _mm_loadu_si128 (reinterpret_cast<const __m128i*> (secret) + i);
+		const __m128i dataKey = _mm_xor_si128 (data, key);
+		const __m128i dataKeyHigh = _mm_shuffle_epi32 (dataKey, _MM_SHUFFLE (0, 3, 0, 1));
+		const __m128i product = _mm_mul_epu32 (dataKey, dataKeyHigh);
+		const __m128i dataSwapped = _mm_shuffle_epi32 (data, _MM_SHUFFLE (1, 0, 3, 2));
+		const __m128i sum = _mm_add_epi64 (_mm_loadu_si128 (vectors + i), dataSwapped);
+		_mm_storeu_si128 (vectors + i, _mm_add_epi64 (product, sum));
+	}
+#else
+	for (int i = 0; i < ACCUMULATOR_COUNT; ++i) {
+		const auto data = Read64 (input + 8 * i);
+		const auto dataKey = data ^ Read64 (secret + 8 * i);
+		accumulators [i ^ 1] += data;
+		accumulators [i] += (dataKey & 0xFFFFFFFF) * (dataKey >> 32);
+	}
+#endif
+}
+
+inline void ScrambleAccumulators (std::uint64_t* accumulators, const std::uint8_t* secret)
+{
+#ifdef AMD_HASH_SSE2
+	__m128i* vectors = reinterpret_cast<__m128i*> (accumulators);
+	const __m128i prime = _mm_set1_epi32 (static_cast<int> (PRIME32_1));
+
+	for (int i = 0; i < 4; ++i) {
+		const __m128i accumulator = _mm_loadu_si128 (vectors + i);
+		const __m128i shifted = _mm_xor_si128 (accumulator, _mm_srli_epi64 (accumulator, 47));
+		const __m128i key = _mm_loadu_si128 (reinterpret_cast<const __m128i*> (secret) + i);
+		const __m128i dataKey = _mm_xor_si128 (shifted, key);
+		const __m128i dataKeyHigh = _mm_shuffle_epi32 (dataKey, _MM_SHUFFLE (0, 3, 0, 1));
+		const __m128i productLow = _mm_mul_epu32 (dataKey, prime);
+		const __m128i productHigh = _mm_mul_epu32 (dataKeyHigh, prime);
+		_mm_storeu_si128 (vectors + i,
+			_mm_add_epi64 (productLow, _mm_slli_epi64 (productHigh, 32)));
+	}
+#else
+	for (int i = 0; i < ACCUMULATOR_COUNT; ++i) {
+		auto accumulator = XorShift64 (accumulators [i], 47);
+		accumulator ^= Read64 (secret + 8 * i);
+		accumulators [i] = accumulator * PRIME32_1;
+	}
+#endif
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::uint64_t HashLong (const std::uint8_t* input, const std::size_t size,
+	const std::uint8_t* secret)
+{
+	static const int LAST_ACCUMULATOR_START = 7;
+	static const int MERGE_ACCUMULATORS_START = 11;
+
+	std::uint64_t accumulators [ACCUMULATOR_COUNT] = {
+		PRIME32_3, PRIME64_1, PRIME64_2, PRIME64_3,
+		PRIME64_4, PRIME32_2, PRIME64_5, PRIME32_1
+	};
+
+	const std::size_t stripesPerBlock = (SECRET_SIZE - STRIPE_SIZE) / SECRET_CONSUME_RATE;
+	const std::size_t blockSize = STRIPE_SIZE * stripesPerBlock;
+	const std::size_t blockCount = (size - 1) / blockSize;
+
+	for (std::size_t block = 0; block < blockCount; ++block) {
+		const auto blockInput = input + block * blockSize;
+
+		for (std::size_t stripe = 0; stripe < stripesPerBlock; ++stripe) {
+			Accumulate512 (accumulators, blockInput + stripe * STRIPE_SIZE,
+				secret + stripe * SECRET_CONSUME_RATE);
+		}
+
+		ScrambleAccumulators (accumulators, secret + SECRET_SIZE - STRIPE_SIZE);
+	}
+
+	// Remaining full stripes, then the last 64 bytes, which may overlap
+	// with what has been processed already
+	const std::size_t stripeCount = ((size - 1) - blockSize * blockCount) / STRIPE_SIZE;
+	const auto tailInput = input + blockCount * blockSize;
+
+	for (std::size_t stripe = 0; stripe < stripeCount; ++stripe) {
+		Accumulate512 (accumulators, tailInput + stripe * STRIPE_SIZE,
+			secret + stripe * SECRET_CONSUME_RATE);
+	}
+
+	Accumulate512 (accumulators, input + size - STRIPE_SIZE,
+		secret + SECRET_SIZE - STRIPE_SIZE - LAST_ACCUMULATOR_START);
+
+	std::uint64_t result = size * PRIME64_1;
+	const auto mergeSecret = secret + MERGE_ACCUMULATORS_START;
+
+	for (int i = 0; i < 4; ++i) {
+		result += MultiplyFold64 (accumulators [2 * i] ^ Read64 (mergeSecret + 16 * i),
+			accumulators [2 * i + 1] ^ Read64 (mergeSecret + 16 * i + 8));
+	}
+
+	return Avalanche (result);
+}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::uint64_t HashXXH3 (const void* data, const std::size_t size,
+	const std::uint64_t seed)
+{
+	const auto input = static_cast<const std::uint8_t*> (data);
+
+	if (size <= 16) {
+		return Hash0To16 (input, size, DEFAULT_SECRET, seed);
+	} else if (size <= 128) {
+		return Hash17To128 (input, size, DEFAULT_SECRET, seed);
+	} else if (size <= 240) {
+		return Hash129To240 (input, size, DEFAULT_SECRET, seed);
+	}
+
+	if (seed == 0) {
+		return HashLong (input, size, DEFAULT_SECRET);
+	}
+
+	// Long inputs fold the seed into the secret instead
+	std::uint8_t secret [SECRET_SIZE];
+	for (int i = 0; i < SECRET_SIZE / 16; ++i) {
+		const auto low = Read64 (DEFAULT_SECRET + 16 * i) + seed;
+		const auto high = Read64 (DEFAULT_SECRET + 16 * i + 8) - seed;
+		::memcpy (secret + 16 * i, &low, sizeof (low));
+		::memcpy (secret + 16 * i + 8, &high, sizeof (high));
+	}
+
+	return HashLong (input, size, secret);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::uint64_t HashFNV1a (const void* data, const std::size_t size)
+{
+	const auto input = static_cast<const std::uint8_t*> (data);
+
+	std::uint64_t hash = 0xCBF29CE484222325ULL;
+	for (std::size_t i = 0; i < size; ++i) {
+		hash ^= input [i];
+		hash *= 0x100000001B3ULL;
+	}
+
+	return hash;
+}
+}
@@ -0,0 +1,46 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#ifndef ANTERU_D3D12_SAMPLE_HASH_H_
+#define ANTERU_D3D12_SAMPLE_HASH_H_
+
+#include <cstddef>
+#include <cstdint>
+
+namespace AMD {
+///////////////////////////////////////////////////////////////////////////////
+/**
+64-bit XXH3 hash of data. The result matches the reference implementation
+(XXH3_64bits_withSeed), so hashes can be computed by tools as well.
+*/
+std::uint64_t HashXXH3 (const void* data, const std::size_t size,
+	const std::uint64_t seed = 0);
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+64-bit FNV-1a hash of data. Much slower than HashXXH3 on large inputs, but
+trivial to reproduce in tools; used for short keys like asset names.
+*/
+std::uint64_t HashFNV1a (const void* data, const std::size_t size);
+}
+
+#endif
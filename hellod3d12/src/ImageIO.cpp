@@ -28,8 +28,12 @@
 // for _com_error
 #include <comdef.h>
 
+#include <algorithm>
+#include <mutex>
 #include <stdexcept>
 
+#include "AssetPack.h"
+#include "ImageResampler.h"
 #include "Utility.h"
 #define SAFE_WIC(expr) do {const auto r = expr; if (FAILED(r)) {_com_error err (r); OutputDebugString (err.ErrorMessage()); __debugbreak ();} } while (0,0)
 
@@ -37,26 +41,111 @@ using namespace Microsoft::WRL;
 
 #undef LoadImage
 
+#ifdef min
+#undef min
+#endif
+
 namespace {
-std::vector<std::uint8_t> LoadInternal(ComPtr<IWICImagingFactory> factory, ComPtr<IWICStream> stream,
-	const int rowAlignment, int* outputWidth, int* outputHeight)
+std::once_flag factoryFlag;
+ComPtr<IWICImagingFactory> sharedFactory;
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Creating the factory is expensive, so all loads share one; it can be used
+from any thread.
+*/
+ComPtr<IWICImagingFactory> GetFactory ()
+{
+	std::call_once (factoryFlag, [] () {
+		HRESULT hr = CoCreateInstance (
+			CLSID_WICImagingFactory,
+			NULL,
+			CLSCTX_INPROC_SERVER,
+			IID_PPV_ARGS (&sharedFactory)
+			);
+
+		if (FAILED (hr)) {
+			throw std::runtime_error ("Could not create WIC factory");
+		}
+	});
+
+	return sharedFactory;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void GetImageSize (IWICBitmapSource* source, UINT* width, UINT* height)
+{
+	source->GetSize (width, height);
+
+	if (*width == 0 || *height == 0) {
+		throw std::runtime_error ("Image is empty");
+	}
+}
+
+ComPtr<IWICStream> CreateStreamFromFile (ComPtr<IWICImagingFactory> factory,
+	const char* path)
+{
+	std::vector<wchar_t> pathWchar (::strlen (path) + 1);
+	mbstowcs (pathWchar.data (), path, pathWchar.size ());
+
+	ComPtr<IWICStream> stream;
+	factory->CreateStream (&stream);
+
+	if (FAILED (stream->InitializeFromFilename (pathWchar.data (), GENERIC_READ))) {
+		throw std::runtime_error ("Could not open image file");
+	}
+
+	return stream;
+}
+
+ComPtr<IWICStream> CreateStreamFromMemory (ComPtr<IWICImagingFactory> factory,
+	const void* data, const std::size_t size)
+{
+	ComPtr<IWICStream> stream;
+	factory->CreateStream (&stream);
+
+	// This is fine here as the memory will live on when the stream is long gone
+	stream->InitializeFromMemory (static_cast<BYTE*> (const_cast<void*> (data)),
+		static_cast<DWORD> (size));
+
+	return stream;
+}
+
+ComPtr<IWICBitmapFrameDecode> GetFirstFrame (ComPtr<IWICImagingFactory> factory,
+	ComPtr<IWICStream> stream)
 {
 	ComPtr<IWICBitmapDecoder> decoder;
-	factory->CreateDecoderFromStream(stream.Get(), nullptr,
-		WICDecodeMetadataCacheOnDemand, &decoder);
+	if (FAILED (factory->CreateDecoderFromStream (stream.Get (), nullptr,
+		WICDecodeMetadataCacheOnDemand, &decoder))) {
+		throw std::runtime_error ("Could not find a decoder for image");
+	}
 
 	ComPtr<IWICBitmapFrameDecode> frame;
-	decoder->GetFrame(0, &frame);
+	decoder->GetFrame (0, &frame);
+
+	return frame;
+}
 
+ComPtr<IWICFormatConverter> CreateConverter (ComPtr<IWICImagingFactory> factory,
+	ComPtr<IWICBitmapFrameDecode> frame)
+{
 	ComPtr<IWICFormatConverter> converter;
-	factory->CreateFormatConverter(&converter);
-	converter->Initialize(
-		frame.Get(), GUID_WICPixelFormat32bppRGBA,
+	factory->CreateFormatConverter (&converter);
+	converter->Initialize (
+		frame.Get (), GUID_WICPixelFormat32bppRGBA,
 		WICBitmapDitherTypeNone, nullptr, 0.f,
 		WICBitmapPaletteTypeMedianCut);
 
+	return converter;
+}
+
+std::vector<std::uint8_t> LoadInternal(ComPtr<IWICImagingFactory> factory, ComPtr<IWICStream> stream,
+	const int rowAlignment, int* outputWidth, int* outputHeight)
+{
+	auto converter = CreateConverter (factory, GetFirstFrame (factory, stream));
+
 	UINT width, height;
-	converter->GetSize(&width, &height);
+	GetImageSize (converter.Get (), &width, &height);
 
 	std::vector<std::uint8_t> result(
 		RoundToNextMultiple(width, static_cast<UINT> (rowAlignment)) * height * 4);
@@ -75,57 +164,207 @@ std::vector<std::uint8_t> LoadInternal(ComPtr<IWICImagingFactory> factory, ComPt
 
 	return result;
 }
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Only the container header is parsed here, WIC does not decode any pixel data
+until CopyPixels is called.
+*/
+ImageInfo GetInfoInternal (ComPtr<IWICImagingFactory> factory, ComPtr<IWICStream> stream)
+{
+	auto frame = GetFirstFrame (factory, stream);
+
+	UINT width, height;
+	GetImageSize (frame.Get (), &width, &height);
+
+	ImageInfo result;
+	result.width = static_cast<int> (width);
+	result.height = static_cast<int> (height);
+	result.bytesPerPixel = 4;
+	result.hasAlpha = false;
+
+	WICPixelFormatGUID pixelFormat;
+	frame->GetPixelFormat (&pixelFormat);
+
+	ComPtr<IWICComponentInfo> componentInfo;
+	ComPtr<IWICPixelFormatInfo2> pixelFormatInfo;
+	if (SUCCEEDED (factory->CreateComponentInfo (pixelFormat, &componentInfo)) &&
+		SUCCEEDED (componentInfo.As (&pixelFormatInfo))) {
+		BOOL supportsTransparency = FALSE;
+		pixelFormatInfo->SupportsTransparency (&supportsTransparency);
+		result.hasAlpha = supportsTransparency != FALSE;
+	}
+
+	return result;
 }
 
-std::vector<std::uint8_t> LoadImageFromFile (const char* path, const int rowAlignment,
+///////////////////////////////////////////////////////////////////////////////
+/**
+Decode in bands of rows so the decoder streams straight into the destination.
+This keeps the working set small and writes the destination sequentially,
+which is what we want if the destination is write-combined upload memory.
+*/
+void LoadIntoInternal (ComPtr<IWICImagingFactory> factory, ComPtr<IWICStream> stream,
+	void* destination, const std::size_t rowPitch, const std::size_t destinationSize)
+{
+	auto converter = CreateConverter (factory, GetFirstFrame (factory, stream));
+
+	UINT width, height;
+	GetImageSize (converter.Get (), &width, &height);
+
+	if (rowPitch < width * 4 ||
+		destinationSize < rowPitch * (height - 1) + width * 4) {
+		throw std::runtime_error ("Destination too small for image");
+	}
+
+	static const UINT rowsPerBand = 64;
+	auto output = static_cast<BYTE*> (destination);
+
+	for (UINT row = 0; row < height; row += rowsPerBand) {
+		const UINT rowCount = std::min (rowsPerBand, height - row);
+		const WICRect rect = {
+			0, static_cast<INT> (row),
+			static_cast<INT> (width), static_cast<INT> (rowCount)
+		};
+
+		// The last row of the band does not need to be padded to the full
+		// pitch, the destination may end right after it
+		const auto bandSize = rowPitch * (rowCount - 1) + width * 4;
+
+		SAFE_WIC (converter->CopyPixels (&rect, static_cast<UINT> (rowPitch),
+			static_cast<UINT> (bandSize), output + row * rowPitch));
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::vector<std::uint8_t> LoadFittedInternal (ComPtr<IWICImagingFactory> factory,
+	ComPtr<IWICStream> stream, const int maximumDimension,
 	int* outputWidth, int* outputHeight)
 {
-	ComPtr<IWICImagingFactory> factory;
-	HRESULT hr = CoCreateInstance (
-		CLSID_WICImagingFactory,
-		NULL,
-		CLSCTX_INPROC_SERVER,
-		IID_PPV_ARGS (&factory)
-		);
+	if (maximumDimension <= 0) {
+		throw std::runtime_error ("Maximum image dimension must be positive");
+	}
+
+	auto converter = CreateConverter (factory, GetFirstFrame (factory, stream));
+
+	UINT width, height;
+	GetImageSize (converter.Get (), &width, &height);
+
+	std::vector<std::uint8_t> image (width * height * 4);
+	SAFE_WIC (converter->CopyPixels (nullptr, width * 4,
+		static_cast<UINT> (image.size ()), image.data ()));
 
-	if (FAILED(hr)) {
-		throw std::runtime_error ("Could not create WIC factory");
+	int fittedWidth, fittedHeight;
+	AMD::GetFittedImageSize (static_cast<int> (width), static_cast<int> (height),
+		maximumDimension, &fittedWidth, &fittedHeight);
+
+	if (fittedWidth != static_cast<int> (width) ||
+		fittedHeight != static_cast<int> (height)) {
+		std::vector<std::uint8_t> fitted (fittedWidth * fittedHeight * 4);
+
+		// The decoder hands out straight alpha
+		AMD::ResampleImage (image.data (), width, height, width * 4,
+			fitted.data (), fittedWidth, fittedHeight, fittedWidth * 4,
+			AMD::ResampleFilter::Lanczos3, AMD::AlphaMode::Straight);
+
+		image.swap (fitted);
 	}
 
-	ComPtr<IWICBitmapDecoder> decoder;
+	if (outputWidth) {
+		*outputWidth = fittedWidth;
+	}
 
-	std::vector<wchar_t> pathWchar (::strlen (path) + 1);
-	mbstowcs (pathWchar.data (), path, pathWchar.size ());
+	if (outputHeight) {
+		*outputHeight = fittedHeight;
+	}
 
-	ComPtr<IWICStream> stream;
-	factory->CreateStream(&stream);
-	stream->InitializeFromFilename(pathWchar.data (), GENERIC_READ);
+	return image;
+}
+}
 
-	return LoadInternal(factory, stream, rowAlignment, outputWidth, outputHeight);
+std::vector<std::uint8_t> LoadImageFromFile (const char* path, const int rowAlignment,
+	int* outputWidth, int* outputHeight)
+{
+	auto factory = GetFactory ();
+	auto stream = CreateStreamFromFile (factory, path);
 
+	return LoadInternal(factory, stream, rowAlignment, outputWidth, outputHeight);
 }
 
 std::vector<std::uint8_t> LoadImageFromMemory(const void* data, const std::size_t size,  
 	const int rowAlignment, int* outputWidth, int* outputHeight)
 {
-	ComPtr<IWICImagingFactory> factory;
-	HRESULT hr = CoCreateInstance(
-		CLSID_WICImagingFactory,
-		NULL,
-		CLSCTX_INPROC_SERVER,
-		IID_PPV_ARGS(&factory)
-		);
+	auto factory = GetFactory ();
+	auto stream = CreateStreamFromMemory (factory, data, size);
 
-	if (FAILED (hr)) {
-		throw std::runtime_error ("Could not create WIC factory");
-	}
+	return LoadInternal(factory, stream, rowAlignment, outputWidth, outputHeight);
+}
 
-	ComPtr<IWICStream> stream;
-	factory->CreateStream(&stream);
+std::vector<std::uint8_t> LoadImageFromPack (const AMD::AssetPack& pack, const char* name,
+	const int rowAlignment, int* outputWidth, int* outputHeight)
+{
+	// Uncompressed entries are decoded in place from the mapping
+	const auto asset = pack.Load (name);
 
-	// This is fine here as the memory will live on when the stream is long gone
-	stream->InitializeFromMemory(static_cast<BYTE*> (const_cast<void*> (data)), 
-		static_cast<DWORD> (size));
+	return LoadImageFromMemory (asset.GetData (), asset.GetSize (), rowAlignment,
+		outputWidth, outputHeight);
+}
 
-	return LoadInternal(factory, stream, rowAlignment, outputWidth, outputHeight);
+ImageInfo GetImageInfoFromFile (const char* path)
+{
+	auto factory = GetFactory ();
+	auto stream = CreateStreamFromFile (factory, path);
+
+	return GetInfoInternal (factory, stream);
+}
+
+ImageInfo GetImageInfoFromMemory (const void* data, const std::size_t size)
+{
+	auto factory = GetFactory ();
+	auto stream = CreateStreamFromMemory (factory, data, size);
+
+	return GetInfoInternal (factory, stream);
+}
+
+ImageInfo GetImageInfoFromPack (const AMD::AssetPack& pack, const char* name)
+{
+	const auto asset = pack.Load (name);
+
+	return GetImageInfoFromMemory (asset.GetData (), asset.GetSize ());
+}
+
+void LoadImageFromFileInto (const char* path,
+	void* destination, const std::size_t rowPitch, const std::size_t destinationSize)
+{
+	auto factory = GetFactory ();
+	auto stream = CreateStreamFromFile (factory, path);
+
+	LoadIntoInternal (factory, stream, destination, rowPitch, destinationSize);
+}
+
+void LoadImageFromMemoryInto (const void* data, const std::size_t size,
+	void* destination, const std::size_t rowPitch, const std::size_t destinationSize)
+{
+	auto factory = GetFactory ();
+	auto stream = CreateStreamFromMemory (factory, data, size);
+
+	LoadIntoInternal (factory, stream, destination, rowPitch, destinationSize);
+}
+
+std::vector<std::uint8_t> LoadImageFromFileFitted (const char* path,
+	const int maximumDimension, int* outputWidth, int* outputHeight)
+{
+	auto factory = GetFactory ();
+	auto stream = CreateStreamFromFile (factory, path);
+
+	return LoadFittedInternal (factory, stream, maximumDimension, outputWidth, outputHeight);
+}
+
+std::vector<std::uint8_t> LoadImageFromMemoryFitted (const void* data, const std::size_t size,
+	const int maximumDimension, int* outputWidth, int* outputHeight)
+{
+	auto factory = GetFactory ();
+	auto stream = CreateStreamFromMemory (factory, data, size);
+
+	return LoadFittedInternal (factory, stream, maximumDimension, outputWidth, outputHeight);
 }
@@ -30,10 +30,64 @@
 #undef LoadImage
 #endif
 
+namespace AMD {
+class AssetPack;
+}
+
 std::vector<std::uint8_t> LoadImageFromFile (const char* path, const int rowAlignment,
 	int* width, int* height);
 
 std::vector<std::uint8_t> LoadImageFromMemory(const void* data, const std::size_t size, const int rowAlignment,
 	int* width, int* height);
 
+/**
+Decode the entry name of pack. Throws if there is no such entry.
+*/
+std::vector<std::uint8_t> LoadImageFromPack (const AMD::AssetPack& pack, const char* name,
+	const int rowAlignment, int* width, int* height);
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Information about an image which can be obtained without decoding it.
+
+Images are always decoded to 32 bpp RGBA, so bytesPerPixel is the size of one
+decoded pixel. hasAlpha is set if the source format can store transparency.
+*/
+struct ImageInfo
+{
+	int width;
+	int height;
+	int bytesPerPixel;
+	bool hasAlpha;
+};
+
+ImageInfo GetImageInfoFromFile (const char* path);
+ImageInfo GetImageInfoFromMemory (const void* data, const std::size_t size);
+ImageInfo GetImageInfoFromPack (const AMD::AssetPack& pack, const char* name);
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Decode an image directly into caller-provided memory, for instance a mapped
+upload buffer. Rows are written rowPitch bytes apart, which allows the
+destination to use the footprint returned by GetCopyableFootprints. The
+destination must be at least rowPitch * (height - 1) + width * 4 bytes large.
+*/
+void LoadImageFromFileInto (const char* path,
+	void* destination, const std::size_t rowPitch, const std::size_t destinationSize);
+
+void LoadImageFromMemoryInto (const void* data, const std::size_t size,
+	void* destination, const std::size_t rowPitch, const std::size_t destinationSize);
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Decode an image and scale it down so neither side exceeds maximumDimension,
+keeping the aspect ratio. Images which fit already are returned as decoded.
+Rows are tightly packed; width and height receive the final size.
+*/
+std::vector<std::uint8_t> LoadImageFromFileFitted (const char* path,
+	const int maximumDimension, int* width, int* height);
+
+std::vector<std::uint8_t> LoadImageFromMemoryFitted (const void* data, const std::size_t size,
+	const int maximumDimension, int* width, int* height);
+
 #endif
\ No newline at end of file
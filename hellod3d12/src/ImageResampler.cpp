@@ -0,0 +1,278 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#include "ImageResampler.h"
+
+#include "Parallel.h"
+#include "PixelConversion.h"
+
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+#include <emmintrin.h>
+
+namespace AMD {
+namespace {
+///////////////////////////////////////////////////////////////////////////////
+float Mitchell (float x)
+{
+	static const float B = 1.0f / 3.0f;
+	static const float C = 1.0f / 3.0f;
+
+	x = std::abs (x);
+
+	if (x < 1) {
+		return ((12 - 9 * B - 6 * C) * x * x * x +
+			(-18 + 12 * B + 6 * C) * x * x +
+			(6 - 2 * B)) / 6;
+	} else if (x < 2) {
+		return ((-B - 6 * C) * x * x * x +
+			(6 * B + 30 * C) * x * x +
+			(-12 * B - 48 * C) * x +
+			(8 * B + 24 * C)) / 6;
+	}
+
+	return 0;
+}
+
+float Sinc (const float x)
+{
+	static const float pi = 3.14159265358979f;
+
+	if (std::abs (x) < 1e-6f) {
+		return 1;
+	}
+
+	return std::sin (pi * x) / (pi * x);
+}
+
+float Lanczos3 (const float x)
+{
+	if (std::abs (x) >= 3) {
+		return 0;
+	}
+
+	return Sinc (x) * Sinc (x / 3);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Filter weights for one dimension. Every output sample reads tapCount
+consecutive input samples starting at first [i]; taps which fall outside of
+the image are folded onto the edge sample, so no bounds checks are needed
+while filtering.
+*/
+struct WeightTable
+{
+	int tapCount;
+	std::vector<int> first;
+	std::vector<float> weights;
+};
+
+WeightTable CreateWeightTable (const int inputSize, const int outputSize,
+	const ResampleFilter filter)
+{
+	const float scale = static_cast<float> (inputSize) / outputSize;
+	// When downscaling, stretch the filter to cover the whole footprint of
+	// the output sample
+	const float filterScale = (std::max) (scale, 1.0f);
+	const float radius = ((filter == ResampleFilter::Mitchell) ? 2.0f : 3.0f) * filterScale;
+
+	auto evaluate = [filter] (const float x) -> float {
+		return (filter == ResampleFilter::Mitchell) ? Mitchell (x) : Lanczos3 (x);
+	};
+
+	auto getTapRange = [=] (const int i, int* begin, int* end) -> void {
+		const float center = (i + 0.5f) * scale;
+		*begin = static_cast<int> (std::floor (center - radius + 0.5f));
+		*end = static_cast<int> (std::floor (center + radius + 0.5f));
+	};
+
+	WeightTable result;
+	result.tapCount = 1;
+
+	for (int i = 0; i < outputSize; ++i) {
+		int begin, end;
+		getTapRange (i, &begin, &end);
+		result.tapCount = (std::max) (result.tapCount, end - begin);
+	}
+
+	result.tapCount = (std::min) (result.tapCount, inputSize);
+	result.first.resize (outputSize);
+	result.weights.resize (static_cast<std::size_t> (outputSize) * result.tapCount);
+
+	for (int i = 0; i < outputSize; ++i) {
+		int begin, end;
+		getTapRange (i, &begin, &end);
+
+		const int first = (std::max) (0,
+			(std::min) (begin, inputSize - result.tapCount));
+		result.first [i] = first;
+
+		float* weights = result.weights.data () + static_cast<std::size_t> (i) * result.tapCount;
+		const float center = (i + 0.5f) * scale;
+		float sum = 0;
+
+		for (int j = begin; j < end; ++j) {
+			const float weight = evaluate ((j + 0.5f - center) / filterScale);
+			const int clamped = (std::max) (0, (std::min) (j, inputSize - 1));
+
+			weights [clamped - first] += weight;
+			sum += weight;
+		}
+
+		for (int t = 0; t < result.tapCount; ++t) {
+			weights [t] /= sum;
+		}
+	}
+
+	return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void PremultiplyLinear (float* pixels, const int count)
+{
+	for (int i = 0; i < count; ++i) {
+		const float a = pixels [i * 4 + 3];
+		pixels [i * 4 + 0] *= a;
+		pixels [i * 4 + 1] *= a;
+		pixels [i * 4 + 2] *= a;
+	}
+}
+
+void UnpremultiplyLinear (float* pixels, const int count)
+{
+	const __m128 zero = _mm_setzero_ps ();
+	const __m128 alphaLane = _mm_castsi128_ps (_mm_setr_epi32 (0, 0, 0, -1));
+
+	for (int i = 0; i < count; ++i) {
+		const __m128 v = _mm_loadu_ps (pixels + i * 4);
+		const __m128 a = _mm_shuffle_ps (v, v, _MM_SHUFFLE (3, 3, 3, 3));
+		// Ringing can produce zero or negative alpha, those texels are black
+		const __m128 mask = _mm_cmpgt_ps (a, zero);
+		const __m128 rgb = _mm_and_ps (_mm_div_ps (v, a), mask);
+		_mm_storeu_ps (pixels + i * 4,
+			_mm_or_ps (_mm_andnot_ps (alphaLane, rgb), _mm_and_ps (alphaLane, v)));
+	}
+}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void GetFittedImageSize (const int width, const int height,
+	const int maximumDimension, int* fittedWidth, int* fittedHeight)
+{
+	const int largest = (std::max) (width, height);
+
+	if (largest <= maximumDimension) {
+		*fittedWidth = width;
+		*fittedHeight = height;
+		return;
+	}
+
+	const double scale = static_cast<double> (maximumDimension) / largest;
+	*fittedWidth = (std::max) (1, static_cast<int> (width * scale + 0.5));
+	*fittedHeight = (std::max) (1, static_cast<int> (height * scale + 0.5));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void ResampleImage (const void* input, const int inputWidth,
+	const int inputHeight, const std::size_t inputRowPitch,
+	void* output, const int outputWidth, const int outputHeight,
+	const std::size_t outputRowPitch,
+	const ResampleFilter filter, const AlphaMode alphaMode)
+{
+	if (inputWidth <= 0 || inputHeight <= 0 || outputWidth <= 0 || outputHeight <= 0) {
+		throw std::runtime_error ("Invalid image size for resampling");
+	}
+
+	const bool straightAlpha = (alphaMode == AlphaMode::Straight);
+	const auto horizontalWeights = CreateWeightTable (inputWidth, outputWidth, filter);
+	const auto verticalWeights = CreateWeightTable (inputHeight, outputHeight, filter);
+
+	// Horizontally filtered input, outputWidth x inputHeight, linear RGBA
+	std::vector<float> intermediate (static_cast<std::size_t> (outputWidth) * inputHeight * 4);
+
+	ParallelFor (inputHeight, 16, [&] (const int begin, const int end) {
+		std::vector<float> row (static_cast<std::size_t> (inputWidth) * 4);
+		const int tapCount = horizontalWeights.tapCount;
+
+		for (int y = begin; y < end; ++y) {
+			ConvertSrgbToLinear (static_cast<const std::uint8_t*> (input) + y * inputRowPitch,
+				row.data (), inputWidth);
+
+			if (straightAlpha) {
+				PremultiplyLinear (row.data (), inputWidth);
+			}
+
+			float* result = intermediate.data () + static_cast<std::size_t> (y) * outputWidth * 4;
+
+			// One RGBA pixel per SSE register
+			for (int x = 0; x < outputWidth; ++x) {
+				const float* source = row.data () + horizontalWeights.first [x] * 4;
+				const float* weights = horizontalWeights.weights.data () +
+					static_cast<std::size_t> (x) * tapCount;
+
+				__m128 sum = _mm_setzero_ps ();
+				for (int t = 0; t < tapCount; ++t) {
+					sum = _mm_add_ps (sum, _mm_mul_ps (
+						_mm_loadu_ps (source + t * 4), _mm_set1_ps (weights [t])));
+				}
+
+				_mm_storeu_ps (result + x * 4, sum);
+			}
+		}
+	});
+
+	ParallelFor (outputHeight, 16, [&] (const int begin, const int end) {
+		const int rowSize = outputWidth * 4;
+		std::vector<float> row (rowSize);
+		const int tapCount = verticalWeights.tapCount;
+
+		for (int y = begin; y < end; ++y) {
+			const float* weights = verticalWeights.weights.data () +
+				static_cast<std::size_t> (y) * tapCount;
+
+			// Accumulate whole rows, so all reads and writes are sequential
+			std::fill (row.begin (), row.end (), 0.0f);
+
+			for (int t = 0; t < tapCount; ++t) {
+				const float* source = intermediate.data () +
+					static_cast<std::size_t> (verticalWeights.first [y] + t) * rowSize;
+				const __m128 weight = _mm_set1_ps (weights [t]);
+
+				for (int x = 0; x < rowSize; x += 4) {
+					_mm_storeu_ps (row.data () + x, _mm_add_ps (_mm_loadu_ps (row.data () + x),
+						_mm_mul_ps (_mm_loadu_ps (source + x), weight)));
+				}
+			}
+
+			if (straightAlpha) {
+				UnpremultiplyLinear (row.data (), outputWidth);
+			}
+
+			// Clamps the overshoot from the negative filter lobes
+			ConvertLinearToSrgb (row.data (),
+				static_cast<std::uint8_t*> (output) + y * outputRowPitch, outputWidth);
+		}
+	});
+}
+}
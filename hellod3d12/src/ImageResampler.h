@@ -0,0 +1,65 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#ifndef ANTERU_D3D12_SAMPLE_IMAGERESAMPLER_H_
+#define ANTERU_D3D12_SAMPLE_IMAGERESAMPLER_H_
+
+#include "MipChain.h"
+
+#include <cstddef>
+
+namespace AMD {
+///////////////////////////////////////////////////////////////////////////////
+enum class ResampleFilter
+{
+	// Mitchell-Netravali with B = C = 1/3, 4 taps, soft with little ringing
+	Mitchell,
+	// Windowed sinc with 6 taps, sharper but rings around hard edges
+	Lanczos3
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Compute the size of an image scaled down uniformly so neither side exceeds
+maximumDimension. Images which fit already keep their size.
+*/
+void GetFittedImageSize (const int width, const int height,
+	const int maximumDimension, int* fittedWidth, int* fittedHeight);
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Resample an 8 bit per channel sRGB RGBA image to a new size, both up- and
+downscaling work.
+
+The filter is separable: a horizontal pass over all input rows followed by a
+vertical pass, both using precomputed weight tables and running on all
+cores. Filtering happens in linear space; straight alpha gets premultiplied
+while filtering so transparent texels don't bleed into their neighbors.
+*/
+void ResampleImage (const void* input, const int inputWidth,
+	const int inputHeight, const std::size_t inputRowPitch,
+	void* output, const int outputWidth, const int outputHeight,
+	const std::size_t outputRowPitch,
+	const ResampleFilter filter, const AlphaMode alphaMode);
+}
+
+#endif
@@ -0,0 +1,229 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#include "Lz4.h"
+
+#include <cstring>
+#include <stdexcept>
+
+namespace AMD {
+namespace {
+// Format constraints: a match needs at least 4 bytes, the last 5 bytes are
+// always literals and the last match must start 12 bytes before the end
+const std::size_t MIN_MATCH = 4;
+const std::size_t LAST_LITERALS = 5;
+const std::size_t MATCH_FIND_LIMIT = 12;
+const std::size_t MAX_OFFSET = 65535;
+
+const int HASH_BITS = 12;
+
+std::uint32_t Read32 (const std::uint8_t* p)
+{
+	std::uint32_t result;
+	std::memcpy (&result, p, sizeof (result));
+	return result;
+}
+
+std::uint32_t Hash (const std::uint32_t sequence)
+{
+	return (sequence * 2654435761u) >> (32 - HASH_BITS);
+}
+
+void WriteLength (std::vector<std::uint8_t>& output, std::size_t length)
+{
+	while (length >= 255) {
+		output.push_back (255);
+		length -= 255;
+	}
+
+	output.push_back (static_cast<std::uint8_t> (length));
+}
+
+void WriteSequence (std::vector<std::uint8_t>& output,
+	const std::uint8_t* literals, const std::size_t literalLength,
+	const std::size_t offset, const std::size_t matchLength)
+{
+	const auto literalToken = (literalLength < 15) ? literalLength : 15;
+	const auto matchToken = (matchLength == 0) ? 0
+		: ((matchLength - MIN_MATCH < 15) ? matchLength - MIN_MATCH : 15);
+
+	output.push_back (static_cast<std::uint8_t> ((literalToken << 4) | matchToken));
+
+	if (literalLength >= 15) {
+		WriteLength (output, literalLength - 15);
+	}
+
+	output.insert (output.end (), literals, literals + literalLength);
+
+	// The last sequence has no match part
+	if (matchLength == 0) {
+		return;
+	}
+
+	output.push_back (static_cast<std::uint8_t> (offset & 0xFF));
+	output.push_back (static_cast<std::uint8_t> (offset >> 8));
+
+	if (matchLength - MIN_MATCH >= 15) {
+		WriteLength (output, matchLength - MIN_MATCH - 15);
+	}
+}
+
+std::size_t ReadLength (const std::uint8_t*& input, const std::uint8_t* end)
+{
+	std::size_t result = 0;
+
+	for (;;) {
+		if (input >= end) {
+			throw std::runtime_error ("LZ4 stream is truncated");
+		}
+
+		const auto value = *input++;
+		result += value;
+
+		if (value != 255) {
+			return result;
+		}
+	}
+}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::vector<std::uint8_t> Lz4Compress (const void* data, const std::size_t size)
+{
+	const auto input = static_cast<const std::uint8_t*> (data);
+
+	std::vector<std::uint8_t> output;
+	output.reserve (size + size / 255 + 16);
+
+	// Positions are stored + 1 so zero means empty
+	std::vector<std::size_t> hashTable (1 << HASH_BITS, 0);
+
+	std::size_t position = 0;
+	std::size_t anchor = 0;
+
+	if (size > MATCH_FIND_LIMIT) {
+		const std::size_t matchLimit = size - LAST_LITERALS;
+
+		while (position < size - MATCH_FIND_LIMIT) {
+			const auto sequence = Read32 (input + position);
+			const auto hash = Hash (sequence);
+			const auto candidate = hashTable [hash];
+			hashTable [hash] = position + 1;
+
+			if (candidate == 0 ||
+				position - (candidate - 1) > MAX_OFFSET ||
+				Read32 (input + candidate - 1) != sequence) {
+				++position;
+				continue;
+			}
+
+			const auto reference = candidate - 1;
+			std::size_t matchLength = MIN_MATCH;
+			while (position + matchLength < matchLimit &&
+				input [reference + matchLength] == input [position + matchLength]) {
+				++matchLength;
+			}
+
+			WriteSequence (output, input + anchor, position - anchor,
+				position - reference, matchLength);
+
+			position += matchLength;
+			anchor = position;
+		}
+	}
+
+	WriteSequence (output, input + anchor, size - anchor, 0, 0);
+
+	return output;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Lz4Decompress (const void* data, const std::size_t size,
+	void* output, const std::size_t outputSize)
+{
+	auto input = static_cast<const std::uint8_t*> (data);
+	const auto inputEnd = input + size;
+
+	const auto outputStart = static_cast<std::uint8_t*> (output);
+	auto out = outputStart;
+	const auto outputEnd = outputStart + outputSize;
+
+	while (input < inputEnd) {
+		const auto token = *input++;
+
+		std::size_t literalLength = token >> 4;
+		if (literalLength == 15) {
+			literalLength += ReadLength (input, inputEnd);
+		}
+
+		if (literalLength > static_cast<std::size_t> (inputEnd - input) ||
+			literalLength > static_cast<std::size_t> (outputEnd - out)) {
+			throw std::runtime_error ("LZ4 literals out of bounds");
+		}
+
+		// Sequences may have no literals, and out is null for empty outputs
+		if (literalLength > 0) {
+			std::memcpy (out, input, literalLength);
+			input += literalLength;
+			out += literalLength;
+		}
+
+		// The last sequence ends after the literals
+		if (input == inputEnd) {
+			break;
+		}
+
+		if (inputEnd - input < 2) {
+			throw std::runtime_error ("LZ4 stream is truncated");
+		}
+
+		const std::size_t offset = input [0] | (input [1] << 8);
+		input += 2;
+
+		std::size_t matchLength = token & 0xF;
+		if (matchLength == 15) {
+			matchLength += ReadLength (input, inputEnd);
+		}
+		matchLength += MIN_MATCH;
+
+		if (offset == 0 || offset > static_cast<std::size_t> (out - outputStart) ||
+			matchLength > static_cast<std::size_t> (outputEnd - out)) {
+			throw std::runtime_error ("LZ4 match out of bounds");
+		}
+
+		const std::uint8_t* match = out - offset;
+		if (offset >= matchLength) {
+			std::memcpy (out, match, matchLength);
+			out += matchLength;
+		} else {
+			// Overlapping match, this repeats the last offset bytes
+			for (std::size_t i = 0; i < matchLength; ++i) {
+				*out++ = *match++;
+			}
+		}
+	}
+
+	if (out != outputEnd) {
+		throw std::runtime_error ("LZ4 stream has the wrong size");
+	}
+}
+}
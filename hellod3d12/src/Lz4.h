@@ -0,0 +1,48 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#ifndef ANTERU_D3D12_SAMPLE_LZ4_H_
+#define ANTERU_D3D12_SAMPLE_LZ4_H_
+
+#include <cstdint>
+#include <vector>
+
+namespace AMD {
+///////////////////////////////////////////////////////////////////////////////
+/**
+Compress data into the LZ4 block format (no frame header). The output can be
+decompressed with any LZ4 block decoder, for instance lz4.block in Python.
+The compressor is a single-pass greedy matcher, it favors speed over ratio.
+*/
+std::vector<std::uint8_t> Lz4Compress (const void* data, const std::size_t size);
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Decompress an LZ4 block. The decompressed size must be known up front,
+throws if the input is malformed or does not decompress to exactly
+outputSize bytes.
+*/
+void Lz4Decompress (const void* data, const std::size_t size,
+	void* output, const std::size_t outputSize);
+}
+
+#endif
@@ -20,14 +20,44 @@
 // THE SOFTWARE.
 //
 
+#include "AssetPack.h"
 #include "D3D12AnimatedQuad.h"
 #include "D3D12Quad.h"
 #include "D3D12TexturedQuad.h"
 
+#include <string>
+
+namespace {
+///////////////////////////////////////////////////////////////////////////////
+/**
+The command line is a single path. Explorer and shells put quotes around
+paths with spaces, so surrounding whitespace and quotes are removed.
+*/
+std::string GetPathArgument (const char* commandLine)
+{
+	if (commandLine == nullptr) {
+		return std::string ();
+	}
+
+	const std::string line (commandLine);
+	const auto first = line.find_first_not_of (" \t");
+	if (first == std::string::npos) {
+		return std::string ();
+	}
+
+	auto path = line.substr (first, line.find_last_not_of (" \t") - first + 1);
+	if (path.size () >= 2 && path.front () == '"' && path.back () == '"') {
+		path = path.substr (1, path.size () - 2);
+	}
+
+	return path;
+}
+}
+
 int WinMain (
 	_In_ HINSTANCE /* hInstance */,
 	_In_opt_ HINSTANCE /* hPrevInstance */,
-	_In_ LPSTR     /* lpCmdLine */,
+	_In_ LPSTR     lpCmdLine,
 	_In_ int       /* nCmdShow */
 	)
 {
@@ -45,6 +75,15 @@ int WinMain (
 		return 1;
 	}
 
+	// An asset pack written by tools/packAssets.py can be passed on the
+	// command line, its shaders.hlsl and ruby.jpg replace the embedded ones
+	std::unique_ptr<AMD::AssetPack> assetPack;
+	const auto assetPackPath = GetPathArgument (lpCmdLine);
+	if (!assetPackPath.empty ()) {
+		assetPack.reset (new AMD::AssetPack (assetPackPath.c_str ()));
+		sample->SetAssetPack (assetPack.get ());
+	}
+
 	sample->Run (512);
 	delete sample;
 
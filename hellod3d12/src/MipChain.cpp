@@ -0,0 +1,424 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#include "MipChain.h"
+
+#include "Parallel.h"
+#include "PixelConversion.h"
+
+#include <cmath>
+#include <immintrin.h>
+
+#ifdef _MSC_VER
+// MSVC allows AVX intrinsics in any function, no target attributes needed
+#define AMD_TARGET_AVX
+#else
+#define AMD_TARGET_AVX __attribute__ ((target ("avx")))
+#endif
+
+namespace AMD {
+namespace {
+///////////////////////////////////////////////////////////////////////////////
+struct LinearImage
+{
+	int width;
+	int height;
+	// Four floats per pixel, RGBA
+	std::vector<float> pixels;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+LinearImage ToLinear (const std::uint8_t* data, const int width, const int height,
+	const std::size_t rowPitch, const bool premultiply)
+{
+	LinearImage result;
+	result.width = width;
+	result.height = height;
+	result.pixels.resize (static_cast<std::size_t> (width) * height * 4);
+
+	ParallelFor (height, 16, [&] (const int begin, const int end) {
+		for (int y = begin; y < end; ++y) {
+			float* output = result.pixels.data () + static_cast<std::size_t> (y) * width * 4;
+			ConvertSrgbToLinear (data + y * rowPitch, output, width);
+
+			if (premultiply) {
+				for (int x = 0; x < width; ++x) {
+					const float a = output [3];
+					output [0] *= a;
+					output [1] *= a;
+					output [2] *= a;
+					output += 4;
+				}
+			}
+		}
+	});
+
+	return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+float Sinc (const float x)
+{
+	static const float pi = 3.14159265358979f;
+
+	if (std::abs (x) < 1e-6f) {
+		return 1;
+	}
+
+	return std::sin (pi * x) / (pi * x);
+}
+
+/**
+Zeroth order modified Bessel function of the first kind, from its power
+series. Converges quickly for the small arguments used by the window.
+*/
+float BesselI0 (const float x)
+{
+	float sum = 1;
+	float term = 1;
+
+	for (int k = 1; k < 32; ++k) {
+		term *= (x / (2 * k)) * (x / (2 * k));
+		sum += term;
+
+		if (term < sum * 1e-8f) {
+			break;
+		}
+	}
+
+	return sum;
+}
+
+const float KAISER_RADIUS = 3;
+const float KAISER_ALPHA = 4;
+
+float Kaiser (const float x)
+{
+	const float t = x / KAISER_RADIUS;
+	if (std::abs (t) >= 1) {
+		return 0;
+	}
+
+	return Sinc (x) * BesselI0 (KAISER_ALPHA * std::sqrt (1 - t * t)) /
+		BesselI0 (KAISER_ALPHA);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Filter weights for one axis. Every output texel reads tapCount consecutive
+input texels starting at first [i]; taps outside of the image are folded
+onto the edge texel, so the kernels need no bounds checks.
+*/
+struct WeightTable
+{
+	int tapCount;
+	std::vector<int> first;
+	std::vector<float> weights;
+};
+
+WeightTable CreateWeightTable (const int inputSize, const int outputSize,
+	const MipFilter filter)
+{
+	// 1 for an axis which is 1 already, 2 or slightly more than 2 otherwise
+	const float scale = static_cast<float> (inputSize) / outputSize;
+
+	auto getTapRange = [=] (const int i, int* begin, int* end) -> void {
+		if (filter == MipFilter::Box) {
+			*begin = static_cast<int> (std::floor (i * scale));
+			*end = static_cast<int> (std::ceil ((i + 1) * scale));
+		} else {
+			const float center = (i + 0.5f) * scale;
+			const float radius = KAISER_RADIUS * scale;
+			*begin = static_cast<int> (std::floor (center - radius + 0.5f));
+			*end = static_cast<int> (std::floor (center + radius + 0.5f));
+		}
+	};
+
+	// The box weight is the part of input texel j covered by output texel i
+	auto evaluate = [=] (const int i, const int j) -> float {
+		if (filter == MipFilter::Box) {
+			const float begin = (std::max) (static_cast<float> (j), i * scale);
+			const float end = (std::min) (static_cast<float> (j + 1), (i + 1) * scale);
+			return (std::max) (0.0f, end - begin);
+		} else {
+			return Kaiser ((j + 0.5f - (i + 0.5f) * scale) / scale);
+		}
+	};
+
+	WeightTable result;
+	result.tapCount = 1;
+
+	for (int i = 0; i < outputSize; ++i) {
+		int begin, end;
+		getTapRange (i, &begin, &end);
+		result.tapCount = (std::max) (result.tapCount, end - begin);
+	}
+
+	result.tapCount = (std::min) (result.tapCount, inputSize);
+	result.first.resize (outputSize);
+	result.weights.resize (static_cast<std::size_t> (outputSize) * result.tapCount);
+
+	for (int i = 0; i < outputSize; ++i) {
+		int begin, end;
+		getTapRange (i, &begin, &end);
+
+		const int first = (std::max) (0,
+			(std::min) (begin, inputSize - result.tapCount));
+		result.first [i] = first;
+
+		float* weights = result.weights.data () + static_cast<std::size_t> (i) * result.tapCount;
+		float sum = 0;
+
+		for (int j = begin; j < end; ++j) {
+			const float weight = evaluate (i, j);
+			const int clamped = (std::max) (0, (std::min) (j, inputSize - 1));
+
+			weights [clamped - first] += weight;
+			sum += weight;
+		}
+
+		for (int t = 0; t < result.tapCount; ++t) {
+			weights [t] /= sum;
+		}
+	}
+
+	return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Vertical pass: output = sum of rows [t] * weights [t], for the floats in
+[begin, end) (multiples of 4).
+*/
+void FilterColumnsSSE2 (const float* const* rows, const float* weights,
+	const int tapCount, float* output, const int begin, const int end)
+{
+	for (int x = begin; x < end; x += 4) {
+		__m128 sum = _mm_setzero_ps ();
+		for (int t = 0; t < tapCount; ++t) {
+			sum = _mm_add_ps (sum, _mm_mul_ps (
+				_mm_loadu_ps (rows [t] + x), _mm_set1_ps (weights [t])));
+		}
+
+		_mm_storeu_ps (output + x, sum);
+	}
+}
+
+AMD_TARGET_AVX void FilterColumnsAVX (const float* const* rows, const float* weights,
+	const int tapCount, float* output, const int size)
+{
+	int x = 0;
+	for (; x + 8 <= size; x += 8) {
+		__m256 sum = _mm256_setzero_ps ();
+		for (int t = 0; t < tapCount; ++t) {
+			sum = _mm256_add_ps (sum, _mm256_mul_ps (
+				_mm256_loadu_ps (rows [t] + x), _mm256_set1_ps (weights [t])));
+		}
+
+		_mm256_storeu_ps (output + x, sum);
+	}
+
+	FilterColumnsSSE2 (rows, weights, tapCount, output, x, size);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Horizontal pass over one row, one RGBA texel per SSE register.
+*/
+void FilterRowSSE2 (const float* input, const WeightTable& table,
+	float* output, const int begin, const int end)
+{
+	const int tapCount = table.tapCount;
+
+	for (int x = begin; x < end; ++x) {
+		const float* source = input + table.first [x] * 4;
+		const float* weights = table.weights.data () + static_cast<std::size_t> (x) * tapCount;
+
+		__m128 sum = _mm_setzero_ps ();
+		for (int t = 0; t < tapCount; ++t) {
+			sum = _mm_add_ps (sum, _mm_mul_ps (
+				_mm_loadu_ps (source + t * 4), _mm_set1_ps (weights [t])));
+		}
+
+		_mm_storeu_ps (output + x * 4, sum);
+	}
+}
+
+/**
+Two output texels per AVX register, one in each 128 bit lane.
+*/
+AMD_TARGET_AVX void FilterRowAVX (const float* input, const WeightTable& table,
+	float* output, const int width)
+{
+	const int tapCount = table.tapCount;
+
+	int x = 0;
+	for (; x + 2 <= width; x += 2) {
+		const float* source0 = input + table.first [x] * 4;
+		const float* source1 = input + table.first [x + 1] * 4;
+		const float* weights0 = table.weights.data () + static_cast<std::size_t> (x) * tapCount;
+		const float* weights1 = weights0 + tapCount;
+
+		__m256 sum = _mm256_setzero_ps ();
+		for (int t = 0; t < tapCount; ++t) {
+			const __m256 texels = _mm256_insertf128_ps (
+				_mm256_castps128_ps256 (_mm_loadu_ps (source0 + t * 4)),
+				_mm_loadu_ps (source1 + t * 4), 1);
+			const __m256 weight = _mm256_insertf128_ps (
+				_mm256_castps128_ps256 (_mm_set1_ps (weights0 [t])),
+				_mm_set1_ps (weights1 [t]), 1);
+			sum = _mm256_add_ps (sum, _mm256_mul_ps (texels, weight));
+		}
+
+		_mm256_storeu_ps (output + x * 4, sum);
+	}
+
+	FilterRowSSE2 (input, table, output, x, width);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Halve the image, rounding down. Each task filters its output rows
+vertically into a temporary row, then horizontally into the result.
+*/
+LinearImage Downsample (const LinearImage& input, const MipFilter filter,
+	const bool useAVX)
+{
+	LinearImage result;
+	result.width = (std::max) (1, input.width / 2);
+	result.height = (std::max) (1, input.height / 2);
+	result.pixels.resize (static_cast<std::size_t> (result.width) * result.height * 4);
+
+	const auto horizontalWeights = CreateWeightTable (input.width, result.width, filter);
+	const auto verticalWeights = CreateWeightTable (input.height, result.height, filter);
+
+	ParallelFor (result.height, 16, [&] (const int begin, const int end) {
+		const int rowSize = input.width * 4;
+		const int tapCount = verticalWeights.tapCount;
+
+		std::vector<float> row (rowSize);
+		std::vector<const float*> rows (tapCount);
+
+		for (int y = begin; y < end; ++y) {
+			for (int t = 0; t < tapCount; ++t) {
+				rows [t] = input.pixels.data () +
+					static_cast<std::size_t> (verticalWeights.first [y] + t) * rowSize;
+			}
+
+			const float* weights = verticalWeights.weights.data () +
+				static_cast<std::size_t> (y) * tapCount;
+			float* output = result.pixels.data () + static_cast<std::size_t> (y) * result.width * 4;
+
+			if (useAVX) {
+				FilterColumnsAVX (rows.data (), weights, tapCount, row.data (), rowSize);
+				FilterRowAVX (row.data (), horizontalWeights, output, result.width);
+			} else {
+				FilterColumnsSSE2 (rows.data (), weights, tapCount, row.data (), 0, rowSize);
+				FilterRowSSE2 (row.data (), horizontalWeights, output, 0, result.width);
+			}
+		}
+	});
+
+	return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+MipLevel ToSrgb (const LinearImage& input, const bool unpremultiply)
+{
+	MipLevel result;
+	result.width = input.width;
+	result.height = input.height;
+	result.data.resize (static_cast<std::size_t> (input.width) * input.height * 4);
+
+	ParallelFor (input.height, 16, [&] (const int begin, const int end) {
+		const __m128 zero = _mm_setzero_ps ();
+		// Keep alpha as-is, the division would turn it into 1
+		const __m128 alphaLane = _mm_castsi128_ps (_mm_setr_epi32 (0, 0, 0, -1));
+
+		std::vector<float> rowBuffer;
+		if (unpremultiply) {
+			rowBuffer.resize (static_cast<std::size_t> (input.width) * 4);
+		}
+
+		for (int y = begin; y < end; ++y) {
+			const float* row = input.pixels.data () + static_cast<std::size_t> (y) * input.width * 4;
+			std::uint8_t* output = result.data.data () + static_cast<std::size_t> (y) * input.width * 4;
+
+			if (unpremultiply) {
+				for (int x = 0; x < input.width; ++x) {
+					const __m128 v = _mm_loadu_ps (row + x * 4);
+					const __m128 a = _mm_shuffle_ps (v, v, _MM_SHUFFLE (3, 3, 3, 3));
+					// Fully transparent texels have no color, keep them black
+					const __m128 mask = _mm_cmpgt_ps (a, zero);
+					const __m128 rgb = _mm_and_ps (_mm_div_ps (v, a), mask);
+					_mm_storeu_ps (rowBuffer.data () + x * 4,
+						_mm_or_ps (_mm_andnot_ps (alphaLane, rgb), _mm_and_ps (alphaLane, v)));
+				}
+
+				row = rowBuffer.data ();
+			}
+
+			ConvertLinearToSrgb (row, output, input.width);
+		}
+	});
+
+	return result;
+}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int GetMipLevelCount (const int width, const int height)
+{
+	int levels = 1;
+	int size = (std::max) (width, height);
+
+	while (size > 1) {
+		size /= 2;
+		++levels;
+	}
+
+	return levels;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::vector<MipLevel> GenerateMipChain (const void* data,
+	const int width, const int height, const std::size_t rowPitch,
+	const AlphaMode alphaMode, const MipFilter filter)
+{
+	const bool straightAlpha = (alphaMode == AlphaMode::Straight);
+	const bool useAVX = (GetPixelConversionSimdLevel () == SimdLevel::AVX2);
+
+	std::vector<MipLevel> result;
+	const int levelCount = GetMipLevelCount (width, height);
+	result.reserve (levelCount - 1);
+
+	auto current = ToLinear (static_cast<const std::uint8_t*> (data),
+		width, height, rowPitch, straightAlpha);
+
+	for (int level = 1; level < levelCount; ++level) {
+		current = Downsample (current, filter, useAVX);
+		result.push_back (ToSrgb (current, straightAlpha));
+	}
+
+	return result;
+}
+}
@@ -0,0 +1,82 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#ifndef ANTERU_D3D12_SAMPLE_MIPCHAIN_H_
+#define ANTERU_D3D12_SAMPLE_MIPCHAIN_H_
+
+#include <cstdint>
+#include <vector>
+
+namespace AMD {
+///////////////////////////////////////////////////////////////////////////////
+enum class AlphaMode
+{
+	// Color is not multiplied with alpha, the filter weights each texel by its
+	// alpha so transparent texels don't bleed into their neighbors
+	Straight,
+	// Color is already multiplied with alpha, filter all channels as-is
+	Premultiplied
+};
+
+///////////////////////////////////////////////////////////////////////////////
+enum class MipFilter
+{
+	// Averages exactly the footprint of each output texel: two taps per axis
+	// for even sizes, three weighted taps for odd sizes
+	Box,
+	// Kaiser-windowed sinc (alpha = 4) over three output texels to each side,
+	// keeps the lower levels sharper and aliases less, at about 1.5 times the
+	// cost of Box
+	Kaiser
+};
+
+///////////////////////////////////////////////////////////////////////////////
+struct MipLevel
+{
+	int width;
+	int height;
+	// RGBA, 8 bit per channel, sRGB encoded, rows tightly packed
+	std::vector<std::uint8_t> data;
+};
+
+int GetMipLevelCount (const int width, const int height);
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Generate all mip levels below an 8 bit per channel sRGB RGBA image, down to
+1x1. The returned vector starts with mip level 1, level 0 is the input image.
+
+Filtering happens in linear space with a separable filter; each level is
+computed from the unquantized previous level so rounding errors don't
+accumulate down the chain. Every level halves the size, rounding down, so
+for odd sizes each output texel covers one and a half input texels, which
+the filter weights account for.
+
+The kernels use AVX if the pixel conversion SIMD level is AVX2 (see
+SetPixelConversionSimdLevel), SSE2 otherwise. Both produce the same result.
+*/
+std::vector<MipLevel> GenerateMipChain (const void* data,
+	const int width, const int height, const std::size_t rowPitch,
+	const AlphaMode alphaMode, const MipFilter filter = MipFilter::Box);
+}
+
+#endif
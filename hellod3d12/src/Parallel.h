@@ -0,0 +1,44 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#ifndef ANTERU_D3D12_SAMPLE_PARALLEL_H_
+#define ANTERU_D3D12_SAMPLE_PARALLEL_H_
+
+#include "TaskScheduler.h"
+
+namespace AMD {
+///////////////////////////////////////////////////////////////////////////////
+/**
+Split [0, count) into contiguous ranges of at least minimumRangeSize items and
+call function (begin, end) for each range on the default task scheduler. The
+calling thread processes ranges as well. Blocks until all ranges are done; an
+exception thrown by any range is rethrown on the calling thread.
+*/
+template <typename Function>
+void ParallelFor (const int count, const int minimumRangeSize, Function function)
+{
+	TaskScheduler::GetDefault ().ParallelFor (count, minimumRangeSize,
+		std::function<void (int, int)> (function));
+}
+}
+
+#endif
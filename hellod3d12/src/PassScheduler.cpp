@@ -0,0 +1,459 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+
+#include "PassScheduler.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace AMD {
+namespace {
+const int COMPUTE_STATES = D3D12_RESOURCE_STATE_VERTEX_AND_CONSTANT_BUFFER
+	| D3D12_RESOURCE_STATE_UNORDERED_ACCESS
+	| D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE
+	| D3D12_RESOURCE_STATE_INDIRECT_ARGUMENT
+	| D3D12_RESOURCE_STATE_COPY_DEST
+	| D3D12_RESOURCE_STATE_COPY_SOURCE;
+
+const int READ_ONLY_STATES = D3D12_RESOURCE_STATE_VERTEX_AND_CONSTANT_BUFFER
+	| D3D12_RESOURCE_STATE_INDEX_BUFFER
+	| D3D12_RESOURCE_STATE_DEPTH_READ
+	| D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE
+	| D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE
+	| D3D12_RESOURCE_STATE_INDIRECT_ARGUMENT
+	| D3D12_RESOURCE_STATE_COPY_SOURCE;
+
+///////////////////////////////////////////////////////////////////////////////
+bool IsReadOnly (const D3D12_RESOURCE_STATES state)
+{
+	return state != D3D12_RESOURCE_STATE_COMMON && (state & ~READ_ONLY_STATES) == 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+struct TrackedResource
+{
+	D3D12_RESOURCE_STATES state;
+
+	// Scheduled passes which used the resource in its current state, and
+	// the one which put it into that state or wrote it last, if any
+	std::vector<int> users;
+	int owner = -1;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+void AddDependency (ScheduledPass& pass, const std::vector<ScheduledPass>& scheduled,
+	const int dependency)
+{
+	if (scheduled [dependency].queue == pass.queue) {
+		return;
+	}
+
+	if (std::find (pass.dependencies.begin (), pass.dependencies.end (),
+		dependency) == pass.dependencies.end ()) {
+		pass.dependencies.push_back (dependency);
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+The last user of resource, if it can transition the resource out of its
+current state at its end, -1 otherwise.
+*/
+int FindEndTransitionPass (const TrackedResource& resource,
+	const std::vector<ScheduledPass>& scheduled, const std::vector<QueueType>& queueTypes,
+	const D3D12_RESOURCE_STATES after)
+{
+	if (resource.users.empty ()) {
+		return -1;
+	}
+
+	const auto queue = scheduled [resource.users.front ()].queue;
+	for (const auto user : resource.users) {
+		if (scheduled [user].queue != queue) {
+			return -1;
+		}
+	}
+
+	if (!IsStateSupported (queueTypes [queue], resource.state) ||
+		!IsStateSupported (queueTypes [queue], after)) {
+		return -1;
+	}
+
+	return *std::max_element (resource.users.begin (), resource.users.end ());
+}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+bool IsStateSupported (const QueueType type, const D3D12_RESOURCE_STATES state)
+{
+	if (type == QueueType::Graphics) {
+		return true;
+	}
+
+	return (state & ~COMPUTE_STATES) == 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+PassSchedule SchedulePasses (const std::vector<ScheduledPassDesc>& passes,
+	const std::vector<QueueType>& queueTypes,
+	const std::vector<D3D12_RESOURCE_STATES>& initialStates)
+{
+	if (queueTypes.empty () || queueTypes.front () != QueueType::Graphics) {
+		throw std::runtime_error ("The first queue must be a graphics queue");
+	}
+
+	std::vector<int> graphicsQueues, computeQueues;
+	for (int i = 0; i < static_cast<int> (queueTypes.size ()); ++i) {
+		(queueTypes [i] == QueueType::Graphics ? graphicsQueues : computeQueues).push_back (i);
+	}
+
+	if (computeQueues.empty ()) {
+		computeQueues = graphicsQueues;
+	}
+
+	std::vector<TrackedResource> resources (initialStates.size ());
+	for (std::size_t i = 0; i < initialStates.size (); ++i) {
+		resources [i].state = initialStates [i];
+	}
+
+	std::vector<ScheduledPass> scheduled;
+
+	for (int passIndex = 0; passIndex < static_cast<int> (passes.size ()); ++passIndex) {
+		const auto& desc = passes [passIndex];
+		const auto& queues = (desc.queueType == QueueType::Graphics) ? graphicsQueues : computeQueues;
+
+		ScheduledPass pass;
+		pass.pass = passIndex;
+		pass.queue = queues [desc.queueIndex % queues.size ()];
+
+		const auto queueType = queueTypes [pass.queue];
+
+		for (const auto& use : desc.uses) {
+			if (use.resource < 0 || use.resource >= static_cast<int> (resources.size ())) {
+				throw std::runtime_error ("Pass resource out of range");
+			}
+
+			if (!IsStateSupported (queueType, use.state)) {
+				throw std::runtime_error ("Pass needs a resource state its queue doesn't support");
+			}
+		}
+
+		// Transitions the queue can't do itself and no earlier pass can
+		// take over go into an extra pass on the graphics queue, which has
+		// to come first
+		int transitionPass = -1;
+		for (const auto& use : desc.uses) {
+			const auto& resource = resources [use.resource];
+
+			const bool compatibleRead = IsReadOnly (resource.state) && IsReadOnly (use.state)
+				&& (resource.state & use.state) == use.state;
+			const bool needsTransition = !compatibleRead && resource.state != use.state;
+
+			if (needsTransition && !IsStateSupported (queueType, resource.state) &&
+				FindEndTransitionPass (resource, scheduled, queueTypes, use.state) == -1) {
+				if (transitionPass == -1) {
+					transitionPass = static_cast<int> (scheduled.size ());
+					scheduled.push_back (ScheduledPass ());
+					scheduled.back ().pass = -1;
+					scheduled.back ().queue = graphicsQueues.front ();
+				}
+			}
+		}
+
+		const int index = static_cast<int> (scheduled.size ());
+
+		for (const auto& use : desc.uses) {
+			auto& resource = resources [use.resource];
+
+			const bool compatibleRead = IsReadOnly (resource.state) && IsReadOnly (use.state)
+				&& (resource.state & use.state) == use.state;
+
+			if (compatibleRead) {
+				// Concurrent reads are fine, just wait for the transition
+				if (resource.owner != -1) {
+					AddDependency (pass, scheduled, resource.owner);
+				}
+
+				resource.users.push_back (index);
+				continue;
+			}
+
+			for (const auto user : resource.users) {
+				AddDependency (pass, scheduled, user);
+			}
+
+			// Reads only need to wait for the pass recording the transition
+			int owner = index;
+
+			ResourceTransition transition;
+			transition.resource = use.resource;
+			transition.before = resource.state;
+			transition.after = use.state;
+
+			if (resource.state == use.state) {
+				// Write after write in the same state. Across queues, the
+				// fence is enough, on the same queue we need a UAV barrier
+				if (use.state == D3D12_RESOURCE_STATE_UNORDERED_ACCESS &&
+					resource.owner != -1 && scheduled [resource.owner].queue == pass.queue) {
+					pass.beginTransitions.push_back (transition);
+				}
+			} else if (IsStateSupported (queueType, resource.state)) {
+				pass.beginTransitions.push_back (transition);
+			} else {
+				const auto endPass = FindEndTransitionPass (resource, scheduled,
+					queueTypes, use.state);
+
+				if (endPass != -1) {
+					scheduled [endPass].endTransitions.push_back (transition);
+					owner = endPass;
+				} else {
+					auto& extra = scheduled [transitionPass];
+					for (const auto user : resource.users) {
+						AddDependency (extra, scheduled, user);
+					}
+
+					extra.beginTransitions.push_back (transition);
+					AddDependency (pass, scheduled, transitionPass);
+					owner = transitionPass;
+				}
+			}
+
+			resource.state = use.state;
+			resource.users.assign (1, index);
+			resource.owner = IsReadOnly (use.state) ? owner : index;
+		}
+
+		scheduled.push_back (pass);
+	}
+
+	PassSchedule schedule;
+	schedule.passes.swap (scheduled);
+	schedule.finalStates.resize (resources.size ());
+	for (std::size_t i = 0; i < resources.size (); ++i) {
+		schedule.finalStates [i] = resources [i].state;
+	}
+
+	return schedule;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+PassScheduler::PassScheduler (ID3D12Device* device, SubmissionBatcher& batcher,
+	const std::vector<int>& queues, const std::vector<QueueType>& queueTypes,
+	const int slotCount)
+	: device_ (device)
+	, batcher_ (batcher)
+	, queues_ (queues)
+	, queueTypes_ (queueTypes)
+	, pools_ (slotCount * queues.size ())
+{
+	if (queues.size () != queueTypes.size ()) {
+		throw std::runtime_error ("Need one type per queue");
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+PassScheduler::~PassScheduler ()
+{
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int PassScheduler::AddResource (ID3D12Resource* resource,
+	const D3D12_RESOURCE_STATES state)
+{
+	resources_.push_back (resource);
+	states_.push_back (state);
+	previousUsers_.push_back (std::vector<SubmissionHandle> ());
+
+	return static_cast<int> (resources_.size ()) - 1;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+D3D12_RESOURCE_STATES PassScheduler::GetResourceState (const int resource) const
+{
+	return states_ [resource];
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void PassScheduler::AddPass (const ScheduledPassDesc& desc, RecordFunction record)
+{
+	passes_.push_back (desc);
+	recordFunctions_.push_back (std::move (record));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::vector<SubmissionHandle> PassScheduler::Execute (const int slot)
+{
+	const int queueCount = static_cast<int> (queues_.size ());
+
+	for (int i = 0; i < queueCount; ++i) {
+		auto& pool = pools_ [slot * queueCount + i];
+		if (pool.allocator) {
+			pool.allocator->Reset ();
+		}
+		pool.used = 0;
+	}
+
+	const auto schedule = SchedulePasses (passes_, queueTypes_, states_);
+
+	std::vector<SubmissionHandle> handles (schedule.passes.size ());
+	std::vector<SubmissionHandle> lastOnQueue (queueCount);
+	std::vector<D3D12_RESOURCE_BARRIER> barriers;
+
+	auto recordTransitions = [&] (ID3D12GraphicsCommandList* commandList,
+		const std::vector<ResourceTransition>& transitions) {
+		if (transitions.empty ()) {
+			return;
+		}
+
+		barriers.clear ();
+		for (const auto& transition : transitions) {
+			D3D12_RESOURCE_BARRIER barrier = {};
+			barrier.Flags = D3D12_RESOURCE_BARRIER_FLAG_NONE;
+
+			if (transition.before == transition.after) {
+				barrier.Type = D3D12_RESOURCE_BARRIER_TYPE_UAV;
+				barrier.UAV.pResource = resources_ [transition.resource].Get ();
+			} else {
+				barrier.Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION;
+				barrier.Transition.pResource = resources_ [transition.resource].Get ();
+				barrier.Transition.StateBefore = transition.before;
+				barrier.Transition.StateAfter = transition.after;
+				barrier.Transition.Subresource = D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES;
+			}
+
+			barriers.push_back (barrier);
+		}
+
+		commandList->ResourceBarrier (static_cast<UINT> (barriers.size ()), barriers.data ());
+	};
+
+	// Passes of earlier calls may still run on other queues. Passes wait for
+	// all of them which touched their resources last time, until a pass
+	// writes or transitions the resource; everything after that waits for
+	// that pass already. This is more than needed for concurrent reads, but
+	// keeps it simple
+	std::vector<std::vector<SubmissionHandle>> users (resources_.size ());
+	std::vector<bool> acquired (resources_.size (), false);
+
+	for (std::size_t i = 0; i < schedule.passes.size (); ++i) {
+		const auto& pass = schedule.passes [i];
+		auto commandList = GetCommandList (slot, pass.queue);
+
+		std::vector<SubmissionHandle> dependencies;
+		for (const auto dependency : pass.dependencies) {
+			dependencies.push_back (handles [dependency]);
+		}
+
+		std::vector<int> touched, exclusive;
+		for (const auto& transition : pass.beginTransitions) {
+			exclusive.push_back (transition.resource);
+		}
+		for (const auto& transition : pass.endTransitions) {
+			exclusive.push_back (transition.resource);
+		}
+		if (pass.pass != -1) {
+			for (const auto& use : passes_ [pass.pass].uses) {
+				(IsReadOnly (use.state) ? touched : exclusive).push_back (use.resource);
+			}
+		}
+
+		touched.insert (touched.end (), exclusive.begin (), exclusive.end ());
+		std::sort (touched.begin (), touched.end ());
+		touched.erase (std::unique (touched.begin (), touched.end ()), touched.end ());
+
+		for (const auto resource : touched) {
+			if (!acquired [resource]) {
+				dependencies.insert (dependencies.end (),
+					previousUsers_ [resource].begin (), previousUsers_ [resource].end ());
+			}
+		}
+
+		for (const auto resource : exclusive) {
+			acquired [resource] = true;
+		}
+
+		recordTransitions (commandList, pass.beginTransitions);
+		if (pass.pass != -1) {
+			recordFunctions_ [pass.pass] (commandList);
+		}
+		recordTransitions (commandList, pass.endTransitions);
+
+		commandList->Close ();
+
+		handles [i] = batcher_.Submit (queues_ [pass.queue], commandList, dependencies);
+		lastOnQueue [pass.queue] = handles [i];
+
+		for (const auto resource : touched) {
+			users [resource].push_back (handles [i]);
+		}
+	}
+
+	for (std::size_t i = 0; i < users.size (); ++i) {
+		if (!users [i].empty ()) {
+			previousUsers_ [i].swap (users [i]);
+		}
+	}
+
+	states_ = schedule.finalStates;
+	passes_.clear ();
+	recordFunctions_.clear ();
+
+	std::vector<SubmissionHandle> result;
+	for (const auto& handle : lastOnQueue) {
+		if (handle.queue != -1) {
+			result.push_back (handle);
+		}
+	}
+
+	return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+ID3D12GraphicsCommandList* PassScheduler::GetCommandList (const int slot, const int queue)
+{
+	auto& pool = pools_ [slot * queues_.size () + queue];
+	const auto type = (queueTypes_ [queue] == QueueType::Graphics)
+		? D3D12_COMMAND_LIST_TYPE_DIRECT : D3D12_COMMAND_LIST_TYPE_COMPUTE;
+
+	if (!pool.allocator) {
+		if (FAILED (device_->CreateCommandAllocator (type, IID_PPV_ARGS (&pool.allocator)))) {
+			throw std::runtime_error ("Could not create pass command allocator");
+		}
+	}
+
+	if (pool.used == static_cast<int> (pool.commandLists.size ())) {
+		Microsoft::WRL::ComPtr<ID3D12GraphicsCommandList> commandList;
+		if (FAILED (device_->CreateCommandList (0, type, pool.allocator.Get (),
+			nullptr, IID_PPV_ARGS (&commandList)))) {
+			throw std::runtime_error ("Could not create pass command list");
+		}
+
+		pool.commandLists.push_back (commandList);
+		return pool.commandLists [pool.used++].Get ();
+	}
+
+	auto commandList = pool.commandLists [pool.used++].Get ();
+	commandList->Reset (pool.allocator.Get (), nullptr);
+	return commandList;
+}
+}
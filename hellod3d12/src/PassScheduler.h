@@ -0,0 +1,224 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+
+#ifndef ANTERU_D3D12_SAMPLE_PASSSCHEDULER_H_
+#define ANTERU_D3D12_SAMPLE_PASSSCHEDULER_H_
+
+#include "SubmissionBatcher.h"
+
+#include <d3d12.h>
+#include <wrl.h>
+#include <functional>
+#include <vector>
+
+namespace AMD {
+///////////////////////////////////////////////////////////////////////////////
+enum class QueueType
+{
+	Graphics,
+	Compute
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Whether a queue of type can transition resources from or into state.
+Compute queues don't support graphics-only states like RENDER_TARGET or
+PIXEL_SHADER_RESOURCE.
+*/
+bool IsStateSupported (const QueueType type, const D3D12_RESOURCE_STATES state);
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+A resource a pass accesses, and the state it needs the resource in.
+*/
+struct PassResourceUse
+{
+	int resource;
+	D3D12_RESOURCE_STATES state;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+struct ScheduledPassDesc
+{
+	/**
+	The type of queue the pass should run on. Compute passes run on the
+	graphics queue if there is no compute queue.
+	*/
+	QueueType queueType = QueueType::Graphics;
+
+	/**
+	Which of the queues of that type, modulo their number.
+	*/
+	int queueIndex = 0;
+
+	std::vector<PassResourceUse> uses;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+A transition of a resource. If before and after are both UNORDERED_ACCESS,
+this is a UAV barrier.
+*/
+struct ResourceTransition
+{
+	int resource;
+	D3D12_RESOURCE_STATES before;
+	D3D12_RESOURCE_STATES after;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+struct ScheduledPass
+{
+	/**
+	Index of the pass description, or -1 if this is an extra pass which
+	only transitions resources the queue of the next pass can't.
+	*/
+	int pass;
+
+	int queue;
+
+	/**
+	Earlier scheduled passes on other queues which must finish first.
+	*/
+	std::vector<int> dependencies;
+
+	/**
+	Recorded before and after the pass.
+	*/
+	std::vector<ResourceTransition> beginTransitions;
+	std::vector<ResourceTransition> endTransitions;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+struct PassSchedule
+{
+	/**
+	In submission order.
+	*/
+	std::vector<ScheduledPass> passes;
+
+	/**
+	The state of each resource after all passes.
+	*/
+	std::vector<D3D12_RESOURCE_STATES> finalStates;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Assign passes to queues and work out the transitions and cross-queue
+dependencies between them, without touching the GPU.
+
+queueTypes is the type of each queue; the first one must be a graphics
+queue. Passes keep their order on each queue.
+
+A pass depends on every pass on another queue which used one of its
+resources, if it writes the resource or needs a different state. Reads in
+the same state run concurrently. Transitions are recorded by the pass which
+needs the new state. If its queue can't transition from the current state,
+the last pass using the resource records it at its end, provided it is on a
+queue which can and no other queue uses the resource in that state;
+otherwise an extra pass on the first graphics queue does.
+
+Throws if a pass needs a state its queue doesn't support.
+*/
+PassSchedule SchedulePasses (const std::vector<ScheduledPassDesc>& passes,
+	const std::vector<QueueType>& queueTypes,
+	const std::vector<D3D12_RESOURCE_STATES>& initialStates);
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Runs passes on graphics and compute queues, so compute work overlaps
+graphics work. Passes are recorded into command lists of their own and
+handed to a SubmissionBatcher, which merges them into as few submissions as
+possible and inserts the fence waits.
+
+Command lists are kept per queue slot, like the frame's command list, and
+reused once Execute is called for the same slot again.
+*/
+class PassScheduler
+{
+public:
+	typedef std::function<void (ID3D12GraphicsCommandList*)> RecordFunction;
+
+	PassScheduler (const PassScheduler&) = delete;
+	PassScheduler& operator= (const PassScheduler&) = delete;
+
+	/**
+	queues are indices of queues in batcher, queueTypes their types.
+	*/
+	PassScheduler (ID3D12Device* device, SubmissionBatcher& batcher,
+		const std::vector<int>& queues, const std::vector<QueueType>& queueTypes,
+		const int slotCount);
+
+	~PassScheduler ();
+
+	int AddResource (ID3D12Resource* resource, const D3D12_RESOURCE_STATES state);
+
+	D3D12_RESOURCE_STATES GetResourceState (const int resource) const;
+
+	void AddPass (const ScheduledPassDesc& desc, RecordFunction record);
+
+	/**
+	Schedule, record and submit the passes added since the last call.
+	Returns the handles of the last pass on each queue which got one, so
+	later submissions can depend on all of them.
+
+	The commands previously submitted for slot must have finished.
+	*/
+	std::vector<SubmissionHandle> Execute (const int slot);
+
+private:
+	/**
+	Command lists for one queue and slot, all sharing one allocator as they
+	are recorded one after the other.
+	*/
+	struct CommandListPool
+	{
+		Microsoft::WRL::ComPtr<ID3D12CommandAllocator> allocator;
+		std::vector<Microsoft::WRL::ComPtr<ID3D12GraphicsCommandList>> commandLists;
+		int used = 0;
+	};
+
+	ID3D12GraphicsCommandList* GetCommandList (const int slot, const int queue);
+
+	Microsoft::WRL::ComPtr<ID3D12Device> device_;
+	SubmissionBatcher& batcher_;
+	const std::vector<int> queues_;
+	const std::vector<QueueType> queueTypes_;
+
+	std::vector<Microsoft::WRL::ComPtr<ID3D12Resource>> resources_;
+	std::vector<D3D12_RESOURCE_STATES> states_;
+
+	// The submissions which touched each resource in the last Execute which
+	// used it
+	std::vector<std::vector<SubmissionHandle>> previousUsers_;
+
+	std::vector<ScheduledPassDesc> passes_;
+	std::vector<RecordFunction> recordFunctions_;
+
+	// [slot * queueCount + queue]
+	std::vector<CommandListPool> pools_;
+};
+}
+
+#endif
@@ -0,0 +1,751 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#include "PixelConversion.h"
+
+#include <atomic>
+#include <cmath>
+#include <cstring>
+#include <stdexcept>
+#include <immintrin.h>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+// MSVC allows AVX2 intrinsics in any function, no target attributes needed
+#define AMD_TARGET_SSSE3
+#define AMD_TARGET_AVX2
+#else
+#include <cpuid.h>
+#define AMD_TARGET_SSSE3 __attribute__ ((target ("ssse3")))
+#define AMD_TARGET_AVX2 __attribute__ ((target ("avx2,f16c")))
+#endif
+
+namespace AMD {
+namespace {
+///////////////////////////////////////////////////////////////////////////////
+void CpuId (const int leaf, int* info)
+{
+#ifdef _MSC_VER
+	__cpuidex (info, leaf, 0);
+#else
+	unsigned int a, b, c, d;
+	__cpuid_count (leaf, 0, a, b, c, d);
+	info [0] = static_cast<int> (a);
+	info [1] = static_cast<int> (b);
+	info [2] = static_cast<int> (c);
+	info [3] = static_cast<int> (d);
+#endif
+}
+
+std::uint64_t GetEnabledXStateFeatures ()
+{
+#ifdef _MSC_VER
+	return _xgetbv (0);
+#else
+	unsigned int eax, edx;
+	__asm__ ("xgetbv" : "=a" (eax), "=d" (edx) : "c" (0));
+	return (static_cast<std::uint64_t> (edx) << 32) | eax;
+#endif
+}
+
+SimdLevel DetectSimdLevel ()
+{
+	int info [4];
+	CpuId (0, info);
+	const int maximumLeaf = info [0];
+
+	CpuId (1, info);
+	const bool sse2 = (info [3] & (1 << 26)) != 0;
+	const bool ssse3 = (info [2] & (1 << 9)) != 0;
+	const bool osxsave = (info [2] & (1 << 27)) != 0;
+	const bool avx = (info [2] & (1 << 28)) != 0;
+	const bool f16c = (info [2] & (1 << 29)) != 0;
+
+	if (!sse2 || !ssse3) {
+		return SimdLevel::Scalar;
+	}
+
+	// The OS must save the YMM registers, otherwise AVX is not usable
+	if (!osxsave || !avx || !f16c || maximumLeaf < 7 ||
+		(GetEnabledXStateFeatures () & 6) != 6) {
+		return SimdLevel::SSSE3;
+	}
+
+	CpuId (7, info);
+	const bool avx2 = (info [1] & (1 << 5)) != 0;
+
+	return avx2 ? SimdLevel::AVX2 : SimdLevel::SSSE3;
+}
+
+std::atomic<int> selectedSimdLevel (-1);
+
+SimdLevel GetSelectedSimdLevel ()
+{
+	const int level = selectedSimdLevel.load (std::memory_order_relaxed);
+	if (level >= 0) {
+		return static_cast<SimdLevel> (level);
+	}
+
+	return GetMaximumSimdLevel ();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Lookup tables for sRGB <-> linear.
+
+srgbToLinear has 512 entries: the sRGB curve for 0..255, followed by plain
+i / 255 for alpha. This way, all four channels can be looked up with a
+single gather by offsetting the alpha index.
+
+linearToSrgb quantizes the linear value to 12 bits, which is enough to hit
+the correct 8 bit sRGB value for all inputs. It is followed by 256 identity
+entries used for alpha, for the same reason as above.
+*/
+struct SrgbTables
+{
+	static const int LINEAR_TO_SRGB_SIZE = 4096;
+
+	float srgbToLinear [512];
+	std::int32_t linearToSrgb [LINEAR_TO_SRGB_SIZE + 256];
+
+	SrgbTables ()
+	{
+		for (int i = 0; i < 256; ++i) {
+			const float c = i / 255.0f;
+			srgbToLinear [i] = (c <= 0.04045f)
+				? c / 12.92f
+				: std::pow ((c + 0.055f) / 1.055f, 2.4f);
+			srgbToLinear [256 + i] = c;
+		}
+
+		for (int i = 0; i < LINEAR_TO_SRGB_SIZE; ++i) {
+			const float c = i / static_cast<float> (LINEAR_TO_SRGB_SIZE - 1);
+			const float s = (c <= 0.0031308f)
+				? c * 12.92f
+				: 1.055f * std::pow (c, 1 / 2.4f) - 0.055f;
+			linearToSrgb [i] = static_cast<std::int32_t> (s * 255.0f + 0.5f);
+		}
+
+		for (int i = 0; i < 256; ++i) {
+			linearToSrgb [LINEAR_TO_SRGB_SIZE + i] = i;
+		}
+	}
+};
+
+const SrgbTables& GetSrgbTables ()
+{
+	static const SrgbTables tables;
+	return tables;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Scalar reference implementations
+namespace Scalar {
+void ConvertRgbToRgba (const std::uint8_t* input, std::uint8_t* output,
+	const std::size_t pixelCount)
+{
+	for (std::size_t i = 0; i < pixelCount; ++i) {
+		output [i * 4 + 0] = input [i * 3 + 0];
+		output [i * 4 + 1] = input [i * 3 + 1];
+		output [i * 4 + 2] = input [i * 3 + 2];
+		output [i * 4 + 3] = 255;
+	}
+}
+
+void ConvertSrgbToLinear (const std::uint8_t* input, float* output,
+	const std::size_t pixelCount)
+{
+	const auto& tables = GetSrgbTables ();
+
+	for (std::size_t i = 0; i < pixelCount * 4; i += 4) {
+		output [i + 0] = tables.srgbToLinear [input [i + 0]];
+		output [i + 1] = tables.srgbToLinear [input [i + 1]];
+		output [i + 2] = tables.srgbToLinear [input [i + 2]];
+		output [i + 3] = tables.srgbToLinear [256 + input [i + 3]];
+	}
+}
+
+int Quantize (const float value, const int maximum)
+{
+	// NaN fails both comparisons and ends up as zero, like in the SIMD
+	// kernels
+	const float clamped = (value > 0) ? ((value < 1) ? value : 1) : 0;
+	return static_cast<int> (clamped * maximum + 0.5f);
+}
+
+void ConvertLinearToSrgb (const float* input, std::uint8_t* output,
+	const std::size_t pixelCount)
+{
+	const auto& tables = GetSrgbTables ();
+	const int maximum = SrgbTables::LINEAR_TO_SRGB_SIZE - 1;
+
+	for (std::size_t i = 0; i < pixelCount * 4; i += 4) {
+		for (int c = 0; c < 3; ++c) {
+			output [i + c] = static_cast<std::uint8_t> (
+				tables.linearToSrgb [Quantize (input [i + c], maximum)]);
+		}
+		output [i + 3] = static_cast<std::uint8_t> (Quantize (input [i + 3], 255));
+	}
+}
+
+void PremultiplyAlpha (std::uint8_t* pixels, const std::size_t pixelCount)
+{
+	for (std::size_t i = 0; i < pixelCount * 4; i += 4) {
+		const int a = pixels [i + 3];
+		for (int c = 0; c < 3; ++c) {
+			// Exact rounding division by 255
+			const int x = pixels [i + c] * a + 128;
+			pixels [i + c] = static_cast<std::uint8_t> ((x + (x >> 8)) >> 8);
+		}
+	}
+}
+
+std::uint16_t FloatToHalf (const float value)
+{
+	std::uint32_t bits;
+	std::memcpy (&bits, &value, sizeof (bits));
+
+	const std::uint32_t sign = (bits >> 16) & 0x8000;
+	const int exponent = static_cast<int> ((bits >> 23) & 0xFF) - 127 + 15;
+	std::uint32_t mantissa = bits & 0x7FFFFF;
+
+	if (exponent <= 0) {
+		// Denormal or zero, round to nearest even
+		if (exponent < -10) {
+			return static_cast<std::uint16_t> (sign);
+		}
+		mantissa |= 0x800000;
+		const int shift = 14 - exponent;
+		const std::uint32_t halfMantissa = mantissa >> shift;
+		const std::uint32_t remainder = mantissa & ((1u << shift) - 1);
+		const std::uint32_t halfway = 1u << (shift - 1);
+		const std::uint32_t rounded = halfMantissa +
+			((remainder > halfway || (remainder == halfway && (halfMantissa & 1))) ? 1 : 0);
+		return static_cast<std::uint16_t> (sign | rounded);
+	} else if (exponent >= 31) {
+		// Overflow to infinity, keep NaN a NaN
+		const bool isNan = ((bits >> 23) & 0xFF) == 0xFF && mantissa != 0;
+		return static_cast<std::uint16_t> (sign | 0x7C00 | (isNan ? 0x200 : 0));
+	}
+
+	std::uint32_t result = sign | (exponent << 10) | (mantissa >> 13);
+	const std::uint32_t remainder = mantissa & 0x1FFF;
+	if (remainder > 0x1000 || (remainder == 0x1000 && (result & 1))) {
+		// May carry into the exponent, which is the correct result
+		++result;
+	}
+
+	return static_cast<std::uint16_t> (result);
+}
+
+float HalfToFloat (const std::uint16_t value)
+{
+	const std::uint32_t sign = (value & 0x8000u) << 16;
+	std::uint32_t exponent = (value >> 10) & 0x1F;
+	std::uint32_t mantissa = value & 0x3FF;
+
+	std::uint32_t bits;
+	if (exponent == 0) {
+		if (mantissa == 0) {
+			bits = sign;
+		} else {
+			// Denormal, normalize it
+			exponent = 127 - 15 + 1;
+			while ((mantissa & 0x400) == 0) {
+				mantissa <<= 1;
+				--exponent;
+			}
+			bits = sign | (exponent << 23) | ((mantissa & 0x3FF) << 13);
+		}
+	} else if (exponent == 31) {
+		bits = sign | 0x7F800000 | (mantissa << 13);
+	} else {
+		bits = sign | ((exponent - 15 + 127) << 23) | (mantissa << 13);
+	}
+
+	float result;
+	std::memcpy (&result, &bits, sizeof (result));
+	return result;
+}
+
+/**
+There are only 256 inputs, so they get converted once up front.
+*/
+struct UnormToHalfTable
+{
+	std::uint16_t values [256];
+
+	UnormToHalfTable ()
+	{
+		for (int i = 0; i < 256; ++i) {
+			values [i] = FloatToHalf (i * (1.0f / 255.0f));
+		}
+	}
+};
+
+void ConvertUnormToHalf (const std::uint8_t* input, std::uint16_t* output,
+	const std::size_t componentCount)
+{
+	static const UnormToHalfTable table;
+
+	for (std::size_t i = 0; i < componentCount; ++i) {
+		output [i] = table.values [input [i]];
+	}
+}
+
+void ConvertHalfToUnorm (const std::uint16_t* input, std::uint8_t* output,
+	const std::size_t componentCount)
+{
+	for (std::size_t i = 0; i < componentCount; ++i) {
+		// NaN fails both comparisons and ends up as zero
+		const float value = HalfToFloat (input [i]);
+		const float clamped = (value > 0) ? ((value < 1) ? value : 1) : 0;
+		output [i] = static_cast<std::uint8_t> (clamped * 255.0f + 0.5f);
+	}
+}
+
+void ExtractChannels (const std::uint8_t* input, std::uint8_t* output,
+	const std::size_t pixelCount, const int channelCount)
+{
+	for (std::size_t i = 0; i < pixelCount; ++i) {
+		for (int c = 0; c < channelCount; ++c) {
+			output [i * channelCount + c] = input [i * 4 + c];
+		}
+	}
+}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// SSE2/SSSE3 kernels. Each processes as many pixels as possible and
+// returns how many were converted, the caller finishes the rest with the
+// scalar code.
+namespace SSSE3 {
+AMD_TARGET_SSSE3
+std::size_t ConvertRgbToRgba (const std::uint8_t* input, std::uint8_t* output,
+	const std::size_t pixelCount)
+{
+	const __m128i shuffle = _mm_setr_epi8 (
+		0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1);
+	const __m128i alpha = _mm_set1_epi32 (static_cast<int> (0xFF000000));
+
+	// 16 byte loads, so 4 bytes past the 4 pixels we convert must be readable
+	std::size_t i = 0;
+	for (; i + 6 <= pixelCount; i += 4) {
+		const __m128i rgb = _mm_loadu_si128 (reinterpret_cast<const __m128i*> (input + i * 3));
+		_mm_storeu_si128 (reinterpret_cast<__m128i*> (output + i * 4),
+			_mm_or_si128 (_mm_shuffle_epi8 (rgb, shuffle), alpha));
+	}
+
+	return i;
+}
+
+std::size_t ConvertLinearToSrgb (const float* input, std::uint8_t* output,
+	const std::size_t pixelCount)
+{
+	const auto& tables = GetSrgbTables ();
+
+	const __m128 zero = _mm_setzero_ps ();
+	const __m128 one = _mm_set1_ps (1.0f);
+	const __m128 scale = _mm_setr_ps (
+		SrgbTables::LINEAR_TO_SRGB_SIZE - 1, SrgbTables::LINEAR_TO_SRGB_SIZE - 1,
+		SrgbTables::LINEAR_TO_SRGB_SIZE - 1, 255.0f);
+	const __m128 half = _mm_set1_ps (0.5f);
+
+	for (std::size_t i = 0; i < pixelCount; ++i) {
+		__m128 v = _mm_loadu_ps (input + i * 4);
+		v = _mm_min_ps (_mm_max_ps (v, zero), one);
+
+		std::int32_t indices [4];
+		_mm_storeu_si128 (reinterpret_cast<__m128i*> (indices),
+			_mm_cvttps_epi32 (_mm_add_ps (_mm_mul_ps (v, scale), half)));
+
+		output [i * 4 + 0] = static_cast<std::uint8_t> (tables.linearToSrgb [indices [0]]);
+		output [i * 4 + 1] = static_cast<std::uint8_t> (tables.linearToSrgb [indices [1]]);
+		output [i * 4 + 2] = static_cast<std::uint8_t> (tables.linearToSrgb [indices [2]]);
+		output [i * 4 + 3] = static_cast<std::uint8_t> (indices [3]);
+	}
+
+	return pixelCount;
+}
+
+/**
+Multiply 8 pixels worth of 16 bit color with alpha, with exact rounding.
+*/
+AMD_TARGET_SSSE3
+__m128i MultiplyAlpha16 (const __m128i color, const __m128i alphaShuffle,
+	const __m128i alphaLanes)
+{
+	const __m128i alpha = _mm_shuffle_epi8 (color, alphaShuffle);
+	__m128i x = _mm_add_epi16 (_mm_mullo_epi16 (color, alpha), _mm_set1_epi16 (128));
+	x = _mm_srli_epi16 (_mm_add_epi16 (x, _mm_srli_epi16 (x, 8)), 8);
+	// Keep alpha itself unchanged
+	return _mm_or_si128 (_mm_andnot_si128 (alphaLanes, x), _mm_and_si128 (alphaLanes, color));
+}
+
+AMD_TARGET_SSSE3
+std::size_t PremultiplyAlpha (std::uint8_t* pixels, const std::size_t pixelCount)
+{
+	const __m128i zero = _mm_setzero_si128 ();
+	// Broadcast the alpha word of each pixel to its four words
+	const __m128i alphaShuffle = _mm_setr_epi8 (
+		6, 7, 6, 7, 6, 7, 6, 7, 14, 15, 14, 15, 14, 15, 14, 15);
+	const __m128i alphaLanes = _mm_setr_epi16 (0, 0, 0, -1, 0, 0, 0, -1);
+
+	std::size_t i = 0;
+	for (; i + 4 <= pixelCount; i += 4) {
+		const __m128i v = _mm_loadu_si128 (reinterpret_cast<const __m128i*> (pixels + i * 4));
+		const __m128i lo = MultiplyAlpha16 (_mm_unpacklo_epi8 (v, zero), alphaShuffle, alphaLanes);
+		const __m128i hi = MultiplyAlpha16 (_mm_unpackhi_epi8 (v, zero), alphaShuffle, alphaLanes);
+		_mm_storeu_si128 (reinterpret_cast<__m128i*> (pixels + i * 4), _mm_packus_epi16 (lo, hi));
+	}
+
+	return i;
+}
+
+AMD_TARGET_SSSE3
+std::size_t ExtractChannels (const std::uint8_t* input, std::uint8_t* output,
+	const std::size_t pixelCount, const int channelCount)
+{
+	const __m128i shuffle = (channelCount == 1)
+		? _mm_setr_epi8 (0, 4, 8, 12, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1)
+		: _mm_setr_epi8 (0, 1, 4, 5, 8, 9, 12, 13, -1, -1, -1, -1, -1, -1, -1, -1);
+
+	// Four pixels per iteration, store only the bytes we produced
+	std::size_t i = 0;
+	for (; i + 4 <= pixelCount; i += 4) {
+		const __m128i v = _mm_shuffle_epi8 (
+			_mm_loadu_si128 (reinterpret_cast<const __m128i*> (input + i * 4)), shuffle);
+
+		if (channelCount == 1) {
+			const int packed = _mm_cvtsi128_si32 (v);
+			std::memcpy (output + i, &packed, 4);
+		} else {
+			_mm_storel_epi64 (reinterpret_cast<__m128i*> (output + i * 2), v);
+		}
+	}
+
+	return i;
+}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// AVX2 + F16C kernels, same conventions as above
+namespace AVX2 {
+AMD_TARGET_AVX2
+std::size_t ConvertRgbToRgba (const std::uint8_t* input, std::uint8_t* output,
+	const std::size_t pixelCount)
+{
+	const __m256i shuffle = _mm256_setr_epi8 (
+		0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1,
+		0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1);
+	const __m256i alpha = _mm256_set1_epi32 (static_cast<int> (0xFF000000));
+
+	// Two 16 byte loads at 0 and 12 bytes, so 28 bytes must be readable
+	std::size_t i = 0;
+	for (; i + 10 <= pixelCount; i += 8) {
+		const __m128i lo = _mm_loadu_si128 (reinterpret_cast<const __m128i*> (input + i * 3));
+		const __m128i hi = _mm_loadu_si128 (reinterpret_cast<const __m128i*> (input + i * 3 + 12));
+		const __m256i rgb = _mm256_inserti128_si256 (_mm256_castsi128_si256 (lo), hi, 1);
+
+		_mm256_storeu_si256 (reinterpret_cast<__m256i*> (output + i * 4),
+			_mm256_or_si256 (_mm256_shuffle_epi8 (rgb, shuffle), alpha));
+	}
+
+	return i;
+}
+
+AMD_TARGET_AVX2
+std::size_t ConvertSrgbToLinear (const std::uint8_t* input, float* output,
+	const std::size_t pixelCount)
+{
+	const auto& tables = GetSrgbTables ();
+	// Alpha is looked up in the second half of the table
+	const __m256i alphaOffset = _mm256_setr_epi32 (0, 0, 0, 256, 0, 0, 0, 256);
+
+	std::size_t i = 0;
+	for (; i + 2 <= pixelCount; i += 2) {
+		const __m256i indices = _mm256_add_epi32 (alphaOffset, _mm256_cvtepu8_epi32 (
+			_mm_loadl_epi64 (reinterpret_cast<const __m128i*> (input + i * 4))));
+
+		_mm256_storeu_ps (output + i * 4,
+			_mm256_i32gather_ps (tables.srgbToLinear, indices, 4));
+	}
+
+	return i;
+}
+
+AMD_TARGET_AVX2
+std::size_t ConvertLinearToSrgb (const float* input, std::uint8_t* output,
+	const std::size_t pixelCount)
+{
+	const auto& tables = GetSrgbTables ();
+
+	const __m256 zero = _mm256_setzero_ps ();
+	const __m256 one = _mm256_set1_ps (1.0f);
+	const float colorScale = SrgbTables::LINEAR_TO_SRGB_SIZE - 1;
+	const __m256 scale = _mm256_setr_ps (
+		colorScale, colorScale, colorScale, 255.0f,
+		colorScale, colorScale, colorScale, 255.0f);
+	const __m256 half = _mm256_set1_ps (0.5f);
+	// Alpha uses the identity entries at the end of the table
+	const __m256i alphaOffset = _mm256_setr_epi32 (
+		0, 0, 0, SrgbTables::LINEAR_TO_SRGB_SIZE,
+		0, 0, 0, SrgbTables::LINEAR_TO_SRGB_SIZE);
+
+	std::size_t i = 0;
+	for (; i + 2 <= pixelCount; i += 2) {
+		__m256 v = _mm256_loadu_ps (input + i * 4);
+		v = _mm256_min_ps (_mm256_max_ps (v, zero), one);
+
+		const __m256i indices = _mm256_add_epi32 (alphaOffset,
+			_mm256_cvttps_epi32 (_mm256_add_ps (_mm256_mul_ps (v, scale), half)));
+		const __m256i values = _mm256_i32gather_epi32 (tables.linearToSrgb, indices, 4);
+
+		// 8 x 32 bit -> 8 x 8 bit, all values are in 0..255 already
+		const __m128i words = _mm_packs_epi32 (_mm256_castsi256_si128 (values),
+			_mm256_extracti128_si256 (values, 1));
+		_mm_storel_epi64 (reinterpret_cast<__m128i*> (output + i * 4),
+			_mm_packus_epi16 (words, words));
+	}
+
+	return i;
+}
+
+AMD_TARGET_AVX2
+std::size_t PremultiplyAlpha (std::uint8_t* pixels, const std::size_t pixelCount)
+{
+	const __m256i alphaShuffle = _mm256_setr_epi8 (
+		6, 7, 6, 7, 6, 7, 6, 7, 14, 15, 14, 15, 14, 15, 14, 15,
+		6, 7, 6, 7, 6, 7, 6, 7, 14, 15, 14, 15, 14, 15, 14, 15);
+	const __m256i alphaLanes = _mm256_setr_epi16 (
+		0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, -1);
+	const __m256i bias = _mm256_set1_epi16 (128);
+
+	std::size_t i = 0;
+	for (; i + 4 <= pixelCount; i += 4) {
+		const __m256i color = _mm256_cvtepu8_epi16 (
+			_mm_loadu_si128 (reinterpret_cast<const __m128i*> (pixels + i * 4)));
+		const __m256i alpha = _mm256_shuffle_epi8 (color, alphaShuffle);
+
+		__m256i x = _mm256_add_epi16 (_mm256_mullo_epi16 (color, alpha), bias);
+		x = _mm256_srli_epi16 (_mm256_add_epi16 (x, _mm256_srli_epi16 (x, 8)), 8);
+		x = _mm256_or_si256 (_mm256_andnot_si256 (alphaLanes, x),
+			_mm256_and_si256 (alphaLanes, color));
+
+		_mm_storeu_si128 (reinterpret_cast<__m128i*> (pixels + i * 4),
+			_mm_packus_epi16 (_mm256_castsi256_si128 (x), _mm256_extracti128_si256 (x, 1)));
+	}
+
+	return i;
+}
+
+AMD_TARGET_AVX2
+std::size_t ConvertUnormToHalf (const std::uint8_t* input, std::uint16_t* output,
+	const std::size_t componentCount)
+{
+	const __m256 scale = _mm256_set1_ps (1.0f / 255.0f);
+
+	std::size_t i = 0;
+	for (; i + 8 <= componentCount; i += 8) {
+		const __m256 v = _mm256_mul_ps (scale, _mm256_cvtepi32_ps (_mm256_cvtepu8_epi32 (
+			_mm_loadl_epi64 (reinterpret_cast<const __m128i*> (input + i)))));
+
+		_mm_storeu_si128 (reinterpret_cast<__m128i*> (output + i),
+			_mm256_cvtps_ph (v, _MM_FROUND_TO_NEAREST_INT));
+	}
+
+	return i;
+}
+
+AMD_TARGET_AVX2
+std::size_t ConvertHalfToUnorm (const std::uint16_t* input, std::uint8_t* output,
+	const std::size_t componentCount)
+{
+	const __m256 zero = _mm256_setzero_ps ();
+	const __m256 one = _mm256_set1_ps (1.0f);
+	const __m256 scale = _mm256_set1_ps (255.0f);
+	const __m256 half = _mm256_set1_ps (0.5f);
+
+	std::size_t i = 0;
+	for (; i + 8 <= componentCount; i += 8) {
+		__m256 v = _mm256_cvtph_ps (
+			_mm_loadu_si128 (reinterpret_cast<const __m128i*> (input + i)));
+		// max/min return the second operand for NaN, so NaN becomes zero
+		v = _mm256_min_ps (_mm256_max_ps (v, zero), one);
+
+		const __m256i values = _mm256_cvttps_epi32 (_mm256_add_ps (_mm256_mul_ps (v, scale), half));
+		const __m128i words = _mm_packs_epi32 (_mm256_castsi256_si128 (values),
+			_mm256_extracti128_si256 (values, 1));
+		_mm_storel_epi64 (reinterpret_cast<__m128i*> (output + i),
+			_mm_packus_epi16 (words, words));
+	}
+
+	return i;
+}
+}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+SimdLevel GetMaximumSimdLevel ()
+{
+	static const SimdLevel level = DetectSimdLevel ();
+	return level;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void SetPixelConversionSimdLevel (const SimdLevel level)
+{
+	const auto maximum = GetMaximumSimdLevel ();
+	selectedSimdLevel = static_cast<int> ((level < maximum) ? level : maximum);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+SimdLevel GetPixelConversionSimdLevel ()
+{
+	return GetSelectedSimdLevel ();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void ConvertRgbToRgba (const std::uint8_t* input, std::uint8_t* output,
+	const std::size_t pixelCount)
+{
+	std::size_t done = 0;
+
+	switch (GetSelectedSimdLevel ()) {
+	case SimdLevel::AVX2: done = AVX2::ConvertRgbToRgba (input, output, pixelCount); break;
+	case SimdLevel::SSSE3: done = SSSE3::ConvertRgbToRgba (input, output, pixelCount); break;
+	case SimdLevel::Scalar: break;
+	}
+
+	Scalar::ConvertRgbToRgba (input + done * 3, output + done * 4, pixelCount - done);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void ConvertSrgbToLinear (const std::uint8_t* input, float* output,
+	const std::size_t pixelCount)
+{
+	std::size_t done = 0;
+
+	// Without a gather instruction, the scalar lookup is as fast as it gets
+	if (GetSelectedSimdLevel () == SimdLevel::AVX2) {
+		done = AVX2::ConvertSrgbToLinear (input, output, pixelCount);
+	}
+
+	Scalar::ConvertSrgbToLinear (input + done * 4, output + done * 4, pixelCount - done);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void ConvertLinearToSrgb (const float* input, std::uint8_t* output,
+	const std::size_t pixelCount)
+{
+	std::size_t done = 0;
+
+	switch (GetSelectedSimdLevel ()) {
+	case SimdLevel::AVX2: done = AVX2::ConvertLinearToSrgb (input, output, pixelCount); break;
+	case SimdLevel::SSSE3: done = SSSE3::ConvertLinearToSrgb (input, output, pixelCount); break;
+	case SimdLevel::Scalar: break;
+	}
+
+	Scalar::ConvertLinearToSrgb (input + done * 4, output + done * 4, pixelCount - done);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void PremultiplyAlpha (std::uint8_t* pixels, const std::size_t pixelCount)
+{
+	std::size_t done = 0;
+
+	switch (GetSelectedSimdLevel ()) {
+	case SimdLevel::AVX2: done = AVX2::PremultiplyAlpha (pixels, pixelCount); break;
+	case SimdLevel::SSSE3: done = SSSE3::PremultiplyAlpha (pixels, pixelCount); break;
+	case SimdLevel::Scalar: break;
+	}
+
+	Scalar::PremultiplyAlpha (pixels + done * 4, pixelCount - done);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void PremultiplyAlphaSrgb (std::uint8_t* pixels, const std::size_t pixelCount)
+{
+	// Go through linear in small batches so the temporary stays in L1
+	static const std::size_t batchSize = 256;
+	float linear [batchSize * 4];
+
+	for (std::size_t i = 0; i < pixelCount; i += batchSize) {
+		const auto count = (pixelCount - i < batchSize) ? pixelCount - i : batchSize;
+
+		ConvertSrgbToLinear (pixels + i * 4, linear, count);
+
+		for (std::size_t j = 0; j < count; ++j) {
+			const float a = linear [j * 4 + 3];
+			linear [j * 4 + 0] *= a;
+			linear [j * 4 + 1] *= a;
+			linear [j * 4 + 2] *= a;
+		}
+
+		ConvertLinearToSrgb (linear, pixels + i * 4, count);
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void ConvertUnormToHalf (const std::uint8_t* input, std::uint16_t* output,
+	const std::size_t componentCount)
+{
+	std::size_t done = 0;
+
+	if (GetSelectedSimdLevel () == SimdLevel::AVX2) {
+		done = AVX2::ConvertUnormToHalf (input, output, componentCount);
+	}
+
+	Scalar::ConvertUnormToHalf (input + done, output + done, componentCount - done);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void ConvertHalfToUnorm (const std::uint16_t* input, std::uint8_t* output,
+	const std::size_t componentCount)
+{
+	std::size_t done = 0;
+
+	if (GetSelectedSimdLevel () == SimdLevel::AVX2) {
+		done = AVX2::ConvertHalfToUnorm (input, output, componentCount);
+	}
+
+	Scalar::ConvertHalfToUnorm (input + done, output + done, componentCount - done);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void ExtractChannels (const std::uint8_t* input, std::uint8_t* output,
+	const std::size_t pixelCount, const int channelCount)
+{
+	if (channelCount != 1 && channelCount != 2) {
+		throw std::runtime_error ("Can only extract one or two channels");
+	}
+
+	std::size_t done = 0;
+
+	if (GetSelectedSimdLevel () != SimdLevel::Scalar) {
+		done = SSSE3::ExtractChannels (input, output, pixelCount, channelCount);
+	}
+
+	Scalar::ExtractChannels (input + done * 4, output + done * channelCount,
+		pixelCount - done, channelCount);
+}
+}
@@ -0,0 +1,114 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#ifndef ANTERU_D3D12_SAMPLE_PIXELCONVERSION_H_
+#define ANTERU_D3D12_SAMPLE_PIXELCONVERSION_H_
+
+#include <cstddef>
+#include <cstdint>
+
+namespace AMD {
+///////////////////////////////////////////////////////////////////////////////
+enum class SimdLevel
+{
+	Scalar,
+	// SSE2 + SSSE3
+	SSSE3,
+	// AVX2 + F16C
+	AVX2
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+The highest SIMD level supported by both the CPU and the operating system.
+*/
+SimdLevel GetMaximumSimdLevel ();
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Select the kernels used by the conversion functions below. By default, the
+maximum supported level is used; requesting a higher level than supported
+clamps to the maximum. Mostly useful to compare against the scalar
+reference code.
+*/
+void SetPixelConversionSimdLevel (const SimdLevel level);
+SimdLevel GetPixelConversionSimdLevel ();
+
+// All functions below work on tightly packed pixels. Input and output must
+// not overlap unless stated otherwise.
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+RGB8 to RGBA8, alpha is set to 255.
+*/
+void ConvertRgbToRgba (const std::uint8_t* input, std::uint8_t* output,
+	const std::size_t pixelCount);
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+sRGB encoded RGBA8 to linear RGBA32F. Alpha is linear already and only gets
+scaled to 0..1.
+*/
+void ConvertSrgbToLinear (const std::uint8_t* input, float* output,
+	const std::size_t pixelCount);
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Linear RGBA32F to sRGB encoded RGBA8. Values are clamped to 0..1.
+*/
+void ConvertLinearToSrgb (const float* input, std::uint8_t* output,
+	const std::size_t pixelCount);
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Multiply color with alpha in place, for UNORM data.
+*/
+void PremultiplyAlpha (std::uint8_t* pixels, const std::size_t pixelCount);
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Multiply color with alpha in place, for sRGB data. The multiplication
+happens in linear space so the result is correct after the sampler converts
+the texel to linear.
+*/
+void PremultiplyAlphaSrgb (std::uint8_t* pixels, const std::size_t pixelCount);
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+UNORM8 components to float16 and back. These work per component, so an RGBA
+image with n pixels has 4 * n components.
+*/
+void ConvertUnormToHalf (const std::uint8_t* input, std::uint16_t* output,
+	const std::size_t componentCount);
+void ConvertHalfToUnorm (const std::uint16_t* input, std::uint8_t* output,
+	const std::size_t componentCount);
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Keep the first channelCount (1 or 2) channels of RGBA8 pixels, producing
+R8 or RG8 data.
+*/
+void ExtractChannels (const std::uint8_t* input, std::uint8_t* output,
+	const std::size_t pixelCount, const int channelCount);
+}
+
+#endif
@@ -0,0 +1,354 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+
+#include "RenderPass.h"
+
+#include <wrl.h>
+#include <cstring>
+#include <stdexcept>
+
+namespace AMD {
+///////////////////////////////////////////////////////////////////////////////
+RenderPassRenderTarget::RenderPassRenderTarget ()
+	: resource (nullptr)
+	, format (DXGI_FORMAT_UNKNOWN)
+	, loadOp (RenderPassLoadOp::Load)
+	, storeOp (RenderPassStoreOp::Store)
+{
+	view.ptr = 0;
+
+	clearColor [0] = 0;
+	clearColor [1] = 0;
+	clearColor [2] = 0;
+	clearColor [3] = 1;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+RenderPassDepthStencil::RenderPassDepthStencil ()
+	: resource (nullptr)
+	, format (DXGI_FORMAT_UNKNOWN)
+	, depthLoadOp (RenderPassLoadOp::Load)
+	, depthStoreOp (RenderPassStoreOp::Store)
+	, stencilLoadOp (RenderPassLoadOp::Load)
+	, stencilStoreOp (RenderPassStoreOp::Store)
+	, clearDepth (1)
+	, clearStencil (0)
+{
+	view.ptr = 0;
+}
+
+namespace {
+///////////////////////////////////////////////////////////////////////////////
+bool HasStencil (const DXGI_FORMAT format)
+{
+	switch (format) {
+	case DXGI_FORMAT_D24_UNORM_S8_UINT:
+	case DXGI_FORMAT_R24G8_TYPELESS:
+	case DXGI_FORMAT_D32_FLOAT_S8X24_UINT:
+	case DXGI_FORMAT_R32G8X24_TYPELESS:
+		return true;
+
+	default:
+		return false;
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Validate (const RenderPassDesc& desc)
+{
+	if (desc.renderTargets.size () > D3D12_SIMULTANEOUS_RENDER_TARGET_COUNT) {
+		throw std::runtime_error ("A render pass can have at most eight render targets");
+	}
+
+	for (const auto& renderTarget : desc.renderTargets) {
+		if (renderTarget.resource == nullptr &&
+			(renderTarget.loadOp == RenderPassLoadOp::Discard ||
+			renderTarget.storeOp == RenderPassStoreOp::Discard)) {
+			throw std::runtime_error ("Discarded render targets need a resource");
+		}
+	}
+
+	if (desc.hasDepthStencil && desc.depthStencil.resource == nullptr) {
+		const auto& depthStencil = desc.depthStencil;
+		const auto hasStencil = HasStencil (depthStencil.format);
+
+		if (depthStencil.depthLoadOp == RenderPassLoadOp::Discard ||
+			depthStencil.depthStoreOp == RenderPassStoreOp::Discard ||
+			(hasStencil && depthStencil.stencilLoadOp == RenderPassLoadOp::Discard) ||
+			(hasStencil && depthStencil.stencilStoreOp == RenderPassStoreOp::Discard)) {
+			throw std::runtime_error ("Discarded depth stencils need a resource");
+		}
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+DiscardResource drops both planes, so the depth stencil can only be
+discarded if neither gets loaded.
+*/
+bool CanDiscardDepthStencil (const RenderPassDepthStencil& depthStencil)
+{
+	if (depthStencil.depthLoadOp == RenderPassLoadOp::Load) {
+		return false;
+	}
+
+	if (HasStencil (depthStencil.format)) {
+		if (depthStencil.stencilLoadOp == RenderPassLoadOp::Load) {
+			return false;
+		}
+
+		return depthStencil.depthLoadOp == RenderPassLoadOp::Discard ||
+			depthStencil.stencilLoadOp == RenderPassLoadOp::Discard;
+	}
+
+	return depthStencil.depthLoadOp == RenderPassLoadOp::Discard;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+bool CanDiscardDepthStencilAtEnd (const RenderPassDepthStencil& depthStencil)
+{
+	if (depthStencil.depthStoreOp != RenderPassStoreOp::Discard) {
+		return false;
+	}
+
+	return !HasStencil (depthStencil.format) ||
+		depthStencil.stencilStoreOp == RenderPassStoreOp::Discard;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void BeginEmulatedRenderPass (ID3D12GraphicsCommandList* commandList,
+	const RenderPassDesc& desc)
+{
+	D3D12_CPU_DESCRIPTOR_HANDLE views [D3D12_SIMULTANEOUS_RENDER_TARGET_COUNT];
+	const auto renderTargetCount = static_cast<UINT> (desc.renderTargets.size ());
+
+	for (UINT i = 0; i < renderTargetCount; ++i) {
+		views [i] = desc.renderTargets [i].view;
+	}
+
+	commandList->OMSetRenderTargets (renderTargetCount,
+		renderTargetCount > 0 ? views : nullptr, FALSE,
+		desc.hasDepthStencil ? &desc.depthStencil.view : nullptr);
+
+	for (const auto& renderTarget : desc.renderTargets) {
+		if (renderTarget.loadOp == RenderPassLoadOp::Discard) {
+			commandList->DiscardResource (renderTarget.resource, nullptr);
+		} else if (renderTarget.loadOp == RenderPassLoadOp::Clear) {
+			commandList->ClearRenderTargetView (renderTarget.view,
+				renderTarget.clearColor, 0, nullptr);
+		}
+	}
+
+	if (!desc.hasDepthStencil) {
+		return;
+	}
+
+	const auto& depthStencil = desc.depthStencil;
+
+	// Discard first, a clear of the other plane has to survive it
+	if (CanDiscardDepthStencil (depthStencil)) {
+		commandList->DiscardResource (depthStencil.resource, nullptr);
+	}
+
+	int clearFlags = 0;
+	if (depthStencil.depthLoadOp == RenderPassLoadOp::Clear) {
+		clearFlags |= D3D12_CLEAR_FLAG_DEPTH;
+	}
+
+	if (HasStencil (depthStencil.format) &&
+		depthStencil.stencilLoadOp == RenderPassLoadOp::Clear) {
+		clearFlags |= D3D12_CLEAR_FLAG_STENCIL;
+	}
+
+	if (clearFlags != 0) {
+		commandList->ClearDepthStencilView (depthStencil.view,
+			static_cast<D3D12_CLEAR_FLAGS> (clearFlags),
+			depthStencil.clearDepth, depthStencil.clearStencil, 0, nullptr);
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void EndEmulatedRenderPass (ID3D12GraphicsCommandList* commandList,
+	const RenderPassDesc& desc)
+{
+	for (const auto& renderTarget : desc.renderTargets) {
+		if (renderTarget.storeOp == RenderPassStoreOp::Discard) {
+			commandList->DiscardResource (renderTarget.resource, nullptr);
+		}
+	}
+
+	if (desc.hasDepthStencil && CanDiscardDepthStencilAtEnd (desc.depthStencil)) {
+		commandList->DiscardResource (desc.depthStencil.resource, nullptr);
+	}
+}
+
+// Older Windows SDKs don't have render passes, everything is emulated then
+#ifdef __ID3D12GraphicsCommandList4_INTERFACE_DEFINED__
+///////////////////////////////////////////////////////////////////////////////
+D3D12_RENDER_PASS_BEGINNING_ACCESS_TYPE GetBeginningAccessType (
+	const RenderPassLoadOp op)
+{
+	switch (op) {
+	case RenderPassLoadOp::Clear:
+		return D3D12_RENDER_PASS_BEGINNING_ACCESS_TYPE_CLEAR;
+
+	case RenderPassLoadOp::Discard:
+		return D3D12_RENDER_PASS_BEGINNING_ACCESS_TYPE_DISCARD;
+
+	default:
+		return D3D12_RENDER_PASS_BEGINNING_ACCESS_TYPE_PRESERVE;
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+D3D12_RENDER_PASS_ENDING_ACCESS_TYPE GetEndingAccessType (
+	const RenderPassStoreOp op)
+{
+	if (op == RenderPassStoreOp::Discard) {
+		return D3D12_RENDER_PASS_ENDING_ACCESS_TYPE_DISCARD;
+	}
+
+	return D3D12_RENDER_PASS_ENDING_ACCESS_TYPE_PRESERVE;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Microsoft::WRL::ComPtr<ID3D12GraphicsCommandList4> GetCommandList4 (
+	ID3D12GraphicsCommandList* commandList)
+{
+	Microsoft::WRL::ComPtr<ID3D12GraphicsCommandList4> commandList4;
+	if (FAILED (commandList->QueryInterface (IID_PPV_ARGS (&commandList4)))) {
+		return nullptr;
+	}
+
+	return commandList4;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void BeginNativeRenderPass (ID3D12GraphicsCommandList* commandList,
+	const RenderPassDesc& desc)
+{
+	const auto commandList4 = GetCommandList4 (commandList);
+	if (!commandList4) {
+		throw std::runtime_error ("Command list doesn't support render passes");
+	}
+
+	D3D12_RENDER_PASS_RENDER_TARGET_DESC renderTargets [D3D12_SIMULTANEOUS_RENDER_TARGET_COUNT];
+	const auto renderTargetCount = static_cast<UINT> (desc.renderTargets.size ());
+
+	for (UINT i = 0; i < renderTargetCount; ++i) {
+		const auto& renderTarget = desc.renderTargets [i];
+		auto& target = renderTargets [i];
+		::memset (&target, 0, sizeof (target));
+
+		target.cpuDescriptor = renderTarget.view;
+		target.BeginningAccess.Type = GetBeginningAccessType (renderTarget.loadOp);
+		target.BeginningAccess.Clear.ClearValue.Format = renderTarget.format;
+		::memcpy (target.BeginningAccess.Clear.ClearValue.Color,
+			renderTarget.clearColor, sizeof (renderTarget.clearColor));
+		target.EndingAccess.Type = GetEndingAccessType (renderTarget.storeOp);
+	}
+
+	D3D12_RENDER_PASS_DEPTH_STENCIL_DESC depthStencil;
+	::memset (&depthStencil, 0, sizeof (depthStencil));
+
+	if (desc.hasDepthStencil) {
+		const auto& source = desc.depthStencil;
+
+		D3D12_CLEAR_VALUE clearValue;
+		clearValue.Format = source.format;
+		clearValue.DepthStencil.Depth = source.clearDepth;
+		clearValue.DepthStencil.Stencil = source.clearStencil;
+
+		depthStencil.cpuDescriptor = source.view;
+		depthStencil.DepthBeginningAccess.Type = GetBeginningAccessType (source.depthLoadOp);
+		depthStencil.DepthBeginningAccess.Clear.ClearValue = clearValue;
+		depthStencil.DepthEndingAccess.Type = GetEndingAccessType (source.depthStoreOp);
+
+		if (HasStencil (source.format)) {
+			depthStencil.StencilBeginningAccess.Type = GetBeginningAccessType (source.stencilLoadOp);
+			depthStencil.StencilBeginningAccess.Clear.ClearValue = clearValue;
+			depthStencil.StencilEndingAccess.Type = GetEndingAccessType (source.stencilStoreOp);
+		} else {
+			depthStencil.StencilBeginningAccess.Type = D3D12_RENDER_PASS_BEGINNING_ACCESS_TYPE_NO_ACCESS;
+			depthStencil.StencilEndingAccess.Type = D3D12_RENDER_PASS_ENDING_ACCESS_TYPE_NO_ACCESS;
+		}
+	}
+
+	commandList4->BeginRenderPass (renderTargetCount,
+		renderTargetCount > 0 ? renderTargets : nullptr,
+		desc.hasDepthStencil ? &depthStencil : nullptr,
+		D3D12_RENDER_PASS_FLAG_NONE);
+}
+#endif
+}
+
+///////////////////////////////////////////////////////////////////////////////
+RenderPassMode GetRenderPassMode (ID3D12GraphicsCommandList* commandList)
+{
+#ifdef __ID3D12GraphicsCommandList4_INTERFACE_DEFINED__
+	if (GetCommandList4 (commandList)) {
+		return RenderPassMode::Native;
+	}
+#else
+	(void) commandList;
+#endif
+
+	return RenderPassMode::Emulated;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void BeginRenderPass (ID3D12GraphicsCommandList* commandList,
+	const RenderPassDesc& desc, const RenderPassMode mode)
+{
+	Validate (desc);
+
+#ifdef __ID3D12GraphicsCommandList4_INTERFACE_DEFINED__
+	if (mode == RenderPassMode::Native) {
+		BeginNativeRenderPass (commandList, desc);
+		return;
+	}
+#else
+	if (mode == RenderPassMode::Native) {
+		throw std::runtime_error ("Built without render pass support");
+	}
+#endif
+
+	BeginEmulatedRenderPass (commandList, desc);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void EndRenderPass (ID3D12GraphicsCommandList* commandList,
+	const RenderPassDesc& desc, const RenderPassMode mode)
+{
+#ifdef __ID3D12GraphicsCommandList4_INTERFACE_DEFINED__
+	if (mode == RenderPassMode::Native) {
+		// The store operations were passed to BeginRenderPass already
+		GetCommandList4 (commandList)->EndRenderPass ();
+		return;
+	}
+#endif
+
+	(void) mode;
+	EndEmulatedRenderPass (commandList, desc);
+}
+}
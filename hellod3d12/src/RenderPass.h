@@ -0,0 +1,151 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+
+#ifndef ANTERU_D3D12_SAMPLE_RENDERPASS_H_
+#define ANTERU_D3D12_SAMPLE_RENDERPASS_H_
+
+#include <d3d12.h>
+#include <cstdint>
+#include <vector>
+
+namespace AMD {
+///////////////////////////////////////////////////////////////////////////////
+/**
+What happens to the contents of a render target when a render pass begins.
+Discard means they are undefined, so use it when every pixel gets written
+anyway. The GPU then doesn't have to load or clear them, which saves
+bandwidth, in particular on tile-based GPUs.
+*/
+enum class RenderPassLoadOp
+{
+	Load,
+	Clear,
+	Discard
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+What happens to the contents of a render target when a render pass ends.
+Discard is for targets which are not read after the pass, like a depth
+buffer only used while rendering.
+*/
+enum class RenderPassStoreOp
+{
+	Store,
+	Discard
+};
+
+///////////////////////////////////////////////////////////////////////////////
+struct RenderPassRenderTarget
+{
+	RenderPassRenderTarget ();
+
+	D3D12_CPU_DESCRIPTOR_HANDLE view;
+
+	/**
+	The resource of the view. Only needed to discard it.
+	*/
+	ID3D12Resource* resource;
+
+	/**
+	Format of the view, clear values need it.
+	*/
+	DXGI_FORMAT format;
+
+	RenderPassLoadOp loadOp;
+	RenderPassStoreOp storeOp;
+
+	float clearColor [4];
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+The stencil operations are ignored if the format has no stencil.
+*/
+struct RenderPassDepthStencil
+{
+	RenderPassDepthStencil ();
+
+	D3D12_CPU_DESCRIPTOR_HANDLE view;
+	ID3D12Resource* resource;
+	DXGI_FORMAT format;
+
+	RenderPassLoadOp depthLoadOp;
+	RenderPassStoreOp depthStoreOp;
+	RenderPassLoadOp stencilLoadOp;
+	RenderPassStoreOp stencilStoreOp;
+
+	float clearDepth;
+	std::uint8_t clearStencil;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+struct RenderPassDesc
+{
+	std::vector<RenderPassRenderTarget> renderTargets;
+
+	bool hasDepthStencil = false;
+	RenderPassDepthStencil depthStencil;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Native render passes use ID3D12GraphicsCommandList4::BeginRenderPass, which
+passes the load and store operations on to the driver. Emulated render
+passes translate them into OMSetRenderTargets, clears and DiscardResource
+calls, which works on every command list.
+*/
+enum class RenderPassMode
+{
+	Native,
+	Emulated
+};
+
+/**
+Native if the command list implements ID3D12GraphicsCommandList4 and the
+headers we are built with know about it.
+*/
+RenderPassMode GetRenderPassMode (ID3D12GraphicsCommandList* commandList);
+
+/**
+Bind the render targets and depth stencil of desc and apply their load
+operations. Render targets must be in the render target state and depth
+stencils in the depth write state already, and stay in it until the pass
+ends, so no barriers can be recorded in between.
+
+Throws if desc has more than eight render targets, if a discarded target
+has no resource, or if mode is Native but the command list doesn't support
+it.
+*/
+void BeginRenderPass (ID3D12GraphicsCommandList* commandList,
+	const RenderPassDesc& desc, const RenderPassMode mode);
+
+/**
+Apply the store operations of desc, which must be the one the pass was
+begun with.
+*/
+void EndRenderPass (ID3D12GraphicsCommandList* commandList,
+	const RenderPassDesc& desc, const RenderPassMode mode);
+}
+
+#endif
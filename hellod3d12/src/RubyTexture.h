@@ -1,6755 +1,2755 @@
-const unsigned char RubyTexture [] = {
-	0xff, 0xd8, 0xff, 0xe0, 0x0 , 0x10, 0x4a, 0x46, 0x49, 0x46, 0x0 , 0x1 , 0x1 , 
-	0x1 , 0x0 , 0xc0, 0x0 , 0xc0, 0x0 , 0x0 , 0xff, 0xe1, 0x0 , 0x66, 0x45, 0x78, 
-	0x69, 0x66, 0x0 , 0x0 , 0x4d, 0x4d, 0x0 , 0x2a, 0x0 , 0x0 , 0x0 , 0x8 , 0x0 , 
-	0x4 , 0x1 , 0x1a, 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x3e, 
-	0x1 , 0x1b, 0x0 , 0x5 , 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0x46, 0x1 , 
-	0x28, 0x0 , 0x3 , 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x2 , 0x0 , 0x0 , 0x1 , 0x31, 
-	0x0 , 0x2 , 0x0 , 0x0 , 0x0 , 0x10, 0x0 , 0x0 , 0x0 , 0x4e, 0x0 , 0x0 , 0x0 , 
-	0x0 , 0x0 , 0x0 , 0x0 , 0xc0, 0x0 , 0x0 , 0x0 , 0x1 , 0x0 , 0x0 , 0x0 , 0xc0, 
-	0x0 , 0x0 , 0x0 , 0x1 , 0x70, 0x61, 0x69, 0x6e, 0x74, 0x2e, 0x6e, 0x65, 0x74, 
-	0x20, 0x34, 0x2e, 0x30, 0x2e, 0x36, 0x0 , 0xff, 0xdb, 0x0 , 0x43, 0x0 , 0x4 , 
-	0x2 , 0x3 , 0x3 , 0x3 , 0x2 , 0x4 , 0x3 , 0x3 , 0x3 , 0x4 , 0x4 , 0x4 , 0x4 , 
-	0x5 , 0x9 , 0x6 , 0x5 , 0x5 , 0x5 , 0x5 , 0xb , 0x8 , 0x8 , 0x6 , 0x9 , 0xd , 
-	0xb , 0xd , 0xd , 0xd , 0xb , 0xc , 0xc , 0xe , 0x10, 0x14, 0x11, 0xe , 0xf , 
-	0x13, 0xf , 0xc , 0xc , 0x12, 0x18, 0x12, 0x13, 0x15, 0x16, 0x17, 0x17, 0x17, 
-	0xe , 0x11, 0x19, 0x1b, 0x19, 0x16, 0x1a, 0x14, 0x16, 0x17, 0x16, 0xff, 0xdb, 
-	0x0 , 0x43, 0x1 , 0x4 , 0x4 , 0x4 , 0x5 , 0x5 , 0x5 , 0xa , 0x6 , 0x6 , 0xa , 
-	0x16, 0xf , 0xc , 0xf , 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 
-	0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 
-	0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 
-	0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 
-	0x16, 0x16, 0xff, 0xc0, 0x0 , 0x11, 0x8 , 0x2 , 0xd0, 0x5 , 0x0 , 0x3 , 0x1 , 
-	0x22, 0x0 , 0x2 , 0x11, 0x1 , 0x3 , 0x11, 0x1 , 0xff, 0xc4, 0x0 , 0x1f, 0x0 , 
-	0x0 , 0x1 , 0x5 , 0x1 , 0x1 , 0x1 , 0x1 , 0x1 , 0x1 , 0x0 , 0x0 , 0x0 , 0x0 , 
-	0x0 , 0x0 , 0x0 , 0x0 , 0x1 , 0x2 , 0x3 , 0x4 , 0x5 , 0x6 , 0x7 , 0x8 , 0x9 , 
-	0xa , 0xb , 0xff, 0xc4, 0x0 , 0xb5, 0x10, 0x0 , 0x2 , 0x1 , 0x3 , 0x3 , 0x2 , 
-	0x4 , 0x3 , 0x5 , 0x5 , 0x4 , 0x4 , 0x0 , 0x0 , 0x1 , 0x7d, 0x1 , 0x2 , 0x3 , 
-	0x0 , 0x4 , 0x11, 0x5 , 0x12, 0x21, 0x31, 0x41, 0x6 , 0x13, 0x51, 0x61, 0x7 , 
-	0x22, 0x71, 0x14, 0x32, 0x81, 0x91, 0xa1, 0x8 , 0x23, 0x42, 0xb1, 0xc1, 0x15, 
-	0x52, 0xd1, 0xf0, 0x24, 0x33, 0x62, 0x72, 0x82, 0x9 , 0xa , 0x16, 0x17, 0x18, 
-	0x19, 0x1a, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2a, 0x34, 0x35, 0x36, 0x37, 0x38, 
-	0x39, 0x3a, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4a, 0x53, 0x54, 0x55, 
-	0x56, 0x57, 0x58, 0x59, 0x5a, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6a, 
-	0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x83, 0x84, 0x85, 0x86, 0x87, 
-	0x88, 0x89, 0x8a, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9a, 0xa2, 
-	0xa3, 0xa4, 0xa5, 0xa6, 0xa7, 0xa8, 0xa9, 0xaa, 0xb2, 0xb3, 0xb4, 0xb5, 0xb6, 
-	0xb7, 0xb8, 0xb9, 0xba, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 
-	0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7, 0xd8, 0xd9, 0xda, 0xe1, 0xe2, 0xe3, 0xe4, 
-	0xe5, 0xe6, 0xe7, 0xe8, 0xe9, 0xea, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 
-	0xf8, 0xf9, 0xfa, 0xff, 0xc4, 0x0 , 0x1f, 0x1 , 0x0 , 0x3 , 0x1 , 0x1 , 0x1 , 
-	0x1 , 0x1 , 0x1 , 0x1 , 0x1 , 0x1 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x0 , 0x1 , 
-	0x2 , 0x3 , 0x4 , 0x5 , 0x6 , 0x7 , 0x8 , 0x9 , 0xa , 0xb , 0xff, 0xc4, 0x0 , 
-	0xb5, 0x11, 0x0 , 0x2 , 0x1 , 0x2 , 0x4 , 0x4 , 0x3 , 0x4 , 0x7 , 0x5 , 0x4 , 
-	0x4 , 0x0 , 0x1 , 0x2 , 0x77, 0x0 , 0x1 , 0x2 , 0x3 , 0x11, 0x4 , 0x5 , 0x21, 
-	0x31, 0x6 , 0x12, 0x41, 0x51, 0x7 , 0x61, 0x71, 0x13, 0x22, 0x32, 0x81, 0x8 , 
-	0x14, 0x42, 0x91, 0xa1, 0xb1, 0xc1, 0x9 , 0x23, 0x33, 0x52, 0xf0, 0x15, 0x62, 
-	0x72, 0xd1, 0xa , 0x16, 0x24, 0x34, 0xe1, 0x25, 0xf1, 0x17, 0x18, 0x19, 0x1a, 
-	0x26, 0x27, 0x28, 0x29, 0x2a, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x43, 0x44, 
-	0x45, 0x46, 0x47, 0x48, 0x49, 0x4a, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 
-	0x5a, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6a, 0x73, 0x74, 0x75, 0x76, 
-	0x77, 0x78, 0x79, 0x7a, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 
-	0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9a, 0xa2, 0xa3, 0xa4, 0xa5, 
-	0xa6, 0xa7, 0xa8, 0xa9, 0xaa, 0xb2, 0xb3, 0xb4, 0xb5, 0xb6, 0xb7, 0xb8, 0xb9, 
-	0xba, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xd2, 0xd3, 0xd4, 
-	0xd5, 0xd6, 0xd7, 0xd8, 0xd9, 0xda, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6, 0xe7, 0xe8, 
-	0xe9, 0xea, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9, 0xfa, 0xff, 0xda, 
-	0x0 , 0xc , 0x3 , 0x1 , 0x0 , 0x2 , 0x11, 0x3 , 0x11, 0x0 , 0x3f, 0x0 , 0xf8, 
-	0xf6, 0x8a, 0x29, 0x40, 0xae, 0xc2, 0x10, 0x1 , 0x4b, 0x45, 0x14, 0x8 , 0x29, 
-	0xc2, 0x8c, 0x51, 0x40, 0xc2, 0x94, 0x7d, 0x68, 0xc7, 0xb5, 0x2f, 0xe1, 0x40, 
-	0x7 , 0xe3, 0x47, 0xe3, 0x45, 0x14, 0x80, 0x28, 0xc5, 0x28, 0xe6, 0x96, 0x80, 
-	0xa , 0x28, 0x14, 0xb8, 0xa4, 0x20, 0x2 , 0x96, 0x8a, 0x51, 0xf4, 0xa0, 0x62, 
-	0x63, 0xde, 0x94, 0x7d, 0x69, 0x7f, 0xa , 0x3f, 0xa , 0x0 , 0x3f, 0x1a, 0x28, 
-	0xa2, 0x80, 0xd0, 0x29, 0x71, 0x4b, 0x8a, 0x28, 0x10, 0x51, 0x8a, 0x5 , 0x3a, 
-	0x80, 0xa , 0x28, 0x14, 0xbf, 0x85, 0x0 , 0x3 , 0xeb, 0x4b, 0xf8, 0xd1, 0xf8, 
-	0x51, 0x40, 0x5 , 0x14, 0x52, 0x81, 0x40, 0x0 , 0x14, 0xb4, 0x52, 0x81, 0x48, 
-	0x3 , 0x14, 0xa2, 0x8e, 0x68, 0xa4, 0x1 , 0x8f, 0x7a, 0x51, 0xf5, 0xa5, 0xfc, 
-	0x28, 0xfc, 0x28, 0x0 , 0xfc, 0x68, 0xa2, 0x8a, 0x0 , 0x50, 0x29, 0x68, 0xa5, 
-	0x2 , 0x80, 0x5 , 0xa5, 0xa2, 0x94, 0xa , 0x0 , 0x7 , 0xd6, 0x97, 0xf1, 0xa3, 
-	0xf0, 0xa2, 0x80, 0xa , 0x70, 0xa4, 0x5a, 0x5a, 0x0 , 0x28, 0xc5, 0x2e, 0x29, 
-	0x68, 0x0 , 0xa5, 0x1f, 0x5a, 0x31, 0xed, 0x4b, 0xf8, 0x50, 0x1 , 0xf8, 0xd1, 
-	0xf8, 0xd1, 0x45, 0x0 , 0x14, 0x62, 0x97, 0x14, 0xb4, 0x0 , 0x51, 0x45, 0x28, 
-	0x14, 0x0 , 0x1 , 0x4b, 0x45, 0x14, 0x0 , 0x51, 0x4b, 0x8a, 0x28, 0x0 , 0x1f, 
-	0x5a, 0x5f, 0xc6, 0x8f, 0xc2, 0x8f, 0xc2, 0x80, 0xf , 0xc6, 0x8a, 0x28, 0xa0, 
-	0x2 , 0x8a, 0x29, 0x40, 0xa0, 0x42, 0x52, 0xe2, 0x97, 0x14, 0x50, 0x1 , 0x45, 
-	0x14, 0x50, 0x1 , 0x46, 0x28, 0x14, 0xea, 0x4 , 0x36, 0x8a, 0x76, 0x28, 0xc5, 
-	0x0 , 0x14, 0x51, 0x45, 0x0 , 0x14, 0x51, 0x45, 0x0 , 0x14, 0x51, 0x45, 0x0 , 
-	0x14, 0x51, 0x4a, 0x5 , 0x0 , 0x25, 0x18, 0xf7, 0xa1, 0x69, 0xdf, 0x85, 0x0 , 
-	0x1f, 0x8d, 0x1f, 0x8d, 0x1f, 0x85, 0x1f, 0x85, 0x0 , 0x1f, 0x8d, 0x1f, 0x8d, 
-	0x1f, 0x85, 0x1f, 0x85, 0x0 , 0x1f, 0x8d, 0x1f, 0x8d, 0x1f, 0x85, 0x1f, 0x85, 
-	0x0 , 0x1f, 0x8d, 0x1f, 0x8d, 0x1f, 0x85, 0x1f, 0x85, 0x0 , 0x1f, 0x8d, 0x1f, 
-	0x8d, 0x1f, 0x85, 0x1f, 0x85, 0x0 , 0x1f, 0x8d, 0x1f, 0x8d, 0x1f, 0x85, 0x14, 
-	0x0 , 0x7e, 0x34, 0x7e, 0x34, 0x7e, 0x14, 0x7e, 0x14, 0x0 , 0x7e, 0x34, 0x7e, 
-	0x34, 0x7e, 0x14, 0x7e, 0x14, 0x0 , 0x7e, 0x34, 0x7e, 0x34, 0x7e, 0x14, 0x7e, 
-	0x14, 0x0 , 0x7e, 0x34, 0x7e, 0x34, 0x7e, 0x14, 0x7e, 0x14, 0x0 , 0x7e, 0x34, 
-	0x7e, 0x34, 0x7e, 0x14, 0x7e, 0x15, 0x40, 0x1f, 0x8d, 0x1f, 0x8d, 0x1f, 0x85, 
-	0x1f, 0x85, 0x0 , 0x21, 0xa4, 0xa5, 0xc5, 0x18, 0xa0, 0x4 , 0xc5, 0x14, 0x51, 
-	0x40, 0x5 , 0x21, 0x14, 0xb4, 0x50, 0x3 , 0x71, 0x45, 0x3a, 0x93, 0x14, 0x0 , 
-	0x94, 0x51, 0x45, 0x0 , 0x36, 0x8a, 0x5c, 0x52, 0x1a, 0x60, 0x14, 0x51, 0x45, 
-	0x0 , 0x1f, 0x8d, 0x1f, 0x8d, 0x1f, 0x85, 0x1f, 0x85, 0x30, 0x10, 0xfd, 0x69, 
-	0x29, 0xdf, 0x85, 0x26, 0x3d, 0xa8, 0x1 , 0x28, 0xa2, 0x8a, 0x0 , 0x6d, 0x14, 
-	0x51, 0x40, 0xd , 0xc5, 0x14, 0xad, 0x49, 0x40, 0x5 , 0x1f, 0x8d, 0x14, 0x7e, 
-	0x14, 0x0 , 0x7e, 0x34, 0xd6, 0xa7, 0x7e, 0x14, 0xd6, 0xa0, 0x2 , 0x91, 0xa9, 
-	0x68, 0xc5, 0x0 , 0x34, 0xd3, 0x69, 0xd4, 0x8d, 0x54, 0x2 , 0x51, 0x45, 0x14, 
-	0x0 , 0x7e, 0x34, 0x87, 0xeb, 0x4b, 0xf8, 0x51, 0xf8, 0x50, 0x3 , 0x69, 0x8 , 
-	0xa5, 0xa2, 0x80, 0x1b, 0x48, 0x45, 0x2d, 0x14, 0x0 , 0xda, 0x3f, 0x1a, 0x28, 
-	0xa0, 0x3 , 0xf1, 0xa6, 0xb5, 0x3b, 0xf0, 0xa4, 0xc7, 0xb5, 0x0 , 0x21, 0xa6, 
-	0xd3, 0xa9, 0x1a, 0x80, 0x12, 0x91, 0xa9, 0x69, 0x1a, 0x80, 0x12, 0x8f, 0xc6, 
-	0x8a, 0x3f, 0xa , 0x0 , 0x43, 0xf5, 0xa4, 0xa7, 0x7e, 0x14, 0xd3, 0x40, 0x14, 
-	0x0 , 0xa5, 0xa2, 0x8a, 0x92, 0xc5, 0x2 , 0x96, 0x8a, 0x28, 0xb , 0x82, 0xd3, 
-	0xbf, 0x1a, 0x4c, 0x7b, 0x52, 0xfe, 0x14, 0x8 , 0x3f, 0x1a, 0x28, 0xa2, 0x81, 
-	0xa0, 0xa7, 0xa , 0x31, 0x45, 0x20, 0xa , 0x31, 0x40, 0xa7, 0x52, 0x10, 0x51, 
-	0x40, 0xa5, 0xc5, 0x0 , 0x3 , 0xeb, 0x4b, 0xf8, 0xd1, 0xf8, 0x51, 0xf8, 0x50, 
-	0x30, 0xa2, 0x8a, 0x55, 0x14, 0x0 , 0x2d, 0x2d, 0x18, 0xa5, 0x2 , 0x80, 0x12, 
-	0x9c, 0x28, 0xc5, 0x14, 0x8 , 0x28, 0xc7, 0xbd, 0x2e, 0x3d, 0xa9, 0x7f, 0xa , 
-	0x7 , 0xa0, 0x7e, 0x34, 0x51, 0x45, 0x2 , 0xa , 0x31, 0x40, 0xa7, 0x50, 0x34, 
-	0x20, 0x14, 0xb8, 0xa0, 0x53, 0xa8, 0x10, 0x80, 0x52, 0xd1, 0x4a, 0x5 , 0x48, 
-	0x8 , 0xa3, 0x14, 0xef, 0xc6, 0x8f, 0xc2, 0x8a, 0x0 , 0x28, 0xa2, 0x94, 0xa , 
-	0x0 , 0x0 , 0xa5, 0xa2, 0x94, 0xa , 0x0 , 0x0 , 0xa5, 0xa2, 0x94, 0xa , 0x0 , 
-	0x4c, 0x7b, 0xd3, 0xa8, 0xfc, 0x28, 0xa0, 0x2 , 0x80, 0x33, 0x40, 0xa7, 0xe , 
-	0x28, 0x0 , 0xa7, 0xa , 0x31, 0x45, 0x0 , 0x14, 0xbd, 0x3b, 0xd1, 0x8a, 0x5f, 
-	0xc2, 0x80, 0xf , 0xc6, 0x8a, 0x28, 0xa0, 0x2 , 0x97, 0x14, 0x2d, 0x2d, 0x0 , 
-	0x20, 0x14, 0xb4, 0xa , 0x5c, 0x50, 0x0 , 0x5 , 0x2d, 0x14, 0x73, 0x40, 0x5 , 
-	0x2a, 0xfd, 0x68, 0xc5, 0x1f, 0x85, 0x0 , 0x2f, 0xe3, 0x47, 0xe3, 0x47, 0xe1, 
-	0x47, 0xe1, 0x40, 0x7 , 0xe3, 0x45, 0x14, 0x50, 0x1 , 0x45, 0x14, 0x50, 0x3 , 
-	0xa8, 0xa2, 0x8a, 0x0 , 0x28, 0xa2, 0x94, 0xa , 0x4 , 0x18, 0xa3, 0x14, 0xa6, 
-	0x81, 0x40, 0x5 , 0x14, 0x51, 0x40, 0x58, 0x28, 0xa2, 0x8a, 0x1 , 0x5 , 0x14, 
-	0x51, 0x40, 0x82, 0x8a, 0x5 , 0x2e, 0x28, 0x1 , 0x28, 0xa5, 0xc5, 0x18, 0xa0, 
-	0x3 , 0x3e, 0xf4, 0xbf, 0x8d, 0x26, 0x3d, 0xa9, 0x7f, 0xa , 0x0 , 0x3f, 0x1a, 
-	0x3f, 0x1a, 0x3f, 0xa , 0x3f, 0xa , 0x0 , 0x3f, 0x1a, 0x3f, 0x1a, 0x3f, 0xa , 
-	0x3f, 0xa , 0x0 , 0x3f, 0x1a, 0x3f, 0x1a, 0x3f, 0xa , 0x3f, 0xa , 0x0 , 0x3f, 
-	0x1a, 0x3f, 0x1a, 0x28, 0xa0, 0x2 , 0x8a, 0x28, 0xa0, 0x2 , 0x8a, 0x28, 0xa0, 
-	0x2 , 0x8a, 0x28, 0xa0, 0x2 , 0x8a, 0x28, 0xa0, 0x3 , 0xf1, 0xa2, 0x8a, 0x28, 
-	0x0 , 0xa3, 0xf1, 0xa2, 0x8a, 0x0 , 0x3f, 0x1a, 0x3f, 0x1a, 0x3f, 0xa , 0x3f, 
-	0xa , 0x0 , 0x3f, 0x1a, 0x3f, 0x1a, 0x3f, 0xa , 0x3f, 0xa , 0x0 , 0x3f, 0x1a, 
-	0x3f, 0x1a, 0x3f, 0xa , 0x3f, 0xa , 0x77, 0x0 , 0xfc, 0x68, 0xfc, 0x68, 0xfc, 
-	0x28, 0xfc, 0x29, 0x80, 0xda, 0x29, 0x48, 0xa4, 0xa0, 0x2 , 0x8a, 0x28, 0xa0, 
-	0x0 , 0xd2, 0x62, 0x96, 0x8a, 0x0 , 0x6d, 0x14, 0xa4, 0x52, 0x50, 0x1 , 0x48, 
-	0x45, 0x2d, 0x14, 0x0 , 0xda, 0x28, 0xa2, 0x80, 0xa , 0x3f, 0x1a, 0x28, 0xfc, 
-	0x28, 0x0 , 0xfc, 0x68, 0xfc, 0x68, 0xfc, 0x28, 0xfc, 0x29, 0xdc, 0x6 , 0xd1, 
-	0x4a, 0x45, 0x25, 0x30, 0x3 , 0x4d, 0xa7, 0x52, 0x35, 0x0 , 0x25, 0x23, 0x52, 
-	0xd2, 0x35, 0x0 , 0x25, 0x14, 0x51, 0x40, 0x7 , 0xe3, 0x47, 0xe3, 0x47, 0xe1, 
-	0x47, 0xe1, 0x40, 0xd , 0xa2, 0x94, 0x8a, 0x4a, 0x0 , 0x6d, 0x14, 0xa4, 0x52, 
-	0x50, 0x3 , 0x71, 0x45, 0x2b, 0x52, 0x50, 0x1 , 0x47, 0xe3, 0x45, 0x1f, 0x85, 
-	0x30, 0x1b, 0x45, 0x2b, 0x7d, 0x29, 0x29, 0x80, 0xdc, 0x51, 0x4a, 0xd4, 0x94, 
-	0x0 , 0xda, 0x29, 0x48, 0xa4, 0xa0, 0x3 , 0xf1, 0xa3, 0xf1, 0xa3, 0xf0, 0xa3, 
-	0xf0, 0xa0, 0x6 , 0xd1, 0x45, 0x14, 0x0 , 0xda, 0x42, 0x29, 0xc4, 0x52, 0x50, 
-	0x3 , 0x68, 0xfc, 0x68, 0xa3, 0xf0, 0xa0, 0x3 , 0xf1, 0xa4, 0x3f, 0x5a, 0x5f, 
-	0xc2, 0x8f, 0xc2, 0x80, 0x33, 0xe9, 0xc2, 0x8c, 0x51, 0x52, 0x58, 0x63, 0xde, 
-	0x94, 0x7d, 0x69, 0x7f, 0xa , 0x3f, 0xa , 0x3 , 0xa0, 0x7e, 0x34, 0x51, 0x45, 
-	0x0 , 0x14, 0xab, 0x4b, 0x81, 0x45, 0x24, 0x20, 0xa5, 0xc5, 0xb , 0x4b, 0x48, 
-	0x61, 0x45, 0x2 , 0x9d, 0xf8, 0x50, 0x1 , 0xf8, 0xd1, 0xf8, 0xd1, 0xf8, 0x51, 
-	0x40, 0x82, 0x8a, 0x29, 0x40, 0xa0, 0x60, 0x5 , 0x2d, 0x14, 0xa0, 0x50, 0x0 , 
-	0x5 , 0x2d, 0x14, 0xa0, 0x50, 0x2 , 0x63, 0xde, 0x94, 0x7d, 0x69, 0x7f, 0xa , 
-	0x3f, 0xa , 0x4 , 0x1f, 0x8d, 0x14, 0x51, 0x40, 0xc2, 0x97, 0x14, 0xb8, 0xa2, 
-	0x81, 0x5 , 0x2e, 0x29, 0x71, 0x45, 0x48, 0x5 , 0x14, 0xa , 0x5f, 0xc2, 0x81, 
-	0x8b, 0xf8, 0xd1, 0xf8, 0xd1, 0xf8, 0x51, 0x40, 0x82, 0x8c, 0x50, 0x29, 0xd4, 
-	0x0 , 0x80, 0x52, 0xe2, 0x81, 0x4e, 0xa0, 0x4 , 0x2 , 0x96, 0x81, 0x4b, 0x8a, 
-	0x0 , 0x7 , 0xd6, 0x97, 0xf1, 0xa3, 0xf0, 0xa2, 0x80, 0xa , 0x31, 0x40, 0xa7, 
-	0x50, 0x1 , 0x4b, 0x8a, 0x16, 0x96, 0x80, 0xa , 0x51, 0xf5, 0xa3, 0x1e, 0xd4, 
-	0xbf, 0x85, 0x0 , 0x1f, 0x8d, 0x14, 0x51, 0x40, 0x5 , 0x18, 0xa0, 0x53, 0xa8, 
-	0x0 , 0xa3, 0x14, 0x52, 0xad, 0x0 , 0x0 , 0x52, 0xd1, 0x4a, 0x5 , 0x0 , 0x1d, 
-	0x68, 0x1f, 0x5a, 0x31, 0xed, 0x4b, 0xf8, 0x50, 0x1 , 0xf8, 0xd1, 0xf8, 0xd1, 
-	0xf8, 0x51, 0xf8, 0x50, 0x1 , 0x45, 0x14, 0x50, 0x1 , 0x46, 0x28, 0x14, 0xea, 
-	0x0 , 0x40, 0x28, 0x22, 0x96, 0x8e, 0x68, 0x0 , 0xa2, 0x8a, 0x50, 0x28, 0x1 , 
-	0x5 , 0x3a, 0x9a, 0x28, 0x66, 0x9 , 0xd6, 0x93, 0x69, 0x6e, 0x38, 0xc5, 0xc9, 
-	0xd9, 0x2d, 0x47, 0x51, 0x4c, 0x32, 0x7c, 0xbb, 0x86, 0x3f, 0x3a, 0x4f, 0x3a, 
-	0x30, 0xb9, 0x67, 0x18, 0xf6, 0xac, 0x65, 0x88, 0xa5, 0x1d, 0xd9, 0xdb, 0x4f, 
-	0x2b, 0xc5, 0xd4, 0xf8, 0x60, 0x49, 0x46, 0x3b, 0xe7, 0x1f, 0xce, 0x9a, 0xb2, 
-	0xa1, 0xe8, 0xf , 0x5e, 0xe7, 0x14, 0xbf, 0x23, 0xb6, 0xc2, 0xbf, 0x5f, 0x9c, 
-	0xe7, 0xf4, 0xac, 0x5e, 0x36, 0x9f, 0x43, 0xbe, 0x3c, 0x3f, 0x8b, 0xd1, 0xca, 
-	0xcb, 0xe6, 0x35, 0xb2, 0x3e, 0xf3, 0xaa, 0xfb, 0x1 , 0x4d, 0x67, 0x75, 0xea, 
-	0x15, 0x87, 0xb7, 0xca, 0x7f, 0x5a, 0x91, 0xe3, 0x5d, 0xbf, 0x2c, 0x18, 0x7 , 
-	0xbb, 0x37, 0xf8, 0xe2, 0x98, 0xb1, 0xe1, 0xb6, 0x8 , 0xa3, 0xdc, 0x7a, 0x1c, 
-	0xab, 0x7e, 0xb5, 0x93, 0xc7, 0x76, 0x47, 0x5c, 0x38, 0x75, 0xfd, 0xa9, 0xaf, 
-	0x90, 0xe4, 0x75, 0x6e, 0x98, 0xfa, 0x66, 0x9d, 0x86, 0x3d, 0x17, 0xf5, 0x14, 
-	0x8 , 0xf0, 0x48, 0xdc, 0xa9, 0x8e, 0xac, 0x0 , 0xb , 0xfa, 0xd1, 0x24, 0xf1, 
-	0xa7, 0xce, 0xd7, 0x62, 0x35, 0x6e, 0x1 , 0x19, 0x19, 0xfc, 0x6a, 0x7e, 0xbb, 
-	0x37, 0xb2, 0x3a, 0x17, 0xf , 0xe1, 0xa3, 0xf1, 0x4d, 0x8f, 0x8e, 0x27, 0x3f, 
-	0xc2, 0x69, 0xe2, 0xde, 0x52, 0x70, 0x7 , 0xea, 0x2a, 0x9d, 0xd6, 0xa4, 0xc5, 
-	0x41, 0x8a, 0xe4, 0x18, 0xfb, 0x92, 0x49, 0xcf, 0xeb, 0x51, 0xc3, 0xa9, 0xbe, 
-	0x3e, 0x57, 0xc0, 0x1c, 0xe4, 0x9c, 0xe7, 0xd7, 0x1c, 0x7f, 0x5a, 0x3e, 0xb7, 
-	0x54, 0x3f, 0xb0, 0xf0, 0x4b, 0xab, 0xfb, 0xff, 0x0 , 0xe0, 0x1a, 0x2d, 0x6d, 
-	0x38, 0xe7, 0x61, 0x3f, 0x4e, 0x6a, 0x29, 0x14, 0xa7, 0xdf, 0xf9, 0x7f, 0xde, 
-	0x20, 0x55, 0x4f, 0xed, 0xa5, 0x3 , 0x6c, 0xe0, 0xe3, 0x1f, 0xde, 0xdd, 0xf9, 
-	0x81, 0xd2, 0x99, 0x1f, 0x88, 0xec, 0xc0, 0x60, 0x3 , 0x7c, 0xa7, 0x1c, 0x11, 
-	0x8f, 0xca, 0xaa, 0x38, 0xca, 0x9d, 0x51, 0x8d, 0x4c, 0x8b, 0xc , 0xfe, 0x19, 
-	0xb4, 0x5e, 0xe4, 0xc , 0xf3, 0xcf, 0x4a, 0x4c, 0x8f, 0x5a, 0x5d, 0x37, 0xc4, 
-	0x1a, 0x4d, 0xc1, 0x11, 0x31, 0x11, 0x48, 0x7 , 0x5d, 0xbf, 0x29, 0xfa, 0xe6, 
-	0xb4, 0xa1, 0x1a, 0x7d, 0xd4, 0x79, 0x1e, 0xb8, 0xca, 0x60, 0x8f, 0xd2, 0xb5, 
-	0x8e, 0x31, 0x75, 0x89, 0xc7, 0x3c, 0x86, 0x5f, 0xf2, 0xee, 0xa2, 0x66, 0x6f, 
-	0xe3, 0x47, 0xe3, 0x5a, 0x52, 0x69, 0xb0, 0xbf, 0x16, 0xf3, 0x82, 0xdd, 0x30, 
-	0x48, 0xfe, 0x55, 0x56, 0xe2, 0xc6, 0xe2, 0x2e, 0xa9, 0x9f, 0xa7, 0xf8, 0x56, 
-	0xf0, 0xc4, 0x53, 0x96, 0xcc, 0xf3, 0xab, 0xe5, 0xb8, 0xaa, 0x3a, 0xb8, 0xdd, 
-	0x77, 0x5a, 0x95, 0xe8, 0xfc, 0x68, 0x3c, 0x1c, 0x62, 0x8f, 0xc2, 0xb6, 0x38, 
-	0x3 , 0xf1, 0xa2, 0x8f, 0xc2, 0x8a, 0x0 , 0x28, 0xa2, 0x8a, 0x0 , 0x28, 0xa2, 
-	0x8a, 0x0 , 0x28, 0xa2, 0x8a, 0x0 , 0x28, 0xa2, 0x8a, 0x0 , 0x28, 0xa2, 0x8a, 
-	0x0 , 0x28, 0xa2, 0x8a, 0x0 , 0x28, 0xa2, 0x8a, 0x0 , 0x28, 0xa2, 0x8a, 0x0 , 
-	0x28, 0xa2, 0x8a, 0x0 , 0x3f, 0x1a, 0x3f, 0x1a, 0x3f, 0xa , 0x3f, 0xa , 0x0 , 
-	0x3f, 0x1a, 0x3f, 0x1a, 0x3f, 0xa , 0x3f, 0xa , 0x0 , 0x3f, 0x1a, 0x43, 0xf5, 
-	0xa5, 0xfc, 0x28, 0xfc, 0x29, 0x80, 0xda, 0x29, 0x71, 0xed, 0x48, 0x68, 0x0 , 
-	0xa2, 0x8a, 0x29, 0x80, 0x53, 0x4d, 0x3a, 0x9a, 0x68, 0x0 , 0xa2, 0x8a, 0x28, 
-	0x0 , 0x34, 0xda, 0x75, 0x23, 0x50, 0x2 , 0x51, 0x45, 0x14, 0x0 , 0x7e, 0x34, 
-	0x7e, 0x34, 0x7e, 0x14, 0x7e, 0x14, 0x0 , 0x87, 0xeb, 0x49, 0x4e, 0xfc, 0x29, 
-	0xa6, 0x80, 0xa , 0x42, 0x29, 0x68, 0xa6, 0x3 , 0x68, 0xa2, 0x8a, 0x60, 0x21, 
-	0x34, 0x94, 0xa4, 0x52, 0x50, 0x1 , 0x47, 0xe3, 0x45, 0x1f, 0x85, 0x0 , 0x23, 
-	0x7d, 0x69, 0x29, 0x71, 0xed, 0x48, 0x68, 0x0 , 0x34, 0xda, 0x75, 0x23, 0x50, 
-	0x2 , 0x52, 0x35, 0x2d, 0x23, 0x50, 0x2 , 0x51, 0xf8, 0xd1, 0x47, 0xe1, 0x40, 
-	0x7 , 0xe3, 0x4d, 0x6a, 0x77, 0xe1, 0x4d, 0x34, 0x0 , 0x1a, 0x6d, 0x3a, 0x91, 
-	0xaa, 0x80, 0x4a, 0x46, 0xa5, 0xa4, 0x6a, 0x0 , 0x4a, 0x3f, 0x1a, 0x28, 0xfc, 
-	0x28, 0x1 , 0x1b, 0xeb, 0x49, 0x4a, 0xdf, 0x4a, 0x4a, 0x0 , 0x6e, 0x28, 0xa5, 
-	0x6a, 0x4a, 0x0 , 0x6e, 0x28, 0xa5, 0x6a, 0x4a, 0x0 , 0x3f, 0x1a, 0x3f, 0x1a, 
-	0x3f, 0xa , 0x3f, 0xa , 0x0 , 0xa3, 0x4a, 0x3e, 0xb4, 0x63, 0xda, 0x97, 0xf0, 
-	0xa9, 0x2c, 0x3f, 0x1a, 0x28, 0xa2, 0x81, 0x5 , 0x2e, 0x29, 0x71, 0x45, 0x5 , 
-	0x5 , 0x2e, 0x28, 0x5a, 0x5a, 0x91, 0x5 , 0x18, 0xf7, 0xa5, 0xc7, 0xb5, 0x2f, 
-	0xe1, 0x40, 0x7 , 0xe3, 0x47, 0xe3, 0x45, 0x14, 0x0 , 0x51, 0x8a, 0x5 , 0x3a, 
-	0x80, 0xa , 0x31, 0x40, 0xa7, 0x50, 0xc , 0x28, 0xa0, 0x52, 0xe2, 0x81, 0x8b, 
-	0xf8, 0xd1, 0xf8, 0xd1, 0xf8, 0x51, 0x40, 0x82, 0x8a, 0x29, 0x40, 0xa0, 0x0 , 
-	0xa , 0x5a, 0x29, 0x40, 0xa0, 0x41, 0x8a, 0x51, 0x45, 0x15, 0x23, 0xb0, 0x52, 
-	0x8f, 0xad, 0x18, 0xf6, 0xa5, 0xfc, 0x28, 0x0 , 0xfc, 0x68, 0xa2, 0x8a, 0x4 , 
-	0x14, 0xe1, 0x46, 0x28, 0xa0, 0x2 , 0x8c, 0x52, 0xe2, 0x96, 0x80, 0xa , 0x28, 
-	0x14, 0xbf, 0x85, 0x0 , 0x2f, 0xe3, 0x47, 0xe3, 0x47, 0xe1, 0x45, 0x0 , 0x14, 
-	0xb8, 0xa1, 0x69, 0x68, 0x0 , 0xed, 0x46, 0x28, 0x14, 0xea, 0x0 , 0x29, 0x47, 
-	0xd6, 0x91, 0x69, 0xdf, 0x85, 0x0 , 0x1f, 0x8d, 0x14, 0x51, 0x40, 0x5 , 0x2e, 
-	0x28, 0x5a, 0x5a, 0x0 , 0x28, 0xc5, 0x2 , 0x9d, 0x40, 0x5 , 0x14, 0x52, 0x81, 
-	0x40, 0x9 , 0x8f, 0x7a, 0x51, 0xf5, 0xa5, 0xfc, 0x28, 0xfc, 0x28, 0x0 , 0xfc, 
-	0x68, 0xfc, 0x68, 0xfc, 0x28, 0xa0, 0x2 , 0x8a, 0x28, 0xa0, 0x2 , 0x97, 0x14, 
-	0x74, 0xa5, 0x14, 0x0 , 0x51, 0x45, 0x14, 0x0 , 0x51, 0x41, 0x3f, 0xe7, 0xd2, 
-	0xa2, 0x69, 0x39, 0xe3, 0x9f, 0x4f, 0xfe, 0xb5, 0x4c, 0xa4, 0x92, 0xd4, 0xd2, 
-	0x9d, 0x39, 0x4d, 0xd9, 0x21, 0xec, 0xc1, 0x79, 0xcf, 0xe3, 0x4d, 0x69, 0xe , 
-	0x33, 0xd0, 0x7a, 0x9e, 0x2a, 0xb5, 0xc5, 0xd2, 0xc6, 0x71, 0x8c, 0xb7, 0xa9, 
-	0x3d, 0x2a, 0xaf, 0x9b, 0x24, 0xd2, 0x64, 0x6 , 0x73, 0xd8, 0x2f, 0x27, 0xf0, 
-	0x15, 0xc1, 0x5b, 0x1c, 0xa2, 0xed, 0x13, 0xe8, 0xb0, 0x39, 0x4 , 0xaa, 0xa5, 
-	0x2a, 0xae, 0xc8, 0xb9, 0x25, 0xd2, 0x11, 0xf2, 0x9f, 0xcf, 0xa7, 0xeb, 0x4c, 
-	0xe , 0xee, 0xf , 0x71, 0xdf, 0x9c, 0xa , 0x8e, 0xb , 0x69, 0x24, 0xe3, 0x18, 
-	0x6f, 0xee, 0xfd, 0xe3, 0xfa, 0x7f, 0x21, 0x56, 0x56, 0xc7, 0x2d, 0xb2, 0x47, 
-	0x38, 0xc6, 0x72, 0x7f, 0xc3, 0xa5, 0x71, 0x4a, 0xad, 0x59, 0xee, 0xcf, 0xa0, 
-	0xa3, 0x83, 0xc2, 0x61, 0xac, 0xa9, 0xc6, 0xec, 0xad, 0xf6, 0x88, 0x23, 0x6d, 
-	0x8c, 0x4c, 0xce, 0x7a, 0x60, 0xe1, 0x73, 0xf8, 0x72, 0x6a, 0xcd, 0xaf, 0x9e, 
-	0x99, 0x66, 0x82, 0x35, 0xdd, 0xd3, 0x81, 0x91, 0xf9, 0xd4, 0xf1, 0xdb, 0x24, 
-	0x2c, 0x16, 0x22, 0x91, 0x16, 0xfe, 0x32, 0x3e, 0x61, 0xc7, 0x6c, 0x74, 0xa7, 
-	0x29, 0x82, 0xd9, 0x95, 0xa6, 0x95, 0xa5, 0x93, 0xb2, 0xa9, 0x27, 0x3f, 0x87, 
-	0x7a, 0xcd, 0x24, 0x74, 0xca, 0x52, 0x7d, 0x6c, 0x84, 0xb4, 0x86, 0x56, 0x99, 
-	0xcc, 0x2e, 0xc5, 0xc0, 0xe4, 0x65, 0x94, 0x3 , 0xee, 0x71, 0xc5, 0x5a, 0xfb, 
-	0x2c, 0xc5, 0x37, 0x19, 0xd5, 0x7f, 0xbc, 0xd1, 0x9c, 0xf , 0xcf, 0xbd, 0x47, 
-	0x1d, 0xc4, 0xd2, 0x7c, 0x8b, 0x1a, 0xc4, 0xa4, 0x70, 0x84, 0xe4, 0xff, 0x0 , 
-	0xf5, 0xaa, 0x45, 0x54, 0x8e, 0x3 , 0x24, 0xf2, 0x6d, 0xd9, 0xc6, 0x1f, 0x3f, 
-	0xa0, 0xff, 0x0 , 0x1a, 0xd1, 0x58, 0xc6, 0x6e, 0x44, 0x52, 0x5b, 0x7c, 0xc1, 
-	0x83, 0x49, 0x20, 0x5e, 0xf9, 0xc0, 0xfc, 0xe9, 0x18, 0xfe, 0xef, 0xca, 0x12, 
-	0x28, 0x2d, 0xdd, 0x5f, 0x18, 0xfc, 0x7a, 0xd5, 0x89, 0xa5, 0x63, 0xe , 0xe5, 
-	0x8b, 0x6f, 0x60, 0x66, 0x18, 0x1f, 0x50, 0xa3, 0xfa, 0xd5, 0x68, 0x43, 0xb1, 
-	0x6d, 0xee, 0xcd, 0xbb, 0x95, 0x5d, 0x99, 0x23, 0xf0, 0x39, 0xc5, 0x3b, 0x23, 
-	0x3b, 0xc9, 0xe9, 0x72, 0x9e, 0x64, 0xfb, 0xaa, 0x25, 0xb9, 0x6c, 0xe0, 0x6d, 
-	0xc0, 0x45, 0xfa, 0x1e, 0x5 , 0x36, 0x6d, 0x91, 0xaf, 0xcc, 0xde, 0x65, 0xc1, 
-	0x1f, 0x75, 0x5f, 0x73, 0x7e, 0x25, 0xba, 0x7e, 0x15, 0x6e, 0x68, 0x64, 0xca, 
-	0xb4, 0xca, 0xcd, 0xb7, 0xee, 0xc4, 0x3b, 0x7d, 0x71, 0xd6, 0xa0, 0x91, 0x17, 
-	0x97, 0x90, 0x7c, 0xf8, 0x1f, 0x28, 0xf9, 0x7b, 0xf7, 0x1d, 0xfe, 0x82, 0xa9, 
-	0x19, 0x3b, 0x22, 0xb7, 0x98, 0xc5, 0x1d, 0x9d, 0x58, 0x15, 0x23, 0x8d, 0xdf, 
-	0x31, 0xfc, 0x7d, 0x3b, 0x75, 0xa6, 0xca, 0x55, 0xf3, 0x14, 0x67, 0xcb, 0xda, 
-	0x3e, 0x71, 0x92, 0x4e, 0x4f, 0xae, 0x30, 0x5 , 0x59, 0x99, 0x59, 0x99, 0xa4, 
-	0xb , 0xb1, 0x47, 0x64, 0x50, 0x1b, 0x3e, 0xa4, 0xf6, 0xaa, 0xd2, 0x5b, 0x4f, 
-	0x2a, 0x83, 0x1 , 0xda, 0x8d, 0xd4, 0x81, 0x81, 0xf5, 0xc9, 0xa6, 0x91, 0xe , 
-	0xa7, 0x6d, 0xcc, 0xcb, 0xa8, 0xa2, 0x19, 0x50, 0xc2, 0x4e, 0x32, 0x55, 0x24, 
-	0x50, 0x7f, 0x11, 0x55, 0x4c, 0x6c, 0x1b, 0x6 , 0xd0, 0x6d, 0xcf, 0xf0, 0xe7, 
-	0x3f, 0x89, 0x27, 0xf9, 0x56, 0xc4, 0x3a, 0x7d, 0xbf, 0xd9, 0x5d, 0xe3, 0x2d, 
-	0x23, 0x29, 0xf9, 0xa4, 0x4 , 0xed, 0xc9, 0xed, 0x9e, 0x9f, 0xa8, 0xa8, 0x27, 
-	0xb6, 0x47, 0xfd, 0xdd, 0xb0, 0x2c, 0x7 , 0xe , 0xc3, 0x90, 0xf , 0xa6, 0x68, 
-	0xd1, 0x4 , 0x63, 0x29, 0x19, 0x85, 0x97, 0x6b, 0x2b, 0x3e, 0xe3, 0x9e, 0x22, 
-	0x8d, 0x37, 0x73, 0xf5, 0xcf, 0x5a, 0x92, 0xc6, 0x6b, 0xfb, 0x46, 0x69, 0x62, 
-	0x9b, 0x69, 0xc7, 0x4f, 0x33, 0xf9, 0xe7, 0xfc, 0x69, 0xf7, 0x88, 0xb1, 0x15, 
-	0x48, 0x98, 0xb3, 0x11, 0xf3, 0x63, 0x24, 0xb7, 0xe3, 0xc6, 0x3e, 0x95, 0xc , 
-	0xea, 0x65, 0x50, 0x51, 0x36, 0x80, 0x71, 0xf3, 0x37, 0x7f, 0xc2, 0x8e, 0x61, 
-	0xba, 0x32, 0xee, 0x6c, 0x43, 0xe2, 0xa9, 0x2 , 0xac, 0x73, 0x37, 0xef, 0x7 , 
-	0x56, 0x3 , 0x70, 0xfc, 0xb8, 0xfd, 0x2b, 0x67, 0x49, 0xf1, 0x4d, 0xb3, 0x62, 
-	0x2b, 0xa9, 0x51, 0x95, 0xb8, 0xc , 0xa7, 0x8f, 0xc4, 0x1f, 0xf3, 0xef, 0x5c, 
-	0x2d, 0xc2, 0x2a, 0xf5, 0xfe, 0x79, 0x1f, 0x85, 0x43, 0x23, 0x2a, 0x9c, 0xc6, 
-	0xa3, 0x9f, 0x5e, 0x3f, 0x4a, 0x34, 0x64, 0xb5, 0x24, 0xb5, 0x67, 0xae, 0xf9, 
-	0x50, 0xdc, 0xae, 0xe4, 0x78, 0xe6, 0x56, 0x19, 0x5 , 0x48, 0x24, 0xf , 0xe7, 
-	0x59, 0xd7, 0x76, 0xa6, 0x26, 0xf9, 0x3e, 0x75, 0xc6, 0x78, 0x1f, 0xe1, 0x5c, 
-	0x3e, 0x8d, 0xe2, 0x6b, 0xab, 0x8 , 0xd2, 0x9 , 0x61, 0x49, 0xa1, 0x53, 0xc1, 
-	0x61, 0xf3, 0xa8, 0xf4, 0x6 , 0xba, 0x7b, 0x2d, 0x62, 0x2b, 0xa8, 0xd0, 0xc7, 
-	0x34, 0x8a, 0x18, 0xe5, 0x18, 0xe7, 0x3 , 0xd4, 0x1c, 0x73, 0xff, 0x0 , 0xea, 
-	0xad, 0xa9, 0xce, 0x71, 0xd9, 0xe8, 0x71, 0xe2, 0x30, 0xf8, 0x7a, 0xfa, 0x4e, 
-	0x3a, 0x96, 0x32, 0x36, 0xe7, 0x23, 0x8f, 0x7a, 0x51, 0xcf, 0x43, 0x59, 0x7a, 
-	0xad, 0xf8, 0xb7, 0xba, 0x69, 0x33, 0x1b, 0xb6, 0xdc, 0x90, 0x49, 0xc6, 0x3f, 
-	0x1f, 0xeb, 0x5c, 0xed, 0xd7, 0x88, 0x2e, 0x67, 0x99, 0x95, 0x24, 0xf2, 0x23, 
-	0x27, 0x90, 0x18, 0x2f, 0xeb, 0x8f, 0xe9, 0x5d, 0x91, 0xae, 0x9a, 0xbb, 0x3e, 
-	0x7e, 0xb6, 0x5f, 0x28, 0x4f, 0x96, 0x2e, 0xe8, 0xed, 0xbb, 0xe3, 0x34, 0x71, 
-	0xeb, 0x5e, 0x7d, 0x65, 0xaa, 0xcc, 0x93, 0x6e, 0x69, 0x49, 0x5e, 0xa7, 0x2c, 
-	0x4f, 0xff, 0x0 , 0x5e, 0xba, 0xad, 0xb , 0x56, 0x49, 0x23, 0x5 , 0xdf, 0x70, 
-	0xeb, 0x82, 0x46, 0x3f, 0x5f, 0xa8, 0xa9, 0x78, 0x9b, 0x74, 0x34, 0xa7, 0x95, 
-	0xf3, 0x6f, 0x3b, 0x1a, 0xf4, 0x55, 0xad, 0x3e, 0x5b, 0x79, 0x17, 0xcb, 0x92, 
-	0x2c, 0xf3, 0x92, 0x47, 0x6a, 0x8f, 0x50, 0xb6, 0x55, 0x6e, 0x2e, 0x2 , 0x29, 
-	0xfc, 0xf , 0xe7, 0x53, 0xf5, 0xc8, 0x75, 0x46, 0xd2, 0xc8, 0xeb, 0x5a, 0xf0, 
-	0x92, 0x7f, 0x81, 0xd , 0x14, 0x92, 0x48, 0x88, 0x4a, 0xb3, 0x63, 0x1c, 0x2 , 
-	0x73, 0xfe, 0x35, 0x1 , 0x9b, 0xe7, 0x2b, 0xb8, 0x31, 0xfe, 0x1c, 0x8a, 0xd6, 
-	0x35, 0xe3, 0x2d, 0x8e, 0x4a, 0xb9, 0x6d, 0x5a, 0x5f, 0x19, 0x62, 0x8a, 0x8b, 
-	0xcc, 0xb , 0xb5, 0x8e, 0x76, 0x1e, 0xfe, 0x95, 0x2f, 0xb8, 0xe9, 0xea, 0x2b, 
-	0x55, 0x24, 0xce, 0x19, 0xd3, 0x71, 0xa , 0x28, 0xa2, 0xa8, 0x80, 0xa2, 0x8a, 
-	0x28, 0x0 , 0xa2, 0x8a, 0x28, 0x0 , 0xa2, 0x8a, 0x28, 0x0 , 0xa2, 0x8a, 0x28, 
-	0x0 , 0xa3, 0xf1, 0xa2, 0x8f, 0xc2, 0x80, 0xf , 0xc6, 0x8f, 0xc6, 0x8f, 0xc2, 
-	0x8f, 0xc2, 0x80, 0xf , 0xc6, 0x8f, 0xc6, 0x8f, 0xc2, 0x8f, 0xc2, 0x80, 0x10, 
-	0xfd, 0x69, 0x28, 0xcf, 0xb5, 0x14, 0x0 , 0x51, 0x45, 0x14, 0x0 , 0x52, 0x11, 
-	0x4b, 0x45, 0x3b, 0x80, 0xda, 0x28, 0xa2, 0x98, 0x5 , 0x21, 0x14, 0xbc, 0xd1, 
-	0x40, 0xd , 0xa2, 0x8a, 0x28, 0x0 , 0xa3, 0xf1, 0xa2, 0x8f, 0xc2, 0x80, 0xf , 
-	0xc6, 0x90, 0xfd, 0x69, 0x7f, 0xa , 0x43, 0xf4, 0xa0, 0x4 , 0xa2, 0x8a, 0x28, 
-	0x1 , 0x1a, 0x92, 0x95, 0xa9, 0x29, 0xa0, 0x11, 0xa9, 0x29, 0xd4, 0xd3, 0x4c, 
-	0x2 , 0x8f, 0xc6, 0x8a, 0x3f, 0xa , 0x0 , 0x3f, 0x1a, 0x6b, 0x53, 0xbf, 0xa , 
-	0x69, 0xa0, 0x2 , 0x8c, 0xd1, 0x46, 0x28, 0x1 , 0xb4, 0x51, 0x45, 0x0 , 0x36, 
-	0x8a, 0x28, 0xa0, 0x3 , 0xf1, 0xa4, 0x3f, 0x5a, 0x5f, 0xc2, 0x8f, 0xc2, 0x80, 
-	0x1b, 0x48, 0xd4, 0xb4, 0x62, 0x80, 0x1b, 0x48, 0xd4, 0xb4, 0x62, 0x80, 0x1b, 
-	0x47, 0xe3, 0x45, 0x1f, 0x85, 0x34, 0x2 , 0x1f, 0xad, 0x25, 0x3b, 0xf0, 0xa6, 
-	0x9a, 0x60, 0x23, 0x52, 0x53, 0xa9, 0xa6, 0x80, 0x3 , 0x4d, 0xa7, 0x1a, 0x6d, 
-	0x0 , 0x14, 0x7e, 0x34, 0x51, 0xf8, 0x50, 0x5 , 0x3f, 0xc6, 0x8a, 0x3f, 0xa , 
-	0x2a, 0x4b, 0xa , 0x31, 0x40, 0xa7, 0x50, 0x1 , 0x46, 0x28, 0x14, 0xea, 0x90, 
-	0xa , 0x28, 0x14, 0xbf, 0x85, 0x2 , 0x17, 0xf1, 0xa3, 0xf1, 0xa3, 0xf0, 0xa2, 
-	0x81, 0x85, 0x18, 0xa1, 0x69, 0xd4, 0x0 , 0x51, 0x8a, 0x5 , 0x3a, 0x81, 0x85, 
-	0x18, 0xf7, 0xa1, 0x69, 0xdf, 0x85, 0x0 , 0x1f, 0x8d, 0x1f, 0x8d, 0x1f, 0x85, 
-	0x14, 0x8 , 0x28, 0xa0, 0x52, 0xe2, 0x80, 0xe8, 0x2d, 0x14, 0xa , 0x5c, 0x50, 
-	0x1d, 0x0 , 0xa , 0x5a, 0x5 , 0x2e, 0x29, 0x5c, 0x4 , 0xc7, 0xbd, 0x2f, 0xe3, 
-	0x4b, 0xf8, 0x51, 0xf8, 0x52, 0x0 , 0xa2, 0x8a, 0x50, 0x28, 0x0 , 0xc5, 0x28, 
-	0xa2, 0x8a, 0x3 , 0xa0, 0xb8, 0xa5, 0x14, 0x52, 0x81, 0x40, 0x84, 0xa5, 0x1f, 
-	0x5a, 0x31, 0xed, 0x4b, 0xf8, 0x50, 0x1 , 0xf8, 0xd1, 0x47, 0xe1, 0x45, 0x0 , 
-	0x14, 0x62, 0x97, 0x14, 0xb4, 0x0 , 0x51, 0x8a, 0x5 , 0x3a, 0x80, 0xa , 0x31, 
-	0xef, 0x42, 0xd3, 0xbf, 0xa , 0x0 , 0x3f, 0x1a, 0x28, 0xa2, 0x80, 0xa , 0x72, 
-	0xf1, 0x46, 0x28, 0xa0, 0x2 , 0x95, 0x69, 0x29, 0xc2, 0x80, 0xa , 0x28, 0x14, 
-	0xb8, 0xa0, 0x0 , 0x7d, 0x69, 0x7f, 0x1a, 0x3f, 0xa , 0x3f, 0xa , 0x0 , 0x3f, 
-	0x1a, 0x28, 0xfc, 0x28, 0xa0, 0x2 , 0x8a, 0x28, 0xa0, 0x2 , 0x9c, 0x28, 0xc5, 
-	0x14, 0x0 , 0x51, 0x45, 0x14, 0x0 , 0x53, 0x5c, 0x80, 0x32, 0xc7, 0x8a, 0x59, 
-	0x1c, 0x20, 0xcf, 0xb7, 0x4a, 0xc8, 0xbe, 0xbd, 0x32, 0x96, 0x55, 0x3f, 0x2a, 
-	0x9f, 0xbd, 0xda, 0xb2, 0xa9, 0x51, 0x41, 0x5d, 0x9d, 0x78, 0x5c, 0x2c, 0xeb, 
-	0xca, 0xd1, 0x45, 0xab, 0x8b, 0xa1, 0xd1, 0x39, 0xfa, 0xe , 0x2a, 0xa4, 0xd7, 
-	0x72, 0x36, 0x42, 0x90, 0xab, 0xd0, 0xb1, 0x3f, 0xd6, 0xab, 0x17, 0x63, 0xf2, 
-	0xf2, 0xcc, 0xdc, 0x4 , 0x7 , 0xf9, 0xff, 0x0 , 0x85, 0x5e, 0xd3, 0x6c, 0x58, 
-	0xbe, 0xf9, 0x8e, 0x64, 0x3 , 0xee, 0x81, 0xc8, 0xf6, 0x3 , 0xb5, 0x79, 0x55, 
-	0x6b, 0xce, 0x7b, 0x6c, 0x7d, 0x9e, 0xf , 0x2f, 0xa3, 0x87, 0x8d, 0xe4, 0xae, 
-	0xc8, 0xed, 0x60, 0x79, 0x9f, 0x6a, 0x83, 0xbb, 0xb2, 0xff, 0x0 , 0x16, 0x3d, 
-	0x71, 0xd8, 0x7d, 0x6b, 0x6b, 0x4e, 0xd2, 0xce, 0x3 , 0x4c, 0x1b, 0xb , 0xc9, 
-	0x55, 0xef, 0xf5, 0xff, 0x0 , 0xe , 0x95, 0x62, 0x8 , 0xac, 0xec, 0x23, 0x5 , 
-	0xb6, 0xab, 0x37, 0x25, 0x41, 0xc1, 0xfc, 0x4f, 0x39, 0x3f, 0x9d, 0x47, 0x71, 
-	0xa9, 0x6d, 0x60, 0x22, 0x41, 0x83, 0xd8, 0xf , 0xf3, 0x8f, 0xc6, 0xb1, 0x51, 
-	0x48, 0xf4, 0x25, 0x27, 0x22, 0xc5, 0xca, 0x43, 0x2 , 0x6d, 0x49, 0x3e, 0x4c, 
-	0xfd, 0xd4, 0x3b, 0x73, 0xf5, 0x3d, 0xea, 0x9d, 0xd5, 0xf2, 0xb7, 0xee, 0xd4, 
-	0x5 , 0xc7, 0x41, 0x9c, 0x7f, 0xf5, 0xea, 0xad, 0xcc, 0xcf, 0xe6, 0x6e, 0x9a, 
-	0x43, 0x1f, 0x1d, 0x9 , 0xe7, 0xd8, 0x63, 0xb7, 0xd3, 0xad, 0x67, 0x5e, 0x5f, 
-	0x16, 0xfd, 0xdc, 0x1c, 0x67, 0x83, 0xd8, 0xe2, 0xa1, 0xc8, 0xb8, 0xc6, 0xcf, 
-	0xcc, 0xb9, 0x79, 0x78, 0x11, 0x8a, 0xaf, 0xde, 0xc6, 0x78, 0x1c, 0xfe, 0x7d, 
-	0xaa, 0x5 , 0xb9, 0x7d, 0xd9, 0x69, 0x3e, 0xf6, 0x3e, 0x55, 0xe3, 0xf3, 0x35, 
-	0x44, 0xc9, 0x8e, 0x4f, 0x1e, 0xfe, 0xb4, 0xe8, 0xd8, 0xb7, 0x20, 0xd , 0xbe, 
-	0xb9, 0xfe, 0x75, 0x1c, 0xc6, 0xaa, 0x1d, 0x8d, 0x48, 0xee, 0x76, 0x49, 0xf2, 
-	0xc8, 0x6 , 0x3a, 0x81, 0x82, 0x47, 0xf9, 0xf7, 0xfc, 0xaa, 0x68, 0xee, 0x11, 
-	0x98, 0x3b, 0x3b, 0x1 , 0x9c, 0x79, 0x92, 0x1f, 0xe4, 0x3b, 0x7d, 0x7f, 0x21, 
-	0x58, 0xe6, 0x74, 0x8d, 0xb , 0x29, 0xdc, 0x47, 0x7e, 0xdf, 0x97, 0xf8, 0x73, 
-	0x4e, 0x86, 0x69, 0x9d, 0xb7, 0xe1, 0xc8, 0x5e, 0x99, 0xea, 0x33, 0xe9, 0xe9, 
-	0x5a, 0x45, 0xe8, 0x63, 0x52, 0x2a, 0xfa, 0xea, 0x74, 0xb , 0x3d, 0xb8, 0x8c, 
-	0xc8, 0xec, 0xca, 0x8b, 0xdd, 0x86, 0xd2, 0x7e, 0x99, 0xff, 0x0 , 0xa , 0x8f, 
-	0xed, 0x71, 0xb8, 0xfd, 0xc2, 0x79, 0x48, 0xc7, 0x69, 0x7e, 0x87, 0xf1, 0xee, 
-	0x6b, 0x17, 0xcc, 0xf2, 0x94, 0x3b, 0xb2, 0xa9, 0x27, 0x23, 0xbb, 0xf , 0xa7, 
-	0xff, 0x0 , 0x5e, 0xa6, 0x92, 0xe6, 0xe4, 0xb2, 0xaa, 0x6 , 0x66, 0x3d, 0xf1, 
-	0xf3, 0x2e, 0x7d, 0x3d, 0x3f, 0x2e, 0x3d, 0xeb, 0x44, 0x71, 0xcd, 0xe9, 0xa1, 
-	0xad, 0x23, 0x84, 0xb7, 0xdc, 0xee, 0x8a, 0x72, 0x32, 0x4a, 0x96, 0x6f, 0x6e, 
-	0xf , 0x7f, 0x6e, 0x6a, 0x6 , 0x65, 0x91, 0x48, 0x94, 0xb2, 0x86, 0x3c, 0xe7, 
-	0xef, 0x7e, 0x3d, 0x36, 0xfe, 0x9f, 0x4a, 0xad, 0xc , 0x33, 0xc9, 0x96, 0x90, 
-	0x31, 0x75, 0xc9, 0x6c, 0x67, 0x72, 0x93, 0xef, 0x8e, 0x3f, 0x4a, 0x9f, 0xec, 
-	0xce, 0x57, 0x76, 0x1e, 0x42, 0xa3, 0x84, 0x8c, 0x74, 0xfc, 0x7 , 0x6f, 0x5e, 
-	0x6a, 0x94, 0x89, 0xf6, 0x57, 0xdc, 0xb3, 0x9 , 0x3b, 0x99, 0x62, 0x8d, 0x0 , 
-	0x0 , 0x65, 0xd9, 0x7f, 0xc7, 0xa5, 0x2c, 0xc9, 0x0 , 0x8f, 0xcc, 0x9e, 0x40, 
-	0xdf, 0x37, 0x42, 0xdf, 0x29, 0x3e, 0xca, 0x3a, 0xd5, 0x65, 0x66, 0xcf, 0x96, 
-	0xed, 0xb1, 0xb3, 0xf2, 0x46, 0xbc, 0xfd, 0x3a, 0x71, 0xfa, 0x54, 0xbb, 0xa1, 
-	0x82, 0x16, 0x9e, 0xe3, 0x1 , 0xc2, 0x9c, 0x96, 0x52, 0xcd, 0xff, 0x0 , 0xd6, 
-	0xfc, 0xea, 0x6e, 0xcb, 0x8c, 0x62, 0x96, 0x81, 0x78, 0xd1, 0xa4, 0x7b, 0xc4, 
-	0x4e, 0xed, 0x9e, 0x41, 0x38, 0x54, 0xfc, 0xce, 0x7 , 0xe4, 0x4f, 0xb5, 0x50, 
-	0xb8, 0xc , 0xf6, 0xfb, 0x5b, 0x66, 0xe6, 0xe4, 0x6e, 0xec, 0x3d, 0x0 , 0x3f, 
-	0xfd, 0x6a, 0xb0, 0xb7, 0x3e, 0x6c, 0x7e, 0x7c, 0x76, 0x8d, 0xe5, 0x8f, 0xf5, 
-	0x6f, 0x2b, 0x85, 0x5f, 0x63, 0x81, 0xd0, 0x54, 0x8d, 0x24, 0x20, 0x6 , 0x13, 
-	0xa6, 0xf2, 0x73, 0x23, 0x85, 0xe7, 0x3e, 0xc2, 0xa8, 0x8b, 0xdf, 0x6d, 0x8c, 
-	0x3f, 0xb2, 0x4a, 0x17, 0x74, 0x88, 0xcb, 0xbb, 0xee, 0x7 , 0x23, 0xf3, 0xda, 
-	0x3a, 0x7e, 0x75, 0x4e, 0xea, 0x1b, 0xd7, 0x51, 0x1f, 0x9b, 0xe5, 0xc6, 0x49, 
-	0xa , 0xa9, 0xce, 0x7d, 0x89, 0x1c, 0x7f, 0x4a, 0xdd, 0x9a, 0x55, 0x9a, 0x3c, 
-	0x2c, 0x5b, 0x99, 0xf3, 0xfb, 0xc7, 0x60, 0xa0, 0x8f, 0x5c, 0x1e, 0x71, 0xf5, 
-	0xfc, 0xaa, 0x9b, 0xda, 0x6e, 0x2d, 0xe7, 0x5d, 0x46, 0x8a, 0x6 , 0xa , 0xa2, 
-	0x96, 0x72, 0x3e, 0x87, 0xfa, 0xe2, 0xaa, 0xe6, 0x4d, 0x37, 0xe8, 0x61, 0x4d, 
-	0x67, 0xb3, 0xef, 0xcc, 0x3 , 0x63, 0x3b, 0x72, 0x3f, 0x52, 0x2a, 0x12, 0x8b, 
-	0xb4, 0xb6, 0x5b, 0x8f, 0x50, 0x31, 0xf9, 0x93, 0x5a, 0xd3, 0xda, 0x44, 0xbb, 
-	0x91, 0x61, 0xa , 0xb9, 0xe0, 0xca, 0xe7, 0x24, 0x7f, 0xba, 0x8 , 0xe7, 0xeb, 
-	0x8a, 0xab, 0x7d, 0x15, 0xb4, 0x6a, 0x3 , 0x9 , 0x24, 0x7e, 0x30, 0x7 , 0x7 , 
-	0xf9, 0x7f, 0x8d, 0x4 , 0xd9, 0xa3, 0x2d, 0x88, 0xcf, 0x1b, 0x5b, 0x3f, 0xaf, 
-	0xf4, 0xa6, 0xc5, 0x7d, 0x71, 0x6c, 0xac, 0xa8, 0xdf, 0x2b, 0x75, 0x4e, 0xd9, 
-	0xfe, 0x86, 0xac, 0x4f, 0x23, 0x74, 0xc7, 0x94, 0xbe, 0x84, 0x62, 0xaa, 0xcc, 
-	0x3 , 0x7d, 0xf6, 0xfc, 0x6b, 0x48, 0xb3, 0x9a, 0xb5, 0x3b, 0xad, 0x19, 0x62, 
-	0xd7, 0x55, 0xf3, 0x54, 0xaf, 0x94, 0xcc, 0xc7, 0x8c, 0x67, 0xf2, 0xc9, 0x3d, 
-	0x7 , 0xe9, 0x51, 0x5e, 0xc2, 0xa9, 0x82, 0x1b, 0xe6, 0x6e, 0x70, 0x4f, 0x51, 
-	0xec, 0x3d, 0x2a, 0x93, 0xac, 0x91, 0xcd, 0xc1, 0xc7, 0xd0, 0xd5, 0xa8, 0xae, 
-	0xbf, 0x72, 0xaa, 0xc4, 0x70, 0x78, 0x18, 0xad, 0x65, 0xb6, 0x87, 0x5 , 0x14, 
-	0xf9, 0x9a, 0xa8, 0xf6, 0x8 , 0x63, 0xc1, 0xcb, 0x70, 0xc3, 0x9a, 0xd4, 0xd2, 
-	0xe4, 0x2b, 0xcf, 0xef, 0x1b, 0xfd, 0xa5, 0xe7, 0x3 , 0xf0, 0xaa, 0xb , 0x3a, 
-	0x8c, 0x31, 0x6f, 0xae, 0x57, 0x18, 0xab, 0xb6, 0xf3, 0x5a, 0xbc, 0x83, 0x61, 
-	0x55, 0xc8, 0xe7, 0x83, 0xfc, 0xfb, 0x7e, 0xb5, 0x84, 0x9c, 0x8f, 0x4e, 0x92, 
-	0xa4, 0xf4, 0x4c, 0xea, 0xb4, 0x1b, 0xa4, 0xd , 0xe6, 0xa9, 0xdc, 0xc3, 0x83, 
-	0x9e, 0x8 , 0xfa, 0x83, 0x5b, 0x1e, 0x6d, 0xbc, 0xca, 0xd1, 0xc2, 0xe1, 0x64, 
-	0x5f, 0xbc, 0x46, 0x6 , 0x4f, 0xd3, 0x1c, 0xfe, 0xb5, 0xca, 0x5a, 0xcc, 0x85, 
-	0x78, 0x99, 0x53, 0x6f, 0x39, 0x63, 0xc0, 0xfc, 0x7b, 0x56, 0xcd, 0x94, 0x6b, 
-	0x30, 0x5f, 0x29, 0xa2, 0x76, 0x3 , 0x98, 0x98, 0x6d, 0x27, 0xe8, 0x45, 0x64, 
-	0xd9, 0xdd, 0x4e, 0x16, 0xdb, 0x52, 0xcd, 0xf0, 0x99, 0x48, 0xf , 0xb4, 0x83, 
-	0xfe, 0x7a, 0x1a, 0xad, 0x98, 0x8f, 0xc8, 0xea, 0x51, 0xcf, 0x4f, 0x9b, 0x19, 
-	0x35, 0x79, 0x3f, 0x7a, 0xcc, 0x88, 0xf2, 0x23, 0xe , 0xb1, 0x39, 0xe3, 0x1f, 
-	0x8f, 0x6a, 0x8e, 0x7b, 0x2f, 0x35, 0x5b, 0x36, 0xc0, 0xb0, 0xef, 0x9e, 0x7f, 
-	0x21, 0xc1, 0xa8, 0xd6, 0x3a, 0xa3, 0x6b, 0x42, 0xa2, 0xb3, 0x2a, 0xdb, 0xc8, 
-	0xd0, 0x1f, 0x2e, 0x43, 0xb9, 0xf , 0x20, 0x8e, 0x71, 0xeb, 0xd3, 0xb5, 0x48, 
-	0xae, 0x63, 0x6c, 0x2f, 0xcc, 0x87, 0x91, 0xb4, 0xe7, 0x23, 0xda, 0xa3, 0xf , 
-	0x14, 0x4a, 0xc8, 0x40, 0x8d, 0xbb, 0xee, 0xe7, 0xf1, 0xc8, 0xed, 0xfe, 0x73, 
-	0x50, 0xee, 0x68, 0xdb, 0x70, 0xdb, 0xb5, 0x8e, 0x48, 0xea, 0xa4, 0xd7, 0x5d, 
-	0x1c, 0x55, 0xac, 0xa4, 0x78, 0x98, 0xdc, 0x9a, 0xf7, 0x9d, 0x15, 0xbf, 0x43, 
-	0x45, 0x48, 0x65, 0xc , 0xe , 0x41, 0x1c, 0x52, 0xd5, 0x5b, 0x59, 0xbf, 0x78, 
-	0x54, 0xf0, 0x1b, 0x90, 0x9 , 0xfc, 0xf1, 0x56, 0x8d, 0x7a, 0x71, 0x92, 0x92, 
-	0x3e, 0x52, 0xb5, 0x19, 0x53, 0x95, 0x98, 0x51, 0x45, 0x15, 0x46, 0x21, 0x45, 
-	0x14, 0x50, 0x1 , 0x45, 0x14, 0x50, 0x1 , 0x45, 0x14, 0x50, 0x1 , 0x45, 0x14, 
-	0x50, 0x1 , 0x9a, 0x3f, 0x1a, 0x3f, 0xa , 0x3f, 0xa , 0x0 , 0x3f, 0x1a, 0x3f, 
-	0x1a, 0x3f, 0xa , 0x3f, 0xa , 0x0 , 0x43, 0xf5, 0xa3, 0xa5, 0x2f, 0xe1, 0x49, 
-	0x8f, 0x6a, 0x0 , 0x4a, 0x29, 0x48, 0xa4, 0xa0, 0x2 , 0x8a, 0x28, 0xa0, 0x6 , 
-	0x8a, 0xd , 0x2 , 0x83, 0x4e, 0xe0, 0x14, 0x51, 0x45, 0x0 , 0x37, 0x14, 0x52, 
-	0xb5, 0x25, 0x30, 0xa , 0x3f, 0x1a, 0x28, 0xfc, 0x28, 0x0 , 0xfc, 0x68, 0xfc, 
-	0x68, 0xfc, 0x28, 0xfc, 0x28, 0x1 , 0x1b, 0xeb, 0x49, 0x4a, 0xdf, 0x4a, 0x4a, 
-	0x0 , 0xd , 0x36, 0x9c, 0x69, 0xb4, 0x0 , 0x52, 0x11, 0x4b, 0x48, 0x4d, 0x30, 
-	0x12, 0x8f, 0xc6, 0x8a, 0x28, 0xb8, 0x7 , 0xe3, 0x48, 0x7e, 0xb4, 0xbf, 0x85, 
-	0x1f, 0x85, 0x30, 0x1b, 0x45, 0x14, 0x50, 0x3 , 0x71, 0x45, 0x19, 0xa2, 0x80, 
-	0x1b, 0x45, 0x14, 0x50, 0x1 , 0xf8, 0xd1, 0xf8, 0xd1, 0xf8, 0x51, 0xf8, 0x50, 
-	0x3 , 0x68, 0xa2, 0x8a, 0x0 , 0x6d, 0x14, 0x51, 0x40, 0xd , 0xa2, 0x8a, 0x28, 
-	0x0 , 0xfc, 0x69, 0xad, 0x4e, 0xfc, 0x29, 0xa6, 0x98, 0x5 , 0x23, 0x52, 0xd2, 
-	0x35, 0x30, 0x12, 0x91, 0xa9, 0x69, 0x1a, 0x80, 0x12, 0x8f, 0xc6, 0x8a, 0x3f, 
-	0xa , 0x0 , 0xa7, 0x4a, 0xd , 0x20, 0xa5, 0xc5, 0x49, 0xa0, 0xb4, 0x62, 0x85, 
-	0xa7, 0x52, 0x10, 0x51, 0x40, 0xa7, 0x7e, 0x14, 0x80, 0x3f, 0x1a, 0x3f, 0x1a, 
-	0x3f, 0xa , 0x28, 0x0 , 0xa3, 0x14, 0xa , 0x75, 0x0 , 0x14, 0x62, 0x81, 0x4e, 
-	0xa0, 0x61, 0x4a, 0x3e, 0xb4, 0x82, 0x9d, 0xf8, 0x50, 0x20, 0xfc, 0x68, 0xfc, 
-	0x68, 0xfc, 0x28, 0xa0, 0x61, 0x46, 0x28, 0x5a, 0x75, 0x0 , 0x20, 0x14, 0xb8, 
-	0xa0, 0x53, 0xa8, 0x24, 0x40, 0x29, 0x68, 0x14, 0xef, 0xc2, 0x86, 0x50, 0x83, 
-	0xeb, 0x4b, 0xf8, 0xd1, 0xf8, 0x51, 0x52, 0x20, 0xa2, 0x8a, 0x50, 0x28, 0x0 , 
-	0x2 , 0x96, 0x8a, 0x50, 0x28, 0x0 , 0x2 , 0x96, 0x8a, 0x50, 0x28, 0x0 , 0x1f, 
-	0x5a, 0x5f, 0xc6, 0x8f, 0xc2, 0x8f, 0xc2, 0x81, 0x7 , 0xe3, 0x45, 0x14, 0xa0, 
-	0x50, 0x31, 0x29, 0xcb, 0xe9, 0x46, 0x28, 0xa0, 0x41, 0x4e, 0x14, 0x62, 0x8a, 
-	0x0 , 0x29, 0x47, 0xd6, 0x8c, 0x7b, 0x52, 0xfe, 0x14, 0x0 , 0x7e, 0x34, 0x51, 
-	0xf8, 0x51, 0x40, 0x5 , 0x2a, 0xd1, 0x8a, 0x5a, 0x0 , 0x28, 0xa2, 0x94, 0xa , 
-	0x0 , 0x0 , 0xa5, 0xa0, 0x52, 0xe2, 0x80, 0x1 , 0xf5, 0xa5, 0xfc, 0x68, 0xfc, 
-	0x28, 0xfc, 0x28, 0x0 , 0xfc, 0x68, 0xa2, 0x8a, 0x0 , 0x28, 0xa2, 0x94, 0xa , 
-	0x0 , 0x4a, 0x55, 0xa3, 0x14, 0xb4, 0x0 , 0x51, 0x45, 0x14, 0x0 , 0x54, 0x57, 
-	0x12, 0xac, 0x60, 0xf3, 0xd0, 0x64, 0x9a, 0x2e, 0xe6, 0x10, 0xc6, 0x30, 0x7e, 
-	0x66, 0xe9, 0xec, 0x3b, 0x9a, 0xe7, 0xb5, 0x4d, 0x45, 0x5f, 0xe4, 0x8b, 0xe6, 
-	0x55, 0x39, 0x2d, 0xdb, 0x3f, 0xd4, 0xd6, 0x55, 0x2a, 0x28, 0x23, 0xaf, 0xb , 
-	0x84, 0x9d, 0x79, 0x59, 0x6c, 0x4d, 0xaa, 0x5f, 0x34, 0x80, 0x80, 0x76, 0xaf, 
-	0x7c, 0xe , 0xbf, 0x5a, 0xaf, 0x6a, 0x8f, 0x22, 0x97, 0xc8, 0x55, 0xfe, 0xf3, 
-	0x8e, 0x9f, 0xe2, 0x6a, 0xad, 0x98, 0x33, 0xb1, 0x9e, 0x4c, 0x94, 0xcf, 0x43, 
-	0xfc, 0x67, 0xfc, 0x2b, 0x52, 0xdf, 0xc , 0xdb, 0xe5, 0xfb, 0x9d, 0x42, 0xa9, 
-	0xe4, 0xfb, 0xfb, 0xa , 0xf2, 0xaa, 0xcd, 0xc9, 0xde, 0x47, 0xda, 0xe0, 0xf0, 
-	0xf0, 0xa3, 0x15, 0x1a, 0x68, 0xb3, 0xa5, 0xc3, 0x9c, 0xec, 0x2c, 0x9f, 0xde, 
-	0x7e, 0xae, 0xc7, 0xb8, 0xcf, 0x6f, 0xc3, 0x9f, 0x53, 0x5a, 0xab, 0x71, 0x14, 
-	0x10, 0xf9, 0x76, 0x88, 0x1 , 0x5f, 0xbc, 0xde, 0x87, 0x1e, 0xb5, 0x96, 0xb3, 
-	0xae, 0xde, 0x48, 0x44, 0x51, 0x8d, 0x8b, 0xd4, 0xfb, 0x1f, 0xf0, 0xaa, 0xd3, 
-	0x5c, 0xb4, 0xc7, 0xcb, 0x41, 0xb5, 0x73, 0x9c, 0x2f, 0x4f, 0xa9, 0xac, 0x77, 
-	0x3b, 0xad, 0xca, 0x8b, 0xf3, 0x5c, 0x2b, 0xc8, 0xcc, 0xef, 0xbb, 0x9e, 0x58, 
-	0xf7, 0x3e, 0xd5, 0x5e, 0x4b, 0xb1, 0x10, 0xdd, 0xbf, 0x67, 0xf3, 0xfc, 0x3d, 
-	0x3e, 0xb5, 0x46, 0x7b, 0xb0, 0xa7, 0x6c, 0x5d, 0x57, 0xab, 0x55, 0x56, 0x66, 
-	0x91, 0xb7, 0x1e, 0x33, 0xd7, 0xff, 0x0 , 0xad, 0x40, 0xe2, 0xbb, 0x6e, 0x58, 
-	0xb8, 0xb9, 0x69, 0x1f, 0x20, 0x6d, 0x1f, 0xc2, 0x33, 0x51, 0x33, 0x63, 0x27, 
-	0xa9, 0x3c, 0xe0, 0xf7, 0xff, 0x0 , 0x1a, 0x8f, 0x71, 0x6e, 0x13, 0x9f, 0xf6, 
-	0xaa, 0x75, 0x51, 0x1c, 0x7b, 0xba, 0xb1, 0xc7, 0x7f, 0xe6, 0x6b, 0x36, 0x6d, 
-	0x18, 0xf5, 0xbe, 0x82, 0xa3, 0x6d, 0x52, 0xd3, 0x71, 0xfe, 0x7f, 0x9d, 0x2a, 
-	0xee, 0x75, 0x25, 0x8e, 0xc8, 0xcf, 0x62, 0x79, 0xa8, 0x55, 0xdd, 0xdb, 0x85, 
-	0xdc, 0x7b, 0x1 , 0x4e, 0x8e, 0x16, 0x96, 0x50, 0x65, 0x25, 0x82, 0xff, 0x0 , 
-	0x0 , 0xfe, 0xbe, 0x94, 0xad, 0xdc, 0x25, 0x51, 0x35, 0x68, 0xa1, 0xfe, 0x62, 
-	0x22, 0xf , 0x2a, 0x2d, 0xcc, 0x3b, 0x91, 0x90, 0x3d, 0xfd, 0x3f, 0x3a, 0xb5, 
-	0xd , 0xbd, 0xcb, 0x15, 0x32, 0x1f, 0x99, 0x8e, 0x70, 0xed, 0xb5, 0x71, 0x8f, 
-	0x41, 0xc9, 0xfc, 0x29, 0x6c, 0xa1, 0x8 , 0xfb, 0xa4, 0x70, 0x72, 0x7e, 0x40, 
-	0xbd, 0xbf, 0x13, 0xfd, 0x5 , 0x69, 0xc1, 0xb9, 0x32, 0xe9, 0x17, 0x94, 0xf , 
-	0xfc, 0xb5, 0x73, 0xc9, 0xfa, 0xe6, 0xab, 0xd0, 0xc5, 0xc1, 0xbd, 0x64, 0x3e, 
-	0xc3, 0x4f, 0x8a, 0x35, 0xdc, 0xe5, 0x8b, 0xa7, 0x25, 0x84, 0x61, 0x7f, 0x9f, 
-	0x23, 0xf1, 0xab, 0x90, 0xc0, 0x8e, 0x3f, 0x76, 0x36, 0xaf, 0xf7, 0x81, 0xdb, 
-	0xb8, 0xe7, 0x9f, 0xbb, 0xd7, 0xf3, 0xa2, 0x39, 0x23, 0x8f, 0xab, 0xb3, 0x48, 
-	0x47, 0xca, 0x30, 0x4e, 0x3f, 0xa5, 0x3b, 0x73, 0xa0, 0x2d, 0xfe, 0xb0, 0x7a, 
-	0x3b, 0x7d, 0xd3, 0xef, 0x8f, 0xf0, 0xab, 0x4d, 0x33, 0x39, 0x45, 0xc7, 0xd0, 
-	0x74, 0xe7, 0x6f, 0xee, 0xe1, 0x48, 0x54, 0x3 , 0xc0, 0x6e, 0x3f, 0xfa, 0xf5, 
-	0x4 , 0x71, 0xb4, 0x9b, 0xb7, 0xc3, 0x2c, 0x80, 0x7f, 0x1c, 0x83, 0x62, 0x8f, 
-	0xcb, 0x93, 0xf8, 0xd4, 0xb3, 0x4d, 0x20, 0x56, 0x75, 0x54, 0x8c, 0xf5, 0xfb, 
-	0xb8, 0x0 , 0x7f, 0x9f, 0x63, 0x55, 0x5a, 0x43, 0x39, 0xf3, 0xe5, 0x95, 0x99, 
-	0x71, 0x95, 0xd , 0xc6, 0xef, 0xa7, 0x4a, 0xb4, 0x73, 0x4a, 0xd7, 0x2d, 0x49, 
-	0xb5, 0x24, 0x48, 0xd6, 0x31, 0x1c, 0x92, 0x75, 0x9 , 0x80, 0x71, 0xef, 0x8e, 
-	0xbf, 0xad, 0x47, 0x34, 0x56, 0xc9, 0x21, 0xdf, 0xb4, 0xb2, 0xf1, 0x86, 0x8c, 
-	0xb9, 0x7 , 0xd7, 0xd2, 0x96, 0x19, 0xc , 0x43, 0xcb, 0x45, 0x31, 0x2b, 0x28, 
-	0xe5, 0xb0, 0x85, 0x8e, 0x39, 0x19, 0xeb, 0xf9, 0x66, 0x98, 0xf2, 0xc7, 0x2c, 
-	0x60, 0x29, 0x5d, 0xab, 0xd7, 0xca, 0x24, 0x81, 0xed, 0xbb, 0xd6, 0x99, 0x9f, 
-	0x32, 0x2b, 0x32, 0x47, 0x3a, 0x30, 0x65, 0x9a, 0x4d, 0x9f, 0x32, 0xe1, 0x78, 
-	0x5f, 0xa6, 0x3a, 0x7e, 0x75, 0x2 , 0x3d, 0xba, 0xbe, 0xe5, 0x52, 0x58, 0xf4, 
-	0x40, 0x9b, 0xb1, 0xf5, 0xfe, 0x10, 0x7d, 0xf0, 0x4d, 0x68, 0x4f, 0x1e, 0xd8, 
-	0x5a, 0x49, 0x18, 0x26, 0x4e, 0x17, 0xcd, 0xe4, 0xf , 0xc0, 0x75, 0xfc, 0x6a, 
-	0xa7, 0xef, 0x61, 0x84, 0x86, 0xb9, 0x64, 0x4c, 0xf3, 0xe4, 0x46, 0xb1, 0x67, 
-	0xf2, 0xe7, 0x9f, 0xad, 0x3b, 0x9 , 0xc9, 0xa2, 0xb4, 0xb1, 0xb4, 0x9b, 0xb7, 
-	0x42, 0xb1, 0xf3, 0xcc, 0xb2, 0x9c, 0xf3, 0xe9, 0xed, 0x8a, 0xcd, 0x9c, 0x97, 
-	0x93, 0x6a, 0x4d, 0x1b, 0xed, 0xea, 0x63, 0x53, 0x80, 0x7d, 0xcd, 0x6c, 0x8f, 
-	0x29, 0x58, 0xef, 0x8c, 0x95, 0xc6, 0x4 , 0x67, 0xd , 0xcf, 0xa9, 0x27, 0xbf, 
-	0xeb, 0x59, 0xb7, 0xd7, 0xcc, 0x6f, 0x1a, 0x15, 0x82, 0x46, 0x58, 0xf9, 0x8 , 
-	0x80, 0x7e, 0x78, 0x4 , 0x7e, 0xb9, 0xa6, 0x8c, 0xa5, 0x27, 0xdc, 0xad, 0x18, 
-	0xb8, 0x50, 0xc7, 0x6c, 0x8e, 0xa3, 0x92, 0xc1, 0x76, 0x81, 0xff, 0x0 , 0x2 , 
-	0x26, 0xa1, 0x96, 0x7d, 0xad, 0xe6, 0x63, 0xcc, 0x60, 0x4e, 0x4c, 0x8d, 0x90, 
-	0x3e, 0x80, 0x75, 0xa9, 0xd5, 0xa4, 0xbb, 0xe7, 0x74, 0x9b, 0x8f, 0xa6, 0x30, 
-	0x3f, 0x9f, 0xe9, 0x51, 0x5c, 0x47, 0x5 , 0xbc, 0x65, 0xe4, 0x9 , 0x23, 0x83, 
-	0x8c, 0x67, 0x7e, 0x3e, 0xa7, 0xee, 0xfe, 0x54, 0x17, 0x1d, 0xb4, 0x32, 0xa6, 
-	0x66, 0x9c, 0xb4, 0xee, 0x30, 0x58, 0xf1, 0xc7, 0x1f, 0xe7, 0xe9, 0x54, 0xe6, 
-	0x68, 0xc3, 0x11, 0xcb, 0x7e, 0x18, 0x15, 0xa5, 0x70, 0xfe, 0x6c, 0x3b, 0xd4, 
-	0x48, 0x78, 0xed, 0x85, 0x50, 0x7d, 0x33, 0x9e, 0x7e, 0x95, 0x5e, 0x48, 0xa6, 
-	0x55, 0xde, 0xf8, 0x84, 0x63, 0xa3, 0x93, 0x93, 0xf4, 0xab, 0x5a, 0x18, 0x49, 
-	0x39, 0x19, 0xb2, 0x10, 0x7e, 0x5c, 0xe4, 0x76, 0x1e, 0x95, 0x7 , 0x9a, 0x11, 
-	0x86, 0xee, 0x54, 0x1c, 0x91, 0xeb, 0x57, 0xa4, 0x2a, 0x72, 0x31, 0xc5, 0x50, 
-	0xbc, 0x8f, 0xab, 0x28, 0x1b, 0x4f, 0xa9, 0xad, 0xe9, 0xbb, 0xb3, 0xcb, 0xc5, 
-	0xc6, 0x51, 0x5c, 0xc8, 0xbb, 0x66, 0x5a, 0xe3, 0x95, 0x5d, 0xab, 0x9e, 0xc9, 
-	0xc8, 0xe2, 0xa4, 0xe6, 0x39, 0x8 , 0xa , 0x18, 0x83, 0xc1, 0x39, 0x5f, 0xd3, 
-	0x35, 0x4f, 0x47, 0x76, 0x49, 0x81, 0x76, 0x74, 0x5c, 0xe3, 0x2b, 0xd4, 0xd6, 
-	0xb5, 0xd0, 0x85, 0x58, 0xba, 0x3 , 0xb5, 0xba, 0xfc, 0xb8, 0x20, 0xe7, 0xbe, 
-	0x4d, 0x4d, 0x4d, 0xd , 0x30, 0x72, 0xf6, 0x91, 0x4d, 0xb2, 0x4b, 0x4b, 0xad, 
-	0xac, 0x19, 0x87, 0xb6, 0x43, 0x1c, 0x81, 0xf9, 0x73, 0x5b, 0xba, 0x6c, 0xfb, 
-	0x15, 0x36, 0xb2, 0xc8, 0xaa, 0x78, 0x39, 0xc7, 0xb8, 0xae, 0x7a, 0x19, 0xc2, 
-	0xff, 0x0 , 0xac, 0x42, 0x41, 0x3c, 0x71, 0x5a, 0x1a, 0x74, 0xd1, 0x16, 0xe2, 
-	0x40, 0xbc, 0xe0, 0xae, 0xe1, 0xfd, 0x7b, 0x57, 0x3c, 0xbd, 0xf , 0x6a, 0x9f, 
-	0x2f, 0xf3, 0x6a, 0x76, 0x9a, 0x66, 0xa5, 0xc , 0xcb, 0xb1, 0xf0, 0xcc, 0x3a, 
-	0xee, 0xe7, 0x1f, 0x88, 0xfe, 0xb5, 0x2b, 0xc5, 0x20, 0xfd, 0xe4, 0x12, 0x31, 
-	0x53, 0x9c, 0x85, 0xe8, 0x3f, 0x11, 0x58, 0xd6, 0xb1, 0xa3, 0xc2, 0x1b, 0x73, 
-	0x7c, 0xad, 0xcb, 0x2 , 0x48, 0x1f, 0x53, 0xce, 0x3f, 0x1c, 0xd6, 0xb5, 0x8c, 
-	0x92, 0xc2, 0xbb, 0x6 , 0x64, 0x53, 0xc1, 0x2a, 0x79, 0x5f, 0x7e, 0x3f, 0x98, 
-	0xac, 0xb7, 0x3b, 0x62, 0x9a, 0xdc, 0x82, 0xe9, 0x3 , 0x39, 0x49, 0x62, 0x91, 
-	0x41, 0x5e, 0x18, 0x2e, 0x47, 0xd7, 0x23, 0xff, 0x0 , 0xad, 0x55, 0xda, 0x35, 
-	0x42, 0x42, 0x26, 0xf1, 0x80, 0x48, 0xc7, 0xaf, 0xd7, 0x9f, 0xd6, 0xb5, 0x99, 
-	0x92, 0x48, 0xce, 0xe6, 0x1c, 0x9d, 0xa4, 0x93, 0xb7, 0xf3, 0x3d, 0x3f, 0x95, 
-	0x56, 0x92, 0xdc, 0xc6, 0x7f, 0x75, 0xbd, 0x97, 0x3c, 0xf4, 0x7d, 0xa7, 0xbf, 
-	0x7 , 0xb5, 0x66, 0xd5, 0x8e, 0x88, 0xbb, 0xad, 0x8a, 0x12, 0x61, 0x17, 0xfd, 
-	0x4c, 0x8b, 0x8f, 0x7f, 0xe7, 0x52, 0xdb, 0xdc, 0x2a, 0xb8, 0x57, 0x94, 0x30, 
-	0x6f, 0xba, 0xe0, 0xf4, 0xf6, 0x23, 0xfa, 0xd4, 0xf3, 0x41, 0x6c, 0x53, 0x7c, 
-	0x72, 0xb2, 0x0 , 0xb8, 0x3c, 0xb0, 0x2a, 0x7d, 0x39, 0xaa, 0x12, 0xc6, 0x21, 
-	0x90, 0x2c, 0xbb, 0xc8, 0x61, 0xd4, 0x8e, 0xbf, 0x87, 0xff, 0x0 , 0xae, 0xb6, 
-	0xa3, 0x5e, 0x54, 0xa5, 0xae, 0xc7, 0x6 , 0x61, 0x96, 0xd3, 0xc5, 0xc5, 0xb5, 
-	0xa3, 0x34, 0x98, 0x91, 0xd7, 0xa7, 0xad, 0x15, 0x46, 0xd2, 0x56, 0x8f, 0x74, 
-	0x67, 0xe6, 0x88, 0x74, 0xcf, 0x38, 0x15, 0x6e, 0x17, 0xc , 0xbc, 0x1c, 0xe3, 
-	0xbd, 0x7a, 0xf4, 0xea, 0xc6, 0x68, 0xf8, 0x5c, 0x56, 0x12, 0xa5, 0x9 , 0x35, 
-	0x25, 0xb0, 0xfa, 0x31, 0x4a, 0x45, 0x26, 0x6b, 0x63, 0x8c, 0x28, 0xa2, 0x8a, 
-	0x0 , 0x28, 0xa2, 0x8a, 0x0 , 0x28, 0xa2, 0x8a, 0x0 , 0x28, 0xfc, 0x68, 0xa3, 
-	0xf0, 0xa0, 0x3 , 0xf1, 0xa3, 0xf1, 0xa3, 0xf0, 0xa3, 0xf0, 0xa0, 0x3 , 0xf1, 
-	0xa3, 0xf1, 0xa3, 0xf0, 0xa3, 0xf0, 0xa0, 0x4 , 0xe9, 0x48, 0x69, 0x7a, 0xd2, 
-	0x1a, 0x0 , 0x28, 0xa2, 0x8a, 0x0 , 0xd , 0x36, 0x9d, 0x48, 0xd4, 0x0 , 0x94, 
-	0x51, 0x45, 0x0 , 0x23, 0x52, 0x52, 0xb5, 0x25, 0x50, 0x5 , 0x14, 0x51, 0x40, 
-	0x7 , 0xe3, 0x47, 0xe3, 0x47, 0xe1, 0x47, 0xe1, 0x40, 0xd , 0xc7, 0xbd, 0x14, 
-	0xa7, 0xe9, 0x49, 0x40, 0x5 , 0x23, 0x52, 0xd2, 0x35, 0x0 , 0x25, 0x21, 0x14, 
-	0xb4, 0x50, 0x3 , 0x68, 0xa2, 0x8a, 0x0 , 0x3f, 0x1a, 0x3f, 0x1a, 0x3f, 0xa , 
-	0x3f, 0xa , 0x77, 0x1 , 0xb4, 0x52, 0xb7, 0xd2, 0x92, 0x80, 0x11, 0xa9, 0x29, 
-	0x5a, 0x92, 0x98, 0x8 , 0x4d, 0x25, 0x29, 0x14, 0x94, 0x0 , 0x7e, 0x34, 0x7e, 
-	0x34, 0x51, 0xf8, 0x50, 0x3 , 0x68, 0xa5, 0x6f, 0xa5, 0x25, 0x0 , 0x37, 0x14, 
-	0x52, 0xb5, 0x25, 0x0 , 0x36, 0x8a, 0x52, 0x29, 0x28, 0x0 , 0xfc, 0x69, 0xf , 
-	0xd6, 0x97, 0xf0, 0xa3, 0xf0, 0xa0, 0x6 , 0xd2, 0x35, 0x2d, 0x18, 0xaa, 0x1 , 
-	0xb4, 0x8d, 0x4b, 0x48, 0xd4, 0x0 , 0x94, 0x7e, 0x34, 0x51, 0xf8, 0x50, 0x5 , 
-	0x5a, 0x31, 0x45, 0x2a, 0xd4, 0x96, 0x2d, 0x14, 0x52, 0xaf, 0xd2, 0xa4, 0x5 , 
-	0xfc, 0x68, 0xfc, 0x68, 0xfc, 0x28, 0xa0, 0x2 , 0x8a, 0x29, 0x40, 0xa0, 0x10, 
-	0xb4, 0x62, 0x81, 0x4e, 0xa0, 0x41, 0x45, 0x2 , 0x97, 0xf0, 0xa0, 0xa1, 0x7f, 
-	0x1a, 0x3f, 0x1a, 0x3f, 0xa , 0x28, 0x0 , 0xa3, 0x14, 0xa , 0x75, 0x0 , 0x14, 
-	0x62, 0x81, 0x4e, 0xa0, 0x56, 0xa , 0x28, 0x14, 0xef, 0xc2, 0x80, 0x61, 0xf8, 
-	0xd1, 0xf8, 0xd1, 0xf8, 0x51, 0x52, 0x1 , 0x46, 0x29, 0x48, 0xa1, 0x68, 0xb , 
-	0xb , 0x46, 0x28, 0xa5, 0x5a, 0x6 , 0x2d, 0x14, 0x52, 0x81, 0x40, 0x0 , 0xfa, 
-	0xd2, 0xfe, 0x34, 0x7e, 0x14, 0x7e, 0x14, 0x8 , 0x28, 0xa2, 0x94, 0xa , 0x0 , 
-	0x4a, 0x70, 0xa3, 0x14, 0x50, 0x1 , 0x4e, 0x14, 0x98, 0xf4, 0xa5, 0xa0, 0x41, 
-	0x4a, 0x3e, 0xb4, 0x63, 0xda, 0x97, 0xf0, 0xa0, 0x3 , 0xf1, 0xa2, 0x8f, 0xc2, 
-	0x8a, 0x0 , 0x29, 0xc2, 0x91, 0x69, 0x68, 0x0 , 0xa3, 0x14, 0xa , 0x75, 0x0 , 
-	0x14, 0x51, 0x4a, 0x5 , 0x0 , 0x2f, 0xe3, 0x47, 0xe3, 0x47, 0xe1, 0x47, 0xe1, 
-	0x40, 0x6 , 0x28, 0xa2, 0x8a, 0x0 , 0x28, 0xa2, 0x94, 0xa , 0x0 , 0x3a, 0x52, 
-	0xd0, 0x68, 0xa0, 0x2 , 0x8c, 0x50, 0x29, 0xd4, 0x0 , 0xda, 0x6c, 0xf2, 0x2c, 
-	0x31, 0x17, 0x7f, 0xc0, 0x7a, 0xd1, 0x2b, 0x88, 0xd4, 0x92, 0x7a, 0x7a, 0xd7, 
-	0x39, 0xe2, 0xd , 0x49, 0x5b, 0xe5, 0xdf, 0xc7, 0xa6, 0x7a, 0x8f, 0xe9, 0x51, 
-	0x29, 0x72, 0xa3, 0x7a, 0x14, 0x5d, 0x49, 0x24, 0x41, 0xad, 0x6a, 0x4f, 0x3c, 
-	0x8c, 0x91, 0xb7, 0xd , 0xc1, 0x20, 0xe0, 0x75, 0xe9, 0xf4, 0x15, 0x96, 0x8d, 
-	0xe7, 0xcc, 0x50, 0xb1, 0x10, 0xc5, 0xfe, 0xb0, 0x8e, 0xa7, 0xd0, 0xf , 0x73, 
-	0x51, 0xb9, 0x77, 0x6f, 0x94, 0x61, 0xa4, 0xe1, 0x40, 0xfe, 0x11, 0xeb, 0x56, 
-	0xad, 0x80, 0x8d, 0x14, 0x2f, 0xdd, 0x8c, 0xfc, 0xa7, 0xd5, 0xbb, 0x9f, 0xf0, 
-	0xaf, 0x3a, 0xa4, 0xee, 0xee, 0xcf, 0xaa, 0xc2, 0xd1, 0x51, 0x8a, 0x84, 0x7e, 
-	0x7f, 0xe4, 0x5e, 0x53, 0x95, 0x48, 0x8e, 0xd0, 0xdd, 0xd5, 0x7a, 0x1 , 0xe9, 
-	0xf4, 0xed, 0xef, 0x53, 0xb4, 0x8b, 0x1f, 0x27, 0xf1, 0x3 , 0xae, 0x6a, 0xad, 
-	0xa9, 0xd8, 0xbe, 0x71, 0xfb, 0xcd, 0xc0, 0xf5, 0xa8, 0xe6, 0x9f, 0x27, 0x7 , 
-	0xf0, 0xae, 0x3d, 0x5b, 0x3d, 0xb8, 0xda, 0x11, 0x2c, 0x4d, 0x31, 0x3f, 0x3f, 
-	0x3 , 0x1c, 0x28, 0xa8, 0xa6, 0xb9, 0x62, 0xbb, 0x4f, 0xca, 0x3b, 0xe2, 0xab, 
-	0xb3, 0xbb, 0x36, 0x7 , 0xde, 0xf4, 0xf4, 0xa4, 0xdc, 0xa9, 0xc0, 0xe4, 0xfa, 
-	0xd5, 0x58, 0x9e, 0x62, 0x4d, 0xe3, 0x1f, 0x36, 0x7d, 0x97, 0xfc, 0x69, 0xd1, 
-	0x6e, 0x94, 0x9e, 0x3e, 0x51, 0xd6, 0xa2, 0x85, 0x77, 0xfc, 0xed, 0xf7, 0x49, 
-	0xe3, 0x3d, 0xea, 0xd4, 0x2b, 0xbd, 0xf8, 0xc0, 0xc7, 0x3c, 0xf6, 0xa9, 0x91, 
-	0xb4, 0x16, 0x97, 0x7b, 0xa , 0x8 , 0xd , 0xb0, 0x2e, 0x4b, 0x74, 0x51, 0xe9, 
-	0x4f, 0xf2, 0x43, 0xb0, 0x79, 0x9 , 0x2a, 0xa7, 0x80, 0x7 , 0xcb, 0xf8, 0xa , 
-	0x21, 0xd8, 0xaa, 0x4e, 0x7e, 0xf6, 0x46, 0x47, 0x1b, 0xbd, 0xf2, 0x7a, 0xd3, 
-	0xd5, 0xc9, 0xc0, 0xf9, 0xbf, 0xba, 0xf , 0xf4, 0x2 , 0xb3, 0x6e, 0xc5, 0xfc, 
-	0x7b, 0x8f, 0x50, 0x17, 0x3b, 0x57, 0x68, 0xfd, 0x7f, 0xfa, 0xd4, 0xe8, 0x43, 
-	0x6d, 0xc9, 0xc0, 0xdc, 0x7a, 0x7b, 0xd3, 0x58, 0xaa, 0xf0, 0xc7, 0x9e, 0xcb, 
-	0x9c, 0xfe, 0x74, 0x47, 0x21, 0x20, 0x95, 0x3b, 0x70, 0x3a, 0xe3, 0x27, 0xff, 
-	0x0 , 0xad, 0x59, 0xdd, 0x9a, 0xf2, 0xab, 0x96, 0xa3, 0x65, 0x8e, 0x4c, 0x96, 
-	0x50, 0x57, 0xb9, 0x18, 0xfd, 0x3a, 0xff, 0x0 , 0x2a, 0xb3, 0xd , 0xc6, 0x5b, 
-	0x7a, 0xed, 0xce, 0x3e, 0xfb, 0xf3, 0xc7, 0xf4, 0xac, 0x86, 0x91, 0x73, 0xf2, 
-	0x82, 0x5b, 0xe9, 0x92, 0x7f, 0xcf, 0xd0, 0x53, 0x91, 0xe5, 0x70, 0x4b, 0xc8, 
-	0xc8, 0x9f, 0xec, 0x9e, 0x47, 0xe3, 0xfe, 0x7e, 0xb5, 0x69, 0x19, 0xca, 0xa5, 
-	0x8d, 0x99, 0xaf, 0x96, 0x3c, 0xa4, 0x8e, 0xce, 0xd8, 0xc9, 0x51, 0xc0, 0xcf, 
-	0xb8, 0x1d, 0x69, 0x91, 0x5f, 0x5c, 0x38, 0x43, 0xa , 0x32, 0xfa, 0x12, 0x31, 
-	0xff, 0x0 , 0xea, 0xfc, 0xeb, 0x3e, 0x37, 0x8e, 0x25, 0xc4, 0x49, 0x1b, 0x31, 
-	0x1c, 0x2b, 0x1c, 0x8f, 0xae, 0x3b, 0xfe, 0x35, 0x61, 0x64, 0x93, 0x91, 0x36, 
-	0xe6, 0xe3, 0x38, 0x58, 0xb0, 0xab, 0xf8, 0xd5, 0xc7, 0x43, 0x96, 0x6d, 0xc9, 
-	0xee, 0x69, 0x5b, 0xcb, 0xbe, 0x6d, 0xb2, 0x4a, 0x9c, 0x7d, 0xef, 0x2c, 0xf5, 
-	0x3f, 0xed, 0x37, 0x5f, 0xc8, 0x55, 0x8b, 0x6b, 0x80, 0xac, 0xdf, 0x67, 0x54, 
-	0x69, 0x33, 0xc9, 0xb , 0xb8, 0xe7, 0xdc, 0x9f, 0xf1, 0xac, 0x98, 0xe4, 0x44, 
-	0x51, 0xbd, 0xc6, 0x31, 0x92, 0x7 , 0x0 , 0xfb, 0x7f, 0xfa, 0xaa, 0x55, 0xb9, 
-	0xd , 0x93, 0x14, 0x32, 0x36, 0xd5, 0xe3, 0x8c, 0x5 , 0xfa, 0xe , 0x83, 0xea, 
-	0x6a, 0x94, 0x89, 0x74, 0xed, 0xf1, 0x1a, 0xdb, 0x51, 0xee, 0x41, 0x9a, 0x65, 
-	0x92, 0x41, 0xcb, 0x2e, 0x37, 0x71, 0xe8, 0x7b, 0xf , 0xc7, 0x35, 0x22, 0xc9, 
-	0x10, 0xdb, 0x19, 0xf3, 0x2 , 0x92, 0x4e, 0x17, 0x83, 0xf4, 0x1f, 0xfe, 0xb1, 
-	0x59, 0x11, 0xcf, 0x23, 0x27, 0x94, 0x24, 0x55, 0xe3, 0x2c, 0x23, 0x60, 0x7f, 
-	0x5e, 0xf5, 0x7a, 0xcc, 0xb7, 0x9e, 0xaa, 0xfb, 0x63, 0x6d, 0xbc, 0x2b, 0x3e, 
-	0xe6, 0x3e, 0xfb, 0x40, 0xe3, 0xf5, 0xaa, 0x4c, 0xcd, 0xc6, 0xcf, 0x44, 0x4c, 
-	0xcf, 0xbe, 0x66, 0x92, 0x2b, 0x75, 0x42, 0x4f, 0x5 , 0xb0, 0x4b, 0x7e, 0x3f, 
-	0xfd, 0x7a, 0xaf, 0x75, 0x22, 0xac, 0x81, 0xae, 0x2e, 0xe0, 0x89, 0x80, 0xc8, 
-	0xde, 0x99, 0x61, 0xee, 0x7 , 0xf5, 0xe9, 0x57, 0x23, 0x89, 0x1d, 0x7f, 0x7c, 
-	0x58, 0xab, 0x67, 0x1b, 0x57, 0xca, 0x7 , 0xf5, 0xcb, 0x7e, 0x55, 0xa , 0xad, 
-	0x93, 0xc6, 0x56, 0x18, 0xd9, 0x79, 0xc6, 0x23, 0x50, 0x32, 0x7f, 0xde, 0x3c, 
-	0xfe, 0x64, 0x55, 0x10, 0xe0, 0x54, 0xb8, 0x82, 0x39, 0x17, 0x7c, 0xa6, 0x79, 
-	0x40, 0xea, 0x64, 0xf9, 0x13, 0xeb, 0xf3, 0x7f, 0x85, 0x33, 0xec, 0x12, 0xc5, 
-	0x18, 0x40, 0xf6, 0xd1, 0xc6, 0x6 , 0x76, 0xc5, 0x16, 0xe6, 0x39, 0xfa, 0xf5, 
-	0xfc, 0xaa, 0xda, 0xc3, 0x0 , 0x6f, 0x32, 0x14, 0xe , 0xc8, 0x3e, 0xe8, 0x3b, 
-	0xb1, 0xf5, 0x66, 0x24, 0x55, 0x1d, 0x49, 0x27, 0x1c, 0xcd, 0x74, 0xad, 0x24, 
-	0x8d, 0x94, 0x8d, 0x70, 0xf , 0x3d, 0xb3, 0xc9, 0x3f, 0x40, 0x28, 0xd5, 0x91, 
-	0x68, 0xc7, 0x52, 0xa5, 0xe5, 0xa4, 0xd2, 0xa0, 0x76, 0x90, 0xc3, 0x93, 0x80, 
-	0x66, 0x1d, 0x47, 0xfb, 0xb8, 0xc0, 0xfc, 0x6b, 0x2e, 0xea, 0xdd, 0xe3, 0x7d, 
-	0xea, 0x4d, 0xc1, 0xc1, 0x19, 0xd9, 0xb5, 0x3f, 0xc , 0x75, 0xa9, 0xaf, 0x55, 
-	0xad, 0x8b, 0x32, 0xbb, 0x34, 0xdf, 0xc2, 0x6 , 0x30, 0x3f, 0x3f, 0xe8, 0x2b, 
-	0x1a, 0xe6, 0xee, 0xf1, 0x58, 0x9b, 0xa9, 0xa4, 0xc6, 0x78, 0xc , 0x4e, 0x47, 
-	0xe1, 0x9e, 0x2a, 0xd4, 0x6e, 0x63, 0x3a, 0xf1, 0x89, 0x34, 0x97, 0xef, 0x17, 
-	0x28, 0x88, 0xd3, 0x2f, 0x1e, 0x6c, 0x83, 0x76, 0xdf, 0xf7, 0x54, 0x70, 0x3f, 
-	0x5a, 0xc9, 0xbc, 0x9a, 0x79, 0x9c, 0xb3, 0xc8, 0x64, 0x27, 0xa9, 0x34, 0x92, 
-	0x5d, 0x7 , 0xce, 0x5f, 0xaf, 0xaf, 0x53, 0x54, 0x9e, 0xe3, 0xae, 0xd0, 0x7 , 
-	0xeb, 0x5a, 0xc2, 0x9b, 0x3c, 0xfc, 0x46, 0x2a, 0x2d, 0x6a, 0xc7, 0x5c, 0x4e, 
-	0xa8, 0xb9, 0x23, 0xe7, 0x3d, 0x80, 0xe9, 0x50, 0xfd, 0xa1, 0x9f, 0x83, 0xfc, 
-	0xa9, 0x26, 0x26, 0x55, 0xe9, 0x82, 0x29, 0xb1, 0xa9, 0x5e, 0x4a, 0xe4, 0x57, 
-	0x42, 0x4a, 0xc7, 0x93, 0x3a, 0xb5, 0x1c, 0xf4, 0x7a, 0x13, 0x42, 0x80, 0x74, 
-	0x6e, 0xf9, 0xff, 0x0 , 0x39, 0xab, 0x91, 0x8d, 0xeb, 0xb6, 0x47, 0x91, 0x9b, 
-	0x39, 0xc9, 0x35, 0x56, 0x10, 0x3a, 0x8e, 0x33, 0xd8, 0x8a, 0xb7, 0x1 , 0x3 , 
-	0xe5, 0x61, 0xd3, 0xae, 0x3a, 0x8a, 0xce, 0x6d, 0x9d, 0x98, 0x6a, 0x70, 0xea, 
-	0x89, 0x56, 0x36, 0x8e, 0x31, 0xe5, 0x99, 0x17, 0xfb, 0xc3, 0x77, 0xde, 0xfc, 
-	0x29, 0xeb, 0x30, 0x6f, 0x95, 0xb1, 0xff, 0x0 , 0x1 , 0x1f, 0xd3, 0xfc, 0x31, 
-	0x56, 0xad, 0xac, 0x9a, 0x68, 0xf0, 0x80, 0x30, 0x23, 0x38, 0x23, 0x83, 0xf8, 
-	0xf6, 0x34, 0xd , 0x3b, 0xcc, 0x8c, 0xb2, 0xb3, 0x92, 0x83, 0xe6, 0x56, 0x1c, 
-	0xa9, 0xfa, 0x8a, 0xc7, 0x9d, 0x75, 0x3d, 0x2f, 0x60, 0xd2, 0xbc, 0xb , 0xba, 
-	0x2d, 0xfc, 0xb6, 0xc7, 0x7c, 0x73, 0x86, 0xce, 0x46, 0xc2, 0xdb, 0x49, 0x1e, 
-	0xc4, 0xf1, 0xf8, 0x66, 0xba, 0x6d, 0x17, 0x5a, 0x86, 0xe6, 0x45, 0x8a, 0xe1, 
-	0x8c, 0x52, 0x2f, 0x5 , 0x59, 0x36, 0xe3, 0x1e, 0xab, 0xf9, 0xf2, 0x2b, 0x87, 
-	0x36, 0x57, 0x0 , 0x34, 0xb1, 0x6 , 0x65, 0x5e, 0x58, 0xa9, 0xc3, 0x47, 0xee, 
-	0xcb, 0x9e, 0x47, 0xbf, 0x4a, 0xb1, 0x6b, 0x71, 0x3c, 0x72, 0xf , 0x34, 0x85, 
-	0x28, 0xc0, 0x0 , 0x38, 0x23, 0xdc, 0x7a, 0x7e, 0x47, 0xe9, 0x53, 0x28, 0x26, 
-	0x6d, 0x47, 0x13, 0x38, 0x3d, 0x4f, 0x51, 0x58, 0x11, 0xe4, 0x3b, 0x5b, 0x82, 
-	0x98, 0x3c, 0x67, 0x83, 0xdc, 0x7b, 0x7d, 0x6a, 0x3b, 0xab, 0x78, 0x8a, 0xfe, 
-	0xec, 0x3a, 0xb3, 0xc , 0xe4, 0x74, 0xcd, 0x73, 0xda, 0x2e, 0xad, 0x24, 0x71, 
-	0xae, 0xe7, 0xdd, 0x1f, 0xf0, 0xb7, 0x5 , 0x41, 0xee, 0x38, 0xfb, 0xad, 0xfc, 
-	0xeb, 0xa1, 0x82, 0x58, 0x67, 0xcb, 0x5b, 0x6d, 0xc , 0x3e, 0x67, 0x8c, 0xf0, 
-	0xe , 0x7b, 0x8f, 0x4f, 0x5a, 0xe6, 0x94, 0x5a, 0x3d, 0x8a, 0x35, 0x63, 0x53, 
-	0x62, 0x93, 0x43, 0x32, 0x6d, 0x76, 0x76, 0x68, 0xf3, 0xf3, 0x48, 0x6 , 0x70, 
-	0x3d, 0xfd, 0x6a, 0xbb, 0x43, 0x2e, 0xd2, 0xd8, 0x59, 0x21, 0x3d, 0x48, 0x39, 
-	0x5e, 0xdd, 0x47, 0xf0, 0x9a, 0xd1, 0x69, 0x8a, 0x4c, 0xc4, 0xc5, 0x8e, 0xc7, 
-	0xd7, 0xf1, 0x1d, 0xea, 0x1b, 0x88, 0x62, 0x95, 0x77, 0x44, 0x4 , 0x73, 0x37, 
-	0xf7, 0xe , 0xd0, 0xc0, 0xe , 0xe3, 0xa1, 0xac, 0xce, 0x9b, 0x6a, 0x64, 0x4c, 
-	0x3c, 0x99, 0x14, 0xa1, 0x91, 0x70, 0x78, 0x27, 0xe6, 0xc8, 0x3f, 0x96, 0x7f, 
-	0x1a, 0x23, 0x94, 0x41, 0x2f, 0x39, 0x43, 0x9e, 0x98, 0x35, 0x34, 0xb1, 0xa2, 
-	0x2b, 0x2e, 0x1e, 0x3d, 0xbf, 0xc0, 0xc0, 0x6c, 0x3f, 0x4f, 0x4f, 0xcc, 0x55, 
-	0x1b, 0xcd, 0xfd, 0x8c, 0x8a, 0x7b, 0xab, 0xfa, 0x7d, 0x7d, 0x2b, 0x4a, 0x35, 
-	0x9c, 0x1e, 0xe7, 0x26, 0x33, 0x3 , 0xa , 0xf1, 0xbd, 0xb5, 0x36, 0x21, 0x91, 
-	0x65, 0x5e, 0x38, 0x3d, 0xd7, 0xd2, 0x9d, 0x59, 0x7a, 0x5c, 0xc5, 0xbf, 0x76, 
-	0x5b, 0xe6, 0x1c, 0xc , 0x75, 0x22, 0xb4, 0xa3, 0x62, 0x47, 0xcd, 0xd3, 0xb1, 
-	0xff, 0x0 , 0x1a, 0xf6, 0xa8, 0xd6, 0xe7, 0x8d, 0xcf, 0x81, 0xc7, 0x60, 0x9e, 
-	0x1e, 0xab, 0x88, 0xea, 0x28, 0xa2, 0xb7, 0x3c, 0xf0, 0xa2, 0x8a, 0x28, 0x0 , 
-	0xa2, 0x8a, 0x28, 0x0 , 0xa2, 0x8a, 0x28, 0x0 , 0xfc, 0x68, 0xfc, 0x68, 0xfc, 
-	0x28, 0xfc, 0x28, 0x0 , 0xfc, 0x68, 0xfc, 0x68, 0xfc, 0x28, 0xfc, 0x28, 0x1 , 
-	0x3f, 0x1a, 0x43, 0x4a, 0xdf, 0x4a, 0x4a, 0x0 , 0x28, 0xa2, 0x8a, 0x0 , 0x28, 
-	0xcd, 0x14, 0x8d, 0x40, 0x9 , 0x45, 0x1d, 0xe8, 0xa0, 0x0 , 0xd2, 0x62, 0x96, 
-	0x90, 0x9a, 0x0 , 0x4a, 0x28, 0xa2, 0x98, 0x7 , 0xe3, 0x47, 0xe3, 0x47, 0xe1, 
-	0x47, 0xe1, 0x4c, 0x4 , 0x3f, 0x5a, 0x4a, 0x77, 0xe1, 0x49, 0x8f, 0x6a, 0x0 , 
-	0x4a, 0x42, 0x29, 0x68, 0xa0, 0x6 , 0xd1, 0x45, 0x14, 0x0 , 0xda, 0x28, 0xa2, 
-	0x80, 0xa , 0x3f, 0x1a, 0x28, 0xfc, 0x28, 0x1 , 0x1b, 0xeb, 0x49, 0x4a, 0xdf, 
-	0x4a, 0x4a, 0x77, 0x1 , 0x1a, 0x92, 0x95, 0xa9, 0x29, 0x80, 0x1a, 0x6d, 0x38, 
-	0xd3, 0x68, 0x0 , 0xa3, 0xf1, 0xa2, 0x8f, 0xc2, 0x80, 0x11, 0xbe, 0xb4, 0x94, 
-	0xad, 0xf4, 0xa4, 0xa0, 0x6 , 0xe2, 0x8a, 0x56, 0xa4, 0xa0, 0x4 , 0x6a, 0x4a, 
-	0x56, 0xa4, 0xa0, 0x3 , 0xf1, 0xa3, 0xf1, 0xa3, 0xf0, 0xa3, 0xf0, 0xa0, 0x6 , 
-	0xd1, 0x9a, 0x28, 0xc5, 0x0 , 0x36, 0x90, 0x8a, 0x5a, 0x29, 0x80, 0xda, 0x3f, 
-	0x1a, 0x28, 0xfc, 0x29, 0x81, 0x58, 0xa , 0x5a, 0x29, 0x40, 0xa8, 0x66, 0x80, 
-	0x3e, 0xb4, 0xbf, 0x8d, 0x1f, 0x85, 0x1f, 0x85, 0x20, 0xa , 0x28, 0xa5, 0x2 , 
-	0x80, 0x16, 0x8a, 0x29, 0x40, 0xa0, 0x5 , 0xa2, 0x81, 0x4b, 0xf8, 0x50, 0x21, 
-	0x7f, 0x1a, 0x3f, 0x1a, 0x3f, 0xa , 0x28, 0x0 , 0xa3, 0x14, 0xa , 0x75, 0x3 , 
-	0xa , 0x31, 0x42, 0xd3, 0xa8, 0x0 , 0xa2, 0x81, 0x4b, 0xf8, 0x52, 0x0 , 0x1f, 
-	0x5a, 0x5f, 0xc6, 0x8f, 0xc2, 0x8a, 0x42, 0xa , 0x31, 0x45, 0x2a, 0xd0, 0x2 , 
-	0xd1, 0x8a, 0x5 , 0x3a, 0x81, 0x85, 0x14, 0xa , 0x5f, 0xc2, 0x81, 0xb , 0xf8, 
-	0xd1, 0xf8, 0xd1, 0xf8, 0x51, 0xf8, 0x50, 0x1 , 0x46, 0x28, 0x14, 0xea, 0x6 , 
-	0x20, 0x14, 0xb4, 0x51, 0x40, 0x85, 0x2 , 0x96, 0x8a, 0x50, 0x28, 0x1 , 0x16, 
-	0x9d, 0xf8, 0xd2, 0x63, 0xda, 0x97, 0xf0, 0xa0, 0x3 , 0xf1, 0xa2, 0x8a, 0x28, 
-	0x10, 0x52, 0xad, 0x18, 0xa5, 0xa0, 0x2 , 0x8c, 0x53, 0xb1, 0x45, 0x0 , 0x14, 
-	0x77, 0xa2, 0x80, 0x28, 0x1 , 0x47, 0xd6, 0x97, 0xf1, 0xa3, 0xf0, 0xa2, 0x80, 
-	0xa , 0x28, 0xa2, 0x80, 0xa , 0x28, 0x14, 0xb8, 0xa0, 0x0 , 0xa , 0x5a, 0x28, 
-	0xa0, 0x2 , 0x8c, 0x52, 0xf5, 0xa5, 0xa0, 0x4 , 0x2 , 0x86, 0x20, 0xc , 0x93, 
-	0x8a, 0x56, 0x21, 0x46, 0x58, 0xe0, 0x77, 0x35, 0x93, 0xaa, 0xde, 0x2b, 0x44, 
-	0xec, 0xc4, 0xac, 0x2a, 0x70, 0x71, 0xd5, 0xcf, 0xa0, 0xa9, 0x6e, 0xc5, 0xc2, 
-	0x2e, 0x4c, 0xaf, 0xaf, 0xea, 0x0 , 0xa6, 0xc8, 0xbe, 0x60, 0x4e, 0x0 , 0xfe, 
-	0xf1, 0xf4, 0x1f, 0xd4, 0xd7, 0x2b, 0x33, 0x99, 0x64, 0xdc, 0xcc, 0x9 , 0x63, 
-	0x93, 0xe9, 0x56, 0xb5, 0x29, 0x8c, 0xae, 0xc5, 0x94, 0x2e, 0xd1, 0xb4, 0x1 , 
-	0xdb, 0xfd, 0x91, 0xfd, 0x4d, 0x67, 0x49, 0x97, 0xc2, 0x67, 0xe6, 0x73, 0x81, 
-	0xf4, 0xae, 0x3a, 0x92, 0xbb, 0x3d, 0xbc, 0x25, 0x35, 0x15, 0x7b, 0x16, 0x6d, 
-	0x47, 0x98, 0x5a, 0x52, 0x70, 0xf , 0xca, 0xbe, 0xc2, 0xac, 0x46, 0x6 , 0xee, 
-	0x72, 0x23, 0x1d, 0x71, 0xfc, 0xaa, 0x5 , 0xc6, 0x36, 0xc7, 0xd7, 0xa0, 0x1e, 
-	0x82, 0xa6, 0x2f, 0xb2, 0x12, 0x1 , 0xe9, 0xd2, 0xb9, 0x25, 0x76, 0xcf, 0x7e, 
-	0x8c, 0x52, 0x8e, 0xa4, 0x93, 0x4c, 0x57, 0x81, 0xd4, 0xfe, 0x95, 0x12, 0x96, 
-	0x2d, 0x90, 0x3e, 0x6e, 0xde, 0x82, 0xa2, 0x53, 0x96, 0xff, 0x0 , 0x3c, 0x52, 
-	0xc9, 0x26, 0x3f, 0x76, 0x9d, 0x4f, 0x53, 0x42, 0x8d, 0x8d, 0x7d, 0xa5, 0xf5, 
-	0x64, 0x8d, 0x2a, 0xa0, 0xda, 0xbf, 0x89, 0xf5, 0xa7, 0xc2, 0x9b, 0xbe, 0x76, 
-	0xfc, 0x16, 0xa3, 0x8d, 0x42, 0x1e, 0x4f, 0xcd, 0xdf, 0xfd, 0x9f, 0xfe, 0xbd, 
-	0x4e, 0xa4, 0x8e, 0x7 , 0xde, 0x61, 0xc2, 0xff, 0x0 , 0x8d, 0x4c, 0xb4, 0x34, 
-	0x86, 0xbf, 0x11, 0x26, 0x44, 0x6b, 0xb9, 0xce, 0xe3, 0xd7, 0x68, 0xa9, 0x11, 
-	0x5e, 0x41, 0xbd, 0xc8, 0xeb, 0xd0, 0x74, 0x5f, 0xf1, 0x35, 0x1c, 0x31, 0x7c, 
-	0xdf, 0x39, 0xdc, 0xdd, 0x4f, 0xb5, 0x4a, 0xcd, 0x87, 0x8 , 0xbf, 0x33, 0x63, 
-	0x85, 0x1d, 0x7 , 0xd6, 0xb0, 0x93, 0xec, 0x75, 0x46, 0x2d, 0xea, 0xf6, 0x1e, 
-	0xcc, 0x15, 0x32, 0xa3, 0x6a, 0xff, 0x0 , 0x78, 0xff, 0x0 , 0x4f, 0x5a, 0x74, 
-	0x61, 0xb1, 0x95, 0xf9, 0x37, 0x75, 0x67, 0xe5, 0x88, 0xfe, 0x82, 0x99, 0xb1, 
-	0xb3, 0x99, 0x48, 0xcf, 0xf2, 0xa7, 0xe4, 0x6d, 0xc8, 0xff, 0x0 , 0xc7, 0x8f, 
-	0x4a, 0xcd, 0x9d, 0xb , 0xbb, 0x24, 0x41, 0x18, 0x50, 0x0 , 0xdd, 0xea, 0x49, 
-	0xe0, 0xd2, 0x48, 0x41, 0x6d, 0xb3, 0x48, 0x11, 0x73, 0xce, 0x7 , 0x5f, 0xc2, 
-	0xa3, 0x56, 0xe3, 0x3e, 0x71, 0x6c, 0xf0, 0x36, 0xe , 0x5 , 0x49, 0x8 , 0x45, 
-	0x1c, 0x41, 0xe6, 0x1f, 0x57, 0x61, 0xfa, 0xe , 0x94, 0x72, 0xeb, 0xa9, 0x12, 
-	0x9b, 0x6b, 0x41, 0xca, 0xf6, 0xbb, 0x4e, 0xcd, 0xf8, 0xee, 0x78, 0x0 , 0xfb, 
-	0x7b, 0xd3, 0xe1, 0x10, 0x91, 0x85, 0x85, 0xa4, 0xc7, 0x52, 0xd2, 0x60, 0x7e, 
-	0xb5, 0x22, 0xb1, 0x79, 0x7c, 0xa5, 0x10, 0xb1, 0x53, 0x96, 0x6 , 0x35, 0x3f, 
-	0xa9, 0x2 , 0x9f, 0xb9, 0x56, 0x42, 0xd2, 0xcb, 0xa , 0x8c, 0xf0, 0xaa, 0xaa, 
-	0x7f, 0xfa, 0xdf, 0xa5, 0x51, 0x8b, 0xf3, 0x1b, 0x1f, 0x92, 0x1 , 0xda, 0x24, 
-	0xf9, 0xb9, 0xdc, 0x8 , 0xc1, 0xfe, 0x59, 0xfa, 0xd4, 0xab, 0x10, 0x62, 0x7e, 
-	0x52, 0xc7, 0xfb, 0xa5, 0xf3, 0xf8, 0xf4, 0xa3, 0xed, 0x6 , 0x46, 0x29, 0x6d, 
-	0x3 , 0x80, 0x79, 0x2c, 0xcb, 0xfe, 0x23, 0x7 , 0xf2, 0xa1, 0x5 , 0xf1, 0x2a, 
-	0x9e, 0x72, 0x2e, 0x7a, 0x2a, 0xb0, 0xff, 0x0 , 0x1a, 0x18, 0x93, 0x4b, 0x62, 
-	0x46, 0xb0, 0xb9, 0x6d, 0xce, 0x20, 0x52, 0x33, 0xce, 0x78, 0x3 , 0xf3, 0xed, 
-	0x52, 0xc7, 0xc , 0x7f, 0xf2, 0xd6, 0xe0, 0x32, 0x9e, 0x7c, 0xb8, 0xc6, 0x17, 
-	0x77, 0xd6, 0xa0, 0x91, 0x59, 0x64, 0xc3, 0xf9, 0x6a, 0x78, 0x25, 0x9 , 0xde, 
-	0x4f, 0xe0, 0x39, 0x15, 0x62, 0xd5, 0x26, 0x65, 0x66, 0x58, 0x82, 0x95, 0x3c, 
-	0x9c, 0x1c, 0xff, 0x0 , 0x52, 0x3f, 0x1c, 0x53, 0xb9, 0x5c, 0xa9, 0x22, 0x68, 
-	0xc4, 0x69, 0x80, 0x1c, 0x48, 0x48, 0xe0, 0x83, 0x9c, 0x1f, 0x41, 0xc6, 0x4f, 
-	0xf2, 0xa9, 0xa1, 0x95, 0x63, 0x0 , 0x8b, 0x88, 0x57, 0xcc, 0x38, 0x25, 0x5b, 
-	0x27, 0xf1, 0xff, 0x0 , 0xeb, 0xe6, 0xa3, 0x89, 0x55, 0x7f, 0xe3, 0xe1, 0xb6, 
-	0xee, 0xe9, 0xbc, 0x0 , 0x58, 0xfd, 0x39, 0x26, 0xa4, 0x59, 0xe1, 0x57, 0xa , 
-	0xb6, 0x20, 0x16, 0x38, 0xdc, 0x55, 0x77, 0x37, 0xd0, 0x1c, 0x9c, 0x7e, 0x15, 
-	0x46, 0x72, 0x4c, 0x48, 0xe6, 0x56, 0x12, 0x31, 0x53, 0x28, 0x62, 0x70, 0xa1, 
-	0x83, 0x33, 0x1 , 0xeb, 0xe8, 0x3f, 0xa , 0x99, 0x66, 0x91, 0x21, 0xdb, 0x2c, 
-	0x50, 0xfc, 0xdd, 0xb6, 0x9c, 0xfe, 0x43, 0x25, 0xa9, 0x58, 0x9 , 0xa3, 0x6 , 
-	0xe6, 0x4f, 0x28, 0xe , 0x38, 0x1b, 0x79, 0xf6, 0xc8, 0xfe, 0x94, 0xc8, 0x44, 
-	0x7b, 0x98, 0xdb, 0x40, 0xad, 0xb4, 0x61, 0xa7, 0x6c, 0x81, 0xee, 0x4b, 0x1e, 
-	0x3f, 0x2e, 0x69, 0xf3, 0x10, 0xe9, 0xbb, 0x16, 0xbc, 0xd7, 0x8c, 0x2 , 0x23, 
-	0xdf, 0x2c, 0x9d, 0x0 , 0x1c, 0x27, 0xb9, 0x27, 0x81, 0xf9, 0xd5, 0x4b, 0xe2, 
-	0xad, 0x26, 0x21, 0x9e, 0x20, 0xcd, 0xc3, 0x36, 0x32, 0x7d, 0xf9, 0xcf, 0xeb, 
-	0x52, 0x6a, 0x4b, 0x6f, 0xa , 0xf9, 0x72, 0xdd, 0xb4, 0xd3, 0xed, 0xc8, 0x5c, 
-	0xec, 0x44, 0xf7, 0xc7, 0x5f, 0xce, 0xab, 0x43, 0xe4, 0x85, 0x81, 0x40, 0x8d, 
-	0xd9, 0xb9, 0x66, 0x28, 0x44, 0x63, 0xe8, 0x3b, 0x9f, 0xc6, 0xa9, 0x48, 0xca, 
-	0xa5, 0x37, 0x6f, 0x22, 0x95, 0xf5, 0xbd, 0xb9, 0xb6, 0x75, 0x8d, 0x37, 0x6d, 
-	0x1f, 0x28, 0xb7, 0x1f, 0x33, 0xfb, 0x93, 0xd8, 0x57, 0x39, 0xa8, 0x59, 0xdb, 
-	0x6e, 0xda, 0xc9, 0xb1, 0xbd, 0x23, 0x25, 0x87, 0xd0, 0x93, 0x5d, 0x56, 0xa8, 
-	0xb1, 0x18, 0xdb, 0xcb, 0x5 , 0xb0, 0xd9, 0x2c, 0x49, 0xa , 0x7d, 0x8f, 0x76, 
-	0xfa, 0x56, 0x24, 0xd0, 0x99, 0x18, 0xb3, 0x64, 0xb8, 0x6f, 0x90, 0x6d, 0x20, 
-	0xc , 0x83, 0xdb, 0xfc, 0xfb, 0x56, 0xd1, 0x6c, 0xf3, 0xea, 0x46, 0x37, 0xd8, 
-	0xe7, 0x2e, 0xad, 0xd5, 0x57, 0xcc, 0xc2, 0x94, 0x6e, 0x87, 0xfa, 0xf , 0x5c, 
-	0x56, 0x75, 0xd4, 0x48, 0xa7, 0x28, 0xbc, 0x7a, 0x9a, 0xd4, 0xd5, 0x83, 0xbc, 
-	0xcd, 0xe6, 0x48, 0xa4, 0x8e, 0x38, 0x39, 0x3f, 0xf8, 0xee, 0x42, 0xfd, 0x33, 
-	0x59, 0xb3, 0xc , 0x46, 0x40, 0xdd, 0xd3, 0xbd, 0x6f, 0x4e, 0xf7, 0x3c, 0xdc, 
-	0x5a, 0x52, 0x8b, 0xb2, 0x21, 0xb7, 0xc6, 0xee, 0x3a, 0xd5, 0xdb, 0x64, 0x46, 
-	0x52, 0x18, 0x60, 0x93, 0xcf, 0xff, 0x0 , 0x5c, 0x56, 0x72, 0x1f, 0xde, 0x6d, 
-	0xc6, 0x46, 0x6a, 0xfd, 0xac, 0x8e, 0x9d, 0xb7, 0xa0, 0xea, 0x3d, 0x2a, 0xea, 
-	0x26, 0x73, 0x61, 0x2a, 0x45, 0xe8, 0xd1, 0x6a, 0x4d, 0x3f, 0x6e, 0xd6, 0x51, 
-	0xb4, 0x11, 0x9f, 0xf3, 0xed, 0x4e, 0x86, 0xdc, 0xac, 0xdb, 0x65, 0x4 , 0x60, 
-	0x67, 0xae, 0xe , 0x3d, 0x8f, 0xf9, 0x15, 0xb1, 0xa5, 0xb4, 0x53, 0x5b, 0xee, 
-	0x5d, 0xb2, 0x0 , 0x32, 0x54, 0x9f, 0xd4, 0x7f, 0x5a, 0xbe, 0xda, 0x58, 0xf2, 
-	0xf7, 0x5 , 0x2c, 0x14, 0x9d, 0xcb, 0xd0, 0x7d, 0x54, 0xd7, 0x2f, 0x3b, 0xea, 
-	0x7b, 0x51, 0xc3, 0xd3, 0x92, 0xbc, 0x4a, 0x9a, 0x14, 0x2c, 0x1 , 0x8a, 0x5d, 
-	0xcc, 0xaf, 0x82, 0x19, 0x9 , 0xc9, 0x3e, 0x84, 0x76, 0x6f, 0x7a, 0xd6, 0x1a, 
-	0x73, 0x19, 0x44, 0x90, 0x1e, 0x57, 0x95, 0x23, 0xa6, 0x38, 0xea, 0x3d, 0x39, 
-	0xe6, 0xab, 0xda, 0xd8, 0xb5, 0xbc, 0x8a, 0xb9, 0x25, 0x5f, 0xb1, 0xe3, 0xf0, 
-	0xff, 0x0 , 0x3f, 0x90, 0xad, 0x98, 0xed, 0xda, 0x65, 0x8 , 0xac, 0x41, 0x7 , 
-	0x70, 0x28, 0x39, 0x6c, 0x63, 0x9f, 0x4a, 0x87, 0x2b, 0x9d, 0x30, 0xa7, 0x28, 
-	0xa2, 0x9b, 0xe9, 0xf0, 0xc8, 0xe8, 0xfe, 0x5f, 0x93, 0x24, 0x7c, 0x2b, 0xfa, 
-	0xb7, 0xa6, 0x7d, 0xfd, 0xff, 0x0 , 0x1a, 0xcf, 0xd6, 0xf4, 0x18, 0xe6, 0x59, 
-	0x38, 0x10, 0x4f, 0xc7, 0x5c, 0xec, 0x7f, 0xf6, 0x4f, 0xa7, 0xb6, 0x7b, 0xd7, 
-	0x4d, 0x6f, 0x72, 0x3 , 0x98, 0x2e, 0x57, 0x7e, 0x38, 0x56, 0x3f, 0x78, 0x29, 
-	0xf5, 0x3f, 0xc4, 0x3e, 0xbf, 0xad, 0x58, 0xd8, 0x93, 0x5a, 0x33, 0xc7, 0xb6, 
-	0x48, 0xd4, 0xfc, 0xd1, 0xbf, 0xcc, 0x42, 0xff, 0x0 , 0x9f, 0xad, 0x4a, 0x9b, 
-	0x4c, 0xde, 0x78, 0x78, 0x54, 0x8e, 0xa8, 0xf3, 0x78, 0x7e, 0xd5, 0xa7, 0x6a, 
-	0x4b, 0x5 , 0xc6, 0x61, 0x70, 0x70, 0x1d, 0xd7, 0xa8, 0xcf, 0xf1, 0x76, 0x65, 
-	0xf7, 0xfc, 0x6b, 0xa8, 0xd2, 0x6e, 0xcc, 0x8d, 0xfb, 0xbf, 0xdd, 0x30, 0x1f, 
-	0x75, 0x5b, 0x77, 0xd4, 0xaf, 0xaf, 0xb8, 0xad, 0x3d, 0x6b, 0x45, 0xb5, 0xbc, 
-	0xb3, 0x7 , 0xec, 0xfe, 0x62, 0xa7, 0xdd, 0x5e, 0x77, 0x8f, 0xa7, 0xb8, 0xae, 
-	0x77, 0xec, 0x2f, 0x4 , 0xc4, 0xdb, 0xcb, 0xf2, 0x9e, 0x4e, 0xee, 0xa0, 0x8e, 
-	0xfd, 0x3d, 0xb9, 0xfc, 0x7b, 0x8a, 0xd2, 0x52, 0x53, 0x5e, 0x67, 0x25, 0x3a, 
-	0x35, 0x30, 0xf3, 0xee, 0x8e, 0x86, 0x3b, 0xc8, 0xee, 0x98, 0x17, 0x3f, 0x37, 
-	0x40, 0x50, 0xf3, 0xff, 0x0 , 0xea, 0xfa, 0xd4, 0x8b, 0x3c, 0x96, 0xdc, 0x48, 
-	0xa5, 0x97, 0x20, 0xab, 0xaa, 0xf2, 0x3d, 0xfd, 0xeb, 0x1 , 0xee, 0x3 , 0xfe, 
-	0xf1, 0xf , 0x95, 0x30, 0x1f, 0x3a, 0x1e, 0xe7, 0xa7, 0x5e, 0xf9, 0xf5, 0xad, 
-	0x7d, 0x2e, 0xe9, 0x2e, 0xad, 0x46, 0x3e, 0xfa, 0x75, 0x52, 0xd8, 0xc3, 0x67, 
-	0xa6, 0x6b, 0x95, 0xc6, 0xc7, 0xb5, 0xa , 0x9c, 0xc9, 0x27, 0xb9, 0x62, 0xf1, 
-	0x16, 0x74, 0x33, 0x65, 0x23, 0x97, 0x82, 0x1e, 0x33, 0x80, 0xe3, 0xb1, 0xaa, 
-	0x37, 0x11, 0x4a, 0x63, 0x5 , 0xd5, 0x5c, 0x3 , 0x85, 0x71, 0xd0, 0xfb, 0x55, 
-	0xcc, 0xb8, 0x89, 0x8a, 0x7e, 0xf1, 0x77, 0x72, 0xf , 0xc , 0x9d, 0xf9, 0xff, 
-	0x0 , 0x1a, 0xb1, 0x6b, 0xc , 0x57, 0x11, 0xb1, 0xc2, 0x30, 0x6f, 0xf9, 0x66, 
-	0x49, 0x5c, 0x9f, 0x6f, 0x5e, 0xbd, 0xea, 0x1a, 0x37, 0x8c, 0xaf, 0xb9, 0xcc, 
-	0xca, 0x8d, 0x1c, 0xc2, 0x58, 0x98, 0xfc, 0x87, 0x24, 0x63, 0xe6, 0x4f, 0xc3, 
-	0xd2, 0xb5, 0xac, 0x6e, 0x56, 0x65, 0xdf, 0xc6, 0x9 , 0xda, 0xde, 0xc6, 0x9f, 
-	0xab, 0x58, 0xae, 0xf2, 0xc4, 0xee, 0xda, 0xbf, 0x46, 0x5f, 0xc7, 0xbd, 0x65, 
-	0xda, 0xb7, 0x91, 0x36, 0x43, 0x6f, 0x52, 0x31, 0x22, 0x63, 0x1f, 0xa5, 0x74, 
-	0xe1, 0x6b, 0xf2, 0x4a, 0xdd, 0x19, 0xe4, 0xe7, 0x19, 0x7f, 0xb7, 0xa3, 0xce, 
-	0x96, 0xab, 0xf2, 0x36, 0xfa, 0x71, 0xf9, 0x1a, 0x29, 0x91, 0x9f, 0xe0, 0x27, 
-	0x38, 0x1f, 0x29, 0xf5, 0x14, 0xfa, 0xf6, 0xd3, 0xd0, 0xfc, 0xfa, 0xa4, 0x5a, 
-	0x7a, 0x86, 0x28, 0xa3, 0x34, 0x55, 0x19, 0x85, 0x14, 0x51, 0x40, 0x5 , 0x14, 
-	0x51, 0x40, 0x7 , 0xe3, 0x47, 0xe3, 0x47, 0xe1, 0x47, 0xe1, 0x40, 0x7 , 0xe3, 
-	0x47, 0xe3, 0x47, 0xe1, 0x47, 0xe1, 0x40, 0x9 , 0xf8, 0xd2, 0x1a, 0x5c, 0x7b, 
-	0x52, 0x1a, 0x0 , 0x28, 0xa2, 0x8a, 0x0 , 0x29, 0x8 , 0xa5, 0xa4, 0x26, 0x80, 
-	0x12, 0x8a, 0x28, 0xa0, 0x2 , 0x91, 0xa9, 0x4d, 0x36, 0x80, 0xa , 0x28, 0xa2, 
-	0x80, 0xf , 0xc6, 0x8f, 0xc6, 0x8f, 0xc2, 0x8f, 0xc2, 0x80, 0x11, 0xbe, 0xb4, 
-	0x94, 0xb8, 0xf6, 0xa4, 0x35, 0x40, 0x14, 0x66, 0x8a, 0x31, 0x40, 0xd , 0xa4, 
-	0x22, 0x96, 0x8a, 0x0 , 0x42, 0x69, 0x28, 0xa2, 0x80, 0xf , 0xc6, 0x8f, 0xc6, 
-	0x8a, 0x3f, 0xa , 0x0 , 0x46, 0xfa, 0xd2, 0x52, 0xb7, 0xd2, 0x92, 0x80, 0x3 , 
-	0x4d, 0xa7, 0x1a, 0x6d, 0x34, 0x1 , 0x4d, 0x34, 0xad, 0x49, 0x40, 0x5 , 0x1f, 
-	0x8d, 0x14, 0x7e, 0x14, 0xc0, 0x43, 0xf5, 0xa4, 0xa5, 0x3f, 0x4a, 0x4a, 0x0 , 
-	0x46, 0xa4, 0xa7, 0x53, 0x4d, 0x0 , 0x23, 0x52, 0x52, 0xb5, 0x25, 0x0 , 0x1f, 
-	0x8d, 0x1f, 0x8d, 0x1f, 0x85, 0x1f, 0x85, 0x0 , 0x36, 0x8a, 0x28, 0xa0, 0x6 , 
-	0xd2, 0x11, 0x4b, 0x45, 0x0 , 0x36, 0x8a, 0x28, 0xfc, 0x28, 0x2 , 0xbd, 0x28, 
-	0xfa, 0xd1, 0x8f, 0x6a, 0x5f, 0xc2, 0x91, 0xa0, 0x7e, 0x34, 0x51, 0x45, 0x21, 
-	0xa , 0xb4, 0xb4, 0x62, 0x8a, 0x0 , 0x5e, 0x94, 0xb4, 0x52, 0xf5, 0xa0, 0x60, 
-	0x3e, 0xb4, 0xbf, 0x8d, 0x1f, 0x85, 0x1f, 0x85, 0x0 , 0x14, 0x62, 0x8a, 0x55, 
-	0xa0, 0x42, 0xd1, 0x8a, 0x29, 0x56, 0x80, 0x16, 0x8a, 0x5 , 0x3b, 0xf0, 0xa0, 
-	0x3 , 0xf1, 0xa2, 0x8f, 0xc2, 0x8a, 0x2 , 0xc1, 0x46, 0x28, 0x14, 0xea, 0x91, 
-	0x85, 0x18, 0xa0, 0x53, 0xa8, 0x10, 0x51, 0x45, 0x2a, 0xfd, 0x28, 0x0 , 0x1f, 
-	0x5a, 0x5f, 0xc6, 0x8f, 0xc2, 0x8f, 0xc2, 0x81, 0x85, 0x14, 0xbd, 0x68, 0xc5, 
-	0x0 , 0x1d, 0x29, 0x68, 0xa5, 0xeb, 0x40, 0xb4, 0x0 , 0x29, 0x68, 0xa5, 0x2 , 
-	0x81, 0x80, 0xfa, 0xd1, 0xc7, 0xad, 0x2f, 0xe1, 0x47, 0xe1, 0x40, 0x83, 0xf1, 
-	0xa2, 0x8a, 0x28, 0x0 , 0xa7, 0xa , 0x31, 0x45, 0x2 , 0x1 , 0xcd, 0x2e, 0x28, 
-	0x5a, 0x5a, 0x0 , 0x28, 0xa0, 0x52, 0xfe, 0x14, 0x0 , 0x2d, 0x2f, 0xe3, 0x49, 
-	0x4b, 0xf8, 0x50, 0x1 , 0x45, 0x14, 0x50, 0x1 , 0x4a, 0xb4, 0x82, 0x9d, 0x40, 
-	0x5 , 0x14, 0x51, 0x40, 0xb , 0x8a, 0x31, 0x4b, 0x45, 0x0 , 0x14, 0x64, 0xe , 
-	0x4d, 0x15, 0xd , 0xd4, 0xa2, 0x34, 0x2c, 0x7a, 0x2f, 0xea, 0x7d, 0x29, 0x3d, 
-	0x6 , 0x95, 0xd9, 0xd , 0xf4, 0x99, 0x3b, 0x37, 0xec, 0x50, 0x37, 0x33, 0x1f, 
-	0xe1, 0x1e, 0xb5, 0x81, 0xac, 0x5d, 0x9 , 0x3e, 0x7c, 0x5 , 0x48, 0xf8, 0x85, 
-	0xf , 0xaf, 0xa9, 0xf7, 0xff, 0x0 , 0xf , 0x6a, 0xd3, 0xbe, 0x7d, 0xc8, 0xc0, 
-	0x91, 0x85, 0x6c, 0xbe, 0x47, 0xdf, 0x7c, 0x74, 0xfa, 0xf , 0xf3, 0xde, 0xb9, 
-	0x9d, 0x66, 0xe3, 0xf8, 0x43, 0x64, 0xf3, 0xcf, 0xaf, 0xa9, 0xac, 0x2a, 0x48, 
-	0xef, 0xa1, 0x4e, 0xee, 0xc5, 0xb , 0xa7, 0x26, 0x40, 0x9b, 0xb3, 0x8c, 0xf4, 
-	0xfa, 0xd2, 0x5b, 0x9c, 0xc8, 0xd2, 0xe , 0xdf, 0x2a, 0x7b, 0x54, 0x4d, 0x93, 
-	0xc8, 0xce, 0x58, 0xe0, 0x55, 0x88, 0xd4, 0x28, 0xa , 0x3b, 0xc , 0x71, 0x5c, 
-	0xb2, 0x3d, 0xaa, 0x11, 0x77, 0x25, 0x8c, 0x80, 0xbe, 0x9e, 0xfe, 0xa3, 0xd2, 
-	0x99, 0x23, 0xef, 0x6c, 0xa , 0x8e, 0x46, 0xcd, 0x0 , 0xed, 0x5 , 0xaa, 0x2d, 
-	0xad, 0xce, 0xbe, 0x7d, 0x2d, 0xd0, 0x91, 0xa4, 0xdb, 0xf2, 0xa9, 0xe4, 0xd3, 
-	0xe1, 0x1b, 0x7b, 0x80, 0x7b, 0x9f, 0x4f, 0xa7, 0xbd, 0x47, 0x2 , 0xf3, 0x9e, 
-	0xa7, 0xd7, 0xd2, 0xa5, 0x8c, 0xe , 0xb8, 0xfa, 0xf , 0x6f, 0x5a, 0x99, 0x17, 
-	0xb , 0xbb, 0x32, 0x68, 0x54, 0xfc, 0xa7, 0x1f, 0xee, 0x2f, 0xf5, 0x3e, 0xf5, 
-	0x34, 0x67, 0xe7, 0xd8, 0x9c, 0xb7, 0xf1, 0xbe, 0x78, 0x1f, 0x8f, 0xad, 0x33, 
-	0xc , 0x3e, 0x45, 0x3f, 0x31, 0xfb, 0xc7, 0xd0, 0x54, 0xaa, 0xa0, 0x0 , 0x83, 
-	0xe5, 0x5c, 0x7c, 0xdf, 0xe2, 0x6b, 0x9 , 0x33, 0xd1, 0xa7, 0x1d, 0x74, 0x24, 
-	0x4 , 0x9f, 0x92, 0x33, 0x85, 0xfe, 0x26, 0xfe, 0xb4, 0xaa, 0x12, 0x32, 0x14, 
-	0x1c, 0x1 , 0xcf, 0xb9, 0xa8, 0xd9, 0xce, 0x36, 0x46, 0xb8, 0xcf, 0x39, 0xc5, 
-	0x2b, 0xc , 0xc , 0x17, 0x39, 0x3d, 0x4f, 0xad, 0x65, 0x63, 0xab, 0x9a, 0xc3, 
-	0xda, 0x50, 0x24, 0xc9, 0x4 , 0x91, 0x4c, 0x54, 0x69, 0x1b, 0x71, 0x38, 0x5f, 
-	0x72, 0x31, 0xf9, 0x74, 0xfd, 0x2a, 0x2f, 0xb4, 0x2a, 0xb6, 0x11, 0x37, 0xb7, 
-	0xab, 0x7f, 0x85, 0x2f, 0x97, 0x24, 0x9f, 0x3c, 0xcd, 0xf9, 0xff, 0x0 , 0x41, 
-	0x4f, 0x96, 0xc6, 0x32, 0x9f, 0x33, 0xee, 0x58, 0x13, 0xaa, 0x29, 0xf2, 0xd5, 
-	0xa5, 0x63, 0xef, 0xc6, 0x3e, 0xb4, 0x82, 0x7b, 0x8e, 0x4b, 0x3e, 0xde, 0xc1, 
-	0x23, 0x38, 0xa8, 0xe3, 0xa , 0x8b, 0x96, 0x52, 0xc3, 0xdc, 0xd4, 0xd0, 0xef, 
-	0x29, 0xb8, 0x95, 0x8d, 0x47, 0x4c, 0x72, 0x7f, 0xa , 0x5a, 0x20, 0xe6, 0x93, 
-	0xea, 0x4d, 0x6e, 0xec, 0x39, 0x61, 0x37, 0x1e, 0xa4, 0x5 , 0x1f, 0x9f, 0x26, 
-	0x9e, 0xb3, 0xc5, 0x1c, 0xca, 0x3 , 0x81, 0xc1, 0xf9, 0x51, 0x41, 0x27, 0xf3, 
-	0xa2, 0xdd, 0x44, 0xb2, 0x63, 0x32, 0xb3, 0x63, 0x3 , 0x24, 0x2e, 0x7f, 0xad, 
-	0x5a, 0x8a, 0xd9, 0x4f, 0xdf, 0x95, 0x20, 0x4f, 0x44, 0x6c, 0x67, 0xe8, 0x40, 
-	0x26, 0x8b, 0xa0, 0xe5, 0x92, 0x12, 0xde, 0x79, 0x65, 0x6d, 0xb0, 0xa0, 0x8f, 
-	0x3d, 0xc , 0xcd, 0x92, 0x7f, 0xe0, 0x23, 0x15, 0x62, 0x19, 0x11, 0x63, 0xc0, 
-	0xba, 0x12, 0xe , 0xea, 0xae, 0x0 , 0x5f, 0xc1, 0x7f, 0xad, 0x42, 0x89, 0x6f, 
-	0x24, 0xcd, 0xe4, 0xa3, 0x4b, 0xc6, 0x39, 0x6d, 0xa8, 0x3e, 0xb8, 0xfe, 0xb5, 
-	0x3a, 0x5a, 0x22, 0xa9, 0x12, 0x4a, 0x38, 0x3c, 0xa4, 0x31, 0x9c, 0x7d, 0x3b, 
-	0xe2, 0x93, 0x65, 0x28, 0xa6, 0xae, 0xf6, 0x2c, 0x5a, 0xfd, 0x9f, 0x76, 0xc1, 
-	0x12, 0xba, 0xf5, 0x24, 0xee, 0xda, 0x7f, 0x5 , 0x3f, 0xce, 0xa6, 0x9a, 0xe6, 
-	0x28, 0xe6, 0x58, 0xd3, 0x12, 0x3f, 0x64, 0xc7, 0x4f, 0xa7, 0x52, 0x4f, 0xe1, 
-	0x55, 0x57, 0xc9, 0xe3, 0xd , 0x72, 0xc8, 0x83, 0xee, 0xc4, 0xc2, 0x3f, 0xc7, 
-	0xb9, 0x3f, 0x8d, 0x4e, 0x97, 0x50, 0xa9, 0x18, 0x8d, 0xd4, 0x1 , 0xf7, 0x1c, 
-	0xf2, 0x7f, 0x1e, 0x28, 0x56, 0x45, 0x7b, 0xd2, 0x7a, 0x11, 0xb4, 0x92, 0xc9, 
-	0x21, 0x71, 0x6a, 0x14, 0xf0, 0xac, 0x65, 0xca, 0xed, 0x5f, 0x53, 0xce, 0x3f, 
-	0x31, 0x56, 0x45, 0xc3, 0xc2, 0xbb, 0x63, 0x5b, 0x70, 0xf8, 0xfb, 0xce, 0xb8, 
-	0xe3, 0xd8, 0xe , 0x4d, 0x40, 0xcd, 0x6e, 0x59, 0x89, 0x2a, 0xaa, 0xa7, 0x3b, 
-	0x0 , 0xc9, 0xcf, 0xb0, 0xe9, 0xfa, 0x52, 0x47, 0x2e, 0xf9, 0x18, 0xc1, 0x14, 
-	0x68, 0x71, 0xf3, 0x31, 0x4 , 0xf7, 0xeb, 0xde, 0x87, 0x22, 0xe1, 0xb , 0x3d, 
-	0x59, 0x2e, 0x5a, 0xe0, 0xac, 0x93, 0x4a, 0xcd, 0xb3, 0x23, 0x12, 0x7c, 0xb1, 
-	0x8f, 0x41, 0xeb, 0xf9, 0xfe, 0x55, 0x6d, 0x44, 0x91, 0x2a, 0x91, 0x20, 0x5c, 
-	0x10, 0xa0, 0xe3, 0x3b, 0x4f, 0xb1, 0x3d, 0x3f, 0x5a, 0xa8, 0x36, 0x49, 0x22, 
-	0x80, 0xfe, 0x63, 0x8f, 0xba, 0x7f, 0xbb, 0xf8, 0xf0, 0x7 , 0xe0, 0x6a, 0xe4, 
-	0x28, 0xed, 0xf2, 0x89, 0x7e, 0x60, 0x32, 0x9 , 0x3 , 0x81, 0xfe, 0xce, 0x3a, 
-	0x7d, 0x68, 0x89, 0x35, 0x1a, 0x5a, 0x21, 0x93, 0x20, 0x8d, 0x5b, 0x8 , 0xbb, 
-	0xf9, 0x2c, 0xcd, 0xf3, 0x12, 0x73, 0xd4, 0xb3, 0x67, 0x1c, 0xfb, 0x7e, 0x54, 
-	0xc8, 0xed, 0xd9, 0xdb, 0x86, 0x32, 0x7c, 0xb8, 0xdc, 0x72, 0x10, 0x9c, 0x76, 
-	0xee, 0x7f, 0x5e, 0x94, 0xd9, 0x97, 0x75, 0xc3, 0x46, 0xf , 0x9a, 0xc8, 0x40, 
-	0x31, 0x26, 0x18, 0x96, 0x1d, 0xc9, 0x3c, 0x3 , 0xf5, 0xe6, 0xa7, 0x69, 0x51, 
-	0x21, 0x6f, 0x36, 0x6f, 0x9b, 0x24, 0x2c, 0x6a, 0x1 , 0xda, 0x7f, 0xda, 0x63, 
-	0xc1, 0x3d, 0x2b, 0x68, 0x9c, 0x35, 0x19, 0x8f, 0x78, 0x92, 0xc1, 0x22, 0x5b, 
-	0xc2, 0xfb, 0xa4, 0x24, 0x92, 0xce, 0x40, 0xe3, 0xbe, 0x3d, 0x3f, 0x3e, 0x2b, 
-	0x36, 0xea, 0xde, 0x38, 0xa6, 0x12, 0x4a, 0x15, 0x47, 0x2c, 0xcf, 0x28, 0x18, 
-	0xc9, 0xee, 0x3 , 0x63, 0x3f, 0xfd, 0x6f, 0x7a, 0xd9, 0xb8, 0xb5, 0x9 , 0x9 , 
-	0x79, 0x67, 0x31, 0xc8, 0xdc, 0x6e, 0x1d, 0x4f, 0xb1, 0x3e, 0x9f, 0xca, 0xb3, 
-	0x6e, 0x2d, 0xe1, 0xf3, 0x83, 0x11, 0x1b, 0x48, 0xa7, 0xee, 0x18, 0xba, 0x77, 
-	0xc9, 0x27, 0x38, 0xfa, 0x9a, 0xd9, 0x33, 0xce, 0x9c, 0x5b, 0x30, 0x75, 0x6 , 
-	0x8a, 0x47, 0xf9, 0x4e, 0xef, 0x42, 0xc7, 0x3 , 0xea, 0x0 , 0xe3, 0xf9, 0xd6, 
-	0x35, 0xd6, 0x3 , 0x37, 0xde, 0xfc, 0xab, 0x6f, 0xc4, 0x57, 0x87, 0x98, 0x13, 
-	0x64, 0x4b, 0xdc, 0x46, 0x84, 0x17, 0xfa, 0xb1, 0xe4, 0xfd, 0x2b, 0x9f, 0xb9, 
-	0xe1, 0x8a, 0xb0, 0x1f, 0x9f, 0x35, 0xac, 0x35, 0x38, 0x71, 0x52, 0xe5, 0x4d, 
-	0x75, 0x2b, 0x29, 0xc4, 0xbc, 0xd6, 0xd6, 0x97, 0x1c, 0x52, 0xc6, 0xb1, 0xc8, 
-	0x36, 0xb4, 0x9f, 0x2a, 0xc9, 0xdb, 0xdb, 0x9f, 0xad, 0x61, 0x2f, 0x2f, 0x8c, 
-	0xfe, 0x75, 0xa9, 0xa6, 0xc9, 0x24, 0x50, 0x6d, 0x56, 0xdc, 0xac, 0x78, 0x5f, 
-	0xee, 0x9f, 0x5a, 0xda, 0xa6, 0xc7, 0x9d, 0x84, 0x97, 0xbf, 0xe4, 0x6a, 0x69, 
-	0xbe, 0x60, 0xba, 0x10, 0xc6, 0x3c, 0xbb, 0x85, 0x6c, 0x3 , 0x9c, 0x6f, 0x23, 
-	0xf8, 0x48, 0xf5, 0xf4, 0xff, 0x0 , 0x39, 0xeb, 0x34, 0xdb, 0xa3, 0x77, 0x66, 
-	0xd1, 0xb0, 0x45, 0xf2, 0x8e, 0x1c, 0x5 , 0xfb, 0x84, 0x76, 0xc1, 0xed, 0xea, 
-	0x38, 0xc5, 0x72, 0xb8, 0x59, 0x26, 0x59, 0x43, 0x7c, 0xed, 0xc3, 0x1c, 0xe3, 
-	0x7 , 0xb1, 0x3f, 0xe7, 0xae, 0x6b, 0x6f, 0x4f, 0x32, 0x4d, 0x27, 0x9e, 0x8e, 
-	0xeb, 0x2c, 0x7c, 0xca, 0x39, 0xc4, 0xa3, 0xa1, 0x3c, 0x72, 0x48, 0xfe, 0x5d, 
-	0x3b, 0xd7, 0x1c, 0x9a, 0x67, 0xd1, 0x50, 0x84, 0x92, 0xba, 0xd4, 0xe9, 0xcc, 
-	0x1b, 0xd5, 0x90, 0xaa, 0x6e, 0xc6, 0x3a, 0x6 , 0x56, 0x3 , 0xa6, 0x3f, 0xcf, 
-	0xe4, 0x69, 0x2d, 0xd3, 0xc9, 0x0 , 0x46, 0xb8, 0x61, 0xff, 0x0 , 0x2c, 0xdf, 
-	0x9e, 0x7f, 0xd9, 0x3e, 0x9e, 0xdd, 0x45, 0x50, 0xd3, 0xb5, 0x32, 0xa4, 0x5a, 
-	0xdd, 0x12, 0x6 , 0x4f, 0x97, 0x2e, 0x7a, 0xaf, 0x50, 0x54, 0xf7, 0x1e, 0xdd, 
-	0xb9, 0xfa, 0xd , 0x8b, 0x8d, 0xcf, 0x22, 0x12, 0xe1, 0xd4, 0xf4, 0x91, 0x9 , 
-	0xdd, 0x8f, 0x5e, 0x3f, 0xa , 0xc8, 0xf4, 0x22, 0xd3, 0x57, 0x44, 0x4f, 0x19, 
-	0x95, 0x4e, 0x57, 0xd , 0x8c, 0xe3, 0x90, 0x5b, 0xdc, 0x63, 0xa3, 0x7f, 0x3a, 
-	0x8a, 0xde, 0x39, 0x22, 0x93, 0x69, 0xdf, 0xb4, 0x1e, 0xe , 0x48, 0x3 , 0x9f, 
-	0x51, 0x5a, 0x76, 0xe4, 0xc8, 0xa4, 0xba, 0x83, 0xf2, 0xf0, 0x40, 0xe1, 0xfd, 
-	0x70, 0x3b, 0x1f, 0xe7, 0x51, 0xdd, 0x42, 0x82, 0x35, 0x9e, 0x17, 0x27, 0x39, 
-	0xce, 0xc2, 0x48, 0x61, 0xf4, 0xac, 0xde, 0xe7, 0x5c, 0x52, 0x71, 0xba, 0x1b, 
-	0x1d, 0xc4, 0x89, 0x20, 0x59, 0x13, 0x70, 0x3f, 0x29, 0xf7, 0x3f, 0xdd, 0x3e, 
-	0xfc, 0x53, 0x35, 0x2d, 0x3e, 0xd7, 0x51, 0xb5, 0xfb, 0xee, 0x8f, 0x9c, 0xa3, 
-	0xa3, 0x6d, 0x65, 0x6f, 0xeb, 0xef, 0x44, 0x52, 0x6 , 0x60, 0x1d, 0x81, 0x89, 
-	0x86, 0xd1, 0x27, 0x4f, 0xc1, 0xbd, 0xbd, 0xfb, 0x52, 0x31, 0x7b, 0x4b, 0xc5, 
-	0x8e, 0x60, 0x59, 0x4e, 0x36, 0xbb, 0x2f, 0x3e, 0xc0, 0xfa, 0xe3, 0x18, 0xcd, 
-	0x4f, 0x33, 0x43, 0xe4, 0x52, 0x47, 0x3b, 0x75, 0x6b, 0x2c, 0x2c, 0x16, 0xeb, 
-	0x6e, 0xec, 0x6d, 0x49, 0xc7, 0x43, 0xec, 0x69, 0xb6, 0x6d, 0x2d, 0xbc, 0xcc, 
-	0x24, 0x1b, 0xd7, 0x9c, 0x11, 0xd7, 0x1e, 0xde, 0xa3, 0xf5, 0x18, 0xae, 0x96, 
-	0xe8, 0x96, 0xc , 0x92, 0x22, 0xbc, 0x32, 0x26, 0x76, 0xf0, 0x77, 0x1f, 0x6e, 
-	0xdf, 0xe7, 0xd6, 0xb0, 0x75, 0x5b, 0x53, 0x6b, 0xb6, 0xe2, 0xd9, 0xa4, 0xc2, 
-	0xb0, 0x18, 0x4e, 0x4a, 0x9c, 0x71, 0x95, 0x3d, 0x73, 0xff, 0x0 , 0xd6, 0xed, 
-	0x56, 0xa5, 0x7d, 0xcc, 0xa5, 0x4d, 0xc3, 0x6e, 0x86, 0x82, 0x88, 0xee, 0x19, 
-	0x48, 0x90, 0xa9, 0x74, 0xc0, 0x60, 0x7e, 0x56, 0x3f, 0x5f, 0x5a, 0x55, 0x13, 
-	0x43, 0x26, 0x51, 0x15, 0xf2, 0x7e, 0x61, 0xfd, 0xe1, 0xfe, 0x3f, 0x4a, 0xcc, 
-	0xb2, 0xbe, 0x86, 0xe1, 0x11, 0xd0, 0xa9, 0xde, 0x4e, 0xe4, 0x4c, 0xe0, 0x9f, 
-	0x55, 0xf7, 0xe3, 0xa1, 0xab, 0x8b, 0x73, 0xe5, 0xa8, 0x32, 0x1 , 0x24, 0x64, 
-	0xfc, 0xad, 0x9e, 0x57, 0xd8, 0x9a, 0x89, 0x2b, 0x33, 0x7a, 0x73, 0x52, 0x57, 
-	0x46, 0x92, 0xbc, 0x57, 0x70, 0x9d, 0xd8, 0x56, 0xe4, 0x7c, 0xdc, 0xf2, 0x3b, 
-	0x1f, 0x7a, 0xc3, 0xd5, 0x6d, 0x82, 0xc8, 0x58, 0x2 , 0xac, 0x7 , 0x1c, 0xf5, 
-	0xad, 0x7b, 0x66, 0x86, 0xe3, 0x98, 0x58, 0x86, 0x6e, 0xb9, 0xfb, 0xcb, 0xeb, 
-	0x91, 0xfd, 0x6a, 0x3d, 0x42, 0x37, 0x9a, 0x6 , 0x91, 0xd4, 0x3a, 0xa9, 0xc3, 
-	0x84, 0xc6, 0x7f, 0x2f, 0x5a, 0xc6, 0x57, 0x47, 0x75, 0x1e, 0x5a, 0x91, 0x68, 
-	0xce, 0xd2, 0x6e, 0xb , 0x47, 0xe5, 0x33, 0x65, 0xe3, 0x3c, 0x7a, 0x95, 0x35, 
-	0xa4, 0xe , 0x46, 0x45, 0x63, 0xb2, 0xfd, 0x9a, 0xe9, 0x64, 0x1f, 0x32, 0x9e, 
-	0xa3, 0xd5, 0x7d, 0x6b, 0x4e, 0xd9, 0xc1, 0xf9, 0x77, 0x6 , 0x7 , 0x94, 0x6f, 
-	0x51, 0x5e, 0xd6, 0x6 , 0xbf, 0x3c, 0x2c, 0xf7, 0x3e, 0x7 , 0x88, 0x32, 0xd7, 
-	0x42, 0xb3, 0x9c, 0x56, 0x8f, 0x5f, 0xf3, 0xff, 0x0 , 0x32, 0x5a, 0x28, 0xa2, 
-	0xbd, 0x3 , 0xe6, 0x82, 0x8a, 0x28, 0xa0, 0x41, 0x45, 0x14, 0x50, 0x1 , 0xf8, 
-	0xd1, 0xf8, 0xd1, 0xf8, 0x51, 0xf8, 0x50, 0x1 , 0xf8, 0xd1, 0xf8, 0xd1, 0xf8, 
-	0x51, 0xf8, 0x50, 0x2 , 0x37, 0xd6, 0x92, 0x97, 0x1e, 0xd4, 0x7e, 0x14, 0x0 , 
-	0x94, 0x51, 0x45, 0x0 , 0x14, 0x51, 0x48, 0x4d, 0x0 , 0x26, 0x28, 0xa5, 0x6a, 
-	0x4a, 0x0 , 0x29, 0x1a, 0x94, 0xd3, 0x68, 0x0 , 0xa2, 0x8a, 0x28, 0x0 , 0xa3, 
-	0xf1, 0xa2, 0x8f, 0xc2, 0x80, 0xf , 0xc6, 0x9a, 0xd4, 0xef, 0xc2, 0x9a, 0x68, 
-	0x0 , 0xa2, 0x8a, 0x29, 0x80, 0xda, 0x28, 0xa2, 0x98, 0x8 , 0xd4, 0x94, 0xad, 
-	0x49, 0x40, 0x5 , 0x1f, 0x8d, 0x14, 0x7e, 0x14, 0x0 , 0x8d, 0xf5, 0xa4, 0xa5, 
-	0xc7, 0xb5, 0x21, 0xa0, 0x0 , 0xd3, 0x69, 0xc6, 0x9b, 0x40, 0x8 , 0xd4, 0x94, 
-	0xad, 0x49, 0x40, 0x5 , 0x1f, 0x8d, 0x14, 0x7e, 0x14, 0xee, 0x2 , 0x1f, 0xad, 
-	0x25, 0x3b, 0xf0, 0xa6, 0x9a, 0x60, 0x6 , 0x9b, 0x4e, 0x34, 0xda, 0x0 , 0x46, 
-	0xa4, 0xa5, 0x6a, 0x4a, 0x0 , 0x28, 0xfc, 0x68, 0xa3, 0xf0, 0xa0, 0x6 , 0xd1, 
-	0x45, 0x14, 0x0 , 0xdc, 0x51, 0x46, 0x68, 0xa0, 0x6 , 0xd1, 0x45, 0x14, 0x1 , 
-	0xf , 0xe3, 0x47, 0xe3, 0x47, 0xe1, 0x45, 0x49, 0xa0, 0x52, 0xaf, 0x4a, 0x41, 
-	0x4e, 0xa0, 0x2 , 0x9c, 0x28, 0xc5, 0x14, 0x0 , 0x63, 0xde, 0x94, 0x7d, 0x69, 
-	0x7f, 0xa , 0x3f, 0xa , 0x0 , 0x28, 0xa2, 0x94, 0xa , 0x4 , 0x0 , 0x52, 0xd1, 
-	0x4a, 0xa2, 0x80, 0xb8, 0x1 , 0x4b, 0x45, 0x28, 0xfa, 0x50, 0x3b, 0x80, 0xfa, 
-	0xd2, 0xfe, 0x34, 0x7e, 0x14, 0x50, 0x24, 0x14, 0x62, 0x8a, 0x72, 0xf4, 0xa4, 
-	0x1 , 0x4b, 0xd6, 0x92, 0x95, 0x69, 0xc , 0x5a, 0x28, 0x14, 0xbf, 0x85, 0x0 , 
-	0x2f, 0xe3, 0x47, 0xe3, 0x47, 0xe1, 0x45, 0x0 , 0x14, 0x62, 0x81, 0x4e, 0xa0, 
-	0x2 , 0x8c, 0x50, 0x29, 0xd4, 0x0 , 0x80, 0x52, 0xd1, 0x40, 0x14, 0x0 , 0xbd, 
-	0x29, 0x7f, 0x1a, 0x4c, 0x7b, 0x52, 0xd0, 0x48, 0x51, 0x45, 0x14, 0xc , 0x29, 
-	0xc2, 0x8c, 0x51, 0x40, 0x5 , 0x18, 0xa0, 0x53, 0xa8, 0x18, 0x51, 0x40, 0xa5, 
-	0xc5, 0x4 , 0x8b, 0xf8, 0xd1, 0xf8, 0xd1, 0xf8, 0x51, 0x40, 0x5 , 0x14, 0x52, 
-	0x81, 0x40, 0x9 , 0x4e, 0x14, 0x62, 0x8a, 0x1 , 0x85, 0x14, 0x52, 0xa8, 0xe2, 
-	0x80, 0x5 , 0xa5, 0xa3, 0x14, 0x50, 0x1 , 0x45, 0x37, 0x3e, 0x87, 0x34, 0x8c, 
-	0x40, 0xe5, 0x8e, 0x7d, 0x0 , 0x34, 0xae, 0x57, 0x2b, 0x9 , 0x1f, 0x3 , 0xb , 
-	0xd7, 0xd6, 0xa8, 0xdd, 0x31, 0xf3, 0x6 , 0x58, 0x29, 0x1f, 0x74, 0x9e, 0x9e, 
-	0xe6, 0xa4, 0xba, 0x94, 0xf2, 0x83, 0x3b, 0xbf, 0x8b, 0x6f, 0x61, 0xe8, 0x3d, 
-	0xeb, 0x3a, 0xf2, 0xe0, 0xaa, 0x9e, 0x14, 0x33, 0xe , 0xb9, 0xfb, 0xaa, 0x3f, 
-	0xcf, 0xe2, 0x6b, 0x39, 0x49, 0x1d, 0x14, 0xa9, 0xb2, 0x9e, 0xad, 0x72, 0x8a, 
-	0x19, 0x79, 0x58, 0xe3, 0x53, 0xd4, 0xf3, 0xcf, 0x7f, 0xa9, 0xae, 0x66, 0xe6, 
-	0x43, 0x2c, 0x9b, 0xb1, 0x8c, 0x9e, 0x0 , 0xab, 0xfa, 0xa4, 0xc1, 0xdb, 0xca, 
-	0x43, 0xb9, 0x89, 0xcb, 0x13, 0x54, 0xdb, 0x6a, 0x1e, 0x39, 0x6f, 0xe5, 0x5c, 
-	0x93, 0xa9, 0x76, 0x7b, 0x58, 0x7c, 0x37, 0x2a, 0xbb, 0x8 , 0xd7, 0x67, 0xce, 
-	0xdf, 0xc3, 0xc0, 0xa6, 0x33, 0x16, 0x38, 0x1c, 0x77, 0xa1, 0xb7, 0x74, 0x73, 
-	0xee, 0x69, 0xa4, 0xf7, 0x35, 0x8 , 0xea, 0x93, 0x4b, 0x4e, 0x83, 0xf7, 0x63, 
-	0x9f, 0xca, 0x91, 0x77, 0x33, 0xe1, 0x4e, 0x4f, 0xa9, 0xe8, 0x2a, 0x19, 0x1f, 
-	0x1f, 0x28, 0xfb, 0xde, 0x95, 0x26, 0x4a, 0x46, 0x14, 0x9f, 0x99, 0xb9, 0x6f, 
-	0xf6, 0x45, 0x16, 0x33, 0xf6, 0x97, 0x7e, 0x84, 0xd2, 0x3e, 0x19, 0x54, 0x3 , 
-	0x83, 0xda, 0xad, 0x46, 0x19, 0x71, 0x81, 0xba, 0x57, 0xe4, 0xe , 0xc3, 0xde, 
-	0xab, 0xd8, 0xa0, 0x66, 0x32, 0x3e, 0x3d, 0x85, 0x5b, 0x4c, 0xc , 0xb3, 0x7d, 
-	0xe7, 0xe4, 0xfb, 0xa , 0xca, 0x7b, 0xd8, 0xf4, 0x70, 0xf1, 0x6f, 0xde, 0x64, 
-	0xb0, 0x85, 0x48, 0xfa, 0xee, 0x6f, 0xef, 0x7a, 0x9a, 0x55, 0xc1, 0x19, 0xcf, 
-	0x3 , 0xa9, 0x3d, 0xe9, 0x87, 0x96, 0xc9, 0x38, 0x4 , 0x60, 0x7b, 0xa , 0x46, 
-	0x93, 0x8c, 0xe4, 0x5 , 0x1d, 0xf , 0xf5, 0xac, 0x5a, 0xb9, 0xe8, 0xf3, 0x28, 
-	0xaf, 0x22, 0x46, 0x9c, 0x2a, 0x92, 0x6 , 0x9 , 0x38, 0xe4, 0x7f, 0x2a, 0x88, 
-	0x9c, 0xb7, 0xef, 0x18, 0x8d, 0xdd, 0xbb, 0x9f, 0xc2, 0x9a, 0xd2, 0x1 , 0xd3, 
-	0xef, 0x7b, 0xff, 0x0 , 0x9e, 0x29, 0xb0, 0xef, 0x6e, 0x53, 0xe5, 0x3d, 0xdc, 
-	0xf5, 0x34, 0xd4, 0x6c, 0x63, 0x2a, 0xae, 0x4d, 0x2b, 0x93, 0x33, 0x88, 0xf8, 
-	0x1b, 0x53, 0x23, 0xbf, 0xde, 0x3f, 0x85, 0xa , 0xec, 0x7a, 0x75, 0xef, 0xbf, 
-	0x3f, 0xc8, 0x72, 0x69, 0x61, 0xb7, 0x5 , 0x8b, 0x1c, 0xfb, 0x93, 0x53, 0xc6, 
-	0x40, 0xf9, 0x13, 0x19, 0xf5, 0xf5, 0xa8, 0x72, 0x48, 0xd2, 0x34, 0xe7, 0x2d, 
-	0xf4, 0x1b, 0x1c, 0x6e, 0xeb, 0xba, 0x46, 0x28, 0xbd, 0x86, 0x40, 0xfe, 0x55, 
-	0x62, 0x35, 0x52, 0xbd, 0x18, 0x8f, 0x53, 0xc0, 0xfa, 0xfa, 0x9a, 0x6a, 0x24, 
-	0x6e, 0xdb, 0x9b, 0xe6, 0xc0, 0xf5, 0xfe, 0x83, 0xff, 0x0 , 0xaf, 0x53, 0x28, 
-	0xc3, 0xe4, 0xe1, 0x47, 0xab, 0xc , 0xb1, 0xfa, 0xa , 0xc6, 0x52, 0x3a, 0xe9, 
-	0xd2, 0xb2, 0x17, 0xe7, 0xfb, 0xa2, 0x4e, 0xf , 0x1b, 0x42, 0xd5, 0x8f, 0x2a, 
-	0x38, 0xdb, 0xe7, 0x55, 0xff, 0x0 , 0x74, 0xf6, 0xef, 0xd3, 0x81, 0x55, 0xbc, 
-	0xe8, 0xcb, 0x6c, 0xe , 0xce, 0x57, 0xb1, 0x3b, 0x7f, 0xae, 0x6a, 0x62, 0x4 , 
-	0x71, 0x65, 0x47, 0xef, 0x24, 0x3c, 0x2a, 0x9a, 0x5e, 0xa3, 0x76, 0xfb, 0x25, 
-	0xbb, 0x71, 0x31, 0xc1, 0x58, 0xc4, 0x6a, 0x3e, 0xee, 0xf3, 0xb8, 0xf , 0x7e, 
-	0x0 , 0xfc, 0x39, 0xab, 0x25, 0x64, 0xd , 0xba, 0xe2, 0x6c, 0x71, 0xc6, 0xe6, 
-	0x9 , 0xbb, 0xe8, 0xbc, 0x71, 0x54, 0x6d, 0xa3, 0xb9, 0xda, 0xbb, 0x9e, 0x38, 
-	0xf7, 0x37, 0x5d, 0xa7, 0x23, 0xfc, 0xfd, 0x29, 0xeb, 0x14, 0x11, 0xcb, 0xfe, 
-	0xb5, 0x99, 0x9c, 0xfc, 0xcf, 0x8c, 0xe7, 0xf3, 0x39, 0x35, 0x57, 0xd0, 0xcf, 
-	0x95, 0xb2, 0xcf, 0x9d, 0x23, 0x6f, 0x8e, 0x2f, 0x22, 0x35, 0x6e, 0x9 , 0x54, 
-	0xce, 0x39, 0xee, 0x4f, 0x24, 0xf1, 0xeb, 0x55, 0xee, 0x23, 0x70, 0xbb, 0xbc, 
-	0xd9, 0x30, 0xc4, 0x65, 0x87, 0xcb, 0xb8, 0xe7, 0xa6, 0x7f, 0xc2, 0xa4, 0x67, 
-	0x89, 0x3e, 0x55, 0x95, 0x32, 0xdc, 0xaa, 0x12, 0x18, 0x1c, 0x77, 0x0 , 0x10, 
-	0x3d, 0x69, 0xd2, 0x32, 0x95, 0xcb, 0x36, 0x76, 0x8f, 0xbc, 0x5b, 0x6e, 0x3b, 
-	0x63, 0x1e, 0xb4, 0xc3, 0x77, 0x62, 0xbc, 0x6b, 0x14, 0x70, 0xaf, 0x98, 0x84, 
-	0xb1, 0x3f, 0x2a, 0xe0, 0x9c, 0xfe, 0x7 , 0xfa, 0xd5, 0x88, 0x58, 0xc , 0x9 , 
-	0xa , 0x81, 0xd7, 0xca, 0x5f, 0xe6, 0x47, 0x7a, 0xa6, 0x1c, 0xbb, 0x62, 0xd5, 
-	0x76, 0xee, 0xea, 0xe4, 0x96, 0x6f, 0xc3, 0x3d, 0x2a, 0xcd, 0xbc, 0x2 , 0x3f, 
-	0xbe, 0xc5, 0x95, 0xfe, 0xf6, 0x38, 0xfc, 0xd8, 0xff, 0x0 , 0x4f, 0xce, 0xa2, 
-	0xcd, 0x9a, 0xa9, 0x46, 0x2a, 0xf6, 0x2d, 0x47, 0x32, 0x88, 0x81, 0x65, 0xdf, 
-	0xcf, 0xa , 0xa7, 0xf4, 0x3 , 0xbd, 0x4f, 0x29, 0x66, 0x81, 0x8c, 0x92, 0x4 , 
-	0x66, 0x19, 0xf2, 0xa1, 0x27, 0x77, 0xb6, 0x48, 0xef, 0xf9, 0x54, 0x30, 0x84, 
-	0x49, 0x32, 0x2e, 0x22, 0x84, 0xaa, 0xf5, 0x65, 0xf5, 0xf6, 0xed, 0x4e, 0x2c, 
-	0x46, 0x4 , 0x4b, 0xf2, 0xb9, 0x24, 0xc8, 0xdc, 0x96, 0x1e, 0x80, 0x77, 0xfa, 
-	0x9c, 0x1 , 0x5a, 0x45, 0x77, 0x39, 0x6a, 0x49, 0x6c, 0x85, 0xb7, 0x59, 0x8e, 
-	0x16, 0x34, 0x16, 0xf1, 0x8c, 0x1d, 0x8a, 0xb , 0x72, 0x7d, 0x71, 0xd4, 0xfb, 
-	0xf , 0x5e, 0xf5, 0x66, 0x42, 0x3a, 0x2a, 0x85, 0xdb, 0xc1, 0x50, 0x1 , 0x6e, 
-	0x7 , 0xa7, 0x45, 0xfa, 0x9c, 0xd2, 0xef, 0xa , 0xaa, 0x91, 0x6 , 0x42, 0x30, 
-	0x76, 0xee, 0xf9, 0x8f, 0x1d, 0x49, 0xf4, 0xa2, 0xdc, 0xe3, 0x2b, 0x84, 0xb , 
-	0xd5, 0xcc, 0x68, 0x8 , 0x3 , 0xa8, 0x0 , 0x9e, 0x5 , 0x69, 0x73, 0x99, 0xc4, 
-	0x86, 0xea, 0x4d, 0xb2, 0x2c, 0x9 , 0x6c, 0xd2, 0xc8, 0xc8, 0x59, 0x9d, 0x9f, 
-	0xee, 0x8f, 0x5f, 0xfe, 0xbf, 0xca, 0x2b, 0x2b, 0x50, 0x56, 0x78, 0xc4, 0x50, 
-	0x98, 0xd0, 0xe3, 0x73, 0x4a, 0x5f, 0x81, 0xee, 0x3d, 0xbf, 0xdd, 0x1c, 0xd6, 
-	0xa5, 0xca, 0x5b, 0xde, 0x2b, 0x6 , 0x56, 0x2a, 0x57, 0x71, 0x55, 0x24, 0x6f, 
-	0x3f, 0x53, 0xd7, 0xeb, 0xd3, 0xde, 0xab, 0x6a, 0x3a, 0x7a, 0x65, 0x64, 0x96, 
-	0x5 , 0x54, 0x8f, 0xc , 0xb1, 0x1e, 0xe3, 0xb6, 0x46, 0x79, 0xfa, 0x9e, 0x2a, 
-	0xd3, 0x31, 0x9c, 0x5b, 0xf4, 0x39, 0xb , 0xdb, 0x20, 0xb9, 0x9 , 0x28, 0x76, 
-	0x63, 0xf3, 0x48, 0xab, 0xc7, 0xe0, 0x4f, 0xf4, 0xcd, 0x62, 0xde, 0x41, 0x1a, 
-	0xb7, 0x7 , 0xe6, 0x5e, 0xa3, 0x3c, 0xfe, 0x55, 0xd8, 0x6a, 0x50, 0xc9, 0x74, 
-	0x2 , 0xbc, 0xb2, 0x48, 0x7a, 0x6f, 0x70, 0x23, 0x8b, 0xe8, 0xbd, 0xcf, 0xd0, 
-	0x71, 0xed, 0x58, 0x37, 0xd1, 0x5b, 0x29, 0xca, 0x18, 0xe4, 0xda, 0x79, 0x29, 
-	0xc8, 0x1e, 0xde, 0x9f, 0xa5, 0x6d, 0x9 , 0xd8, 0xe1, 0xc4, 0x61, 0xd4, 0xa3, 
-	0xad, 0x8c, 0xd , 0xa5, 0x64, 0xc2, 0x90, 0x79, 0xef, 0x5a, 0x7a, 0x58, 0xd9, 
-	0xb , 0xcd, 0x87, 0x42, 0x9f, 0x70, 0xe3, 0xe5, 0xcf, 0x19, 0xfe, 0x95, 0xc , 
-	0x88, 0x8b, 0x36, 0x76, 0xe5, 0x49, 0xf9, 0x86, 0x31, 0xc5, 0x6c, 0x69, 0xeb, 
-	0x1d, 0xb5, 0x8c, 0xb1, 0x94, 0xd , 0x1c, 0xe9, 0x94, 0x6c, 0x6e, 0x1f, 0x43, 
-	0xe8, 0x78, 0xeb, 0xf5, 0xed, 0x5b, 0x4a, 0x57, 0x89, 0xe4, 0xd0, 0xa2, 0xe3, 
-	0x51, 0xa2, 0x28, 0x72, 0xad, 0xe6, 0x49, 0xfc, 0x67, 0x0 , 0xf6, 0x15, 0xb7, 
-	0xa2, 0xcb, 0xe5, 0xc8, 0x8e, 0x19, 0x97, 0x69, 0x19, 0x75, 0xed, 0xf8, 0xfe, 
-	0xb5, 0xcf, 0xda, 0xe5, 0x18, 0x29, 0x27, 0xcb, 0x3f, 0xc2, 0xdf, 0xd3, 0xd2, 
-	0xb6, 0xac, 0xd4, 0x24, 0x62, 0x58, 0x1d, 0xbc, 0xa6, 0xe1, 0x8e, 0x79, 0x4f, 
-	0x66, 0xf4, 0xfa, 0xd7, 0x34, 0xd1, 0xef, 0x61, 0xaa, 0x28, 0xee, 0x74, 0xda, 
-	0xa5, 0xb2, 0x4d, 0x6e, 0x1e, 0x28, 0x76, 0xc8, 0xa4, 0x30, 0x71, 0xc8, 0xdc, 
-	0x7b, 0xf1, 0xd0, 0x1c, 0x7e, 0x7 , 0xf1, 0xa3, 0x4d, 0xba, 0x90, 0x46, 0xd6, 
-	0x37, 0xea, 0xe8, 0x98, 0x6 , 0x2b, 0x85, 0xf9, 0x48, 0x23, 0xa7, 0xb0, 0x3f, 
-	0xe4, 0xd4, 0x9e, 0x1f, 0x95, 0x5 , 0xaf, 0xd9, 0xe6, 0xca, 0xb6, 0xed, 0x9b, 
-	0x87, 0x24, 0x67, 0x9f, 0xcb, 0xfc, 0xf4, 0xa9, 0xaf, 0xa1, 0x77, 0x26, 0x39, 
-	0x8f, 0xcc, 0x1b, 0xe5, 0x65, 0x5e, 0xfc, 0x60, 0xfe, 0x3f, 0xcf, 0xeb, 0x58, 
-	0x5f, 0xa1, 0xea, 0x3a, 0x7f, 0x69, 0xf , 0xb5, 0x96, 0xe6, 0xd5, 0xb0, 0xcc, 
-	0xaf, 0xe5, 0x8f, 0x9d, 0x31, 0xf2, 0xb8, 0xf5, 0x1e, 0x95, 0x77, 0x4a, 0xbd, 
-	0x44, 0x62, 0x58, 0xf , 0x22, 0x4f, 0x98, 0xaf, 0xa7, 0xe1, 0xfa, 0x1a, 0xce, 
-	0x86, 0x68, 0xe4, 0x98, 0x5b, 0x5e, 0xc4, 0xbb, 0xc2, 0xd , 0xb2, 0xa0, 0xfb, 
-	0xc3, 0xae, 0x41, 0x1f, 0xcb, 0xeb, 0x42, 0x62, 0x8 , 0xcc, 0x9b, 0xf7, 0xdb, 
-	0x38, 0xdc, 0x64, 0x8f, 0x82, 0x1 , 0xe8, 0x48, 0xa4, 0xf5, 0x2a, 0x2f, 0x91, 
-	0xdf, 0xa1, 0xab, 0x79, 0x15, 0xa9, 0x67, 0x92, 0x12, 0x16, 0x36, 0x3 , 0x71, 
-	0x53, 0xca, 0xe7, 0xa6, 0x4f, 0xf2, 0x6e, 0x86, 0xa1, 0x63, 0x30, 0x81, 0x6d, 
-	0xe6, 0x21, 0xd4, 0x28, 0xf2, 0xe4, 0x7 , 0x18, 0xfa, 0x8f, 0xe7, 0x51, 0x59, 
-	0xce, 0x91, 0x6d, 0x1 , 0xc1, 0xe3, 0xe4, 0x60, 0x38, 0x75, 0xf7, 0xff, 0x0 , 
-	0xa , 0x92, 0x70, 0x53, 0x1e, 0x5f, 0x31, 0x95, 0x24, 0x20, 0xfe, 0xe , 0x9f, 
-	0xf8, 0xe9, 0xf4, 0xa8, 0x37, 0x5b, 0xdd, 0x9 , 0x6e, 0x80, 0x96, 0x89, 0xc0, 
-	0x11, 0xaf, 0xf0, 0xb7, 0x3b, 0xf , 0xa8, 0x3d, 0x87, 0xbf, 0xbd, 0x32, 0x7b, 
-	0x7d, 0xd9, 0x68, 0xd8, 0x9 , 0x14, 0x61, 0x84, 0x83, 0xe5, 0xfa, 0x9f, 0xcf, 
-	0xaf, 0x63, 0x83, 0x4b, 0x5 , 0xce, 0x23, 0xc , 0xfe, 0xa5, 0x58, 0x11, 0xca, 
-	0x8f, 0xf0, 0xa9, 0x99, 0x5d, 0xf7, 0x2 , 0x59, 0x64, 0x8c, 0xe4, 0x15, 0x1c, 
-	0x91, 0x9e, 0xfd, 0xb8, 0xfe, 0x55, 0x9b, 0x66, 0xea, 0x2b, 0xa7, 0xf5, 0xe4, 
-	0x71, 0xda, 0xc5, 0xa0, 0xb3, 0xd4, 0x59, 0x8c, 0x52, 0x20, 0x90, 0xe7, 0x86, 
-	0x1f, 0x29, 0xcf, 0x71, 0xdf, 0xea, 0x3b, 0xd4, 0xd6, 0xb7, 0xbe, 0x5c, 0x85, 
-	0x9c, 0x6f, 0x8e, 0x4f, 0xbe, 0x70, 0x39, 0xff, 0x0 , 0xeb, 0xff, 0x0 , 0x3a, 
-	0xdd, 0xd5, 0x42, 0x4d, 0x1b, 0x47, 0x3a, 0xb3, 0x22, 0xfd, 0xe5, 0x3 , 0x94, 
-	0xed, 0xf9, 0x1f, 0xfe, 0xb5, 0x72, 0xf7, 0x50, 0x7d, 0x92, 0x56, 0xe , 0x43, 
-	0x42, 0xc3, 0xe5, 0x91, 0x9 , 0x2b, 0x8e, 0xd9, 0x1f, 0xc2, 0xd8, 0xed, 0xd0, 
-	0xd6, 0xaa, 0x5c, 0xeb, 0xcc, 0xe3, 0x9d, 0x3f, 0x63, 0x3b, 0xaf, 0x85, 0x9a, 
-	0x31, 0xdc, 0x24, 0x39, 0x78, 0xc0, 0x2b, 0x90, 0xcb, 0xb4, 0xfc, 0xd1, 0x9f, 
-	0x50, 0x7d, 0x2a, 0xfd, 0xb5, 0xd7, 0xda, 0x7 , 0x9b, 0x1b, 0xfc, 0xf8, 0xc1, 
-	0x0 , 0x75, 0xeb, 0xc1, 0x15, 0xce, 0xac, 0xac, 0x8d, 0xb3, 0x76, 0x40, 0xe5, 
-	0x47, 0xa8, 0xf6, 0xa9, 0xa3, 0xb8, 0xda, 0x43, 0x23, 0x15, 0x3d, 0x18, 0xf , 
-	0xd0, 0xd6, 0x52, 0xd8, 0xec, 0xa5, 0x2b, 0x49, 0x33, 0x52, 0xe1, 0x3 , 0xc6, 
-	0x5d, 0x0 , 0xdb, 0x9c, 0xb2, 0x83, 0xd3, 0xdf, 0xda, 0x99, 0x65, 0x29, 0xda, 
-	0x22, 0x63, 0x82, 0x9 , 0x31, 0x91, 0xd8, 0x8e, 0xc6, 0x98, 0xb2, 0xf9, 0x91, 
-	0xef, 0x56, 0xc3, 0xaf, 0xe4, 0x7e, 0xb4, 0xc9, 0xe , 0x48, 0x65, 0x3b, 0x58, 
-	0x75, 0xc7, 0x63, 0x4a, 0x85, 0x47, 0x4e, 0x69, 0x9a, 0xe6, 0x18, 0x58, 0xe2, 
-	0xb0, 0xee, 0x2f, 0x7d, 0xd1, 0xaf, 0xb , 0xef, 0x5f, 0x42, 0xf , 0x22, 0x9d, 
-	0x54, 0xed, 0x66, 0x32, 0x46, 0x1d, 0x7e, 0xfa, 0xf0, 0xc0, 0x77, 0x15, 0x71, 
-	0x58, 0x30, 0xc8, 0xaf, 0xa4, 0xa5, 0x53, 0x9e, 0x29, 0x9f, 0x94, 0x63, 0x30, 
-	0xf2, 0xa3, 0x51, 0xab, 0x5 , 0x14, 0x51, 0x5a, 0x9c, 0x61, 0x45, 0x14, 0x71, 
-	0xdc, 0xd0, 0x1 , 0x47, 0xe3, 0x47, 0xe1, 0x47, 0xe1, 0x40, 0x7 , 0xe3, 0x47, 
-	0xe3, 0x47, 0xe1, 0x47, 0xe1, 0x40, 0x7 , 0xe3, 0x4d, 0x6a, 0x77, 0xe1, 0x49, 
-	0x8f, 0x6a, 0x0 , 0x4a, 0x28, 0xa2, 0x80, 0xa , 0x46, 0xa5, 0xa3, 0x14, 0x0 , 
-	0xda, 0x28, 0xa2, 0x80, 0xa , 0x28, 0xea, 0x29, 0x3a, 0x50, 0x2 , 0x51, 0x45, 
-	0x14, 0x0 , 0x51, 0xf8, 0xd1, 0x47, 0xe1, 0x40, 0x7 , 0xe3, 0x4d, 0x6a, 0x77, 
-	0xe1, 0x4d, 0x34, 0x0 , 0x52, 0x11, 0x4b, 0x45, 0x0 , 0x36, 0x8a, 0x52, 0x29, 
-	0x29, 0x80, 0x1a, 0x6d, 0x38, 0xd3, 0x69, 0x80, 0x51, 0xf8, 0xd1, 0x47, 0xe1, 
-	0x40, 0x7 , 0xe3, 0x4d, 0x6a, 0x77, 0xe1, 0x4d, 0x34, 0x0 , 0x8d, 0x49, 0x4e, 
-	0xa6, 0x9a, 0x0 , 0x29, 0x1a, 0x96, 0x91, 0xa8, 0x1 , 0x28, 0xfc, 0x68, 0xa3, 
-	0xf0, 0xa0, 0x4 , 0xfc, 0x69, 0xd , 0x2e, 0x3d, 0xa9, 0xd , 0x3d, 0x0 , 0x46, 
-	0xa4, 0xa5, 0x6a, 0x4a, 0x60, 0x23, 0x52, 0x52, 0xb5, 0x25, 0x0 , 0x14, 0x7e, 
-	0x34, 0x51, 0xf8, 0x50, 0x3 , 0x68, 0xa5, 0x6f, 0xa5, 0x25, 0x0 , 0x36, 0x8a, 
-	0x52, 0x29, 0x28, 0x1 , 0xb4, 0x51, 0x45, 0x0 , 0x43, 0x45, 0x14, 0xa0, 0x54, 
-	0x9a, 0xb , 0x46, 0x28, 0xa7, 0x2f, 0x4a, 0x0 , 0x29, 0x57, 0xeb, 0x48, 0x29, 
-	0xdf, 0x85, 0x2 , 0xb8, 0x7e, 0x34, 0x51, 0x45, 0x3 , 0xa , 0x70, 0xa3, 0x14, 
-	0x50, 0x1 , 0x4e, 0x14, 0x62, 0x8a, 0x0 , 0x51, 0xf5, 0xa5, 0xfc, 0x68, 0xfc, 
-	0x28, 0xfc, 0x28, 0x0 , 0xfc, 0x68, 0xa2, 0x94, 0xa , 0x0 , 0x0 , 0xa5, 0xa0, 
-	0x52, 0xe2, 0xa4, 0x48, 0x0 , 0xa5, 0xa2, 0x95, 0x7e, 0x94, 0xc , 0x5f, 0xc6, 
-	0x8f, 0xc6, 0x8f, 0xc2, 0x8f, 0xc2, 0x80, 0xa , 0x28, 0x14, 0xb8, 0xa0, 0x40, 
-	0x5 , 0x2d, 0x14, 0xa0, 0x50, 0x1 , 0x8a, 0x5a, 0x29, 0x40, 0xa0, 0x60, 0x3e, 
-	0xb4, 0xbf, 0x8d, 0x1f, 0x85, 0x1f, 0x85, 0x0 , 0x14, 0x51, 0x45, 0x0 , 0x14, 
-	0xe1, 0x46, 0x28, 0xa0, 0x2 , 0x97, 0x14, 0x2d, 0x2d, 0x2 , 0x10, 0xa , 0x5a, 
-	0x5 , 0x2f, 0xe1, 0x40, 0x85, 0xfc, 0x68, 0xfc, 0x69, 0x7 , 0xd2, 0x97, 0xf0, 
-	0xa0, 0x61, 0x45, 0x14, 0x50, 0x20, 0xa5, 0x5a, 0x31, 0x4b, 0x40, 0xfa, 0x5 , 
-	0x14, 0xa , 0x5c, 0x50, 0x21, 0x5 , 0x3b, 0x34, 0x84, 0x52, 0x72, 0x7 , 0x51, 
-	0x48, 0xab, 0x3 , 0x3 , 0x47, 0x1f, 0xc5, 0x93, 0x4d, 0x91, 0x88, 0xee, 0x2a, 
-	0x19, 0x26, 0xd9, 0xf7, 0x91, 0xb3, 0xea, 0x54, 0x91, 0x50, 0xe6, 0x96, 0xe7, 
-	0x45, 0x3c, 0x3d, 0x49, 0xfc, 0x24, 0xce, 0xea, 0xa3, 0xa6, 0x7e, 0x95, 0xc , 
-	0xf2, 0x6c, 0x5d, 0xce, 0x9c, 0xff, 0x0 , 0xa , 0xe7, 0x0 , 0x54, 0x6d, 0x76, 
-	0xad, 0xc9, 0x99, 0x57, 0x1d, 0x32, 0x31, 0xfe, 0x35, 0x46, 0xea, 0xea, 0x1c, 
-	0x17, 0x7b, 0x8d, 0xd8, 0xec, 0xa4, 0x73, 0x59, 0xca, 0xac, 0x7b, 0x9d, 0x34, 
-	0xf0, 0x53, 0xbe, 0xb1, 0x7f, 0x73, 0x12, 0xee, 0xe9, 0x82, 0x11, 0x9c, 0x5 , 
-	0x3d, 0x3b, 0xb1, 0xfa, 0x56, 0x2e, 0xb1, 0x70, 0xf9, 0x24, 0xb7, 0xcc, 0xde, 
-	0xbd, 0xfd, 0x3f, 0xa , 0x9a, 0xf2, 0xe6, 0x22, 0xa5, 0xbd, 0xb0, 0xa2, 0xb3, 
-	0x26, 0x6f, 0x31, 0xb7, 0x31, 0x6e, 0x3a, 0x71, 0x5c, 0xb3, 0xa9, 0x73, 0xd9, 
-	0xa3, 0x84, 0x49, 0x5d, 0x2b, 0x7f, 0x5d, 0xca, 0xed, 0xf2, 0x64, 0xc , 0xee, 
-	0x6e, 0xa6, 0x99, 0x9c, 0x70, 0x29, 0xfe, 0x50, 0x19, 0x6d, 0xe4, 0xe7, 0xb9, 
-	0xa8, 0x66, 0x91, 0x54, 0x6d, 0x51, 0xcf, 0xad, 0x4a, 0x77, 0xd8, 0xb9, 0x27, 
-	0x5 , 0x79, 0x68, 0x19, 0x0 , 0x12, 0xd5, 0xc , 0x92, 0xf3, 0xc7, 0xe1, 0x4c, 
-	0x91, 0xcb, 0x36, 0x4d, 0x22, 0xe3, 0xa9, 0xad, 0x14, 0x4e, 0x9 , 0xd6, 0x6d, 
-	0xda, 0x24, 0x96, 0xe3, 0x69, 0xdc, 0xc6, 0xac, 0x42, 0xbb, 0xdb, 0x68, 0x3f, 
-	0x78, 0xf2, 0x6a, 0x15, 0x4 , 0x8e, 0x47, 0x26, 0xae, 0x41, 0xf2, 0x2e, 0x0 , 
-	0xe7, 0x38, 0x6 , 0x94, 0x99, 0xd1, 0x87, 0x82, 0x7a, 0x3d, 0x89, 0x97, 0x68, 
-	0x1b, 0x33, 0xf2, 0xaf, 0x2f, 0xfe, 0xd1, 0xec, 0xb4, 0xe5, 0x61, 0xb0, 0xbb, 
-	0xf2, 0x58, 0xfe, 0x66, 0xa3, 0x51, 0x96, 0xdb, 0x9c, 0x5 , 0xa7, 0x67, 0x32, 
-	0x1e, 0x30, 0xab, 0xdf, 0xd2, 0xb0, 0x92, 0x3d, 0x68, 0x3b, 0x7f, 0x5f, 0xd6, 
-	0xc4, 0x9b, 0xb3, 0x9d, 0xe4, 0x63, 0x19, 0x23, 0xd2, 0x9a, 0xc7, 0x7f, 0x39, 
-	0xb , 0xef, 0x43, 0x0 , 0x78, 0x3f, 0x2f, 0x7d, 0xbf, 0xe3, 0x4e, 0x55, 0x25, 
-	0x86, 0x1 , 0xcf, 0x61, 0x53, 0xb1, 0xa3, 0xbc, 0xb4, 0x4 , 0x40, 0x30, 0x3e, 
-	0xf1, 0x35, 0x23, 0x10, 0x98, 0x4 , 0xe7, 0xd8, 0xa , 0x63, 0x3a, 0xa0, 0xda, 
-	0x32, 0xcc, 0x7a, 0xe2, 0x96, 0x38, 0x59, 0xc6, 0x65, 0x23, 0x3 , 0xf8, 0x4f, 
-	0x4a, 0x87, 0xdd, 0x9b, 0x46, 0x36, 0xd2, 0x2b, 0x52, 0x48, 0xcb, 0xc8, 0xbd, 
-	0x4e, 0xf , 0x4f, 0x43, 0xfd, 0x4d, 0x4f, 0x12, 0x6c, 0x5c, 0x48, 0xbb, 0x7d, 
-	0xa9, 0x9b, 0x96, 0x2f, 0xb8, 0x7e, 0x66, 0xff, 0x0 , 0xbe, 0xbf, 0xfa, 0xd4, 
-	0xc5, 0x6c, 0xf2, 0xc4, 0x1 , 0xec, 0x3f, 0xad, 0x64, 0xf5, 0xf4, 0x3a, 0x23, 
-	0x68, 0x6e, 0xee, 0xc9, 0xfc, 0xcc, 0x2a, 0x81, 0xc6, 0x7a, 0x6d, 0xff, 0x0 , 
-	0x1a, 0x1b, 0x9c, 0x6f, 0x7f, 0x2f, 0xfb, 0xc4, 0x93, 0x93, 0x50, 0x2c, 0x87, 
-	0xfe, 0x59, 0xfc, 0xa1, 0x87, 0x2d, 0xdc, 0xfe, 0x34, 0xf5, 0x70, 0x84, 0x3 , 
-	0x28, 0x5c, 0xf6, 0xc6, 0x58, 0xff, 0x0 , 0x5a, 0x5c, 0xa1, 0xed, 0x14, 0x96, 
-	0xac, 0xb5, 0x1b, 0x47, 0x12, 0x85, 0x54, 0xdb, 0x8e, 0x99, 0x18, 0xcf, 0xe5, 
-	0xc9, 0xa9, 0x56, 0xe6, 0x4d, 0xdb, 0x52, 0x38, 0xe3, 0xdd, 0xd5, 0xb6, 0xe3, 
-	0xff, 0x0 , 0xae, 0x6b, 0x35, 0xee, 0xb1, 0x27, 0xcb, 0xbb, 0x39, 0xc0, 0xf5, 
-	0xa9, 0x55, 0x9f, 0x7e, 0xe9, 0x5b, 0x6e, 0x47, 0xdd, 0x4 , 0x92, 0x7e, 0xa4, 
-	0xff, 0x0 , 0x2a, 0x5c, 0xaf, 0xa8, 0xe3, 0x59, 0x5e, 0xd1, 0x2f, 0x6e, 0x41, 
-	0x21, 0x77, 0x91, 0x9d, 0x48, 0xc0, 0x38, 0xe7, 0xe8, 0x7 , 0x41, 0xf9, 0x52, 
-	0xca, 0xea, 0xc3, 0x9 , 0x13, 0x2f, 0x6c, 0xb1, 0x7 , 0xf2, 0x0 , 0x55, 0x4c, 
-	0x9f, 0x30, 0x12, 0x3e, 0x5e, 0xca, 0x79, 0xe3, 0xda, 0xa4, 0xf3, 0x62, 0xc , 
-	0x4b, 0x92, 0xc7, 0xf8, 0x50, 0x77, 0xfc, 0xa9, 0x1 , 0x62, 0x19, 0x5e, 0x25, 
-	0x3b, 0x81, 0x51, 0xc0, 0x25, 0x54, 0x17, 0x3f, 0x8f, 0x6a, 0x91, 0x5f, 0x70, 
-	0x5 , 0x94, 0x85, 0x5e, 0x40, 0x3d, 0x7f, 0x2e, 0x5 , 0x55, 0x86, 0x4c, 0x63, 
-	0x78, 0xcb, 0x7f, 0xa , 0x80, 0x6 , 0x3f, 0xe , 0xd4, 0xef, 0x3d, 0x15, 0x58, 
-	0xbf, 0x4f, 0x45, 0x27, 0x93, 0xe9, 0x4b, 0xd0, 0xa8, 0xe8, 0xb5, 0x27, 0x8e, 
-	0x46, 0x69, 0x19, 0x61, 0x55, 0x7 , 0xbb, 0x37, 0x1b, 0x7 , 0xd7, 0xb7, 0xe9, 
-	0x52, 0xa4, 0xe9, 0xe6, 0xf , 0x98, 0xc8, 0xc0, 0x61, 0x64, 0x73, 0xf2, 0x8f, 
-	0xa0, 0xea, 0x7f, 0x4a, 0xa0, 0xaf, 0x34, 0xcd, 0x85, 0x50, 0xab, 0xfd, 0xd5, 
-	0xe5, 0x7f, 0x13, 0xdc, 0xfe, 0x95, 0x2c, 0x2e, 0xb1, 0xb7, 0x4 , 0xb3, 0x67, 
-	0x96, 0xf4, 0xf6, 0x1e, 0xa6, 0x84, 0x4c, 0xb5, 0xd5, 0xec, 0x69, 0x5b, 0xc1, 
-	0x34, 0x97, 0x1b, 0xe4, 0x8d, 0xe6, 0x61, 0xd3, 0x78, 0x0 , 0x27, 0xb9, 0x1d, 
-	0x7 , 0xf3, 0xab, 0x73, 0xbb, 0x23, 0x7c, 0x98, 0xf9, 0x8e, 0xc , 0x85, 0x4e, 
-	0xe , 0x3b, 0x2f, 0xf8, 0xf1, 0x54, 0xe1, 0x95, 0xc4, 0x25, 0x4b, 0x6c, 0x40, 
-	0x9 , 0x65, 0x38, 0xff, 0x0 , 0x20, 0xff, 0x0 , 0x2a, 0x81, 0xb5, 0x5 , 0x4c, 
-	0x79, 0x8 , 0x59, 0xf8, 0x1e, 0x63, 0x1c, 0x2f, 0xd0, 0xe , 0xbf, 0xd4, 0xd6, 
-	0x9a, 0x18, 0x73, 0x33, 0x4a, 0x19, 0x19, 0xf2, 0xd2, 0xee, 0x90, 0x9f, 0x95, 
-	0x55, 0xb2, 0x17, 0xaf, 0xa7, 0x53, 0xf5, 0xa0, 0xa2, 0xc9, 0x2f, 0xef, 0x27, 
-	0x48, 0x55, 0x7f, 0x87, 0xb9, 0x3f, 0xee, 0x8e, 0x9f, 0xa9, 0xac, 0xb9, 0x2f, 
-	0xa4, 0x8f, 0x2d, 0x23, 0x2a, 0xb0, 0x3f, 0x77, 0xf8, 0xbf, 0x13, 0xfc, 0x3f, 
-	0x41, 0x51, 0x8b, 0xb7, 0x91, 0xb7, 0x2e, 0x1a, 0x4e, 0x7e, 0x63, 0xf2, 0xa8, 
-	0xfc, 0x3b, 0xd1, 0x71, 0x38, 0x9d, 0x17, 0x99, 0x6e, 0x8a, 0x61, 0x8e, 0x6d, 
-	0xaa, 0xa7, 0x2f, 0xf3, 0x60, 0x67, 0xd4, 0xb1, 0xe6, 0xa3, 0x9a, 0xf2, 0xde, 
-	0xd6, 0xdc, 0xa5, 0xad, 0x9a, 0x39, 0x23, 0xae, 0xb , 0x2f, 0xd7, 0x9f, 0xbd, 
-	0xf5, 0x35, 0x95, 0x66, 0x25, 0xb9, 0xe0, 0x6 , 0x90, 0xf5, 0x24, 0x8c, 0xe4, 
-	0xfa, 0x1 , 0xda, 0xb7, 0x34, 0xdf, 0xe , 0x6a, 0x37, 0x8b, 0xb4, 0x44, 0x42, 
-	0xb7, 0x38, 0xad, 0x63, 0x16, 0x73, 0x56, 0xac, 0x96, 0xc7, 0x27, 0xac, 0x49, 
-	0x6e, 0xd2, 0x79, 0xad, 0x23, 0x4d, 0x23, 0x2 , 0xa4, 0x9c, 0xf1, 0xfe, 0xca, 
-	0x1 , 0x80, 0x3f, 0x97, 0xbd, 0x64, 0x43, 0x69, 0x7b, 0xa8, 0x36, 0x20, 0x81, 
-	0x61, 0x8d, 0x46, 0x51, 0x8a, 0xe4, 0x9e, 0x7f, 0x21, 0xf8, 0xa , 0xf6, 0xcf, 
-	0xc , 0xfc, 0x27, 0xba, 0xba, 0x93, 0xcf, 0x78, 0x5b, 0xf7, 0x98, 0x24, 0x95, 
-	0xf4, 0xf7, 0x3f, 0x85, 0x77, 0xfa, 0xf , 0xc1, 0x9b, 0x78, 0xa3, 0xf3, 0x65, 
-	0x88, 0x81, 0x9c, 0x92, 0x47, 0xd , 0xf8, 0xfe, 0x15, 0xd5, 0x1b, 0x24, 0x78, 
-	0x75, 0xe5, 0x52, 0x72, 0xdf, 0xee, 0x3e, 0x4d, 0x6d, 0x16, 0xf7, 0x12, 0x66, 
-	0xdd, 0x87, 0x96, 0x33, 0x9c, 0x71, 0x51, 0x3 , 0x3d, 0xbb, 0x34, 0x1f, 0x2a, 
-	0x86, 0xfe, 0xf , 0x7f, 0x6a, 0xfb, 0x13, 0x5a, 0xf8, 0x57, 0x0 , 0xd3, 0x64, 
-	0xc5, 0xb8, 0xda, 0x3a, 0x7c, 0xa3, 0xd2, 0xbc, 0x3 , 0xe2, 0x37, 0x81, 0x85, 
-	0xa5, 0xd4, 0x8e, 0x23, 0x65, 0x64, 0x6e, 0xa0, 0x62, 0x9f, 0x3a, 0x7a, 0x1c, 
-	0xf1, 0xa7, 0x52, 0x12, 0xe6, 0x38, 0x4b, 0x31, 0x1c, 0xdb, 0x3 , 0x8e, 0x49, 
-	0xc1, 0x1f, 0xe7, 0xa5, 0x6a, 0x5a, 0x42, 0xf6, 0xf7, 0x11, 0xb8, 0xc , 0xbb, 
-	0x86, 0x8 , 0x3f, 0xc6, 0xa7, 0xd7, 0xde, 0xb1, 0xe4, 0x46, 0xb6, 0x7f, 0x98, 
-	0x90, 0xc8, 0xdb, 0x77, 0x67, 0xf9, 0xfe, 0xb5, 0xd8, 0x68, 0x2b, 0x6f, 0xaa, 
-	0x59, 0xa2, 0xed, 0x5f, 0xb4, 0x46, 0x6 , 0x55, 0xb3, 0x93, 0xd3, 0x24, 0x63, 
-	0xf0, 0x38, 0xf6, 0xac, 0x27, 0x78, 0x9e, 0xd6, 0x1e, 0x51, 0xab, 0xea, 0x4d, 
-	0xa6, 0xcc, 0x60, 0xff, 0x0 , 0x54, 0xa0, 0xa4, 0x47, 0x6b, 0x23, 0xb7, 0x2a, 
-	0xf , 0x6f, 0xa7, 0xa5, 0x6f, 0x59, 0x91, 0x2c, 0x5f, 0xba, 0xf9, 0xf7, 0xd , 
-	0xca, 0x33, 0xcf, 0xfb, 0xb8, 0xef, 0xf8, 0x7b, 0x56, 0x5f, 0x93, 0x24, 0x52, 
-	0x29, 0x64, 0x2d, 0xbf, 0xe5, 0xc8, 0x5f, 0xbc, 0xbd, 0x81, 0xf5, 0x20, 0x67, 
-	0x91, 0xf5, 0xfa, 0x49, 0x19, 0x7d, 0x32, 0x4c, 0xaa, 0x9f, 0x2a, 0x62, 0xa , 
-	0x90, 0x79, 0xd , 0xdc, 0x67, 0xb6, 0x6b, 0x9 , 0x1e, 0x9d, 0x19, 0x38, 0x68, 
-	0xf6, 0x25, 0xd5, 0x2d, 0x44, 0x91, 0x89, 0xd9, 0xa4, 0x2 , 0x13, 0xbe, 0x27, 
-	0x8f, 0x3b, 0x90, 0xff, 0x0 , 0x10, 0x61, 0xdf, 0x91, 0x9f, 0xce, 0xaa, 0x3f, 
-	0x9f, 0x6f, 0x19, 0x9a, 0xda, 0x35, 0x19, 0x3b, 0x9e, 0x31, 0x9d, 0xb2, 0x7f, 
-	0xb4, 0xbe, 0x9f, 0x4a, 0xd9, 0x79, 0x84, 0xd6, 0xab, 0x3c, 0x61, 0x7c, 0xc6, 
-	0x53, 0xe6, 0x29, 0x3f, 0x7c, 0x73, 0xfa, 0x8f, 0x5c, 0x56, 0x64, 0xc8, 0x5b, 
-	0x6b, 0x46, 0xce, 0x13, 0x90, 0x4c, 0x83, 0x5 , 0x47, 0x3c, 0x1f, 0xf3, 0xef, 
-	0x51, 0x73, 0xa1, 0xc5, 0x74, 0x22, 0x47, 0x58, 0xe3, 0x17, 0x96, 0xf2, 0x95, 
-	0xb7, 0x7f, 0xf5, 0xa8, 0xc3, 0xfd, 0x59, 0xf6, 0x1e, 0x9c, 0xfe, 0x15, 0x6e, 
-	0xde, 0xe0, 0x3a, 0xa7, 0x1b, 0x93, 0x1c, 0x95, 0x39, 0x23, 0xdc, 0x7b, 0x7f, 
-	0x2e, 0x95, 0x9a, 0xaa, 0xf6, 0xb7, 0x47, 0x68, 0xca, 0x4c, 0x70, 0x54, 0xfa, 
-	0xfb, 0x67, 0xdf, 0xb7, 0xd7, 0xd6, 0xa6, 0x58, 0x82, 0xc6, 0xc6, 0x23, 0xb5, 
-	0x71, 0xf7, 0x3a, 0xed, 0x3d, 0xf1, 0xed, 0xfc, 0xa8, 0x12, 0xbe, 0x9d, 0xcb, 
-	0x97, 0x6b, 0x24, 0x65, 0x5f, 0x6a, 0xb4, 0x6c, 0x3e, 0x56, 0x53, 0xc1, 0xcf, 
-	0x6f, 0xf3, 0xe9, 0x4f, 0xb7, 0xb9, 0x9a, 0x1b, 0x84, 0x5 , 0xf8, 0xc6, 0x17, 
-	0x3c, 0x6 , 0x18, 0xf5, 0xf5, 0xaa, 0xda, 0x5d, 0xf1, 0x45, 0x68, 0xa5, 0x3e, 
-	0x66, 0x33, 0xf2, 0xf5, 0xc8, 0xef, 0x8f, 0xa7, 0x7a, 0x73, 0x70, 0x8d, 0x25, 
-	0xb6, 0x4c, 0x2b, 0x9d, 0xe8, 0xdf, 0xc3, 0xdf, 0x24, 0x7a, 0x7d, 0x2b, 0x39, 
-	0x23, 0xaa, 0x94, 0xee, 0x69, 0x5c, 0xa4, 0x73, 0x32, 0xcf, 0xa , 0x3 , 0xbd, 
-	0x4e, 0x40, 0x1c, 0x83, 0xed, 0xd8, 0x8f, 0x6f, 0xca, 0xb9, 0xdd, 0x72, 0xd6, 
-	0x68, 0xb7, 0xdd, 0x5a, 0x15, 0xe3, 0x29, 0x2a, 0x91, 0xf2, 0xb8, 0xff, 0x0 , 
-	0x68, 0x7f, 0x9f, 0x5e, 0x3a, 0xd6, 0xbd, 0x9c, 0xc5, 0x3e, 0x78, 0xdb, 0x1e, 
-	0xaa, 0xf , 0x4 , 0x66, 0x9d, 0x70, 0x63, 0x91, 0x7c, 0xd5, 0x71, 0xbf, 0xa7, 
-	0x5e, 0xf , 0xb3, 0xf , 0xc2, 0xa1, 0x4a, 0xce, 0xe7, 0x44, 0xa9, 0x29, 0xc2, 
-	0xc7, 0x14, 0xf1, 0x8d, 0x9f, 0xba, 0x7 , 0x62, 0x9c, 0xf9, 0x6d, 0xc9, 0x8f, 
-	0x3d, 0xb3, 0xdc, 0x7a, 0x1a, 0x62, 0xb1, 0x1f, 0xc5, 0xc6, 0x7f, 0x31, 0x57, 
-	0xf5, 0x78, 0xd , 0xac, 0x86, 0x48, 0xbf, 0xd5, 0xf7, 0xc7, 0xfc, 0xb3, 0x39, 
-	0xe9, 0xfe, 0xed, 0x67, 0xc9, 0x83, 0x96, 0xc0, 0xe7, 0x9c, 0xa , 0xd1, 0xbb, 
-	0xea, 0x71, 0xc6, 0x2d, 0x2b, 0x76, 0x2e, 0xdb, 0xca, 0x41, 0xc9, 0x3d, 0xf0, 
-	0x6a, 0x75, 0x7e, 0x70, 0x47, 0x43, 0x83, 0x59, 0xd6, 0x6e, 0xa , 0x94, 0x3d, 
-	0x3b, 0xd5, 0xa5, 0x7c, 0xf3, 0x9e, 0x7a, 0x1a, 0xc6, 0x51, 0xb3, 0x3d, 0x3a, 
-	0x33, 0xe6, 0x82, 0x2f, 0xd8, 0xb0, 0x49, 0x7a, 0xfc, 0xa7, 0xa8, 0x3d, 0xab, 
-	0x4a, 0x13, 0x8c, 0x1c, 0xf0, 0xdd, 0x7f, 0xcf, 0xd6, 0xb1, 0x63, 0x6c, 0xa8, 
-	0xeb, 0xbb, 0xa7, 0x15, 0xa9, 0xa7, 0xb6, 0xe8, 0x40, 0x3d, 0xc7, 0xff, 0x0 , 
-	0xaf, 0xf5, 0xaf, 0x5f, 0x3 , 0x53, 0x99, 0x58, 0xf8, 0x6e, 0x24, 0xc1, 0xaa, 
-	0x75, 0x1c, 0x97, 0x5f, 0xe9, 0x16, 0xa8, 0xa1, 0x79, 0x5c, 0xd1, 0x5e, 0xa1, 
-	0xf1, 0xec, 0x28, 0xa2, 0x8a, 0x60, 0x1f, 0x8d, 0x1f, 0x8d, 0x1f, 0x85, 0x1f, 
-	0x85, 0x0 , 0x1f, 0x8d, 0x1f, 0x8d, 0x1f, 0x85, 0x21, 0xfa, 0x50, 0x26, 0x7 , 
-	0xeb, 0x40, 0xfa, 0xd0, 0x7e, 0x94, 0xf , 0xa5, 0x2 , 0x12, 0x8a, 0x28, 0xa0, 
-	0x2 , 0x8a, 0x28, 0xa0, 0x4 , 0x26, 0x92, 0x94, 0x8a, 0x4a, 0x0 , 0x29, 0x1a, 
-	0x96, 0x91, 0xa8, 0x1 , 0x28, 0xa2, 0x8a, 0x0 , 0x3f, 0x1a, 0x3f, 0x1a, 0x28, 
-	0xfc, 0x28, 0x1 , 0x1b, 0xeb, 0x49, 0x4b, 0x8f, 0x6a, 0x43, 0x40, 0x5 , 0x14, 
-	0x51, 0x40, 0x8 , 0xd4, 0x94, 0x66, 0x8a, 0x0 , 0x46, 0xa4, 0xa5, 0x6a, 0x4e, 
-	0xd4, 0xc0, 0x28, 0xfc, 0x68, 0xa3, 0xf0, 0xa6, 0x1 , 0xf8, 0xd3, 0x5a, 0x9d, 
-	0xf8, 0x53, 0x4d, 0x0 , 0x23, 0x52, 0x53, 0xa9, 0xa6, 0x80, 0xa , 0x46, 0xa5, 
-	0x34, 0xda, 0x0 , 0x28, 0xfc, 0x68, 0xa2, 0x80, 0x10, 0xfd, 0x69, 0x29, 0xdf, 
-	0x85, 0x34, 0xd0, 0x2 , 0x35, 0x25, 0x3a, 0x9a, 0x69, 0xa0, 0x11, 0xa9, 0x29, 
-	0x5a, 0x92, 0x98, 0x5 , 0x1f, 0x8d, 0x14, 0x7e, 0x14, 0x0 , 0xda, 0x29, 0x5b, 
-	0xe9, 0x49, 0x40, 0xd , 0xa2, 0x8a, 0x28, 0x1 , 0xb4, 0x51, 0x45, 0x0 , 0x44, 
-	0xb4, 0xb4, 0x62, 0x8a, 0x93, 0x41, 0x40, 0xa5, 0xa2, 0x94, 0xa , 0x0 , 0x5f, 
-	0xc6, 0x8f, 0xc6, 0x8f, 0xc2, 0x8f, 0xc2, 0x80, 0xa , 0x31, 0x40, 0xa7, 0x50, 
-	0x1 , 0x4a, 0xb4, 0x94, 0xab, 0x40, 0xb , 0x4a, 0x3e, 0xb4, 0x8b, 0x4e, 0xfc, 
-	0x28, 0x0 , 0xfc, 0x68, 0xa2, 0x8a, 0x0 , 0x50, 0x29, 0x68, 0xa2, 0x90, 0xa , 
-	0x5 , 0x2d, 0x14, 0x52, 0x1 , 0x47, 0xd6, 0x97, 0xf1, 0xa3, 0xf0, 0xa3, 0xf0, 
-	0xa0, 0x41, 0x45, 0x14, 0x50, 0x3 , 0xb3, 0x45, 0x18, 0xa5, 0x2 , 0x81, 0x80, 
-	0x14, 0xb4, 0x51, 0x40, 0x85, 0x1f, 0x5a, 0x5f, 0xc6, 0x8f, 0xc2, 0x8f, 0xc2, 
-	0x80, 0xd4, 0x3f, 0x1a, 0x28, 0xa2, 0x80, 0xa , 0x70, 0xa3, 0x14, 0x50, 0x30, 
-	0xa5, 0xc1, 0xf5, 0xa5, 0xc5, 0x14, 0x8 , 0x28, 0xa2, 0x94, 0xa , 0x6 , 0x2f, 
-	0xe3, 0x47, 0xe3, 0x47, 0xe1, 0x40, 0x1e, 0xd4, 0x0 , 0x51, 0x45, 0x14, 0x0 , 
-	0x53, 0x85, 0x22, 0xd2, 0xd0, 0x17, 0xa , 0x3b, 0xd0, 0x29, 0x71, 0x40, 0x84, 
-	0xc5, 0x38, 0x51, 0x45, 0x0 , 0xc2, 0x8a, 0x5 , 0xd , 0xc7, 0x34, 0x80, 0x47, 
-	0x4 , 0xf4, 0x38, 0xa8, 0x25, 0x80, 0xbf, 0x22, 0x4c, 0x63, 0xd3, 0x3c, 0xfe, 
-	0xb5, 0x31, 0x3e, 0xd8, 0x1e, 0xe2, 0xab, 0xdd, 0x39, 0x1c, 0x70, 0x7e, 0x87, 
-	0x9a, 0x89, 0x6c, 0x6f, 0x4e, 0xe9, 0xab, 0x14, 0xaf, 0x21, 0x6c, 0x31, 0x67, 
-	0x56, 0x55, 0xea, 0xc5, 0x3f, 0x40, 0x7d, 0x6b, 0x3a, 0xe2, 0x27, 0xfe, 0x38, 
-	0xa2, 0x50, 0xa3, 0x27, 0x23, 0xa5, 0x5e, 0xba, 0xdc, 0x79, 0x55, 0x38, 0x5e, 
-	0x9f, 0x36, 0x7f, 0x9f, 0x53, 0x59, 0x3a, 0x94, 0xbb, 0xcf, 0x90, 0x19, 0xb6, 
-	0x93, 0xf3, 0x60, 0x65, 0x89, 0xf4, 0x0 , 0x72, 0x4f, 0xbd, 0x72, 0xc9, 0x46, 
-	0xf6, 0x3d, 0x9a, 0x55, 0x2a, 0xa8, 0xde, 0x3a, 0xaf, 0xc8, 0xa3, 0x70, 0xd1, 
-	0xc9, 0xb9, 0xc2, 0x61, 0x10, 0xf0, 0x47, 0x1 , 0xbe, 0x9e, 0xb5, 0x4a, 0x4b, 
-	0x96, 0x66, 0xc2, 0x20, 0x5c, 0xf4, 0xc8, 0xa9, 0xaf, 0x1f, 0xcc, 0x5c, 0x48, 
-	0x3c, 0xb8, 0x94, 0xe1, 0x23, 0x5e, 0xaf, 0xfe, 0x7d, 0x6a, 0x95, 0xc1, 0x29, 
-	0xf2, 0x91, 0x86, 0xfe, 0x2e, 0x2b, 0x3f, 0x66, 0x8e, 0x8f, 0xad, 0x4a, 0xdd, 
-	0x84, 0xb8, 0x76, 0x3c, 0x33, 0x3 , 0x8a, 0xac, 0xed, 0x9e, 0x94, 0xe7, 0x4 , 
-	0xe7, 0x1d, 0x86, 0x4d, 0x44, 0xc7, 0xda, 0xa9, 0x2b, 0x1c, 0x95, 0x6a, 0x37, 
-	0xb8, 0xbd, 0xff, 0x0 , 0x95, 0x48, 0xa3, 0x1f, 0x31, 0xa6, 0x28, 0xc7, 0x34, 
-	0xf8, 0xf0, 0xcf, 0xfe, 0xca, 0x7f, 0x3a, 0xa2, 0x20, 0xb5, 0x26, 0xb7, 0x7 , 
-	0xaf, 0x53, 0xd3, 0xf1, 0xee, 0x6a, 0xdc, 0x7c, 0xb6, 0xd1, 0xf7, 0x57, 0xf5, 
-	0xff, 0x0 , 0x26, 0xaa, 0xc4, 0xdb, 0x57, 0x1d, 0x2a, 0xcf, 0x31, 0xc6, 0x1 , 
-	0xea, 0xc3, 0x27, 0xdb, 0xd2, 0xb3, 0x91, 0xe9, 0xe1, 0xf4, 0x43, 0xd5, 0xb3, 
-	0x9d, 0xbc, 0x8c, 0xe0, 0x1f, 0x53, 0xdc, 0xd4, 0x91, 0x90, 0xab, 0xd7, 0xdc, 
-	0x9a, 0x8e, 0x24, 0x21, 0xb6, 0x3 , 0x8c, 0xe , 0x71, 0xda, 0xa4, 0x51, 0xbb, 
-	0x19, 0xe1, 0x40, 0xe3, 0xde, 0xb1, 0x91, 0xdf, 0x4e, 0xfa, 0xb , 0x1a, 0xef, 
-	0x6d, 0xc7, 0x81, 0xd7, 0x9f, 0xeb, 0x4e, 0xdd, 0xe6, 0x7c, 0xb1, 0xf , 0x97, 
-	0xbb, 0x53, 0x72, 0x65, 0x1f, 0xec, 0xfb, 0x77, 0xff, 0x0 , 0xeb, 0x54, 0xc0, 
-	0x85, 0x5e, 0x46, 0x17, 0xb0, 0x1d, 0xea, 0x19, 0xd3, 0x5 , 0x75, 0xe4, 0x10, 
-	0xc6, 0x13, 0xdc, 0xff, 0x0 , 0x11, 0xff, 0x0 , 0xa , 0x74, 0x92, 0x0 , 0x76, 
-	0x81, 0xf3, 0xe , 0xe7, 0xa0, 0xa6, 0x33, 0x31, 0x4 , 0x11, 0xb7, 0xd3, 0x1d, 
-	0xaa, 0x36, 0x71, 0xf7, 0x73, 0xb5, 0x7b, 0x7a, 0x9a, 0x8b, 0x5d, 0x9a, 0x4a, 
-	0x6a, 0xa , 0xd1, 0x1d, 0x92, 0x57, 0x6f, 0x52, 0x4f, 0x3e, 0xf4, 0xac, 0xca, 
-	0xbf, 0x7b, 0x1f, 0x53, 0xcf, 0xe4, 0x2a, 0xd , 0xe5, 0x78, 0x5f, 0xbd, 0xef, 
-	0xda, 0x8d, 0xc2, 0x3c, 0x93, 0xd7, 0xa6, 0xe6, 0xec, 0x7f, 0xc6, 0xab, 0x95, 
-	0x9c, 0xee, 0xaa, 0x44, 0xa4, 0xc9, 0xb7, 0x83, 0xb4, 0x7a, 0x9e, 0xb4, 0xd5, 
-	0x3f, 0x36, 0xd4, 0x5c, 0xc8, 0x7a, 0xe7, 0xaf, 0xe3, 0x48, 0xbb, 0x9c, 0xee, 
-	0x91, 0x99, 0x17, 0xff, 0x0 , 0x1e, 0x34, 0xbe, 0x60, 0x88, 0x6d, 0x45, 0xc7, 
-	0xa0, 0xff, 0x0 , 0x1a, 0x2c, 0x26, 0xef, 0xab, 0x7a, 0x13, 0x40, 0xbb, 0x7e, 
-	0x79, 0x1b, 0x6f, 0xa9, 0x1c, 0x1f, 0xa0, 0xf4, 0xa7, 0xab, 0x6c, 0x5d, 0xca, 
-	0xa1, 0x57, 0xb6, 0x47, 0x35, 0x0 , 0x5c, 0x7c, 0xf2, 0x1d, 0xcd, 0xd9, 0x71, 
-	0xd3, 0xe8, 0x2a, 0x55, 0xc , 0xca, 0x32, 0x7a, 0x9e, 0x4e, 0x79, 0xfc, 0xea, 
-	0x24, 0x6f, 0xb , 0xda, 0xc9, 0xf , 0x2c, 0xec, 0x4e, 0xe3, 0xc9, 0x3f, 0x74, 
-	0x1e, 0x9e, 0xec, 0x69, 0xea, 0xdb, 0x78, 0x1f, 0x29, 0xc7, 0x2c, 0x3a, 0xfd, 
-	0x29, 0x81, 0x82, 0xaf, 0x1f, 0x28, 0xed, 0x8a, 0x7a, 0x8e, 0x8c, 0xdd, 0x7b, 
-	0xe , 0xc3, 0xeb, 0x50, 0xcd, 0x92, 0x6b, 0xae, 0xa2, 0xab, 0xee, 0x5d, 0xa5, 
-	0x70, 0x4f, 0x6e, 0xe7, 0xeb, 0xfe, 0x14, 0x7 , 0xc2, 0x8d, 0xe3, 0x73, 0x76, 
-	0x5e, 0x94, 0xc4, 0x39, 0xe1, 0x7 , 0x7e, 0x5c, 0x8f, 0xe5, 0xeb, 0x4f, 0xdd, 
-	0x14, 0x6a, 0x48, 0x1b, 0x9f, 0xdf, 0xfa, 0xff, 0x0 , 0x9c, 0x52, 0xb7, 0x90, 
-	0x73, 0x69, 0x7b, 0x96, 0x62, 0x13, 0xca, 0xca, 0x99, 0xf9, 0x5b, 0x81, 0x81, 
-	0x81, 0x53, 0x87, 0xb5, 0x81, 0x86, 0xd6, 0x33, 0x49, 0x8c, 0x2 , 0x9f, 0x74, 
-	0x73, 0xd3, 0x8e, 0xbf, 0x85, 0x67, 0xb4, 0xd2, 0x4c, 0xb9, 0x76, 0x6d, 0xbf, 
-	0x5e, 0xf , 0xf8, 0xff, 0x0 , 0x2f, 0x6a, 0x8e, 0x49, 0xb7, 0xb6, 0xe1, 0xfc, 
-	0x3c, 0x67, 0xfa, 0xa , 0x6a, 0x36, 0x22, 0x53, 0xbe, 0xad, 0x96, 0x6e, 0x6e, 
-	0x9 , 0xc2, 0xe1, 0x8e, 0x3f, 0x83, 0x3c, 0xf , 0xaf, 0xf9, 0xc5, 0x22, 0x4c, 
-	0x77, 0x65, 0x49, 0xdc, 0x1 , 0xcb, 0x3 , 0xfa, 0xf , 0x4f, 0xaf, 0x5a, 0xad, 
-	0xe , 0x5d, 0xb1, 0x83, 0xb7, 0xb2, 0x8e, 0xad, 0xf5, 0xff, 0x0 , 0xa , 0xd3, 
-	0xd2, 0xb4, 0xab, 0x9b, 0xb9, 0x3e, 0x45, 0xf9, 0x73, 0xc9, 0xc7, 0xca, 0xbf, 
-	0x5f, 0x53, 0xed, 0x4e, 0xc4, 0x73, 0x24, 0xae, 0xde, 0x85, 0x7b, 0x78, 0xde, 
-	0x79, 0x17, 0xa , 0xcd, 0xfd, 0xd4, 0x3 , 0x81, 0xef, 0x5d, 0x7 , 0x87, 0xfc, 
-	0x3d, 0x3d, 0xec, 0xa0, 0x18, 0xf7, 0x13, 0xc9, 0x3 , 0xa0, 0xff, 0x0 , 0x1a, 
-	0xe9, 0xbc, 0x21, 0xe0, 0xe6, 0x97, 0x68, 0xf2, 0xce, 0xf , 0xde, 0x66, 0x1c, 
-	0xb5, 0x7a, 0xaf, 0x84, 0xfc, 0x24, 0x90, 0xaa, 0xe2, 0x1d, 0xa3, 0xbf, 0x19, 
-	0xcd, 0x52, 0x49, 0x1c, 0x75, 0xb1, 0xe , 0x5a, 0x23, 0x8f, 0xf0, 0x77, 0x82, 
-	0x55, 0xb6, 0xee, 0x8f, 0x9c, 0xf5, 0xc5, 0x7a, 0xdf, 0x80, 0xbc, 0x1f, 0x6b, 
-	0x6d, 0x24, 0x66, 0x48, 0xc6, 0xdc, 0x70, 0x76, 0xf7, 0xad, 0x7d, 0x7 , 0x43, 
-	0x11, 0x6d, 0xdb, 0x18, 0xed, 0xd6, 0xbb, 0x1d, 0x1e, 0x8 , 0xd4, 0x8 , 0x9d, 
-	0x3a, 0x7b, 0x53, 0x53, 0xd4, 0xe5, 0x94, 0x5b, 0x45, 0x8d, 0x3 , 0x41, 0xb3, 
-	0x54, 0x4 , 0x1 , 0xc7, 0x63, 0xf2, 0x8f, 0xc4, 0xd6, 0xb4, 0xd6, 0x70, 0x5 , 
-	0x6f, 0xdd, 0x1 , 0xc0, 0xe3, 0xaf, 0xd4, 0xe6, 0xa2, 0xb5, 0xb9, 0x8 , 0xad, 
-	0xa , 0x83, 0xc7, 0x27, 0x1d, 0xbe, 0x82, 0xa5, 0x9a, 0xe1, 0xb6, 0xa8, 0x62, 
-	0x3a, 0xf6, 0x3f, 0xe1, 0x5a, 0x7b, 0x44, 0xd1, 0x8f, 0xb2, 0x69, 0x99, 0x9a, 
-	0xcd, 0xb4, 0x4d, 0x9 , 0x46, 0x8b, 0x69, 0xc1, 0x39, 0x27, 0xdb, 0xda, 0xbc, 
-	0x23, 0xe3, 0x37, 0x87, 0xa1, 0x67, 0x93, 0xcb, 0x5c, 0xee, 0x4 , 0x93, 0x8a, 
-	0xf7, 0xab, 0xe7, 0xf3, 0x37, 0x12, 0x57, 0xa1, 0xcf, 0x6a, 0xf3, 0xff, 0x0 , 
-	0x89, 0x3a, 0x79, 0xb9, 0xb5, 0x7d, 0xab, 0x8f, 0x7c, 0x56, 0x2e, 0x5a, 0x9b, 
-	0x46, 0x1a, 0x6a, 0x7c, 0x5f, 0xe3, 0x6d, 0x20, 0x43, 0xa8, 0x48, 0x85, 0x70, 
-	0x1c, 0x95, 0xcf, 0xa1, 0xec, 0x6b, 0x2f, 0xc3, 0x37, 0x4d, 0x14, 0xa9, 0x6b, 
-	0x21, 0xf2, 0xe4, 0xdf, 0xb6, 0x29, 0xe , 0x78, 0x6e, 0xc1, 0x87, 0xa1, 0xc9, 
-	0x15, 0xe9, 0xff, 0x0 , 0x15, 0x34, 0x6d, 0x92, 0xc8, 0x2 , 0xf5, 0xe7, 0x38, 
-	0xe9, 0x5e, 0x55, 0xaa, 0x5b, 0x10, 0xce, 0x46, 0x55, 0x88, 0xcf, 0xd1, 0x87, 
-	0xff, 0x0 , 0x5b, 0x26, 0xbb, 0x23, 0x69, 0xc7, 0x53, 0x85, 0xca, 0x54, 0x6a, 
-	0x73, 0x44, 0xee, 0x2c, 0x6f, 0xd , 0xd4, 0x7f, 0x64, 0xb9, 0x4d, 0xb2, 0xa1, 
-	0x1b, 0xb6, 0xff, 0x0 , 0x7b, 0x82, 0xac, 0xbf, 0x5e, 0x3a, 0x7d, 0x7a, 0x1a, 
-	0xd0, 0x5f, 0x29, 0xed, 0x5a, 0x9 , 0xa4, 0xd , 0xc , 0x8c, 0xa , 0xbe, 0x32, 
-	0x63, 0x63, 0xd3, 0xf3, 0x35, 0xc5, 0xe9, 0x3a, 0x9a, 0xcd, 0xc , 0x26, 0xe5, 
-	0xd9, 0x4f, 0xdd, 0x12, 0x3 , 0xca, 0xb0, 0xea, 0xad, 0xfe, 0xc9, 0xe0, 0x8f, 
-	0x43, 0x5b, 0xd6, 0xb3, 0xa1, 0xb5, 0x69, 0xd0, 0xef, 0xc1, 0x22, 0x68, 0x9 , 
-	0x3f, 0x30, 0x27, 0x27, 0x7 , 0xb7, 0x42, 0x7d, 0x9b, 0xeb, 0x5c, 0xb5, 0x23, 
-	0xca, 0xcf, 0xa4, 0xc2, 0xd4, 0x8d, 0x58, 0x73, 0x22, 0xc1, 0x66, 0x82, 0xe5, 
-	0xe1, 0x23, 0x6b, 0x0 , 0x59, 0x1d, 0x7 , 0x51, 0xdf, 0xfa, 0x7e, 0x62, 0xa6, 
-	0x9a, 0x46, 0x6b, 0x73, 0x77, 0x1a, 0x6e, 0x88, 0xa7, 0xef, 0xd1, 0x46, 0x8 , 
-	0x1d, 0xc8, 0xa6, 0x97, 0x49, 0x60, 0x56, 0x49, 0x41, 0xc7, 0xcd, 0x4 , 0xa4, 
-	0x72, 0x47, 0xa3, 0x7f, 0x23, 0xed, 0x50, 0xd9, 0x5c, 0x49, 0x63, 0x7d, 0xb9, 
-	0x7e, 0x44, 0x60, 0x4b, 0xae, 0x39, 0xcf, 0x70, 0x3d, 0x45, 0x62, 0xce, 0xc4, 
-	0x9a, 0x7e, 0x42, 0x4f, 0x10, 0x90, 0x36, 0xc2, 0x24, 0x8e, 0x40, 0x36, 0x9f, 
-	0xee, 0x9e, 0xc0, 0xfa, 0x1e, 0x31, 0x9a, 0x86, 0x19, 0x3e, 0x6c, 0x65, 0x94, 
-	0x71, 0xf3, 0xf5, 0x92, 0x13, 0xdb, 0x3e, 0xbd, 0x3f, 0x98, 0xad, 0x3b, 0xa8, 
-	0x63, 0x1f, 0xe9, 0x76, 0x58, 0x68, 0x49, 0x2b, 0x34, 0x20, 0xe0, 0xc6, 0x7d, 
-	0x57, 0xdb, 0xda, 0xa9, 0xcd, 0x18, 0x6f, 0xf4, 0x98, 0xbf, 0xd7, 0x26, 0x73, 
-	0xc6, 0x4 , 0xc3, 0xd0, 0x8e, 0xf9, 0xf4, 0xf6, 0xe2, 0x92, 0x92, 0x9 , 0x41, 
-	0xa6, 0xee, 0x56, 0xba, 0xb7, 0x31, 0xed, 0xbc, 0x5c, 0x5 , 0xc8, 0xf3, 0x36, 
-	0x9c, 0x28, 0x38, 0xe0, 0x83, 0xd8, 0x1e, 0x80, 0xf6, 0xe8, 0x7a, 0xa , 0x4d, 
-	0x36, 0xed, 0x5e, 0x45, 0x69, 0x1b, 0x6f, 0xae, 0x4e, 0xde, 0x3a, 0x60, 0x8e, 
-	0xc4, 0x1a, 0xb3, 0x6d, 0x30, 0x36, 0xbb, 0x1d, 0x0 , 0x85, 0xdc, 0xfc, 0x8e, 
-	0x4e, 0x46, 0x47, 0x2a, 0xde, 0xbf, 0xe1, 0x59, 0xd7, 0xd0, 0x1b, 0x5b, 0x82, 
-	0x23, 0x2a, 0x53, 0x1d, 0x50, 0xe4, 0x10, 0x78, 0xe4, 0xfe, 0x9f, 0x85, 0x37, 
-	0xae, 0x84, 0x45, 0xb8, 0xb5, 0x24, 0x69, 0x5d, 0x2b, 0xc1, 0x27, 0x9b, 0x11, 
-	0xb , 0xc0, 0x27, 0x1f, 0x74, 0x8c, 0x8e, 0xdd, 0xbf, 0x95, 0x1e, 0x64, 0x6e, 
-	0xbe, 0x6a, 0xb0, 0x4c, 0x8f, 0xde, 0x71, 0x90, 0xbe, 0xff, 0x0 , 0x4e, 0x9f, 
-	0x4a, 0xa3, 0x65, 0x74, 0xa8, 0xfe, 0x44, 0xce, 0xc1, 0x59, 0x46, 0x18, 0xf0, 
-	0x40, 0xfa, 0xd5, 0x99, 0xe3, 0x68, 0x33, 0x22, 0x2e, 0xf8, 0x98, 0x8d, 0xca, 
-	0xf , 0x19, 0x3e, 0xdd, 0x8f, 0xb7, 0x43, 0x58, 0x49, 0x1e, 0x95, 0x19, 0x95, 
-	0xee, 0x7e, 0x53, 0xb9, 0xd0, 0xfc, 0xeb, 0xf3, 0x71, 0x95, 0x60, 0x7f, 0xa5, 
-	0x63, 0xdd, 0x40, 0xb0, 0xc9, 0x84, 0x24, 0xc6, 0xc7, 0xe5, 0xcf, 0xf0, 0xfb, 
-	0x1f, 0xa7, 0x35, 0xae, 0xed, 0xb1, 0x77, 0xc7, 0x86, 0x8c, 0xfd, 0xe4, 0x3d, 
-	0xbe, 0x95, 0x4a, 0xf2, 0x1e, 0xae, 0x8d, 0xf2, 0x9c, 0x75, 0xf5, 0x1f, 0xd6, 
-	0x94, 0x65, 0xd0, 0xba, 0x94, 0xae, 0xee, 0x8c, 0xa8, 0x89, 0x49, 0x37, 0x63, 
-	0xa1, 0xe4, 0x7b, 0x55, 0xcb, 0x66, 0xe5, 0x81, 0xe3, 0x8c, 0xd4, 0x33, 0x28, 
-	0x32, 0x6e, 0x3 , 0x1f, 0xde, 0x1e, 0xf4, 0xb1, 0xb1, 0xc2, 0xb7, 0xf7, 0x4e, 
-	0x2b, 0x49, 0x6a, 0x65, 0x46, 0xf0, 0x65, 0xd8, 0xb7, 0x2 , 0x7b, 0x81, 0xdf, 
-	0xd2, 0xb4, 0x6c, 0xdf, 0x6f, 0xcc, 0x3e, 0xe8, 0x6c, 0xfe, 0x75, 0x9f, 0x69, 
-	0x86, 0x70, 0xa4, 0xb0, 0xd , 0x91, 0xc0, 0xcf, 0xd2, 0xb4, 0xec, 0x22, 0xdf, 
-	0x27, 0x94, 0xce, 0x7e, 0x60, 0x71, 0x94, 0x3f, 0x85, 0x69, 0x85, 0xaa, 0xe1, 
-	0x33, 0x9b, 0x38, 0xc0, 0xc7, 0x11, 0x42, 0xfd, 0x51, 0x71, 0x48, 0xdc, 0x40, 
-	0x23, 0x9e, 0x69, 0xd5, 0x1c, 0x51, 0x30, 0x55, 0x26, 0x3e, 0x9c, 0x67, 0x6 , 
-	0x9c, 0xc5, 0x87, 0xf0, 0xd7, 0xbd, 0x4e, 0xac, 0x64, 0x8f, 0xcd, 0x31, 0x58, 
-	0x2a, 0x94, 0x24, 0xd3, 0x43, 0xa8, 0xa1, 0x72, 0x7b, 0x7e, 0xb4, 0x31, 0x2 , 
-	0xb5, 0x38, 0xec, 0xc3, 0xf1, 0xa3, 0xf1, 0xa4, 0xfc, 0xd , 0x1f, 0x85, 0x31, 
-	0x7 , 0xe3, 0x4b, 0xf8, 0xd1, 0xf8, 0x51, 0xf8, 0x50, 0x1 , 0xf8, 0xd2, 0x67, 
-	0xde, 0x97, 0xf0, 0xa4, 0xc7, 0xb5, 0x0 , 0x25, 0x14, 0x51, 0x40, 0x82, 0x8a, 
-	0x28, 0xa0, 0x43, 0x68, 0xa2, 0x8a, 0x0 , 0x28, 0xa2, 0x8a, 0x0 , 0x6d, 0x14, 
-	0x51, 0x40, 0x5 , 0x1f, 0x8d, 0x14, 0x7e, 0x14, 0x0 , 0x7e, 0x34, 0xd6, 0xa7, 
-	0x7e, 0x14, 0xd6, 0xa0, 0x2 , 0x8a, 0x28, 0xa0, 0x6 , 0xd1, 0x45, 0x14, 0x0 , 
-	0x84, 0xd2, 0x52, 0x91, 0x49, 0x40, 0x5 , 0x1f, 0x8d, 0x14, 0x7e, 0x14, 0xc0, 
-	0x4a, 0x43, 0x4b, 0x8f, 0x6a, 0x43, 0x4c, 0x2 , 0x91, 0xa9, 0x4d, 0x36, 0x80, 
-	0xa , 0x46, 0xa5, 0xa4, 0x6a, 0x0 , 0x4a, 0x3f, 0x1a, 0x28, 0xfc, 0x28, 0x0 , 
-	0xfc, 0x69, 0xad, 0x4e, 0xfc, 0x29, 0xa6, 0x80, 0x3 , 0x4d, 0xa7, 0x1a, 0x6d, 
-	0x0 , 0x23, 0x52, 0x52, 0xb5, 0x25, 0x30, 0xa , 0x3f, 0x1a, 0x28, 0xfc, 0x29, 
-	0x80, 0xda, 0x28, 0xa2, 0x80, 0x1b, 0x8a, 0x28, 0xcd, 0x14, 0x0 , 0xda, 0x28, 
-	0xa3, 0xf0, 0xa0, 0x8 , 0xe9, 0x56, 0x90, 0x53, 0xaa, 0x4d, 0x2 , 0x94, 0x7d, 
-	0x69, 0x16, 0x9d, 0xf8, 0x50, 0x1 , 0xf8, 0xd1, 0x45, 0x14, 0x0 , 0xb8, 0xa7, 
-	0x63, 0x34, 0x94, 0xab, 0xd2, 0x80, 0x0 , 0x29, 0x68, 0xa5, 0x5f, 0xa5, 0x0 , 
-	0x2f, 0xe3, 0x47, 0xe3, 0x47, 0xe1, 0x45, 0x0 , 0x14, 0xab, 0x48, 0x29, 0xd4, 
-	0x0 , 0x52, 0xe2, 0x8c, 0xa , 0x5a, 0x42, 0x61, 0x4a, 0x3e, 0xb4, 0x63, 0xda, 
-	0x97, 0xf0, 0xa4, 0x30, 0xfc, 0x68, 0xa2, 0x8a, 0x0 , 0x29, 0xc2, 0x8c, 0x52, 
-	0x81, 0x40, 0x81, 0x69, 0x69, 0x16, 0x96, 0x80, 0xa , 0x51, 0xf5, 0xa3, 0x1e, 
-	0xd4, 0xbf, 0x85, 0x0 , 0x1f, 0x8d, 0x14, 0x51, 0x40, 0xc2, 0x97, 0x14, 0xb8, 
-	0xa2, 0x80, 0xa , 0x55, 0xa4, 0x14, 0xea, 0x4 , 0x14, 0x51, 0x4a, 0x5 , 0x3 , 
-	0x5 , 0xa5, 0xfc, 0x68, 0xfc, 0x28, 0xfc, 0x28, 0x0 , 0xa2, 0x8a, 0x28, 0x10, 
-	0x62, 0x9c, 0x29, 0x16, 0x96, 0x80, 0xf , 0xc2, 0x8a, 0x29, 0x7a, 0xd0, 0x0 , 
-	0x5 , 0x2d, 0x14, 0x50, 0x1 , 0x4a, 0xbf, 0x5a, 0x41, 0x4b, 0xd2, 0x80, 0x13, 
-	0x1e, 0xf4, 0xb9, 0xc7, 0x7a, 0x46, 0x6c, 0xe , 0x40, 0xfc, 0xea, 0x29, 0x25, 
-	0x1e, 0x99, 0xf6, 0x56, 0x1f, 0xce, 0xa5, 0xb2, 0xa3, 0x16, 0xc2, 0x4c, 0x96, 
-	0xda, 0xa2, 0x46, 0x3f, 0xa5, 0x51, 0xbd, 0x78, 0xe3, 0x56, 0x3f, 0x36, 0xe1, 
-	0xd7, 0xfc, 0x8a, 0x7d, 0xc4, 0xcc, 0x7e, 0x40, 0x63, 0x51, 0xe9, 0xbc, 0xb1, 
-	0x3f, 0x95, 0x52, 0x95, 0xdc, 0x9c, 0x5 , 0x18, 0x1d, 0xe4, 0xfe, 0x1f, 0xc3, 
-	0xff, 0x0 , 0xad, 0x59, 0xca, 0x47, 0x5d, 0x38, 0x34, 0x52, 0xbc, 0x8e, 0x59, 
-	0x54, 0xc9, 0x22, 0xca, 0xb0, 0xe7, 0xa9, 0x93, 0x6e, 0x7e, 0x9e, 0x95, 0x49, 
-	0x99, 0xf6, 0xe1, 0x21, 0x8e, 0x8 , 0x3a, 0x17, 0x67, 0xfb, 0xc3, 0xd0, 0x7a, 
-	0xfe, 0x15, 0x66, 0xe9, 0xa4, 0x66, 0xdd, 0x34, 0xc1, 0xbd, 0x32, 0x3e, 0x51, 
-	0xf8, 0x77, 0xaa, 0x77, 0x6e, 0x84, 0x6f, 0x71, 0xbb, 0xe6, 0xe1, 0xe5, 0xe9, 
-	0xf8, 0x2f, 0x53, 0xfe, 0x78, 0xae, 0x79, 0x45, 0x33, 0xd1, 0xa3, 0x56, 0x71, 
-	0xd9, 0x95, 0xee, 0x6 , 0x54, 0xbd, 0xb6, 0xb , 0x1e, 0x37, 0x91, 0xc8, 0xfa, 
-	0x7a, 0x56, 0x4c, 0xff, 0x0 , 0x2b, 0x11, 0x83, 0xbb, 0xb9, 0x3d, 0x6a, 0xed, 
-	0xcd, 0xc4, 0x82, 0x4c, 0xe4, 0x96, 0x3d, 0x8f, 0x1c, 0x7b, 0xe , 0xd5, 0x1b, 
-	0xbc, 0x72, 0xaf, 0xce, 0xa0, 0xf3, 0xfa, 0xd6, 0x49, 0xca, 0x3b, 0xea, 0x8e, 
-	0xa9, 0x42, 0x95, 0x45, 0x78, 0xe9, 0x2f, 0xc0, 0xa2, 0x18, 0xab, 0x6e, 0x1f, 
-	0x85, 0x4f, 0xc , 0x2b, 0x73, 0xfe, 0xa8, 0xaa, 0xbe, 0x39, 0x52, 0x71, 0xfe, 
-	0x45, 0x12, 0x5b, 0xa8, 0x3f, 0x2b, 0x7e, 0x75, 0x1a, 0x87, 0x8a, 0x4d, 0xc3, 
-	0x69, 0xf7, 0xc5, 0x5d, 0xd3, 0x39, 0x1d, 0x39, 0xc7, 0x74, 0x25, 0xc4, 0x52, 
-	0xc2, 0xdb, 0x24, 0x46, 0x56, 0xc6, 0x70, 0x47, 0x5f, 0x71, 0x4f, 0x85, 0x8 , 
-	0x50, 0xa0, 0x64, 0xf5, 0x35, 0xa1, 0x67, 0x7c, 0x92, 0xa2, 0xc3, 0x75, 0x1a, 
-	0xc9, 0x17, 0x70, 0xfd, 0xbd, 0xc7, 0xa7, 0xe9, 0xf5, 0xab, 0x12, 0x5a, 0x69, 
-	0x52, 0xa6, 0x61, 0x9e, 0x5b, 0x79, 0xf , 0x40, 0xc4, 0x30, 0xcf, 0xe1, 0xd3, 
-	0xf3, 0xa1, 0xca, 0xc6, 0xb4, 0xe8, 0xdd, 0xf3, 0x26, 0x66, 0xda, 0x80, 0xf2, 
-	0xb3, 0x37, 0xdd, 0x51, 0xcd, 0x4d, 0x19, 0xcb, 0xf9, 0x8d, 0xc9, 0xea, 0x2a, 
-	0xc3, 0x58, 0x88, 0xe1, 0xff, 0x0 , 0x5f, 0x16, 0xe2, 0x72, 0x48, 0x38, 0xcf, 
-	0xe1, 0x51, 0xc7, 0x11, 0x56, 0x66, 0x25, 0x4f, 0xd0, 0xd6, 0x6e, 0x49, 0x9e, 
-	0x85, 0x3a, 0x32, 0x49, 0x26, 0x89, 0x23, 0x50, 0xa9, 0x86, 0xfa, 0xb5, 0x2c, 
-	0x8d, 0xd0, 0x1e, 0x54, 0x76, 0xa6, 0x49, 0x90, 0xbe, 0xff, 0x0 , 0xca, 0xa4, 
-	0xb7, 0x7 , 0x68, 0x72, 0x32, 0x4f, 0xdd, 0xac, 0x9f, 0x76, 0x76, 0xc7, 0x7e, 
-	0x44, 0x39, 0x14, 0x8f, 0x99, 0x87, 0xcc, 0xdd, 0x7 , 0xa5, 0x2b, 0x37, 0x39, 
-	0x1c, 0xff, 0x0 , 0xb4, 0x7b, 0x53, 0x26, 0x6c, 0x1d, 0xb9, 0xeb, 0xd4, 0xd4, 
-	0x4e, 0xff, 0x0 , 0x2e, 0x33, 0xc5, 0x2e, 0x5b, 0x9a, 0x4a, 0xa2, 0x86, 0x88, 
-	0x7c, 0x92, 0x12, 0xd8, 0x0 , 0xfa, 0xf3, 0xd4, 0xfd, 0x69, 0x9b, 0xbb, 0xae, 
-	0xb , 0x1e, 0xfe, 0x94, 0x44, 0x32, 0xac, 0x79, 0xc0, 0xfd, 0x7d, 0xa9, 0x49, 
-	0xdb, 0xc6, 0xe , 0xe6, 0xe8, 0x5 , 0x33, 0x7 , 0x26, 0xd5, 0xdb, 0x13, 0x3 , 
-	0x94, 0x4 , 0x96, 0xee, 0xd9, 0xe7, 0xe9, 0x4a, 0x14, 0x6 , 0x19, 0x3b, 0x8a, 
-	0xfe, 0x9f, 0xe1, 0x41, 0x2 , 0x3f, 0x95, 0x71, 0xbb, 0xbf, 0x7c, 0x7d, 0x29, 
-	0x54, 0x15, 0x5c, 0xba, 0x9f, 0x65, 0xff, 0x0 , 0x1a, 0x5 , 0xd4, 0x5c, 0x9d, 
-	0xd9, 0x3c, 0xe4, 0x71, 0xf4, 0xff, 0x0 , 0x3d, 0xe9, 0xf1, 0xa9, 0x52, 0x64, 
-	0x66, 0xf9, 0xbd, 0x4f, 0x6a, 0x58, 0xd5, 0xcf, 0xcf, 0x20, 0xc7, 0xe1, 0x53, 
-	0xc , 0x20, 0xdc, 0x47, 0x38, 0xe0, 0x7a, 0x7f, 0xf5, 0xeb, 0x39, 0x4a, 0xc7, 
-	0x4d, 0x3a, 0x77, 0xd5, 0x89, 0x1a, 0x95, 0xf9, 0x98, 0xe , 0x9f, 0xc5, 0xfd, 
-	0x69, 0x23, 0x5 , 0xb2, 0x4f, 0x3 , 0xdf, 0xbf, 0xff, 0x0 , 0x5a, 0x87, 0xf9, 
-	0x93, 0xe6, 0xc8, 0xf4, 0x1f, 0xe3, 0xea, 0x69, 0xcb, 0xf2, 0xf2, 0xd9, 0xf6, 
-	0x1d, 0xea, 0xd , 0x7a, 0xae, 0xc4, 0x8b, 0x82, 0xbc, 0x2 , 0x4d, 0x37, 0x6e, 
-	0x5b, 0x19, 0xcf, 0x3c, 0xe3, 0xa7, 0xff, 0x0 , 0x5e, 0x97, 0x25, 0xb8, 0x3 , 
-	0x81, 0xd7, 0x1d, 0xa9, 0x97, 0xe , 0x76, 0xe1, 0x8 , 0x45, 0xc7, 0x2f, 0xfe, 
-	0x15, 0x2a, 0xf7, 0x2e, 0x76, 0x4a, 0xec, 0x75, 0xc4, 0xde, 0x5f, 0xcb, 0xb8, 
-	0x3b, 0xf4, 0x0 , 0xc , 0xe3, 0xfc, 0xfa, 0x55, 0x74, 0xd , 0xf7, 0xe5, 0xeb, 
-	0x9e, 0x14, 0xf6, 0xfa, 0xfb, 0xd1, 0x0 , 0x20, 0x12, 0x6 , 0xd1, 0xeb, 0xde, 
-	0xa4, 0xc6, 0x5b, 0x1d, 0xff, 0x0 , 0xba, 0x2a, 0xd2, 0x51, 0xd0, 0xc1, 0xb7, 
-	0x37, 0xcc, 0xc6, 0xb1, 0x63, 0xf2, 0xf3, 0x83, 0xd3, 0xd4, 0xd4, 0xd1, 0xc2, 
-	0x5d, 0x80, 0xdb, 0xf7, 0x47, 0x41, 0xd0, 0x54, 0x96, 0x36, 0x8f, 0x31, 0x63, 
-	0x9c, 0x1 , 0xcb, 0xb7, 0xf8, 0x57, 0x65, 0xe1, 0x5f, 0xd , 0x19, 0x66, 0x8c, 
-	0xcd, 0x9 , 0x93, 0x20, 0x18, 0xe1, 0x3 , 0xf5, 0x6f, 0x41, 0x4e, 0xc6, 0x72, 
-	0xa9, 0x18, 0xae, 0xe6, 0x5f, 0x86, 0x7c, 0x3f, 0x2d, 0xd6, 0xd9, 0x64, 0x5 , 
-	0x62, 0x3d, 0x8 , 0x1f, 0x34, 0x9e, 0xc3, 0xd0, 0x57, 0xaa, 0x78, 0x37, 0xc2, 
-	0x43, 0x11, 0x19, 0xa1, 0xf2, 0xd4, 0x7d, 0xc8, 0xc0, 0xe0, 0x7d, 0x6b, 0x5b, 
-	0xc1, 0xfe, 0x19, 0x58, 0x9d, 0x64, 0x94, 0x9 , 0x24, 0xc6, 0x7a, 0x70, 0xa3, 
-	0xd0, 0xa , 0xf4, 0x1d, 0xf , 0x4b, 0x55, 0x55, 0x1 , 0xf , 0x5f, 0x4a, 0x1b, 
-	0xb1, 0xc9, 0x39, 0xb9, 0xb2, 0x9f, 0x87, 0xf4, 0x34, 0x87, 0x6e, 0x22, 0x5d, 
-	0xa3, 0xda, 0xbb, 0x6d, 0x17, 0x4c, 0x41, 0x1a, 0xee, 0xfc, 0xaa, 0x3b, 0x3b, 
-	0x64, 0x4c, 0x1c, 0x7f, 0x9f, 0xc2, 0xb5, 0xed, 0xd9, 0x42, 0x8c, 0x70, 0xf , 
-	0x41, 0x8a, 0xcf, 0x98, 0x56, 0x2c, 0xda, 0xdb, 0x4 , 0xc6, 0x7 , 0xcb, 0x8e, 
-	0x5 , 0x5e, 0x8a, 0x24, 0xa , 0x14, 0xed, 0x5c, 0x8e, 0x7 , 0x53, 0xf8, 0xd5, 
-	0x48, 0xe4, 0x45, 0xe4, 0x7a, 0x70, 0x6a, 0xc4, 0x13, 0xab, 0x7c, 0xd8, 0xe9, 
-	0xc8, 0xa5, 0x71, 0xd8, 0xb8, 0xa8, 0xe8, 0xe1, 0x87, 0xef, 0x3d, 0x7 , 0x3f, 
-	0x95, 0x24, 0x8c, 0x5a, 0x3c, 0xe7, 0x6f, 0xe3, 0xc7, 0xd2, 0x9d, 0xb , 0x96, 
-	0x55, 0xc4, 0x43, 0x9e, 0xfc, 0x83, 0xcd, 0x2b, 0x2f, 0xee, 0xfa, 0xe7, 0x3c, 
-	0xf0, 0xd , 0x31, 0x15, 0xa4, 0x5c, 0x86, 0xdc, 0x38, 0xf6, 0x3d, 0x6b, 0xb , 
-	0xc4, 0x96, 0xfe, 0x7d, 0xbb, 0x80, 0x6 , 0x79, 0xe8, 0x3d, 0xab, 0x7a, 0x76, 
-	0xc4, 0x67, 0x2b, 0x8c, 0xa , 0xa3, 0xa8, 0xc6, 0x1a, 0x22, 0x40, 0xeb, 0xc6, 
-	0x3d, 0x6b, 0x30, 0x3e, 0x77, 0xf8, 0xbb, 0xa3, 0xe3, 0xcc, 0x20, 0x65, 0x46, 
-	0x79, 0xc5, 0x78, 0x3f, 0x89, 0x2c, 0xc4, 0x57, 0x4c, 0x48, 0xf9, 0x73, 0x86, 
-	0xe3, 0xb5, 0x7d, 0x65, 0xf1, 0x4b, 0x4f, 0x32, 0x42, 0xef, 0xb7, 0x2b, 0xdc, 
-	0xff, 0x0 , 0x85, 0x7c, 0xe3, 0xf1, 0x2 , 0xc7, 0xcb, 0xba, 0x93, 0x23, 0xb9, 
-	0xfc, 0x6b, 0xae, 0x84, 0xba, 0x1c, 0x78, 0x88, 0xe9, 0x73, 0xce, 0xe3, 0xd , 
-	0xc , 0x92, 0x5b, 0x30, 0xf9, 0x59, 0xb2, 0x39, 0xe7, 0x3e, 0xdf, 0xa5, 0x69, 
-	0x78, 0x77, 0x51, 0xc4, 0x9e, 0x4c, 0xa5, 0xb7, 0xc4, 0x70, 0xff, 0x0 , 0xed, 
-	0xa7, 0xaf, 0xe5, 0x54, 0xf5, 0x68, 0xb6, 0xfc, 0xfb, 0x73, 0xb4, 0x73, 0xf4, 
-	0xff, 0x0 , 0x20, 0xd6, 0x7d, 0xcc, 0x8d, 0xd , 0xc2, 0xdc, 0x46, 0xdc, 0x8e, 
-	0xa7, 0xd6, 0xba, 0x2a, 0x43, 0x9d, 0x59, 0x8b, 0xb , 0x88, 0x74, 0x25, 0xcc, 
-	0xb6, 0x5f, 0x91, 0xdd, 0xda, 0xcf, 0x1c, 0x37, 0x12, 0x40, 0x18, 0x79, 0x72, 
-	0x7c, 0xc1, 0x7a, 0xe1, 0xbb, 0xe3, 0xd3, 0x3f, 0xcf, 0xeb, 0x52, 0xc9, 0xb0, 
-	0x47, 0xe5, 0x33, 0x9f, 0x9d, 0xb2, 0x8f, 0x9e, 0x54, 0xf5, 0xc0, 0xfa, 0xe3, 
-	0x22, 0xb9, 0xe8, 0xe7, 0x49, 0xad, 0x63, 0x9a, 0x36, 0xe4, 0xa0, 0x23, 0x1d, 
-	0x8f, 0xf9, 0xfe, 0x55, 0xa1, 0xc , 0xde, 0x62, 0xe0, 0x36, 0x3c, 0xc5, 0xca, 
-	0x1c, 0xf4, 0x6f, 0x4f, 0xc0, 0xf3, 0x5e, 0x64, 0xaf, 0x17, 0xa9, 0xf6, 0x50, 
-	0x51, 0xa9, 0x1b, 0xc7, 0xe4, 0x6c, 0xda, 0x4d, 0x23, 0xb6, 0x4b, 0xe2, 0x40, 
-	0x0 , 0x6c, 0x8f, 0xbd, 0xe8, 0x47, 0xb1, 0x7 , 0xfc, 0x69, 0xaa, 0xeb, 0xc , 
-	0xc5, 0x48, 0xc0, 0xf , 0xc0, 0xe7, 0xe5, 0xf6, 0xfa, 0x73, 0x59, 0xb6, 0xb2, 
-	0x16, 0xba, 0xda, 0x48, 0xf3, 0x19, 0x3e, 0x51, 0x8c, 0x67, 0xd8, 0x7a, 0x7b, 
-	0x7f, 0xf5, 0xea, 0xe5, 0xc3, 0x1b, 0x9b, 0x53, 0x22, 0x27, 0xef, 0xa3, 0xda, 
-	0x18, 0x6d, 0xfb, 0xcb, 0xce, 0xf , 0xf4, 0xfc, 0xaa, 0x1b, 0xd7, 0x43, 0x48, 
-	0x46, 0xf1, 0xb3, 0xe8, 0x24, 0x85, 0x2d, 0xef, 0x37, 0x3e, 0xe3, 0x3 , 0xb0, 
-	0xd , 0x9c, 0x10, 0xc3, 0xaf, 0x3f, 0x9f, 0xd7, 0x8a, 0x5b, 0xe2, 0x17, 0x4f, 
-	0x38, 0x1b, 0xe3, 0x43, 0x9c, 0xff, 0x0 , 0x10, 0x5c, 0x72, 0xe , 0x39, 0xe9, 
-	0xfa, 0x3 , 0xde, 0xa9, 0xf9, 0x9b, 0x9f, 0x6b, 0x11, 0xb7, 0x9e, 0xdd, 0x72, 
-	0x3b, 0x7e, 0x5f, 0xa5, 0x58, 0xb5, 0x2a, 0x50, 0x4 , 0xc3, 0x32, 0x9e, 0x31, 
-	0xdc, 0x7f, 0x9f, 0xeb, 0x55, 0xcd, 0xb3, 0x32, 0x74, 0xd2, 0x72, 0x89, 0x9b, 
-	0x74, 0x9b, 0x3e, 0x56, 0x7d, 0xca, 0x79, 0x8e, 0x5f, 0x50, 0x7b, 0x1f, 0xcc, 
-	0x7e, 0x75, 0x63, 0x4c, 0xbf, 0x92, 0x1c, 0xdb, 0xcd, 0xb6, 0x45, 0x0 , 0x8d, 
-	0xac, 0x33, 0xfa, 0xfa, 0x54, 0x5a, 0x82, 0xa4, 0x6a, 0x71, 0x86, 0x88, 0xb1, 
-	0xc8, 0x3f, 0x9e, 0x31, 0xdb, 0x1c, 0xfe, 0x66, 0xa8, 0xb1, 0x28, 0xd8, 0x25, 
-	0x9b, 0x69, 0xe0, 0xe7, 0xaa, 0xf6, 0xa2, 0x4a, 0xfa, 0xa2, 0x69, 0x49, 0xc2, 
-	0x5c, 0xac, 0xdc, 0xba, 0x8 , 0x13, 0xcd, 0x84, 0xe6, 0x27, 0x1c, 0x2 , 0x72, 
-	0x57, 0xd4, 0x1f, 0x50, 0x6a, 0x84, 0xb9, 0x8e, 0x6e, 0x3a, 0x1e, 0xab, 0xfe, 
-	0x15, 0x1d, 0xa5, 0xcb, 0x24, 0x87, 0x3f, 0x34, 0x6c, 0x39, 0x7 , 0xf9, 0xd4, 
-	0x93, 0xa6, 0xf3, 0xb7, 0x3c, 0x3 , 0xf2, 0xb1, 0xf4, 0xac, 0x36, 0x67, 0xa9, 
-	0x1f, 0x7e, 0x3a, 0x15, 0xee, 0x6 , 0xef, 0xde, 0xa7, 0xaf, 0x23, 0xdb, 0xbd, 
-	0x46, 0xa0, 0x12, 0x59, 0x78, 0x57, 0x1c, 0xfd, 0x6a, 0x4e, 0x63, 0x6c, 0x10, 
-	0x41, 0xce, 0x31, 0xdf, 0x34, 0xd2, 0x15, 0x70, 0xc3, 0xee, 0xb5, 0x5a, 0xd8, 
-	0xcf, 0x97, 0x5b, 0x93, 0x5b, 0xb3, 0xc , 0x63, 0xf4, 0xf5, 0xad, 0xb , 0x5b, 
-	0x99, 0xa1, 0xb8, 0x59, 0x52, 0x4e, 0x57, 0x18, 0xcd, 0x66, 0xc2, 0x4a, 0x86, 
-	0x3 , 0xf1, 0xad, 0x1b, 0x59, 0xa1, 0x30, 0xa1, 0x91, 0x7a, 0x1e, 0x7d, 0xff, 
-	0x0 , 0xce, 0x6a, 0x3a, 0x9d, 0x1b, 0xc2, 0xd7, 0x37, 0x62, 0xd5, 0x26, 0x6e, 
-	0x5a, 0x38, 0x58, 0x38, 0xcf, 0x42, 0x7f, 0xad, 0x17, 0x37, 0x4b, 0x2a, 0xe0, 
-	0x44, 0x14, 0xfa, 0x83, 0xc5, 0x37, 0x4f, 0x93, 0x4d, 0x30, 0xe1, 0xf7, 0xd , 
-	0x8d, 0x90, 0x41, 0xec, 0x7f, 0x1a, 0x9d, 0xd3, 0x4e, 0xd9, 0xfb, 0xb9, 0xf , 
-	0xfd, 0xf4, 0x2b, 0xd2, 0xa3, 0x2a, 0x5d, 0x62, 0xcf, 0x8f, 0xcc, 0x68, 0xe3, 
-	0x53, 0x7e, 0xce, 0xaa, 0xb7, 0xcb, 0xfc, 0x8a, 0x18, 0x66, 0xff, 0x0 , 0x96, 
-	0x9c, 0x7a, 0x53, 0x82, 0xff, 0x0 , 0xb5, 0xfa, 0x53, 0xa6, 0x0 , 0x7f, 0xab, 
-	0x70, 0xdf, 0x91, 0xfe, 0x55, 0xa , 0xbb, 0xee, 0xc1, 0xe7, 0xe8, 0x2b, 0xd3, 
-	0xa7, 0x28, 0x74, 0x47, 0xc8, 0xe2, 0xa8, 0xe2, 0x13, 0x7e, 0xd2, 0x49, 0x92, 
-	0x28, 0x23, 0xa9, 0xa7, 0x7e, 0x34, 0x99, 0xf6, 0x6f, 0xca, 0x97, 0xf0, 0xae, 
-	0x84, 0x79, 0xa1, 0xf8, 0xd1, 0xf8, 0xd1, 0xf8, 0x51, 0xf8, 0x53, 0x0 , 0xfc, 
-	0x69, 0x33, 0xef, 0x4b, 0xf8, 0x52, 0x63, 0xda, 0x80, 0x12, 0x83, 0x45, 0x14, 
-	0x0 , 0x51, 0x45, 0x14, 0x0 , 0xdc, 0x51, 0x46, 0x68, 0xa0, 0x2 , 0x91, 0xa9, 
-	0x69, 0x1a, 0x81, 0x9 , 0x45, 0x29, 0x14, 0x94, 0x8 , 0x28, 0xfc, 0x68, 0xa3, 
-	0xf0, 0xa0, 0x61, 0xf8, 0xd3, 0x5a, 0x9d, 0xf8, 0x53, 0x4d, 0x2 , 0xa , 0x28, 
-	0xa2, 0x80, 0x1b, 0x45, 0x14, 0x50, 0x2 , 0x13, 0x49, 0x4a, 0x45, 0x25, 0x0 , 
-	0x14, 0x7e, 0x34, 0x51, 0xf8, 0x50, 0x2 , 0x37, 0xd6, 0x92, 0x97, 0x1e, 0xd4, 
-	0x86, 0x98, 0x5 , 0x23, 0x52, 0xd2, 0x35, 0x30, 0x12, 0x91, 0xa9, 0x69, 0x1a, 
-	0x80, 0x12, 0x8f, 0xc6, 0x8a, 0x3f, 0xa , 0x0 , 0x43, 0xf5, 0xa4, 0xa5, 0x3f, 
-	0x4a, 0x4a, 0x0 , 0x29, 0xa6, 0x95, 0xa9, 0x28, 0x1 , 0x1a, 0x92, 0x95, 0xa9, 
-	0x28, 0x0 , 0xa3, 0xf1, 0xa2, 0x8f, 0xc2, 0x80, 0x11, 0xbe, 0xb4, 0x94, 0xad, 
-	0xf4, 0xa4, 0xaa, 0x1 , 0xb4, 0x52, 0x91, 0x49, 0x40, 0xd , 0xa2, 0x8a, 0x28, 
-	0x1 , 0x80, 0x52, 0xd1, 0x4a, 0x5 , 0x49, 0x60, 0x3e, 0xb4, 0xbf, 0x8d, 0x1f, 
-	0x85, 0x14, 0xc , 0x28, 0xc5, 0x2 , 0x9d, 0x40, 0x5 , 0x38, 0x52, 0x2d, 0x2d, 
-	0x0 , 0xb , 0x4e, 0xfc, 0x69, 0x31, 0xed, 0x4b, 0xf8, 0x50, 0x20, 0xa2, 0x8a, 
-	0x50, 0x28, 0x18, 0x1 , 0x4b, 0x8a, 0x29, 0x56, 0x80, 0x16, 0x8a, 0x5 , 0x2e, 
-	0x3d, 0xa8, 0x1 , 0x7f, 0x1a, 0x3f, 0x1a, 0x3f, 0xa , 0x2a, 0x40, 0x29, 0x71, 
-	0x42, 0xd2, 0xd0, 0x1 , 0x4b, 0x8a, 0x16, 0x96, 0x80, 0xa , 0x51, 0xf5, 0xa4, 
-	0x14, 0xef, 0xc2, 0x80, 0xf , 0xc6, 0x8a, 0x3f, 0xa , 0x28, 0x0 , 0xa3, 0x14, 
-	0xa , 0x75, 0x0 , 0x14, 0x62, 0x81, 0x4e, 0xa0, 0x2 , 0x8a, 0x29, 0x40, 0xa0, 
-	0x0 , 0x7d, 0x69, 0x7f, 0x1a, 0x3f, 0xa , 0x3f, 0xa , 0x0 , 0x28, 0xa2, 0x8a, 
-	0x0 , 0x29, 0x71, 0x42, 0xd2, 0xd0, 0x1 , 0x45, 0x14, 0x50, 0x2 , 0x81, 0x4b, 
-	0x45, 0x14, 0x0 , 0xe , 0x69, 0x47, 0xd6, 0x8c, 0x7b, 0x52, 0xfe, 0x14, 0x8 , 
-	0x41, 0xf5, 0xa5, 0xfc, 0x68, 0xfc, 0x28, 0xfc, 0x28, 0x0 , 0xe3, 0xd0, 0x53, 
-	0x58, 0x3 , 0xd4, 0x7e, 0x94, 0xb9, 0x15, 0x5 , 0xd5, 0xca, 0x44, 0x99, 0x27, 
-	0xfc, 0xff, 0x0 , 0x5a, 0x92, 0x92, 0x6d, 0x84, 0xc2, 0x35, 0x52, 0x48, 0x0 , 
-	0x91, 0xcd, 0x66, 0xdf, 0x4f, 0x4 , 0x4a, 0x5d, 0x82, 0x7b, 0x6e, 0x3c, 0x7e, 
-	0x5d, 0xea, 0x3b, 0xcb, 0xe7, 0x7d, 0xc3, 0x38, 0xc7, 0x27, 0x38, 0xc0, 0xff, 
-	0x0 , 0x3e, 0xf5, 0x89, 0x7f, 0x73, 0x19, 0x25, 0xdc, 0xb3, 0x7a, 0x2a, 0xff, 
-	0x0 , 0x53, 0x58, 0xca, 0x67, 0x6d, 0x1a, 0x2d, 0xee, 0x4b, 0x7b, 0x7a, 0x59, 
-	0xb3, 0x16, 0x17, 0x9f, 0xf5, 0x8e, 0xbd, 0x3f, 0xdd, 0x15, 0x89, 0x7d, 0x73, 
-	0xb6, 0x4c, 0x86, 0x66, 0x7c, 0x7d, 0xe6, 0xea, 0x3f, 0xe , 0xd4, 0xb7, 0x57, 
-	0x1b, 0x94, 0x85, 0x38, 0xaa, 0x4c, 0xac, 0x7a, 0x73, 0xf4, 0xac, 0x5c, 0x8e, 
-	0xc5, 0x4d, 0xc5, 0x6c, 0x2a, 0xef, 0x77, 0x3c, 0x93, 0xea, 0x4d, 0x1b, 0x88, 
-	0x7c, 0x11, 0xf5, 0xcd, 0x35, 0x4c, 0xc8, 0xc1, 0x94, 0x30, 0x22, 0xb4, 0x21, 
-	0xb7, 0x17, 0x90, 0x19, 0x17, 0xb , 0x20, 0xea, 0x2a, 0x1b, 0xb1, 0xb5, 0x38, 
-	0xb9, 0x2d, 0x37, 0x2a, 0x13, 0xcf, 0xc8, 0xc4, 0xfb, 0x1a, 0x8d, 0x99, 0x4f, 
-	0x1c, 0x8a, 0x99, 0xe1, 0x30, 0x36, 0xd9, 0xd5, 0xb6, 0xe7, 0x1b, 0x87, 0x63, 
-	0xe8, 0x69, 0xe6, 0xd8, 0xed, 0xeb, 0xb8, 0x37, 0xf1, 0xe , 0xc3, 0xdc, 0x7f, 
-	0x5a, 0x69, 0x20, 0x6d, 0xbd, 0x8 , 0xed, 0xd1, 0x65, 0xd , 0xb0, 0xfc, 0xde, 
-	0x86, 0x83, 0x6d, 0x2e, 0xf0, 0x80, 0x6 , 0xc7, 0xf7, 0x58, 0x1a, 0x74, 0x71, 
-	0x3c, 0x2d, 0xb8, 0x7f, 0x9 , 0xe1, 0xc1, 0xca, 0xfe, 0x75, 0xb3, 0x6f, 0x67, 
-	0xe , 0xa5, 0xe , 0xf8, 0x87, 0x97, 0x71, 0x18, 0xfc, 0xfd, 0x88, 0x15, 0x12, 
-	0x97, 0x2e, 0xa6, 0xd4, 0xa9, 0xfb, 0x45, 0x6e, 0xa6, 0x5b, 0x47, 0x2b, 0x48, 
-	0x13, 0xcb, 0x6e, 0x38, 0xe9, 0x52, 0x91, 0x83, 0x90, 0x30, 0xa9, 0xc7, 0xd4, 
-	0xfa, 0xd3, 0xda, 0xce, 0xea, 0xc5, 0x4b, 0x4b, 0x13, 0x6 , 0x63, 0xf2, 0x9c, 
-	0xe4, 0x1a, 0x7 , 0xcd, 0x8d, 0xbd, 0xbb, 0x7a, 0x9a, 0xce, 0x52, 0xb9, 0xdf, 
-	0x4e, 0x16, 0x57, 0x7b, 0x8d, 0x8d, 0x49, 0x7e, 0x7a, 0x54, 0xcc, 0x70, 0x9b, 
-	0x81, 0xeb, 0xc2, 0xfd, 0x29, 0xaa, 0xab, 0x9c, 0x3f, 0xde, 0x61, 0xc8, 0x1d, 
-	0x85, 0x47, 0x33, 0xf9, 0x8d, 0xf2, 0x1c, 0x76, 0x1e, 0xd5, 0x1b, 0xb3, 0xa5, 
-	0x3e, 0x48, 0xdf, 0xa8, 0x92, 0x30, 0x62, 0x55, 0x4f, 0x3 , 0xa9, 0xf5, 0x34, 
-	0x2a, 0x6f, 0x6f, 0xf6, 0x54, 0x53, 0x92, 0x16, 0x23, 0xa , 0xe , 0x2a, 0x5f, 
-	0x2c, 0x4 , 0x11, 0xe0, 0xb7, 0x7f, 0x4a, 0xa7, 0x25, 0xd0, 0x88, 0xd3, 0x94, 
-	0x9d, 0xda, 0x22, 0x62, 0xa7, 0xee, 0x9c, 0x2a, 0xf7, 0xec, 0x4f, 0xa5, 0x35, 
-	0x77, 0x72, 0x50, 0x7d, 0x49, 0xa9, 0x19, 0x7e, 0x6c, 0xe3, 0x2a, 0xbc, 0x1 , 
-	0xef, 0x46, 0xc2, 0xcc, 0x1 , 0x1d, 0x39, 0x23, 0xb5, 0x2b, 0xa1, 0xb8, 0x36, 
-	0xc6, 0xa8, 0x0 , 0x7c, 0x9d, 0xfa, 0x9e, 0xe7, 0xe9, 0x56, 0x21, 0x8f, 0x3f, 
-	0x3c, 0x9c, 0x28, 0xf5, 0xa6, 0x85, 0x58, 0x87, 0x9b, 0x2b, 0x77, 0xe3, 0xdf, 
-	0xda, 0xa4, 0x52, 0x77, 0x79, 0x92, 0x7c, 0xa3, 0x1f, 0x2a, 0xe3, 0x81, 0x59, 
-	0xca, 0x5a, 0x1d, 0x14, 0xa9, 0xa4, 0xf5, 0xfe, 0xbd, 0x47, 0x6 , 0x5d, 0xd9, 
-	0x3d, 0x0 , 0xc8, 0xcf, 0x6a, 0xf , 0xf7, 0xb0, 0x7d, 0x87, 0xad, 0x34, 0xa9, 
-	0x73, 0xce, 0x3a, 0xf4, 0xff, 0x0 , 0x1a, 0x76, 0xd6, 0xe8, 0x3b, 0xd4, 0x59, 
-	0x23, 0x6b, 0xb6, 0x1f, 0xab, 0x7b, 0x7f, 0x9f, 0xd6, 0x97, 0x20, 0x1f, 0x98, 
-	0x9c, 0x91, 0xd3, 0xfc, 0xf4, 0xa5, 0x5c, 0x5 , 0x38, 0x3b, 0x8f, 0x73, 0xda, 
-	0xab, 0xdc, 0x4a, 0xb8, 0xe0, 0x16, 0xc9, 0xfc, 0x58, 0xd0, 0x95, 0xd8, 0xa7, 
-	0x25, 0x8 , 0xdd, 0x8f, 0x9a, 0x60, 0x7 , 0x5c, 0x81, 0xd3, 0xdf, 0xe8, 0x2a, 
-	0x24, 0x89, 0xa4, 0x70, 0xcc, 0x4e, 0x7b, 0xc , 0xf4, 0xa4, 0x8e, 0x36, 0x32, 
-	0x6e, 0x6f, 0xbd, 0xfa, 0x2d, 0x4f, 0x18, 0x2c, 0x36, 0x26, 0x70, 0x4f, 0x27, 
-	0xbb, 0x55, 0xda, 0xdb, 0x1c, 0xbc, 0xdc, 0xfa, 0xcf, 0x61, 0x17, 0x2c, 0xdb, 
-	0x57, 0xa0, 0xef, 0x5a, 0x3a, 0x66, 0x9e, 0xd3, 0x9c, 0xe7, 0x8 , 0x9f, 0x78, 
-	0xff, 0x0 , 0x9e, 0xf5, 0x36, 0x8f, 0xa5, 0xb4, 0x8c, 0xa3, 0x7 , 0xe6, 0x38, 
-	0xc8, 0x19, 0x3f, 0x41, 0xea, 0x6b, 0xd1, 0xfc, 0x23, 0xe1, 0x93, 0x88, 0xfc, 
-	0xc8, 0xd7, 0x23, 0xa2, 0x1 , 0x90, 0x9f, 0x5f, 0x56, 0xfd, 0x28, 0xb1, 0x9d, 
-	0x4a, 0xca, 0x28, 0xa1, 0xe0, 0xdf, 0xc , 0x3c, 0xac, 0x8c, 0x61, 0xda, 0xa3, 
-	0x91, 0xb9, 0x73, 0x8f, 0x7f, 0x73, 0x5e, 0xa5, 0xe1, 0x7f, 0xf , 0x41, 0x6d, 
-	0xf , 0xcb, 0x11, 0x2c, 0x7e, 0xf3, 0x11, 0xc9, 0x3e, 0xa6, 0x9f, 0xe1, 0xfd, 
-	0x31, 0x22, 0x55, 0x1e, 0x5e, 0xd0, 0xa4, 0x57, 0x5b, 0xa7, 0xc0, 0x23, 0x8f, 
-	0x3b, 0x38, 0x1d, 0x6 , 0x29, 0x36, 0x73, 0x5d, 0xc9, 0xea, 0x3f, 0x48, 0xd3, 
-	0xd5, 0x30, 0x71, 0xdb, 0x20, 0xf5, 0x15, 0xd1, 0x69, 0xb6, 0xea, 0x2 , 0xfc, 
-	0xb9, 0xe7, 0xa7, 0x15, 0x5 , 0x8a, 0xa8, 0x50, 0xc4, 0x1c, 0x63, 0xb8, 0xe9, 
-	0x56, 0xe0, 0x38, 0xf9, 0x94, 0x64, 0x81, 0xdc, 0x71, 0x59, 0xb2, 0xd2, 0x2e, 
-	0xc2, 0xab, 0xbb, 0x3f, 0x2e, 0x33, 0x9f, 0xa5, 0x39, 0x40, 0xda, 0xa , 0xe1, 
-	0x40, 0x3d, 0xaa, 0x8 , 0x59, 0xb1, 0x86, 0xc1, 0xe4, 0x67, 0x1f, 0xcb, 0xf4, 
-	0xa9, 0xf6, 0xe3, 0x3 , 0x20, 0x7a, 0xa , 0x92, 0xcb, 0x90, 0x90, 0xc0, 0xc , 
-	0x63, 0xe9, 0x56, 0xa3, 0x65, 0x23, 0xa7, 0x6e, 0x98, 0xaa, 0x10, 0xb1, 0x1c, 
-	0xc , 0x7e, 0x75, 0x6a, 0x2c, 0xbb, 0x70, 0x57, 0x18, 0xe4, 0x67, 0xbd, 0x2 , 
-	0x65, 0xb8, 0x59, 0x43, 0x2 , 0x40, 0x19, 0xe7, 0x3 , 0x3f, 0xa5, 0x3d, 0xa5, 
-	0x60, 0xa3, 0x93, 0xea, 0xe , 0x3a, 0x55, 0x52, 0xcc, 0x5b, 0xb , 0xfe, 0x18, 
-	0xa7, 0xa9, 0xcf, 0x3b, 0x8f, 0x27, 0xad, 0x21, 0x12, 0x49, 0x32, 0xbe, 0xe5, 
-	0x24, 0xf0, 0x38, 0x15, 0x5a, 0xe1, 0x8b, 0xf1, 0x93, 0x8e, 0x98, 0xa7, 0xc8, 
-	0xa8, 0x18, 0x11, 0xc9, 0xc6, 0x9 , 0x15, 0x1c, 0xc7, 0xe5, 0x38, 0xfc, 0x5 , 
-	0x26, 0x23, 0x99, 0xf1, 0x75, 0x88, 0x96, 0xd6, 0x40, 0xc3, 0x39, 0x1c, 0x67, 
-	0xfa, 0xd7, 0xce, 0xff, 0x0 , 0x15, 0x74, 0xb5, 0x4b, 0x89, 0x1c, 0x26, 0x7 , 
-	0x4a, 0xfa, 0x6b, 0x58, 0x84, 0x3c, 0x6c, 0x0 , 0xe3, 0x1f, 0xc5, 0xd2, 0xbc, 
-	0x63, 0xe2, 0xbe, 0x9a, 0xac, 0x24, 0x65, 0x39, 0xce, 0x70, 0x40, 0xef, 0x57, 
-	0x4e, 0x56, 0x66, 0x35, 0x23, 0x74, 0xcf, 0x9c, 0x75, 0xd8, 0x36, 0x31, 0xc8, 
-	0xee, 0x41, 0xae, 0x7e, 0x75, 0x26, 0x32, 0xbd, 0xd4, 0xe3, 0xfc, 0xfe, 0x95, 
-	0xdb, 0x78, 0xae, 0xd4, 0xc7, 0x33, 0xc , 0x7a, 0x83, 0x9a, 0xe4, 0x2e, 0xa3, 
-	0x2b, 0x31, 0x53, 0xfc, 0x5c, 0x57, 0xa0, 0xb5, 0x47, 0x9d, 0x1d, 0x25, 0x67, 
-	0xe8, 0x37, 0x45, 0x9e, 0x50, 0xa6, 0xd , 0xdc, 0x26, 0x58, 0xe , 0xf8, 0x1d, 
-	0x7f, 0x43, 0xfa, 0x56, 0xd5, 0xab, 0x9d, 0xdb, 0x43, 0x60, 0x7d, 0xe1, 0x83, 
-	0xf9, 0xd7, 0x33, 0x13, 0xf9, 0x17, 0x4b, 0x28, 0xec, 0xd9, 0x3e, 0xfe, 0xbf, 
-	0xe7, 0xde, 0xb6, 0x6c, 0x64, 0xd8, 0x30, 0x39, 0xdb, 0xd3, 0xe8, 0x79, 0xae, 
-	0x6c, 0x4c, 0x35, 0xba, 0x3e, 0x87, 0x26, 0xc4, 0xfb, 0xbe, 0xce, 0x4f, 0x63, 
-	0x42, 0xe1, 0x98, 0x32, 0xc8, 0x6 , 0x4a, 0xb6, 0x70, 0x3b, 0x8c, 0x7f, 0x5f, 
-	0xe7, 0x5a, 0x50, 0x5d, 0x6f, 0x1e, 0x7a, 0xb6, 0xe6, 0x20, 0x6e, 0x1d, 0x88, 
-	0xf7, 0xff, 0x0 , 0x3d, 0xea, 0x81, 0x65, 0x78, 0x55, 0x3f, 0xbc, 0xb8, 0xff, 
-	0x0 , 0xa , 0x83, 0x4b, 0x9b, 0xcb, 0x99, 0x91, 0xce, 0xc2, 0xa7, 0x9f, 0xf1, 
-	0xfe, 0x46, 0xb8, 0xad, 0x74, 0x7b, 0xf7, 0xf6, 0x75, 0x17, 0x9f, 0xe6, 0x68, 
-	0xde, 0x46, 0x22, 0x76, 0x91, 0x37, 0x18, 0xe4, 0xe9, 0xea, 0xac, 0x39, 0xff, 
-	0x0 , 0xf , 0xf2, 0x6a, 0x38, 0x9d, 0x95, 0xcb, 0x81, 0x8c, 0x11, 0x91, 0xe8, 
-	0x7b, 0xfe, 0x7f, 0xd0, 0xd5, 0x96, 0x29, 0xf7, 0x58, 0xed, 0x8e, 0x51, 0xb4, 
-	0xe7, 0xa2, 0x37, 0xaf, 0xf2, 0xfc, 0xd , 0x50, 0xdc, 0xd1, 0x6e, 0x2c, 0xe , 
-	0xe8, 0x9b, 0x6b, 0x8f, 0x55, 0xff, 0x0 , 0x3f, 0xca, 0x88, 0xea, 0x85, 0x5a, 
-	0x3c, 0xb2, 0xb9, 0x62, 0x42, 0x19, 0xa , 0xb1, 0x7 , 0x38, 0xe0, 0xff, 0x0 , 
-	0x9e, 0xdc, 0x56, 0x64, 0x9f, 0x2a, 0xed, 0x5c, 0x90, 0x33, 0x81, 0xfc, 0x4a, 
-	0x3d, 0xf , 0xeb, 0xfa, 0x55, 0xde, 0x43, 0x60, 0x1f, 0x93, 0x39, 0x19, 0xed, 
-	0xdb, 0xf4, 0xe2, 0xa9, 0x5d, 0x36, 0xd2, 0xc4, 0x8d, 0xad, 0xd7, 0xdf, 0x8a, 
-	0xa8, 0xb7, 0xb1, 0x95, 0x68, 0xab, 0x29, 0x21, 0xd0, 0xb3, 0x2f, 0x52, 0xbf, 
-	0x87, 0xa5, 0x59, 0x85, 0xc8, 0x5d, 0x99, 0xe9, 0xca, 0x9a, 0xa3, 0x19, 0xf , 
-	0x83, 0xf7, 0x58, 0x73, 0x53, 0xa9, 0xdc, 0x1 , 0x1f, 0xfe, 0xa3, 0x53, 0x28, 
-	0x9d, 0x18, 0x7a, 0x9a, 0x68, 0x58, 0x66, 0x59, 0x0 , 0xcf, 0xc , 0xa3, 0xbf, 
-	0x71, 0x4c, 0x5e, 0x55, 0x93, 0x3 , 0xe8, 0x69, 0xbf, 0x31, 0xc1, 0xc6, 0x8 , 
-	0xa5, 0xc1, 0xdd, 0xbd, 0x4e, 0x79, 0xe6, 0xa3, 0x63, 0xb3, 0x77, 0xb0, 0xb1, 
-	0x9f, 0x9b, 0x9f, 0xc2, 0xa5, 0x85, 0xd4, 0x47, 0x8f, 0x41, 0x51, 0xb6, 0x6 , 
-	0x1b, 0x3e, 0xd4, 0xe5, 0x55, 0xfe, 0x2e, 0x32, 0x69, 0x15, 0x14, 0x5d, 0xb7, 
-	0x3f, 0x36, 0x1 , 0xea, 0x31, 0xed, 0x57, 0x6d, 0xc9, 0x6e, 0xe , 0x4e, 0x38, 
-	0xdc, 0x2b, 0x2a, 0x4 , 0x38, 0xdc, 0x8f, 0xb7, 0xdc, 0xd5, 0xc5, 0xb8, 0xb8, 
-	0x89, 0xbe, 0x50, 0xae, 0xbe, 0x99, 0x19, 0xad, 0xe9, 0xe2, 0x67, 0x7 , 0xdc, 
-	0xf3, 0x31, 0x99, 0x55, 0xa , 0xf1, 0x6e, 0xf6, 0xfc, 0x4d, 0x5 , 0xce, 0x3e, 
-	0x53, 0xbb, 0xe8, 0x69, 0xca, 0xc7, 0x38, 0x60, 0x47, 0xe1, 0x50, 0x5a, 0xea, 
-	0xa , 0xcc, 0x16, 0x7b, 0x7f, 0xa1, 0x3 , 0xff, 0x0 , 0xaf, 0x5a, 0xb6, 0xad, 
-	0xa7, 0xba, 0xfc, 0xe6, 0x54, 0x1e, 0xc7, 0x3f, 0xcc, 0x57, 0x7d, 0x3c, 0x72, 
-	0xea, 0x99, 0xf2, 0xd8, 0xae, 0x1d, 0x9b, 0x6f, 0x92, 0x51, 0x7f, 0x81, 0x50, 
-	0x10, 0x7b, 0xd2, 0xfe, 0x35, 0xa0, 0xd6, 0xfa, 0x5b, 0xaf, 0xc9, 0x72, 0x47, 
-	0xb9, 0x18, 0xfe, 0x42, 0xaa, 0xcf, 0x4 , 0x51, 0x8f, 0xdd, 0xce, 0x24, 0xff, 
-	0x0 , 0x80, 0x9a, 0xeb, 0x8e, 0x2e, 0x9b, 0x3c, 0x5a, 0xd9, 0x1e, 0x26, 0x1a, 
-	0xe9, 0xf7, 0xaf, 0xf3, 0x21, 0xfc, 0x68, 0xfc, 0x6a, 0x37, 0x90, 0xa9, 0xfb, 
-	0x9f, 0x89, 0xff, 0x0 , 0xf5, 0x52, 0xe5, 0x88, 0xc8, 0x18, 0x15, 0xd1, 0x1a, 
-	0x8a, 0x5b, 0x1e, 0x5d, 0x5c, 0x3c, 0xe9, 0x3b, 0x48, 0x7f, 0xe3, 0x48, 0x7e, 
-	0xb4, 0x8b, 0x9e, 0xf4, 0xef, 0xc2, 0xb4, 0x31, 0x10, 0xd2, 0x52, 0x91, 0x49, 
-	0x40, 0x5 , 0x19, 0xa2, 0x8c, 0x50, 0x3 , 0x68, 0xa2, 0x8a, 0x0 , 0x28, 0xcd, 
-	0x14, 0x62, 0x80, 0x1b, 0x45, 0x14, 0x50, 0x20, 0xa3, 0xf1, 0xa2, 0x8f, 0xc2, 
-	0x80, 0x13, 0xf1, 0xa4, 0x34, 0xb8, 0xf6, 0xa3, 0x14, 0x8 , 0x4a, 0x28, 0xa2, 
-	0x81, 0x8d, 0xa2, 0x8a, 0x28, 0x10, 0x8d, 0x49, 0x46, 0x68, 0xa0, 0x2 , 0x8f, 
-	0xc6, 0x8a, 0x3f, 0xa , 0x0 , 0x46, 0xfa, 0xd2, 0x52, 0xe3, 0xda, 0x90, 0xd0, 
-	0x1 , 0x48, 0xd4, 0xa6, 0x9b, 0x40, 0x1 , 0xa6, 0xd3, 0xa9, 0x1a, 0xa8, 0x4 , 
-	0xa3, 0xf1, 0xa2, 0x8f, 0xc2, 0x80, 0x10, 0xfd, 0x69, 0x29, 0xdf, 0x85, 0x34, 
-	0xd0, 0x2 , 0x35, 0x25, 0x2b, 0x52, 0x50, 0x2 , 0x35, 0x25, 0x2b, 0x52, 0x50, 
-	0x1 , 0xf8, 0xd1, 0xf8, 0xd1, 0xf8, 0x51, 0xf8, 0x50, 0x3 , 0x68, 0xa2, 0x8a, 
-	0x60, 0x36, 0x8a, 0x28, 0xa6, 0x3 , 0x68, 0xa2, 0x8f, 0xc2, 0x80, 0x1b, 0x4a, 
-	0x3e, 0xb4, 0x82, 0x9d, 0xf8, 0x54, 0x9a, 0x7 , 0xe3, 0x45, 0x1f, 0x85, 0x14, 
-	0x0 , 0x2d, 0x3a, 0x8c, 0x52, 0xf5, 0xa0, 0x96, 0x2d, 0x14, 0x52, 0xaf, 0xd2, 
-	0x82, 0x85, 0xfc, 0x68, 0xa3, 0xf0, 0xa2, 0x81, 0xa , 0xb4, 0xb4, 0x8b, 0x4b, 
-	0x40, 0xc2, 0x9c, 0x28, 0xc5, 0x14, 0x8 , 0x16, 0x9d, 0xf8, 0xd2, 0x63, 0xda, 
-	0x97, 0xf0, 0xa4, 0x30, 0xa2, 0x8a, 0x50, 0x29, 0x0 , 0x1 , 0x4b, 0x45, 0x28, 
-	0x14, 0x0 , 0xb4, 0x50, 0x29, 0x71, 0x40, 0x85, 0xfc, 0x68, 0xfc, 0x68, 0xfc, 
-	0x28, 0xa0, 0x61, 0x45, 0x14, 0xaa, 0x33, 0x40, 0x85, 0xa3, 0x14, 0x52, 0xad, 
-	0x3 , 0xe , 0x94, 0xb4, 0x52, 0x81, 0x40, 0x8 , 0xb4, 0xef, 0xc6, 0x93, 0x1e, 
-	0xd4, 0xbf, 0x85, 0x0 , 0x1f, 0x8d, 0x14, 0x51, 0x40, 0xba, 0x85, 0x14, 0xa , 
-	0x5c, 0x50, 0x30, 0x2 , 0x96, 0x8a, 0x50, 0x28, 0x0 , 0xc5, 0x28, 0xa2, 0x8a, 
-	0x0 , 0x28, 0xc7, 0xbd, 0x2 , 0x9d, 0xf8, 0x50, 0x1 , 0xf8, 0xd1, 0xf8, 0xd1, 
-	0xf8, 0x51, 0xf8, 0x50, 0x1 , 0x8a, 0x3e, 0xa6, 0x93, 0x3e, 0xd5, 0xd , 0xe4, 
-	0xd1, 0xc6, 0x99, 0x76, 0xff, 0x0 , 0x80, 0xfa, 0xd4, 0xb0, 0x8a, 0x6d, 0x91, 
-	0xde, 0x4d, 0xb5, 0x38, 0x3f, 0x40, 0x6b, 0x1e, 0xf3, 0xed, 0x12, 0x31, 0x67, 
-	0x7c, 0x2e, 0x38, 0xab, 0x6d, 0x97, 0xfd, 0xf4, 0x83, 0x0 , 0x1f, 0x95, 0x6a, 
-	0x8e, 0xa9, 0x70, 0xb6, 0xd6, 0xed, 0x34, 0xdc, 0xee, 0x3f, 0x20, 0xcf, 0x53, 
-	0x58, 0xcb, 0xcc, 0xec, 0xa5, 0xa3, 0xb2, 0xdc, 0xa3, 0x7c, 0x36, 0xc3, 0xf3, 
-	0x38, 0x55, 0x7 , 0xef, 0x63, 0xfc, 0x9a, 0xc3, 0xbb, 0xb9, 0xcb, 0xe1, 0x41, 
-	0x6f, 0x76, 0xe6, 0xa6, 0x69, 0x2e, 0xf5, 0x1b, 0x83, 0x8f, 0xba, 0xbd, 0x49, 
-	0x38, 0x54, 0xa2, 0x64, 0xb6, 0xb7, 0x42, 0xaa, 0xde, 0x74, 0x83, 0xab, 0x91, 
-	0x81, 0x9f, 0x6a, 0xc2, 0xcd, 0xfa, 0x1e, 0x8a, 0x92, 0x82, 0xb6, 0xec, 0xa4, 
-	0xd0, 0x49, 0xb7, 0x7b, 0x91, 0x18, 0xff, 0x0 , 0x6b, 0xa9, 0xfc, 0x29, 0x62, 
-	0x48, 0xcf, 0x4 , 0x10, 0x7b, 0x37, 0x51, 0xf8, 0xd3, 0x24, 0x39, 0x6c, 0xb9, 
-	0xe7, 0xeb, 0x51, 0x6e, 0x23, 0xa1, 0x23, 0xf1, 0xa5, 0x6d, 0x6 , 0xa4, 0x93, 
-	0xd4, 0xb9, 0xb4, 0xaf, 0xd , 0xdf, 0xa6, 0x4f, 0x5a, 0x75, 0xbb, 0xc9, 0x5 , 
-	0xca, 0xbe, 0xed, 0x8c, 0xa7, 0xbd, 0x56, 0x82, 0xe6, 0x65, 0x6e, 0x59, 0x58, 
-	0x7f, 0x75, 0x94, 0x11, 0x53, 0xad, 0xd4, 0x4d, 0xc4, 0xb6, 0xeb, 0xb7, 0xfd, 
-	0x87, 0x23, 0x1f, 0x4e, 0xb8, 0xa9, 0xe5, 0x66, 0xf1, 0xad, 0x17, 0x6e, 0x87, 
-	0x4f, 0xa6, 0xea, 0x3a, 0x2d, 0xd4, 0x22, 0xdf, 0x55, 0x83, 0xc9, 0xcf, 0x49, 
-	0x0 , 0x1b, 0x4f, 0xbf, 0xff, 0x0 , 0x5e, 0xaf, 0xaf, 0x83, 0xed, 0xa4, 0x43, 
-	0x26, 0x95, 0x7e, 0x93, 0x27, 0x50, 0x84, 0xe4, 0x8f, 0xc3, 0x83, 0x5c, 0x4f, 
-	0x99, 0x66, 0x3f, 0xd5, 0xcb, 0x70, 0xbe, 0xaa, 0xc8, 0xae, 0x3f, 0x98, 0xab, 
-	0xda, 0x4e, 0xa5, 0x6f, 0x6e, 0xdb, 0x8d, 0xec, 0xb1, 0x81, 0xd0, 0x5 , 0x38, 
-	0x1f, 0x86, 0x4d, 0x65, 0x2a, 0x72, 0x5f, 0xb , 0x3b, 0xa8, 0xe2, 0xa8, 0xc9, 
-	0xa5, 0x5a, 0x29, 0xf9, 0xde, 0xcf, 0xfa, 0xf9, 0x1b, 0x1a, 0x97, 0x85, 0xaf, 
-	0x21, 0xe7, 0x9 , 0x1b, 0x7f, 0xb4, 0xa , 0x83, 0xff, 0x0 , 0x2 , 0xe3, 0x3f, 
-	0x8d, 0x36, 0xda, 0xca, 0xfe, 0xd2, 0x48, 0xdf, 0xec, 0xcc, 0xc5, 0x7a, 0x3c, 
-	0x6e, 0xf , 0xf8, 0x53, 0xed, 0xfc, 0x52, 0x81, 0x76, 0x1d, 0x59, 0x88, 0x5e, 
-	0x70, 0x61, 0x6f, 0xe9, 0x56, 0x2d, 0xfc, 0x4f, 0xb , 0x21, 0x2f, 0x34, 0x8c, 
-	0xc4, 0xf1, 0x95, 0x23, 0xf3, 0xe2, 0xb9, 0xe5, 0xed, 0xfb, 0x1e, 0x9d, 0x8 , 
-	0xe5, 0xb2, 0x95, 0xd4, 0xed, 0xf7, 0x33, 0x6e, 0xde, 0xf2, 0xde, 0xe6, 0xdc, 
-	0x43, 0x79, 0x66, 0x42, 0x9e, 0xe , 0xe4, 0x4 , 0x7f, 0xf5, 0xbf, 0x5a, 0xcd, 
-	0xd5, 0xf4, 0x4b, 0x29, 0x32, 0xd6, 0xb8, 0x8c, 0x13, 0xc8, 0xcf, 0x6f, 0xc2, 
-	0xab, 0xc9, 0xae, 0x2e, 0x38, 0x12, 0xf1, 0xce, 0x77, 0xe2, 0xaa, 0xcb, 0xaf, 
-	0xe4, 0x9c, 0x86, 0x1f, 0x49, 0x17, 0x35, 0x87, 0x2d, 0x7b, 0xe8, 0x8f, 0x51, 
-	0xd4, 0xcb, 0x92, 0xf7, 0xa5, 0x7f, 0x90, 0xd6, 0xd2, 0xd5, 0x37, 0x6e, 0x7f, 
-	0xd3, 0xb5, 0x57, 0x5b, 0x44, 0xd , 0xc1, 0x55, 0x51, 0xe8, 0xbd, 0x6a, 0x2b, 
-	0xad, 0x59, 0x9f, 0x4 , 0x4a, 0xa0, 0xf5, 0xc3, 0xc8, 0x4f, 0xe8, 0x32, 0x2a, 
-	0xa3, 0x5e, 0x48, 0xed, 0x96, 0x6c, 0xae, 0x7a, 0x1 , 0xfa, 0xd6, 0xd1, 0xa7, 
-	0x56, 0xda, 0xb3, 0x86, 0xa6, 0x33, 0x4 , 0x9f, 0xb9, 0x13, 0x49, 0x51, 0x1 , 
-	0x25, 0x98, 0xe0, 0xd4, 0x6f, 0xb3, 0xa0, 0x38, 0x1e, 0xf5, 0x94, 0xd7, 0xa1, 
-	0x9b, 0x6e, 0x7 , 0xe2, 0xa3, 0xfa, 0x52, 0x35, 0xc3, 0xed, 0xc2, 0x39, 0x19, 
-	0xe0, 0x6d, 0xad, 0x3d, 0x83, 0xee, 0x73, 0xbc, 0xce, 0x93, 0x4f, 0x96, 0x26, 
-	0x88, 0xf2, 0xf3, 0xc0, 0x1c, 0xf , 0x5c, 0xfe, 0x54, 0xde, 0x7c, 0xc1, 0xb1, 
-	0x47, 0x3d, 0xcf, 0xf8, 0x55, 0x25, 0x32, 0x95, 0x1 , 0x9d, 0x88, 0x1e, 0xfd, 
-	0x6a, 0x58, 0xcb, 0x16, 0xda, 0xac, 0xdc, 0xfa, 0x9f, 0xd2, 0x9f, 0x25, 0xba, 
-	0x91, 0x1c, 0x52, 0x97, 0x42, 0xce, 0xe1, 0xbb, 0x8f, 0x99, 0xa8, 0xa , 0xc5, 
-	0xbd, 0x4f, 0xbf, 0x45, 0xa2, 0x8 , 0x82, 0x7f, 0xbd, 0xeb, 0x52, 0x31, 0x8 , 
-	0x2 , 0x2e, 0xb , 0x9e, 0xe4, 0xf4, 0xac, 0x9b, 0xec, 0x74, 0xc6, 0x2d, 0xab, 
-	0xcb, 0x41, 0xac, 0x36, 0xe0, 0x60, 0xe7, 0xb0, 0xc5, 0x2e, 0x76, 0x29, 0x19, 
-	0xdc, 0xcd, 0xd4, 0xa , 0x4d, 0xd8, 0xc8, 0x8f, 0x25, 0x8f, 0xde, 0x73, 0xfe, 
-	0x15, 0x13, 0x90, 0x17, 0x68, 0xef, 0xf9, 0xfe, 0x34, 0xd2, 0xb8, 0xa5, 0x35, 
-	0x1d, 0x44, 0x91, 0xc9, 0x38, 0xcf, 0x1e, 0x9e, 0xbf, 0xfd, 0x6a, 0x6a, 0xaf, 
-	0xcd, 0xc8, 0xe4, 0x8a, 0x74, 0x63, 0xd , 0x85, 0xea, 0x47, 0x53, 0x56, 0x2d, 
-	0xed, 0xf2, 0xd8, 0xc7, 0xe2, 0x6b, 0x5b, 0x58, 0xe2, 0x6f, 0x99, 0xdd, 0x91, 
-	0xc3, 0x11, 0x76, 0xa , 0x7 , 0xcb, 0x9e, 0x9e, 0xb5, 0xb9, 0xa2, 0xe9, 0xe6, 
-	0x59, 0x15, 0x44, 0x6c, 0xe5, 0xba, 0x1 , 0xc9, 0x6f, 0x61, 0xe8, 0x2a, 0xc6, 
-	0x81, 0xa2, 0x3d, 0xc6, 0x30, 0x84, 0xae, 0x7a, 0x9e, 0x87, 0xe9, 0xeb, 0x5e, 
-	0x81, 0xe1, 0x7d, 0xe , 0x38, 0xa3, 0x7 , 0x6e, 0x49, 0xe4, 0xb7, 0x76, 0x1e, 
-	0x9f, 0x4a, 0x23, 0x17, 0xb9, 0x95, 0x6a, 0xf1, 0x8b, 0xe5, 0x44, 0x7e, 0x13, 
-	0xf0, 0xf8, 0x88, 0x9 , 0x24, 0x51, 0xe7, 0x60, 0xd , 0xc3, 0xa2, 0x8f, 0x45, 
-	0xaf, 0x40, 0xd1, 0x34, 0xe5, 0x45, 0x55, 0xda, 0xa0, 0x8e, 0x98, 0x15, 0x1e, 
-	0x8d, 0x66, 0xa3, 0x68, 0xe0, 0x76, 0x1c, 0x57, 0x47, 0xa7, 0xc2, 0x76, 0x82, 
-	0x57, 0xf0, 0xf4, 0x14, 0xa4, 0x72, 0xeb, 0x27, 0x76, 0x59, 0xd2, 0xed, 0xd0, 
-	0x10, 0x31, 0xda, 0xb6, 0x2d, 0x53, 0x6e, 0x31, 0xed, 0x55, 0x6d, 0x63, 0xf9, 
-	0x79, 0x27, 0x1d, 0xea, 0xe4, 0x64, 0xaa, 0x8e, 0x7f, 0xdd, 0x3d, 0x2b, 0x26, 
-	0x6c, 0xb4, 0x2f, 0xda, 0x39, 0x64, 0x4 , 0x76, 0x18, 0xab, 0x30, 0xb8, 0x3f, 
-	0x28, 0x1f, 0x76, 0xa9, 0x42, 0x2 , 0xf2, 0xc7, 0x3c, 0xf6, 0xeb, 0xf8, 0x55, 
-	0x80, 0xc4, 0xfd, 0xe0, 0x78, 0xf4, 0xea, 0xdf, 0xe4, 0x56, 0x65, 0x96, 0xd7, 
-	0x1 , 0x83, 0x65, 0x46, 0xef, 0x7e, 0xb5, 0x34, 0x67, 0x3c, 0xab, 0x2 , 0x1 , 
-	0xfc, 0xea, 0xac, 0x6c, 0xa , 0xee, 0xe7, 0x70, 0xc8, 0xc0, 0x3e, 0xd4, 0xe8, 
-	0x64, 0xdd, 0x8f, 0x94, 0x9c, 0x1c, 0x60, 0x1e, 0xbf, 0xe7, 0x9a, 0x0 , 0xb9, 
-	0x1b, 0x81, 0xc1, 0xfd, 0x2a, 0xc4, 0x6d, 0x95, 0xc8, 0x65, 0xfa, 0x67, 0xad, 
-	0x52, 0xce, 0x30, 0x41, 0xcf, 0x6c, 0x9e, 0xd4, 0xfb, 0x66, 0x4 , 0xb7, 0x98, 
-	0xd8, 0x5c, 0x73, 0x91, 0xf9, 0xd0, 0x6 , 0x8e, 0x1a, 0x45, 0x2a, 0xa3, 0x69, 
-	0x1c, 0x9e, 0x3a, 0xf , 0x51, 0x4a, 0xcc, 0xa1, 0x4b, 0x2e, 0xe6, 0x1c, 0x70, 
-	0x8 , 0xeb, 0x50, 0xc2, 0x7c, 0xcf, 0xb8, 0xc1, 0x70, 0xc4, 0x75, 0xe5, 0x87, 
-	0x7f, 0xe6, 0x2a, 0x68, 0xd8, 0xa8, 0xcc, 0x87, 0xa , 0xdc, 0x60, 0x9e, 0x3f, 
-	0x1f, 0xce, 0xa4, 0x5 , 0x39, 0x73, 0x85, 0xca, 0xed, 0xe8, 0x73, 0xde, 0x93, 
-	0x68, 0xe8, 0xd , 0x39, 0x5b, 0x1b, 0x81, 0x8c, 0x70, 0x7a, 0x67, 0xf4, 0xfe, 
-	0x54, 0x34, 0x45, 0x97, 0x23, 0x3f, 0x37, 0x19, 0xe9, 0xe9, 0x53, 0x22, 0x4a, 
-	0x57, 0xc0, 0x15, 0xda, 0x1 , 0x1c, 0xf0, 0x71, 0xc7, 0x6f, 0x4a, 0xf3, 0xcf, 
-	0x88, 0x1a, 0x59, 0x96, 0xde, 0x42, 0x17, 0x77, 0xb3, 0xf , 0xd4, 0x57, 0xa5, 
-	0xde, 0xed, 0xf2, 0xf7, 0x2a, 0x76, 0xf4, 0xfd, 0x5 , 0x73, 0xbe, 0x2c, 0xb3, 
-	0x32, 0x5a, 0xb1, 0x51, 0xc0, 0x18, 0x39, 0x5f, 0xaf, 0x4a, 0x94, 0xec, 0xc4, 
-	0xf6, 0x3e, 0x56, 0xf8, 0x8d, 0xa6, 0xf9, 0x37, 0x4c, 0x42, 0xe0, 0x76, 0xaf, 
-	0x35, 0xd6, 0x22, 0x65, 0x97, 0x3d, 0x39, 0xaf, 0x7d, 0xf8, 0xa9, 0xa5, 0x65, 
-	0x64, 0xda, 0xa3, 0x2a, 0x2b, 0xc5, 0x3c, 0x45, 0x6f, 0xb1, 0xd9, 0x48, 0xfa, 
-	0x57, 0xa5, 0x42, 0x57, 0x47, 0x95, 0x5e, 0x16, 0x91, 0xcc, 0x5f, 0x26, 0xdc, 
-	0xb2, 0xfd, 0x6a, 0xd6, 0x9f, 0x20, 0x2a, 0x83, 0xa7, 0xf0, 0x9f, 0x71, 0xfe, 
-	0x7f, 0x9d, 0x45, 0x72, 0x81, 0xa3, 0x23, 0xae, 0x32, 0x3f, 0x3e, 0x9f, 0xad, 
-	0x56, 0xb5, 0x76, 0xc7, 0x1d, 0x57, 0xde, 0xb4, 0x9c, 0x6f, 0x16, 0x8d, 0xb0, 
-	0xd5, 0xfd, 0x9d, 0x65, 0x2e, 0xeb, 0xfe, 0x1c, 0xe9, 0x2d, 0x58, 0x98, 0x4c, 
-	0x79, 0xe5, 0x7b, 0xfb, 0x71, 0x51, 0x5c, 0x2e, 0xcb, 0xb2, 0xe4, 0xf0, 0xfd, 
-	0xbf, 0xcf, 0xe3, 0x51, 0xd8, 0xcb, 0xba, 0x35, 0x94, 0x1e, 0x18, 0x54, 0xda, 
-	0x86, 0x1a, 0x12, 0x15, 0x7d, 0x30, 0x7f, 0xcf, 0xe1, 0x5e, 0x75, 0xad, 0x2b, 
-	0x1f, 0x66, 0xe5, 0x19, 0xd0, 0xe6, 0x5d, 0x35, 0x2e, 0x43, 0x21, 0x78, 0x8a, 
-	0x72, 0xdb, 0x88, 0x4 , 0xe7, 0xa7, 0xa1, 0xfd, 0x69, 0x67, 0x62, 0x4f, 0x99, 
-	0xb4, 0xf4, 0xda, 0xde, 0xe3, 0x1f, 0xfd, 0x6a, 0xa3, 0x6f, 0x3f, 0xca, 0xa4, 
-	0x72, 0x19, 0x79, 0x3 , 0xfc, 0xff, 0x0 , 0x9c, 0xd5, 0xb8, 0x58, 0x32, 0x8e, 
-	0xea, 0xc3, 0x7 , 0x27, 0xfc, 0xfb, 0xd6, 0x6d, 0x34, 0xce, 0x9a, 0x72, 0x55, 
-	0x22, 0x88, 0xe3, 0x72, 0x23, 0x28, 0x79, 0xf2, 0xcf, 0x23, 0xd4, 0x74, 0xfe, 
-	0x55, 0x1d, 0xf2, 0xfc, 0x8b, 0x24, 0x63, 0x73, 0xe , 0x46, 0x7f, 0x8b, 0xdb, 
-	0xf2, 0xcd, 0x3a, 0x6c, 0xc3, 0x20, 0x20, 0x67, 0xf8, 0x4d, 0x39, 0x86, 0x53, 
-	0x1 , 0xbe, 0xee, 0x38, 0xa6, 0x9d, 0x9d, 0xcc, 0xf9, 0x39, 0xa2, 0xe1, 0xd4, 
-	0xa6, 0xac, 0xe , 0xd9, 0x14, 0xfc, 0x8d, 0xc8, 0xff, 0x0 , 0x3f, 0xe7, 0xa5, 
-	0x5a, 0x8c, 0x92, 0xf , 0xf9, 0xcd, 0x55, 0x6c, 0x26, 0x54, 0x1 , 0xb7, 0x3b, 
-	0x87, 0xf5, 0xfd, 0x6a, 0x54, 0x7d, 0xad, 0xed, 0xc5, 0x54, 0x95, 0xf6, 0x32, 
-	0xc3, 0xca, 0xce, 0xcc, 0xb1, 0x19, 0xfd, 0x7f, 0x4a, 0x55, 0xca, 0x36, 0x1 , 
-	0xe3, 0xd3, 0xd2, 0x93, 0x18, 0x1b, 0x87, 0x43, 0xd6, 0x97, 0xb7, 0x3f, 0x81, 
-	0xac, 0x8f, 0x52, 0x3b, 0x2e, 0xe3, 0xa4, 0x53, 0xb3, 0x2b, 0xdb, 0xd3, 0xd2, 
-	0xa5, 0xb6, 0x0 , 0xae, 0x3 , 0x64, 0x63, 0x9c, 0xd4, 0xa , 0xce, 0x87, 0xb , 
-	0xce, 0xde, 0xa0, 0xd4, 0xb6, 0xef, 0x9c, 0xe4, 0x77, 0xe2, 0xa5, 0xa7, 0x63, 
-	0x58, 0x4a, 0x3c, 0xda, 0x96, 0x16, 0x45, 0x55, 0x28, 0xf , 0x7e, 0xe , 0x6a, 
-	0x78, 0x48, 0x72, 0xa7, 0x8f, 0xc4, 0xf5, 0xaa, 0xab, 0x8 , 0x71, 0xdf, 0xd8, 
-	0xd4, 0xd1, 0xae, 0x17, 0x19, 0x27, 0x1d, 0x16, 0x9c, 0x24, 0xe3, 0xd0, 0xc7, 
-	0x13, 0x46, 0x9d, 0x7d, 0x65, 0x3b, 0x7a, 0x32, 0xe0, 0x28, 0xe , 0x2 , 0x73, 
-	0xdc, 0x67, 0x8f, 0xce, 0xa6, 0x84, 0xc , 0x83, 0x9c, 0x55, 0x7b, 0x67, 0x67, 
-	0x38, 0x4 , 0x20, 0x51, 0xf5, 0xfe, 0x55, 0x6e, 0x13, 0x11, 0x6c, 0x79, 0xa9, 
-	0x9f, 0x5e, 0x98, 0xae, 0xca, 0x58, 0x88, 0xdf, 0xde, 0x8d, 0x8f, 0x9b, 0xc6, 
-	0x65, 0x35, 0x5a, 0xfd, 0xd5, 0x6e, 0x66, 0xfb, 0xb6, 0xbe, 0xee, 0x82, 0xe0, 
-	0xf , 0x53, 0x4f, 0x50, 0x3a, 0xf1, 0x4f, 0x8e, 0x18, 0x5f, 0x93, 0x28, 0x1e, 
-	0xf5, 0x3f, 0xd8, 0x94, 0x8f, 0x96, 0xea, 0x23, 0xf5, 0x60, 0x2b, 0xd1, 0x86, 
-	0x2a, 0x8b, 0x3e, 0x5f, 0x11, 0x93, 0x63, 0xa2, 0xdd, 0xd5, 0xfe, 0x6b, 0xfc, 
-	0xca, 0xf9, 0xfa, 0xd1, 0xf8, 0xd4, 0xb2, 0x5b, 0x30, 0x1c, 0xcd, 0x11, 0xfa, 
-	0x3e, 0x73, 0x50, 0xca, 0xe1, 0x3b, 0x6e, 0xfa, 0x57, 0x4c, 0x6b, 0x42, 0x5b, 
-	0x33, 0xc9, 0xa9, 0x83, 0xaf, 0xf , 0x8a, 0x23, 0xbf, 0x1a, 0x4c, 0xfb, 0xd3, 
-	0x51, 0xb7, 0x1f, 0xbb, 0x8f, 0xad, 0x29, 0xad, 0x77, 0x39, 0x5a, 0xb0, 0x51, 
-	0x4a, 0x45, 0x25, 0x30, 0xa , 0x28, 0xa2, 0x80, 0x1b, 0x45, 0x14, 0x50, 0x1 , 
-	0x48, 0xd4, 0xa6, 0x93, 0xad, 0x0 , 0x4 , 0xd2, 0x51, 0x45, 0x0 , 0x1f, 0x8d, 
-	0x1f, 0x8d, 0x1f, 0x85, 0x1f, 0x85, 0x0 , 0x25, 0x23, 0x52, 0x9e, 0xd , 0x25, 
-	0x0 , 0x14, 0x84, 0x52, 0xd2, 0x31, 0xc5, 0x2 , 0x12, 0x8a, 0x28, 0xa0, 0x2c, 
-	0x37, 0x14, 0x52, 0xb5, 0x25, 0x0 , 0x14, 0x7e, 0x34, 0x51, 0xf8, 0x50, 0x2 , 
-	0x37, 0xd6, 0x92, 0x95, 0xbe, 0x94, 0x94, 0x0 , 0x52, 0x35, 0x2d, 0x23, 0x50, 
-	0x21, 0x29, 0x1a, 0x96, 0x91, 0xa9, 0x80, 0x94, 0x7e, 0x34, 0x51, 0xf8, 0x53, 
-	0x1 , 0x1b, 0xeb, 0x49, 0x4a, 0xdf, 0x4a, 0x4a, 0x0 , 0x46, 0xa4, 0xa5, 0x6a, 
-	0x4a, 0x0 , 0x46, 0xa4, 0xa5, 0x6a, 0x4a, 0x0 , 0x3f, 0x1a, 0x3f, 0x1a, 0x28, 
-	0xfc, 0x28, 0x1 , 0xb4, 0x51, 0x45, 0x3 , 0x1b, 0x48, 0x45, 0x2d, 0x14, 0xc4, 
-	0x36, 0x8f, 0xc6, 0x8a, 0x3f, 0xa , 0x60, 0x26, 0x7d, 0xe9, 0x7f, 0x1a, 0x4c, 
-	0x7b, 0x52, 0xfe, 0x15, 0x25, 0x85, 0x18, 0xa2, 0x95, 0x68, 0x18, 0xb4, 0xab, 
-	0x48, 0x29, 0xd4, 0xb , 0x50, 0x5a, 0x77, 0xe3, 0x4d, 0x5a, 0x77, 0xe1, 0x40, 
-	0x7 , 0xe3, 0x45, 0x14, 0x50, 0x31, 0xd4, 0x62, 0x8a, 0x55, 0xa0, 0x42, 0xd2, 
-	0xaf, 0xd6, 0x92, 0x95, 0x7e, 0x94, 0x0 , 0xbf, 0x8d, 0x14, 0x7e, 0x14, 0x52, 
-	0x18, 0x53, 0x85, 0x22, 0xd2, 0xd2, 0x0 , 0xa7, 0xa , 0x31, 0x45, 0x0 , 0x2a, 
-	0xd2, 0xfe, 0x34, 0x82, 0x97, 0xf0, 0xa0, 0x2 , 0x8a, 0x28, 0xa0, 0x41, 0x4e, 
-	0x14, 0x62, 0x8a, 0x6 , 0x2a, 0xd2, 0xd1, 0x8a, 0x28, 0x0 , 0x14, 0xb4, 0x63, 
-	0xda, 0x97, 0xf0, 0xa0, 0x3 , 0xf1, 0xa3, 0xf1, 0xa2, 0x8a, 0x4 , 0x14, 0x51, 
-	0x4a, 0x5 , 0x3 , 0x16, 0x8a, 0x28, 0xa0, 0x5 , 0xc5, 0x28, 0xa2, 0x8a, 0x0 , 
-	0x28, 0xa2, 0x94, 0xa , 0x0 , 0x5f, 0xc6, 0x8f, 0xc6, 0x8f, 0xc2, 0x8f, 0xc2, 
-	0x82, 0x43, 0xf1, 0xa4, 0x6c, 0x81, 0x4b, 0x8c, 0x76, 0xa6, 0xb6, 0x3a, 0x9e, 
-	0x40, 0xe8, 0x7 , 0x7a, 0x4c, 0xa5, 0xb9, 0xd , 0xc4, 0x8e, 0x14, 0x91, 0xb8, 
-	0x7a, 0x56, 0x65, 0xc4, 0xe7, 0x76, 0xe6, 0xdc, 0x73, 0xd3, 0x23, 0xad, 0x5e, 
-	0xba, 0x60, 0xec, 0x55, 0xc8, 0xd8, 0xbf, 0xeb, 0x8 , 0xef, 0xfe, 0xc8, 0xa4, 
-	0x8c, 0x65, 0xbc, 0xc6, 0x5c, 0x1 , 0xd0, 0x63, 0xee, 0x8f, 0xe9, 0x58, 0x4a, 
-	0x2d, 0xec, 0xce, 0xda, 0x75, 0xa2, 0x96, 0xb1, 0xb9, 0x89, 0x71, 0xa8, 0x4 , 
-	0x6c, 0xbf, 0xcd, 0x8e, 0x82, 0xb1, 0x35, 0x6b, 0x89, 0x6f, 0xe7, 0xdc, 0xd9, 
-	0x2a, 0xbc, 0x5 , 0x5e, 0xd5, 0xa7, 0xe2, 0x2b, 0xb1, 0x79, 0x75, 0xf6, 0x38, 
-	0x9d, 0x52, 0x15, 0x3f, 0xbe, 0x91, 0x40, 0xcf, 0xfb, 0xa3, 0xd4, 0xd5, 0x4b, 
-	0xcb, 0xa1, 0x1d, 0xb8, 0x86, 0x34, 0xf2, 0x61, 0x5e, 0x80, 0x8c, 0xc8, 0xff, 
-	0x0 , 0xe1, 0x58, 0x4a, 0xfd, 0xce, 0xfa, 0x4e, 0xa , 0xcf, 0x92, 0xd7, 0x33, 
-	0x66, 0x9e, 0x65, 0xb7, 0x10, 0x22, 0x14, 0x41, 0xdb, 0x1f, 0xad, 0x53, 0x91, 
-	0xdc, 0xf0, 0xef, 0xd3, 0xb5, 0x59, 0x9a, 0x72, 0xff, 0x0 , 0xc1, 0x8f, 0x72, 
-	0x79, 0xa8, 0x57, 0xf7, 0x99, 0x1b, 0x79, 0xa9, 0xbb, 0x35, 0x71, 0x8b, 0x7a, 
-	0x15, 0xc8, 0x63, 0x40, 0x53, 0x56, 0xe3, 0xb3, 0x99, 0xb9, 0x64, 0xd8, 0xb8, 
-	0xce, 0xe3, 0xd3, 0x14, 0xdb, 0x84, 0x85, 0x33, 0xe5, 0x49, 0xbf, 0xf4, 0xab, 
-	0x31, 0xb4, 0x6f, 0xb9, 0x5f, 0x7 , 0xd6, 0xa3, 0x6e, 0x5b, 0x3 , 0xa5, 0x39, 
-	0x98, 0xee, 0xc7, 0x4a, 0x15, 0x7f, 0x95, 0x34, 0x67, 0x2d, 0x5e, 0x81, 0xb8, 
-	0x5 , 0xc6, 0xc5, 0xa0, 0xb4, 0x5d, 0xe3, 0x3e, 0xbf, 0x7a, 0x9a, 0xc7, 0x27, 
-	0x14, 0xd3, 0xcf, 0x27, 0x2 , 0x9d, 0x8c, 0xe5, 0x22, 0x48, 0xdc, 0xa6, 0xe6, 
-	0x55, 0xf9, 0x9b, 0xe5, 0x1c, 0x9a, 0xbd, 0xc , 0xd2, 0x88, 0xc0, 0xe , 0x40, 
-	0x1c, 0xf0, 0x6b, 0x3a, 0x30, 0x5a, 0x45, 0x51, 0xd8, 0xe4, 0xd5, 0xe0, 0x3e, 
-	0x53, 0x8f, 0x4c, 0x54, 0xc9, 0x23, 0xab, 0x8 , 0xe5, 0xab, 0xe8, 0x2b, 0x33, 
-	0x31, 0x25, 0x8e, 0x4b, 0x75, 0xa4, 0x5f, 0xbd, 0xec, 0x79, 0x3f, 0x4a, 0x60, 
-	0x3f, 0x2b, 0x11, 0xf4, 0x14, 0xbd, 0xb1, 0xdf, 0x18, 0xff, 0x0 , 0x3f, 0x95, 
-	0x49, 0xd1, 0xcd, 0x7d, 0x49, 0x17, 0xf7, 0x9f, 0x33, 0x6c, 0x1f, 0xa7, 0x14, 
-	0x4f, 0x94, 0x1c, 0x1 , 0xed, 0xf3, 0xd1, 0x8c, 0x60, 0x7e, 0x26, 0xab, 0x4a, 
-	0xc5, 0xe5, 0xf6, 0x15, 0x2b, 0x56, 0x15, 0x25, 0xc9, 0x1f, 0x36, 0x3e, 0x35, 
-	0x75, 0x4c, 0x9e, 0xa7, 0xd5, 0xba, 0xa , 0x74, 0x2b, 0x99, 0x3 , 0x31, 0x18, 
-	0x5e, 0x80, 0x52, 0x60, 0x85, 0x19, 0x1c, 0x9e, 0x82, 0xa7, 0xb7, 0x41, 0x8e, 
-	0x6 , 0xea, 0x24, 0xec, 0x2a, 0x30, 0xbb, 0x48, 0x7c, 0x21, 0xdf, 0x9c, 0x93, 
-	0xed, 0xfe, 0x7b, 0x56, 0x85, 0x8c, 0x1c, 0x79, 0x8d, 0xf7, 0x7b, 0x7a, 0xd4, 
-	0x76, 0xb6, 0xc5, 0xd7, 0x73, 0x64, 0x47, 0x9e, 0xa0, 0x7d, 0xe3, 0xed, 0xed, 
-	0x57, 0x98, 0x33, 0xae, 0xf , 0xcb, 0x18, 0xe3, 0x2 , 0xb8, 0xea, 0xd4, 0xd6, 
-	0xc7, 0xd0, 0x60, 0xf0, 0xd6, 0x5c, 0xd2, 0x43, 0x17, 0x2e, 0xd8, 0x41, 0xc6, 
-	0x38, 0xa6, 0x36, 0xd1, 0xf7, 0x1b, 0xeb, 0x27, 0xa9, 0xf6, 0xa7, 0x4d, 0x20, 
-	0xd9, 0xb0, 0x7c, 0xaa, 0x3a, 0xe3, 0xbd, 0x44, 0xc1, 0x9b, 0xaf, 0x3 , 0xd3, 
-	0xd2, 0xa6, 0x9c, 0x5b, 0xf4, 0x37, 0xc4, 0x55, 0x8c, 0x34, 0xdd, 0x89, 0xc1, 
-	0x18, 0x3 , 0xb , 0x9e, 0x9f, 0xe2, 0x7b, 0xd0, 0xb1, 0xe5, 0x4e, 0x7 , 0xd4, 
-	0x9e, 0xff, 0x0 , 0x4a, 0x95, 0x53, 0xdb, 0xf0, 0xab, 0x36, 0xb0, 0x19, 0x1b, 
-	0x24, 0x67, 0x15, 0xd9, 0x1a, 0x76, 0x47, 0x91, 0x2a, 0xae, 0x72, 0xdc, 0x8e, 
-	0xde, 0xdc, 0xb6, 0x8 , 0x5e, 0xf8, 0x51, 0x5d, 0x7 , 0x87, 0x74, 0x81, 0x3c, 
-	0x8a, 0xd2, 0x1 , 0xb4, 0x1e, 0x83, 0xb9, 0xa3, 0x4a, 0xb1, 0x2c, 0xca, 0x31, 
-	0xf3, 0x77, 0x3e, 0x95, 0xd7, 0x68, 0x36, 0x61, 0xa , 0xaf, 0x0 , 0x63, 0xd3, 
-	0xa5, 0x57, 0x2f, 0x59, 0x1c, 0xb5, 0x71, 0x1f, 0x62, 0xc , 0xbb, 0xa1, 0xe9, 
-	0xea, 0x30, 0x2 , 0xe3, 0xf0, 0xed, 0x5d, 0x66, 0x8b, 0x62, 0xa8, 0x8a, 0x3a, 
-	0xf3, 0x9e, 0x6a, 0x9e, 0x95, 0x6a, 0x6 , 0xdc, 0x56, 0xed, 0x8c, 0x7b, 0x57, 
-	0x4 , 0x1e, 0x39, 0xc1, 0xac, 0x64, 0xcc, 0xe0, 0xac, 0x69, 0x69, 0x70, 0x22, 
-	0xae, 0x4f, 0x5f, 0x5e, 0xf8, 0xad, 0x8b, 0x75, 0xcb, 0x2e, 0x7 , 0x35, 0x9d, 
-	0x62, 0xbb, 0x70, 0x46, 0x9 , 0xed, 0x8e, 0xf5, 0xa3, 0x8 , 0x72, 0xbd, 0x73, 
-	0x83, 0xc8, 0x6 , 0xb2, 0x67, 0x44, 0x4b, 0xd1, 0x0 , 0x39, 0xc7, 0x38, 0x19, 
-	0x22, 0xac, 0xc2, 0x37, 0x81, 0x83, 0x9e, 0x70, 0x16, 0xaa, 0x5b, 0x3a, 0xe3, 
-	0x5 , 0xb9, 0xc7, 0xa7, 0x5a, 0xb0, 0xad, 0x1a, 0x8d, 0xc7, 0xae, 0x71, 0xd7, 
-	0xa1, 0xff, 0x0 , 0x38, 0xa8, 0x36, 0x2d, 0x42, 0xe1, 0xc7, 0xdc, 0xda, 0xd9, 
-	0xec, 0x2a, 0xc2, 0xa9, 0xd , 0xb7, 0xf1, 0xe2, 0xa1, 0x89, 0x81, 0x2a, 0x54, 
-	0xa7, 0x5c, 0x7f, 0x3f, 0xf0, 0xa9, 0x94, 0x17, 0x50, 0x14, 0x85, 0xd , 0xc9, 
-	0xf4, 0xc7, 0xf9, 0xc5, 0x48, 0xd1, 0x24, 0x6d, 0x86, 0xdd, 0xd5, 0xb2, 0x70, 
-	0x7 , 0x5a, 0x9d, 0xf , 0xef, 0x37, 0x3 , 0xc6, 0x73, 0xf8, 0xd5, 0x15, 0x7c, 
-	0x26, 0x48, 0xa , 0x49, 0xf4, 0xef, 0x53, 0xdb, 0xb8, 0x55, 0xea, 0x0 , 0x27, 
-	0x90, 0x78, 0xfc, 0xa8, 0x19, 0x71, 0x5b, 0x69, 0xe3, 0x90, 0xdc, 0xf4, 0xe9, 
-	0x53, 0x42, 0xfe, 0x53, 0x6 , 0x2a, 0x36, 0x93, 0x8d, 0xc6, 0xab, 0x31, 0xc4, 
-	0x6c, 0xa8, 0x37, 0xae, 0x3a, 0x3 , 0xd2, 0x9f, 0x18, 0x53, 0xf2, 0x86, 0xc9, 
-	0xc7, 0x0 , 0x9e, 0x69, 0x30, 0x2f, 0x2e, 0xec, 0x6e, 0x56, 0xc7, 0x3c, 0xfa, 
-	0x74, 0xa9, 0xb7, 0x6d, 0x24, 0x13, 0xb7, 0xe5, 0xe8, 0x71, 0xeb, 0xef, 0x54, 
-	0xe1, 0x90, 0x5 , 0x0 , 0x37, 0x6e, 0x99, 0xfd, 0x73, 0xef, 0x52, 0x47, 0xf3, 
-	0x48, 0x7c, 0xc1, 0xf3, 0x63, 0xe6, 0xdd, 0xdb, 0xbf, 0xf5, 0xa8, 0x2 , 0xdc, 
-	0x92, 0xab, 0x2a, 0xb1, 0xca, 0x96, 0x3 , 0x23, 0xd2, 0xa4, 0x50, 0x55, 0x89, 
-	0x3c, 0xaf, 0xa8, 0xaa, 0xb6, 0xe5, 0xd3, 0x12, 0x75, 0xcf, 0xde, 0x1d, 0x7f, 
-	0x2a, 0xb7, 0xc , 0xb9, 0x50, 0xaa, 0x72, 0x72, 0x39, 0x1c, 0xe3, 0xeb, 0xe9, 
-	0x59, 0xb2, 0x46, 0xf9, 0x7b, 0x47, 0x46, 0x6e, 0x7b, 0x9e, 0x79, 0xed, 0x59, 
-	0xfa, 0xc4, 0x1 , 0xe0, 0x3d, 0xc9, 0x0 , 0x7f, 0x87, 0x15, 0xa8, 0x23, 0x7d, 
-	0xa4, 0xa3, 0x9d, 0xb9, 0x3c, 0xb1, 0x27, 0xbf, 0xe9, 0x55, 0xee, 0x20, 0xd , 
-	0x1a, 0xa0, 0xc8, 0xc9, 0x39, 0xf7, 0xfc, 0x7b, 0x52, 0x3 , 0xc7, 0x3e, 0x24, 
-	0xe9, 0xb , 0xe4, 0xca, 0xcf, 0x19, 0x52, 0xd9, 0x1c, 0x57, 0xcf, 0x3e, 0x32, 
-	0xb1, 0x31, 0xdc, 0xba, 0xe0, 0xc , 0x13, 0x5f, 0x5b, 0xfc, 0x40, 0xd2, 0xcc, 
-	0xb6, 0x8c, 0x47, 0x19, 0x4 , 0xf1, 0xcf, 0x4f, 0xaf, 0xf9, 0xe2, 0xbe, 0x74, 
-	0xf8, 0x9d, 0xa6, 0x79, 0x77, 0x52, 0xb2, 0xaf, 0x73, 0x8c, 0xa , 0xeb, 0xc3, 
-	0xca, 0xcc, 0xe4, 0xc5, 0x53, 0xbc, 0x6e, 0x78, 0xed, 0xe0, 0xdb, 0x70, 0xca, 
-	0xf , 0xd , 0xfc, 0xeb, 0x35, 0xc1, 0x8e, 0xe9, 0x86, 0x70, 0xae, 0x31, 0x9f, 
-	0x43, 0xdb, 0xf5, 0x15, 0xbb, 0xaf, 0x41, 0xb2, 0x4c, 0x80, 0x7d, 0xfd, 0xab, 
-	0x17, 0x50, 0x19, 0x1b, 0xb1, 0xd3, 0xad, 0x7a, 0x7 , 0x9d, 0x19, 0x69, 0xe6, 
-	0x9d, 0xff, 0x0 , 0xcc, 0xb5, 0xa1, 0xdc, 0xf , 0x34, 0xc1, 0x8f, 0x95, 0x8e, 
-	0xe5, 0xff, 0x0 , 0x65, 0xb3, 0xc8, 0xfc, 0xff, 0x0 , 0x9d, 0x6b, 0x28, 0xf3, 
-	0x2d, 0xda, 0x32, 0x7e, 0x64, 0xe0, 0xfd, 0xd , 0x73, 0x3e, 0x61, 0x8a, 0x65, 
-	0x9c, 0x65, 0x91, 0xb9, 0x6c, 0x76, 0x35, 0xbb, 0x6b, 0x3a, 0xbc, 0x91, 0xca, 
-	0x1b, 0x2b, 0x27, 0xc8, 0xc4, 0x7f, 0x7a, 0xb8, 0xf1, 0x14, 0xf5, 0xe6, 0x47, 
-	0xd4, 0x65, 0x38, 0xb8, 0xb8, 0x3a, 0x53, 0x7b, 0x7e, 0x4c, 0x48, 0x4b, 0x2f, 
-	0x43, 0x8d, 0x8d, 0x92, 0x3e, 0xbd, 0x6a, 0xed, 0xbb, 0x1f, 0x31, 0x94, 0xff, 
-	0x0 , 0x16, 0x30, 0x6a, 0xa5, 0xda, 0xf9, 0x77, 0x1b, 0xc7, 0x21, 0xc5, 0x4a, 
-	0x8e, 0x42, 0x86, 0xeb, 0xb7, 0xf5, 0x15, 0xcf, 0x2d, 0x55, 0xcf, 0x52, 0x87, 
-	0xee, 0xe6, 0xe3, 0xdb, 0xfa, 0xfc, 0x8b, 0x33, 0x0 , 0xd9, 0x56, 0xe8, 0x47, 
-	0x3f, 0x51, 0x4d, 0xb5, 0x6f, 0x9b, 0x6b, 0x77, 0x15, 0x32, 0xb2, 0xb6, 0x18, 
-	0x7f, 0x10, 0xe7, 0xd8, 0xd5, 0x56, 0x1e, 0x5c, 0xdb, 0x47, 0x4c, 0xe4, 0x7e, 
-	0x15, 0x92, 0xd5, 0x58, 0xed, 0x9f, 0xb9, 0x25, 0x31, 0x97, 0x40, 0x87, 0xf9, 
-	0x47, 0xdd, 0xe7, 0xe9, 0x42, 0xb6, 0x57, 0x6f, 0xaf, 0x2a, 0x6a, 0x7b, 0xa4, 
-	0x25, 0x7c, 0xd0, 0x33, 0xec, 0x3a, 0xf1, 0x55, 0xd9, 0x3e, 0x51, 0xb7, 0xa6, 
-	0x72, 0x3f, 0xad, 0x5c, 0x5a, 0x68, 0xe6, 0xa9, 0x19, 0x42, 0xa3, 0x2c, 0x5a, 
-	0x39, 0x29, 0xb0, 0x9c, 0x71, 0xfe, 0x45, 0x1b, 0x8c, 0x6d, 0xd3, 0x8f, 0x7a, 
-	0x82, 0x17, 0x1 , 0xb6, 0x9e, 0xa3, 0xbd, 0x5b, 0xda, 0x26, 0x5c, 0x83, 0xc8, 
-	0xea, 0x3d, 0x6b, 0x39, 0x2b, 0x33, 0xb2, 0x8c, 0x9d, 0x48, 0x2e, 0x57, 0xaa, 
-	0x1 , 0x87, 0x0 , 0x8e, 0x9d, 0xbd, 0x47, 0xd6, 0xa4, 0x85, 0x8a, 0xc8, 0x37, 
-	0xc , 0x8e, 0xe0, 0x55, 0x55, 0xdc, 0xbc, 0xc , 0x8f, 0xa5, 0x4d, 0xb , 0x96, 
-	0xf9, 0x58, 0xf , 0x62, 0x29, 0x34, 0x6d, 0x9 , 0xa9, 0x68, 0xf4, 0x66, 0x8c, 
-	0x77, 0x5 , 0x71, 0xb5, 0x46, 0x73, 0xf7, 0xb1, 0x56, 0x96, 0x44, 0x7f, 0xbc, 
-	0x0 , 0x2c, 0x39, 0x24, 0x56, 0x4a, 0x17, 0x53, 0xf2, 0x13, 0xf4, 0x35, 0x76, 
-	0xde, 0xe1, 0xc2, 0x8d, 0xd0, 0xb1, 0xfa, 0x73, 0x5b, 0x52, 0xa9, 0x8 , 0xfc, 
-	0x47, 0x99, 0x8e, 0xc1, 0xe2, 0x2a, 0x59, 0xd1, 0x76, 0x7e, 0xb6, 0x2c, 0xc6, 
-	0x25, 0xdb, 0xcb, 0xee, 0x1f, 0xdd, 0x3e, 0x95, 0x2a, 0xa4, 0x7b, 0x7e, 0x65, 
-	0x2a, 0x6a, 0x38, 0x66, 0x8c, 0x93, 0xfb, 0x99, 0xb , 0x7f, 0xb9, 0x8a, 0xb0, 
-	0x8b, 0x2c, 0x8b, 0x80, 0x4 , 0x63, 0xd0, 0x8a, 0xeb, 0xa7, 0x5a, 0x9f, 0x63, 
-	0xc4, 0xc5, 0xe0, 0x31, 0x8b, 0xed, 0x59, 0x75, 0x77, 0xd0, 0x68, 0x28, 0x9d, 
-	0x3f, 0x4a, 0x92, 0x15, 0x27, 0x93, 0xde, 0x9d, 0x1c, 0x30, 0xc7, 0xf7, 0xb0, 
-	0xc7, 0xd4, 0x9a, 0x73, 0x4 , 0xe8, 0xa3, 0xf4, 0xae, 0xea, 0x7a, 0xee, 0x8f, 
-	0x99, 0xc5, 0x5e, 0x9 , 0xa8, 0xcd, 0xb5, 0xde, 0xe1, 0xc6, 0x30, 0x39, 0xa3, 
-	0x0 , 0x51, 0x8f, 0xc2, 0x94, 0xf , 0xc6, 0xba, 0x8f, 0x26, 0x4f, 0xcc, 0xf , 
-	0xd6, 0x81, 0xf5, 0xa0, 0xfd, 0x28, 0x1f, 0x4a, 0x64, 0x89, 0x45, 0x14, 0x53, 
-	0x0 , 0xa4, 0x22, 0x96, 0x8a, 0x0 , 0x6d, 0x14, 0x51, 0x40, 0x8 , 0xd4, 0x94, 
-	0xe3, 0xcd, 0x34, 0xd0, 0x1 , 0x45, 0x14, 0x50, 0x1 , 0x47, 0xe3, 0x45, 0x1f, 
-	0x85, 0x0 , 0x27, 0xe3, 0x48, 0x69, 0x71, 0xed, 0x48, 0x68, 0x0 , 0xa2, 0x8a, 
-	0x28, 0x1 , 0xb4, 0x51, 0x45, 0x0 , 0x36, 0x8a, 0x28, 0xa0, 0x2 , 0x8f, 0xc6, 
-	0x8a, 0x3f, 0xa , 0x0 , 0x46, 0xfa, 0xd2, 0x52, 0xb7, 0xd2, 0x92, 0x80, 0x11, 
-	0xa9, 0x29, 0xd4, 0xd3, 0x40, 0x84, 0x6a, 0x4a, 0x56, 0xa4, 0xa0, 0x2 , 0x8f, 
-	0xc6, 0x8a, 0x3f, 0xa , 0xa0, 0x13, 0xf1, 0xa4, 0x34, 0xad, 0xf4, 0xa4, 0xa0, 
-	0x0 , 0xd3, 0x69, 0xc6, 0x9b, 0x40, 0x8 , 0x4d, 0x25, 0x29, 0x14, 0x94, 0x0 , 
-	0x7e, 0x34, 0x7e, 0x34, 0x7e, 0x14, 0x7e, 0x14, 0x0 , 0xda, 0x28, 0xa2, 0x81, 
-	0xd , 0xa4, 0x6a, 0x5a, 0x46, 0xa0, 0x76, 0x12, 0x8f, 0xc6, 0x8a, 0x3f, 0xa , 
-	0xa0, 0xf , 0xc6, 0x8a, 0x3f, 0xa , 0x2a, 0x4a, 0x15, 0x69, 0x69, 0x16, 0x96, 
-	0x80, 0x14, 0xa , 0x5a, 0x29, 0x40, 0xa0, 0x5 , 0xfc, 0x68, 0xa3, 0xf0, 0xa2, 
-	0x80, 0xd4, 0x29, 0x57, 0xa5, 0x25, 0x2a, 0xf4, 0xa0, 0x7 , 0x2d, 0x2d, 0x22, 
-	0xd2, 0xd0, 0x30, 0x5a, 0x77, 0xe3, 0x49, 0x8f, 0x6a, 0x5f, 0xc2, 0x81, 0x7 , 
-	0xe3, 0x46, 0x28, 0xa2, 0xa4, 0x63, 0xa8, 0xc5, 0x14, 0xab, 0x40, 0xb , 0x45, 
-	0x14, 0xab, 0xf4, 0xa0, 0x5 , 0xfc, 0x68, 0xa3, 0xf0, 0xa2, 0x80, 0xa , 0x55, 
-	0xa4, 0x14, 0xea, 0x0 , 0x28, 0xa2, 0x94, 0xa , 0x0 , 0x5a, 0x28, 0xa5, 0x2 , 
-	0x81, 0x20, 0x1f, 0x5a, 0x5f, 0xc6, 0x8f, 0xc2, 0x8f, 0xc2, 0x81, 0x85, 0x14, 
-	0x51, 0x40, 0x85, 0x5a, 0x5a, 0x31, 0x45, 0x3 , 0xa , 0x5e, 0x94, 0x2d, 0x2e, 
-	0x28, 0x0 , 0xa5, 0x14, 0x94, 0xa0, 0x50, 0x26, 0x2f, 0xe3, 0x47, 0xe3, 0x47, 
-	0xe1, 0x47, 0xe1, 0x40, 0xc3, 0xf1, 0xa3, 0xf1, 0xa3, 0xf0, 0xa2, 0x81, 0x5 , 
-	0x57, 0xba, 0x93, 0xa , 0xa , 0xfd, 0xe3, 0x90, 0x99, 0x1d, 0x3d, 0x5b, 0xf0, 
-	0xa9, 0xa6, 0x6c, 0x2e, 0xd1, 0xd4, 0xd5, 0x39, 0x32, 0x5b, 0xa , 0x9 , 0x79, 
-	0x3a, 0x63, 0xb2, 0xa , 0x96, 0x5c, 0x57, 0x50, 0xb7, 0x8c, 0xc8, 0xfb, 0x98, 
-	0xfc, 0x91, 0xf4, 0x27, 0xf5, 0xac, 0xdf, 0x14, 0x6a, 0x65, 0x23, 0x8e, 0xc6, 
-	0xc9, 0x49, 0x9a, 0x6e, 0x23, 0xc7, 0xfe, 0x85, 0x5a, 0x97, 0x8d, 0x14, 0x36, 
-	0xad, 0x24, 0xdf, 0xea, 0x61, 0x5c, 0xec, 0x5e, 0x8d, 0x8e, 0x83, 0xde, 0xb8, 
-	0xcb, 0x6f, 0xb6, 0x6a, 0x17, 0x57, 0x17, 0xe5, 0xfc, 0xb5, 0x91, 0xb6, 0xf9, 
-	0x84, 0xe1, 0xb1, 0xfd, 0xd5, 0x27, 0xa7, 0x1d, 0x4f, 0x60, 0x2b, 0x39, 0xca, 
-	0xda, 0x1d, 0x34, 0x61, 0xcc, 0xdc, 0x9f, 0x40, 0x92, 0x68, 0x6c, 0x71, 0x6b, 
-	0x64, 0xbf, 0x6a, 0xbc, 0x27, 0xe7, 0x94, 0xf2, 0x14, 0xf7, 0xc5, 0x50, 0xd4, 
-	0x2d, 0x65, 0x89, 0x4c, 0xd7, 0x92, 0x31, 0x9a, 0x4e, 0x8a, 0x4d, 0x6b, 0x43, 
-	0x6f, 0xe , 0x95, 0x62, 0xd7, 0x2c, 0x81, 0x99, 0xb8, 0x40, 0x7e, 0xf3, 0x9f, 
-	0xa7, 0x50, 0xbe, 0xe6, 0xa9, 0x5b, 0xdb, 0xdc, 0x5f, 0x4a, 0xd7, 0x77, 0x45, 
-	0x99, 0x7a, 0xb1, 0x23, 0x0 , 0xf , 0xc7, 0x81, 0x58, 0xee, 0x75, 0xab, 0xad, 
-	0x5e, 0xc5, 0x3b, 0x78, 0xe6, 0x9e, 0x30, 0x48, 0xc4, 0x6a, 0x70, 0xf , 0x41, 
-	0x9f, 0xeb, 0x57, 0xe3, 0x8a, 0xda, 0xd9, 0x43, 0xc9, 0x18, 0x91, 0xb8, 0xdb, 
-	0x93, 0xb5, 0x7f, 0x13, 0xd4, 0xd4, 0x97, 0xb3, 0xb , 0x65, 0xc2, 0xc3, 0xb3, 
-	0xe5, 0x1c, 0xb7, 0x5c, 0x76, 0x20, 0x76, 0x1f, 0x5a, 0xc8, 0xb9, 0xbb, 0x96, 
-	0x49, 0x77, 0x9c, 0x48, 0xb9, 0xff, 0x0 , 0x3c, 0x54, 0xda, 0xc5, 0x46, 0x5c, 
-	0xfb, 0xbd, 0xb , 0x77, 0x77, 0x5f, 0x69, 0xca, 0x92, 0x38, 0xec, 0xbc, 0x1 , 
-	0xf8, 0x76, 0xac, 0xf9, 0xa0, 0x91, 0x5b, 0x72, 0x9c, 0x8f, 0x4f, 0x4a, 0x72, 
-	0x6c, 0x27, 0x3b, 0x4a, 0x9e, 0xc3, 0x3c, 0x55, 0x84, 0x9d, 0x37, 0x0 , 0xf9, 
-	0x5f, 0xaf, 0xf8, 0x8a, 0xcd, 0xf3, 0x2d, 0x8e, 0xd5, 0x18, 0x54, 0x4b, 0x9f, 
-	0x42, 0x9a, 0xe3, 0x1c, 0xd4, 0x91, 0x8d, 0xac, 0xa , 0x9f, 0x94, 0xf4, 0x3e, 
-	0x9f, 0x5a, 0xb1, 0x71, 0x6c, 0xb2, 0x2e, 0xe5, 0x3f, 0x88, 0xa8, 0x62, 0x86, 
-	0x54, 0x6c, 0xa6, 0x58, 0x74, 0x3b, 0x48, 0xff, 0x0 , 0x26, 0x9a, 0x92, 0x68, 
-	0x99, 0xd1, 0xa9, 0x7 , 0xb7, 0xcc, 0x76, 0xa1, 0xa7, 0x49, 0x14, 0x5f, 0x69, 
-	0x8d, 0x77, 0x44, 0xdd, 0x76, 0x9c, 0xed, 0xff, 0x0 , 0xeb, 0x56, 0x79, 0xcf, 
-	0xa5, 0x74, 0x5a, 0x2d, 0xfc, 0x70, 0x3a, 0xc5, 0x72, 0x8c, 0x61, 0xcf, 0x2c, 
-	0x3f, 0x87, 0xd7, 0x23, 0xfa, 0x56, 0xdc, 0xde, 0xb , 0xb6, 0xd5, 0xed, 0xbe, 
-	0xd5, 0xa3, 0xdd, 0xc6, 0xae, 0xc3, 0x3b, 0x1b, 0xee, 0x37, 0xd3, 0xba, 0xfe, 
-	0xb4, 0x95, 0x5e, 0x5f, 0x88, 0xa9, 0xe0, 0x3d, 0xb2, 0xe6, 0xa1, 0xbf, 0x6f, 
-	0xf2, 0x38, 0x8b, 0x24, 0x3b, 0xb7, 0x7e, 0x55, 0x62, 0x56, 0xc4, 0x58, 0x7 , 
-	0xa9, 0xc5, 0x6b, 0x5c, 0x78, 0x7e, 0xff, 0x0 , 0x4c, 0x98, 0x8b, 0xfb, 0x46, 
-	0x55, 0x1f, 0xc7, 0xfc, 0x3f, 0x9f, 0x4a, 0x69, 0xd2, 0x3c, 0xe6, 0xd , 0xb4, 
-	0xaa, 0xe3, 0xe5, 0xf9, 0xb1, 0xcf, 0xe3, 0xd6, 0x87, 0x52, 0x2d, 0xdc, 0xba, 
-	0x78, 0x5a, 0x90, 0x87, 0x22, 0x5a, 0x99, 0x51, 0x81, 0xb0, 0x1 , 0x52, 0x47, 
-	0xd3, 0x27, 0xd6, 0xb4, 0xdb, 0x45, 0x99, 0x3e, 0xea, 0x48, 0x78, 0xe3, 0xa5, 
-	0x2b, 0x69, 0x12, 0xc7, 0x18, 0x2e, 0x92, 0x70, 0x3b, 0x60, 0xd6, 0x6e, 0xb4, 
-	0x3b, 0x9d, 0x74, 0xf0, 0x35, 0xbf, 0x94, 0xc8, 0xb8, 0x6d, 0xa9, 0xc1, 0xeb, 
-	0xd6, 0x99, 0x12, 0x10, 0x3 , 0x30, 0xff, 0x0 , 0x74, 0x56, 0xa0, 0xd2, 0xdb, 
-	0xce, 0x1b, 0xa3, 0x9b, 0x1e, 0xa5, 0x47, 0xf8, 0xd5, 0xdb, 0x5d, 0x1e, 0x3d, 
-	0xdb, 0xe4, 0x62, 0x31, 0xdb, 0x77, 0x23, 0xf2, 0xc5, 0x4b, 0xc4, 0x42, 0xb , 
-	0x71, 0xc3, 0x2c, 0xc4, 0xd6, 0x9e, 0xc6, 0x2d, 0xac, 0xe , 0xf2, 0xe3, 0x9f, 
-	0xf6, 0x9b, 0x1d, 0x3d, 0xab, 0x5a, 0xd6, 0xc5, 0x53, 0x6b, 0x48, 0x8 , 0x51, 
-	0xca, 0xa7, 0x76, 0xad, 0x18, 0x60, 0x86, 0xdd, 0x48, 0x8e, 0x25, 0x8c, 0x7a, 
-	0xff, 0x0 , 0x9e, 0xa7, 0xeb, 0x4d, 0x91, 0xc6, 0xdd, 0xce, 0xa , 0x46, 0x3a, 
-	0x13, 0xf7, 0x9b, 0xe9, 0x5c, 0xd5, 0x31, 0xe , 0x6f, 0x43, 0xd9, 0xc3, 0x65, 
-	0x74, 0xe8, 0x2b, 0xd4, 0x77, 0x7f, 0x81, 0x17, 0xcc, 0xcd, 0xfd, 0xdd, 0xbd, 
-	0x4f, 0xa7, 0xb0, 0xa8, 0xe6, 0x93, 0xe5, 0xc2, 0xf6, 0x1d, 0x1 , 0xa8, 0xee, 
-	0x6e, 0x77, 0x9c, 0xe0, 0x2a, 0xa8, 0xe0, 0x67, 0x81, 0xf5, 0xaa, 0xfe, 0x73, 
-	0x48, 0xfb, 0x13, 0x2c, 0x40, 0xc9, 0x50, 0x2a, 0xa9, 0xd0, 0x94, 0x8c, 0xf1, 
-	0x38, 0xfa, 0x54, 0xd3, 0x51, 0x77, 0x64, 0xcb, 0xc9, 0xc8, 0xff, 0x0 , 0xeb, 
-	0xf , 0xa5, 0x3e, 0x35, 0x7 , 0x1d, 0xfd, 0xe9, 0x90, 0xc6, 0x42, 0x8f, 0x31, 
-	0xba, 0xff, 0x0 , 0x8 , 0xfe, 0xb5, 0x6a, 0x14, 0xc9, 0xc0, 0x1d, 0x3a, 0xa , 
-	0xf4, 0xe9, 0x61, 0xd2, 0x57, 0x3e, 0x72, 0xbe, 0x32, 0x4d, 0xbb, 0xfd, 0xdf, 
-	0xd6, 0xc3, 0xed, 0xa1, 0xde, 0xc0, 0x1 , 0xd2, 0xb6, 0x74, 0xdb, 0x5d, 0xcc, 
-	0x0 , 0x1f, 0xa5, 0x53, 0xd3, 0xa1, 0x25, 0x87, 0xae, 0x6b, 0xa6, 0xd1, 0xed, 
-	0xb0, 0xa0, 0xe3, 0x27, 0xf9, 0x56, 0x92, 0x8d, 0x8e, 0x7f, 0x6b, 0xa5, 0xba, 
-	0xb2, 0xe6, 0x87, 0x63, 0x8c, 0xc , 0x75, 0xeb, 0x5d, 0x1e, 0x9b, 0x6b, 0xb7, 
-	0x5 , 0x6a, 0xae, 0x9b, 0x10, 0x56, 0xe0, 0x7e, 0x3e, 0x95, 0xb9, 0x62, 0x83, 
-	0x38, 0xcd, 0x73, 0xc9, 0x95, 0x4 , 0x5e, 0xd3, 0xc1, 0x40, 0x31, 0xc1, 0xed, 
-	0x5a, 0xb0, 0x5 , 0x5e, 0x73, 0xc9, 0xc7, 0x20, 0xf1, 0xd7, 0xad, 0x66, 0xa8, 
-	0x3c, 0x10, 0x31, 0xc6, 0x33, 0xeb, 0x57, 0xed, 0xa4, 0x2f, 0x1e, 0xd6, 0x1d, 
-	0x7b, 0x8a, 0xe7, 0x92, 0xb9, 0xd1, 0x13, 0x52, 0xd5, 0x80, 0xd , 0xcf, 0x5c, 
-	0xfa, 0x7e, 0x95, 0xa3, 0x69, 0x26, 0x4e, 0x7 , 0xae, 0x8 , 0x3d, 0x7e, 0xb5, 
-	0x93, 0x6c, 0x46, 0x78, 0x3c, 0xf7, 0xc7, 0x6a, 0xb9, 0x67, 0x2e, 0x18, 0x82, 
-	0x4f, 0x5c, 0xe0, 0x7b, 0x76, 0xac, 0xd9, 0xac, 0x59, 0xab, 0x18, 0x1b, 0xc6, 
-	0xd6, 0xc6, 0xe1, 0x90, 0x45, 0x4b, 0x19, 0x62, 0xd8, 0x63, 0xd0, 0xff, 0x0 , 
-	0x9e, 0x2a, 0xad, 0xbb, 0xe7, 0x85, 0xe3, 0x3 , 0x81, 0xd3, 0xf2, 0xa9, 0x96, 
-	0x45, 0xc9, 0x3d, 0x58, 0xf7, 0xcf, 0x6e, 0x95, 0x26, 0xa9, 0x97, 0x62, 0x94, 
-	0xa7, 0xdf, 0x20, 0x9c, 0x60, 0x90, 0x38, 0xcf, 0x3d, 0xff, 0x0 , 0xa , 0xb2, 
-	0xae, 0xaa, 0x0 , 0x4 , 0xe7, 0xae, 0x1 , 0xf7, 0xeb, 0x59, 0x6d, 0x38, 0x1c, 
-	0x1f, 0xbb, 0x8c, 0xe4, 0x9e, 0x9c, 0xd4, 0xd0, 0xdc, 0xc , 0xf5, 0xc6, 0x7a, 
-	0xf3, 0x9c, 0x73, 0x9a, 0x92, 0x8b, 0xd9, 0x21, 0x8e, 0x7a, 0x60, 0xfd, 0x73, 
-	0xed, 0x52, 0xda, 0x8d, 0xaa, 0xc5, 0xc0, 0x39, 0xed, 0x8e, 0xd5, 0x5b, 0xce, 
-	0x7 , 0x92, 0x7b, 0xe7, 0x19, 0xe9, 0xcd, 0x48, 0xb3, 0x8d, 0xd8, 0xdd, 0xbb, 
-	0x9e, 0xa3, 0xe9, 0xff, 0x0 , 0xd6, 0xa9, 0x2 , 0xfc, 0xd , 0xe6, 0xa6, 0xe1, 
-	0x91, 0x8e, 0x54, 0xff, 0x0 , 0x8d, 0x4b, 0x6e, 0x5d, 0x48, 0x66, 0x3 , 0x4 , 
-	0xf0, 0x33, 0xcd, 0x67, 0xa4, 0xc8, 0x52, 0x46, 0x52, 0x46, 0x7 , 0xdd, 0xc7, 
-	0x5f, 0x6c, 0x7e, 0x15, 0x35, 0xbc, 0xce, 0xd1, 0x2b, 0x67, 0xe6, 0x1d, 0x7b, 
-	0xe7, 0xe9, 0xf9, 0xd4, 0xb0, 0x34, 0x62, 0x7d, 0xb3, 0x60, 0x85, 0xc2, 0x81, 
-	0xd3, 0x8f, 0xca, 0x9e, 0x65, 0xf9, 0xb2, 0xdb, 0xb9, 0xf4, 0xef, 0xf8, 0xfa, 
-	0x55, 0x58, 0x66, 0x47, 0xd , 0xb8, 0xf2, 0x7 , 0x39, 0x15, 0x3e, 0xf5, 0x1 , 
-	0x14, 0x12, 0x7d, 0x80, 0xa9, 0x2 , 0xe8, 0x9f, 0x11, 0xb3, 0x2a, 0x96, 0x2b, 
-	0xca, 0x15, 0xf5, 0xfc, 0x78, 0xa7, 0x5a, 0xc9, 0xdc, 0x32, 0xb0, 0x27, 0xa8, 
-	0xc5, 0x53, 0x57, 0xda, 0xbb, 0x73, 0x86, 0x6e, 0x9f, 0xec, 0xd4, 0x96, 0xad, 
-	0xbf, 0xaa, 0xa8, 0xc3, 0x72, 0x46, 0x31, 0x9f, 0xc2, 0xa6, 0xc3, 0x2f, 0xab, 
-	0x93, 0x26, 0xce, 0x4f, 0x18, 0x3 , 0xd6, 0x9f, 0x6e, 0xbf, 0x33, 0x31, 0x7 , 
-	0x7f, 0xd2, 0xab, 0xc7, 0x2a, 0x85, 0xe4, 0xb3, 0x2f, 0x5e, 0x47, 0x19, 0x1f, 
-	0xfe, 0xaa, 0xb1, 0x63, 0x22, 0x4a, 0xcc, 0xc0, 0xb1, 0xca, 0x67, 0xdb, 0xd7, 
-	0xf3, 0xa9, 0x1d, 0xcc, 0xbf, 0x10, 0x5a, 0x19, 0xad, 0xdb, 0x70, 0xc9, 0x2b, 
-	0xd3, 0x3d, 0xab, 0xc3, 0x7e, 0x2e, 0x68, 0xaa, 0x51, 0xbc, 0xa8, 0xc8, 0xc0, 
-	0xe0, 0x62, 0xbe, 0x83, 0xba, 0x88, 0x3a, 0xb7, 0x4d, 0xcd, 0xd8, 0xe7, 0xa5, 
-	0x79, 0xf7, 0xc4, 0x5d, 0x2b, 0xcf, 0xb3, 0x90, 0x80, 0x9 , 0x23, 0xbd, 0x5c, 
-	0x5b, 0x4c, 0xce, 0xa2, 0xba, 0x3e, 0x41, 0xf1, 0x55, 0xa1, 0x8a, 0x67, 0x5 , 
-	0x78, 0xce, 0x2b, 0x91, 0xbe, 0x0 , 0x29, 0xc8, 0xc9, 0x1d, 0x6b, 0xd6, 0x3e, 
-	0x26, 0xe8, 0xcd, 0x6d, 0x34, 0x84, 0x29, 0x0 , 0x13, 0x9a, 0xf2, 0xdd, 0x72, 
-	0x33, 0x19, 0x63, 0x5e, 0xad, 0x29, 0x29, 0x44, 0xf0, 0xeb, 0x27, 0x4e, 0x77, 
-	0x33, 0x71, 0xf2, 0xed, 0x19, 0x23, 0x38, 0x1e, 0xbf, 0x4a, 0xb9, 0xa3, 0xc8, 
-	0xb , 0x35, 0xac, 0x87, 0xe5, 0x90, 0x7c, 0xa7, 0xd0, 0xff, 0x0 , 0x9 , 0xff, 
-	0x0 , 0x3e, 0xb5, 0x46, 0x29, 0x55, 0x98, 0xe5, 0x7a, 0xf5, 0xc1, 0xef, 0x52, 
-	0x71, 0x80, 0xe3, 0x3f, 0xe7, 0xfa, 0x53, 0x94, 0x6e, 0xac, 0xce, 0x9c, 0x3d, 
-	0x5e, 0x49, 0xaa, 0x91, 0xe9, 0xf9, 0x76, 0x3a, 0x8 , 0x9d, 0xa4, 0x83, 0x12, 
-	0xf , 0xde, 0x46, 0xdc, 0xd4, 0xb6, 0x99, 0x39, 0x53, 0xfc, 0x27, 0x7 , 0xe9, 
-	0x54, 0xec, 0x67, 0xf3, 0x14, 0x4a, 0x7e, 0xf1, 0xf9, 0x25, 0x1f, 0xc9, 0xaa, 
-	0xdc, 0x2a, 0x56, 0x42, 0xad, 0xc0, 0x61, 0x8c, 0xd7, 0x9b, 0x38, 0xda, 0xe8, 
-	0xfb, 0x3c, 0x3d, 0x45, 0x53, 0x96, 0x49, 0xdf, 0xfa, 0xd0, 0x9a, 0xdc, 0x98, 
-	0xc9, 0x43, 0xd4, 0x72, 0x33, 0xfe, 0x7d, 0xa9, 0x6f, 0x23, 0xca, 0xef, 0x3 , 
-	0x95, 0xe7, 0x3 , 0xfc, 0xfa, 0x53, 0x2e, 0x98, 0xc6, 0x23, 0x99, 0x87, 0xf1, 
-	0x61, 0x88, 0xff, 0x0 , 0x3e, 0xa2, 0xa6, 0x8c, 0x83, 0xf2, 0xf5, 0x38, 0xc8, 
-	0xf7, 0x15, 0x8e, 0xaa, 0xd2, 0x3d, 0x8 , 0xf2, 0xc9, 0x3a, 0x4f, 0xfa, 0xec, 
-	0x25, 0xb1, 0xcc, 0x5b, 0x1c, 0xf4, 0xe8, 0x69, 0xe6, 0xd6, 0x46, 0x56, 0x5d, 
-	0x81, 0x94, 0x8c, 0xe3, 0xda, 0xa3, 0x64, 0xd9, 0x20, 0x1d, 0x45, 0x5d, 0xb1, 
-	0xbc, 0x31, 0x2e, 0x24, 0xf9, 0x95, 0x4f, 0x4 , 0xae, 0x78, 0xa9, 0x77, 0x5a, 
-	0xc4, 0xd2, 0x31, 0x8b, 0x5c, 0xb5, 0x3a, 0x19, 0xcd, 0x6e, 0xc1, 0x88, 0x68, 
-	0xd9, 0x59, 0x3b, 0x67, 0xa8, 0xfc, 0x69, 0xd0, 0xb4, 0x41, 0xb0, 0x59, 0x90, 
-	0x81, 0xd0, 0xaf, 0xf8, 0x56, 0xfd, 0xad, 0xf5, 0xab, 0xf1, 0xba, 0x32, 0xbe, 
-	0x98, 0xe9, 0xfa, 0x55, 0x98, 0x5e, 0xc5, 0x89, 0x6 , 0x28, 0xd8, 0x7d, 0x29, 
-	0x7b, 0x47, 0xb3, 0x42, 0x8e, 0x1a, 0x31, 0x77, 0xa7, 0x33, 0x7 , 0x64, 0x13, 
-	0xa9, 0x5f, 0x31, 0x41, 0xee, 0x7a, 0x7f, 0x3a, 0x41, 0x67, 0x24, 0x64, 0x32, 
-	0xb4, 0x6c, 0x3b, 0x90, 0xe3, 0xfc, 0x6b, 0xa7, 0x85, 0xf4, 0xc4, 0x39, 0xfb, 
-	0x22, 0x85, 0xf6, 0x1d, 0xff, 0x0 , 0x2a, 0xb9, 0x1e, 0xa1, 0xa3, 0xc6, 0x38, 
-	0xb6, 0x88, 0xfb, 0x98, 0x89, 0xfe, 0x42, 0xa6, 0xed, 0x6c, 0x75, 0xbe, 0x49, 
-	0x2b, 0xcd, 0xab, 0xf7, 0x39, 0x9b, 0x7b, 0x6b, 0x83, 0xf7, 0x51, 0x76, 0x91, 
-	0xfd, 0xe1, 0x8a, 0xd4, 0xb1, 0xb1, 0x9f, 0xc8, 0xc9, 0x85, 0xe4, 0xc7, 0x3f, 
-	0x2f, 0x4f, 0xcf, 0xa5, 0x6b, 0x9d, 0x7f, 0x4c, 0x5f, 0xb9, 0x18, 0x1b, 0x7b, 
-	0x6c, 0xdb, 0x83, 0x51, 0xc9, 0xad, 0x45, 0x2b, 0x6d, 0x58, 0x94, 0x9f, 0x56, 
-	0xe7, 0xf9, 0x83, 0x55, 0x14, 0xdb, 0xd8, 0xc2, 0xb4, 0xe1, 0x15, 0xa4, 0x9f, 
-	0xc8, 0xa3, 0xf6, 0x49, 0xcf, 0xcc, 0x16, 0x38, 0xc0, 0xff, 0x0 , 0x6b, 0x27, 
-	0xf4, 0x14, 0xab, 0x6 , 0xd5, 0xf9, 0x98, 0x93, 0xea, 0x4e, 0x5 , 0x58, 0x92, 
-	0xfa, 0x47, 0xe3, 0x19, 0xe3, 0xa2, 0x2d, 0x57, 0x91, 0xcb, 0xfc, 0xa5, 0x31, 
-	0xfe, 0xf9, 0xfe, 0x95, 0xe9, 0xd0, 0xa4, 0x96, 0xa7, 0xc7, 0x66, 0x58, 0xd9, 
-	0x54, 0xbc, 0x52, 0x76, 0x5f, 0xd6, 0xa0, 0xec, 0xb9, 0xda, 0x6 , 0x71, 0xdc, 
-	0xa , 0x69, 0x38, 0xe0, 0xa , 0x3f, 0x1c, 0xf , 0x61, 0x4e, 0x18, 0x1d, 0x2b, 
-	0xd2, 0x82, 0xb6, 0xc7, 0xc8, 0xd7, 0x9f, 0x33, 0xf7, 0x9d, 0xc6, 0x8c, 0x9a, 
-	0x51, 0xf5, 0xa5, 0xfc, 0x28, 0xfc, 0x2b, 0x53, 0x91, 0x87, 0xe3, 0x47, 0xe3, 
-	0x47, 0xe1, 0x47, 0xe1, 0x40, 0x86, 0xd1, 0x45, 0x14, 0xc0, 0x28, 0xa2, 0x8a, 
-	0x60, 0x37, 0x14, 0x51, 0x9a, 0x28, 0x0 , 0xa4, 0x22, 0x96, 0x90, 0x9a, 0x0 , 
-	0x4a, 0x28, 0xa2, 0x80, 0xf , 0xc6, 0x8f, 0xc6, 0x8f, 0xc2, 0x8f, 0xc2, 0x80, 
-	0x11, 0xbe, 0xb4, 0x94, 0xb8, 0xf6, 0xa4, 0x6e, 0x28, 0x0 , 0xa4, 0x6a, 0x5a, 
-	0x46, 0xa0, 0x4 , 0xa3, 0xb5, 0x14, 0x50, 0x3 , 0x68, 0xa2, 0x8a, 0x0 , 0x28, 
-	0xfc, 0x68, 0xa3, 0xf0, 0xa0, 0x4 , 0x6f, 0xad, 0x25, 0x2b, 0x7d, 0x29, 0x28, 
-	0x1 , 0x1a, 0x92, 0x95, 0xa9, 0x28, 0x1 , 0x1a, 0x92, 0x95, 0xa9, 0x28, 0x0 , 
-	0xa3, 0xf1, 0xa2, 0x8f, 0xc2, 0x9a, 0x1 , 0x1b, 0xeb, 0x49, 0x4a, 0xdf, 0x4a, 
-	0x4a, 0x60, 0x37, 0x14, 0x51, 0x9a, 0x28, 0x1 , 0xb4, 0x51, 0x45, 0x0 , 0x1f, 
-	0x8d, 0x26, 0x7d, 0xe9, 0x7f, 0xa , 0x4c, 0x7b, 0x50, 0x2 , 0x51, 0x45, 0x21, 
-	0x34, 0x8 , 0x4a, 0x46, 0xa5, 0xa4, 0x6a, 0x6 , 0x25, 0x1f, 0x8d, 0x14, 0x7e, 
-	0x14, 0xc0, 0x3f, 0x1a, 0x28, 0xfc, 0x28, 0xa4, 0x3d, 0x45, 0x2 , 0x97, 0x14, 
-	0x52, 0xad, 0x2 , 0x16, 0x94, 0x7d, 0x69, 0x29, 0x57, 0xe9, 0x40, 0xc5, 0xfc, 
-	0x68, 0xa3, 0xf0, 0xa2, 0x81, 0xa , 0xb4, 0xb4, 0x62, 0x8a, 0xa , 0x1d, 0x45, 
-	0x14, 0xab, 0xf4, 0xa0, 0x5 , 0xfc, 0x68, 0xfc, 0x68, 0xfc, 0x28, 0xa0, 0x2 , 
-	0x95, 0x69, 0x5 , 0x3a, 0x90, 0xa , 0xb4, 0xb4, 0x8b, 0x4b, 0x48, 0x40, 0xb4, 
-	0xef, 0xc6, 0x91, 0x45, 0x2f, 0xe1, 0x40, 0x7 , 0xe3, 0x45, 0x14, 0x50, 0x31, 
-	0x56, 0x96, 0x8c, 0x51, 0x40, 0x85, 0x2 , 0x96, 0x8a, 0x28, 0xd , 0x41, 0x69, 
-	0xdf, 0x8d, 0x26, 0x3d, 0xa9, 0x7f, 0xa , 0x6 , 0x1f, 0x8d, 0x14, 0x7e, 0x14, 
-	0x50, 0x20, 0xa5, 0x5a, 0x41, 0x4e, 0xa0, 0x61, 0x45, 0x14, 0xa0, 0x50, 0x0 , 
-	0x5 , 0x2d, 0x14, 0xa0, 0x50, 0x2 , 0xa , 0x5f, 0xc6, 0x8c, 0x51, 0xf8, 0x50, 
-	0x2 , 0xfe, 0x34, 0x7e, 0x34, 0x7e, 0x14, 0x50, 0x2b, 0x5 , 0x14, 0x53, 0x26, 
-	0x6c, 0x0 , 0xa3, 0xab, 0x7e, 0x83, 0xb9, 0xa4, 0x32, 0x39, 0x8e, 0xe6, 0xda, 
-	0x7 , 0x2c, 0x39, 0x3e, 0x8b, 0x49, 0x6c, 0xbf, 0x29, 0x93, 0x3f, 0x34, 0xbd, 
-	0xfb, 0x85, 0xa4, 0x65, 0x1b, 0x70, 0xf , 0xfa, 0xc3, 0xb7, 0x3e, 0xc3, 0x92, 
-	0x6a, 0xa6, 0xb5, 0x70, 0xe5, 0x45, 0x95, 0xb9, 0xdb, 0x2c, 0xca, 0x49, 0x7e, 
-	0xd1, 0x46, 0x3a, 0xb1, 0xff, 0x0 , 0x3d, 0x6a, 0x5e, 0xc6, 0xd1, 0x57, 0x76, 
-	0x33, 0xfc, 0x49, 0xe6, 0xea, 0x97, 0x11, 0x59, 0xda, 0x4f, 0x18, 0x85, 0x5b, 
-	0x12, 0xe1, 0xfe, 0x6e, 0x3a, 0xd4, 0xf7, 0x10, 0xa4, 0x51, 0xab, 0x2a, 0x7c, 
-	0x96, 0xeb, 0x88, 0xa3, 0x51, 0xc0, 0xf7, 0xfa, 0xe6, 0xaa, 0x78, 0x6e, 0xdd, 
-	0x47, 0x9d, 0x79, 0x18, 0xe2, 0x56, 0x30, 0xc1, 0xbb, 0xa8, 0x51, 0xd5, 0x8f, 
-	0xe3, 0xdf, 0xda, 0xaa, 0x5e, 0xdc, 0xbe, 0xad, 0xac, 0x2d, 0xa5, 0xa3, 0x37, 
-	0x91, 0x6f, 0x9c, 0xb2, 0xf1, 0xbc, 0xfa, 0xe7, 0xd3, 0xb5, 0x73, 0xcb, 0x99, 
-	0x6b, 0xdc, 0xef, 0x8f, 0xb2, 0x6f, 0x96, 0xcd, 0x25, 0xe6, 0x52, 0xbe, 0x82, 
-	0xee, 0xf2, 0xf0, 0xdc, 0x5e, 0xd , 0xbc, 0xe1, 0x57, 0x3f, 0x71, 0x6b, 0x41, 
-	0x6f, 0x2d, 0xad, 0xe3, 0x5c, 0x81, 0x23, 0x20, 0xc2, 0xa8, 0x7 , 0x3 , 0xe9, 
-	0xe9, 0xf5, 0xeb, 0x4f, 0x84, 0x6c, 0x69, 0x6e, 0xc8, 0x56, 0x8d, 0x7e, 0x48, 
-	0xf7, 0xe0, 0x82, 0x7d, 0x87, 0xf9, 0xe2, 0xb1, 0x35, 0x7d, 0x41, 0x91, 0x5d, 
-	0x23, 0xfb, 0xf2, 0x8c, 0x13, 0x8c, 0x61, 0x7d, 0x7 , 0xa0, 0xcd, 0x45, 0xa6, 
-	0xba, 0x9a, 0xb9, 0xd1, 0x7a, 0x72, 0xbd, 0x3c, 0xff, 0x0 , 0xe0, 0xc , 0xd5, 
-	0xae, 0x85, 0xd3, 0x93, 0x24, 0x98, 0x5 , 0x8b, 0x63, 0x8e, 0xbc, 0xd5, 0x6 , 
-	0x96, 0x24, 0xfb, 0x87, 0xff, 0x0 , 0x1d, 0xa8, 0x4b, 0x1f, 0xba, 0xa7, 0xaf, 
-	0x53, 0x48, 0xa0, 0xe7, 0xd , 0x91, 0xf5, 0xa9, 0xb7, 0x76, 0x1e, 0xd9, 0x7d, 
-	0x88, 0xd8, 0x94, 0xcc, 0x1f, 0x93, 0xc7, 0xd0, 0x50, 0xa4, 0x8e, 0xa4, 0xb2, 
-	0xfa, 0x8a, 0x8d, 0x57, 0xb1, 0xc0, 0xf4, 0xa5, 0xe5, 0x39, 0x1c, 0x55, 0x58, 
-	0x39, 0xdb, 0xdc, 0x7a, 0xce, 0xd1, 0xb6, 0x50, 0x6d, 0xf7, 0x5a, 0x9d, 0x2e, 
-	0xd5, 0xff, 0x0 , 0xd6, 0x6e, 0xcf, 0xa8, 0xaa, 0xa2, 0x41, 0x9f, 0x99, 0x7 , 
-	0xe1, 0x4e, 0x5f, 0x2d, 0x9b, 0x20, 0xed, 0xf6, 0x34, 0x9c, 0x57, 0x63, 0x4a, 
-	0x75, 0xe7, 0x1f, 0x86, 0x5f, 0x22, 0xdb, 0x49, 0xbb, 0x95, 0x91, 0x4e, 0x3d, 
-	0x45, 0x5b, 0xd2, 0x75, 0x4b, 0xad, 0x3a, 0x5f, 0x32, 0xda, 0x42, 0x87, 0x3f, 
-	0x30, 0x53, 0x80, 0xdf, 0x87, 0x4a, 0xcc, 0x54, 0xf9, 0xbe, 0xf2, 0x9a, 0x56, 
-	0x21, 0x78, 0xcf, 0xeb, 0x51, 0xc9, 0xa1, 0xd0, 0xab, 0x34, 0xf9, 0xad, 0x66, 
-	0x77, 0xfa, 0x7f, 0x8f, 0xe1, 0xf2, 0x84, 0x37, 0xd6, 0xec, 0xc3, 0xb9, 0x55, 
-	0xc , 0x3f, 0x5e, 0x6a, 0xc4, 0x7a, 0xdf, 0x86, 0x2e, 0x18, 0xb6, 0xc8, 0x91, 
-	0x8f, 0x3c, 0xa6, 0xdc, 0x9f, 0xd3, 0x15, 0xe6, 0xa6, 0x62, 0x38, 0xc7, 0xe7, 
-	0x4d, 0xf3, 0x25, 0x6e, 0x2 , 0xe3, 0xdf, 0x15, 0x93, 0xc2, 0xa7, 0xe4, 0x75, 
-	0xc3, 0x3a, 0xa9, 0x16, 0xaf, 0x67, 0xea, 0x8f, 0x4b, 0x56, 0xd1, 0x6e, 0x1b, 
-	0x74, 0x22, 0x3c, 0x81, 0xce, 0xd2, 0x4f, 0x1e, 0xf8, 0xa8, 0xee, 0xa2, 0xb3, 
-	0xfe, 0x5 , 0x89, 0xb0, 0x3b, 0xf1, 0xfc, 0xeb, 0xce, 0x1b, 0xcc, 0xc6, 0x8 , 
-	0xfc, 0xf8, 0xa7, 0xc3, 0x1b, 0xb7, 0xf1, 0x71, 0xec, 0x33, 0x59, 0xbc, 0x1a, 
-	0xfe, 0x63, 0xaa, 0x3c, 0x41, 0x3d, 0x95, 0x24, 0x76, 0xd3, 0x5c, 0xc3, 0xc , 
-	0x9b, 0x41, 0xb7, 0x43, 0xe8, 0xb3, 0x2f, 0xf2, 0x15, 0xc , 0xf7, 0xa7, 0x77, 
-	0xc8, 0x37, 0xfb, 0xae, 0xf , 0xeb, 0x5c, 0xc5, 0xbc, 0x4d, 0x9f, 0x94, 0x15, 
-	0xf6, 0x1f, 0x7b, 0xf1, 0x3d, 0xaa, 0x49, 0x26, 0x58, 0x46, 0xd5, 0xda, 0xef, 
-	0xf4, 0xc8, 0x1f, 0x53, 0xde, 0xa5, 0x60, 0xe2, 0xde, 0x9a, 0x9d, 0x1f, 0xdb, 
-	0x55, 0xb9, 0x39, 0xa6, 0xb9, 0x51, 0xb5, 0x73, 0x78, 0x23, 0x4d, 0xf7, 0xc , 
-	0xa1, 0x8f, 0x2a, 0x8c, 0xe0, 0x67, 0xf2, 0xcd, 0x67, 0xdd, 0x5d, 0xb4, 0xcd, 
-	0x99, 0x27, 0x5e, 0x9d, 0x10, 0x1c, 0x1 , 0xe9, 0xda, 0xb2, 0x9b, 0xcc, 0x9a, 
-	0x62, 0xec, 0x59, 0x9b, 0xbb, 0x1a, 0x96, 0x8 , 0xcb, 0x48, 0x7 , 0xf7, 0x8f, 
-	0x3 , 0xd6, 0xba, 0xe8, 0xe1, 0x61, 0x17, 0x73, 0xc6, 0xc5, 0xe7, 0x15, 0xaa, 
-	0xe8, 0xb4, 0x5f, 0xd6, 0xe5, 0xc3, 0x24, 0x7b, 0x32, 0x1 , 0x60, 0x7d, 0x69, 
-	0xf6, 0xef, 0x24, 0x9f, 0x2e, 0x76, 0xa9, 0xec, 0xb5, 0x1c, 0x8a, 0x4b, 0x84, 
-	0x1d, 0xf8, 0x1f, 0x41, 0xfe, 0x45, 0x5b, 0x8d, 0xa , 0xa0, 0x0 , 0x60, 0xfd, 
-	0x33, 0x5d, 0x91, 0xa7, 0x4 , 0xf6, 0x3c, 0xb7, 0x5a, 0xac, 0xa3, 0xa3, 0xb5, 
-	0xc9, 0x61, 0xa , 0x18, 0x73, 0xf3, 0x55, 0x88, 0xae, 0x22, 0x5e, 0x0 , 0xcb, 
-	0x55, 0x75, 0x86, 0x56, 0xe0, 0x10, 0x33, 0xdb, 0xfc, 0x6a, 0x55, 0xb1, 0x90, 
-	0xff, 0x0 , 0x77, 0x18, 0xe4, 0x63, 0xfc, 0x6b, 0x67, 0xcd, 0x2f, 0x43, 0x14, 
-	0xd4, 0x76, 0xdc, 0xd3, 0xd2, 0xef, 0x52, 0x39, 0x32, 0xcb, 0xf2, 0xfa, 0xe2, 
-	0xba, 0x1d, 0x2b, 0x5c, 0xb3, 0x4c, 0x6e, 0x60, 0x3d, 0xc7, 0x35, 0xc9, 0xb , 
-	0x9 , 0xc , 0x78, 0x12, 0xb0, 0x35, 0x5a, 0x6b, 0x2b, 0x94, 0x3f, 0x23, 0xb0, 
-	0xc7, 0x39, 0xcf, 0xf4, 0xac, 0x6a, 0x53, 0x9b, 0x2a, 0x32, 0x67, 0xac, 0x58, 
-	0xea, 0xb6, 0x52, 0x2a, 0xa8, 0x91, 0x73, 0xea, 0x3a, 0x7e, 0x75, 0xb5, 0x67, 
-	0x7b, 0x8 , 0xe5, 0x5f, 0x8c, 0x75, 0xaf, 0x17, 0xb5, 0x9e, 0xf2, 0xdd, 0x7e, 
-	0x67, 0x7c, 0x8e, 0x9c, 0x7c, 0xa7, 0xfa, 0xd6, 0x9d, 0x9e, 0xb3, 0x70, 0xb8, 
-	0xdd, 0x21, 0xb , 0xd3, 0x82, 0x6b, 0x9d, 0xc6, 0x5d, 0x8d, 0xe3, 0x58, 0xf6, 
-	0x58, 0x6f, 0x3 , 0x28, 0x65, 0x6e, 0x31, 0x8c, 0xa , 0xb3, 0xd , 0xe6, 0x46, 
-	0x17, 0xaf, 0x4e, 0x6b, 0xcb, 0x74, 0x9d, 0x76, 0xe0, 0x0 , 0x47, 0xce, 0x3a, 
-	0x60, 0x63, 0xfc, 0x6b, 0x6a, 0xd7, 0x5f, 0x75, 0x6c, 0x16, 0xc , 0x7d, 0xb , 
-	0x63, 0xf3, 0xa8, 0xe4, 0x66, 0xf1, 0xaa, 0x8f, 0x47, 0xb3, 0xbc, 0x52, 0xb9, 
-	0xc , 0x1 , 0xce, 0x3a, 0xe3, 0xf9, 0xd5, 0xd8, 0xee, 0x0 , 0x6e, 0xa3, 0x15, 
-	0xe7, 0xf6, 0xba, 0xc8, 0xe0, 0x93, 0xb7, 0xa7, 0x7a, 0xd7, 0xb5, 0xd5, 0x43, 
-	0x2f, 0x12, 0x75, 0xac, 0xe5, 0x4c, 0xda, 0x35, 0x11, 0xd9, 0xdb, 0x5c, 0xe5, 
-	0xb9, 0x3c, 0xfb, 0x55, 0xb8, 0xe6, 0xe4, 0xb1, 0x3f, 0x31, 0x15, 0xc9, 0xda, 
-	0xea, 0x28, 0x7e, 0x60, 0xdc, 0x1 , 0xc9, 0xcf, 0xf9, 0xf7, 0xad, 0x2b, 0x5d, 
-	0x41, 0x5d, 0x0 , 0xdd, 0xd7, 0x8c, 0x56, 0xe , 0x2c, 0xd5, 0x4c, 0xdd, 0x59, 
-	0xb2, 0xbf, 0x32, 0xf4, 0xe8, 0x3d, 0x29, 0x45, 0xc7, 0x38, 0xc7, 0x4e, 0x73, 
-	0x9a, 0xc6, 0xfb, 0x59, 0xce, 0x3 , 0x31, 0x3d, 0xa9, 0x16, 0xed, 0x77, 0x64, 
-	0xb9, 0xeb, 0xd0, 0xa , 0x56, 0x2d, 0x48, 0xe9, 0x20, 0xb8, 0x52, 0x99, 0x2d, 
-	0x9e, 0x31, 0x9e, 0xf9, 0xa9, 0x96, 0x7e, 0x7a, 0x10, 0x48, 0xf5, 0xae, 0x6e, 
-	0xda, 0xf0, 0xee, 0xce, 0xee, 0xdd, 0xea, 0xca, 0xdf, 0xe0, 0x72, 0xdc, 0xfb, 
-	0xd2, 0xb1, 0x5c, 0xc7, 0x41, 0xd , 0xc2, 0x90, 0xd8, 0x3b, 0x54, 0x76, 0xc7, 
-	0x7e, 0xf8, 0xab, 0x76, 0x77, 0x40, 0x28, 0xfb, 0xac, 0x71, 0x9e, 0xb8, 0xe2, 
-	0xb9, 0x98, 0x6f, 0x7 , 0x99, 0xf7, 0x89, 0xcf, 0x43, 0x8e, 0x9f, 0x5a, 0x99, 
-	0x6e, 0xd5, 0x50, 0xc8, 0x3e, 0x66, 0xcf, 0x1f, 0x37, 0xf5, 0xfc, 0x6a, 0x1c, 
-	0x4a, 0xe6, 0x47, 0x4c, 0xb7, 0x44, 0xf1, 0x8c, 0x8c, 0xf7, 0x6e, 0xf8, 0xeb, 
-	0x52, 0x2d, 0xd7, 0x96, 0x37, 0x33, 0x75, 0xee, 0x4d, 0x70, 0xba, 0xf7, 0x88, 
-	0x93, 0x4f, 0x8c, 0x49, 0x24, 0xe9, 0x1a, 0xf3, 0x93, 0x9c, 0xb3, 0x11, 0xe8, 
-	0x2b, 0x9a, 0xd4, 0xbc, 0x75, 0x23, 0xc7, 0xbe, 0x6 , 0x90, 0xc5, 0xb7, 0x25, 
-	0xc3, 0x60, 0x7b, 0x64, 0xd2, 0xe4, 0x21, 0xd5, 0x48, 0xf5, 0xbb, 0x8d, 0x66, 
-	0xd5, 0x61, 0x25, 0xa7, 0x1b, 0x71, 0x92, 0x54, 0xe6, 0xaa, 0x5e, 0x78, 0xae, 
-	0xc6, 0xca, 0x5 , 0x2b, 0x26, 0xf5, 0x3 , 0x3f, 0x78, 0x0 , 0xbf, 0x89, 0xc7, 
-	0xb7, 0x7a, 0xf0, 0xfd, 0x43, 0xc5, 0x57, 0x13, 0x2b, 0x16, 0x62, 0x14, 0xf4, 
-	0xcb, 0x13, 0xef, 0xd3, 0xa7, 0xf9, 0xeb, 0x55, 0x22, 0xd5, 0xee, 0x27, 0x55, 
-	0x10, 0xb4, 0x7b, 0x77, 0x91, 0x92, 0x37, 0x12, 0x7f, 0x9e, 0x7a, 0x55, 0x7b, 
-	0x33, 0x27, 0x5d, 0xdf, 0x43, 0xd7, 0xef, 0x3e, 0x21, 0x28, 0x5c, 0x5b, 0xc4, 
-	0xe7, 0x60, 0xce, 0xf6, 0x97, 0xa , 0xc7, 0xf4, 0x1d, 0x85, 0x66, 0x37, 0x8f, 
-	0x35, 0xb9, 0x8 , 0x8 , 0x89, 0x1c, 0x64, 0x63, 0x99, 0x19, 0x49, 0xfa, 0x1c, 
-	0x8f, 0xe5, 0x5c, 0x6e, 0x93, 0xa7, 0x5f, 0xdd, 0x30, 0xfb, 0x44, 0x93, 0x1d, 
-	0xd8, 0x61, 0x1e, 0x9 , 0x3f, 0x96, 0x40, 0x5a, 0xeb, 0xb4, 0x1f, 0xf , 0xcd, 
-	0x1b, 0x82, 0x3c, 0xa8, 0xf8, 0xe5, 0xca, 0x16, 0x61, 0xf8, 0x93, 0xfc, 0xa8, 
-	0xe5, 0x48, 0x71, 0xe7, 0x91, 0xa9, 0xa0, 0xf8, 0xae, 0xfe, 0x46, 0x5f, 0x36, 
-	0x19, 0xd3, 0x76, 0x73, 0x22, 0x2b, 0x36, 0x7d, 0xb2, 0xc3, 0xe9, 0xde, 0xba, 
-	0x48, 0xef, 0x92, 0xfe, 0xd0, 0xc5, 0x2b, 0xbb, 0x39, 0x1c, 0x7 , 0x8f, 0x69, 
-	0xff, 0x0 , 0xf , 0xca, 0xab, 0x69, 0x3a, 0x44, 0x69, 0x8d, 0xd7, 0x32, 0x17, 
-	0x63, 0xf3, 0x1e, 0x39, 0x15, 0x34, 0xda, 0x73, 0xd8, 0xb3, 0x1b, 0x58, 0xe2, 
-	0x91, 0x4f, 0x50, 0xd9, 0x7 , 0xf3, 0xff, 0x0 , 0xeb, 0x56, 0x2e, 0xc6, 0xea, 
-	0x2d, 0x1e, 0x57, 0xf1, 0x7b, 0x44, 0x47, 0xb6, 0x79, 0x15, 0x7f, 0x10, 0x3b, 
-	0xd7, 0xce, 0xbe, 0x33, 0xb4, 0xf2, 0x24, 0x90, 0x63, 0xa1, 0xaf, 0xaa, 0xbc, 
-	0x6e, 0xaf, 0x2c, 0x12, 0x43, 0x22, 0x15, 0x66, 0x1c, 0x86, 0x5e, 0xf8, 0xec, 
-	0x6b, 0xe7, 0x6f, 0x89, 0xf6, 0x5b, 0x24, 0x94, 0xe3, 0x1d, 0x7b, 0x57, 0x5e, 
-	0x1a, 0x47, 0x9b, 0x8c, 0x85, 0xd5, 0xcf, 0x30, 0x53, 0x89, 0x4f, 0xeb, 0x56, 
-	0x41, 0xda, 0xb9, 0xea, 0xac, 0x39, 0x15, 0x5e, 0x41, 0xfb, 0xe3, 0x56, 0x22, 
-	0xc1, 0x5d, 0x87, 0xb8, 0xe3, 0xf2, 0xae, 0xd9, 0x1c, 0x98, 0x7b, 0xda, 0xc5, 
-	0xcb, 0x17, 0xf2, 0x99, 0x5c, 0x1d, 0xc8, 0xe3, 0x1f, 0x51, 0xfe, 0x35, 0xb9, 
-	0xc , 0x82, 0x48, 0x40, 0x27, 0x9c, 0x63, 0x35, 0xce, 0xdb, 0x31, 0x8e, 0x11, 
-	0xc6, 0x46, 0x39, 0x6 , 0xb4, 0xec, 0xe6, 0x28, 0xcb, 0x22, 0x9d, 0xca, 0xc7, 
-	0xf5, 0xf4, 0x3f, 0x5a, 0xe3, 0xaf, 0x4e, 0xfa, 0x9f, 0x4b, 0x95, 0xe2, 0xb9, 
-	0x17, 0x2b, 0xd8, 0xd9, 0x58, 0x96, 0x68, 0x9a, 0x36, 0xe3, 0x70, 0xda, 0xde, 
-	0xc7, 0xb1, 0xaa, 0xb6, 0xe5, 0xd1, 0xb6, 0x4c, 0x0 , 0x78, 0xdb, 0xd , 0x9f, 
-	0xcb, 0x35, 0x66, 0xd1, 0x83, 0x9c, 0xa9, 0xc8, 0x71, 0xcd, 0x4b, 0x75, 0x0 , 
-	0x91, 0x84, 0xca, 0xbc, 0xe3, 0xe7, 0x5f, 0x51, 0xde, 0xbc, 0xf5, 0x2b, 0x3b, 
-	0x33, 0xea, 0xa7, 0x47, 0x9e, 0xa , 0xa4, 0x37, 0x5f, 0x8f, 0xf5, 0xb8, 0xcc, 
-	0x8d, 0xa0, 0xe7, 0x8c, 0xf4, 0x3d, 0x8d, 0x2b, 0xc4, 0x41, 0xde, 0x88, 0xac, 
-	0x31, 0xcf, 0xbd, 0x57, 0x89, 0xc7, 0x9c, 0x62, 0x73, 0xb1, 0xb1, 0x8f, 0x9b, 
-	0xbf, 0xe3, 0x56, 0xed, 0xc9, 0x8f, 0xe5, 0x6e, 0x39, 0xe8, 0xdd, 0x3f, 0xcf, 
-	0xd2, 0x89, 0x26, 0x82, 0x9d, 0x65, 0x35, 0x66, 0xbf, 0xe0, 0x10, 0xae, 0xc2, 
-	0xd8, 0x68, 0xca, 0xe3, 0xa6, 0x4f, 0xf5, 0xc5, 0x25, 0xc3, 0x35, 0xbb, 0x7c, 
-	0xb6, 0xfb, 0xd7, 0xf0, 0xe7, 0xf4, 0xa9, 0xae, 0x26, 0x2b, 0x8c, 0x8e, 0x40, 
-	0xee, 0x32, 0x18, 0x7b, 0x1a, 0x22, 0xb8, 0xb7, 0x92, 0x1e, 0x5d, 0x40, 0xec, 
-	0xc7, 0xee, 0xff, 0x0 , 0xf5, 0xbf, 0x4a, 0x2f, 0x2d, 0xed, 0xa0, 0x4a, 0x9d, 
-	0x39, 0x37, 0x15, 0x2b, 0x32, 0xa8, 0xbb, 0x41, 0x26, 0xe5, 0x81, 0x32, 0x7f, 
-	0xbc, 0xa3, 0xf4, 0x35, 0x3d, 0xad, 0xdc, 0xcc, 0xc5, 0x2 , 0xc5, 0x9c, 0x74, 
-	0x2a, 0x2a, 0xcf, 0x90, 0x8e, 0xbf, 0x32, 0x63, 0x9e, 0xe , 0x37, 0xa , 0x72, 
-	0xd9, 0x90, 0x43, 0x29, 0x5e, 0x3d, 0xff, 0x0 , 0xa1, 0xa3, 0xda, 0x45, 0x93, 
-	0x1c, 0x2d, 0x68, 0xf5, 0xd0, 0x85, 0x64, 0x91, 0x64, 0x4 , 0x8d, 0xbb, 0xbd, 
-	0x33, 0x57, 0x95, 0xe5, 0xc6, 0x18, 0x8f, 0x61, 0x4e, 0x5b, 0x7d, 0xca, 0x1 , 
-	0x42, 0x6 , 0x7a, 0x8a, 0x96, 0x18, 0xc0, 0x5d, 0x87, 0x9e, 0x38, 0xa2, 0x35, 
-	0x22, 0xa5, 0x7e, 0x81, 0x53, 0xd , 0x52, 0x74, 0xf9, 0x2f, 0xef, 0x2d, 0xba, 
-	0x5c, 0x22, 0x77, 0x2a, 0x55, 0x99, 0xbd, 0xb2, 0x4f, 0xf2, 0xa9, 0xe3, 0xdb, 
-	0xb7, 0x1c, 0xf3, 0xe9, 0xd2, 0x85, 0x89, 0x3 , 0xe , 0x3f, 0x23, 0x52, 0x2c, 
-	0x5e, 0x8a, 0xf8, 0xef, 0xd2, 0xbd, 0x4c, 0x3d, 0x78, 0x25, 0xb1, 0xf1, 0xb9, 
-	0x9e, 0x59, 0x88, 0x94, 0x9b, 0xbb, 0xfc, 0x47, 0x26, 0x3f, 0x1c, 0x72, 0x29, 
-	0xd9, 0xcf, 0xff, 0x0 , 0x5a, 0x9f, 0xd , 0xa3, 0xba, 0xe4, 0x6 , 0x3 , 0x1d, 
-	0xc5, 0x4e, 0xb6, 0x2c, 0xa0, 0x19, 0x1b, 0x83, 0xd0, 0xfd, 0xda, 0xec, 0x58, 
-	0x88, 0x77, 0x3e, 0x7e, 0x59, 0x66, 0x22, 0xff, 0x0 , 0x9 , 0x57, 0x19, 0xa3, 
-	0x18, 0xab, 0x4d, 0x11, 0xdd, 0xb6, 0x18, 0xb7, 0x7b, 0xf6, 0xa8, 0xa6, 0xb7, 
-	0x94, 0x72, 0xfd, 0x3b, 0x93, 0xd0, 0x55, 0xaa, 0xb1, 0xee, 0x65, 0x2c, 0xd , 
-	0x55, 0xd0, 0x80, 0x9e, 0x3a, 0xd2, 0xa9, 0xcf, 0x7a, 0x1d, 0x0 , 0x19, 0x3d, 
-	0x29, 0x3f, 0x87, 0x2 , 0xad, 0x4a, 0xe7, 0x3c, 0xe9, 0xf2, 0x85, 0x14, 0xa , 
-	0xd , 0x5a, 0x32, 0xa , 0x28, 0x34, 0x99, 0xa0, 0x0 , 0x9a, 0x4a, 0x28, 0xa6, 
-	0x1 , 0x48, 0xd4, 0xa6, 0x93, 0xad, 0x0 , 0x21, 0xa2, 0x8a, 0x28, 0x0 , 0xfc, 
-	0x68, 0xfc, 0x68, 0xfc, 0x28, 0xfc, 0x28, 0x1 , 0x1b, 0xeb, 0x49, 0x4a, 0xdf, 
-	0x4a, 0x4a, 0x0 , 0x28, 0xa2, 0x90, 0x9a, 0x0 , 0x4a, 0x28, 0xa2, 0x80, 0x1b, 
-	0x45, 0x14, 0x50, 0x1 , 0xf8, 0xd1, 0xf8, 0xd1, 0xf8, 0x51, 0xf8, 0x50, 0x3 , 
-	0x68, 0xa2, 0x8a, 0x0 , 0x46, 0xa4, 0xa3, 0x34, 0x50, 0x2 , 0x35, 0x25, 0x2b, 
-	0x52, 0x50, 0x1 , 0x47, 0xe3, 0x45, 0x1f, 0x85, 0x30, 0x1b, 0x45, 0x2b, 0x7d, 
-	0x29, 0x29, 0x80, 0x84, 0xd2, 0x51, 0x45, 0x0 , 0x36, 0x8a, 0x28, 0xa0, 0x3 , 
-	0xf1, 0xa4, 0x3f, 0x5a, 0x5f, 0xc2, 0x90, 0xfd, 0x28, 0x1 , 0x29, 0x1a, 0x96, 
-	0x91, 0xa8, 0x1 , 0x29, 0x1a, 0x96, 0x91, 0xa8, 0x1 , 0x28, 0xfc, 0x68, 0xa3, 
-	0xf0, 0xa7, 0x60, 0xa , 0x50, 0x69, 0x28, 0xa4, 0x34, 0x3a, 0x95, 0x69, 0x5 , 
-	0x3a, 0x80, 0x5 , 0xa7, 0x7e, 0x34, 0xd5, 0xa7, 0x7e, 0x14, 0xc , 0x3f, 0x1a, 
-	0x28, 0xa5, 0x51, 0x41, 0x22, 0xd1, 0x8a, 0x29, 0xcb, 0xd2, 0x81, 0x85, 0x2a, 
-	0xfd, 0x69, 0x5 , 0x2f, 0xe1, 0x40, 0xb , 0xf8, 0xd1, 0x47, 0xe1, 0x45, 0x0 , 
-	0x14, 0xe1, 0x46, 0x28, 0xa4, 0x21, 0xd4, 0x51, 0x4a, 0x5 , 0x21, 0x8b, 0xf8, 
-	0xd1, 0xf8, 0xd1, 0xf8, 0x51, 0x40, 0xc2, 0x8c, 0x51, 0x46, 0x68, 0x16, 0x83, 
-	0xa8, 0xc5, 0x14, 0xab, 0x40, 0xc5, 0xa2, 0x8a, 0x50, 0x28, 0x1 , 0x7f, 0x1a, 
-	0x3f, 0x1a, 0x3f, 0xa , 0x3f, 0xa , 0x0 , 0x28, 0xa3, 0x14, 0xa0, 0x50, 0x0 , 
-	0xb4, 0xb4, 0x62, 0x8a, 0x0 , 0x55, 0x18, 0xa5, 0xa2, 0x8a, 0x0 , 0x28, 0xa0, 
-	0x52, 0xe2, 0x81, 0x21, 0x7f, 0x1a, 0x4f, 0xc6, 0x97, 0xf0, 0xa3, 0xf0, 0xa0, 
-	0x2 , 0x8a, 0x3b, 0x51, 0x40, 0xc1, 0x8e, 0x17, 0x26, 0xa3, 0xc1, 0xf9, 0x89, 
-	0xfb, 0xc7, 0x8c, 0x53, 0x89, 0xce, 0x5b, 0xb2, 0x74, 0xfa, 0xd3, 0x72, 0x17, 
-	0x93, 0xfc, 0x23, 0x9f, 0xf3, 0xf5, 0xa4, 0x4 , 0x37, 0x52, 0x47, 0xa , 0xbc, 
-	0xb2, 0x37, 0xc9, 0xa , 0x7c, 0xc7, 0xd8, 0x73, 0xfa, 0xd6, 0x4d, 0xf0, 0x99, 
-	0x34, 0x99, 0x27, 0x95, 0x7f, 0xd2, 0xf5, 0x26, 0xa , 0x17, 0xba, 0x27, 0x65, 
-	0x1f, 0x87, 0xea, 0x6a, 0xf4, 0x88, 0x6e, 0xef, 0x92, 0xd8, 0xe4, 0xc7, 0x19, 
-	0x13, 0x4e, 0x7d, 0x49, 0xfb, 0xab, 0xfd, 0x7f, 0x2a, 0x8e, 0xf1, 0x85, 0xc6, 
-	0xb4, 0x19, 0x88, 0x11, 0x5a, 0x2e, 0x79, 0xe9, 0xba, 0xa1, 0xea, 0x6d, 0x1d, 
-	0xc , 0xdf, 0x10, 0x4f, 0xfd, 0x9b, 0xa4, 0xc7, 0x67, 0x9 , 0x1e, 0x74, 0x8b, 
-	0xe5, 0xae, 0xde, 0xa0, 0x77, 0xc7, 0xf9, 0xfe, 0x2a, 0x8e, 0xc6, 0x5 , 0xd3, 
-	0x74, 0x37, 0xe3, 0x13, 0x3a, 0xe5, 0xce, 0x39, 0xc7, 0x40, 0x3f, 0x3a, 0xad, 
-	0x64, 0xc7, 0x53, 0xd7, 0x26, 0xd4, 0x1c, 0x66, 0x2b, 0x71, 0xfb, 0xbc, 0xf7, 
-	0x3d, 0xbf, 0x53, 0x9a, 0xb1, 0xab, 0x4f, 0xe6, 0x5e, 0x24, 0x1f, 0xc2, 0xa7, 
-	0xcc, 0x70, 0x4f, 0x7 , 0x1d, 0x33, 0xed, 0xd2, 0xb3, 0xdf, 0x53, 0xa1, 0xe9, 
-	0x68, 0x7c, 0xd9, 0x5a, 0xf2, 0x65, 0x16, 0xf1, 0xdb, 0x31, 0x6c, 0xb0, 0xc1, 
-	0x45, 0xf5, 0x27, 0xfa, 0x9e, 0xbf, 0xe4, 0x57, 0x3b, 0xaa, 0x45, 0x24, 0x77, 
-	0xc , 0x1b, 0x5 , 0x79, 0xc3, 0xe , 0x86, 0xb4, 0x35, 0x2b, 0xb0, 0xb2, 0x49, 
-	0x20, 0x1f, 0x30, 0xf9, 0x62, 0xc0, 0xc7, 0x38, 0xe5, 0xbd, 0xb1, 0x90, 0x5 , 
-	0x50, 0x86, 0xe9, 0x42, 0xf9, 0x72, 0x80, 0x54, 0xfb, 0x56, 0x32, 0xbf, 0x43, 
-	0xa2, 0x9a, 0x8c, 0xb4, 0x96, 0x9e, 0x65, 0x4c, 0x60, 0x75, 0xa7, 0xab, 0x6 , 
-	0xf9, 0x3a, 0x37, 0x63, 0x53, 0x4d, 0x0 , 0x7f, 0x9e, 0x1c, 0xb0, 0xec, 0x7 , 
-	0x5f, 0xca, 0xa0, 0x8 , 0x15, 0xb0, 0x4f, 0xd7, 0x34, 0x93, 0xb9, 0x52, 0x84, 
-	0xa0, 0xec, 0xc , 0x31, 0xf7, 0xbf, 0xa , 0x92, 0x36, 0xf9, 0x76, 0xbf, 0x4f, 
-	0x5a, 0x6a, 0xe5, 0xbf, 0x87, 0x20, 0x7a, 0xd3, 0xbc, 0xb2, 0xdc, 0xf4, 0xf6, 
-	0xa6, 0x38, 0xa7, 0x7b, 0xa2, 0x39, 0xe3, 0x2a, 0x72, 0xa7, 0x8f, 0xe5, 0x44, 
-	0x31, 0x93, 0x8c, 0x77, 0x35, 0x34, 0x31, 0x36, 0xdf, 0x9b, 0xa0, 0xf5, 0xa7, 
-	0x12, 0xaa, 0xe , 0xce, 0xbe, 0xb4, 0x73, 0x14, 0xa8, 0xeb, 0xcc, 0xf4, 0x6 , 
-	0x47, 0x8d, 0x38, 0x52, 0x7e, 0x9c, 0xe2, 0xab, 0xb9, 0xc9, 0xe7, 0xe5, 0x3e, 
-	0xf4, 0x8d, 0xbf, 0x76, 0x71, 0xf8, 0xd2, 0xac, 0xb2, 0x81, 0x85, 0x91, 0xbd, 
-	0xf9, 0x34, 0xd1, 0x13, 0x9d, 0xdd, 0xba, 0xe , 0x86, 0x39, 0x24, 0xff, 0x0 , 
-	0x56, 0x37, 0x7f, 0xbb, 0x52, 0x8b, 0x59, 0xc7, 0x2c, 0x8c, 0x3f, 0xc , 0xff, 
-	0x0 , 0x2a, 0x8b, 0x7c, 0xa7, 0x8f, 0x31, 0xce, 0x7a, 0x9d, 0xd4, 0xaa, 0x59, 
-	0x7f, 0x88, 0x9f, 0xc6, 0x96, 0xa5, 0x47, 0x93, 0xaa, 0x65, 0x98, 0x6d, 0xc2, 
-	0x1c, 0xfd, 0x98, 0x3 , 0xdd, 0xa5, 0x61, 0xc7, 0xe1, 0x52, 0x33, 0xc0, 0x87, 
-	0x2f, 0x2b, 0x4c, 0x47, 0x64, 0xe1, 0x7f, 0x3f, 0xfe, 0xb5, 0x52, 0xcb, 0x1f, 
-	0xbc, 0x7f, 0x3a, 0x18, 0xa8, 0x1c, 0x9f, 0xa5, 0x4f, 0x2b, 0xea, 0xcd, 0xe3, 
-	0x56, 0x30, 0x5e, 0xec, 0x7e, 0xff, 0x0 , 0xe9, 0x22, 0x79, 0x6e, 0x99, 0xd7, 
-	0x0 , 0x4 , 0x5e, 0xca, 0xa3, 0xfc, 0xe6, 0xa3, 0xe , 0xaa, 0xbf, 0x74, 0x1f, 
-	0x5c, 0xe6, 0xa3, 0x51, 0xbd, 0xb8, 0xab, 0x36, 0xf6, 0xfb, 0xcf, 0x4c, 0xe3, 
-	0xb1, 0xad, 0xa9, 0xc3, 0x4b, 0x24, 0x73, 0x54, 0xab, 0x29, 0x3b, 0xc9, 0x89, 
-	0x8 , 0xca, 0xf2, 0x9d, 0x7a, 0xe , 0x6a, 0xed, 0x9a, 0x32, 0x83, 0x23, 0x0 , 
-	0x36, 0xf0, 0x30, 0x29, 0xf0, 0xdb, 0xf5, 0xc6, 0xdc, 0xe3, 0x19, 0xeb, 0x8a, 
-	0xb1, 0x1c, 0x66, 0x49, 0x4 , 0x4a, 0x3e, 0x55, 0xeb, 0x5b, 0x28, 0x72, 0xaf, 
-	0x33, 0x1e, 0x67, 0x39, 0x79, 0x4 , 0x1b, 0x98, 0x17, 0x23, 0x0 , 0xf4, 0xc7, 
-	0x15, 0x62, 0x35, 0x50, 0x37, 0x1f, 0xc2, 0x95, 0x94, 0x28, 0xc0, 0x18, 0xc5, 
-	0x2c, 0x47, 0x73, 0xe7, 0x3f, 0x28, 0xe9, 0xef, 0x5b, 0x42, 0x2a, 0x28, 0xce, 
-	0x55, 0x25, 0x52, 0x5e, 0x45, 0xab, 0x65, 0xef, 0x9a, 0xb2, 0xac, 0x7 , 0x6a, 
-	0xa4, 0xb2, 0x81, 0x49, 0xf6, 0x80, 0xbd, 0xeb, 0x51, 0x68, 0x68, 0xab, 0xe , 
-	0xe2, 0xa4, 0x56, 0x56, 0x23, 0x20, 0x71, 0xed, 0x59, 0x26, 0xf1, 0x47, 0x56, 
-	0xa0, 0x6a, 0x8 , 0x3f, 0x8f, 0xf5, 0xa0, 0x77, 0x36, 0x1a, 0x38, 0x99, 0x70, 
-	0x6a, 0xbd, 0xc5, 0xaa, 0x60, 0x14, 0x27, 0x8f, 0x43, 0x54, 0x57, 0x51, 0x8c, 
-	0xff, 0x0 , 0x17, 0xeb, 0x52, 0x7d, 0xbd, 0xf , 0x47, 0x15, 0x94, 0x95, 0xc3, 
-	0x98, 0xb7, 0x6e, 0xed, 0x1b, 0x65, 0x46, 0xa , 0x9f, 0xfb, 0xea, 0xa5, 0x9b, 
-	0x55, 0xda, 0xca, 0xac, 0x39, 0xc7, 0xe3, 0x59, 0xbf, 0x6c, 0x7 , 0xbd, 0x6 , 
-	0x78, 0xd8, 0xfc, 0xc3, 0x3f, 0x5a, 0xc9, 0xd2, 0x4c, 0x39, 0x99, 0xab, 0xe , 
-	0xa9, 0x21, 0x6c, 0x6 , 0x3c, 0x72, 0xa4, 0x9e, 0x95, 0xb1, 0xa7, 0x78, 0x80, 
-	0xc4, 0xa3, 0x3d, 0xc8, 0xef, 0x5c, 0xac, 0x6e, 0x81, 0xb7, 0x1 , 0x8a, 0x55, 
-	0x62, 0xa7, 0xe5, 0x3c, 0x52, 0x95, 0x1d, 0xd , 0xa3, 0x56, 0xc7, 0xa5, 0x69, 
-	0x3e, 0x21, 0x8a, 0x46, 0x23, 0x3d, 0x31, 0x9c, 0x1f, 0xa6, 0x2b, 0xa0, 0xd3, 
-	0xb5, 0xd , 0xf8, 0xc3, 0xe4, 0xe3, 0xb5, 0x79, 0xd , 0x9d, 0xdb, 0xc4, 0x46, 
-	0xc3, 0x8f, 0xa1, 0xfd, 0x2b, 0xb1, 0xf0, 0xae, 0xa4, 0xc5, 0x42, 0xc9, 0xd4, 
-	0xf7, 0x15, 0xc9, 0x52, 0x8d, 0x8e, 0x98, 0x55, 0xb9, 0xe8, 0x11, 0xdc, 0x86, 
-	0x5c, 0x2 , 0x41, 0x1e, 0xfd, 0x69, 0x7e, 0xd0, 0x4b, 0x7f, 0x3e, 0x6b, 0x26, 
-	0xc6, 0xe0, 0xb8, 0x0 , 0xb6, 0x39, 0xab, 0x8c, 0x32, 0xb9, 0x23, 0x3c, 0xf4, 
-	0xae, 0x77, 0x13, 0xa5, 0x48, 0xb9, 0x1d, 0xe1, 0x1d, 0x1f, 0x19, 0xe0, 0x73, 
-	0x4e, 0x4d, 0x40, 0xf4, 0x2d, 0x8e, 0x71, 0x80, 0x7f, 0x5a, 0xc9, 0x99, 0x98, 
-	0xc , 0x8f, 0xff, 0x0 , 0x5d, 0x51, 0xba, 0xbb, 0x68, 0xd7, 0x77, 0xa7, 0xad, 
-	0x2e, 0x5b, 0x8d, 0xc8, 0xe8, 0x27, 0xd6, 0xd2, 0x9 , 0x9 , 0xf3, 0x3 , 0x6e, 
-	0x3f, 0x20, 0x5f, 0x5a, 0xc1, 0xd6, 0x3c, 0x57, 0x32, 0x5e, 0xb4, 0x31, 0x49, 
-	0xb5, 0x17, 0x82, 0xf , 0x5 , 0xc9, 0xe7, 0xaf, 0xf5, 0xae, 0x76, 0xf2, 0xec, 
-	0x89, 0x19, 0xb6, 0xed, 0x66, 0x72, 0x49, 0xf5, 0xeb, 0xc6, 0x7f, 0x1a, 0xc5, 
-	0xb8, 0xbb, 0x5f, 0x39, 0xa5, 0xf3, 0x30, 0xc4, 0xf5, 0xcf, 0x4f, 0x6c, 0xfd, 
-	0x71, 0xf9, 0x55, 0x2a, 0x57, 0x32, 0x95, 0x53, 0xa2, 0xd4, 0xb5, 0x4f, 0x3e, 
-	0xe5, 0xa6, 0xbc, 0x91, 0xa4, 0x2a, 0x78, 0x8f, 0x39, 0xc9, 0xf7, 0x27, 0xf9, 
-	0x74, 0xac, 0xa9, 0x75, 0x7 , 0xba, 0x9f, 0x79, 0x6f, 0x31, 0xb7, 0x7c, 0x83, 
-	0x1f, 0x28, 0xfa, 0xe , 0x87, 0x1e, 0xf5, 0x81, 0x75, 0xa8, 0x20, 0x6e, 0x70, 
-	0xde, 0xbc, 0x75, 0xa2, 0xd , 0x75, 0x63, 0xe0, 0xc , 0x7a, 0x56, 0xab, 0xe , 
-	0xcc, 0x5d, 0x53, 0xaa, 0xb1, 0xd3, 0x9e, 0xea, 0x45, 0x92, 0xe2, 0x46, 0xe7, 
-	0xf8, 0x49, 0xae, 0xe3, 0xc3, 0x3a, 0x6d, 0x9c, 0x2b, 0x18, 0x62, 0xbf, 0x28, 
-	0xca, 0xa8, 0xed, 0x5e, 0x61, 0x67, 0xe2, 0x64, 0x52, 0x32, 0xdf, 0xad, 0x74, 
-	0x3a, 0x6f, 0x8a, 0xed, 0x95, 0x14, 0x19, 0xb9, 0xf6, 0x6a, 0x89, 0xd1, 0x66, 
-	0xd4, 0xe6, 0x8f, 0x5d, 0xd3, 0xe5, 0xb5, 0x45, 0x50, 0x81, 0x47, 0xbd, 0x6a, 
-	0x5a, 0xde, 0xa6, 0xd0, 0x57, 0xb0, 0xe8, 0x2b, 0xc9, 0x2d, 0x3c, 0x61, 0x6e, 
-	0x48, 0xfd, 0xf0, 0xf6, 0xe6, 0xb5, 0xac, 0xfc, 0x5b, 0x1e, 0xd1, 0xfb, 0xc1, 
-	0xf8, 0xb5, 0x60, 0xe9, 0x1d, 0x50, 0xa8, 0xae, 0x7a, 0xad, 0xbe, 0xa4, 0xb1, 
-	0xed, 0x24, 0xe7, 0xd0, 0x66, 0xb4, 0x4e, 0xa0, 0xa , 0x81, 0xf2, 0x96, 0xaf, 
-	0x31, 0xb2, 0xf1, 0x22, 0x15, 0xce, 0xf0, 0x4f, 0x18, 0xad, 0x7b, 0x2d, 0x7f, 
-	0x7c, 0x80, 0x34, 0x8b, 0xcd, 0x65, 0x2a, 0x6c, 0xde, 0x32, 0x4c, 0xd8, 0xf1, 
-	0x55, 0xa4, 0x77, 0x30, 0xf9, 0xa0, 0x6d, 0xc8, 0x39, 0x23, 0xb8, 0xf7, 0xf5, 
-	0xaf, 0x9f, 0xbe, 0x2d, 0xe9, 0xde, 0x5d, 0xc4, 0x8a, 0x7d, 0x4e, 0xd , 0x7b, 
-	0xea, 0xdf, 0x24, 0xd6, 0xdb, 0x49, 0x4 , 0x62, 0xbc, 0x83, 0xe2, 0xec, 0x48, 
-	0xe4, 0xe3, 0x9e, 0xbc, 0x8a, 0x29, 0x5d, 0x48, 0xe6, 0xc5, 0x46, 0xf1, 0x3e, 
-	0x72, 0xb8, 0x5d, 0x97, 0x4c, 0xf , 0x62, 0x6a, 0x4b, 0x75, 0x5 , 0x57, 0xfc, 
-	0xfa, 0xd3, 0xf5, 0x85, 0xd9, 0xa9, 0x4c, 0x3d, 0x1c, 0xff, 0x0 , 0x3a, 0x6d, 
-	0xbf, 0xfc, 0xb3, 0xf4, 0xcd, 0x7a, 0x32, 0xd8, 0xf3, 0x70, 0xeb, 0xde, 0x2c, 
-	0x46, 0xb , 0xc2, 0x7 , 0x7e, 0x95, 0x2d, 0xb3, 0x14, 0x6c, 0x3 , 0xd4, 0x8c, 
-	0xfa, 0x7b, 0x53, 0x23, 0x25, 0x9 , 0x3f, 0xdd, 0x71, 0x53, 0x2a, 0x3 , 0xb9, 
-	0x40, 0xed, 0xc7, 0xe0, 0x6b, 0x9e, 0x4f, 0xb9, 0xec, 0xd2, 0x8e, 0xcd, 0x6e, 
-	0x68, 0x58, 0x5c, 0x34, 0x71, 0xab, 0xe , 0x83, 0xa8, 0x3e, 0x95, 0xb3, 0x19, 
-	0x59, 0xa3, 0xc8, 0x6f, 0x98, 0x7f, 0x74, 0xf3, 0x58, 0x16, 0xe3, 0x74, 0x6c, 
-	0xa4, 0x70, 0x47, 0x3f, 0xe7, 0xf1, 0xab, 0x31, 0x4d, 0x35, 0xb1, 0xe , 0xae, 
-	0x54, 0x0 , 0xe , 0x7d, 0x45, 0x70, 0xd6, 0xa7, 0xcc, 0xf4, 0xdc, 0xfa, 0x4c, 
-	0xe , 0x29, 0xd2, 0x8d, 0xa6, 0xaf, 0x13, 0x4e, 0xee, 0x5 , 0xb9, 0x8c, 0x17, 
-	0x4d, 0xac, 0xbd, 0xc0, 0xa8, 0x6d, 0xc4, 0xf1, 0x2e, 0xc6, 0xf9, 0xd5, 0x7a, 
-	0x7d, 0x2a, 0x5b, 0x7d, 0x4a, 0x29, 0xb2, 0x26, 0xfd, 0xd3, 0xf5, 0xc , 0x3a, 
-	0x35, 0x5b, 0x86, 0x28, 0xe4, 0x5d, 0xca, 0xd9, 0xf7, 0x53, 0x9a, 0xe6, 0xe6, 
-	0x94, 0x15, 0xa4, 0x8f, 0x57, 0xd9, 0xd2, 0xac, 0xf9, 0xe9, 0x4a, 0xef, 0xfa, 
-	0xdc, 0xaa, 0xa1, 0x5c, 0x5 , 0x60, 0x31, 0x9f, 0xba, 0xdd, 0x2a, 0xa5, 0xcd, 
-	0x93, 0xc6, 0xe5, 0xe2, 0xf9, 0x7b, 0x67, 0x3d, 0x7d, 0x89, 0xad, 0x68, 0xe3, 
-	0x50, 0x70, 0x8 , 0x1e, 0xc7, 0x8c, 0xd5, 0x98, 0x6d, 0x83, 0x29, 0x0 , 0x65, 
-	0x4f, 0xa6, 0x28, 0x55, 0x1c, 0x76, 0x9 , 0xe1, 0x63, 0x51, 0x25, 0x25, 0xa9, 
-	0xce, 0xc1, 0x24, 0xe1, 0x99, 0x4e, 0x77, 0x3 , 0xf7, 0x94, 0xe0, 0xfd, 0xe , 
-	0x2a, 0xe5, 0xb5, 0xe4, 0xa8, 0xca, 0xb , 0xb3, 0x2f, 0xd0, 0x7f, 0x4c, 0x55, 
-	0xe9, 0xb4, 0x95, 0x2c, 0x59, 0x86, 0xd6, 0x23, 0xef, 0x2b, 0x63, 0x3f, 0x87, 
-	0xad, 0x42, 0xb6, 0xd , 0xbb, 0x31, 0xbb, 0x7a, 0x7f, 0xac, 0x52, 0x3e, 0xbe, 
-	0xd5, 0x7c, 0xd1, 0x99, 0x82, 0xa7, 0x56, 0x8f, 0x56, 0x4d, 0x15, 0xfe, 0xcc, 
-	0x16, 0x18, 0x5c, 0x72, 0x41, 0xc6, 0x3f, 0x4a, 0xb9, 0x6f, 0xa9, 0xc2, 0x1b, 
-	0x4 , 0x7e, 0xa3, 0xfa, 0xd5, 0x45, 0xb6, 0x97, 0x8d, 0xfb, 0x71, 0xdc, 0x9c, 
-	0x54, 0xd1, 0xd9, 0x4b, 0xce, 0xc8, 0xd6, 0x40, 0x39, 0x20, 0x63, 0x23, 0xe8, 
-	0x7f, 0xc6, 0xa9, 0xe1, 0xe3, 0x25, 0x74, 0x63, 0x1c, 0xd2, 0xac, 0x25, 0xcb, 
-	0x51, 0x7f, 0xc1, 0xfc, 0x4b, 0xab, 0xa9, 0x5b, 0x15, 0xcb, 0x39, 0x5f, 0xf8, 
-	0xd , 0x4d, 0x6f, 0xa9, 0xc1, 0x9f, 0x94, 0x86, 0xfc, 0x3f, 0xc2, 0xaa, 0x45, 
-	0x68, 0xb2, 0xfc, 0xa9, 0xb , 0x6e, 0x3 , 0x81, 0x91, 0x9f, 0xca, 0x9f, 0x1e, 
-	0x98, 0x4b, 0x66, 0x40, 0x14, 0x77, 0xc2, 0xf3, 0x4b, 0xd8, 0x4d, 0x2d, 0x19, 
-	0xaf, 0xf6, 0x95, 0x16, 0xed, 0x38, 0xfd, 0xff, 0x0 , 0xd5, 0x8d, 0x38, 0xf5, 
-	0x18, 0xf6, 0xe0, 0xd , 0xbf, 0x86, 0x3f, 0xa5, 0x3b, 0xed, 0x71, 0x96, 0xe7, 
-	0x69, 0xc7, 0xb1, 0xac, 0xef, 0xb2, 0x4d, 0x8d, 0xd0, 0xc6, 0xf8, 0xe8, 0xa5, 
-	0x96, 0x95, 0x62, 0xbb, 0x8d, 0xbf, 0x7a, 0xe1, 0x7f, 0x5f, 0xd2, 0xb4, 0x85, 
-	0x3a, 0xc8, 0xe5, 0xad, 0x8c, 0xc0, 0x4b, 0xe2, 0xd3, 0xe4, 0x69, 0xb5, 0xc3, 
-	0xb0, 0xc4, 0x63, 0x6f, 0xba, 0x8c, 0x54, 0x2e, 0xb1, 0xaf, 0xef, 0x24, 0x7c, 
-	0x9a, 0xa4, 0xd2, 0xb7, 0xdd, 0x41, 0x9f, 0x72, 0x6 , 0x69, 0x14, 0xce, 0xcd, 
-	0x80, 0x33, 0xf4, 0xae, 0xda, 0x54, 0xeb, 0x7a, 0x1f, 0x3f, 0x8d, 0xc5, 0x60, 
-	0x1e, 0xc9, 0xb7, 0xfd, 0x74, 0xb9, 0x34, 0xf2, 0x7 , 0xe1, 0x14, 0x1 , 0xdc, 
-	0xd4, 0x38, 0x1d, 0x4d, 0xe , 0x36, 0xf1, 0x9c, 0x9f, 0xad, 0x1f, 0x8d, 0x7a, 
-	0x34, 0xe2, 0xd2, 0xdc, 0xf9, 0x5c, 0x4d, 0x68, 0xce, 0x5a, 0x2f, 0xeb, 0xd0, 
-	0x28, 0xa3, 0x1c, 0x66, 0x8a, 0xdd, 0x1c, 0xf , 0x70, 0xa2, 0x8a, 0x42, 0x69, 
-	0x88, 0x4a, 0x28, 0xa2, 0x80, 0xa , 0x69, 0xa7, 0x53, 0x4d, 0x0 , 0x14, 0x51, 
-	0x45, 0x0 , 0x1f, 0x8d, 0x1f, 0x8d, 0x1f, 0x85, 0x1f, 0x85, 0x0 , 0x23, 0x7d, 
-	0x69, 0x29, 0x71, 0xed, 0x48, 0xdc, 0x50, 0x1 , 0x4d, 0x34, 0xad, 0x49, 0x40, 
-	0x7 , 0x7a, 0x46, 0xa5, 0xa4, 0x6a, 0x0 , 0x4a, 0x28, 0xa3, 0xf0, 0xa0, 0x3 , 
-	0xf1, 0xa3, 0xf1, 0xa3, 0xf0, 0xa3, 0xf0, 0xa0, 0x6 , 0xd1, 0x45, 0x14, 0x0 , 
-	0xda, 0x28, 0xa2, 0x80, 0x10, 0x9a, 0x4a, 0x28, 0xa0, 0x3 , 0xf1, 0xa3, 0xf1, 
-	0xa3, 0xf0, 0xa3, 0xf0, 0xa6, 0x3 , 0x68, 0xa2, 0x8a, 0x0 , 0x6e, 0x28, 0xa3, 
-	0x34, 0x53, 0x1 , 0xb4, 0x51, 0x45, 0x0 , 0x1f, 0x8d, 0x35, 0xa9, 0xdf, 0x85, 
-	0x34, 0xd0, 0x1 , 0x48, 0xd4, 0xb4, 0x8d, 0x40, 0xd , 0x6a, 0x4a, 0x56, 0xa4, 
-	0xa0, 0x2 , 0x8f, 0xc6, 0x8a, 0x3f, 0xa , 0x0 , 0x29, 0xcb, 0xd2, 0x9b, 0x4a, 
-	0xb4, 0x0 , 0xe5, 0xa5, 0xa4, 0x5a, 0x5a, 0x6 , 0xb , 0x4e, 0xfc, 0x69, 0x3f, 
-	0xa , 0x5f, 0xc2, 0x80, 0xa , 0x31, 0x45, 0x39, 0x7a, 0x50, 0xc , 0x29, 0xc2, 
-	0x91, 0x69, 0x68, 0x0 , 0x5a, 0x77, 0xe3, 0x4d, 0x5a, 0x77, 0xe1, 0x40, 0x5 , 
-	0x14, 0x51, 0x40, 0xe , 0xa7, 0x2f, 0x4a, 0x6d, 0x2a, 0xd0, 0x2 , 0xd1, 0x45, 
-	0x2a, 0xfd, 0x2a, 0x46, 0x2f, 0xe3, 0x45, 0x1f, 0x85, 0x14, 0x0 , 0x52, 0xad, 
-	0x20, 0xa7, 0x50, 0x2 , 0xad, 0x2d, 0x22, 0xd2, 0xd0, 0x20, 0xa5, 0x1f, 0x5a, 
-	0x45, 0xa5, 0xef, 0xd2, 0x80, 0x17, 0xf1, 0xa2, 0x8f, 0xc2, 0x8a, 0x0 , 0x29, 
-	0xc3, 0xee, 0xd3, 0x69, 0x56, 0x81, 0xb , 0x46, 0x28, 0xed, 0x4a, 0xb4, 0x14, 
-	0x2d, 0x14, 0x51, 0x40, 0x80, 0x53, 0xbf, 0x1a, 0x68, 0xa7, 0x7e, 0x14, 0xc , 
-	0x3f, 0x1a, 0x3f, 0x1a, 0x3f, 0xa , 0x28, 0x0 , 0xa4, 0x63, 0x8e, 0x9d, 0x7b, 
-	0x52, 0xd2, 0x63, 0x32, 0x1f, 0xf6, 0x78, 0xa0, 0x3 , 0x18, 0xc2, 0x8e, 0xd5, 
-	0xd , 0xec, 0xa9, 0xd , 0xac, 0x92, 0xb8, 0xf9, 0x40, 0xe7, 0x1e, 0x9f, 0xe7, 
-	0xf9, 0xd4, 0xfd, 0x3e, 0x6f, 0x41, 0x54, 0xef, 0x1 , 0x96, 0xf2, 0x1b, 0x7c, 
-	0xf1, 0x1f, 0xef, 0xa4, 0x1e, 0xa0, 0x74, 0x1f, 0x8b, 0x63, 0xf2, 0xa4, 0xc7, 
-	0x1d, 0xc2, 0xcd, 0x4d, 0xad, 0x93, 0xcf, 0x2e, 0x7c, 0xe7, 0xcb, 0xc9, 0xfe, 
-	0xf1, 0xed, 0xf8, 0x70, 0x3f, 0xa , 0xc6, 0xd7, 0x66, 0x6b, 0x5d, 0x14, 0xae, 
-	0x1 , 0x9a, 0xf1, 0x8a, 0x81, 0xdf, 0x1d, 0xcf, 0xf4, 0xfc, 0x6b, 0x73, 0x50, 
-	0x5 , 0xa1, 0xd8, 0xbc, 0xee, 0x21, 0x47, 0xbf, 0x73, 0xfe, 0x15, 0x84, 0x2 , 
-	0xdf, 0xf8, 0xab, 0x39, 0x1e, 0x45, 0x82, 0x81, 0x93, 0xd0, 0x95, 0xcf, 0xf5, 
-	0xcf, 0xe5, 0x51, 0x3d, 0xac, 0x6f, 0x47, 0x7e, 0x67, 0xd0, 0x6d, 0xbd, 0xb2, 
-	0x59, 0xd8, 0xc7, 0x6b, 0x8c, 0xb2, 0xfc, 0xf2, 0x67, 0xbb, 0x63, 0x18, 0x3e, 
-	0xd9, 0xc9, 0x3e, 0xcb, 0x54, 0xdc, 0xc6, 0xb0, 0xcb, 0x33, 0xc9, 0xfe, 0xb4, 
-	0xfc, 0xcc, 0xdd, 0x71, 0xce, 0x4f, 0xe6, 0x2a, 0xfb, 0x16, 0x97, 0xcc, 0x79, 
-	0x24, 0xc2, 0x1f, 0xbc, 0x7d, 0x77, 0x76, 0xfc, 0x0 , 0x1f, 0xaf, 0xad, 0x65, 
-	0x6b, 0x80, 0x18, 0xd9, 0x6 , 0x10, 0x65, 0x53, 0xd , 0xfc, 0x19, 0xe9, 0x9f, 
-	0x53, 0x8c, 0x9f, 0xc0, 0xd6, 0x6c, 0xd6, 0x2e, 0xef, 0x53, 0x7 , 0x54, 0x95, 
-	0xa4, 0x91, 0x5c, 0xae, 0xd0, 0xcb, 0x95, 0x18, 0xed, 0x93, 0xcf, 0xe2, 0x73, 
-	0x54, 0xfd, 0xcd, 0x5a, 0xd5, 0xe6, 0x13, 0x5e, 0x33, 0x28, 0xda, 0x8b, 0x85, 
-	0x45, 0xf4, 0x50, 0x30, 0x3f, 0x95, 0x55, 0xc7, 0xaf, 0x7a, 0xc8, 0xd4, 0x7c, 
-	0x6e, 0x57, 0x95, 0x62, 0x3f, 0x1a, 0x9e, 0x3b, 0xa2, 0x78, 0x96, 0x34, 0x75, 
-	0xf7, 0x1c, 0xd5, 0x6e, 0x58, 0xe1, 0x69, 0xca, 0xa0, 0x71, 0x52, 0xd2, 0x66, 
-	0xd4, 0xea, 0x4e, 0x3a, 0x45, 0xe8, 0x58, 0x59, 0x60, 0x61, 0x91, 0x6e, 0x57, 
-	0x1e, 0xf4, 0x35, 0xc8, 0xe9, 0x1c, 0x6a, 0x3e, 0xbc, 0xd4, 0x3c, 0xd2, 0x12, 
-	0x14, 0x74, 0xe6, 0x97, 0x2a, 0x36, 0xf6, 0xd3, 0x4b, 0xb7, 0xc9, 0xf , 0x92, 
-	0x42, 0xdf, 0x34, 0x8d, 0xf4, 0x15, 0x16, 0xec, 0xb7, 0x53, 0x4d, 0x76, 0x25, 
-	0xb2, 0x68, 0x3 , 0x18, 0xc7, 0x7a, 0xb4, 0x8e, 0x59, 0x54, 0x72, 0x63, 0xd6, 
-	0x4a, 0x52, 0xe3, 0xbd, 0x45, 0xd2, 0x93, 0x19, 0xa7, 0x64, 0x2f, 0x69, 0x2d, 
-	0x8b, 0x1b, 0xc5, 0x21, 0x7c, 0x2e, 0x7a, 0xa , 0x89, 0xa9, 0x24, 0x39, 0xc0, 
-	0xcd, 0x22, 0xa5, 0x51, 0xa4, 0x2b, 0x4a, 0x7a, 0x6 , 0x3 , 0xde, 0x9b, 0xbb, 
-	0xdf, 0x3f, 0x4a, 0x6a, 0x8c, 0x9e, 0xb4, 0x31, 0x3 , 0x8c, 0xf5, 0xeb, 0x8a, 
-	0xb3, 0x99, 0xce, 0x4f, 0x72, 0xd5, 0xaf, 0xcd, 0xfe, 0x35, 0xad, 0x68, 0xa0, 
-	0x6d, 0x0 , 0x75, 0x15, 0x93, 0xa6, 0xe3, 0x76, 0x7 , 0xad, 0x6c, 0x5b, 0xe7, 
-	0x72, 0xed, 0x19, 0x35, 0xd5, 0x4e, 0xca, 0x24, 0xab, 0xc9, 0x96, 0xfe, 0xec, 
-	0x62, 0x38, 0xc7, 0xcc, 0xdd, 0xfd, 0x3d, 0xea, 0xed, 0xac, 0x2 , 0x18, 0x41, 
-	0xfd, 0x69, 0x96, 0x30, 0xed, 0xf9, 0x8f, 0x5e, 0xb5, 0x69, 0xfb, 0x1 , 0x55, 
-	0x6e, 0xac, 0xa9, 0x49, 0x5b, 0x96, 0x25, 0x2b, 0xaf, 0xbd, 0x81, 0xd0, 0x9e, 
-	0x6a, 0x26, 0x97, 0x67, 0xb5, 0x59, 0x9d, 0x41, 0x8f, 0x23, 0x90, 0x6b, 0x3a, 
-	0xec, 0x60, 0x60, 0xa , 0xa4, 0x48, 0x4d, 0x77, 0x8f, 0xe2, 0xfc, 0xaa, 0x9c, 
-	0xd7, 0xa4, 0x77, 0xaa, 0xd7, 0x8d, 0xb3, 0xab, 0x7d, 0x2a, 0x3d, 0x2e, 0xdd, 
-	0xf5, 0xb , 0xc1, 0x9 , 0x6f, 0x2d, 0x70, 0x49, 0xf5, 0x3f, 0x4a, 0x39, 0x9d, 
-	0xf9, 0x56, 0xe4, 0xca, 0x56, 0x1f, 0x25, 0xe3, 0x96, 0xc6, 0xef, 0xca, 0xa2, 
-	0x17, 0xe , 0xcd, 0x80, 0xac, 0x4f, 0x71, 0x5d, 0x96, 0x9d, 0xa2, 0x5b, 0x5b, 
-	0x47, 0xf2, 0xc2, 0x1 , 0xdb, 0xf7, 0x8f, 0x53, 0xf8, 0xd6, 0x2d, 0xc5, 0xac, 
-	0x9 , 0xa9, 0x4c, 0x8 , 0x3b, 0xb7, 0x77, 0xab, 0x9e, 0x1e, 0x51, 0x49, 0xc9, 
-	0x98, 0x3a, 0xec, 0xc5, 0x79, 0xd9, 0xe , 0x1b, 0x2b, 0xf8, 0xd5, 0xeb, 0x8b, 
-	0xd , 0x5a, 0xd7, 0x45, 0xb2, 0xd6, 0x2e, 0xac, 0x2e, 0xe0, 0xd3, 0xf5, 0x6 , 
-	0x91, 0x6c, 0xee, 0xa4, 0x89, 0x96, 0x2b, 0x83, 0x19, 0x1 , 0xc2, 0x31, 0xe1, 
-	0xb6, 0x96, 0x5c, 0xe3, 0xa6, 0x45, 0x33, 0x52, 0x8c, 0xb4, 0x99, 0x11, 0x8d, 
-	0xa0, 0x75, 0xc7, 0x5f, 0x5a, 0x65, 0xbc, 0x92, 0xdc, 0xa4, 0x36, 0x72, 0x5c, 
-	0xcd, 0x24, 0x56, 0xe5, 0x8c, 0x11, 0x33, 0x92, 0x91, 0xee, 0xe5, 0xb6, 0xa9, 
-	0xe0, 0x67, 0x3 , 0x38, 0xeb, 0x8a, 0xe6, 0x71, 0x7c, 0xd6, 0x29, 0x54, 0x76, 
-	0x24, 0xb7, 0xb8, 0x63, 0xd2, 0x46, 0xfc, 0xea, 0xcc, 0x77, 0x12, 0x2e, 0x3e, 
-	0x60, 0x6a, 0x9 , 0x34, 0xdd, 0xd7, 0x28, 0x91, 0xbf, 0x96, 0xce, 0x71, 0x8c, 
-	0x7f, 0x4a, 0x7d, 0xc5, 0xac, 0xf6, 0x32, 0x5 , 0xb9, 0x19, 0x52, 0x7e, 0x57, 
-	0x3 , 0x83, 0x57, 0x28, 0xce, 0xe , 0xc5, 0xc2, 0xa2, 0x91, 0x7e, 0xb , 0x92, 
-	0x79, 0xcd, 0x5a, 0x8e, 0x72, 0x7a, 0x1a, 0xcb, 0x84, 0x67, 0x91, 0x56, 0x63, 
-	0x24, 0x55, 0xc5, 0xdd, 0x1a, 0x1a, 0x90, 0xc8, 0x4f, 0x35, 0xb9, 0xa0, 0xdc, 
-	0x94, 0x99, 0x40, 0x3d, 0xeb, 0x9c, 0xb5, 0x6c, 0xd6, 0xbe, 0x94, 0xdb, 0x64, 
-	0x53, 0x8e, 0xf5, 0x13, 0x8d, 0xd1, 0xbd, 0x27, 0xa9, 0xea, 0x1e, 0x1d, 0x6 , 
-	0x65, 0x4 , 0x7b, 0x77, 0xeb, 0x5d, 0xc , 0x36, 0xae, 0x13, 0x71, 0x1c, 0xe2, 
-	0xb0, 0x7c, 0x6 , 0x16, 0x44, 0x52, 0x33, 0xdb, 0xb5, 0x77, 0xf6, 0xb6, 0xc1, 
-	0xa1, 0x7 , 0xaf, 0x1d, 0x85, 0x79, 0x15, 0x5d, 0x99, 0xea, 0xd3, 0x8d, 0xd1, 
-	0xcb, 0xdd, 0x5b, 0x95, 0x5c, 0xed, 0xe9, 0xc6, 0x7a, 0xff, 0x0 , 0x9e, 0x95, 
-	0xcf, 0xeb, 0x11, 0x1d, 0xa5, 0xb1, 0xef, 0x5e, 0x81, 0x77, 0x61, 0xf5, 0xcf, 
-	0xa6, 0x2b, 0x91, 0xf1, 0x55, 0xbf, 0x95, 0x1b, 0x7d, 0xd , 0x67, 0x19, 0x95, 
-	0x2a, 0x67, 0x9d, 0xeb, 0xd7, 0x46, 0x15, 0x65, 0x53, 0xd0, 0x63, 0x9a, 0xe4, 
-	0xf5, 0xb , 0xf6, 0xc9, 0xf9, 0xab, 0x67, 0xc5, 0xce, 0xc2, 0x46, 0x0 , 0x92, 
-	0x4d, 0x72, 0x37, 0x4b, 0x23, 0x49, 0xce, 0x6b, 0xbe, 0x91, 0xc1, 0x59, 0xb4, 
-	0x17, 0x17, 0xcd, 0x9f, 0x94, 0xe6, 0xab, 0x9b, 0x8b, 0x82, 0xdc, 0x30, 0x14, 
-	0xd9, 0x2 , 0xab, 0x0 , 0x46, 0x58, 0x9c, 0x0 , 0x7 , 0x34, 0xd8, 0x63, 0x96, 
-	0x77, 0x60, 0xf , 0x96, 0x17, 0x8c, 0x63, 0x9a, 0xe9, 0xf4, 0x38, 0x25, 0x3b, 
-	0x6e, 0x4b, 0xe6, 0x4b, 0xd4, 0xcb, 0x83, 0xf5, 0xa6, 0x8b, 0xa7, 0x27, 0x6c, 
-	0x73, 0x39, 0x6c, 0xf3, 0x83, 0xd2, 0xa8, 0x5d, 0x46, 0xc2, 0x46, 0xe , 0xe7, 
-	0x86, 0x38, 0x4 , 0xf5, 0xad, 0x68, 0x75, 0x1d, 0x5f, 0x52, 0xd2, 0x74, 0xdd, 
-	0x1a, 0x5b, 0xa1, 0x35, 0x8e, 0x94, 0xb2, 0xfd, 0x92, 0x21, 0xa , 0xaf, 0x95, 
-	0xe6, 0x3e, 0xf7, 0xf9, 0x80, 0xcb, 0x65, 0xbf, 0xbc, 0x4e, 0x3b, 0x62, 0xa3, 
-	0x93, 0x99, 0xd9, 0x92, 0xf1, 0xd , 0x6c, 0x24, 0x57, 0xf2, 0x9 , 0xa , 0xa4, 
-	0xd2, 0x71, 0xd6, 0xaf, 0x58, 0xea, 0x77, 0xc7, 0x95, 0x9a, 0x40, 0x33, 0x8c, 
-	0xb0, 0xc0, 0xae, 0x87, 0xe1, 0xf , 0x83, 0x22, 0xf1, 0xf , 0x8c, 0x61, 0xb4, 
-	0xbc, 0xde, 0x88, 0xe1, 0xb7, 0x32, 0x1e, 0x40, 0x3 , 0xfc, 0x6b, 0xd1, 0x3e, 
-	0x20, 0x7c, 0x11, 0x1a, 0x7a, 0xab, 0xe8, 0xba, 0x8b, 0x48, 0x5c, 0x70, 0x93, 
-	0x2f, 0x24, 0xfd, 0x45, 0x29, 0xd1, 0x8a, 0x6d, 0x5c, 0xd2, 0x9e, 0x26, 0x6e, 
-	0xc7, 0x9f, 0x68, 0x9e, 0x25, 0xba, 0xb7, 0x65, 0x59, 0x9c, 0xba, 0xff, 0x0 , 
-	0x78, 0x1c, 0xe7, 0xda, 0xbb, 0x7d, 0x7 , 0xc4, 0x51, 0x32, 0xab, 0x9 , 0x78, 
-	0x3e, 0xf5, 0xe4, 0xba, 0xd6, 0x83, 0xa9, 0xe8, 0xfa, 0xcc, 0xd6, 0x33, 0xc4, 
-	0xd1, 0xcd, 0x1b, 0x61, 0xd3, 0x3c, 0x1f, 0x71, 0x57, 0xbc, 0x3e, 0x6f, 0x52, 
-	0x75, 0x55, 0x86, 0x4f, 0x98, 0xfb, 0xd7, 0x2c, 0xa0, 0x7a, 0x34, 0x6b, 0xc9, 
-	0xb3, 0xdf, 0x34, 0x7d, 0x68, 0xcd, 0x1e, 0x15, 0xbb, 0x7a, 0xd7, 0x3f, 0xf1, 
-	0x2 , 0x23, 0x2c, 0x3b, 0xf3, 0xd6, 0x9b, 0xe0, 0x8b, 0x6b, 0x96, 0x8d, 0xb , 
-	0x2b, 0x7c, 0xdf, 0xa5, 0x6b, 0x78, 0xd2, 0xcc, 0xa5, 0x8e, 0xe2, 0x38, 0x3 , 
-	0x35, 0xc5, 0x3b, 0x29, 0x23, 0xb6, 0xa2, 0x6e, 0x3a, 0x9f, 0x35, 0x78, 0xb6, 
-	0x3f, 0x2b, 0x58, 0x99, 0x71, 0xfc, 0x66, 0xaa, 0x5b, 0xfd, 0xd0, 0x7f, 0xda, 
-	0xad, 0x6f, 0x88, 0x91, 0x18, 0xb5, 0xb9, 0x7 , 0xfb, 0x55, 0x91, 0x6a, 0x72, 
-	0xad, 0xcf, 0x51, 0xc5, 0x76, 0x7d, 0x94, 0x79, 0xd4, 0x9d, 0xaa, 0x17, 0x5c, 
-	0x62, 0x37, 0xfa, 0xd5, 0x98, 0x8 , 0x65, 0x53, 0xd8, 0x8a, 0x83, 0xef, 0xc7, 
-	0xc7, 0xf1, 0x53, 0xad, 0xdf, 0x62, 0xae, 0x3b, 0x1c, 0x7d, 0x2b, 0x99, 0xea, 
-	0x8f, 0x7e, 0x9d, 0xa3, 0x3b, 0xf4, 0x2e, 0x5b, 0xaf, 0xe7, 0x8e, 0x2a, 0xca, 
-	0x47, 0xe7, 0x5b, 0x98, 0x99, 0x8e, 0x40, 0x2b, 0xc7, 0x5f, 0xf3, 0xfe, 0x15, 
-	0x5d, 0x3e, 0x61, 0x91, 0xf8, 0x55, 0xab, 0x73, 0xb6, 0x5c, 0x8e, 0x8d, 0xc7, 
-	0xd2, 0xb9, 0xa6, 0xcf, 0x62, 0x84, 0x53, 0xd1, 0xec, 0x52, 0x2e, 0x42, 0x86, 
-	0x2d, 0x86, 0x5e, 0x8 , 0xc7, 0x71, 0xdf, 0xf1, 0xe6, 0xa4, 0xb7, 0x98, 0xc1, 
-	0x2e, 0x53, 0x2a, 0xac, 0x7a, 0x6 , 0xe3, 0x3e, 0xd5, 0x3d, 0xd5, 0xba, 0xbc, 
-	0xa4, 0xaf, 0x5 , 0xc7, 0x23, 0xbf, 0x5c, 0xe4, 0x7d, 0xd , 0x50, 0x8d, 0xca, 
-	0xc9, 0xe5, 0xca, 0x3e, 0x75, 0x3b, 0x5c, 0x63, 0xa7, 0xbd, 0x69, 0x1b, 0x4d, 
-	0x1c, 0xb5, 0x39, 0xe8, 0x54, 0x5a, 0x9b, 0x56, 0xf7, 0xf7, 0xb , 0xca, 0x4b, 
-	0xe6, 0xf , 0x42, 0x33, 0x57, 0x2d, 0xf5, 0x67, 0x12, 0xf , 0x32, 0xd9, 0x3e, 
-	0xaa, 0x48, 0xac, 0x24, 0x3b, 0x64, 0x3 , 0x38, 0x38, 0xed, 0xfc, 0xc5, 0x4f, 
-	0xb , 0x9e, 0x15, 0x89, 0x7 , 0x3c, 0x1a, 0xe7, 0x95, 0x25, 0xd8, 0xf4, 0xa8, 
-	0xe3, 0x6a, 0x69, 0xaf, 0xf5, 0xf3, 0x3a, 0x88, 0xb5, 0x3b, 0x47, 0x5f, 0xf5, 
-	0xd , 0xbb, 0x19, 0xea, 0x33, 0x52, 0xda, 0xdf, 0xda, 0x4e, 0xd8, 0xfb, 0x3c, 
-	0xc9, 0x83, 0x8e, 0x80, 0xff, 0x0 , 0x5a, 0xe6, 0xe1, 0x92, 0x4d, 0xd8, 0x2c, 
-	0xad, 0xd8, 0xd5, 0xbb, 0x67, 0x65, 0x93, 0x2b, 0x90, 0xc0, 0x82, 0x70, 0x38, 
-	0xeb, 0xd6, 0xb1, 0xe4, 0x49, 0x9d, 0xff, 0x0 , 0x59, 0x94, 0x95, 0xda, 0x3a, 
-	0xbb, 0x58, 0xed, 0x99, 0x49, 0x68, 0x5b, 0xe5, 0x38, 0x39, 0xe3, 0xb6, 0x7d, 
-	0x6a, 0xfc, 0x72, 0x5a, 0xc7, 0x1e, 0xd2, 0xd1, 0x80, 0x3f, 0x85, 0x6 , 0x73, 
-	0xf9, 0x57, 0x37, 0x5 , 0xd5, 0xca, 0xc8, 0xcc, 0x38, 0xce, 0xf , 0xb , 0x56, 
-	0x61, 0x9a, 0x77, 0xce, 0xf7, 0x63, 0x8f, 0x43, 0x5d, 0x94, 0xb0, 0xf2, 0x97, 
-	0x53, 0xc3, 0xc5, 0xe6, 0xd4, 0x69, 0x36, 0xb9, 0x3f, 0x23, 0x52, 0x6b, 0x8b, 
-	0x58, 0xdb, 0x7f, 0x92, 0xad, 0xcf, 0x5 , 0xc6, 0x3f, 0x21, 0x50, 0x49, 0xa8, 
-	0x2b, 0x30, 0x11, 0xc2, 0xb , 0xfa, 0xe3, 0x2 , 0xaa, 0x47, 0xc , 0x97, 0x2d, 
-	0x88, 0xe3, 0x6c, 0xe , 0x32, 0x1 , 0xa9, 0xda, 0x25, 0xb4, 0x5c, 0x6e, 0xdd, 
-	0x2f, 0xf7, 0x4e, 0x78, 0xfa, 0xff, 0x0 , 0x85, 0x74, 0x2c, 0x3a, 0x5d, 0x75, 
-	0x3c, 0xa9, 0x66, 0xd3, 0xa8, 0xae, 0x92, 0x51, 0x5d, 0xd7, 0xfc, 0x11, 0xb7, 
-	0x17, 0x17, 0x7 , 0x87, 0xce, 0x71, 0xfc, 0xd , 0x50, 0x63, 0xfb, 0xcb, 0x2a, 
-	0xee, 0xf4, 0xe6, 0xa5, 0x86, 0x6 , 0x66, 0xdf, 0x2a, 0x16, 0xc9, 0xe3, 0xe6, 
-	0xeb, 0x44, 0x80, 0x46, 0xd9, 0x21, 0x77, 0xe , 0x8 , 0xeb, 0x5d, 0x11, 0x87, 
-	0x2e, 0x8a, 0x5a, 0xff, 0x0 , 0x5e, 0x47, 0x99, 0x5a, 0xbf, 0xb5, 0x7c, 0xf3, 
-	0xa6, 0x92, 0xf9, 0xff, 0x0 , 0xf2, 0x42, 0x33, 0x46, 0x9b, 0x70, 0x1d, 0xc9, 
-	0xf5, 0x1f, 0xd0, 0x52, 0x3c, 0x85, 0xb8, 0xc8, 0xb , 0xe8, 0x17, 0x14, 0xce, 
-	0x4e, 0x5c, 0xf3, 0x9e, 0xf4, 0x99, 0xc1, 0xe0, 0x56, 0xf1, 0x87, 0x99, 0xe6, 
-	0xd5, 0xc4, 0x27, 0xf6, 0x12, 0x5f, 0xd7, 0x66, 0x2e, 0x7d, 0x7 , 0x1e, 0xb8, 
-	0xa3, 0x8e, 0xbd, 0xe9, 0x37, 0x13, 0xd6, 0x8c, 0x66, 0xb6, 0x51, 0x38, 0x65, 
-	0x36, 0xfc, 0x83, 0x9a, 0x28, 0xa2, 0xa8, 0xcc, 0x9 , 0xc5, 0x0 , 0xe6, 0x8a, 
-	0x42, 0x71, 0x54, 0x21, 0x28, 0xa2, 0x8a, 0x0 , 0x29, 0x1a, 0x94, 0xd3, 0x68, 
-	0x0 , 0xa2, 0x8a, 0x28, 0x0 , 0xfc, 0x68, 0xfc, 0x68, 0xfc, 0x28, 0xfc, 0x28, 
-	0x1 , 0xb4, 0x52, 0xb7, 0xd2, 0x92, 0x80, 0xa , 0x69, 0xa5, 0x6a, 0x4a, 0x0 , 
-	0x29, 0x1a, 0x94, 0xd3, 0x68, 0x0 , 0xa2, 0x8a, 0x3f, 0xa , 0x0 , 0x3f, 0x1a, 
-	0x3f, 0x1a, 0x4f, 0xc2, 0x97, 0xf0, 0xa0, 0x6 , 0xd1, 0x45, 0x21, 0x34, 0x0 , 
-	0x13, 0x49, 0x9a, 0x29, 0x1a, 0x80, 0x12, 0x8a, 0x28, 0xa0, 0x3 , 0xf1, 0xa3, 
-	0xf1, 0xa3, 0xf0, 0xa3, 0xf0, 0xa0, 0x6 , 0xd1, 0x45, 0x14, 0xd0, 0xd , 0xa3, 
-	0x34, 0x52, 0x35, 0x30, 0x12, 0x8f, 0xc6, 0x8a, 0x3f, 0xa , 0x0 , 0x3f, 0x1a, 
-	0x6b, 0x53, 0xbf, 0xa , 0x69, 0xa0, 0x2 , 0x9a, 0x69, 0x5a, 0x92, 0x80, 0x11, 
-	0xa9, 0x29, 0x5a, 0x92, 0x80, 0xa , 0x3f, 0x1a, 0x3f, 0xa , 0x3f, 0xa , 0x68, 
-	0x5 , 0x5a, 0x5a, 0x45, 0xa5, 0xa4, 0x2 , 0xad, 0x2d, 0x18, 0xa2, 0x81, 0x8e, 
-	0xfc, 0x68, 0xfc, 0x68, 0xfc, 0x28, 0xa0, 0x2 , 0x9c, 0x29, 0x16, 0x96, 0x80, 
-	0x15, 0x69, 0x69, 0x16, 0x96, 0x80, 0x1d, 0xf8, 0xd1, 0xf8, 0xd1, 0xf8, 0x51, 
-	0xf8, 0x50, 0x30, 0xa5, 0x5e, 0x94, 0x94, 0xab, 0xd2, 0x81, 0xb , 0x4e, 0x5e, 
-	0x94, 0xd1, 0x4e, 0xa0, 0x40, 0xb4, 0xef, 0xc6, 0x9a, 0xb4, 0xef, 0xc2, 0xa4, 
-	0x61, 0xf8, 0xd1, 0x47, 0xe1, 0x45, 0x1 , 0x71, 0x56, 0x96, 0x8c, 0x51, 0x40, 
-	0xa , 0x5 , 0x2d, 0x14, 0x50, 0x2 , 0xe7, 0xde, 0x97, 0xf1, 0xa4, 0xc7, 0xb5, 
-	0x2f, 0xe1, 0x40, 0x5 , 0x14, 0x51, 0x40, 0xa , 0xb4, 0xb4, 0x8b, 0x4b, 0x40, 
-	0xc2, 0x9c, 0x29, 0xb4, 0xe1, 0x40, 0x82, 0x8a, 0x29, 0x57, 0xe9, 0x40, 0xc5, 
-	0xfc, 0x69, 0x3f, 0x1a, 0x5f, 0xc2, 0x8f, 0xc2, 0x81, 0x7 , 0xe3, 0x45, 0x14, 
-	0x50, 0x1a, 0x81, 0x38, 0x19, 0xa1, 0x46, 0x38, 0xa2, 0x8a, 0x0 , 0x5c, 0x55, 
-	0x6b, 0x5c, 0xbb, 0xc9, 0x72, 0x47, 0x32, 0x36, 0x17, 0xfd, 0xd5, 0x38, 0x5f, 
-	0xd7, 0x27, 0xf1, 0xa9, 0x6f, 0x59, 0x96, 0xd5, 0xb6, 0x1c, 0x33, 0x7c, 0xaa, 
-	0x7d, 0xc9, 0xc0, 0xfe, 0x74, 0xb1, 0xa0, 0x5d, 0xaa, 0xbc, 0x4 , 0x3 , 0x1f, 
-	0x87, 0x14, 0x86, 0xb6, 0x2b, 0xea, 0x4e, 0xd6, 0xf6, 0xed, 0x32, 0x8c, 0x98, 
-	0x53, 0xe5, 0xe7, 0xf8, 0x8f, 0x3 , 0xf5, 0x35, 0x8f, 0xa6, 0xc2, 0xd6, 0xba, 
-	0x1b, 0xb9, 0x42, 0x5e, 0xe8, 0xe3, 0x77, 0xae, 0x7f, 0xfa, 0xc3, 0xf5, 0xad, 
-	0x1f, 0x10, 0x1f, 0x35, 0xa1, 0xb4, 0x1d, 0x64, 0x6c, 0x9c, 0x7e, 0x43, 0xf9, 
-	0x9f, 0xca, 0x93, 0x54, 0x51, 0xe6, 0xa4, 0x3 , 0x88, 0xe3, 0x51, 0xc8, 0xed, 
-	0x9f, 0xfe, 0xb2, 0xd4, 0x3d, 0xcd, 0xe2, 0xed, 0x1b, 0x77, 0x29, 0xf1, 0x14, 
-	0x61, 0xa , 0xb6, 0x22, 0x5f, 0x39, 0xff, 0x0 , 0x92, 0xf , 0xc4, 0x9a, 0xc0, 
-	0xd5, 0x2e, 0x2 , 0xfd, 0xf1, 0xf3, 0x22, 0xb4, 0xa7, 0x27, 0xf8, 0xcf, 0xb , 
-	0xfe, 0x7d, 0xeb, 0x72, 0xe1, 0xc7, 0x9d, 0x21, 0x6d, 0xd9, 0x19, 0x91, 0xc0, 
-	0xf6, 0xe1, 0x47, 0xe6, 0x7f, 0x41, 0x5c, 0x95, 0xfe, 0xf9, 0x66, 0xf2, 0x94, 
-	0xe7, 0x7b, 0x2a, 0xe7, 0xb1, 0x6c, 0x7f, 0x4c, 0xd6, 0x53, 0x7a, 0x1a, 0xd2, 
-	0x8d, 0xde, 0xa6, 0x7c, 0x70, 0x99, 0xe , 0xee, 0xa3, 0x9f, 0xc8, 0x53, 0x59, 
-	0x41, 0x93, 0xdb, 0xda, 0xaf, 0xdc, 0x6c, 0x8e, 0xdd, 0x96, 0x10, 0x9 , 0x63, 
-	0xb0, 0x1f, 0xf6, 0x47, 0x7f, 0xc6, 0xaa, 0x32, 0x8e, 0xe7, 0xf2, 0xac, 0x9e, 
-	0x87, 0x5c, 0x20, 0xde, 0xa4, 0x7c, 0xfd, 0xd5, 0xa7, 0x2a, 0x63, 0x19, 0xa7, 
-	0x2f, 0x3 , 0xe5, 0x1c, 0x53, 0x58, 0x91, 0x4b, 0x52, 0xec, 0x96, 0xe0, 0xcc, 
-	0x7 , 0x2 , 0xa1, 0x63, 0xeb, 0x4e, 0x6c, 0xd3, 0x42, 0xf6, 0xef, 0x4d, 0x19, 
-	0x4e, 0x4d, 0x86, 0x47, 0xa5, 0x3b, 0x18, 0xe4, 0x9e, 0x4d, 0xa , 0xb8, 0x6f, 
-	0x7a, 0x72, 0xae, 0x5b, 0x26, 0x81, 0x46, 0x2c, 0x66, 0xdc, 0xfe, 0x74, 0xad, 
-	0x85, 0xfa, 0xd2, 0xe7, 0x1d, 0x29, 0x31, 0x83, 0x96, 0xa0, 0x76, 0xb6, 0xc3, 
-	0x70, 0x71, 0x92, 0x69, 0xad, 0x8f, 0x7f, 0xc2, 0x95, 0x89, 0xa6, 0x73, 0x9e, 
-	0xb5, 0x48, 0xc6, 0x52, 0x5b, 0x1 , 0xc , 0xc3, 0x0 , 0x60, 0x7a, 0x52, 0xac, 
-	0x24, 0x72, 0xc4, 0x2f, 0xd4, 0xd3, 0xb , 0x30, 0xee, 0x69, 0x43, 0x37, 0xad, 
-	0x56, 0xa6, 0x5e, 0xef, 0x52, 0xe5, 0x8e, 0xc0, 0xd8, 0x53, 0x9f, 0x53, 0x5b, 
-	0xb6, 0xb , 0xb6, 0xb0, 0x6c, 0xce, 0x26, 0x3 , 0xd6, 0xba, 0x1d, 0x3c, 0x72, 
-	0x1 , 0xae, 0xaa, 0x6b, 0x41, 0x73, 0x5c, 0xd3, 0x80, 0x64, 0xa , 0x98, 0x8e, 
-	0xe3, 0xd2, 0x8b, 0x75, 0x1b, 0x6a, 0x66, 0x4f, 0x97, 0x22, 0xad, 0x8c, 0xa9, 
-	0x28, 0xf9, 0x79, 0x1d, 0xaa, 0x95, 0xc4, 0x6a, 0x47, 0x4a, 0xd3, 0x74, 0x15, 
-	0x56, 0x78, 0xf3, 0xde, 0x84, 0x8 , 0xc0, 0xd4, 0xa0, 0x62, 0x30, 0xa0, 0xf , 
-	0x7a, 0xa3, 0x66, 0x4c, 0x57, 0xb , 0xb5, 0xd9, 0x19, 0x4e, 0x55, 0xeb, 0xa3, 
-	0xb8, 0x87, 0x70, 0x23, 0x15, 0x9b, 0x75, 0x66, 0x9 , 0x2d, 0x44, 0x93, 0x7a, 
-	0x89, 0xa3, 0x7b, 0x49, 0xd7, 0x26, 0x68, 0xc4, 0x77, 0x91, 0xf6, 0xc0, 0x92, 
-	0x31, 0xc7, 0xe2, 0x2a, 0xaf, 0x88, 0x2d, 0xb7, 0xdc, 0xb , 0xeb, 0x6c, 0x3a, 
-	0xf4, 0x91, 0x57, 0xae, 0x3d, 0x45, 0x65, 0x59, 0xcb, 0x71, 0x68, 0xd9, 0x8c, 
-	0xe5, 0x7d, 0xd , 0x6e, 0xe9, 0x7a, 0xcd, 0x9c, 0xb1, 0x85, 0xbb, 0xb5, 0xda, 
-	0x7d, 0x40, 0xff, 0x0 , 0xa , 0xa9, 0x62, 0x25, 0x6e, 0x59, 0x6a, 0x4f, 0xd5, 
-	0xe3, 0x2d, 0x9d, 0x8c, 0xe1, 0x6b, 0xd , 0xca, 0x8d, 0x8c, 0x18, 0x1e, 0xb8, 
-	0x3c, 0x8f, 0xc2, 0x95, 0xec, 0x56, 0xd1, 0x81, 0x2a, 0xaa, 0xf , 0x7e, 0xe6, 
-	0xba, 0x14, 0x8b, 0xc2, 0xf7, 0x5f, 0x3b, 0x1f, 0x2d, 0x9b, 0xea, 0x2a, 0xe5, 
-	0x9d, 0x8e, 0x81, 0x6f, 0x2e, 0xe4, 0x9e, 0x16, 0x61, 0xd3, 0x7a, 0xee, 0xc1, 
-	0xc5, 0x64, 0xb1, 0x51, 0x8f, 0x41, 0x3c, 0xc , 0xde, 0xd2, 0x31, 0x3c, 0x3f, 
-	0xa4, 0xdc, 0x33, 0xfd, 0xae, 0x64, 0x65, 0x4f, 0xe0, 0x56, 0x1f, 0xad, 0x5a, 
-	0xd6, 0xa1, 0x86, 0x4b, 0x56, 0x49, 0x15, 0x4a, 0xe0, 0x82, 0x7d, 0x2b, 0xa0, 
-	0xfb, 0x66, 0x9a, 0x55, 0x95, 0x6e, 0x7c, 0xcf, 0x97, 0xa6, 0xcc, 0x63, 0xdc, 
-	0x71, 0x5c, 0xc6, 0xb5, 0xf6, 0x7 , 0x94, 0xa0, 0x13, 0xb6, 0x73, 0xd4, 0x93, 
-	0x9a, 0x4f, 0x15, 0x17, 0xd0, 0xa5, 0x84, 0x92, 0xea, 0x73, 0x76, 0x64, 0xa5, 
-	0xc3, 0x42, 0xe , 0xe4, 0xcf, 0xca, 0xde, 0xd5, 0xa7, 0x1c, 0x44, 0xae, 0x71, 
-	0x50, 0x35, 0x9a, 0x31, 0x26, 0xdc, 0xb7, 0xca, 0x7a, 0x63, 0xa5, 0x68, 0x20, 
-	0x2b, 0x18, 0x7 , 0xae, 0x39, 0x34, 0xe1, 0x25, 0xb9, 0xa7, 0x2d, 0x88, 0xe3, 
-	0x5 , 0xd , 0x6a, 0x69, 0x64, 0xee, 0x1f, 0x5a, 0xcf, 0xdb, 0x9a, 0xd3, 0xd1, 
-	0xd4, 0xf9, 0x8b, 0x9f, 0x5a, 0xd2, 0x5b, 0x1a, 0x51, 0xf8, 0x91, 0xeb, 0x7f, 
-	0xa , 0xe3, 0x77, 0x44, 0xc1, 0x7 , 0xa7, 0x15, 0xeb, 0xba, 0x5d, 0x87, 0x99, 
-	0xa , 0xfc, 0x9d, 0xbd, 0x2b, 0xcd, 0xfe, 0x10, 0xdb, 0x23, 0x47, 0x13, 0x3 , 
-	0xcf, 0x18, 0x15, 0xee, 0x5a, 0x6 , 0x9c, 0xd , 0x98, 0x60, 0xbb, 0xb2, 0x31, 
-	0x9c, 0xd7, 0x83, 0x88, 0x77, 0x91, 0xef, 0x52, 0x8a, 0x51, 0x39, 0x9b, 0xdd, 
-	0x34, 0xac, 0x19, 0x58, 0xff, 0x0 , 0x1c, 0x57, 0x9b, 0xfc, 0x43, 0xb7, 0x2b, 
-	0xbd, 0x0 , 0x3c, 0x3 , 0x5e, 0xeb, 0x7b, 0x64, 0xc , 0x2c, 0x84, 0xc , 0xf3, 
-	0x5e, 0x57, 0xf1, 0x12, 0xcb, 0x17, 0x4c, 0x36, 0xfa, 0xf5, 0x1d, 0x6b, 0x9a, 
-	0x32, 0xf7, 0x8d, 0xa5, 0xb , 0xc4, 0xf0, 0xed, 0x5f, 0x49, 0x32, 0xbb, 0x3b, 
-	0x26, 0x2b, 0x8b, 0xf1, 0x24, 0x11, 0xdb, 0x2b, 0x2f, 0x46, 0x15, 0xeb, 0x1a, 
-	0xf4, 0x27, 0x2c, 0xaa, 0x31, 0xf8, 0x57, 0x11, 0xac, 0x68, 0x3e, 0x65, 0xd9, 
-	0xba, 0x92, 0x48, 0xcc, 0x24, 0x70, 0xa7, 0x39, 0x1f, 0x85, 0x7a, 0x14, 0xaa, 
-	0x1e, 0x5d, 0x6a, 0x46, 0x5f, 0x85, 0x74, 0x1b, 0x73, 0xa6, 0xad, 0xe1, 0x3e, 
-	0x64, 0xd2, 0x8c, 0xe4, 0xf3, 0x81, 0xe9, 0x50, 0x4d, 0xa5, 0xc5, 0x69, 0xad, 
-	0xf , 0xb5, 0xaf, 0x95, 0x6d, 0x39, 0xe2, 0x5c, 0x60, 0x23, 0x7b, 0x9a, 0xd4, 
-	0xb0, 0x9a, 0xd6, 0xc1, 0x84, 0x50, 0x2c, 0xc1, 0x7a, 0x8f, 0x9f, 0x8f, 0xa6, 
-	0x2b, 0x66, 0x39, 0xb4, 0x6b, 0xcb, 0x6d, 0x97, 0xaf, 0x2a, 0xab, 0x70, 0x43, 
-	0x28, 0xc7, 0xe3, 0x5d, 0xd1, 0xc4, 0x43, 0x96, 0xd6, 0x3c, 0xda, 0x98, 0x59, 
-	0x4b, 0x63, 0x26, 0x4f, 0x87, 0x9f, 0xda, 0xa , 0xb2, 0xab, 0x86, 0x56, 0x1f, 
-	0x21, 0x46, 0xfb, 0xc2, 0xb4, 0xf4, 0xbf, 0x7 , 0x58, 0xe8, 0x76, 0xed, 0x2d, 
-	0xc3, 0x47, 0x1a, 0x1 , 0xf3, 0x6e, 0x3c, 0xe7, 0x8f, 0xce, 0xa7, 0xd3, 0x74, 
-	0xcd, 0x29, 0x3e, 0x4d, 0x3b, 0xc4, 0x97, 0x16, 0xe8, 0xb9, 0xfd, 0xda, 0xb9, 
-	0x3 , 0xf0, 0x6 , 0xb6, 0x34, 0xab, 0x5d, 0x16, 0xd6, 0xee, 0x3b, 0xab, 0xbb, 
-	0xe8, 0xf5, 0x9 , 0x94, 0x6f, 0x41, 0x77, 0x23, 0xb8, 0x3e, 0xe0, 0xe , 0x29, 
-	0xac, 0x4c, 0x16, 0xcb, 0x53, 0x9f, 0xfb, 0x3e, 0xbb, 0xeb, 0xa1, 0xdc, 0xfe, 
-	0xcd, 0xbe, 0x15, 0xf2, 0x2e, 0xa5, 0xd7, 0xe7, 0x85, 0xa3, 0x59, 0x46, 0xcb, 
-	0x65, 0x61, 0x82, 0x53, 0x3f, 0x7b, 0x9f, 0x5e, 0x3f, 0x1 , 0x5d, 0x5f, 0xc5, 
-	0x9d, 0x6b, 0x4e, 0xd1, 0x9a, 0x39, 0x26, 0xc , 0xf3, 0xb7, 0xcd, 0x1c, 0x31, 
-	0xe0, 0xb3, 0xf3, 0xd4, 0x3 , 0xd0, 0x67, 0x3c, 0xf4, 0xae, 0x2a, 0x4f, 0x8b, 
-	0x37, 0x16, 0xb6, 0xf2, 0x5a, 0xe9, 0x86, 0xce, 0xd7, 0xcb, 0x4 , 0x33, 0x5a, 
-	0x5a, 0x96, 0x93, 0x18, 0xc7, 0x6 , 0x42, 0xc0, 0x1f, 0x70, 0x1 , 0xae, 0x37, 
-	0x54, 0xd7, 0xb5, 0xd , 0x62, 0x66, 0xbb, 0x63, 0x2b, 0x6f, 0x4 , 0x19, 0xee, 
-	0x65, 0x2f, 0x2b, 0x60, 0x8c, 0xfc, 0xc7, 0xd9, 0x81, 0x15, 0x94, 0xab, 0x26, 
-	0xce, 0xea, 0x18, 0x2e, 0x5b, 0x5d, 0x99, 0x9e, 0x3a, 0xd4, 0x24, 0xf1, 0x17, 
-	0x88, 0x8a, 0xbd, 0xbc, 0x71, 0xca, 0xcc, 0x38, 0x3 , 0x26, 0x35, 0x1d, 0x3 , 
-	0x1f, 0x5e, 0x4d, 0x74, 0x9e, 0xd , 0xf0, 0xde, 0xeb, 0x75, 0x33, 0x45, 0xf3, 
-	0xa6, 0x72, 0x6b, 0x33, 0xc2, 0x5a, 0xb , 0x4d, 0xa9, 0x79, 0xd8, 0x6e, 0x5b, 
-	0x2c, 0xed, 0xce, 0xef, 0x7f, 0xe9, 0x5e, 0xb7, 0xa0, 0x58, 0x62, 0x15, 0x55, 
-	0x1c, 0x0 , 0x39, 0x15, 0xcf, 0x52, 0xa5, 0x91, 0xea, 0xe1, 0xe8, 0x5b, 0x52, 
-	0x2f, 0xe , 0xe9, 0x29, 0x14, 0x23, 0x11, 0xf2, 0x3d, 0x6a, 0x2f, 0x1c, 0x58, 
-	0x3 , 0x64, 0x49, 0x1f, 0x87, 0xa5, 0x75, 0xda, 0x7d, 0xa8, 0x50, 0x3b, 0x64, 
-	0xe4, 0x0 , 0x2a, 0x9f, 0x8c, 0xad, 0xb , 0xd8, 0x37, 0x6c, 0x8e, 0x72, 0x2b, 
-	0xcc, 0x9c, 0xef, 0x23, 0xaa, 0x71, 0xd2, 0xc7, 0xc7, 0xff, 0x0 , 0x18, 0x2d, 
-	0x8c, 0x5a, 0xd4, 0x84, 0xc , 0x73, 0x9a, 0xe4, 0xad, 0x4e, 0x78, 0xf5, 0x4 , 
-	0xf , 0xca, 0xbd, 0x1f, 0xf6, 0x85, 0xb5, 0x16, 0xda, 0xa2, 0xb9, 0x18, 0xf , 
-	0xd6, 0xbc, 0xd6, 0x1c, 0xac, 0x81, 0x4f, 0xa9, 0x1f, 0xe7, 0xf3, 0xaf, 0x4a, 
-	0x9e, 0xb4, 0xd1, 0xe2, 0x4b, 0xdd, 0xac, 0x69, 0x5b, 0x9d, 0xd1, 0xfe, 0x3c, 
-	0x7d, 0x69, 0xd8, 0xf7, 0xfb, 0xc3, 0x8f, 0xf3, 0xf9, 0x54, 0x36, 0x6d, 0x86, 
-	0x90, 0xc , 0x75, 0xde, 0xd , 0x5b, 0x65, 0xdd, 0x19, 0x23, 0xa1, 0x3f, 0x95, 
-	0x61, 0x2d, 0x19, 0xee, 0xd1, 0xf7, 0xe9, 0xf9, 0xa2, 0x5b, 0x46, 0x24, 0xe7, 
-	0xdb, 0xa5, 0x5e, 0x8b, 0x1f, 0x81, 0xe9, 0x59, 0xf0, 0xb0, 0xc , 0x2b, 0x4a, 
-	0xcb, 0xd , 0x8c, 0xf4, 0x27, 0x1f, 0x4a, 0xe6, 0xa8, 0x7a, 0xf8, 0x59, 0x6c, 
-	0x89, 0x24, 0x8f, 0xcc, 0x51, 0xcf, 0xcc, 0x3a, 0x1a, 0xaf, 0x79, 0x6f, 0xe6, 
-	0x3a, 0xbb, 0xfc, 0x92, 0xe , 0x4 , 0x83, 0xf8, 0xbe, 0xbe, 0xb5, 0x3c, 0xdb, 
-	0xa1, 0x4 , 0x15, 0xde, 0xa0, 0xfe, 0x3f, 0x9d, 0x16, 0xd3, 0xc3, 0x2a, 0xff, 
-	0x0 , 0x79, 0x7f, 0x89, 0x5b, 0xa8, 0xac, 0xe2, 0xe4, 0xb5, 0x47, 0x65, 0x58, 
-	0xd3, 0x9b, 0xe5, 0x7b, 0xbf, 0xeb, 0xfa, 0xb1, 0x9d, 0x2a, 0xb7, 0x96, 0x3 , 
-	0x27, 0xcc, 0x87, 0x23, 0x6f, 0x3c, 0x77, 0x23, 0xd6, 0xa5, 0xb5, 0x97, 0x20, 
-	0x6f, 0x3b, 0xbb, 0xab, 0xf , 0x5a, 0xbb, 0x35, 0xaa, 0xbb, 0x6f, 0x81, 0xf2, 
-	0xd8, 0xc8, 0x52, 0x7e, 0xf5, 0x52, 0x68, 0x80, 0x90, 0xee, 0x56, 0x8a, 0x4e, 
-	0xeb, 0x8c, 0xab, 0x7f, 0xf5, 0xeb, 0x45, 0x25, 0x24, 0x71, 0x4a, 0x85, 0x4a, 
-	0x32, 0x4f, 0xa1, 0x75, 0x49, 0x29, 0xcf, 0xce, 0x33, 0xd3, 0xbd, 0x5b, 0xb7, 
-	0x8 , 0x79, 0xeb, 0xb7, 0xb8, 0x3c, 0x81, 0xfc, 0xff, 0x0 , 0x3a, 0xcc, 0x85, 
-	0xdd, 0x71, 0xb7, 0xe6, 0xc0, 0xe9, 0xde, 0xad, 0x47, 0x30, 0x3c, 0x12, 0xf , 
-	0xfb, 0xdc, 0x1f, 0xcc, 0x56, 0x32, 0x89, 0xdb, 0x46, 0xa2, 0xea, 0x74, 0x3a, 
-	0x4c, 0x91, 0x23, 0x6c, 0x67, 0xca, 0x9f, 0xe1, 0x23, 0xf9, 0x56, 0xdd, 0xac, 
-	0x36, 0xc5, 0xb8, 0x91, 0x76, 0x9c, 0x11, 0x8e, 0x45, 0x71, 0xf6, 0xf3, 0x89, 
-	0x17, 0x6e, 0xe4, 0x6f, 0x69, 0x17, 0x3f, 0xa8, 0xe6, 0xb4, 0x6c, 0xa6, 0x4d, 
-	0xbb, 0x57, 0xcc, 0x4e, 0x7b, 0x1d, 0xc3, 0xf2, 0x38, 0xa9, 0xe7, 0x9a, 0xd9, 
-	0x9d, 0x1e, 0xc2, 0x84, 0xd6, 0xa8, 0xea, 0x76, 0xfc, 0xac, 0xa0, 0x80, 0x7 , 
-	0x75, 0xc0, 0xff, 0x0 , 0x1a, 0xae, 0xcb, 0x14, 0x4c, 0x76, 0xdb, 0x19, 0x1b, 
-	0xfb, 0xce, 0x47, 0xf5, 0xac, 0xb8, 0xa6, 0x7 , 0x2a, 0x19, 0x1b, 0x3f, 0xc2, 
-	0x7e, 0x53, 0xfa, 0xd3, 0xf0, 0x3a, 0x30, 0x65, 0xfa, 0xe4, 0xd7, 0x45, 0x2a, 
-	0xc9, 0x6e, 0xcf, 0x37, 0x17, 0x82, 0x9b, 0x57, 0x84, 0x13, 0xf9, 0xff, 0x0 , 
-	0x9a, 0xb1, 0x66, 0x69, 0x99, 0xb8, 0x69, 0xa3, 0x88, 0x7a, 0x29, 0xc9, 0x3f, 
-	0x95, 0x55, 0x77, 0x88, 0x7d, 0xdf, 0x9b, 0x1e, 0xa2, 0x89, 0x22, 0x3f, 0xf2, 
-	0xce, 0x45, 0xfa, 0x67, 0x19, 0xa8, 0xb6, 0xca, 0x1b, 0x98, 0x5b, 0x1e, 0xd8, 
-	0x35, 0xdf, 0x4e, 0xb5, 0x3e, 0x8c, 0xf9, 0x9c, 0x56, 0x5f, 0x8c, 0xbd, 0xe5, 
-	0xf , 0xc9, 0xff, 0x0 , 0xc0, 0xfc, 0x9 , 0x37, 0x17, 0x6c, 0xf3, 0xc0, 0xc9, 
-	0xe3, 0x2 , 0x96, 0x22, 0x3e, 0x67, 0xc1, 0xe0, 0x75, 0xc7, 0x4a, 0x4c, 0x4a, 
-	0x40, 0x8c, 0x44, 0xdb, 0x9f, 0xbe, 0x3b, 0x53, 0xee, 0x8f, 0x95, 0x18, 0x81, 
-	0x54, 0x1c, 0x7d, 0xe3, 0xef, 0x5d, 0x51, 0xa8, 0xa5, 0xa2, 0x3c, 0x7a, 0xb8, 
-	0x59, 0xc2, 0xf2, 0x9a, 0xff, 0x0 , 0x87, 0x22, 0xe7, 0xbf, 0xf2, 0xa5, 0xc9, 
-	0xe2, 0x91, 0x43, 0x1c, 0x28, 0x3 , 0x24, 0xe6, 0x9e, 0xe3, 0x6b, 0x63, 0xd3, 
-	0xad, 0x6a, 0xa5, 0x73, 0x92, 0x54, 0xdc, 0x55, 0xd8, 0xda, 0x28, 0xa2, 0xa8, 
-	0xc0, 0x29, 0x8 , 0xa5, 0x34, 0x99, 0xaa, 0x1 , 0x28, 0xa2, 0x8a, 0x0 , 0x33, 
-	0x48, 0xd4, 0x74, 0xa4, 0xa0, 0x2 , 0x8f, 0xc6, 0x8a, 0x28, 0x0 , 0xfc, 0x68, 
-	0xfc, 0x68, 0xfc, 0x28, 0xfc, 0x28, 0x1 , 0xb4, 0x51, 0x45, 0x0 , 0x23, 0x52, 
-	0x52, 0xb5, 0x25, 0x0 , 0x14, 0x8d, 0x4a, 0x69, 0xb4, 0x0 , 0x51, 0x9a, 0x28, 
-	0xfc, 0x28, 0x0 , 0xfc, 0x69, 0xad, 0x4e, 0xfc, 0x29, 0xa6, 0x80, 0xa , 0x28, 
-	0xa2, 0x80, 0x1b, 0x48, 0x45, 0x2d, 0x21, 0x34, 0x0 , 0x94, 0x51, 0x45, 0x0 , 
-	0x1f, 0x8d, 0x26, 0x7d, 0xe9, 0x7f, 0xa , 0x69, 0xa0, 0x2 , 0x8c, 0xd1, 0x48, 
-	0xd4, 0x0 , 0x94, 0xd3, 0x4e, 0xa6, 0x9a, 0x60, 0x14, 0x7e, 0x34, 0x51, 0xf8, 
-	0x53, 0x1 , 0x1b, 0xeb, 0x49, 0x4a, 0xdf, 0x4a, 0x4a, 0x0 , 0x46, 0xa4, 0xa3, 
-	0x34, 0x50, 0x2 , 0x35, 0x25, 0x19, 0xa2, 0x80, 0xf , 0xc6, 0x8f, 0xc6, 0x8f, 
-	0xc2, 0x90, 0xfd, 0x28, 0x1 , 0xcb, 0x4b, 0x48, 0xb4, 0xb4, 0x0 , 0xea, 0x28, 
-	0xa5, 0x2 , 0x80, 0x17, 0xf1, 0xa2, 0x8f, 0xc2, 0x8a, 0x6 , 0x2a, 0xd2, 0xd2, 
-	0x2d, 0x2d, 0x2 , 0x14, 0xa , 0x5a, 0x28, 0xa0, 0x77, 0x1d, 0xf8, 0xd1, 0xf8, 
-	0xd1, 0xf8, 0x51, 0x40, 0x82, 0x95, 0x69, 0x5 , 0x3a, 0x80, 0x15, 0x69, 0x69, 
-	0x16, 0x96, 0x80, 0x14, 0x7d, 0x69, 0x7f, 0x1a, 0x41, 0x4b, 0xf8, 0x52, 0x0 , 
-	0xa2, 0x8a, 0x29, 0x0 , 0xea, 0x50, 0x69, 0x29, 0x40, 0xa0, 0x62, 0xd1, 0x45, 
-	0x28, 0x14, 0x0 , 0xbf, 0x8d, 0x1f, 0x8d, 0x1f, 0x85, 0x14, 0x0 , 0x51, 0x45, 
-	0x14, 0xc , 0x50, 0x29, 0x68, 0xa2, 0x82, 0x45, 0x5a, 0x5a, 0x31, 0x45, 0x5 , 
-	0x2 , 0xd3, 0xbf, 0x1a, 0x6a, 0xd3, 0xbf, 0xa , 0x0 , 0x3f, 0x1a, 0x3f, 0x1a, 
-	0x3f, 0xa , 0x3f, 0xa , 0x4 , 0x14, 0x51, 0x45, 0x3 , 0x1 , 0x43, 0x6 , 0x3c, 
-	0xab, 0x62, 0x8a, 0x55, 0xa0, 0x5a, 0x95, 0x25, 0x59, 0xda, 0xea, 0x34, 0xde, 
-	0xad, 0xe5, 0x83, 0x26, 0x31, 0xed, 0x81, 0x9f, 0xcc, 0xfe, 0x54, 0xe1, 0x2d, 
-	0xc8, 0xc9, 0xf2, 0x87, 0x27, 0x8a, 0x92, 0x1e, 0x64, 0x9a, 0x41, 0xdc, 0xed, 
-	0x1f, 0x41, 0xff, 0x0 , 0xd7, 0xcd, 0x48, 0xe4, 0x24, 0x7b, 0x8a, 0xe7, 0x6a, 
-	0xf4, 0xc5, 0x4f, 0x29, 0xa2, 0x97, 0x91, 0x8e, 0x25, 0x9e, 0x5d, 0x51, 0xae, 
-	0x3c, 0x9d, 0xdb, 0x32, 0x0 , 0xcf, 0xa7, 0x1e, 0x9f, 0x5a, 0xaf, 0x79, 0x25, 
-	0xd4, 0xd3, 0x33, 0x88, 0x1b, 0x86, 0xec, 0xc7, 0xb7, 0x3e, 0xa3, 0xd0, 0x7e, 
-	0x75, 0xb5, 0x66, 0x4 , 0x51, 0x17, 0x66, 0xc1, 0x3c, 0x9c, 0xd5, 0x29, 0x3 , 
-	0x9f, 0x2f, 0x4 , 0x29, 0x24, 0x12, 0x7e, 0xbc, 0xff, 0x0 , 0x45, 0xfc, 0xea, 
-	0x1c, 0x7c, 0xcd, 0x95, 0x45, 0x7d, 0x8c, 0xb , 0xe8, 0xaf, 0x92, 0xcd, 0x8b, 
-	0xcc, 0x47, 0x9c, 0x70, 0x46, 0x47, 0x3c, 0xf4, 0xfe, 0x55, 0x83, 0x71, 0x93, 
-	0x74, 0x22, 0xc , 0x5b, 0x24, 0x9e, 0x3d, 0xff, 0x0 , 0xfa, 0xc2, 0xba, 0x1d, 
-	0x6a, 0x50, 0xcc, 0xb0, 0x6f, 0xe1, 0x14, 0x73, 0xe9, 0x9c, 0x13, 0xfa, 0x3 , 
-	0x58, 0x80, 0x2a, 0x5d, 0x4a, 0xcd, 0xc1, 0x85, 0x70, 0x7e, 0x80, 0x0 , 0x5 , 
-	0x61, 0x2d, 0xce, 0xca, 0x52, 0x95, 0xb4, 0x48, 0xa7, 0x78, 0x42, 0x4c, 0xc8, 
-	0xad, 0x90, 0x9c, 0x3 , 0x51, 0x42, 0x8d, 0x27, 0x4f, 0xef, 0x5 , 0x0 , 0x77, 
-	0x26, 0x96, 0x40, 0xce, 0xc0, 0x7a, 0xf3, 0x9a, 0xb3, 0x1c, 0xa2, 0x22, 0xa , 
-	0x47, 0xf7, 0x57, 0xe4, 0x3e, 0xfe, 0xbf, 0xce, 0xa0, 0xd5, 0xf3, 0x3d, 0x10, 
-	0xdb, 0xe8, 0xe3, 0x86, 0x31, 0x18, 0x39, 0x7f, 0xe2, 0xaa, 0x75, 0x29, 0x25, 
-	0xd8, 0xe4, 0xe7, 0xd4, 0xd3, 0x31, 0xe9, 0x4a, 0xe3, 0xe4, 0xd0, 0x66, 0xde, 
-	0xf4, 0xaa, 0x3d, 0x3f, 0x3a, 0x78, 0x4c, 0xf2, 0xd4, 0x12, 0x7 , 0xdd, 0xfc, 
-	0xcd, 0x1c, 0xc1, 0xec, 0xed, 0xab, 0x1a, 0xaa, 0x0 , 0xc9, 0xa1, 0x89, 0x3c, 
-	0xa , 0x1b, 0x1d, 0xcf, 0xe1, 0x4d, 0x91, 0x8f, 0xff, 0x0 , 0x5a, 0x9d, 0x85, 
-	0x29, 0x24, 0x35, 0x88, 0x5e, 0x1 , 0xe6, 0x98, 0x32, 0x79, 0x34, 0xbb, 0x79, 
-	0xa1, 0xbb, 0x28, 0xaa, 0x39, 0xe4, 0xdb, 0x63, 0x78, 0x2 , 0x98, 0xdc, 0xa , 
-	0x7c, 0x9f, 0x7a, 0xa3, 0x7e, 0x95, 0x48, 0xc6, 0x60, 0x68, 0x14, 0x50, 0xb5, 
-	0x66, 0x7d, 0x4b, 0x76, 0x67, 0x32, 0x23, 0x7b, 0xd7, 0x45, 0xa7, 0x7d, 0xe5, 
-	0x3e, 0xd5, 0xce, 0xd9, 0x8c, 0x32, 0x8f, 0x7a, 0xe8, 0x74, 0xe3, 0xf7, 0x7e, 
-	0x95, 0xd1, 0x4f, 0x61, 0x23, 0x7e, 0xd4, 0x65, 0x6a, 0x7d, 0xbf, 0x2e, 0x3d, 
-	0x2a, 0x1b, 0x23, 0xf2, 0x8f, 0xa5, 0x59, 0xfe, 0x1e, 0xf , 0x26, 0xb4, 0xb5, 
-	0xcb, 0x2b, 0xc8, 0xb5, 0x3 , 0xc6, 0x4f, 0x6a, 0xba, 0xe3, 0x9a, 0x16, 0x2c, 
-	0xf6, 0xa0, 0xa4, 0x67, 0x49, 0xf , 0xb1, 0xaa, 0xb3, 0x40, 0x4f, 0x4a, 0xdd, 
-	0x6b, 0x6c, 0xf2, 0x5 , 0x43, 0x2d, 0xa1, 0x3d, 0x7 , 0xe5, 0x53, 0x72, 0xf9, 
-	0x59, 0x82, 0xd0, 0x1 , 0xc1, 0x14, 0xb1, 0xdb, 0xae, 0xec, 0x85, 0xad, 0x86, 
-	0xd3, 0xa4, 0xcf, 0xdd, 0x3f, 0x95, 0x49, 0xe , 0x8f, 0x3c, 0x87, 0x1 , 0xd , 
-	0x4c, 0xa5, 0x1b, 0x1a, 0xc6, 0x9b, 0x33, 0xec, 0xec, 0x11, 0x99, 0x49, 0x6e, 
-	0x87, 0x22, 0xb6, 0x2d, 0x6d, 0x2d, 0xc7, 0xca, 0xc4, 0x67, 0xd6, 0xad, 0xd8, 
-	0xf8, 0x5e, 0xed, 0xd7, 0x24, 0x30, 0x19, 0xad, 0xdd, 0x37, 0xc2, 0x2d, 0xc1, 
-	0x65, 0x6f, 0xc2, 0xb8, 0xea, 0x4a, 0x27, 0x5d, 0x3a, 0x26, 0x55, 0xae, 0x9f, 
-	0x2 , 0x2e, 0x11, 0x3a, 0x8e, 0xb8, 0xf5, 0x18, 0xa5, 0x97, 0x46, 0x49, 0x5b, 
-	0x77, 0x93, 0x9c, 0x73, 0xd2, 0xbb, 0x7d, 0x3f, 0xc3, 0x26, 0x31, 0xc8, 0x2d, 
-	0x8e, 0x9e, 0xd5, 0x77, 0xfb, 0x8 , 0xe , 0x2 , 0x91, 0xda, 0xb0, 0xf6, 0xa9, 
-	0x1b, 0xfb, 0x15, 0x63, 0xca, 0xaf, 0x34, 0x90, 0xbb, 0x82, 0xaf, 0xe2, 0x7 , 
-	0xf3, 0xac, 0xa9, 0x6d, 0x99, 0x5b, 0x69, 0x6 , 0xbd, 0x6b, 0x53, 0xd0, 0xa , 
-	0xc6, 0x7e, 0x4f, 0x73, 0x8a, 0xe4, 0xf5, 0xad, 0x1b, 0x62, 0xb6, 0x13, 0xe6, 
-	0x1e, 0x83, 0xbd, 0x6f, 0x4a, 0xb1, 0xcb, 0x52, 0x81, 0xc8, 0x79, 0x78, 0x1c, 
-	0x81, 0x5a, 0x7a, 0xc , 0x5b, 0xae, 0x14, 0x76, 0x26, 0x9b, 0x35, 0x9b, 0xac, 
-	0x9b, 0x71, 0xd6, 0xb5, 0x74, 0x5b, 0x32, 0xb3, 0x26, 0x3d, 0x33, 0x5d, 0x6e, 
-	0xa2, 0x71, 0x30, 0xa7, 0x4e, 0xd3, 0x47, 0xb4, 0x7c, 0x1e, 0xb7, 0x11, 0xc3, 
-	0x1e, 0x79, 0x15, 0xef, 0x9e, 0x15, 0xb7, 0x89, 0xad, 0x40, 0x25, 0x46, 0x78, 
-	0x21, 0x87, 0x18, 0xda, 0x79, 0xaf, 0x10, 0xf8, 0x46, 0x23, 0x36, 0xf1, 0xf4, 
-	0xed, 0x9e, 0xd5, 0xee, 0x1e, 0x11, 0x76, 0x87, 0xe6, 0xfb, 0xc3, 0x18, 0x24, 
-	0x76, 0x1e, 0xbf, 0x4e, 0xd5, 0xe3, 0x4f, 0x59, 0x9e, 0xed, 0xbd, 0xcd, 0x9 , 
-	0x6e, 0xa0, 0x1e, 0x63, 0x28, 0xcf, 0x4e, 0x1 , 0x1d, 0xab, 0x82, 0xf1, 0xfe, 
-	0x88, 0x26, 0x90, 0xed, 0x1f, 0x78, 0xf5, 0xc5, 0x7a, 0xd , 0xde, 0x7e, 0xd0, 
-	0xcc, 0x72, 0xdc, 0xf7, 0xef, 0x54, 0xaf, 0x6c, 0xd6, 0xe9, 0x5b, 0x2b, 0x9e, 
-	0x7f, 0x31, 0x5c, 0x52, 0x76, 0x67, 0x44, 0x57, 0xba, 0x7c, 0xf9, 0xe2, 0x4f, 
-	0xe , 0xfe, 0xf5, 0xbe, 0x5e, 0x73, 0xe9, 0x5c, 0xb6, 0xb1, 0xe1, 0xd7, 0x68, 
-	0x48, 0x9 , 0x8c, 0x9e, 0x98, 0xaf, 0xa0, 0xf5, 0xef, 0xc , 0xf9, 0x8a, 0x5f, 
-	0xca, 0xf5, 0xce, 0x3d, 0xab, 0x92, 0xd4, 0x3c, 0x3e, 0x0 , 0xda, 0xcb, 0xce, 
-	0x72, 0x9 , 0x15, 0xac, 0x2a, 0xd8, 0xc6, 0x74, 0xd4, 0x8f, 0x9c, 0x75, 0x9d, 
-	0x1e, 0x48, 0x24, 0xca, 0xa6, 0x31, 0xcf, 0x4c, 0xd6, 0x5e, 0xf2, 0x92, 0x79, 
-	0x72, 0xa9, 0xc7, 0xff, 0x0 , 0x5e, 0xbd, 0xf7, 0x5a, 0xf0, 0xa2, 0x4f, 0xbb, 
-	0x9 , 0xd7, 0xa6, 0x47, 0x35, 0xc5, 0x6b, 0xde, 0x0 , 0x90, 0xb3, 0x14, 0x43, 
-	0xf9, 0x74, 0xae, 0xb8, 0x56, 0x56, 0xd4, 0xe6, 0x74, 0x6c, 0x70, 0x76, 0x2d, 
-	0x0 , 0x25, 0xc1, 0x19, 0xee, 0x1 , 0xeb, 0x56, 0xa2, 0x81, 0x65, 0x91, 0x19, 
-	0xe , 0x36, 0xe4, 0x1 , 0x9f, 0x5a, 0xd1, 0xb9, 0xf0, 0x4d, 0xf2, 0x48, 0x42, 
-	0xab, 0x7e, 0x15, 0x36, 0x9b, 0xe0, 0xdd, 0x5b, 0xcd, 0xa , 0xa5, 0xd7, 0x91, 
-	0xc9, 0x15, 0x6e, 0x70, 0x1a, 0xa2, 0x1a, 0x76, 0x9d, 0xe5, 0xee, 0x3b, 0x6 , 
-	0x58, 0x92, 0x49, 0x35, 0xb7, 0xa5, 0xe9, 0x91, 0xcc, 0xea, 0x88, 0xbd, 0x1b, 
-	0x81, 0x9c, 0xd6, 0x86, 0x8b, 0xe0, 0xbd, 0x45, 0xd7, 0xf7, 0xf3, 0xb3, 0x2 , 
-	0x39, 0x0 , 0x63, 0x8a, 0xed, 0xbc, 0x37, 0xe1, 0x28, 0xed, 0x3e, 0x70, 0x1 , 
-	0xe7, 0x90, 0xdd, 0x6b, 0x29, 0x54, 0x4b, 0x63, 0x48, 0xd3, 0x48, 0xad, 0xe1, 
-	0x9d, 0xf , 0xcb, 0xa , 0xdb, 0x3e, 0xbc, 0x57, 0x59, 0xa6, 0xdb, 0xa8, 0x88, 
-	0x12, 0x19, 0x54, 0xb6, 0x30, 0xd8, 0xe7, 0x1e, 0xd5, 0x6a, 0xc6, 0xcd, 0x52, 
-	0x2d, 0xa1, 0x18, 0x60, 0xc , 0x67, 0xfa, 0xd5, 0xbf, 0xb2, 0xa9, 0x53, 0x85, 
-	0x1c, 0xf5, 0x3c, 0xe0, 0x73, 0x5c, 0xd5, 0x2a, 0x1d, 0x11, 0x43, 0x20, 0x55, 
-	0xcf, 0xdd, 0x23, 0xdf, 0x1f, 0xce, 0xa1, 0xd7, 0xa0, 0xdd, 0x66, 0xe0, 0x9c, 
-	0xf0, 0x7f, 0x3a, 0xbb, 0xa , 0x90, 0xd8, 0x28, 0x18, 0x63, 0x8f, 0x5e, 0xd5, 
-	0xd , 0xe1, 0x49, 0x21, 0x24, 0x7f, 0x12, 0xe4, 0x1f, 0x6c, 0x57, 0x3d, 0xf5, 
-	0x2e, 0x51, 0xd0, 0xf9, 0x5b, 0xf6, 0xb0, 0x84, 0x43, 0x35, 0xab, 0x1 , 0xf7, 
-	0x9b, 0x19, 0xaf, 0x1b, 0x84, 0xef, 0x5e, 0x3e, 0xf2, 0xe3, 0x1e, 0xf8, 0xaf, 
-	0x66, 0xfd, 0xb2, 0x25, 0x3 , 0x54, 0xb0, 0x85, 0x4f, 0xde, 0xdc, 0x7f, 0xa5, 
-	0x78, 0xa2, 0xb1, 0x56, 0x56, 0x7 , 0xa1, 0xaf, 0x63, 0xf , 0xad, 0x24, 0x7c, 
-	0xce, 0x2a, 0x5c, 0xb8, 0x96, 0x5e, 0xb7, 0x62, 0x18, 0x11, 0xdb, 0x2a, 0x7e, 
-	0x9d, 0xab, 0x46, 0xd6, 0x41, 0x9d, 0xa4, 0xfc, 0xae, 0x38, 0x3e, 0x86, 0xb3, 
-	0x61, 0xc4, 0x8a, 0xb3, 0x27, 0xde, 0x53, 0xf3, 0xaf, 0xa7, 0xbd, 0x4f, 0xb , 
-	0xf9, 0x6f, 0xce, 0x59, 0x18, 0xf2, 0x3d, 0x33, 0x51, 0x52, 0x37, 0x3d, 0x5c, 
-	0x25, 0x57, 0x6 , 0xbb, 0x7f, 0x5f, 0xd3, 0x34, 0x2 , 0xed, 0x62, 0xa7, 0xf0, 
-	0xab, 0xb6, 0x79, 0x4e, 0x7e, 0xf2, 0x9e, 0x32, 0x2a, 0x9d, 0xbb, 0x7 , 0x87, 
-	0x96, 0xe9, 0xc0, 0x3f, 0xd0, 0xd5, 0xbb, 0x17, 0xd9, 0x27, 0xca, 0x76, 0xb7, 
-	0x70, 0x7a, 0x1a, 0xe4, 0x96, 0xd6, 0x67, 0xbd, 0x46, 0xc9, 0xa6, 0x9e, 0x86, 
-	0xaa, 0xc6, 0x92, 0x44, 0x7 , 0xf7, 0xba, 0x31, 0xed, 0xf5, 0xf6, 0xac, 0x6b, 
-	0x9b, 0x52, 0xb3, 0xed, 0x50, 0xd0, 0xce, 0x9d, 0x15, 0x87, 0xc , 0x2b, 0x6a, 
-	0xca, 0x54, 0x55, 0xc1, 0x1 , 0x73, 0xd5, 0x4f, 0x2b, 0xf8, 0x7a, 0x7e, 0x3c, 
-	0x54, 0xf7, 0x56, 0x8b, 0x3c, 0x59, 0xce, 0x57, 0x19, 0x56, 0x3 , 0x25, 0x7f, 
-	0xfa, 0xd5, 0xcd, 0x19, 0xb8, 0x33, 0xd4, 0xa9, 0x46, 0x35, 0xe9, 0xab, 0x6e, 
-	0x8e, 0x68, 0x5c, 0x4f, 0x13, 0x20, 0x2a, 0x57, 0x3f, 0xc2, 0x4f, 0xca, 0xde, 
-	0xea, 0x7b, 0x1a, 0x9a, 0x3d, 0x51, 0x9 , 0xc5, 0xc8, 0xdd, 0x83, 0x8c, 0xb7, 
-	0x63, 0xf5, 0xf5, 0xa5, 0xbc, 0xb4, 0x9a, 0xda, 0x43, 0xb8, 0x6f, 0x84, 0xe4, 
-	0x61, 0xbe, 0x65, 0xcf, 0xb7, 0x71, 0x55, 0x59, 0x6d, 0xdc, 0x2 , 0x4b, 0x20, 
-	0x61, 0xfc, 0x63, 0x70, 0x1f, 0x8f, 0x7a, 0xea, 0x51, 0x84, 0xd6, 0xc7, 0x8f, 
-	0x2a, 0x98, 0x8a, 0xe , 0xca, 0x5f, 0x27, 0xfd, 0x7f, 0x91, 0x7d, 0x7e, 0xcd, 
-	0x3f, 0xcf, 0x1c, 0x8d, 0x19, 0xf5, 0x3c, 0x83, 0x52, 0x2c, 0x52, 0x70, 0xc0, 
-	0xac, 0x80, 0xf5, 0x23, 0x9a, 0xc5, 0x78, 0x26, 0xb7, 0x6d, 0xd0, 0x92, 0x46, 
-	0x39, 0x5c, 0xe7, 0xf2, 0x3f, 0xe3, 0x52, 0x5b, 0x5f, 0x4d, 0x1b, 0x61, 0xb3, 
-	0xd7, 0x3c, 0xd2, 0x95, 0x17, 0xf6, 0x59, 0xa5, 0x2c, 0x7c, 0x2f, 0x6a, 0x90, 
-	0xb3, 0x36, 0xa2, 0x58, 0xcc, 0x9f, 0x32, 0xb2, 0x9f, 0x7e, 0xd5, 0x6e, 0x1c, 
-	0xa1, 0xe , 0xaf, 0x9f, 0x7e, 0xb5, 0x93, 0xd , 0xf2, 0xe0, 0x13, 0xc1, 0xf7, 
-	0xe7, 0xfc, 0xfe, 0x75, 0x66, 0x3b, 0xc8, 0x83, 0x7c, 0xca, 0x7 , 0xb8, 0xc8, 
-	0xff, 0x0 , 0x1a, 0xe5, 0x94, 0x24, 0x8f, 0x5a, 0x95, 0x6a, 0x52, 0x5b, 0x9b, 
-	0x96, 0xee, 0x5e, 0x10, 0x99, 0x56, 0xec, 0x41, 0xed, 0xf4, 0x3d, 0x45, 0x5a, 
-	0x85, 0xa4, 0x5e, 0x81, 0x8e, 0x3b, 0x75, 0xcd, 0x61, 0xc5, 0x72, 0xaa, 0xca, 
-	0xca, 0xfc, 0xf6, 0xc3, 0xa , 0xbb, 0x67, 0x7e, 0x55, 0x80, 0x32, 0x1e, 0x7b, 
-	0x32, 0x8a, 0x23, 0x37, 0x1d, 0xd5, 0xcb, 0xa9, 0x87, 0x8d, 0x4f, 0x86, 0x56, 
-	0x66, 0xa2, 0xb6, 0xfe, 0xa4, 0x2f, 0xd4, 0x7f, 0x85, 0x5d, 0xb5, 0xb1, 0x77, 
-	0xfd, 0xe6, 0xe0, 0xa3, 0xb0, 0x2d, 0x8a, 0xa9, 0x67, 0xa9, 0x30, 0x5c, 0x88, 
-	0xd3, 0x3e, 0xa0, 0xf3, 0x56, 0xc6, 0xa0, 0x92, 0x7f, 0xac, 0x0 , 0x7d, 0x3f, 
-	0xfd, 0x75, 0xa2, 0xab, 0x9 , 0x69, 0xca, 0x73, 0x3c, 0x25, 0x6a, 0x77, 0x93, 
-	0xa9, 0x7f, 0xc0, 0x8a, 0xeb, 0x6c, 0x4c, 0x63, 0x8d, 0xf7, 0xb6, 0x79, 0x7e, 
-	0xa2, 0x96, 0xd6, 0xc6, 0x79, 0x3e, 0x79, 0x57, 0x68, 0xc7, 0x5 , 0xb8, 0xcd, 
-	0x4d, 0xfd, 0xa6, 0x91, 0x71, 0x5 , 0xb4, 0x41, 0xb3, 0xf7, 0xf8, 0xcf, 0xf2, 
-	0xcd, 0x52, 0xba, 0xbc, 0x9e, 0x76, 0x26, 0x49, 0x7 , 0xd0, 0xa , 0xed, 0xa7, 
-	0xe , 0x65, 0x68, 0xab, 0x1f, 0x3d, 0x8b, 0xae, 0xe1, 0x27, 0x2a, 0x93, 0x72, 
-	0xf2, 0x4a, 0xcb, 0xef, 0x64, 0xb7, 0x2c, 0x90, 0x33, 0x8 , 0xce, 0xf7, 0x3d, 
-	0x5c, 0x76, 0xf6, 0x15, 0x58, 0x2f, 0x7c, 0xe7, 0xeb, 0x4c, 0xd , 0x9e, 0x0 , 
-	0xcd, 0x2e, 0x7d, 0x5b, 0xf5, 0xaf, 0x4a, 0x9d, 0x35, 0x14, 0x7c, 0xae, 0x2f, 
-	0x11, 0x3a, 0xd2, 0xbb, 0xd1, 0x76, 0x17, 0x6 , 0x9d, 0x47, 0x1e, 0x94, 0x56, 
-	0xa7, 0x8 , 0x53, 0x5b, 0xd6, 0x9d, 0x4d, 0x6f, 0x4a, 0xa1, 0x5 , 0x1c, 0xd1, 
-	0x45, 0x0 , 0x36, 0x8a, 0x28, 0xa0, 0x2 , 0x8f, 0xc6, 0x8a, 0x3f, 0xa , 0x0 , 
-	0x3f, 0x1a, 0x3f, 0x1a, 0x43, 0xf4, 0xa4, 0xcf, 0xb5, 0x0 , 0x14, 0x51, 0x45, 
-	0x0 , 0x21, 0x34, 0x94, 0x51, 0x40, 0x8 , 0xd4, 0x94, 0xad, 0x49, 0x40, 0x5 , 
-	0x1f, 0x8d, 0x14, 0x7e, 0x14, 0x0 , 0x7e, 0x34, 0xd6, 0xa7, 0x7e, 0x14, 0xd3, 
-	0x40, 0x5 , 0x21, 0x14, 0xb4, 0x84, 0xd0, 0x2 , 0x52, 0x35, 0x2d, 0x23, 0x50, 
-	0x2 , 0x51, 0xf8, 0xd1, 0x47, 0xe1, 0x40, 0x7 , 0xe3, 0x4d, 0x6a, 0x53, 0xf4, 
-	0xa4, 0xa0, 0x2 , 0x9a, 0x69, 0x5a, 0x92, 0x8d, 0x80, 0xd , 0x36, 0x9c, 0x69, 
-	0xb4, 0xc0, 0x28, 0xfc, 0x68, 0xa3, 0xf0, 0xa6, 0x2 , 0x37, 0xd6, 0x92, 0x8a, 
-	0x28, 0x1 , 0x1a, 0x92, 0x8c, 0xd2, 0x13, 0x40, 0x9 , 0x45, 0x14, 0x50, 0x1 , 
-	0xf8, 0xd3, 0x5a, 0x9d, 0xf8, 0x53, 0x4d, 0x0 , 0x3d, 0x69, 0x68, 0x3 , 0x14, 
-	0x53, 0x18, 0xea, 0x55, 0xfa, 0xd2, 0x52, 0xaf, 0xd2, 0x90, 0x85, 0xfc, 0x68, 
-	0xa3, 0xf0, 0xa2, 0x80, 0x15, 0x69, 0x69, 0x16, 0x96, 0x80, 0x1d, 0x4a, 0x29, 
-	0xa0, 0xd3, 0xb1, 0x40, 0xb , 0xf8, 0xd1, 0x48, 0x7e, 0x94, 0xb4, 0x0 , 0xa , 
-	0x75, 0x34, 0x53, 0xa8, 0x1 , 0x56, 0x96, 0x91, 0x69, 0x68, 0x18, 0xa3, 0xeb, 
-	0x4b, 0xf8, 0xd2, 0xf , 0xa5, 0x2f, 0xe1, 0x49, 0x80, 0x51, 0x8a, 0x28, 0xa4, 
-	0x21, 0xd4, 0x62, 0x8a, 0x55, 0xa0, 0x5 , 0xa5, 0x5f, 0xad, 0x25, 0x2a, 0xfd, 
-	0x28, 0x18, 0xbf, 0x8d, 0x14, 0x7e, 0x14, 0x50, 0x1a, 0x5 , 0x2a, 0xd2, 0x51, 
-	0x9a, 0x0 , 0x75, 0x14, 0x51, 0x40, 0x21, 0xd4, 0x51, 0x45, 0x3 , 0xc , 0x7b, 
-	0xd2, 0x8f, 0xad, 0x2 , 0x97, 0xf0, 0xa0, 0x41, 0xf8, 0xd1, 0x47, 0xe1, 0x45, 
-	0x0 , 0x14, 0x50, 0x68, 0xa0, 0x0 , 0x52, 0xb3, 0x0 , 0xb9, 0x34, 0x62, 0x9a, 
-	0xdb, 0x59, 0x71, 0x91, 0xf8, 0x81, 0x40, 0xd0, 0xd5, 0x65, 0x1 , 0x51, 0x59, 
-	0x7d, 0x4f, 0xf9, 0xfa, 0xd2, 0xca, 0x86, 0x48, 0xf6, 0xed, 0x5e, 0x7a, 0x9a, 
-	0xad, 0x35, 0xae, 0xe6, 0x3b, 0xa , 0x8c, 0xfa, 0x64, 0x7f, 0x2a, 0xaf, 0x2d, 
-	0xb5, 0xe8, 0xff, 0x0 , 0x52, 0xe4, 0xfb, 0x2 , 0xa7, 0xfc, 0x2b, 0x37, 0x27, 
-	0xd8, 0xda, 0x30, 0x8b, 0xfb, 0x45, 0xdb, 0xcd, 0xc2, 0xd5, 0xc2, 0xa9, 0xfb, 
-	0xb8, 0xe1, 0xb1, 0x54, 0x26, 0x81, 0xc3, 0x48, 0xc0, 0xaa, 0x84, 0xd , 0xfe, 
-	0xd6, 0x30, 0xb8, 0xfe, 0x78, 0xaa, 0xb7, 0x4f, 0xae, 0x47, 0x1e, 0xd3, 0x19, 
-	0x2a, 0x48, 0xe4, 0xf7, 0xe7, 0xeb, 0x59, 0xb7, 0x5a, 0x8e, 0xa6, 0x51, 0xb2, 
-	0xab, 0xb4, 0xa9, 0xc9, 0xcf, 0xa9, 0xa8, 0x94, 0xd7, 0x63, 0x7a, 0x78, 0x76, 
-	0xf6, 0x92, 0x21, 0xb8, 0xd , 0x2f, 0x9b, 0x2b, 0x3b, 0x6d, 0xdc, 0x71, 0x81, 
-	0x8e, 0xe4, 0xf , 0xeb, 0xf9, 0xd6, 0x25, 0xd6, 0xef, 0xbc, 0xc4, 0xfe, 0xf5, 
-	0x89, 0xfa, 0x8c, 0x9f, 0xf0, 0xab, 0x73, 0x5c, 0x5c, 0xfd, 0x9b, 0xcb, 0x6f, 
-	0xbb, 0x9d, 0xfd, 0x7a, 0xd5, 0x29, 0x9 , 0xe3, 0x2b, 0xc6, 0x38, 0xc9, 0xae, 
-	0x79, 0x4a, 0xe7, 0xa3, 0xa , 0x4d, 0x2b, 0x5c, 0x6d, 0xaf, 0xde, 0x2f, 0x8c, 
-	0x1e, 0xd4, 0x49, 0xb9, 0x9b, 0x24, 0xe4, 0xd0, 0x5b, 0xb6, 0x40, 0xc7, 0x53, 
-	0x4d, 0x2f, 0xf2, 0xe1, 0x46, 0x7d, 0xcd, 0x2d, 0xcb, 0xf7, 0x22, 0xc3, 0x1e, 
-	0xa7, 0x8a, 0x6e, 0xf5, 0x1c, 0x1 , 0xf9, 0xd3, 0x5b, 0x3b, 0xb2, 0xc7, 0x1e, 
-	0xc2, 0x9a, 0xd9, 0xc7, 0x4c, 0x7d, 0x68, 0x26, 0x55, 0x2d, 0xb0, 0x48, 0xec, 
-	0xdc, 0xf , 0xce, 0x9b, 0xd0, 0x64, 0x75, 0xf5, 0xa3, 0xfc, 0x8a, 0x91, 0x57, 
-	0x2d, 0xb7, 0xfb, 0xbf, 0x78, 0xfa, 0x55, 0x6c, 0x61, 0xab, 0xd4, 0x60, 0x5e, 
-	0xed, 0x48, 0xc3, 0x1f, 0x8d, 0x4f, 0x1a, 0x65, 0x77, 0x9f, 0xbb, 0xfd, 0x29, 
-	0x8c, 0x9 , 0x6c, 0x1 , 0xc9, 0x3c, 0x52, 0x1b, 0x8e, 0x84, 0x4a, 0x7 , 0x5a, 
-	0x6b, 0x92, 0x33, 0x4f, 0x95, 0x87, 0xdc, 0x5e, 0xd5, 0xb , 0xf1, 0xc5, 0x52, 
-	0x57, 0x31, 0x9b, 0xb0, 0xd2, 0x68, 0x3e, 0x94, 0x2f, 0x34, 0x1a, 0xb3, 0x98, 
-	0x46, 0xe7, 0xbd, 0x28, 0xa2, 0x8e, 0x9d, 0xaa, 0x84, 0x5a, 0xb3, 0xc9, 0x91, 
-	0x7e, 0xb5, 0xbd, 0xa7, 0xfd, 0xd5, 0xac, 0x4d, 0x39, 0x37, 0x36, 0xe1, 0x5b, 
-	0x96, 0x7c, 0x63, 0xda, 0xb7, 0x86, 0xc4, 0x9b, 0xd6, 0x4 , 0x6d, 0x1f, 0xad, 
-	0x5d, 0x6 , 0xb3, 0xb4, 0xd3, 0xf2, 0xe2, 0xb4, 0x63, 0xe7, 0x1c, 0x66, 0xb7, 
-	0x45, 0x86, 0x33, 0x52, 0xc4, 0x40, 0x61, 0x91, 0x4c, 0xa3, 0xf8, 0xa9, 0x32, 
-	0xd1, 0xa7, 0x6b, 0x2 , 0xcb, 0xc0, 0xef, 0x57, 0xad, 0xb4, 0xd0, 0xcd, 0x8e, 
-	0xb5, 0x97, 0x61, 0x71, 0xb1, 0xd7, 0x77, 0xf3, 0xae, 0x82, 0xc2, 0x65, 0x66, 
-	0xc2, 0x91, 0xed, 0xcd, 0x73, 0xd4, 0x4d, 0x1d, 0x74, 0xec, 0xcb, 0x16, 0x1a, 
-	0x32, 0xbe, 0x9 , 0x51, 0x8f, 0xa5, 0x6d, 0x69, 0xfa, 0x1c, 0x68, 0xdb, 0xb0, 
-	0x3f, 0x1 , 0x52, 0x69, 0x41, 0x4e, 0xd3, 0x8e, 0x8 , 0xe4, 0x8f, 0xeb, 0x5b, 
-	0x56, 0x28, 0xb , 0x75, 0xe6, 0xb8, 0x2a, 0x49, 0x9d, 0xf4, 0xe0, 0x84, 0xd3, 
-	0x74, 0xa8, 0x42, 0x9c, 0x27, 0x3d, 0xc5, 0x6b, 0xd9, 0xe9, 0xd1, 0x86, 0x54, 
-	0xa , 0x7 , 0xa6, 0x7 , 0x5a, 0x96, 0xc5, 0x22, 0x69, 0x30, 0x4f, 0x38, 0xea, 
-	0x3b, 0x56, 0xa5, 0x9a, 0x6c, 0xe4, 0x9c, 0x8f, 0xa6, 0x31, 0x5c, 0xb2, 0x93, 
-	0x3a, 0xa3, 0x4 , 0x47, 0x6 , 0x94, 0xaf, 0x1e, 0x55, 0x7d, 0x89, 0xa9, 0x46, 
-	0x93, 0x1a, 0xf0, 0xeb, 0x81, 0xdd, 0xab, 0x5f, 0x4d, 0xf2, 0x80, 0xc , 0x17, 
-	0xd , 0xc6, 0x2a, 0xde, 0xd8, 0x9f, 0xf8, 0x43, 0x67, 0xb7, 0x6c, 0xd6, 0x2e, 
-	0x4c, 0xd3, 0x95, 0x1c, 0x96, 0xa7, 0xa4, 0xa7, 0x96, 0x40, 0x3 , 0xf2, 0xed, 
-	0x5c, 0x67, 0x89, 0x34, 0x65, 0x56, 0x23, 0x6f, 0x53, 0xd3, 0x15, 0xea, 0x9a, 
-	0x8a, 0x20, 0x85, 0xc8, 0xc2, 0x80, 0xb8, 0x25, 0x87, 0x4a, 0xe1, 0xbc, 0x52, 
-	0xe8, 0x3e, 0x5e, 0x37, 0xe , 0xa3, 0x3f, 0xad, 0x6b, 0x4d, 0xbb, 0x98, 0xd4, 
-	0x8a, 0xb1, 0xe6, 0x3a, 0xce, 0x9b, 0x1c, 0x3b, 0x8e, 0x3f, 0x1c, 0x55, 0x4d, 
-	0x14, 0x1f, 0xb5, 0x80, 0x40, 0xf4, 0xe9, 0x5b, 0x1e, 0x26, 0x9b, 0x76, 0x54, 
-	0xfd, 0xea, 0xc9, 0xd0, 0xd8, 0xfd, 0xb3, 0x4 , 0x74, 0x3d, 0xeb, 0xd4, 0x87, 
-	0xc0, 0x79, 0xfa, 0x7b, 0x44, 0x7b, 0x37, 0xc2, 0x78, 0x8a, 0x47, 0x19, 0xc7, 
-	0x53, 0xde, 0xbd, 0xcf, 0xc1, 0x96, 0xaf, 0x2c, 0x91, 0xa0, 0x65, 0x65, 0x2b, 
-	0x9e, 0x7b, 0x1f, 0x4a, 0xf0, 0xff, 0x0 , 0x86, 0x72, 0xed, 0x85, 0x3f, 0xc , 
-	0x57, 0xb7, 0xf8, 0x16, 0x70, 0xb2, 0x6 , 0xc7, 0xa , 0x3 , 0x13, 0xb7, 0x3d, 
-	0x8 , 0xfd, 0x2b, 0xce, 0x7f, 0x19, 0xea, 0xbb, 0xfb, 0x32, 0xce, 0xad, 0x1a, 
-	0xc5, 0x76, 0x46, 0x7e, 0x6e, 0x9 , 0xa8, 0xe0, 0x3c, 0xee, 0x7 , 0xaf, 0x2 , 
-	0xa4, 0xd5, 0x24, 0xf3, 0x1d, 0x98, 0xf3, 0x86, 0x3f, 0x8d, 0x43, 0x6e, 0xd8, 
-	0xe0, 0x9c, 0x8a, 0xe5, 0xa8, 0xb7, 0x36, 0x87, 0xc2, 0x8b, 0x2b, 0xa , 0x3e, 
-	0xed, 0xd8, 0xc3, 0xc , 0x30, 0x3d, 0xeb, 0x23, 0x5f, 0xd0, 0x14, 0xa8, 0x96, 
-	0x8 , 0xce, 0xc0, 0x32, 0xd8, 0x18, 0xe7, 0x3d, 0xfd, 0x3a, 0xd6, 0xb5, 0xbc, 
-	0xa0, 0xe , 0x78, 0xfe, 0x95, 0x7a, 0xd8, 0xb3, 0xe5, 0x7c, 0xd5, 0x44, 0xcf, 
-	0x39, 0x1d, 0x41, 0xe3, 0x15, 0x10, 0xd7, 0x43, 0x2a, 0x97, 0x8b, 0xba, 0x3c, 
-	0xd2, 0xfb, 0x47, 0x2b, 0x26, 0xff, 0x0 , 0x24, 0xed, 0x3d, 0x42, 0xf5, 0xcd, 
-	0x52, 0x93, 0x4c, 0x8c, 0x7f, 0xac, 0x8c, 0x1c, 0x82, 0xf , 0xcb, 0x9c, 0x8a, 
-	0xf4, 0x6d, 0x6a, 0xdd, 0x31, 0x1e, 0x0 , 0x5f, 0x2d, 0x42, 0x93, 0x8e, 0x18, 
-	0xf6, 0x1f, 0xe7, 0x9e, 0x6b, 0x1a, 0xf2, 0xd4, 0x3c, 0xd9, 0x48, 0xc9, 0xdd, 
-	0xd4, 0x30, 0xc7, 0x6f, 0x6f, 0xad, 0x56, 0xa9, 0x8d, 0x49, 0x49, 0x6a, 0x72, 
-	0x23, 0xc3, 0xd6, 0x8f, 0x9c, 0x46, 0xbc, 0x8c, 0xaf, 0xb7, 0xe9, 0x49, 0x27, 
-	0x87, 0x6d, 0xed, 0x99, 0x49, 0x84, 0xaf, 0xcb, 0xca, 0x91, 0xc8, 0x23, 0xd7, 
-	0x22, 0xba, 0x69, 0x2c, 0xd4, 0xed, 0x64, 0x65, 0xe4, 0x7c, 0xca, 0x47, 0x20, 
-	0x7a, 0xd3, 0x5a, 0x3f, 0x94, 0xe7, 0xe6, 0x1f, 0xc2, 0x47, 0x63, 0x4f, 0x9c, 
-	0x9b, 0x76, 0x30, 0xed, 0xf4, 0x24, 0x33, 0x79, 0xb1, 0xd , 0xca, 0xa0, 0x3 , 
-	0xb9, 0x54, 0x63, 0x9f, 0x4c, 0xf3, 0x52, 0xc7, 0x60, 0x23, 0xf9, 0x48, 0x6d, 
-	0xd9, 0x19, 0xe3, 0xa5, 0x6a, 0xfd, 0x9d, 0xb7, 0x6e, 0x5c, 0x30, 0x7 , 0x38, 
-	0x3 , 0x9f, 0xc2, 0x9d, 0xe4, 0x96, 0x66, 0x1b, 0x49, 0x7e, 0xc1, 0xfb, 0x7e, 
-	0x14, 0xb9, 0xae, 0x34, 0x54, 0x82, 0xc0, 0x1d, 0xa7, 0xe4, 0x2d, 0x9c, 0xaf, 
-	0x27, 0x91, 0x8e, 0xbf, 0xe7, 0xd2, 0x9f, 0x35, 0xb8, 0x5e, 0x36, 0xaf, 0x24, 
-	0x74, 0x39, 0x2 , 0xad, 0xdc, 0x46, 0x89, 0xc1, 0xf9, 0x57, 0xab, 0x1e, 0x47, 
-	0xf3, 0xa6, 0x32, 0x2f, 0x93, 0xe6, 0x13, 0xd3, 0x8c, 0x81, 0x51, 0x23, 0x58, 
-	0xa6, 0x67, 0x49, 0x18, 0xce, 0x15, 0x73, 0xce, 0x73, 0xfd, 0x45, 0x50, 0xbc, 
-	0x52, 0x23, 0x65, 0x23, 0x19, 0xce, 0xda, 0xd7, 0x7c, 0x2b, 0x32, 0x8c, 0x85, 
-	0xc9, 0x21, 0xb3, 0xce, 0x3d, 0x3d, 0xab, 0x2f, 0x56, 0xf9, 0x51, 0x81, 0xcf, 
-	0x4e, 0xa6, 0x84, 0x8a, 0x67, 0xc8, 0xbf, 0xb5, 0xfd, 0xc2, 0xb7, 0x8e, 0x6d, 
-	0xa0, 0x7 , 0xfd, 0x4d, 0xbe, 0x48, 0xfa, 0x9a, 0xf2, 0xe , 0x48, 0x7 , 0xde, 
-	0xbb, 0xff, 0x0 , 0xda, 0x6b, 0x50, 0x17, 0xdf, 0x16, 0x2f, 0xd5, 0x4e, 0xe5, 
-	0xb7, 0x9 , 0x8 , 0x3f, 0x45, 0xc9, 0xfd, 0x4d, 0x70, 0xb , 0xf7, 0x1 , 0xf7, 
-	0xaf, 0x6a, 0x8a, 0xb5, 0x34, 0x7c, 0x8e, 0x2a, 0x5c, 0xd8, 0x89, 0xb2, 0xcd, 
-	0xab, 0xb2, 0xb3, 0x60, 0x90, 0x7a, 0x8c, 0x56, 0x82, 0x6d, 0x94, 0xa6, 0xdc, 
-	0x7 , 0x65, 0xe8, 0x7e, 0xeb, 0x7f, 0xf5, 0xeb, 0x32, 0x13, 0x86, 0x53, 0xf8, 
-	0x1a, 0xb2, 0x8c, 0x44, 0x6a, 0xc3, 0xf8, 0x5b, 0xc , 0x3d, 0xaa, 0x67, 0x1b, 
-	0x9d, 0xb8, 0x5a, 0xbc, 0xb1, 0xb3, 0xd8, 0xbe, 0xac, 0xf0, 0x30, 0x75, 0xcf, 
-	0x4e, 0x41, 0xfe, 0x46, 0xb4, 0x61, 0x96, 0x39, 0x30, 0xcb, 0xdf, 0xa8, 0xee, 
-	0xbf, 0xfd, 0x6a, 0xcf, 0xb2, 0xb8, 0x49, 0x54, 0x47, 0x37, 0xd0, 0x13, 0xfd, 
-	0x6a, 0xcb, 0x40, 0x43, 0x2b, 0xc4, 0xd8, 0x3d, 0xb0, 0x6b, 0x8e, 0x6b, 0x5b, 
-	0x33, 0xe8, 0x30, 0xd3, 0x76, 0xbc, 0x1d, 0xd7, 0x63, 0x5a, 0xd9, 0x8a, 0x10, 
-	0x51, 0x8a, 0x8e, 0xa7, 0xb8, 0xfc, 0xab, 0x42, 0xce, 0x7d, 0xaf, 0xf3, 0x8d, 
-	0xbd, 0xc3, 0x27, 0xdd, 0x3f, 0x81, 0xe9, 0x58, 0x56, 0x37, 0xc , 0xb3, 0x5 , 
-	0x70, 0x3 , 0x1f, 0x7e, 0xd , 0x6b, 0xc3, 0x2c, 0x52, 0x28, 0x12, 0x29, 0x53, 
-	0xd9, 0x85, 0x72, 0x54, 0x83, 0x3d, 0xcc, 0x2e, 0x26, 0x17, 0xde, 0xc6, 0x93, 
-	0x45, 0x1c, 0xd1, 0xee, 0xa , 0x1b, 0xdd, 0x79, 0xcd, 0x64, 0xea, 0x5a, 0xa , 
-	0x3a, 0xb3, 0x43, 0xf2, 0x36, 0x78, 0xda, 0x7f, 0xa5, 0x5f, 0x58, 0xe5, 0x45, 
-	0x66, 0x87, 0x6c, 0x80, 0x73, 0x90, 0x70, 0x45, 0x4a, 0xb3, 0x92, 0xc1, 0x64, 
-	0x4 , 0x1c, 0xf4, 0x65, 0xc1, 0xfd, 0x7a, 0xd7, 0x3a, 0x94, 0xe0, 0xef, 0x16, 
-	0x7a, 0x93, 0xa3, 0x43, 0x11, 0x1b, 0x4d, 0x1c, 0x8d, 0xe5, 0xa5, 0xed, 0x9b, 
-	0x71, 0x89, 0x36, 0xff, 0x0 , 0x9 , 0xee, 0x3f, 0xc6, 0xa3, 0x8e, 0x58, 0xe5, 
-	0x5e, 0x55, 0x90, 0xf7, 0x57, 0xf9, 0x80, 0xfc, 0x3a, 0xfe, 0xb5, 0xd9, 0xcd, 
-	0x1c, 0x72, 0x82, 0x30, 0x1b, 0x3d, 0xbb, 0xfe, 0x46, 0xa9, 0xdd, 0xe8, 0xf6, 
-	0xd2, 0x7c, 0xe8, 0x2 , 0x37, 0x75, 0x23, 0x19, 0xfc, 0xeb, 0xa6, 0x38, 0xb4, 
-	0xfe, 0x24, 0x79, 0x35, 0xb2, 0x59, 0x45, 0xb7, 0x4a, 0x57, 0x5d, 0x8e, 0x72, 
-	0x18, 0xb8, 0xfd, 0xd6, 0xd6, 0x53, 0xd5, 0x73, 0xd3, 0xf3, 0xa9, 0x23, 0xd , 
-	0xbb, 0xe5, 0xdc, 0xc3, 0x1d, 0x7 , 0x27, 0xf4, 0xeb, 0x5a, 0x17, 0x3a, 0x4c, 
-	0xb0, 0x1d, 0xea, 0x8c, 0xcb, 0x9e, 0xab, 0xd5, 0x7f, 0x95, 0x45, 0x25, 0xbb, 
-	0x39, 0x60, 0xad, 0xb5, 0xc7, 0xaa, 0xff, 0x0 , 0x9c, 0xd6, 0x9e, 0xd2, 0x32, 
-	0xea, 0x73, 0x47, 0xd , 0x5a, 0x9b, 0xb3, 0x44, 0x51, 0xc8, 0x7 , 0xcc, 0x43, 
-	0x29, 0x7 , 0xa8, 0xfe, 0xb5, 0x66, 0xde, 0x75, 0x3c, 0x63, 0xaf, 0x5e, 0x3f, 
-	0xa5, 0x40, 0x16, 0x45, 0x5f, 0xde, 0x1d, 0xad, 0xea, 0xad, 0xc1, 0xa7, 0x2b, 
-	0xba, 0xb6, 0xb , 0x83, 0xcf, 0xf1, 0xc , 0xe2, 0xb3, 0x92, 0x4c, 0xea, 0xa7, 
-	0x52, 0x51, 0x2f, 0x5a, 0xcc, 0xc1, 0x73, 0x1c, 0xd8, 0x61, 0xc6, 0xd6, 0xe4, 
-	0x1f, 0xc6, 0xae, 0x45, 0x73, 0x20, 0xe2, 0x58, 0x9d, 0x47, 0xf7, 0x87, 0x22, 
-	0xb2, 0xd1, 0xbf, 0xbe, 0x7f, 0x14, 0xe9, 0x53, 0x41, 0x31, 0x5f, 0xf5, 0x72, 
-	0x96, 0xe7, 0x85, 0x6a, 0xc6, 0x51, 0xb9, 0xdd, 0xa , 0xe9, 0x2d, 0x7f, 0xaf, 
-	0x91, 0xa8, 0xa5, 0x5d, 0x72, 0x8e, 0x78, 0xec, 0xd , 0xd , 0x24, 0xaa, 0xbc, 
-	0xed, 0x6f, 0xad, 0x66, 0x9b, 0xa8, 0xf7, 0x7e, 0xf6, 0x23, 0x13, 0x7f, 0x79, 
-	0x4f, 0x6 , 0xa5, 0x49, 0x9 , 0xe5, 0x25, 0x5e, 0x7a, 0x67, 0x8f, 0xe5, 0x55, 
-	0xf , 0x69, 0x1d, 0x99, 0x8d, 0x65, 0x84, 0xaa, 0xad, 0x28, 0xfd, 0xdf, 0xe4, 
-	0xcb, 0x9f, 0x68, 0x19, 0xf9, 0x91, 0x97, 0xf0, 0xa9, 0xe0, 0xb8, 0x53, 0xc6, 
-	0x78, 0xf6, 0xac, 0xf2, 0xd7, 0x21, 0x47, 0xca, 0xa4, 0x7b, 0x53, 0xa3, 0x74, 
-	0x76, 0xc3, 0x28, 0x56, 0xff, 0x0 , 0x3e, 0x95, 0xdd, 0x4e, 0xbd, 0x68, 0xe8, 
-	0x7c, 0xfe, 0x2f, 0x2d, 0xc0, 0x54, 0x4e, 0x4a, 0xff, 0x0 , 0x2d, 0xd7, 0xcb, 
-	0xa9, 0xa9, 0xbd, 0x40, 0xce, 0xee, 0x29, 0x55, 0xb3, 0xf7, 0x47, 0x1e, 0xb5, 
-	0x9f, 0x99, 0xa1, 0x39, 0x23, 0x7a, 0xff, 0x0 , 0x2a, 0xb7, 0x6b, 0x3c, 0x72, 
-	0xae, 0x43, 0x1e, 0x3a, 0x8a, 0xf4, 0xa9, 0x55, 0x72, 0x76, 0x92, 0xb3, 0x3e, 
-	0x4f, 0x15, 0x81, 0x8d, 0x28, 0xb9, 0xd3, 0x97, 0x34, 0x7b, 0xf6, 0xf5, 0x5d, 
-	0xb , 0x7 , 0x9a, 0x6d, 0x3 , 0x8e, 0x87, 0x34, 0x57, 0x49, 0xe5, 0x85, 0x19, 
-	0xa2, 0x8c, 0x53, 0x1 , 0x9 , 0xa4, 0xa2, 0x8a, 0x0 , 0x28, 0xfc, 0x68, 0xa3, 
-	0xf0, 0xa0, 0x3 , 0xf1, 0xa6, 0xb5, 0x29, 0xfa, 0x52, 0x50, 0x1 , 0xde, 0x8a, 
-	0x29, 0x9 , 0xa0, 0x4 , 0xa2, 0x8a, 0x28, 0x1 , 0x9 , 0xa4, 0xa2, 0x8a, 0x0 , 
-	0x3f, 0x1a, 0x3f, 0x1a, 0x3f, 0xa , 0x3f, 0xa , 0x0 , 0x46, 0xfa, 0xd2, 0x52, 
-	0xb7, 0xd2, 0x92, 0x80, 0xa , 0x69, 0xa3, 0x34, 0x50, 0x1 , 0x4d, 0x34, 0xad, 
-	0x49, 0x40, 0x5 , 0x1f, 0x8d, 0x14, 0x7e, 0x14, 0x0 , 0x8d, 0xf5, 0xa4, 0xa5, 
-	0x6f, 0xa5, 0x25, 0x0 , 0x23, 0x52, 0x52, 0xb5, 0x25, 0x30, 0x11, 0xa9, 0x29, 
-	0x5a, 0x92, 0x98, 0x5 , 0x1f, 0x8d, 0x1f, 0x85, 0x21, 0xfa, 0x50, 0x2 , 0x51, 
-	0x9a, 0x29, 0x1a, 0x80, 0x12, 0x91, 0xa9, 0x69, 0x1a, 0x80, 0x12, 0x8f, 0xc6, 
-	0x8a, 0x3f, 0xa , 0x0 , 0x4f, 0xc6, 0x90, 0xd2, 0xe3, 0xda, 0x90, 0xd0, 0x3 , 
-	0xc0, 0xa5, 0xa4, 0x6 , 0x9c, 0x5 , 0x30, 0x16, 0x95, 0x7e, 0xb4, 0x94, 0xab, 
-	0xf4, 0xa4, 0x2 , 0xfe, 0x34, 0x51, 0xf8, 0x51, 0x40, 0x0 , 0xa7, 0x52, 0x2d, 
-	0x2d, 0x0 , 0x3a, 0x8a, 0x29, 0x57, 0xe9, 0x40, 0xb , 0xf8, 0xd1, 0x47, 0xe1, 
-	0x45, 0x0 , 0x2a, 0xd2, 0xd2, 0x2d, 0x2f, 0x7a, 0x6 , 0x3b, 0x34, 0x52, 0x2d, 
-	0x2d, 0x2 , 0x1d, 0xf8, 0xd1, 0xf8, 0xd1, 0xf8, 0x51, 0xf8, 0x50, 0x1 , 0x4a, 
-	0xb4, 0x94, 0xab, 0x48, 0x5 , 0xa5, 0x5a, 0x4a, 0x55, 0xa4, 0x2 , 0xd2, 0x8a, 
-	0x4a, 0x50, 0x28, 0x1 , 0x7f, 0x1a, 0x28, 0xfc, 0x28, 0xa0, 0x61, 0x4a, 0xd , 
-	0x25, 0x28, 0x14, 0x0 , 0xb4, 0xa0, 0xd2, 0x52, 0x81, 0x40, 0x85, 0xa2, 0x8a, 
-	0x28, 0x18, 0xef, 0xc6, 0x8f, 0xc6, 0x90, 0x7d, 0x29, 0x7f, 0xa , 0x0 , 0x3f, 
-	0x1a, 0x28, 0xfc, 0x28, 0xfc, 0x28, 0x0 , 0xa5, 0x5a, 0x4a, 0x30, 0xf , 0x51, 
-	0x40, 0xc3, 0x38, 0xeb, 0x48, 0xcc, 0xbf, 0xf3, 0xd3, 0xf3, 0x19, 0xa5, 0xa , 
-	0x3d, 0x29, 0x24, 0x8 , 0xab, 0x92, 0x6 , 0x3e, 0x94, 0x86, 0xac, 0x43, 0x22, 
-	0x29, 0xfe, 0x2e, 0xbe, 0x98, 0x15, 0xd , 0xc4, 0x50, 0x22, 0x16, 0x79, 0x88, 
-	0xf4, 0xc9, 0xa5, 0x9a, 0xe2, 0xd1, 0x39, 0x72, 0xbd, 0x38, 0xc2, 0x9c, 0xff, 
-	0x0 , 0x2a, 0xc9, 0xba, 0xbc, 0x3 , 0xfd, 0x4c, 0x3b, 0xcf, 0x63, 0xe5, 0x93, 
-	0xfd, 0x79, 0xac, 0xe5, 0x24, 0x8e, 0x9a, 0x74, 0xe5, 0x27, 0xa1, 0x35, 0xd0, 
-	0xb4, 0xc8, 0x79, 0x27, 0xdc, 0xa1, 0xb8, 0x52, 0xfd, 0x70, 0xf , 0x61, 0xcf, 
-	0xa7, 0x15, 0x8d, 0xa9, 0xcc, 0xa6, 0xdc, 0xc4, 0xb , 0x47, 0x1e, 0x47, 0xca, 
-	0xf , 0x5c, 0xe , 0xf4, 0x6a, 0x17, 0x53, 0x10, 0xce, 0xee, 0xb1, 0x76, 0x4 , 
-	0xb0, 0xdd, 0xf4, 0xc0, 0xac, 0x6b, 0xa9, 0xa5, 0x90, 0xe4, 0xe5, 0x81, 0xe1, 
-	0x78, 0xc0, 0x3f, 0x4a, 0xc2, 0x52, 0xec, 0x77, 0x53, 0xa5, 0x6d, 0x5b, 0x1d, 
-	0x79, 0x3a, 0xed, 0x55, 0x8c, 0x7c, 0xa1, 0x7a, 0x9a, 0xa2, 0xc7, 0x77, 0x43, 
-	0x52, 0xdc, 0x46, 0xcb, 0xfe, 0xb5, 0x80, 0x38, 0xfb, 0xa0, 0xd3, 0x21, 0x43, 
-	0x34, 0x81, 0x22, 0x42, 0xc4, 0xf4, 0xac, 0xed, 0x76, 0x6f, 0xcc, 0x92, 0xd0, 
-	0x63, 0x14, 0xff, 0x0 , 0x7b, 0xe8, 0x29, 0xae, 0xcd, 0x8f, 0xee, 0x8a, 0x9a, 
-	0x65, 0x8a, 0x25, 0xc6, 0x77, 0x38, 0x3c, 0x95, 0xfb, 0xbf, 0xfd, 0x7a, 0xac, 
-	0xc7, 0x2d, 0xdc, 0x9c, 0xf1, 0x54, 0x65, 0x29, 0xf6, 0x15, 0x7d, 0xfe, 0xa4, 
-	0xd2, 0xb0, 0xc9, 0x24, 0x9f, 0xc3, 0xfa, 0x50, 0xa0, 0xb3, 0x6d, 0x5e, 0xbe, 
-	0xbe, 0xa7, 0xd7, 0xe8, 0x2a, 0x48, 0xd0, 0x13, 0xc7, 0x45, 0xef, 0xfd, 0x68, 
-	0x33, 0xd6, 0x43, 0x76, 0xb2, 0xfc, 0xdd, 0x59, 0xba, 0xa , 0x9a, 0x18, 0x77, 
-	0x91, 0xa , 0xfd, 0x64, 0x61, 0x52, 0x59, 0xc0, 0xf2, 0xb6, 0xe5, 0x7 , 0x73, 
-	0xf1, 0x18, 0xf4, 0x1e, 0xb5, 0xa4, 0xd6, 0xf1, 0x58, 0xd9, 0x96, 0x6f, 0xbc, 
-	0x3a, 0xfb, 0x9f, 0x4a, 0x99, 0x49, 0x23, 0xa2, 0x9d, 0x27, 0x2d, 0x7a, 0x19, 
-	0xf7, 0x61, 0x62, 0x5c, 0x7e, 0x43, 0xd6, 0xaa, 0x4c, 0x4c, 0x71, 0xe4, 0xfd, 
-	0xf7, 0x1f, 0x90, 0xab, 0xc , 0x77, 0x31, 0xb8, 0x98, 0x2 , 0x7 , 0x45, 0xec, 
-	0x7d, 0x5 , 0x54, 0x72, 0x64, 0x73, 0x23, 0x9e, 0x3b, 0x9a, 0x22, 0x4d, 0x47, 
-	0xd0, 0x8b, 0x18, 0x5c, 0x9e, 0xa7, 0xa5, 0x46, 0xdc, 0x71, 0x4f, 0x90, 0xe7, 
-	0xe6, 0xfc, 0xa9, 0xab, 0xcd, 0x68, 0x8e, 0x29, 0xee, 0x14, 0x51, 0xd7, 0x9a, 
-	0x2b, 0x42, 0x6 , 0xd3, 0x4d, 0x3a, 0x9a, 0xc7, 0x26, 0xa4, 0x92, 0xde, 0x99, 
-	0x74, 0xb0, 0xb6, 0xd9, 0x3e, 0xee, 0x78, 0x3e, 0x95, 0xbb, 0xa6, 0xcd, 0x14, 
-	0xac, 0x7c, 0xb7, 0x56, 0xe3, 0x3c, 0x1a, 0xe5, 0xdb, 0x8a, 0xd0, 0xf0, 0xbc, 
-	0x9b, 0x35, 0x65, 0x5c, 0xf0, 0xe0, 0xaf, 0xf5, 0xfe, 0x95, 0xb4, 0x24, 0xf6, 
-	0x33, 0x3b, 0x1b, 0x16, 0xed, 0x5a, 0x90, 0x9c, 0xa5, 0x64, 0x5b, 0xfc, 0xad, 
-	0x8a, 0xd3, 0xb6, 0x3d, 0x3e, 0x95, 0xd5, 0x12, 0xd6, 0xc4, 0xf8, 0xa5, 0x61, 
-	0x85, 0xdc, 0x7a, 0x50, 0xb4, 0xe1, 0xd3, 0x9a, 0xad, 0xcb, 0x5 , 0x38, 0x3d, 
-	0x2b, 0x53, 0x4f, 0xbb, 0xb , 0x8d, 0xd9, 0xdd, 0x8a, 0xcb, 0x6c, 0x63, 0x20, 
-	0xe2, 0x9f, 0x1b, 0x6c, 0xe6, 0xa6, 0x51, 0xb9, 0xac, 0x27, 0x66, 0x77, 0x1e, 
-	0x1f, 0xbe, 0x7 , 0x3 , 0xd3, 0xa0, 0xcd, 0x75, 0x5a, 0x5c, 0xfb, 0xe3, 0xcf, 
-	0x19, 0xee, 0x2b, 0xcc, 0x34, 0xcb, 0x92, 0x92, 0x2 , 0x1f, 0xf5, 0xae, 0xab, 
-	0x41, 0xd4, 0x5f, 0xcc, 0xa , 0xc7, 0x8f, 0x5c, 0xd7, 0x9f, 0x5a, 0x91, 0xe8, 
-	0xd2, 0xa8, 0x77, 0x76, 0x17, 0xa , 0xe4, 0x6d, 0x4 , 0x15, 0x3d, 0xeb, 0x5e, 
-	0xde, 0xe1, 0x5b, 0x20, 0x93, 0x5c, 0xb6, 0x9b, 0x75, 0x96, 0xc8, 0xe7, 0xd4, 
-	0xd6, 0xa4, 0x72, 0x81, 0x87, 0xdd, 0xd4, 0x8c, 0x1c, 0xf7, 0xaf, 0x3e, 0x71, 
-	0x3b, 0x63, 0x3d, 0xe , 0x86, 0x2b, 0x90, 0x88, 0x4e, 0x4b, 0x77, 0x15, 0x61, 
-	0x2f, 0xe , 0x78, 0x91, 0x46, 0xe1, 0xce, 0x6b, 0x9e, 0x8e, 0xe4, 0xb2, 0x60, 
-	0xb1, 0xe0, 0xf6, 0xa6, 0xc9, 0x70, 0xf1, 0x8f, 0x95, 0x9b, 0xd , 0xdc, 0x56, 
-	0x7c, 0xa5, 0xf3, 0x9b, 0x1a, 0xad, 0xf8, 0xf2, 0x1b, 0x24, 0x64, 0x8c, 0x70, 
-	0x6b, 0x81, 0xf1, 0x55, 0xd3, 0x8 , 0x5f, 0xf7, 0x9d, 0xbb, 0x7e, 0x95, 0xab, 
-	0xa9, 0x5f, 0xee, 0x88, 0xa9, 0x1b, 0xb2, 0x7b, 0x77, 0xae, 0x4b, 0xc4, 0xf7, 
-	0x66, 0x68, 0x64, 0x7 , 0x8e, 0xa3, 0x6 , 0xb6, 0xa5, 0xd , 0x4c, 0x2a, 0xd4, 
-	0xd0, 0xe5, 0x35, 0x6b, 0xc6, 0x79, 0xf , 0xcd, 0x93, 0x49, 0xa1, 0x1d, 0xf7, 
-	0x80, 0x83, 0xf3, 0x1a, 0xcd, 0xb8, 0x72, 0x6e, 0x1b, 0x27, 0xbd, 0x6a, 0x78, 
-	0x55, 0x37, 0xdf, 0xae, 0x3d, 0x6b, 0xd5, 0xe5, 0xe5, 0x81, 0xe7, 0xc5, 0xde, 
-	0xa1, 0xed, 0x5f, 0xe , 0x17, 0x31, 0xa1, 0x3 , 0x19, 0xc0, 0xfa, 0x9a, 0xf7, 
-	0xf , 0x3 , 0xc7, 0xe6, 0x28, 0x20, 0xb6, 0xe4, 0x5c, 0x8d, 0xb8, 0xce, 0x78, 
-	0xf5, 0xaf, 0x1b, 0xf8, 0x77, 0x11, 0xdb, 0x18, 0x1d, 0x30, 0x31, 0x5e, 0xd9, 
-	0xf0, 0xf4, 0x37, 0x99, 0xb0, 0x8c, 0xab, 0x76, 0x53, 0x82, 0x48, 0x7 , 0xa6, 
-	0x7e, 0xb5, 0xe5, 0xef, 0x33, 0xd9, 0x96, 0x94, 0x87, 0x6a, 0x4b, 0xe5, 0xca, 
-	0x54, 0xb2, 0xee, 0x27, 0xb7, 0xf2, 0xaa, 0x7e, 0x60, 0x5e, 0x0 , 0xc3, 0x63, 
-	0x1f, 0x5a, 0xd3, 0xd7, 0x20, 0x3f, 0x6a, 0x2e, 0xc0, 0xee, 0xce, 0x40, 0xc6, 
-	0x31, 0xed, 0x8a, 0xc4, 0xf3, 0x2 , 0xdc, 0x6d, 0x6e, 0x39, 0xe3, 0x3d, 0xab, 
-	0x96, 0xa2, 0xd5, 0x9b, 0x53, 0xd6, 0x28, 0xb0, 0xd2, 0x38, 0x1c, 0x1c, 0x7a, 
-	0x13, 0x53, 0x5b, 0x5d, 0x2c, 0x2a, 0xc5, 0x1c, 0xee, 0x3d, 0x9 , 0x7 , 0x19, 
-	0xfc, 0xf8, 0xaa, 0x32, 0x5c, 0xe6, 0x3c, 0x30, 0xfb, 0xbd, 0xf , 0xad, 0x54, 
-	0x92, 0xe1, 0x77, 0x6e, 0x5e, 0x31, 0xef, 0x5c, 0xc9, 0xd8, 0x26, 0xae, 0x8d, 
-	0x4b, 0x8b, 0x88, 0xe5, 0x3b, 0x81, 0x45, 0x6d, 0xa0, 0x37, 0x39, 0xdd, 0xf4, 
-	0x15, 0x4a, 0x49, 0x1b, 0x9c, 0x9e, 0x5b, 0x9d, 0xa4, 0x67, 0xf5, 0xaa, 0x6d, 
-	0x74, 0x47, 0x42, 0xac, 0x17, 0xda, 0xa3, 0x13, 0x8d, 0xca, 0x5f, 0x2d, 0xdb, 
-	0x91, 0x54, 0xd9, 0x9a, 0x56, 0x27, 0x92, 0x60, 0xaf, 0xb0, 0xd , 0xc6, 0x43, 
-	0xc6, 0x7b, 0x7e, 0x34, 0xe2, 0x23, 0xd , 0x84, 0x66, 0x46, 0x3 , 0x95, 0x71, 
-	0x9c, 0xfa, 0xd5, 0x39, 0x26, 0x4c, 0x60, 0x65, 0x83, 0xc , 0x63, 0xd0, 0x51, 
-	0x99, 0x8f, 0xc8, 0x3e, 0x7f, 0x5f, 0x94, 0xf0, 0x28, 0x43, 0x34, 0x30, 0x85, 
-	0x7a, 0x5 , 0x61, 0xfc, 0xaa, 0xb4, 0x88, 0x77, 0x4 , 0x51, 0x85, 0xe4, 0x6e, 
-	0xef, 0x50, 0xb4, 0x8e, 0x85, 0x79, 0xe3, 0xa6, 0x29, 0xd2, 0x4a, 0x4e, 0xdc, 
-	0x36, 0x7 , 0xbf, 0x4f, 0xc6, 0x82, 0x96, 0x81, 0xc4, 0x68, 0xc8, 0xc1, 0x8e, 
-	0xf2, 0x79, 0x3d, 0x8d, 0x3e, 0x49, 0x4 , 0xd6, 0xfc, 0xa7, 0x50, 0x71, 0x93, 
-	0x80, 0x4f, 0xf9, 0xc5, 0x45, 0x1b, 0xaf, 0xde, 0x7 , 0x72, 0x77, 0xe7, 0xa5, 
-	0x46, 0xeb, 0x9c, 0x39, 0x5 , 0x54, 0xf5, 0x27, 0xd2, 0x99, 0x68, 0x92, 0x46, 
-	0x55, 0x5c, 0x30, 0xb , 0xc7, 0x6e, 0x0 , 0xe3, 0xd6, 0xb2, 0x3c, 0x40, 0xcb, 
-	0xd , 0x8c, 0xd2, 0xf4, 0x58, 0xd0, 0x92, 0x7d, 0x38, 0xad, 0xc , 0xa9, 0x62, 
-	0xe , 0xd7, 0xc8, 0xe4, 0x67, 0xad, 0x71, 0x3f, 0x1e, 0x75, 0x6f, 0xec, 0x7f, 
-	0x85, 0xba, 0xd6, 0xa0, 0xaf, 0xb5, 0xa2, 0xb4, 0x70, 0x87, 0xd4, 0x91, 0xb4, 
-	0x7e, 0xa6, 0xaa, 0x31, 0xbb, 0xb1, 0x35, 0x24, 0xa3, 0x16, 0xd9, 0xf1, 0x7 , 
-	0x8e, 0x75, 0xf , 0xed, 0x5f, 0x17, 0x6a, 0x3a, 0x86, 0x72, 0x2e, 0x2e, 0xa4, 
-	0x70, 0x7d, 0x8b, 0x1a, 0xcb, 0x41, 0xfb, 0xb6, 0xe7, 0xa1, 0x6 , 0x9a, 0x49, 
-	0x3d, 0x69, 0xd1, 0xe3, 0x76, 0xf , 0x43, 0xd6, 0xbd, 0xb5, 0xa2, 0xb1, 0xf1, 
-	0xb7, 0xbc, 0xae, 0xfa, 0x8f, 0x8c, 0xe0, 0xf3, 0xf4, 0xab, 0xb0, 0x80, 0xd1, 
-	0xe7, 0xd4, 0x61, 0xbf, 0xc7, 0xf5, 0xaa, 0x38, 0x20, 0xe0, 0x8a, 0xb7, 0xa7, 
-	0x38, 0xdd, 0xe5, 0xbf, 0xdd, 0x6e, 0x2b, 0x39, 0xad, 0xe , 0xcc, 0x2c, 0xad, 
-	0x2b, 0x32, 0x58, 0x57, 0x3f, 0x21, 0xfb, 0xd5, 0x7a, 0xca, 0xe1, 0xd4, 0xc , 
-	0x92, 0xde, 0xa3, 0xbd, 0x54, 0xda, 0x41, 0x3f, 0xde, 0x5e, 0xf , 0xb8, 0xf5, 
-	0xa9, 0x94, 0x6d, 0x65, 0x94, 0x72, 0x18, 0xf3, 0x5c, 0xf3, 0xb3, 0x3d, 0x8c, 
-	0x3f, 0x34, 0x1d, 0xd7, 0x43, 0x51, 0x76, 0x4f, 0x1e, 0x42, 0x86, 0xef, 0xc0, 
-	0xc1, 0xcd, 0x24, 0x32, 0x49, 0x6d, 0x27, 0xee, 0xa4, 0xc8, 0xfe, 0xe9, 0x1b, 
-	0x80, 0xf6, 0xf5, 0xaa, 0xf0, 0xb9, 0x8d, 0x83, 0xe7, 0x82, 0x7a, 0x8a, 0xb3, 
-	0x31, 0x90, 0x62, 0x4d, 0xa1, 0xfb, 0x83, 0x8f, 0xbd, 0x5c, 0xdb, 0x3b, 0x74, 
-	0x3d, 0x89, 0x7b, 0xf1, 0xe6, 0x5a, 0x34, 0x5e, 0xb7, 0xd4, 0xe5, 0x56, 0x5c, 
-	0xc7, 0xb4, 0xaf, 0x52, 0x9 , 0xc7, 0xe6, 0x3a, 0x7e, 0x55, 0xa7, 0x61, 0xad, 
-	0x5a, 0x49, 0x1e, 0xcb, 0x81, 0xf2, 0xff, 0x0 , 0xb6, 0x3e, 0x5c, 0xfd, 0x47, 
-	0xff, 0x0 , 0x5a, 0xb9, 0xc8, 0x8a, 0x4c, 0xbf, 0xb9, 0x62, 0xf , 0xf7, 0xf , 
-	0x63, 0xed, 0x9a, 0x46, 0xe1, 0xb7, 0x37, 0xd , 0xd3, 0x7a, 0xf0, 0x7e, 0x86, 
-	0x94, 0xa9, 0xc5, 0xee, 0x69, 0x4b, 0x13, 0x52, 0xb , 0x9a, 0x2f, 0x43, 0xb6, 
-	0xb1, 0x8f, 0x4f, 0xb9, 0x8f, 0xf7, 0x52, 0x32, 0xa9, 0xe8, 0xb , 0x6 , 0x5f, 
-	0xcf, 0x91, 0xfc, 0xa9, 0xcb, 0xa6, 0x4f, 0xf3, 0x49, 0xc , 0xdb, 0xd4, 0x76, 
-	0xfb, 0xe3, 0xfa, 0xd7, 0x17, 0xc , 0xc2, 0x39, 0x15, 0x88, 0x68, 0xc9, 0x3f, 
-	0x7d, 0x7e, 0x5c, 0xfe, 0x23, 0xfc, 0x2b, 0x63, 0x4e, 0xd5, 0xef, 0x22, 0x6d, 
-	0xd0, 0xdd, 0x89, 0xa , 0xf5, 0x49, 0xf , 0xcd, 0xf9, 0x9e, 0x6b, 0x9 , 0xd1, 
-	0xb6, 0xc7, 0xa5, 0x47, 0x31, 0x52, 0xb2, 0x99, 0xb5, 0x2c, 0x24, 0x2e, 0x25, 
-	0x18, 0x3d, 0xd9, 0xd , 0x57, 0x9a, 0xcd, 0x19, 0xb8, 0x9a, 0x33, 0xe8, 0xb , 
-	0xf , 0xeb, 0x53, 0xda, 0xf8, 0x93, 0x77, 0xcb, 0x75, 0x6f, 0xf3, 0x63, 0x86, 
-	0xc0, 0x20, 0xfe, 0x75, 0x76, 0x1b, 0xfb, 0x2b, 0x85, 0xcb, 0x24, 0x27, 0xdd, 
-	0x81, 0x1f, 0xa7, 0x4a, 0xc1, 0xc6, 0xc7, 0xa7, 0x1a, 0xb0, 0x9f, 0x5b, 0x98, 
-	0x17, 0x56, 0x73, 0xab, 0x10, 0x15, 0x5b, 0xe8, 0xb9, 0xfe, 0x47, 0xfa, 0x56, 
-	0x6d, 0xd2, 0x3a, 0x48, 0x52, 0x43, 0x86, 0xfe, 0xeb, 0x64, 0x1f, 0xc8, 0xd7, 
-	0x74, 0x3f, 0xb2, 0xdd, 0x76, 0xba, 0xa7, 0x23, 0xa6, 0xee, 0x3f, 0x22, 0x2a, 
-	0xa5, 0xc5, 0x95, 0x93, 0xfc, 0xb1, 0x34, 0x89, 0xdc, 0x18, 0xdf, 0xfa, 0x66, 
-	0xaa, 0x32, 0xee, 0x61, 0x5b, 0xf , 0x7f, 0x85, 0x9c, 0x33, 0x2e, 0xdf, 0x9b, 
-	0x5 , 0x47, 0xad, 0x2a, 0x2c, 0x8c, 0x70, 0x92, 0x6e, 0xae, 0xc3, 0xfb, 0x2d, 
-	0x4f, 0xfa, 0xb9, 0xe7, 0x6e, 0xcd, 0xf2, 0x8c, 0xfe, 0x24, 0x1a, 0x1a, 0xc6, 
-	0x1f, 0x2f, 0x8f, 0x38, 0xb7, 0x4e, 0x61, 0x6 , 0xb4, 0xf6, 0x88, 0xe3, 0xfa, 
-	0xa4, 0xd1, 0xc9, 0x32, 0xdc, 0xaf, 0x18, 0xe3, 0xd8, 0x1c, 0x51, 0x1f, 0x9a, 
-	0x9f, 0x74, 0x10, 0x7a, 0xfb, 0x7e, 0xb5, 0xd3, 0x98, 0x2d, 0xd3, 0x82, 0x2f, 
-	0xf , 0xa6, 0xdb, 0x70, 0xa3, 0xf9, 0x54, 0x37, 0x11, 0x5b, 0x4a, 0x30, 0xd6, 
-	0xd2, 0xee, 0x1d, 0x19, 0xc8, 0xfe, 0x95, 0x6a, 0x49, 0x99, 0x4e, 0x8c, 0xe3, 
-	0xae, 0xe8, 0xca, 0xb7, 0xbb, 0xba, 0x88, 0x8d, 0xd1, 0xbf, 0x3e, 0x83, 0x22, 
-	0xae, 0xc7, 0x73, 0xd , 0xc2, 0xfe, 0xf1, 0x3c, 0xb3, 0xfd, 0xe3, 0x49, 0x32, 
-	0xc9, 0xb , 0x7f, 0xa3, 0x84, 0xc7, 0xf7, 0x70, 0x79, 0xfc, 0xe9, 0x8c, 0x90, 
-	0x5d, 0x64, 0x48, 0x3c, 0xb9, 0xf , 0x62, 0x6b, 0xa2, 0x9c, 0xe6, 0x95, 0xaf, 
-	0xf7, 0xea, 0x99, 0xe6, 0x62, 0x28, 0x51, 0x6f, 0x9f, 0x96, 0xed, 0x75, 0x8e, 
-	0x8d, 0x7c, 0xba, 0x97, 0x60, 0x67, 0x46, 0xc6, 0xe , 0x3b, 0x66, 0x96, 0x48, 
-	0x49, 0x7f, 0x3a, 0x2f, 0x92, 0x41, 0xd4, 0x1 , 0xd6, 0xa8, 0xed, 0xb8, 0xb5, 
-	0x0 , 0xc4, 0xad, 0x24, 0x63, 0xa8, 0xf4, 0xad, 0xb , 0x2b, 0x95, 0xb8, 0x8f, 
-	0x2a, 0xdf, 0x32, 0x8e, 0x7d, 0x6b, 0xb6, 0x8c, 0xaf, 0xee, 0x4d, 0x5b, 0xb7, 
-	0xfc, 0x39, 0xe0, 0x63, 0x68, 0xb8, 0xaf, 0xac, 0xd0, 0x92, 0x76, 0xde, 0xdf, 
-	0xaa, 0xfc, 0xfa, 0x13, 0x5b, 0xc8, 0x1d, 0x7a, 0x61, 0xbb, 0x8a, 0x92, 0xa0, 
-	0x90, 0x4 , 0x93, 0x78, 0x18, 0xf5, 0xa9, 0x94, 0xe5, 0x73, 0x5d, 0xb1, 0xbe, 
-	0xcc, 0xf0, 0x2b, 0x46, 0x37, 0xe6, 0x8a, 0xb2, 0x7f, 0x80, 0xb4, 0x66, 0x8a, 
-	0x46, 0xab, 0x31, 0x12, 0x8a, 0x28, 0xa0, 0x3 , 0xf1, 0xa3, 0xf1, 0xa3, 0xf0, 
-	0xa3, 0xf0, 0xa0, 0x4 , 0x6f, 0xad, 0x25, 0x2b, 0x7d, 0x29, 0x28, 0x0 , 0xa3, 
-	0x34, 0x52, 0x35, 0x0 , 0x25, 0x14, 0x52, 0x13, 0x40, 0x9 , 0x45, 0x14, 0x50, 
-	0x1 , 0xf8, 0xd1, 0xf8, 0xd1, 0xf8, 0x51, 0xf8, 0x50, 0x3 , 0x68, 0xa2, 0x8a, 
-	0x0 , 0x42, 0x69, 0x29, 0x48, 0xa4, 0xa0, 0x4 , 0x26, 0x92, 0x8a, 0x28, 0x0 , 
-	0xa3, 0xf1, 0xa3, 0xf0, 0xa3, 0xf0, 0xa0, 0x6 , 0xd1, 0x45, 0x14, 0x0 , 0x84, 
-	0xd2, 0x51, 0x45, 0x0 , 0x36, 0x8a, 0x28, 0xa6, 0x80, 0x3f, 0x1a, 0x4c, 0xfb, 
-	0xd2, 0xfe, 0x14, 0x98, 0xf6, 0xa6, 0x2 , 0x51, 0x9a, 0x29, 0x1a, 0x80, 0x12, 
-	0x9a, 0x69, 0x5a, 0x92, 0x80, 0xa , 0x3f, 0x1a, 0x28, 0xfc, 0x28, 0x1 , 0x1b, 
-	0xeb, 0x49, 0x4a, 0xd4, 0x94, 0x0 , 0xf0, 0x29, 0x69, 0x1 , 0xa5, 0xaa, 0x1 , 
-	0xd4, 0xab, 0xf5, 0xa4, 0xa5, 0x5f, 0xa5, 0x20, 0x17, 0xf1, 0xa2, 0x8f, 0xc2, 
-	0x8a, 0x40, 0x2a, 0xd2, 0xd2, 0x2d, 0x2d, 0x0 , 0x3a, 0x94, 0x52, 0x52, 0x81, 
-	0x40, 0xb , 0xf8, 0xd1, 0x47, 0xe1, 0x45, 0x0 , 0x2a, 0xd2, 0xd2, 0x2d, 0x2d, 
-	0x0 , 0x28, 0x14, 0xb4, 0x80, 0xd2, 0xd0, 0x2 , 0xfe, 0x34, 0xb4, 0x9d, 0x69, 
-	0x68, 0x0 , 0xa2, 0x8a, 0x50, 0x28, 0x1 , 0x69, 0xcb, 0x4d, 0xa5, 0xcd, 0x48, 
-	0xb , 0x4a, 0xbf, 0x5a, 0x4a, 0x55, 0xfa, 0x50, 0x2 , 0xfe, 0x34, 0x51, 0xf8, 
-	0x51, 0x40, 0x5 , 0x18, 0xa2, 0x95, 0x68, 0x18, 0xb4, 0x51, 0x4b, 0x8a, 0x0 , 
-	0x5a, 0x29, 0x1 , 0xa5, 0xa0, 0x60, 0xb4, 0xef, 0xc6, 0x93, 0x1e, 0xd4, 0xbf, 
-	0x85, 0x2 , 0xf , 0xc6, 0x8a, 0x3f, 0xa , 0x28, 0x10, 0x51, 0xce, 0xde, 0x5 , 
-	0x14, 0x50, 0x50, 0x73, 0x8e, 0x14, 0xfe, 0x34, 0xd6, 0xce, 0x9 , 0x69, 0x2 , 
-	0x8f, 0x6a, 0x74, 0x8c, 0xaa, 0xa4, 0x9c, 0xe3, 0xd6, 0xab, 0xcc, 0xe3, 0xef, 
-	0x48, 0xac, 0x17, 0x3f, 0x2c, 0x60, 0x72, 0xdf, 0x5a, 0x43, 0x45, 0x79, 0x23, 
-	0x9e, 0x7c, 0xad, 0xbb, 0x2a, 0xaf, 0x76, 0x31, 0xe7, 0x3f, 0x8d, 0x66, 0xdd, 
-	0x5a, 0x4b, 0x33, 0x18, 0xa2, 0xb9, 0x69, 0xe , 0x3e, 0x67, 0x18, 0x8 , 0x3f, 
-	0x1f, 0xf0, 0xad, 0x2b, 0xbb, 0x83, 0xe4, 0x91, 0x26, 0xd5, 0x5f, 0xe1, 0x51, 
-	0xe9, 0xee, 0x7b, 0xff, 0x0 , 0x2f, 0xaf, 0x5a, 0xe7, 0xf5, 0x8d, 0x65, 0x12, 
-	0x36, 0x86, 0xdd, 0xd4, 0x28, 0xea, 0xcb, 0xfd, 0x3f, 0xbc, 0x7d, 0xfa, 0xa , 
-	0xca, 0x76, 0x5b, 0x9d, 0x54, 0xb9, 0xdb, 0xd0, 0x8e, 0xf9, 0x34, 0xfb, 0x4c, 
-	0xc3, 0x14, 0x6b, 0x71, 0x71, 0x8f, 0x99, 0xe4, 0x39, 0x55, 0xff, 0x0 , 0x3e, 
-	0x83, 0xf1, 0x35, 0x89, 0x73, 0x72, 0xef, 0x33, 0x6c, 0xf9, 0x99, 0x86, 0x9 , 
-	0xc0, 0xe9, 0xe8, 0x31, 0xc0, 0x1f, 0x4a, 0xb0, 0xb6, 0xf3, 0xdd, 0x42, 0xd2, 
-	0xbe, 0x2d, 0xed, 0x54, 0xf2, 0xcc, 0x7e, 0xf1, 0xf4, 0xcf, 0x56, 0x34, 0x8a, 
-	0x96, 0xf0, 0x6e, 0xca, 0xb3, 0x10, 0x4e, 0x21, 0x5e, 0xf , 0xd5, 0xcf, 0x6f, 
-	0xa5, 0x62, 0xee, 0xce, 0xb5, 0x68, 0xef, 0xab, 0x2a, 0x45, 0x3 , 0x4a, 0xdb, 
-	0xe4, 0x27, 0x6f, 0x7f, 0xa5, 0x44, 0xd2, 0xa4, 0x53, 0x3e, 0xde, 0x46, 0x30, 
-	0x30, 0x6a, 0x5b, 0x89, 0xe5, 0x97, 0x72, 0xa9, 0x1 , 0x4f, 0x1c, 0x1f, 0x97, 
-	0x1f, 0xd6, 0xa0, 0xb7, 0x8c, 0x3b, 0x30, 0x1f, 0xc3, 0xce, 0xec, 0x7f, 0x21, 
-	0x52, 0x1c, 0xcd, 0xad, 0x48, 0xa6, 0x62, 0xcd, 0x96, 0x18, 0xf6, 0xa4, 0x40, 
-	0x78, 0xc7, 0x53, 0x4b, 0xb4, 0xb3, 0x63, 0x1c, 0xf7, 0xa9, 0x50, 0x6c, 0x5f, 
-	0x90, 0xe5, 0xfb, 0xb7, 0xa5, 0x3 , 0x51, 0xbe, 0xbd, 0x3 , 0x1b, 0x7f, 0x74, 
-	0x98, 0xf3, 0x1b, 0xef, 0x7a, 0x28, 0xa9, 0xad, 0xe2, 0xf3, 0x1d, 0x63, 0x5c, 
-	0x90, 0x7a, 0xfb, 0xfd, 0x7f, 0xcf, 0xa5, 0x47, 0x12, 0x13, 0x95, 0x40, 0x48, 
-	0xcf, 0xcc, 0xdd, 0xd8, 0xfa, 0x56, 0xf6, 0x87, 0x66, 0x90, 0x47, 0xe7, 0xdc, 
-	0x11, 0xfe, 0x7b, 0x56, 0x73, 0xa9, 0xca, 0x8e, 0xbc, 0x3e, 0x1a, 0x55, 0x65, 
-	0xb6, 0x88, 0x9e, 0xce, 0xd5, 0x2d, 0x2d, 0x9a, 0xe2, 0x5e, 0x1b, 0x1d, 0xff, 
-	0x0 , 0x84, 0x56, 0x4d, 0xf4, 0xad, 0x75, 0x73, 0xfd, 0xd5, 0xce, 0x11, 0x4f, 
-	0x45, 0x1e, 0xa6, 0xac, 0xeb, 0x77, 0xc6, 0x46, 0xdb, 0x93, 0x8c, 0xfc, 0xa9, 
-	0xdc, 0x9a, 0xcd, 0x98, 0x95, 0x1b, 0x4f, 0xdf, 0x6e, 0xb8, 0xec, 0x3d, 0x2a, 
-	0x21, 0x77, 0xab, 0x37, 0xac, 0xe3, 0x1f, 0x75, 0x6c, 0x47, 0x74, 0xde, 0x6b, 
-	0x8 , 0xd3, 0x84, 0x5e, 0x9f, 0xe2, 0x7e, 0xb5, 0x5e, 0x62, 0x31, 0xb4, 0x7d, 
-	0xd1, 0xfa, 0xd4, 0xae, 0x40, 0x8f, 0x68, 0xcf, 0xfb, 0x47, 0x3d, 0x6a, 0xb3, 
-	0x9c, 0xb5, 0x6c, 0x8f, 0x3a, 0xa3, 0xb0, 0xc6, 0x27, 0xa5, 0x1c, 0x2a, 0xe2, 
-	0x97, 0xbe, 0x69, 0xa6, 0xb5, 0x39, 0x85, 0xcd, 0x22, 0xf7, 0x34, 0x60, 0x9a, 
-	0x18, 0xe7, 0x8a, 0x4 , 0x34, 0xd3, 0xf , 0x26, 0x9f, 0x4d, 0xa7, 0x63, 0x29, 
-	0x3 , 0xd4, 0xda, 0x6c, 0x9e, 0x55, 0xfc, 0x32, 0x93, 0xc2, 0xc8, 0x33, 0x50, 
-	0xb7, 0x4a, 0x41, 0x4c, 0x86, 0x7a, 0x4 , 0x7d, 0xaa, 0xdd, 0xbb, 0x60, 0x8e, 
-	0x4d, 0x67, 0x68, 0xf2, 0xf9, 0xf6, 0x10, 0xc9, 0xfd, 0xe4, 0x19, 0xfa, 0xf4, 
-	0xab, 0xe9, 0xc3, 0xa , 0xec, 0x89, 0x68, 0xbd, 0x13, 0x64, 0x62, 0xa4, 0x7 , 
-	0xb6, 0x6a, 0xaa, 0xfd, 0x7a, 0xd4, 0xc8, 0x78, 0xc6, 0xee, 0x45, 0x68, 0x8a, 
-	0x44, 0xbd, 0x79, 0x19, 0xcd, 0x18, 0xce, 0x1 , 0xef, 0x48, 0xbc, 0xf1, 0x80, 
-	0x3d, 0xf3, 0x4e, 0xf5, 0x24, 0xe7, 0xd2, 0xa8, 0x64, 0xd6, 0xd2, 0x2a, 0xbf, 
-	0xb7, 0x7a, 0xd8, 0xd3, 0x6e, 0x63, 0x8d, 0xd5, 0x96, 0x46, 0xc7, 0x15, 0x82, 
-	0xa4, 0xe , 0x95, 0x72, 0xd5, 0xc6, 0xdc, 0xaf, 0x7 , 0x8a, 0xc6, 0x71, 0xba, 
-	0x3a, 0x29, 0xcd, 0xa6, 0x77, 0x3a, 0x5d, 0xee, 0xc3, 0x81, 0x2b, 0x74, 0xe3, 
-	0x8a, 0xdf, 0xb3, 0xbc, 0xdc, 0xbc, 0x1c, 0xf , 0x5c, 0xd7, 0x9 , 0xa6, 0xdd, 
-	0xe2, 0x2c, 0xe7, 0xb8, 0xeb, 0xc9, 0x15, 0xbd, 0x6b, 0x75, 0x95, 0x0 , 0x3 , 
-	0xb5, 0xbd, 0x3b, 0x1a, 0xf3, 0xea, 0x53, 0x3b, 0xe1, 0x50, 0xea, 0xe2, 0x9d, 
-	0x76, 0xee, 0x23, 0x81, 0xd4, 0x66, 0x8b, 0xb9, 0xc1, 0x4d, 0xdd, 0x87, 0x18, 
-	0x15, 0x83, 0xe7, 0x49, 0x1e, 0x79, 0xfe, 0x1e, 0xa3, 0xfc, 0xd , 0xd , 0x7c, 
-	0x65, 0x87, 0xe6, 0x62, 0x71, 0xd4, 0xe3, 0x1f, 0x9d, 0x73, 0x3a, 0x66, 0xbc, 
-	0xc1, 0xab, 0xdd, 0x36, 0xd6, 0x52, 0xd8, 0x3 , 0xa1, 0xae, 0x47, 0x59, 0xbb, 
-	0x77, 0x97, 0x6a, 0x9d, 0xc5, 0xba, 0x9a, 0xb7, 0xe2, 0x7b, 0xe2, 0xbb, 0xc9, 
-	0x7c, 0x1c, 0x74, 0xcf, 0x6 , 0xb9, 0xeb, 0x1b, 0x8d, 0xec, 0x5a, 0x43, 0xd7, 
-	0xf4, 0xae, 0x9a, 0x54, 0xf4, 0xb9, 0xcb, 0x56, 0x63, 0x9e, 0xcc, 0xfd, 0xff, 
-	0x0 , 0x6f, 0x4a, 0xda, 0xf0, 0x5d, 0xaa, 0xc9, 0x7a, 0xa4, 0x11, 0xd7, 0xbd, 
-	0x65, 0x4d, 0x71, 0x95, 0x2a, 0xf , 0x6a, 0xbb, 0xe0, 0xfb, 0x83, 0x15, 0xe0, 
-	0x39, 0xc7, 0x3c, 0x13, 0x5d, 0x12, 0x4d, 0xc5, 0x99, 0xd1, 0x6b, 0x9c, 0xf7, 
-	0xaf, 0x3 , 0x84, 0x85, 0x53, 0xe6, 0x27, 0x3f, 0xa5, 0x7a, 0xd7, 0x81, 0xdc, 
-	0x9 , 0xd7, 0x7 , 0x7 , 0x8c, 0x9c, 0x7a, 0x1c, 0xe7, 0xfa, 0x57, 0x88, 0x78, 
-	0x2b, 0x51, 0x46, 0x54, 0x25, 0xba, 0x7a, 0x57, 0xa8, 0xf8, 0x57, 0x57, 0xa , 
-	0x14, 0xa6, 0xff, 0x0 , 0x97, 0x1d, 0x3f, 0xcf, 0xb5, 0x79, 0x6f, 0xdd, 0x96, 
-	0xa7, 0xb3, 0xf1, 0x42, 0xc7, 0x6f, 0xe2, 0x60, 0xf9, 0x2c, 0xec, 0xbc, 0xa8, 
-	0x3 , 0x1c, 0xe7, 0x8f, 0x5f, 0xf3, 0xd6, 0xb9, 0x76, 0x87, 0xcc, 0x99, 0x9b, 
-	0xd0, 0xf1, 0xc5, 0x68, 0xdc, 0x6a, 0x22, 0xf6, 0x6e, 0xa3, 0x68, 0x18, 0x0 , 
-	0xd5, 0x45, 0x93, 0x6b, 0xb8, 0xda, 0xbf, 0x85, 0x63, 0x57, 0x56, 0xec, 0x69, 
-	0x4a, 0xf1, 0x8a, 0x4c, 0xad, 0x78, 0x87, 0xc9, 0x2a, 0xd8, 0xfc, 0x38, 0xcd, 
-	0x73, 0xf7, 0x92, 0x98, 0x6e, 0x8 , 0x24, 0xe4, 0x1c, 0xf3, 0x5d, 0x64, 0x82, 
-	0x29, 0x63, 0x1b, 0x87, 0x24, 0x73, 0x5e, 0x7d, 0xe3, 0x49, 0xfc, 0x9d, 0x49, 
-	0x82, 0x39, 0xfa, 0x3 , 0xd6, 0xb9, 0xe4, 0xac, 0x69, 0xb9, 0x7d, 0xae, 0xa3, 
-	0xdd, 0xb8, 0x97, 0xda, 0x7e, 0xf7, 0xa5, 0x58, 0xb5, 0xb9, 0x6e, 0xa7, 0x1b, 
-	0x9 , 0xef, 0x9e, 0x2b, 0x96, 0x83, 0x51, 0x66, 0x8f, 0x7 , 0x2b, 0x8e, 0xe4, 
-	0x1e, 0x6a, 0xe5, 0xbd, 0xd6, 0x57, 0x19, 0xdc, 0xad, 0xc0, 0x24, 0x73, 0xfa, 
-	0x51, 0x63, 0x29, 0x1d, 0x1f, 0x98, 0x99, 0xdc, 0xa , 0x8c, 0x1c, 0xe3, 0xb7, 
-	0xe5, 0x4e, 0x5 , 0x58, 0xe7, 0x71, 0x19, 0xe7, 0x8c, 0x56, 0xc , 0x12, 0xc8, 
-	0x0 , 0xc1, 0xca, 0xfb, 0x1a, 0xbb, 0xd , 0xcb, 0x2a, 0x8c, 0x8f, 0x5c, 0x93, 
-	0xd6, 0x8b, 0x2 , 0x34, 0x26, 0xce, 0x32, 0xb , 0xe , 0x79, 0xc8, 0xeb, 0x51, 
-	0xa8, 0x3 , 0x77, 0x2d, 0xed, 0x4f, 0x86, 0xe1, 0x64, 0x2b, 0xb6, 0x4f, 0xbb, 
-	0xd7, 0x1c, 0x8f, 0xc7, 0xd2, 0xa3, 0x92, 0x4d, 0xb7, 0x19, 0x19, 0x18, 0x18, 
-	0x29, 0x8e, 0xbe, 0xf4, 0x15, 0xcc, 0x49, 0xb , 0xaa, 0xc3, 0xe5, 0x15, 0x7 , 
-	0x8c, 0xf , 0x63, 0x8a, 0x64, 0xd7, 0x24, 0xba, 0xc6, 0x46, 0xd5, 0xdd, 0xf2, 
-	0x96, 0xef, 0x50, 0x5d, 0x14, 0xd , 0xb4, 0x13, 0xc9, 0xc8, 0x3 , 0x8f, 0xf3, 
-	0xda, 0xaa, 0xb4, 0xd2, 0x7d, 0xac, 0x5 , 0xf9, 0x95, 0x47, 0x25, 0x8e, 0xf , 
-	0xe1, 0x4d, 0x2b, 0x94, 0x5c, 0x92, 0x56, 0x78, 0xc1, 0xdb, 0xb4, 0xfa, 0x7b, 
-	0x67, 0xff, 0x0 , 0xad, 0x5e, 0x21, 0xfb, 0x6e, 0x6b, 0x6 , 0xd7, 0xe1, 0x6c, 
-	0x3a, 0x7c, 0x6f, 0x83, 0xa8, 0xdf, 0x22, 0x11, 0xfe, 0xca, 0x82, 0xe7, 0xf5, 
-	0xb , 0x5e, 0xc3, 0x25, 0xc2, 0x98, 0xc9, 0xcf, 0x4 , 0xf6, 0x35, 0xf3, 0x17, 
-	0xed, 0xc5, 0xaa, 0x99, 0xfc, 0x45, 0xa2, 0xe8, 0xea, 0xdf, 0x2d, 0xbd, 0xbc, 
-	0x97, 0xd , 0xf5, 0x76, 0xa , 0x3f, 0x44, 0x3f, 0x9d, 0x6f, 0x87, 0x8d, 0xea, 
-	0x23, 0x8f, 0x1f, 0x3e, 0x5c, 0x3c, 0xbc, 0xf4, 0xfb, 0xcf, 0x6 , 0xa5, 0x5f, 
-	0xe9, 0x49, 0x4e, 0x4e, 0xf5, 0xea, 0x1f, 0x31, 0x62, 0x4f, 0xbe, 0x9b, 0xbb, 
-	0x8e, 0xb4, 0xe8, 0xc5, 0x46, 0xbc, 0x1 , 0x8a, 0x99, 0x79, 0x5c, 0xa8, 0xe7, 
-	0xb8, 0xa8, 0x67, 0x4d, 0x3d, 0x59, 0x7a, 0x17, 0x33, 0x46, 0x1b, 0x3f, 0x3a, 
-	0xc , 0x7d, 0x7d, 0x2a, 0xc4, 0x20, 0x2a, 0xf2, 0x3e, 0x56, 0xfb, 0xd5, 0x9f, 
-	0x6a, 0xdb, 0x24, 0xce, 0x70, 0x31, 0xce, 0x2b, 0x4a, 0xca, 0x50, 0xcd, 0xb1, 
-	0xb8, 0x6c, 0xf5, 0xec, 0x6b, 0x9a, 0xa4, 0x6c, 0x7b, 0x58, 0x5a, 0x8a, 0x76, 
-	0xbe, 0xe5, 0x8b, 0x5d, 0xaa, 0xde, 0x54, 0xa7, 0xe4, 0x6e, 0x86, 0xac, 0x47, 
-	0x13, 0xa9, 0xf2, 0x5b, 0x9c, 0xfd, 0xc2, 0xf , 0xf2, 0xa8, 0x8 , 0xb , 0x1e, 
-	0xa , 0xf0, 0xf , 0x4c, 0x74, 0x35, 0x35, 0xbb, 0x7 , 0x87, 0xcb, 0xce, 0x48, 
-	0x39, 0x5f, 0xfe, 0xb7, 0xa1, 0xae, 0x79, 0x2b, 0x9e, 0xb5, 0x19, 0x5b, 0x42, 
-	0x2b, 0xab, 0x52, 0x5b, 0x7a, 0xb0, 0x49, 0x40, 0xe1, 0xbb, 0x37, 0xf8, 0x1a, 
-	0x8d, 0x27, 0x32, 0xb1, 0x82, 0xe9, 0x5a, 0x29, 0xb1, 0x84, 0x75, 0xe3, 0x3f, 
-	0x51, 0xdf, 0xeb, 0x57, 0xd5, 0xa4, 0x3c, 0x38, 0xf , 0xc7, 0x6f, 0xbd, 0x8f, 
-	0xeb, 0x4c, 0x92, 0x8 , 0xde, 0x2e, 0x8b, 0x22, 0x83, 0xc7, 0x3d, 0x3d, 0xbd, 
-	0xa8, 0x53, 0x6b, 0x46, 0x69, 0x3c, 0x3a, 0x9b, 0xe6, 0xa7, 0xbf, 0x55, 0xdf, 
-	0xfa, 0xee, 0x51, 0x59, 0xde, 0x21, 0xb4, 0x95, 0x6c, 0x70, 0xc3, 0xee, 0xb0, 
-	0xff, 0x0 , 0xeb, 0xd6, 0x8e, 0x9e, 0x56, 0xe9, 0xc8, 0x5c, 0x33, 0x46, 0xa3, 
-	0x28, 0x40, 0xc , 0x47, 0xa8, 0xf5, 0xc5, 0x54, 0xbc, 0xb1, 0x5b, 0x8b, 0x7c, 
-	0xa9, 0xd9, 0x20, 0x1c, 0x6e, 0xe3, 0x3f, 0x8d, 0x53, 0xb3, 0x7b, 0xbb, 0x19, 
-	0xd1, 0x98, 0x30, 0x55, 0x3c, 0x12, 0x32, 0x2b, 0x45, 0xcb, 0x25, 0xa6, 0xe7, 
-	0x24, 0xa5, 0x56, 0x8c, 0xd2, 0x9a, 0xbc, 0x5f, 0x53, 0xa1, 0x5b, 0x59, 0x21, 
-	0xe5, 0x1f, 0x7a, 0x16, 0xed, 0x90, 0x7b, 0x76, 0x35, 0x32, 0x2 , 0x63, 0xf9, 
-	0x59, 0x4b, 0x1e, 0x41, 0x1c, 0x6e, 0xf6, 0xed, 0x83, 0xf8, 0x54, 0x9a, 0x6d, 
-	0xe4, 0x57, 0x70, 0x83, 0x90, 0x1b, 0xaa, 0xe0, 0xf0, 0x46, 0x3a, 0x11, 0xf8, 
-	0x77, 0xab, 0x70, 0xa4, 0x1b, 0xb0, 0xc0, 0xc6, 0xac, 0x71, 0x8c, 0x7d, 0xd6, 
-	0x23, 0xaf, 0xd3, 0xdb, 0xd6, 0xb0, 0x95, 0xef, 0xa9, 0xe8, 0xd3, 0x6a, 0xc9, 
-	0xc1, 0x99, 0xeb, 0x7f, 0x75, 0x6a, 0xd8, 0x75, 0x20, 0x3 , 0xca, 0xe3, 0x3f, 
-	0xcb, 0xa8, 0xfc, 0x2a, 0xcc, 0x5a, 0xfc, 0x47, 0x1b, 0xa3, 0x8e, 0x4c, 0xe , 
-	0xb1, 0xbe, 0xd3, 0xf9, 0x1a, 0xd2, 0x8f, 0x4a, 0x69, 0xf2, 0x8b, 0x2a, 0xc8, 
-	0xbf, 0x74, 0x64, 0x9e, 0xf , 0xa6, 0x3b, 0x7e, 0x55, 0x43, 0x51, 0xf0, 0xec, 
-	0x87, 0x7b, 0x79, 0x7 , 0x7f, 0x40, 0x57, 0x19, 0xcf, 0xae, 0x3b, 0x8f, 0x51, 
-	0x59, 0xb8, 0x41, 0xee, 0x75, 0x46, 0xb6, 0x26, 0x9a, 0xd1, 0xdd, 0x16, 0x23, 
-	0xd7, 0x2d, 0x72, 0xa5, 0xd6, 0x68, 0xb2, 0x7e, 0xf1, 0x41, 0x81, 0xf9, 0x55, 
-	0xb8, 0x75, 0x2b, 0x49, 0x58, 0xf , 0x3e, 0x26, 0xf7, 0xe7, 0x3f, 0x95, 0x71, 
-	0xd2, 0xda, 0xdd, 0x59, 0x4c, 0xc9, 0x2a, 0xe0, 0x8e, 0xaa, 0x49, 0x5f, 0xc7, 
-	0x8e, 0x29, 0xb1, 0xcf, 0xa , 0xff, 0x0 , 0xac, 0x7 , 0x69, 0xe8, 0x71, 0x9c, 
-	0x7e, 0x26, 0x87, 0x86, 0x4f, 0x66, 0x38, 0xe7, 0x13, 0x8f, 0xc7, 0x13, 0xb6, 
-	0x92, 0x7b, 0x40, 0x32, 0xb2, 0x7e, 0xb , 0x28, 0xfe, 0xa6, 0xa1, 0x79, 0xe1, 
-	0x3c, 0x83, 0x20, 0xf4, 0xc1, 0xd , 0x9f, 0xca, 0xb9, 0x68, 0xd4, 0x33, 0x61, 
-	0x65, 0xf , 0xc7, 0xaf, 0xf3, 0x15, 0x2b, 0x47, 0x31, 0x8c, 0x92, 0x5f, 0xdb, 
-	0x6c, 0x98, 0xa9, 0xfa, 0xb4, 0x91, 0xac, 0x73, 0x6a, 0x73, 0xd9, 0x24, 0x6f, 
-	0xb4, 0xa3, 0xaf, 0xcf, 0xf8, 0x47, 0xff, 0x0 , 0xeb, 0xaa, 0xf3, 0x4 , 0x71, 
-	0x90, 0xe7, 0x76, 0x78, 0x38, 0xc1, 0x1f, 0xa5, 0x63, 0x29, 0x91, 0xe , 0x1d, 
-	0xa5, 0x5f, 0x67, 0xef, 0xfa, 0x54, 0xab, 0x1b, 0x95, 0x2f, 0x19, 0x62, 0x47, 
-	0xf7, 0x5b, 0x9f, 0xc8, 0xd3, 0x8a, 0x69, 0xd8, 0x55, 0xa7, 0xa , 0x91, 0xe6, 
-	0xd8, 0xd2, 0xb7, 0x97, 0x2d, 0xb1, 0x98, 0x2b, 0x74, 0xfc, 0x7d, 0x69, 0x25, 
-	0x43, 0x1c, 0x9e, 0x6c, 0x23, 0xe7, 0x1c, 0x91, 0xfd, 0xea, 0xcd, 0x8e, 0xe5, 
-	0x84, 0x8a, 0x25, 0x5e, 0x57, 0xaf, 0x7 , 0x24, 0x56, 0x94, 0x4e, 0xaf, 0x18, 
-	0x64, 0x39, 0xc7, 0x43, 0xe9, 0xf5, 0xae, 0xea, 0x53, 0xe6, 0x5c, 0xaf, 0x73, 
-	0xe7, 0x71, 0x98, 0x77, 0x4e, 0x6a, 0xb4, 0x2d, 0x67, 0xbf, 0x6f, 0xeb, 0xc8, 
-	0xb9, 0x6f, 0x32, 0xcf, 0x6f, 0xb9, 0x4f, 0x4 , 0x7e, 0x22, 0xa6, 0xb7, 0xe5, 
-	0x7a, 0xf4, 0xaa, 0x16, 0xe3, 0xca, 0xb8, 0xc0, 0xf9, 0x56, 0x4e, 0x9f, 0xef, 
-	0x55, 0xb8, 0x1b, 0x12, 0xed, 0xee, 0x73, 0xfe, 0x7f, 0x9d, 0x7a, 0x14, 0xe4, 
-	0xda, 0x57, 0xdc, 0xf9, 0x6c, 0x4d, 0x24, 0xa4, 0xf9, 0x76, 0x7a, 0x96, 0x29, 
-	0xa6, 0x97, 0x39, 0x14, 0x95, 0xd0, 0x79, 0xe1, 0x45, 0x14, 0x50, 0x1 , 0xf8, 
-	0xd1, 0xf8, 0xd1, 0xf8, 0x52, 0x50, 0x0 , 0xdf, 0x5a, 0x4a, 0x33, 0x9a, 0x28, 
-	0x0 , 0x6a, 0x6d, 0x39, 0xa9, 0xb4, 0x0 , 0x51, 0x45, 0x21, 0x34, 0x0 , 0x94, 
-	0x66, 0x8a, 0x3f, 0xa , 0x0 , 0x3f, 0x1a, 0x3f, 0x1a, 0x3f, 0xa , 0x43, 0xf4, 
-	0xa0, 0x4 , 0xef, 0x45, 0x14, 0x50, 0x3 , 0x69, 0x8 , 0xa5, 0xa2, 0x80, 0x1b, 
-	0x45, 0x14, 0x7e, 0x14, 0x0 , 0x7e, 0x34, 0x87, 0xeb, 0x4b, 0xf8, 0x51, 0xf8, 
-	0x50, 0x3 , 0x68, 0xcd, 0x14, 0x8d, 0x40, 0x9 , 0x46, 0x68, 0xef, 0x48, 0xd4, 
-	0xd0, 0x9 , 0x47, 0xe3, 0x45, 0x1f, 0x85, 0x30, 0x13, 0xf1, 0xa4, 0x34, 0xb8, 
-	0xf6, 0xa4, 0x34, 0x0 , 0x8d, 0x49, 0x4a, 0xd4, 0x94, 0x0 , 0x8d, 0x49, 0x4a, 
-	0xd4, 0x94, 0x0 , 0x51, 0xf8, 0xd1, 0xf8, 0x51, 0xf8, 0x50, 0x2 , 0x1a, 0x4a, 
-	0x28, 0xa0, 0x7 , 0xad, 0x2d, 0x22, 0xd2, 0xd5, 0x0 , 0xea, 0x55, 0xfa, 0xd2, 
-	0x51, 0x40, 0xe , 0xfc, 0x68, 0xa3, 0xf0, 0xa2, 0xa4, 0x5 , 0x5a, 0x5a, 0x45, 
-	0xa5, 0xa0, 0x7 , 0x51, 0x45, 0x14, 0x0 , 0xef, 0xc6, 0x8a, 0x3f, 0xa , 0x28, 
-	0x1 , 0x56, 0x96, 0x91, 0x69, 0x68, 0x1 , 0x56, 0x96, 0x91, 0x69, 0x68, 0x1 , 
-	0xdf, 0x8d, 0x1f, 0x8d, 0x20, 0xfa, 0x52, 0xfe, 0x14, 0x0 , 0x52, 0x83, 0x49, 
-	0x45, 0x0 , 0x3a, 0x94, 0x1a, 0x4a, 0x28, 0x1 , 0xd4, 0xab, 0xf5, 0xa4, 0xa5, 
-	0x5f, 0xa5, 0x48, 0xb , 0xf8, 0xd1, 0xf8, 0xd1, 0xf8, 0x51, 0xf8, 0x50, 0x1 , 
-	0x4a, 0xd , 0x25, 0x14, 0x0 , 0xee, 0xd4, 0x51, 0x45, 0x0 , 0x3a, 0x8a, 0x28, 
-	0xa0, 0x1 , 0x69, 0xdf, 0x8d, 0x34, 0x53, 0xbf, 0xa , 0x0 , 0x3f, 0x1a, 0x33, 
-	0x47, 0xe1, 0x47, 0xe1, 0x40, 0xc2, 0x86, 0x38, 0x5c, 0x9a, 0x3f, 0x1c, 0x54, 
-	0x32, 0x1d, 0xc7, 0x7b, 0x67, 0x6f, 0x44, 0x5c, 0xe3, 0x77, 0xbd, 0x0 , 0x23, 
-	0xb1, 0x27, 0x24, 0x65, 0xbf, 0x84, 0x7a, 0x7f, 0xf5, 0xfd, 0xea, 0x9d, 0xed, 
-	0xd4, 0x50, 0xc6, 0x64, 0x66, 0xcf, 0xfb, 0x59, 0xe5, 0xbe, 0x9e, 0xd4, 0xb7, 
-	0x97, 0x0 , 0x7e, 0xea, 0x33, 0xb9, 0xdb, 0xef, 0x1c, 0x76, 0xec, 0x2b, 0x1f, 
-	0x58, 0xb8, 0x6b, 0x25, 0x57, 0x3f, 0xbd, 0xbb, 0x93, 0xfd, 0x5c, 0x64, 0xf0, 
-	0x9e, 0xf5, 0x12, 0x95, 0x8d, 0xe1, 0xb , 0xb2, 0xae, 0xbd, 0x73, 0x77, 0x23, 
-	0x2c, 0x20, 0x62, 0x59, 0x3a, 0x44, 0x3a, 0xa8, 0xf5, 0x6f, 0xfe, 0xbd, 0x56, 
-	0x5b, 0x18, 0x6c, 0xe3, 0xf3, 0xaf, 0x25, 0x1b, 0xbd, 0x7d, 0x71, 0xd5, 0x54, 
-	0x75, 0x27, 0xdf, 0xa7, 0xbd, 0x3d, 0xa6, 0x4b, 0x78, 0x49, 0x32, 0x2c, 0x92, 
-	0xc9, 0xcc, 0x92, 0xb7, 0x76, 0x3d, 0x86, 0x3e, 0xf7, 0xf2, 0xaa, 0xb0, 0xa9, 
-	0xbe, 0x99, 0xfe, 0xd5, 0x21, 0x86, 0x15, 0x20, 0x49, 0x2b, 0xc , 0xb9, 0xc7, 
-	0x45, 0x51, 0xdb, 0xe9, 0x58, 0x3d, 0x59, 0xd9, 0x1d, 0x23, 0xa6, 0xc1, 0x79, 
-	0x29, 0xbe, 0xb8, 0x40, 0xb1, 0xcc, 0xc1, 0x7f, 0xd5, 0xc1, 0x19, 0xf9, 0x80, 
-	0xf5, 0x3d, 0x96, 0x9a, 0xd6, 0x89, 0xc , 0x2d, 0xf6, 0x96, 0x1b, 0xbf, 0x82, 
-	0xde, 0x2e, 0x72, 0x73, 0xdc, 0xf5, 0x3d, 0x3a, 0xf4, 0xad, 0x58, 0x63, 0x92, 
-	0x58, 0xcd, 0xb6, 0x9b, 0x6c, 0xd6, 0xb6, 0xe3, 0xef, 0xc8, 0xe3, 0xe7, 0x92, 
-	0xaf, 0xe9, 0xba, 0x5c, 0x16, 0x70, 0xb4, 0xf2, 0x8d, 0xd2, 0x96, 0xc1, 0x91, 
-	0xbb, 0x9e, 0x7a, 0x7e, 0x5f, 0x5a, 0x39, 0x6e, 0x66, 0xe7, 0x63, 0x99, 0x9a, 
-	0xd6, 0x66, 0x8d, 0x9a, 0x55, 0x11, 0xf2, 0x0 , 0x41, 0xea, 0x7d, 0x7f, 0xf , 
-	0xe5, 0x4c, 0xb7, 0x58, 0xa2, 0xd3, 0x58, 0x95, 0x6f, 0x34, 0xf0, 0xc7, 0x3c, 
-	0x0 , 0x47, 0x6f, 0xcf, 0xf4, 0xad, 0x1d, 0x5a, 0x56, 0x3e, 0x73, 0xaa, 0x61, 
-	0x73, 0x9c, 0x7e, 0x23, 0x1f, 0xca, 0xb3, 0x78, 0xfb, 0x1e, 0xd2, 0x72, 0x49, 
-	0xcf, 0xd3, 0x81, 0xff, 0x0 , 0xd7, 0xa8, 0x96, 0x87, 0x55, 0x38, 0x73, 0x6e, 
-	0x51, 0x62, 0xab, 0xf2, 0x8f, 0xd2, 0x9f, 0x6f, 0xb , 0x3e, 0x19, 0xb8, 0x5e, 
-	0xde, 0xd5, 0x2c, 0x31, 0x77, 0xdb, 0x93, 0xd8, 0xa , 0xb9, 0xc , 0x71, 0xa7, 
-	0xef, 0x26, 0x20, 0xe3, 0xf2, 0xac, 0x27, 0x52, 0xc7, 0xa5, 0x47, 0x8 , 0xe6, 
-	0xef, 0x2d, 0x87, 0x58, 0x5b, 0xaa, 0xae, 0xf6, 0xa , 0xa0, 0xe , 0x1 , 0xec, 
-	0x29, 0xba, 0x85, 0xfb, 0x33, 0x79, 0x71, 0x7e, 0x75, 0x5e, 0xea, 0xe9, 0xe7, 
-	0x6d, 0x91, 0xfc, 0xa9, 0xfe, 0x79, 0xa8, 0x19, 0x95, 0x78, 0x5c, 0x91, 0xdd, 
-	0xbd, 0x6b, 0x38, 0xc1, 0xb7, 0x76, 0x74, 0x55, 0xc4, 0x42, 0x31, 0xe4, 0xa7, 
-	0xb7, 0x7e, 0xe3, 0x94, 0xed, 0xf9, 0x89, 0xdc, 0xde, 0xa6, 0xa0, 0x91, 0xf3, 
-	0x92, 0x9 , 0xf7, 0x63, 0xd6, 0x89, 0x1f, 0x77, 0xd3, 0xd2, 0xa2, 0x26, 0xba, 
-	0x23, 0x13, 0xcc, 0xa9, 0x53, 0xb0, 0x92, 0x1d, 0xdd, 0xf8, 0x1d, 0x5 , 0x46, 
-	0x79, 0xe0, 0xa , 0x7b, 0x1c, 0x53, 0x47, 0xcd, 0xd7, 0x81, 0x56, 0x8e, 0x49, 
-	0x6e, 0x26, 0x40, 0xe9, 0x4d, 0xa5, 0x63, 0x9e, 0x94, 0x1 , 0xc6, 0x4d, 0x59, 
-	0x98, 0x37, 0xa5, 0x37, 0xbd, 0x28, 0xe7, 0xaf, 0xa5, 0x26, 0x28, 0x21, 0xea, 
-	0x27, 0x6a, 0x46, 0xef, 0x4e, 0x6e, 0x94, 0xd6, 0xa6, 0x43, 0x42, 0x7f, 0xd , 
-	0x14, 0xb8, 0xe2, 0x92, 0x99, 0x27, 0x57, 0xe0, 0x99, 0x37, 0xe9, 0x86, 0x2c, 
-	0xf3, 0x1b, 0x91, 0xf8, 0x1e, 0x7f, 0xc6, 0xb7, 0x54, 0x57, 0x23, 0xe0, 0x79, 
-	0xf6, 0x6a, 0x32, 0x44, 0x4f, 0x12, 0x26, 0x47, 0xd4, 0x57, 0x5e, 0xb5, 0xd3, 
-	0x4d, 0xde, 0x20, 0x89, 0x63, 0x24, 0xc , 0x54, 0xca, 0x46, 0x31, 0x9a, 0x80, 
-	0x74, 0xe2, 0xa4, 0x53, 0xc6, 0x45, 0x6a, 0x8a, 0x27, 0x52, 0xf , 0x19, 0xa5, 
-	0x7 , 0x1c, 0x53, 0x14, 0xe7, 0x92, 0x3a, 0x52, 0xee, 0x15, 0x45, 0xe , 0xc9, 
-	0xce, 0x2a, 0xc5, 0xa8, 0xcf, 0xd2, 0xab, 0xae, 0x31, 0xcf, 0xe1, 0x56, 0x6d, 
-	0x5b, 0x6b, 0x8e, 0x6a, 0x5b, 0x2a, 0x3b, 0x9b, 0x1a, 0x78, 0x74, 0xc0, 0xef, 
-	0x8e, 0x3d, 0x6b, 0x77, 0x4c, 0x72, 0xd1, 0x80, 0xac, 0x70, 0x2b, 0x22, 0xc3, 
-	0xcb, 0x3b, 0x4f, 0xf1, 0x1 , 0xc7, 0xbd, 0x6b, 0x58, 0xb0, 0x8f, 0x5 , 0x19, 
-	0xba, 0x7a, 0x57, 0x1d, 0x53, 0xba, 0x9b, 0x34, 0x61, 0x66, 0x11, 0x64, 0x13, 
-	0xe8, 0xe , 0x33, 0x50, 0xcd, 0x29, 0xdb, 0xb8, 0x11, 0xcf, 0x5e, 0x31, 0x4f, 
-	0x8e, 0x6d, 0xa4, 0xf0, 0xb8, 0xfa, 0xf5, 0xfc, 0x2b, 0x37, 0x58, 0xbb, 0x11, 
-	0xc2, 0xcb, 0xdb, 0x1d, 0xeb, 0x9d, 0x6a, 0xcd, 0x65, 0x2b, 0x23, 0x9d, 0xf1, 
-	0x7d, 0xc8, 0x32, 0x6c, 0x5e, 0x31, 0xe8, 0x6b, 0x16, 0xd6, 0x7e, 0xc4, 0xd4, 
-	0xda, 0x94, 0x86, 0x69, 0x99, 0x8e, 0x79, 0xef, 0x59, 0x77, 0x1 , 0xd7, 0x95, 
-	0x3c, 0x81, 0x5d, 0xd4, 0xe3, 0x64, 0x70, 0x55, 0x95, 0xd9, 0xad, 0xf6, 0x81, 
-	0xb7, 0x19, 0xcd, 0x58, 0xb1, 0xbb, 0xf2, 0xd8, 0x15, 0x3c, 0xd7, 0x31, 0x24, 
-	0xd7, 0x5d, 0x15, 0xb1, 0xf8, 0x54, 0x70, 0xdf, 0x5e, 0xc1, 0x26, 0xe6, 0xb , 
-	0x22, 0xfa, 0x63, 0x6 , 0xb4, 0xd3, 0x6b, 0x11, 0x9 , 0xb8, 0xbb, 0x9e, 0xdd, 
-	0xe0, 0xd , 0x6f, 0x2a, 0xaa, 0x64, 0xc1, 0x4 , 0x77, 0xef, 0x5e, 0x9d, 0xa0, 
-	0xeb, 0xaa, 0x8a, 0xa0, 0xbe, 0xf , 0x53, 0xc9, 0xc5, 0x7c, 0xc9, 0xa1, 0xeb, 
-	0x8f, 0x3 , 0x2c, 0x91, 0xb3, 0xf , 0x51, 0xe9, 0x5d, 0x56, 0x9f, 0xe3, 0x69, 
-	0x62, 0x65, 0xcb, 0x9e, 0x3b, 0xe6, 0xbc, 0xfc, 0x45, 0x16, 0xde, 0x87, 0xb3, 
-	0x87, 0xc4, 0x5d, 0x1f, 0x4c, 0x69, 0x9a, 0xda, 0x3a, 0x86, 0xd , 0x93, 0x8c, 
-	0xe , 0x7d, 0xea, 0xc7, 0xf6, 0xf4, 0x2b, 0x36, 0xd6, 0x93, 0x9f, 0xad, 0x7c, 
-	0xf5, 0x37, 0xc5, 0x11, 0x67, 0x63, 0x88, 0x62, 0x69, 0xee, 0x18, 0x7c, 0xaa, 
-	0xbd, 0x33, 0xdb, 0x27, 0xb5, 0x73, 0x2f, 0xe3, 0x3f, 0x16, 0x5f, 0x5e, 0x79, 
-	0xef, 0x36, 0x37, 0x1e, 0x23, 0x45, 0xe0, 0x7b, 0x57, 0x9e, 0xe9, 0xb3, 0xb6, 
-	0x33, 0x52, 0x67, 0xd6, 0x32, 0x6b, 0xf6, 0xa2, 0xdf, 0x71, 0x90, 0x7e, 0x6 , 
-	0xb9, 0xd , 0x5a, 0x49, 0x2f, 0xef, 0x24, 0xb8, 0x55, 0xf9, 0x19, 0xb2, 0x3e, 
-	0x95, 0xc2, 0xfc, 0x2d, 0xb4, 0xf1, 0x2e, 0xb3, 0x2a, 0xcf, 0xaa, 0xb4, 0x90, 
-	0xd9, 0x8f, 0xe1, 0xcf, 0xcd, 0x27, 0xf8, 0xa , 0xf4, 0xeb, 0x6b, 0x74, 0x48, 
-	0xbc, 0xbd, 0xa3, 0xb8, 0xe9, 0x5c, 0xf2, 0xdc, 0x6e, 0xfb, 0x1c, 0xdc, 0xa0, 
-	0xc5, 0xc2, 0xbe, 0xde, 0x73, 0x8c, 0x77, 0xa4, 0x86, 0xf5, 0xd4, 0x9c, 0x9c, 
-	0x8c, 0x75, 0x6 , 0xb6, 0x35, 0xd , 0x38, 0x49, 0xb , 0x60, 0x7e, 0x95, 0xc9, 
-	0x5f, 0x47, 0xf6, 0x3b, 0xa6, 0x96, 0x35, 0xda, 0x72, 0x37, 0x13, 0xdf, 0x14, 
-	0x26, 0x4b, 0xb9, 0xd1, 0x43, 0x77, 0xf2, 0x82, 0x77, 0x67, 0x3 , 0xdc, 0x55, 
-	0xfb, 0x39, 0xfa, 0x3 , 0x92, 0xf , 0xe9, 0xf8, 0x57, 0x27, 0xa7, 0xea, 0x19, 
-	0x60, 0x1b, 0x8f, 0x5e, 0x7f, 0xad, 0x6c, 0x43, 0x70, 0x38, 0xea, 0x39, 0xee, 
-	0x73, 0x55, 0x61, 0x5c, 0xe8, 0x6d, 0xee, 0x76, 0xc9, 0xc6, 0x36, 0x91, 0xd0, 
-	0x7f, 0x33, 0x52, 0xc8, 0xe2, 0x4c, 0x71, 0xf3, 0x28, 0x3f, 0x74, 0xe2, 0xb1, 
-	0xed, 0xe7, 0x4e, 0xc3, 0x1f, 0xdd, 0x35, 0x70, 0x5c, 0x46, 0x36, 0xef, 0x72, 
-	0x1b, 0xa0, 0x4 , 0x63, 0x9a, 0x82, 0x93, 0x2c, 0xf9, 0xb1, 0x80, 0x14, 0xf2, 
-	0xdd, 0x81, 0x3f, 0x31, 0xfa, 0x55, 0xb , 0xb9, 0x14, 0x36, 0xe6, 0x38, 0x7 , 
-	0xa0, 0xcd, 0x17, 0x57, 0x71, 0x9c, 0x38, 0xdb, 0x9c, 0x1e, 0x83, 0x3f, 0xfe, 
-	0xaa, 0xa3, 0x33, 0x17, 0x19, 0x18, 0xc7, 0xa0, 0x18, 0x3 , 0xe9, 0x40, 0xee, 
-	0x24, 0xf7, 0x44, 0xb6, 0x32, 0x78, 0xeb, 0xcf, 0x4a, 0xf9, 0x3 , 0xf6, 0x8f, 
-	0xd6, 0xc6, 0xb7, 0xf1, 0x77, 0x54, 0x95, 0x1b, 0x31, 0xd9, 0xb2, 0xda, 0x47, 
-	0xcf, 0xf7, 0x6 , 0x1b, 0xff, 0x0 , 0x1e, 0xdd, 0x5f, 0x52, 0x78, 0xbb, 0x55, 
-	0x8b, 0x44, 0xd0, 0x2f, 0x35, 0x39, 0x7 , 0xee, 0xec, 0xa0, 0x79, 0x88, 0x27, 
-	0xef, 0x60, 0x12, 0x7 , 0xf2, 0xaf, 0x89, 0xef, 0xee, 0x25, 0xbb, 0xbe, 0x9a, 
-	0xea, 0x66, 0xdd, 0x24, 0xf2, 0x34, 0x8e, 0x7d, 0x49, 0x39, 0x3f, 0xce, 0xbb, 
-	0x70, 0x91, 0xd5, 0xc8, 0xf2, 0xf3, 0x3a, 0x9e, 0xec, 0x61, 0xf3, 0x21, 0x6a, 
-	0x44, 0xfb, 0xd4, 0xad, 0x48, 0xa7, 0x6 , 0xbb, 0x8f, 0x1b, 0xa8, 0xef, 0x4a, 
-	0x92, 0x32, 0x47, 0x14, 0xca, 0x72, 0x54, 0xb3, 0x48, 0x68, 0xcb, 0x11, 0xf3, 
-	0xfe, 0xf7, 0xf3, 0xa9, 0xe1, 0x24, 0x63, 0x19, 0xca, 0x8e, 0x7 , 0xb7, 0xa5, 
-	0x56, 0x8f, 0x22, 0xac, 0x46, 0x71, 0x82, 0x73, 0xd7, 0xa8, 0xea, 0x2b, 0x29, 
-	0x1e, 0x95, 0x16, 0x68, 0x5b, 0xcd, 0xe6, 0xa8, 0xe7, 0xe6, 0xe9, 0xcf, 0x7a, 
-	0x97, 0x24, 0x37, 0x39, 0x53, 0xeb, 0x54, 0x14, 0x63, 0x94, 0xfb, 0xc7, 0x91, 
-	0x83, 0xc1, 0xfa, 0x55, 0xab, 0x6b, 0x91, 0x2e, 0x15, 0xf8, 0x6f, 0x5a, 0xe6, 
-	0x94, 0x7b, 0x1e, 0xcd, 0x1a, 0xc9, 0xd9, 0x49, 0xea, 0x68, 0x42, 0xc2, 0x55, 
-	0xce, 0x42, 0xb0, 0xe9, 0x9e, 0x99, 0xf6, 0x35, 0x23, 0x2 , 0xb8, 0x2e, 0xa , 
-	0x6e, 0x1d, 0x7b, 0x55, 0x78, 0x8 , 0xeb, 0xd5, 0x7f, 0xbc, 0x2a, 0xf5, 0xb8, 
-	0x2d, 0xf2, 0xab, 0x2b, 0x7a, 0xa9, 0xee, 0x2b, 0x9a, 0x52, 0xb1, 0xeb, 0xd2, 
-	0xa6, 0xa6, 0xb4, 0x7a, 0x91, 0xa3, 0x1c, 0x80, 0x54, 0x6e, 0x1f, 0xaf, 0xd3, 
-	0xd2, 0x9b, 0x34, 0x21, 0xb0, 0xca, 0x5a, 0x32, 0x7f, 0xbc, 0xbc, 0x1f, 0xad, 
-	0x5a, 0xfb, 0x2c, 0x72, 0x8d, 0xaa, 0x76, 0x37, 0x6d, 0xc3, 0x8c, 0xd4, 0x46, 
-	0x1b, 0x9b, 0x66, 0xc4, 0x89, 0xf2, 0xf4, 0xdc, 0xa7, 0x72, 0xb5, 0x4a, 0x92, 
-	0xe9, 0xb9, 0xa4, 0xa1, 0x24, 0xad, 0x25, 0x74, 0x32, 0xd0, 0x18, 0x58, 0x6e, 
-	0x89, 0x76, 0x92, 0x9 , 0x68, 0xc8, 0x15, 0xa7, 0xb , 0x87, 0x21, 0x1d, 0x9a, 
-	0x37, 0x3f, 0x74, 0xe3, 0x87, 0xf6, 0x20, 0xf1, 0xcf, 0x15, 0x9c, 0x8e, 0xac, 
-	0xd9, 0x50, 0x54, 0xf7, 0x3 , 0x3f, 0xca, 0xae, 0x5a, 0xdc, 0x15, 0x3b, 0x59, 
-	0x44, 0x8b, 0xd0, 0x81, 0xd4, 0x50, 0xe5, 0x21, 0x42, 0x10, 0xfe, 0xbf, 0xa4, 
-	0x69, 0x69, 0xf7, 0x8f, 0x1b, 0x8 , 0x67, 0x21, 0xf6, 0x8c, 0x7f, 0xb4, 0x3d, 
-	0xc1, 0xeb, 0x5d, 0x15, 0x8d, 0xda, 0xdc, 0x45, 0x82, 0xe1, 0xd8, 0xf , 0xe2, 
-	0xff, 0x0 , 0x1a, 0xe7, 0x2d, 0xfc, 0xbb, 0x93, 0xe5, 0xf9, 0x83, 0x70, 0x1f, 
-	0x29, 0x2b, 0xd7, 0xeb, 0xef, 0x4f, 0xb7, 0xf3, 0xed, 0x66, 0xdf, 0x18, 0xc9, 
-	0x5e, 0xaa, 0x38, 0xdc, 0x3d, 0xbd, 0xea, 0x5e, 0xa6, 0xf1, 0x4a, 0x1b, 0xec, 
-	0x6c, 0x6a, 0xba, 0x54, 0x1a, 0x85, 0xb3, 0x17, 0xc2, 0x32, 0xae, 0x43, 0xae, 
-	0x78, 0x3f, 0xe7, 0xf4, 0xae, 0x66, 0xe3, 0x46, 0x9e, 0x19, 0x36, 0x3a, 0x2c, 
-	0xc0, 0xe , 0x76, 0xfa, 0x7a, 0x8a, 0xea, 0xb4, 0xbb, 0xd8, 0xae, 0x54, 0x3c, 
-	0x6e, 0x43, 0x63, 0xb8, 0x7 , 0xea, 0x29, 0xda, 0x85, 0xba, 0x4a, 0xbe, 0x6a, 
-	0x5 , 0xe4, 0xf6, 0x3f, 0x74, 0xfb, 0x8a, 0xde, 0x8c, 0x93, 0x7c, 0xac, 0xe2, 
-	0xc7, 0x52, 0x9a, 0x8f, 0xb4, 0xa7, 0x66, 0x70, 0xb3, 0x69, 0x61, 0x18, 0xe3, 
-	0xcc, 0x8b, 0xd3, 0xe5, 0xc8, 0xa2, 0x18, 0x2e, 0xa3, 0xfb, 0xac, 0xb2, 0xaf, 
-	0x7d, 0x87, 0xfa, 0x57, 0x53, 0x3c, 0x6c, 0xa7, 0x91, 0x9f, 0x5e, 0x2a, 0xac, 
-	0xd0, 0x42, 0xe0, 0x92, 0xa3, 0x3e, 0xa0, 0x73, 0x5d, 0x5e, 0xcb, 0xb3, 0x3c, 
-	0x2f, 0xae, 0xa6, 0xfd, 0xf8, 0x5b, 0xf1, 0xff, 0x0 , 0x2f, 0xcc, 0xc6, 0xf3, 
-	0x3 , 0xd , 0xb2, 0x46, 0xc9, 0xea, 0x8 , 0xe2, 0xa3, 0x68, 0x1e, 0x3f, 0xde, 
-	0xdb, 0x36, 0x71, 0xd4, 0xa , 0xd5, 0x68, 0x5d, 0x1b, 0x86, 0xe , 0x31, 0xd1, 
-	0x87, 0x3f, 0x9d, 0x30, 0x42, 0x92, 0x93, 0x85, 0xc3, 0xe , 0xa0, 0x1c, 0x30, 
-	0xff, 0x0 , 0x1a, 0x8f, 0x65, 0x7d, 0x19, 0xd7, 0x1c, 0x57, 0x27, 0xbd, 0x1d, 
-	0xbe, 0xf5, 0xf3, 0x4e, 0xc5, 0x58, 0x1a, 0x1b, 0xb8, 0xf6, 0xcc, 0x80, 0xb0, 
-	0xf4, 0xff, 0x0 , 0x3c, 0x54, 0x2d, 0xc , 0xd6, 0x6c, 0xd2, 0x42, 0xe5, 0xa1, 
-	0x7 , 0x9c, 0x75, 0x5f, 0xad, 0x49, 0x71, 0x4 , 0x90, 0xca, 0x67, 0x43, 0xd3, 
-	0xa8, 0xe9, 0xbb, 0xde, 0xad, 0x5b, 0x37, 0x98, 0xde, 0x6a, 0x1e, 0x1d, 0x70, 
-	0xe3, 0xf2, 0xeb, 0xf9, 0xd1, 0x18, 0xf3, 0x7b, 0xaf, 0x74, 0x15, 0x2b, 0x46, 
-	0x9a, 0xf6, 0xb4, 0xf5, 0x8c, 0xb7, 0x5d, 0x13, 0xed, 0xf3, 0xe8, 0x2c, 0x2e, 
-	0x2e, 0x2d, 0x72, 0x0 , 0x3d, 0xd4, 0x8f, 0xe1, 0x35, 0x65, 0x4e, 0xf5, 0x49, 
-	0x7 , 0x52, 0x7 , 0xf9, 0xfe, 0x75, 0x9e, 0xa9, 0xf6, 0x1b, 0xd1, 0xb7, 0xfd, 
-	0x4c, 0x87, 0x0 , 0x7f, 0x74, 0xfa, 0x7d, 0x2a, 0xf4, 0xb , 0xb3, 0x70, 0xcf, 
-	0xcb, 0xb8, 0xe3, 0xe8, 0x79, 0xae, 0xba, 0x32, 0x6f, 0x47, 0xb9, 0xe1, 0xe3, 
-	0xa9, 0xc6, 0x3e, 0xfc, 0x3e, 0x19, 0x6a, 0xbf, 0x55, 0xf2, 0xd0, 0xb7, 0x1b, 
-	0x6e, 0x5c, 0xfe, 0x62, 0x96, 0xa3, 0x8c, 0xe1, 0xb3, 0xf9, 0xd4, 0x95, 0xda, 
-	0x8f, 0x6 , 0x4a, 0xcc, 0x28, 0xa2, 0x8a, 0x64, 0x87, 0xe3, 0x49, 0x9f, 0x7a, 
-	0x5f, 0xc2, 0x9a, 0x68, 0x0 , 0xa2, 0x8a, 0x28, 0x1 , 0xbf, 0x85, 0x14, 0x77, 
-	0xa2, 0x80, 0x11, 0xa9, 0x29, 0x7a, 0xd2, 0x1a, 0x0 , 0x28, 0xfc, 0x68, 0xa3, 
-	0xf0, 0xa0, 0x3 , 0xf1, 0xa6, 0xb5, 0x29, 0xfa, 0x52, 0x50, 0x1 , 0x48, 0xd4, 
-	0xb4, 0x8d, 0x40, 0x9 , 0x46, 0x68, 0x34, 0xda, 0x0 , 0x28, 0xfc, 0x68, 0xa3, 
-	0xf0, 0xa0, 0x4 , 0xfc, 0x69, 0xd , 0x2b, 0x7d, 0x29, 0x28, 0x0 , 0xa4, 0x6a, 
-	0x5a, 0x46, 0xa0, 0x4 , 0xa6, 0x9a, 0x56, 0xa4, 0xa6, 0x1 , 0x47, 0xe3, 0x47, 
-	0xe1, 0x47, 0xe1, 0x4c, 0x4 , 0xfc, 0x69, 0xd , 0x14, 0x50, 0x2 , 0x13, 0x49, 
-	0x45, 0x14, 0x0 , 0x84, 0xd2, 0x51, 0x45, 0x0 , 0x1f, 0x8d, 0x26, 0x7d, 0xe9, 
-	0x7f, 0xa , 0x69, 0xa0, 0x2 , 0x91, 0xa9, 0x69, 0x1a, 0x80, 0x24, 0x5a, 0x5a, 
-	0x45, 0xa5, 0xaa, 0x1 , 0xd4, 0xa2, 0x92, 0x8a, 0x0 , 0x77, 0xe3, 0x45, 0x1f, 
-	0x85, 0x2 , 0x80, 0xa , 0x55, 0xa4, 0x14, 0xea, 0x40, 0x2e, 0x69, 0x69, 0xab, 
-	0x4e, 0xa4, 0x3 , 0xbf, 0x1a, 0x3f, 0x1a, 0x41, 0xf4, 0xa5, 0xfc, 0x28, 0x0 , 
-	0x14, 0xea, 0x6d, 0x2a, 0xd0, 0x3 , 0x96, 0x96, 0x91, 0x69, 0x68, 0x1 , 0x73, 
-	0xef, 0x4b, 0xf8, 0xd3, 0x56, 0x9d, 0xf8, 0x50, 0x1 , 0xda, 0x94, 0x1a, 0x4a, 
-	0x28, 0x1 , 0xd4, 0x51, 0x45, 0x20, 0x1d, 0x4a, 0x29, 0x28, 0xa0, 0x7 , 0x7e, 
-	0x34, 0x7e, 0x34, 0x7e, 0x14, 0x7e, 0x14, 0x80, 0x29, 0x56, 0x92, 0x8a, 0x0 , 
-	0x5e, 0x94, 0xb4, 0x51, 0x40, 0xa , 0xb4, 0xb4, 0x8b, 0x4b, 0x40, 0x0 , 0xa5, 
-	0xfc, 0x69, 0x5 , 0x2f, 0xe1, 0x40, 0xb , 0xf8, 0xd1, 0xf8, 0xd1, 0xf8, 0x53, 
-	0x5b, 0xd0, 0x77, 0xa0, 0x68, 0x6c, 0x84, 0x37, 0x4 , 0x8d, 0x83, 0xef, 0x1f, 
-	0x6a, 0xab, 0x71, 0x23, 0x48, 0x48, 0x3 , 0x4 , 0x8f, 0x94, 0x1e, 0xc3, 0xd4, 
-	0xd4, 0x97, 0xe , 0x5b, 0x6a, 0x20, 0xcb, 0x48, 0x7e, 0x50, 0x7d, 0x3d, 0x4f, 
-	0xb5, 0x47, 0x2b, 0x45, 0x6f, 0x19, 0x2c, 0x77, 0x71, 0x96, 0x6c, 0x75, 0xa4, 
-	0x5a, 0xdc, 0xab, 0xa8, 0xcd, 0xe , 0x9d, 0x62, 0xd7, 0x12, 0x7c, 0xc7, 0xa2, 
-	0xe , 0xf2, 0xb1, 0xf4, 0xae, 0x65, 0xbc, 0xf9, 0x2f, 0x1a, 0x5b, 0xb8, 0x4c, 
-	0x92, 0xe3, 0x71, 0x88, 0xf0, 0x14, 0xf6, 0xdd, 0xe8, 0x7 , 0xa5, 0x4d, 0x75, 
-	0x7b, 0x75, 0x7f, 0xab, 0x35, 0xc9, 0x3b, 0x23, 0xb7, 0x25, 0x62, 0x18, 0xdd, 
-	0x87, 0xed, 0xb4, 0x77, 0x6f, 0xe5, 0x57, 0x2c, 0x34, 0xf7, 0x96, 0x3c, 0xcd, 
-	0xf2, 0x44, 0x58, 0xb1, 0x42, 0x72, 0x5b, 0x9e, 0xae, 0x7b, 0x93, 0xe9, 0xef, 
-	0x58, 0x37, 0xcc, 0xf4, 0x3b, 0x12, 0xe4, 0x5a, 0xee, 0xcc, 0xe9, 0xb6, 0xc6, 
-	0xbe, 0x74, 0x43, 0xcf, 0x98, 0xf1, 0xe6, 0xb1, 0x1 , 0x43, 0x1e, 0xc8, 0x3d, 
-	0x3f, 0xc3, 0xad, 0x6c, 0x68, 0xfa, 0x12, 0x2a, 0x82, 0xfb, 0x9e, 0x56, 0xe5, 
-	0x9d, 0xba, 0x67, 0xb9, 0xa5, 0x99, 0x12, 0x4d, 0x5a, 0x18, 0x63, 0x41, 0xe5, 
-	0x5a, 0x2e, 0xf7, 0xf9, 0x4f, 0xcc, 0xde, 0xa7, 0xf4, 0xc5, 0x5c, 0xb8, 0xbc, 
-	0x98, 0x29, 0xa , 0x12, 0x24, 0xe9, 0x96, 0x6c, 0x16, 0xfa, 0xd0, 0xa2, 0x96, 
-	0xa0, 0xf9, 0x9a, 0x49, 0x13, 0xb0, 0x8a, 0x18, 0x8c, 0x50, 0x2a, 0xb2, 0xaf, 
-	0x1 , 0xbb, 0x6e, 0xfe, 0xa4, 0x55, 0x4b, 0xab, 0x88, 0x11, 0x48, 0x77, 0x2f, 
-	0xb5, 0x8e, 0x0 , 0x3e, 0xfd, 0xff, 0x0 , 0xc0, 0x55, 0x3b, 0xeb, 0xc1, 0x12, 
-	0xed, 0x33, 0x6e, 0x6c, 0x7f, 0x8 , 0xc7, 0xea, 0x6a, 0x87, 0x9f, 0x33, 0xa3, 
-	0x18, 0x51, 0x55, 0x73, 0x8d, 0xec, 0x3f, 0x91, 0xa5, 0x2a, 0x8b, 0x64, 0x6d, 
-	0x4b, 0xb , 0x27, 0xef, 0x32, 0xd , 0x46, 0x7d, 0xd0, 0xb4, 0x60, 0x6d, 0x52, 
-	0xc4, 0xed, 0xfc, 0xff, 0x0 , 0xc4, 0xd5, 0x15, 0x52, 0xdd, 0x47, 0x15, 0x35, 
-	0xc2, 0x15, 0x66, 0x32, 0x12, 0x58, 0x76, 0xf5, 0xaa, 0x72, 0x4e, 0xc5, 0x76, 
-	0xaf, 0xcb, 0x9e, 0xf5, 0xcf, 0x2b, 0xb3, 0xd6, 0xa4, 0xa9, 0xd3, 0x89, 0x34, 
-	0x92, 0x47, 0x9 , 0xc7, 0xde, 0x6f, 0x40, 0x7f, 0x9d, 0x57, 0x91, 0x9a, 0x66, 
-	0xcc, 0x87, 0x3e, 0x8a, 0x3a, 0xa , 0x8f, 0x5 , 0x8e, 0x17, 0xaf, 0x73, 0x4f, 
-	0x38, 0x41, 0xb7, 0xa9, 0xef, 0x51, 0xca, 0x97, 0xa8, 0x4a, 0xac, 0xa7, 0xbe, 
-	0x91, 0xfe, 0xbe, 0xf0, 0x66, 0x27, 0xe5, 0xe8, 0x5 , 0x44, 0xe4, 0x76, 0xfc, 
-	0xa9, 0x58, 0x93, 0xec, 0x2a, 0x36, 0x75, 0x1c, 0x28, 0xfc, 0x6b, 0x48, 0xa3, 
-	0x9a, 0xa4, 0xc4, 0x90, 0xd3, 0x73, 0x47, 0x24, 0xd2, 0x39, 0x2 , 0xae, 0xc7, 
-	0x33, 0x97, 0x51, 0xe , 0x3a, 0x9a, 0x6b, 0x73, 0x47, 0x27, 0x93, 0x4b, 0xb7, 
-	0x35, 0x56, 0x31, 0x77, 0x62, 0x2a, 0xf7, 0xa4, 0x6f, 0xeb, 0x4a, 0xc7, 0xb0, 
-	0xa4, 0xf6, 0x14, 0xc8, 0x7d, 0x84, 0x63, 0x44, 0x63, 0x1c, 0x9a, 0x28, 0x3d, 
-	0x3f, 0xa , 0x9 , 0x5b, 0x88, 0xc7, 0x2d, 0x4d, 0x23, 0x26, 0x94, 0xe , 0x4d, 
-	0x1d, 0x45, 0x4 , 0x3d, 0x44, 0x1d, 0x68, 0xa5, 0xa4, 0xaa, 0x13, 0x27, 0xd2, 
-	0xe7, 0xfb, 0x3e, 0xa5, 0xc , 0xf9, 0xc0, 0x47, 0x19, 0xfa, 0x74, 0x3f, 0xa5, 
-	0x7a, 0x14, 0x47, 0x72, 0x82, 0xd , 0x79, 0xab, 0x57, 0x77, 0xe1, 0x7b, 0xa1, 
-	0x77, 0xa4, 0xc2, 0xe4, 0xfc, 0xca, 0xbb, 0x5b, 0xea, 0x38, 0xad, 0xa9, 0x3e, 
-	0x82, 0x5b, 0x9a, 0x4b, 0x4e, 0x50, 0x7d, 0x29, 0x23, 0xe6, 0x9e, 0xb5, 0xba, 
-	0x28, 0x7a, 0xe7, 0x77, 0x20, 0x7e, 0x54, 0xee, 0x9d, 0xe9, 0xaa, 0x7f, 0x3a, 
-	0x55, 0x1e, 0xdf, 0x9d, 0x30, 0x1e, 0xe , 0x71, 0x52, 0x47, 0x2e, 0xd2, 0x39, 
-	0xa8, 0xdb, 0x18, 0xe0, 0xd2, 0x29, 0xc2, 0xe6, 0x82, 0x91, 0xb1, 0x63, 0x70, 
-	0xca, 0x6 , 0x8 , 0xf9, 0x6b, 0x5e, 0xd2, 0xec, 0x3a, 0x8c, 0xb7, 0xb1, 0x19, 
-	0xe9, 0x5c, 0xa4, 0x32, 0x95, 0x6e, 0xf , 0x4e, 0xa6, 0xad, 0xc7, 0x34, 0x9d, 
-	0x55, 0xbe, 0xa6, 0xb9, 0xe7, 0x1b, 0x9d, 0x30, 0x9d, 0x91, 0xd2, 0xcb, 0x78, 
-	0x16, 0x30, 0x59, 0xb9, 0xcd, 0x63, 0xeb, 0x57, 0x86, 0x44, 0xc1, 0xfe, 0x75, 
-	0x51, 0xae, 0xf1, 0x91, 0x92, 0x3f, 0x1a, 0xa9, 0x71, 0x29, 0x66, 0xeb, 0x9a, 
-	0x98, 0xd3, 0x1c, 0xaa, 0x68, 0x43, 0x32, 0xe7, 0x9a, 0x89, 0xd7, 0x2b, 0xd2, 
-	0xa7, 0xc8, 0xc7, 0x35, 0x14, 0x87, 0xd2, 0xb6, 0x39, 0x5c, 0xae, 0xca, 0xd2, 
-	0x42, 0x3a, 0xd4, 0x26, 0xdf, 0x2d, 0xc2, 0xd6, 0x83, 0x47, 0xb9, 0x73, 0x53, 
-	0xda, 0x59, 0x99, 0x58, 0x0 , 0x39, 0xa1, 0xca, 0xdb, 0x97, 0x4e, 0xe , 0x46, 
-	0x4b, 0x5b, 0x95, 0xfb, 0xbf, 0x9d, 0x4d, 0xa7, 0xd9, 0x4d, 0x3c, 0xc1, 0x77, 
-	0x1c, 0x1e, 0xc3, 0xbd, 0x75, 0x5a, 0x6f, 0x85, 0xee, 0x6e, 0xb0, 0xde, 0x51, 
-	0xe6, 0xb7, 0xb4, 0xbf, 0x8 , 0xcb, 0x4 , 0x88, 0xe6, 0x3c, 0x73, 0xc9, 0x2 , 
-	0xb8, 0xaa, 0x62, 0xaf, 0x73, 0xd3, 0xa3, 0x85, 0x5a, 0x5c, 0x8f, 0xc1, 0xbe, 
-	0x5 , 0x92, 0xf1, 0x52, 0x49, 0x17, 0xe5, 0x3e, 0xd5, 0xe9, 0xfe, 0x12, 0xf8, 
-	0x7f, 0x6b, 0x6c, 0xcb, 0x2b, 0xdb, 0x86, 0xc6, 0x30, 0x48, 0xae, 0x9f, 0xe1, 
-	0xae, 0x83, 0x9 , 0xd3, 0xe3, 0xf9, 0x49, 0x7a, 0xeb, 0x96, 0xd1, 0x23, 0x2c, 
-	0xa5, 0x39, 0x51, 0x83, 0x5e, 0x55, 0x4a, 0x8d, 0xb3, 0xd0, 0x8c, 0x52, 0xd0, 
-	0xc4, 0xb7, 0xb1, 0xfb, 0x2c, 0x21, 0x11, 0x44, 0x60, 0xe , 0x3d, 0xe9, 0xfb, 
-	0xa , 0xb6, 0x77, 0x6e, 0xad, 0x49, 0xa3, 0x1b, 0x73, 0xb3, 0x9a, 0xa3, 0x75, 
-	0xf2, 0xf0, 0xc0, 0x8f, 0xd6, 0xb9, 0xdb, 0x35, 0x56, 0x2b, 0x48, 0xc1, 0xc6, 
-	0x0 , 0xc1, 0xac, 0xad, 0x53, 0x4a, 0x17, 0x56, 0xad, 0x21, 0x8f, 0x72, 0xa9, 
-	0xc6, 0x71, 0xd2, 0xa6, 0xd4, 0xae, 0x95, 0x15, 0xbd, 0x71, 0xd6, 0xb8, 0x5d, 
-	0x52, 0xfa, 0xe2, 0x2f, 0x11, 0x8b, 0xf9, 0xf5, 0x29, 0x92, 0x18, 0xd4, 0xaa, 
-	0x42, 0x1f, 0x8 , 0x73, 0xea, 0x29, 0xc5, 0x5c, 0x99, 0x34, 0x26, 0xad, 0xa7, 
-	0xdc, 0x5b, 0x5c, 0x16, 0x4f, 0xbb, 0xed, 0x52, 0xe9, 0xf7, 0x27, 0x85, 0x66, 
-	0xda, 0x3b, 0xe4, 0xf3, 0x51, 0xcd, 0xaf, 0x5b, 0x5d, 0xd , 0x86, 0x45, 0x6e, 
-	0xe0, 0xd5, 0x61, 0x32, 0x48, 0xc1, 0xa3, 0x2b, 0xbb, 0xd8, 0xf3, 0x5b, 0x2b, 
-	0x99, 0x39, 0x2b, 0x9d, 0x2d, 0xad, 0xca, 0xaa, 0x80, 0x32, 0x40, 0xf7, 0xab, 
-	0xa9, 0x70, 0x4a, 0x8d, 0xa5, 0xbf, 0x1f, 0x4a, 0xe7, 0x6c, 0xd8, 0xba, 0x66, 
-	0x47, 0x61, 0x83, 0x9a, 0xd3, 0x8e, 0x56, 0xb , 0x8c, 0x92, 0xbd, 0xcd, 0x4b, 
-	0x45, 0x26, 0x8b, 0xed, 0x22, 0x80, 0x8 , 0x6e, 0xd9, 0xe0, 0x74, 0xaa, 0x57, 
-	0xd3, 0x12, 0xdb, 0x11, 0xb1, 0xed, 0x9c, 0x62, 0x89, 0x2e, 0x71, 0x1f, 0xcb, 
-	0xf8, 0x71, 0xc5, 0x62, 0xde, 0x4e, 0x44, 0x84, 0x67, 0x2c, 0xf , 0x3f, 0x4a, 
-	0x12, 0xb8, 0xee, 0x70, 0x7f, 0xb5, 0x16, 0xb8, 0x6c, 0x7e, 0x1b, 0xb5, 0x84, 
-	0x6f, 0xf3, 0x6a, 0x13, 0x2c, 0x3f, 0xf0, 0x11, 0xf3, 0x1f, 0xe5, 0xfa, 0xd7, 
-	0xcd, 0x75, 0xea, 0x1f, 0xb5, 0x56, 0xb2, 0x6e, 0xbc, 0x55, 0x67, 0xa4, 0x46, 
-	0xf9, 0x4b, 0x18, 0x7c, 0xc9, 0x6 , 0x7f, 0x8d, 0xfb, 0x7e, 0xa , 0x7 , 0xe7, 
-	0x5e, 0x5c, 0xa7, 0x22, 0xbd, 0x3a, 0x11, 0xb5, 0x34, 0x7c, 0xfe, 0x32, 0xa2, 
-	0x9d, 0x77, 0xe4, 0x25, 0x21, 0xa7, 0x63, 0xbd, 0x37, 0x19, 0xad, 0x8e, 0x49, 
-	0xa , 0xa7, 0x22, 0x9e, 0xbf, 0x7b, 0x35, 0x1a, 0x9c, 0x54, 0xab, 0xea, 0x29, 
-	0x32, 0xe0, 0xcb, 0x30, 0x8c, 0xa9, 0xa9, 0x14, 0x81, 0xc3, 0x74, 0xa8, 0x2d, 
-	0xce, 0x1b, 0x19, 0xfa, 0x54, 0xee, 0xe , 0xd0, 0xd5, 0x8c, 0x96, 0xa7, 0xa7, 
-	0x4a, 0x57, 0x8d, 0xc7, 0x46, 0x4a, 0x64, 0xc , 0x15, 0x1c, 0xe3, 0xfc, 0xf4, 
-	0xa9, 0x81, 0x57, 0xc4, 0x99, 0xe0, 0xff, 0x0 , 0x10, 0xfe, 0xb5, 0x49, 0x89, 
-	0x1c, 0x8e, 0x8 , 0xe9, 0x53, 0xda, 0xca, 0xac, 0xd9, 0x7 , 0xcb, 0x7e, 0xe0, 
-	0x74, 0x3f, 0x85, 0x27, 0x17, 0x6b, 0x9a, 0xd2, 0xac, 0x94, 0xb9, 0x59, 0x76, 
-	0x29, 0x99, 0x39, 0xdd, 0xf4, 0x3d, 0x8d, 0x5c, 0xb7, 0xbb, 0x8f, 0x76, 0x1b, 
-	0xe5, 0x3e, 0xf5, 0x45, 0x48, 0xb , 0x90, 0x0 , 0x3d, 0xf , 0xf7, 0x4d, 0x24, 
-	0xe9, 0x85, 0xe9, 0x8f, 0xaf, 0x23, 0xf3, 0xae, 0x79, 0x46, 0x32, 0x3d, 0x6a, 
-	0x75, 0xe7, 0x4d, 0x5d, 0x6a, 0x74, 0x50, 0xdd, 0xf0, 0x12, 0x54, 0x56, 0xd , 
-	0xd1, 0xaa, 0xf4, 0x2c, 0xbb, 0x7f, 0x75, 0x71, 0xc7, 0x74, 0x71, 0x91, 0x5c, 
-	0x95, 0x95, 0xc4, 0xb1, 0x36, 0xd5, 0x7d, 0xc0, 0x7f, 0xb , 0x1a, 0xd5, 0x82, 
-	0xe9, 0x47, 0xc , 0xa , 0xe7, 0xb1, 0x3c, 0x7e, 0x15, 0xcb, 0x52, 0x8b, 0x8e, 
-	0xc7, 0xb3, 0x85, 0xc7, 0xc2, 0xac, 0x7d, 0xef, 0xeb, 0xe6, 0x6c, 0x98, 0x23, 
-	0x6e, 0x6e, 0x6d, 0x51, 0xc8, 0xe8, 0xf1, 0xff, 0x0 , 0x9f, 0xeb, 0x51, 0x47, 
-	0x15, 0x81, 0x6d, 0xa6, 0x49, 0x11, 0x87, 0xf0, 0xc9, 0x93, 0x9f, 0xe7, 0xfc, 
-	0xea, 0x1b, 0x7b, 0xb9, 0x50, 0x6e, 0x86, 0x53, 0xf4, 0xa9, 0xdb, 0x50, 0x67, 
-	0x5d, 0xb3, 0x5b, 0x44, 0xe7, 0x1d, 0xd7, 0x7 , 0xf4, 0xac, 0xb9, 0x9a, 0x3b, 
-	0x39, 0x61, 0x2d, 0x53, 0xfc, 0x3f, 0x52, 0xe5, 0xbd, 0xbc, 0x3b, 0x77, 0x45, 
-	0x2b, 0x5 , 0xf5, 0x47, 0xab, 0x71, 0x4a, 0xe7, 0xa9, 0xe , 0x7 , 0x72, 0xdc, 
-	0xff, 0x0 , 0x2a, 0xcb, 0xb5, 0xd4, 0x2d, 0x7 , 0xc8, 0x6c, 0xf0, 0x7d, 0x9c, 
-	0x8f, 0xe7, 0x56, 0xe2, 0xb9, 0xb2, 0x78, 0xff, 0x0 , 0xe3, 0xd1, 0xf3, 0x9e, 
-	0xcf, 0xff, 0x0 , 0xd6, 0xa5, 0xa9, 0xa2, 0xe4, 0xf2, 0xfc, 0x7f, 0xc8, 0xbe, 
-	0x92, 0xf9, 0x72, 0x6f, 0x84, 0xa2, 0x96, 0xe4, 0x8c, 0x9e, 0xbe, 0xbd, 0x2b, 
-	0x46, 0xd6, 0xf6, 0x9 , 0x57, 0x6c, 0xcc, 0xb9, 0xe8, 0x4e, 0x3f, 0xce, 0x2b, 
-	0x12, 0x6b, 0x7b, 0x46, 0x4d, 0xf1, 0x24, 0x87, 0x3 , 0x3c, 0x4b, 0xfd, 0x2a, 
-	0x6 , 0xb9, 0x36, 0xcd, 0xba, 0x38, 0x9 , 0x23, 0xf8, 0xb3, 0x4a, 0xd2, 0x7b, 
-	0x14, 0xe5, 0x4a, 0x2b, 0xde, 0x5a, 0x1b, 0x57, 0x4b, 0x1e, 0xe2, 0xa2, 0x46, 
-	0x2d, 0x9f, 0x97, 0x9e, 0xd , 0x53, 0x94, 0x3a, 0x7d, 0xe5, 0x18, 0x3f, 0x86, 
-	0x2a, 0xb2, 0xea, 0x72, 0x4b, 0x1f, 0x23, 0x6e, 0xde, 0xca, 0x29, 0x1a, 0xe9, 
-	0x1b, 0xa9, 0xe2, 0xba, 0xa9, 0x54, 0x9f, 0x56, 0x78, 0xd8, 0xdc, 0x3e, 0x1f, 
-	0x78, 0xc6, 0xe4, 0x92, 0x6d, 0xe9, 0xd7, 0xeb, 0x50, 0xb2, 0x91, 0x8f, 0x51, 
-	0xf7, 0x58, 0xc , 0x52, 0xac, 0xe8, 0xc3, 0x8d, 0xb9, 0xfa, 0xd3, 0xb7, 0x6e, 
-	0x1c, 0xed, 0xe7, 0xa1, 0xae, 0xf8, 0x42, 0xeb, 0x56, 0x7c, 0xd5, 0x6a, 0xdc, 
-	0x92, 0xb4, 0x63, 0xa0, 0xd5, 0x2 , 0x68, 0xd8, 0x3a, 0xe1, 0x87, 0x51, 0x9f, 
-	0xe5, 0x54, 0xed, 0x51, 0xad, 0xee, 0x5a, 0x20, 0x7e, 0x65, 0x39, 0x5c, 0xff, 
-	0x0 , 0x10, 0xc1, 0xe0, 0xd5, 0xf9, 0x1 , 0x21, 0x65, 0x50, 0x72, 0x3a, 0x8e, 
-	0x79, 0xa8, 0x6e, 0x97, 0xf7, 0xd0, 0x4e, 0xa3, 0x1c, 0xed, 0x35, 0x53, 0x85, 
-	0xad, 0x2e, 0xa8, 0x8c, 0x35, 0x77, 0x2e, 0x6a, 0x4f, 0x69, 0x27, 0xa7, 0x66, 
-	0x95, 0xff, 0x0 , 0x1b, 0x7e, 0x23, 0x67, 0x88, 0x5c, 0xdb, 0x60, 0xc , 0x64, 
-	0x63, 0x1e, 0x9f, 0xe4, 0xd3, 0xb4, 0xb7, 0x32, 0x43, 0x86, 0xfb, 0xc8, 0x0 , 
-	0x61, 0xf4, 0xcf, 0xf8, 0x54, 0x92, 0x7c, 0x93, 0x7 , 0x7 , 0xe5, 0x7c, 0x67, 
-	0xd3, 0x3e, 0xb4, 0xc8, 0xd3, 0xcb, 0xd4, 0xa5, 0x50, 0x31, 0xbc, 0x6 , 0x1f, 
-	0x9d, 0x6b, 0xcb, 0x69, 0xa9, 0x7c, 0x8e, 0x45, 0x3e, 0x7a, 0x13, 0xa6, 0xff, 
-	0x0 , 0xc4, 0xbe, 0xfb, 0x3f, 0xce, 0xff, 0x0 , 0x22, 0xc3, 0xc , 0x7c, 0xc3, 
-	0xb8, 0xa9, 0x57, 0x95, 0xa6, 0x2f, 0xcc, 0xa4, 0x74, 0xcf, 0x4f, 0x6a, 0x58, 
-	0xf8, 0x5e, 0x7b, 0xd7, 0x4a, 0x3c, 0x99, 0x6a, 0x87, 0x7e, 0x34, 0x9f, 0x8d, 
-	0x2f, 0xe1, 0x47, 0xe1, 0x54, 0x66, 0x25, 0x21, 0xa5, 0x6a, 0x4a, 0x0 , 0x29, 
-	0x8 , 0xa5, 0xa4, 0x26, 0x80, 0x12, 0x8e, 0x68, 0xa4, 0x26, 0x80, 0x6 , 0xa4, 
-	0xa3, 0x34, 0x50, 0x1 , 0xf8, 0xd1, 0xf8, 0xd1, 0xf8, 0x51, 0xf8, 0x50, 0x2 , 
-	0x1a, 0x4a, 0x28, 0xa0, 0x4 , 0x6a, 0x4a, 0x33, 0x45, 0x0 , 0x14, 0xd3, 0x46, 
-	0x68, 0xa0, 0x2 , 0x8f, 0xc6, 0x8f, 0xc2, 0x8f, 0xc2, 0x80, 0x13, 0xf1, 0xa4, 
-	0x34, 0xad, 0xf4, 0xa4, 0xa0, 0x4 , 0x6a, 0x4a, 0x33, 0x45, 0x0 , 0x21, 0x34, 
-	0x94, 0x51, 0x4f, 0xa8, 0x7 , 0xe3, 0x47, 0xe3, 0x47, 0xe1, 0x48, 0x7e, 0x94, 
-	0xc0, 0x4a, 0x33, 0x45, 0x23, 0x50, 0x2 , 0x52, 0x35, 0x2d, 0x23, 0x50, 0x2 , 
-	0x51, 0xf8, 0xd1, 0x47, 0xe1, 0x40, 0x7 , 0xe3, 0x4d, 0x6a, 0x53, 0xf4, 0xa4, 
-	0xa0, 0x4 , 0x6a, 0x4a, 0x56, 0xa4, 0xa0, 0x9 , 0x5 , 0x3a, 0x9b, 0x4a, 0xb5, 
-	0x40, 0x3f, 0x34, 0x52, 0x2d, 0x2d, 0x0 , 0x3b, 0xf1, 0xa3, 0xf1, 0xa3, 0xf0, 
-	0xa3, 0xf0, 0xa0, 0x2 , 0x95, 0x69, 0x29, 0x56, 0x90, 0xe , 0x5a, 0x5a, 0x45, 
-	0xa5, 0xa4, 0x0 , 0xb4, 0xef, 0xc6, 0x93, 0x1e, 0xd4, 0xbf, 0x85, 0x0 , 0x14, 
-	0xab, 0x49, 0x46, 0x68, 0x1 , 0xc3, 0xd2, 0x9c, 0x29, 0xb4, 0xe1, 0x40, 0x0 , 
-	0xa5, 0xfc, 0x69, 0x5 , 0x2f, 0xe1, 0x40, 0xb , 0xf8, 0xd1, 0x47, 0xe1, 0x45, 
-	0x0 , 0x3a, 0x8a, 0x28, 0xa0, 0x7 , 0x66, 0x8a, 0x45, 0xa5, 0xa0, 0x5 , 0xcf, 
-	0xbd, 0x2f, 0xe3, 0x49, 0x8f, 0x6a, 0x5f, 0xc2, 0x90, 0x5 , 0x14, 0x51, 0x48, 
-	0x7 , 0x66, 0x8a, 0x45, 0xa5, 0xa0, 0x0 , 0x53, 0xa9, 0xb4, 0xab, 0x40, 0xb , 
-	0x4a, 0xbf, 0x5a, 0x4a, 0x28, 0x1 , 0xdf, 0x8d, 0x46, 0xd8, 0x39, 0x7 , 0xee, 
-	0xff, 0x0 , 0x11, 0xf6, 0xf4, 0xa7, 0x31, 0xc2, 0xe7, 0xd2, 0xa1, 0xb9, 0x38, 
-	0x8c, 0x20, 0xfb, 0xcd, 0xc9, 0xf6, 0xa0, 0x68, 0x48, 0x73, 0x23, 0x19, 0x30, 
-	0x32, 0xfd, 0x9 , 0xfe, 0x15, 0xed, 0xf9, 0xf5, 0xac, 0x1f, 0x13, 0xea, 0x21, 
-	0x10, 0xa4, 0x59, 0x67, 0x70, 0x7c, 0xbc, 0x1e, 0xbd, 0xb7, 0x9f, 0x61, 0xdb, 
-	0xde, 0xb4, 0xf5, 0xbb, 0xa1, 0x6b, 0xa7, 0x6d, 0x1 , 0xbe, 0x71, 0xdb, 0xa9, 
-	0x1f, 0xd3, 0xb0, 0xcf, 0xbd, 0x64, 0x49, 0x68, 0x5b, 0x50, 0xb5, 0xb7, 0x9f, 
-	0xfd, 0x6c, 0x8c, 0x24, 0x9f, 0x1d, 0x87, 0x5d, 0x83, 0xd9, 0x40, 0x1f, 0x9d, 
-	0x67, 0x26, 0xf6, 0x3a, 0x69, 0x25, 0x7e, 0x66, 0x58, 0xd2, 0xf4, 0xb4, 0xb3, 
-	0xb1, 0x86, 0x24, 0x42, 0x67, 0x91, 0x77, 0x48, 0xe4, 0xfd, 0xd1, 0xd7, 0x3 , 
-	0xd3, 0x9c, 0x56, 0x83, 0x29, 0x44, 0xdc, 0xab, 0x94, 0x84, 0x64, 0xf3, 0x80, 
-	0x71, 0xff, 0x0 , 0xd7, 0xcd, 0x59, 0x55, 0x1e, 0x73, 0x31, 0x1f, 0xc3, 0xf9, 
-	0xc , 0xd3, 0x26, 0x52, 0xf6, 0xae, 0x8b, 0xd1, 0x47, 0x3e, 0xe7, 0xa6, 0x3f, 
-	0x3c, 0xd3, 0xe5, 0x49, 0x11, 0xed, 0x1c, 0xa5, 0xa9, 0x8d, 0x63, 0x1d, 0xc4, 
-	0xbe, 0x6c, 0xe5, 0xd1, 0x5a, 0x46, 0xc9, 0x2f, 0xcf, 0xbf, 0x1f, 0x9f, 0xe9, 
-	0x49, 0x35, 0xab, 0x1e, 0xb3, 0x1f, 0x7d, 0xb8, 0x51, 0xfc, 0xeb, 0xa1, 0xb7, 
-	0x45, 0x4b, 0x7f, 0xb9, 0xc0, 0x27, 0xe9, 0x50, 0xcc, 0xa0, 0xee, 0x90, 0xed, 
-	0x5d, 0xa3, 0xe5, 0x5f, 0x73, 0xd3, 0xf1, 0xa9, 0xf6, 0x6a, 0xc6, 0xf1, 0xc4, 
-	0xb4, 0xf4, 0x46, 0x12, 0xd9, 0x6c, 0x6d, 0xce, 0x16, 0x3d, 0xdd, 0x1 , 0x8c, 
-	0x96, 0x3f, 0x5a, 0x5b, 0xd0, 0x62, 0x8c, 0xb2, 0xef, 0xdc, 0x17, 0xef, 0x64, 
-	0xf , 0x6c, 0x63, 0xad, 0x6e, 0x2d, 0xbd, 0xb4, 0x6b, 0xe6, 0x4c, 0xca, 0x5b, 
-	0xb9, 0xec, 0x2b, 0x17, 0xc4, 0x9a, 0x9c, 0x62, 0x3f, 0x2a, 0xdd, 0x14, 0x1d, 
-	0xc0, 0xf4, 0xf4, 0xe8, 0x2a, 0x5c, 0x14, 0x51, 0x71, 0xad, 0x3a, 0x92, 0x39, 
-	0xdd, 0x59, 0xb1, 0x2e, 0xd0, 0x73, 0xb7, 0x83, 0xde, 0xa8, 0xf5, 0x35, 0x24, 
-	0xf3, 0x92, 0xcd, 0x93, 0x92, 0x4f, 0x3e, 0xf5, 0x5e, 0x47, 0x3d, 0x7 , 0x5a, 
-	0xc1, 0xea, 0xf4, 0x3d, 0x18, 0xbe, 0x55, 0xa9, 0x23, 0x36, 0xd5, 0xe0, 0xd4, 
-	0x2c, 0xe7, 0x34, 0x1c, 0xf7, 0xeb, 0x42, 0xe7, 0xf1, 0xfe, 0x54, 0xac, 0x4c, 
-	0xa6, 0xd8, 0x8c, 0x49, 0xe2, 0x9a, 0xa3, 0xb0, 0x39, 0x34, 0xbe, 0xc3, 0xf3, 
-	0xa1, 0xfe, 0x41, 0x8a, 0xa3, 0x17, 0xae, 0xa3, 0x58, 0xe3, 0xa5, 0x35, 0x46, 
-	0x79, 0x34, 0x50, 0x32, 0x69, 0xec, 0x43, 0xd4, 0x29, 0xa4, 0xf6, 0x14, 0xac, 
-	0x7b, 0xa , 0x41, 0xc7, 0x4a, 0x68, 0x89, 0x3e, 0x82, 0x7b, 0xe , 0xb4, 0x9d, 
-	0xf9, 0x34, 0x67, 0xb0, 0xef, 0x42, 0xf5, 0x3f, 0x4a, 0xa3, 0x26, 0xf5, 0x3 , 
-	0xf7, 0x71, 0x4a, 0xdf, 0x76, 0x91, 0x47, 0x3f, 0xad, 0x12, 0x1c, 0x2d, 0xc , 
-	0x7d, 0x2e, 0x37, 0xa8, 0xa3, 0xfc, 0x28, 0x5e, 0x94, 0x2f, 0x34, 0x8c, 0xc3, 
-	0xf8, 0xa8, 0xa5, 0xfe, 0x2a, 0x43, 0x4f, 0xa8, 0x31, 0xad, 0xcd, 0x6e, 0xf8, 
-	0x6 , 0xf3, 0xcb, 0xba, 0x92, 0xcd, 0x9b, 0x89, 0x3e, 0x65, 0x19, 0xee, 0x3a, 
-	0xfe, 0x9f, 0xca, 0xb0, 0xdb, 0xfa, 0x51, 0x69, 0x3b, 0xdb, 0xdc, 0x47, 0x3c, 
-	0x7c, 0x32, 0x36, 0x45, 0x54, 0x5d, 0x9d, 0xcc, 0xe5, 0xa3, 0x3d, 0x31, 0x4f, 
-	0x14, 0xf5, 0xe9, 0xcd, 0x54, 0xd3, 0x6e, 0x52, 0xea, 0xce, 0x3b, 0x84, 0x3f, 
-	0x2c, 0x8a, 0xf , 0xd0, 0xfa, 0x55, 0xa0, 0x78, 0xae, 0xc4, 0x68, 0x39, 0x72, 
-	0x1b, 0x9a, 0x95, 0x40, 0xe3, 0x3c, 0xd4, 0x59, 0xf6, 0xa7, 0xa9, 0x3d, 0x69, 
-	0x80, 0xfe, 0xd4, 0xd9, 0xf , 0x18, 0x26, 0x95, 0x88, 0xdb, 0xdf, 0xa5, 0x46, 
-	0xd9, 0xa4, 0xc0, 0x55, 0x7d, 0xa6, 0xa5, 0x6b, 0x8d, 0x89, 0x91, 0xf8, 0xd5, 
-	0x59, 0x9b, 0x1d, 0xea, 0xad, 0xc4, 0xb8, 0xef, 0x51, 0x22, 0x93, 0x2f, 0x35, 
-	0xc9, 0x2d, 0x81, 0x42, 0xbb, 0x7a, 0xe6, 0xb3, 0xa1, 0x98, 0x6 , 0x19, 0x3d, 
-	0x6a, 0xe4, 0x72, 0xc , 0x75, 0xa6, 0x84, 0xd9, 0x62, 0x33, 0x93, 0x93, 0x4f, 
-	0x55, 0x5 , 0xb9, 0x15, 0xa , 0xcb, 0x1f, 0x76, 0xa8, 0x27, 0xd4, 0x22, 0x8c, 
-	0x90, 0xe , 0x7e, 0x94, 0x8 , 0xd5, 0x82, 0x2d, 0xec, 0x7 , 0x15, 0xd7, 0xf8, 
-	0x2f, 0x47, 0x49, 0x6e, 0x10, 0xb8, 0x7 , 0x35, 0xe6, 0x91, 0xeb, 0x8e, 0x8c, 
-	0xa , 0x2f, 0x4f, 0x5a, 0xdb, 0xd0, 0x3c, 0x6b, 0x7b, 0x67, 0x32, 0x95, 0xfe, 
-	0x1f, 0x6a, 0xe6, 0xac, 0x9b, 0x56, 0x47, 0x76, 0x1e, 0xc9, 0xea, 0x7d, 0x35, 
-	0xe1, 0x9f, 0x9 , 0x43, 0x26, 0x9a, 0xb2, 0xa4, 0x60, 0x8e, 0xe7, 0xa5, 0x5b, 
-	0xb9, 0xd0, 0x96, 0x5 , 0x6f, 0xdd, 0xaf, 0xcb, 0xe9, 0x5e, 0x61, 0xe0, 0x5f, 
-	0x8b, 0xad, 0x14, 0x62, 0x29, 0x70, 0xbc, 0x60, 0x8e, 0xd5, 0xd2, 0xea, 0x1f, 
-	0x13, 0xad, 0xa5, 0x87, 0xe4, 0xe5, 0x8f, 0x6c, 0xd7, 0x93, 0x52, 0x12, 0x5a, 
-	0x58, 0xf5, 0x69, 0xdd, 0x1e, 0x8b, 0xe0, 0xf9, 0x45, 0x9c, 0x3e, 0x59, 0x3f, 
-	0x2e, 0x46, 0x7b, 0x56, 0xdd, 0xd5, 0xfd, 0xbe, 0xdc, 0xb4, 0xab, 0xdb, 0x8c, 
-	0xd7, 0x80, 0x5f, 0x7c, 0x41, 0xbd, 0x2c, 0x4c, 0x2c, 0x23, 0xac, 0xa9, 0xfe, 
-	0x24, 0x6a, 0x91, 0x49, 0xb8, 0xc9, 0xbb, 0x1d, 0xb3, 0xd2, 0xb3, 0xf6, 0x6d, 
-	0x9d, 0xf , 0xb9, 0xf4, 0x1d, 0xe5, 0xf4, 0x41, 0x8e, 0x19, 0x46, 0xe3, 0xc0, 
-	0x7 , 0x81, 0x54, 0x2e, 0x6f, 0x62, 0xfb, 0xa4, 0x83, 0xea, 0x6b, 0xc1, 0xa4, 
-	0xf8, 0xad, 0x78, 0xbc, 0x3c, 0x5f, 0x8e, 0xea, 0xab, 0x37, 0xc5, 0xcb, 0x81, 
-	0xc7, 0x90, 0x4f, 0xfc, 0xa , 0x97, 0xb0, 0x91, 0x9b, 0xa8, 0x91, 0xec, 0xda, 
-	0xf5, 0xdc, 0x22, 0x16, 0x60, 0xdd, 0x3d, 0x6b, 0xc4, 0xfe, 0x2f, 0x6b, 0xb1, 
-	0xc1, 0x3e, 0xc5, 0x9c, 0x7 , 0x24, 0xe1, 0x43, 0x73, 0xfa, 0x55, 0x76, 0xf1, 
-	0x97, 0x89, 0xfc, 0x46, 0xde, 0x56, 0x9b, 0x6b, 0xe5, 0xc6, 0xc7, 0x1e, 0x73, 
-	0x3 , 0x81, 0xfe, 0x35, 0x99, 0xac, 0x78, 0x23, 0x50, 0x3b, 0xae, 0xef, 0x27, 
-	0x92, 0xe2, 0x62, 0x3e, 0x67, 0x7f, 0xe9, 0x5a, 0xd3, 0xa4, 0xa2, 0xfd, 0xe3, 
-	0x9a, 0xa5, 0x49, 0x3d, 0x8c, 0x7d, 0x1b, 0xc4, 0x33, 0xa4, 0x83, 0x32, 0x12, 
-	0xb9, 0xee, 0x6b, 0xd0, 0x3c, 0x33, 0xab, 0xbc, 0xf1, 0x82, 0x1f, 0x19, 0x1d, 
-	0x8f, 0xff, 0x0 , 0x5e, 0xbc, 0xc6, 0x7d, 0x35, 0xed, 0xae, 0x8 , 0xd9, 0x8e, 
-	0x7d, 0x2b, 0xaa, 0xf0, 0x9a, 0x84, 0x87, 0xe6, 0xdd, 0x5d, 0x15, 0x23, 0xb , 
-	0x5d, 0x18, 0xa9, 0x4a, 0xfa, 0x9d, 0xfd, 0xad, 0xf3, 0xa1, 0xc7, 0x9a, 0xa7, 
-	0xd4, 0x3 , 0x5a, 0xb0, 0xdc, 0xbb, 0xc1, 0xbb, 0xcd, 0x25, 0x54, 0x7a, 0xe7, 
-	0xf3, 0xae, 0x2a, 0x9 , 0x8a, 0x4b, 0xf7, 0xb7, 0x73, 0xc6, 0xe3, 0x9a, 0xd5, 
-	0x82, 0x49, 0xf , 0x20, 0xaa, 0xe7, 0x8c, 0x66, 0xb9, 0x9c, 0x4d, 0xd4, 0x8d, 
-	0xc6, 0xd4, 0xcb, 0x7e, 0xed, 0x1b, 0x23, 0xb9, 0x2 , 0xa9, 0xdd, 0xdd, 0xc4, 
-	0x90, 0xc9, 0x73, 0x2c, 0xbb, 0x20, 0x81, 0x1a, 0x49, 0x18, 0xf4, 0x0 , 0xc , 
-	0x92, 0x6a, 0x18, 0xc8, 0xb , 0x85, 0x38, 0x3d, 0xf1, 0x5c, 0x2f, 0xed, 0x5 , 
-	0xe2, 0xf , 0xec, 0x9f, 0x5 , 0xff, 0x0 , 0x66, 0x5b, 0xb8, 0x5b, 0x8d, 0x54, 
-	0x98, 0xf1, 0x9e, 0x44, 0x43, 0x96, 0x3f, 0x8f, 0x3 , 0xf1, 0x34, 0xe3, 0x1e, 
-	0x66, 0xa2, 0x87, 0x52, 0xaa, 0xa7, 0x7 , 0x27, 0xd0, 0xf1, 0x1f, 0x17, 0x6a, 
-	0xb2, 0x6b, 0x9e, 0x26, 0xbe, 0xd5, 0xa4, 0x2d, 0xba, 0xee, 0x76, 0x90, 0x3 , 
-	0xd9, 0x73, 0xf2, 0x8f, 0xc0, 0x60, 0x56, 0x7a, 0x74, 0x34, 0xda, 0x72, 0x77, 
-	0xaf, 0x4e, 0xd6, 0x56, 0x3e, 0x6a, 0x32, 0x6e, 0x57, 0x62, 0x9a, 0x3a, 0x75, 
-	0xe9, 0x48, 0x4f, 0x22, 0x86, 0xa4, 0x68, 0xf5, 0x3 , 0xd2, 0x88, 0xcf, 0x6f, 
-	0xca, 0x85, 0xe7, 0x8a, 0x6f, 0x43, 0xc5, 0x4 , 0xad, 0x19, 0x61, 0x4f, 0xcb, 
-	0x9a, 0xb1, 0x13, 0x67, 0x83, 0xe9, 0x55, 0x63, 0xe5, 0xb0, 0x3f, 0x8a, 0x9e, 
-	0x9 , 0x18, 0x3e, 0x95, 0x9c, 0x91, 0xdb, 0x4a, 0xa3, 0x44, 0xb2, 0x8c, 0x9a, 
-	0x62, 0xf1, 0xc8, 0x34, 0xfc, 0x83, 0x4d, 0xc0, 0xd , 0xf5, 0xa4, 0x8d, 0x25, 
-	0xab, 0xb9, 0x6e, 0xda, 0x46, 0xfe, 0x1f, 0xc4, 0x7a, 0xd5, 0xa8, 0xce, 0xf5, 
-	0xc0, 0x1f, 0x50, 0x7d, 0x3d, 0x6a, 0x84, 0x24, 0x6e, 0x19, 0xfc, 0x6a, 0xe4, 
-	0x5c, 0x11, 0x83, 0xc8, 0xe5, 0x7d, 0xeb, 0x9 , 0xa5, 0x73, 0xd4, 0xc3, 0xc9, 
-	0xf2, 0x8d, 0x91, 0x6 , 0xec, 0x1e, 0xbe, 0xdc, 0xd5, 0xcd, 0x39, 0xff, 0x0 , 
-	0x87, 0x70, 0x23, 0x1d, 0xcd, 0x46, 0xd1, 0xa4, 0xc9, 0x85, 0xe1, 0x89, 0xf9, 
-	0x7d, 0xbd, 0xbf, 0x3a, 0x8e, 0x22, 0xe8, 0xf9, 0x3d, 0x47, 0x5c, 0xf6, 0xa9, 
-	0x7e, 0xf2, 0xb1, 0xd1, 0x4d, 0xba, 0x75, 0x14, 0xba, 0x1a, 0x83, 0x7a, 0x72, 
-	0xa4, 0xb0, 0xa7, 0x2c, 0xd3, 0x46, 0xbf, 0x2c, 0x99, 0x18, 0xe4, 0xe3, 0x34, 
-	0xeb, 0x37, 0xf3, 0x46, 0x41, 0xc3, 0xc , 0x71, 0xef, 0x4f, 0x92, 0x21, 0xb7, 
-	0x8f, 0x94, 0x8e, 0xa2, 0xb9, 0x1b, 0x57, 0xd4, 0xf6, 0xe0, 0x9d, 0xaf, 0x16, 
-	0x48, 0x4c, 0x92, 0x44, 0x24, 0x41, 0x97, 0xc7, 0x4f, 0xf0, 0x34, 0xb6, 0xb7, 
-	0x82, 0x55, 0xdc, 0xbb, 0x83, 0x29, 0xc3, 0x2f, 0x4 , 0x83, 0x4c, 0xd3, 0xdc, 
-	0x24, 0xb8, 0x27, 0xe5, 0x6e, 0x4a, 0xe7, 0xbd, 0x3a, 0xe2, 0x26, 0xb7, 0xba, 
-	0xfb, 0x54, 0x7c, 0xaf, 0xf1, 0xaf, 0xb7, 0xad, 0x67, 0x65, 0xb1, 0xd5, 0x19, 
-	0x4b, 0x49, 0x5f, 0x4e, 0xbf, 0xe6, 0x5b, 0xb3, 0xd4, 0x82, 0xf2, 0x54, 0x91, 
-	0xfd, 0xe5, 0xf5, 0xab, 0x42, 0xe6, 0x39, 0xe , 0x51, 0x86, 0xf , 0x5c, 0xd6, 
-	0x5d, 0xf4, 0x49, 0xb9, 0x66, 0x8d, 0x7e, 0x57, 0xfb, 0xc1, 0x4e, 0xe , 0x69, 
-	0xb0, 0xb0, 0x1c, 0x31, 0xcf, 0xae, 0x7d, 0x29, 0xc5, 0x7d, 0xa4, 0x44, 0xe5, 
-	0xab, 0xa7, 0x32, 0xd4, 0x8c, 0xd6, 0xd7, 0x41, 0x90, 0x9d, 0xac, 0x7f, 0x2f, 
-	0x63, 0x57, 0xa3, 0x95, 0x5d, 0x72, 0xa3, 0xef, 0x7b, 0x74, 0x3e, 0xf5, 0x97, 
-	0xd3, 0xe5, 0xc3, 0x60, 0x9e, 0xaa, 0xdf, 0x97, 0x14, 0xfb, 0x2b, 0x85, 0x8e, 
-	0x46, 0x8d, 0x9b, 0x95, 0xfb, 0xc1, 0x86, 0xe , 0x2b, 0x68, 0xd4, 0xe5, 0x77, 
-	0xb1, 0xc1, 0x57, 0xd , 0xcf, 0x7 , 0xe , 0x64, 0xfb, 0x7f, 0x91, 0xab, 0x1b, 
-	0x80, 0xc3, 0xe5, 0x1f, 0x95, 0x58, 0x8d, 0xd7, 0xd0, 0x7b, 0xfc, 0xb5, 0x9e, 
-	0xd2, 0x15, 0x65, 0x60, 0xbb, 0x95, 0xbd, 0x3b, 0x54, 0x91, 0xcc, 0x30, 0xa7, 
-	0x69, 0xe7, 0xd7, 0xb5, 0x77, 0x53, 0xc5, 0x41, 0x75, 0x3c, 0xc , 0x5e, 0x4f, 
-	0x5d, 0xea, 0xa2, 0x5c, 0x47, 0xea, 0xb9, 0xe0, 0x8e, 0x9 , 0xed, 0x50, 0xcf, 
-	0x8f, 0x24, 0xf3, 0xf7, 0x58, 0x11, 0xf9, 0xd4, 0x7e, 0x72, 0x91, 0xf7, 0x4d, 
-	0x6 , 0x4d, 0xea, 0xdf, 0x26, 0x32, 0x31, 0xc9, 0xad, 0xa5, 0x51, 0x4a, 0x3a, 
-	0x1c, 0x34, 0xb0, 0xf5, 0x29, 0x55, 0x5c, 0xca, 0xda, 0xaf, 0xeb, 0xee, 0x27, 
-	0x90, 0x6 , 0x8c, 0xa9, 0x1c, 0x3 , 0xfa, 0x1a, 0x8c, 0xe4, 0xcd, 0xb , 0x77, 
-	0x20, 0xa1, 0xff, 0x0 , 0x3f, 0x85, 0x48, 0xb9, 0x2b, 0xc8, 0x3c, 0x8e, 0xc3, 
-	0x14, 0x9b, 0x7e, 0x68, 0xc8, 0xec, 0xe0, 0xfe, 0x95, 0xac, 0x91, 0xc7, 0x4e, 
-	0x56, 0xbd, 0xfc, 0xff, 0x0 , 0x2b, 0x12, 0xaf, 0xd , 0xcf, 0x7f, 0xe7, 0x4a, 
-	0xbf, 0xd6, 0x92, 0x4c, 0x8e, 0x7d, 0xe9, 0x4f, 0x43, 0x5b, 0x1c, 0x52, 0x7d, 
-	0x47, 0x7e, 0x34, 0x99, 0xf7, 0xa5, 0xfc, 0x29, 0x31, 0xed, 0x4c, 0x81, 0x28, 
-	0xa2, 0x8a, 0x0 , 0x46, 0xa4, 0xa5, 0x6a, 0x4a, 0x0 , 0x29, 0x1a, 0x96, 0x91, 
-	0xa8, 0x1 , 0x28, 0xa2, 0x83, 0x40, 0x7 , 0xe3, 0x49, 0x9f, 0x7a, 0x5a, 0x69, 
-	0xa0, 0x2 , 0x8c, 0xd1, 0x48, 0xd4, 0x0 , 0x94, 0x51, 0x48, 0x4d, 0x0 , 0x25, 
-	0x14, 0x51, 0xf8, 0x50, 0x1 , 0xf8, 0xd1, 0xf8, 0xd1, 0xf8, 0x51, 0xf8, 0x50, 
-	0x3 , 0x68, 0xcd, 0x14, 0x8d, 0x40, 0x9 , 0x48, 0xd4, 0xb4, 0x8d, 0x4d, 0x0 , 
-	0x94, 0x7e, 0x34, 0x51, 0xf8, 0x53, 0x0 , 0xfc, 0x69, 0xad, 0x4a, 0x69, 0x28, 
-	0x0 , 0xa4, 0x6a, 0x53, 0x4d, 0xa0, 0x2 , 0x9a, 0x69, 0x5a, 0x92, 0x80, 0xa , 
-	0x3f, 0x1a, 0x3f, 0xa , 0x3f, 0xa , 0x0 , 0x46, 0xfa, 0xd2, 0x51, 0x45, 0x0 , 
-	0x21, 0x34, 0x94, 0x52, 0x13, 0x40, 0x12, 0x8a, 0x75, 0x36, 0x95, 0x6a, 0x80, 
-	0x72, 0xd2, 0xd2, 0x2d, 0x2d, 0x0 , 0xb , 0x4e, 0xfc, 0x69, 0xab, 0x4e, 0xfc, 
-	0x28, 0x0 , 0xa5, 0x5a, 0x4a, 0x55, 0xa0, 0x5 , 0xa5, 0x5a, 0x4a, 0x55, 0xa5, 
-	0xa0, 0xa , 0xb4, 0xef, 0xc6, 0x9a, 0xb4, 0xef, 0xc2, 0x90, 0x7 , 0x6a, 0x50, 
-	0x69, 0x28, 0xa0, 0x7 , 0x52, 0x83, 0x49, 0x45, 0x0 , 0x38, 0x52, 0xfe, 0x34, 
-	0x94, 0xab, 0xf4, 0xa0, 0x5 , 0xfc, 0x68, 0xa3, 0xf0, 0xa2, 0x80, 0x1 , 0x4e, 
-	0xa6, 0x8a, 0x75, 0x0 , 0x3b, 0x34, 0x53, 0x69, 0xc2, 0x80, 0x5 , 0xa7, 0x7e, 
-	0x34, 0xda, 0x51, 0xf4, 0xa0, 0x5 , 0xfc, 0x68, 0xa3, 0xf0, 0xa2, 0xa4, 0x0 , 
-	0x53, 0xa9, 0xb4, 0xe5, 0xa0, 0x5 , 0x5a, 0x5a, 0x6d, 0x0 , 0xe2, 0x80, 0x1d, 
-	0x45, 0x20, 0x34, 0xb4, 0x0 , 0x8c, 0x72, 0xc0, 0x7e, 0x27, 0x35, 0x13, 0x6d, 
-	0x2c, 0xf2, 0xb9, 0xc4, 0x6b, 0xd4, 0x9f, 0x4e, 0xbf, 0x95, 0x3c, 0xfc, 0xd2, 
-	0x10, 0x3a, 0x2 , 0x1 , 0xff, 0x0 , 0xa , 0x86, 0xe8, 0xe5, 0x76, 0xae, 0x3e, 
-	0x51, 0xe6, 0x38, 0xf5, 0xeb, 0xb4, 0x7e, 0x63, 0xf4, 0xa0, 0xa4, 0x8a, 0x50, 
-	0xab, 0x5f, 0xea, 0xa1, 0xa6, 0x4c, 0x2c, 0x7f, 0xbc, 0x23, 0xd1, 0x41, 0x21, 
-	0x17, 0xea, 0x4e, 0x58, 0xfe, 0x14, 0x46, 0x8c, 0xfa, 0xe3, 0xce, 0xdc, 0xe0, 
-	0x1c, 0x7f, 0x2c, 0x7e, 0x95, 0x73, 0x44, 0x8b, 0x6c, 0x2d, 0x29, 0xe5, 0xa5, 
-	0x7e, 0xbe, 0xc3, 0x81, 0xfc, 0xa9, 0xd6, 0xd1, 0xe2, 0x42, 0xcc, 0x3b, 0xf1, 
-	0xf8, 0xe3, 0xff, 0x0 , 0xaf, 0x53, 0xcb, 0xb1, 0xa3, 0x95, 0xae, 0x4a, 0xc8, 
-	0x51, 0x1b, 0x1d, 0x5b, 0x0 , 0x7d, 0x31, 0x42, 0xa9, 0x5b, 0x50, 0x3d, 0x48, 
-	0xa7, 0xb6, 0x49, 0x6c, 0x76, 0x18, 0xa7, 0x63, 0x1c, 0x7a, 0x63, 0xf4, 0xaa, 
-	0x33, 0xb8, 0xd0, 0xb9, 0x55, 0x52, 0x4f, 0x1c, 0xf1, 0x51, 0x49, 0x18, 0x32, 
-	0x36, 0x49, 0xca, 0x8c, 0x8a, 0xb1, 0x8f, 0x9b, 0x3e, 0xd5, 0x1d, 0xc6, 0x3 , 
-	0x6f, 0xf4, 0xe0, 0x8f, 0x5f, 0x6a, 0x1 , 0x6e, 0x56, 0xba, 0x8e, 0x25, 0x8c, 
-	0x96, 0x20, 0x7a, 0x33, 0x76, 0x1f, 0xde, 0xef, 0x5c, 0x47, 0x88, 0x2f, 0x3c, 
-	0xfb, 0xa6, 0x82, 0xdd, 0x7e, 0x50, 0xdf, 0xe7, 0xf4, 0xae, 0x83, 0xc5, 0x97, 
-	0xad, 0x1d, 0xba, 0xdb, 0x45, 0xcc, 0xd2, 0xfc, 0xab, 0xfd, 0x49, 0xae, 0x71, 
-	0xad, 0xd5, 0x1b, 0x64, 0x7f, 0x34, 0x9b, 0x4e, 0x49, 0xee, 0x6b, 0x9e, 0xa3, 
-	0xbb, 0xb1, 0xe8, 0x61, 0xa3, 0xcb, 0xef, 0x32, 0x94, 0xc1, 0x22, 0xe1, 0x8 , 
-	0x6f, 0x56, 0x23, 0xae, 0x3d, 0x3f, 0x1a, 0xae, 0x72, 0x4e, 0xec, 0xe5, 0x9a, 
-	0xa5, 0xbe, 0xff, 0x0 , 0x8f, 0x9d, 0x80, 0xe4, 0x2e, 0x0 , 0xa8, 0xd7, 0xe5, 
-	0xc9, 0x3f, 0x85, 0x64, 0xf4, 0x3b, 0x23, 0x77, 0xa8, 0x60, 0x2f, 0x19, 0xfc, 
-	0x7d, 0x29, 0xb8, 0x2e, 0xdb, 0x54, 0x53, 0xc2, 0x13, 0xcb, 0x70, 0x3b, 0x52, 
-	0x48, 0xf8, 0x18, 0x4e, 0x7 , 0x7f, 0xfe, 0xbd, 0x22, 0x9a, 0xd3, 0x50, 0x62, 
-	0xa8, 0x30, 0xa7, 0x24, 0xf5, 0x6f, 0xf0, 0xa8, 0x4d, 0x2b, 0x1c, 0xb7, 0x26, 
-	0x90, 0x83, 0xd3, 0xfc, 0x8a, 0x6b, 0x43, 0x19, 0x4a, 0xe2, 0x11, 0xb8, 0xe2, 
-	0x91, 0xfe, 0xee, 0x1 , 0xfc, 0x69, 0x58, 0x80, 0xb8, 0x1f, 0x9d, 0x47, 0xc9, 
-	0x3e, 0xd4, 0xd1, 0x94, 0x9d, 0x83, 0xad, 0xe , 0x78, 0xa5, 0x3c, 0xc , 0x77, 
-	0xef, 0x4d, 0xce, 0x5b, 0xe9, 0x54, 0x66, 0xf4, 0x40, 0x45, 0x1f, 0xc3, 0x4b, 
-	0x4a, 0xdc, 0xe0, 0x55, 0x9 , 0x20, 0x51, 0xd2, 0x9b, 0x2f, 0x27, 0x15, 0x20, 
-	0xe1, 0x73, 0x50, 0x93, 0x93, 0x9a, 0x90, 0x96, 0x8a, 0xc0, 0x7e, 0xed, 0x3a, 
-	0x3f, 0xbb, 0x48, 0xdd, 0x29, 0x63, 0x1f, 0x2e, 0x68, 0x25, 0x6e, 0x18, 0xe6, 
-	0x9a, 0xdf, 0xd2, 0x9d, 0x9e, 0x69, 0xa7, 0xbf, 0xd0, 0x50, 0xc , 0x47, 0xe2, 
-	0xa2, 0xa9, 0x24, 0xe9, 0x51, 0xd5, 0x18, 0x4f, 0x73, 0xa2, 0xf0, 0x2e, 0xa3, 
-	0xe5, 0x5c, 0x1b, 0x19, 0xf , 0xcb, 0x27, 0x31, 0xfb, 0x37, 0xa7, 0xe3, 0x5d, 
-	0x7a, 0x9a, 0xf3, 0x8 , 0x9d, 0x92, 0x40, 0xe8, 0x76, 0xb2, 0x9c, 0x82, 0x3b, 
-	0x1a, 0xef, 0xbc, 0x37, 0xa9, 0x2e, 0xa3, 0xa7, 0xac, 0x84, 0xfe, 0xf5, 0x38, 
-	0x91, 0x7d, 0xfd, 0x6b, 0x7a, 0x72, 0xbe, 0x83, 0x84, 0xba, 0x1a, 0xab, 0xcf, 
-	0xad, 0x29, 0xa6, 0xc6, 0x4d, 0x38, 0x73, 0x5b, 0x9a, 0xe , 0xc9, 0x3d, 0xd , 
-	0x32, 0x6e, 0xf , 0x14, 0xb9, 0xc7, 0x34, 0xc9, 0x39, 0xe6, 0x93, 0x2 , 0x1b, 
-	0x86, 0xcf, 0x4a, 0xa9, 0x24, 0x65, 0xce, 0x33, 0x56, 0x58, 0x64, 0x9a, 0x45, 
-	0x5e, 0x73, 0x59, 0xbd, 0xc6, 0x64, 0xdf, 0x5a, 0x4a, 0x83, 0x7c, 0x52, 0x32, 
-	0x9f, 0xd2, 0xa8, 0x9b, 0xdb, 0xc8, 0x8e, 0x1f, 0x9c, 0x77, 0x15, 0xd4, 0x34, 
-	0x4a, 0xeb, 0x82, 0x2b, 0x27, 0x53, 0xb2, 0x3 , 0x39, 0x1d, 0x7b, 0xe2, 0x86, 
-	0x9a, 0xd8, 0x71, 0x32, 0xce, 0xa4, 0xe7, 0x96, 0x63, 0x48, 0x6f, 0x37, 0x77, 
-	0xcd, 0x13, 0xdb, 0xed, 0xed, 0x4c, 0x4b, 0x7d, 0xdd, 0x5 , 0x64, 0xe5, 0x23, 
-	0x78, 0xc2, 0xe1, 0xf6, 0x83, 0x9e, 0xb5, 0x35, 0xbd, 0xdb, 0x2b, 0x54, 0x96, 
-	0xfa, 0x5b, 0xc9, 0xc8, 0x4c, 0xd5, 0xc8, 0x7c, 0x3d, 0x73, 0x26, 0x16, 0x38, 
-	0xce, 0x4f, 0xa1, 0xac, 0x9d, 0x5b, 0x1d, 0x94, 0xf0, 0xf3, 0x7a, 0xa4, 0x49, 
-	0xa7, 0xeb, 0x6 , 0x26, 0xcb, 0xa9, 0xfc, 0xeb, 0x6a, 0x1f, 0x13, 0xa4, 0x6a, 
-	0x36, 0xf1, 0xf8, 0xd4, 0x1a, 0xf , 0x80, 0x75, 0xcd, 0x51, 0x80, 0xb5, 0xb4, 
-	0x92, 0x4c, 0xf4, 0xc6, 0x3d, 0xbf, 0xc4, 0x56, 0xdf, 0x86, 0xfe, 0x19, 0xdf, 
-	0xcb, 0xe2, 0x9 , 0xb4, 0xcd, 0x4b, 0x75, 0xbc, 0x96, 0xaf, 0xb6, 0x60, 0xa , 
-	0xe4, 0x60, 0x8c, 0xf5, 0x20, 0x74, 0x3e, 0xb5, 0x84, 0xe4, 0x9e, 0xa7, 0x7d, 
-	0x2a, 0x53, 0x46, 0x5d, 0xc7, 0x8a, 0x19, 0xc6, 0x23, 0xe7, 0xda, 0xa9, 0xc7, 
-	0x75, 0xab, 0x5e, 0xdc, 0x62, 0x28, 0x9c, 0xe7, 0xa0, 0x3 , 0x35, 0xf4, 0xbf, 
-	0xc3, 0x9f, 0x83, 0x9f, 0xf , 0x74, 0xcf, 0x14, 0xdd, 0xd8, 0x6b, 0xb0, 0xc3, 
-	0x76, 0xd6, 0xc5, 0x7c, 0xa8, 0xe7, 0xd4, 0x7f, 0xd6, 0x65, 0x55, 0xbe, 0xec, 
-	0xa , 0xfb, 0x8e, 0x9 , 0xe0, 0x11, 0x8c, 0x63, 0x35, 0xdc, 0xeb, 0x1a, 0xf , 
-	0x85, 0x34, 0x9 , 0x2c, 0xa5, 0xb4, 0xd0, 0x2c, 0x74, 0xab, 0x13, 0x39, 0x47, 
-	0x91, 0xad, 0x85, 0xaf, 0xc8, 0xea, 0x46, 0x33, 0x23, 0x3c, 0xa4, 0x64, 0x21, 
-	0xdc, 0x0 , 0xea, 0x7a, 0x52, 0x54, 0x9d, 0xaf, 0x70, 0xf6, 0xd1, 0xe6, 0x51, 
-	0xb3, 0x67, 0xc9, 0x5a, 0x3f, 0x82, 0x3c, 0x55, 0xa9, 0xce, 0xaa, 0x6d, 0xa5, 
-	0x88, 0x48, 0x54, 0x6e, 0x70, 0x54, 0xc , 0x9e, 0x9 , 0xcd, 0x74, 0xa7, 0xe1, 
-	0xdd, 0xbe, 0x87, 0x20, 0x5d, 0x56, 0xe3, 0xed, 0x17, 0x60, 0xe0, 0x42, 0xbf, 
-	0x75, 0x48, 0x38, 0x3b, 0xbd, 0xbb, 0x8f, 0xad, 0x7a, 0xbf, 0x8c, 0xbc, 0x71, 
-	0x60, 0x3c, 0x3e, 0xda, 0x46, 0x9d, 0x4 , 0x73, 0x4a, 0x8a, 0xd1, 0x35, 0xca, 
-	0x47, 0xe5, 0xa6, 0xd2, 0x41, 0xc8, 0x3 , 0x92, 0xc0, 0xa8, 0x3b, 0x8f, 0x3c, 
-	0xd7, 0x13, 0x68, 0x6e, 0x35, 0x4d, 0x40, 0x4f, 0x3c, 0x8d, 0x23, 0x92, 0x37, 
-	0x3b, 0x1e, 0x78, 0x18, 0xae, 0x7a, 0x95, 0x12, 0xd1, 0x3b, 0x9e, 0x85, 0x2c, 
-	0x3e, 0x9c, 0xf3, 0x8d, 0x97, 0x63, 0xa2, 0xf0, 0x7d, 0x92, 0xfd, 0x82, 0x1b, 
-	0x34, 0x85, 0x55, 0x43, 0x16, 0x1b, 0x57, 0xa6, 0x78, 0xc7, 0xd2, 0xb7, 0xf5, 
-	0xad, 0x2e, 0x2f, 0xb2, 0xec, 0x55, 0x7 , 0x3 , 0x9e, 0x2a, 0x7f, 0x8 , 0xd8, 
-	0x8b, 0x7b, 0x51, 0x2b, 0x2e, 0x9 , 0x1c, 0x64, 0x56, 0x8d, 0xf6, 0x1a, 0x6 , 
-	0x38, 0xe4, 0xf6, 0xae, 0x49, 0xd4, 0x6d, 0x9c, 0xb5, 0x23, 0x16, 0xdd, 0x91, 
-	0xe4, 0x7e, 0x20, 0xf0, 0xec, 0x46, 0xeb, 0x73, 0xae, 0x39, 0xe7, 0x8a, 0x86, 
-	0xd7, 0x4a, 0x8a, 0x15, 0x21, 0x7 , 0xe4, 0x2b, 0xb2, 0xd7, 0x23, 0xd , 0x21, 
-	0x38, 0xea, 0x78, 0xaa, 0x51, 0xda, 0x2e, 0xdc, 0xb0, 0x6f, 0x6f, 0x7a, 0xd5, 
-	0x54, 0x76, 0x39, 0x25, 0xd , 0x4e, 0x6a, 0x1b, 0x49, 0x16, 0x4c, 0x95, 0x5d, 
-	0xb9, 0xea, 0x6a, 0xfc, 0x50, 0xed, 0xc8, 0x3 , 0xeb, 0x57, 0x64, 0x85, 0x77, 
-	0x67, 0xb6, 0x7a, 0xd2, 0xb3, 0x2a, 0x83, 0x8c, 0x71, 0xd7, 0x34, 0xee, 0x2b, 
-	0x11, 0x46, 0x55, 0x14, 0xb3, 0xb0, 0x54, 0x50, 0x5a, 0x47, 0x6e, 0x80, 0x57, 
-	0xce, 0x9f, 0x13, 0xb5, 0xc7, 0xf1, 0x47, 0x8c, 0x2e, 0x2f, 0x87, 0xfc, 0x7b, 
-	0xc7, 0xfb, 0xab, 0x55, 0x1d, 0xa3, 0x53, 0xc1, 0xfc, 0x79, 0x3f, 0x8d, 0x7a, 
-	0x7f, 0xc7, 0x1f, 0x12, 0xff, 0x0 , 0x67, 0xf8, 0x7c, 0xe8, 0xf6, 0x4e, 0x45, 
-	0xc5, 0xe8, 0xfd, 0xf1, 0x1d, 0x52, 0x2c, 0xf3, 0xf4, 0x2d, 0x8c, 0x7d, 0x33, 
-	0x5e, 0x45, 0xd , 0xbc, 0x70, 0xdb, 0x34, 0xb2, 0x7f, 0xad, 0x20, 0x15, 0x5f, 
-	0xee, 0xfb, 0x9a, 0xec, 0xc2, 0xd3, 0xfb, 0x4c, 0xf2, 0xf3, 0xc , 0x45, 0xdf, 
-	0xb3, 0x46, 0x53, 0x42, 0x17, 0x72, 0x38, 0xda, 0xcb, 0x51, 0x2d, 0x5b, 0xba, 
-	0x45, 0x2e, 0x64, 0x27, 0xe9, 0x55, 0xe4, 0x4d, 0x98, 0x1e, 0xd5, 0xd3, 0x23, 
-	0x86, 0x9c, 0x5b, 0xd4, 0x8d, 0xa9, 0xb9, 0xa7, 0xed, 0xa6, 0xe0, 0x52, 0x29, 
-	0x89, 0x45, 0x14, 0x50, 0x21, 0xf1, 0x9e, 0x7f, 0x5a, 0x94, 0x1c, 0x9f, 0xad, 
-	0x40, 0x9f, 0x7a, 0xa5, 0x8f, 0x93, 0x8a, 0x99, 0x1b, 0x52, 0x7d, 0x7 , 0xc2, 
-	0xdf, 0xc3, 0xe9, 0x52, 0x30, 0xdc, 0xa0, 0xd4, 0x4b, 0xcb, 0x86, 0x1e, 0xbc, 
-	0xd4, 0xf0, 0xf2, 0xac, 0x2a, 0x59, 0xd3, 0x4b, 0x5d, 0x5 , 0x8f, 0x9a, 0xb5, 
-	0x6e, 0xc4, 0x8f, 0x43, 0x55, 0x90, 0x63, 0x9a, 0x9a, 0xdd, 0xb0, 0xdf, 0x8d, 
-	0x63, 0x2d, 0x51, 0xe8, 0x50, 0x76, 0x6a, 0xe5, 0xc5, 0x5d, 0xd8, 0x23, 0xef, 
-	0x1e, 0x78, 0xf5, 0xa9, 0x9d, 0xb , 0xa8, 0x71, 0x8d, 0xdf, 0xc5, 0x50, 0xdb, 
-	0x91, 0xd0, 0x1c, 0x73, 0xc1, 0xf4, 0x35, 0x6e, 0x32, 0xad, 0xc9, 0x1b, 0x58, 
-	0x75, 0xc9, 0xe2, 0xb9, 0xd9, 0xeb, 0x53, 0x8a, 0x61, 0x62, 0xcc, 0xbf, 0x32, 
-	0xfd, 0xe1, 0xd4, 0x56, 0xa4, 0x6c, 0x8e, 0x39, 0x5 , 0x48, 0x38, 0x3e, 0xde, 
-	0xc6, 0xa8, 0x34, 0x6b, 0xc4, 0x89, 0xc1, 0xfe, 0x20, 0x3f, 0xcf, 0x35, 0x66, 
-	0xd6, 0x4d, 0xd8, 0x2d, 0xc1, 0xf5, 0xec, 0x45, 0x61, 0x53, 0x5d, 0x4f, 0x4f, 
-	0xd , 0x78, 0xfb, 0x8c, 0x2e, 0x61, 0x78, 0xe5, 0x4 , 0x2f, 0xd , 0xd4, 0x7a, 
-	0x55, 0xab, 0x57, 0x67, 0x87, 0x91, 0x9c, 0x70, 0x54, 0xf7, 0xf6, 0xa6, 0xa8, 
-	0xdc, 0xbe, 0x53, 0x2f, 0x6c, 0x6d, 0x3f, 0xd2, 0xa4, 0xb5, 0x43, 0x19, 0x23, 
-	0x70, 0x74, 0xee, 0x47, 0x51, 0xf5, 0x15, 0x94, 0xb6, 0x3b, 0x69, 0xab, 0x4f, 
-	0xc8, 0x86, 0x26, 0x48, 0xdf, 0xca, 0x6c, 0x98, 0x98, 0xe0, 0x67, 0xb7, 0xb7, 
-	0xe1, 0x4d, 0xbc, 0xb5, 0x78, 0xe4, 0xde, 0xa0, 0xb2, 0x37, 0x5f, 0xa5, 0x5c, 
-	0x92, 0x14, 0x90, 0x10, 0x39, 0xc , 0x79, 0xa6, 0xdb, 0x4a, 0xe8, 0xbf, 0x65, 
-	0x99, 0x8e, 0xdc, 0xfc, 0x8d, 0x44, 0x66, 0xe2, 0x5d, 0x5c, 0x3c, 0x6a, 0x24, 
-	0x9e, 0xfd, 0x3f, 0xcb, 0xfc, 0x87, 0x68, 0xf1, 0x47, 0x34, 0x7e, 0x5c, 0x89, 
-	0xe6, 0xe , 0x84, 0xf7, 0xc5, 0x25, 0xf5, 0x84, 0x91, 0x5f, 0x79, 0x6c, 0x3e, 
-	0xf0, 0xfd, 0xd4, 0x98, 0xea, 0x2a, 0xcc, 0x70, 0x2c, 0x33, 0xab, 0xa6, 0x42, 
-	0x31, 0xce, 0x7 , 0x63, 0xdf, 0xf0, 0x35, 0xb1, 0xe5, 0xae, 0xa3, 0xa7, 0xf9, 
-	0x6a, 0x40, 0xb8, 0x88, 0x96, 0x89, 0x87, 0xf1, 0x7b, 0x56, 0xb1, 0xa8, 0x8e, 
-	0x2a, 0x98, 0x59, 0x5f, 0x55, 0xaa, 0x32, 0xac, 0xe1, 0xd , 0x6e, 0xa9, 0x2a, 
-	0xc , 0x9e, 0x83, 0xd0, 0xd3, 0xd6, 0x24, 0x1d, 0x54, 0x71, 0xfc, 0xea, 0x75, 
-	0x40, 0x4b, 0x2f, 0xcb, 0xf3, 0x1c, 0xe0, 0x1e, 0x8d, 0xdc, 0x52, 0x11, 0x91, 
-	0x93, 0x5d, 0x98, 0x79, 0xc6, 0x51, 0xd5, 0x6a, 0x78, 0x39, 0x9e, 0x1a, 0xad, 
-	0x2a, 0x97, 0x8c, 0x9f, 0x2b, 0xf3, 0xfb, 0xc7, 0x2c, 0x11, 0xed, 0x3f, 0x2d, 
-	0xb , 0x1c, 0x61, 0x88, 0xb , 0x4d, 0x8d, 0xdb, 0x81, 0xd3, 0x1d, 0xcd, 0x49, 
-	0xc9, 0x6c, 0xf3, 0xf5, 0xc5, 0x7a, 0x51, 0xe5, 0x6b, 0x63, 0xe5, 0x6a, 0xfb, 
-	0x48, 0xc9, 0xa7, 0x2b, 0x8a, 0xc0, 0x7b, 0xd2, 0x22, 0xe3, 0xf2, 0xa5, 0x2 , 
-	0x8e, 0x9c, 0xd6, 0x96, 0x39, 0xb9, 0x84, 0x61, 0x9e, 0x29, 0x47, 0xd6, 0x96, 
-	0x8f, 0xc2, 0x99, 0x2 , 0x74, 0x14, 0x66, 0x86, 0xfa, 0x52, 0x50, 0x1 , 0x46, 
-	0x68, 0xa4, 0x6a, 0x0 , 0x4a, 0x28, 0xa2, 0x80, 0x10, 0x9a, 0x4a, 0x28, 0xa0, 
-	0x2 , 0x8f, 0xc6, 0x8f, 0xc2, 0x8f, 0xc2, 0x80, 0x13, 0xf1, 0xa4, 0x34, 0x51, 
-	0x40, 0x5 , 0x35, 0xbd, 0x69, 0x5a, 0x92, 0x80, 0x3 , 0x4d, 0xa7, 0x1a, 0x6d, 
-	0x0 , 0x14, 0x7e, 0x34, 0x51, 0xf8, 0x50, 0x1 , 0xf8, 0xd3, 0x5a, 0x94, 0xfd, 
-	0x29, 0x28, 0x1 , 0x1a, 0x92, 0x95, 0xa9, 0x28, 0x0 , 0xa6, 0x9a, 0x56, 0xa4, 
-	0xa6, 0x80, 0x28, 0xfc, 0x68, 0xfc, 0x28, 0xfc, 0x29, 0x80, 0x86, 0x92, 0x8a, 
-	0x28, 0x1 , 0xb4, 0x51, 0x45, 0x0 , 0x36, 0x8a, 0x28, 0xa0, 0x3 , 0xf1, 0xa4, 
-	0xcf, 0xbd, 0x2f, 0xe1, 0x4d, 0x34, 0x0 , 0x52, 0x35, 0x2d, 0x23, 0x50, 0x2 , 
-	0x52, 0x35, 0x29, 0xa6, 0xd0, 0x4 , 0xd4, 0xa0, 0xd2, 0x51, 0x54, 0x3 , 0xa9, 
-	0x56, 0x92, 0x95, 0x68, 0x1 , 0x45, 0x2f, 0xe3, 0x48, 0x29, 0x7f, 0xa , 0x0 , 
-	0x5a, 0x28, 0xfc, 0x28, 0xa0, 0x7 , 0x52, 0x83, 0x49, 0x45, 0x0 , 0x3a, 0x95, 
-	0x7e, 0xb4, 0x94, 0xab, 0xf4, 0xa9, 0x1 , 0x7f, 0x1a, 0x28, 0xfc, 0x28, 0xa0, 
-	0x5 , 0x5a, 0x5a, 0x45, 0xa5, 0xa0, 0x7 , 0x51, 0x45, 0x14, 0x0 , 0xef, 0xc6, 
-	0x8f, 0xc6, 0x8f, 0xc2, 0x8f, 0xc2, 0x80, 0xa , 0x70, 0xa6, 0xd1, 0x9a, 0x0 , 
-	0x75, 0x28, 0x34, 0x94, 0xa0, 0x50, 0x2 , 0x8a, 0x5f, 0xc6, 0x92, 0x8a, 0x0 , 
-	0x77, 0xe3, 0x45, 0x1f, 0x85, 0x1f, 0x85, 0x0 , 0x14, 0xa0, 0xd2, 0x51, 0x4a, 
-	0xc0, 0x3a, 0x8c, 0xd1, 0x45, 0x20, 0x1d, 0x48, 0xc7, 0x3 , 0xfa, 0x52, 0xd3, 
-	0x4f, 0xfa, 0xcf, 0xa0, 0xa0, 0x5 , 0x55, 0xda, 0x30, 0x3a, 0xe6, 0xaa, 0x5c, 
-	0x9c, 0x58, 0xbb, 0xe7, 0x99, 0x5f, 0x8f, 0xa0, 0xe9, 0xfa, 0xc , 0xfe, 0x35, 
-	0x66, 0xe0, 0x91, 0xb , 0x11, 0xd7, 0x1c, 0x7d, 0x6a, 0x3b, 0xa8, 0xb3, 0x14, 
-	0x71, 0xa8, 0xfb, 0xac, 0x3f, 0x96, 0x28, 0x29, 0x32, 0x6b, 0x75, 0x11, 0xdb, 
-	0xc6, 0x83, 0xf8, 0x54, 0xa , 0x76, 0x7 , 0x1e, 0xd4, 0xbf, 0x85, 0x1f, 0x85, 
-	0x4 , 0x87, 0x6a, 0x28, 0xa3, 0x3e, 0xd4, 0x0 , 0x3 , 0x8a, 0xad, 0x2b, 0xf , 
-	0x99, 0xd8, 0xfc, 0xb1, 0xf1, 0x8f, 0xef, 0x37, 0xa5, 0x4d, 0x34, 0x9b, 0x14, 
-	0x90, 0xa7, 0x3d, 0xb9, 0xef, 0x54, 0xee, 0x5d, 0x90, 0xaa, 0x94, 0xdc, 0xb0, 
-	0xae, 0xe2, 0xbb, 0xba, 0xb7, 0xbd, 0x6 , 0x91, 0x8d, 0xce, 0x6b, 0x52, 0x62, 
-	0xfe, 0x20, 0x67, 0x2c, 0x70, 0xaa, 0x55, 0x9 , 0xf6, 0xef, 0xf9, 0xd6, 0x6c, 
-	0xf3, 0x63, 0x74, 0xa7, 0xae, 0x76, 0xa0, 0xf4, 0x2 , 0xb4, 0x75, 0x6c, 0xfd, 
-	0xa1, 0xd8, 0x9c, 0x9c, 0x6d, 0x66, 0xf7, 0x1c, 0x9c, 0x7e, 0x26, 0xb1, 0x2e, 
-	0xe6, 0x3c, 0x2f, 0x3 , 0xae, 0x6b, 0x96, 0x6e, 0xc7, 0xa9, 0x46, 0x17, 0x5a, 
-	0x90, 0xed, 0x39, 0x2c, 0xc7, 0x6e, 0x7a, 0x93, 0x48, 0xcc, 0xab, 0xf7, 0x46, 
-	0xe6, 0xf5, 0x3d, 0x5 , 0x23, 0x86, 0x68, 0xfc, 0xc3, 0xc8, 0xce, 0x6 , 0x7d, 
-	0x7a, 0xd4, 0x67, 0xe6, 0x6c, 0x67, 0xeb, 0x59, 0x5a, 0xfb, 0x9d, 0x1c, 0xe9, 
-	0x7c, 0x21, 0x23, 0x17, 0x39, 0x27, 0xf1, 0x34, 0xd2, 0x9 , 0xe1, 0x69, 0x5b, 
-	0xee, 0x81, 0x8a, 0x92, 0x14, 0xe3, 0x27, 0x3f, 0x85, 0x59, 0x93, 0xbb, 0x21, 
-	0xdb, 0xd8, 0x7e, 0x7e, 0x94, 0x99, 0x0 , 0x63, 0xb7, 0xf3, 0xa9, 0x2e, 0x89, 
-	0xf3, 0x4a, 0xe0, 0xf , 0x50, 0x3b, 0x54, 0x2c, 0x9 , 0xa0, 0x86, 0xfb, 0xd , 
-	0x6e, 0x79, 0xfc, 0xa8, 0x1c, 0x7d, 0x69, 0x4f, 0x1c, 0xa , 0x41, 0xd7, 0x14, 
-	0xf7, 0x33, 0x7a, 0x3 , 0x70, 0xbe, 0xf4, 0xda, 0x77, 0xde, 0x62, 0x68, 0xc6, 
-	0x6a, 0x91, 0x1b, 0x82, 0x8a, 0x31, 0x9a, 0x5e, 0xd4, 0x74, 0x5a, 0x4d, 0x94, 
-	0x92, 0x12, 0x43, 0xc6, 0x29, 0x8b, 0xcd, 0x2c, 0x9c, 0x1f, 0xe7, 0x48, 0xa2, 
-	0x83, 0x36, 0xee, 0xc4, 0x6f, 0x5a, 0x78, 0xe1, 0x45, 0x37, 0xd0, 0x53, 0x9b, 
-	0xa7, 0xf2, 0xa5, 0xb0, 0xe2, 0x36, 0x91, 0xbb, 0x52, 0xfb, 0x52, 0x37, 0xf5, 
-	0xa6, 0x4b, 0x11, 0xfe, 0xe1, 0xfa, 0xd4, 0x7d, 0x6a, 0x46, 0xfb, 0xbf, 0xad, 
-	0x46, 0xbf, 0x4a, 0x68, 0xc2, 0x7b, 0x89, 0x57, 0x34, 0x5b, 0xf9, 0x34, 0xeb, 
-	0xd5, 0x9d, 0x32, 0x57, 0xa3, 0xaf, 0xf7, 0x85, 0x55, 0x64, 0x60, 0x9b, 0xf1, 
-	0xf2, 0xe7, 0x19, 0xa6, 0xd3, 0xd8, 0x83, 0xd3, 0x2c, 0xa7, 0x8e, 0xe2, 0xdd, 
-	0x26, 0x89, 0xc3, 0x23, 0x8c, 0xa9, 0xab, 0xa , 0x9 , 0xe6, 0xb8, 0x5f, 0xa , 
-	0xea, 0xcd, 0x61, 0x2f, 0x95, 0x29, 0x26, 0xdd, 0xcf, 0x3f, 0xec, 0x9f, 0x51, 
-	0x5d, 0xb4, 0x32, 0xab, 0xa0, 0x65, 0x6d, 0xca, 0xc3, 0x20, 0x8e, 0xf5, 0xd5, 
-	0x19, 0x73, 0x23, 0x68, 0xca, 0xe4, 0xdd, 0x69, 0x8d, 0xc1, 0xa5, 0xdd, 0xe9, 
-	0x48, 0xdc, 0xf3, 0x54, 0x32, 0x26, 0x51, 0x42, 0x8e, 0xe2, 0x95, 0x94, 0xff, 
-	0x0 , 0xf5, 0xe9, 0x70, 0x47, 0x5a, 0x48, 0x64, 0x91, 0xf1, 0x49, 0x3c, 0x6b, 
-	0x2a, 0x61, 0xa8, 0x53, 0xed, 0x4b, 0x91, 0xe9, 0x4c, 0xc , 0x8b, 0xdb, 0x36, 
-	0xc , 0x46, 0x38, 0xed, 0x54, 0x5a, 0x33, 0xc , 0xc0, 0xe3, 0xf0, 0xae, 0x8a, 
-	0x5c, 0x30, 0xc1, 0xe7, 0xfa, 0x55, 0xb , 0xa8, 0x7 , 0xa6, 0x41, 0xf4, 0xa9, 
-	0x71, 0x36, 0xa7, 0x52, 0xc4, 0xda, 0x25, 0xcc, 0x41, 0x70, 0xeb, 0x5d, 0x4e, 
-	0x8d, 0x75, 0x6e, 0xb2, 0x2b, 0x82, 0x6 , 0xe , 0x2b, 0x87, 0xf2, 0x99, 0x1b, 
-	0x31, 0xb6, 0x3d, 0xaa, 0xe5, 0x9d, 0xf5, 0xc4, 0x27, 0xc , 0x37, 0xa , 0xe4, 
-	0xab, 0x49, 0x35, 0xb1, 0xec, 0x61, 0xb1, 0x96, 0x56, 0x67, 0xac, 0xf8, 0x6f, 
-	0x59, 0x82, 0xca, 0x8 , 0xc2, 0xc3, 0x1b, 0x6d, 0xfb, 0xd9, 0x88, 0x36, 0x46, 
-	0xe0, 0x7d, 0x38, 0xe8, 0x2a, 0xde, 0xa5, 0xe2, 0x28, 0xa7, 0xf1, 0x55, 0xee, 
-	0xad, 0x15, 0x94, 0x31, 0xad, 0xd4, 0xee, 0xeb, 0x9 , 0x8d, 0x76, 0xa0, 0x20, 
-	0x80, 0x7 , 0x1d, 0xb2, 0x3f, 0x2a, 0xf3, 0x2b, 0x1d, 0x60, 0x86, 0x19, 0x46, 
-	0xfc, 0xd , 0x6a, 0x45, 0xa8, 0x17, 0xfb, 0x88, 0x7f, 0x2a, 0xf3, 0xe5, 0x9 , 
-	0xad, 0xf , 0x56, 0x9e, 0x22, 0x8b, 0x77, 0xea, 0x7a, 0x63, 0xfc, 0x49, 0xf1, 
-	0x12, 0xde, 0xb5, 0xd5, 0xa6, 0xa2, 0xba, 0x74, 0x8d, 0x12, 0x46, 0xe6, 0xca, 
-	0x31, 0x1e, 0x42, 0xae, 0xde, 0x8b, 0x8e, 0xdd, 0x6b, 0x9d, 0xbe, 0xd6, 0xae, 
-	0xef, 0xbe, 0x6b, 0xab, 0x89, 0xee, 0x49, 0x6e, 0x5a, 0x69, 0x9 , 0xac, 0xb , 
-	0x57, 0x9a, 0x7e, 0x2 , 0xe0, 0x55, 0xeb, 0x77, 0xb2, 0xb6, 0xe6, 0xee, 0xe9, 
-	0x7a, 0xf0, 0xa0, 0xe4, 0xd6, 0x72, 0x53, 0x96, 0xec, 0xd2, 0x35, 0xe9, 0x43, 
-	0xe0, 0x49, 0x17, 0xac, 0x60, 0xb8, 0xbc, 0x90, 0x67, 0x3b, 0x73, 0x5d, 0xaf, 
-	0x85, 0x74, 0xf8, 0xd5, 0x94, 0x81, 0x95, 0x1d, 0x4f, 0xad, 0x72, 0xfa, 0x1d, 
-	0xef, 0xda, 0xdd, 0x52, 0xde, 0x2f, 0x2e, 0x2f, 0x53, 0xd4, 0xd7, 0x6f, 0xa1, 
-	0x80, 0x91, 0xaa, 0x8e, 0x2a, 0x25, 0xa1, 0xcd, 0x53, 0x13, 0xcf, 0xa2, 0x3a, 
-	0x48, 0x64, 0xc2, 0xaa, 0x83, 0x81, 0x8e, 0x5 , 0x17, 0x24, 0x6d, 0xc0, 0x23, 
-	0xd2, 0xab, 0x6f, 0xdb, 0x18, 0x0 , 0xf5, 0x14, 0x93, 0x3e, 0x21, 0xc6, 0x46, 
-	0x71, 0xd6, 0xb9, 0xed, 0xa9, 0x91, 0x42, 0xf2, 0x8 , 0xda, 0x4c, 0x96, 0x1d, 
-	0x71, 0xd3, 0xad, 0x51, 0xb8, 0x8c, 0xa0, 0x23, 0xa8, 0xc5, 0x5c, 0x9e, 0x45, 
-	0x8d, 0xb2, 0x7f, 0x33, 0x59, 0x57, 0xd7, 0x25, 0x99, 0xb6, 0xed, 0xe4, 0x7a, 
-	0xe2, 0xad, 0x18, 0xc8, 0xa1, 0x70, 0x8 , 0xcf, 0x39, 0xf7, 0x1d, 0xeb, 0x7 , 
-	0xc5, 0x9a, 0xdd, 0xbe, 0x8d, 0xa4, 0xcb, 0x77, 0x37, 0x25, 0x46, 0x11, 0x1 , 
-	0xe5, 0xdb, 0xb0, 0x15, 0xa5, 0xad, 0x6a, 0x10, 0x5a, 0xdb, 0x3c, 0xb2, 0xc8, 
-	0xaa, 0xaa, 0xb , 0x31, 0x27, 0xa0, 0x15, 0xe4, 0x1e, 0x2e, 0xd6, 0xbf, 0xb6, 
-	0xb5, 0x6 , 0x9a, 0x47, 0x22, 0xde, 0x1c, 0x88, 0x50, 0x1f, 0xfc, 0x78, 0x8f, 
-	0x5a, 0xeb, 0xa3, 0x49, 0xd4, 0x7e, 0x47, 0xe , 0x27, 0x10, 0xa9, 0x47, 0xcc, 
-	0xe7, 0xb5, 0x7b, 0xa9, 0x35, 0x1d, 0x4a, 0x6b, 0xfb, 0xd6, 0x69, 0x2e, 0x27, 
-	0x6d, 0xc4, 0x31, 0xe0, 0xe , 0xd8, 0xf6, 0x3 , 0x18, 0xac, 0x39, 0xe7, 0xdc, 
-	0xcc, 0xab, 0x9e, 0x9 , 0x24, 0x9e, 0xb5, 0xb7, 0xe2, 0x2f, 0xb3, 0xac, 0x23, 
-	0xcb, 0x4c, 0x49, 0x9d, 0xc5, 0x89, 0xf5, 0x1d, 0x2b, 0x2 , 0xda, 0xde, 0x5b, 
-	0x8b, 0xc5, 0x44, 0xef, 0xc9, 0x3f, 0xdd, 0x1e, 0xb5, 0xe9, 0xbb, 0x45, 0x58, 
-	0xf1, 0xa1, 0x19, 0x54, 0x95, 0x96, 0xad, 0x8b, 0x1c, 0x46, 0x43, 0xbb, 0x9d, 
-	0xa3, 0x92, 0x2a, 0xb5, 0xf0, 0xc3, 0x64, 0xfa, 0xd6, 0xdc, 0xd0, 0xac, 0x30, 
-	0xf9, 0x49, 0xd0, 0x77, 0x3d, 0xeb, 0x1f, 0x54, 0x5e, 0x9f, 0x5a, 0xc7, 0x9a, 
-	0xec, 0xf5, 0x6b, 0x61, 0x3d, 0x85, 0xb , 0x75, 0xea, 0x55, 0x1e, 0x94, 0xd6, 
-	0x14, 0xbd, 0x68, 0xc7, 0x6a, 0xb3, 0xcd, 0x1b, 0x45, 0x2a, 0xd0, 0xd4, 0x13, 
-	0x61, 0x57, 0xef, 0xa , 0x91, 0x4f, 0xcc, 0x3e, 0xa2, 0xa3, 0x8f, 0x25, 0xb1, 
-	0x52, 0xa8, 0xe4, 0xe3, 0xb5, 0x26, 0x69, 0x4d, 0xa , 0x3b, 0xfb, 0xd5, 0x88, 
-	0xc1, 0xfd, 0xe0, 0xee, 0x6 , 0x6a, 0x28, 0x46, 0x10, 0xc8, 0xc3, 0xfd, 0xd1, 
-	0xeb, 0x52, 0xc6, 0x48, 0x8a, 0x66, 0xee, 0x4e, 0x3f, 0x5a, 0xce, 0x47, 0x6d, 
-	0x18, 0xdb, 0x5f, 0xeb, 0xa9, 0x24, 0x7f, 0x32, 0xe4, 0x1f, 0xad, 0x49, 0xb3, 
-	0xb8, 0xa8, 0x61, 0x70, 0x1b, 0x77, 0xf0, 0xb7, 0xe9, 0x56, 0xb6, 0x8e, 0xc7, 
-	0x83, 0xd0, 0xd6, 0x32, 0xd0, 0xf4, 0x28, 0xa5, 0x38, 0x8f, 0x84, 0xe5, 0x6a, 
-	0xcc, 0x44, 0xfe, 0x3e, 0xdd, 0xea, 0xb2, 0x8d, 0xad, 0xc8, 0xf6, 0x61, 0x52, 
-	0xa1, 0x28, 0x40, 0xc6, 0x47, 0x63, 0x58, 0xc8, 0xf4, 0x69, 0xf9, 0x9a, 0x16, 
-	0x72, 0x29, 0x7d, 0x8e, 0xdb, 0x55, 0xbf, 0x4a, 0x7d, 0xc9, 0x36, 0xd3, 0x72, 
-	0x9 , 0x1d, 0x37, 0x1 , 0xc7, 0xff, 0x0 , 0x5e, 0xab, 0x32, 0xb7, 0x97, 0xbd, 
-	0x3f, 0x11, 0xed, 0x56, 0x2d, 0xe5, 0xf3, 0xa1, 0xd8, 0xc7, 0x71, 0x1d, 0x41, 
-	0xac, 0x1a, 0xb3, 0xb9, 0xe8, 0xc2, 0x6d, 0xae, 0x57, 0xbf, 0x46, 0x5f, 0xb3, 
-	0x78, 0xe4, 0x5d, 0xbb, 0x83, 0x7a, 0xc , 0xff, 0x0 , 0x2a, 0x95, 0x94, 0xa3, 
-	0x6e, 0xe5, 0x97, 0x3c, 0x11, 0xf7, 0x87, 0xd7, 0xd6, 0xb3, 0xa1, 0x8c, 0x1e, 
-	0x63, 0x18, 0x61, 0xd8, 0xf5, 0x6 , 0xae, 0xd8, 0xdc, 0xfc, 0xde, 0x54, 0x9f, 
-	0x2c, 0x84, 0x70, 0x3d, 0x6b, 0x9 , 0xab, 0x6a, 0x8f, 0x52, 0x8c, 0x95, 0x44, 
-	0x94, 0xf4, 0x7d, 0x19, 0x66, 0x19, 0x22, 0x20, 0xef, 0xfb, 0xb9, 0xe2, 0x41, 
-	0xdb, 0xeb, 0x49, 0x75, 0x11, 0x64, 0x60, 0x59, 0x5d, 0x4f, 0x42, 0x29, 0x3c, 
-	0x9c, 0xfc, 0xd1, 0x8e, 0x4f, 0x51, 0x8e, 0xf , 0xd6, 0x9f, 0x1c, 0x27, 0x66, 
-	0x55, 0xf6, 0xb7, 0xf7, 0x5b, 0x90, 0x7e, 0x9f, 0xfd, 0x7a, 0x95, 0x6e, 0x86, 
-	0xad, 0x4e, 0xdc, 0xb3, 0x44, 0x11, 0xb4, 0x90, 0x2e, 0xc9, 0x77, 0x18, 0xd8, 
-	0x70, 0xe3, 0xb7, 0xd7, 0xd2, 0xb4, 0x74, 0xdb, 0x97, 0x56, 0xc , 0xae, 0x32, 
-	0x30, 0x41, 0x4 , 0x75, 0xa4, 0xb7, 0xc6, 0x2 , 0xc9, 0x16, 0x3d, 0x4e, 0x72, 
-	0x29, 0x97, 0x16, 0x90, 0x6 , 0xcc, 0x59, 0x50, 0x7b, 0xa1, 0xa6, 0x27, 0xb2, 
-	0xbf, 0xfc, 0x1f, 0xf8, 0x26, 0xb6, 0xa6, 0x12, 0x45, 0x82, 0xfa, 0xdc, 0x5 , 
-	0x12, 0x0 , 0x26, 0x51, 0xd9, 0xfd, 0x7f, 0x1f, 0xf3, 0xd2, 0xab, 0xc9, 0xcf, 
-	0x21, 0x4f, 0x3e, 0xdd, 0xfd, 0x2a, 0x2b, 0x58, 0xa3, 0x59, 0x15, 0x25, 0x92, 
-	0x4d, 0x8e, 0x39, 0xe7, 0x1f, 0x8d, 0x2c, 0xd0, 0x79, 0x4c, 0x55, 0xcb, 0x31, 
-	0x5e, 0x84, 0xb1, 0x20, 0x8f, 0xf3, 0xcd, 0x6f, 0x41, 0xc9, 0x4e, 0xc8, 0xf3, 
-	0xf3, 0x18, 0x51, 0x74, 0x39, 0x9d, 0xf4, 0x7f, 0x98, 0xd6, 0x97, 0x63, 0x64, 
-	0x6d, 0x19, 0x1c, 0xd3, 0x83, 0xbb, 0xe3, 0x1f, 0xca, 0x9b, 0xb5, 0x15, 0xb2, 
-	0x0 , 0xc1, 0xf4, 0xa9, 0x17, 0xd4, 0x7f, 0x2a, 0xf6, 0x68, 0xa7, 0x6d, 0x59, 
-	0xf0, 0x58, 0xf9, 0x41, 0x4a, 0xf1, 0x88, 0xe5, 0x6 , 0x9d, 0xc5, 0x20, 0x3c, 
-	0xf5, 0xa3, 0xf0, 0xae, 0x93, 0xca, 0x77, 0x17, 0xf1, 0xa3, 0xf1, 0xa6, 0x83, 
-	0x9a, 0x5f, 0xc2, 0x99, 0x22, 0x51, 0x45, 0x14, 0x0 , 0xdc, 0x52, 0x83, 0x49, 
-	0x9a, 0x28, 0x0 , 0xa4, 0x6a, 0x53, 0x4d, 0xa0, 0x2 , 0x8a, 0x28, 0xfc, 0x28, 
-	0x0 , 0xfc, 0x68, 0xfc, 0x68, 0xfc, 0x29, 0xf , 0xd2, 0x80, 0x12, 0x8a, 0x29, 
-	0x9 , 0xa0, 0x4 , 0xa3, 0x34, 0x52, 0x35, 0x0 , 0x4 , 0xd2, 0x51, 0x45, 0x0 , 
-	0x1f, 0x8d, 0x1f, 0x8d, 0x1f, 0x85, 0x21, 0xfa, 0x50, 0x0 , 0x69, 0x28, 0xa4, 
-	0x26, 0x80, 0x2 , 0x69, 0x28, 0xa4, 0x26, 0x98, 0x1 , 0x34, 0x94, 0x51, 0x4c, 
-	0x3 , 0xf1, 0xa4, 0xcf, 0xbd, 0x2f, 0xe1, 0x4d, 0x34, 0x0 , 0x52, 0x35, 0x29, 
-	0xa6, 0xd0, 0x1 , 0x48, 0xd4, 0xa6, 0x9b, 0x40, 0x5 , 0x1f, 0x8d, 0x14, 0x7e, 
-	0x14, 0x0 , 0x87, 0xeb, 0x49, 0x4a, 0x7e, 0x94, 0x94, 0x0 , 0x8d, 0x49, 0x46, 
-	0x68, 0xa0, 0x4 , 0x6a, 0x4a, 0x33, 0x45, 0x0 , 0x4d, 0xf8, 0xd1, 0x47, 0xe1, 
-	0x45, 0x50, 0xe , 0xa2, 0x90, 0x1a, 0x5a, 0x0 , 0x75, 0x2a, 0xfd, 0x69, 0x28, 
-	0xa0, 0x7 , 0x7e, 0x34, 0x51, 0xf8, 0x51, 0x40, 0xe , 0xcd, 0x14, 0x8b, 0x4b, 
-	0x40, 0xe , 0xa2, 0x90, 0x1a, 0x5a, 0x0 , 0x77, 0xe3, 0x47, 0xe3, 0x47, 0xe1, 
-	0x47, 0xe1, 0x48, 0x2 , 0x95, 0x69, 0x29, 0x56, 0x90, 0xa , 0x29, 0xd4, 0xda, 
-	0x55, 0xa0, 0x7 , 0x67, 0xde, 0x97, 0xf1, 0xa6, 0xd2, 0x8f, 0xa5, 0x0 , 0x2d, 
-	0x14, 0x7e, 0x14, 0x50, 0x3 , 0xa8, 0xa0, 0xd0, 0x28, 0x1 , 0xd9, 0xa5, 0x14, 
-	0xd5, 0xa5, 0xa0, 0x7 , 0x7e, 0x34, 0x7e, 0x34, 0x83, 0xe9, 0x4b, 0xf8, 0x50, 
-	0x1 , 0x45, 0x14, 0x50, 0x2 , 0xad, 0x2d, 0x36, 0x9c, 0x29, 0x0 , 0xa , 0x14, 
-	0x1e, 0x4f, 0xa9, 0xa2, 0x8c, 0xd2, 0x0 , 0x75, 0xdc, 0x31, 0x9e, 0xe0, 0xfe, 
-	0xb4, 0xea, 0x28, 0xa0, 0x7 , 0x7e, 0x34, 0x7e, 0x34, 0x83, 0xe9, 0x4b, 0xf8, 
-	0x50, 0x1 , 0x47, 0xe3, 0x8f, 0xc2, 0x85, 0xa6, 0xbb, 0x0 , 0x3e, 0x63, 0xf9, 
-	0x50, 0x4 , 0x73, 0xe4, 0x48, 0xb9, 0x62, 0x79, 0x39, 0xec, 0x7 , 0x15, 0x97, 
-	0xaa, 0x4e, 0x22, 0x8e, 0x55, 0x8c, 0x6e, 0x90, 0xf2, 0xe4, 0xf4, 0x50, 0x3f, 
-	0xcf, 0x4a, 0xb1, 0x7d, 0x7b, 0x1a, 0x3 , 0x82, 0x10, 0x1 , 0xd7, 0xfc, 0x2b, 
-	0xe , 0xf8, 0xdc, 0xde, 0x6c, 0x8a, 0x38, 0xfc, 0x98, 0x24, 0x93, 0x69, 0x66, 
-	0x5f, 0xbd, 0x9e, 0x73, 0x8e, 0xa7, 0xa5, 0x4c, 0x8e, 0x8a, 0x71, 0xee, 0x66, 
-	0xeb, 0x77, 0x48, 0x8a, 0x20, 0x85, 0x83, 0xb0, 0x0 , 0x33, 0x7b, 0xe7, 0x27, 
-	0xf5, 0xcd, 0x63, 0x48, 0xa7, 0x7e, 0xdc, 0xf3, 0xdc, 0xfb, 0xd6, 0xde, 0xab, 
-	0x1c, 0x76, 0xcc, 0xb1, 0x22, 0x8f, 0xba, 0x5d, 0xc9, 0xea, 0x7b, 0x8a, 0xc6, 
-	0x62, 0xaf, 0x22, 0x82, 0x4e, 0x32, 0x49, 0xae, 0x79, 0xee, 0x7a, 0x34, 0xdf, 
-	0xb8, 0x24, 0xcf, 0xbb, 0xa , 0xbb, 0x78, 0xf4, 0xa6, 0xa8, 0xec, 0x29, 0x8 , 
-	0xcb, 0x71, 0x52, 0x27, 0x1d, 0xbe, 0x66, 0xe0, 0x54, 0x17, 0xb2, 0x5 , 0x5f, 
-	0x32, 0x45, 0x8d, 0x3b, 0x9c, 0xf , 0x73, 0x56, 0x96, 0xdc, 0x73, 0x12, 0x30, 
-	0x66, 0xc0, 0x3b, 0xbd, 0x3a, 0xff, 0x0 , 0x8d, 0x37, 0x4f, 0x8b, 0x74, 0x86, 
-	0x40, 0xe , 0x47, 0xcb, 0x18, 0xec, 0x4f, 0x4e, 0xb5, 0x36, 0xa4, 0x4 , 0x78, 
-	0x8e, 0x13, 0xf3, 0x1 , 0xf3, 0xb0, 0xfa, 0x91, 0xfe, 0x35, 0x46, 0x2e, 0x57, 
-	0x76, 0x46, 0x65, 0xd3, 0x17, 0x93, 0x9f, 0xe1, 0x18, 0xe9, 0x51, 0x67, 0x26, 
-	0x9f, 0x70, 0x73, 0xdf, 0xad, 0x44, 0xc7, 0x3 , 0x14, 0x81, 0xbb, 0x8 , 0x72, 
-	0xbf, 0x8f, 0x4a, 0x3d, 0xa9, 0xcb, 0xf3, 0x7e, 0x1d, 0x29, 0xa3, 0x3e, 0x9c, 
-	0xd3, 0x21, 0x87, 0x4e, 0x29, 0x54, 0x52, 0xa8, 0xf5, 0xa0, 0xd3, 0x1c, 0x57, 
-	0x50, 0x3e, 0xff, 0x0 , 0x85, 0x2c, 0x63, 0x77, 0x39, 0xe0, 0x75, 0xfa, 0x53, 
-	0x73, 0x9e, 0x5 , 0xe , 0xd8, 0x8c, 0xa0, 0x3f, 0x29, 0x3c, 0xd2, 0x44, 0xce, 
-	0x43, 0x26, 0x20, 0xbe, 0x17, 0xee, 0x8a, 0x17, 0x85, 0xa6, 0xa8, 0xe6, 0x9f, 
-	0xec, 0x28, 0x66, 0x71, 0xee, 0x27, 0xf1, 0x66, 0x9c, 0xd4, 0x8b, 0xf7, 0xa9, 
-	0x48, 0xc9, 0xa4, 0x69, 0xd0, 0x69, 0xe5, 0xbf, 0x1a, 0x6b, 0x73, 0x8f, 0x7a, 
-	0x77, 0xa9, 0xa6, 0xb7, 0xf2, 0x35, 0x46, 0x72, 0x1a, 0xe6, 0x9a, 0xdd, 0xa9, 
-	0x4f, 0xf4, 0xa5, 0xc6, 0x56, 0x9a, 0x31, 0x96, 0xa3, 0xd5, 0x1a, 0x48, 0x9b, 
-	0x1c, 0xed, 0x19, 0xa8, 0x48, 0xf7, 0xab, 0x9a, 0x5c, 0x9e, 0x5c, 0xc0, 0xed, 
-	0x5e, 0x4f, 0x3b, 0x87, 0x14, 0xfd, 0x52, 0xc5, 0x60, 0x75, 0x78, 0x9b, 0x74, 
-	0x6e, 0xb9, 0x4 , 0x8e, 0xfd, 0xc5, 0x6b, 0xcb, 0x75, 0x74, 0x63, 0x7d, 0x4a, 
-	0x70, 0x9f, 0xe7, 0x5d, 0x7 , 0x86, 0xb5, 0x66, 0xb6, 0x61, 0x6f, 0x3b, 0x66, 
-	0x13, 0xf7, 0x49, 0xfe, 0xf , 0xfe, 0xb5, 0x73, 0xb1, 0x9c, 0x35, 0x5a, 0x85, 
-	0xbd, 0x6a, 0x14, 0x9a, 0x77, 0x34, 0x89, 0xe8, 0x71, 0x48, 0x1d, 0x72, 0xe , 
-	0x41, 0xe8, 0x69, 0xfb, 0xb1, 0xd6, 0xb9, 0x3d, 0x7 , 0x54, 0x6b, 0x66, 0x11, 
-	0x4c, 0x4b, 0x43, 0xd8, 0xf7, 0x5f, 0xfe, 0xb5, 0x74, 0xf0, 0xc8, 0xb2, 0x46, 
-	0x1d, 0x4e, 0xe0, 0x46, 0x41, 0x15, 0xd3, 0x19, 0xa9, 0x23, 0x4b, 0x93, 0x1c, 
-	0x1f, 0x6a, 0x5c, 0xf , 0x4a, 0x61, 0x3c, 0x64, 0x1a, 0x55, 0x18, 0xef, 0xef, 
-	0x54, 0x50, 0x36, 0x71, 0x49, 0x4f, 0xc6, 0x39, 0xc5, 0x26, 0x38, 0xcd, 0x48, 
-	0x11, 0xb0, 0x34, 0xc7, 0x23, 0x18, 0xa9, 0x8e, 0x4f, 0x6a, 0x6b, 0x47, 0x9e, 
-	0xd4, 0x1 , 0x55, 0xd1, 0x7d, 0x2a, 0x3d, 0x98, 0xe9, 0x57, 0xbc, 0x82, 0x69, 
-	0xcb, 0x68, 0x5b, 0xb5, 0x4b, 0x35, 0x8a, 0x95, 0xf4, 0x28, 0xab, 0xca, 0xbf, 
-	0x75, 0x8f, 0xe5, 0x56, 0x23, 0xbb, 0xbc, 0x3 , 0x2 , 0x52, 0x3e, 0x82, 0xaf, 
-	0xda, 0xe9, 0x52, 0xca, 0xe3, 0x8 , 0x4e, 0x6b, 0x7b, 0x47, 0xf0, 0x7c, 0xf7, 
-	0x4 , 0x12, 0x87, 0x9f, 0x41, 0x5c, 0xb5, 0x2a, 0x53, 0x5b, 0x9d, 0x94, 0xe1, 
-	0x53, 0xb9, 0xcd, 0x40, 0xf7, 0xd3, 0x9d, 0xa2, 0x59, 0x5b, 0x3e, 0xf5, 0xbf, 
-	0xe1, 0xfd, 0x15, 0xe4, 0x91, 0x5e, 0x5c, 0x9e, 0x7b, 0xd7, 0x6f, 0xa1, 0xf8, 
-	0xf , 0x6e, 0x19, 0x97, 0xf4, 0xae, 0x8a, 0xc7, 0xc2, 0xc2, 0xdc, 0x0 , 0x57, 
-	0xb7, 0xa5, 0x71, 0xd4, 0xaf, 0x17, 0xb1, 0xd7, 0x1a, 0x72, 0xea, 0xcc, 0x5f, 
-	0xe , 0xda, 0x2d, 0xbc, 0x61, 0x55, 0x70, 0x31, 0xe9, 0x5d, 0x4e, 0x9e, 0x84, 
-	0x72, 0x9 , 0xe4, 0x54, 0x96, 0xba, 0x46, 0xce, 0x4a, 0x8e, 0x3a, 0xc , 0x55, 
-	0xc8, 0xed, 0x4a, 0x73, 0x8c, 0x7a, 0x76, 0xe6, 0xb8, 0xa7, 0x2b, 0x9d, 0x31, 
-	0x8d, 0x85, 0x85, 0xb1, 0xd4, 0x54, 0x77, 0x17, 0x2a, 0x18, 0xe4, 0x73, 0x52, 
-	0x4b, 0x1b, 0x80, 0x71, 0xc7, 0x35, 0x4a, 0xec, 0x6d, 0xc9, 0xcf, 0xe3, 0x50, 
-	0x8a, 0x65, 0x5b, 0xf9, 0x7c, 0xcc, 0xb1, 0x62, 0x7 , 0xa6, 0x6b, 0xb , 0x59, 
-	0xbf, 0x8a, 0x8 , 0x9b, 0x66, 0x31, 0x52, 0x6b, 0xf7, 0xe2, 0x18, 0x58, 0x16, 
-	0x3 , 0x8a, 0xf2, 0x4f, 0x88, 0xde, 0x31, 0x30, 0xdd, 0x2d, 0xa2, 0xab, 0x6d, 
-	0xea, 0xde, 0xae, 0x39, 0xe9, 0x83, 0xc7, 0x41, 0x5d, 0x14, 0xa9, 0xb9, 0xb3, 
-	0x8a, 0xb5, 0x65, 0x4 , 0x5c, 0xf8, 0x85, 0xa9, 0x2e, 0xa5, 0xc , 0xd6, 0xbf, 
-	0x6d, 0x16, 0xcd, 0x1 , 0x57, 0xf2, 0x26, 0xc , 0xbf, 0x69, 0x4 , 0xf1, 0x8e, 
-	0x39, 0x1d, 0x49, 0xe8, 0x3b, 0xe4, 0xd7, 0x25, 0x6e, 0xea, 0xb0, 0x6f, 0x2b, 
-	0xf3, 0x2f, 0xa2, 0xe5, 0x73, 0xf5, 0x3f, 0x4f, 0x4a, 0xe7, 0xed, 0xae, 0x6e, 
-	0xaf, 0xb5, 0x66, 0x9a, 0x49, 0x99, 0xe4, 0xeb, 0x96, 0x3d, 0xbd, 0x2b, 0x4e, 
-	0xe6, 0x76, 0x11, 0x88, 0x81, 0x66, 0x76, 0x38, 0x55, 0x51, 0xc9, 0x3f, 0x4a, 
-	0xf5, 0x29, 0xa5, 0x5 , 0xee, 0x9e, 0x1d, 0x67, 0x2a, 0x93, 0xd7, 0x73, 0x3b, 
-	0x50, 0x32, 0xdc, 0x5f, 0x8 , 0xa2, 0x5 , 0x9e, 0x46, 0xc0, 0x19, 0xc9, 0xcf, 
-	0xbd, 0x69, 0xc3, 0x6a, 0x96, 0x36, 0xbe, 0x42, 0x9c, 0xc8, 0x79, 0x91, 0xbd, 
-	0x4d, 0x59, 0xb3, 0xb5, 0x8b, 0x4e, 0x8f, 0x7b, 0x10, 0xf7, 0xb2, 0xf , 0x9d, 
-	0x87, 0x48, 0x87, 0x65, 0x1e, 0xfe, 0xb5, 0x5e, 0x63, 0x9a, 0xc6, 0xa4, 0xef, 
-	0xa2, 0x3e, 0xa3, 0x2d, 0xcb, 0xd6, 0x1e, 0x1e, 0xd2, 0x6b, 0xdf, 0x7f, 0x81, 
-	0x4e, 0xe0, 0x56, 0x46, 0xac, 0x36, 0x80, 0x7d, 0xeb, 0x66, 0x6a, 0xc8, 0xd7, 
-	0x38, 0x55, 0xff, 0x0 , 0x7a, 0x88, 0xee, 0x67, 0x98, 0xaf, 0xdd, 0x36, 0x50, 
-	0x23, 0xd2, 0x9a, 0xc2, 0x95, 0x68, 0x6a, 0xd4, 0xf9, 0xd1, 0x3d, 0xe8, 0xa1, 
-	0x47, 0x6a, 0x77, 0x4e, 0x9f, 0x8d, 0x30, 0xb0, 0xb1, 0x8f, 0x9a, 0xa5, 0x40, 
-	0xa , 0x16, 0x6f, 0xbb, 0x9c, 0xd3, 0x63, 0x5c, 0xae, 0x4f, 0x4a, 0x2e, 0x1f, 
-	0x76, 0x15, 0x7e, 0xea, 0xf0, 0x5 , 0x46, 0xec, 0xda, 0x36, 0x8c, 0x6e, 0xc7, 
-	0x86, 0x32, 0x48, 0x18, 0xc , 0x7a, 0xa , 0x9e, 0x51, 0xe5, 0xd9, 0xa2, 0xf7, 
-	0x66, 0xc9, 0xfc, 0x29, 0xb6, 0x51, 0x92, 0x37, 0x63, 0xe6, 0xce, 0xd4, 0x1e, 
-	0xb4, 0xeb, 0xe2, 0x3e, 0xd0, 0x11, 0x7e, 0xec, 0x63, 0x1f, 0x85, 0x43, 0xd6, 
-	0x56, 0x3b, 0x23, 0x6 , 0xa9, 0x39, 0xbd, 0xd9, 0x14, 0x24, 0x7d, 0xc6, 0xfe, 
-	0x2e, 0x73, 0xe9, 0x57, 0xac, 0xdc, 0x85, 0xf2, 0xe4, 0xf5, 0xe0, 0xd6, 0x72, 
-	0xfc, 0xdf, 0x30, 0xea, 0xdf, 0x74, 0x55, 0x95, 0x6d, 0xc0, 0x47, 0xbb, 0xc , 
-	0xbd, 0xf , 0xad, 0x29, 0xc6, 0xe5, 0xe1, 0xaa, 0xb8, 0xbb, 0x97, 0xc2, 0xe3, 
-	0xaf, 0xa5, 0x48, 0xa0, 0x15, 0xda, 0x7f, 0xf , 0x6a, 0xaf, 0x6b, 0x28, 0x3f, 
-	0x24, 0x9d, 0x3d, 0x7d, 0x2a, 0xca, 0xaf, 0x6f, 0x5e, 0x86, 0xb9, 0x64, 0xac, 
-	0xcf, 0x76, 0x93, 0x8c, 0xd5, 0xd1, 0x35, 0x8b, 0x8c, 0xf9, 0x6e, 0x7e, 0xef, 
-	0x4c, 0x8e, 0xbe, 0xc6, 0xad, 0x34, 0x20, 0xb6, 0xe4, 0x3b, 0x7e, 0x9e, 0xb5, 
-	0x43, 0x92, 0x76, 0xb7, 0xde, 0x1d, 0xf , 0xad, 0x5e, 0xb5, 0x9f, 0xf7, 0x65, 
-	0x1c, 0xf7, 0xe7, 0xd8, 0x7a, 0xe2, 0xb3, 0x92, 0xb9, 0xd1, 0x4e, 0x7c, 0xba, 
-	0x35, 0xa0, 0xe6, 0x32, 0x24, 0xa2, 0x54, 0x39, 0xfe, 0xf0, 0x3d, 0xea, 0xd4, 
-	0x81, 0x6e, 0x2d, 0x83, 0xa9, 0xc3, 0x1f, 0xb8, 0x7d, 0x48, 0xed, 0xf5, 0xaa, 
-	0xcf, 0x81, 0x2e, 0x1b, 0x95, 0x61, 0xc1, 0xf5, 0xa5, 0x88, 0x88, 0x64, 0xda, 
-	0x5b, 0xf7, 0x6d, 0xc1, 0xf4, 0x7 , 0xd6, 0xb2, 0x7a, 0xfa, 0x9d, 0xd4, 0xe5, 
-	0xcb, 0x7b, 0x7c, 0x2f, 0x72, 0xcd, 0x85, 0xf3, 0xac, 0xde, 0x4d, 0xc0, 0xc7, 
-	0x1f, 0x2b, 0x8e, 0x87, 0xeb, 0x57, 0xe3, 0x97, 0x1c, 0x67, 0x83, 0xdb, 0xb1, 
-	0xac, 0x4d, 0x4b, 0x28, 0x8b, 0xbb, 0xf8, 0x5b, 0x1 , 0x94, 0xf6, 0x3d, 0x3e, 
-	0xb5, 0x2c, 0x12, 0xc8, 0x91, 0xae, 0xe3, 0xf7, 0xba, 0x1c, 0xf0, 0x7f, 0xfa, 
-	0xf5, 0x9c, 0xa9, 0x6d, 0x24, 0x75, 0x52, 0xc6, 0x37, 0x7a, 0x73, 0xd7, 0xcc, 
-	0xd9, 0x86, 0xed, 0x63, 0x75, 0x7 , 0xe5, 0x6f, 0x51, 0xd6, 0xa7, 0xf3, 0x62, 
-	0x90, 0xe0, 0x95, 0xfa, 0x9f, 0x94, 0xfe, 0x62, 0xb1, 0xb7, 0x6f, 0x5e, 0xb9, 
-	0xc7, 0x6e, 0xe2, 0x92, 0xdd, 0xe4, 0x5b, 0x81, 0x90, 0x40, 0x3c, 0x67, 0xd6, 
-	0x85, 0x14, 0xd9, 0x52, 0xa9, 0x28, 0x2d, 0x55, 0xd1, 0xad, 0xe6, 0x30, 0xf9, 
-	0x73, 0x8c, 0x76, 0x7e, 0x98, 0xfa, 0x8c, 0xd4, 0xf0, 0x89, 0x9e, 0x12, 0x5d, 
-	0x59, 0x8c, 0x7c, 0xe4, 0x10, 0x72, 0xbf, 0xfd, 0x6a, 0xc0, 0x92, 0xea, 0x68, 
-	0x2e, 0x33, 0x92, 0x46, 0x9 , 0xc6, 0x71, 0x9c, 0x63, 0x8f, 0xe7, 0x57, 0xb4, 
-	0x7d, 0x41, 0xa4, 0x52, 0xdd, 0xd4, 0xf5, 0xc7, 0x51, 0xfe, 0x4d, 0x68, 0xa9, 
-	0xce, 0x2e, 0xe8, 0xe5, 0x96, 0x26, 0x8d, 0x48, 0xb8, 0xd4, 0xd8, 0xd0, 0x2e, 
-	0x81, 0x78, 0x3e, 0xe0, 0x11, 0x4e, 0x13, 0x20, 0xe4, 0x37, 0xeb, 0x4c, 0x62, 
-	0x37, 0x70, 0x7e, 0x5e, 0xdc, 0xf6, 0xa3, 0x63, 0x15, 0xe4, 0x3 , 0xf5, 0x15, 
-	0xe8, 0x51, 0x9d, 0x5b, 0x5e, 0xe7, 0xcd, 0x63, 0xb0, 0xf8, 0x26, 0xdc, 0x6d, 
-	0xaf, 0x93, 0x7f, 0xa9, 0x28, 0x95, 0x3d, 0x4d, 0x2e, 0xe5, 0x3e, 0xf5, 0x5d, 
-	0x53, 0x7 , 0x94, 0xc7, 0xd3, 0x8a, 0x72, 0xaa, 0x83, 0xff, 0x0 , 0xd9, 0x57, 
-	0x74, 0x67, 0x27, 0xb9, 0xf3, 0xd5, 0x68, 0x52, 0x5f, 0x5 , 0xc9, 0xc3, 0xf , 
-	0xa5, 0x6 , 0x9b, 0xc7, 0x50, 0x3f, 0x3a, 0x55, 0xfa, 0xd6, 0xa8, 0xe1, 0x92, 
-	0x16, 0x8c, 0xd1, 0x48, 0xd4, 0xc9, 0x12, 0x8a, 0x29, 0x9 , 0xa0, 0x0 , 0x9a, 
-	0x4a, 0x28, 0xa0, 0x3 , 0xf1, 0xa3, 0xf1, 0xa3, 0xf0, 0xa3, 0xf0, 0xa0, 0x4 , 
-	0x34, 0x94, 0xa4, 0x52, 0x1a, 0x0 , 0x29, 0xa6, 0x8c, 0xd1, 0x40, 0x5 , 0x34, 
-	0xd2, 0xb5, 0x25, 0x0 , 0x14, 0x7e, 0x34, 0x51, 0xf8, 0x50, 0x2 , 0x7e, 0x34, 
-	0x86, 0x95, 0xbe, 0x94, 0x94, 0x0 , 0x52, 0x35, 0x29, 0xa6, 0xd0, 0x1 , 0x4d, 
-	0x34, 0xad, 0x49, 0x4c, 0x2 , 0x8f, 0xc6, 0x8a, 0x3f, 0xa , 0x60, 0x23, 0x7d, 
-	0x69, 0x28, 0xa2, 0x80, 0x11, 0xa9, 0x28, 0xcd, 0x14, 0x0 , 0x84, 0xd2, 0x51, 
-	0x45, 0x0 , 0x1f, 0x8d, 0x1f, 0x8d, 0x1f, 0x85, 0x1f, 0x85, 0x0 , 0x36, 0x8c, 
-	0xd1, 0x46, 0x28, 0x1 , 0xb4, 0x51, 0x48, 0x4d, 0x0 , 0x25, 0x1f, 0x8d, 0x14, 
-	0x7e, 0x14, 0xd0, 0x13, 0x7e, 0x34, 0x51, 0xf8, 0x51, 0xf8, 0x53, 0x1 , 0x56, 
-	0x96, 0x9b, 0x4e, 0x14, 0x0 , 0xab, 0x4b, 0x48, 0xb4, 0xb4, 0x0 , 0xef, 0xc6, 
-	0x8f, 0xc6, 0x90, 0x7d, 0x29, 0x7f, 0xa , 0x0 , 0x29, 0x56, 0x92, 0x8c, 0xd0, 
-	0x3 , 0x85, 0x3a, 0x9b, 0x4a, 0xb4, 0x0 , 0xab, 0x4e, 0xfc, 0x69, 0xb4, 0xa3, 
-	0xe9, 0x40, 0xb , 0x45, 0x1f, 0x85, 0x14, 0xac, 0x3 , 0xa9, 0x41, 0xa6, 0x83, 
-	0x4b, 0x48, 0x7 , 0x52, 0x8a, 0x4a, 0x28, 0x1 , 0xdf, 0x8d, 0x14, 0x7e, 0x14, 
-	0x7e, 0x14, 0x0 , 0x52, 0xad, 0x25, 0x19, 0xa0, 0x7 , 0xa , 0x5c, 0xd2, 0x51, 
-	0x40, 0xe , 0x14, 0xbf, 0x8d, 0x25, 0x2a, 0xfd, 0x28, 0x1 , 0x7f, 0x1a, 0x3f, 
-	0x1a, 0x3f, 0xa , 0x3f, 0xa , 0x0 , 0x28, 0xa2, 0x8a, 0x0 , 0x75, 0x14, 0x83, 
-	0x9a, 0x5a, 0x0 , 0x5c, 0xd2, 0xd3, 0x45, 0x3a, 0x90, 0x5 , 0x2e, 0x69, 0x28, 
-	0xa4, 0x0 , 0xc1, 0xbf, 0x85, 0xaa, 0x36, 0x87, 0x71, 0xf9, 0x8e, 0x47, 0x71, 
-	0xfe, 0x7a, 0xd4, 0xa3, 0xe9, 0x4b, 0xf8, 0x50, 0x5 , 0x3f, 0xb1, 0xc3, 0x1b, 
-	0x6f, 0x58, 0xc3, 0x39, 0xe8, 0x5c, 0x64, 0xfe, 0x1d, 0x85, 0x66, 0xea, 0x93, 
-	0x47, 0x6f, 0x75, 0xbd, 0xdc, 0x7e, 0xec, 0x36, 0x39, 0xcf, 0x38, 0x18, 0xad, 
-	0x8b, 0x82, 0x5f, 0x6a, 0xab, 0x63, 0x9e, 0x71, 0xf4, 0x35, 0xce, 0x6b, 0x2a, 
-	0x88, 0xf2, 0x36, 0x9 , 0x76, 0xc0, 0x4 , 0x9f, 0x7c, 0x67, 0xf2, 0xcd, 0x4b, 
-	0x37, 0xa7, 0xab, 0xd4, 0xc3, 0xd4, 0xa4, 0x91, 0xfc, 0xc9, 0x4e, 0x55, 0x58, 
-	0x61, 0x41, 0xea, 0xc0, 0x9e, 0x3f, 0x95, 0x67, 0x48, 0x14, 0x49, 0xf2, 0xf1, 
-	0x85, 0x0 , 0xfb, 0x9c, 0x73, 0xfa, 0xd6, 0x86, 0xb0, 0xfe, 0x75, 0xd0, 0x8d, 
-	0x33, 0xe5, 0xae, 0x17, 0x76, 0x3d, 0x6 , 0x7f, 0xc6, 0xb3, 0x64, 0x20, 0xbb, 
-	0x6d, 0x1f, 0x2e, 0xe3, 0x8a, 0xe7, 0x91, 0xe8, 0xd3, 0xd9, 0x4 , 0x9 , 0x97, 
-	0x1c, 0x67, 0xb9, 0x15, 0x24, 0x6a, 0xd2, 0x5c, 0x37, 0x96, 0x9 , 0x63, 0x90, 
-	0xb8, 0x1f, 0x99, 0xa8, 0x55, 0xc8, 0x76, 0x55, 0x3c, 0xe3, 0x15, 0xb1, 0xa5, 
-	0xdb, 0x4 , 0xb3, 0x32, 0x36, 0x43, 0xb2, 0xef, 0xce, 0x79, 0x55, 0xed, 0xf8, 
-	0x93, 0x4a, 0x28, 0x2a, 0x4e, 0xcd, 0x92, 0x58, 0x44, 0x90, 0xc3, 0x34, 0xa5, 
-	0xb2, 0xb1, 0x2e, 0xd4, 0xe3, 0x1f, 0x3d, 0x52, 0xbc, 0x1 , 0x21, 0x1b, 0x80, 
-	0xdd, 0xb4, 0x9e, 0x4f, 0x41, 0xd0, 0xf , 0xe6, 0x6b, 0x53, 0x4f, 0x4c, 0xdb, 
-	0x45, 0x1c, 0x83, 0xf7, 0x66, 0x40, 0x5b, 0xdb, 0xb9, 0x3f, 0x96, 0x6b, 0x1e, 
-	0xf2, 0x43, 0x3d, 0xc4, 0x93, 0x6d, 0xe0, 0x9d, 0xc0, 0x63, 0xf2, 0xaa, 0x7b, 
-	0x19, 0xc7, 0x76, 0x67, 0xdc, 0x7c, 0xae, 0x7d, 0x85, 0x44, 0x39, 0x19, 0xa5, 
-	0x90, 0x92, 0xc3, 0x26, 0x97, 0x18, 0xa8, 0x7 , 0xab, 0x10, 0xfe, 0xbf, 0xca, 
-	0x97, 0xa9, 0x6 , 0x93, 0x1f, 0x35, 0x3f, 0x81, 0xc9, 0x1f, 0x5a, 0x1 , 0x20, 
-	0xe9, 0xcf, 0xf9, 0x34, 0xc6, 0xc9, 0x38, 0xef, 0x4a, 0xd9, 0xea, 0x7f, 0xfd, 
-	0x54, 0xab, 0xb5, 0x64, 0xf9, 0x87, 0x3 , 0xa8, 0xa0, 0x25, 0x2e, 0x82, 0x63, 
-	0xc , 0x0 , 0x38, 0xdf, 0xdc, 0xf6, 0xa8, 0xe5, 0x20, 0xb6, 0xd5, 0xfb, 0xab, 
-	0xd3, 0xde, 0x96, 0x42, 0x79, 0x18, 0xef, 0x4c, 0x51, 0x93, 0x54, 0x63, 0x2d, 
-	0x58, 0xaa, 0x8 , 0xa7, 0x28, 0xc9, 0xa3, 0xaf, 0x18, 0xa5, 0x61, 0x85, 0xc7, 
-	0x73, 0x52, 0x68, 0x95, 0x90, 0xe , 0x99, 0xa4, 0xef, 0x4b, 0xfc, 0x34, 0x94, 
-	0x8a, 0x62, 0x7f, 0x9 , 0xf7, 0xa6, 0x37, 0x5f, 0xc2, 0x9f, 0xd7, 0x0 , 0x53, 
-	0x1b, 0xab, 0x7b, 0x55, 0x98, 0x48, 0x61, 0xa7, 0x47, 0xd2, 0x9b, 0x4e, 0x8f, 
-	0xa5, 0x34, 0x66, 0xb7, 0x25, 0x87, 0x0 , 0xed, 0x23, 0xad, 0x5d, 0x59, 0x3c, 
-	0xeb, 0x7f, 0x2a, 0x42, 0x4e, 0xde, 0xf5, 0x45, 0x46, 0x6a, 0x78, 0xd8, 0x8c, 
-	0x36, 0x3a, 0x1c, 0x11, 0x5b, 0x41, 0x99, 0x54, 0x8d, 0x99, 0x4 , 0xd0, 0x6d, 
-	0x50, 0xe3, 0xee, 0xb1, 0xe0, 0xd2, 0xc2, 0xd5, 0x7f, 0x4f, 0xb , 0x24, 0x8d, 
-	0x6b, 0x84, 0x1e, 0x61, 0xc2, 0xee, 0xfe, 0x5e, 0xd5, 0x9d, 0x8f, 0x2a, 0xe5, 
-	0xa3, 0x38, 0xf9, 0x49, 0x5c, 0x8f, 0x5a, 0x99, 0x25, 0xba, 0x14, 0x6e, 0x5b, 
-	0x88, 0xf1, 0x5a, 0x9a, 0x36, 0xa3, 0x25, 0xa3, 0x6c, 0x7c, 0xb4, 0x47, 0xb6, 
-	0x7e, 0xef, 0xd2, 0xb2, 0xa0, 0x3c, 0x54, 0xeb, 0x59, 0xa6, 0xd3, 0xba, 0x36, 
-	0x47, 0x65, 0x6f, 0x32, 0x4a, 0xa1, 0xd1, 0xb2, 0xa7, 0xa1, 0xab, 0x2b, 0xce, 
-	0x2b, 0x93, 0xd2, 0xef, 0x24, 0xb6, 0x93, 0xbb, 0x21, 0xea, 0xbf, 0xe1, 0x5d, 
-	0x25, 0x8d, 0xc4, 0x72, 0xc6, 0x1d, 0x8 , 0x23, 0xeb, 0x5d, 0x30, 0x92, 0x91, 
-	0x45, 0xb5, 0x5e, 0xf4, 0x30, 0xfd, 0x69, 0x46, 0xa , 0xe4, 0x1a, 0x7a, 0x81, 
-	0xb6, 0xac, 0x63, 0x56, 0x3a, 0x96, 0x38, 0x49, 0xa5, 0x8d, 0x47, 0x6a, 0xbf, 
-	0x62, 0x83, 0xcc, 0x19, 0xa4, 0xf6, 0x2a, 0x3a, 0xb2, 0x3b, 0x3d, 0x39, 0xe5, 
-	0x23, 0x3 , 0xf4, 0xae, 0x83, 0x46, 0xf0, 0xe3, 0xca, 0x43, 0x30, 0xfc, 0xc5, 
-	0x5b, 0xd0, 0x61, 0x43, 0xb4, 0x10, 0x39, 0x35, 0xda, 0xf8, 0x7e, 0xda, 0x3f, 
-	0x97, 0x8e, 0x7 , 0x6a, 0xe1, 0xad, 0x51, 0x9d, 0xf4, 0x60, 0x8a, 0xde, 0x1d, 
-	0xf0, 0xcc, 0x23, 0x69, 0x78, 0xc1, 0xc1, 0xf4, 0xeb, 0x5d, 0x96, 0x8b, 0xa0, 
-	0x41, 0x13, 0x2f, 0xcb, 0x8f, 0xc2, 0xa5, 0xd3, 0xa3, 0x89, 0x55, 0x4f, 0x0 , 
-	0xd6, 0xcd, 0xa4, 0x91, 0x2f, 0x19, 0x3 , 0x9a, 0xf2, 0xea, 0x49, 0xb3, 0xd2, 
-	0x84, 0x52, 0x1f, 0x6f, 0xa5, 0xc4, 0x91, 0xf1, 0xb6, 0x95, 0xec, 0x23, 0xb , 
-	0xf7, 0x7d, 0xea, 0x74, 0xba, 0x5c, 0x70, 0xc2, 0x9f, 0xe7, 0x2b, 0x72, 0x33, 
-	0xd3, 0x4 , 0xd6, 0xd , 0x9b, 0x58, 0xcf, 0x92, 0xda, 0x24, 0x5d, 0xfb, 0x46, 
-	0x40, 0xac, 0xfb, 0xa4, 0x50, 0xfb, 0xb6, 0x1d, 0xa3, 0xf4, 0xad, 0x7b, 0xd2, 
-	0x9c, 0x91, 0x83, 0xe9, 0x59, 0x3a, 0x8c, 0xd1, 0xc6, 0xb8, 0x38, 0x24, 0x72, 
-	0x4d, 0x21, 0x14, 0xaf, 0x9b, 0x6c, 0x5d, 0x0 , 0xc7, 0x35, 0xce, 0xf8, 0x82, 
-	0xf9, 0x23, 0x88, 0x9d, 0xd8, 0x18, 0xe7, 0x9a, 0xb1, 0xe2, 0x2d, 0x56, 0x34, 
-	0x8d, 0x9d, 0x98, 0x5 , 0xf5, 0xaf, 0xf , 0xf8, 0xad, 0xf1, 0xd , 0x9b, 0xce, 
-	0xb1, 0xd2, 0x64, 0xcb, 0x86, 0xd8, 0xf2, 0x60, 0x9c, 0x7a, 0x81, 0xee, 0x2b, 
-	0x7a, 0x34, 0x9c, 0x99, 0xcb, 0x5a, 0xb2, 0xa7, 0x13, 0x43, 0xc7, 0x5e, 0x32, 
-	0xb6, 0xb0, 0x9f, 0x7a, 0xac, 0x77, 0xe , 0x87, 0xf7, 0x70, 0x39, 0x38, 0x27, 
-	0xb3, 0x30, 0x1d, 0x47, 0xf3, 0xc5, 0x79, 0x46, 0xad, 0x25, 0xc6, 0xa1, 0x78, 
-	0xd3, 0x4d, 0x23, 0x3b, 0xcb, 0x29, 0x91, 0x8e, 0x78, 0xe7, 0xbe, 0x3f, 0x1a, 
-	0xa8, 0x93, 0x3c, 0xb3, 0x79, 0xd3, 0x65, 0xd8, 0x9e, 0x4e, 0x6a, 0xf4, 0x52, 
-	0x3b, 0xc8, 0xb1, 0x47, 0x16, 0xe7, 0x6f, 0xba, 0xb9, 0xfe, 0x75, 0xeb, 0x42, 
-	0xa , 0x11, 0xb1, 0xe1, 0x54, 0x95, 0x4a, 0xb5, 0x36, 0xbb, 0xe8, 0x3b, 0x4d, 
-	0x53, 0x6e, 0xa7, 0xf7, 0x4c, 0x5d, 0xf8, 0x0 , 0x75, 0x26, 0xb5, 0xac, 0xa3, 
-	0xfb, 0x26, 0x67, 0x60, 0x3e, 0xd0, 0xc3, 0x3 , 0xfe, 0x99, 0x8f, 0x6f, 0x7a, 
-	0x65, 0xac, 0x3e, 0x4f, 0xce, 0xc7, 0x7c, 0xcc, 0x39, 0x23, 0xa2, 0xfb, 0xa , 
-	0x57, 0x39, 0xac, 0xe7, 0x36, 0xf4, 0x5b, 0x1f, 0x4b, 0x97, 0xe5, 0xb1, 0xc3, 
-	0xfe, 0xf2, 0xae, 0xb3, 0xfc, 0xbf, 0xe0, 0x89, 0x23, 0x13, 0xc9, 0x3f, 0x5a, 
-	0x8d, 0xa9, 0xcd, 0x4d, 0x6e, 0x95, 0x91, 0xea, 0x36, 0x41, 0x2f, 0x3f, 0x95, 
-	0x64, 0x6b, 0x6a, 0x4c, 0x4b, 0x8e, 0xc7, 0x26, 0xb6, 0x25, 0x18, 0xaa, 0x53, 
-	0xc7, 0xbf, 0xb7, 0x6a, 0xb4, 0xec, 0xcf, 0x3b, 0x19, 0x4f, 0xda, 0x53, 0x71, 
-	0xee, 0x60, 0x8a, 0x75, 0x3a, 0xe2, 0x3f, 0x2e, 0x66, 0x4f, 0x4e, 0x94, 0x98, 
-	0xad, 0x8f, 0x98, 0xb3, 0x4d, 0xa6, 0x20, 0xa5, 0x3 , 0x9e, 0x7a, 0x52, 0x2f, 
-	0x5a, 0x90, 0x2e, 0x7e, 0x9d, 0xcd, 0x21, 0xc6, 0x37, 0x2 , 0x72, 0xbb, 0xba, 
-	0xe , 0xc2, 0x9d, 0x67, 0x17, 0x99, 0x26, 0x49, 0xc2, 0x8a, 0x6c, 0x40, 0xc9, 
-	0x28, 0xc7, 0x41, 0xd2, 0xaf, 0x43, 0x1a, 0x95, 0x23, 0xa4, 0x4b, 0xf7, 0xdb, 
-	0xd7, 0xd8, 0x54, 0x4a, 0x56, 0x47, 0x55, 0xa , 0x5e, 0xd2, 0x77, 0x7b, 0x12, 
-	0x42, 0x55, 0x21, 0x32, 0x91, 0xb4, 0x1 , 0x84, 0x1e, 0xde, 0xb5, 0x45, 0x8e, 
-	0xe2, 0x72, 0x7e, 0xf7, 0x6 , 0xa6, 0xbf, 0x9b, 0x7b, 0xed, 0x1d, 0xba, 0x8e, 
-	0xc0, 0xfa, 0x7e, 0x15, 0xc , 0x60, 0x5 , 0xf9, 0xba, 0x2d, 0x4c, 0x23, 0x6d, 
-	0x4d, 0xeb, 0xd4, 0x52, 0x92, 0x82, 0xd9, 0x8 , 0x32, 0xbc, 0x9e, 0xbd, 0x17, 
-	0xdb, 0xde, 0x9a, 0x1b, 0xd , 0x8f, 0x4e, 0xf4, 0xf9, 0xb3, 0x9d, 0xde, 0xa3, 
-	0x8f, 0x6a, 0x8d, 0x46, 0x1b, 0xeb, 0x56, 0x72, 0xca, 0xe9, 0xd8, 0xb5, 0xc , 
-	0x87, 0x76, 0xd6, 0xce, 0x7b, 0x11, 0xde, 0xaf, 0x59, 0xcc, 0x14, 0x4 , 0x73, 
-	0x95, 0xed, 0xed, 0x59, 0x68, 0x78, 0xd8, 0x7a, 0xa9, 0xe2, 0xac, 0x43, 0x27, 
-	0x3f, 0x37, 0xa7, 0x5f, 0xf1, 0xac, 0xe7, 0x14, 0xce, 0xec, 0x3e, 0x22, 0x50, 
-	0x69, 0x9a, 0xe1, 0x54, 0xaf, 0x27, 0xfd, 0xd6, 0xa7, 0x43, 0xbb, 0x76, 0xc7, 
-	0x1c, 0x8e, 0x9e, 0xbf, 0x51, 0x55, 0x6c, 0xe7, 0x28, 0xd8, 0x6f, 0xbb, 0xdc, 
-	0x77, 0x5f, 0x7f, 0xa5, 0x5d, 0x8f, 0x63, 0x80, 0x1 , 0xce, 0x3d, 0x3a, 0x8f, 
-	0xa5, 0x71, 0xc9, 0x38, 0xb3, 0xe8, 0x68, 0xca, 0x35, 0x55, 0xd6, 0xe4, 0xa1, 
-	0xb3, 0x1e, 0xc2, 0x6 , 0x33, 0xf2, 0x9c, 0x63, 0x9f, 0xe9, 0x49, 0x71, 0xb8, 
-	0x34, 0x72, 0x8d, 0xde, 0x5b, 0x7c, 0xb2, 0x7b, 0x1a, 0x4c, 0x10, 0xd8, 0x27, 
-	0x4 , 0xf4, 0x3d, 0x9a, 0x94, 0xca, 0x4c, 0x4d, 0x1b, 0xae, 0x33, 0xd0, 0xe7, 
-	0xa1, 0xf5, 0xa9, 0x5a, 0xb3, 0x46, 0xb9, 0x62, 0x49, 0x3c, 0x44, 0x46, 0xc8, 
-	0xe , 0xe0, 0xc3, 0xa5, 0x4d, 0x66, 0xbe, 0x6d, 0x9e, 0xc6, 0x5c, 0x91, 0xc1, 
-	0x15, 0x62, 0xdd, 0x23, 0x9a, 0xc9, 0x26, 0xde, 0x11, 0xd4, 0xd , 0xc3, 0xdb, 
-	0xde, 0xa0, 0xb5, 0x57, 0x17, 0x52, 0xc6, 0x3e, 0xf4, 0x67, 0xa7, 0x73, 0x53, 
-	0xea, 0x6b, 0x77, 0x6b, 0xc7, 0xa8, 0xd9, 0x3 , 0x40, 0x41, 0x4 , 0xba, 0x8e, 
-	0xe7, 0xa8, 0xf6, 0x3e, 0xa2, 0xa7, 0x8e, 0xe2, 0x7 , 0xe1, 0x9b, 0x6b, 0x7a, 
-	0x8e, 0x95, 0x2c, 0xa1, 0x67, 0xb5, 0x6c, 0xff, 0x0 , 0xac, 0x1d, 0x1b, 0xd6, 
-	0xb2, 0x9c, 0x3a, 0xb1, 0x27, 0x2a, 0x7f, 0xcf, 0x6a, 0x1d, 0x35, 0x23, 0x4a, 
-	0x78, 0xc9, 0x53, 0xd2, 0xda, 0x1a, 0x73, 0x46, 0x92, 0xe7, 0x2a, 0xad, 0x8c, 
-	0x10, 0x57, 0x83, 0x49, 0xa6, 0xa8, 0xb7, 0x72, 0x83, 0x8c, 0x8e, 0x33, 0x54, 
-	0x22, 0x9c, 0xed, 0xee, 0x30, 0x30, 0x30, 0x78, 0xf6, 0xfa, 0x52, 0xda, 0xdc, 
-	0x4e, 0xb7, 0x91, 0x87, 0x62, 0x55, 0x8e, 0x32, 0x69, 0x46, 0x33, 0x5d, 0x4a, 
-	0xa9, 0x56, 0x85, 0x45, 0x6e, 0x5d, 0x59, 0xd0, 0x46, 0xc1, 0x97, 0x1d, 0xd7, 
-	0xf9, 0x54, 0x88, 0x58, 0xc , 0x2 , 0x6a, 0x9a, 0x39, 0x5f, 0x98, 0xe7, 0x3 , 
-	0xae, 0x7d, 0x2a, 0xc4, 0x6e, 0xbf, 0xdd, 0xe2, 0xbb, 0x30, 0xdb, 0xda, 0xe7, 
-	0x85, 0x9a, 0xa4, 0xe0, 0xa6, 0xa3, 0xaf, 0xea, 0x4b, 0x97, 0xcf, 0xad, 0x4a, 
-	0xaa, 0xdd, 0xf0, 0xb5, 0x1c, 0x6c, 0x37, 0x3 , 0x9c, 0x54, 0x99, 0xcf, 0xa9, 
-	0xfc, 0x2b, 0xd3, 0x84, 0x51, 0xf2, 0x75, 0xaa, 0x36, 0xf6, 0xd , 0xaa, 0x7 , 
-	0x27, 0x34, 0xe5, 0xa2, 0x90, 0x9c, 0x55, 0x9c, 0xad, 0xdc, 0x4a, 0x28, 0xa2, 
-	0x98, 0x82, 0x9a, 0x69, 0x73, 0xeb, 0x49, 0x40, 0x5 , 0x1f, 0x8d, 0x14, 0x7e, 
-	0x14, 0x0 , 0x7e, 0x34, 0x99, 0xf7, 0xa0, 0xfd, 0x29, 0x28, 0x0 , 0xa2, 0x8a, 
-	0x42, 0x68, 0x1 , 0x3b, 0xd1, 0x45, 0x21, 0x34, 0x0 , 0x94, 0x51, 0x45, 0x0 , 
-	0x1f, 0x8d, 0x1f, 0x8d, 0x1f, 0x85, 0x37, 0x3e, 0xd4, 0x0 , 0x51, 0x45, 0x21, 
-	0x34, 0x0 , 0x94, 0x51, 0x48, 0x4d, 0x50, 0x9 , 0x45, 0x14, 0x50, 0x1 , 0xf8, 
-	0xd2, 0x67, 0xde, 0x97, 0xf0, 0xa6, 0x9a, 0x0 , 0x28, 0xcd, 0x14, 0x8d, 0x40, 
-	0x9 , 0x48, 0xd4, 0xb4, 0x8d, 0x40, 0x9 , 0x47, 0xe3, 0x45, 0x1f, 0x85, 0x0 , 
-	0x27, 0xe3, 0x48, 0x69, 0x5b, 0xe9, 0x49, 0x40, 0x5 , 0x23, 0x52, 0x9a, 0x6d, 
-	0x0 , 0x23, 0x52, 0x52, 0xb5, 0x25, 0x0 , 0x14, 0x7e, 0x34, 0x7e, 0x14, 0x7e, 
-	0x15, 0x40, 0x4b, 0x9f, 0x7a, 0x5f, 0xc6, 0x9a, 0xb4, 0xef, 0xc2, 0x80, 0xa , 
-	0x50, 0x69, 0x28, 0xa0, 0x7 , 0xa , 0x75, 0x36, 0x8c, 0xd0, 0x3 , 0x85, 0x2f, 
-	0xe3, 0x49, 0x4a, 0xbf, 0x4a, 0x0 , 0x5a, 0x28, 0xfc, 0x28, 0xa0, 0x7 , 0x51, 
-	0x48, 0xd , 0x2d, 0x0 , 0x3a, 0x95, 0x7e, 0xb4, 0x94, 0x50, 0x3 , 0xbf, 0x1a, 
-	0x28, 0xfc, 0x28, 0xa0, 0x0 , 0x53, 0xa9, 0xb4, 0xab, 0x48, 0x7 , 0x2d, 0x2d, 
-	0x36, 0x9c, 0x29, 0x0 , 0x2d, 0x3b, 0xf1, 0xa6, 0xd2, 0x8f, 0xa5, 0x0 , 0x2f, 
-	0xe3, 0x45, 0x1f, 0x85, 0x14, 0x0 , 0xec, 0xd1, 0x48, 0xb4, 0xb4, 0x0 , 0xea, 
-	0x29, 0x33, 0x4a, 0x28, 0x1 , 0x73, 0xef, 0x4b, 0xf8, 0xd3, 0x56, 0x9d, 0xf8, 
-	0x50, 0x1 , 0xf8, 0xd1, 0x47, 0xe1, 0x45, 0x0 , 0x14, 0xab, 0x49, 0x4a, 0xb4, 
-	0x0 , 0xb4, 0x51, 0x45, 0x0 , 0x3b, 0x34, 0x53, 0x69, 0xc2, 0x90, 0x0 , 0xe6, 
-	0x82, 0x7 , 0xf1, 0x1e, 0x3e, 0xb4, 0xe , 0x28, 0x6e, 0x69, 0x1 , 0x5e, 0xea, 
-	0xe3, 0xf8, 0x61, 0x52, 0xc4, 0x1e, 0xc3, 0xfc, 0x8a, 0xe5, 0x75, 0x2c, 0xbd, 
-	0xd6, 0xeb, 0x87, 0xa , 0x80, 0x64, 0xc , 0xf2, 0x4f, 0xf9, 0xf4, 0xae, 0x9e, 
-	0xeb, 0xcd, 0xa , 0x44, 0x6a, 0x6 , 0x3a, 0x71, 0xfe, 0x45, 0x73, 0x56, 0x76, 
-	0xab, 0x35, 0xd1, 0x79, 0x1b, 0xcc, 0x3b, 0xb1, 0xcf, 0x73, 0x9c, 0x7e, 0x55, 
-	0x12, 0x3a, 0xa8, 0xd9, 0x5d, 0x99, 0x17, 0xa7, 0xed, 0x37, 0x1b, 0x61, 0x6 , 
-	0x38, 0x86, 0xec, 0x67, 0x8c, 0x8e, 0x3f, 0xa5, 0x67, 0x72, 0x5b, 0x1e, 0x86, 
-	0xb6, 0xaf, 0xbe, 0x5b, 0xd5, 0x8c, 0x28, 0xf9, 0x8b, 0x30, 0x3 , 0xdc, 0x8e, 
-	0x3f, 0x21, 0x59, 0x71, 0xc4, 0x65, 0x69, 0x59, 0x7e, 0x55, 0x0 , 0xb7, 0x3e, 
-	0x83, 0x9f, 0xf0, 0xac, 0x25, 0xb9, 0xdd, 0x4d, 0xd9, 0x11, 0xd9, 0xa2, 0x4b, 
-	0x71, 0x86, 0xc9, 0xf9, 0x73, 0x8f, 0x7a, 0xe9, 0x15, 0xb , 0x46, 0xca, 0x83, 
-	0x23, 0xa , 0xa0, 0xfb, 0xff, 0x0 , 0xfa, 0xf1, 0x58, 0x70, 0xc4, 0x21, 0x6b, 
-	0x39, 0x81, 0xff, 0x0 , 0x59, 0xb8, 0x37, 0xb1, 0xec, 0x3f, 0x2c, 0x57, 0x55, 
-	0xa6, 0xc0, 0x55, 0x6d, 0x95, 0xf1, 0xb9, 0x80, 0x90, 0x8f, 0xcc, 0xff, 0x0 , 
-	0x20, 0x2a, 0xa2, 0x8e, 0x7a, 0x92, 0xb1, 0x4e, 0xe3, 0x31, 0x69, 0x77, 0x3b, 
-	0x40, 0xf9, 0x23, 0xda, 0xa0, 0x1e, 0x72, 0x71, 0x9f, 0xd0, 0x56, 0x34, 0x31, 
-	0x89, 0x21, 0x96, 0x4f, 0xee, 0x28, 0xb , 0xcf, 0x61, 0xeb, 0xfa, 0x56, 0xae, 
-	0xa4, 0x42, 0x69, 0xb3, 0xae, 0x1 , 0xdd, 0xc0, 0xe7, 0xbe, 0x41, 0x3f, 0xa0, 
-	0x3f, 0x9d, 0x66, 0xe0, 0x25, 0x89, 0x8b, 0xb3, 0xf4, 0xf5, 0x62, 0xe , 0x31, 
-	0x53, 0x2d, 0xca, 0x8e, 0xcc, 0xc5, 0x5f, 0xbd, 0x93, 0x4a, 0x3b, 0x93, 0x4b, 
-	0x9a, 0x14, 0x63, 0x93, 0xf8, 0x54, 0x1a, 0x58, 0x14, 0x0 , 0xb9, 0x34, 0x84, 
-	0xe7, 0xfa, 0x52, 0xa8, 0x2e, 0xdd, 0x38, 0xab, 0x2b, 0x6e, 0x4a, 0xb0, 0x5e, 
-	0xaa, 0x32, 0xd9, 0xe9, 0x54, 0x89, 0x94, 0xac, 0x88, 0x14, 0x1 , 0x1e, 0xe3, 
-	0xce, 0x7a, 0xfb, 0xa , 0x6f, 0xca, 0xb0, 0x79, 0x84, 0xfc, 0xd9, 0xc0, 0x15, 
-	0x34, 0xe8, 0x23, 0x21, 0x6 , 0x78, 0x19, 0x61, 0xe9, 0xed, 0x55, 0xa4, 0x3b, 
-	0xbb, 0x74, 0xa3, 0x62, 0x2f, 0x74, 0x30, 0x2e, 0x5b, 0xae, 0x29, 0x70, 0x3b, 
-	0x54, 0x90, 0xc6, 0x65, 0x7d, 0xa3, 0x8c, 0x72, 0x4f, 0xa5, 0x4c, 0xd0, 0xaa, 
-	0x46, 0x49, 0x6 , 0x90, 0xb4, 0x44, 0x6b, 0x11, 0x54, 0xdc, 0xdc, 0x7d, 0x6a, 
-	0x2c, 0x92, 0xd9, 0xa9, 0x26, 0x95, 0xa4, 0xdb, 0xbb, 0xee, 0xaf, 0xa , 0x2a, 
-	0x3f, 0xe7, 0x41, 0x4b, 0xcc, 0x3a, 0x9f, 0xa5, 0x2e, 0x32, 0xbb, 0xbd, 0xf1, 
-	0x4f, 0x8e, 0x23, 0xb4, 0x0 , 0x37, 0x6e, 0xe0, 0x53, 0xaf, 0x14, 0x2c, 0xfe, 
-	0x4a, 0x10, 0x76, 0xe0, 0x1c, 0x74, 0xcf, 0x7a, 0x68, 0x4d, 0x8c, 0xb6, 0x1 , 
-	0xe4, 0xdb, 0xf8, 0x54, 0x57, 0x2a, 0x56, 0x46, 0x0 , 0xf2, 0xa7, 0x9a, 0xbd, 
-	0x25, 0xac, 0xf6, 0x37, 0x50, 0xc9, 0x32, 0x6d, 0xc , 0x79, 0xcf, 0x6a, 0xad, 
-	0x74, 0x7 , 0x98, 0xe4, 0x8c, 0xf3, 0x82, 0x47, 0xad, 0x55, 0x8c, 0x24, 0xee, 
-	0x54, 0xa7, 0x47, 0xd6, 0x91, 0x86, 0x1b, 0x8a, 0x58, 0xfa, 0xd0, 0x89, 0x43, 
-	0xd6, 0xa6, 0xe , 0xbc, 0x36, 0x31, 0xc7, 0x35, 0x8 , 0xa5, 0x5e, 0xb5, 0x49, 
-	0xd8, 0xa9, 0x2b, 0xa1, 0xed, 0xc1, 0x24, 0x1f, 0xc6, 0xa0, 0x97, 0x25, 0xf7, 
-	0x66, 0xa6, 0xc7, 0xee, 0xf1, 0xf9, 0xd3, 0x5b, 0x7 , 0x9e, 0xa0, 0x8e, 0x82, 
-	0xae, 0x5a, 0x98, 0x92, 0xdb, 0x9c, 0xa8, 0x35, 0x6d, 0xd , 0x51, 0xb6, 0x38, 
-	0x25, 0x73, 0x9a, 0xb9, 0x1f, 0x35, 0x89, 0xa4, 0x4b, 0x11, 0xf4, 0xcd, 0x5a, 
-	0xb1, 0xb8, 0x92, 0xda, 0x4d, 0xc8, 0x78, 0x3d, 0x47, 0xad, 0x55, 0x8e, 0xa4, 
-	0x5a, 0x69, 0xd9, 0x96, 0x74, 0xba, 0x7d, 0xe2, 0x4c, 0xb9, 0x56, 0xe7, 0xb8, 
-	0x3d, 0xaa, 0xfc, 0x72, 0x2 , 0xbd, 0x6b, 0x93, 0x84, 0xb2, 0x36, 0xe5, 0x38, 
-	0x3e, 0xb5, 0xa5, 0x63, 0xa8, 0x10, 0x42, 0xcd, 0xf8, 0x35, 0x75, 0x46, 0x57, 
-	0x3 , 0xa0, 0x8d, 0xfe, 0x5c, 0x1a, 0xb3, 0x4 , 0xf8, 0xdb, 0xd3, 0x8a, 0xc8, 
-	0x8a, 0xe5, 0x59, 0x72, 0x1b, 0x39, 0xa9, 0x96, 0x73, 0xd0, 0x1a, 0xb6, 0x34, 
-	0x75, 0x3a, 0x6e, 0xa7, 0xe5, 0xe3, 0xdb, 0xb8, 0x35, 0xd3, 0xe8, 0xba, 0xf8, 
-	0x49, 0x17, 0xe7, 0x38, 0x23, 0x9e, 0x7a, 0x57, 0x99, 0xc7, 0x71, 0xb4, 0xf5, 
-	0xa9, 0xa3, 0xbf, 0x96, 0x36, 0xe1, 0xbe, 0x95, 0xcb, 0x52, 0x97, 0x31, 0xd9, 
-	0x4a, 0xb5, 0x8f, 0x72, 0xd2, 0x75, 0xe8, 0xe , 0xd1, 0x24, 0xa3, 0x9e, 0x1 , 
-	0x7 , 0xbd, 0x6d, 0x43, 0xac, 0xc3, 0x80, 0x7c, 0xc5, 0xc7, 0xa1, 0x35, 0xe0, 
-	0x36, 0x7a, 0xec, 0xd1, 0x9e, 0x64, 0x3b, 0x6b, 0x5e, 0xc7, 0xc5, 0x73, 0x43, 
-	0xc1, 0x90, 0x95, 0xc6, 0x2b, 0xcf, 0xa9, 0x86, 0x67, 0x7d, 0x3a, 0xeb, 0xb9, 
-	0xee, 0xd6, 0xda, 0x9c, 0x5d, 0x9b, 0x8f, 0x7a, 0x98, 0xea, 0xea, 0x17, 0x6e, 
-	0x40, 0xc7, 0x43, 0x9a, 0xf1, 0x8b, 0x7f, 0x17, 0x90, 0x17, 0x7c, 0x84, 0xc , 
-	0x7a, 0xd4, 0xb3, 0x78, 0xd1, 0x55, 0x4f, 0xef, 0xb1, 0xc7, 0x3f, 0x35, 0x73, 
-	0x3a, 0x12, 0x36, 0xf6, 0xc8, 0xf5, 0x5b, 0xfd, 0x6a, 0x34, 0x5f, 0xbf, 0xd7, 
-	0xaf, 0x35, 0xca, 0xf8, 0x93, 0xc4, 0x70, 0xc0, 0x8c, 0xed, 0x26, 0x0 , 0xff, 
-	0x0 , 0x6a, 0xbc, 0xdf, 0xc4, 0x5e, 0x3f, 0x8e, 0x18, 0x59, 0x8c, 0xb8, 0xf4, 
-	0xf9, 0xba, 0xd7, 0x95, 0xf8, 0xcf, 0xc5, 0xfa, 0x9e, 0xb9, 0x33, 0x40, 0xb2, 
-	0x34, 0x76, 0xf9, 0xc1, 0x0 , 0xf2, 0xdf, 0x5f, 0xf0, 0xad, 0x69, 0xe1, 0x65, 
-	0x2d, 0x7a, 0x1c, 0xb5, 0xf1, 0xb1, 0x82, 0xf3, 0x3a, 0x8f, 0x8a, 0x9f, 0x11, 
-	0xe7, 0xd5, 0x66, 0x93, 0x4c, 0xd2, 0xa6, 0x22, 0x15, 0x38, 0x96, 0x75, 0x3f, 
-	0x78, 0x7a, 0x2f, 0xf8, 0xd7, 0x9f, 0xed, 0x1b, 0x46, 0x5b, 0x9e, 0xc6, 0xa3, 
-	0xb7, 0x87, 0x6a, 0x1c, 0x9e, 0xbd, 0xaa, 0xc4, 0x31, 0x3b, 0x4a, 0x91, 0xe , 
-	0x19, 0xb8, 0x1e, 0xd5, 0xdf, 0x18, 0x46, 0xa , 0xc7, 0x92, 0xe7, 0x3a, 0xd3, 
-	0x5d, 0xd9, 0x73, 0x44, 0xd2, 0xa7, 0xd4, 0x59, 0x99, 0xa , 0xc5, 0xc , 0x23, 
-	0x33, 0x4e, 0xe3, 0xe5, 0x4c, 0xf4, 0xff, 0x0 , 0x79, 0x8f, 0x65, 0x1c, 0x9f, 
-	0xa6, 0x4d, 0x6c, 0x5b, 0xdb, 0x5b, 0xdb, 0xee, 0x5b, 0x70, 0x76, 0x93, 0xcb, 
-	0xbf, 0xde, 0x6a, 0x6d, 0xa9, 0xf2, 0x6c, 0xd6, 0xd4, 0x3b, 0x79, 0x4a, 0x4b, 
-	0x6d, 0xcf, 0x56, 0x3c, 0x13, 0x8f, 0x5a, 0x6c, 0x92, 0x97, 0xe0, 0x70, 0x5 , 
-	0x65, 0x29, 0x36, 0x7d, 0x46, 0x7 , 0x7 , 0x1c, 0x32, 0xbe, 0xf3, 0xef, 0xdb, 
-	0xd0, 0x91, 0xe4, 0x3 , 0x81, 0x8a, 0x61, 0x2a, 0x47, 0x14, 0xc0, 0x9 , 0xa7, 
-	0x2a, 0x11, 0xcd, 0x49, 0xde, 0xf , 0x4c, 0x6e, 0x94, 0xf6, 0xa6, 0x35, 0x0 , 
-	0x43, 0x21, 0xc8, 0xe2, 0x91, 0x62, 0xf9, 0x73, 0x52, 0x46, 0x85, 0xa4, 0xa9, 
-	0xe4, 0x5c, 0x2e, 0x0 , 0xa4, 0x28, 0xd3, 0xbe, 0xac, 0xe5, 0xb5, 0xa5, 0xdb, 
-	0x7c, 0x47, 0xaa, 0x8a, 0xac, 0xa3, 0xb5, 0x6e, 0xea, 0x16, 0xab, 0x70, 0xc7, 
-	0x70, 0xe4, 0x74, 0x35, 0x8f, 0x71, 0x6e, 0xf0, 0x3e, 0x1c, 0x7d, 0xf , 0xad, 
-	0x6b, 0x19, 0x68, 0x7c, 0xc6, 0x33, 0xd , 0x38, 0x55, 0x73, 0xb6, 0x8d, 0x8c, 
-	0xc7, 0xcb, 0x4a, 0xbf, 0x37, 0xcb, 0xd0, 0x7a, 0xd2, 0x73, 0x4f, 0x8c, 0x0 , 
-	0xbb, 0x9b, 0xa0, 0xe8, 0x28, 0x39, 0xe2, 0xb5, 0x26, 0xb5, 0x8f, 0x3c, 0x7d, 
-	0xd5, 0x1d, 0x4d, 0x49, 0x75, 0x71, 0xb2, 0x35, 0xd9, 0xc0, 0xff, 0x0 , 0x96, 
-	0x63, 0xff, 0x0 , 0x66, 0x35, 0x1c, 0x8f, 0xb2, 0x30, 0xcc, 0xbf, 0x2f, 0x64, 
-	0xf5, 0xf7, 0x35, 0x56, 0x47, 0x69, 0x1c, 0xb3, 0x1c, 0x93, 0xd6, 0x94, 0x63, 
-	0xcc, 0xee, 0xce, 0x89, 0xd6, 0x54, 0xa1, 0xcb, 0x1d, 0xc7, 0x2b, 0x5 , 0xe4, 
-	0x9e, 0x4d, 0x39, 0x89, 0x38, 0x63, 0xfc, 0x3d, 0x5 , 0x44, 0xa3, 0xb9, 0xe4, 
-	0xd3, 0xd5, 0xbe, 0x6a, 0xab, 0x1c, 0xaa, 0x5a, 0x12, 0x8f, 0xde, 0x47, 0xfc, 
-	0xa9, 0xa1, 0x41, 0x18, 0xa5, 0x43, 0xb1, 0xbd, 0xaa, 0x46, 0xe4, 0xe4, 0x77, 
-	0xa9, 0x3a, 0x12, 0xe6, 0x57, 0xea, 0x44, 0x32, 0x7a, 0xf5, 0x1d, 0xea, 0x50, 
-	0xb , 0x2e, 0x7 , 0x51, 0xc8, 0x3e, 0x95, 0x1b, 0x70, 0x72, 0x2a, 0x48, 0x8f, 
-	0x7f, 0xce, 0x86, 0x38, 0x6f, 0x66, 0x49, 0x4 , 0xb9, 0xdb, 0x9c, 0x8f, 0x42, 
-	0x3b, 0x7b, 0x55, 0xd8, 0x64, 0xcf, 0x0 , 0xed, 0x71, 0xc8, 0xc7, 0x46, 0xac, 
-	0xf9, 0x14, 0x8f, 0x98, 0x7d, 0xd6, 0xeb, 0x52, 0xc6, 0xed, 0x1f, 0x4 , 0x6e, 
-	0x5e, 0xbf, 0x51, 0x59, 0xca, 0x37, 0xd8, 0xeb, 0xa1, 0x59, 0xc1, 0xd9, 0x9b, 
-	0xb1, 0x37, 0x98, 0xb8, 0x62, 0xb8, 0xee, 0x9 , 0xef, 0x4b, 0x22, 0x63, 0x87, 
-	0xfb, 0xbf, 0xde, 0xee, 0xbf, 0x5f, 0xf1, 0xaa, 0x9a, 0x64, 0xbc, 0x90, 0xa7, 
-	0x72, 0xe3, 0x8e, 0x39, 0xc7, 0xa1, 0x15, 0xa6, 0x76, 0xb2, 0x86, 0xea, 0xf , 
-	0x5c, 0x9e, 0x47, 0xb7, 0xd2, 0xb9, 0x25, 0x1b, 0x3d, 0xf , 0x7a, 0x8d, 0x65, 
-	0x38, 0xfb, 0xc4, 0x10, 0xc9, 0x24, 0x6a, 0xd1, 0x91, 0xb9, 0x7b, 0x8f, 0xf0, 
-	0x35, 0x68, 0x32, 0xff, 0x0 , 0x6a, 0x45, 0x2a, 0xfd, 0xd9, 0x0 , 0x19, 0x7 , 
-	0xfc, 0xf7, 0xc5, 0x24, 0x38, 0x86, 0x4c, 0x91, 0xb9, 0xf , 0x50, 0x3a, 0xe2, 
-	0xa3, 0xb8, 0x8b, 0x66, 0x24, 0x5f, 0x9a, 0x32, 0x78, 0x3e, 0x9c, 0xd4, 0xee, 
-	0x6f, 0x24, 0xe3, 0x63, 0x62, 0xea, 0x5 , 0xf2, 0x8 , 0x93, 0x82, 0xdd, 0x18, 
-	0x71, 0x9f, 0xf0, 0x35, 0x56, 0xe2, 0xdf, 0x7c, 0x0 , 0x12, 0x9 , 0xc0, 0xda, 
-	0xc3, 0xf8, 0xbf, 0xfa, 0xfd, 0x2a, 0xd7, 0xda, 0x3c, 0xdb, 0x3d, 0xa5, 0x95, 
-	0xd5, 0xb8, 0xe4, 0x73, 0xf4, 0xab, 0x5e, 0x4a, 0x88, 0x36, 0x83, 0xb8, 0xc , 
-	0x7d, 0x7a, 0x7f, 0x3e, 0x29, 0x46, 0xe9, 0x97, 0x51, 0x46, 0x71, 0xb3, 0xfe, 
-	0xbf, 0xaf, 0xc0, 0xe4, 0xf6, 0x32, 0x5c, 0x79, 0x44, 0x60, 0x75, 0xff, 0x0 , 
-	0xf5, 0x51, 0x78, 0x1a, 0x2f, 0x2d, 0xc7, 0xd7, 0x8f, 0xf3, 0xed, 0x57, 0xae, 
-	0xa3, 0x23, 0x56, 0xf2, 0xc8, 0xc8, 0x1f, 0xc4, 0x3d, 0xe8, 0xd6, 0x21, 0xa , 
-	0xb1, 0xe4, 0x71, 0xb8, 0x81, 0xfa, 0x56, 0xf1, 0xd5, 0x1e, 0x6d, 0x4f, 0x72, 
-	0x4b, 0x53, 0x52, 0x5 , 0x49, 0x21, 0x8d, 0xc0, 0xfb, 0xc2, 0xa5, 0xb3, 0x8d, 
-	0x4e, 0x55, 0x97, 0x95, 0xaa, 0x9a, 0x1c, 0x9b, 0xb4, 0xf5, 0x53, 0xd9, 0x45, 
-	0x5b, 0x42, 0x52, 0xf4, 0x83, 0xff, 0x0 , 0x2d, 0x7 , 0xf2, 0xae, 0x8a, 0x76, 
-	0x6a, 0x32, 0xb7, 0x91, 0xe7, 0xe2, 0x1c, 0x94, 0xaa, 0xd2, 0xe6, 0x76, 0x6b, 
-	0x99, 0x6b, 0xf3, 0x7f, 0x85, 0xd1, 0x65, 0x10, 0xc , 0x8c, 0x74, 0xf6, 0xa7, 
-	0x82, 0x3a, 0xd3, 0x71, 0xf3, 0xe , 0x69, 0x54, 0x11, 0xc6, 0x3b, 0xd7, 0xa1, 
-	0x13, 0xe6, 0x6a, 0x6b, 0xd4, 0x5d, 0xd9, 0x34, 0x86, 0x95, 0xa9, 0x2a, 0x8c, 
-	0x42, 0x91, 0xa8, 0xcd, 0x25, 0x0 , 0x14, 0x51, 0x45, 0x0 , 0x1f, 0x8d, 0x1f, 
-	0x8d, 0x1f, 0x85, 0x1f, 0x85, 0x0 , 0x21, 0xa4, 0xa2, 0x8a, 0x0 , 0x42, 0x69, 
-	0x28, 0xa2, 0x80, 0x10, 0x9a, 0x4a, 0x28, 0xa0, 0x2 , 0x8f, 0xc6, 0x8a, 0x3f, 
-	0xa , 0x0 , 0x46, 0xfa, 0xd2, 0x51, 0x45, 0x3b, 0x0 , 0x8d, 0x49, 0x46, 0x68, 
-	0xa0, 0x2 , 0x9a, 0x68, 0xcd, 0x14, 0xc0, 0x33, 0x47, 0xe3, 0x47, 0xe1, 0x47, 
-	0xe1, 0x40, 0x8 , 0xdf, 0x5a, 0x4a, 0x28, 0xa0, 0x4 , 0x6a, 0x4a, 0x33, 0x45, 
-	0x0 , 0x21, 0x34, 0x94, 0x51, 0x40, 0x7 , 0xe3, 0x47, 0xe3, 0x47, 0xe1, 0x48, 
-	0x7e, 0x94, 0x0 , 0x94, 0x51, 0x48, 0x4d, 0x0 , 0x4 , 0xd2, 0x66, 0x8a, 0x46, 
-	0xa6, 0x2 , 0x51, 0x45, 0x1f, 0x85, 0x3b, 0x0 , 0x7e, 0x34, 0x99, 0xf7, 0xa0, 
-	0xfd, 0x29, 0x28, 0x2 , 0x6a, 0x55, 0xfa, 0xd2, 0x51, 0x40, 0xe , 0xfc, 0x68, 
-	0xa3, 0xf0, 0xa2, 0x80, 0x1d, 0x9a, 0x29, 0xb4, 0xe1, 0x40, 0xe , 0xa5, 0x14, 
-	0xd0, 0x69, 0x68, 0x1 , 0xdf, 0x8d, 0x14, 0x83, 0xe9, 0x4b, 0xf8, 0x50, 0x0 , 
-	0x29, 0xd4, 0xda, 0x55, 0xa0, 0x7 , 0x2d, 0x2d, 0x36, 0x9c, 0x28, 0x0 , 0x5a, 
-	0x77, 0xe3, 0x4d, 0xa5, 0x1f, 0x4a, 0x0 , 0x5a, 0x50, 0x69, 0x3f, 0xa , 0x28, 
-	0x1 , 0xd9, 0xa5, 0x6 , 0x9a, 0xb4, 0xb4, 0x80, 0x75, 0x28, 0xa6, 0x83, 0x4b, 
-	0x40, 0xe , 0xfc, 0x68, 0xfc, 0x69, 0x7 , 0xd2, 0x97, 0xf0, 0xa4, 0x1 , 0x4a, 
-	0xbf, 0x5a, 0x4a, 0x33, 0x40, 0xe , 0xa5, 0x6 , 0x92, 0x8a, 0x0 , 0x75, 0x28, 
-	0xa6, 0x83, 0x4b, 0x40, 0xe , 0xfc, 0x68, 0xfc, 0x69, 0x7 , 0xd2, 0x97, 0xf0, 
-	0xa0, 0x2 , 0x8a, 0x0 , 0xa2, 0x80, 0x1 , 0x4e, 0xa6, 0xd1, 0x9a, 0x0 , 0x75, 
-	0x28, 0x34, 0x94, 0x50, 0x3 , 0x86, 0x71, 0x48, 0xc4, 0x1 , 0x93, 0x48, 0x49, 
-	0xed, 0x8f, 0xc6, 0x8c, 0x67, 0xef, 0x7e, 0x54, 0x80, 0x86, 0xea, 0x42, 0x54, 
-	0xb0, 0x1f, 0x2a, 0xa9, 0x3c, 0xff, 0x0 , 0x5a, 0xe6, 0xa1, 0x94, 0xc7, 0x1b, 
-	0x5 , 0x21, 0x79, 0xeb, 0x8c, 0x93, 0xf4, 0x15, 0xd2, 0xdf, 0xae, 0xeb, 0x57, 
-	0xf7, 0x18, 0xc5, 0x64, 0x2c, 0x4a, 0xb6, 0x73, 0xa2, 0xa8, 0xdc, 0x14, 0xf3, 
-	0x8f, 0x50, 0xb8, 0xfe, 0x46, 0xa2, 0x49, 0x9b, 0xd3, 0x69, 0x26, 0x73, 0x77, 
-	0x91, 0xc8, 0x5d, 0xde, 0x42, 0xc3, 0x10, 0x92, 0x32, 0x72, 0x4f, 0x4e, 0xa7, 
-	0xf1, 0x15, 0x52, 0xd6, 0x45, 0x8f, 0x4e, 0xba, 0x6c, 0x8d, 0xcc, 0x9b, 0x14, 
-	0x1e, 0xbc, 0x95, 0xfe, 0x99, 0xad, 0x4f, 0x11, 0x39, 0x88, 0xc , 0xc , 0x89, 
-	0x23, 0x20, 0x7b, 0xc , 0xa9, 0xfe, 0x49, 0xfa, 0xd6, 0x39, 0x8b, 0x11, 0x90, 
-	0x7f, 0x86, 0x21, 0x27, 0xe8, 0x7 , 0xf5, 0xac, 0x24, 0xb5, 0x3b, 0x63, 0x2b, 
-	0xc4, 0xb3, 0x7d, 0x1b, 0x47, 0x67, 0x22, 0xe , 0x4d, 0xbc, 0xa1, 0x97, 0xe8, 
-	0x78, 0xff, 0x0 , 0xa , 0xea, 0xf4, 0xb7, 0x13, 0xdb, 0xdb, 0xdc, 0x29, 0x24, 
-	0x18, 0xb0, 0x3f, 0x0 , 0x1 , 0xfe, 0x55, 0x85, 0xab, 0x45, 0xba, 0x40, 0x40, 
-	0xf9, 0x64, 0x4d, 0x8d, 0xf5, 0x27, 0x22, 0xb4, 0x7c, 0xf , 0x3e, 0xed, 0x33, 
-	0xec, 0xa4, 0x7e, 0xf2, 0xda, 0x46, 0x52, 0x3d, 0x8f, 0xff, 0x0 , 0x5f, 0x35, 
-	0x71, 0xf8, 0x8c, 0x2a, 0x6b, 0x1b, 0x90, 0x78, 0x82, 0x2d, 0xb0, 0xcf, 0xc7, 
-	0xb , 0x72, 0x31, 0xe9, 0x8c, 0x11, 0xfc, 0xf1, 0x59, 0xba, 0xca, 0xa8, 0x93, 
-	0x78, 0x39, 0x5f, 0x2f, 0x83, 0xef, 0x8f, 0xf1, 0xc5, 0x6f, 0xeb, 0x70, 0x9b, 
-	0xa9, 0x25, 0xb4, 0x8b, 0x7 , 0x71, 0xdc, 0x49, 0x3d, 0x30, 0x32, 0x3f, 0x5f, 
-	0xe7, 0x58, 0x5a, 0xc4, 0x53, 0xa6, 0x9f, 0x1f, 0x9b, 0x3 , 0x21, 0xc6, 0xd0, 
-	0x4a, 0xed, 0xfa, 0xff, 0x0 , 0x9f, 0x6a, 0x52, 0x8b, 0xe8, 0x38, 0xc9, 0x59, 
-	0x5d, 0x98, 0x73, 0x21, 0x57, 0xda, 0x46, 0x31, 0x44, 0x63, 0x7b, 0x1 , 0xcd, 
-	0x2b, 0x6 , 0x7e, 0x32, 0x7 , 0xb9, 0xa7, 0xb5, 0xac, 0xd1, 0xc3, 0xe6, 0xa9, 
-	0x53, 0x8e, 0xa0, 0x1e, 0x47, 0xbd, 0x66, 0xa2, 0xcb, 0x95, 0x48, 0xad, 0x2e, 
-	0x5c, 0x5b, 0x27, 0x8c, 0x26, 0x57, 0x1c, 0xe0, 0xb7, 0xa9, 0xf4, 0xe3, 0xea, 
-	0x2a, 0xdd, 0xbc, 0x71, 0x9 , 0xa , 0x9f, 0x94, 0x95, 0x56, 0x27, 0xd7, 0x9e, 
-	0xe7, 0xb7, 0xd7, 0xda, 0xa8, 0xd8, 0xea, 0x3b, 0x3f, 0xd6, 0xc , 0x9e, 0x70, 
-	0xc7, 0xa8, 0x38, 0xeb, 0xfa, 0xa , 0xd1, 0xd3, 0x64, 0xb7, 0x95, 0x4c, 0xb2, 
-	0x1c, 0x15, 0x8c, 0xf6, 0xeb, 0xcf, 0xff, 0x0 , 0xab, 0xf4, 0xab, 0x56, 0x33, 
-	0x93, 0x66, 0x4e, 0xb9, 0x26, 0xeb, 0xe6, 0xb , 0x8d, 0xab, 0x80, 0x48, 0xef, 
-	0xfe, 0x71, 0x55, 0xed, 0xd4, 0x79, 0x87, 0x79, 0x2a, 0x3b, 0xfb, 0x53, 0xf5, 
-	0x3d, 0xc2, 0xe9, 0xd9, 0xba, 0x48, 0x77, 0xf , 0xd4, 0x55, 0xab, 0x70, 0xd , 
-	0xf3, 0xa6, 0xcd, 0xdb, 0xd0, 0x75, 0x3d, 0x48, 0xe0, 0xe3, 0xd6, 0xa5, 0xad, 
-	0x46, 0x9e, 0x85, 0x29, 0x83, 0x43, 0x36, 0xec, 0x15, 0xdc, 0x3d, 0x7f, 0xcf, 
-	0xad, 0x2d, 0xc4, 0xe6, 0x4f, 0x94, 0x70, 0xbc, 0x7e, 0x26, 0x9f, 0xa8, 0x10, 
-	0xb8, 0x8c, 0x31, 0x6c, 0x8f, 0xc8, 0x7a, 0x7f, 0x3a, 0xad, 0x49, 0x8e, 0x3d, 
-	0xc0, 0x2 , 0x78, 0xe4, 0xd5, 0xc8, 0x6c, 0xca, 0x44, 0xb3, 0x4e, 0x76, 0xa9, 
-	0x3c, 0x2f, 0x73, 0x45, 0x8a, 0xc7, 0x1a, 0x99, 0x25, 0x5c, 0xee, 0x1f, 0x2f, 
-	0x3d, 0x3d, 0xc7, 0xbf, 0xf9, 0xeb, 0x45, 0xe5, 0xc8, 0x99, 0x86, 0xd0, 0x14, 
-	0x28, 0xdb, 0x81, 0xe8, 0x3f, 0x95, 0x1b, 0xe , 0xf7, 0x61, 0x23, 0x6d, 0x8c, 
-	0xc8, 0xbd, 0x54, 0xe3, 0xda, 0xaf, 0xf8, 0x47, 0x4c, 0x7b, 0xdb, 0xcf, 0xb5, 
-	0x3a, 0x9f, 0x2a, 0xf , 0x99, 0xbd, 0xcf, 0xa6, 0x6a, 0xd , 0x17, 0x4b, 0xb9, 
-	0xd4, 0xee, 0x14, 0x2a, 0xb2, 0xc0, 0xf , 0x2d, 0xb7, 0xaf, 0xd3, 0xd4, 0xd7, 
-	0x54, 0xfa, 0x96, 0x95, 0xa0, 0x69, 0xdf, 0x65, 0x96, 0x45, 0x69, 0x61, 0x63, 
-	0x88, 0x23, 0x3b, 0x98, 0xf1, 0xd5, 0x8f, 0x41, 0xc1, 0xfc, 0xc5, 0x5c, 0x63, 
-	0x73, 0x2a, 0x93, 0xe9, 0xd4, 0xcd, 0xf1, 0x7d, 0xa9, 0x9a, 0xdd, 0xdd, 0xf8, 
-	0x31, 0x70, 0x98, 0x1d, 0x82, 0xee, 0x1c, 0x7d, 0x38, 0xae, 0x52, 0x57, 0x52, 
-	0x80, 0x92, 0x32, 0x7b, 0x7b, 0xe2, 0xaf, 0xeb, 0xda, 0xfd, 0xc5, 0xff, 0x0 , 
-	0xcb, 0x1a, 0x88, 0x63, 0x4 , 0xf4, 0xfb, 0xcd, 0xf5, 0x35, 0x90, 0xa3, 0x2d, 
-	0x93, 0x4e, 0x5b, 0x99, 0xa1, 0x59, 0xb7, 0x1 , 0x9e, 0xc2, 0x9c, 0x3a, 0x53, 
-	0x71, 0x4e, 0x5e, 0x45, 0x22, 0x90, 0xb9, 0xf7, 0xa5, 0xfc, 0x69, 0x31, 0xed, 
-	0x4b, 0xf8, 0x50, 0x58, 0xfc, 0xf2, 0xf , 0xaf, 0x5a, 0x69, 0x18, 0xa5, 0x53, 
-	0xf2, 0x91, 0xfd, 0xde, 0x68, 0x6e, 0x4e, 0x7d, 0x6b, 0x45, 0xaa, 0x31, 0x9a, 
-	0xb3, 0x23, 0x8c, 0x85, 0x98, 0x63, 0xbf, 0x5a, 0xbd, 0x9 , 0xac, 0xf9, 0x6 , 
-	0xe , 0x6a, 0xed, 0xb3, 0x65, 0x41, 0xf6, 0xac, 0x98, 0xe2, 0x5d, 0x84, 0x83, 
-	0x53, 0xc6, 0x32, 0x6a, 0xb4, 0x27, 0x15, 0x66, 0x1e, 0xb5, 0x26, 0xa4, 0xa9, 
-	0x52, 0x2d, 0x31, 0x2a, 0x45, 0x1c, 0xd6, 0xf0, 0x60, 0x3e, 0x37, 0x74, 0xfb, 
-	0xad, 0xdf, 0xf0, 0xab, 0xb , 0x76, 0xe3, 0xaf, 0xf3, 0xaa, 0xe0, 0xa , 0x30, 
-	0x2b, 0xa2, 0x20, 0x5b, 0x17, 0xb8, 0xee, 0x69, 0xc2, 0xf8, 0x77, 0x6a, 0xa5, 
-	0x48, 0xd4, 0x72, 0x81, 0x7b, 0xfb, 0x41, 0x47, 0xf1, 0xa , 0x46, 0xd4, 0xd4, 
-	0x7f, 0x15, 0x67, 0x38, 0xa8, 0xca, 0xd4, 0xfb, 0x34, 0xc3, 0x99, 0xa3, 0x4a, 
-	0x4d, 0x5f, 0x68, 0xc2, 0x96, 0x35, 0x52, 0xeb, 0x56, 0xb8, 0x6e, 0x13, 0x8f, 
-	0x72, 0x6a, 0xa3, 0x74, 0xa8, 0xd8, 0x53, 0x54, 0x61, 0xd8, 0x6e, 0xa4, 0xbb, 
-	0x90, 0x5e, 0x4a, 0xee, 0x4b, 0xca, 0xec, 0xc7, 0xd4, 0x9a, 0xa3, 0x1f, 0xae, 
-	0x39, 0xce, 0x49, 0xab, 0x37, 0xc7, 0x11, 0xed, 0xee, 0xdc, 0x55, 0x7f, 0x5c, 
-	0x54, 0x54, 0x76, 0x76, 0x30, 0x96, 0xac, 0x93, 0xcc, 0x66, 0xe6, 0xb4, 0xb4, 
-	0x60, 0xcf, 0x21, 0x99, 0xf1, 0xf2, 0x8d, 0xaa, 0x71, 0x59, 0xb0, 0x9c, 0xc , 
-	0x8f, 0xc8, 0xd6, 0xde, 0x9b, 0x1e, 0xcb, 0x65, 0x5f, 0x6c, 0xd7, 0x25, 0x47, 
-	0xa1, 0xea, 0x65, 0x34, 0x54, 0xab, 0x73, 0x76, 0x2c, 0xb9, 0xf9, 0x40, 0x14, 
-	0xb1, 0xad, 0x34, 0xfd, 0xec, 0x54, 0x8b, 0xc5, 0x60, 0x7d, 0x46, 0xc8, 0x6 , 
-	0x29, 0x59, 0xf1, 0x4d, 0x26, 0x8e, 0xbc, 0xe2, 0x81, 0xa0, 0x66, 0x26, 0x98, 
-	0xdc, 0xf0, 0x29, 0x5a, 0xac, 0x69, 0xb6, 0xfe, 0x74, 0xca, 0xa4, 0x85, 0xdc, 
-	0x71, 0x93, 0xda, 0x96, 0xa5, 0xa5, 0x76, 0x25, 0xbc, 0x5b, 0x17, 0x24, 0x52, 
-	0x5c, 0x60, 0x2d, 0x6c, 0xf8, 0x8a, 0x2b, 0x7b, 0x7f, 0x2e, 0x18, 0x5b, 0x38, 
-	0x50, 0x48, 0xc7, 0x3d, 0x3b, 0xd6, 0x15, 0xc9, 0x2c, 0xc1, 0x7d, 0x4d, 0xd , 
-	0x58, 0xd3, 0x99, 0x72, 0x26, 0x88, 0xa3, 0x8f, 0x70, 0xce, 0x3a, 0xd3, 0x2e, 
-	0xad, 0x12, 0x58, 0xca, 0xb8, 0xff, 0x0 , 0xeb, 0x55, 0xe8, 0x53, 0xa , 0x38, 
-	0xa7, 0xb4, 0x40, 0x8f, 0x97, 0xf2, 0xa4, 0x4b, 0xa0, 0xa5, 0x1b, 0x34, 0x71, 
-	0xb7, 0x96, 0xf2, 0x41, 0x33, 0x46, 0xc0, 0xfc, 0xbd, 0xfd, 0xa9, 0xaa, 0xd8, 
-	0x19, 0x1c, 0x9f, 0x53, 0xda, 0xb7, 0xbc, 0x43, 0x6e, 0x43, 0x47, 0x3a, 0x9c, 
-	0x1f, 0xba, 0x71, 0xfa, 0x55, 0x38, 0x6d, 0x22, 0xba, 0xca, 0x60, 0x47, 0x2e, 
-	0x3a, 0x81, 0xd7, 0xf0, 0xad, 0xbe, 0xcd, 0xcf, 0x96, 0xab, 0x86, 0x70, 0xc4, 
-	0xca, 0x84, 0x5e, 0xbd, 0x3c, 0xcc, 0xa5, 0x3b, 0xb3, 0x92, 0x7e, 0x6f, 0x5a, 
-	0x67, 0x4e, 0xd , 0x59, 0xbb, 0xb2, 0x9e, 0xd5, 0xf1, 0x2a, 0x70, 0x4f, 0xc , 
-	0x3a, 0x1a, 0x82, 0x55, 0xc3, 0x66, 0xa8, 0xe1, 0xa9, 0x4e, 0x51, 0x76, 0x92, 
-	0xb3, 0x41, 0xd0, 0x7d, 0x68, 0x5c, 0xe6, 0x86, 0xa7, 0x46, 0xd , 0x2 , 0x4a, 
-	0xf2, 0x24, 0x55, 0xca, 0xe2, 0x9c, 0x99, 0xdb, 0x83, 0x44, 0x7e, 0xde, 0xb5, 
-	0x30, 0x8f, 0x3c, 0x7a, 0x9a, 0xcc, 0xec, 0x8c, 0x74, 0xba, 0x23, 0x3e, 0x94, 
-	0xd5, 0x3b, 0x1b, 0x3d, 0xbb, 0xd4, 0xdb, 0x7b, 0x77, 0xed, 0x46, 0xcd, 0xcb, 
-	0xb4, 0x8e, 0x7b, 0xd1, 0x72, 0xdc, 0x1e, 0xe8, 0x51, 0xf3, 0x2 , 0x83, 0xf8, 
-	0x87, 0x18, 0xa7, 0xdb, 0xaf, 0x9b, 0x1e, 0xcc, 0xe1, 0xd7, 0x95, 0xa8, 0x20, 
-	0xc8, 0x6d, 0xb9, 0xf9, 0x97, 0xf5, 0x15, 0x2b, 0x65, 0x25, 0x59, 0x53, 0x20, 
-	0xe7, 0xf2, 0x35, 0x2d, 0x17, 0x7 , 0x7d, 0x59, 0x2d, 0x93, 0x94, 0x93, 0x60, 
-	0x38, 0x2a, 0x72, 0xb5, 0xd0, 0x59, 0xb2, 0xb4, 0x41, 0x82, 0x8c, 0xb6, 0x32, 
-	0xf , 0x43, 0xfe, 0x15, 0x81, 0x78, 0x80, 0x14, 0x9e, 0x31, 0x85, 0x61, 0x9e, 
-	0x3f, 0x5a, 0xd1, 0xd1, 0xe6, 0x33, 0xb2, 0x42, 0x39, 0xdc, 0xd5, 0x8d, 0x45, 
-	0x7d, 0x51, 0xe9, 0xe1, 0x25, 0xc9, 0x2f, 0x67, 0x23, 0x46, 0x48, 0x4f, 0xf6, 
-	0xd4, 0x3b, 0x58, 0xed, 0x91, 0x8 , 0x65, 0x27, 0xa1, 0xf4, 0x3f, 0xca, 0xad, 
-	0x3c, 0x2f, 0xb9, 0xe3, 0xc1, 0xda, 0xf , 0xcc, 0xd , 0x55, 0xbc, 0x97, 0xcb, 
-	0xd5, 0xed, 0x4b, 0x7d, 0xe2, 0xe , 0x8 , 0xe8, 0xc3, 0x3 , 0x19, 0xad, 0xa8, 
-	0xbc, 0xb9, 0xe3, 0xb8, 0x2b, 0xb9, 0x77, 0x0 , 0x3 , 0x13, 0xc8, 0x38, 0xce, 
-	0xf , 0xb7, 0xbd, 0x61, 0x25, 0x7b, 0x33, 0xd3, 0xa3, 0x34, 0x9c, 0xa2, 0xf5, 
-	0x57, 0xfd, 0xc , 0xeb, 0x48, 0x25, 0x81, 0x7c, 0xc5, 0xf9, 0x91, 0x46, 0x1c, 
-	0xe , 0x78, 0xfa, 0x7f, 0x4a, 0xd9, 0x8e, 0x48, 0xfe, 0xc9, 0xe7, 0xc6, 0x7e, 
-	0x4c, 0x0 , 0x6 , 0x7f, 0x3c, 0x7f, 0x85, 0x50, 0xb7, 0x2d, 0xca, 0xb8, 0xa , 
-	0xdb, 0xca, 0x82, 0xf , 0x7 , 0x14, 0xdb, 0x96, 0x96, 0x19, 0x8e, 0xdc, 0xac, 
-	0x5d, 0x5d, 0x7a, 0xae, 0x6a, 0x2e, 0xdb, 0xb7, 0x53, 0xa3, 0x96, 0x31, 0x87, 
-	0x32, 0xd5, 0x7e, 0x45, 0x44, 0x51, 0x1d, 0xfb, 0x4b, 0x20, 0x2d, 0x19, 0x4d, 
-	0xc7, 0x3c, 0x32, 0xe4, 0x8e, 0x95, 0x67, 0xc4, 0xb0, 0x1 , 0x6c, 0x39, 0xce, 
-	0x19, 0x70, 0x71, 0xeb, 0x9a, 0xd2, 0xd3, 0x61, 0xb7, 0x95, 0xa6, 0x2c, 0xbc, 
-	0x6c, 0x51, 0xc6, 0x7d, 0xff, 0x0 , 0xfa, 0xd5, 0x63, 0xc4, 0x71, 0x46, 0x34, 
-	0xff, 0x0 , 0x95, 0x46, 0xd0, 0x13, 0x95, 0x3d, 0xf , 0x35, 0xa4, 0x6a, 0x5a, 
-	0x46, 0x35, 0x70, 0x8a, 0xa5, 0x3b, 0xdf, 0x6d, 0x8c, 0x1d, 0xd , 0xb1, 0x66, 
-	0x8e, 0x3e, 0xe8, 0x91, 0x81, 0xfa, 0x1a, 0xd0, 0xbc, 0x6c, 0x79, 0x73, 0x1 , 
-	0xca, 0x38, 0x39, 0xfc, 0xaa, 0x5f, 0x8 , 0x5a, 0x47, 0x3e, 0x87, 0x75, 0xfb, 
-	0xb1, 0xff, 0x0 , 0x1f, 0xe , 0x13, 0x3f, 0x4f, 0x5a, 0xd3, 0xba, 0xb1, 0x86, 
-	0x5d, 0x2c, 0xa0, 0x88, 0x89, 0x3c, 0xae, 0x79, 0xee, 0x2b, 0xa2, 0x35, 0xa2, 
-	0x93, 0x89, 0xe6, 0xd5, 0xc0, 0xd5, 0x94, 0xa9, 0xd4, 0x4d, 0x68, 0xff, 0x0 , 
-	0x7 , 0xd3, 0xf3, 0x28, 0x33, 0x9c, 0x2 , 0x3a, 0x66, 0x8f, 0x98, 0xb7, 0x1d, 
-	0xc5, 0x69, 0xd9, 0xdb, 0xdb, 0x3d, 0x8c, 0x4c, 0x61, 0x93, 0x73, 0x20, 0xc9, 
-	0xdc, 0x31, 0xfe, 0x78, 0xa7, 0xcd, 0x6b, 0x0 , 0x55, 0x6d, 0x98, 0x19, 0xe0, 
-	0x93, 0x8f, 0xeb, 0x5d, 0x51, 0xc5, 0x40, 0xf1, 0x6a, 0x64, 0xb8, 0x84, 0xde, 
-	0xa8, 0xca, 0xda, 0xde, 0x86, 0x8d, 0xa6, 0xad, 0xcc, 0xd0, 0xa7, 0x1 , 0x93, 
-	0x3f, 0x5a, 0xad, 0x24, 0xa1, 0xb8, 0x15, 0xb4, 0x6a, 0xf3, 0x6c, 0x8e, 0xa , 
-	0x98, 0x35, 0x4f, 0xe2, 0x92, 0xb9, 0x1e, 0x47, 0xbd, 0x25, 0x1f, 0x5e, 0xbe, 
-	0xf4, 0x56, 0xc7, 0x14, 0xac, 0x82, 0x8f, 0xc6, 0x8f, 0xc2, 0x90, 0xfd, 0x28, 
-	0x24, 0x3f, 0x1a, 0x43, 0x45, 0x14, 0x0 , 0x53, 0x4d, 0x19, 0xa2, 0x80, 0xa , 
-	0x4c, 0xd0, 0xd4, 0x94, 0x0 , 0x51, 0x9a, 0x28, 0xfc, 0x28, 0x1 , 0x3f, 0x1a, 
-	0x33, 0x43, 0x7d, 0x29, 0x29, 0xec, 0x1 , 0x46, 0x68, 0x34, 0xda, 0x60, 0x14, 
-	0x8d, 0x4a, 0x69, 0xb4, 0x0 , 0x51, 0x45, 0x1f, 0x85, 0x0 , 0x1f, 0x8d, 0x35, 
-	0xa9, 0x4f, 0xd2, 0x92, 0x80, 0xa , 0x6b, 0x7a, 0xd2, 0xb5, 0x25, 0x0 , 0x14, 
-	0x8d, 0x4a, 0x69, 0xb4, 0x0 , 0x51, 0xf8, 0xd1, 0x47, 0xe1, 0x40, 0x7 , 0xe3, 
-	0x4d, 0x6a, 0x53, 0xf4, 0xa4, 0xa0, 0x2 , 0x9a, 0x68, 0xcd, 0x14, 0x0 , 0x53, 
-	0x4d, 0x19, 0xa2, 0x98, 0x5 , 0x1f, 0x8d, 0x1f, 0x85, 0x1f, 0x85, 0x30, 0x10, 
-	0xd2, 0x51, 0x45, 0x0 , 0x4a, 0xb4, 0xb4, 0x8b, 0x4b, 0x40, 0xe , 0xfc, 0x68, 
-	0xfc, 0x69, 0x7 , 0xd2, 0x97, 0xf0, 0xa0, 0x2 , 0x94, 0x1a, 0x4a, 0x28, 0x1 , 
-	0xc2, 0x9d, 0x4d, 0xa5, 0x5a, 0x0 , 0x55, 0xa7, 0x7e, 0x34, 0xda, 0x51, 0xf4, 
-	0xa0, 0x5 , 0xfc, 0x68, 0xa3, 0xf0, 0xa2, 0x80, 0x1d, 0x9a, 0x50, 0x69, 0xab, 
-	0x4b, 0x40, 0xe , 0xa5, 0x14, 0xd0, 0x69, 0x68, 0x1 , 0xdf, 0x8d, 0x1f, 0x8d, 
-	0x20, 0xfa, 0x52, 0xfe, 0x14, 0x0 , 0x52, 0xad, 0x25, 0x19, 0xa0, 0x7 , 0xad, 
-	0x2d, 0x36, 0x9c, 0x29, 0x0 , 0x52, 0xaf, 0xd6, 0x92, 0x8a, 0x0 , 0x77, 0xe3, 
-	0x45, 0x1f, 0x85, 0x1f, 0x85, 0x20, 0x1 , 0x4e, 0xa6, 0xd1, 0x9a, 0x0 , 0x75, 
-	0x2a, 0xd2, 0x51, 0x9a, 0x0 , 0x75, 0x14, 0x51, 0x40, 0xe , 0xfc, 0x68, 0xfc, 
-	0x68, 0xfc, 0x28, 0xfc, 0x28, 0x0 , 0xa2, 0x8f, 0xc2, 0x8a, 0x0 , 0x29, 0xd9, 
-	0xc5, 0x36, 0x8a, 0x0 , 0x70, 0xa7, 0x66, 0x9b, 0x46, 0xd , 0x0 , 0x45, 0xa8, 
-	0x73, 0x6f, 0x8f, 0xf3, 0xd2, 0xb3, 0x61, 0xc8, 0x8e, 0x43, 0xfd, 0xe5, 0x3f, 
-	0xd4, 0xd6, 0xbd, 0xc5, 0xb4, 0xb2, 0x26, 0xdc, 0x6d, 0xeb, 0xc9, 0xa6, 0xc3, 
-	0x61, 0xc , 0x69, 0xf3, 0x29, 0x93, 0x1d, 0x77, 0x74, 0xab, 0x54, 0x67, 0x20, 
-	0xf6, 0xd1, 0x8a, 0x38, 0xef, 0x14, 0xc5, 0x2b, 0xc6, 0xa9, 0xc , 0x6e, 0xf2, 
-	0x9 , 0x36, 0xed, 0x55, 0x24, 0xfd, 0xdf, 0x4f, 0xc6, 0x9f, 0xff, 0x0 , 0x8 , 
-	0xc6, 0xa7, 0x79, 0x3c, 0x7e, 0x5c, 0x4b, 0xc , 0x22, 0xdc, 0x21, 0x69, 0x5b, 
-	0x1c, 0xe3, 0xd0, 0x73, 0xde, 0xbb, 0x54, 0x96, 0x28, 0xb9, 0x8d, 0x13, 0x3d, 
-	0xc8, 0x1c, 0xe6, 0x9e, 0xd3, 0xc8, 0x23, 0x1b, 0xe3, 0xc6, 0xe1, 0x90, 0xce, 
-	0xbd, 0x7e, 0x95, 0x71, 0xc1, 0xc7, 0xed, 0x32, 0x5e, 0x36, 0x69, 0x7b, 0xa8, 
-	0xc1, 0xff, 0x0 , 0x84, 0x79, 0x5 , 0xb7, 0x95, 0x3d, 0xd1, 0x6c, 0x80, 0x9 , 
-	0x54, 0xe4, 0x60, 0xe , 0x99, 0x35, 0x26, 0x9f, 0xa2, 0xda, 0xda, 0x5c, 0x49, 
-	0x3c, 0x21, 0xbc, 0xc9, 0x40, 0xde, 0x4b, 0x13, 0x9e, 0xfd, 0x7 , 0xb8, 0xad, 
-	0x77, 0x65, 0x62, 0xb , 0xd , 0xb9, 0x1d, 0xa9, 0x15, 0x23, 0x2a, 0x0 , 0x62, 
-	0xa5, 0xba, 0xe4, 0xd6, 0xca, 0x85, 0x35, 0xb2, 0x30, 0x95, 0x7a, 0xaf, 0x76, 
-	0x67, 0xac, 0x71, 0xa6, 0x46, 0xd2, 0xdc, 0xe7, 0x3 , 0x8e, 0x78, 0x1f, 0xd2, 
-	0xa8, 0xde, 0x5a, 0xc5, 0x34, 0x99, 0x78, 0xc3, 0x7d, 0x72, 0x7b, 0xd6, 0xfa, 
-	0x5b, 0xa2, 0xba, 0x93, 0x89, 0x3b, 0x85, 0xf5, 0xa8, 0x35, 0x3d, 0x8a, 0x55, 
-	0x44, 0x61, 0x58, 0xe4, 0xed, 0x6c, 0x70, 0xb8, 0xcf, 0x3c, 0x70, 0x2a, 0xdc, 
-	0x15, 0x88, 0x52, 0x77, 0x39, 0x8b, 0xeb, 0x68, 0x56, 0x36, 0x62, 0xab, 0x9e, 
-	0xc0, 0xd7, 0x3f, 0xa9, 0x5c, 0xc , 0xec, 0x4e, 0xde, 0x95, 0xb3, 0xe2, 0xd , 
-	0x43, 0xef, 0xe , 0x98, 0xe8, 0xb8, 0xe6, 0xb9, 0x89, 0x9 , 0x2d, 0x93, 0x92, 
-	0x7d, 0x2b, 0x8a, 0xac, 0x95, 0xec, 0x8e, 0x9a, 0x6b, 0x4d, 0x49, 0xa7, 0xb2, 
-	0x81, 0xa3, 0x56, 0xb7, 0x97, 0x7b, 0x31, 0xfb, 0xa0, 0x63, 0x1f, 0x9d, 0x41, 
-	0x24, 0x77, 0x36, 0x92, 0x7e, 0xf1, 0x1b, 0x1e, 0xb4, 0xfb, 0x74, 0x46, 0x20, 
-	0x7 , 0x71, 0x27, 0x60, 0x79, 0x53, 0xf8, 0x76, 0xad, 0x54, 0xd4, 0x6c, 0xfe, 
-	0xce, 0xbf, 0x6c, 0x6f, 0x99, 0x70, 0xb2, 0x2e, 0x32, 0x5b, 0xb6, 0x47, 0xd2, 
-	0xb9, 0xe5, 0x5 , 0xba, 0x3a, 0x63, 0x51, 0xec, 0xcc, 0x39, 0x9d, 0x64, 0x8c, 
-	0x9c, 0x92, 0xd9, 0xc8, 0xf6, 0xab, 0x2c, 0xe6, 0x5b, 0x34, 0x91, 0x1b, 0xf7, 
-	0x90, 0xff, 0x0 , 0xe , 0xde, 0xbf, 0xfd, 0x6a, 0x66, 0xaf, 0x71, 0x63, 0x33, 
-	0x3 , 0x69, 0x6e, 0xf1, 0x9f, 0xe2, 0x39, 0xc0, 0x6f, 0xc3, 0xb5, 0x51, 0x59, 
-	0x1d, 0x7e, 0xe9, 0x2b, 0xf4, 0xac, 0xf9, 0x4b, 0xf6, 0x88, 0x97, 0x2d, 0x24, 
-	0x85, 0x8f, 0xaf, 0xe5, 0x4e, 0x85, 0x55, 0x95, 0xa4, 0x7f, 0xb8, 0xbe, 0x9d, 
-	0x49, 0xed, 0x50, 0x2b, 0x30, 0xce, 0x18, 0xf2, 0x39, 0xe6, 0x9e, 0xd2, 0xb1, 
-	0x89, 0x63, 0xe0, 0x2a, 0xf4, 0x0 , 0x75, 0xfa, 0xd2, 0xe5, 0xd4, 0xaf, 0x69, 
-	0x75, 0xb0, 0xf5, 0x24, 0xf5, 0x21, 0x57, 0x3d, 0xfa, 0xa , 0x9e, 0xde, 0x6b, 
-	0x1b, 0x7d, 0xcc, 0xf1, 0xbd, 0xcb, 0xff, 0x0 , 0x8 , 0x3f, 0x2a, 0x3 , 0xef, 
-	0xeb, 0x54, 0xa8, 0xc5, 0x31, 0x73, 0x36, 0x5f, 0xba, 0xd6, 0xf5, 0x9 , 0xa2, 
-	0xf2, 0x92, 0x5f, 0x22, 0x30, 0x30, 0x16, 0x21, 0xb7, 0xf5, 0xeb, 0xfa, 0xd6, 
-	0x71, 0xf5, 0x34, 0xec, 0xa , 0x6b, 0xd0, 0x4d, 0xac, 0x37, 0xa9, 0xa7, 0x62, 
-	0x91, 0x46, 0x4d, 0x48, 0xaa, 0x4f, 0x2 , 0x80, 0x88, 0xcc, 0x53, 0x92, 0x9e, 
-	0xca, 0x17, 0x8e, 0xa7, 0xbd, 0x35, 0x68, 0x28, 0x5f, 0xc6, 0x8f, 0xc6, 0x97, 
-	0x3 , 0x6d, 0x27, 0xe1, 0x41, 0x42, 0xa7, 0xd , 0x4e, 0x5c, 0x95, 0x23, 0xba, 
-	0xd3, 0x29, 0xe0, 0xfe, 0xf3, 0x23, 0xf8, 0x87, 0x6a, 0xa8, 0xb3, 0x3a, 0x8b, 
-	0x42, 0x39, 0x17, 0x22, 0xa5, 0xb0, 0x3d, 0x54, 0xf6, 0x34, 0xd2, 0xd , 0x25, 
-	0xb9, 0xdb, 0x70, 0x3d, 0x1b, 0xbd, 0x12, 0x44, 0x45, 0xea, 0x69, 0xc5, 0x56, 
-	0x61, 0xeb, 0x55, 0xa1, 0x35, 0x66, 0x2e, 0xb5, 0x89, 0xb9, 0x62, 0x31, 0x52, 
-	0x28, 0xa6, 0x25, 0x4c, 0x3a, 0xd6, 0x90, 0xdc, 0x4 , 0xc5, 0x2a, 0x8a, 0x5c, 
-	0x51, 0xcd, 0x75, 0x44, 0x4 , 0xa6, 0xb0, 0xa7, 0xe2, 0x9a, 0x4d, 0x55, 0xc0, 
-	0x8d, 0xaa, 0x36, 0x6 , 0xa6, 0x22, 0xa3, 0x61, 0x9e, 0xd5, 0x42, 0x22, 0x61, 
-	0x51, 0x48, 0x2a, 0x77, 0x15, 0x1b, 0x8e, 0x31, 0x40, 0x8c, 0xbd, 0x40, 0xe6, 
-	0xe1, 0x13, 0xfb, 0xa3, 0x35, 0x1a, 0xe7, 0x8a, 0x26, 0x60, 0xf7, 0x52, 0x37, 
-	0xfb, 0x58, 0xa0, 0x7d, 0xee, 0x2b, 0x96, 0x6e, 0xed, 0x99, 0xad, 0x59, 0x35, 
-	0x9a, 0x7 , 0x91, 0x53, 0x1d, 0x4e, 0x2b, 0x7a, 0x3c, 0x2f, 0x23, 0xb5, 0x64, 
-	0x68, 0xa9, 0xba, 0xe8, 0xb7, 0xf7, 0x45, 0x6b, 0x9f, 0xba, 0x0 , 0xae, 0x5a, 
-	0x9b, 0x9f, 0x4d, 0x94, 0xd3, 0xe5, 0xa2, 0xe5, 0xdd, 0x8f, 0x8c, 0x3 , 0xc9, 
-	0x34, 0xac, 0xd8, 0xe3, 0x3f, 0x8d, 0xc , 0x76, 0xae, 0x2a, 0x33, 0x9e, 0xf5, 
-	0x99, 0xeb, 0x2d, 0x58, 0xea, 0x33, 0x81, 0x49, 0x9a, 0x58, 0xd0, 0xbb, 0x62, 
-	0x82, 0x87, 0xdb, 0xa1, 0x66, 0xc9, 0xf5, 0xad, 0x88, 0xe1, 0x86, 0xd , 0x2f, 
-	0xce, 0x2f, 0xfb, 0xd2, 0xc0, 0x1 , 0xed, 0x55, 0x6d, 0x51, 0x17, 0x0 , 0x8c, 
-	0x9a, 0x49, 0x1c, 0x95, 0xc7, 0x5f, 0x4a, 0x93, 0xa2, 0x31, 0xb2, 0x12, 0xf2, 
-	0x66, 0x91, 0x8b, 0x31, 0x24, 0x9e, 0xa6, 0xa9, 0xc0, 0xa5, 0xe4, 0x2e, 0x3a, 
-	0x67, 0x2 , 0x96, 0xe9, 0xc9, 0xf9, 0x47, 0xde, 0x6e, 0x95, 0x77, 0x4a, 0xb3, 
-	0x69, 0x5c, 0x46, 0x9d, 0x87, 0x26, 0x9d, 0xae, 0x4e, 0xf2, 0xf2, 0x42, 0xc3, 
-	0x10, 0x65, 0xc7, 0xf1, 0x7a, 0x53, 0x59, 0x48, 0x38, 0x23, 0x15, 0x7d, 0xe0, 
-	0x9 , 0x84, 0x93, 0xa , 0x71, 0xf2, 0xb5, 0x47, 0x22, 0xe7, 0xe5, 0x93, 0xf0, 
-	0x61, 0x4e, 0xc6, 0xca, 0x49, 0x99, 0x1a, 0xe2, 0xee, 0xb4, 0x52, 0x47, 0x47, 
-	0x1f, 0xaf, 0x1f, 0xd6, 0xb2, 0x2d, 0xcb, 0x47, 0x22, 0xb1, 0xfb, 0xc1, 0xb9, 
-	0xfc, 0xeb, 0x6f, 0xc4, 0xc0, 0x43, 0xa7, 0xf2, 0xd9, 0x5 , 0xd3, 0x7 , 0xfe, 
-	0x4 , 0x2b, 0xe , 0xe1, 0x97, 0x73, 0x0 , 0x7a, 0xf2, 0x2b, 0x6a, 0x6a, 0xf1, 
-	0xb1, 0xf2, 0x59, 0xdc, 0xbd, 0x9e, 0x36, 0x33, 0x8e, 0xf6, 0x4f, 0xf1, 0x66, 
-	0xea, 0xa2, 0xc9, 0x16, 0x18, 0x2 , 0x18, 0x72, 0x8 , 0xac, 0xad, 0x53, 0x43, 
-	0x57, 0x52, 0xd6, 0xad, 0xb4, 0xe7, 0xee, 0x9e, 0x87, 0xe9, 0x5a, 0xd6, 0x27, 
-	0x36, 0xea, 0x7d, 0xaa, 0x6a, 0xc5, 0x3b, 0x1f, 0x4b, 0x57, 0xb , 0x47, 0x11, 
-	0x4d, 0x73, 0xab, 0x9c, 0x4c, 0xd6, 0xd3, 0x41, 0x2e, 0xd9, 0xe3, 0x64, 0x3e, 
-	0xe3, 0xaf, 0xd2, 0x85, 0x18, 0x62, 0x2b, 0xb2, 0x9e, 0x8 , 0xe5, 0x8f, 0x64, 
-	0x91, 0xab, 0x2f, 0xa1, 0x15, 0x99, 0x75, 0xa1, 0xc4, 0x5b, 0x75, 0xbb, 0x94, 
-	0x24, 0xfd, 0xd6, 0xe4, 0x55, 0x73, 0x5c, 0xf1, 0x2a, 0xe4, 0xf5, 0x29, 0xbb, 
-	0xd2, 0x77, 0x5f, 0x89, 0x8d, 0x6e, 0x84, 0xb7, 0x1d, 0x49, 0xab, 0x7e, 0x58, 
-	0x33, 0x48, 0x17, 0x95, 0x8c, 0xe3, 0x3e, 0xbf, 0xe7, 0x14, 0xf5, 0xb3, 0x9e, 
-	0xde, 0x75, 0xf3, 0x10, 0x85, 0x53, 0x92, 0xc3, 0x91, 0xc5, 0x59, 0xb0, 0x84, 
-	0xbd, 0xab, 0x1f, 0xba, 0x18, 0xe7, 0xdd, 0xa8, 0xb5, 0xce, 0x3e, 0x59, 0x52, 
-	0x76, 0x92, 0xb1, 0x9f, 0x3a, 0x9c, 0xe4, 0x76, 0xe8, 0x69, 0xa0, 0x65, 0x77, 
-	0xe , 0xbd, 0xea, 0xcd, 0xd4, 0x78, 0x72, 0x99, 0xe3, 0xa8, 0xf6, 0xaa, 0xdf, 
-	0x72, 0x4c, 0x8e, 0xdd, 0x6a, 0x2e, 0x6d, 0xca, 0x96, 0xbd, 0x18, 0xc9, 0xa3, 
-	0x20, 0x9 , 0x57, 0x92, 0x7 , 0x38, 0xa9, 0x99, 0x77, 0xc3, 0x91, 0xdc, 0x64, 
-	0x52, 0xaf, 0xa0, 0xfb, 0xbe, 0xf4, 0xb6, 0x23, 0x64, 0x8d, 0x3 , 0x74, 0x3c, 
-	0xa9, 0xa4, 0xdd, 0xd0, 0xe3, 0xb , 0x4a, 0xdd, 0x1f, 0xe6, 0x48, 0x85, 0x65, 
-	0xd3, 0xc2, 0xe3, 0xe7, 0x46, 0xc7, 0xd7, 0xde, 0xa3, 0xb7, 0x76, 0xb6, 0xbc, 
-	0x52, 0x84, 0x8d, 0xa4, 0x15, 0x34, 0x98, 0xf2, 0xe6, 0x65, 0x7 , 0x8e, 0xd5, 
-	0x6f, 0x51, 0x44, 0x6b, 0x38, 0xe4, 0x41, 0xf3, 0x27, 0xde, 0xe7, 0xb1, 0xff, 
-	0x0 , 0xeb, 0xd4, 0xf5, 0xb7, 0x73, 0x78, 0xc5, 0xb8, 0xf3, 0x2d, 0xe2, 0x69, 
-	0x2c, 0x8b, 0x79, 0xaa, 0xd8, 0xa3, 0x12, 0xb8, 0xd , 0xb4, 0xaf, 0xbf, 0xf9, 
-	0xfd, 0x6b, 0x57, 0xf7, 0x96, 0x53, 0x48, 0x99, 0xe1, 0xc9, 0xc0, 0x1d, 0xc7, 
-	0xb5, 0x73, 0xda, 0x3e, 0x5a, 0xf2, 0x39, 0x8 , 0x2d, 0xe5, 0xaf, 0x4f, 0x7a, 
-	0xe8, 0x96, 0xed, 0x23, 0x8c, 0x19, 0x87, 0x9b, 0x96, 0xde, 0x9e, 0xa2, 0xb3, 
-	0x92, 0x3b, 0xe8, 0xc9, 0x6a, 0xdf, 0x5f, 0xf2, 0x2c, 0x46, 0xf1, 0xc9, 0x6e, 
-	0xb1, 0x7 , 0x4f, 0x3a, 0x4c, 0xe0, 0x37, 0xdd, 0xf7, 0xfa, 0x7f, 0xf5, 0xa9, 
-	0xde, 0x4c, 0xb1, 0xa8, 0x8e, 0x42, 0x77, 0xaa, 0xe5, 0x4b, 0xe , 0xa3, 0xdf, 
-	0xb1, 0xa5, 0xb3, 0xb0, 0x75, 0x65, 0xb9, 0x65, 0xf3, 0x3 , 0x8d, 0xc1, 0x90, 
-	0x67, 0x3 , 0xdc, 0x55, 0xeb, 0xcb, 0x85, 0xfb, 0x1b, 0x24, 0x9f, 0x32, 0x63, 
-	0xe5, 0x6d, 0xbf, 0x32, 0x1f, 0x51, 0x59, 0xca, 0x29, 0x9d, 0x74, 0x6a, 0x49, 
-	0x6e, 0x62, 0x6d, 0x78, 0xb7, 0xc0, 0x9 , 0x56, 0x63, 0xfb, 0x92, 0x49, 0xce, 
-	0x71, 0xf7, 0x4d, 0x5c, 0xd4, 0xa6, 0x99, 0x74, 0xf6, 0xd , 0xcf, 0xca, 0xa0, 
-	0xe7, 0xb1, 0xa9, 0x5a, 0xd3, 0xed, 0x16, 0x2a, 0x54, 0xee, 0x99, 0x7 , 0xcc, 
-	0xf , 0x43, 0xf4, 0xfc, 0xf8, 0xaa, 0x9a, 0x85, 0xdf, 0x99, 0xa6, 0xc9, 0x19, 
-	0x5c, 0x4d, 0x18, 0x39, 0x4 , 0x72, 0x7d, 0x28, 0x8b, 0xbe, 0x8c, 0x55, 0x63, 
-	0xca, 0xaf, 0x17, 0xa7, 0xf5, 0xa1, 0x6f, 0xc0, 0xd3, 0xca, 0xbe, 0x1d, 0x91, 
-	0x63, 0x2b, 0xbf, 0xce, 0x79, 0x8 , 0xe7, 0xc , 0xbd, 0xe , 0x3e, 0x95, 0x66, 
-	0x1d, 0x4e, 0xea, 0x48, 0xdb, 0x3b, 0x7a, 0x95, 0xce, 0x4f, 0xf8, 0xd3, 0x3c, 
-	0x27, 0x1a, 0xc7, 0xa0, 0xdb, 0xb8, 0xe2, 0x45, 0xdc, 0xe0, 0x91, 0xd4, 0x16, 
-	0x35, 0x74, 0x59, 0xc4, 0xb2, 0xbb, 0x3 , 0x88, 0xe5, 0x60, 0xe9, 0x81, 0xd8, 
-	0x8e, 0x47, 0xe0, 0x45, 0x6f, 0x4d, 0xd3, 0xe6, 0xf7, 0x91, 0xc1, 0x88, 0x8e, 
-	0x2b, 0xd8, 0xb7, 0x4e, 0x76, 0x6a, 0xdf, 0xd7, 0xe8, 0xff, 0x0 , 0xe0, 0x99, 
-	0xf6, 0x37, 0x73, 0x35, 0xa8, 0x4f, 0x30, 0x80, 0xbc, 0x60, 0x13, 0x4a, 0xc4, 
-	0xb6, 0x32, 0xdc, 0xe6, 0x9f, 0xa5, 0xc2, 0x82, 0xde, 0x4d, 0xcd, 0x82, 0x25, 
-	0x61, 0xf7, 0x7b, 0x55, 0x87, 0x89, 0x55, 0x57, 0x2c, 0xbf, 0x8a, 0x9a, 0xec, 
-	0xa7, 0x2a, 0x4a, 0x2b, 0x43, 0xc1, 0xc5, 0x51, 0xc5, 0xce, 0xa3, 0x72, 0x95, 
-	0xfe, 0x65, 0x4c, 0x1a, 0x4c, 0x1f, 0x4a, 0xb1, 0x26, 0xc1, 0xfc, 0x5f, 0x80, 
-	0x5a, 0x8d, 0x8f, 0x1c, 0x29, 0xfc, 0x4d, 0x74, 0x29, 0xa7, 0xb2, 0x3c, 0xe9, 
-	0xe1, 0xa7, 0x1f, 0x89, 0x91, 0xd1, 0xf8, 0xd1, 0xc9, 0xff, 0x0 , 0xeb, 0xa , 
-	0x3f, 0xa , 0xb3, 0x9d, 0xab, 0x9 , 0xf8, 0xd1, 0x9a, 0x4a, 0x28, 0x24, 0x28, 
-	0xcd, 0x6 , 0x9b, 0x40, 0x5 , 0x19, 0xa0, 0xd3, 0x68, 0x1 , 0x49, 0xa4, 0xa2, 
-	0x8a, 0x0 , 0x3f, 0x1a, 0x41, 0xf5, 0xa5, 0xfc, 0x29, 0xf , 0xd2, 0x98, 0x1 , 
-	0xa4, 0xa2, 0x90, 0x9a, 0x60, 0xd , 0x49, 0x45, 0x14, 0x0 , 0x84, 0xd2, 0x51, 
-	0x45, 0x0 , 0x1f, 0x8d, 0x1f, 0x8d, 0x1f, 0x85, 0x21, 0xfa, 0x50, 0x2 , 0x51, 
-	0x9a, 0x29, 0x1a, 0x80, 0x12, 0x8a, 0x29, 0x9 , 0xa0, 0x4 , 0xa2, 0x8a, 0x28, 
-	0x0 , 0xfc, 0x69, 0x33, 0xef, 0x4b, 0xf8, 0x53, 0x4d, 0x0 , 0x14, 0x50, 0x69, 
-	0x33, 0x40, 0x9 , 0x46, 0x68, 0x34, 0xda, 0x68, 0x2 , 0x8f, 0xc6, 0x8a, 0x3f, 
-	0xa , 0x60, 0x1f, 0x8d, 0x35, 0xa9, 0x4f, 0xd2, 0x92, 0x80, 0xa , 0x69, 0xa5, 
-	0x6a, 0x4a, 0x0 , 0x9a, 0x94, 0x1a, 0x4a, 0x29, 0x80, 0xe1, 0x4b, 0xf8, 0xd2, 
-	0x51, 0x48, 0x7 , 0x7e, 0x34, 0x51, 0xf8, 0x51, 0x40, 0xe , 0xcd, 0x14, 0x8b, 
-	0x4b, 0x40, 0xe , 0xa5, 0x14, 0xd0, 0x69, 0x68, 0x1 , 0x73, 0xef, 0x4b, 0xf8, 
-	0xd3, 0x56, 0x9d, 0xf8, 0x50, 0x1 , 0x4a, 0xb4, 0x94, 0x66, 0x80, 0x1c, 0x29, 
-	0xd4, 0xda, 0x33, 0x40, 0xe , 0x5e, 0x29, 0x7f, 0x1a, 0x4a, 0x28, 0x1 , 0xdf, 
-	0x8d, 0x14, 0x7e, 0x14, 0x50, 0x2 , 0xad, 0x2d, 0x36, 0x9c, 0x28, 0x0 , 0x14, 
-	0xea, 0x6d, 0x2a, 0xd0, 0x3 , 0xb3, 0x47, 0xe3, 0x49, 0x4a, 0xbf, 0x4a, 0x0 , 
-	0x5c, 0xd1, 0x47, 0xe1, 0x45, 0x48, 0xa , 0xb4, 0xb4, 0xda, 0x5c, 0xd0, 0x2 , 
-	0x8a, 0x5c, 0xd2, 0x51, 0x40, 0xe , 0xe6, 0x94, 0x52, 0x51, 0x40, 0xe , 0xfc, 
-	0x68, 0xa4, 0xeb, 0x47, 0xe1, 0x40, 0xb , 0x4a, 0xa0, 0x93, 0x80, 0x32, 0x7d, 
-	0x5 , 0x4b, 0x67, 0x69, 0x25, 0xc1, 0xc8, 0xc2, 0xa8, 0xea, 0xc7, 0xa5, 0x5d, 
-	0x4b, 0x71, 0xb , 0x1 , 0x19, 0x1b, 0xbf, 0xbd, 0x9a, 0xda, 0x9d, 0x19, 0x4b, 
-	0x57, 0xb1, 0x9c, 0xea, 0xa8, 0xfa, 0x95, 0xe1, 0xb2, 0x72, 0xbe, 0x64, 0xb9, 
-	0x55, 0xfa, 0x53, 0xd4, 0xc7, 0x1f, 0xdc, 0xf9, 0x79, 0xfb, 0xdd, 0xea, 0x49, 
-	0x1e, 0x52, 0xd8, 0x25, 0x98, 0xf6, 0xd , 0xde, 0xa3, 0xfb, 0x33, 0x38, 0x2c, 
-	0xe9, 0xb5, 0x7b, 0xb1, 0x20, 0xf , 0xa7, 0x35, 0xd5, 0x1a, 0x71, 0x8e, 0xc8, 
-	0xe7, 0x94, 0xe5, 0x2d, 0xc3, 0xcf, 0x50, 0x36, 0x8c, 0x39, 0xf5, 0xa8, 0xd1, 
-	0x16, 0x46, 0x26, 0x46, 0x21, 0x73, 0xd4, 0x53, 0xae, 0xa5, 0xb3, 0xb6, 0x2a, 
-	0x24, 0x66, 0x7f, 0x64, 0x18, 0x3 , 0xea, 0x4f, 0x3f, 0xa5, 0x56, 0x6d, 0x6a, 
-	0x18, 0x57, 0xf7, 0x31, 0x46, 0xac, 0xf , 0x3f, 0xc5, 0xfc, 0xfa, 0x56, 0x84, 
-	0xa8, 0xbe, 0x88, 0x9f, 0xec, 0xb2, 0x99, 0x33, 0x6 , 0x59, 0x7f, 0xbc, 0x17, 
-	0xa5, 0x23, 0x5b, 0xba, 0xb1, 0x13, 0x5c, 0x20, 0xe3, 0xb9, 0xdc, 0x7f, 0xe , 
-	0xf5, 0x91, 0x7d, 0xae, 0xcc, 0xeb, 0xfb, 0xd9, 0xf0, 0xa3, 0xb1, 0x6a, 0xcd, 
-	0x6d, 0x52, 0x49, 0x5f, 0x11, 0x19, 0x64, 0xff, 0x0 , 0x71, 0x49, 0x15, 0x2f, 
-	0x95, 0x75, 0x2b, 0xd9, 0xc8, 0xe9, 0xe4, 0x9a, 0xca, 0x2d, 0xc1, 0xa4, 0x69, 
-	0x39, 0xec, 0xa1, 0x41, 0x1f, 0x89, 0xfe, 0x94, 0xc6, 0xd5, 0xad, 0x63, 0xc1, 
-	0x8e, 0x18, 0xfe, 0x5e, 0xb9, 0xe4, 0x9a, 0xe3, 0xaf, 0x35, 0x19, 0xd5, 0x72, 
-	0xd0, 0xb0, 0x3e, 0xae, 0xdf, 0xd2, 0xaa, 0x35, 0xfd, 0xc1, 0x2c, 0x3c, 0xc5, 
-	0x51, 0x80, 0x41, 0x2 , 0x97, 0xb4, 0x4b, 0x62, 0xd5, 0x25, 0xd4, 0xed, 0xa5, 
-	0xd5, 0xc1, 0x85, 0x8a, 0x3b, 0x80, 0xc7, 0xb7, 0x40, 0x7b, 0x7f, 0x5a, 0xc7, 
-	0xd4, 0xf5, 0x16, 0x6b, 0x7b, 0x89, 0x19, 0x82, 0xab, 0x70, 0x9 , 0x3c, 0xed, 
-	0x1d, 0x5 , 0x60, 0xc9, 0x74, 0xe4, 0x2 , 0x65, 0x91, 0x87, 0xf7, 0x41, 0xff, 
-	0x0 , 0xa , 0x87, 0xce, 0xd8, 0x9b, 0x58, 0x29, 0x3d, 0x79, 0x50, 0x71, 0xf8, 
-	0xd4, 0x4e, 0xa5, 0xd1, 0x71, 0x82, 0x45, 0x4d, 0x62, 0xe1, 0x5e, 0x42, 0xa9, 
-	0x92, 0x33, 0x9c, 0x81, 0xd4, 0xd5, 0x29, 0xfe, 0x66, 0x56, 0x7 , 0xa8, 0xab, 
-	0x3a, 0x82, 0x96, 0x97, 0x79, 0x27, 0xfd, 0x9f, 0x4a, 0xa5, 0x2b, 0x10, 0xab, 
-	0xc6, 0x3d, 0xab, 0xce, 0x96, 0xe6, 0xeb, 0x61, 0x97, 0x12, 0x10, 0xdb, 0x51, 
-	0xb0, 0x47, 0x52, 0xd , 0x45, 0x4b, 0xf8, 0x51, 0xf8, 0x54, 0x8c, 0x4a, 0x46, 
-	0xa7, 0x63, 0xda, 0x93, 0x1f, 0x30, 0x14, 0x9e, 0x88, 0x6b, 0x70, 0xc7, 0xbd, 
-	0x18, 0xf7, 0xa7, 0x51, 0x8f, 0x6a, 0xcc, 0xde, 0xc3, 0x71, 0xef, 0x46, 0x3d, 
-	0xe9, 0xec, 0x84, 0x7a, 0x51, 0xb4, 0x7b, 0x53, 0xb0, 0xc6, 0x54, 0x6d, 0xd6, 
-	0xa4, 0x6a, 0x8e, 0x91, 0x9c, 0xc9, 0x6d, 0xc0, 0x2d, 0xc9, 0xa5, 0x3c, 0x71, 
-	0x9a, 0x6c, 0x7f, 0x76, 0x9d, 0x4c, 0xb8, 0xad, 0x3 , 0xf1, 0xa6, 0x9f, 0xbd, 
-	0x4e, 0xfc, 0x29, 0x1a, 0x90, 0xc7, 0xa7, 0x4c, 0x53, 0x48, 0xc1, 0xa7, 0x2d, 
-	0x3e, 0x55, 0x1b, 0x45, 0x3 , 0x22, 0xa5, 0x1f, 0x77, 0x20, 0xf2, 0xd , 0x25, 
-	0x2a, 0xfa, 0x7a, 0xf1, 0x4d, 0x6e, 0x26, 0xae, 0x87, 0xb1, 0xcf, 0x22, 0xa3, 
-	0x90, 0x6d, 0xf9, 0x97, 0xa8, 0xe6, 0x9c, 0x9f, 0x74, 0x7d, 0x70, 0x68, 0x93, 
-	0xee, 0xe0, 0xd5, 0xcb, 0x53, 0x98, 0xd0, 0xb6, 0x20, 0xa8, 0x23, 0xbd, 0x5c, 
-	0x86, 0xb3, 0xb4, 0xe6, 0xcc, 0x20, 0x7a, 0x1c, 0x56, 0x8c, 0x35, 0xce, 0xce, 
-	0x95, 0xaa, 0x2c, 0xa0, 0xf4, 0xa9, 0x63, 0xfa, 0x54, 0x71, 0x8e, 0x2a, 0x65, 
-	0x15, 0x51, 0x18, 0xea, 0x28, 0xa5, 0xae, 0x84, 0x3 , 0x58, 0x53, 0x70, 0x29, 
-	0xe4, 0xf1, 0xcd, 0x36, 0xb4, 0x4c, 0x8 , 0xd8, 0x53, 0x18, 0xe , 0xb5, 0x2e, 
-	0x33, 0xda, 0x9a, 0x56, 0xad, 0x1 , 0x14, 0x80, 0x9a, 0xaf, 0x74, 0x76, 0x46, 
-	0xcd, 0xfd, 0xd0, 0x4d, 0x5b, 0x71, 0x8a, 0xcf, 0xd6, 0x1f, 0x6d, 0xae, 0xdf, 
-	0xef, 0xb0, 0x5f, 0xf3, 0xf9, 0x50, 0xdd, 0x91, 0xf , 0x44, 0x65, 0x28, 0xc0, 
-	0x1e, 0xbd, 0x4d, 0x2c, 0x63, 0x3c, 0xd2, 0xb6, 0x39, 0x3e, 0xb4, 0xf8, 0xc1, 
-	0xe7, 0x1e, 0xb5, 0xc9, 0x22, 0x60, 0xb4, 0x35, 0x34, 0x68, 0xf6, 0x40, 0x5b, 
-	0xbb, 0x1a, 0xbe, 0x9c, 0xb6, 0x7d, 0x2a, 0x1b, 0x54, 0x11, 0xdb, 0xa2, 0x7a, 
-	0xa , 0x9b, 0xa2, 0xe3, 0xd6, 0xb9, 0x1e, 0xe7, 0xd9, 0x61, 0xe1, 0xc9, 0x4a, 
-	0x31, 0xf2, 0x6 , 0x39, 0x39, 0xa4, 0x3 , 0x34, 0x0 , 0x49, 0xc0, 0x14, 0xec, 
-	0x76, 0x1d, 0xba, 0xd2, 0x3a, 0x76, 0x11, 0x54, 0xb1, 0xc0, 0xab, 0x96, 0xf1, 
-	0x88, 0xd7, 0x71, 0xe3, 0xd2, 0x99, 0x6d, 0x1e, 0x3a, 0xfe, 0x27, 0xd2, 0xa7, 
-	0x6f, 0xbb, 0x9c, 0x61, 0x7a, 0x1 , 0x49, 0x9d, 0x14, 0xe3, 0xd5, 0x86, 0xec, 
-	0x74, 0xa8, 0x66, 0x6d, 0xbd, 0xf9, 0xfe, 0x54, 0xf6, 0x60, 0xa3, 0x9a, 0xaa, 
-	0xf9, 0x9a, 0x6d, 0x83, 0xa7, 0xf1, 0x1a, 0x7 , 0x52, 0x76, 0xd8, 0x75, 0x9a, 
-	0x19, 0x24, 0x33, 0x1e, 0x9d, 0x14, 0x56, 0xf6, 0x8a, 0x36, 0xa1, 0xb , 0x8c, 
-	0xe7, 0x26, 0xb3, 0xec, 0xa2, 0xc9, 0x51, 0xd1, 0x45, 0x5a, 0x56, 0x31, 0x48, 
-	0x19, 0x2a, 0x96, 0x8e, 0xe5, 0x46, 0x16, 0x85, 0x8d, 0x75, 0x11, 0x4a, 0xa6, 
-	0x37, 0x50, 0x3f, 0xa , 0xad, 0x35, 0xa4, 0xd1, 0xfd, 0xc1, 0xe6, 0x27, 0xa1, 
-	0xed, 0x45, 0xb4, 0xe9, 0x26, 0xe , 0x47, 0xa1, 0xf6, 0xab, 0x7e, 0x6f, 0x96, 
-	0xb9, 0xde, 0x3d, 0xb3, 0x5a, 0xe8, 0xce, 0x7b, 0xca, 0xc , 0xe3, 0xfc, 0x70, 
-	0x54, 0x49, 0x1c, 0xa , 0xa5, 0x41, 0x93, 0x2c, 0xbd, 0xc6, 0x17, 0x27, 0xf5, 
-	0xae, 0x76, 0xed, 0xc2, 0xc8, 0x63, 0x46, 0x66, 0x27, 0xd4, 0xd6, 0xce, 0xb1, 
-	0x2f, 0xda, 0xf5, 0xd9, 0xb , 0x72, 0xb1, 0x26, 0x4e, 0x7d, 0x58, 0xff, 0x0 , 
-	0x80, 0xac, 0x55, 0xb7, 0x69, 0x35, 0x5 , 0x38, 0xe3, 0x70, 0x39, 0x3d, 0xea, 
-	0xa3, 0xf0, 0xdc, 0xf9, 0x4c, 0xce, 0x5e, 0xdb, 0x1c, 0xe2, 0xbc, 0x91, 0xd4, 
-	0xe9, 0xe3, 0x16, 0xca, 0x3d, 0xaa, 0x7a, 0x8e, 0xdd, 0x76, 0xc6, 0x0 , 0xf4, 
-	0xa9, 0x30, 0x6b, 0x9c, 0xfb, 0x78, 0x69, 0x14, 0x84, 0x26, 0x90, 0xc , 0xd1, 
-	0x4a, 0xa7, 0x14, 0xc , 0x6b, 0x2f, 0xa8, 0xfc, 0xc5, 0x47, 0x24, 0x28, 0xd1, 
-	0xed, 0x1f, 0x28, 0xf6, 0xab, 0x51, 0xe3, 0x77, 0x52, 0x2a, 0x56, 0xb7, 0xdc, 
-	0xbb, 0x81, 0x51, 0xf8, 0x11, 0x4f, 0x53, 0x1a, 0xb1, 0xa7, 0x35, 0x69, 0xab, 
-	0xa2, 0xb7, 0x86, 0xfc, 0x27, 0xa8, 0xf8, 0x93, 0x5b, 0x5b, 0x3b, 0x36, 0x5c, 
-	0x1f, 0x9a, 0x59, 0x4a, 0x13, 0xe5, 0xaf, 0xae, 0x7 , 0xf2, 0xaf, 0x44, 0x3f, 
-	0x6 , 0x74, 0x9 , 0xad, 0x7c, 0xb8, 0x75, 0x7b, 0xe8, 0xef, 0x50, 0x7d, 0xe6, 
-	0x54, 0x74, 0x27, 0xdd, 0x6 , 0x8 , 0x1f, 0x53, 0x5a, 0x7f, 0xe , 0xf4, 0x9f, 
-	0xec, 0x7d, 0x4 , 0x34, 0xd0, 0xb2, 0xcd, 0x3e, 0x24, 0x95, 0xa4, 0xb4, 0x32, 
-	0x1 , 0xe8, 0x37, 0x29, 0xc8, 0xc0, 0xae, 0x8a, 0xb , 0xc8, 0xa5, 0x6f, 0xdd, 
-	0x49, 0x1d, 0xc6, 0xdf, 0xe0, 0x8e, 0xe5, 0x5c, 0x8f, 0xa2, 0xca, 0x38, 0xfc, 
-	0xd , 0x6b, 0x1a, 0x6a, 0xda, 0x9f, 0x19, 0x8a, 0xc6, 0xb7, 0x59, 0xfb, 0x1d, 
-	0x22, 0xb6, 0x3c, 0x5b, 0xc4, 0xdf, 0xa , 0xbc, 0x59, 0xa6, 0xee, 0x96, 0xd2, 
-	0xda, 0x2d, 0x52, 0xdf, 0xfb, 0xf6, 0x4d, 0xb9, 0x87, 0xd5, 0xf , 0xcd, 0x9f, 
-	0xa0, 0x35, 0xc4, 0xde, 0x41, 0x35, 0xb4, 0xd9, 0x9a, 0x36, 0x8a, 0x58, 0x5f, 
-	0xe , 0x8e, 0xa , 0xb2, 0x9f, 0x42, 0xf , 0x4a, 0xfa, 0xa5, 0x2f, 0xd2, 0x36, 
-	0xdd, 0x2b, 0x34, 0x7b, 0x86, 0x2 , 0xca, 0xa6, 0x22, 0x7d, 0x86, 0xec, 0xa9, 
-	0xfc, 0xa , 0xd4, 0x5e, 0x21, 0xd2, 0xb4, 0x1f, 0x10, 0x58, 0xf9, 0x5a, 0xee, 
-	0x99, 0xd , 0xc6, 0xfe, 0x15, 0xe5, 0x4f, 0x2e, 0x5f, 0xf8, 0xb , 0xe7, 0xf9, 
-	0x31, 0xfa, 0x54, 0xba, 0x2b, 0xa0, 0xa3, 0x8f, 0x95, 0xad, 0x35, 0x73, 0xe5, 
-	0xd9, 0x40, 0x76, 0x47, 0x1f, 0x88, 0xab, 0xb0, 0x80, 0xd6, 0xed, 0x1c, 0xbc, 
-	0x8e, 0x57, 0x23, 0xb1, 0xf7, 0xaf, 0x4c, 0xf1, 0x9f, 0xc1, 0xc8, 0xe0, 0x86, 
-	0x4b, 0xcf, 0xe , 0x6a, 0x27, 0x6c, 0x60, 0x93, 0x67, 0x79, 0xc1, 0x3c, 0x64, 
-	0x6d, 0x7e, 0x39, 0xe3, 0x80, 0xc0, 0x7d, 0x6b, 0xcc, 0x6e, 0x9a, 0x58, 0x1d, 
-	0x96, 0x44, 0x68, 0xe4, 0x19, 0x8d, 0xd4, 0xf0, 0x43, 0x3 , 0xde, 0xb9, 0xea, 
-	0x45, 0xc6, 0xc8, 0xf6, 0x30, 0xb8, 0x8a, 0x75, 0x54, 0xa4, 0xbe, 0x63, 0xf4, 
-	0xa9, 0x36, 0x4d, 0xb9, 0x59, 0x73, 0xf7, 0x73, 0xfa, 0x56, 0xbd, 0x9d, 0xa9, 
-	0xc , 0xa5, 0x89, 0x56, 0xf7, 0xfb, 0xad, 0xfe, 0x15, 0x9f, 0xe1, 0x7d, 0x22, 
-	0xff, 0x0 , 0x52, 0xd5, 0x5 , 0x8d, 0x85, 0xb3, 0x4d, 0x23, 0x0 , 0x4e, 0xde, 
-	0x2 , 0x67, 0xbb, 0x1e, 0x80, 0x57, 0xa5, 0x69, 0x9e, 0x9 , 0x9e, 0xdf, 0x6a, 
-	0xea, 0x57, 0xa9, 0xf3, 0xc , 0x6d, 0x85, 0x73, 0xb7, 0xb7, 0x24, 0xf6, 0xce, 
-	0x3b, 0x77, 0xa5, 0x1a, 0x73, 0x93, 0xd0, 0xd6, 0x58, 0xba, 0x14, 0xa9, 0xfe, 
-	0xf2, 0x5a, 0xf6, 0x39, 0xed, 0x36, 0xe6, 0x6b, 0x31, 0x95, 0x25, 0x76, 0xe5, 
-	0x76, 0x9e, 0x86, 0xa7, 0xb8, 0x96, 0xd6, 0xfa, 0x4f, 0x2e, 0x45, 0xf2, 0x19, 
-	0x87, 0x2c, 0xbd, 0xf , 0xf4, 0xae, 0x83, 0x5e, 0xd1, 0x74, 0x8d, 0x36, 0xdd, 
-	0x95, 0x5a, 0x46, 0x72, 0xb9, 0xcb, 0x4a, 0x76, 0xe7, 0xb7, 0xe0, 0x6b, 0x8b, 
-	0x9a, 0xea, 0xca, 0x7b, 0xa3, 0x15, 0x9f, 0x98, 0xd2, 0x3b, 0x6d, 0x41, 0x17, 
-	0x3b, 0x8f, 0xa0, 0x1d, 0xcf, 0xd3, 0x35, 0xac, 0xb0, 0xee, 0xd7, 0x5b, 0x9c, 
-	0x50, 0xcd, 0xa9, 0xa9, 0x72, 0xb6, 0xf9, 0x7c, 0xcd, 0x28, 0xec, 0xe7, 0x85, 
-	0x95, 0xd5, 0xd6, 0x68, 0x4f, 0x74, 0x3c, 0xe0, 0x74, 0x35, 0x4b, 0xc4, 0x91, 
-	0x83, 0x32, 0xcb, 0x17, 0xc , 0xc7, 0x1f, 0xef, 0x8f, 0x6a, 0xf5, 0xff, 0x0 , 
-	0x3 , 0xfc, 0xe , 0xd6, 0x25, 0xd2, 0xe2, 0xd4, 0x35, 0x8d, 0x5b, 0xfb, 0x3d, 
-	0xa6, 0x45, 0x65, 0xb6, 0x8e, 0x2d, 0xee, 0xa0, 0x8c, 0x80, 0xc4, 0x90, 0x1 , 
-	0xfc, 0xfe, 0xb5, 0x5f, 0xc4, 0x1f, 0x2 , 0xb5, 0x58, 0xe4, 0x8e, 0x4d, 0x3f, 
-	0x5f, 0xb6, 0xba, 0x48, 0xe4, 0xdf, 0xe5, 0xdc, 0x44, 0x63, 0x3d, 0x73, 0x8c, 
-	0x82, 0xd5, 0x3f, 0x53, 0xab, 0xbd, 0x8e, 0xb8, 0xe7, 0x18, 0x5b, 0x38, 0x73, 
-	0x1c, 0x1d, 0x9b, 0xbd, 0xa5, 0xac, 0x36, 0xc0, 0xae, 0xd4, 0x40, 0x10, 0xed, 
-	0xed, 0x8a, 0x9d, 0x66, 0x12, 0xc3, 0x24, 0x4d, 0x12, 0xfc, 0xbf, 0x34, 0x78, 
-	0x7 , 0x9e, 0x39, 0x1f, 0xcf, 0xf2, 0xad, 0x9f, 0x12, 0xf8, 0x67, 0xc4, 0x3a, 
-	0x44, 0x2e, 0xd7, 0x1a, 0x6c, 0x8a, 0x13, 0xe6, 0x12, 0x22, 0xef, 0x4f, 0xcc, 
-	0x7f, 0x5a, 0xe7, 0x6d, 0xee, 0xa7, 0x36, 0x6d, 0x29, 0x55, 0xc , 0x9f, 0x3a, 
-	0x65, 0x71, 0x91, 0x9a, 0xc6, 0x30, 0x7a, 0x5d, 0x59, 0x9d, 0xf5, 0x2b, 0xc1, 
-	0x5d, 0x29, 0xf3, 0x45, 0xed, 0x65, 0x7f, 0x97, 0xa9, 0x5e, 0xc4, 0xb1, 0xb7, 
-	0x63, 0xe4, 0xb0, 0x2d, 0x23, 0x1e, 0x7 , 0xbd, 0x2c, 0x86, 0x21, 0xf7, 0xa3, 
-	0x39, 0xff, 0x0 , 0x69, 0xa8, 0xf2, 0xa7, 0x30, 0x8c, 0x2b, 0x61, 0x86, 0xe0, 
-	0x3e, 0xbc, 0xff, 0x0 , 0x5a, 0x62, 0xdb, 0xcc, 0x46, 0x7c, 0x93, 0xf9, 0x57, 
-	0x75, 0x18, 0x2b, 0x2b, 0xb3, 0xe7, 0xb1, 0xb8, 0x89, 0xfb, 0x46, 0x94, 0x5b, 
-	0xf9, 0x3 , 0x4c, 0xbf, 0xc1, 0x1a, 0x8f, 0xc2, 0xa3, 0x62, 0x5b, 0xa9, 0xfd, 
-	0x6a, 0x43, 0xc , 0x9d, 0x5b, 0xb , 0xec, 0x4d, 0x46, 0xc1, 0x57, 0xab, 0x73, 
-	0xe9, 0x8a, 0xe8, 0x8f, 0x2a, 0x3c, 0x8a, 0x8e, 0xb3, 0xdd, 0x58, 0x3f, 0x1a, 
-	0x6b, 0x51, 0x9a, 0x2b, 0x43, 0x98, 0x28, 0xcd, 0x14, 0x8d, 0x40, 0x84, 0xa3, 
-	0x34, 0x1a, 0x6d, 0x0 , 0x29, 0x34, 0x94, 0x51, 0xf8, 0x53, 0x0 , 0xcd, 0x1f, 
-	0x8d, 0x1f, 0x85, 0x21, 0xfa, 0x53, 0x1 , 0x28, 0xa2, 0x90, 0x9a, 0x0 , 0x9 , 
-	0xa4, 0xa2, 0x8a, 0x0 , 0x4c, 0xd2, 0x1a, 0x28, 0xa0, 0x0 , 0xfd, 0x68, 0xfc, 
-	0x68, 0xfc, 0x29, 0xf , 0xd2, 0x80, 0x6 , 0xfa, 0xd2, 0x51, 0x45, 0x0 , 0x23, 
-	0x52, 0x51, 0x45, 0x0 , 0x21, 0x34, 0x94, 0x51, 0x40, 0x5 , 0x1f, 0x8d, 0x1f, 
-	0x85, 0x21, 0xfa, 0x50, 0x0 , 0xdf, 0x5a, 0x4a, 0x28, 0xa0, 0x4 , 0x26, 0x92, 
-	0x8a, 0x2a, 0x80, 0x42, 0x69, 0x28, 0xa2, 0x80, 0xf , 0xc6, 0x8f, 0xc6, 0x8f, 
-	0xc2, 0x90, 0xfd, 0x28, 0x1 , 0x28, 0xa2, 0x90, 0x9a, 0x0 , 0x9 , 0xa4, 0xa2, 
-	0x90, 0x9a, 0x0 , 0x94, 0x53, 0xa9, 0xb4, 0xab, 0x4c, 0x7 , 0xe6, 0x8a, 0x6d, 
-	0x38, 0x52, 0x1 , 0x73, 0xef, 0x4b, 0xf8, 0xd3, 0x56, 0x9d, 0xf8, 0x50, 0x1 , 
-	0x4a, 0xd , 0x27, 0xe1, 0x45, 0x0 , 0x3a, 0x94, 0x1a, 0x4a, 0x28, 0x1 , 0xc2, 
-	0x97, 0x34, 0x94, 0x50, 0x3 , 0xbf, 0x1a, 0x28, 0xfc, 0x28, 0xa0, 0x5 , 0x6 , 
-	0x96, 0x9b, 0x4a, 0xb4, 0x0 , 0xe5, 0xa5, 0xa6, 0xd2, 0xe6, 0x80, 0x15, 0x69, 
-	0xdf, 0x8d, 0x36, 0x94, 0x7d, 0x28, 0x1 , 0x68, 0xa3, 0xf0, 0xa2, 0x80, 0x1d, 
-	0x9a, 0x29, 0xb4, 0xe1, 0x40, 0xe , 0xcd, 0x14, 0xda, 0x70, 0xa0, 0x1 , 0x69, 
-	0xdf, 0x8d, 0x36, 0x94, 0x7d, 0x28, 0x1 , 0x68, 0xa3, 0xf0, 0xa2, 0x90, 0xe , 
-	0xcd, 0x14, 0xda, 0x70, 0xa4, 0x0 , 0x29, 0x73, 0x49, 0x42, 0x82, 0x5b, 0x0 , 
-	0x73, 0x40, 0xe , 0x1c, 0xd4, 0xd0, 0xc6, 0xbb, 0x86, 0xf3, 0xcf, 0xa0, 0xa2, 
-	0x14, 0xdb, 0x90, 0x39, 0x3d, 0xcd, 0x58, 0x58, 0x80, 0x5d, 0xc7, 0x8f, 0x52, 
-	0x6b, 0xaa, 0x9d, 0x14, 0xb5, 0x66, 0x13, 0xa8, 0xde, 0x88, 0xb0, 0xa4, 0x95, 
-	0xa , 0xa1, 0x47, 0x61, 0x8e, 0x2a, 0x45, 0xdb, 0x14, 0x79, 0x99, 0x80, 0xcf, 
-	0xe2, 0x4d, 0x50, 0x9a, 0xfa, 0x18, 0x10, 0x47, 0x12, 0xe5, 0x8f, 0x56, 0xcf, 
-	0x35, 0xcf, 0xeb, 0x5a, 0xd0, 0x8d, 0x9b, 0xcc, 0x72, 0xd8, 0xe8, 0x13, 0xa8, 
-	0xfa, 0xd7, 0x43, 0x92, 0x46, 0x71, 0xa6, 0xd9, 0xd2, 0xea, 0x5a, 0xac, 0x28, 
-	0xbf, 0xb9, 0x5d, 0xdb, 0x4f, 0x5 , 0xbe, 0x66, 0x3c, 0xd6, 0x1e, 0xa5, 0xad, 
-	0x92, 0xdb, 0x9e, 0x40, 0xa7, 0xb6, 0xe , 0x4f, 0xe5, 0x5c, 0xfc, 0x57, 0xf7, 
-	0x77, 0xd7, 0x42, 0x14, 0x7f, 0x26, 0x36, 0xe4, 0x93, 0xcb, 0x1a, 0xbd, 0x25, 
-	0xbc, 0x6a, 0x12, 0xb , 0x6b, 0x66, 0x79, 0x32, 0x6 , 0x14, 0x6e, 0x66, 0x3f, 
-	0xce, 0xa5, 0xcd, 0x9a, 0xa8, 0x24, 0x43, 0x77, 0xa8, 0x4f, 0x3f, 0xcc, 0x91, 
-	0xb7, 0xb3, 0xbf, 0xaf, 0xb0, 0xac, 0xfb, 0x87, 0xb9, 0x65, 0xc9, 0x98, 0xe7, 
-	0xa6, 0x17, 0x8a, 0xe9, 0x2d, 0x7c, 0x1f, 0xac, 0xde, 0xb2, 0xba, 0xa2, 0xda, 
-	0xc6, 0xc3, 0x93, 0x23, 0x7c, 0xdf, 0xf7, 0xc8, 0xfe, 0xb5, 0xd1, 0xe9, 0xbf, 
-	0xf , 0xf4, 0x78, 0x22, 0x53, 0x7b, 0xba, 0xe5, 0xdb, 0x9d, 0xf2, 0x39, 0x55, 
-	0x3e, 0xc0, 0x2 , 0x29, 0x28, 0xce, 0x42, 0x75, 0x22, 0x8f, 0x38, 0x8b, 0xca, 
-	0x11, 0xed, 0x3f, 0x34, 0x87, 0xae, 0xee, 0x49, 0xad, 0x18, 0x6d, 0x35, 0x9b, 
-	0xbd, 0xa6, 0xd6, 0xda, 0x74, 0x5f, 0x5f, 0x2c, 0xa8, 0xfd, 0x71, 0x5e, 0x9f, 
-	0x63, 0xa2, 0x58, 0x5a, 0x8d, 0x96, 0x76, 0xf6, 0xb6, 0xe0, 0x74, 0x31, 0xc4, 
-	0x15, 0x8f, 0xfc, 0x8 , 0xf3, 0x53, 0x5c, 0x47, 0xb7, 0x85, 0x90, 0xb3, 0x6d, 
-	0xc1, 0x4 , 0xab, 0x7d, 0x31, 0xda, 0xaf, 0xd8, 0xbe, 0xe4, 0x7b, 0x6f, 0x23, 
-	0xcc, 0x66, 0xf0, 0x9e, 0xbb, 0x77, 0x31, 0x53, 0xc , 0x31, 0x15, 0xff, 0x0 , 
-	0x9e, 0x92, 0x8c, 0x9f, 0xc0, 0x66, 0xa3, 0x5f, 0x3 , 0x6a, 0xc1, 0x94, 0x4b, 
-	0x79, 0x6c, 0xbd, 0xf8, 0xcb, 0x7e, 0x15, 0xe9, 0x6c, 0x26, 0x1f, 0x70, 0xe3, 
-	0xbf, 0xcf, 0xc1, 0xfa, 0xf1, 0x50, 0xb4, 0x4b, 0xb9, 0xf6, 0xae, 0xfd, 0xdd, 
-	0xf3, 0xc7, 0xff, 0x0 , 0xae, 0x8f, 0x63, 0x16, 0x4f, 0xb5, 0x91, 0xc3, 0x5b, 
-	0xf8, 0x1f, 0xe6, 0x26, 0x6d, 0x4b, 0xd , 0x8e, 0x89, 0x1e, 0x7 , 0xea, 0x69, 
-	0x97, 0xde, 0x1c, 0xb3, 0xb6, 0x5d, 0xa9, 0x71, 0x2b, 0x6d, 0x42, 0xe0, 0xf0, 
-	0x7 , 0xbf, 0x6a, 0xed, 0xe6, 0x46, 0x58, 0xf3, 0x9f, 0xf8, 0x16, 0x38, 0xf4, 
-	0xef, 0x5c, 0xdf, 0x8b, 0x9b, 0xcb, 0x85, 0x7a, 0xed, 0xc9, 0x5 , 0xb3, 0xd7, 
-	0x8e, 0x9f, 0xe7, 0xd2, 0xa6, 0x74, 0xa1, 0x18, 0xec, 0x11, 0x94, 0x9b, 0xdc, 
-	0xf3, 0xdd, 0x72, 0x31, 0x1b, 0x1 , 0xbf, 0x70, 0xce, 0x57, 0xd6, 0xb2, 0x66, 
-	0x6d, 0xcd, 0x8a, 0xd6, 0xf1, 0x3 , 0x1d, 0xdf, 0x28, 0xe9, 0x58, 0xcb, 0xeb, 
-	0x5e, 0x5c, 0xb7, 0x3b, 0x63, 0xb0, 0xb4, 0x51, 0x45, 0x31, 0x85, 0xb , 0xf7, 
-	0xa8, 0x15, 0x35, 0xac, 0x2f, 0x2e, 0xf6, 0x55, 0x27, 0x6f, 0x1c, 0xa , 0x99, 
-	0x22, 0xa1, 0xb8, 0xce, 0x3d, 0x29, 0x1b, 0x6 , 0xa4, 0x68, 0x64, 0x5f, 0xe0, 
-	0x27, 0xf0, 0xa8, 0xc8, 0x23, 0xa8, 0xfd, 0x2a, 0x35, 0x3a, 0x4 , 0xc7, 0xad, 
-	0x25, 0x3a, 0x93, 0x15, 0x20, 0x35, 0xba, 0x54, 0x55, 0x2b, 0x7d, 0xda, 0x66, 
-	0x29, 0xa3, 0x29, 0xee, 0x3a, 0x3f, 0xb9, 0xf8, 0xd3, 0xa9, 0x21, 0xfb, 0xa4, 
-	0x7b, 0xd4, 0xab, 0xb , 0x37, 0xdd, 0x19, 0xa2, 0xc5, 0xc7, 0xe1, 0x43, 0x31, 
-	0x49, 0x83, 0x56, 0x56, 0x10, 0xab, 0xb9, 0xcf, 0x18, 0xa8, 0xa6, 0x39, 0xe0, 
-	0x2d, 0x37, 0x1b, 0xe , 0xe4, 0x6b, 0x52, 0x96, 0xdc, 0xa2, 0xa2, 0xef, 0x4f, 
-	0x4f, 0x4a, 0x48, 0x62, 0x48, 0x31, 0xcd, 0x36, 0xa6, 0x61, 0x95, 0x1f, 0xad, 
-	0x44, 0xc0, 0x83, 0x83, 0x40, 0xa , 0xa7, 0xe6, 0x3e, 0xe2, 0x9c, 0x40, 0x2b, 
-	0xc5, 0x33, 0xd0, 0x8f, 0x5e, 0x69, 0xf9, 0x21, 0x98, 0x55, 0xad, 0x8e, 0x79, 
-	0xab, 0x32, 0x4d, 0x39, 0xb1, 0x23, 0x29, 0xfa, 0xd6, 0xb5, 0xbf, 0x5a, 0xc6, 
-	0xb6, 0x62, 0xb7, 0x69, 0xee, 0x71, 0x5b, 0x36, 0xf5, 0x8c, 0xb7, 0x35, 0x83, 
-	0xd0, 0xb7, 0x17, 0xdd, 0xe6, 0xa7, 0x8c, 0x54, 0x50, 0xa9, 0x35, 0x6a, 0x18, 
-	0xc9, 0xed, 0xde, 0x92, 0xd0, 0xd0, 0x67, 0xbd, 0x1d, 0x38, 0xa9, 0xc4, 0x27, 
-	0x6f, 0x43, 0x48, 0x62, 0xe3, 0xa7, 0xe7, 0x5a, 0xc6, 0x43, 0xb1, 0x5c, 0x8a, 
-	0x43, 0x52, 0x48, 0xb8, 0x38, 0xa6, 0x30, 0xe7, 0xa5, 0x6a, 0x99, 0x23, 0x71, 
-	0x4d, 0x61, 0x52, 0x3 , 0xed, 0x4d, 0x6a, 0xd2, 0xe2, 0x23, 0x6c, 0x74, 0x15, 
-	0x91, 0xaf, 0x3e, 0x6e, 0x22, 0x8b, 0x3d, 0x1 , 0x63, 0xcf, 0x4a, 0xd7, 0x6c, 
-	0x63, 0x20, 0x56, 0xe , 0xa4, 0xe1, 0xf5, 0x9 , 0x5b, 0xfb, 0xa7, 0x68, 0xfe, 
-	0xb5, 0x32, 0x7a, 0x11, 0x3d, 0x88, 0x95, 0x72, 0xc2, 0xac, 0x5a, 0xc6, 0x1a, 
-	0xe1, 0x7 , 0xa9, 0xa6, 0x45, 0xf7, 0xaa, 0xde, 0x9a, 0x85, 0xae, 0x8b, 0x7b, 
-	0x60, 0x57, 0x34, 0xf4, 0x46, 0xf8, 0x38, 0xfb, 0x4a, 0xd1, 0x89, 0xa2, 0xbc, 
-	0x75, 0xa7, 0x67, 0x3c, 0xe6, 0x90, 0xf1, 0xc5, 0x22, 0xfa, 0x57, 0x2b, 0x3e, 
-	0xc2, 0x23, 0xd4, 0x7a, 0x54, 0xf0, 0xc7, 0xdc, 0xd3, 0x61, 0x8f, 0x1f, 0x31, 
-	0xab, 0x2b, 0x85, 0xe5, 0x87, 0xd1, 0x7d, 0x68, 0x37, 0xa7, 0xe , 0xac, 0x72, 
-	0x80, 0xa9, 0xb9, 0x87, 0xca, 0x7b, 0x7f, 0x7a, 0x98, 0xcc, 0x5b, 0x96, 0x3d, 
-	0x29, 0x19, 0x8b, 0x36, 0x49, 0xa8, 0x67, 0x90, 0x5 , 0xa0, 0xd2, 0x52, 0xb0, 
-	0xcb, 0xa9, 0xf , 0x41, 0xd4, 0xf4, 0x15, 0x35, 0x9c, 0x5b, 0x17, 0x9e, 0xa7, 
-	0xa9, 0xa8, 0x6d, 0x50, 0xb3, 0x79, 0x8d, 0xd7, 0xb7, 0xb5, 0x5d, 0x41, 0x81, 
-	0x40, 0x52, 0x8d, 0xdf, 0x33, 0x1f, 0x1b, 0x15, 0xe0, 0x54, 0x9e, 0x69, 0xa8, 
-	0x69, 0xc2, 0x83, 0xa7, 0x42, 0x45, 0x91, 0x83, 0x2 , 0xa4, 0x83, 0x56, 0xae, 
-	0xa6, 0x68, 0x74, 0x79, 0x2f, 0xa6, 0x7c, 0x6e, 0x1b, 0x10, 0x7b, 0x75, 0x27, 
-	0xfc, 0xfa, 0xd4, 0x1a, 0x7d, 0xb3, 0xdd, 0x5d, 0x2c, 0x2b, 0xfc, 0x47, 0x9a, 
-	0xa5, 0xf1, 0x2 , 0xed, 0x65, 0x9a, 0x2d, 0x2e, 0x13, 0xfb, 0xb8, 0xd7, 0xf , 
-	0xb7, 0xb2, 0x8f, 0xbc, 0x7f, 0x3a, 0xb8, 0x45, 0xb3, 0x87, 0x1d, 0x89, 0x8d, 
-	0xa , 0x6e, 0x7d, 0xb5, 0xfe, 0xbd, 0x59, 0x81, 0xc , 0xf9, 0xb5, 0x92, 0x5d, 
-	0xcb, 0xe6, 0x4c, 0xfb, 0xd8, 0x1e, 0xa0, 0x1e, 0x0 , 0xa9, 0xb4, 0x74, 0x12, 
-	0xde, 0xe , 0x38, 0x8c, 0x73, 0x9f, 0x5a, 0xce, 0xbe, 0xc9, 0xbe, 0x5d, 0x8e, 
-	0xce, 0xa8, 0x46, 0x7d, 0x6 , 0x2b, 0x7b, 0x41, 0x88, 0x8b, 0x7f, 0x31, 0xbe, 
-	0xf4, 0x95, 0xad, 0x47, 0x68, 0xd8, 0xf9, 0x4c, 0xa6, 0x8c, 0xb1, 0x18, 0xb5, 
-	0x29, 0x74, 0xd5, 0x9a, 0xb , 0x52, 0x2a, 0x83, 0xfc, 0x5f, 0xad, 0x36, 0x20, 
-	0x37, 0x73, 0x57, 0x20, 0x86, 0x26, 0x39, 0x60, 0x48, 0x3e, 0x9d, 0xab, 0x14, 
-	0xae, 0x7d, 0xa4, 0xa5, 0xca, 0x57, 0x16, 0xec, 0xc3, 0xe4, 0x2a, 0x69, 0x8d, 
-	0x13, 0xaf, 0xde, 0x5c, 0x56, 0xaa, 0xd8, 0x21, 0xe5, 0x55, 0xa9, 0xff, 0x0 , 
-	0x60, 0xc8, 0xfb, 0x8d, 0x55, 0xc8, 0xcc, 0x7e, 0xb0, 0xbb, 0x98, 0x98, 0x3e, 
-	0x86, 0xb5, 0xbc, 0x1f, 0x4 , 0x97, 0x7a, 0xdc, 0x71, 0x6e, 0xfd, 0xda, 0xd , 
-	0xf2, 0xf , 0x2d, 0x9c, 0x10, 0x3b, 0x10, 0x3d, 0xf1, 0xfa, 0xd4, 0xa7, 0x4f, 
-	0xc0, 0xfb, 0x8d, 0xf9, 0x1a, 0xdb, 0xf0, 0x3d, 0xa1, 0x8a, 0x49, 0xae, 0x52, 
-	0x19, 0xdd, 0x99, 0xf6, 0xf , 0x22, 0xf1, 0x23, 0x93, 0x3 , 0xd1, 0x4f, 0x5e, 
-	0x73, 0xd8, 0xd5, 0x46, 0xe , 0xfa, 0x9e, 0x7e, 0x69, 0x8d, 0x50, 0xc3, 0x49, 
-	0x47, 0x77, 0xa7, 0xf5, 0xf2, 0x3a, 0xab, 0x59, 0xe2, 0x74, 0xd , 0x7 , 0xd9, 
-	0x1a, 0x45, 0xea, 0x6c, 0xee, 0x8c, 0x2c, 0x3f, 0xe0, 0xf , 0x85, 0xa9, 0x2e, 
-	0x2e, 0xa , 0x62, 0x5b, 0xa7, 0x2a, 0xb9, 0xeb, 0x7d, 0x68, 0xae, 0xbf, 0xf7, 
-	0xf1, 0x78, 0xac, 0xbb, 0xbb, 0xc0, 0xd7, 0x5e, 0x45, 0xd5, 0xd2, 0x64, 0xf4, 
-	0x8f, 0x54, 0xb5, 0x22, 0x45, 0xff, 0x0 , 0x81, 0x81, 0x9f, 0xc4, 0x1 , 0x52, 
-	0xdb, 0xb3, 0x40, 0x49, 0x8e, 0x1b, 0xa8, 0xc1, 0x1f, 0xeb, 0x74, 0xfb, 0x9f, 
-	0x3e, 0x3f, 0xc5, 0x4e, 0x48, 0xfd, 0x2b, 0x63, 0xe3, 0x4d, 0x9b, 0x39, 0x88, 
-	0x52, 0xd0, 0x9 , 0x1a, 0x36, 0xe0, 0x9b, 0x2b, 0x8f, 0x39, 0x3f, 0x18, 0xdf, 
-	0x9f, 0xc0, 0xa , 0x74, 0x17, 0xb1, 0xb4, 0xc6, 0x8 , 0x64, 0x85, 0xa4, 0xce, 
-	0xc , 0x71, 0x3f, 0xd9, 0xdd, 0xbd, 0x9a, 0x36, 0xca, 0x93, 0xf5, 0xac, 0x3b, 
-	0x79, 0x96, 0xe2, 0x33, 0xb4, 0x58, 0xde, 0x30, 0x3c, 0x14, 0x3f, 0x66, 0x9c, 
-	0x7e, 0xa0, 0x13, 0xf5, 0x63, 0x4e, 0xbc, 0xd4, 0x8d, 0x8d, 0x94, 0xd7, 0x77, 
-	0x46, 0xe3, 0x65, 0xbc, 0x4d, 0x22, 0xc1, 0x7d, 0x8 , 0x91, 0x24, 0xc0, 0xfb, 
-	0xaa, 0xe0, 0x75, 0xfa, 0x66, 0x80, 0x38, 0xdf, 0x8f, 0xfe, 0x29, 0xbe, 0x97, 
-	0x53, 0x8f, 0x45, 0xd2, 0xee, 0x24, 0x86, 0xdf, 0x4f, 0x21, 0xa6, 0xa , 0xa1, 
-	0xb , 0xcb, 0xc1, 0x2a, 0xc0, 0x70, 0x31, 0xd3, 0x8e, 0x9 , 0xed, 0x5c, 0x5e, 
-	0xb1, 0x29, 0xd4, 0x27, 0xb7, 0xbf, 0xfb, 0xa6, 0xe2, 0x5 , 0x92, 0x6c, 0xf4, 
-	0x59, 0x47, 0xca, 0x73, 0xf5, 0xdb, 0x9f, 0xc6, 0xa0, 0xd4, 0xa7, 0x9a, 0xee, 
-	0xf4, 0xef, 0x6d, 0xd2, 0xdc, 0x48, 0x5e, 0x46, 0xfa, 0x9c, 0x93, 0x57, 0xb5, 
-	0xb , 0x14, 0x3a, 0x3c, 0x83, 0xcf, 0xb , 0xb5, 0x7b, 0x21, 0x3f, 0x5e, 0x95, 
-	0x9d, 0x54, 0x9d, 0x91, 0xeb, 0x65, 0x94, 0x65, 0xcb, 0x3a, 0xdd, 0x17, 0xe2, 
-	0x7a, 0x27, 0xc1, 0xeb, 0x71, 0x17, 0x86, 0x5f, 0x51, 0x88, 0x46, 0x93, 0xb3, 
-	0x89, 0x12, 0x49, 0x3e, 0xef, 0x7 , 0x3 , 0x27, 0xd3, 0x39, 0x4 , 0x57, 0x49, 
-	0xae, 0x9 , 0xbe, 0xce, 0xb7, 0x91, 0xb2, 0xc5, 0xb5, 0x15, 0x87, 0xcd, 0xd0, 
-	0x15, 0x53, 0x82, 0x73, 0xce, 0x38, 0x39, 0xf4, 0xe2, 0xb8, 0xff, 0x0 , 0x82, 
-	0x77, 0x68, 0xbe, 0x1f, 0xf2, 0xc2, 0xac, 0xcc, 0x60, 0x91, 0x44, 0x40, 0x80, 
-	0xcc, 0x46, 0x5b, 0x1f, 0x88, 0x3d, 0x4d, 0x76, 0x92, 0x44, 0x3f, 0xb2, 0xed, 
-	0x42, 0xee, 0xdd, 0x12, 0x2e, 0xdc, 0x80, 0xbb, 0x8a, 0xed, 0xc8, 0xc0, 0xe3, 
-	0x3c, 0x9e, 0xfd, 0x9 , 0xad, 0x79, 0x79, 0x55, 0x8f, 0x36, 0x73, 0x73, 0x93, 
-	0x93, 0xea, 0x79, 0xb7, 0xc7, 0x59, 0x35, 0x48, 0x6e, 0xad, 0x25, 0x69, 0x42, 
-	0x5b, 0xcc, 0x84, 0x8 , 0xc0, 0x38, 0x66, 0x7 , 0xbe, 0x3a, 0xf0, 0x47, 0xeb, 
-	0x55, 0xfe, 0x3 , 0xcf, 0x66, 0x35, 0xcd, 0x4a, 0x6 , 0x2c, 0xd7, 0x73, 0x69, 
-	0xd2, 0xfd, 0x9b, 0xcc, 0xc1, 0xc3, 0xa9, 0x57, 0x3b, 0x4f, 0x66, 0xd8, 0xaf, 
-	0xc7, 0xa6, 0x7d, 0x6b, 0x73, 0xe3, 0x35, 0x8c, 0xda, 0x97, 0x82, 0x24, 0xbc, 
-	0xdc, 0xd8, 0xb2, 0x71, 0x3a, 0x7 , 0xea, 0x39, 0x2a, 0xc3, 0x1d, 0x80, 0xcf, 
-	0xe9, 0x5e, 0x6f, 0xe0, 0x7d, 0x46, 0x7d, 0x2b, 0x59, 0xb6, 0xbf, 0x83, 0x71, 
-	0x96, 0xd6, 0x51, 0x2a, 0x44, 0xcd, 0x85, 0x6c, 0x1e, 0x84, 0x63, 0x8c, 0x8c, 
-	0x83, 0xf5, 0xa7, 0x17, 0x66, 0x65, 0x23, 0xf4, 0x33, 0xe1, 0xfe, 0xa9, 0x7 , 
-	0x89, 0x3c, 0x17, 0x61, 0xaa, 0x22, 0x2 , 0x92, 0x42, 0x16, 0x40, 0x7f, 0xbc, 
-	0x0 , 0xc , 0x2a, 0xc6, 0xab, 0xa2, 0xaf, 0x96, 0xcd, 0xf , 0xee, 0xd8, 0xd , 
-	0xc1, 0x5c, 0x95, 0xcf, 0xb7, 0x23, 0x6 , 0xbc, 0x9f, 0xe0, 0x5f, 0x8a, 0xad, 
-	0x6d, 0x75, 0xe1, 0xa5, 0x5a, 0xe5, 0x34, 0xed, 0x52, 0x15, 0xbc, 0xb3, 0x53, 
-	0xce, 0xd2, 0xc3, 0x2c, 0xa4, 0x9e, 0x78, 0xe9, 0xf8, 0x57, 0xac, 0x35, 0xec, 
-	0x91, 0xb3, 0x38, 0x2a, 0x57, 0x81, 0xb4, 0x92, 0xa4, 0x8f, 0xce, 0xbd, 0x28, 
-	0x25, 0x38, 0x5c, 0xe4, 0x93, 0x71, 0x91, 0xcd, 0xdf, 0xe9, 0xf7, 0x1 , 0xcb, 
-	0xac, 0x5c, 0x1e, 0xa4, 0xe , 0xf , 0xe5, 0x5c, 0x9f, 0x8a, 0xbc, 0x15, 0xe1, 
-	0xed, 0x5a, 0x16, 0x17, 0xda, 0x7f, 0x93, 0x2b, 0xc , 0x19, 0xad, 0x4f, 0x96, 
-	0xdf, 0x8e, 0x38, 0x3f, 0x88, 0x35, 0xea, 0x51, 0xa5, 0xbc, 0x92, 0x2b, 0x9d, 
-	0xd1, 0xb3, 0x73, 0x90, 0x7b, 0x7f, 0x9f, 0x5a, 0x66, 0xa5, 0x61, 0xe7, 0x6e, 
-	0x2b, 0x4 , 0x72, 0x2a, 0x8c, 0x6 , 0x0 , 0xd , 0xdf, 0x88, 0xac, 0xe7, 0x41, 
-	0x49, 0x59, 0xa3, 0x5a, 0x58, 0x89, 0xd3, 0x7c, 0xd0, 0x76, 0x67, 0xce, 0x5e, 
-	0x26, 0xf8, 0x5f, 0xaa, 0x41, 0x11, 0x93, 0x44, 0xbd, 0x4b, 0xc8, 0xa3, 0x1c, 
-	0x45, 0x2f, 0xc9, 0x26, 0x3d, 0x1 , 0xce, 0xd3, 0xfa, 0x57, 0x9f, 0xeb, 0x16, 
-	0xfa, 0x8e, 0x9b, 0x76, 0x6d, 0x6f, 0xad, 0x6e, 0x2d, 0xe4, 0xfe, 0xe4, 0xaa, 
-	0x54, 0xfe, 0x1e, 0xb5, 0xf5, 0xb5, 0xf6, 0x84, 0x4 , 0xa4, 0xc6, 0xdf, 0x37, 
-	0x75, 0x1c, 0x11, 0xf8, 0x57, 0x3b, 0xe2, 0x3d, 0x2 , 0xd6, 0xea, 0xdc, 0xdb, 
-	0xdf, 0xda, 0x45, 0x75, 0x1f, 0xf7, 0x25, 0x8c, 0x36, 0x3e, 0x9e, 0x9f, 0x85, 
-	0x72, 0xbc, 0x2c, 0x56, 0xc7, 0x67, 0xf6, 0x8d, 0x59, 0x2f, 0x79, 0xdd, 0x9f, 
-	0x2e, 0x31, 0x66, 0xea, 0xd4, 0x98, 0x15, 0xea, 0xde, 0x32, 0xf8, 0x4a, 0xac, 
-	0x8d, 0x75, 0xe1, 0xab, 0x8d, 0xa7, 0x92, 0xd6, 0x93, 0xbe, 0x46, 0x7d, 0x11, 
-	0xcf, 0xf2, 0x6f, 0xce, 0xbc, 0xc7, 0x53, 0xb1, 0xbc, 0xd3, 0xaf, 0x1e, 0xd2, 
-	0xfe, 0xda, 0x5b, 0x79, 0xe3, 0x3f, 0x34, 0x72, 0x2e, 0x8 , 0xff, 0x0 , 0x1a, 
-	0x39, 0x79, 0x7a, 0x1c, 0xd2, 0xa9, 0x29, 0xee, 0xca, 0xf4, 0x50, 0x69, 0xa7, 
-	0x9a, 0x9 , 0xa , 0x28, 0xa4, 0x26, 0x80, 0x12, 0x8a, 0x28, 0xaa, 0x0 , 0xfc, 
-	0x68, 0xfc, 0x68, 0xfc, 0x29, 0xf , 0xd2, 0x80, 0x3 , 0x49, 0x45, 0x14, 0x0 , 
-	0x84, 0xd2, 0x51, 0x45, 0x0 , 0x14, 0xd3, 0x46, 0x68, 0xa0, 0x2 , 0x8f, 0xc6, 
-	0x8a, 0x3f, 0xa , 0x0 , 0x4f, 0xc6, 0x90, 0xd1, 0x45, 0x0 , 0x14, 0xd3, 0x46, 
-	0x68, 0xa0, 0x2 , 0x91, 0xa9, 0x4d, 0x36, 0x80, 0xa , 0x3f, 0x1a, 0x28, 0xfc, 
-	0x28, 0x1 , 0x3f, 0x1a, 0x43, 0x45, 0x14, 0x0 , 0x53, 0x4d, 0x19, 0xa2, 0x98, 
-	0x5 , 0x34, 0xd1, 0x9a, 0x29, 0x80, 0x51, 0xf8, 0xd1, 0xf8, 0x51, 0xf8, 0x50, 
-	0x2 , 0x7e, 0x34, 0x86, 0x8a, 0x28, 0x1 , 0x9 , 0xa4, 0xa2, 0x8a, 0x0 , 0x46, 
-	0xa4, 0xa3, 0x34, 0x50, 0x4 , 0xd4, 0x51, 0xf8, 0x51, 0x54, 0x3 , 0xa9, 0x41, 
-	0xa6, 0x83, 0x4b, 0x40, 0xe , 0xa5, 0x14, 0xd0, 0x69, 0x69, 0x0 , 0xef, 0xc6, 
-	0x8a, 0x3f, 0xa , 0x3f, 0xa , 0x40, 0x2 , 0x9d, 0x4d, 0xa3, 0x34, 0x0 , 0xe1, 
-	0x4e, 0xa6, 0xd2, 0xad, 0x0 , 0x2a, 0xd3, 0xbf, 0x1a, 0x6d, 0x28, 0xfa, 0x50, 
-	0x2 , 0xfe, 0x34, 0x51, 0xf8, 0x51, 0x40, 0xe , 0xcd, 0x14, 0xda, 0x70, 0xa0, 
-	0x7 , 0x66, 0x94, 0x53, 0x29, 0xc2, 0x80, 0x17, 0x3e, 0xf4, 0xbf, 0x8d, 0x35, 
-	0x69, 0xdf, 0x85, 0x0 , 0x14, 0x51, 0xf8, 0x51, 0x40, 0xe , 0xa2, 0x90, 0x1a, 
-	0x5a, 0x0 , 0x76, 0x68, 0xa6, 0xd3, 0x85, 0x0 , 0x2e, 0x7d, 0xe9, 0x7f, 0x1a, 
-	0x6a, 0xd3, 0xbf, 0xa , 0x0 , 0x28, 0x14, 0x7e, 0x14, 0x52, 0xb0, 0x2 , 0x8c, 
-	0xf4, 0xa9, 0xc7, 0xca, 0xa1, 0x54, 0x7c, 0xcd, 0xde, 0x96, 0x18, 0xf6, 0x2e, 
-	0x48, 0xf9, 0x8f, 0x4c, 0xd2, 0xcb, 0x22, 0xc0, 0xd9, 0xcf, 0xce, 0xbe, 0x9e, 
-	0xb5, 0xd5, 0x4e, 0x1c, 0xba, 0xbd, 0xcc, 0x25, 0x27, 0x2d, 0x10, 0xef, 0x31, 
-	0x61, 0x66, 0xc , 0x70, 0x40, 0x1c, 0xa , 0xce, 0xd5, 0x35, 0x5c, 0x29, 0x2c, 
-	0xe0, 0x28, 0xe9, 0x8f, 0xe8, 0x2a, 0x96, 0xb5, 0xa9, 0x2c, 0x52, 0x11, 0xcb, 
-	0x48, 0x47, 0xa , 0x6b, 0x9e, 0x56, 0xbb, 0xbf, 0xbc, 0xf2, 0xe0, 0x8a, 0x49, 
-	0xa6, 0x93, 0xee, 0xa2, 0x76, 0xe7, 0xa9, 0xf4, 0xaa, 0xe7, 0xec, 0x54, 0x60, 
-	0x91, 0x72, 0xfb, 0x54, 0x92, 0x72, 0x50, 0x6 , 0x8d, 0x33, 0x8c, 0x9e, 0xa6, 
-	0x9f, 0xa6, 0xe9, 0x3a, 0x86, 0xa9, 0x1b, 0x2d, 0x8d, 0x9c, 0x92, 0x29, 0x38, 
-	0x32, 0x11, 0x85, 0x1e, 0xe5, 0xab, 0xa0, 0xf0, 0xdf, 0x82, 0xd5, 0x36, 0x5c, 
-	0xeb, 0x32, 0x89, 0xe6, 0xc9, 0xb , 0x2 , 0x93, 0xb1, 0x71, 0xfd, 0xe3, 0xfc, 
-	0x5f, 0xca, 0xba, 0xfb, 0x25, 0x58, 0xc2, 0xaa, 0x6d, 0x89, 0x31, 0x8c, 0x29, 
-	0xc0, 0x3 , 0x18, 0xe9, 0x4e, 0x31, 0x6f, 0x71, 0x4a, 0xa2, 0x5b, 0x1c, 0xef, 
-	0x86, 0x7c, 0xd , 0x6f, 0x6c, 0x12, 0xe3, 0x52, 0xb9, 0x79, 0x65, 0x27, 0xfd, 
-	0x5c, 0x79, 0x54, 0xfa, 0x67, 0xa9, 0xae, 0xbe, 0x1b, 0xb , 0x1b, 0x6b, 0x86, 
-	0x6b, 0x68, 0x12, 0x32, 0xab, 0x92, 0x98, 0xc6, 0x46, 0x39, 0x20, 0xf7, 0xa5, 
-	0xb7, 0x50, 0x5b, 0x1b, 0x3 , 0x26, 0x4e, 0x31, 0xee, 0x3a, 0xd4, 0xab, 0xb , 
-	0x26, 0xd7, 0xdd, 0xc2, 0x9e, 0xdf, 0xc3, 0x91, 0xeb, 0x5b, 0x28, 0xa5, 0xb1, 
-	0x83, 0x93, 0x64, 0xec, 0x85, 0x7e, 0x65, 0xc1, 0x5c, 0x81, 0x91, 0xc7, 0xe3, 
-	0xef, 0xc6, 0x69, 0xb9, 0x0 , 0xe0, 0x5 , 0x1c, 0x72, 0x99, 0x18, 0x3e, 0xe2, 
-	0x9a, 0xb2, 0x4 , 0x6f, 0x95, 0x78, 0x1c, 0x8c, 0xb0, 0xa7, 0xc8, 0xca, 0xc0, 
-	0x16, 0xf9, 0x7 , 0x62, 0x7a, 0x1f, 0xc7, 0x15, 0x7c, 0xc4, 0xf2, 0x8c, 0x60, 
-	0x3c, 0xb2, 0x8 , 0x8c, 0xb0, 0x27, 0xd , 0x9e, 0x3f, 0x1a, 0x88, 0xec, 0x9 , 
-	0x92, 0xa8, 0xac, 0x7a, 0x0 , 0x73, 0xcf, 0xf2, 0xa9, 0x72, 0xca, 0xbb, 0x51, 
-	0xd5, 0xb0, 0x7a, 0x86, 0xc8, 0x3f, 0x43, 0xff, 0x0 , 0xd6, 0xaa, 0xf7, 0x12, 
-	0x44, 0x1b, 0x2f, 0x1b, 0xa3, 0x30, 0xc6, 0x42, 0xe3, 0x27, 0xe9, 0x8c, 0x66, 
-	0xa1, 0xcc, 0xae, 0x52, 0x31, 0x13, 0x6f, 0x61, 0xb7, 0x4 , 0x9e, 0x47, 0x1f, 
-	0x9f, 0xa5, 0xd , 0x8 , 0x46, 0xc2, 0x9f, 0x98, 0x8c, 0x64, 0xf7, 0xf5, 0xe2, 
-	0xa1, 0x9a, 0x62, 0x7e, 0x44, 0x41, 0x82, 0x1 , 0xc , 0xc0, 0xf , 0xe5, 0x51, 
-	0x7d, 0xa4, 0x88, 0xcc, 0x66, 0x35, 0xf9, 0x7a, 0xfa, 0x9f, 0xc6, 0xa7, 0x9a, 
-	0xc3, 0xe5, 0x19, 0x73, 0x74, 0xb , 0x98, 0xd4, 0x13, 0xdb, 0x9e, 0x95, 0xcc, 
-	0xf8, 0xcb, 0x1f, 0xd9, 0x81, 0x40, 0xfe, 0x2f, 0x97, 0x8e, 0xa2, 0xba, 0x69, 
-	0x99, 0x4c, 0x2a, 0xc8, 0x32, 0xac, 0x1 , 0x55, 0xdb, 0xc8, 0x38, 0xef, 0x5c, 
-	0xe7, 0x8b, 0x14, 0xcb, 0x6a, 0x59, 0xf8, 0x3 , 0x27, 0x8e, 0xff, 0x0 , 0xe7, 
-	0x22, 0xb2, 0xab, 0x3f, 0x70, 0xd2, 0x11, 0xd4, 0xf3, 0x6d, 0x59, 0xbf, 0x72, 
-	0xf2, 0x77, 0xf3, 0x38, 0xfc, 0x2b, 0x29, 0x49, 0x3c, 0x9e, 0xe6, 0xb4, 0x75, 
-	0xc2, 0x55, 0x4 , 0x79, 0xcf, 0x39, 0xfc, 0xf9, 0xaa, 0xa , 0x3e, 0x51, 0x5e, 
-	0x77, 0x53, 0xab, 0xa0, 0x1 , 0x4b, 0x45, 0x15, 0x40, 0x20, 0x15, 0xa1, 0xa3, 
-	0x7 , 0xfb, 0x2c, 0xac, 0xa0, 0xf2, 0xdd, 0x85, 0x50, 0xad, 0x2d, 0x16, 0x39, 
-	0xda, 0xd1, 0x8c, 0x4a, 0xa4, 0x6e, 0x3d, 0xf0, 0x7a, 0x53, 0x8e, 0xe3, 0x45, 
-	0xa6, 0x42, 0x79, 0xdd, 0x82, 0x4f, 0x52, 0xa6, 0xa0, 0xb8, 0xb7, 0xdf, 0xc1, 
-	0x78, 0xd8, 0xfd, 0x70, 0x6a, 0x6d, 0xb7, 0x8b, 0xc0, 0x56, 0xcf, 0xb1, 0xa4, 
-	0xdd, 0x74, 0x39, 0x64, 0x53, 0xf5, 0x5a, 0xa6, 0xbb, 0xa2, 0xd7, 0xa9, 0x49, 
-	0xac, 0x98, 0x74, 0x1 , 0xbd, 0x81, 0xa8, 0xa4, 0xb4, 0x90, 0xc , 0xec, 0x3f, 
-	0x8d, 0x5f, 0x66, 0xdc, 0xb8, 0x6b, 0x61, 0x9f, 0x55, 0x6a, 0x6f, 0x9e, 0xa3, 
-	0xa3, 0xc8, 0xbe, 0xce, 0x33, 0x51, 0xcb, 0x12, 0xf9, 0xa4, 0x65, 0x4a, 0xac, 
-	0xbc, 0x30, 0xc1, 0xa8, 0x6b, 0x43, 0x50, 0x2a, 0xe1, 0x5c, 0x10, 0x7e, 0x95, 
-	0x41, 0xbe, 0xf5, 0x64, 0xd5, 0x99, 0x33, 0xe8, 0x3e, 0x1c, 0x6 , 0x20, 0xd6, 
-	0xcc, 0x67, 0x65, 0xba, 0x95, 0x8d, 0x50, 0x63, 0xef, 0x35, 0x62, 0xc6, 0x7e, 
-	0x71, 0x5b, 0xb , 0x69, 0x34, 0xb6, 0xf1, 0xb7, 0xcc, 0xd9, 0x51, 0x8c, 0xf6, 
-	0xab, 0xa7, 0x7d, 0x45, 0xa3, 0x8a, 0x2a, 0x30, 0x2f, 0xce, 0x7e, 0x5f, 0x53, 
-	0x4d, 0x6c, 0x60, 0xac, 0x6b, 0x9f, 0x53, 0x57, 0x16, 0xc2, 0x52, 0x3e, 0x76, 
-	0xf9, 0x47, 0x6a, 0xaf, 0x36, 0x15, 0xb6, 0x67, 0x8a, 0xa7, 0x17, 0xd4, 0xb5, 
-	0x2b, 0xec, 0x53, 0x70, 0x41, 0xe6, 0x91, 0x4e, 0xf , 0x14, 0xf9, 0x79, 0x6a, 
-	0x67, 0x43, 0x58, 0x96, 0x4a, 0xdd, 0x8f, 0xad, 0xe , 0x9b, 0xa3, 0x4 , 0x75, 
-	0xa6, 0xc6, 0xc0, 0xfc, 0xa7, 0xa5, 0x4f, 0xc0, 0x8c, 0x83, 0xe9, 0x4d, 0x20, 
-	0x2a, 0xe3, 0xae, 0x69, 0xc8, 0xc5, 0xb9, 0x3d, 0xa9, 0xec, 0x37, 0x72, 0x7 , 
-	0x23, 0xb7, 0xad, 0x46, 0xbc, 0x67, 0xf3, 0xa7, 0x13, 0x2a, 0x8b, 0xa8, 0x3f, 
-	0x1f, 0x37, 0xd0, 0xfe, 0xb5, 0xbb, 0x62, 0x3c, 0xc5, 0x52, 0xb9, 0xf9, 0x80, 
-	0x35, 0x8b, 0xb3, 0x71, 0xc0, 0xe7, 0xd8, 0x77, 0xad, 0xef, 0x9 , 0x80, 0xec, 
-	0x6d, 0x9c, 0xe1, 0xd4, 0xe5, 0x73, 0xdc, 0x7f, 0xf5, 0xab, 0x2a, 0x9d, 0xc2, 
-	0x96, 0xae, 0xc6, 0x9d, 0x95, 0xb1, 0x6c, 0x7c, 0xb5, 0xa5, 0x6f, 0x68, 0x76, 
-	0xe7, 0x6 , 0xad, 0xe9, 0xf6, 0x7f, 0x28, 0xe3, 0x15, 0xad, 0x6f, 0x63, 0x85, 
-	0x7 , 0x6f, 0xe7, 0x5c, 0xce, 0xa1, 0xdd, 0x1a, 0x66, 0x31, 0xb4, 0xc2, 0x9a, 
-	0x86, 0x6b, 0x52, 0x1 , 0xfa, 0x57, 0x4c, 0x2c, 0xf3, 0xce, 0x3e, 0xb5, 0x56, 
-	0xf6, 0xd3, 0x6f, 0x55, 0xea, 0x78, 0xa7, 0x1a, 0x83, 0x70, 0x39, 0x6b, 0x88, 
-	0x76, 0xd5, 0x47, 0x18, 0x35, 0xb9, 0xa8, 0x5b, 0x90, 0xa7, 0x8a, 0xc8, 0xb8, 
-	0x4d, 0xad, 0xd2, 0xba, 0x61, 0x2b, 0x98, 0x4a, 0x36, 0x20, 0xef, 0x4d, 0x23, 
-	0xde, 0x94, 0xd2, 0x63, 0x1c, 0xd6, 0xe6, 0x43, 0x24, 0x60, 0xaa, 0x5d, 0xbb, 
-	0xe , 0x6b, 0x99, 0xc , 0x4b, 0x79, 0x84, 0xf2, 0xc4, 0xb7, 0xeb, 0x9a, 0xdc, 
-	0xd6, 0xe5, 0xf2, 0xac, 0x59, 0x41, 0xf9, 0xa4, 0xf9, 0x57, 0xf1, 0xeb, 0xfa, 
-	0x56, 0x28, 0x0 , 0x8c, 0x7a, 0xa , 0x52, 0x33, 0x9e, 0xf6, 0x1f, 0x1b, 0x7a, 
-	0x56, 0x9e, 0x92, 0x3f, 0x73, 0xbc, 0x8c, 0x6e, 0xaa, 0x8 , 0xa8, 0x17, 0x1c, 
-	0xe7, 0xb0, 0xc5, 0x6b, 0x5b, 0xa1, 0x58, 0x95, 0x45, 0x73, 0x54, 0x7d, 0xf , 
-	0x5b, 0x2a, 0xa7, 0x7a, 0x8e, 0x5d, 0x89, 0x39, 0x2d, 0x53, 0xc3, 0x18, 0xce, 
-	0xe3, 0xf8, 0x52, 0x5b, 0xc7, 0xcf, 0x23, 0x3e, 0xd5, 0x63, 0x3 , 0xdb, 0xeb, 
-	0x58, 0xb3, 0xe9, 0xa1, 0x10, 0x5e, 0x3b, 0xd1, 0xf8, 0xd2, 0x71, 0x4d, 0x91, 
-	0xc2, 0x8e, 0xc4, 0xd2, 0x36, 0x72, 0xb2, 0x9 , 0x1f, 0x1c, 0x77, 0xa8, 0xe3, 
-	0x8f, 0xcd, 0x3b, 0x88, 0xf9, 0x73, 0xf2, 0xff, 0x0 , 0xb4, 0x7f, 0xc2, 0x96, 
-	0x34, 0x32, 0xb3, 0x64, 0xfc, 0x83, 0xef, 0x11, 0xdf, 0xfd, 0x91, 0x56, 0x40, 
-	0xc7, 0x60, 0xf , 0xa0, 0xfe, 0x11, 0xe9, 0x41, 0x9c, 0x6f, 0x52, 0x5e, 0x41, 
-	0x1a, 0xe2, 0x9f, 0xf8, 0xd3, 0x56, 0x9d, 0xf8, 0x50, 0x76, 0xa0, 0xce, 0x29, 
-	0xf1, 0xab, 0x33, 0x60, 0xc , 0xfe, 0x14, 0xfb, 0x58, 0x24, 0x99, 0xbe, 0x55, 
-	0xe2, 0xad, 0xc7, 0x24, 0x56, 0xca, 0x71, 0x86, 0x7f, 0xe1, 0x3 , 0xfa, 0xd5, 
-	0x28, 0x91, 0x2a, 0x89, 0x68, 0xb7, 0x26, 0x59, 0x93, 0x49, 0xd3, 0x64, 0xb8, 
-	0x2c, 0xa2, 0x66, 0x5c, 0xc , 0xff, 0x0 , 0xd , 0x71, 0x46, 0x5f, 0x31, 0xa6, 
-	0xd4, 0x25, 0x19, 0x69, 0xb2, 0x23, 0x1e, 0x8b, 0x57, 0xfc, 0x4f, 0x76, 0x6e, 
-	0x6e, 0x63, 0xb1, 0x57, 0x38, 0x6e, 0x65, 0x3e, 0x8b, 0xdc, 0xfe, 0x35, 0x9f, 
-	0xa9, 0x32, 0xbb, 0xac, 0x51, 0x7c, 0xa1, 0x47, 0x6e, 0x82, 0xb7, 0xa6, 0xb4, 
-	0xb9, 0xf2, 0x39, 0xd6, 0x2b, 0x9a, 0xa7, 0xb1, 0x4f, 0x6d, 0x5f, 0xaf, 0xfc, 
-	0x2 , 0xb5, 0x9c, 0x3f, 0x69, 0xb9, 0x51, 0x86, 0x4d, 0xcf, 0xb9, 0xb1, 0xe9, 
-	0x5d, 0x2c, 0x2a, 0x15, 0x0 , 0x1d, 0x2b, 0x37, 0x41, 0xb7, 0xda, 0x86, 0x66, 
-	0x24, 0x96, 0xe8, 0x4f, 0xa5, 0x6a, 0xf , 0xa5, 0x65, 0x37, 0x76, 0x7b, 0x19, 
-	0x36, 0x17, 0xd8, 0xe1, 0xf9, 0x9e, 0xf2, 0xd4, 0x7a, 0x2b, 0x67, 0x80, 0x6a, 
-	0x68, 0xda, 0x54, 0xe8, 0x40, 0xfa, 0xd5, 0x70, 0x48, 0xee, 0x68, 0xc9, 0xef, 
-	0xcd, 0x49, 0xeb, 0x38, 0xdc, 0xbb, 0x1d, 0xdc, 0xb1, 0xf1, 0xb9, 0x4d, 0x48, 
-	0x35, 0x39, 0x57, 0xa6, 0xd3, 0xf8, 0xd6, 0x70, 0x6 , 0x97, 0x6e, 0x7a, 0x9a, 
-	0x7c, 0xcc, 0xcd, 0xd3, 0x87, 0x54, 0x68, 0x49, 0xac, 0x4a, 0xb1, 0x92, 0x0 , 
-	0xcf, 0x6e, 0x4f, 0x5e, 0xd5, 0xd5, 0xe9, 0x71, 0xc6, 0x6c, 0x63, 0x8d, 0x62, 
-	0xd3, 0xef, 0x76, 0xa8, 0xdd, 0xe5, 0xb1, 0x86, 0x5c, 0xf7, 0x39, 0xe3, 0x3f, 
-	0x99, 0xae, 0x2f, 0x4b, 0x44, 0x6d, 0x62, 0xdd, 0x4c, 0xc6, 0x30, 0x8c, 0x64, 
-	0x2c, 0xa9, 0xb8, 0x8d, 0xbd, 0x38, 0xc8, 0xef, 0x8a, 0xec, 0xe6, 0x63, 0x71, 
-	0xa , 0x96, 0x36, 0xba, 0x87, 0xfb, 0x4a, 0xc , 0x53, 0xf , 0xe5, 0x9f, 0xd6, 
-	0xb6, 0x83, 0x6d, 0x6a, 0x7c, 0xae, 0x77, 0x38, 0xfb, 0x75, 0x4e, 0x3b, 0x25, 
-	0xf9, 0x96, 0x1e, 0xe4, 0xdb, 0x48, 0xb1, 0x35, 0xcd, 0xe5, 0x97, 0xa4, 0x37, 
-	0xb1, 0x9 , 0x63, 0x3f, 0x89, 0x3 , 0x8f, 0xc0, 0xd3, 0xd5, 0xb , 0x5e, 0x9 , 
-	0x12, 0xc8, 0x4a, 0x7f, 0xe7, 0xae, 0x97, 0x2e, 0xd2, 0x7f, 0xed, 0x99, 0xe9, 
-	0xff, 0x0 , 0x7c, 0x8a, 0xa7, 0xe6, 0x9b, 0x79, 0x16, 0x24, 0xba, 0xb9, 0xb1, 
-	0xcf, 0x26, 0x1b, 0xb4, 0xde, 0x87, 0xf4, 0xe9, 0xff, 0x0 , 0x1 , 0x34, 0xbe, 
-	0x58, 0x79, 0x8c, 0x92, 0x58, 0x9 , 0x0 , 0xe4, 0xcd, 0xa7, 0x3e, 0x3f, 0x12, 
-	0xa3, 0x20, 0x7e, 0x42, 0xac, 0xf1, 0x4b, 0x92, 0xdd, 0xb , 0x96, 0x68, 0x9e, 
-	0xe6, 0xde, 0xe8, 0x83, 0x8d, 0x97, 0xc9, 0xe5, 0x4c, 0xbe, 0xdb, 0xc7, 0xf5, 
-	0x22, 0xb0, 0xbe, 0x23, 0x5c, 0x9b, 0x3f, 0xc , 0x25, 0x92, 0xac, 0xd0, 0x35, 
-	0xec, 0xb9, 0x78, 0xcc, 0xc2, 0x48, 0xdd, 0x17, 0x90, 0x55, 0xb9, 0xfe, 0x22, 
-	0x3b, 0x9e, 0x95, 0xa5, 0x15, 0xc1, 0x9d, 0xf6, 0x8b, 0xeb, 0x5b, 0x95, 0xec, 
-	0x97, 0xd1, 0xe1, 0xfe, 0x9b, 0xb9, 0xc7, 0xe6, 0x2b, 0x8b, 0xf8, 0x87, 0x3a, 
-	0xb6, 0xbc, 0x6d, 0xd2, 0x26, 0x84, 0x5a, 0xc4, 0xa8, 0xd1, 0x6f, 0xdc, 0x11, 
-	0x88, 0xdc, 0xd8, 0xeb, 0xc7, 0x23, 0xb9, 0xa6, 0x82, 0xda, 0x1c, 0xf6, 0x86, 
-	0x9f, 0x68, 0xf1, 0x3 , 0x2 , 0x7e, 0x54, 0xc2, 0x73, 0xdb, 0xd6, 0xba, 0xdd, 
-	0x5b, 0x65, 0xce, 0x9b, 0x25, 0xb4, 0x5b, 0x54, 0x6d, 0xe0, 0xaa, 0xf5, 0xae, 
-	0x53, 0xc3, 0x23, 0x2b, 0x24, 0xc0, 0xe0, 0xc9, 0x23, 0x10, 0x7f, 0x4a, 0xeb, 
-	0xf4, 0xb8, 0xd4, 0xdb, 0x12, 0x14, 0xb7, 0xbe, 0x7a, 0xd6, 0x6b, 0x59, 0x1f, 
-	0x53, 0x83, 0xa7, 0xc9, 0x83, 0x8b, 0xef, 0xa8, 0xff, 0x0 , 0x80, 0xb7, 0x62, 
-	0x36, 0xb8, 0x89, 0x86, 0x4d, 0xba, 0xac, 0xe8, 0x42, 0x65, 0x87, 0x3b, 0x5b, 
-	0x1e, 0xb9, 0xc , 0x38, 0xaf, 0x4e, 0xbe, 0x8e, 0x43, 0x6b, 0xf6, 0x45, 0x50, 
-	0xad, 0x1c, 0x87, 0x66, 0x14, 0xe1, 0x41, 0xe0, 0x37, 0x7 , 0x24, 0x5 , 0xda, 
-	0x8 , 0xf4, 0x2 , 0xbc, 0x53, 0xe1, 0xdd, 0xdc, 0xfa, 0x4f, 0x8c, 0xb1, 0x1c, 
-	0xab, 0x9 , 0x49, 0x24, 0x89, 0x8b, 0xe , 0x36, 0x90, 0x7f, 0xcf, 0xe5, 0x5e, 
-	0xe8, 0xb1, 0x25, 0xfd, 0xe0, 0x58, 0x9d, 0xa3, 0x2b, 0x6e, 0x1d, 0x17, 0x77, 
-	0x2c, 0x3e, 0xeb, 0xa8, 0x3d, 0xf1, 0x80, 0x47, 0x3d, 0xab, 0x79, 0xf4, 0x3e, 
-	0x65, 0xab, 0x36, 0x8e, 0x7b, 0x51, 0xb6, 0xfb, 0x6e, 0x95, 0x71, 0xa7, 0xce, 
-	0x58, 0xc7, 0x3c, 0x2c, 0x99, 0x7 , 0xa0, 0x2b, 0xdf, 0xf3, 0xc7, 0xe1, 0x5e, 
-	0x31, 0xe1, 0xf9, 0x21, 0xb0, 0xba, 0x6f, 0xb4, 0xc6, 0xa6, 0x45, 0xc2, 0xf5, 
-	0xce, 0xdc, 0x1c, 0x73, 0x8c, 0x90, 0x78, 0xef, 0x5e, 0xc1, 0xa8, 0x5e, 0x2d, 
-	0xb5, 0xe1, 0x47, 0x2c, 0x19, 0x9f, 0x39, 0xc7, 0x0 , 0x91, 0x82, 0x4f, 0xa8, 
-	0x27, 0x6f, 0xd3, 0x35, 0xe5, 0x3e, 0x29, 0x53, 0x6f, 0xe2, 0x4b, 0x8b, 0x55, 
-	0xc4, 0x6a, 0xd3, 0x19, 0x77, 0x5 , 0xdf, 0xbb, 0x3f, 0x36, 0x40, 0x24, 0x0 , 
-	0x39, 0xed, 0x9a, 0xcc, 0x89, 0x1e, 0xab, 0xf0, 0xb7, 0x58, 0xcd, 0xa4, 0x3a, 
-	0x82, 0x48, 0xc6, 0x4d, 0x16, 0xed, 0x5b, 0x95, 0xdb, 0xfb, 0x99, 0x39, 0x3 , 
-	0x3 , 0xfd, 0xa0, 0xf5, 0xf5, 0x66, 0x8f, 0x2c, 0x57, 0xfa, 0x2c, 0x77, 0xc9, 
-	0xc , 0x86, 0x37, 0x0 , 0xb4, 0x84, 0x7c, 0xa3, 0xa5, 0x7c, 0x61, 0xf0, 0x87, 
-	0x53, 0x13, 0x6a, 0xd7, 0x5a, 0x6c, 0x96, 0xf2, 0xa2, 0x5d, 0x5a, 0xc9, 0x10, 
-	0x75, 0x8b, 0x6a, 0xef, 0x41, 0xbd, 0x73, 0x8e, 0x39, 0x0 , 0xfa, 0x75, 0xaf, 
-	0xa7, 0xbe, 0x5 , 0xeb, 0xb2, 0x5c, 0x78, 0x36, 0xd6, 0x16, 0x99, 0x7c, 0xc8, 
-	0x97, 0x1 , 0x43, 0x1d, 0xdc, 0x1f, 0x6e, 0x9d, 0x7 , 0xe7, 0x5d, 0xf8, 0x59, 
-	0xd9, 0xd8, 0xe6, 0xad, 0x1d, 0xe , 0xfa, 0xd4, 0xc6, 0x22, 0xdc, 0xb2, 0x22, 
-	0xab, 0x30, 0xda, 0x73, 0xdc, 0xf1, 0x83, 0xf5, 0xab, 0x65, 0x66, 0x8d, 0x97, 
-	0xcd, 0x8f, 0x1d, 0x86, 0x38, 0xff, 0x0 , 0xf5, 0xf5, 0xa4, 0xb5, 0xbf, 0xe , 
-	0x3c, 0xd9, 0xa2, 0x92, 0x38, 0xe3, 0x4f, 0x91, 0xd6, 0x30, 0x4a, 0x92, 0xf , 
-	0x7 , 0xa7, 0x1c, 0x55, 0x8f, 0xdc, 0x16, 0x5d, 0x93, 0xf , 0x9d, 0x33, 0xb4, 
-	0xe0, 0x63, 0x1f, 0x8f, 0x1d, 0xeb, 0xbb, 0x46, 0x73, 0x6a, 0x86, 0x3a, 0x2b, 
-	0x29, 0x5f, 0xbd, 0xc7, 0xdd, 0xee, 0x3e, 0x99, 0xac, 0xcd, 0x42, 0xc5, 0x24, 
-	0x2c, 0xad, 0xd3, 0xd7, 0x1c, 0xfe, 0x35, 0xb1, 0x34, 0x65, 0xad, 0xd2, 0x47, 
-	0x51, 0x8d, 0xc7, 0x9c, 0xe3, 0x1f, 0x95, 0x57, 0xbd, 0x56, 0x64, 0xca, 0xa8, 
-	0x12, 0x5 , 0xce, 0x77, 0x0 , 0x7f, 0xa , 0x52, 0x82, 0x5 , 0x23, 0x91, 0xba, 
-	0xd2, 0x95, 0x2e, 0x18, 0x32, 0xf1, 0xd8, 0x81, 0x5c, 0xdf, 0x8e, 0x7c, 0x1f, 
-	0xa7, 0x6b, 0xd6, 0x26, 0xd , 0x42, 0xd8, 0x49, 0xb4, 0x7e, 0xee, 0x45, 0xe1, 
-	0xd3, 0xfd, 0xd6, 0xed, 0xfc, 0xab, 0xd1, 0x26, 0x64, 0x2a, 0xbe, 0x72, 0x79, 
-	0x6c, 0x47, 0x24, 0x8e, 0x33, 0xef, 0xe9, 0x59, 0xfa, 0xad, 0xb6, 0xd5, 0xf4, 
-	0xf4, 0xc0, 0xc8, 0x3f, 0x4a, 0xe7, 0x95, 0x34, 0x6b, 0x19, 0x9f, 0x28, 0x78, 
-	0xfb, 0xc1, 0x5a, 0x97, 0x86, 0xe6, 0x69, 0x70, 0xd7, 0x16, 0x5b, 0xb8, 0x99, 
-	0x57, 0x5 , 0x3d, 0x3 , 0x8e, 0xc7, 0xdf, 0xa1, 0xae, 0x62, 0xbe, 0xae, 0xd7, 
-	0x34, 0xc4, 0x9e, 0x37, 0x12, 0x46, 0xae, 0xac, 0xb8, 0x65, 0x75, 0x4 , 0x11, 
-	0xef, 0xeb, 0x5e, 0x2b, 0xf1, 0x2b, 0xe1, 0xd4, 0x96, 0x4d, 0x26, 0xa3, 0xa0, 
-	0xc6, 0xcf, 0x0 , 0xc9, 0x96, 0xd0, 0xc , 0xb4, 0x7e, 0xe9, 0xea, 0x3d, 0xba, 
-	0x8a, 0xe5, 0x70, 0x68, 0xd9, 0x3b, 0x9e, 0x73, 0x45, 0x14, 0x54, 0x8c, 0x28, 
-	0xfc, 0x68, 0xfc, 0x28, 0xfc, 0x28, 0x1 , 0x1b, 0xeb, 0x49, 0x45, 0x14, 0x0 , 
-	0x53, 0x4d, 0x19, 0xa2, 0x80, 0xa , 0x69, 0xa5, 0x6a, 0x4a, 0x0 , 0x28, 0xfc, 
-	0x68, 0xfc, 0x28, 0xfc, 0x28, 0x1 , 0x3f, 0x1a, 0x43, 0x4a, 0xdf, 0x4a, 0x4a, 
-	0x0 , 0x29, 0xa6, 0x95, 0xa9, 0x28, 0x0 , 0xa3, 0x34, 0x1a, 0x6d, 0x0 , 0x14, 
-	0x7e, 0x34, 0x51, 0xf8, 0x50, 0x2 , 0x7e, 0x34, 0x66, 0x86, 0xfa, 0x52, 0x53, 
-	0x0 , 0xa4, 0xcd, 0xd , 0x49, 0x4c, 0x2 , 0x8c, 0xd0, 0x69, 0xb4, 0x0 , 0x51, 
-	0xf8, 0xd1, 0x47, 0xe1, 0x40, 0x7 , 0xe3, 0x49, 0x9f, 0x7a, 0xf , 0xd2, 0x92, 
-	0x80, 0xa , 0x33, 0x41, 0xa6, 0xd0, 0x1 , 0x46, 0x68, 0x34, 0xda, 0x0 , 0x28, 
-	0xa2, 0x8f, 0xc2, 0x80, 0x26, 0xfc, 0x68, 0xfc, 0x68, 0xfc, 0x28, 0xfc, 0x2a, 
-	0x80, 0x29, 0x56, 0x92, 0x8c, 0xd0, 0x3 , 0x85, 0x3a, 0x9b, 0x46, 0x68, 0x1 , 
-	0xc2, 0x97, 0xf1, 0xa4, 0xa2, 0x80, 0x1d, 0xf8, 0xd1, 0x47, 0xe1, 0x45, 0x48, 
-	0xe , 0xcd, 0x14, 0xda, 0x70, 0xa0, 0x7 , 0x66, 0x8a, 0x6d, 0x38, 0x50, 0x2 , 
-	0xe7, 0xde, 0x97, 0xf1, 0xa6, 0xad, 0x3b, 0xf0, 0xa0, 0x2 , 0x8a, 0x28, 0xa0, 
-	0x7 , 0x52, 0x83, 0x4d, 0x6 , 0x96, 0x80, 0x1d, 0x9a, 0x51, 0x4d, 0x5a, 0x5a, 
-	0x0 , 0x77, 0xe3, 0x47, 0xe3, 0x48, 0x3e, 0x94, 0xbf, 0x85, 0x0 , 0x14, 0xa0, 
-	0xd2, 0x51, 0x40, 0xe , 0xcd, 0x14, 0xda, 0x70, 0xa0, 0x7 , 0x66, 0x8a, 0x6d, 
-	0x38, 0x50, 0x2 , 0xe6, 0xa4, 0xb6, 0x0 , 0xbe, 0x4f, 0xe1, 0x51, 0x75, 0xa9, 
-	0x84, 0x8a, 0x8a, 0x70, 0x79, 0xc7, 0x43, 0x5b, 0x51, 0x8d, 0xdd, 0xd9, 0x9d, 
-	0x49, 0x74, 0x44, 0x93, 0x5c, 0x2c, 0x2b, 0xb8, 0x7c, 0xcd, 0xcf, 0x38, 0xfd, 
-	0x2b, 0x13, 0x5a, 0xbf, 0x55, 0x5c, 0xc7, 0x96, 0x90, 0xf2, 0x14, 0x76, 0x1d, 
-	0xf2, 0x7b, 0x53, 0xb5, 0x4b, 0xa1, 0xb , 0x60, 0x3a, 0xfe, 0xf0, 0xf0, 0x33, 
-	0xd3, 0xde, 0x93, 0x49, 0xb3, 0x6b, 0xbd, 0xf0, 0xb3, 0x2b, 0x2b, 0x61, 0xa5, 
-	0x91, 0x87, 0x6f, 0x45, 0x3e, 0xb5, 0xa4, 0xa4, 0xe4, 0xc2, 0x29, 0x45, 0x19, 
-	0x5a, 0x3e, 0x9d, 0x79, 0xa9, 0xde, 0x33, 0x41, 0x81, 0xff, 0x0 , 0x3d, 0x26, 
-	0x7e, 0x89, 0xec, 0x3d, 0x4d, 0x76, 0xde, 0x1c, 0xd3, 0x6d, 0xb4, 0x9b, 0x66, 
-	0x8e, 0xd6, 0x30, 0x64, 0x73, 0xfb, 0xc9, 0xf , 0x2e, 0xdf, 0x5f, 0x6f, 0x61, 
-	0x4f, 0xb1, 0xb7, 0x8e, 0xde, 0x31, 0x15, 0xbc, 0x6b, 0x1a, 0x1 , 0x85, 0x4e, 
-	0x9f, 0xfe, 0xba, 0xbb, 0x6f, 0x17, 0x98, 0xfb, 0x71, 0x93, 0x9c, 0x1e, 0x6a, 
-	0xa2, 0xac, 0x44, 0xa5, 0x72, 0x58, 0x23, 0x20, 0x13, 0xb9, 0xbe, 0x61, 0x8d, 
-	0xa7, 0xf5, 0x26, 0xae, 0x59, 0xff, 0x0 , 0x75, 0xa4, 0xcb, 0x6d, 0xca, 0x9f, 
-	0xa7, 0xa8, 0xee, 0x2a, 0x3b, 0x36, 0x2e, 0x79, 0xe5, 0x57, 0xa1, 0x1d, 0x47, 
-	0xbf, 0xd2, 0xa4, 0x90, 0x96, 0x6d, 0xdb, 0x7e, 0x60, 0x7e, 0x51, 0xef, 0xed, 
-	0x5a, 0x19, 0x92, 0xb0, 0xd9, 0xb5, 0x46, 0x56, 0x42, 0x43, 0x0 , 0x7a, 0x1f, 
-	0xa6, 0x6a, 0xcc, 0x9a, 0x84, 0x31, 0xed, 0x17, 0x2f, 0xb7, 0x7f, 0x46, 0x44, 
-	0xfd, 0xd , 0x54, 0x91, 0x80, 0x87, 0x87, 0x40, 0xdb, 0x7e, 0x60, 0x7a, 0xaf, 
-	0xa7, 0xd2, 0x99, 0x35, 0xde, 0x9e, 0x74, 0xff, 0x0 , 0xdf, 0x5b, 0x97, 0x78, 
-	0xf2, 0x37, 0x63, 0xe6, 0x18, 0x1f, 0x78, 0x63, 0xa8, 0xcf, 0x5a, 0x97, 0x21, 
-	0xc6, 0x37, 0x2d, 0x33, 0x90, 0xa5, 0x94, 0x9d, 0x9c, 0xf5, 0x7 , 0xf5, 0x39, 
-	0xe2, 0x93, 0xcd, 0x44, 0x8c, 0xb1, 0x24, 0x64, 0x60, 0x9c, 0x92, 0x3f, 0x97, 
-	0x2 , 0xb1, 0xb5, 0x2d, 0x64, 0xc8, 0x84, 0x86, 0x48, 0xc6, 0xde, 0x18, 0xf0, 
-	0x1b, 0xdf, 0x3d, 0xeb, 0x9b, 0xd4, 0xbc, 0x4a, 0x8a, 0xb8, 0x6b, 0x92, 0xe0, 
-	0x70, 0x70, 0x78, 0x35, 0x32, 0xa8, 0x68, 0xa9, 0xbe, 0xa7, 0x71, 0xf6, 0x88, 
-	0x91, 0x7c, 0xd1, 0x22, 0x81, 0x1b, 0x65, 0x81, 0xc3, 0x32, 0xf6, 0xe7, 0xda, 
-	0xa1, 0xbc, 0xd4, 0x2d, 0xd1, 0x9e, 0x2f, 0xb4, 0x79, 0xaa, 0x39, 0x1b, 0x4f, 
-	0x43, 0xe8, 0x3d, 0xab, 0xcd, 0x2e, 0x7c, 0x4d, 0x29, 0xf9, 0xe3, 0x8d, 0xb3, 
-	0x9e, 0x1a, 0xab, 0x9d, 0x73, 0x50, 0x7c, 0xe1, 0x95, 0x78, 0xe4, 0xe3, 0x1f, 
-	0xa5, 0x4f, 0x33, 0x65, 0x72, 0xa3, 0xd0, 0x9f, 0x54, 0x89, 0x64, 0x7 , 0x61, 
-	0x75, 0xf5, 0x23, 0xa7, 0xbd, 0x41, 0x26, 0xb3, 0x2 , 0x36, 0x1e, 0xd , 0xd9, 
-	0x39, 0xf9, 0x48, 0xcf, 0xe0, 0x7f, 0x2a, 0xf3, 0xdb, 0x8d, 0x52, 0xeb, 0x69, 
-	0x69, 0x2f, 0x3f, 0x5 , 0x38, 0xaa, 0xf3, 0xea, 0x81, 0xd7, 0x22, 0xea, 0x69, 
-	0x9 , 0x1c, 0x8c, 0x73, 0x49, 0xca, 0xdd, 0x47, 0xca, 0xbb, 0x1d, 0xf5, 0xc6, 
-	0xb6, 0xd0, 0x7c, 0xbb, 0xa3, 0x1c, 0x72, 0xbb, 0xc9, 0x1f, 0x5a, 0xca, 0xd6, 
-	0xb5, 0x84, 0xbb, 0xb7, 0x10, 0x65, 0x4b, 0x37, 0x1c, 0x7b, 0xd7, 0x11, 0x25, 
-	0xd5, 0xdb, 0xe4, 0x24, 0x52, 0x63, 0xdf, 0x8a, 0x14, 0xde, 0x79, 0x9b, 0xb0, 
-	0xa0, 0xe3, 0xae, 0xe2, 0x6b, 0xa , 0x93, 0x8b, 0x56, 0xb9, 0x71, 0x8d, 0x99, 
-	0x47, 0x5a, 0x27, 0xed, 0x8e, 0xae, 0x72, 0x43, 0x91, 0x50, 0xed, 0xcd, 0x4d, 
-	0xa8, 0x42, 0xc9, 0x3a, 0x7 , 0x24, 0xb3, 0xc , 0x92, 0x69, 0xbb, 0x7d, 0xab, 
-	0x9e, 0x3b, 0x9a, 0x7d, 0x92, 0x3a, 0x46, 0xa9, 0x8 , 0x3 , 0xd3, 0xf0, 0xa4, 
-	0xc6, 0x7a, 0x66, 0xa8, 0x92, 0x33, 0x57, 0xf4, 0x9b, 0xd3, 0x6d, 0x6f, 0xb0, 
-	0x2f, 0x53, 0x93, 0x54, 0x88, 0x3e, 0xd5, 0x7b, 0x4f, 0x6b, 0x75, 0xb7, 0x2 , 
-	0x41, 0xf3, 0x64, 0xd0, 0xb7, 0x2a, 0x3e, 0x85, 0xc4, 0xd4, 0xd4, 0xf , 0xb8, 
-	0x7d, 0xce, 0x69, 0xcb, 0xa9, 0x42, 0xdd, 0x54, 0xd5, 0x7d, 0xd6, 0xdf, 0xdd, 
-	0xa1, 0x8c, 0x18, 0xe1, 0x5 , 0x69, 0x79, 0x77, 0x2b, 0x96, 0x3d, 0x8b, 0x7f, 
-	0x6a, 0xb4, 0x7e, 0xb8, 0xfc, 0xa9, 0xde, 0x45, 0xbc, 0xb9, 0xd8, 0xe3, 0x9e, 
-	0x83, 0x35, 0x9c, 0xcb, 0x19, 0xe8, 0x28, 0x9 , 0x8e, 0x54, 0xb0, 0xfa, 0x51, 
-	0xcc, 0xfa, 0x87, 0x2f, 0x66, 0x3f, 0x52, 0xb1, 0x31, 0x40, 0xce, 0x39, 0x3 , 
-	0xdb, 0x91, 0x58, 0xed, 0xf7, 0xab, 0x61, 0xae, 0x26, 0x58, 0x59, 0x1c, 0xf9, 
-	0x89, 0xdc, 0xd6, 0x55, 0xca, 0xed, 0x98, 0x81, 0xd3, 0x3c, 0x56, 0x35, 0x2d, 
-	0x7d, 0x7 , 0xaf, 0x2e, 0xa4, 0x6b, 0xeb, 0x5d, 0x57, 0x87, 0xe4, 0x59, 0xb4, 
-	0x95, 0x4 , 0xf3, 0x13, 0x15, 0x3f, 0xcc, 0x57, 0x2a, 0xb5, 0xb1, 0xe1, 0x79, 
-	0xb6, 0x89, 0x60, 0x27, 0x97, 0x5e, 0x3e, 0xa2, 0xaa, 0x93, 0xb4, 0xc8, 0xb5, 
-	0xe2, 0xd1, 0x25, 0xd5, 0xdb, 0x47, 0x24, 0xb0, 0xb0, 0xee, 0x70, 0x6b, 0x32, 
-	0x46, 0xdc, 0xd9, 0xab, 0x97, 0x12, 0xa4, 0xc6, 0x45, 0x75, 0xc3, 0xe7, 0x20, 
-	0xfb, 0xd5, 0x23, 0xd6, 0xa6, 0xa3, 0xb9, 0xb4, 0x23, 0x60, 0xc6, 0x7b, 0xd4, 
-	0x6c, 0x30, 0x6a, 0x4c, 0x63, 0xb5, 0x48, 0x90, 0x3c, 0xca, 0xcc, 0xa3, 0xee, 
-	0x8a, 0x8b, 0x5c, 0xa2, 0xb2, 0xd4, 0xea, 0x4b, 0x2f, 0xb8, 0xa8, 0x18, 0x62, 
-	0x9f, 0xb , 0xed, 0x6e, 0xb4, 0x90, 0xe , 0xa6, 0xc8, 0x3a, 0x37, 0xa7, 0x5a, 
-	0x92, 0x45, 0xb , 0xcf, 0xad, 0x2a, 0xe0, 0x8a, 0xa5, 0xb8, 0x9e, 0xa8, 0x65, 
-	0xb9, 0xc3, 0x86, 0x7 , 0x4 , 0x7d, 0xd3, 0x5a, 0xd6, 0x2a, 0xc6, 0x34, 0x9a, 
-	0xc9, 0x9d, 0xae, 0x52, 0x4d, 0xdc, 0x1 , 0x91, 0xd0, 0x70, 0x3a, 0x9f, 0xa7, 
-	0xd6, 0xb1, 0xfe, 0xeb, 0xfb, 0x76, 0xab, 0xda, 0x6d, 0xfb, 0xdb, 0x5c, 0x24, 
-	0xa1, 0x77, 0x6c, 0xed, 0x8e, 0x18, 0x7a, 0x1f, 0x51, 0xf5, 0xa1, 0xea, 0x8c, 
-	0x2c, 0xd3, 0x3d, 0x2b, 0xc1, 0x3a, 0x9d, 0x9e, 0xa7, 0x21, 0xb4, 0x72, 0xa9, 
-	0x7b, 0x19, 0x21, 0xa3, 0xe9, 0xbf, 0xdd, 0x73, 0xc9, 0x1e, 0xdd, 0x45, 0x75, 
-	0xf0, 0x59, 0xf4, 0xf9, 0x7f, 0x2a, 0xf1, 0x6b, 0x97, 0x6b, 0xcb, 0xd5, 0xbc, 
-	0xb5, 0x12, 0x2 , 0xa3, 0x3c, 0xc , 0x34, 0x67, 0x27, 0x1c, 0x82, 0x7f, 0x3e, 
-	0x2b, 0xad, 0xf0, 0xe7, 0x8d, 0xf5, 0x8d, 0x3e, 0x35, 0x8a, 0xe4, 0xa5, 0xe4, 
-	0x2b, 0xd7, 0xcd, 0xe1, 0xc0, 0xff, 0x0 , 0x78, 0x75, 0xfc, 0x73, 0x5c, 0x55, 
-	0x70, 0xf2, 0xde, 0x27, 0x75, 0x1c, 0x54, 0x6d, 0x69, 0x9e, 0x86, 0xd6, 0x43, 
-	0xcb, 0x4 , 0x8e, 0x9d, 0xf1, 0x54, 0xef, 0xac, 0xf1, 0xc1, 0x1c, 0x7d, 0x2a, 
-	0x3d, 0x2f, 0xc7, 0xfe, 0x1c, 0xbb, 0x8f, 0x6d, 0xc8, 0x9a, 0xcd, 0xcf, 0x5f, 
-	0x31, 0x77, 0x2f, 0x5e, 0xcc, 0xbc, 0xfe, 0x95, 0xa4, 0x75, 0x6f, 0xf , 0xdd, 
-	0xc1, 0xba, 0xd , 0x62, 0xca, 0x4d, 0xdd, 0x7 , 0x9e, 0xa0, 0xfe, 0x47, 0x9a, 
-	0xe6, 0xe5, 0x9c, 0x77, 0x47, 0x5a, 0x95, 0x39, 0x6c, 0xce, 0x47, 0x54, 0xb5, 
-	0x3 , 0x3c, 0x1c, 0x7b, 0xd7, 0x33, 0xaa, 0x45, 0xb5, 0xf3, 0x5d, 0xde, 0xb0, 
-	0xd6, 0x85, 0x32, 0x6e, 0xad, 0xf0, 0x7 , 0xfc, 0xf5, 0x5a, 0xe1, 0xfc, 0x43, 
-	0x79, 0xa7, 0xa3, 0x7f, 0xc7, 0xec, 0x24, 0xfa, 0x2b, 0x86, 0xfd, 0x5 , 0x74, 
-	0x52, 0x93, 0x30, 0xab, 0x14, 0x8c, 0xdc, 0x7a, 0xd4, 0x33, 0xc8, 0x91, 0x44, 
-	0x5e, 0x46, 0xda, 0xa3, 0xbd, 0x52, 0xbb, 0xd6, 0x60, 0x1f, 0x2c, 0x8 , 0xce, 
-	0xdd, 0x89, 0xe0, 0x55, 0x71, 0x24, 0x8e, 0xeb, 0x3d, 0xd1, 0x57, 0x60, 0x32, 
-	0xb1, 0x67, 0x20, 0x7e, 0x15, 0xdb, 0x16, 0xd9, 0xc3, 0x29, 0x58, 0x82, 0xfa, 
-	0x66, 0xb8, 0x93, 0xcc, 0x23, 0xb , 0xd1, 0x14, 0xf5, 0x3 , 0xde, 0xa0, 0x8d, 
-	0xb6, 0x37, 0x4c, 0xd3, 0xa6, 0x63, 0x23, 0x12, 0x7e, 0xf1, 0xeb, 0x8e, 0x82, 
-	0x9d, 0x6b, 0x6b, 0x24, 0xf3, 0x8 , 0xd0, 0x7d, 0x4f, 0xa0, 0xf5, 0xa2, 0x52, 
-	0xb2, 0x1d, 0x3a, 0x6e, 0xa4, 0x94, 0x56, 0xec, 0xb3, 0xa5, 0xc6, 0xf3, 0xcd, 
-	0xbc, 0x8f, 0x95, 0x3d, 0x7 , 0x7f, 0x4a, 0xd9, 0x86, 0x30, 0xbc, 0x9e, 0x69, 
-	0x2c, 0xad, 0xd6, 0x8 , 0x56, 0x28, 0xd7, 0x81, 0xf9, 0x9a, 0x99, 0x81, 0x7 , 
-	0x4 , 0x7e, 0x75, 0xcb, 0x27, 0x76, 0x7d, 0x7e, 0xf , 0x8 , 0xa8, 0x53, 0xb7, 
-	0x51, 0x70, 0x7 , 0x4a, 0x33, 0xce, 0x3f, 0x5a, 0x4c, 0xe0, 0x66, 0xa3, 0x77, 
-	0x1 , 0x69, 0x1d, 0xae, 0x49, 0x21, 0xec, 0xe1, 0x46, 0x6a, 0x34, 0x53, 0x2b, 
-	0x1e, 0x70, 0xa3, 0xef, 0xb7, 0xa7, 0xb0, 0xf7, 0xa8, 0xb2, 0xd2, 0xc9, 0x80, 
-	0x70, 0x3b, 0x9f, 0x4a, 0xb7, 0x8 , 0xa , 0x80, 0xe , 0xdd, 0x7 , 0xf5, 0xa0, 
-	0xcd, 0x27, 0x51, 0xf9, 0x12, 0x46, 0x2 , 0xa8, 0x1 , 0x42, 0x80, 0x3e, 0x51, 
-	0xfd, 0xdf, 0xfe, 0xbd, 0x14, 0x80, 0x93, 0x4b, 0x52, 0x75, 0xc5, 0x24, 0xac, 
-	0x3a, 0xa6, 0xb5, 0x88, 0xc8, 0xe0, 0xa , 0x85, 0x79, 0xad, 0xad, 0x1e, 0x5 , 
-	0x48, 0xc3, 0x93, 0xf3, 0xb7, 0x4f, 0x6a, 0xb8, 0x46, 0xec, 0x9a, 0xb5, 0x39, 
-	0x22, 0x13, 0xc1, 0xf6, 0x6b, 0x16, 0x24, 0x9f, 0x98, 0x74, 0xf4, 0x35, 0x87, 
-	0xa8, 0x5c, 0xa5, 0xad, 0xa3, 0xca, 0xe7, 0xa2, 0xfa, 0xd7, 0x47, 0xe2, 0xe8, 
-	0x26, 0xb3, 0xd3, 0xad, 0x5a, 0xe3, 0xf7, 0x66, 0xe8, 0x19, 0x12, 0x33, 0xf7, 
-	0x8a, 0xe , 0x37, 0x11, 0xd8, 0x13, 0x9c, 0x7a, 0xe2, 0xb8, 0x4b, 0xd9, 0x7e, 
-	0xdd, 0xa8, 0x6c, 0xce, 0x61, 0xb7, 0x39, 0x6f, 0x46, 0x6f, 0x4f, 0xc2, 0xae, 
-	0x51, 0xe6, 0x95, 0x91, 0xe7, 0x62, 0x31, 0x8b, 0xf , 0x86, 0x73, 0x7b, 0xbd, 
-	0x84, 0xb7, 0x2d, 0x1d, 0xbc, 0x97, 0x33, 0x7f, 0xad, 0x9b, 0x93, 0x9e, 0xc3, 
-	0xb0, 0xa8, 0xad, 0xe3, 0x69, 0xee, 0x0 , 0x23, 0xe6, 0x7e, 0x5b, 0xd8, 0x51, 
-	0x76, 0xfe, 0x6b, 0x6c, 0x7 , 0xe5, 0x5e, 0xa6, 0xb4, 0x34, 0xb , 0x46, 0x19, 
-	0x90, 0x82, 0x64, 0x97, 0xf4, 0x15, 0xa4, 0xe5, 0xcb, 0x1d, 0xf , 0x9b, 0xcb, 
-	0xf0, 0xef, 0x15, 0x88, 0xf7, 0xb6, 0xdd, 0x97, 0xa2, 0x40, 0x88, 0x14, 0x71, 
-	0x8a, 0x91, 0x11, 0x8f, 0x40, 0x6a, 0xe4, 0x16, 0xc1, 0x6 , 0x58, 0x64, 0xd4, 
-	0xea, 0x30, 0xb8, 0x18, 0x15, 0x8f, 0x29, 0xf6, 0x7e, 0xd5, 0x2d, 0x22, 0x53, 
-	0x86, 0xce, 0x67, 0xea, 0xd , 0x59, 0x8f, 0x4d, 0xfe, 0xf3, 0xf , 0xce, 0x9e, 
-	0x4b, 0xe , 0x87, 0x3e, 0xd4, 0x7 , 0x1e, 0xbf, 0x5a, 0xa5, 0x14, 0x65, 0x2a, 
-	0x93, 0x7d, 0x47, 0x2e, 0x9d, 0xf , 0x77, 0xa5, 0x16, 0x31, 0x1f, 0xb8, 0xc3, 
-	0x8e, 0xe6, 0x99, 0xbc, 0x75, 0xcf, 0x14, 0xff, 0x0 , 0xb4, 0xc6, 0x8b, 0x96, 
-	0x23, 0x0 , 0x55, 0x2e, 0x53, 0x29, 0x4a, 0xa7, 0x72, 0x4d, 0xd , 0x62, 0x8b, 
-	0x54, 0x9d, 0xe1, 0xbe, 0x30, 0x32, 0xa2, 0xa6, 0x36, 0xe4, 0x7a, 0x9c, 0x90, 
-	0x7d, 0xc7, 0x6a, 0xda, 0x99, 0x5e, 0x5f, 0xbf, 0x67, 0xd , 0xc6, 0x3f, 0xe5, 
-	0xad, 0xab, 0x61, 0xbf, 0x21, 0xfd, 0x45, 0x65, 0xf8, 0x6e, 0x46, 0x6b, 0x21, 
-	0x22, 0x5d, 0x40, 0xc6, 0x52, 0x64, 0xf2, 0xe5, 0x8f, 0xe5, 0x19, 0x3e, 0xf9, 
-	0x15, 0x6e, 0x65, 0x50, 0xc6, 0x59, 0x6c, 0xe5, 0x8b, 0x9f, 0xf5, 0x90, 0x37, 
-	0xcb, 0xfd, 0x45, 0x6b, 0x6e, 0xc7, 0xc6, 0x57, 0xa8, 0xea, 0xd5, 0x94, 0xdf, 
-	0x56, 0x4f, 0x1c, 0xe3, 0x88, 0xa2, 0xbd, 0x65, 0xa , 0x7f, 0xd4, 0x5d, 0xc7, 
-	0xb9, 0x47, 0xf3, 0xfe, 0x54, 0xac, 0x2 , 0x31, 0x9e, 0x4b, 0x69, 0x20, 0xc1, 
-	0xff, 0x0 , 0x5f, 0x66, 0xfb, 0x94, 0x7b, 0x91, 0xdb, 0xf4, 0xa8, 0x16, 0xe0, 
-	0xb8, 0xc2, 0x5d, 0xc5, 0x3a, 0x8e, 0x89, 0x72, 0x83, 0xf9, 0xf2, 0x3f, 0x51, 
-	0x49, 0x91, 0xf , 0xef, 0x1a, 0x1b, 0x8b, 0x63, 0xda, 0x48, 0x1f, 0x72, 0xff, 
-	0x0 , 0x3f, 0xeb, 0x45, 0x8c, 0x8b, 0x76, 0x52, 0xfd, 0xaa, 0xe1, 0x43, 0x49, 
-	0x6b, 0x7c, 0x84, 0xfc, 0xc2, 0x44, 0xd9, 0x2e, 0xd1, 0xd7, 0x7 , 0xd7, 0x1e, 
-	0xe6, 0xbc, 0xcf, 0xc4, 0x37, 0x5b, 0xee, 0x2e, 0xae, 0x99, 0x8f, 0xef, 0x25, 
-	0x72, 0xe , 0x7e, 0xb8, 0xfe, 0x55, 0xdf, 0x4f, 0x76, 0xa9, 0xa6, 0xcd, 0x70, 
-	0xf2, 0x43, 0x39, 0x0 , 0x2a, 0x38, 0x5d, 0x92, 0x29, 0x27, 0xaf, 0xb8, 0xc0, 
-	0x3e, 0xb5, 0xe6, 0xda, 0xd0, 0x57, 0xb0, 0x72, 0x7e, 0xa3, 0x3e, 0xb9, 0xa5, 
-	0xd4, 0xd9, 0xc1, 0xc7, 0xf , 0xcd, 0xdd, 0xfe, 0x4b, 0xfe, 0x9 , 0x7b, 0xc3, 
-	0xa9, 0xb7, 0x4f, 0x8c, 0x7a, 0x81, 0x5d, 0x8e, 0x9f, 0x24, 0x62, 0xdd, 0x42, 
-	0x90, 0xa3, 0x15, 0xca, 0xe9, 0x29, 0xb2, 0xcd, 0x31, 0xfc, 0x20, 0x56, 0xc5, 
-	0xa4, 0xee, 0xf1, 0x2c, 0x23, 0x9d, 0xbc, 0x9e, 0x6b, 0x38, 0xca, 0xcc, 0xfa, 
-	0xe8, 0xd3, 0xfd, 0xc4, 0x23, 0xd9, 0x18, 0xda, 0x83, 0x1b, 0x4f, 0x19, 0xc9, 
-	0x2c, 0x4e, 0xab, 0xf3, 0x24, 0xaa, 0xc4, 0x64, 0x3 , 0x5e, 0xf3, 0xe1, 0xe9, 
-	0x64, 0x93, 0x4d, 0x55, 0x85, 0x44, 0x57, 0xa , 0x88, 0x63, 0x7 , 0xa6, 0x1b, 
-	0x69, 0xdb, 0xb8, 0x7d, 0x18, 0x8f, 0x4d, 0xc6, 0xbc, 0x1b, 0xc5, 0x51, 0xb4, 
-	0x7a, 0x94, 0x13, 0x15, 0xc0, 0x74, 0x28, 0x73, 0xed, 0xcd, 0x7a, 0xbf, 0xc3, 
-	0x3b, 0x86, 0x3a, 0xc , 0x53, 0x43, 0x2c, 0x8f, 0xe5, 0x4 , 0x70, 0x37, 0x75, 
-	0x4 , 0x6d, 0x65, 0xfc, 0x9 , 0x7f, 0xcc, 0x57, 0x4b, 0xd6, 0x8 , 0xf9, 0x5c, 
-	0x4c, 0x79, 0x6b, 0xc9, 0x16, 0x7c, 0x5d, 0x3 , 0xb , 0xe7, 0x48, 0xc8, 0xf2, 
-	0xd9, 0xb6, 0x2a, 0x37, 0xde, 0x8f, 0xb8, 0xcf, 0xae, 0xf , 0x7a, 0xf2, 0xf , 
-	0x89, 0x36, 0x8f, 0x17, 0x88, 0x39, 0xf3, 0x22, 0x77, 0x41, 0xf2, 0xe7, 0x8c, 
-	0x73, 0xdf, 0xd2, 0xbd, 0x8b, 0xc5, 0xd2, 0xb2, 0x4d, 0xfb, 0xc0, 0x19, 0xe3, 
-	0x3b, 0xc3, 0x1 , 0x8e, 0x3b, 0xf1, 0xed, 0x90, 0x7e, 0x95, 0xe6, 0xbf, 0x13, 
-	0x95, 0xa7, 0xb3, 0xb2, 0x9f, 0x2d, 0xe6, 0x86, 0x20, 0x90, 0x48, 0x3b, 0x7d, 
-	0x71, 0xdf, 0xa1, 0xeb, 0x59, 0x1c, 0xcc, 0x8f, 0xe1, 0xeb, 0x47, 0xa4, 0xea, 
-	0xb6, 0xba, 0x85, 0xcd, 0xeb, 0x6f, 0x82, 0x74, 0x91, 0x92, 0x48, 0xb2, 0xac, 
-	0x37, 0x61, 0x86, 0xfe, 0x31, 0xc6, 0x7a, 0x9c, 0x57, 0xd1, 0x5f, 0x4 , 0x2e, 
-	0x9a, 0xd , 0x5a, 0xfa, 0xc9, 0xdf, 0x98, 0x2e, 0x5b, 0x7 , 0x27, 0xbf, 0x4e, 
-	0x3d, 0x2b, 0xe5, 0xad, 0x26, 0x64, 0x5b, 0x85, 0x8d, 0x2e, 0x95, 0x19, 0xd8, 
-	0x2b, 0xbe, 0x1 , 0xfd, 0x71, 0x8c, 0xf3, 0xeb, 0x5f, 0x42, 0xfc, 0x23, 0xba, 
-	0x13, 0xf8, 0xc2, 0xce, 0x48, 0xd9, 0xa5, 0x1a, 0x96, 0x9f, 0x1c, 0xa5, 0x97, 
-	0x3f, 0x3b, 0x81, 0x86, 0xe3, 0xeb, 0x9a, 0xde, 0x94, 0xac, 0xcc, 0xa4, 0xb4, 
-	0x3d, 0xf9, 0x6f, 0xaf, 0xed, 0x58, 0xc6, 0x93, 0x6d, 0x46, 0x0 , 0xb0, 0xdd, 
-	0x9e, 0x7b, 0x77, 0xa9, 0x5a, 0xe9, 0x64, 0x88, 0x19, 0x32, 0xa4, 0x37, 0x6c, 
-	0xfa, 0x76, 0xa9, 0xe3, 0xd1, 0xa4, 0x96, 0xd6, 0x19, 0x90, 0x7c, 0xd2, 0x2 , 
-	0xc8, 0xa1, 0xc6, 0x48, 0x18, 0x1d, 0x3e, 0xa7, 0x1f, 0x85, 0x41, 0x79, 0xa5, 
-	0x5e, 0x2d, 0xbe, 0x8 , 0xda, 0x1 , 0x1d, 0x3a, 0xe7, 0x3d, 0xfb, 0x57, 0x7a, 
-	0xa8, 0x73, 0xb8, 0x16, 0x61, 0xd4, 0xa4, 0x55, 0xf9, 0x6e, 0x1b, 0xef, 0x60, 
-	0x20, 0xcf, 0xca, 0x3f, 0x1e, 0xb5, 0x76, 0xc3, 0x50, 0xb6, 0x96, 0x33, 0x13, 
-	0x26, 0xc9, 0x7d, 0x46, 0x47, 0xe4, 0x2b, 0x98, 0xd4, 0x20, 0x96, 0x16, 0xdc, 
-	0x9f, 0x30, 0x5e, 0x37, 0x5 , 0x22, 0xa6, 0xd2, 0xef, 0xc9, 0x4d, 0xb2, 0xa0, 
-	0xdd, 0xd8, 0x91, 0xda, 0xb4, 0x53, 0x4c, 0xcd, 0xc6, 0xc6, 0xf4, 0xb1, 0xc7, 
-	0x34, 0x4a, 0x5b, 0x70, 0x53, 0x9e, 0x58, 0xc , 0x7e, 0x6 , 0xa8, 0x6a, 0x50, 
-	0x5c, 0x5a, 0xdb, 0xac, 0x66, 0x50, 0xd1, 0xed, 0xc9, 0x1d, 0x48, 0x1d, 0x68, 
-	0x3a, 0x88, 0x58, 0xf6, 0x47, 0x24, 0x6e, 0xa4, 0x1 , 0xb6, 0x41, 0xf7, 0x47, 
-	0xa0, 0x39, 0xcf, 0xe2, 0x6a, 0x24, 0x94, 0xa4, 0xc3, 0xcb, 0x66, 0xdb, 0x8c, 
-	0x12, 0xc7, 0x73, 0x63, 0xd3, 0x3d, 0xe8, 0x7a, 0x82, 0x32, 0xff, 0x0 , 0x77, 
-	0x3c, 0x2c, 0x8c, 0xbc, 0xe7, 0xe4, 0x19, 0xe7, 0xdf, 0xeb, 0x58, 0xba, 0xa5, 
-	0x93, 0x27, 0xcd, 0x8e, 0x87, 0x9a, 0xda, 0xd5, 0x6d, 0xf1, 0x3b, 0x1b, 0x76, 
-	0x54, 0x6e, 0xa3, 0xb0, 0xcf, 0xa8, 0xf4, 0x34, 0xd9, 0x8c, 0x53, 0x59, 0x84, 
-	0x99, 0x3c, 0x99, 0x94, 0xf5, 0x7 , 0x86, 0xcf, 0x52, 0x47, 0x6f, 0xe5, 0x58, 
-	0x4a, 0x26, 0xd1, 0x67, 0x89, 0xfc, 0x50, 0xf8, 0x7e, 0xb7, 0x86, 0x5d, 0x4f, 
-	0x46, 0x8c, 0x2d, 0xdf, 0x2d, 0x2d, 0xb8, 0x18, 0x59, 0xbd, 0xc7, 0xa3, 0x7e, 
-	0x86, 0xbc, 0x9a, 0x54, 0x78, 0xe5, 0x68, 0xe4, 0x56, 0x46, 0x56, 0x21, 0x95, 
-	0x86, 0x8 , 0x3d, 0xc1, 0x15, 0xf5, 0x3e, 0xaf, 0x6c, 0xe8, 0xd9, 0x54, 0x20, 
-	0xaf, 0xde, 0x5c, 0x73, 0x8a, 0xf3, 0x9f, 0x8a, 0x1e, 0x9 , 0x83, 0x58, 0x56, 
-	0xbf, 0xb0, 0xb , 0x15, 0xf8, 0x5c, 0xe7, 0x0 , 0x2c, 0xe3, 0xd1, 0xbd, 0xf , 
-	0xa1, 0xfc, 0xeb, 0x9a, 0x51, 0xb1, 0x67, 0x8e, 0x1a, 0x4a, 0x92, 0xea, 0x9 , 
-	0xad, 0xae, 0x5e, 0xde, 0xe2, 0x26, 0x8e, 0x58, 0xd8, 0xab, 0xa3, 0xc , 0x15, 
-	0x3e, 0x98, 0xa8, 0x9a, 0xa4, 0x61, 0x9a, 0x43, 0x45, 0x14, 0x0 , 0x52, 0x35, 
-	0x19, 0xa4, 0xa0, 0x2 , 0x8a, 0x28, 0xfc, 0x28, 0x0 , 0xfc, 0x69, 0x33, 0xef, 
-	0x41, 0xfa, 0x52, 0x50, 0x1 , 0x46, 0x68, 0x34, 0xda, 0x0 , 0x28, 0xcd, 0x6 , 
-	0x9b, 0x40, 0x5 , 0x14, 0x51, 0xf8, 0x50, 0x1 , 0xf8, 0xd2, 0x67, 0xde, 0x83, 
-	0xf4, 0xa4, 0xa6, 0x1 , 0x46, 0x68, 0x34, 0xda, 0x60, 0x14, 0x66, 0x83, 0x4d, 
-	0xa0, 0x2 , 0x8a, 0x28, 0xfc, 0x28, 0x0 , 0xfc, 0x68, 0xfc, 0x69, 0xf , 0xd2, 
-	0x93, 0x3e, 0xd4, 0x0 , 0x51, 0x9a, 0x29, 0x1a, 0x80, 0x12, 0x8c, 0xd0, 0x69, 
-	0xb4, 0x0 , 0x51, 0x45, 0x14, 0x0 , 0x7e, 0x34, 0x7e, 0x34, 0x7e, 0x14, 0x87, 
-	0xe9, 0x40, 0x12, 0x8a, 0x5f, 0xc6, 0x92, 0x8a, 0xa0, 0x1d, 0xf8, 0xd1, 0x47, 
-	0xe1, 0x47, 0xe1, 0x40, 0xa , 0xb4, 0xb4, 0xda, 0x70, 0xa0, 0x5 , 0x5a, 0x5a, 
-	0x6d, 0x38, 0x50, 0x2 , 0xe7, 0xde, 0x97, 0xf1, 0xa6, 0xd2, 0x8f, 0xa5, 0x0 , 
-	0x2d, 0x14, 0x7e, 0x14, 0x50, 0x3 , 0xb3, 0x4a, 0xd , 0x35, 0x69, 0x69, 0x0 , 
-	0xec, 0xd2, 0x8a, 0x65, 0x38, 0x52, 0x1 , 0x73, 0xef, 0x4b, 0xf8, 0xd3, 0x69, 
-	0x47, 0xd2, 0x80, 0x16, 0x94, 0x1a, 0x4a, 0x28, 0x1 , 0xd4, 0xa0, 0xd3, 0x41, 
-	0xa5, 0xa0, 0x7 , 0x51, 0x49, 0x9a, 0x51, 0x40, 0xb , 0x9f, 0x7a, 0x5f, 0xc6, 
-	0x9b, 0x4a, 0x3e, 0x94, 0x0 , 0xb9, 0xa2, 0x8f, 0xc2, 0x8a, 0x0 , 0x76, 0x68, 
-	0xa6, 0xd3, 0x97, 0x9e, 0x49, 0xc0, 0xaa, 0x8c, 0x79, 0x9d, 0x84, 0xdd, 0x95, 
-	0xc1, 0x9b, 0x6c, 0x64, 0xff, 0x0 , 0x17, 0x6a, 0x86, 0xf2, 0x40, 0x21, 0x32, 
-	0xf4, 0xf9, 0x79, 0x4 , 0x53, 0xd9, 0xe3, 0x7c, 0x83, 0x9c, 0x8e, 0xbc, 0x66, 
-	0xb1, 0x75, 0x89, 0x9a, 0x6b, 0x84, 0xb4, 0x8b, 0xe6, 0x25, 0x81, 0x1 , 0x7b, 
-	0x9f, 0x4a, 0xe8, 0x93, 0xb5, 0xa2, 0x88, 0x8a, 0xfb, 0x4c, 0x4b, 0x8 , 0x24, 
-	0xd5, 0x6f, 0x8 , 0x89, 0x86, 0xd1, 0xcb, 0xb7, 0x38, 0x51, 0xed, 0xef, 0xe9, 
-	0x5d, 0x76, 0x9b, 0xa , 0x45, 0xc , 0x71, 0x5b, 0x6d, 0x28, 0xaa, 0x38, 0xef, 
-	0x93, 0xdc, 0xd6, 0x6e, 0x87, 0x62, 0x6c, 0xb4, 0xb5, 0x45, 0x65, 0x32, 0x64, 
-	0xb3, 0xfb, 0x93, 0xfe, 0x71, 0x5a, 0x1a, 0x7b, 0xcb, 0x14, 0xe2, 0x48, 0x49, 
-	0x8d, 0x94, 0x7d, 0xd3, 0xd1, 0xa9, 0xc7, 0x42, 0x5b, 0x6c, 0xd0, 0x8c, 0xb2, 
-	0x7e, 0xf1, 0xb0, 0xca, 0xf , 0xcd, 0x95, 0xe5, 0x7d, 0xf1, 0xf9, 0x55, 0xa5, 
-	0x8d, 0xb6, 0xab, 0x44, 0x41, 0x2d, 0xc6, 0x54, 0x83, 0xc8, 0xe4, 0x1f, 0xa7, 
-	0x4a, 0x8a, 0x29, 0xa3, 0x9d, 0x7c, 0xc7, 0xc , 0x1b, 0x71, 0xde, 0x3 , 0xe3, 
-	0x67, 0x38, 0xfc, 0x45, 0x58, 0x90, 0xb , 0x66, 0x76, 0x27, 0x6a, 0xab, 0x61, 
-	0x93, 0x3c, 0x8f, 0x71, 0xfa, 0x53, 0x24, 0x9a, 0x14, 0x2 , 0xdd, 0x66, 0x1c, 
-	0x37, 0x52, 0x55, 0xb8, 0xc7, 0x5f, 0xcf, 0xb5, 0x53, 0xd6, 0x6f, 0xb6, 0xed, 
-	0x31, 0x2f, 0x3e, 0xc4, 0x70, 0x6b, 0x3f, 0x51, 0xd4, 0x15, 0x14, 0x16, 0x93, 
-	0x6a, 0x8e, 0x5b, 0x71, 0xc7, 0xd4, 0x8f, 0xad, 0x73, 0xda, 0xa6, 0xb8, 0xb6, 
-	0xf9, 0x55, 0x38, 0x27, 0x20, 0x75, 0x2c, 0x41, 0xee, 0x3f, 0x3a, 0x99, 0x54, 
-	0x34, 0x8c, 0xd , 0x8d, 0x4b, 0x55, 0x58, 0x8e, 0xe7, 0x9d, 0xb7, 0x77, 0x42, 
-	0xd9, 0x7 , 0x3d, 0xbd, 0xeb, 0x9d, 0xbd, 0xf1, 0x13, 0x9 , 0x8f, 0xd9, 0x46, 
-	0x36, 0x90, 0x72, 0x9 , 0xe3, 0xeb, 0xe9, 0x58, 0x17, 0x57, 0x57, 0x37, 0xb2, 
-	0x31, 0x1 , 0x88, 0x27, 0x82, 0x4f, 0xf5, 0xef, 0x50, 0xac, 0x72, 0x21, 0xdb, 
-	0x92, 0xcd, 0x9e, 0x42, 0xd6, 0x2e, 0x66, 0x9c, 0xa6, 0x8c, 0xd3, 0x3d, 0xd4, 
-	0x6d, 0x35, 0xc5, 0xd6, 0xd2, 0xc7, 0x80, 0x2a, 0x95, 0xd5, 0xcc, 0xa , 0xfb, 
-	0x51, 0x7a, 0x7f, 0x16, 0x45, 0x4e, 0x96, 0xb3, 0x5c, 0x46, 0x4 , 0x8a, 0xab, 
-	0xfa, 0x9a, 0x92, 0x2d, 0x22, 0x1 , 0xcb, 0xa9, 0x6f, 0xad, 0x4b, 0xa9, 0xd8, 
-	0x39, 0x4c, 0xa8, 0x64, 0x9a, 0xfa, 0xf0, 0x5b, 0xa3, 0x6d, 0x3 , 0x9c, 0xf5, 
-	0xc0, 0xad, 0x28, 0x34, 0x95, 0x1c, 0xbc, 0xb2, 0xb7, 0xfc, 0xb , 0x15, 0xa1, 
-	0xe0, 0x9d, 0x36, 0xde, 0x6d, 0x52, 0xee, 0x59, 0x6 , 0xd8, 0xe3, 0x0 , 0x28, 
-	0x1d, 0xce, 0x4f, 0xf8, 0x57, 0x57, 0x1c, 0x16, 0x11, 0x72, 0x96, 0xea, 0x7e, 
-	0xbc, 0xd5, 0x46, 0x9c, 0xa5, 0xab, 0x64, 0xba, 0x89, 0x68, 0x91, 0xc7, 0xdb, 
-	0xe8, 0xc8, 0x78, 0x8e, 0xdb, 0x77, 0xfc, 0x4 , 0x9a, 0xd0, 0x87, 0x40, 0xba, 
-	0x23, 0x8b, 0x6d, 0xa3, 0xdf, 0x2 , 0xba, 0x5f, 0xb4, 0x6d, 0xe2, 0x35, 0xa , 
-	0x3d, 0x85, 0x31, 0x9e, 0x47, 0x3c, 0x9a, 0xbf, 0x63, 0x5 , 0xbb, 0x33, 0x75, 
-	0x64, 0x73, 0xff, 0x0 , 0xf0, 0x8f, 0xca, 0x47, 0xcf, 0x24, 0x6b, 0x4d, 0x93, 
-	0x45, 0x8e, 0x24, 0x2c, 0xd3, 0x3 , 0x8e, 0x70, 0x5 , 0x74, 0x3e, 0x43, 0x37, 
-	0x53, 0x49, 0x25, 0xbc, 0x68, 0xbb, 0xe4, 0x1f, 0x2a, 0xf2, 0x7e, 0x9d, 0xff, 
-	0x0 , 0x4a, 0x6e, 0x9c, 0x52, 0xbd, 0x81, 0x4e, 0x4d, 0x9e, 0x67, 0xab, 0x22, 
-	0x9d, 0x65, 0x63, 0x6e, 0x8b, 0x9c, 0xd5, 0x6c, 0x6 , 0x25, 0xb6, 0x93, 0x93, 
-	0x52, 0xea, 0x92, 0xf9, 0x9a, 0xc4, 0x92, 0x67, 0xff, 0x0 , 0xd6, 0x69, 0x90, 
-	0xae, 0x53, 0xa1, 0x3e, 0xc2, 0xb8, 0x63, 0xd4, 0xec, 0x92, 0xb4, 0x10, 0xc6, 
-	0x4 , 0x75, 0xda, 0x3f, 0xa , 0x4d, 0x99, 0xfe, 0xf1, 0xa9, 0xf6, 0x9f, 0xee, 
-	0xaa, 0xfd, 0x69, 0x30, 0x3f, 0xbc, 0xcd, 0xec, 0x5 , 0x51, 0x99, 0x2 , 0xa6, 
-	0x7d, 0x5 , 0x49, 0x1c, 0x60, 0x8e, 0x7d, 0x4f, 0xf3, 0xa9, 0x21, 0x8c, 0x97, 
-	0x1f, 0x26, 0x3e, 0xb4, 0x2 , 0x55, 0x8f, 0x1f, 0xc4, 0x7f, 0x9d, 0x4b, 0xdc, 
-	0xda, 0x8a, 0xbd, 0xc6, 0x18, 0xc8, 0xe9, 0x48, 0x55, 0xea, 0x65, 0x91, 0x4f, 
-	0x5a, 0x7e, 0xe4, 0xa7, 0xa1, 0xb5, 0x9a, 0x2a, 0xaa, 0xc9, 0xd8, 0x9a, 0x76, 
-	0xd9, 0x7a, 0x82, 0x6a, 0xce, 0xf4, 0xf4, 0xa6, 0x34, 0xd8, 0xe8, 0x28, 0xd3, 
-	0xb8, 0xac, 0xfb, 0x11, 0x7e, 0xfa, 0x31, 0xc8, 0xc8, 0x3d, 0xb1, 0x55, 0x6f, 
-	0x6 , 0x7e, 0x61, 0xf8, 0x55, 0xc3, 0x2b, 0x1a, 0x8a, 0x45, 0xdf, 0x1b, 0x71, 
-	0xd3, 0x9a, 0x52, 0xd5, 0xb , 0x92, 0xe8, 0xa1, 0x9c, 0x55, 0x8d, 0x3e, 0x56, 
-	0x86, 0xe9, 0x24, 0x53, 0x8e, 0xf9, 0xaa, 0xec, 0x30, 0x48, 0xa7, 0x2f, 0xdd, 
-	0xc7, 0xa7, 0x35, 0x27, 0x3e, 0xcc, 0xd6, 0xd4, 0xe2, 0x4f, 0x33, 0xcc, 0x1c, 
-	0x6f, 0xf9, 0x87, 0x35, 0x45, 0x81, 0xdd, 0x8e, 0xf5, 0x65, 0x65, 0x13, 0x58, 
-	0x2a, 0x93, 0xca, 0x1e, 0xd , 0x45, 0xb4, 0xb4, 0x80, 0xf7, 0x15, 0x52, 0xb3, 
-	0xd4, 0xe8, 0x82, 0x76, 0x1f, 0x6f, 0x6a, 0xee, 0x7e, 0x60, 0x6a, 0xea, 0xa1, 
-	0x89, 0x7f, 0x76, 0xa4, 0x91, 0xd6, 0xae, 0x59, 0x80, 0xf0, 0xa9, 0x6f, 0x94, 
-	0x81, 0xc8, 0x14, 0xb7, 0x12, 0xc7, 0xf7, 0x17, 0x15, 0xb4, 0x63, 0x18, 0xab, 
-	0x99, 0x3e, 0x69, 0x3b, 0x58, 0xe7, 0xee, 0x97, 0x2e, 0xcc, 0xab, 0xdf, 0x91, 
-	0xe9, 0x55, 0xc8, 0xae, 0x89, 0xad, 0xa3, 0x75, 0xdc, 0xbc, 0x9e, 0xe0, 0x77, 
-	0xac, 0xed, 0x43, 0x4f, 0x68, 0x8e, 0xf0, 0xe , 0xd6, 0xe8, 0x6b, 0x9 , 0xc6, 
-	0xda, 0x9b, 0x46, 0x2d, 0xe8, 0x53, 0x89, 0x81, 0x5d, 0x8d, 0xf8, 0x1f, 0x4a, 
-	0x7a, 0xa9, 0xa8, 0xa4, 0x56, 0x56, 0xc3, 0x7e, 0x14, 0xe8, 0x9f, 0xb1, 0xa8, 
-	0xbd, 0xc3, 0x67, 0xa9, 0x24, 0x90, 0xb7, 0xde, 0x2 , 0xa3, 0xda, 0xe9, 0xf3, 
-	0x2e, 0x46, 0x3a, 0x8e, 0xe3, 0xff, 0x0 , 0xad, 0x56, 0xe0, 0x90, 0x74, 0x35, 
-	0x65, 0x62, 0x47, 0xe7, 0xbf, 0xad, 0xd , 0xb8, 0xea, 0x74, 0xac, 0x2c, 0x6a, 
-	0xaf, 0x75, 0xea, 0x56, 0xb1, 0xb9, 0xa , 0xfb, 0xc0, 0x62, 0xde, 0xa0, 0xff, 
-	0x0 , 0x31, 0x5a, 0xf6, 0xb7, 0xb6, 0xcd, 0xc4, 0xf1, 0x95, 0x2c, 0x38, 0xc9, 
-	0xce, 0x4d, 0x50, 0x93, 0x4b, 0x59, 0xf2, 0xd0, 0xba, 0xc7, 0x27, 0xa1, 0xe8, 
-	0x7f, 0xc2, 0xa0, 0x30, 0xde, 0xda, 0x7c, 0x93, 0xda, 0xb3, 0x2f, 0x62, 0xbf, 
-	0xfd, 0x6a, 0xae, 0x64, 0xce, 0x5a, 0x98, 0x3a, 0xd0, 0x7a, 0xc4, 0xd9, 0x90, 
-	0xdb, 0x4b, 0x26, 0x11, 0x8a, 0xb1, 0xe8, 0xcc, 0x38, 0xcd, 0x45, 0x3d, 0xbe, 
-	0xe5, 0xf2, 0xc1, 0x5c, 0xc , 0x64, 0xfa, 0xfd, 0x2b, 0x2f, 0xed, 0xbb, 0x0 , 
-	0xd , 0x1b, 0x2e, 0x3d, 0x56, 0x9a, 0xd7, 0xa0, 0xf7, 0x5c, 0x7a, 0x1a, 0x34, 
-	0x39, 0xda, 0x92, 0x27, 0xbc, 0xb4, 0x4 , 0xb1, 0x2e, 0xaa, 0x13, 0xb0, 0x39, 
-	0xc7, 0xbd, 0x55, 0x78, 0xa3, 0x52, 0xab, 0xe6, 0xa3, 0xc , 0x75, 0x2 , 0x9f, 
-	0x15, 0xd4, 0x41, 0xf7, 0x93, 0xb5, 0x80, 0xc6, 0x7 , 0x7a, 0x63, 0x13, 0x33, 
-	0xfe, 0xe6, 0x12, 0x41, 0x3f, 0x75, 0x1 , 0x20, 0x51, 0xa1, 0x51, 0xe6, 0x7a, 
-	0x21, 0x1b, 0x62, 0xae, 0x10, 0x10, 0xde, 0xbb, 0x69, 0x1 , 0x3b, 0x78, 0xe7, 
-	0xd6, 0xac, 0xda, 0x69, 0xba, 0x8c, 0xff, 0x0 , 0x72, 0x6 , 0x41, 0xea, 0xc7, 
-	0x2 , 0xb4, 0xac, 0x34, 0x48, 0x55, 0x83, 0x5c, 0xcd, 0xe6, 0x11, 0xd7, 0x1c, 
-	0x20, 0xfa, 0xfa, 0xd4, 0xca, 0x69, 0x1d, 0x94, 0xb0, 0x15, 0xea, 0x7d, 0x9b, 
-	0x7a, 0x99, 0x9a, 0x56, 0x9d, 0x73, 0x7f, 0x70, 0x12, 0xdd, 0x30, 0xbf, 0xc4, 
-	0xe7, 0x85, 0x51, 0xeb, 0x9a, 0xdd, 0x8a, 0xb , 0x7b, 0x48, 0xfc, 0x8b, 0x6f, 
-	0x9d, 0x7f, 0x8e, 0x42, 0x39, 0x73, 0xeb, 0xf4, 0xf4, 0xa9, 0xe6, 0x9d, 0x4 , 
-	0x3f, 0x67, 0xb6, 0x5d, 0x91, 0x7f, 0x16, 0x6 , 0xb , 0x7f, 0xf5, 0xbd, 0xaa, 
-	0xe , 0x9d, 0x6b, 0x9e, 0x52, 0x72, 0x3e, 0x87, 0x7 , 0x81, 0x86, 0x1d, 0x5f, 
-	0x76, 0x29, 0xf4, 0xa5, 0x67, 0x6d, 0xb8, 0x2c, 0x71, 0xe8, 0x4d, 0x46, 0xce, 
-	0x5 , 0x43, 0x34, 0xd8, 0xa9, 0x3b, 0x25, 0x51, 0x22, 0x49, 0xa5, 0xa , 0x3a, 
-	0xd4, 0x2a, 0x1a, 0x63, 0xe8, 0xbd, 0xe8, 0x86, 0x27, 0x90, 0x82, 0xfd, 0x3d, 
-	0x2a, 0xe4, 0x48, 0x17, 0xb7, 0x2 , 0x81, 0x46, 0x2e, 0x7a, 0xbd, 0x82, 0x28, 
-	0xd5, 0x14, 0x0 , 0x31, 0x52, 0x71, 0x47, 0xe1, 0x4b, 0xb4, 0x9e, 0xd4, 0x1d, 
-	0x6a, 0xd1, 0x56, 0x12, 0xa4, 0x45, 0x1d, 0xcd, 0x35, 0x7 , 0x73, 0x52, 0x63, 
-	0x2b, 0x9a, 0x61, 0xcc, 0x4d, 0x6a, 0x23, 0xd , 0xb9, 0x86, 0x7d, 0x5 , 0x7a, 
-	0x77, 0xc2, 0xdf, 0xc , 0xd9, 0x43, 0xa1, 0xcf, 0xe3, 0x8f, 0x16, 0x3 , 0x1e, 
-	0x8b, 0xa7, 0xae, 0xe8, 0xe1, 0x3c, 0x35, 0xdb, 0x8e, 0x8a, 0x1 , 0xea, 0x9 , 
-	0xe3, 0xdc, 0xfb, 0x3 , 0x5c, 0xdf, 0xc1, 0x5f, 0x6 , 0xcb, 0xe3, 0x1f, 0x16, 
-	0x24, 0x12, 0xe5, 0x34, 0xfb, 0x5c, 0x4b, 0x79, 0x27, 0x4f, 0x97, 0xfb, 0xa0, 
-	0xfa, 0x9f, 0xe5, 0x57, 0x7f, 0x68, 0x8f, 0x1e, 0xda, 0x6b, 0x17, 0x69, 0xa2, 
-	0x69, 0x5 , 0x62, 0xf0, 0xee, 0x8b, 0xf2, 0x40, 0x91, 0x8c, 0x2c, 0xee, 0x6 , 
-	0x37, 0x8f, 0x51, 0xd9, 0x7f, 0x13, 0xde, 0xa9, 0x3b, 0x1c, 0x18, 0x9a, 0x8a, 
-	0x52, 0xe4, 0xbe, 0x8b, 0x56, 0xfb, 0x2f, 0xf8, 0x27, 0x9 , 0xf1, 0x3b, 0xc4, 
-	0xf7, 0xba, 0xff, 0x0 , 0x88, 0x2e, 0x35, 0x19, 0xc8, 0x5b, 0xab, 0xe7, 0xc4, 
-	0x51, 0xaf, 0xdd, 0x82, 0x30, 0x30, 0xaa, 0x7 , 0xa2, 0xa8, 0x3 , 0xf0, 0xae, 
-	0x71, 0xa , 0xdb, 0xc1, 0xe4, 0xc6, 0x31, 0xc7, 0xc , 0x7f, 0x88, 0xf7, 0x34, 
-	0x42, 0xc6, 0x59, 0x64, 0xb9, 0xb9, 0x38, 0x92, 0x41, 0xd3, 0xfb, 0xab, 0x4c, 
-	0x27, 0xcc, 0x6d, 0xc5, 0x4b, 0x72, 0x2 , 0xa8, 0xad, 0x63, 0x1b, 0x23, 0xe5, 
-	0x71, 0x98, 0xa7, 0x89, 0xab, 0xa6, 0xcb, 0x44, 0x87, 0x69, 0xf6, 0xd2, 0xcd, 
-	0x7a, 0x1 , 0x3f, 0xbb, 0x3 , 0x73, 0x71, 0xfa, 0x57, 0x5d, 0xa4, 0xdb, 0x1d, 
-	0xb9, 0x5c, 0x2f, 0xab, 0x1e, 0xde, 0xc2, 0xb3, 0x74, 0x9b, 0x55, 0x81, 0x0 , 
-	0x6e, 0xbd, 0x5f, 0xeb, 0x5a, 0xa9, 0x38, 0x55, 0xa , 0x3a, 0x7a, 0x56, 0x77, 
-	0xbb, 0xb9, 0xf4, 0xb8, 0x1c, 0x2b, 0xc3, 0xd0, 0x4b, 0xed, 0x3d, 0xcb, 0xc2, 
-	0x18, 0x94, 0x7c, 0xc7, 0x71, 0xf7, 0x34, 0xbf, 0xb9, 0x5e, 0x8a, 0x2b, 0x3d, 
-	0xae, 0x33, 0xfc, 0x54, 0xd6, 0x9c, 0xfa, 0xd5, 0xf3, 0x23, 0xa3, 0xd9, 0xc9, 
-	0xf5, 0x34, 0xb , 0xc4, 0x3b, 0x7f, 0xf5, 0xea, 0x36, 0xd8, 0xfc, 0xb2, 0xfd, 
-	0x31, 0x54, 0x3c, 0xe2, 0x3a, 0x9e, 0x68, 0xf3, 0x89, 0xe8, 0x4d, 0x2e, 0x74, 
-	0x35, 0x4d, 0xa2, 0xcc, 0x85, 0x3a, 0x15, 0xfc, 0x45, 0x52, 0xd5, 0x50, 0x1b, 
-	0x36, 0x50, 0x76, 0xf9, 0x98, 0x40, 0xde, 0x9b, 0x88, 0x14, 0xff, 0x0 , 0x3c, 
-	0x8e, 0xf5, 0x1c, 0x2e, 0xf3, 0xea, 0x96, 0xb0, 0xab, 0xa8, 0xc3, 0x19, 0x8 , 
-	0x71, 0xc7, 0x3 , 0xfc, 0x48, 0xa2, 0x36, 0x6d, 0x18, 0xe2, 0xe4, 0xe9, 0x61, 
-	0xe7, 0x2f, 0x23, 0xa2, 0xb6, 0x57, 0x16, 0xaa, 0x81, 0x2d, 0xee, 0x40, 0x50, 
-	0x30, 0x6 , 0x18, 0x7f, 0x2a, 0x6e, 0xe4, 0x89, 0x81, 0x6 , 0xe2, 0xd9, 0xbd, 
-	0xf9, 0x1f, 0xe3, 0x49, 0x22, 0x8d, 0xa0, 0xc9, 0x6d, 0xc7, 0xf7, 0xe1, 0x3f, 
-	0xcf, 0x1f, 0xe1, 0x4d, 0x8d, 0xc9, 0xe2, 0x3b, 0x9e, 0x3f, 0xb9, 0x22, 0xf1, 
-	0x5b, 0x1f, 0x1a, 0x4c, 0x5a, 0x46, 0xe0, 0x8b, 0x7b, 0x90, 0x7b, 0x9e, 0x1b, 
-	0xf3, 0xe0, 0xfe, 0xb5, 0x1b, 0x3a, 0x43, 0xd1, 0xae, 0x2d, 0x5b, 0xdc, 0xe4, 
-	0x7f, 0x4a, 0x63, 0x80, 0x79, 0x92, 0xdb, 0xfe, 0x7 , 0x11, 0xff, 0x0 , 0xf , 
-	0xf0, 0xa1, 0x24, 0xc9, 0xdb, 0x15, 0xc9, 0xff, 0x0 , 0x76, 0x41, 0x40, 0x16, 
-	0xbc, 0x49, 0x61, 0x31, 0xf8, 0x76, 0x75, 0xa7, 0x96, 0x17, 0x41, 0x7a, 0x20, 
-	0x8d, 0x95, 0x70, 0xcc, 0x7c, 0xb7, 0x62, 0xf , 0xd3, 0x3 , 0xf3, 0xaf, 0x33, 
-	0xd5, 0x31, 0xf6, 0x74, 0x4f, 0xef, 0x3a, 0x8a, 0xf6, 0xcf, 0x8a, 0xf0, 0xd , 
-	0x3f, 0xe0, 0x1e, 0x8b, 0x13, 0x8 , 0x56, 0x7b, 0x8b, 0xc9, 0x27, 0x94, 0x45, 
-	0x8c, 0x67, 0x63, 0x0 , 0x78, 0xff, 0x0 , 0x64, 0xad, 0x78, 0x8e, 0xa7, 0x9f, 
-	0x3a, 0x10, 0x7f, 0xe7, 0xa8, 0xc7, 0xe1, 0x59, 0xad, 0xd9, 0xdd, 0x59, 0x7e, 
-	0xe6, 0x8c, 0x7d, 0x7f, 0x33, 0x76, 0xcf, 0x8b, 0x6f, 0xc2, 0xac, 0x41, 0x37, 
-	0x97, 0xdb, 0x39, 0xef, 0x50, 0xd9, 0x82, 0x2d, 0x4f, 0xfb, 0xb4, 0xaa, 0x77, 
-	0x56, 0x5b, 0x1f, 0x59, 0x1d, 0x51, 0x5f, 0xc5, 0x13, 0xf9, 0x96, 0xf0, 0xb3, 
-	0x7f, 0xcb, 0x39, 0x41, 0xfe, 0x95, 0xde, 0x7c, 0x1f, 0xbc, 0x2d, 0xa6, 0xf9, 
-	0x7 , 0x3 , 0x6b, 0x38, 0x57, 0x1d, 0x41, 0x0 , 0x1f, 0xd3, 0x9f, 0xfb, 0xef, 
-	0xda, 0xb8, 0x9d, 0x43, 0x4d, 0x7b, 0xcd, 0x36, 0x62, 0x99, 0xdd, 0x1a, 0x33, 
-	0x1 , 0xee, 0x6 , 0x6b, 0x5f, 0xe1, 0x3d, 0xd6, 0xc9, 0x2 , 0x1f, 0x37, 0x12, 
-	0x48, 0x19, 0x76, 0x2f, 0xa0, 0xe7, 0x9f, 0xa1, 0xfe, 0x55, 0xd5, 0x4e, 0x4d, 
-	0xd3, 0x67, 0xcb, 0xe6, 0x91, 0x8c, 0x71, 0xe , 0xc7, 0xa4, 0xf8, 0xba, 0x2f, 
-	0x3b, 0x6c, 0xca, 0xa9, 0xe7, 0x24, 0x21, 0x43, 0x73, 0xb5, 0x8f, 0xf3, 0xee, 
-	0xc3, 0xf0, 0xaf, 0x39, 0xf8, 0x81, 0x1c, 0xf7, 0x3e, 0x19, 0x32, 0xec, 0x2e, 
-	0x60, 0x6d, 0xaa, 0x6 , 0xe , 0x39, 0xed, 0x9e, 0xdc, 0xd7, 0x77, 0xa9, 0x5c, 
-	0x4d, 0x2d, 0x91, 0x6d, 0xac, 0xcc, 0xe9, 0xb7, 0x69, 0x1f, 0x74, 0xaf, 0x3f, 
-	0xae, 0x73, 0x5c, 0xb6, 0xa5, 0x6d, 0xc , 0xda, 0x4d, 0xe2, 0xc6, 0x2 , 0x89, 
-	0x21, 0xc , 0xbc, 0x8f, 0x97, 0x23, 0xa7, 0xaf, 0x4 , 0xd4, 0x9e, 0x79, 0xe7, 
-	0x9a, 0x19, 0x2b, 0x77, 0x1a, 0x3a, 0xa2, 0xca, 0x70, 0x11, 0x24, 0x39, 0x5c, 
-	0x91, 0xf7, 0xb3, 0x9c, 0x8f, 0xc3, 0xd2, 0xbe, 0x81, 0xf8, 0x44, 0xaf, 0x6d, 
-	0x6b, 0xa0, 0xea, 0x66, 0x64, 0x56, 0xb5, 0xd4, 0xa5, 0xb5, 0x93, 0x68, 0xe1, 
-	0x51, 0xbf, 0x78, 0x3d, 0xfa, 0xbd, 0x7c, 0xeb, 0x6d, 0xe5, 0xbd, 0xc4, 0x76, 
-	0xf2, 0xbc, 0x70, 0x94, 0x93, 0x1b, 0x8c, 0x7b, 0x42, 0xf3, 0xd5, 0x89, 0xe5, 
-	0xbf, 0x2a, 0xf7, 0x1f, 0x82, 0x3a, 0x8c, 0x73, 0xf8, 0x53, 0xc4, 0x36, 0x2c, 
-	0xc0, 0xb5, 0x89, 0xb6, 0xbd, 0x86, 0x42, 0x85, 0x58, 0xed, 0x2c, 0xad, 0xb7, 
-	0xb6, 0x38, 0x1d, 0x5 , 0x5c, 0x3e, 0x23, 0x27, 0xb1, 0xf6, 0x66, 0x8b, 0x18, 
-	0x7d, 0x37, 0xcc, 0x69, 0x11, 0x37, 0xb6, 0xc2, 0xc2, 0x31, 0xcb, 0x86, 0x3b, 
-	0xb6, 0xf1, 0x90, 0x8 , 0xe6, 0xb4, 0x6f, 0x6c, 0xe2, 0x68, 0x54, 0xc7, 0x23, 
-	0xb4, 0x99, 0x0 , 0x82, 0x31, 0xc7, 0xbf, 0xa7, 0x4a, 0xc0, 0xf0, 0x6 , 0xa3, 
-	0x6b, 0x73, 0xa2, 0xc3, 0x72, 0xf2, 0x96, 0x69, 0x1b, 0x71, 0x18, 0x24, 0x47, 
-	0x9e, 0x9c, 0x74, 0xdc, 0x7e, 0x52, 0x4f, 0xa7, 0x5a, 0xe8, 0xd9, 0xd1, 0xa1, 
-	0x12, 0x42, 0x41, 0x31, 0xb2, 0xef, 0xca, 0x82, 0x57, 0x24, 0x76, 0x1c, 0x7a, 
-	0xd7, 0x4f, 0x35, 0x8c, 0xec, 0x67, 0xdd, 0x68, 0x92, 0x45, 0xf7, 0x37, 0x1d, 
-	0xff, 0x0 , 0x7f, 0xf , 0x93, 0xf8, 0x7f, 0x93, 0xd6, 0xb9, 0xad, 0x4b, 0x4e, 
-	0x8a, 0x14, 0x72, 0xd1, 0xb2, 0x67, 0x20, 0x1c, 0x1f, 0xc8, 0xe2, 0xbb, 0xc9, 
-	0xa2, 0x96, 0x48, 0xd9, 0xd2, 0x7e, 0x13, 0x3c, 0xec, 0x1f, 0x98, 0x1e, 0x9f, 
-	0x97, 0x4a, 0xc1, 0xd6, 0xae, 0x2c, 0xa1, 0x1 , 0xaf, 0xe7, 0x48, 0xc3, 0x93, 
-	0xbc, 0x67, 0x4 , 0x7b, 0xed, 0x3f, 0x4a, 0xa8, 0xcc, 0x4d, 0x1c, 0x45, 0xd4, 
-	0x2c, 0x92, 0x6e, 0x42, 0xac, 0xa4, 0x77, 0x39, 0xc1, 0xf4, 0xe2, 0x9b, 0x1d, 
-	0xd3, 0xc4, 0x54, 0xb8, 0x38, 0x23, 0xee, 0xe7, 0x38, 0xe7, 0xd6, 0xa5, 0xbe, 
-	0x9b, 0x4d, 0x76, 0x13, 0x59, 0x6a, 0x36, 0xee, 0x19, 0xf6, 0x85, 0x49, 0x7 , 
-	0x7 , 0xa8, 0xfe, 0x46, 0xa3, 0xf9, 0x42, 0x81, 0xb9, 0x77, 0x11, 0x9c, 0x70, 
-	0x7 , 0xaf, 0x3f, 0xa5, 0x6f, 0x19, 0x19, 0xca, 0x25, 0xb9, 0xc , 0x17, 0x71, 
-	0xe6, 0x13, 0xfb, 0xd1, 0xcb, 0x21, 0xeb, 0xf8, 0x56, 0x76, 0xa9, 0x31, 0xdc, 
-	0x15, 0xd4, 0x8c, 0xa , 0x55, 0x68, 0x3c, 0xa0, 0xca, 0x64, 0x59, 0xbb, 0xfa, 
-	0x7e, 0x6 , 0xa2, 0x9a, 0x61, 0x34, 0x58, 0x63, 0xf7, 0x4f, 0x71, 0xcd, 0x37, 
-	0xa9, 0x2b, 0x42, 0x26, 0x9d, 0xa6, 0x53, 0x14, 0xb2, 0x65, 0x36, 0xed, 0x57, 
-	0xee, 0xbe, 0x9f, 0xd2, 0xb2, 0xb5, 0x2b, 0x56, 0xa , 0xd8, 0xb , 0xc7, 0x6c, 
-	0x75, 0xfa, 0x56, 0xa8, 0x83, 0x62, 0x99, 0xe3, 0x53, 0xb1, 0x54, 0x65, 0x5b, 
-	0xa3, 0x7a, 0xd4, 0x7b, 0x15, 0x19, 0x84, 0xa8, 0x59, 0x70, 0x77, 0x1 , 0xd5, 
-	0x7d, 0xd , 0x63, 0x28, 0x9a, 0x23, 0xcb, 0xfe, 0x21, 0x78, 0x46, 0xdf, 0x5e, 
-	0x84, 0xcb, 0x8 , 0x58, 0x2f, 0xe3, 0x5f, 0xdd, 0x4a, 0x78, 0x12, 0x1 , 0xfc, 
-	0xf , 0xfd, 0xf , 0x6f, 0xa5, 0x78, 0xfe, 0xa1, 0x6b, 0x71, 0x65, 0x79, 0x25, 
-	0xad, 0xdc, 0x2d, 0xc , 0xd1, 0x31, 0x59, 0x11, 0xc6, 0xa , 0x91, 0x5f, 0x4c, 
-	0x6b, 0x16, 0x5 , 0xe3, 0x69, 0x6d, 0xf9, 0xda, 0x32, 0xc3, 0x18, 0xff, 0x0 , 
-	0x26, 0xb8, 0x6f, 0x88, 0x5e, 0x16, 0x83, 0xc4, 0x56, 0x3e, 0x6c, 0x41, 0x23, 
-	0xd4, 0x61, 0x5f, 0xdd, 0x49, 0xd0, 0x48, 0x3f, 0xb8, 0xdf, 0xd0, 0xf6, 0xac, 
-	0x5a, 0x34, 0x3c, 0x6a, 0x9a, 0x6a, 0x4b, 0xb8, 0x66, 0xb6, 0xb8, 0x7b, 0x7b, 
-	0x88, 0xda, 0x39, 0x63, 0x62, 0xae, 0x8c, 0x30, 0x54, 0x8a, 0x8e, 0xa0, 0x2 , 
-	0x8f, 0xc6, 0x8a, 0x3f, 0xa , 0x0 , 0x3f, 0x1a, 0x4c, 0xfb, 0xd2, 0x67, 0xda, 
-	0x8a, 0x0 , 0x28, 0xcd, 0x6 , 0x9b, 0x40, 0x5 , 0x19, 0xa0, 0xd3, 0x68, 0x0 , 
-	0xa2, 0x8a, 0x3f, 0xa , 0x60, 0x1f, 0x8d, 0x26, 0x7d, 0xe8, 0x3f, 0x4a, 0x4a, 
-	0x60, 0x14, 0x51, 0x48, 0x4d, 0x0 , 0x25, 0x14, 0x52, 0x13, 0x40, 0x1 , 0x34, 
-	0x94, 0x51, 0x40, 0x7 , 0xe3, 0x47, 0xe3, 0x47, 0xe1, 0x48, 0x7e, 0x94, 0x0 , 
-	0x94, 0x51, 0x48, 0x4d, 0x0 , 0x4 , 0xd2, 0x51, 0x48, 0x4d, 0x0 , 0x4 , 0xd2, 
-	0x51, 0x45, 0x0 , 0x1f, 0x8d, 0x1f, 0x8d, 0x1f, 0x85, 0x1f, 0x85, 0x0 , 0x27, 
-	0xe3, 0x48, 0x68, 0xa2, 0x80, 0x25, 0x5a, 0x5a, 0x6d, 0x38, 0x55, 0x0 , 0xb9, 
-	0xf7, 0xa5, 0xfc, 0x69, 0xb4, 0xa3, 0xe9, 0x40, 0xb , 0x45, 0x1f, 0x85, 0x14, 
-	0x0 , 0xec, 0xd1, 0x4d, 0xa7, 0xa , 0x0 , 0x76, 0x68, 0xa6, 0xd3, 0x85, 0x0 , 
-	0x3b, 0xf1, 0xa3, 0xf1, 0xa6, 0xe7, 0xda, 0x94, 0x7d, 0x28, 0x1 , 0x68, 0xa3, 
-	0xf0, 0xa2, 0x80, 0x1d, 0x4a, 0xd , 0x37, 0x34, 0xa2, 0x80, 0x1d, 0x4a, 0x29, 
-	0xa0, 0xd2, 0xd4, 0x80, 0xef, 0xc6, 0x8f, 0xc6, 0x90, 0x7d, 0x29, 0x7f, 0xa , 
-	0x0 , 0x29, 0x41, 0xa4, 0xa2, 0x80, 0x1d, 0x9a, 0x29, 0x16, 0x96, 0x80, 0x1d, 
-	0x9a, 0x29, 0xb4, 0xe1, 0x40, 0xb , 0x9f, 0x7a, 0x5f, 0xc6, 0x9b, 0x4a, 0x3e, 
-	0x94, 0x0 , 0xb4, 0x37, 0x38, 0x5c, 0xf7, 0xe6, 0x85, 0xc7, 0x7a, 0x6d, 0xc0, 
-	0xd8, 0xbb, 0xf0, 0x54, 0x91, 0xeb, 0x5b, 0xd3, 0x8d, 0x97, 0x31, 0x9c, 0xb5, 
-	0x76, 0x29, 0xea, 0xd7, 0xab, 0x6f, 0xb , 0x36, 0x1 , 0xe3, 0x0 , 0xfb, 0xf4, 
-	0xa8, 0xfc, 0x2b, 0x6c, 0x52, 0x3f, 0xb6, 0xcc, 0xbb, 0x99, 0xc9, 0xf2, 0xf3, 
-	0xe9, 0xeb, 0x59, 0xc1, 0x5b, 0x53, 0xd5, 0x8c, 0x63, 0xfd, 0x4c, 0x47, 0x2e, 
-	0xc7, 0xeb, 0x5d, 0xc , 0x72, 0x22, 0x5 , 0x4d, 0xb9, 0x55, 0x18, 0xc0, 0xec, 
-	0x2a, 0xe2, 0xbe, 0xd0, 0x49, 0xf4, 0x2e, 0x46, 0xff, 0x0 , 0x32, 0x90, 0x39, 
-	0x1d, 0x48, 0xef, 0x56, 0x37, 0x96, 0x38, 0x3 , 0x70, 0x0 , 0x63, 0xd4, 0x55, 
-	0x65, 0x68, 0xdd, 0x81, 0x5c, 0x9e, 0x6 , 0x46, 0x31, 0x8a, 0xbb, 0x66, 0xa9, 
-	0xb7, 0x2e, 0x7a, 0xf0, 0x4f, 0xa7, 0xa1, 0xa6, 0x41, 0x65, 0x5c, 0x25, 0xb0, 
-	0x90, 0x12, 0x41, 0x51, 0x82, 0x47, 0x4 , 0xf3, 0xda, 0xab, 0x5c, 0xdd, 0x32, 
-	0xa3, 0x33, 0x4a, 0x7f, 0xd9, 0xcb, 0x1e, 0x7d, 0x28, 0x99, 0x9e, 0x4 , 0x65, 
-	0xea, 0x8d, 0xce, 0xde, 0xb8, 0x3d, 0x38, 0x3f, 0x85, 0x73, 0xfe, 0x21, 0xd4, 
-	0x5 , 0xa4, 0xc , 0x58, 0x7c, 0xec, 0x7e, 0x51, 0x9e, 0xa6, 0xb2, 0x9c, 0xfa, 
-	0x23, 0x58, 0xc6, 0xda, 0x95, 0x3c, 0x47, 0xa9, 0x35, 0xb2, 0x90, 0x24, 0x5f, 
-	0x33, 0x3d, 0x86, 0x4d, 0x66, 0x59, 0x5b, 0x19, 0xe4, 0x17, 0x37, 0x79, 0xa , 
-	0xd9, 0x3b, 0xe , 0x72, 0xdf, 0xfd, 0x6a, 0xb7, 0xa7, 0xe9, 0xec, 0x51, 0xaf, 
-	0xaf, 0xc6, 0xee, 0x72, 0x81, 0x87, 0x6c, 0xf7, 0xa5, 0xb8, 0x6f, 0xb4, 0x4a, 
-	0x12, 0x30, 0x4a, 0x83, 0xf2, 0xf1, 0xc9, 0xac, 0x79, 0x8d, 0x8 , 0x64, 0x2 , 
-	0x7c, 0x6c, 0x42, 0xaa, 0xa3, 0x3 , 0x93, 0xc0, 0xf4, 0xab, 0x1a, 0x7e, 0x9c, 
-	0xed, 0xc4, 0x71, 0x71, 0xdc, 0xe2, 0xb5, 0x34, 0xfd, 0x36, 0x28, 0x22, 0x59, 
-	0x6f, 0x4f, 0x6e, 0x23, 0xff, 0x0 , 0x1a, 0x96, 0xe2, 0xf7, 0x3f, 0x24, 0x4a, 
-	0xa8, 0x9d, 0x80, 0xaa, 0xe4, 0x56, 0xf7, 0x8c, 0xf9, 0xef, 0xb1, 0x4 , 0x3a, 
-	0x7c, 0x69, 0xfe, 0xb5, 0xff, 0x0 , 0x1 , 0x56, 0x52, 0x38, 0x11, 0x49, 0x58, 
-	0xc1, 0xc0, 0xef, 0x55, 0xd5, 0xb3, 0xc9, 0x35, 0xd , 0xf6, 0xa5, 0x6b, 0x6d, 
-	0xb , 0x9 , 0x26, 0x40, 0xd8, 0xe0, 0x67, 0x93, 0x4d, 0x49, 0x2e, 0x82, 0x69, 
-	0xbe, 0xa5, 0x8d, 0x3d, 0x82, 0xbb, 0x95, 0x0 , 0x6 , 0xc7, 0x4f, 0xc6, 0xae, 
-	0xa9, 0x26, 0xb2, 0x34, 0xb , 0xa8, 0xee, 0xe3, 0x69, 0x62, 0x3f, 0x28, 0x6d, 
-	0xbf, 0xd7, 0xfa, 0xd6, 0xaa, 0x7d, 0xea, 0xd3, 0x9a, 0xec, 0x95, 0x1b, 0x22, 
-	0x68, 0xc6, 0x6a, 0xd4, 0x29, 0x59, 0xcd, 0xa8, 0xd9, 0xc0, 0xfb, 0x64, 0x98, 
-	0x67, 0xb8, 0x1c, 0xd6, 0x86, 0x9f, 0x75, 0x6f, 0x72, 0x9b, 0xa1, 0x90, 0x37, 
-	0xd3, 0xb7, 0xe1, 0x4d, 0x49, 0x9 , 0xc5, 0x96, 0x55, 0x5 , 0x66, 0x78, 0xaa, 
-	0x75, 0xb7, 0xd2, 0xe5, 0xe7, 0x92, 0x84, 0x1 , 0xf5, 0xe3, 0xfa, 0x9a, 0xd5, 
-	0xdc, 0x0 , 0xae, 0x4b, 0xc7, 0xd7, 0x4a, 0x63, 0x58, 0x8b, 0xed, 0x52, 0xff, 
-	0x0 , 0x31, 0xf4, 0x3 , 0xff, 0x0 , 0xd7, 0x59, 0xd5, 0x9d, 0xa2, 0x55, 0x38, 
-	0x7b, 0xc7, 0x9e, 0x5e, 0x39, 0x7b, 0xb9, 0x18, 0x75, 0xdc, 0x6a, 0xed, 0x9e, 
-	0x1a, 0xdd, 0x72, 0xcc, 0x78, 0xe8, 0x5 , 0x53, 0xb8, 0x89, 0xbc, 0xe6, 0x65, 
-	0x56, 0xd8, 0x4f, 0xcb, 0x9e, 0xb8, 0xcf, 0x7a, 0xbf, 0x64, 0x40, 0xb5, 0x50, 
-	0xd2, 0x1e, 0x9f, 0x75, 0x47, 0x35, 0xcb, 0x13, 0xa2, 0x51, 0x92, 0xdd, 0xe , 
-	0x9 , 0xff, 0x0 , 0x4c, 0xc0, 0xf7, 0x73, 0x49, 0x8c, 0x7d, 0xe9, 0x0 , 0x1e, 
-	0xc2, 0xa4, 0xf2, 0xfb, 0xf9, 0x4c, 0x7d, 0xd8, 0xd2, 0xe1, 0x80, 0xe0, 0xc6, 
-	0x9f, 0x4a, 0xa2, 0x46, 0xd9, 0xa0, 0x37, 0xb , 0x80, 0xfd, 0x7a, 0xd5, 0x35, 
-	0x98, 0x6f, 0x20, 0x3e, 0x39, 0x3c, 0x56, 0x9d, 0x8e, 0x4 , 0xd9, 0xf3, 0x73, 
-	0xb7, 0x9e, 0x5 , 0x73, 0xf9, 0xf5, 0xe7, 0xde, 0xa2, 0x5b, 0x9a, 0xd3, 0xa9, 
-	0xc8, 0x68, 0xef, 0xf7, 0x53, 0x4a, 0x1b, 0xfd, 0x9f, 0xca, 0xb3, 0xd4, 0x8c, 
-	0x53, 0xd5, 0xb1, 0xd1, 0xcf, 0xe7, 0x42, 0x8f, 0x99, 0xaa, 0xc4, 0x2e, 0xa8, 
-	0xba, 0x4a, 0x9f, 0x5a, 0x4c, 0x21, 0xee, 0x6a, 0xa2, 0xc9, 0x27, 0xf7, 0xf3, 
-	0x4e, 0xf3, 0x9c, 0x76, 0x6 , 0x8e, 0x49, 0x1a, 0x2c, 0x44, 0x19, 0x6d, 0x4a, 
-	0xe , 0xd4, 0x2b, 0x81, 0x2a, 0xb1, 0x5e, 0x3b, 0x8f, 0x51, 0x55, 0xbe, 0xd1, 
-	0x8f, 0xbc, 0x86, 0x9c, 0xb7, 0x11, 0x9e, 0xa4, 0x8a, 0x9f, 0x78, 0xa5, 0x3a, 
-	0x6f, 0xa8, 0xcd, 0x4a, 0xf , 0x2a, 0x63, 0x8e, 0x47, 0xad, 0x56, 0x5e, 0x1c, 
-	0x66, 0xb4, 0x99, 0xe3, 0x9e, 0x36, 0x52, 0xeb, 0x9d, 0xbc, 0x13, 0x59, 0xcd, 
-	0xee, 0x28, 0x47, 0x3d, 0x78, 0xa4, 0xd3, 0x4f, 0x72, 0x7b, 0x56, 0x2b, 0x21, 
-	0x8c, 0xf4, 0x3c, 0x8a, 0xbb, 0x6a, 0x7 , 0x9a, 0x37, 0x74, 0xef, 0x59, 0x6a, 
-	0xd9, 0x0 , 0xf7, 0x5a, 0xd2, 0xb3, 0x91, 0x5b, 0x6b, 0x9f, 0xc4, 0x50, 0xf7, 
-	0x4c, 0xdb, 0xc , 0xf9, 0x97, 0x29, 0x7e, 0xe5, 0x80, 0x87, 0x8 , 0x70, 0xca, 
-	0x79, 0xaa, 0x9f, 0x31, 0x6c, 0x93, 0x56, 0x2e, 0x90, 0x89, 0x33, 0x9e, 0xb4, 
-	0xc5, 0x5c, 0xd4, 0x54, 0x93, 0x6c, 0xef, 0xa5, 0x45, 0x58, 0xbb, 0xa7, 0x49, 
-	0x85, 0xc1, 0x1c, 0x55, 0xb9, 0x2 , 0xb2, 0x9e, 0x3 , 0x3 , 0xd5, 0x4f, 0xa5, 
-	0x41, 0xa7, 0x84, 0x23, 0xe6, 0xc0, 0xab, 0x8d, 0x18, 0xdb, 0xf2, 0xfe, 0x75, 
-	0xbc, 0x64, 0xf9, 0x77, 0x25, 0xd2, 0x5c, 0xc6, 0x35, 0xe6, 0x9c, 0xac, 0x9b, 
-	0xe3, 0xe4, 0x75, 0x2b, 0xdc, 0x56, 0x45, 0xcd, 0xb3, 0xc2, 0x73, 0x8e, 0x3d, 
-	0x6b, 0xa9, 0x91, 0x42, 0xf5, 0xe7, 0xdf, 0xd2, 0xab, 0x4d, 0x12, 0x49, 0x9c, 
-	0x81, 0xcd, 0x61, 0x2d, 0x1e, 0x86, 0xf2, 0xc2, 0xc6, 0xaa, 0xf3, 0x39, 0xc4, 
-	0x7c, 0x1a, 0xb7, 0x6b, 0x74, 0x55, 0xb0, 0x4d, 0x4d, 0x77, 0xa5, 0xee, 0xf9, 
-	0xe1, 0x38, 0x3e, 0x9d, 0xab, 0x3e, 0x48, 0xe4, 0x89, 0xb6, 0xc8, 0x85, 0x4d, 
-	0x35, 0x24, 0xce, 0x19, 0x53, 0xad, 0x87, 0x7a, 0xad, 0x3b, 0x9b, 0x56, 0xf3, 
-	0x23, 0xc , 0x86, 0xfd, 0x6a, 0xed, 0xbd, 0xd1, 0x1c, 0x30, 0x57, 0x1e, 0xfc, 
-	0xd7, 0x35, 0xc , 0xe5, 0x7a, 0x55, 0xc8, 0x6f, 0x3d, 0x47, 0xe5, 0x49, 0xc5, 
-	0x74, 0x3b, 0xa8, 0xe3, 0x55, 0xbd, 0xe3, 0xa0, 0x59, 0xad, 0x5b, 0xef, 0x47, 
-	0x8f, 0xa5, 0xc , 0xb6, 0x2d, 0xd5, 0x47, 0xfd, 0xf3, 0x59, 0x11, 0xdd, 0xa9, 
-	0xfe, 0x3a, 0x94, 0x4e, 0x8 , 0xfb, 0xc2, 0xa3, 0x94, 0xee, 0x8e, 0x22, 0xf , 
-	0xa9, 0xa5, 0x18, 0xb0, 0x56, 0x7 , 0xcb, 0x7 , 0x9f, 0xee, 0x8a, 0x93, 0xed, 
-	0x30, 0xa2, 0xe2, 0x28, 0x47, 0xe3, 0x59, 0x3e, 0x78, 0xf5, 0xa3, 0xcf, 0x15, 
-	0x37, 0xb1, 0xa7, 0xb4, 0x87, 0x73, 0x42, 0x7b, 0x99, 0x24, 0xe0, 0x9c, 0x2f, 
-	0xa0, 0xe0, 0x54, 0x2d, 0x21, 0xc6, 0x9 , 0xe2, 0xaa, 0x35, 0xc7, 0x1c, 0x9a, 
-	0x8d, 0xae, 0x57, 0xfb, 0xd4, 0xb5, 0x7 , 0x88, 0x8a, 0xd8, 0xba, 0x64, 0x2 , 
-	0xa3, 0x92, 0x70, 0x3a, 0xd5, 0x3f, 0x3a, 0x49, 0xe , 0x23, 0x52, 0x6a, 0xcd, 
-	0xbd, 0x8b, 0xbf, 0xcd, 0x33, 0x63, 0x1d, 0xa8, 0x26, 0x35, 0x27, 0x51, 0xfb, 
-	0xa8, 0x67, 0x99, 0x24, 0xad, 0x88, 0xc1, 0x3e, 0xf5, 0x66, 0xde, 0xd8, 0x3 , 
-	0xb9, 0xf9, 0x6f, 0x7a, 0x9a, 0x28, 0xd5, 0x17, 0xa , 0xb8, 0xa9, 0x51, 0x9 , 
-	0xfb, 0xa2, 0x91, 0xd5, 0x4e, 0x8a, 0x5a, 0xcb, 0x56, 0x8 , 0x31, 0x4e, 0x54, 
-	0x27, 0xf1, 0xa9, 0x21, 0x8b, 0xe6, 0x1b, 0xba, 0xd5, 0x84, 0xf2, 0xd3, 0xad, 
-	0x35, 0x13, 0x47, 0x34, 0x84, 0xb7, 0xb6, 0xf9, 0x7e, 0xed, 0x32, 0xe9, 0x76, 
-	0xf1, 0x91, 0x53, 0xbc, 0x8c, 0x57, 0xe4, 0xe0, 0x7a, 0xd5, 0x29, 0xa4, 0x25, 
-	0xba, 0xe6, 0xaa, 0x56, 0xb1, 0x30, 0x6d, 0xca, 0xec, 0x1 , 0xa9, 0xad, 0x55, 
-	0xa5, 0x99, 0x50, 0x2b, 0x31, 0x62, 0x2 , 0xa8, 0xee, 0x6a, 0xb8, 0x35, 0x62, 
-	0xd6, 0x77, 0xb6, 0x71, 0x71, 0x1b, 0x6c, 0x68, 0xce, 0x55, 0xbb, 0xe7, 0xda, 
-	0xa0, 0xda, 0x4f, 0x4d, 0xf , 0x40, 0xf1, 0x76, 0xbf, 0x7 , 0x84, 0x3c, 0x16, 
-	0x9e, 0xc , 0xd0, 0x67, 0x1f, 0x6f, 0xbc, 0x8f, 0x76, 0xb9, 0x74, 0x8d, 0xc0, 
-	0x24, 0x67, 0xc9, 0x7 , 0xd8, 0x64, 0x13, 0xf5, 0x15, 0xe3, 0x1a, 0xb5, 0xf2, 
-	0x5d, 0x5c, 0x10, 0x8f, 0x88, 0x60, 0xe5, 0x46, 0x3f, 0xd6, 0x1c, 0xe3, 0x35, 
-	0x67, 0x5f, 0xbd, 0x96, 0xe6, 0x57, 0xb5, 0xb7, 0x62, 0xce, 0xfc, 0xcc, 0xf9, 
-	0xe8, 0x3d, 0x33, 0xeb, 0x54, 0x65, 0x81, 0x22, 0x90, 0x2a, 0x9f, 0x98, 0xae, 
-	0x7 , 0xb0, 0xf5, 0xad, 0x61, 0x1e, 0xa7, 0xca, 0xe6, 0x58, 0xa5, 0xad, 0x18, 
-	0x3f, 0x57, 0xdd, 0x81, 0xb8, 0x17, 0xc , 0x8a, 0xd1, 0x95, 0x27, 0xae, 0x3b, 
-	0xd6, 0x9e, 0x87, 0x68, 0x37, 0x79, 0xc4, 0x1c, 0x7f, 0x6 , 0x7a, 0xfd, 0x6a, 
-	0xbe, 0x9b, 0x6a, 0x19, 0xc2, 0x81, 0xd3, 0xef, 0x13, 0xfc, 0xab, 0x7a, 0xcd, 
-	0x76, 0xe3, 0xb , 0xf7, 0x7a, 0x53, 0x9c, 0xba, 0x1a, 0x65, 0x38, 0x2e, 0x67, 
-	0xed, 0xe6, 0xb4, 0x5b, 0x1b, 0x1e, 0x15, 0xd2, 0x16, 0xf6, 0xe7, 0x75, 0xc3, 
-	0x15, 0x8d, 0x7b, 0x7a, 0xd6, 0xfe, 0xa9, 0xa6, 0xe9, 0xf0, 0xc3, 0xb6, 0x3d, 
-	0xbc, 0x57, 0x33, 0x67, 0x7f, 0x2d, 0xb8, 0xc2, 0x92, 0x5 , 0x49, 0x36, 0xa0, 
-	0xf2, 0xf0, 0x5c, 0xd6, 0x56, 0x3d, 0x9a, 0x91, 0xa9, 0x29, 0xde, 0xfa, 0x10, 
-	0xea, 0x10, 0x22, 0xc8, 0x42, 0x9e, 0xf5, 0x45, 0x83, 0xa , 0xba, 0xc1, 0x5f, 
-	0xf8, 0xc7, 0xe7, 0x48, 0x2d, 0xd4, 0xf5, 0x91, 0x68, 0xb1, 0xbc, 0x66, 0x92, 
-	0xd4, 0xa5, 0x96, 0xf5, 0xa5, 0xf9, 0x8d, 0x6a, 0x45, 0x65, 0x6e, 0x79, 0x6b, 
-	0x88, 0xc7, 0xe3, 0x57, 0xad, 0x6d, 0x34, 0x85, 0xff, 0x0 , 0x5d, 0x7d, 0xf , 
-	0xe7, 0x40, 0xa5, 0x88, 0x8a, 0xe8, 0x73, 0xab, 0x1c, 0x8d, 0xc0, 0x5e, 0xb5, 
-	0x36, 0x87, 0x6f, 0x2f, 0xf6, 0xd4, 0xce, 0xd0, 0xac, 0x82, 0x38, 0x95, 0x70, 
-	0x7a, 0x8c, 0xf3, 0xc7, 0xe9, 0x5d, 0x75, 0xbb, 0xf8, 0x5a, 0x5 , 0xc9, 0xbd, 
-	0x8c, 0xb0, 0xed, 0xb7, 0x20, 0xd6, 0x4 , 0x73, 0xd9, 0xdd, 0xea, 0x97, 0x97, 
-	0xd0, 0xa4, 0x91, 0xc1, 0x2c, 0xe4, 0x44, 0xc3, 0xa1, 0x45, 0x1 , 0x41, 0xfc, 
-	0x71, 0x9f, 0xc6, 0xb4, 0xa6, 0xb5, 0x3c, 0x6c, 0xdb, 0x15, 0x27, 0x45, 0x42, 
-	0xd6, 0xbb, 0x2d, 0xb1, 0x8d, 0x1b, 0x1 , 0xa5, 0x81, 0xbb, 0x83, 0xc8, 0xfd, 
-	0x68, 0x6f, 0x31, 0x97, 0xe6, 0x11, 0x4e, 0x3d, 0xbe, 0xf5, 0x22, 0xb3, 0x9e, 
-	0x12, 0x78, 0xe4, 0x5f, 0xee, 0xb8, 0xa6, 0xba, 0xa8, 0xe6, 0x48, 0x1a, 0x3f, 
-	0xf6, 0x90, 0xf1, 0xfe, 0x15, 0xb1, 0xf3, 0xc1, 0x98, 0xd5, 0xb8, 0x69, 0x60, 
-	0x6f, 0x7e, 0x45, 0x3a, 0x15, 0x96, 0x69, 0xd5, 0x36, 0xc5, 0x71, 0xb8, 0x81, 
-	0x8c, 0x7c, 0xd4, 0xd5, 0x62, 0x57, 0xf7, 0x73, 0xab, 0x8f, 0xee, 0xc8, 0x2a, 
-	0x39, 0x48, 0x8a, 0xde, 0x69, 0xa4, 0x84, 0xc4, 0x51, 0xe , 0xd9, 0x10, 0xf0, 
-	0x9 , 0xe0, 0x7e, 0xb4, 0x3d, 0x8a, 0xa7, 0x1e, 0x79, 0xa8, 0xf7, 0x3b, 0x1f, 
-	0xda, 0x62, 0xfa, 0xd0, 0xf8, 0x57, 0x40, 0xb0, 0xb3, 0x98, 0x49, 0x1c, 0x16, 
-	0xce, 0x70, 0x31, 0xf2, 0xae, 0xd5, 0x50, 0x32, 0x3e, 0x87, 0xad, 0x78, 0x7d, 
-	0xeb, 0x17, 0xb8, 0xb6, 0xc8, 0xc6, 0x5f, 0x38, 0xad, 0xbf, 0x10, 0x5f, 0x34, 
-	0x9a, 0x6f, 0x97, 0x2d, 0xc3, 0x39, 0xc6, 0xc5, 0xdc, 0x7a, 0x64, 0xf4, 0x1f, 
-	0xce, 0xb0, 0xaf, 0x1b, 0x3a, 0xa5, 0xba, 0xfa, 0x77, 0xf5, 0xac, 0xa3, 0xf0, 
-	0xb6, 0x7a, 0xb8, 0xe8, 0x28, 0x55, 0xa5, 0x4d, 0x3b, 0xdb, 0xfc, 0xce, 0x9a, 
-	0xd4, 0x7f, 0xc4, 0xb6, 0x4e, 0x3e, 0x62, 0x5 , 0x46, 0xa6, 0xa6, 0x88, 0x9f, 
-	0xec, 0xf5, 0x51, 0x9e, 0x46, 0x6a, 0xb8, 0x35, 0x12, 0xe8, 0x7d, 0x5 , 0x27, 
-	0xa3, 0x2d, 0x59, 0xea, 0xd , 0x68, 0x4b, 0x1e, 0x57, 0x18, 0x22, 0x9b, 0xf0, 
-	0xae, 0xf5, 0x2d, 0xef, 0x1e, 0x27, 0x76, 0xb , 0x24, 0x4c, 0x10, 0x7f, 0xb5, 
-	0x9e, 0x9f, 0x88, 0xfe, 0x95, 0x52, 0xe1, 0x73, 0xb , 0xf , 0x6a, 0xa7, 0xe0, 
-	0xd9, 0x4 , 0x3a, 0xd2, 0x46, 0xe7, 0x1b, 0x64, 0xf5, 0xfc, 0xbf, 0x51, 0x5b, 
-	0xe1, 0xde, 0xe8, 0xf0, 0xf3, 0x8a, 0x69, 0x4a, 0x33, 0x5d, 0x4f, 0x64, 0xba, 
-	0x76, 0x7b, 0x69, 0x39, 0xf9, 0x57, 0xfb, 0xc7, 0x96, 0x4 , 0x76, 0xfd, 0x6b, 
-	0x98, 0xbc, 0x5f, 0x32, 0xed, 0xd1, 0x9b, 0x1 , 0x55, 0x86, 0x58, 0x63, 0xe6, 
-	0x19, 0xc8, 0x38, 0xf5, 0xc5, 0x75, 0x36, 0xb1, 0x25, 0xce, 0x92, 0x44, 0xa7, 
-	0x6a, 0xc9, 0x9 , 0xc6, 0x3a, 0x83, 0xdf, 0xf2, 0xe2, 0xb1, 0xf5, 0xb , 0x42, 
-	0xb3, 0xc7, 0x38, 0x2a, 0xdd, 0x3c, 0xd0, 0x9 , 0x2a, 0xe7, 0xaf, 0x7 , 0xf1, 
-	0x34, 0xcf, 0x1c, 0xf2, 0x6d, 0x5e, 0x5f, 0x23, 0x52, 0x9a, 0x21, 0xa , 0x2c, 
-	0x4a, 0xe4, 0x12, 0x51, 0x59, 0x87, 0x6e, 0xf , 0x6e, 0xbf, 0xa5, 0x7a, 0x4f, 
-	0xc0, 0x4b, 0x92, 0x83, 0x50, 0xb6, 0x30, 0xca, 0xc9, 0x79, 0xa6, 0x4d, 0x1c, 
-	0x6f, 0xe7, 0xee, 0x8c, 0x95, 0x21, 0xb0, 0x33, 0xc8, 0x38, 0x53, 0xd3, 0x8e, 
-	0x6b, 0x80, 0xf1, 0xc5, 0xaa, 0xdb, 0xf8, 0x92, 0x65, 0x66, 0xc6, 0xe0, 0xb , 
-	0x0 , 0xb9, 0xc9, 0xc7, 0x19, 0x3f, 0x9d, 0x75, 0x5f, 0x5 , 0xee, 0x5a, 0xda, 
-	0xea, 0x14, 0x59, 0x22, 0xf2, 0xcc, 0xc4, 0x32, 0xf9, 0x83, 0x24, 0x3a, 0x15, 
-	0xe0, 0x7a, 0x67, 0xf1, 0xa6, 0xb7, 0x33, 0x3e, 0xc6, 0xf8, 0x1 , 0xa9, 0xb , 
-	0x9f, 0xc , 0x58, 0x17, 0x90, 0x60, 0xa2, 0x96, 0x25, 0x77, 0x75, 0x0 , 0x63, 
-	0xff, 0x0 , 0x42, 0xfc, 0xab, 0xd4, 0x16, 0xe5, 0x57, 0xcc, 0xdb, 0xf7, 0x1 , 
-	0xf9, 0x53, 0xae, 0x7d, 0xbd, 0x7 , 0x7a, 0xf0, 0xbf, 0xd9, 0x6a, 0xf2, 0x27, 
-	0xf0, 0xf5, 0xac, 0x66, 0x50, 0x1b, 0x69, 0x8d, 0xd1, 0x8e, 0x46, 0xdc, 0x90, 
-	0x4f, 0xf9, 0xf5, 0xaf, 0x69, 0x59, 0xe2, 0x2a, 0x96, 0xe6, 0x56, 0x69, 0x7 , 
-	0xde, 0xd8, 0x47, 0x38, 0x3d, 0xbf, 0x2a, 0xdd, 0xee, 0x42, 0x2c, 0x6a, 0x17, 
-	0x51, 0xda, 0xe9, 0xf2, 0x36, 0xd7, 0xdd, 0xa , 0xe5, 0x18, 0x3e, 0x39, 0xfc, 
-	0x4f, 0xe9, 0x5f, 0x27, 0x7c, 0x6b, 0xf1, 0xbe, 0xa3, 0xae, 0x78, 0x96, 0x5d, 
-	0x2a, 0x5b, 0xa6, 0x3b, 0xa7, 0x30, 0xdb, 0xe3, 0x21, 0xa4, 0x3d, 0x30, 0x42, 
-	0x8e, 0xa7, 0x1e, 0x95, 0xf4, 0xe7, 0x88, 0xa , 0x49, 0xa6, 0x4d, 0xe , 0xfc, 
-	0x1d, 0xa7, 0x67, 0x19, 0xf6, 0xfc, 0xeb, 0xe3, 0x5f, 0x8a, 0xd7, 0x13, 0xf8, 
-	0x6f, 0xc7, 0x71, 0x5e, 0x4f, 0xf , 0x9d, 0x15, 0xad, 0xe0, 0x63, 0x83, 0xf3, 
-	0x6c, 0xc9, 0xe7, 0xd8, 0xf3, 0x9f, 0xc2, 0x93, 0xd4, 0x67, 0x33, 0xe3, 0xc4, 
-	0xf8, 0x87, 0xe0, 0x8b, 0x88, 0xb5, 0x3b, 0xab, 0xd , 0x52, 0xce, 0xc5, 0x9c, 
-	0x79, 0x73, 0x38, 0xfd, 0xdb, 0x1f, 0x43, 0x82, 0x71, 0xf8, 0xd7, 0xaa, 0xfe, 
-	0xcf, 0x9f, 0x17, 0x5f, 0xc4, 0xb0, 0x7f, 0x67, 0x6b, 0x3b, 0x1a, 0xe9, 0x3e, 
-	0x55, 0x73, 0xd7, 0xdb, 0x8f, 0x4a, 0xd5, 0xf8, 0x9d, 0xf1, 0x23, 0xc1, 0xda, 
-	0xcf, 0xc3, 0x9b, 0xb4, 0xb8, 0xb8, 0xb7, 0x36, 0xd7, 0x36, 0x6f, 0x1c, 0x91, 
-	0x16, 0xc , 0xce, 0x4a, 0xf1, 0xc7, 0x62, 0xe , 0x31, 0x5f, 0x39, 0x7c, 0x6 , 
-	0x37, 0x89, 0xe3, 0x48, 0x24, 0xb6, 0x1f, 0x28, 0x3f, 0x3f, 0x7 , 0x27, 0xf2, 
-	0xfa, 0x52, 0xe6, 0x51, 0x97, 0xba, 0xc5, 0xba, 0xd4, 0xfb, 0x59, 0xa5, 0x49, 
-	0xa0, 0xc4, 0x63, 0x3 , 0x3e, 0x9f, 0xe7, 0x35, 0x56, 0x58, 0x88, 0x62, 0xcd, 
-	0xca, 0x81, 0x9c, 0xd6, 0x75, 0xad, 0xcb, 0x88, 0x90, 0xb1, 0x6f, 0xba, 0xe , 
-	0x3d, 0xd , 0x6c, 0xc7, 0x73, 0x5 , 0xc5, 0xb2, 0xab, 0x85, 0x88, 0x33, 0x7d, 
-	0xf0, 0x7 , 0x5f, 0x7a, 0xeb, 0x8c, 0xae, 0x62, 0xe2, 0x2d, 0xb3, 0xac, 0x68, 
-	0x43, 0x1d, 0xca, 0xc3, 0x5 , 0x3e, 0xbd, 0xea, 0x2b, 0xd2, 0xd1, 0xdf, 0x9 , 
-	0x23, 0x0 , 0x2e, 0x31, 0x81, 0xdc, 0xfa, 0x1a, 0x27, 0x8c, 0x88, 0x70, 0x8f, 
-	0xb9, 0x55, 0x88, 0x62, 0xbd, 0xea, 0xb3, 0x5c, 0x7c, 0xc2, 0x26, 0x20, 0xae, 
-	0xe0, 0x48, 0xfa, 0x7a, 0xd5, 0x31, 0x2d, 0xb , 0xd1, 0x5b, 0x47, 0xf , 0xef, 
-	0x87, 0xcd, 0x1b, 0x7c, 0xd2, 0x43, 0x9f, 0x99, 0x7d, 0xc1, 0xae, 0x5b, 0x52, 
-	0xb5, 0xc5, 0xc3, 0x4f, 0x12, 0x1f, 0x2d, 0x89, 0xeb, 0xda, 0xba, 0x19, 0xc , 
-	0xbf, 0x67, 0x73, 0x19, 0xf9, 0x43, 0x1 , 0xf4, 0x15, 0x9f, 0x7f, 0xb2, 0x35, 
-	0x90, 0xe1, 0x73, 0x82, 0x1c, 0x13, 0xc1, 0xf7, 0x15, 0x94, 0xa2, 0x5a, 0x67, 
-	0x99, 0xfc, 0x52, 0xf0, 0x9a, 0xea, 0xf0, 0x7d, 0xba, 0xc5, 0x31, 0x7b, 0x1a, 
-	0xf4, 0xff, 0x0 , 0x9e, 0xc0, 0x7f, 0x9 , 0xf7, 0xf4, 0xfc, 0xab, 0xc8, 0xd9, 
-	0x4a, 0x31, 0x56, 0x5 , 0x59, 0x49, 0x4 , 0x11, 0xc8, 0x3e, 0x95, 0xf4, 0xd , 
-	0xa9, 0x95, 0xa6, 0x92, 0x27, 0x39, 0x54, 0xe7, 0xaf, 0x7a, 0xe1, 0x3e, 0x2e, 
-	0x78, 0x57, 0x7a, 0xc9, 0xae, 0x69, 0xf1, 0x80, 0xca, 0x37, 0x5d, 0x46, 0xa3, 
-	0xef, 0xf , 0xef, 0x8f, 0x7f, 0x5f, 0xce, 0xb1, 0x68, 0xb3, 0xce, 0x3f, 0x1a, 
-	0x33, 0x49, 0x45, 0x48, 0x5 , 0x26, 0x68, 0x6a, 0x4a, 0x0 , 0x28, 0xcd, 0x6 , 
-	0x9b, 0x4c, 0x2 , 0x8a, 0x28, 0xfc, 0x28, 0x0 , 0xfc, 0x69, 0x33, 0xef, 0x41, 
-	0xfa, 0x52, 0x53, 0x0 , 0xa3, 0x34, 0x1a, 0x6d, 0x0 , 0x14, 0x51, 0x48, 0x4d, 
-	0x0 , 0x4 , 0xd2, 0x51, 0x45, 0x0 , 0x19, 0xa3, 0xf1, 0xa3, 0xf0, 0xa4, 0x3f, 
-	0x4a, 0x0 , 0xd , 0x25, 0x14, 0x84, 0xd0, 0x0 , 0xd4, 0x94, 0x66, 0x8a, 0x0 , 
-	0x29, 0xa6, 0x8c, 0xd1, 0x40, 0x5 , 0x1f, 0x8d, 0x1f, 0x85, 0x1f, 0x85, 0x0 , 
-	0x1f, 0x8d, 0x35, 0xa8, 0xcf, 0xb5, 0x14, 0x0 , 0x52, 0x35, 0x29, 0xa6, 0xd0, 
-	0x4 , 0xd9, 0xa2, 0x9b, 0x4e, 0x15, 0x40, 0x3b, 0x34, 0x53, 0x69, 0xc2, 0x80, 
-	0x17, 0x3e, 0xf4, 0xbf, 0x8d, 0x36, 0x94, 0x7d, 0x28, 0x1 , 0x68, 0xa3, 0xf0, 
-	0xa2, 0x80, 0x1d, 0x9a, 0x50, 0x69, 0xab, 0x4b, 0x40, 0xe , 0xa2, 0x93, 0x34, 
-	0xa2, 0x80, 0x17, 0x3e, 0xf4, 0xbf, 0x8d, 0x36, 0x94, 0x7d, 0x28, 0x1 , 0x69, 
-	0x41, 0xa4, 0xfc, 0x28, 0xa0, 0x7 , 0x66, 0x94, 0x1a, 0x6a, 0xd2, 0xd0, 0x3 , 
-	0xa9, 0x45, 0x37, 0x34, 0xa2, 0x80, 0x17, 0x3e, 0xf4, 0xbf, 0x8d, 0x36, 0x94, 
-	0x7d, 0x2a, 0x40, 0x5a, 0x50, 0x69, 0x3f, 0xa , 0x28, 0x1 , 0x73, 0x4b, 0x4d, 
-	0xa5, 0x5a, 0x0 , 0x72, 0xd2, 0xd3, 0x69, 0xdf, 0xc2, 0x4d, 0x54, 0x63, 0xcc, 
-	0xec, 0x26, 0xec, 0x81, 0x9b, 0x68, 0xe3, 0xeb, 0x9f, 0x43, 0x58, 0x9e, 0x20, 
-	0xd4, 0x8 , 0xb7, 0xd8, 0xad, 0xcb, 0x70, 0x3d, 0x45, 0x5e, 0xbc, 0xb8, 0x31, 
-	0xa3, 0xe5, 0x88, 0xfa, 0x56, 0x46, 0x97, 0x10, 0xbf, 0xd4, 0xcd, 0xc4, 0x9f, 
-	0xea, 0xe1, 0xe7, 0x1f, 0xde, 0xf4, 0xae, 0x87, 0xae, 0x84, 0x2d, 0x16, 0xa6, 
-	0xa6, 0x87, 0x6c, 0x2d, 0xad, 0x63, 0x4c, 0x7c, 0xf2, 0xd , 0xef, 0xf8, 0xf6, 
-	0xad, 0x4 , 0xf2, 0xf7, 0x10, 0x7e, 0xf0, 0xe0, 0xad, 0x47, 0x8 , 0xcb, 0x92, 
-	0x4e, 0xdd, 0xb5, 0x36, 0xdd, 0xc7, 0x18, 0xea, 0x7a, 0xe3, 0x39, 0xfc, 0xaa, 
-	0x89, 0xea, 0x3a, 0x16, 0x62, 0xd8, 0xc1, 0xeb, 0xc6, 0x2b, 0x52, 0xdc, 0x2f, 
-	0xca, 0xf8, 0xdc, 0xb9, 0x20, 0xe7, 0xa8, 0x27, 0x9e, 0x9f, 0x9d, 0x67, 0x59, 
-	0x23, 0x3c, 0xdb, 0x33, 0xdf, 0x8f, 0xad, 0x6c, 0xda, 0xc0, 0xe6, 0x5f, 0x29, 
-	0x47, 0x3d, 0xc0, 0xe9, 0x51, 0x29, 0x59, 0x15, 0x5 , 0x76, 0x67, 0x6a, 0x93, 
-	0x88, 0x20, 0x33, 0x93, 0xb4, 0x1 , 0xc0, 0xf7, 0xf5, 0x19, 0xae, 0x5b, 0x4f, 
-	0x8a, 0x4d, 0x43, 0x50, 0x37, 0xf3, 0xaa, 0xb2, 0xc4, 0xd8, 0x8d, 0x4b, 0x67, 
-	0xb7, 0x5c, 0x77, 0xe6, 0xb7, 0x3c, 0x40, 0xb2, 0xdc, 0xca, 0xa5, 0x10, 0xb4, 
-	0x5 , 0xca, 0x16, 0x53, 0xc7, 0x15, 0x95, 0xab, 0x2c, 0x76, 0x56, 0xab, 0x14, 
-	0x3 , 0xcb, 0x92, 0x41, 0xd0, 0x76, 0x1d, 0xcd, 0x72, 0x5f, 0x53, 0x61, 0x97, 
-	0xd7, 0x8d, 0x75, 0x2f, 0x94, 0x3e, 0xe8, 0xea, 0x7 , 0x46, 0x3f, 0xe1, 0x57, 
-	0x2c, 0x11, 0x2d, 0x23, 0xf3, 0x58, 0x6e, 0x90, 0xf4, 0xcf, 0x6a, 0xa7, 0xa5, 
-	0xc2, 0x23, 0x8f, 0xcd, 0x7f, 0xf8, 0xd , 0x4e, 0x58, 0xbb, 0x64, 0xd6, 0x8b, 
-	0x45, 0x72, 0x1e, 0xa4, 0xb3, 0x4c, 0xf3, 0x36, 0xe7, 0x35, 0x9f, 0xaa, 0x6a, 
-	0xd6, 0xd6, 0x5f, 0x21, 0x3e, 0x64, 0x99, 0xfb, 0x8b, 0xdb, 0xeb, 0x54, 0xb5, 
-	0xed, 0x51, 0xe3, 0xcd, 0xb5, 0xa7, 0x2e, 0xdc, 0x16, 0x1f, 0xd2, 0xa8, 0x58, 
-	0x59, 0xb9, 0x7d, 0xcd, 0xf3, 0x48, 0x7a, 0x93, 0xda, 0xa6, 0xf7, 0x2a, 0xd6, 
-	0x1d, 0x79, 0x7f, 0x7d, 0x74, 0x33, 0x34, 0xff, 0x0 , 0x67, 0x8c, 0xf4, 0x44, 
-	0xe0, 0xfe, 0x75, 0x48, 0xb2, 0x21, 0xfd, 0xd4, 0x3b, 0x9b, 0xfb, 0xcf, 0xd4, 
-	0xd7, 0x5b, 0xa5, 0xe8, 0x19, 0x8c, 0x4b, 0x30, 0xda, 0xf , 0x3b, 0x98, 0x72, 
-	0x7e, 0x94, 0xb3, 0xda, 0x69, 0xf6, 0xf3, 0x71, 0x18, 0x91, 0xbd, 0x5a, 0xb4, 
-	0x8c, 0x1b, 0xf2, 0x22, 0x52, 0x48, 0x8f, 0xc1, 0x45, 0xff, 0x0 , 0xb3, 0x77, 
-	0x38, 0xe5, 0x9d, 0xbb, 0x7d, 0x2b, 0x6a, 0xe8, 0xb8, 0xb2, 0x2c, 0x80, 0xe5, 
-	0x8e, 0x33, 0xe9, 0x55, 0x2c, 0x4a, 0x95, 0x25, 0x0 , 0x51, 0x9e, 0x0 , 0xe9, 
-	0x5a, 0x76, 0x72, 0xab, 0x5b, 0xb4, 0x25, 0x37, 0x1c, 0xe4, 0x7e, 0x44, 0x1f, 
-	0xe7, 0xfa, 0x54, 0xcb, 0x4b, 0xa4, 0x11, 0xd6, 0xcc, 0xc2, 0x6d, 0x9 , 0xee, 
-	0x3f, 0x7c, 0xd2, 0x72, 0x47, 0xa , 0x45, 0x41, 0xa4, 0x2d, 0xce, 0x97, 0xaf, 
-	0x43, 0x18, 0x62, 0x12, 0x63, 0xb4, 0x8a, 0xe9, 0xfe, 0xd1, 0xb , 0x10, 0x5b, 
-	0x11, 0xb0, 0xe0, 0xe7, 0xa1, 0xc5, 0x51, 0x6b, 0x23, 0x36, 0xb0, 0x2f, 0x64, 
-	0x52, 0xb1, 0xc3, 0xfe, 0xac, 0x30, 0xe5, 0x89, 0xef, 0x8f, 0x4a, 0x51, 0xb5, 
-	0x86, 0xdb, 0xb9, 0xad, 0x3c, 0xe0, 0x47, 0x9f, 0x6a, 0xe0, 0x3c, 0x6d, 0x72, 
-	0x66, 0xd4, 0x56, 0x2c, 0xf0, 0xa3, 0x3f, 0x8d, 0x75, 0xf7, 0xd3, 0x62, 0x33, 
-	0x5c, 0x6 , 0xa7, 0x37, 0x9f, 0xa9, 0x4b, 0x27, 0x6d, 0xd8, 0x15, 0x8d, 0x59, 
-	0x1d, 0x38, 0x58, 0xde, 0x62, 0x2d, 0xe4, 0xd0, 0xc1, 0xb1, 0xa , 0x81, 0x8f, 
-	0xee, 0xd3, 0xa1, 0x76, 0x68, 0x77, 0xb4, 0xaa, 0xbb, 0xb2, 0x48, 0x51, 0x55, 
-	0x27, 0x38, 0x5a, 0xbb, 0x6e, 0xac, 0xb6, 0xeb, 0xfe, 0xad, 0x38, 0xea, 0x79, 
-	0x34, 0xa0, 0xdb, 0x46, 0x98, 0xa4, 0x94, 0x90, 0xaa, 0xaa, 0xe3, 0x23, 0xcd, 
-	0x7f, 0xa5, 0x2e, 0xc6, 0x1f, 0xf2, 0xc5, 0x57, 0xfd, 0xe3, 0x4e, 0xca, 0x9e, 
-	0x1a, 0x76, 0x6f, 0x65, 0x14, 0xe1, 0x18, 0x3f, 0x76, 0x9 , 0x5b, 0xeb, 0x54, 
-	0x72, 0x92, 0x5b, 0x82, 0x16, 0x42, 0x5e, 0x3e, 0x11, 0xb2, 0x0 , 0xe9, 0xc1, 
-	0xaa, 0x10, 0x69, 0xd6, 0x72, 0x42, 0xac, 0xee, 0xc8, 0xcd, 0xd8, 0xf , 0xfe, 
-	0xbd, 0x68, 0xaa, 0x94, 0xd3, 0xee, 0x1c, 0xc2, 0x17, 0x11, 0x9e, 0x87, 0xd7, 
-	0x8f, 0xeb, 0x59, 0xea, 0x48, 0x1c, 0x66, 0xb2, 0x93, 0xf7, 0x8e, 0xec, 0x2d, 
-	0x35, 0x28, 0xbd, 0x4 , 0x6d, 0x1a, 0x13, 0xf7, 0x2e, 0xd4, 0x7f, 0xbc, 0x8 , 
-	0xfe, 0x95, 0x13, 0x68, 0xb3, 0x7f, 0xcb, 0x39, 0xa3, 0x7f, 0xa3, 0xa , 0xb1, 
-	0xbd, 0x87, 0x7a, 0x4 , 0x8d, 0x9e, 0x4d, 0x1c, 0xc8, 0xdf, 0xea, 0xd0, 0x7d, 
-	0xa , 0x52, 0x69, 0x37, 0xe9, 0xcf, 0x94, 0x4f, 0xb8, 0x6 , 0xab, 0xc9, 0x6b, 
-	0x74, 0x9f, 0x7a, 0x33, 0x5b, 0x11, 0xca, 0xe3, 0x80, 0xc4, 0x7d, 0x2a, 0x5f, 
-	0xb4, 0x4d, 0xff, 0x0 , 0x3d, 0x19, 0xbe, 0xbc, 0xd1, 0x7e, 0xcc, 0x97, 0x84, 
-	0x83, 0x39, 0xf6, 0x49, 0x87, 0x58, 0xdb, 0xf2, 0x34, 0xcc, 0x9e, 0xf5, 0xd1, 
-	0xf9, 0xe4, 0xf0, 0xf0, 0xc4, 0xdf, 0x54, 0x14, 0xdc, 0x5b, 0x37, 0xde, 0xb7, 
-	0x5f, 0xc1, 0x8d, 0x37, 0x27, 0xdc, 0x9f, 0xa8, 0xf6, 0x67, 0x3e, 0xa4, 0x1 , 
-	0xd2, 0x95, 0x5d, 0x77, 0x2 , 0xeb, 0xb8, 0x67, 0x91, 0x9c, 0x64, 0x7a, 0x66, 
-	0xb7, 0x64, 0xb4, 0xb0, 0x71, 0x9f, 0x25, 0xc1, 0xf6, 0x39, 0xff, 0x0 , 0xa , 
-	0xab, 0x36, 0x93, 0x1b, 0x46, 0x5e, 0x27, 0x60, 0x33, 0x8c, 0x9e, 0x99, 0xa1, 
-	0xd4, 0x7d, 0x48, 0x78, 0xa , 0x9d, 0x35, 0x33, 0x6e, 0xc , 0x22, 0xe9, 0xfe, 
-	0xcf, 0xbf, 0xc9, 0x27, 0xe4, 0xdf, 0x8d, 0xc0, 0x7b, 0xe2, 0xa6, 0xb2, 0x93, 
-	0xcb, 0x93, 0x69, 0xe8, 0x6a, 0xbc, 0xd1, 0x3c, 0x32, 0x98, 0xe4, 0x18, 0x65, 
-	0xa7, 0x67, 0x20, 0x30, 0xea, 0x28, 0xdd, 0x1c, 0xd1, 0x72, 0xa7, 0x3f, 0x34, 
-	0x6f, 0x31, 0x12, 0x42, 0xa7, 0xf8, 0x97, 0x83, 0xee, 0x29, 0x15, 0x6a, 0xb6, 
-	0x9b, 0x2e, 0xf8, 0xb1, 0xde, 0xae, 0x28, 0xac, 0x65, 0xb9, 0xf4, 0x34, 0x1a, 
-	0x9c, 0x53, 0x45, 0xab, 0x0 , 0x31, 0xee, 0x2a, 0xcb, 0x4b, 0xfb, 0xcc, 0x7a, 
-	0x55, 0x4b, 0x62, 0x57, 0x91, 0x56, 0x23, 0x1b, 0x89, 0xfa, 0x55, 0x29, 0x68, 
-	0x69, 0xec, 0xf5, 0xd4, 0x8a, 0x47, 0x26, 0x9a, 0xa0, 0x9a, 0x91, 0x92, 0x96, 
-	0x34, 0xac, 0xdd, 0xd9, 0xd3, 0x18, 0xa4, 0x86, 0x28, 0x14, 0x8f, 0xc , 0x72, 
-	0x2e, 0x1d, 0x3 , 0xa , 0xb9, 0x6f, 0x0 , 0x6e, 0xa3, 0x8a, 0xb0, 0xd6, 0x71, 
-	0xed, 0xcd, 0x1c, 0x8d, 0x97, 0xed, 0x23, 0xb3, 0x39, 0xeb, 0x8d, 0x1a, 0x17, 
-	0x39, 0x89, 0x8a, 0x1a, 0xa5, 0x36, 0x91, 0x78, 0x9c, 0xa6, 0xd7, 0x1e, 0xd5, 
-	0xd2, 0xc9, 0xe , 0xd6, 0xc0, 0x6a, 0x63, 0x29, 0xe9, 0x8c, 0xd1, 0x79, 0x23, 
-	0x19, 0x60, 0x70, 0xb5, 0x35, 0xb5, 0x9f, 0x91, 0xcb, 0x35, 0xbd, 0xdc, 0x7f, 
-	0x7a, 0x19, 0x3f, 0x2a, 0x4c, 0xce, 0xf , 0xdd, 0x7f, 0xfb, 0xe4, 0xd7, 0x52, 
-	0x77, 0x1 , 0xc8, 0xa4, 0xc6, 0x7a, 0xad, 0x1c, 0xcf, 0xb1, 0x8f, 0xf6, 0x5c, 
-	0x57, 0xc3, 0x36, 0x73, 0x21, 0xee, 0x3b, 0x2b, 0x7e, 0x55, 0x22, 0x47, 0x7a, 
-	0xe7, 0x88, 0xdb, 0xf2, 0xae, 0x8b, 0x18, 0x38, 0x1f, 0xa0, 0xa3, 0x7 , 0xde, 
-	0x8e, 0x6f, 0x22, 0xa3, 0x97, 0x25, 0xbc, 0xd9, 0x8b, 0xe , 0x9f, 0x76, 0xfc, 
-	0xbb, 0x84, 0xfc, 0x6a, 0xdc, 0x1a, 0x6c, 0x4b, 0xcc, 0x8c, 0x5f, 0xda, 0xb4, 
-	0x36, 0xfb, 0xf , 0xce, 0x86, 0x50, 0x39, 0x34, 0xb5, 0x3a, 0xa9, 0xe1, 0x28, 
-	0xc3, 0xa5, 0xfd, 0x48, 0xe3, 0x8d, 0x23, 0x18, 0x45, 0x0 , 0x53, 0xf9, 0x34, 
-	0x83, 0x93, 0x52, 0xaa, 0xfb, 0x52, 0x3a, 0x6e, 0x90, 0x22, 0xe2, 0xa6, 0x8f, 
-	0x3e, 0x95, 0x12, 0xe4, 0x7b, 0x7d, 0x6a, 0x64, 0x20, 0x75, 0x15, 0x49, 0x11, 
-	0x29, 0xa , 0xaa, 0x59, 0xb8, 0xfc, 0x2a, 0x78, 0x6d, 0xcb, 0x72, 0xc4, 0x8a, 
-	0x7d, 0xba, 0x80, 0xb8, 0x4 , 0x1f, 0xaf, 0x5a, 0x92, 0x69, 0x1 , 0x8f, 0xe5, 
-	0xc8, 0x20, 0x74, 0x3d, 0xeb, 0x45, 0x15, 0xd4, 0xc6, 0x55, 0x1d, 0xec, 0x8a, 
-	0x77, 0xb2, 0xa8, 0xfd, 0xda, 0x71, 0x8e, 0xf5, 0x57, 0xf1, 0xa5, 0x9d, 0x81, 
-	0x93, 0x8a, 0x48, 0xd7, 0x71, 0xfe, 0x7e, 0xd5, 0x94, 0x9d, 0xd9, 0xd5, 0x5 , 
-	0x64, 0x3a, 0x31, 0x9e, 0x4f, 0x40, 0x39, 0x3e, 0x95, 0x9b, 0xaf, 0x6a, 0x5 , 
-	0x31, 0xc , 0x18, 0xe , 0xdc, 0x2f, 0xfb, 0x23, 0xd4, 0xd4, 0xba, 0xcd, 0xf2, 
-	0xc1, 0xe , 0xd5, 0xe7, 0x3c, 0x22, 0x8e, 0xac, 0x6b, 0x36, 0xde, 0x3d, 0x81, 
-	0xa5, 0x9f, 0xd , 0x34, 0x9f, 0x78, 0xfa, 0xf , 0x4a, 0x70, 0x8d, 0xd9, 0xe4, 
-	0xe6, 0x58, 0xff, 0x0 , 0x65, 0x1f, 0x67, 0x7 , 0xef, 0x3f, 0xc0, 0x8e, 0x21, 
-	0x1c, 0x30, 0xe4, 0x32, 0xb3, 0xe3, 0x71, 0x6e, 0xe4, 0x9a, 0x11, 0x89, 0x65, 
-	0x66, 0xc6, 0xf7, 0x60, 0xaa, 0x7b, 0x73, 0x55, 0x84, 0xb1, 0x89, 0xca, 0x83, 
-	0xf2, 0xa9, 0xa7, 0x49, 0x24, 0x4c, 0xbb, 0x4f, 0x40, 0x72, 0x2b, 0xa3, 0xa1, 
-	0xf3, 0x9 , 0xab, 0xea, 0x74, 0x16, 0xad, 0xd , 0xbc, 0x4a, 0x8a, 0xd9, 0x38, 
-	0xe4, 0xd2, 0xb5, 0xec, 0x23, 0xac, 0x80, 0x7e, 0x35, 0xce, 0x29, 0x8b, 0x1c, 
-	0xfe, 0xa4, 0xd2, 0x87, 0x80, 0x1e, 0x55, 0x3d, 0xb8, 0xac, 0xbd, 0x9f, 0x99, 
-	0xed, 0xac, 0xe9, 0xc6, 0x2a, 0x31, 0x86, 0x8b, 0xcf, 0xfe, 0x1 , 0xbe, 0xda, 
-	0xad, 0xb8, 0xff, 0x0 , 0x96, 0xcb, 0xff, 0x0 , 0x7d, 0x53, 0x7f, 0xb6, 0x6d, 
-	0xc7, 0xfc, 0xb5, 0x27, 0xe8, 0x6b, 0xb , 0xcf, 0x84, 0x74, 0xda, 0x3f, 0xa , 
-	0x5f, 0xb5, 0xc6, 0x3f, 0x8a, 0x9f, 0xb3, 0x5d, 0xc8, 0x96, 0x75, 0x59, 0xed, 
-	0x14, 0x6d, 0x1d, 0x66, 0x2c, 0x70, 0x5c, 0xfd, 0x14, 0xd3, 0x1b, 0x58, 0x7 , 
-	0xa4, 0x72, 0xb7, 0xfc, 0x4 , 0xd6, 0x31, 0xbc, 0x4e, 0xc7, 0xf2, 0xa4, 0xfb, 
-	0x58, 0xe8, 0x3 , 0x1f, 0xc2, 0x8f, 0x66, 0x8c, 0xff, 0x0 , 0xb5, 0xf1, 0x2f, 
-	0x6b, 0x1a, 0xed, 0xab, 0x3f, 0xfc, 0xfb, 0xbf, 0xe9, 0xfe, 0x35, 0x1c, 0x9a, 
-	0xc4, 0x8b, 0xd6, 0x12, 0xf , 0xb9, 0x15, 0x9d, 0xe7, 0xca, 0x7e, 0xec, 0x32, 
-	0x1f, 0xa2, 0x1a, 0x8e, 0x45, 0xba, 0x91, 0xbf, 0xe3, 0xde, 0x63, 0x91, 0xfd, 
-	0xc3, 0x47, 0x24, 0x49, 0xfe, 0xd2, 0xc6, 0xcb, 0x6f, 0xc8, 0xbb, 0x36, 0xb9, 
-	0x36, 0xd6, 0x2 , 0x3c, 0x36, 0x3a, 0xe6, 0xbb, 0x6f, 0xc , 0xc6, 0xf0, 0xe8, 
-	0xf0, 0x22, 0x5c, 0xaf, 0xfa, 0xb0, 0x48, 0x71, 0x8e, 0xbc, 0xd7, 0x9e, 0x2d, 
-	0x95, 0xc2, 0xdc, 0x43, 0x1c, 0x91, 0x95, 0x32, 0x38, 0x3 , 0x70, 0xe3, 0x39, 
-	0xef, 0x5e, 0x9b, 0x6f, 0x1b, 0xb , 0x75, 0x53, 0x6a, 0x8f, 0x81, 0xd6, 0x3c, 
-	0x7f, 0x4a, 0xb8, 0xa4, 0x96, 0x87, 0x26, 0x22, 0xbd, 0x6a, 0xad, 0x7b, 0x57, 
-	0xb0, 0xf6, 0x56, 0x3f, 0x7e, 0xd8, 0x37, 0xfb, 0x51, 0x9f, 0xf0, 0xa6, 0x2b, 
-	0xc6, 0xad, 0x84, 0x9d, 0xe3, 0x3d, 0xc3, 0x8a, 0x37, 0x42, 0xad, 0x8d, 0xf3, 
-	0x42, 0xde, 0x84, 0xff, 0x0 , 0x8e, 0x29, 0xea, 0xd2, 0xbf, 0xb , 0x34, 0x32, 
-	0x8f, 0x47, 0x1f, 0xe3, 0xfe, 0x34, 0xce, 0x71, 0x24, 0x57, 0x65, 0xf9, 0xa2, 
-	0x8e, 0x6f, 0x74, 0xeb, 0xfe, 0x35, 0x89, 0xe3, 0x7b, 0x83, 0x6f, 0xa0, 0xf9, 
-	0x70, 0xbc, 0xd1, 0xbc, 0xd2, 0xaa, 0xb2, 0x37, 0x75, 0x0 , 0x9f, 0xe6, 0x16, 
-	0xb6, 0x64, 0x40, 0x6 , 0x5e, 0xda, 0x48, 0xff, 0x0 , 0xda, 0x8c, 0xe4, 0x7f, 
-	0x5a, 0xe7, 0xfc, 0x79, 0x6b, 0x7f, 0xa8, 0xb , 0x38, 0x2c, 0xc3, 0x5c, 0x43, 
-	0x1a, 0xb3, 0x92, 0x46, 0x36, 0xb3, 0x10, 0x31, 0xf9, 0x28, 0xfc, 0xe8, 0x76, 
-	0x34, 0xa7, 0x19, 0xca, 0x56, 0x82, 0xd4, 0xe5, 0x64, 0x73, 0xe5, 0x19, 0x24, 
-	0x66, 0x90, 0xb7, 0xb , 0xb8, 0xf4, 0xf7, 0xa8, 0xe1, 0x7c, 0xde, 0x43, 0xd7, 
-	0xe5, 0xc0, 0xe6, 0xaf, 0x49, 0xe1, 0xfd, 0x5f, 0x6e, 0x5a, 0xdc, 0xe0, 0x7b, 
-	0xd6, 0x7b, 0x47, 0x2c, 0x17, 0xab, 0x1c, 0xc8, 0x55, 0xd5, 0x87, 0x7 , 0xeb, 
-	0x53, 0x75, 0x63, 0x57, 0x4a, 0xb4, 0x24, 0xa7, 0x38, 0xbd, 0xfa, 0x9d, 0xbd, 
-	0xa3, 0x7 , 0xd2, 0x32, 0x38, 0xf2, 0xc7, 0xf3, 0xaa, 0x99, 0xcd, 0x5e, 0xd0, 
-	0x11, 0x25, 0xd1, 0x6e, 0x32, 0x7e, 0xe8, 0xc9, 0x1e, 0xd5, 0x43, 0x38, 0x3c, 
-	0x74, 0xac, 0xa5, 0xb2, 0x3e, 0xaa, 0x8c, 0xb7, 0x2 , 0x72, 0xa7, 0xe9, 0x59, 
-	0x56, 0x32, 0x79, 0x1a, 0xe1, 0x6f, 0xe1, 0xdc, 0xb , 0xc , 0x75, 0x19, 0xe6, 
-	0xb5, 0x18, 0xe0, 0x56, 0x34, 0xfc, 0x6a, 0xdf, 0xef, 0x2 , 0x2a, 0xe8, 0x3f, 
-	0x7d, 0x1c, 0x19, 0xb2, 0xbd, 0x14, 0xfc, 0xcf, 0x71, 0xf0, 0x9c, 0xa8, 0x2d, 
-	0x2d, 0x4e, 0xf6, 0xf9, 0x4f, 0x1f, 0x88, 0xdd, 0xfd, 0x8 , 0xa9, 0xf5, 0x9b, 
-	0x54, 0x8e, 0x69, 0xa , 0xa8, 0x85, 0xa5, 0x7c, 0xb2, 0x76, 0x67, 0xdb, 0x9f, 
-	0x97, 0xdf, 0x8f, 0xd2, 0xb1, 0x7e, 0x1e, 0xdc, 0xc4, 0xda, 0xd , 0xb1, 0x9b, 
-	0x7b, 0x65, 0x86, 0xe3, 0xe8, 0x41, 0x38, 0x23, 0xe8, 0x1 , 0xae, 0xcb, 0x5a, 
-	0x85, 0x64, 0x89, 0x55, 0x2 , 0x6e, 0x60, 0x19, 0xb2, 0x41, 0x1 , 0x80, 0x38, 
-	0xfc, 0xf9, 0xfc, 0xeb, 0x59, 0x68, 0xcf, 0x9f, 0x5a, 0x9e, 0x35, 0xf1, 0x8a, 
-	0xd3, 0xec, 0xfa, 0xc4, 0x17, 0x49, 0x1b, 0x16, 0x9a, 0x1c, 0x2f, 0xcb, 0x95, 
-	0xdc, 0xe , 0x7f, 0xad, 0x64, 0xfc, 0x3f, 0xbf, 0x4b, 0x4d, 0x61, 0xa7, 0x65, 
-	0x82, 0x4f, 0x2e, 0x58, 0xe4, 0x2c, 0xdc, 0x1c, 0x2b, 0x7f, 0xe , 0x38, 0xef, 
-	0xde, 0xbb, 0x4f, 0x8d, 0xd6, 0x17, 0x12, 0xf8, 0x66, 0xde, 0xfe, 0x64, 0x52, 
-	0x2d, 0x66, 0xa , 0xcb, 0x9e, 0x40, 0x23, 0x1c, 0xfe, 0x24, 0x57, 0x9e, 0x78, 
-	0x7e, 0x63, 0xf6, 0xcf, 0x26, 0x69, 0xb6, 0x43, 0x36, 0x63, 0x31, 0x80, 0x32, 
-	0xc3, 0xae, 0x39, 0x38, 0xf4, 0xeb, 0x48, 0x87, 0xb9, 0xf5, 0xc7, 0xec, 0x9d, 
-	0x7f, 0xf , 0xd9, 0x66, 0x6 , 0x44, 0x8d, 0x52, 0xe2, 0x50, 0x3 , 0xf7, 0x1b, 
-	0xbb, 0xfe, 0x15, 0xee, 0x17, 0x17, 0x6a, 0xf7, 0x8 , 0x8a, 0xc1, 0x5e, 0x4f, 
-	0x9a, 0x30, 0x71, 0x86, 0x18, 0xed, 0xd2, 0xbe, 0x3f, 0xfd, 0x9c, 0x7c, 0x50, 
-	0x34, 0xfb, 0xf9, 0x6d, 0x59, 0x95, 0x8c, 0x92, 0x6e, 0xf9, 0xdb, 0x1c, 0x8e, 
-	0x8 , 0xe3, 0xfa, 0x57, 0xd1, 0x7a, 0xe , 0xbf, 0x6f, 0x3d, 0x92, 0xc8, 0xed, 
-	0xbf, 0x9d, 0xa1, 0x41, 0x20, 0xe7, 0x1f, 0x7b, 0x3e, 0x83, 0xf5, 0xae, 0x89, 
-	0x6e, 0x42, 0x3b, 0x3f, 0x37, 0xf7, 0x8e, 0x54, 0x86, 0x75, 0x25, 0x48, 0x8d, 
-	0x49, 0xc7, 0xb1, 0xc7, 0xf4, 0xaf, 0x3d, 0xf8, 0xc1, 0xe0, 0x4f, 0xf , 0x6b, 
-	0xda, 0x1b, 0x47, 0x63, 0x63, 0x1c, 0x37, 0x19, 0x2d, 0x34, 0x80, 0x6e, 0x91, 
-	0xc9, 0xfe, 0xf1, 0xc6, 0x4f, 0x7f, 0xce, 0xba, 0xb6, 0x9f, 0xcc, 0xd3, 0x9a, 
-	0xee, 0xd1, 0xdf, 0xcb, 0x63, 0x86, 0x2f, 0x84, 0x8 , 0x73, 0xdc, 0xf7, 0xfc, 
-	0xab, 0x3f, 0x49, 0x9e, 0xe2, 0xdf, 0x7d, 0xc8, 0x45, 0x8a, 0x36, 0x52, 0x62, 
-	0x0 , 0x3 , 0xbf, 0x91, 0xc8, 0x62, 0x78, 0xe9, 0x52, 0x36, 0x7c, 0xa7, 0xe2, 
-	0x2f, 0x83, 0x77, 0xb1, 0xea, 0x12, 0x46, 0x62, 0x24, 0xb3, 0x67, 0x8 , 0xa , 
-	0xe3, 0x1e, 0xc6, 0xbb, 0x8f, 0x84, 0xff, 0x0 , 0xd , 0xff, 0x0 , 0xb0, 0x98, 
-	0x49, 0x2c, 0x4a, 0xb3, 0x28, 0xce, 0xdd, 0xb9, 0x27, 0xda, 0xbd, 0xb3, 0x56, 
-	0xfb, 0x3c, 0xb6, 0xce, 0xcb, 0xa7, 0xaf, 0xda, 0x32, 0x59, 0x98, 0x2a, 0xfe, 
-	0xf7, 0x9c, 0x3 , 0xb8, 0xf6, 0xac, 0xcd, 0x6a, 0xd6, 0x7b, 0x1b, 0x72, 0xcc, 
-	0xec, 0x38, 0x18, 0x21, 0xc1, 0x62, 0x7d, 0x72, 0xbe, 0x9f, 0x5a, 0x76, 0x11, 
-	0x99, 0x74, 0xc6, 0xf , 0xdd, 0xc8, 0x8c, 0xad, 0x80, 0x30, 0x7b, 0x7d, 0x6a, 
-	0x94, 0x37, 0xbb, 0x64, 0xa , 0x19, 0x94, 0xff, 0x0 , 0x10, 0xcf, 0x5f, 0x6a, 
-	0x83, 0x50, 0x9e, 0x61, 0x23, 0x34, 0x8e, 0x5c, 0xb1, 0xce, 0x43, 0x72, 0x2b, 
-	0x3c, 0x48, 0x7c, 0xcd, 0xa7, 0xd4, 0x63, 0x34, 0xf9, 0xac, 0x4d, 0x8e, 0xca, 
-	0xcf, 0x50, 0xdb, 0x14, 0x87, 0xf7, 0x6a, 0xa0, 0xd , 0xea, 0x7a, 0xfd, 0x47, 
-	0xf8, 0x54, 0x37, 0x13, 0x89, 0x19, 0x76, 0xaa, 0xb3, 0x37, 0x3e, 0x6a, 0x9e, 
-	0x8 , 0xed, 0x8a, 0xc7, 0xd1, 0xef, 0x37, 0xce, 0xb0, 0xca, 0xd1, 0xae, 0xe5, 
-	0x20, 0x39, 0x1d, 0x47, 0xbd, 0x5c, 0x55, 0x91, 0x3f, 0x7a, 0x9f, 0xbc, 0x45, 
-	0xe3, 0x1 , 0xba, 0x9c, 0x75, 0x1f, 0x9d, 0x6c, 0xa4, 0x45, 0x8b, 0x91, 0xdd, 
-	0xb4, 0x73, 0x14, 0x24, 0x98, 0xd8, 0x73, 0xed, 0x8a, 0xa7, 0xaa, 0x6a, 0x76, 
-	0xb2, 0x79, 0xb6, 0xe3, 0x22, 0x44, 0xe5, 0x78, 0xe1, 0x87, 0xa0, 0xa5, 0x86, 
-	0x44, 0x99, 0x4a, 0xbb, 0xed, 0x6c, 0x70, 0x48, 0xe2, 0xb0, 0x75, 0xa0, 0x1b, 
-	0x52, 0x2b, 0x10, 0x6f, 0x94, 0xe3, 0x39, 0xcd, 0x55, 0xf4, 0x15, 0x8b, 0x2b, 
-	0x6a, 0xeb, 0x71, 0xc , 0xaa, 0x18, 0x6 , 0x52, 0x5f, 0xe9, 0xd8, 0x53, 0xa6, 
-	0x53, 0xca, 0xb2, 0x7c, 0xad, 0x9d, 0xc3, 0x1d, 0x7d, 0xbf, 0x2a, 0xbf, 0xa7, 
-	0x82, 0xd6, 0x11, 0xc5, 0x36, 0xe5, 0x90, 0x2f, 0x19, 0xf4, 0x34, 0x93, 0x43, 
-	0x1b, 0x36, 0x24, 0x38, 0xc1, 0xc1, 0x23, 0xb7, 0x15, 0x9b, 0x89, 0x48, 0xf1, 
-	0x1f, 0x8a, 0x5e, 0x17, 0xfe, 0xc3, 0xd4, 0x5 , 0xed, 0xa2, 0x1f, 0xb0, 0xdd, 
-	0x31, 0xda, 0x0 , 0xff, 0x0 , 0x54, 0xfd, 0x76, 0xfd, 0x3b, 0x8a, 0xe4, 0x49, 
-	0xcd, 0x7d, 0xd , 0xe2, 0x6d, 0x3a, 0x1b, 0xdb, 0x9 , 0x34, 0xdb, 0xd4, 0x57, 
-	0x86, 0x65, 0xda, 0xf , 0xd7, 0xee, 0x91, 0x5e, 0xf , 0xe2, 0x4d, 0x2e, 0xe3, 
-	0x47, 0xd5, 0xe5, 0xb1, 0xb8, 0x4 , 0xf9, 0x67, 0x28, 0xfd, 0x9d, 0x7b, 0x11, 
-	0x59, 0xb4, 0x51, 0x46, 0x93, 0x34, 0x99, 0xa2, 0x80, 0xa , 0x28, 0xa3, 0xf0, 
-	0xa4, 0x1 , 0xf8, 0xd2, 0x67, 0xde, 0x83, 0xf4, 0xa4, 0xa6, 0x1 , 0x45, 0x6 , 
-	0x93, 0x34, 0x0 , 0x94, 0x51, 0x48, 0x4d, 0x0 , 0x25, 0x14, 0x51, 0x40, 0x7 , 
-	0xe3, 0x47, 0xe3, 0x47, 0xe1, 0x47, 0xe1, 0x40, 0x8 , 0x69, 0x28, 0xa2, 0x80, 
-	0x11, 0xa9, 0x28, 0xcd, 0x14, 0x0 , 0x53, 0x4d, 0x19, 0xa2, 0x80, 0xa , 0x3f, 
-	0x1a, 0x3f, 0xa , 0x3f, 0xa , 0x0 , 0x4f, 0xc6, 0x90, 0xd2, 0xb7, 0xd2, 0x92, 
-	0x80, 0xa , 0x33, 0x41, 0xa6, 0xd0, 0x1 , 0x46, 0x68, 0x34, 0xda, 0x0 , 0x9a, 
-	0x8a, 0x28, 0xaa, 0x1 , 0xd4, 0xa0, 0xd3, 0x41, 0xa5, 0xa0, 0x7 , 0x51, 0x48, 
-	0xd , 0x2d, 0x0 , 0x3b, 0xf1, 0xa3, 0xf1, 0xa4, 0x1f, 0x4a, 0x5f, 0xc2, 0x80, 
-	0xa , 0x50, 0x69, 0x28, 0xa0, 0x7 , 0x66, 0x94, 0x1a, 0x6a, 0xd2, 0xd0, 0x3 , 
-	0xa8, 0xa4, 0xcd, 0x28, 0xa0, 0x5 , 0xcf, 0xbd, 0x2f, 0xe3, 0x4d, 0xa5, 0x1f, 
-	0x4a, 0x0 , 0x5a, 0x28, 0xfc, 0x28, 0xa0, 0x7 , 0x66, 0x8a, 0x6d, 0x38, 0x50, 
-	0x3 , 0xb3, 0x45, 0x36, 0x9c, 0x28, 0x1 , 0x73, 0x47, 0xe3, 0x49, 0x45, 0x20, 
-	0x1d, 0x9a, 0x28, 0xfc, 0x28, 0xfc, 0x28, 0x0 , 0x1e, 0xd4, 0x97, 0xcf, 0x88, 
-	0xc4, 0x6b, 0xc6, 0x3a, 0xd2, 0xee, 0xf2, 0xe3, 0x32, 0x9e, 0x83, 0x81, 0xf5, 
-	0xaa, 0x37, 0xb7, 0x24, 0x46, 0x55, 0x8e, 0x4d, 0x6f, 0x4e, 0x36, 0x57, 0x22, 
-	0x5a, 0xb2, 0x8e, 0xb1, 0x2b, 0x4f, 0x20, 0x8a, 0x33, 0x86, 0x90, 0xe3, 0x35, 
-	0xa5, 0xa7, 0x41, 0x1d, 0xb6, 0x9f, 0xb4, 0x7d, 0xf6, 0x23, 0x24, 0x7a, 0x56, 
-	0x4e, 0x8e, 0xbe, 0x7e, 0xa0, 0xf2, 0xe0, 0xed, 0x51, 0xc1, 0x35, 0xb2, 0x9 , 
-	0x1c, 0xf4, 0xab, 0x44, 0xc8, 0x95, 0x47, 0xee, 0xc9, 0xea, 0x73, 0xeb, 0xed, 
-	0x52, 0x43, 0x29, 0x5c, 0x80, 0x57, 0x92, 0x78, 0xc7, 0xad, 0x43, 0x1e, 0x7 , 
-	0xa7, 0xe3, 0x48, 0xa7, 0x73, 0x8c, 0x76, 0xe7, 0x93, 0x4c, 0x46, 0xce, 0x9c, 
-	0x81, 0xe4, 0x69, 0x81, 0xb , 0xb5, 0xb0, 0x53, 0x38, 0x20, 0xe7, 0xf4, 0xe2, 
-	0xaf, 0x5c, 0xb3, 0xad, 0xb9, 0x6f, 0x33, 0x2c, 0xc3, 0x4 , 0xfa, 0x76, 0xfc, 
-	0xea, 0x9e, 0x9d, 0xf2, 0x59, 0xab, 0x15, 0x27, 0x70, 0xdc, 0x32, 0x31, 0xc8, 
-	0xe0, 0xd4, 0xab, 0x34, 0x72, 0xdd, 0x46, 0xac, 0x49, 0x65, 0xcb, 0x13, 0x8e, 
-	0x87, 0x1d, 0x3d, 0xeb, 0x9a, 0xa3, 0xbb, 0xb1, 0xb4, 0x74, 0x44, 0xb3, 0x2c, 
-	0x51, 0x5a, 0xab, 0x14, 0xfd, 0xda, 0x81, 0xb8, 0x91, 0xdb, 0xd6, 0xb8, 0xc9, 
-	0xe4, 0x17, 0xd7, 0xcf, 0x71, 0x8c, 0x23, 0x36, 0x10, 0x7a, 0x28, 0xad, 0x7f, 
-	0x1a, 0x6a, 0x2c, 0xb6, 0x66, 0x4 , 0xc0, 0x92, 0xe4, 0xec, 0xc2, 0xf4, 0xc7, 
-	0x7a, 0xc8, 0x84, 0x8 , 0xe1, 0x1 , 0x7d, 0x30, 0x2a, 0x16, 0xac, 0x72, 0x25, 
-	0x99, 0xc1, 0xc2, 0x8e, 0x8b, 0x55, 0x75, 0x29, 0xda, 0x38, 0x7c, 0xb4, 0x3f, 
-	0x33, 0xe , 0xbe, 0x95, 0x2c, 0x67, 0xb9, 0xaa, 0x17, 0x72, 0xf , 0x31, 0x9d, 
-	0xfb, 0xd1, 0x36, 0x28, 0x95, 0xa1, 0xb7, 0xa , 0xf9, 0xc6, 0x64, 0x6e, 0x9e, 
-	0xc3, 0xd6, 0xba, 0xd , 0x1e, 0xda, 0x2b, 0x54, 0x12, 0x48, 0xbb, 0x9f, 0xb0, 
-	0x3d, 0xab, 0x3f, 0x47, 0x8b, 0x71, 0x37, 0x12, 0xe , 0xbd, 0x8d, 0x5d, 0xba, 
-	0xb8, 0x48, 0x63, 0x69, 0x65, 0x38, 0x2 , 0x9c, 0x7d, 0xd0, 0x7a, 0xe8, 0x5c, 
-	0xba, 0xbb, 0x66, 0x52, 0xce, 0xdb, 0x54, 0x7a, 0xf4, 0x15, 0xce, 0x6a, 0x9a, 
-	0x9c, 0xb , 0x70, 0x48, 0x93, 0x79, 0x1f, 0xdd, 0xaa, 0x1a, 0xa5, 0xf5, 0xcd, 
-	0xf4, 0x84, 0x2e, 0xe5, 0x8f, 0x3c, 0x28, 0x3c, 0x53, 0x6d, 0xac, 0x77, 0x73, 
-	0x21, 0xc0, 0xa6, 0x9b, 0x62, 0xb2, 0x48, 0xeb, 0x34, 0x87, 0xdf, 0xa7, 0xc5, 
-	0x27, 0xf7, 0xd4, 0x1f, 0xf3, 0xf9, 0xd5, 0xe8, 0x5f, 0x6b, 0x71, 0x9f, 0xc2, 
-	0xa9, 0xe9, 0xc8, 0x16, 0xc6, 0x24, 0x1d, 0x15, 0x40, 0xfd, 0x2a, 0xca, 0xf5, 
-	0xa9, 0x77, 0xb8, 0xcd, 0x28, 0x6f, 0x19, 0x57, 0x90, 0x9 , 0xf5, 0x22, 0xab, 
-	0xdc, 0x4e, 0x59, 0x89, 0x3d, 0xea, 0x10, 0xdf, 0x2d, 0x31, 0x8e, 0x6a, 0x5c, 
-	0x9b, 0x1a, 0x56, 0x2a, 0xeb, 0x77, 0x1e, 0x55, 0x8c, 0xb2, 0x67, 0xa2, 0x9a, 
-	0xe3, 0x21, 0x56, 0x76, 0x0 , 0x7d, 0xe6, 0x35, 0xd0, 0xf8, 0xc2, 0x7d, 0x96, 
-	0x6b, 0x10, 0xff, 0x0 , 0x96, 0x8d, 0x58, 0xba, 0x7a, 0xf3, 0xe6, 0x67, 0xa7, 
-	0x4a, 0xca, 0x4a, 0xf2, 0x3a, 0xa9, 0x4b, 0xd9, 0xd3, 0x72, 0x1d, 0x36, 0x95, 
-	0x78, 0xdd, 0x10, 0x71, 0xef, 0x56, 0x56, 0xd6, 0x68, 0xd4, 0xf , 0xb2, 0x28, 
-	0xc7, 0xf1, 0x39, 0xc8, 0xfd, 0x6a, 0xc5, 0x9a, 0x5f, 0xce, 0xd8, 0xb7, 0xf3, 
-	0x5b, 0x9e, 0x4e, 0x78, 0xfc, 0xcd, 0x6b, 0x43, 0xa5, 0xf8, 0x84, 0x43, 0xe6, 
-	0xa4, 0x21, 0xd7, 0x19, 0xc0, 0x61, 0x9a, 0xd6, 0x31, 0x89, 0xcf, 0x3a, 0x92, 
-	0x93, 0xbb, 0x30, 0xbe, 0x78, 0xc6, 0x1e, 0xe1, 0x53, 0xfd, 0xc5, 0xff, 0x0 , 
-	0xf5, 0x52, 0xa8, 0x8d, 0xbf, 0x8e, 0x69, 0x3e, 0x9f, 0xe4, 0xd5, 0xfb, 0x89, 
-	0xcc, 0x52, 0x79, 0x77, 0xd6, 0x5b, 0x1f, 0xdd, 0x70, 0x69, 0x42, 0xc1, 0x3f, 
-	0x10, 0xdc, 0x34, 0x67, 0xd1, 0x8d, 0x1c, 0xbd, 0x98, 0xb9, 0xbb, 0x94, 0x2f, 
-	0xf6, 0xc7, 0xa4, 0x30, 0x55, 0x75, 0xde, 0xea, 0x30, 0xc7, 0xf1, 0xfe, 0x95, 
-	0x9e, 0xbc, 0x2d, 0x6a, 0xeb, 0x10, 0xcd, 0x25, 0xbc, 0x71, 0x21, 0xd , 0xe5, 
-	0xb1, 0x27, 0x7 , 0xaf, 0x4c, 0x63, 0xf5, 0xac, 0xbd, 0xa4, 0x70, 0xc3, 0x7 , 
-	0xb8, 0xae, 0x69, 0x6e, 0x7a, 0xb8, 0x4b, 0x7b, 0x3d, 0xc3, 0x14, 0x62, 0x96, 
-	0x94, 0xa , 0x4c, 0xed, 0x48, 0x4a, 0x70, 0xa1, 0x45, 0x2e, 0x3d, 0xaa, 0x4a, 
-	0x48, 0x3f, 0x1a, 0x5c, 0x66, 0x8f, 0xc2, 0x95, 0x68, 0x29, 0x21, 0xd1, 0xaf, 
-	0x35, 0x79, 0x54, 0x2d, 0xbe, 0xf , 0xdd, 0x6e, 0xa3, 0xda, 0xab, 0x46, 0x87, 
-	0xa8, 0xab, 0xc , 0xdf, 0xb9, 0xc7, 0xa5, 0x68, 0xb4, 0x13, 0x57, 0x68, 0xca, 
-	0xd7, 0xed, 0x37, 0xdb, 0xf9, 0x8b, 0xf7, 0xe2, 0xeb, 0xee, 0x2b, 0x1a, 0x33, 
-	0x8e, 0x2b, 0xac, 0x0 , 0x3c, 0x5c, 0x8c, 0xf1, 0xb5, 0xab, 0x99, 0xd4, 0xad, 
-	0xcd, 0xb5, 0xe3, 0xc5, 0xfc, 0x39, 0xca, 0x9f, 0x51, 0x53, 0x7 , 0xad, 0x8e, 
-	0x2c, 0xce, 0x86, 0xd5, 0x97, 0x5d, 0x1f, 0xa8, 0x5a, 0x48, 0x61, 0x9c, 0x1e, 
-	0xc6, 0xb7, 0x2d, 0xd8, 0x3a, 0xe4, 0x57, 0x3d, 0x9c, 0xad, 0x68, 0xe8, 0xf7, 
-	0x23, 0xfd, 0x5b, 0x1f, 0xc6, 0x9c, 0xd5, 0xcc, 0xf2, 0xfc, 0x47, 0x24, 0xb9, 
-	0x25, 0xb3, 0x36, 0x21, 0xe7, 0x83, 0x53, 0xc0, 0x70, 0x4f, 0xe3, 0xfc, 0xaa, 
-	0xbc, 0x5c, 0x30, 0xab, 0x4a, 0x3d, 0xba, 0xd6, 0x71, 0xd8, 0xf7, 0xc6, 0x1e, 
-	0xb5, 0x25, 0xba, 0x92, 0xd4, 0xd8, 0xc1, 0x2d, 0x8a, 0xb7, 0x6e, 0x80, 0x7d, 
-	0x7d, 0xd , 0x9 , 0x5c, 0x72, 0x69, 0x22, 0x58, 0x40, 0x55, 0xcd, 0x12, 0x49, 
-	0x9e, 0x5 , 0x24, 0x84, 0xa , 0x68, 0x4 , 0xfd, 0x7b, 0xfb, 0x56, 0xbd, 0xc , 
-	0xd1, 0x1b, 0x29, 0x6e, 0x9f, 0x8d, 0x1e, 0x49, 0xf5, 0xab, 0xa , 0x80, 0x53, 
-	0xf0, 0x2a, 0x79, 0x4a, 0xf6, 0x9d, 0x8a, 0x9e, 0x4b, 0x7f, 0x7a, 0x83, 0xb , 
-	0x5 , 0xeb, 0x56, 0xf1, 0x48, 0xdd, 0x47, 0xd6, 0x8e, 0x54, 0x1e, 0xd1, 0x95, 
-	0x3c, 0x96, 0xec, 0x68, 0x28, 0xe3, 0xaf, 0xe7, 0x57, 0x71, 0x4d, 0x93, 0x0 , 
-	0x67, 0x1f, 0xfd, 0x7a, 0x39, 0x10, 0x7b, 0x56, 0x52, 0x2a, 0x54, 0x7b, 0x53, 
-	0x19, 0x6a, 0xdb, 0x47, 0x8e, 0x47, 0x5f, 0x4a, 0x82, 0x65, 0x2b, 0xc1, 0x1f, 
-	0x8f, 0xad, 0x4b, 0x89, 0xa4, 0x66, 0x40, 0xdf, 0x7a, 0xa5, 0x84, 0xf1, 0x51, 
-	0x30, 0x23, 0x9a, 0x58, 0xcf, 0x38, 0xf5, 0xe2, 0xb3, 0x36, 0x6e, 0xe8, 0xb5, 
-	0xb4, 0x15, 0xa5, 0x54, 0xf9, 0xb2, 0x33, 0x4d, 0x84, 0xd5, 0x88, 0x86, 0x6b, 
-	0x45, 0xa9, 0x8c, 0xa4, 0xd0, 0xad, 0x91, 0x1e, 0x38, 0x3f, 0x5a, 0x8a, 0xf2, 
-	0x61, 0xb7, 0x60, 0xc8, 0xf5, 0xc9, 0xa9, 0x2e, 0x98, 0x2a, 0xe4, 0xd5, 0x9 , 
-	0x89, 0x62, 0x49, 0xa7, 0x37, 0x61, 0xd3, 0x8d, 0xdd, 0xc4, 0x51, 0xbb, 0xeb, 
-	0x51, 0x6a, 0x17, 0x51, 0xda, 0xdb, 0x92, 0x5b, 0xa7, 0x5f, 0xaf, 0xa5, 0x2d, 
-	0xdc, 0xe9, 0x6f, 0xb , 0x3b, 0x36, 0x30, 0x39, 0x3e, 0x95, 0x86, 0xd2, 0x3d, 
-	0xd4, 0xdf, 0x69, 0x90, 0xf , 0x2d, 0x4f, 0xee, 0xe3, 0x3d, 0xfd, 0xcd, 0x44, 
-	0x63, 0x76, 0x61, 0x8e, 0xc7, 0x2c, 0x3c, 0x2c, 0xbe, 0x27, 0xb0, 0xe8, 0x4b, 
-	0x4b, 0x31, 0xb9, 0x9f, 0xfd, 0x61, 0xfb, 0x89, 0x9f, 0xb8, 0x2a, 0x1d, 0x4e, 
-	0xef, 0x2c, 0x21, 0x87, 0x93, 0xfc, 0x47, 0xdf, 0xd2, 0x8d, 0x46, 0xe4, 0x5 , 
-	0xda, 0x98, 0xc , 0x7d, 0xb9, 0x15, 0x63, 0xc3, 0xba, 0x79, 0x66, 0x13, 0xca, 
-	0x39, 0x3c, 0xae, 0x7b, 0x7b, 0xd6, 0xcd, 0xa8, 0xa3, 0xe6, 0xe8, 0xd1, 0xa9, 
-	0x8a, 0xad, 0x6e, 0xaf, 0x76, 0x32, 0xc7, 0x43, 0x9a, 0x75, 0xf3, 0x67, 0x90, 
-	0x47, 0xbb, 0x9d, 0xa0, 0x64, 0xd6, 0x84, 0x7e, 0x1f, 0xb2, 0x51, 0xf3, 0xbc, 
-	0x8d, 0xf5, 0x6a, 0xd1, 0xe3, 0x1b, 0x57, 0xa0, 0xa2, 0xb1, 0xe6, 0x67, 0xd3, 
-	0x51, 0xcb, 0x70, 0xd0, 0x8a, 0xf7, 0x6f, 0xeb, 0xa9, 0x4e, 0x3d, 0x13, 0x4c, 
-	0x7 , 0x94, 0x27, 0xf1, 0x3f, 0xe3, 0x53, 0x2e, 0x93, 0xa6, 0xe , 0x96, 0xf9, 
-	0x1f, 0xee, 0xff, 0x0 , 0xf5, 0xea, 0x75, 0x24, 0x1a, 0x90, 0x3b, 0x74, 0xcd, 
-	0x1c, 0xcc, 0xdf, 0xea, 0xd4, 0x63, 0xb4, 0x17, 0xdc, 0x88, 0x57, 0x4d, 0xb0, 
-	0x7 , 0x8b, 0x31, 0xff, 0x0 , 0x7c, 0xa , 0x95, 0x2c, 0x6c, 0xf7, 0x7c, 0xb6, 
-	0x43, 0xff, 0x0 , 0x1d, 0xff, 0x0 , 0xa , 0x9b, 0x2f, 0x8e, 0x4d, 0x3 , 0xd4, 
-	0x9a, 0x3 , 0x92, 0xb , 0x64, 0x8b, 0x5a, 0x76, 0x8a, 0x97, 0x2c, 0x2 , 0x5b, 
-	0xc3, 0x1e, 0x7b, 0xbb, 0xed, 0xfe, 0x95, 0xd5, 0x68, 0xbf, 0xe , 0x5e, 0xf7, 
-	0x5 , 0xef, 0xec, 0x61, 0x7 , 0xd3, 0x73, 0x7f, 0x85, 0x72, 0xd6, 0x37, 0x8f, 
-	0x3 , 0x7d, 0xee, 0x2b, 0x66, 0xc7, 0x59, 0x31, 0xae, 0x55, 0xca, 0xfb, 0xa9, 
-	0xdb, 0xfc, 0xa9, 0x5c, 0xc2, 0xa4, 0xab, 0x2f, 0x85, 0xd8, 0xee, 0x34, 0xcf, 
-	0x84, 0x1a, 0x5b, 0x28, 0x37, 0x3e, 0x20, 0x4f, 0xa4, 0x76, 0xdf, 0xd4, 0xb5, 
-	0x6a, 0x2f, 0xc2, 0x3f, 0xb , 0x46, 0xa0, 0x8d, 0x56, 0x79, 0x48, 0x3c, 0xab, 
-	0x14, 0x50, 0x7e, 0x87, 0x69, 0xc7, 0xeb, 0x5c, 0x1a, 0x78, 0xaa, 0xee, 0x25, 
-	0x1b, 0x6e, 0x37, 0xf , 0x73, 0xfd, 0x45, 0x43, 0x75, 0xe3, 0x4b, 0xbd, 0xb8, 
-	0x13, 0x38, 0x3f, 0xef, 0x53, 0xe6, 0x39, 0x7f, 0xda, 0x65, 0xf6, 0x8b, 0xdf, 
-	0x1c, 0x3c, 0x2f, 0xe1, 0x8d, 0xb , 0x49, 0xd2, 0xe3, 0xd3, 0x5 , 0xd3, 0xdf, 
-	0x5c, 0x6a, 0x0 , 0x34, 0x72, 0xba, 0x9f, 0xdd, 0xaa, 0xb1, 0x24, 0x6d, 0x1c, 
-	0x8c, 0xed, 0xe6, 0xb9, 0x8f, 0xdc, 0x2a, 0xfc, 0xde, 0x74, 0x3f, 0x5f, 0xfe, 
-	0xbd, 0x66, 0xeb, 0xda, 0xd5, 0xc6, 0xb3, 0xe2, 0x9b, 0x28, 0xae, 0x6e, 0x1f, 
-	0x65, 0xba, 0x3b, 0xaf, 0x39, 0xe4, 0xe0, 0x7f, 0x4a, 0xd6, 0x8d, 0x9f, 0x18, 
-	0x4b, 0xb5, 0x61, 0xe8, 0xe0, 0x8f, 0xf1, 0xad, 0xe3, 0xf0, 0xa3, 0xc3, 0xc6, 
-	0x73, 0x7b, 0x66, 0xa4, 0xf5, 0x42, 0x7 , 0x72, 0xb8, 0x4b, 0x94, 0x75, 0xf4, 
-	0x90, 0x7f, 0xfa, 0xc5, 0x26, 0xc2, 0x7e, 0xfd, 0xa0, 0x61, 0xeb, 0x11, 0xff, 
-	0x0 , 0xa , 0x73, 0x24, 0x8d, 0xf7, 0xad, 0x23, 0x93, 0xde, 0x22, 0x3f, 0xa1, 
-	0xa8, 0xdb, 0xc8, 0x46, 0xe4, 0xcf, 0xb , 0xff, 0x0 , 0xb5, 0xcf, 0xe8, 0x71, 
-	0x4c, 0xe5, 0x10, 0x18, 0x95, 0xb0, 0x93, 0xc9, 0xb , 0x7a, 0x35, 0x6e, 0x5a, 
-	0xf8, 0xe2, 0xeb, 0x45, 0xb3, 0x5d, 0x36, 0x3d, 0x17, 0x44, 0xbc, 0x68, 0x80, 
-	0x3f, 0x6a, 0xb9, 0xb6, 0xde, 0xef, 0xbb, 0x9e, 0x7a, 0x74, 0xce, 0x3f, 0xa , 
-	0xc7, 0x53, 0x34, 0x8c, 0x15, 0x67, 0x8a, 0x60, 0x78, 0xc3, 0x8c, 0x67, 0xf3, 
-	0xac, 0x9b, 0xe8, 0x9e, 0x6d, 0x4a, 0x7f, 0x93, 0x68, 0xf3, 0x18, 0x5 , 0x1d, 
-	0x7 , 0x3d, 0x2b, 0x3a, 0x8e, 0xc8, 0xf5, 0x32, 0xba, 0x71, 0x9d, 0x49, 0x39, 
-	0x6c, 0x91, 0xd3, 0xdc, 0x7c, 0x40, 0xd6, 0xaf, 0x4f, 0x93, 0x1e, 0x9b, 0xa1, 
-	0xc6, 0xac, 0x30, 0x7c, 0xbd, 0x32, 0x33, 0xc7, 0xd5, 0xb3, 0x5e, 0x77, 0xe3, 
-	0x48, 0x73, 0x2a, 0xdc, 0x11, 0xf3, 0x47, 0x2e, 0x18, 0x81, 0x8c, 0x82, 0x6b, 
-	0xab, 0xb1, 0x8e, 0x3b, 0x48, 0xcb, 0xb6, 0x33, 0x8e, 0x2b, 0x7 , 0xc4, 0xd1, 
-	0x19, 0x2d, 0x66, 0x7 , 0xab, 0x26, 0xf1, 0x9f, 0x51, 0xcd, 0x67, 0x19, 0x6a, 
-	0x7a, 0xf5, 0x69, 0xc2, 0x74, 0xa7, 0x8 , 0xae, 0x9f, 0x90, 0x9a, 0x4d, 0xdb, 
-	0x41, 0x6f, 0x22, 0xaf, 0x49, 0x53, 0x69, 0xa6, 0xee, 0xc9, 0xaa, 0x5a, 0x6b, 
-	0x6e, 0xb5, 0x43, 0xed, 0x56, 0x92, 0x8b, 0x6a, 0x6b, 0x45, 0xde, 0x9 , 0xae, 
-	0xa3, 0xcd, 0x63, 0xea, 0x5f, 0x2d, 0xf4, 0x6f, 0xfe, 0xd5, 0x6b, 0xb1, 0xe2, 
-	0xb1, 0xf5, 0xa1, 0xfb, 0xc0, 0x45, 0x54, 0x34, 0x92, 0x39, 0x73, 0x1d, 0x68, 
-	0x33, 0xd1, 0x7e, 0x15, 0x4c, 0x64, 0x8c, 0xdb, 0x7e, 0x4 , 0x6f, 0xda, 0x3e, 
-	0xf0, 0x23, 0xf1, 0xce, 0x7f, 0xc , 0xd7, 0xa3, 0x42, 0x31, 0xa7, 0x84, 0x91, 
-	0x5b, 0x72, 0x36, 0xd3, 0x20, 0x8f, 0x27, 0x84, 0x0 , 0x13, 0xf9, 0x75, 0xaf, 
-	0x19, 0xf0, 0x3d, 0xef, 0x97, 0x74, 0xa7, 0x19, 0x56, 0x64, 0x66, 0x3 , 0x39, 
-	0x23, 0x23, 0x38, 0xc7, 0x7c, 0x66, 0xbd, 0x57, 0x45, 0xbb, 0x82, 0x4d, 0x25, 
-	0x98, 0xdc, 0x95, 0x46, 0x21, 0xda, 0x30, 0x9 , 0xda, 0xa1, 0x79, 0xe7, 0xd1, 
-	0x97, 0x24, 0x7f, 0x91, 0x5d, 0x55, 0x56, 0xa7, 0xce, 0x44, 0xab, 0xa9, 0x5a, 
-	0xa6, 0xab, 0xa3, 0xde, 0x69, 0xe , 0xb , 0x3c, 0xd1, 0x94, 0x59, 0x18, 0x8f, 
-	0xbe, 0x38, 0x7 , 0xea, 0xe , 0x3f, 0x4a, 0xf0, 0xdb, 0x91, 0x26, 0x9b, 0xa9, 
-	0x3d, 0xb5, 0xc2, 0xe2, 0x5b, 0x79, 0xa , 0xb8, 0x3 , 0xa1, 0x1f, 0xfd, 0x7a, 
-	0xf6, 0x2d, 0x51, 0x9e, 0x4b, 0xac, 0xc4, 0xae, 0xc3, 0x70, 0x0 , 0x6e, 0x25, 
-	0x5d, 0x71, 0x8e, 0xa0, 0x70, 0xc0, 0x82, 0x3f, 0x1 , 0x9f, 0x5a, 0xe5, 0xfc, 
-	0x79, 0xa1, 0xdb, 0x6a, 0x7f, 0xf1, 0x33, 0xb3, 0x55, 0x49, 0x98, 0x6d, 0x78, 
-	0xd4, 0x83, 0xe6, 0x63, 0x23, 0x3c, 0x70, 0x8 , 0xe9, 0x59, 0xec, 0xc , 0xcd, 
-	0xd1, 0x6f, 0xa3, 0xbb, 0x9f, 0xed, 0x9a, 0x74, 0xe6, 0x3b, 0x98, 0xd7, 0x7b, 
-	0xc7, 0x85, 0x52, 0xc4, 0x63, 0x95, 0x3 , 0xaf, 0x7a, 0xf5, 0x8f, 0x86, 0xfe, 
-	0x3e, 0xfb, 0x59, 0x8e, 0xce, 0xea, 0x4f, 0x26, 0xe1, 0x4e, 0x9 , 0x62, 0x30, 
-	0xdf, 0x4a, 0xf0, 0x4d, 0x24, 0xb5, 0xa4, 0xca, 0xcc, 0xa9, 0xe7, 0x46, 0x4a, 
-	0x8d, 0xea, 0x18, 0x1 , 0xf4, 0x3f, 0x8d, 0x74, 0x96, 0x77, 0x30, 0xdf, 0x65, 
-	0xca, 0xac, 0x33, 0xa6, 0x30, 0xe8, 0xd8, 0x7 , 0xa0, 0xe2, 0xb4, 0x52, 0xd2, 
-	0xcc, 0xce, 0xc7, 0xd4, 0x7a, 0x67, 0x88, 0xfc, 0xcb, 0x5d, 0x8e, 0xee, 0xe1, 
-	0x4e, 0xed, 0xb9, 0xfb, 0xde, 0xdf, 0x4a, 0xd4, 0xfe, 0xdc, 0x7b, 0xe9, 0x9 , 
-	0x92, 0x44, 0x50, 0xd8, 0xe0, 0xe7, 0x1d, 0x3a, 0x1 , 0x5f, 0x3b, 0x78, 0x47, 
-	0xc6, 0x97, 0x9a, 0x64, 0x8b, 0x6b, 0xaa, 0x66, 0x48, 0xf2, 0x36, 0xca, 0xe , 
-	0x7e, 0x99, 0xaf, 0x49, 0xd1, 0xf5, 0xb8, 0x2f, 0x61, 0x49, 0xad, 0xdf, 0x76, 
-	0xee, 0xea, 0x6a, 0xad, 0x61, 0x9e, 0x80, 0xba, 0x9c, 0x69, 0x22, 0xa8, 0xe8, 
-	0x0 , 0xea, 0x73, 0x93, 0xcf, 0xaf, 0xd6, 0xad, 0xb , 0xb8, 0xdb, 0x36, 0x57, 
-	0x32, 0x18, 0x55, 0x94, 0x98, 0xb1, 0xc2, 0x82, 0x79, 0xc9, 0xae, 0x36, 0x3b, 
-	0xad, 0xf8, 0xde, 0xdc, 0xf5, 0xce, 0x3a, 0x56, 0xa6, 0xa4, 0xe6, 0x69, 0x23, 
-	0x5d, 0xc5, 0xc1, 0x4d, 0xc1, 0x87, 0x50, 0x3a, 0xf , 0xe5, 0x45, 0xc5, 0x63, 
-	0x40, 0x69, 0x10, 0x6a, 0x4c, 0x12, 0xde, 0x49, 0x52, 0xe1, 0xb0, 0xa8, 0x5f, 
-	0x1 , 0x3a, 0xf5, 0x3e, 0xb5, 0xcf, 0xeb, 0x56, 0xd , 0x63, 0x26, 0xd0, 0xe6, 
-	0x66, 0x8d, 0x8a, 0xb1, 0x0 , 0xe0, 0x90, 0x71, 0xc1, 0xf4, 0xad, 0x1b, 0x6b, 
-	0x9b, 0xa4, 0xba, 0x11, 0x49, 0xb6, 0x4d, 0x89, 0xf2, 0x7 , 0xf4, 0xc7, 0x51, 
-	0xef, 0xce, 0x6a, 0xc5, 0x8d, 0x9d, 0x90, 0xb2, 0x57, 0xbd, 0xba, 0xb8, 0x91, 
-	0xae, 0x72, 0x36, 0xac, 0x59, 0xf2, 0xdb, 0x3c, 0x9f, 0x7e, 0xf4, 0x6e, 0x23, 
-	0x9d, 0x8a, 0x43, 0xc1, 0xa , 0x7a, 0xf0, 0x4d, 0x68, 0xd9, 0x5e, 0x4 , 0x9b, 
-	0xf7, 0xbb, 0x4a, 0x93, 0x90, 0x7 , 0x63, 0x55, 0xb5, 0x7d, 0x36, 0x6b, 0x49, 
-	0x19, 0xf1, 0x23, 0xc0, 0x4e, 0x16, 0x6c, 0x61, 0x4f, 0xb7, 0xd6, 0xb3, 0xa0, 
-	0x97, 0xca, 0x70, 0x79, 0x2b, 0x9e, 0x95, 0x49, 0xd8, 0x4d, 0x1d, 0xa3, 0xdb, 
-	0x95, 0x8e, 0x2b, 0xc4, 0x76, 0xf2, 0xc9, 0xda, 0x5d, 0x3a, 0x29, 0xe7, 0xa8, 
-	0xff, 0x0 , 0x3c, 0x56, 0xc , 0xc9, 0x1f, 0xda, 0x99, 0x91, 0x73, 0x33, 0x9e, 
-	0x42, 0x83, 0x81, 0xf8, 0xe , 0xd5, 0x2d, 0x9e, 0xa1, 0x1a, 0xdb, 0xaa, 0x91, 
-	0xbe, 0x26, 0xfe, 0x12, 0xc7, 0x9e, 0xf , 0xe4, 0x6a, 0x6d, 0x39, 0xd8, 0x5c, 
-	0x4d, 0x36, 0x6 , 0xd0, 0xbf, 0x23, 0x6 , 0xf9, 0xbd, 0x71, 0x9f, 0xa0, 0x3d, 
-	0xba, 0xd6, 0x97, 0x20, 0xb3, 0x11, 0x65, 0xb7, 0x56, 0x61, 0xd0, 0x63, 0xf2, 
-	0xa8, 0xbe, 0x56, 0x91, 0x99, 0xf , 0xce, 0x4e, 0x70, 0x6a, 0xcd, 0xf5, 0xc4, 
-	0x73, 0xcc, 0xca, 0x32, 0xbb, 0x4f, 0xe , 0xca, 0x33, 0x20, 0xc0, 0xe4, 0x91, 
-	0xf5, 0xaa, 0xd7, 0xd0, 0xbc, 0x30, 0xee, 0xc8, 0xda, 0xdc, 0xa3, 0x9f, 0x5f, 
-	0x4f, 0xe7, 0x5a, 0x31, 0x19, 0x97, 0x93, 0x8b, 0xbb, 0xbf, 0xb2, 0xc9, 0x84, 
-	0xdb, 0x96, 0x50, 0x3b, 0xfb, 0x7d, 0x6b, 0x95, 0xf8, 0xa1, 0xe1, 0xf1, 0xab, 
-	0xe9, 0xad, 0x2d, 0xbc, 0x79, 0xbd, 0xb5, 0x5d, 0xca, 0x40, 0xe6, 0x41, 0xdd, 
-	0x7f, 0x4f, 0xce, 0xba, 0xf9, 0x34, 0xf4, 0x17, 0x42, 0xe1, 0x89, 0xda, 0x4f, 
-	0xde, 0x1d, 0x47, 0x15, 0x91, 0x75, 0x7a, 0x6 , 0xab, 0xe4, 0x3a, 0xe7, 0x4 , 
-	0xa1, 0x2b, 0xde, 0xb1, 0x65, 0x9e, 0x12, 0x41, 0xc , 0x41, 0x1c, 0x8e, 0xb4, 
-	0x57, 0x5b, 0xf1, 0x53, 0x42, 0xfe, 0xcf, 0xd4, 0x7f, 0xb4, 0x60, 0x50, 0x21, 
-	0xb8, 0x72, 0x24, 0x51, 0xfc, 0x2f, 0xd7, 0xf2, 0x23, 0x9f, 0xce, 0xb9, 0x1e, 
-	0xbd, 0xaa, 0x40, 0x3f, 0x1a, 0x43, 0x45, 0x14, 0x0 , 0x51, 0x9a, 0xd , 0x36, 
-	0x80, 0xa , 0x28, 0x34, 0x99, 0xa0, 0x0 , 0x9a, 0x4a, 0x28, 0xa0, 0x3 , 0xf1, 
-	0xa3, 0xf1, 0xa3, 0xf0, 0xa4, 0x3f, 0x4a, 0x0 , 0xd , 0x25, 0x14, 0x50, 0x2 , 
-	0x66, 0x90, 0xd1, 0x48, 0x4d, 0x0 , 0x2d, 0x34, 0xd2, 0xb5, 0x25, 0x0 , 0x14, 
-	0x7e, 0x34, 0x51, 0xf8, 0x50, 0x1 , 0xf8, 0xd3, 0x5a, 0x94, 0xfd, 0x29, 0x28, 
-	0x0 , 0xa3, 0x34, 0x1a, 0x6d, 0x0 , 0x14, 0x51, 0x48, 0x4d, 0x0 , 0x25, 0x14, 
-	0x51, 0x4c, 0x9 , 0xbf, 0x1a, 0x3f, 0x1a, 0x41, 0xf4, 0xa5, 0xfc, 0x29, 0x80, 
-	0x52, 0x83, 0x49, 0x45, 0x0 , 0x3a, 0x94, 0x1a, 0x68, 0x34, 0xb4, 0x0 , 0xea, 
-	0x29, 0x33, 0x4a, 0x28, 0x1 , 0x73, 0xef, 0x4b, 0xf8, 0xd3, 0x69, 0x47, 0xd2, 
-	0x80, 0x16, 0x8a, 0x28, 0xa0, 0x7 , 0x51, 0x49, 0x9a, 0x51, 0x40, 0xe , 0xcd, 
-	0x14, 0xda, 0x70, 0xa0, 0x5 , 0xcf, 0xbd, 0x2f, 0xe3, 0x4d, 0xa5, 0x1f, 0x4a, 
-	0x0 , 0x5a, 0x28, 0xfc, 0x28, 0xa0, 0x0 , 0x53, 0xa9, 0xb4, 0x66, 0x80, 0x1f, 
-	0x9a, 0x5a, 0x6d, 0x19, 0xa0, 0x7 , 0xa , 0x5c, 0xd2, 0x53, 0x94, 0xaa, 0xa3, 
-	0x3b, 0x1f, 0xbb, 0xd3, 0xdc, 0xd3, 0x49, 0xb7, 0x61, 0x37, 0x64, 0x41, 0x7c, 
-	0xea, 0x1 , 0x8c, 0xc9, 0xb7, 0x68, 0xe0, 0x7b, 0xd6, 0x16, 0xa9, 0x71, 0xfb, 
-	0xb3, 0x82, 0x37, 0x31, 0xc0, 0xc5, 0x5f, 0xd4, 0xde, 0x43, 0x1e, 0x4e, 0x3e, 
-	0x6e, 0xf8, 0xac, 0x8b, 0x74, 0xfb, 0x4d, 0xe8, 0x52, 0x3 , 0xd , 0xd8, 0xc5, 
-	0x6d, 0xe4, 0x4a, 0xd8, 0xd8, 0xd1, 0x53, 0xcb, 0xb2, 0x40, 0x78, 0xdd, 0xc9, 
-	0xcd, 0x5c, 0x65, 0x61, 0x9c, 0xae, 0x0 , 0xf4, 0xa6, 0x31, 0x4e, 0x8a, 0xa3, 
-	0x3d, 0x87, 0xa5, 0x58, 0xb1, 0x75, 0x2c, 0x63, 0x20, 0x7c, 0xca, 0x40, 0xff, 
-	0x0 , 0x3f, 0x9d, 0x59, 0x4 , 0x52, 0x3f, 0x65, 0x18, 0x3 , 0xa5, 0x4d, 0x62, 
-	0x80, 0xc7, 0xe7, 0x31, 0x18, 0xdd, 0x8c, 0x9f, 0x5f, 0x7a, 0x5 , 0xba, 0xc9, 
-	0x1a, 0xba, 0x4b, 0xce, 0x42, 0x95, 0x51, 0xfc, 0xbd, 0x6a, 0x5d, 0x3e, 0x22, 
-	0xd7, 0x2 , 0x30, 0x8c, 0xca, 0xf , 0x2b, 0xeb, 0x8a, 0x5a, 0x81, 0xb9, 0xc , 
-	0xc , 0x63, 0x2 , 0x36, 0x78, 0xc8, 0x3 , 0x3c, 0x64, 0x7e, 0x5f, 0x85, 0x50, 
-	0x9d, 0x15, 0x26, 0x95, 0xb7, 0xee, 0x2a, 0x36, 0x9f, 0xe7, 0x5b, 0x96, 0xf0, 
-	0xef, 0x85, 0xc2, 0x2b, 0x37, 0x38, 0xc2, 0xe7, 0x8e, 0xbc, 0x7b, 0x1a, 0xe7, 
-	0xfc, 0x59, 0x2a, 0xda, 0x68, 0xd3, 0x5c, 0x14, 0x24, 0xcd, 0x29, 0xb , 0xcf, 
-	0x2b, 0x5c, 0x6f, 0x73, 0xa3, 0xa1, 0xcb, 0xea, 0x17, 0x6 , 0xff, 0x0 , 0x5e, 
-	0x62, 0x87, 0x31, 0xc4, 0x3e, 0x5f, 0xad, 0x4c, 0xcd, 0xd1, 0x7d, 0x2a, 0xae, 
-	0x86, 0x98, 0xb5, 0x7b, 0x93, 0xd5, 0xd8, 0xe2, 0xa7, 0x1c, 0xf3, 0x8a, 0xbd, 
-	0x88, 0x64, 0x9c, 0xf9, 0x24, 0xfa, 0xf1, 0x58, 0xcc, 0xff, 0x0 , 0x68, 0xd4, 
-	0x19, 0x47, 0xdd, 0x53, 0xb6, 0xb5, 0xee, 0xdb, 0xca, 0xd3, 0x5e, 0x4f, 0xee, 
-	0xa9, 0x35, 0x8d, 0xe1, 0xf1, 0x96, 0xdc, 0x7a, 0xe7, 0x26, 0xa3, 0x79, 0x17, 
-	0xb2, 0x37, 0xa1, 0xc2, 0xc6, 0x11, 0x7a, 0x1 , 0x59, 0xba, 0xcb, 0x19, 0xa6, 
-	0x58, 0xf3, 0xc0, 0xed, 0x5a, 0x10, 0xf2, 0x8c, 0x47, 0xa5, 0x66, 0x46, 0x44, 
-	0x97, 0xcc, 0x7f, 0xba, 0x70, 0x29, 0xcb, 0x57, 0x62, 0x63, 0xb0, 0x24, 0xa , 
-	0x91, 0x8e, 0x3f, 0x2a, 0x56, 0xc8, 0xe9, 0x53, 0xcc, 0x73, 0xc5, 0x46, 0xc2, 
-	0xb4, 0x48, 0x93, 0x72, 0xd7, 0x8b, 0x74, 0xff, 0x0 , 0x74, 0x7f, 0x2a, 0x95, 
-	0x4d, 0x47, 0x7 , 0xfa, 0x94, 0xff, 0x0 , 0x74, 0x53, 0xb3, 0x59, 0xb2, 0xd1, 
-	0x26, 0x69, 0xb2, 0x36, 0x6 , 0x73, 0x45, 0x55, 0xd5, 0x27, 0x10, 0xdb, 0xb3, 
-	0x93, 0xd0, 0x66, 0xb3, 0x63, 0x39, 0xaf, 0x14, 0x5d, 0xb4, 0xfa, 0x8f, 0x96, 
-	0xbc, 0xec, 0xe0, 0xf , 0x7a, 0xbf, 0xa1, 0xd9, 0x7 , 0x55, 0xdf, 0xf7, 0x17, 
-	0xaf, 0xfb, 0x46, 0xb0, 0xec, 0x73, 0x73, 0xa9, 0x19, 0xf , 0x76, 0x2d, 0x5d, 
-	0x9d, 0x84, 0x22, 0x2b, 0x75, 0x18, 0xe4, 0x8e, 0x6a, 0xa1, 0x1e, 0xa3, 0x9c, 
-	0x9d, 0x94, 0x4b, 0xb6, 0x72, 0x43, 0x6 , 0xd1, 0xe5, 0x92, 0x7 , 0x61, 0xc0, 
-	0xad, 0xab, 0x7d, 0x7a, 0xdd, 0x62, 0xc4, 0x91, 0x14, 0x3d, 0x87, 0xad, 0x73, 
-	0xd2, 0x30, 0x4c, 0x77, 0x27, 0xa0, 0xf5, 0xa6, 0xa8, 0xcb, 0x65, 0xb9, 0x3f, 
-	0xca, 0xb4, 0x52, 0x6b, 0x62, 0x39, 0x53, 0x37, 0x75, 0x21, 0x67, 0xad, 0x5a, 
-	0x94, 0x92, 0x25, 0x7 , 0x3c, 0x37, 0x75, 0xe3, 0xad, 0x70, 0x7a, 0x94, 0x53, 
-	0x59, 0x5f, 0x49, 0x6a, 0xf1, 0x3b, 0xc9, 0x19, 0xfe, 0x11, 0xc6, 0x3d, 0x73, 
-	0xd2, 0xbb, 0xcd, 0x3e, 0x34, 0x86, 0xd1, 0x42, 0x72, 0x58, 0x64, 0x93, 0x58, 
-	0x7f, 0x11, 0xad, 0x1a, 0xb , 0xeb, 0x79, 0x18, 0x7f, 0xad, 0x84, 0x37, 0xe0, 
-	0x40, 0x23, 0xff, 0x0 , 0x42, 0xac, 0xa4, 0xee, 0xc6, 0x95, 0x91, 0x93, 0x6f, 
-	0x24, 0xf3, 0x42, 0x80, 0xc3, 0x1a, 0xec, 0x5c, 0x7c, 0xaf, 0x92, 0x7a, 0xf5, 
-	0xc7, 0xd6, 0xb3, 0xb5, 0x8 , 0xd9, 0x2e, 0x59, 0x8a, 0x32, 0xab, 0x1e, 0xb8, 
-	0xe2, 0x8b, 0xcb, 0x9f, 0xb2, 0x2a, 0x4b, 0x86, 0x3b, 0x98, 0x8e, 0xe , 0xd , 
-	0x5e, 0xb2, 0xbd, 0x82, 0xf6, 0x12, 0x77, 0x80, 0x88, 0x3e, 0x72, 0xe9, 0xfc, 
-	0xfd, 0x6a, 0x27, 0x1b, 0x9b, 0xd0, 0xac, 0xe9, 0xca, 0xf6, 0x33, 0x7 , 0x34, 
-	0x63, 0xde, 0xaf, 0xbe, 0x9b, 0x23, 0x3b, 0x18, 0xe7, 0xb7, 0x6f, 0xe2, 0xa , 
-	0x1c, 0xae, 0x7 , 0xe2, 0x2a, 0x33, 0xa7, 0x5e, 0x71, 0x8b, 0x72, 0xd9, 0xe9, 
-	0xb0, 0x86, 0xfe, 0x55, 0x8b, 0x4c, 0xf6, 0x63, 0x5a, 0x9b, 0x5f, 0x12, 0x2b, 
-	0x7e, 0x34, 0x54, 0x93, 0x41, 0x34, 0x3f, 0xeb, 0x62, 0x74, 0xe7, 0x8d, 0xc8, 
-	0x47, 0xf3, 0xa6, 0x1 , 0x52, 0x6e, 0xb5, 0x15, 0x45, 0x39, 0x45, 0x18, 0xa5, 
-	0x5a, 0xb , 0x45, 0xbb, 0x45, 0xcc, 0x78, 0xa5, 0x91, 0x76, 0x82, 0xd , 0x25, 
-	0xa3, 0x62, 0x9d, 0x74, 0xd9, 0x5e, 0x2b, 0x4d, 0x39, 0x48, 0x4b, 0xde, 0x21, 
-	0x84, 0x80, 0xe4, 0x1e, 0x8d, 0x55, 0x3c, 0x45, 0x69, 0xe7, 0x5a, 0xf9, 0xca, 
-	0x3f, 0x79, 0xf , 0xde, 0xff, 0x0 , 0x77, 0xbd, 0x58, 0x1c, 0x9e, 0x6a, 0xc4, 
-	0x6d, 0xbd, 0x79, 0x1e, 0xcd, 0x59, 0x5f, 0xa9, 0xd5, 0x2a, 0x71, 0xab, 0x7 , 
-	0x4e, 0x5b, 0x33, 0x90, 0xa7, 0x46, 0xc5, 0x58, 0x32, 0x9e, 0x95, 0x67, 0x5a, 
-	0xb3, 0x36, 0x97, 0x84, 0x28, 0xfd, 0xdb, 0xf2, 0x87, 0xfa, 0x55, 0x68, 0xc8, 
-	0xe9, 0xeb, 0x5b, 0xc7, 0x53, 0xe5, 0x6a, 0x42, 0x54, 0xaa, 0x38, 0xcb, 0x74, 
-	0x6f, 0x69, 0xb3, 0x89, 0x62, 0x1e, 0xb5, 0xa9, 0x18, 0x26, 0x30, 0xd8, 0xfd, 
-	0x6b, 0x95, 0xd3, 0xe7, 0x30, 0x4d, 0xd7, 0x2b, 0x9a, 0xe9, 0x34, 0xc9, 0xd5, 
-	0xd7, 0x69, 0xe8, 0xc3, 0x8a, 0xc9, 0xc6, 0xcc, 0xf7, 0xf0, 0x78, 0x95, 0x56, 
-	0x9f, 0x9a, 0x27, 0xb5, 0x7 , 0xcd, 0xe9, 0x9a, 0xb9, 0x33, 0x0 , 0xb8, 0xdb, 
-	0x55, 0xed, 0x97, 0x33, 0x31, 0x6 , 0xa7, 0x68, 0xf7, 0xb1, 0xf4, 0x14, 0xd2, 
-	0xd0, 0xeb, 0x94, 0x95, 0xc8, 0x95, 0x99, 0x8f, 0x0 , 0xe3, 0xb6, 0x6a, 0x65, 
-	0x2a, 0xab, 0xf3, 0x6 , 0x5e, 0x3b, 0x8a, 0x15, 0x51, 0x29, 0x24, 0x90, 0x6d, 
-	0x35, 0x5b, 0x12, 0xf5, 0x24, 0x67, 0x1e, 0xff, 0x0 , 0x91, 0xa6, 0xf9, 0x83, 
-	0xd4, 0xd4, 0xd , 0x27, 0xa1, 0xc0, 0xa6, 0x79, 0x9f, 0xe7, 0x35, 0x3c, 0xc5, 
-	0x28, 0x96, 0x3c, 0xd5, 0xf5, 0xa1, 0x64, 0x1b, 0xf3, 0x9e, 0x82, 0xab, 0x6e, 
-	0x34, 0x82, 0x4c, 0x1a, 0x39, 0x8a, 0xe5, 0x2e, 0x79, 0xab, 0xfd, 0xe1, 0xf9, 
-	0xd2, 0xab, 0xae, 0x79, 0x61, 0xf4, 0xcf, 0x4a, 0xa8, 0xb2, 0x7a, 0xff, 0x0 , 
-	0x3a, 0x77, 0x9b, 0x92, 0x14, 0x1f, 0xa9, 0xa3, 0x98, 0x9e, 0x42, 0xd3, 0x11, 
-	0xd7, 0xf8, 0x45, 0x46, 0xcb, 0x9c, 0x92, 0x3f, 0xf , 0x4a, 0x23, 0x60, 0xdf, 
-	0x87, 0x4a, 0x94, 0x80, 0x56, 0xab, 0x72, 0x6f, 0x62, 0x84, 0x89, 0x8c, 0xd4, 
-	0x4c, 0x8 , 0x35, 0x76, 0x44, 0x24, 0xf , 0xa5, 0x56, 0x99, 0x48, 0xeb, 0x59, 
-	0xc9, 0x1d, 0x10, 0x90, 0xfb, 0x73, 0x97, 0xe2, 0xb4, 0x2d, 0x53, 0xe5, 0xe6, 
-	0xa8, 0xd9, 0x29, 0x23, 0x78, 0xed, 0x56, 0xda, 0x75, 0x48, 0x5b, 0x7 , 0x6 , 
-	0xaa, 0x3a, 0x23, 0x3a, 0x97, 0x6e, 0xc8, 0x82, 0xf9, 0xc3, 0x49, 0xb4, 0x1e, 
-	0x17, 0xf5, 0xaa, 0x33, 0xcc, 0x22, 0x42, 0xce, 0x71, 0xeb, 0xed, 0x4b, 0x71, 
-	0x30, 0x19, 0x62, 0x70, 0x5 , 0x62, 0x5c, 0x4c, 0xd7, 0xf3, 0x60, 0x12, 0x2d, 
-	0xd0, 0xf3, 0xfe, 0xdd, 0x45, 0xb9, 0x99, 0x18, 0x8c, 0x54, 0x70, 0xd4, 0xfc, 
-	0xfb, 0x10, 0xea, 0x53, 0x4d, 0x78, 0xdb, 0xd5, 0x71, 0x2 , 0x9e, 0x32, 0x71, 
-	0xb8, 0xd4, 0x52, 0x5c, 0x85, 0x8f, 0x6a, 0x64, 0x60, 0x63, 0x19, 0xe9, 0x53, 
-	0x6a, 0xf , 0x12, 0xc5, 0xb4, 0x36, 0x3d, 0x0 , 0xfe, 0x95, 0x53, 0x4f, 0xb5, 
-	0x7b, 0xa9, 0xf6, 0x80, 0x76, 0x83, 0xf3, 0x1a, 0xdb, 0x44, 0x8f, 0x98, 0x6e, 
-	0xa6, 0x22, 0xaf, 0x76, 0xcb, 0x1a, 0x35, 0x9b, 0x5d, 0x4f, 0xe6, 0xc8, 0x32, 
-	0xa0, 0xfe, 0x66, 0xba, 0x68, 0xd0, 0x43, 0x1e, 0xc0, 0x39, 0xef, 0xed, 0x51, 
-	0xd9, 0xc0, 0x96, 0xf0, 0x2e, 0x14, 0xe , 0x3e, 0x50, 0x3f, 0x9d, 0x49, 0xd7, 
-	0x93, 0x58, 0x49, 0xdc, 0xfa, 0x9c, 0xe , 0x16, 0x38, 0x7a, 0x76, 0xeb, 0xd4, 
-	0x72, 0x9e, 0x69, 0xd , 0x25, 0x2a, 0x9c, 0xfc, 0xa7, 0xf0, 0xa9, 0x3b, 0xae, 
-	0x28, 0x35, 0x2a, 0x90, 0x3a, 0xd4, 0x38, 0xa5, 0x24, 0xd0, 0x27, 0xa9, 0x39, 
-	0x96, 0x98, 0xd2, 0x1a, 0x8c, 0x93, 0x4d, 0xa7, 0x71, 0x72, 0xa4, 0x3c, 0x48, 
-	0xd4, 0xf1, 0x2b, 0x7a, 0xd4, 0x34, 0x52, 0x1d, 0x91, 0x23, 0x4c, 0xe7, 0xbd, 
-	0x31, 0x98, 0xb7, 0x53, 0x48, 0x6a, 0x1b, 0xab, 0x84, 0xb7, 0x84, 0xc9, 0x21, 
-	0xe3, 0xb0, 0xf5, 0xa1, 0x6a, 0x4c, 0xa5, 0x18, 0x27, 0x27, 0xa2, 0x42, 0x68, 
-	0xc , 0xcf, 0xe2, 0xe7, 0xd8, 0xc8, 0x36, 0xc5, 0xfc, 0x75, 0xd6, 0xe2, 0x46, 
-	0xe1, 0xac, 0xe1, 0x93, 0xde, 0x32, 0x33, 0xff, 0x0 , 0x8e, 0x90, 0x6a, 0x87, 
-	0x83, 0x34, 0xd , 0x32, 0x78, 0xdb, 0x53, 0xbd, 0xd5, 0xe0, 0xb1, 0x91, 0x8e, 
-	0x36, 0xcb, 0xe6, 0x33, 0x11, 0x8f, 0xe1, 0x55, 0x53, 0xfa, 0xd6, 0xf2, 0x7f, 
-	0xc2, 0x29, 0x6c, 0x48, 0x96, 0xe3, 0x52, 0xbe, 0x23, 0xa0, 0x8a, 0x25, 0x85, 
-	0x4f, 0xe2, 0xc4, 0x9f, 0xfc, 0x74, 0x57, 0x5a, 0x8d, 0x92, 0x3e, 0x2f, 0x11, 
-	0x51, 0x54, 0xad, 0x29, 0x2e, 0xac, 0xcc, 0xcd, 0xb2, 0xb6, 0xd6, 0x4b, 0x88, 
-	0x5b, 0xb8, 0xdd, 0xd3, 0xf0, 0x22, 0xa5, 0x43, 0x36, 0xdf, 0x92, 0xe8, 0x32, 
-	0xff, 0x0 , 0x76, 0x44, 0x23, 0xfc, 0x45, 0x6a, 0xdb, 0x5e, 0x5a, 0x4a, 0xdf, 
-	0xf1, 0x2c, 0xf0, 0xb4, 0x6e, 0xb9, 0xfb, 0xf7, 0x77, 0x2e, 0xff, 0x0 , 0xfa, 
-	0xe , 0xc1, 0x5a, 0x49, 0x27, 0x89, 0x1a, 0x3c, 0xd9, 0xe9, 0x7a, 0x24, 0x23, 
-	0xb0, 0x4b, 0x48, 0xd8, 0xfe, 0x6f, 0x9f, 0xe7, 0x55, 0xca, 0x99, 0x85, 0xce, 
-	0x56, 0x1d, 0xad, 0x70, 0xa6, 0xe6, 0xcf, 0x80, 0xc3, 0x25, 0x3e, 0x53, 0x8f, 
-	0xc3, 0x8f, 0xd2, 0xa2, 0x92, 0x37, 0x5d, 0xcc, 0x90, 0xb3, 0x12, 0x49, 0xad, 
-	0xdd, 0x4f, 0x55, 0xf1, 0x6d, 0x99, 0xff, 0x0 , 0x49, 0x7f, 0xb3, 0xaf, 0x63, 
-	0x1d, 0xac, 0x48, 0xbf, 0x81, 0x55, 0xac, 0xcb, 0xcd, 0x67, 0x57, 0xbb, 0x84, 
-	0xc3, 0x75, 0x7f, 0x34, 0xd1, 0x93, 0x9d, 0xac, 0x78, 0xc8, 0xe9, 0x51, 0x2a, 
-	0x71, 0x96, 0xe7, 0x46, 0x1f, 0x13, 0x3a, 0x37, 0xe5, 0xb6, 0xa6, 0x2c, 0xd2, 
-	0xbc, 0x99, 0x27, 0xf2, 0xaa, 0xb7, 0x8c, 0x5d, 0x57, 0x70, 0xed, 0x8a, 0xd0, 
-	0x95, 0x57, 0xcc, 0xe1, 0x47, 0xcd, 0xcd, 0x54, 0xd4, 0xa3, 0xdb, 0x1e, 0x41, 
-	0xe7, 0x35, 0xcc, 0xd5, 0x9d, 0x8f, 0xa6, 0xc3, 0xd6, 0x8d, 0x48, 0xc6, 0x4b, 
-	0xa9, 0x81, 0xa6, 0x7c, 0x91, 0xbc, 0x7f, 0xf3, 0xcd, 0xca, 0xff, 0x0 , 0x9f, 
-	0xca, 0xae, 0x46, 0x6a, 0xae, 0x3c, 0xbd, 0x46, 0x61, 0xd9, 0xb0, 0xd5, 0x3a, 
-	0x9a, 0xa6, 0x4d, 0x1f, 0x76, 0x3c, 0xbd, 0x89, 0xf , 0x15, 0x97, 0xac, 0xf , 
-	0x97, 0xf1, 0xad, 0x3c, 0xd5, 0xd , 0x51, 0x77, 0x46, 0x69, 0xc7, 0x73, 0x3c, 
-	0x62, 0xe6, 0xa2, 0xd0, 0x68, 0x37, 0xc , 0x9b, 0x8 , 0x6c, 0x18, 0xcf, 0xf2, 
-	0xe4, 0x57, 0xa8, 0x78, 0x47, 0x55, 0xdd, 0x63, 0x1c, 0x80, 0x6e, 0x8e, 0xde, 
-	0x21, 0xe7, 0x2f, 0x6f, 0x2c, 0x1d, 0xa7, 0xa , 0x7a, 0xe3, 0x83, 0xc6, 0x3e, 
-	0xf6, 0x6b, 0xc8, 0x2c, 0xe5, 0x31, 0x4d, 0xec, 0xdd, 0x6b, 0xaa, 0xf0, 0xa6, 
-	0xa8, 0x6c, 0x35, 0x18, 0xe6, 0x33, 0x32, 0x80, 0x18, 0x70, 0x32, 0x39, 0x18, 
-	0xe4, 0x71, 0x9e, 0x83, 0xbd, 0x76, 0x7c, 0x50, 0x3e, 0x69, 0xe8, 0xcf, 0x46, 
-	0xd4, 0xed, 0xe6, 0xba, 0x55, 0x8e, 0xd5, 0x92, 0x3d, 0xb8, 0x78, 0xb6, 0x93, 
-	0x97, 0x0 , 0x74, 0x50, 0x78, 0x20, 0xe0, 0x7d, 0xe , 0xf , 0x7a, 0xe6, 0xad, 
-	0xf7, 0xa4, 0xac, 0x92, 0xc5, 0x36, 0x77, 0xee, 0xa , 0xeb, 0x8c, 0xfa, 0x8e, 
-	0x99, 0x61, 0x9f, 0x6e, 0xf5, 0xd1, 0x49, 0x76, 0x3c, 0xb1, 0x33, 0x43, 0xd , 
-	0xc6, 0xd6, 0x57, 0x28, 0xa3, 0x69, 0xc6, 0x1 , 0x38, 0xdc, 0xf , 0x50, 0xc4, 
-	0xf5, 0xec, 0x2a, 0x9d, 0xd5, 0xa4, 0x3e, 0x44, 0x31, 0xc3, 0x78, 0xd1, 0xae, 
-	0xa , 0xc7, 0x1b, 0x21, 0x62, 0xe , 0x41, 0x0 , 0x31, 0x3 , 0x91, 0x8c, 0x7e, 
-	0x18, 0xac, 0xca, 0x32, 0x75, 0x9f, 0xf , 0xda, 0xeb, 0x8a, 0xd7, 0x36, 0xca, 
-	0xd6, 0xf7, 0x1 , 0x40, 0xd , 0xb7, 0x1b, 0x8f, 0xd3, 0xfa, 0xfa, 0x57, 0x1b, 
-	0xf6, 0x7b, 0xbd, 0x32, 0x43, 0x5 , 0xca, 0x62, 0x45, 0x63, 0xb8, 0x71, 0x86, 
-	0xed, 0x5e, 0x89, 0x6e, 0xcf, 0x1c, 0xca, 0x8a, 0xb7, 0x4a, 0xdb, 0x7e, 0x51, 
-	0xa , 0x28, 0xe , 0x7b, 0xed, 0x6c, 0xf1, 0xcf, 0x6a, 0x4d, 0x5a, 0xd2, 0xde, 
-	0xfe, 0xd4, 0x5b, 0x5e, 0xdb, 0xaa, 0xec, 0xe7, 0x77, 0xdd, 0x61, 0x9e, 0xe4, 
-	0xfa, 0xd2, 0x25, 0xa3, 0x89, 0xd1, 0x75, 0x2 , 0xd1, 0xfd, 0x9e, 0xe1, 0xfc, 
-	0xc8, 0x91, 0xb6, 0x82, 0xdd, 0x40, 0xf4, 0xad, 0xed, 0xf , 0x50, 0xba, 0xd3, 
-	0x6e, 0x9a, 0x7d, 0x1e, 0x69, 0x24, 0x8d, 0x3e, 0x67, 0x46, 0x7 , 0x6e, 0x2b, 
-	0x1b, 0x5d, 0xd1, 0x2e, 0x6c, 0x81, 0x68, 0x8 , 0x92, 0x16, 0x38, 0x12, 0x1 , 
-	0xd3, 0xfd, 0xea, 0x87, 0x4c, 0x33, 0x5b, 0x6 , 0x66, 0xe1, 0xb6, 0xed, 0x20, 
-	0x1e, 0x31, 0xe8, 0x6a, 0x94, 0x99, 0x36, 0x3d, 0x6f, 0xc2, 0x9e, 0x2e, 0xb3, 
-	0xd5, 0x7e, 0x59, 0x9b, 0xcb, 0xb9, 0xcf, 0x28, 0xc7, 0x1f, 0x95, 0x76, 0xba, 
-	0x5d, 0xee, 0x63, 0x1f, 0x39, 0x6c, 0x9c, 0x3 , 0x9e, 0x71, 0x5e, 0xf , 0x2 , 
-	0xda, 0xcc, 0x4 , 0xaa, 0x4c, 0x73, 0x28, 0x19, 0xdb, 0xc1, 0xcf, 0xaf, 0x5a, 
-	0xe9, 0x7c, 0x39, 0xe2, 0xbb, 0xdd, 0x35, 0x92, 0x3b, 0xe0, 0xd2, 0xc6, 0xa4, 
-	0x6d, 0x94, 0x76, 0xff, 0x0 , 0x7a, 0xab, 0x47, 0xb0, 0x1e, 0xcd, 0x6f, 0x72, 
-	0x5a, 0xea, 0x34, 0x2f, 0xf3, 0x7f, 0xcb, 0x2e, 0x47, 0xe4, 0x4d, 0x5d, 0x6d, 
-	0x45, 0xa5, 0x9a, 0x18, 0x51, 0x7e, 0x68, 0xd8, 0x9c, 0x44, 0x36, 0x8c, 0xe3, 
-	0xd8, 0xf3, 0x5c, 0xae, 0x8b, 0xa9, 0x41, 0x79, 0x62, 0x93, 0x89, 0xc3, 0xab, 
-	0x8f, 0xbc, 0xf , 0x3 , 0x8e, 0x31, 0x5a, 0xb6, 0x64, 0x47, 0xfb, 0xdd, 0xa1, 
-	0x51, 0x42, 0x9d, 0xdb, 0x88, 0x32, 0x8e, 0xa7, 0x1e, 0xde, 0xf4, 0x8 , 0xdf, 
-	0x96, 0xfa, 0xc2, 0x53, 0x24, 0xf7, 0xc4, 0xdc, 0x46, 0xe1, 0x71, 0xb1, 0x47, 
-	0xc8, 0x71, 0x83, 0xc7, 0x1c, 0xf3, 0x5c, 0xcd, 0xf5, 0x98, 0x50, 0x65, 0x8a, 
-	0x4d, 0xf1, 0xaf, 0x46, 0x3 , 0xaf, 0xb7, 0xd6, 0xae, 0xeb, 0x37, 0x10, 0x4b, 
-	0x7a, 0xb2, 0x42, 0x82, 0x38, 0x88, 0xdc, 0xdb, 0x46, 0x17, 0x76, 0x3f, 0xc7, 
-	0x14, 0x9a, 0xbd, 0xfd, 0xb2, 0xe9, 0x3e, 0x40, 0x89, 0x1a, 0x44, 0x50, 0x23, 
-	0x95, 0x49, 0x5e, 0x49, 0xe7, 0x23, 0xa7, 0x7a, 0x62, 0x31, 0x63, 0x96, 0x48, 
-	0xd8, 0x5 , 0x47, 0xe9, 0xf3, 0x7b, 0x56, 0xe6, 0x95, 0x73, 0x1a, 0xd9, 0x85, 
-	0x42, 0xa1, 0xf3, 0xf2, 0xee, 0xe9, 0xd7, 0xb7, 0xa1, 0xff, 0x0 , 0x1a, 0xc4, 
-	0xbe, 0x8e, 0xe2, 0xda, 0x70, 0x2e, 0x11, 0x95, 0x99, 0x43, 0xc , 0x37, 0x51, 
-	0xea, 0x2b, 0xf , 0xc6, 0x5a, 0xb3, 0x69, 0x5a, 0xd , 0xc5, 0xda, 0x49, 0xb1, 
-	0x95, 0x72, 0x70, 0x7a, 0x7b, 0xd5, 0x29, 0x58, 0x4d, 0x5c, 0xed, 0x1b, 0x59, 
-	0xd3, 0x56, 0xeb, 0xc8, 0xfb, 0x5c, 0x51, 0xca, 0xdf, 0x32, 0x33, 0x1e, 0x84, 
-	0x67, 0xe5, 0xcf, 0xe9, 0x57, 0xa3, 0x9e, 0x19, 0x97, 0x2c, 0xf8, 0xe9, 0x85, 
-	0x3f, 0x77, 0xdc, 0xd7, 0xcb, 0x17, 0x5e, 0x3a, 0xbb, 0xb9, 0x91, 0x98, 0xc7, 
-	0x2b, 0x28, 0x6c, 0xb4, 0x9b, 0x8f, 0x1d, 0xb2, 0x47, 0x6a, 0xf5, 0x4f, 0x84, 
-	0x9e, 0x37, 0x5b, 0x8f, 0x2f, 0x4e, 0xbc, 0x97, 0xce, 0x8f, 0x3f, 0x24, 0xbb, 
-	0xf9, 0x1e, 0xa3, 0xaf, 0x4a, 0xa8, 0xd4, 0xd4, 0x4e, 0x27, 0xa8, 0x87, 0xdb, 
-	0xb , 0x2b, 0xf0, 0xb8, 0x24, 0x71, 0xd4, 0xfa, 0x56, 0x47, 0xd9, 0x61, 0x4d, 
-	0x4d, 0x6e, 0xb9, 0xc1, 0x24, 0x9e, 0xe3, 0xd0, 0xff, 0x0 , 0x3a, 0xb9, 0x7d, 
-	0x72, 0xe , 0x17, 0x62, 0xc7, 0x93, 0x9e, 0x3b, 0xfa, 0x55, 0x7d, 0xe1, 0x77, 
-	0xa3, 0x8c, 0x67, 0xa7, 0xe3, 0x55, 0x22, 0x51, 0x9d, 0xe3, 0xd , 0x3e, 0xde, 
-	0xf7, 0x4f, 0x92, 0x19, 0x3e, 0x68, 0xe4, 0x4d, 0xae, 0xca, 0x3b, 0x1e, 0x87, 
-	0xea, 0xd , 0x78, 0xb6, 0xb5, 0x63, 0x36, 0x9b, 0xa9, 0x4b, 0x67, 0x38, 0xf9, 
-	0xa3, 0x6e, 0x1b, 0x1c, 0x30, 0xec, 0x47, 0xb1, 0x15, 0xee, 0xb1, 0xfc, 0xdb, 
-	0xa3, 0x6c, 0x15, 0xe4, 0x8c, 0xf7, 0xf6, 0xae, 0x27, 0xe2, 0xd6, 0x83, 0xe6, 
-	0xd8, 0xad, 0xf4, 0x2b, 0x99, 0x2d, 0x81, 0xed, 0xcb, 0x47, 0xe9, 0xf8, 0x73, 
-	0x52, 0x51, 0xe6, 0xd4, 0x99, 0xa4, 0xcd, 0x15, 0x20, 0x14, 0x99, 0xa1, 0xa9, 
-	0x28, 0x0 , 0xa2, 0x8a, 0x3f, 0xa , 0x0 , 0x3f, 0x1a, 0x4c, 0xfb, 0xd2, 0xfe, 
-	0x14, 0xd3, 0x40, 0xa , 0x69, 0x28, 0xa4, 0x26, 0x80, 0xc , 0xd2, 0x1a, 0x28, 
-	0xa0, 0x2 , 0x9a, 0x68, 0xcd, 0x14, 0x0 , 0x51, 0xf8, 0xd1, 0xf8, 0x51, 0xf8, 
-	0x50, 0x1 , 0xf8, 0xd2, 0x67, 0xde, 0x83, 0xf4, 0xa4, 0xa0, 0x2 , 0x8c, 0xd0, 
-	0x69, 0xb4, 0x0 , 0x51, 0x45, 0x21, 0x34, 0x0 , 0x13, 0x49, 0x45, 0x14, 0xc0, 
-	0x28, 0xfc, 0x68, 0xfc, 0x28, 0xfc, 0x29, 0xd8, 0x9 , 0x5 , 0x2f, 0xe3, 0x49, 
-	0x45, 0x0 , 0x3b, 0xf1, 0xa3, 0xf1, 0xa3, 0xf0, 0xa3, 0xf0, 0xa0, 0x2 , 0x94, 
-	0x1a, 0x4a, 0x28, 0x1 , 0xd4, 0xa0, 0xd3, 0x41, 0xa5, 0xa0, 0x7 , 0x66, 0x8a, 
-	0x6d, 0x38, 0x50, 0x2 , 0xe7, 0xde, 0x97, 0xf1, 0xa6, 0xd2, 0x8f, 0xa5, 0x0 , 
-	0x2d, 0x14, 0x7e, 0x14, 0x50, 0x3 , 0xb3, 0x45, 0x36, 0x9c, 0x28, 0x1 , 0x73, 
-	0x4b, 0x4d, 0xa3, 0x34, 0x0 , 0xe1, 0x4b, 0xf8, 0xd2, 0x51, 0x40, 0xe , 0xfc, 
-	0x68, 0xa3, 0xf0, 0xa3, 0xf0, 0xa0, 0x0 , 0x52, 0xe6, 0x92, 0x8a, 0x0 , 0x75, 
-	0x57, 0xbe, 0x91, 0x82, 0xec, 0x50, 0xe , 0x3a, 0xe6, 0xa5, 0x92, 0x40, 0x88, 
-	0x58, 0xf6, 0xac, 0xab, 0xb9, 0xce, 0x49, 0x3d, 0xcf, 0x35, 0xa5, 0x35, 0xd4, 
-	0x99, 0x15, 0xf5, 0x8b, 0xbf, 0xdc, 0x1f, 0xef, 0x1e, 0x0 , 0xa7, 0x78, 0x5e, 
-	0x31, 0xb6, 0x49, 0x7f, 0xba, 0x31, 0xf8, 0xf7, 0xac, 0xcb, 0xc9, 0x3c, 0xe9, 
-	0x8b, 0x8f, 0xba, 0xbc, 0xf , 0x7a, 0xdd, 0xd0, 0x50, 0x26, 0x96, 0x87, 0xbb, 
-	0x92, 0x4f, 0xe7, 0x4e, 0x2e, 0xf2, 0x14, 0xb6, 0x2c, 0x64, 0xf5, 0x6 , 0x9e, 
-	0xa4, 0x34, 0x44, 0x67, 0xa3, 0x76, 0xea, 0x29, 0x9b, 0x58, 0x73, 0xc6, 0xdf, 
-	0x5c, 0xd2, 0x29, 0xc7, 0x23, 0xbd, 0x59, 0x5 , 0xbb, 0x30, 0xef, 0x20, 0xc , 
-	0x70, 0x54, 0xe7, 0x2a, 0x7d, 0x3a, 0x71, 0x56, 0xad, 0x63, 0x75, 0xba, 0x86, 
-	0x65, 0xda, 0xcb, 0xe6, 0x6e, 0xc8, 0x38, 0x24, 0x7a, 0x56, 0x67, 0x98, 0xdf, 
-	0xc2, 0xdc, 0x9e, 0x9c, 0xd5, 0xcf, 0xd , 0x3c, 0x8b, 0xaa, 0x2 , 0xef, 0xb5, 
-	0x57, 0xe6, 0x61, 0xbf, 0x19, 0xe4, 0x74, 0xf5, 0x3d, 0x29, 0xcb, 0x62, 0x96, 
-	0xe7, 0x77, 0xa5, 0xc9, 0x12, 0xda, 0x92, 0xb3, 0x86, 0xde, 0x77, 0x2e, 0xe0, 
-	0x40, 0x39, 0xed, 0xc7, 0xa1, 0x1d, 0xd , 0x79, 0xd7, 0xc4, 0x89, 0x1e, 0x4b, 
-	0x58, 0x22, 0x13, 0x72, 0xf2, 0x12, 0x15, 0x7b, 0x83, 0xeb, 0xf9, 0xd7, 0x67, 
-	0xe6, 0x42, 0x21, 0x69, 0x22, 0xf2, 0xd5, 0x87, 0xf7, 0x5b, 0xef, 0x1f, 0x52, 
-	0x2b, 0xce, 0xb5, 0xc9, 0xfe, 0xdd, 0xe2, 0x68, 0x54, 0x36, 0x56, 0x14, 0xc9, 
-	0xcf, 0x6e, 0x7f, 0xfa, 0xf5, 0xc7, 0xd4, 0xd8, 0xb0, 0x54, 0x43, 0x6b, 0x14, 
-	0x3 , 0xf8, 0x57, 0x9a, 0x8f, 0x34, 0x48, 0xfb, 0x9c, 0x9a, 0x6e, 0x6b, 0x44, 
-	0x40, 0xfd, 0x74, 0xed, 0xd0, 0x64, 0x3f, 0xec, 0xe2, 0xb2, 0xbc, 0x3f, 0xfe, 
-	0xac, 0xd6, 0xae, 0xbc, 0x33, 0xe1, 0xe9, 0x3e, 0x83, 0xf9, 0xd6, 0x36, 0x80, 
-	0xd8, 0xdc, 0x2b, 0x38, 0xfc, 0x65, 0x3d, 0x8d, 0xf8, 0xcf, 0xfc, 0x4b, 0xe4, 
-	0x7f, 0xee, 0xd6, 0x4e, 0x9c, 0x73, 0xb9, 0xbd, 0x6b, 0x56, 0xcc, 0xf9, 0x96, 
-	0x53, 0x47, 0xdf, 0x15, 0x8d, 0xa7, 0x3e, 0xb , 0x27, 0xf7, 0x49, 0xa7, 0xf6, 
-	0x85, 0xd0, 0xb7, 0x23, 0x65, 0xa9, 0x8c, 0x69, 0x92, 0x37, 0xcd, 0x42, 0x9c, 
-	0xe2, 0xb7, 0x44, 0x9d, 0x4 , 0x4d, 0xfb, 0xb5, 0x1e, 0xd4, 0xf5, 0x35, 0x4 , 
-	0x67, 0xe5, 0x5f, 0xa5, 0x48, 0xad, 0x59, 0x32, 0xd1, 0x21, 0x60, 0x6 , 0x6b, 
-	0x3 , 0xc5, 0xb7, 0x5b, 0x6d, 0x4c, 0x60, 0xf2, 0xc7, 0x15, 0xad, 0x75, 0x30, 
-	0x55, 0x3f, 0x4a, 0xe5, 0x3c, 0x45, 0x29, 0x92, 0xe0, 0xc , 0xf4, 0xac, 0xde, 
-	0xc3, 0x25, 0xf0, 0xbc, 0x40, 0xcc, 0xa4, 0xff, 0x0 , 0x13, 0x1 , 0xfa, 0xd7, 
-	0x5d, 0x23, 0x5 , 0x18, 0xea, 0x4f, 0x41, 0x5c, 0x9e, 0x8e, 0x4c, 0x77, 0x11, 
-	0xa2, 0x8f, 0x98, 0x5 , 0xfc, 0xf3, 0x5d, 0x4a, 0x2e, 0x39, 0x27, 0x2d, 0xdc, 
-	0xd5, 0x74, 0x44, 0xee, 0xd8, 0xaa, 0xf , 0x53, 0xc9, 0x35, 0x2a, 0xe , 0x7d, 
-	0xe9, 0x23, 0x18, 0xe0, 0xd4, 0x90, 0x81, 0xe6, 0x64, 0xf6, 0xa0, 0xd , 0x88, 
-	0xe4, 0x45, 0x8d, 0x0 , 0x27, 0xe5, 0x50, 0x3f, 0x1c, 0x57, 0x3f, 0xe3, 0xe9, 
-	0xbc, 0xc9, 0xad, 0x63, 0x2c, 0x49, 0x44, 0x3d, 0x4f, 0x41, 0xc0, 0x1f, 0xca, 
-	0xb5, 0x56, 0x40, 0x17, 0x39, 0xe9, 0x5c, 0xc6, 0xad, 0x3f, 0xdb, 0x75, 0x66, 
-	0x70, 0x7e, 0x50, 0x76, 0x8f, 0xa0, 0xac, 0xfa, 0x97, 0xd0, 0xa9, 0x71, 0x6f, 
-	0x1c, 0xcf, 0x6f, 0x14, 0x83, 0x38, 0x25, 0xb1, 0x4b, 0x12, 0x27, 0x92, 0x2 , 
-	0x28, 0x51, 0x34, 0xbc, 0x1 , 0xe9, 0xd7, 0xfc, 0x29, 0x66, 0x3f, 0xbd, 0x9e, 
-	0x41, 0xff, 0x0 , 0x2c, 0xe3, 0xda, 0x3e, 0xbf, 0xfe, 0xb3, 0x4a, 0x9f, 0x24, 
-	0xb1, 0x83, 0xf7, 0x61, 0x88, 0xb1, 0xff, 0x0 , 0x3f, 0x85, 0x3 , 0x1c, 0xdf, 
-	0x32, 0xcc, 0x41, 0xfb, 0xee, 0x23, 0x1f, 0x87, 0x1f, 0xd0, 0xd4, 0x8d, 0xb9, 
-	0x64, 0x91, 0x94, 0xff, 0x0 , 0xab, 0x4c, 0xf , 0xaf, 0xf9, 0x35, 0xd , 0xb8, 
-	0x3b, 0x6d, 0xd0, 0x8e, 0x72, 0x5d, 0xbf, 0xcf, 0xe3, 0x52, 0x2b, 0x16, 0x87, 
-	0x20, 0xff, 0x0 , 0xae, 0x97, 0xf4, 0xff, 0x0 , 0x38, 0xa4, 0x5 , 0x98, 0x27, 
-	0xb8, 0x8e, 0x48, 0xd0, 0x48, 0xf8, 0x58, 0xcb, 0x1c, 0x31, 0xa2, 0x3b, 0x87, 
-	0x78, 0xe2, 0x12, 0x45, 0x13, 0xb4, 0x87, 0x27, 0x7c, 0x6a, 0xdf, 0xcc, 0x54, 
-	0x4c, 0xff, 0x0 , 0x2c, 0xec, 0x3d, 0x42, 0x2f, 0xe8, 0x3f, 0xc6, 0xa5, 0x52, 
-	0xab, 0x3e, 0x7b, 0x45, 0x17, 0x34, 0xac, 0x98, 0xd4, 0x9a, 0xd9, 0x89, 0x21, 
-	0xb3, 0x91, 0x19, 0xde, 0xca, 0x3c, 0x99, 0x36, 0xae, 0xd2, 0xcb, 0xdf, 0xd8, 
-	0xe2, 0x9c, 0x6d, 0xf4, 0xdd, 0xd2, 0x6 , 0x8a, 0x75, 0xf2, 0xd7, 0x39, 0x59, 
-	0x47, 0xa7, 0xb8, 0xa4, 0x8d, 0x1 , 0x58, 0x13, 0x1c, 0x92, 0x58, 0xd2, 0xb2, 
-	0x83, 0xc , 0x8d, 0xff, 0x0 , 0x3d, 0x24, 0xc0, 0xff, 0x0 , 0x3f, 0x85, 0x2e, 
-	0x58, 0xf6, 0x35, 0x8e, 0x22, 0xb4, 0x76, 0x93, 0x15, 0x6c, 0xad, 0xb , 0x20, 
-	0x8e, 0xe6, 0x54, 0x2e, 0x33, 0x86, 0x8c, 0x37, 0xf5, 0x14, 0xcf, 0xec, 0xe5, 
-	0x90, 0x6e, 0x4b, 0xe8, 0xf9, 0x6c, 0xd , 0xc8, 0xc3, 0xf9, 0x66, 0xa5, 0x64, 
-	0x2 , 0x67, 0x7f, 0xf9, 0xe7, 0x1e, 0x7 , 0xd6, 0x88, 0xe2, 0xf9, 0xa0, 0x4c, 
-	0xfd, 0xd0, 0x58, 0xd2, 0xe5, 0x46, 0xb1, 0xc7, 0x57, 0x5d, 0x48, 0x5f, 0x48, 
-	0x9f, 0x2d, 0xb2, 0x7b, 0x69, 0x36, 0x75, 0xc4, 0xb8, 0xff, 0x0 , 0xd0, 0xb1, 
-	0x44, 0x3a, 0x7d, 0xea, 0x6e, 0x5f, 0x23, 0x77, 0x43, 0x85, 0x75, 0x6e, 0x3f, 
-	0x3 , 0x53, 0x7c, 0xe6, 0xe , 0xbf, 0xeb, 0x25, 0xfd, 0x33, 0xff, 0x0 , 0xd6, 
-	0xa7, 0xb3, 0x3e, 0xf9, 0xdf, 0xfb, 0xab, 0xb4, 0x7e, 0x5f, 0xfd, 0x7a, 0x9f, 
-	0x66, 0x8d, 0xe3, 0x9a, 0x56, 0x5b, 0xa4, 0xca, 0x3a, 0x9e, 0x91, 0x73, 0x75, 
-	0x67, 0xe5, 0x4b, 0x6b, 0x32, 0x9e, 0xb1, 0xb7, 0x96, 0x78, 0x35, 0xc7, 0xdc, 
-	0xc4, 0xf0, 0x5c, 0x34, 0x53, 0x2e, 0xc7, 0x53, 0x82, 0xa4, 0x74, 0xaf, 0x41, 
-	0x86, 0x49, 0xa3, 0x9a, 0x14, 0x57, 0x65, 0xc2, 0xe4, 0xe0, 0xd2, 0xb5, 0xd5, 
-	0xc3, 0xdb, 0xfe, 0xf2, 0x46, 0x7f, 0x32, 0x4c, 0x61, 0x8e, 0x7b, 0xfb, 0xd3, 
-	0x8c, 0x6c, 0x63, 0x8b, 0xc5, 0x2c, 0x45, 0xa4, 0xe3, 0x69, 0x2e, 0xa7, 0x9f, 
-	0x7d, 0xe5, 0xc8, 0xed, 0x57, 0xb4, 0x9b, 0xcf, 0x2d, 0x84, 0x6e, 0xd8, 0xe7, 
-	0x8a, 0xec, 0x64, 0xf2, 0x1a, 0x49, 0x99, 0xec, 0xed, 0x5c, 0x22, 0xc , 0xee, 
-	0xb7, 0x43, 0x93, 0x8f, 0x5c, 0x54, 0x52, 0x58, 0xe9, 0x92, 0xb4, 0x29, 0x2e, 
-	0x97, 0x6b, 0x96, 0x19, 0x25, 0x41, 0x4f, 0xfd, 0x4 , 0x8a, 0x6d, 0x5c, 0xc6, 
-	0x8d, 0x69, 0x52, 0x97, 0x32, 0x28, 0x5a, 0xca, 0x1a, 0x40, 0x59, 0xf6, 0xe7, 
-	0xbd, 0x68, 0xf9, 0x25, 0x94, 0x6c, 0xb8, 0xc , 0x3d, 0x5 , 0x32, 0x3b, 0x4d, 
-	0x39, 0x62, 0x25, 0x2d, 0x59, 0x46, 0xfd, 0xab, 0x89, 0x58, 0xff, 0x0 , 0x32, 
-	0x6a, 0xc4, 0x76, 0xf6, 0x2b, 0x23, 0x2e, 0xdb, 0x81, 0xb5, 0x73, 0xc4, 0x83, 
-	0x8f, 0xfc, 0x76, 0xa7, 0x95, 0xa3, 0xd8, 0x59, 0x8d, 0x26, 0x95, 0xf4, 0x65, 
-	0x69, 0x22, 0x95, 0x7b, 0xe6, 0xa2, 0xf9, 0xc7, 0x51, 0x57, 0xfc, 0x8b, 0x52, 
-	0x23, 0xc4, 0xd3, 0xae, 0xfe, 0xc4, 0x6 , 0xff, 0x0 , 0xa , 0x63, 0x5b, 0x44, 
-	0x52, 0x46, 0x17, 0x67, 0xe5, 0x24, 0x7c, 0xd0, 0xf5, 0xfc, 0x8d, 0x27, 0x13, 
-	0x58, 0xe6, 0x14, 0x3f, 0x9b, 0xf0, 0x65, 0x16, 0xd , 0x9c, 0xe2, 0x9c, 0xa0, 
-	0xe2, 0xb4, 0x16, 0xc9, 0x3c, 0xcd, 0x82, 0xe6, 0x3e, 0x57, 0x3c, 0xa1, 0x1f, 
-	0x9f, 0x5a, 0x23, 0xb2, 0x42, 0xaa, 0xdf, 0x6b, 0x83, 0xc , 0x70, 0x7 , 0xcf, 
-	0xff, 0x0 , 0xc4, 0xd2, 0xe5, 0x2f, 0xeb, 0xd4, 0x1f, 0xda, 0x46, 0x76, 0xc3, 
-	0x8c, 0x8a, 0x51, 0x1b, 0x7a, 0x56, 0xa7, 0xd8, 0x3e, 0xf2, 0x89, 0xa0, 0x3b, 
-	0x7e, 0xf0, 0xd , 0x8e, 0x3f, 0x2a, 0x7f, 0xd8, 0xdb, 0x38, 0x6 , 0x23, 0xc6, 
-	0x40, 0xf3, 0x57, 0xfc, 0x6a, 0xb9, 0x10, 0x7d, 0x72, 0x97, 0xf3, 0x23, 0x19, 
-	0x94, 0xa8, 0xe7, 0x39, 0xa1, 0x63, 0x7e, 0xb8, 0xad, 0x65, 0xb2, 0x2c, 0x16, 
-	0x67, 0xf2, 0xf6, 0xe7, 0xa , 0x3c, 0xd5, 0xeb, 0xf9, 0xd3, 0xfe, 0xc6, 0x41, 
-	0x61, 0xb1, 0x72, 0xa3, 0x27, 0xe , 0xbf, 0xe3, 0x47, 0x20, 0xfe, 0xb9, 0x4f, 
-	0xba, 0x32, 0x14, 0xc8, 0xbd, 0xaa, 0x45, 0x9e, 0x40, 0x8 , 0x2a, 0x7a, 0x56, 
-	0x89, 0xb7, 0x71, 0xb7, 0x6c, 0x79, 0xdd, 0xd3, 0xe6, 0x53, 0x9f, 0xd6, 0x98, 
-	0xc9, 0x32, 0xab, 0x11, 0x66, 0x4e, 0xde, 0xb8, 0x61, 0x47, 0x2d, 0xba, 0x87, 
-	0xd6, 0x69, 0xbe, 0xdf, 0x79, 0x4f, 0xed, 0xc , 0x3a, 0xa7, 0xe9, 0x50, 0xdc, 
-	0xca, 0x19, 0x7a, 0x55, 0xd9, 0x56, 0xf8, 0xb6, 0xc4, 0xb3, 0xe4, 0x8c, 0x8e, 
-	0x45, 0x56, 0xfb, 0x25, 0xe3, 0xba, 0xc9, 0x2d, 0xb3, 0x32, 0xe7, 0xa0, 0x60, 
-	0x2a, 0x65, 0xb1, 0xa4, 0x2a, 0xd3, 0xde, 0xeb, 0xef, 0x44, 0xb0, 0x47, 0xe5, 
-	0xd8, 0xe5, 0xb8, 0xcf, 0x26, 0xa8, 0xde, 0x4e, 0x33, 0xb8, 0x91, 0xb4, 0x74, 
-	0xab, 0x77, 0xe9, 0xaa, 0x5c, 0x7c, 0x9f, 0x64, 0xda, 0xb1, 0x8e, 0x11, 0x8 , 
-	0xfc, 0xfa, 0xf3, 0x58, 0xb7, 0xda, 0x66, 0xb5, 0x77, 0x22, 0xc6, 0x2d, 0x1e, 
-	0x38, 0x58, 0xfd, 0xe3, 0x22, 0xf3, 0xfa, 0xd2, 0x69, 0xcb, 0x43, 0x2a, 0x98, 
-	0xca, 0x74, 0xa2, 0xe5, 0x7b, 0xbf, 0x22, 0x95, 0xd5, 0xc3, 0x5e, 0xcd, 0xe4, 
-	0xc6, 0xdb, 0x61, 0x7 , 0xe6, 0x6f, 0xef, 0x52, 0xdc, 0xc8, 0xb6, 0xf0, 0x85, 
-	0x50, 0x0 , 0x1d, 0x5 , 0x5f, 0x5d, 0x17, 0x53, 0x86, 0x16, 0x58, 0xec, 0xf8, 
-	0x8f, 0xa8, 0xf3, 0x13, 0x3f, 0xce, 0xaa, 0xb7, 0x86, 0xf5, 0xcb, 0x8b, 0x85, 
-	0xf , 0x6c, 0x88, 0x1c, 0xf0, 0x5a, 0xe2, 0x3c, 0x7f, 0xe8, 0x55, 0xa2, 0x56, 
-	0x47, 0xcf, 0x55, 0xab, 0x3a, 0xd3, 0xe6, 0x93, 0xd4, 0xcb, 0x86, 0x39, 0x6f, 
-	0x2e, 0xb0, 0x3a, 0xfa, 0xfa, 0xa , 0xe9, 0xf4, 0x9b, 0x18, 0xed, 0xad, 0xf7, 
-	0x11, 0xf2, 0x8f, 0xcd, 0x8d, 0x5a, 0xd2, 0x7c, 0x3f, 0x25, 0xb4, 0x27, 0x70, 
-	0x88, 0x6d, 0x3f, 0x31, 0x33, 0x26, 0x7f, 0x9d, 0x5c, 0x9b, 0x4d, 0xbc, 0x79, 
-	0x15, 0x1 , 0x81, 0x57, 0x1f, 0x28, 0xf3, 0x97, 0x18, 0xa8, 0x77, 0x67, 0xb5, 
-	0x82, 0xa7, 0x42, 0x82, 0xbc, 0xa6, 0xb9, 0xbd, 0x51, 0x9c, 0xcd, 0xbd, 0xb7, 
-	0x1e, 0xb4, 0x95, 0x75, 0x74, 0xa9, 0xf6, 0x6e, 0x33, 0x5b, 0x8e, 0x70, 0x7f, 
-	0x79, 0xff, 0x0 , 0xd6, 0xa7, 0xff, 0x0 , 0x64, 0x4a, 0x1c, 0xa9, 0xba, 0xb5, 
-	0xc8, 0x19, 0xfb, 0xed, 0xff, 0x0 , 0xc4, 0xd6, 0x7c, 0xb2, 0x3d, 0x2f, 0xae, 
-	0x61, 0xd7, 0xdb, 0x5f, 0x79, 0x40, 0x9a, 0x4a, 0xd0, 0xfe, 0xca, 0x6d, 0xaa, 
-	0xdf, 0x6d, 0xb6, 0xc3, 0x1c, 0x7f, 0x1f, 0x1f, 0xf8, 0xed, 0x2f, 0xf6, 0x49, 
-	0xde, 0xcb, 0xf6, 0xd8, 0x3e, 0x51, 0x9e, 0x3 , 0x7f, 0x85, 0x1c, 0x92, 0x17, 
-	0xd7, 0xb0, 0xdf, 0xce, 0x8a, 0x5c, 0xe3, 0x39, 0xe9, 0x4b, 0x80, 0x6a, 0xea, 
-	0xe9, 0xc8, 0x15, 0x5d, 0xae, 0xd3, 0xe , 0x70, 0x40, 0x43, 0xc5, 0x39, 0xb4, 
-	0xe8, 0x7f, 0x78, 0xd , 0xe3, 0x65, 0x39, 0x18, 0x87, 0x39, 0xff, 0x0 , 0xc7, 
-	0xaa, 0xb9, 0x1f, 0x62, 0x1e, 0x61, 0x86, 0x5f, 0x6f, 0xf3, 0x33, 0x68, 0xcd, 
-	0x6a, 0x7d, 0x82, 0xcf, 0xf7, 0x65, 0xae, 0x66, 0x6d, 0xdd, 0x71, 0x18, 0x1f, 
-	0xd6, 0x8f, 0xb1, 0x69, 0xe1, 0x24, 0x24, 0xdc, 0xb3, 0x21, 0xc0, 0xf9, 0x94, 
-	0x3 , 0xcf, 0xd0, 0xd2, 0xf6, 0x72, 0x27, 0xfb, 0x53, 0xa , 0xbe, 0xd7, 0xe0, 
-	0xcc, 0xba, 0x6b, 0x1a, 0xd8, 0xfb, 0x2e, 0x98, 0x26, 0x55, 0xf2, 0xee, 0xa , 
-	0xb2, 0xe4, 0xe6, 0x61, 0x9f, 0xd1, 0x69, 0x9e, 0x45, 0x8a, 0xc3, 0xbb, 0xec, 
-	0xec, 0x48, 0x7c, 0x1f, 0xde, 0x1e, 0x47, 0xe1, 0x4f, 0xd9, 0xc8, 0x8f, 0xed, 
-	0x7c, 0x37, 0x9f, 0xdc, 0x65, 0x40, 0x56, 0x5b, 0x8f, 0x25, 0x5d, 0x77, 0x81, 
-	0x92, 0x9 , 0xe9, 0x57, 0x9b, 0xc3, 0x31, 0xde, 0xc4, 0xb2, 0xdd, 0xea, 0x71, 
-	0xdb, 0xa8, 0xfb, 0xaa, 0xe , 0xe2, 0x7d, 0xf0, 0xa0, 0x9f, 0xcf, 0x15, 0x8d, 
-	0xad, 0x5a, 0x5c, 0x59, 0xeb, 0xc6, 0xe3, 0x4c, 0xb7, 0x66, 0x52, 0xbb, 0x80, 
-	0x2c, 0x5b, 0x1c, 0x7a, 0x9a, 0xb1, 0xa2, 0x6a, 0x5a, 0x83, 0x6b, 0xb , 0x67, 
-	0x7c, 0xa8, 0xa1, 0xe3, 0xdc, 0xaa, 0xab, 0xdf, 0xfc, 0x8a, 0xd6, 0x30, 0x48, 
-	0xf1, 0xf1, 0x59, 0x85, 0x4a, 0xf7, 0x8e, 0xd1, 0x35, 0xd6, 0xce, 0xfa, 0xd9, 
-	0x31, 0x5 , 0xdd, 0xbd, 0xfa, 0xaf, 0x1 , 0x48, 0xf2, 0x64, 0xfc, 0x33, 0xc1, 
-	0xfc, 0xeb, 0x5f, 0xc2, 0xd6, 0x4f, 0xa8, 0x48, 0x1e, 0x6b, 0x59, 0x23, 0x3b, 
-	0xb6, 0x88, 0x58, 0x7c, 0xcc, 0x7e, 0x82, 0xb2, 0xee, 0x9c, 0xa4, 0x27, 0x6f, 
-	0xde, 0x62, 0x15, 0x7e, 0xa4, 0xe0, 0x7f, 0x3a, 0xea, 0xf4, 0x2b, 0x99, 0x74, 
-	0xb9, 0x6d, 0xde, 0xce, 0x46, 0x8e, 0x58, 0x8 , 0x29, 0x22, 0x36, 0xd6, 0x4 , 
-	0x77, 0x4 , 0x74, 0x35, 0xa2, 0xd4, 0xf3, 0x87, 0x5d, 0xea, 0x96, 0xfa, 0x74, 
-	0xf0, 0xc3, 0x72, 0xad, 0x14, 0x72, 0x7c, 0xaa, 0xe0, 0x7c, 0xa0, 0xfa, 0x1c, 
-	0x74, 0xae, 0xaf, 0x4f, 0x9f, 0x43, 0x8e, 0xdc, 0x13, 0x79, 0x7b, 0x23, 0x30, 
-	0x1c, 0xa5, 0xaa, 0xed, 0xfc, 0xcb, 0x83, 0xfa, 0xa , 0xc0, 0xd6, 0x6c, 0x6d, 
-	0x75, 0x2b, 0x47, 0x49, 0x7 , 0x98, 0x92, 0x8c, 0xb6, 0x57, 0x4 , 0x13, 0xff, 
-	0x0 , 0xd7, 0xcd, 0x73, 0x7a, 0x6d, 0xe5, 0xcf, 0x87, 0xef, 0x97, 0x4f, 0xbf, 
-	0x66, 0x7b, 0x57, 0x38, 0x82, 0x73, 0xdb, 0xd8, 0xd5, 0x29, 0x34, 0x2b, 0x26, 
-	0x7a, 0x1d, 0xc5, 0xd5, 0x94, 0xb1, 0xb4, 0x41, 0xda, 0x44, 0x70, 0x47, 0xef, 
-	0x62, 0xb , 0xf9, 0x80, 0x48, 0xfd, 0x6b, 0x8f, 0xf1, 0x6 , 0x8e, 0x22, 0xdd, 
-	0x71, 0x6a, 0xb8, 0xb , 0xcb, 0xc7, 0xfd, 0x45, 0x6c, 0xc6, 0xeb, 0x24, 0x61, 
-	0x94, 0xee, 0x53, 0xc8, 0xa7, 0x31, 0xcc, 0x78, 0x27, 0xa5, 0x27, 0x2e, 0x6d, 
-	0xc1, 0x46, 0xdb, 0x1e, 0x7b, 0xa8, 0x31, 0x80, 0x33, 0xe3, 0xa1, 0xfd, 0xd , 
-	0x64, 0x4d, 0x33, 0xca, 0xc4, 0xb1, 0xeb, 0xda, 0xba, 0x6f, 0x17, 0x59, 0x88, 
-	0x66, 0x65, 0x41, 0xf2, 0x4a, 0xa7, 0x68, 0x1d, 0xab, 0x94, 0xae, 0x7a, 0x8b, 
-	0x53, 0xe8, 0x32, 0xa9, 0xa7, 0x4d, 0xc7, 0xb7, 0xea, 0x52, 0xd4, 0x3e, 0x5b, 
-	0xe8, 0x9f, 0xb3, 0x29, 0x53, 0xf8, 0x7f, 0xfa, 0xea, 0x55, 0x35, 0x1e, 0xb0, 
-	0x9 , 0xb7, 0x47, 0x1f, 0xc0, 0xe3, 0x3f, 0x43, 0xc5, 0x3a, 0x22, 0x36, 0x75, 
-	0xed, 0x53, 0xd0, 0xeb, 0x6f, 0x96, 0xac, 0x97, 0xa3, 0x25, 0xcd, 0x57, 0xbb, 
-	0x19, 0x52, 0x2a, 0x6c, 0xd3, 0x25, 0x19, 0x14, 0xe , 0xa7, 0xbd, 0x1b, 0x18, 
-	0xd2, 0x2e, 0x1c, 0xad, 0x59, 0xb1, 0xb9, 0xda, 0x42, 0xbf, 0x6e, 0x9e, 0xf4, 
-	0xdb, 0xc8, 0xfe, 0x6c, 0x8a, 0xaf, 0x8a, 0xe8, 0x84, 0xac, 0x7c, 0xed, 0x6a, 
-	0x7c, 0xb2, 0x69, 0x9d, 0xdf, 0x84, 0x7c, 0x4d, 0x2d, 0xae, 0xc8, 0x24, 0x98, 
-	0x88, 0xc7, 0x8 , 0xd2, 0xd , 0xde, 0x58, 0xf6, 0xe0, 0x9a, 0xec, 0xa3, 0xb8, 
-	0x82, 0x65, 0x32, 0x2b, 0x43, 0x2a, 0xcb, 0x86, 0xf9, 0x14, 0xf , 0x30, 0xff, 
-	0x0 , 0xec, 0xdf, 0x9f, 0x7f, 0xc6, 0xbc, 0x66, 0xd2, 0xe8, 0xa3, 0x0 , 0xe7, 
-	0xf1, 0x26, 0xb7, 0xf4, 0x1d, 0x5c, 0xd9, 0xfc, 0xac, 0x1d, 0xe2, 0xce, 0xed, 
-	0x8a, 0xe5, 0x70, 0x71, 0x8c, 0x8c, 0x7d, 0x7f, 0x95, 0x6a, 0xe2, 0xa5, 0xaa, 
-	0x31, 0xbb, 0x47, 0xa3, 0xdc, 0xda, 0x45, 0x7b, 0x6a, 0xcf, 0x34, 0xb2, 0x24, 
-	0x6f, 0xca, 0xef, 0x9f, 0x1b, 0x5b, 0xfd, 0x90, 0x4e, 0x1 , 0xfc, 0x7f, 0x3a, 
-	0xa4, 0xd6, 0x6e, 0x57, 0x63, 0x2c, 0x9b, 0x97, 0xa1, 0x99, 0x42, 0xb1, 0xf6, 
-	0x60, 0x38, 0xcf, 0x1d, 0x7b, 0xe7, 0xad, 0x45, 0x63, 0xae, 0xd8, 0x5c, 0xf9, 
-	0x53, 0xab, 0xb4, 0x57, 0x0 , 0x6d, 0x24, 0xc8, 0x17, 0x70, 0xc7, 0x42, 0x31, 
-	0x83, 0xf8, 0xf1, 0x5a, 0x3b, 0xa3, 0x91, 0xbc, 0xb2, 0x64, 0xda, 0xc3, 0xb , 
-	0x93, 0xb8, 0x83, 0xdd, 0x7e, 0x9f, 0x4e, 0x3d, 0xab, 0x21, 0xee, 0x51, 0x59, 
-	0x3c, 0xbd, 0xd1, 0x4c, 0xaa, 0xc8, 0xc0, 0x86, 0xe7, 0x76, 0x3d, 0x8d, 0x73, 
-	0xfa, 0xf6, 0x8b, 0x8 , 0x69, 0x2e, 0x2c, 0x43, 0x5 , 0xdd, 0x92, 0x80, 0xf4, 
-	0xfa, 0x57, 0x45, 0x79, 0x2 , 0x16, 0x6d, 0x8a, 0x1f, 0x39, 0x4 , 0xa0, 0xc7, 
-	0x3d, 0x32, 0x47, 0x4c, 0xd6, 0x5d, 0xe0, 0x75, 0x66, 0xb , 0x93, 0x9e, 0xfb, 
-	0xb8, 0x1f, 0x97, 0x34, 0x84, 0x62, 0xdb, 0xdc, 0xcc, 0x89, 0x28, 0x56, 0x40, 
-	0x80, 0xa8, 0x60, 0x54, 0x6e, 0x7 , 0xd4, 0x1e, 0xdc, 0x55, 0x9f, 0xb5, 0x3a, 
-	0xfc, 0xca, 0x73, 0x23, 0x90, 0xb9, 0x7 , 0xe5, 0xf5, 0x39, 0x15, 0x34, 0xd6, 
-	0x31, 0xdd, 0xb0, 0x2a, 0x15, 0x64, 0x2b, 0xcb, 0xf5, 0xe3, 0xdf, 0x15, 0x46, 
-	0xef, 0x7d, 0xac, 0xca, 0xb3, 0x40, 0x11, 0x88, 0xc6, 0x54, 0x7c, 0xad, 0x8e, 
-	0xe0, 0x9e, 0xb4, 0xc4, 0x74, 0x3e, 0x1d, 0xd5, 0x2e, 0xac, 0x24, 0x13, 0xdb, 
-	0xca, 0xa9, 0xc6, 0xe1, 0x13, 0x1c, 0xc6, 0xc4, 0xfb, 0x76, 0x35, 0xe9, 0x9e, 
-	0x10, 0xf1, 0x1d, 0x9e, 0xa3, 0x6a, 0x22, 0x66, 0x3e, 0x6c, 0x2a, 0xc , 0x91, 
-	0xca, 0xd8, 0xc9, 0xcf, 0xea, 0x2b, 0xc5, 0x34, 0xfb, 0xdd, 0xca, 0x62, 0x97, 
-	0xa , 0xab, 0xef, 0xc7, 0xd7, 0x35, 0xa7, 0xf6, 0xb6, 0x82, 0x54, 0xb8, 0x84, 
-	0xc9, 0xfb, 0x96, 0xce, 0x63, 0x39, 0x60, 0x7 , 0xa7, 0xad, 0x5a, 0x97, 0x72, 
-	0x4f, 0x78, 0xb3, 0x24, 0x47, 0x1d, 0xbd, 0xda, 0x37, 0x92, 0x1b, 0xce, 0x4 , 
-	0x7d, 0x3a, 0x66, 0xaa, 0x6a, 0x46, 0x17, 0x94, 0xdc, 0x40, 0xbf, 0xbb, 0x66, 
-	0x38, 0x4e, 0xb8, 0x15, 0xc2, 0xe9, 0x3e, 0x3d, 0x17, 0xa9, 0x1d, 0xa5, 0xfb, 
-	0x6d, 0x63, 0xc4, 0x53, 0x63, 0x68, 0x7f, 0xaf, 0xa1, 0xae, 0xaf, 0x45, 0xd5, 
-	0x63, 0xf2, 0xda, 0x6 , 0x44, 0x64, 0x90, 0x85, 0xe , 0x7f, 0x83, 0xdc, 0x53, 
-	0x3 , 0x5e, 0xf2, 0xf1, 0x6e, 0xb4, 0xc8, 0x4b, 0x5 , 0x11, 0x46, 0x15, 0x3c, 
-	0xc6, 0x5d, 0xc5, 0x73, 0xc7, 0x6a, 0xe1, 0xbe, 0x29, 0x69, 0xd2, 0xdd, 0xf8, 
-	0x6a, 0xea, 0xd9, 0x4f, 0xcd, 0xb1, 0xb6, 0x9e, 0xc7, 0xd3, 0xf0, 0xae, 0xa9, 
-	0x56, 0x58, 0x24, 0xf3, 0x50, 0xb1, 0x85, 0x98, 0xe7, 0x3 , 0xa7, 0xd2, 0x9d, 
-	0xa9, 0x41, 0x15, 0xf5, 0x80, 0x8e, 0x50, 0xe , 0x58, 0xe7, 0x27, 0xb1, 0xf5, 
-	0xf4, 0xa0, 0x47, 0x92, 0xfe, 0xcf, 0x57, 0x76, 0x10, 0x68, 0x7a, 0x85, 0xa4, 
-	0xf0, 0x42, 0xd3, 0x99, 0x88, 0x99, 0x65, 0x8c, 0x1d, 0xe8, 0x40, 0x1 , 0x4e, 
-	0x7b, 0x70, 0x6b, 0x17, 0xc2, 0xf2, 0x5a, 0xe9, 0x9f, 0x10, 0x35, 0x2b, 0x2b, 
-	0x7 , 0x53, 0x14, 0x77, 0x2d, 0xf6, 0x78, 0xc8, 0x7 , 0xb , 0x9c, 0xf0, 0x7b, 
-	0x63, 0xa7, 0xe1, 0x57, 0xfc, 0x69, 0xe0, 0x5d, 0x6b, 0x4d, 0xd5, 0xa6, 0xbd, 
-	0xd0, 0xee, 0x25, 0x85, 0x67, 0x39, 0x7d, 0x84, 0xae, 0xe1, 0xd7, 0xb5, 0x57, 
-	0xf8, 0x6b, 0xe1, 0x6d, 0x5a, 0xdf, 0x58, 0xfb, 0x4d, 0xcf, 0x1 , 0xb9, 0x90, 
-	0x11, 0xbb, 0x77, 0x7f, 0xbd, 0xd7, 0x34, 0xb5, 0xd0, 0xf , 0x73, 0xb4, 0x26, 
-	0xee, 0xce, 0x3f, 0x35, 0xb1, 0x33, 0x22, 0xed, 0x24, 0x67, 0x3f, 0xe0, 0x68, 
-	0x96, 0x57, 0xc , 0xd0, 0xc8, 0x77, 0x79, 0x63, 0x6e, 0x3b, 0x8a, 0x82, 0x45, 
-	0x8d, 0x36, 0x25, 0xbb, 0x9c, 0x6d, 0x5 , 0xe , 0x7a, 0x1f, 0x4a, 0xaf, 0x71, 
-	0x2b, 0xbd, 0xc7, 0x9b, 0x9e, 0x78, 0x27, 0xdc, 0xf7, 0xad, 0xae, 0x45, 0x8b, 
-	0x7b, 0xdb, 0xcb, 0xdd, 0xe8, 0x73, 0x4f, 0xd7, 0x14, 0x4d, 0xa7, 0x6f, 0xa , 
-	0xe , 0x3e, 0xf7, 0xd2, 0xab, 0x47, 0x70, 0x3c, 0xbd, 0xbf, 0x2e, 0xd9, 0x7a, 
-	0xfa, 0x83, 0x53, 0xc0, 0xc6, 0x48, 0xd7, 0x2a, 0x7c, 0xb3, 0x90, 0xd8, 0xfc, 
-	0x7 , 0xe5, 0xd2, 0x90, 0xcf, 0x19, 0xf1, 0x76, 0x9d, 0xfd, 0x99, 0xac, 0x49, 
-	0x12, 0x7f, 0xa9, 0x93, 0xf7, 0x91, 0x63, 0xd0, 0xf6, 0xfc, 0xe , 0x45, 0x65, 
-	0x1a, 0xee, 0xbe, 0x2d, 0x5b, 0x43, 0x15, 0xac, 0x2c, 0x18, 0x16, 0x8e, 0x52, 
-	0xaa, 0x7d, 0xb1, 0xff, 0x0 , 0xd6, 0x15, 0xc2, 0xd4, 0x80, 0x51, 0x9a, 0x3f, 
-	0xa , 0x3f, 0xa , 0x0 , 0x3f, 0x1a, 0x4c, 0xfb, 0xd0, 0x7e, 0x94, 0x94, 0x0 , 
-	0x51, 0x41, 0xa4, 0xcd, 0x0 , 0x4 , 0xd2, 0x51, 0x48, 0x4d, 0x0 , 0xd , 0x49, 
-	0x46, 0x68, 0xa0, 0x2 , 0x8f, 0xc6, 0x8f, 0xc2, 0x8f, 0xc2, 0x80, 0x13, 0xf1, 
-	0xa3, 0x34, 0x37, 0xd2, 0x92, 0x80, 0xa , 0x33, 0x41, 0xa6, 0xd0, 0x1 , 0x45, 
-	0x14, 0x84, 0xd0, 0x0 , 0x4d, 0x25, 0x14, 0x55, 0x0 , 0x51, 0xf8, 0xd1, 0xf8, 
-	0x51, 0xf8, 0x50, 0x1 , 0xf8, 0xd3, 0x5a, 0x94, 0xfd, 0x29, 0x28, 0x3 , 0xff, 
-	0xd9, 
+// Generated by embedAsset.py from ruby.jpg, do not edit
+#include "EmbeddedAsset.h"
+
+namespace {
+const std::uint64_t RubyTextureData [] = {
+	0x464a1000e0ffd8ff, 0xc000010101004649, 0x6600e1ff0000c000, 0x4d4d000066697845,
+	0x400080000002a00, 0x100000005001a01, 0x5001b013e000000, 0x4600000001000000,
+	0x100000003002801, 0x200310100000200, 0x4e00000010000000, 0xc000000000000000,
+	0xc000000001000000, 0x6e69617001000000, 0x2e342074656e2e74, 0x4300dbff00362e30,
+	0x402030303020400, 0x504040404030303, 0x80b050505050609, 0xd0d0d0b0d090608,
+	0xe1114100e0c0c0b, 0x1218120c0c0f130f, 0x110e171717161513, 0x1716141a16191b19,
+	0x404014300dbff16, 0xa06060a05050504, 0x161616160f0c0f16, 0x1616161616161616,
+	0x1616161616161616, 0x1616161616161616, 0x1616161616161616, 0x1616161616161616,
+	0xc0ff161616161616, 0x30005d002081100, 0x1103011102002201, 0x100001f00c4ff01,
+	0x1010101010105, 0x100000000000000, 0x908070605040302, 0x10b500c4ff0b0a,
+	0x503040203030102, 0x17d010000040405, 0x2112051104000302, 0x2207615113064131,
+	0x2308a19181321471, 0x24f0d15215c1b142, 0x17160a0982726233, 0x29282726251a1918,
+	0x3a3938373635342a, 0x4a49484746454443, 0x5a59585756555453, 0x6a69686766656463,
+	0x7a79787776757473, 0x8a89888786858483, 0x9998979695949392, 0xa8a7a6a5a4a3a29a,
+	0xb7b6b5b4b3b2aaa9, 0xc6c5c4c3c2bab9b8, 0xd5d4d3d2cac9c8c7, 0xe3e2e1dad9d8d7d6,
+	0xf1eae9e8e7e6e5e4, 0xf9f8f7f6f5f4f3f2, 0x300011f00c4fffa, 0x101010101010101,
+	0x100000000000001, 0x908070605040302, 0x11b500c4ff0b0a, 0x704030404020102,
+	0x77020100040405, 0x3121050411030201, 0x1371610751411206, 0xa191421408813222,
+	0x15f052332309c1b1, 0xe13424160ad17262, 0x27261a191817f125, 0x39383736352a2928,
+	0x494847464544433a, 0x595857565554534a, 0x696867666564635a, 0x797877767574736a,
+	0x888786858483827a, 0x9796959493928a89, 0xa6a5a4a3a29a9998, 0xb5b4b3b2aaa9a8a7,
+	0xc4c3c2bab9b8b7b6, 0xd3d2cac9c8c7c6c5, 0xe2dad9d8d7d6d5d4, 0xeae9e8e7e6e5e4e3,
+	0xf9f8f7f6f5f4f3f2, 0x1030c00dafffa, 0xf8003f0011031102, 0x110c2ae40298af6,
+	0x518cc2290814454b, 0x2fb5c7687d94c240, 0x1445e347e30740e1, 0xa8096e628c52880,
+	0x8a960220a4b81428, 0x7d94de6362a0f451, 0x1a3f000a3f0a7f69, 0x8a4b7129d080a228,
+	0xa803a058a511028, 0x4beb030085bf1428, 0x5214054051f8d1f8, 0x488152b414004081,
+	0x8f01a4688ea21403, 0x28fc28fca5f5517a, 0x2950008aa268fc00, 0x94a2a5058002a568,
+	0xf0a3f197d607000a, 0x5a5aa4700a80a2, 0x1fa50068292ec528, 0xf80150f84bed315a,
+	0x9762140045d1f8d1, 0x1428455100b414, 0x8a4b510014454b01, 0xc28fc65f5a1f0028,
+	0xa0288ac60f80c28f, 0xe25242a040298a02, 0x150144501501497, 0x768a3604ea142846,
+	0x140045511400c528, 0x1400455114004551, 0xa1f7182500054a51, 0x8d1f8d1f0085df69,
+	0x1f8d1f00851f851f, 0x8d1f00851f851f8d, 0x1f00851f851f8d1f, 0x851f851f8d1f8d,
+	0x851f851f8d1f8d1f, 0x14851f8d1f8d1f00, 0x7e147e347e347e00, 0x147e347e347e0014,
+	0x7e347e347e00147e, 0x347e347e00147e14, 0x7e347e00147e147e, 0x8d1f40157e147e34,
+	0x2100851f851f8d1f, 0x14c504a018c5a5a4, 0x350b41421054051, 0x51940014933a4571,
+	0x601a525c8a360045, 0x8d1f8d1f00455114, 0x69fd1030851f851f, 0x2801a83d2685df29,
+	0xd4051146d008aa2, 0x8d1f054049ad14c5, 0xa7d6347e00147e14, 0x68a99102a0d6147e,
+	0x548dd469d33400c5, 0x87347e0014455102, 0x690350f851f84beb, 0x2d45481b80a2a508,
+	0x3a0281a3fda0014, 0xb5c7a4f03bb5a6f1, 0x12801aa9d3a62100, 0xc68f12801a69a991,
+	0xa7a4f543000a3f8a, 0xa2a5001440d3147e, 0xb288a9602c5928a, 0xfe527b4c1abfd382,
+	0xa081a2281a3f0814, 0x40310a2045310aa7, 0xc5a540511052a7, 0xf851f8d1f84beb03,
+	0x2d0014558aa23050, 0x289c128002a5182d, 0x3d2ebdc7280814c5, 0x51347ea0070a7fa9,
+	0x3450a740310a0245, 0x8010a853a0b81420, 0x14a30848054ad152, 0xa228008ac28fc6ef,
+	0xa94a2a500000a94, 0x4c000a94a2a50000, 0x8002a028fca8d37b, 0xaa700280ea74033,
+	0x8ad13bbd14004531, 0xa0288ac60f80c25f, 0x1420002d2d149702, 0x142d0500505c0ab4,
+	0x1fc568fd2a054073, 0xe147e347e32f0085, 0x501445e30740e147, 0x8aa2a80350144501,
+	0xa318040a94a22800, 0x405114054081a614, 0x511405018aa22858, 0x2801282e058a8240,
+	0xbff43e03a018c5a5, 0x3f000a7fa93d268d, 0xa3f0a3f1a3f1a, 0xa3f0a3f1a3f1a3f,
+	0x3f0a3f1a3f1a3f00, 0xa0281a3f1a3f000a, 0xa0288a02a0288a02, 0xa0288a02a0288a02,
+	0xf1a300288aa2f103, 0x3f1a3f1a3f008aa2, 0x1a3f1a3f000a3f0a, 0x3f1a3f000a3f0a3f,
+	0xfc00770a3f0a3f1a, 0x8029fc28fc68fc68, 0x288a02a0a44829da, 0x6d008a9662d200a0,
+	0x2d4548015052a414, 0x3f0a80a228da0014, 0xfc68fc0028fc281a, 0xd106dc29fc28fc68,
+	0x52a74d033025454a, 0x35d25223250035, 0xe347e30740511425, 0x94a20d40e147e147,
+	0x5052a4146d004a8a, 0x470150522b457103, 0x2b451b30851f45e3, 0xd44a51dc8029297d,
+	0x3a0a44829da0094, 0xa0f0a3f0a3f1a3f1, 0x2942da001445d106, 0xa368fc68035052c4,
+	0x5f5a3fa4f103a0f0, 0x8cc2e93380c28fc2, 0x697d94de63585251, 0x347ea0030a3f0a7f,
+	0x45814bab14004551, 0x61484b0bc5a52024, 0xd1f80150f89d0245, 0x298a824051f8d1f8,
+	0x50a0142d0560a040, 0x630250a0142d0500, 0xa3f0a7f697d94de, 0x97c24051148d1f04,
+	0x71292e0581a2b814, 0x81c25f0a14054845, 0x4051f8d1f8d1f88b, 0x528000d429508c82,
+	0x81960204a04e81e2, 0xa3f197d607008a4b, 0x50a740310a80a2f0, 0x510a8096168a4b01,
+	0x1f0085bfd41ea3f5, 0x53a018054051148d, 0xad5214a300a8, 0x1f681d00054ad152,
+	0xf80150f84bed315a, 0x150f851f8d1f8d1, 0xea14284601501445, 0x688e9622284000,
+	0x9a3a050128508aa2, 0x386e6993d6096628, 0x324c51472dd9c9c5, 0x303a4f3a3f86bb7c,
+	0xa58865acf61867b9, 0xf8d4c52b4fdbd91d, 0x9ace1fe73b464960, 0xbf14e75e0fe8a1b2,
+	0xf4e79c5fbfc2b623, 0x3f3cbe439f365eac, 0x3eb235e6cbcad18b, 0xea75674d01fbaaf3,
+	0xe3915a7fcab78715, 0xf837bb07182cbf5d, 0xdca308b6e1b198e2, 0x76c793b57eab1c7a,
+	0x90afa9fd75385c47, 0x869d66fa986e75e4, 0xdc48f00814f5173d, 0x24d1fa0b00ac8ea9,
+	0x16e3562d7cea7f1, 0xb237bb7e6afc1919, 0x8f4df1a3e10f173a, 0x52dee269c23f278e,
+	0xc5a4d69d2aea0770, 0xcf4992fb18e48a41, 0xc0573ebea9c351eb, 0x5a7f1cd7e79ce41c,
+	0xab4bf0b03f54b73e, 0x386d2d1ae000fffb, 0xa714296a4e3f61e7, 0xed4f5520de7ff9df,
+	0xddde1fe3e06c03a5, 0xc0ec881f99d281f9, 0xca8f111ca77c0360, 0x8b4c8d519dca38aa,
+	0xf30ce45eb419fe0c, 0xc4375d5a8f4c4acf, 0x748113111c14d1a, 0x1aa1b4e6fa29bf5d,
+	0x8f60cab81e79d47d, 0x3cc78975318eb5d2, 0xe36f66a2eef25f86, 0x16bfb069525ae347,
+	0x5655fe4830dd82f3, 0xf8a79fa92ee2c6e2, 0xabf3cc9653c4f056, 0x5a77ddb83aaab8e5,
+	0x8f621c3c68fce895, 0xc28fa2f10338b6c2, 0xa228008aa228008a, 0xa228008aa228008a,
+	0xa228008aa228008a, 0xa228008aa228008a, 0x1a3f008aa228008a, 0x3f000a3f0a3f1a3f,
+	0xa3f0a3f1a3f1a, 0xfc28fca5f5431a3f, 0x6848ed7129da8029, 0x3a4d5380298aa200,
+	0x3400288aa200689a, 0x14455102502375da, 0x7e147e347e347e00, 0x29fc4e49eb870014,
+	0x3a66829420a80a6, 0xa4943421608aa268, 0x851f45e347015052, 0x48ed7129697d2300,
+	0x2502375da340068, 0xf8510250232d3552, 0x6a4de30740e147d1, 0x3a6d1a00344de177,
+	0x6aa4a5464a80aa91, 0x128fc281a3f4a00, 0x4a4adf4a49eb1b, 0x286e004a6aa5286e,
+	0x1a3f1a3f004a6aa5, 0x3e4aa3000a3f0a3f, 0x3f2ca9f097da63b4, 0x71292e0581a2281a,
+	0x915a5a282e050545, 0xe12fb5c7a5f71805, 0x1445e347e30740, 0x40310a803a058a51,
+	0x81e252a0280c50a7, 0x4051f8d1f8d1f88b, 0x5a0a00a040298a82, 0x1545518a41a04029,
+	0xa5f618ad8f52b023, 0x48aa268fc0028fc, 0x528c02a02846e114, 0x85bf14280a8096e2,
+	0x45e147e347e32f00, 0xed006869a1b81400, 0xd6472900ea142846, 0x148d1f0085df6991,
+	0x5a5a282e054051, 0x521405409d02c528, 0xa5f5517a8f094081, 0xfc68fc0028fc28fc,
+	0xa0288a02a028fc68, 0x510014a574149702, 0xd2e73f4151001445, 0xb5fe4f9fe33969a2,
+	0x4d399dd2d492a44c, 0x4de3cf79c1ec21d9, 0xb52a9e7ad0330e69, 0x3da9b78c71c6d2c5,
+	0x730664d2249baf2a, 0x1c5bc115f0272fd8, 0xaa0439b0e813eda2, 0x11d225b9c8ae2aa5,
+	0xee0e4ceba7cf9ff2, 0x690b8e0a9cdf710f, 0xfae3fdee6f18e324, 0x47b22dc75656217f,
+	0x4a71a5c37f72c638, 0xc283a3a0cfee59ad, 0x88f6adecc6a9ac61, 0xe1607ace4c8c6d23,
+	0x999eafcd6a72f873, 0xf99181d3dd358266, 0x9122162c24dbf1d4, 0x746cc7613e32fe16,
+	0xa595a695d98229a7, 0xcd7a873f27a9b293, 0xb4846c7d52ca7424, 0xe4c0c52ecc995686,
+	0xfb5ac571ee039465, 0xd1bc7fd51937c52c, 0xd2c41d47bdcf0f9c, 0xe48470a4c41a8b7c,
+	0x38e5445aaf500ff, 0xa03f1fc6d96df224, 0x446ec658d11a00ff, 0x5e204983c17c5b52,
+	0xcaeffe18e9fcc0f9, 0x7afc185fdd2d2812, 0x6f8be50e63a589d5, 0xd5faa3501f186660,
+	0x95bbcdee6db14368, 0x233bc539f023995d, 0xaafb649e72e9c93b, 0xfa45c06de06cb925,
+	0xdeccaf916d36051e, 0x257e735f751fc165, 0xb4ca64686e157eba, 0x717d3bc4eeb7cdca,
+	0xf87c90971791a0d6, 0x82fe1df77bf9281f, 0x1dc598b7223b19a9, 0xfc31df8d2315589d,
+	0x14f355caa6753b7d, 0x4f4e92713edacb67, 0xa4995999590530ae, 0xa43e1b506447b10b,
+	0x1832a4f5bd2aaf6, 0xa6c9f58181d48dda, 0xa2a8cbcc6da70e91, 0x502455324ec25019,
+	0xd0061b6c4c55117f, 0xf927893fe7f0cf6d, 0xe35dd9bf7d3ac456, 0xc9ed04a4f929232d,
+	0x47b627a8a89f9eed, 0x90c30e072cb0ddfd, 0x19296304d168a60f, 0x229ee33e2b6b9785,
+	0xc6925acff573378d, 0xc7699b626946fb6b, 0x88f769fce7f9334f, 0x63f311b3984815b1,
+	0xea0c953ec6e3b724, 0x37f3718036515065, 0x6cee32ba618ec27f, 0xef3773ac02a9e243,
+	0x2bfdb8fc70035607, 0xa92b62b34df14967, 0x1fc48fa70cb89551, 0xfef52ac22d5ceff3,
+	0xc69c2a2343851f79, 0xb564344a3f5e9fa3, 0xaedc50f9ae67b524, 0x2448051956e678e4,
+	0xf926a676d759e70f, 0x3e5ce11f78c6753e, 0x6109d208ab6be28d, 0xf4a8f361c153a149,
+	0xd0a82b622d7bba06, 0x3e718e5188a34c7, 0xa9adea00ff731cd4, 0xf830e271e8d971ce,
+	0xe73632963a4efa7a, 0x7a5943cf517a8f23, 0xb61b3369bab7f8ad, 0x5ceb1f3fc64990dc,
+	0x249599672e88d7ed, 0x8feb2f18902723f2, 0x7e3ebb9aae915de9, 0xede82e964f285fb6,
+	0x657d5eeb7134e3bb, 0xa75e49696e93ccaa, 0xbadba5e00ff4f2c, 0x82eb70df05234956,
+	0x749b78a9a85f3f46, 0xf41a3b6ff395a734, 0x92cb17795b3ead55, 0xb6508f6a4792f32c,
+	0xe70ffc29022e6e55, 0xebc8d24675c8f553, 0x92140d817f92f05a, 0x73021c63b34a8848,
+	0x31b82be79b0135fe, 0x8e2de335d68a1cfe, 0x8a62195f5a6db94a, 0xfe1e768eb50bcc8b,
+	0x24552beae9b82f95, 0xa8a2280a71d319ce, 0x288aa200288aa280, 0x288aa200288aa200,
+	0xf80c28fa2f1a300, 0x80c28fc28fc68fc6, 0xc28fc28fc68fc60f, 0x14b5cf2869fd1080,
+	0x4b11520014455100, 0x598a228da803b45, 0x8aa20d40d1bc1421, 0x80c28fa2f1a30028,
+	0x430a7f69fd90c60f, 0x1a01288aa204a0f4, 0x29a911a029a99592, 0x3f8ac68f024cd3d4,
+	0xabf536b1a3f000a, 0x12846d18c02a069, 0xa0288a36004551b4, 0x8fc25f5a3fa4f103,
+	0x8062b4d4481b80c2, 0x471b8062b4d4481b, 0xad1f0234851f45e3, 0x5223609aa6f03b25,
+	0x1aa74d0380a6a953, 0x50f851347e14006d, 0x4b2a0a3f8ac63f05, 0x28460150a740310a,
+	0x85bf14280a90ea14, 0xa2f0a3f1a3f11702, 0x5100d469a1188581, 0xa1f71885813a058a,
+	0x8d1f8d1f0085df69, 0xe252a0280814851f, 0x1d505c0a142de880, 0x45c292e055a0a00,
+	0xf851f84be32fbdc7, 0xc50028508aa20052, 0x14a5b8a0038aa228, 0x315a1fa584408152,
+	0x47d1f80150f84bed, 0xb4149762140045e1, 0x310a803a058a5100, 0x1a3f000abfd342ef,
+	0x2846f1720a80a228, 0xa80c229699502a0, 0x7f697d00a0b81428, 0x1a3f000a3f0a3f1a,
+	0xa0288a02a028fc28, 0x45510014c5289c02, 0x8ac732805c530014, 0xbec84ab7cf201c59,
+	0xbd9f2a3f559632bd, 0x789d5d4151a9b2da, 0x8bab45d1caeb2c5c, 0xd7a42a0efa39d1a1,
+	0x3fb1d0ab90423672, 0xdcccf2f26317abd6, 0xd35e8500fff90704, 0xee03648ef9be586c,
+	0x6b5579b503f6c881, 0xa32f0f9e7d6c7bce, 0x7960edc8aee48d87, 0x1600ffb2bb836a9f,
+	0xd24e6b6b7dd8713d, 0xef55c90b1b4c03ce, 0xac0862950e00fff5, 0x412537abb60523ec,
+	0x71479d3f394ffcc1, 0xfd8834122606da9, 0x25f44851b1c68ff3, 0x496d0243cac52227,
+	0x3df5733bd4fd4c3e, 0x5d4eeb7f2d59dea, 0xccadeaf57f9c41c7, 0x91d1f439a6ee6cf,
+	0x5e67add3b763d8e7, 0xd883671cdcfd165f, 0xb9cccfc6b8c8a1e2, 0x78c6deaf8a117879,
+	0xd97db905aa7dfe1c, 0x35f3e3553ef63e69, 0xe8b4fe1e4f8ec944, 0x75feb9be0d20b7d8,
+	0x76ee488d1daac61c, 0x4782813a06c8f249, 0x9811ee68aafcf7f9, 0xe41f92799c013b3b,
+	0x8d74e658217f7d3b, 0xf897df7e47dc290b, 0xc8e1b79d69864e73, 0x455ae9e933ea995e,
+	0xb74eafa2a5263e8, 0xdd8bcaecc88cb83d, 0x8f0a00ff997ed286, 0xc74879c2fdb871ed,
+	0xcc176beef1877e69, 0xbb2327a9b23b94f2, 0xe692a65e00ffa70f, 0xf3f13d6606aab2e4,
+	0x44eb3d2e3f3d7d2e, 0xb78423ada1e9cd71, 0x6f964a32728aeedc, 0x9165066a6e7f0f6e,
+	0x7eefe73c86b29448, 0x330cad4a9ffe363d, 0x676cc975319096c9, 0xec9f4a3f8eef9372,
+	0x8c84a3421e7657ce, 0x89946a5e6f07fc74, 0x62993b09b3dc57f6, 0xa5c77fd96500008d,
+	0xdf409ecc8f00c92c, 0xd53aca3e29df4237, 0xf2b3b1ed96cf6665, 0xbb54fa713afdbc46,
+	0x9cc201e39e1682a1, 0xeafcd600ffcd5296, 0xd1788196628ccb6e, 0x38419eed4ec47ba4,
+	0x50b54fe407cefc54, 0xe4e6665bfbf60cb8, 0xb06afd3f003dec6e, 0xe58d767c7e6c3eb7,
+	0x81635f852b6ff58f, 0xa6130620248d54d0, 0xa8c23ee7852373f2, 0x174ab23f8c6ddf8b,
+	0xf32307eebbcb8874, 0xd71bea4e757e3ada, 0xa90a49c6e59b1f51, 0x9add4a7f1c897dce,
+	0xfbf3995b2c3c9a55, 0xf5711e5c8fa060c7, 0x5de72d6eda9baafc, 0x3e7296a20a068a46,
+	0xe8374de6aae2fa87, 0x6303ccefb3674d61, 0xb48b122a523f723b, 0x5a93f931508f5bb6,
+	0xb90a6191bb44dad3, 0xe708ba7f24e7cae0, 0x36ab4157dab8aeb, 0x7ff90707307e2409,
+	0x1bcf882da3d9048d, 0x717dc5a6f4af3f5b, 0xd94e752bdfa8ac6c, 0x94c774234fac86fe,
+	0xf67d03ccaa6284be, 0xad3bb59ab3486bfc, 0x94af54f355d76219, 0x73dc9f2678cc7cc,
+	0xe61b82a9c25e51e9, 0x932a3dec514f706e, 0xa8d5d0c7c1cd91ac, 0x187870c4aa72bfae,
+	0x9af9140587b665ad, 0xc370cbc16308f6a8, 0x1befcf2be4d2d49a, 0x3a0baaf003e7a5fd,
+	0xb6ab1857ae6f318c, 0xe7c8556183bc5af3, 0x8f9c84b57efbfc83, 0x1bb4ea4cf4a4924e,
+	0x9e83c3dca9e60da4, 0xcabc6d1e5b83fa08, 0x646bc5f64e1c2d1, 0xcc5acab5fe1cd34f,
+	0xc063396f53997885, 0x5f306b94cd567bfc, 0x276d98980376a229, 0xdb164eddd96445e8,
+	0x83b40f4899f0cd52, 0xeac88f98ad1a7afe, 0x3f7935199b4fcf51, 0x39b10e23f288cc7a,
+	0x352f7b8e6a8f1fe3, 0x217f9eefb0c0365b, 0xa2426ba33ad6a8c1, 0x432e1fd0c8db2ab3,
+	0xb5d3eb718e200fb9, 0x9187cc2f6c63ae48, 0x4a140fa3da23e7b4, 0xc8f1e7eebb8d40c8,
+	0x70db68ee5073feed, 0x5dd7a4ea488eb5db, 0x9adc9878a4ac551c, 0x65484543bf159df7,
+	0x595bd5521c410e0c, 0xfc09901bf05478bf, 0x3e9292717a8d56f1, 0x455198955319b552,
+	0x4501501445214615, 0x4501501445015014, 0xa3f1a3f9a015014, 0x3f1a3f1a3f000a3f,
+	0xa5a3f543000a3f0a, 0x294a006a8f49e12f, 0x6a0288a02a0a448, 0x5114e04e83020d8a,
+	0x3025b55214370045, 0xfc0028fc281a3f0a, 0x128fc28fc68fc68, 0x4a4adf4a49eb1b,
+	0x115200b4699c360d, 0x8ac68f12304d484b, 0xbfb47e48e307b828, 0x5014451b30851f85,
+	0x451b80a219457103, 0xf8d1f8d1f8015014, 0x8aa2680350f851, 0x288aa20d4051146d,
+	0xa629fc4ead69fc00, 0x123035d252230598, 0xc68f12801a69a991, 0x200d4aa7000a3f8a,
+	0xa78562b4a049c5a5, 0x80147ea740511052, 0x280a3f1a3f1a3f, 0x81621400750a14a3,
+	0x9d82b43e4a61a04e, 0xfc68fc68fc2050f8, 0x755a284661a028, 0x4024a853a0b81420,
+	0x835086c2ef146829, 0x205251f8d1f84beb, 0x8a96020028508aa2, 0x28508a9602002850,
+	0x8fc28fc65f5a1f00, 0x50a01445e30781c2, 0x41a02846e9cb2931, 0xd64729008a62144e,
+	0x347e0014fe527b8c, 0x8ad12a054051f851, 0xa94a228005a, 0xa5f50180e252a0a5,
+	0xfc0028fc28fc68fc, 0xa94a228008aa268, 0x5100b414a3554a00, 0x60ac125754001445,
+	0xc610e62e9a64d0f3, 0xe79a3bece9667e30, 0x55e68be45f454db5, 0x2a55d6d43fdb2d39,
+	0x59799d840baf2328, 0x768080345faa4d6c, 0x8f6aaf5abf0e7caf, 0x9f8ef3fe55c89722,
+	0x4c9eb13398ad6ae2, 0x522bfc67fc43cf94, 0xa9429dfbe5db0cdf, 0xc9cdaaf20afbfbe4,
+	0x15a3f0f0e0da47de, 0x2cec9cc3a5b3681a, 0x6fcfb8c7ae7ede9f, 0x101471ab5a539fc3,
+	0x87debc5f018876f9, 0x4448deaeb396b51e, 0xaaf01ffbd48b8d51, 0x73b541cbc7b45cd3,
+	0xad3b77aca94f2f9c, 0xefccc82b5cf38bca, 0x4b5ed53ef7589ebb, 0x3dfcf367bfdd10b1,
+	0x5d6ca7b07b46b53e, 0x1eb791665655ab57, 0xbbe240ad00ffd733, 0x6d201f69b9b8586e,
+	0xa92763335133c21f, 0x718f1a00fff7e03c, 0x1c5175aaf69f136e, 0x366be67fc7b1ba7b,
+	0x526da382bef5186d, 0x75ee2a9d7ffe71d3, 0x55a87962cfc88e25, 0x8e4e017bdc85dbdd,
+	0xff822565509616, 0x5125dcad94befe00, 0x2a0f2262fea16835, 0x3ffd3d90913bcc2d,
+	0x1f3215cbbd0db53a, 0x418f71b5ed708e99, 0xa4fb08a16c29fcc9, 0xfd13bfbd407e7270,
+	0x9417e932b9c16905, 0xabe6fac973b5fc0f, 0x4fc33e64bdc1c5d0, 0x8425a78be5dc358a,
+	0xc090abf1239f7f61, 0xdb81f7af36763f8e, 0x39a2f3d7bb9fe7b8, 0x30ca4748b3ab8f23,
+	0xfe2da0733ba53f4e, 0xf08fefd37d3b7ab0, 0x74d0c74539334dab, 0xc0035448e1ee6fe7,
+	0x9bb47104f5fa3f6e, 0x62831c7f802cc3b7, 0x204db3d4f893cb8f, 0xb8fbf58c547556,
+	0xf339435a55639f7f, 0xefc60d95719995e5, 0x492dd74a73b44aa7, 0x75921c31d64824b5,
+	0x47adbf8eef718009, 0xf1b2b4df21c95634, 0x1996d2d707b98c86, 0xe5282b3145cb430c,
+	0x66f9eb19398e85b0, 0xab5d29602cc7f298, 0x99d6bbed8124cad7, 0x65303a47322b329f,
+	0xa65f78e1329f4d9a, 0xe5beba3d02757e3a, 0xfef5b19b40f45852, 0xd81e4f684df07d10,
+	0xe4cd174e2618495a, 0x61efa76afc75c00f, 0x46e4f34c64b98684, 0x93bad9fe7f267b1,
+	0x42b79bb4b1b4a2c9, 0xede9f39cb2ccf3b1, 0x1b4d6a93979ccd8a, 0x6ccd7d805363eaed,
+	0x4c6958cef58298f, 0x59ebbf27a9cf0d67, 0x4682151a6fccd7b7, 0x7e04787e8008f958,
+	0x18addc27a58ca6b9, 0xc192a38e6cc750b8, 0x96a1260200ff8176, 0x4c4e60cc63e6ad7d,
+	0xa4d5a975803e908d, 0x3f30a68f9b74e7bb, 0x65bc05475c51e99f, 0x3e7e678c832309e4,
+	0x32b41d1754feeea7, 0xf15830eeb49c66a6, 0xc368e654e9e71fc7, 0xfe70a515187ecb11,
+	0x5085ed7848d43b6c, 0xa6485e957e9e337d, 0x9393a36384f8de55, 0xb2193949185aabf4,
+	0x7951e76e45c7e10, 0xeb911c54ee86119a, 0xbc50c531722aa457, 0xe9ada94f1b28ab8f,
+	0xc85c51c6c5cbb3bb, 0x9eab5d95e35a66bb, 0xa0839e6a4e2c8c9, 0x4f35d35f39c18318,
+	0xe35c747681497647, 0xba5885d0b5d6d42b, 0xbee720b8fcbab503, 0x91f672300d4d4d4d,
+	0x8719acad4b4bb24d, 0xba5b73f9811c43b6, 0x78aac8b23615fb6c, 0xffc2197aaeb8c739,
+	0x1a5a713c4142ac00, 0xaee0bc40e216d174, 0x6a0fbd3c577bfde1, 0xa5669a766af32f9f,
+	0xe7ee3accf0b1cb0c, 0xfd20c52bb5fe881f, 0x3fe8859c533112e4, 0x731bc2a3b1d65811,
+	0xce531f4802cbad7c, 0xbbc2928cb5d61c3f, 0x7e5f792ac1536406, 0xdc9a623bb7ac983f,
+	0x419162493903e982, 0xff23d7472e185e, 0xf126424235da55ad, 0xb5d69fd7afc74880,
+	0xa49d1ce6ce489299, 0x9256953f3df3b793, 0xf43c97bd757fc6dc, 0x8ed566b507bfa77d,
+	0xfd1761128aadbb88, 0xdcdb52e77f8f8b4c, 0xe0ba6f309457b82a, 0x6c41f3d4fa23f6f4,
+	0xb03cb800b2727c53, 0x9021c612aa397d2a, 0x87bf8ed461c8bb2c, 0xa5545ea3b6ae00ff,
+	0xc5c5d3966106c7ae, 0xada7d7919834a3b5, 0xe667748f56d24615, 0xc176e1538cf7488,
+	0xc6eaf47abde31cbc, 0x3509a512565cf868, 0x6b26454a31fab025, 0xa228008aa2288c63,
+	0xfc28008aa228008a, 0xf1a3f103a0f0a368, 0xa3f103a0f0a3f0a3, 0xe904a0f0a3f0a3f1,
+	0xa228001ad27a6948, 0xd4489d360d008a, 0xb552522300455194, 0xe307405114055025,
+	0xd40e147e147e347, 0x54049e9a714bdc7, 0x1421250035d25223, 0x3f008aa2680350b4,
+	0x770a3f0a3f1a3f1a, 0x118092d2b752b401, 0x254d0898925a29a9, 0x347e347e00941429,
+	0xa56fa5680350f851, 0x25b55214370025, 0x69fc002829528a36, 0x6a0f0a3f097d60f,
+	0x8db401aa182d35d2, 0x51347e9400d4484b, 0xd42a45315a0550f8, 0x5a4d2af52142d96,
+	0x2a028fc68fc68fc, 0x8162b410a040298a, 0xa0f097024541a04e, 0x280a3f1a3f1a7fa1,
+	0x621400750a14a300, 0xef14280a56a04e81, 0xf8d1f8d1f86180c2, 0x68a1482946015251,
+	0x2d065aa528460b0b, 0xfed2fa0040815214, 0xa22808147e147e34, 0x5014a3704a000a94,
+	0x41a0a5f498144e01, 0xa0f097da63b43e4a, 0x29008ac28fa2f103, 0xa14a300686991c2,
+	0x2f00054a51140075, 0x40e147e147e347e3, 0x94a228008aa22806, 0x2a068d0523a000a,
+	0xf26cda00d429508c, 0x2bd17ac07f17312c, 0xe239d77a7a92d488, 0x7aa6c7dfe55b490d,
+	0x147aa3722951e98f, 0x3c4f6aad4124495d, 0x75e020c10db7918c, 0x50cce78d9615f4e9,
+	0xd0a78eb0fec510b1, 0x61946f77b951730f, 0xad56eb11fe40e1a4, 0xa7fc8cdd2f148d80,
+	0xeea43aaff09fbbd5, 0x848a51d1c2aacfee, 0x8e4895535ee47f7e, 0xedf4e9017ad5ddd0,
+	0x3f1271f8bb453ef, 0xfb71bed8a9ad6aae, 0x7279fe6a8f5c0cd, 0x11dab83d5b3daef0,
+	0x281c033f3f314d2c, 0x3bca4fbb62b9a6a8, 0xf4de0736bbb3abe2, 0xd5fae4c0a9dca4f4,
+	0x7d361fe34d629e58, 0x3e9e946ed169fc97, 0xf7edfc7785a2d651, 0xf8bd2bd4ea3de349,
+	0x16b491a9f63cc7c0, 0x4b2eb00d080a7b97, 0x79b043f24fe95174, 0xaf8cb0780a72a09,
+	0x4746f67e4eaad821, 0xc0c9d5d37af2bd1b, 0x6eb302f40fbabff9, 0x573b17508f7bfcc5,
+	0x6d43e8d4fa7ffd68, 0xaa58d37b7adcc0c9, 0x4774fe9ccb9ec7f0, 0x27e33a703b952021,
+	0xabf29add59ad00ff, 0x5750964c8e65a396, 0xb32a00ff3afd18b9, 0xfb3eceed7a5bc60d,
+	0xf2739186acf4c7f3, 0x53d0cf7f92e95b82, 0xec9fc8c84b70e591, 0x1969b57efee3479e,
+	0xa43c96af998da5ca, 0xb8cfc051c9d8ce8e, 0xa43385c5f91691d, 0xfcea00ff3112fa32,
+	0x1b49c4258e373eeb, 0xfe3bae8f1c2b1c31, 0xe3e6369193646135, 0x43c7d5f8abb05838,
+	0xbecb5b69eec96d96, 0xf52cef7d9c4ab26d, 0x6b8b55c85f37ed3f, 0xc933695467dfac80,
+	0x98acf19fdce7b80b, 0x79231c6bd5144e4, 0xdb955aafa7ffb00, 0x58ce3d536321493,
+	0x7489946aea830efa, 0x9a41ee51db1af1ed, 0xe871372ecb419265, 0xdb10c92235c70f7b,
+	0xf483174e9202f319, 0x2723cf1159b1fe1f, 0x7f60232ce3552494, 0xfbaa9eb7cc7af55e,
+	0xfb3ee63e2bbc6d63, 0xcfc6cd4caaf5e340, 0x752b9266becf4c44, 0xfd3f7e4bb0054f42,
+	0x2eae81ac2275af7a, 0xee6199dec88089e0, 0x7f1d892357e9f507, 0x7ca571b67ab587c,
+	0xc693ad0a557ecbf5, 0x325023c679d91856, 0xe0105564fe3cde7f, 0x79a67c173982b854,
+	0x7ff3eb13f964ea40, 0xf64018c512ec3385, 0x39e616c57606c6d1, 0x6f00c3daaafcf5fa,
+	0xb13be83ec80e1432, 0x1c27491d552466f5, 0x708d948d24ad74cd, 0xd528403fc9b33d0f,
+	0xd2a4e5a552c76891, 0x1d668093c39076a0, 0xea2e6bfcc0b8fb47, 0x19c1c14dea7de3dd,
+	0x55afa9750c3fb5d9, 0x6c2df34bb328bad, 0xeee61a2be83f3f30, 0xc78c6a4a99b58f1,
+	0x636ed42a9ee1474e, 0x2817ef973489f13a, 0xdf76836c1e2fd388, 0x9abcc95a3f7054f7,
+	0x34a92764c8b39c79, 0x53afaf5fce075d92, 0x5aeb07d0aee39e54, 0x6a2d2a46fc3c9bc2,
+	0x3de723b9a84e5cc7, 0xfc839fa1fd50e980, 0xb12982e9552626a9, 0xc74a4257e44a5ea9,
+	0x42137af41cb53a93, 0xab3900fff96e7480, 0x399b9147b6eb8d91, 0xd8338e3a105635c9,
+	0xaed361e50301b78a, 0x706a989d6dce8a3a, 0x99e5318e365689ea, 0xeb29fcde77c3fb17,
+	0x1f0100ffb1956f30, 0x689aacad5631fcd3, 0xf8832338233080f0, 0xb3b28ccc3b0d34f6,
+	0x8afaa91c56e68392, 0xbcd2602f3d759dc7, 0x737cc7b6fc2dba0b, 0xc41e49dbc246ce86,
+	0x865a176dba66f8f1, 0x52f528ce18a45e6, 0x2bf2f9ab1ee33659, 0x6506b13400573687,
+	0x9ecbee47c3a9585e, 0x723c716bb14abf47, 0x233800c02885340f, 0x262853e9477e7adc,
+	0x58514f3d3813476d, 0x673c98825b3be411, 0x78ab3b6a7d7bdc83, 0x74e40cb33aecfe8a,
+	0xae7124ad2eda73cd, 0xee4105b7f01fdde7, 0x5882a1ebfcadfb38, 0x8c673e0c6d5bcb67,
+	0x94e65a4f8f7b0ef0, 0x93625363358a3d5a, 0xf3f36876766d3243, 0x43bb6afd3d700648,
+	0x39483d2159d8d22e, 0x8a69d19af047dd5e, 0x1df1d7c78ec5c44c, 0x444779562881bea,
+	0xe30ec0d00ef73773, 0x3c4c646a9bceaca1, 0xe627787091a11499, 0x4194231a7f963fc8,
+	0xb13435989e43392f, 0xc0c0bf3d1e2e2ba2, 0xcd1b55cc4f4f3f6c, 0x7d7dfaab7b8a8cfd,
+	0x3326e71e9c354a2b, 0x912136b5bdf10a03, 0x599dd2d73d385e65, 0x1ce65b76bfc55c7a,
+	0xcd4762a3b422750c, 0xd6a8f61a00ffb1d3, 0x1e9e60c781cf8de7, 0xf03cb7a228ea88ab,
+	0x288aa200288aa2, 0x68fc68fc00288aa2, 0xfc68fc0028fc28fc, 0x1a3f0128fc28fc68,
+	0xa228004a4adf4a43, 0x9408d14cd28008a, 0x9662d200a0e81d45, 0x798a2284a009a90,
+	0x4ce147e147e347e3, 0x8f49e1774a5a3f04, 0x6a06829424a006a, 0x80a228da001445d1,
+	0x1b0128fc281a3f0a, 0x1774a4adf4a49eb, 0x6d1a8029a995921a, 0x8fa2f1a30068d338,
+	0xf4ad94b4be1180c2, 0xa0a4568ae206a0a4, 0xf103a0a4564a6a04, 0x6a0f0a3f0a3f1a3,
+	0x8a903600c5289ad1, 0xfc281a3fda80295a, 0xa840295a0a588129, 0x851f8dbfb43e8066,
+	0x8002a5280a20851f, 0x81a205a040298a16, 0x1a3f1a7f2150f84b, 0x750a14a300280a3f,
+	0xa200a8d342310a03, 0x5f5a1f0052f84b81, 0x45310a428ac28fc6, 0x813a058ad102d02a,
+	0xf80b81c25f0a1485, 0x150f851f8d1f8d1, 0xb4142006ea142846, 0x28508a9602854051,
+	0x97da63d2f89d1601, 0x10288aa2f103a0f0, 0x538c02a0a518ad52, 0x2880a277140045b1,
+	0xa2f0a3f197d64701, 0x14280a80a2280a80, 0x2a0285a0a00a0b8, 0x860204a0a5f5528c,
+	0x584621568a930c20, 0x442bdeaa933577e0, 0xcfd571702aacc4ec, 0xaf4c2ec2c56ea9a0,
+	0x4e60bec8a600eaaf, 0x2bd7d41ff4f1fe00, 0x936309ccdc649933, 0x94c5ae8c29b556e9,
+	0xfd91fddb01b4d12e, 0x73e667c29749674d, 0xbc3dbb923aaef481, 0x98476d167b153525,
+	0xacc2beca0f70525a, 0xfc711d2372ee0646, 0x1ea0d7c736c605aa, 0xd2e90112b22fa682,
+	0x8e528c7ecf7625b9, 0x95fed481574c93a4, 0x82de6e3e902d9612, 0xc9523c00ff9653a2,
+	0x8d42534f9d763f26, 0xa02a8d64f5a57d8d, 0xbe9bc2a7f589bfda, 0x4f1e428da316fc76,
+	0xa44ebdfe9ffddfcd, 0x8d00ffc261de078e, 0x442611bf8634b44c, 0x11a968d7e3ceb96b,
+	0x5f74d0ebc8bd415e, 0xdc39df7c311c35f1, 0xbf0887cd4ab54fdd, 0x93b0d6071d856333,
+	0xcc1ef6ea2d4675ec, 0xff7800ff6aa33215, 0xf995b161745a4f00, 0x9982fe88e5677537,
+	0xe4a7f2cf4899b3b1, 0xcd4a8fc700ffc86d, 0x50184124bb0b9d, 0x6d4148d2e049eadd,
+	0xc25f07ce731148b3, 0x36f06c713ee356a3, 0xe6411c450849050e, 0xeb72940efa61571f,
+	0xbbf6ca416b9b12a9, 0x7bfb0078eef8cd4e, 0xc7a485859110e1d3, 0x79b122b57e60d252,
+	0x35069653b110a57c, 0xd24256b99f02a93f, 0xfa7faaaaf08c0acb, 0x921f1bf38b51a5df,
+	0xc108dcb9f924da01, 0x7e6210abd4fa59fe, 0xa3f4f8f3a5fbc752, 0x7980036d294606ed,
+	0x5a1f20723fecb2c, 0xb02a7a2e729e2af1, 0x46624b93181a00ff, 0xce335220ce6db9b0,
+	0x7f0cc752edf30378, 0xc6b87c9e32e0d6f2, 0xc3645991a0d67717, 0xe04fde0925786af9,
+	0x58666526d5621539, 0x5200ff1c9c3c9582, 0x6822a95cb9531c3f, 0x83e048481c8069c4,
+	0xa1a9f24fc6411f9c, 0x38cc57888b006395, 0xe6eb00fff1275b25, 0xeeb6e1e37f5589a3,
+	0xa42639fd5800bce9, 0x381620b60a57e159, 0x7e9c1cd0377755dc, 0x1256e6484c724615,
+	0x3383a17062285331, 0x9166990a3fe8eb01, 0x9cb6ddfc502cdb21, 0x6a30958a92543fe,
+	0xf6791b380e284fe6, 0xdb987b44c894fec8, 0xee816ca761b4ad40, 0xe910f3692e3f1e4b,
+	0xdf23028cd7bc16bb, 0x8127b9271c009d2c, 0x9e2126ade24bd5f9, 0xcff97d3236c3cd20,
+	0x72f90a6f4b6a52eb, 0x44ec5cc8edd3b4dd, 0x85e443abce5fc7f7, 0x442866b9d98d4081,
+	0xca48a9c69f3be863, 0xb9bdf595226f37a5, 0xb7281f6d378d75b6, 0xa83957d893fb331f,
+	0x23bdb1c9da6edb59, 0xb1a8565d93d08725, 0x492cd9b005cbdb18, 0xd02456fa768f7d0a,
+	0x6d906fb864b31899, 0xd156fbfcdb830c20, 0x2ee7d83746eaf36c, 0x876e94c2cc57d5ad,
+	0xa748d475565c0ffa, 0xbc83d5d49a7abc28, 0x3f39388ea448e6cd, 0xcb35933fd42eef8,
+	0xf74e6fbdd3dd4046, 0xb721b28b525adc3c, 0x524664dbd53aeec6, 0x565c00ffcf936018,
+	0xfd6a46c66dde1f72, 0x2a3deaa0b79d8eac, 0xd1e8452a617326ea, 0x11b451d66e3f4d6a,
+	0xdbacdc864eedf39f, 0x8f3d0eae67600465, 0xee5b53b4a5b115f9, 0x7fd49f543200b25d,
+	0x2c05f7f258dabe5a, 0x2fd7547dd0cb9d14, 0xbc92d3c3517bea3b, 0xcc5d8a012c149a4a,
+	0x76843ec9091982af, 0x904419731ad67a6f, 0x3dea38a62395571e, 0x8abcb5d8daabe639,
+	0xfff0e3b15f25b9, 0x865daed98ad903f, 0x636c3928700741ac, 0x28a7309d2b874a9f,
+	0x5ffee8c8f0e99ba2, 0x7da6b7fa2b7c2493, 0x18f4d6cf1a00fffd, 0xec5cc74f103859e6,
+	0x4dd77bb6a74ff67f, 0x387e572e9803726f, 0x3ec43ff529783f56, 0xc7335a93d858adbf,
+	0x42ccbfd1fcd448b6, 0xde4c9b4aad9f00ff, 0x7e78f3a88e547878, 0x7061c6054b6aa7d5,
+	0x6576f1cfa8d71d70, 0x8dcc6ed2a86bfcf7, 0x775b751f30ddbffb, 0x456b3dadb8afafd4,
+	0xa762feec07b3bcb5, 0x77aeb8a78f775edd, 0x9ef2cbdbc4042fec, 0xfcb93dfd8ea0ee4e,
+	0x25675e5352d28a7b, 0x3b868eeef330353a, 0x5040373f1798eec8, 0x3c8bd4faea00fff3,
+	0xaaab2097a548dc96, 0xfe03ee01ebfd3df2, 0xe71e3a1f30950ff1, 0xe92e7dadf5f95ea7,
+	0xd85275fa3e46ad2e, 0xb5c7c6956ba667c3, 0x16f162b927c99c0a, 0x331e829723653374,
+	0x634a1137aab1e380, 0xfbd07185035cd505, 0x77f17e8a89b8cc55, 0x1a00fff99d0c0f72,
+	0x30c2b111570c6bb1, 0x5e6f9f5c4966f96f, 0xccb9af8c371aeabd, 0x87fc9858c21c8dca,
+	0xacb5d2c34fe66324, 0xdeda09c6df65566e, 0xeec4f2ae58ab9fc6, 0xda65bdc75f46bfda,
+	0x2231526f433691b7, 0x4af26be174a51f63, 0xa3b77f19e7e419dd, 0xf971fa36f2ab96ce,
+	0x1f3827e09f91291a, 0xfcd0d3f6fa14f529, 0x34a328867a5aa4fa, 0x1405405114851955,
+	0xe147e347e3074051, 0x47e347e30740e147, 0x1ad2f80940e147e1, 0x8aa228001a527b5c,
+	0x128026a4a5082900, 0x364da99102a0288a, 0x8fc60f80a2280a80, 0xbe1180c28fc28fc6,
+	0x144035a4f6b894b4, 0x9622a40d40318a66, 0xf80a2286942008a, 0x46000a3f8ac68fc6,
+	0x38092d2b752d2fa, 0x344d01346d1aa74d, 0x7e148d1f054049ad, 0x4a3fa5a4f543c014,
+	0x4d53a7a446004a, 0x8d1f0025b5525223, 0x3600851f851f8d1f, 0x454b11d206a0288a,
+	0xbd0228fc288a3600, 0x91c25f6a8fd1fa28, 0xb40a214551347ea0, 0x52b4945e008a62b4,
+	0x1f8dbfb43e60a0f5, 0x558a621400851f85, 0x168056298ad142a0, 0xa2f103a0f03b058a,
+	0x142846c1028ac28f, 0x10a853a0188591ea, 0x5a1f0028fd2a4551, 0x8581c28fc28fc65f,
+	0x68291d00c568bd14, 0xa5682900b440eba5, 0x2fadc7d1fa808102, 0x8aa2f18340e147e1,
+	0x10245310aa70028, 0xa028005a5a282ecd, 0x49e32f2d0014fe52, 0x15014450150f84b,
+	0x511405409d82b44a, 0x1400454b318a0b40, 0x34a2d40d154d0e64, 0x63d297dea2f7a2c,
+	0xec373b99f40dd995, 0x81b51ee11f333750, 0xf848057c3e095dac, 0xf00fff7a9af0f85,
+	0x8591c0c87dbed36a, 0xffa747cdf47be6c, 0x43f8e3669db9def3, 0x482aaca9afcff364,
+	0x26a70bc5ee4ea1ef, 0x5bd2faf48cb39b40, 0x547b2adf0ed2c89c, 0x8855e058cec8934d,
+	0xb25c710c3b0a28d4, 0xbe808c257711aa3d, 0x6cef2399d2a3fe9e, 0xaa05ed00cd468e0a,
+	0x91d02d7dbecead2d, 0x1be1d3e4a9f2dba4, 0x47bda74f9f7b807b, 0x8ca5d2d7a79ef302,
+	0x17995a6f0ffab80e, 0x1fa7fc546832bb0b, 0xe76734f53ef52fee, 0x8f1f78bef1b79cd8,
+	0xfb313f453e0c33ad, 0xe58300a0aa54d0c7, 0xd133096be2df7c5c, 0x33929f0424741da7,
+	0x3212aab4fe26fe85, 0xced9a8b9cf011c14, 0xc2bc539cfb84636, 0x6365ad4f3d39170c,
+	0x4c92450dac39aab, 0x5f38711b69544c91, 0xb42f2afd74f93172, 0x857fabb73711b62a,
+	0xfff9cd3c9f24972f, 0x339f32c6964f4100, 0xa5d5f229aa1358ee, 0x8e7b82b43ec6ef63,
+	0xe3a83823c1de3e4b, 0xd0d4dcc352968b0a, 0x724c478d95b829ef, 0x4dea93e6205a0a7f,
+	0x5a41e376139ec6e, 0xca1cc5b39e269f1f, 0xf3274151f9c18103, 0x63b33263b244dda2,
+	0xd98a5aad7f2e2403, 0x676c444f2095df4f, 0x1292e5a08b2640e8, 0x3d8fa0b06d6579de,
+	0x621523e07f92cd0c, 0xea0e12bac0631119, 0x8942ad7fc15f00ae, 0x39c64ba3e4cd246f,
+	0x5a3ab5feb83ea86d, 0x31a43c384a12a922, 0xa6286593e23b7d9c, 0xc1769ffd5a2cf6ae,
+	0x57fdaee24f5ba12, 0x58e628e69aa6ce3f, 0x52a74fc7643f12d3, 0x720de3c95755e14f,
+	0xb9c73fc2c4ee83c8, 0x8d18a950974e8d3f, 0x281e7ff21cf701d4, 0x92b4117ad27b4556,
+	0x65acf0146a7121c9, 0x56313fce535fedca, 0xf8705b63bbc2c345, 0x404d0ed8e3b8cefb,
+	0x3ba7aa2a89596ecd, 0x4752fae9b0cfc900, 0xf3716814c118f92e, 0xe12287deebf70431,
+	0x93ace05a2e593d0b, 0x8fb17c1223b3cd4a, 0x91446d55fef9eb41, 0x3be3a0105c20912a,
+	0x4936a85a3f3db14f, 0xbb7fba8f63fe8022, 0xed28e46ae007f0f8, 0x81030932607e89f2,
+	0x1a3589687d3acefe, 0xbb085b8d2093215a, 0xb3d47312f3cd2cf9, 0xd9edc8547efb1c67,
+	0x1072dcb87c3286db, 0x97d9945e7fee769c, 0x3140c89a0f46c375, 0xf5033cc91d961826,
+	0x6f366f215169a7e6, 0xda7fda016a2c249b, 0x19359c682b3dc163, 0xfbc25b22c192788f,
+	0x3dbee340ce9224a4, 0xa638deea362b3e3f, 0x1828cf2c47154a12, 0x7a6ffd3f6303eec9,
+	0x3167790909b5b8d9, 0x9f3eb14f1d6edcc8, 0x1183f3e12d6eb3ca, 0xc977ba18eea7481b,
+	0x9cce33d99afa3827, 0x4ef9478a0675305b, 0xf9e300ea03c742ef, 0xabfcde3703d635d6,
+	0x4b6413988757c46f, 0xfde4b1fa178446dc, 0x9f1fb08ae1b99f2b, 0x4de552713835ac35,
+	0x97d6d6bcc4292b75, 0x9fb436c8b1c6521c, 0x2f61ad9fdbdbc92a, 0x24c9a6a975fe8c2f,
+	0xee5f78acdc566d50, 0x97849dc7a6da5a9f, 0x10ba60be696ae4bf, 0x6f9c036c85bb3cc6,
+	0x3900fff4f548f823, 0xb0d16677a3db34eb, 0x7684fb051c8ef245, 0x59b872c538eaedc1,
+	0xe31cc3ed7c435926, 0x4f6f6baee73fb107, 0x7c2ceb8e9e274d32, 0x48723ca1a3c439ca,
+	0xd1679a1cd73b5dfe, 0x1bcce9d4ba928450, 0x56063ac66eaa90d5, 0xd32d69e4cf3fa603,
+	0x2c00ff61b84600c9, 0x45dd9e3ed97f9edf, 0x12dd5aa432b5d350, 0x5450af7a2e974f06,
+	0x8d8b0dfab9dd1ef7, 0x991f4d4e11222cf, 0x22f4c80a3f5e8fdd, 0x574e95194f4457d3,
+	0xa363dc5b90e38c0d, 0x69932239de8a3a7f, 0x519f03480e1eb4df, 0xf283baa4c8e4765a,
+	0xe71f3b70fde140f0, 0x27179e358242dd51, 0xdeacf46148c2ce39, 0xc41d1bba71525ce7,
+	0xf7293f7013592089, 0x3e2d3553fc3edd3f, 0xa39c8feefbb551d7, 0x5244efeb6f656da3,
+	0x27d18689811d6006, 0x7b3152fbbdbdc14f, 0xbb364e59608ec54b, 0x4fcd18e3fac03e2f,
+	0x6b753b4752e44333, 0x496dec6eeb162c2c, 0xbc2d6db669ec43c7, 0x1ed7119cd71b24cc,
+	0x96e896ae18f5a3de, 0xf0762632bc22920c, 0x75b0d6e7df6e1f77, 0xc2a4d9e2b66b535b,
+	0x3d95719c4a4e18b0, 0x7da556edd600ff73, 0x8882866ec34da5cc, 0x60c074a9904819ee,
+	0x4313555a5f3f567e, 0xe1fd617ef2155126, 0xe186beb2cc4a3ffe, 0xe04ce44edea9d011,
+	0x738baba1e3f7559f, 0xadfc64240132a8e5, 0x7a332b899ad8579e, 0x7057bc9246575273,
+	0x3bf2dc7ce456d89d, 0x58c8826dd5c37a1f, 0x667badf51c07ac02, 0xfbb96e865898e386,
+	0x37423d6afd91ebcb, 0x84c3a93ad491069a, 0x754757c65a2f7fc6, 0xb6ed2ce68915a1e,
+	0x957a3ce36533e547, 0xfdb26345460ea435, 0xd5a39e321f64e99a, 0x677f9c1d94e6b7d,
+	0xbf06d65e516f9407, 0xd73288073ef72c3c, 0xfff35f8f569cb342, 0xe603bda2285a3200,
+	0x50144541a0288a82, 0xf851f8d1f8d1f801, 0x51f8d1f8d1f80150, 0x1e9792d6370250f8,
+	0x45519400147ed4, 0xa52826004d485114, 0x68d3941a29004a6a, 0xa2f1a300288aa200,
+	0xefd49ac60f80c28f, 0x80298aa200689ac2, 0xad94d40898a228da, 0x147e148d1f054049,
+	0x21b5c7a5a4f58d00, 0x8409bc669d300a0, 0x8d1f054049ad94d4, 0x25ad1f02ee147e14,
+	0x4e9b06609aa6f03b, 0x4a6aa5a44600da34, 0x6a0f0a368fc2800, 0x684651dc001445d1,
+	0xe30f011445d106a0, 0x52a04945e147e347, 0x289c02a04e414aaf, 0x697d94de630014c5,
+	0x94a228000a3f0a7f, 0x80a24ad15200040a, 0x3b50fa28454b01b8, 0x50147e34fed2fa80,
+	0x1a4f4728a621424, 0x285a0c699592d64b, 0xe347e32f0085bf14, 0x4e8162140045e147,
+	0x8000d429508c02a0, 0x7f29bd001440d152, 0x455148d0527b4c1a, 0x540518cc2290c14,
+	0xa5405118a853a018, 0xf8d1f8d1f88b04c5, 0x940815214054051, 0x521485018a62144e,
+	0x5014a3a50580e2a8, 0x408c34873e374501, 0x2b57ae34007d8ee5, 0xdda8d6d70b031f09,
+	0x9e741f295806f331, 0x3b83f294baa4e69e, 0x3aeb3de8616f8bbf, 0xb90e33149eaae0f2,
+	0x49396be2cf3faafb, 0x8a72ad9eb2a9141d, 0xcff3d453e3587919, 0x9b2c43e666aea97f,
+	0xc1a4faab009e8cb1, 0x5413cb89b943cadb, 0x935ce56f391e6adb, 0xbb2a377c587b76a9,
+	0xa6c0c3dfce67d708, 0x74b7a1771c381633, 0xea0835f7a469ee73, 0xca9f63f7834e4b93,
+	0xe8a94f4ee1337791, 0x95defb281f1f192a, 0x6fb9999f14464a26, 0x847e97f6331645f6,
+	0xadda830354193ed2, 0xee457ba81711946, 0x3e3266a0d8abdec3, 0xe77db30c4c5b853d,
+	0x70f4d87bca0afbe4, 0xfa4885b064de6ff1, 0x19c1559a7aef6fee, 0xc99687e93da903cf,
+	0x8c93460a7b600438, 0xb95aacf50f1d05e4, 0x2a9c4622af28f3e8, 0x882a7fe438090692,
+	0x9fbbdd8d18efb79c, 0xff7befd301d29ac2, 0xe5536eefb0299e00, 0x2a636cd434f5dc3d,
+	0x1bf88833932b4dae, 0xec0a853fdebf2353, 0x6972c83fbfef757a, 0x5393fb1c8b05b761,
+	0xa8f5f51913f940c6, 0x1bf42de734d24872, 0x86bd2846baeb6e1c, 0x18bd52356255fe40,
+	0x246a9afafac0538f, 0x83fef5c0e69bdb6e, 0xe1e4c32853af00ff, 0x52c60afab10cab47,
+	0xa2fbe717b2d2e93a, 0x382a8fd5421b0f4e, 0xeff67400ff55e7db, 0xe6ccbe8bc5581d3,
+	0x626aae7f3bb157ce, 0x2a3c24ef47657104, 0x71bb25fb76a35e9a, 0xf3ee3e6ac458c131,
+	0x25ab39fc007e0fb8, 0xe6c6716ce2ba0d64, 0xa36d5471bce8bb09, 0x5d37f7389ebbdab9,
+	0x1114eb29fdfc23a7, 0x8ccffc9c99b5fecb, 0x95cfd0573539f3e7, 0x222f8e6f239dcfb2,
+	0x4fee39ce54096e35, 0xbb7023ee55ebf124, 0xb8cb8765c430d9bc, 0x3e8967a4c27fa6e7,
+	0x1c1812aadc329555, 0x9532d2693d100077, 0x3b6e5bbc8f7636cb, 0x6bbc6277c3b41e63,
+	0x2a3fb18498af7014, 0x5888d5fa07fe9ce0, 0xe65fcad7810a090c, 0x76d562bb1ca67a47,
+	0x2a3dc36f96e4eaee, 0xfe95c5be3f02bccd, 0xce4f00ffd8fc38f6, 0x2df62a46a99acda2,
+	0xacfdf6581883247, 0x8166294fbd03f4a7, 0x27a1f2196604928c, 0x843054f9ef48b677,
+	0x65f5aa84222e3249, 0x4b04462c4eedf6f5, 0x801e96dcc824b9f2, 0x3977455a019cfa77,
+	0x168e59b7856c496a, 0x720b8a1d8cf11634, 0x66f55e0ffbd4717d, 0x150c1db852a3a42,
+	0xefd29cfa45a7076e, 0xee7630420691aa0a, 0xe3dca2f4491d8ff9, 0x30868ccd50b842b,
+	0xc4997369059e00a8, 0xd26c092cb24dea86, 0x5f8fee9f9d59c8c8, 0x7856502b2bcabffe,
+	0x5f4a73e3d09850c4, 0xa5d61cddbf3dee81, 0x572a56062bde5bca, 0xebd7533f6f245571,
+	0x64657a3a6aabded3, 0xe31eb10c8f540596, 0x31d32a9efa7946b6, 0xb920db0b39f45b9c,
+	0xc7ab48f363762809, 0x1a41de62cdf44fe0, 0x55fe3ca35ee607b7, 0xb2bc0274c9506ad8,
+	0xbde88b23706f7a48, 0x5bd13758ed71d0cf, 0xc82979dae418ca29, 0xe1d8096da59fde1e,
+	0xa50d8cada3d461c4, 0x587a5aef7990c264, 0xe3709f4287cd0bd9, 0x8b880c95fe19cfe5,
+	0xc53186f949e57636, 0x94b18cb51deb696c, 0x431f6e6c94e91c0d, 0x574a5bedf5eb78e8,
+	0x28a251e3a2d0e489, 0xf60067fc49e6ad72, 0x198ec8e5cba2b715, 0xb5fef8ed75196997,
+	0x3fcb272918e5dacf, 0x24d4acb6d2d3dfc2, 0x798ee1a6bc1d5862, 0xefd134d7faf4664f,
+	0xb2a5da74ee28aa61, 0x30a4c876281e6e4d, 0x7e1cd0f17bdcc871, 0xd64690ba4da3f107,
+	0xf9852b0698e8ea37, 0x9ed4e43fb0a72348, 0xb6cae6d9af05951f, 0xfccb9f6724879bed,
+	0x8f392677a1afa9f4, 0xfe60fc5e65e51bcc, 0x3aeaa15f58ebcf3f, 0xb0d5e696b50f697f,
+	0xb8f2319d8fe5afcc, 0x6244bd4a77951ef5, 0xe1a7af984f220f58, 0x5b98e46886ce1afa,
+	0xfba0b20dc2bbc45e, 0x6242ebcb1f41aec3, 0x64dc38dbf79bcc08, 0x2af5a448e801828f,
+	0xa91579aba1df912f, 0x5371033616129267, 0xa1866ef24fa6e7ca, 0x28d421e66d813063,
+	0x51e78ffa1807e4f2, 0xe4e3c1016d91ce59, 0x920a00fff7753860, 0x202495315f1e5370,
+	0x37a8f4e9f89f0efe, 0xc08996806e09dd5b, 0x3da80f3bb7f0af11, 0x68d97d7b32bdbf87,
+	0xfae58384611409d8, 0xce054b8363afcf9f, 0x8fca1158a5fe0c23, 0x645902f75d99a9f0,
+	0xb8fd9e911c15e48c, 0xf5a72bea669b55fe, 0x59d4b3a0c5da71e4, 0x291f86e79020528c,
+	0xb7d6d43beadf71cf, 0xbe4f8e6f9c855cbe, 0x3a00ffeb00ff3970, 0xb33a471b4d42d5dd,
+	0x1ff9ed9403e5fd22, 0x56927d50f772b5fe, 0x2b0991e5c342430e, 0xd6d0edd8c21fd98e,
+	0x633f9de3cceb5caa, 0x3924dc319a85af3b, 0xd1fcb4cb902bc078, 0xdad7b5fd2a7d509f,
+	0x7500c1f8fc1b9b07, 0xb38dacacce15c1eb, 0xa3a9f6a847e54076, 0xf183d152343dab8,
+	0x492ba5ecd852d6d0, 0xdb005dc603e15233, 0x6599dadfd383b29c, 0x913109826322da29,
+	0xef91f9b298c68ed8, 0xec9b47ee4afc356, 0x4a63c775583b6548, 0x5818e69a694e4785,
+	0xbafd17d2feeb0e2, 0xed549d220f425fef, 0xc0f0fa7e1d463266, 0xa4afc83058711577,
+	0x3063949f299e53a5, 0x5a511405ab51a3f2, 0x1d0dc711445619c, 0x740e147e147e347,
+	0x40e147e147e347e3, 0x8f49e1776a4de307, 0x460a80a2284a006a, 0x80a228da0014a3a5,
+	0x5102503a29ea280a, 0xe147d1f851001445, 0x4de1776a4de30740, 0x3600454b11520034,
+	0x386d1a802929528a, 0xe147d1f8518069d3, 0x4de1776a4de30740, 0x9aa64e498d0034,
+	0xfc2801a891961a29, 0xd69fc04a0f0a368, 0xa446003d0da93d2e, 0xb5525223604a6aa5,
+	0x50f851347e140025, 0x360025a56fa56803, 0x4551b4012829528a, 0xb9a54a014454300,
+	0x5729004a2fa72846, 0x7eb80285df2948eb, 0x14a3700a03455134, 0x51008a62144e0150,
+	0x28fc28fc68fca5f5, 0xa94a268fc00, 0xa50048a4e252a0a5, 0x8fc65f0c947e95a2,
+	0x280a80c28fc28fc6, 0xa0142d0540a0b814, 0x60a040295a8a0150, 0x851f851f8dbfb43e,
+	0x46e1140045511400, 0x22d2d149702a028, 0x8540e12f055a0a10, 0xf097d20769fc68fc,
+	0x5aa52050144561a0, 0x5c0a1405fa404b31, 0x725284343b052150, 0x1f470303ab485107,
+	0x192aee88914d93c5, 0x9154eab391f7d926, 0x493d3c45e796e650, 0x957ea6a3eace24fc,
+	0xff9cce5d6cf20c, 0xc9ad766d5400e70a, 0x4635fe31321d5799, 0xecd88d7b171ceaea,
+	0x349d7bacca5973a4, 0xee12737fb1be53f0, 0xb13b3d059c1182e9, 0xb724f970b12e56fa,
+	0xf29a0a3ffdbddecc, 0x26b3a2b0bda522e6, 0x5c713a6e31b7316f, 0x5d4984a3d973a9b3,
+	0xc64f2edca5d7f2b, 0xfe29709c99a66eee, 0x66a8b9e7e46d1950, 0x774aadcf516d5491,
+	0x1968790527b9d8, 0x4ce1c7f3920cd512, 0xada9e3224d36cb91, 0x9624da6dd6094e14,
+	0xdbbb42acc6dc69e3, 0x8e04156af2783f68, 0xe7002ef241ae2647, 0x7a8287d199940638,
+	0xaff2331b6897893d, 0xb061e5b4ecd1fe2f, 0x9651a366fe58f2bb, 0x301e3267a7059cdb,
+	0x3b683d92b0d2dfab, 0xe49db39bc4d65f7f, 0x397fc79ad2231963, 0x7d2f3f780043ef0b,
+	0xcf018625554ee3bf, 0x4004b4bca3b15361, 0x498102335f13e30, 0x32daa03a630ad8e7,
+	0x65c6593896e27acc, 0x9bdd874a4ff80323, 0xc8cb48522bd23646, 0x4f4dfd434f0f4ebd,
+	0x9ba97dbb485c6c12, 0xbe00ff667eb82f96, 0x1c4f26cc5d4fabf, 0x233af4f564ad3fec,
+	0x812accfcc9ee6e68, 0x9c1b1a00ff6d7ac6, 0x509393c4fb2f7f6f, 0x2d87a1fc59fe872c,
+	0x28038470f534fedc, 0x5c5a00ff58c6f65c, 0x471bb5ac9614eda1, 0xcf18998edb548512,
+	0x52db4de656a9c9e5, 0xffe3b6d5dde338, 0xbbcb27b1ee356bae, 0xe97e9f55a9f5c039,
+	0xa47e9204dd476e5b, 0x59e3a8af5c2a00ff, 0x917721416e2fd15e, 0x4107e8e738c0489d,
+	0x2f1309c3eaca52f9, 0x9f4c5500f207b16c, 0xdae379ca5e3e1230, 0xf8c7924b0c62f3a4,
+	0x5e196201a9fc7750, 0x175425c051813b25, 0x9405705f916a8f3f, 0x55052e7f3d405e85,
+	0x800a7fcb78634c86, 0x58153defd40e3f06, 0xd04be99327454fbf, 0x1969468e27b5e8a8,
+	0xd7071b37bb075561, 0x980fe6e9a452e9b7, 0xa08ff2736461c0c8, 0x85cd34afa04a7fea,
+	0xdc137fe5d5fdab50, 0xb304b7b12e2c95fe, 0x4c84a61ef6f49667, 0x9734c15b69ecd5b5,
+	0x78d361e68de41b, 0xbb73abf3071db927, 0x4e850c8ef9987c23, 0x95e154f1f82f3b0e,
+	0x386509406c4b25c4, 0xb5812a00ff2000ff, 0x631ef85908794c05, 0x9ad6d4bf0ed02f1c,
+	0xd2f219194a337318, 0xaf17b255959f90ee, 0xef2fc9a2a0f553a7, 0xee3fb9877f554827,
+	0x8fa42fb9aca99f8e, 0xbff8773fb02a232d, 0x91b78b51413ffc13, 0xa8f2637e4e1a2eb7,
+	0x99179d3871d13bfc, 0x2fa7aa6d8e618a6e, 0x9aa3e6b1d46760f3, 0x399aada5dcd6def2,
+	0xf5bd9fd72f0bae23, 0x9006e0b925669535, 0xb7da01fae48c24f5, 0x44b48b376a0edf34,
+	0x56731663ad38b742, 0xd26e49ac27c796ac, 0x9ca402234d23ad79, 0xbd973f8001cafef1,
+	0x812036a87b694364, 0x7f9ee48a51468d61, 0x27fc0ccff60af821, 0x98f75b78cf93baba,
+	0xfa77853ff7f49524, 0x8865f3a3789bc10f, 0x15fef80d47929c81, 0x7252e57578241bd5,
+	0x12f7166d4d3eeedf, 0x51719c339687dd66, 0xfe862a1f34bb3d03, 0x57f85a13fb6a7f0f,
+	0x7c3adab8c564d300, 0x858137e203bcd2a3, 0xa06e6465238ed4a5, 0x52a7f11c7a3a9f62,
+	0x3db1c314b38e612, 0x5a6aa5e71fc1498e, 0x86bb0cb811f7f642, 0xe4b1ded7a7c63f08,
+	0x77dbc890987fb646, 0x6f2b68d8b5fef967, 0x646b45feda259aa, 0x38f06324d393b355,
+	0x511ed69e7827acf6, 0xff60cca64deaab, 0x2ab7236b47a4a054, 0x2c91596fa5a76f0f,
+	0xcf33ca0df7f9ba5f, 0x935f567bf8efb8fb, 0xc8e5bf2d64295224, 0x916720f581bdbc5f,
+	0xaa4c327d1949faf5, 0xdc0d79900a622a9f, 0x38199d1e096bb667, 0x8991442dd525f668,
+	0x3b8f27be1302a4d9, 0x9f91df611000ff90, 0xda9a196f9f3faace, 0x7fb29d319e3b1935,
+	0xd68479d94a9fbeb4, 0x29e653c67c613cab, 0x64565c8ffa737c3f, 0x4c9013ce466b5bc8,
+	0x51eff31f3c470583, 0xe358472274c5a173, 0xa8f57fb795f29617, 0x15fe9c1ef659fdc3,
+	0x1c931ba73ae0de6e, 0x952e7f7bdc233995, 0x4cca6847b7f6aa9a, 0xd7b7df67fbfa5470,
+	0xb523c6c68258a6d6, 0xfcedf13ded3af771, 0x246b97cb9dbe12a8, 0x53563e6cb46a5f65,
+	0xb9b74fe9f36fcfc1, 0x3c17c6f805841b9a, 0xf15ddaaaf5f51806, 0xf5f233663ea56845,
+	0x8d70737aa78fefc8, 0xc3dfe89d2b4cb625, 0xaa23392b7d7a24df, 0xcf3273a45c69ee94,
+	0xed831c404ebd030a, 0xd672ddb9ca6f8fd8, 0x2a29e3155addb768, 0x9f7f6800ffb8f291,
+	0x783ec59cbdd63a5e, 0x709d66040faa1edb, 0x5ea7bf71d57c9163, 0xe7ce4aa1c20fb30f,
+	0x8df114c7c229a944, 0xc96df99c6207ba9f, 0xb1621a7adcb33d8f, 0x78f557317fc6c51f,
+	0xc7f7d5bf4886ac0d, 0xc967edfee939b3fc, 0xbbd10a9ce7c09683, 0xdb2e762b2dc671ea,
+	0x7e756af03dc941ca, 0xa6ed65983434770, 0x9ef37ca5d53b3d94, 0x333a3db351c61a7a,
+	0xfc7a49b0d82f82e6, 0x1c8c134aab3da8a7, 0x6c63b1d6cf7fddf0, 0xb6a7a915a7bbeba8,
+	0xf5af00ffc73d40e8, 0x6ef8589953035faf, 0xe95f971c75aac124, 0xa15ed15c79a1a816,
+	0x8d1f608aa228ecf1, 0x1f00851f851f8d1f, 0x50fa21851f8d1f8d, 0x947ed0fa40eb0726,
+	0x2a0288a1202a50f, 0x8a94922604a0288a, 0x1a891961a29004a, 0x1a3f1a3f008aa228,
+	0x4b49eb1b0128fc28, 0x4051140540436a8f, 0xa446008a6694d408, 0x68fc28c0d44e6aa5,
+	0x9d5ad3f801a6f0a3, 0xa9535223004d53f8, 0xda34a5460a80a6, 0x69fd1080a268fc28,
+	0x253502d03485df29, 0x5a29a911a0699a3a, 0x147e148d1f059892, 0xd4049e95b29da00,
+	0x4551b401288aa2, 0x4041938a62b4b444, 0x8fc65f000a94a2a5, 0x310a80c28fc28fc6,
+	0xab94b44a0150a740, 0xfc4e8bb43e4a0b40, 0x50008aa268fc0028, 0x142d050a90a26829,
+	0xf0a3f197d6470152, 0x350144541a0f0a3, 0x14808102a51845b3, 0xc65f5a1f854051b4,
+	0x1a3fd480c28fc28f, 0x5014a3700a80a228, 0x814c5a5f5c1a530, 0x47e32f060a94a228,
+	0x5100d41e40e147e3, 0xd0d2228553001445, 0x84407129d03b0a17, 0x58ac200455138c5,
+	0x38f404478034c70d, 0xd3634c22bf8025a8, 0xe21ed83e31b5fe3c, 0x9a877e701c39ddab,
+	0xaf14abe94e6f6c89, 0xc5ea555667316c21, 0xfe27e23a6b7d403f, 0x5ea52327a350a238,
+	0x369f5e385579dcba, 0xcfbb943a59539f7f, 0x896560f393b61990, 0x46c972bd4f7200f4,
+	0x3adea82a559a3df6, 0xc2b9c9d170a3c8af, 0xb59ebe0147f01061, 0xf45c20c266964b4a,
+	0x3c485ccc1fafa9c8, 0x7dfeaf5e23e194b8, 0xfe8691f229c1956a, 0x4aad8f8e663f2b2e,
+	0x8a03333c76b884dd, 0x1de704e7949eedac, 0x1c2ba9dac7444d86, 0x9500ffbdb8376a95,
+	0x34c728a6311fa348, 0xa23a7fcafecff0f8, 0xd353af07b726b520, 0xf7d1b67cdc6aeef1,
+	0xdbc4aa2600fff557, 0xea01c631cf2a1d57, 0xe1e991b3d2db27c3, 0xe08cbc9db3d543f4,
+	0xd7ab9091d4dc531f, 0x8c03b621248e9adc, 0xe119bb51a4da710e, 0xfa4edf91b1dee340,
+	0x9fd781c76def1a0b, 0x970fb17ce6dd4eeb, 0x77fbec1f657253bb, 0x465e85c054eb00ff,
+	0x7505d319ea1db017, 0x1100ffdc13c610e4, 0x81760092740a00ff, 0x43133a6a0e70ef3,
+	0xf77136aa1dd3b711, 0x9a5d8b9a7a7bb573, 0x6f57921dd10a6a4a, 0x7bbfcaacf43e4f52,
+	0x78e50d2ae4cf531f, 0x933cc28ddaefbd5f, 0x95abc67fece6a6d7, 0x83b7c9a444aaee9c,
+	0xd4363fd5b49e7ab4, 0xbb48e3afe77ac85c, 0x1e00ff179991ee9c, 0xa0c7456d8860be34,
+	0x7aabef262c1a00ff, 0xa96f1b797ebb4013, 0x5d6caba7f4a01f1c, 0x5c003547b657a1ca,
+	0xe8d371d9cd1df27c, 0x4e9e7a32ca0c552a, 0xc9da0b6f24eafc79, 0x743fc9e34eec2c0f,
+	0x1f78dbea69ec9e1e, 0x828129fd3a2cc729, 0x8c8e7a8aed281faf, 0x92cd50ebc30e7bdd,
+	0x70a55deeaba2ae6b, 0xc20714feebe76e4f, 0x39c4945e7673e38d, 0x4febe58f5c7e07e1,
+	0xfadf9f1b486a14dd, 0x697390b7529c00ff, 0xf999caca1362967b, 0x81b587538181815b,
+	0x749f028c4933d686, 0xd2b46785bf8ed373, 0xf80f5ebf6d76b94c, 0xb6b7498e6a2f00ff,
+	0x366a0afa673cfce1, 0x96e6e96adbe5322, 0xaf0f3c833f8ee1c2, 0xdc4965774c22c5f9,
+	0x5aaf4f0ffa03cb01, 0x8eb2b783b15d0ead, 0xb4d2d30a00fff5ad, 0xc973f9453eb99bab,
+	0xc44eed535fbfcac7, 0xde787b85deae2473, 0x8103d4fdcd0a1779, 0xec3d3dfc87075def,
+	0xffa003c913f718a0, 0x97e6e021bce91a00, 0xb51c66de0fcef268, 0xe2aa9024fc84af7a,
+	0x1c4952cd19bfa31d, 0x77f08f235a0eb175, 0xc5f59c8feeb65582, 0x246d6b1fbc80df7a,
+	0xadf77670dcc64866, 0xed18db6d1143077d, 0x9d08d4081e1dbbd6, 0x5b94e5d453537b3a,
+	0x10454b341038d45, 0xd6b4d6c48ff263c7, 0xafe3c001dd6f0570, 0xaad08b9b5a2e6d4,
+	0x9aa582be1d27c783, 0xe13ff63a62a8b6e1, 0x9969b28fd1447b5a, 0x698b46094db4cd9a,
+	0xe323bcdadb2739c1, 0xee5ccb9367a18737, 0x37f3e7abf78a9304, 0xfff36acfa15712,
+	0x8fab7db5b9793a89, 0x6a1a469b5a2e567c, 0x48a843206de35f7c, 0x6beca1cf951c7085,
+	0x216ba9144d37c32f, 0x6e780e29b6dfe4f2, 0xffe915c9a187c1, 0xe7f502c8926d3415,
+	0xce105baa555ee938, 0xff87d1cf885546, 0x8553c76923bb265b, 0x6f2cee44736a54ca,
+	0xa1b24db9647fd40d, 0xbfac827b00ffb61b, 0x295fd01a7a7d3a5e, 0xa8c0c0da4095aed,
+	0xc535f3d3636332be, 0xd9e5260ccd9a3ae9, 0xadeab0ca0312dd4f, 0xb3d65b438fe0c9fe,
+	0x6822c1efd069b5a1, 0x42b7072727303f09, 0xcfca23b55ceb9b7d, 0xc12273588dd4c2a4,
+	0x59006b23e1e58266, 0xa6627efadf51071d, 0x886e1a77736b469a, 0xa6c81d0846d1efa7,
+	0xcdc7414956604997, 0xed237fa34772a404, 0x7eb97d63495cd950, 0x3d70cf39ae4b6044,
+	0x4f427e9ac4ce6245, 0x36408e24c2369010, 0x9a311efac09eee9f, 0xf37194656c3e1986,
+	0x983fbd3edb1392f5, 0x5876e91f63a83bad, 0x7dc6e020342b4968, 0xf46f18cda9dadb57,
+	0xc304c67326d7bf98, 0x9292e2f6f4f98ed0, 0x31b7ba56eea64109, 0x9c36f3c8055cbced,
+	0xf6801ed883e03828, 0x455eed364d0a7ae8, 0x603ade4eae6f1b69, 0xbb36306db31ac48e,
+	0x464e8efcdc85001d, 0xd0d759e1bfde2a47, 0x501d532a23825b1b, 0x37859ffee47810e4,
+	0x5d6924b5b84584ae, 0x27c00b119b27c12b, 0x1e95bfdd8e8c741f, 0xde8f4cb06abe6e64,
+	0x4a9f4e00ffbe9071, 0xc1ce44fea87465a3, 0x99d5fa40f0184659, 0x8d98f82e223368e3,
+	0x43b78fdd3e190fca, 0x7eee9519951e4958, 0x9571f3ebfcd0b953, 0xc9b040dd63a57f60,
+	0xfbf0cfe5c7c62484, 0xc777b1edae35a71f, 0x4a95be3de4fd8c86, 0xf5759cf28dae1ef2,
+	0xae94bad06594d61f, 0xa163374989a88cee, 0xe381e566cb557be4, 0x1f036e322833d48c,
+	0xf7b7c2b1b1f41ede, 0x65f046656a492b4e, 0xb4d2df817b02b7d8, 0xfe6ce83ecc6fdf6c,
+	0xdb0a47086699f75, 0xdf22ecb4d2cfc091, 0x3f9471607ece9427, 0x389b33e1aa856985,
+	0x487151fd4211c7c0, 0x511cd5699e2340dc, 0x9c06679c3e265530, 0x64ac4ebdd7f087c5,
+	0xd324942a5831cd8f, 0x31b47e7b72a1a843, 0xf1a3f1c3ec38b502, 0xe30731851f0dfca4,
+	0x150f851f8d1f84b, 0xc7a4f097de67d2f8, 0x8a824051142500b5, 0x28008aa26843a028,
+	0x54051146d008aa2, 0x347e00147e148d1f, 0x8a02a0d6147ea7d6, 0x84001445d106a028,
+	0x8d1f0540499152d2, 0x8f4b434ac0147e14, 0x364da991024c436a, 0x4a006aa4a5460a80,
+	0x69fc0028fc281a3f, 0x4d0380a629fc4ead, 0xb5525223006d1aa7, 0x29fc281a3f0a3025,
+	0x288a1b80a228da80, 0xa0f0a328da0014cd, 0x24daa539056e908, 0x150f89d16697d94,
+	0x63a7b8001445d1f8, 0x68290080d2ab9434, 0xe347e32f00a55fa5, 0x2948ab140045e147,
+	0x425a0a8ce25200d4, 0xf097da63b43e4a61, 0x29008aa268fc30a4, 0x6969814081528cc2,
+	0x1ea3f5510a809616, 0x51148d1f0085bfd4, 0xa80a2b81497c240, 0x4a511404ea14a455,
+	0x28fc68fca5050305, 0x6210288aa20028fc, 0x8ac20f809616299c, 0x50142d0500d07a29,
+	0x80d24b415abf4a01, 0x6c467ac7b9f41e13, 0x991e2529eafc400e, 0x16a3b2a5ce1f56f6,
+	0xa53f46a2da964cc2, 0xe1363f56e378bd51, 0x407eccc47d8afcd7, 0x52953fb1bce95163,
+	0xfee41d18059cdc95, 0x47ca59ad00ffc31f, 0x54598ebc5234385d, 0x6e93a9e7b0ca22c9,
+	0x21e1f69949959e7e, 0xd0c3fb67173a088e, 0xdd66a4e96615fe7a, 0x77f8513e32bdc134,
+	0xe6bb716f846e77aa, 0x78fe532ff8e9e5e1, 0x7156a3d1334579ae, 0xbb6bd5406ee95d9,
+	0x4c567afac891371e, 0x3db9bb83112b00ff, 0x96e44c82c4cded6a, 0xbc1bd50e7b1c8f3d,
+	0x49d6faf3a0ceaf72, 0x459542a98eea3bca, 0x6eab18a2c02fe978, 0xa8fe732b0c4f851f,
+	0x1245fe715239beaa, 0x871a757e2b3fa85b, 0xd35dc5f769c34d8a, 0x52c42574c7391d39,
+	0x4770c6564624dbc2, 0x64a05008854f715f, 0xc3a2927c67a135f5, 0xc7bdfd7017c91a75,
+	0x52695a12abf5e9a7, 0xc4400f795b9e61a6, 0xc6caa1f3d3e1cf30, 0x80da6626f3dde8b4,
+	0x194dcd51dd37b3f2, 0x58c32aeac98df9cb, 0x72e2165f00ffe188, 0x5611c751e1cf3848,
+	0x9e496ed6d04f2566, 0x5023892649323a85, 0x1ed08d2cb5fa86a9, 0xffbe9049a67654,
+	0x4f32726807b7a4ca, 0x447ec776769facdd, 0x7ddcc87998f1439, 0xb400ff1c39372ba5,
+	0xd4ebb91d6c26537b, 0x2ec5332e00ff4ed4, 0x927c8886a24a9a5b, 0x69fdd4f3fa00d812,
+	0x4494fe1e0baebb9b, 0x49a97dfdc079ac32, 0x73305e8e60ec6db, 0x9604940313dbd526,
+	0x1906144ae9e7d9ee, 0x3f0241e19ffe8a3b, 0x54297d7cbfbb7195, 0x1a00ff659fba5c15,
+	0x71e43cd99d5cd405, 0x52a9f1e93d00fff4, 0xd5586a4fbdf96664, 0x200c53e1c720cfcf,
+	0xebf57f7ae03847dc, 0x89d5773a4dc74a39, 0xfdc59f0e98f9951a, 0xbfdf034fb2052369,
+	0xc8e693f9875a00ff, 0xf2f2cb69eae31ff4, 0xc4ae7a0dea1df6d9, 0x5b6e374d02bc828b,
+	0x5e00ffa7e33ccf19, 0xa91dd78103b82597, 0x2fc74508e1760e97, 0xec4a762ef72a15fe,
+	0xf43bb8cb5fdec475, 0xd7455fafce30c00, 0xfbfaf6149eebe5f7, 0xdeebd106122000d1,
+	0x2aba00ff1d5bc6a4, 0xc6cc37b7c1d051d2, 0xd4d4d383f3f263b1, 0x4147f7db805dc2d1,
+	0x9c63318f369654d0, 0x5fe16557f8b7cb01, 0x209309cd8c66190d, 0xc64e416ff503e118,
+	0x7c865fe6ae18a972, 0x3d620564d9d62d3f, 0xaa57d0c39e341f08, 0xf2a1191143c23778,
+	0x5b6b7de0c0c87dd4, 0x994649d5819fec1, 0xf40ad0a3707ac624, 0x5f0f0155554b0f1d,
+	0x9fb2b939c9b11b4a, 0xa35d226e8734f487, 0xee1a414c176dbbda, 0x7f1c4c643b3baafc,
+	0x708c42d9edb5c29f, 0xda2c5698cf8a410f, 0x5e058ecb07c604db, 0x78e5ced140a248a,
+	0x7ae445e448d5f853, 0xe9d87cab13c46a70, 0xe1e8a8b8d871a5c8, 0x8c24953f073def87,
+	0x9dd2c7e36fe73c5a, 0x83fc9e43c455960b, 0xf03ce7faee2f2bcd, 0x38dc865ca415310d,
+	0x7dfe96c40b6b3df6, 0x7aab3de8790680bb, 0xa8a30a8c2b67c476, 0x6b3dc6eb40221ac6,
+	0xcce3a3bbf8773e30, 0x893f78c579466520, 0x8673f9484c57c42c, 0x324f4bf1657db5e3,
+	0x8500ffdc2bb7ef42, 0x93bacbc702f1e37c, 0x1cba84ae6bfcb923, 0xc0de3ce73e98878,
+	0xe739b259f9305b92, 0xc451777869a5df3e, 0xff70c4b7a54c9e, 0xb668f554e5afa7ed,
+	0xfff473b473fbfc, 0xdcc20d8dcc7dd620, 0x432abad6a78edc46, 0xcc2574880b8b599d,
+	0x371ccfdadd915fb6, 0x7ac17c7279184012, 0x52ebcf3fd3e3bbe1, 0xb29d9f33e547b0c9,
+	0x22e3fac0f5549e8f, 0x369a63ad49e7e8b9, 0x55fef98f1d23a0e4, 0xc53c36e062de0ca1,
+	0x5ef3c04f6ff41cca, 0xa95150f6a917af64, 0xb6234dda6ce4c71b, 0xe8bd8f6c0040e24b,
+	0xcebaa69fc07b147, 0xf6e5e7c00fc048c5, 0xdaba16b2b65973fa, 0xd8678c513e19f348,
+	0x1bc3e5eaf57f7b7a, 0x18daa3ef2722539b, 0xaafcf40fcecbfb6d, 0xe8b3f1464843d71b,
+	0x3e33e37ef2d8524, 0x9f3fafc3109c0db0, 0x1b384f17e25b8ad7, 0x725c1000ff9c43e3,
+	0xf9a9de03fae9390e, 0x72dd9eb7116b9f9b, 0x502ab558a55f7e3b, 0x9f7fdc319e32c304,
+	0x72d27432b3cd55eb, 0xca7d563e9b749b89, 0x7ecc1f7b505f8e79, 0xcddb1c92bf4c6375,
+	0xfafa33ac8d0045b6, 0x8886716aa4825a54, 0xfe1cdb319e3fc8b1, 0x699b25d828b1a866,
+	0xa2fa4aa2f6aae7e0, 0x8badcac5cc24969, 0x72021c27e684cd13, 0x8eb9846a501fd457,
+	0xa51d15feab1e3a6e, 0x7396c343f8724cb, 0x33cb7f3a693d4f9, 0x1fa96736acf4b1f2,
+	0xa7deef06ee153a7e, 0x5912a046bddb23af, 0x6c634e6afd1c5778, 0x15d234df31ce4110,
+	0x97cfd85ab5eec370, 0xf5f4630cb35b935b, 0x5259b8a1995b0bad, 0x864ac266cd18574e,
+	0xa130a1591badf103, 0x6ace00ff7d1e7a91, 0xd56237d7c21b9d3a, 0x42cf3858385a6e26,
+	0x44e02a4b3717ad7f, 0x4d934f37c583fa14, 0xec41908d0df7e130, 0xb9fbd94ed39d1a7f,
+	0x5d2aa3d22bf4fd0f, 0x7e53e368cc8fcf62, 0x66188afccbb7aace, 0xff82537a9c9600ff,
+	0xab7f00a653fab500, 0xeebb0a55fe91df70, 0x7428a7d32be8e7c1, 0xd27e13e2a8e2c847,
+	0x347ea7a923289249, 0x84aef097ca6ff699, 0x51f8d1f8d1f8a179, 0x4bef3369fc0053f8,
+	0x45831280da6352f8, 0x51dc001445510014, 0x1a69a99102a06846, 0x2808941429450981,
+	0xd3f861a0f0a368fc, 0x280a024d53f89d5a, 0x13025014451b80a2, 0x347e140025454a49,
+	0x9792d6370250f851, 0xd25223059886d41e, 0x801a69a991123035, 0x43000a3f8ac68f12,
+	0x29004a4a3fa5a4f5, 0x95921a0128a995a6, 0xc28fa2f1a30028a9, 0xa4f4ad94b4be1180,
+	0xd40499152b401aa, 0x4ad1528001288aa2, 0x1f8dbfb43e604905, 0x409d02c5280c1485,
+	0x4e0b002d2d523805, 0x2050f84bed3169fc, 0x8a4b011828508aa2, 0x3d2e058a16805629,
+	0xa3f1a3f1a7f01a8, 0x1d0d2427129402a, 0xf5510a8096168a4b, 0x8ac60f80c2ef14a4,
+	0x750a14a300280a3f, 0x8a02a04e81621400, 0x1a7f697d00a04029, 0x8aa228000a3f0a3f,
+	0x4501d0d242712900, 0x14454b81025014, 0xfe527b8cd647690e, 0xfc68fca5f5410814,
+	0x5853d0e30028fc28, 0xd50515b9947ed403, 0x5a00fffc279944ca, 0x485235c2846d9292,
+	0x4a044fdf66cd9100, 0xea5d7e3c6e7b825d, 0x27c738c37de7cb3b, 0x7f89f53e00ffc038,
+	0xff2a7ab3dc251973, 0x2d1a6d67ca585300, 0x1716b3597a7b4bee, 0x8915dd3fbd8ef59f,
+	0x7d7c66864cb6737d, 0x1b57b7d40e3feae6, 0x737aac4caa388594, 0x6cc54dc58e5cacf4,
+	0x1b4dea933c77ef2a, 0xc84c35cdf5117c88, 0x17b721b4223094c1, 0x1b2aea200b171990,
+	0x132a372db938b5b1, 0x4f998d1afbc4c8cf, 0xd5d93630e1998a1c, 0xe669e863871be7b6,
+	0xc30ef137b8ebedd8, 0x8bd6d20695a7fdc, 0x86defcb00d65d1ed, 0xf7c70680f02e6d83,
+	0x7fb82d3c71741a58, 0x6fb375fecac1e109, 0x719787f80ea50e67, 0x2e97121588fdfc18,
+	0x5ba66e45fba9d4a6, 0xe9386ecb13482b47, 0xd4c7a93090839152, 0x4b4bc5eacedad3fa,
+	0x71ae49cf2630613, 0x52ce9a7abbbd8dcd, 0x8d8d7b57164edfb9, 0x819b70cc547a7e49,
+	0x3f9cabaa29fdc2eb, 0xf93347851dc861de, 0xb31bd51e761cf28d, 0x623092a8df483ea5,
+	0x6f2a34f5a9034f55, 0xa2316925354f66f, 0xb7e011042c5f2a0e, 0x94d388d025a74a7f,
+	0x2a9ceea76222da9d, 0x50727735a54fecf7, 0x2ae36c7e19a9497d, 0x1d01ccc246ef01bc,
+	0xc636b8a12bb52339, 0xe9e79efa9d7c00a8, 0xf5289c3c3f8f2156, 0xe3772b9b875885a6,
+	0x7c92797752a4dadf, 0x5aca5981e32a1fa3, 0x47bdfef5a4a9141d, 0x6acfc8003dd95d06,
+	0xa934ad877db0f70f, 0x761a00fff43ace73, 0xb66b2359d43be8d6, 0x2097d69f7f7bab1f,
+	0xa5f4fcd3919c981f, 0xabda738f3b38055c, 0x58fcc916e0b84adc, 0x8fdd0825a7d895d0,
+	0xe8dfd3815c07609a, 0x7b4ecc70a489242a, 0x6f6e32368ea4f40c, 0x26362c184f2dfabd,
+	0x1cdbda55bb274f70, 0xdb2c1761cffadcbc, 0xd39e663a5aefa057, 0x9e00ff789f08e79c,
+	0x7a38cb4a58f36f5, 0x6bea413f19c838e6, 0xc8fc8893e123fcd1, 0x565f9f9001a223d7,
+	0xa128ca4a9db128fd, 0xda618cac3c0cdfe0, 0x5e737f8f73b991a3, 0xcb0f6d410f7fe1a5,
+	0xa63ec911f37e2c11, 0x5e1e552231fde19f, 0x8f23c0a75b57a4d0, 0x5d733629061d383b,
+	0x7130d5d3483feac9, 0xeab669d115f520db, 0x8a0515a7e7b9fc02, 0x56e9b8631cc450a8,
+	0x71dc816494f938e0, 0x3fbbabc22ed2b259, 0xada4039a59f332e, 0x86b15908aa3d40e1,
+	0xf6a9f4cb1f67e4c1, 0x90cb920a7a2003e3, 0x65a356e9630cc090, 0x1cb110aa986ea723,
+	0x5770bb2c6a757e0c, 0x59b86502bd67e418, 0xa53f03e719400243, 0x3a0eea93a360a53d,
+	0xa718fe0b5bcc5255, 0x1221ad278f3bcfa9, 0x1538f024e5be3249, 0xa7988e93f18be15a,
+	0x1509c6c91118a8c8, 0x232605fc38e5c71c, 0xc340d6968875f199, 0xffced7fa671c39,
+	0x7261c894bb57415, 0x6c3c84586bfa4a, 0xbee263bcd2c51fe3, 0x4070ce396524ac9a,
+	0x74233566564e57ef, 0xeec83136d8759ccf, 0xd4bd3226757eae41, 0xd4ae78db95fefce3,
+	0x2ee49a837a0c33c7, 0xa0575cfc53312ba3, 0x37e867251d9d47b5, 0x5826dc0da6509e45,
+	0xd556fa437f1df80e, 0x83e17d6043db9dab, 0x284b17f91333d7f9, 0xb6dee7bffe3ed9ec,
+	0xe8d3db3930d8646c, 0x873eba354c6cae79, 0x42634fcebefbc426, 0x70b64a06c83298e1,
+	0x5d505ae75f7f8c3b, 0x1d6e20e6b67a1e6f, 0x6581ea3d00fff788, 0xa00ffb8bc3f5578,
+	0xc2ce9199cb9b4b83, 0x74adb846fef19fa7, 0x68e69f1775f6f77b, 0xe4183791762246de,
+	0xf20f00ff39aceae9, 0x118c81cb959d386a, 0x96d5d07ffe7be891, 0xe7b4518eed58f729,
+	0xdc500dfcf2af37a2, 0x8f6b9be80e2c6ed1, 0x85ea88ca3f00ff55, 0xa194262b9b23c5a,
+	0xdc9e00ffe03807b1, 0x33905ced2a9f6456, 0x55faeb0f3d4afc81, 0xed1939931f6043de,
+	0xc4d2365da9e2f4db, 0xb1b7a88adfd7ad8d, 0x2fb3d02129ab6895, 0x5dc88559a587bf52,
+	0x830f19a39acae999, 0x1f01dca9537358f7, 0x9a7a189d2853a3fe, 0xa30ccf0059665868,
+	0xe80393555e4c71bf, 0xc1a508c6c131bf69, 0xb363a3e6794ebddd, 0xa5c29f9b9fb1b077,
+	0x6b651418f47d485, 0x322efe55e5d43e1b, 0x1363fb75d141569, 0xe6ec96d57ed31ea,
+	0xdc38042a2bdc384e, 0x89b8b8c5d5dcb78f, 0xe9ad1999beae50be, 0x559931f3dc0767e2,
+	0xce054dfcf66ef10a, 0x38c7ca69e8bb533e, 0xcc0aea5a50e14760, 0xaf00ff03a17f7b16,
+	0x54e6fcbaa7adb65a, 0x723c7d57cc3fc71e, 0x6f9b1daed8f299ea, 0xd27b1050817f5192,
+	0xc9af5bfad6a035fe, 0xcfaa42fe18b94772, 0xff24cedd8f5104, 0x5a3c9b2e8eeb9a80,
+	0xf3aff7e91a261ed9, 0xa990376afc68fc21, 0xe552f500ff899ffb, 0x5b8a1ad11518c888,
+	0x7f483be93c5c5d1e, 0xeff49e8bb47e48e3, 0x499152d21031b4c2, 0x6803508ca2190540,
+	0x806214cd28008aa2, 0xa2f1a3205014451b, 0xb834a4f11380c28f, 0x81a2284a0814a3f6,
+	0x46498d10288aa28d, 0xa3f8ac68f02a068, 0x90dae352d2fa4600, 0x1409ba6d44801d0,
+	0xf1a304a81aa9d3a6, 0x2969fd1080c28fa2, 0x2b253502d03485df, 0x50522b2535025052,
+	0xf851f8d1f8d1f801, 0x8a36608aa2680350, 0x80c28fa26803a628, 0x54f89d82b43e4a1b,
+	0x14851f45e3079a, 0x2d96a0f5528c3a2d, 0x68fc8582d2af5214, 0x8bb4b40a81a2f0a3,
+	0x814c5289cc2404b, 0xf097da63d2f89d16, 0x10029508aa230a4, 0x2950b4001428454b,
+	0xfc68fc68fc854071, 0x4033aa144561a028, 0x940e03ad5214a385, 0xc6efb408408152b4,
+	0x8d1f0085bfd41e93, 0x5c0a1485ba405114, 0x28508a96023050, 0xbdc728008aa228c5,
+	0xf8d1f80150f89d02, 0x3e8a0150f851f8d1, 0xc6d1e40dd53e93a6, 0xb0d4fa8000ff7699,
+	0x3f38b54dde916d8a, 0x673112edf31e6b40, 0xf4fd976dab382e7c, 0x70a98e6a951f0083,
+	0x203feedc34edd6b6, 0xa3a5eccccb5853cf, 0x38f3c3367ca3dcb2, 0xbbc39afc63ef0755,
+	0xa6e6766f41e1cbb9, 0xbdba8f831bf52e69, 0x42b7b664a2543849, 0x9f8191ab8374deaa,
+	0x82928a1efacdc26a, 0x917bb749d0a4ecb6, 0x6229fca96b00ff18, 0xf851377b1004cf48,
+	0x51ebe7b96c3924d3, 0x66da5f123a1236e, 0xdf0dafb4b9d493a4, 0xca05c9bb755a4fa6,
+	0xe68256bda78cedbe, 0x1194757f58596e65, 0xb7ebb6c44dd4ad53, 0xe5a9b84e1f2387fd,
+	0xa64f876e17adf166, 0x8355df22d42d3aea, 0xffbf4f1b0049cfc9, 0x43a4ed83afaf5e00,
+	0xe4845027937e9526, 0x3f66994f5c83c38f, 0x3faec8aabe70cbd5, 0xdb6e6fa54edaab98,
+	0x1f3805d081b1ec8d, 0x3b0b5f722a654d86, 0xf9295aa5c9a8e2a8, 0x85971a1bf9facfde,
+	0xab47f1b09e721af, 0x368d3fe30200ff83, 0xccecdf48d2fecada, 0xed53f80f6e3c7ac5,
+	0x5e88591d768152fc, 0x4ffc2d56e96f6170, 0x95f1c48c342f210b, 0x1efbede5b9e2f323,
+	0xf7edd495b2e5089d, 0x43dce6def2de6e33, 0x7f04e40e9e426679, 0x294bf4d5cd5abff5,
+	0x6fcfc8138cb8d632, 0xf112382eaec9abc2, 0x9ce4afcbaae277ce, 0x7b2d873517491f86,
+	0xa5f792cbd4518fe8, 0x7f6e37d5d2d6907f, 0x55c10d445b57b5d3, 0x9f59ad2b6abde851,
+	0xe84fc8c3f5a04a04, 0x6c96ed485ea32a32, 0x56a7d1d6fa017aae, 0xb99f0433a686b3da,
+	0xd4e0982501514913, 0xd794f51e38a0b36f, 0x52faa3e2076e9ba1, 0x6de01939c2edc335,
+	0x93cebc73ee833dad, 0x1cc0f3f28826964f, 0xb1c17cde54fe5c0f, 0x95322555f8cf3d47,
+	0xcb586afd1e889d01, 0x9fd29ffadcacda16, 0xce4297521c91ba25, 0xbdc50aa8998fbbe1,
+	0xbd7f8208a245bf4f, 0x9e0b2e02083152eb, 0x2dc674ec9bacf4e4, 0xe760e036ac41cbab,
+	0xcddc1929762ec5b0, 0x8f258fc8d84d0ad4, 0x6817901315fe73de, 0x35a5b8d234fef9ef,
+	0x9e1ecf38c991441d, 0xe4c8cdaf6a6afdbf, 0x5347ea850d63748a, 0x6be2c7d8f2ed2d56,
+	0xc391dd996fe2585b, 0xb59e9ecb070a7611, 0x6c441559e6e9a2b9, 0x2ae8616fc901bae5,
+	0xae8430c63da281c6, 0xe1815eebe9879e7a, 0xe4496e07a3380e7d, 0xb917234a9f1e76b7,
+	0x137e44e58bf16a95, 0x60e751240988f8f0, 0xd140af458fa2c30d, 0x988ea0da5545e534,
+	0x76e068a3668d1e15, 0x578276c2a747571c, 0x7627eb72a414f4f0, 0xb6da3110d0edd259,
+	0x636d55ed316e532d, 0xaa64e4ea1d2779f9, 0xb46c262b3ddd7f8e, 0xab1876046439da2f,
+	0x42a9761f283fb830, 0x55f8ebf63cc7f202, 0xdfeaf478e0fdc480, 0x658301d7966556e4,
+	0xab3c6734b57eef46, 0xee0a6caceafc0102, 0x64e8d43ec0c870e7, 0xbf1e601c9c948fdd,
+	0xfdc1811bb9009ae7, 0x67fa65c8956dc42a, 0x9e6ccf4130ce52ad, 0x5cd898b70466fbd4,
+	0x451a8e06d0f99173, 0x510f3a9e1c69a32a, 0x701ce62e4ba1cc4a, 0xc1b8cf7cc250eb08,
+	0x2ae67f87e575c470, 0x60dc0a87cca8d868, 0x733905a4ce1f3f9e, 0x6893de73e8edca85,
+	0x708c811b5b390de8, 0x97453454fef4677a, 0x2253e9e919373f23, 0xf01c01da15c0574a,
+	0x1a88cff34a6fc771, 0xfb3771742de9659, 0x2af7f2eddea557d4, 0xb32cbe7305fdf476,
+	0x5f3918c051b15a32, 0x563ef6c4ec944aaf, 0xe0424c37f9a68df8, 0x3d976522d635af76,
+	0x6465a5a9f87daf39, 0x6f453cc52b2aa3da, 0x5742a557fa48d9b1, 0x265fcc91165e9547,
+	0x2a209fd66afdb2dc, 0x9d7ffe719ff0a783, 0x3f32ae23a3817245, 0x1dc776b556ad9f3e,
+	0xb08d166f9cb4de57, 0x1cfeeb2e659dfdd5, 0x7be5794c98582de9, 0xe4b2cb2e5c5171fb,
+	0xcbd851e3cfbffdf0, 0x86da54181e9435ba, 0xe1cf7f307d15121a, 0x19e5661f2bad755e,
+	0x7821432e355de6d0, 0xa1a7e70488db728a, 0xf4b4994f626769fd, 0x6fa36afd1fe3deda,
+	0xfc03791972a4ca3f, 0x8e3258b8d59c00ff, 0x6dd6fbfc2707c3ea, 0xe3882255729ace34,
+	0xd423cff279282372, 0x248bfcf21d55fe74, 0xf2db8b7f460e7363, 0xf8672020c36c3acd,
+	0x38eebe015386394d, 0xe1a239f9cc9d9da6, 0x8dfc14d90eaca6d4, 0x8c5aa5e73f00ffc8,
+	0x54266c55cdf90f92, 0x546afdf5873bb701, 0x32f69554c5edad7d, 0x7ffd19b1cccecac3,
+	0xd2d3e30136ca554a, 0xb797d643871b1893, 0xe32e3b528fac813f, 0xa5d2d3db2bb353a4,
+	0xd49c636403ae00b6, 0xd4a0dece0b87ce0a, 0xa7a5e277e49cefb6, 0x451696da3c4a5863,
+	0x48786a0e7e0f2855, 0x8abaaf5c48fa772, 0x1917aed1d4d8df71, 0xc7d0e3249c161d27,
+	0x327a3b657d9d4613, 0x8f67dc73020e28e0, 0x7b559c830c84a6ce, 0xfef5512004386767,
+	0x9fa9796c11136e55, 0xdedf8858caae985e, 0xfd5a3565c69b8f8d, 0x82eebeb6fb666ed5,
+	0x4ff13a504f530fe0, 0x3ff51e28935f188e, 0x60f523ea968f94d8, 0x115f3e8b2a86d12b,
+	0xfc6bfed5dda26393, 0x5bb2d4f8d1faf9ca, 0x50733efa11cd1c30, 0x6b4c57fa6e3be1ca,
+	0xfaf83a9c9335b42, 0x51d3fb4c1abf238a, 0x77ad29ad8fbb1fb7, 0x3025454a51b05a39,
+	0x5014451b80a2280a, 0x400ad93a6d44801, 0x8d1f8d1f004551d2, 0x52232500851f851f,
+	0xd252841400250d9e, 0x2ca0288a1202c531, 0x7e140025b5521437, 0x92d6370250f85134,
+	0x2d3552009494be95, 0xa991961a29215023, 0x153f851347e9480, 0x4a4adf4a49eb1b,
+	0xa446004a6aa5a446, 0x1a3f1a3f004a6aa5, 0x34551b40128fc28, 0x8f36c4142d45481b,
+	0xe97d26600a3f8ac6, 0x2515fe527b4c1a7f, 0xabb4186895a21885, 0xe3775a500bd42948,
+	0x45e30740e1775a4d, 0xa0558a62d4315014, 0x947e9592d6afd242, 0x1852147e148dbf00,
+	0xaa700d2d2228553, 0x8234fed22a004531, 0x41a0288a02a0f097, 0xd1d22a068a62144e,
+	0x97da63b41400288a, 0x8aa2f1a3f103a0f0, 0x8a1603054a511404, 0x8aa228c505a028,
+	0x8fc65f000a94a228, 0xf14382c28fc28fc6, 0xb6a6768c4b816ca4, 0xa54c7a07e8409e3a,
+	0x7ab891148ec40db9, 0x73dce676e7c46556, 0x55ec60ba5ead23d3, 0xc8feef08ebbfd8c8,
+	0xd0015cc6bc658ca4, 0xec2d4a58e98fee63, 0x89b9b196a275dace, 0x828ecdbf6c04a871,
+	0xd9dce76f896b35b1, 0x2be2a7d55e05bc2a, 0x15529d38f67579b1, 0xd4a3fbcf4091be3f,
+	0x3486b81da1cb4bd5, 0xffc88c805e61f2, 0xa4efacefd4a58e1, 0xb7659e6633d792cf,
+	0x53ad1fdb41142210, 0x9a59b5d3eff0dc91, 0xa879728fc100ff72, 0x35bba9791b99f757,
+	0x534063c8157a8b71, 0xb8d864b999b3e356, 0x338584db14d3e3ce, 0x6fb431abf4bf49e5,
+	0x35b6ea3d6075fb9, 0x7f154ac7ee9839a5, 0x5b8815e2d673495, 0xbf3ee35db4a0c5c6,
+	0x27cfd31427c79a7a, 0xa6dc4822e58c9d02, 0xbd9a1ce59bf955e6, 0xf01c400ec088d20c,
+	0xe4d851455a303a6b, 0xc9544c8f533ee0d5, 0x332be8abe508ab23, 0xbd5fa4754b8e2531,
+	0x112b3f604a3f79ec, 0xff18dfb1bd14f4, 0x17497dcdd149953f, 0x4f14a71f6c339ff7,
+	0x608cd1f3ed011c94, 0x15f6e5c54aab267e, 0x3e361fc92515562b, 0xabad5a79e4c7535,
+	0x805e183103992b74, 0xa7829e1c19856052, 0x2aec24ea068e41b7, 0x939cdf217c48bb30,
+	0x791c8c85567bfeed, 0xc5b676d47a7bf78d, 0xe37da09e476473d7, 0xcb0fae339857eded,
+	0xc7d6d4eab802e318, 0x1743d25cd6f060d0, 0xd136a638c641d82e, 0x4da7f6a927eb1bf7,
+	0xbde33aaa7cb0d920, 0xa6d2d303af9bc144, 0x348c55c437f45b9c, 0x9f9e0b0318c189dd,
+	0xd4074ee5b1d07be2, 0xf0db53954a00ff9e, 0x1567241b19b036ab, 0x72ae2a9147761ad9,
+	0xf85e08b6dcde8edc, 0x8a3c817487075d51, 0x4aa3b9831eb401d2, 0x953e77f331ca2cb1,
+	0x6300af0a613668d7, 0x71b51c592f57a5d3, 0x30eae9a1bb0c621f, 0x628b665dedf0e302,
+	0x959e6a9ef33a8aa8, 0x577b8ced56dc066a, 0xe0cc64acc1391e04, 0x5f4fae22706969ac,
+	0x72ecb758badf85e, 0xed094670bb629d35, 0x8373bd7208a3f58e, 0xd14b4467b206c8,
+	0x37c2ac221938c739, 0x3a5baa16709e8381, 0xadb05aa7c7b905e3, 0xffa1d771aec78d1a,
+	0xc7e1422d36a83800, 0xda9c22aecd9dadc, 0x542a8189a1e2f1b7, 0x1794a9f03f7f5ca7,
+	0xf9c7f4c90d851450, 0xd5dd866d24d148c5, 0x37ef0f9d5a0770b2, 0x267c15d5f873c603,
+	0xb8db53eff4490a48, 0xa8fc78902700ea55, 0xf4dc90e3695b7119, 0x362a0653fe4253e9,
+	0xa86cc431abc68d93, 0x53189fd2033aae37, 0x30699e00c7c986f2, 0xfa3cc7566eec2e2f,
+	0xe5b713246db7a974, 0x590e154efeb71e8, 0x52ef73fd996e3700, 0xe663f3c17c48f347,
+	0x92dc02a8f5bfdbdd, 0xd2230396cab12aab, 0xaaa8af3c895550a4, 0x1ddecf7512d3e5b6,
+	0x72aa50b90cb72a7f, 0xb259e9ebe31c3972, 0x9e7b6e46477bf946, 0x3de001c4fa59ed79,
+	0x7d23a815877f00c9, 0xbf27b13cb99da3a4, 0xc8a01a0d20ee55e9, 0xc703527bfcf739c9,
+	0x19cfcae40be9243e, 0xb1323ecf571cd952, 0x5b5f130ce0badc31, 0x19478cb6ccd240fc,
+	0xbee2f9af4fcff104, 0xb2527779a69df874, 0xcccac3eb0a8c73af, 0xe0ed786ebc53c5e4,
+	0x35ebfc0d0fca70db, 0x9f31ae7086e98ec1, 0xb241afbb15f5db43, 0x195017abfd7d804c,
+	0x199d077aadd3b11b, 0xa1b5cc00ff9de669, 0xe58e958fc1340fdc, 0xfffcc8b36500ff,
+	0x7e32da2df3286b9d, 0x8a613e730dfde064, 0x35766cb991659c65, 0x2b1bca91bc3a6bbb,
+	0x14f1b87a7fc4c827, 0xb8b83865d447e6f5, 0x2f4b484c7e7b533a, 0xed6abd3e928d8d43,
+	0x301600ff94311fbb, 0x21c71b77f9daa56a, 0xf5b7eb86428e4ac5, 0xee8752cf552dcf15,
+	0x338bfcfadbe3e6, 0xb54d513f47e856d9, 0xb6b23215776b9b6f, 0x1e56d5d8e7107f18,
+	0x92157ee44c47db5c, 0x973125b99fed58d5, 0x42e9e7dd47f98740, 0xa47b6a2aaf6f57b6,
+	0x55f13aec33d07c25, 0xad3f72a6b7513ed9, 0xa34219a9e6685a5c, 0xfe719cb029395a2c,
+	0x827a8fd36d8c1b45, 0xda5bbda39eb60117, 0x396b3deac8835c26, 0x572e489d8cb2332b,
+	0x47bd9d8e008701aa, 0x8e0c37c88a85a4d6, 0xa58f0cbcdc5555e0, 0x29620f58f9960b4d,
+	0x8c66f468a9096d34, 0xb1f77346b5710577, 0x392c00bc7f449656, 0xf413f253174a5624,
+	0xb1d08dc2e1de7635, 0x47fc08a9525b73fa, 0x76d1592ae2c18e99, 0xeecbdb25c62cb67e,
+	0x7e7ba42a953edd1f, 0xfb938c66386a2a65, 0x2c8bb08ab97f0b99, 0xa7eb8ad06304808b,
+	0x8b31e0c5c4639f5a, 0x9d2868d0777559ed, 0x9dde932715924a3f, 0x9ad4c7b0f7c7301c,
+	0x7aeaaef4a3e80473, 0xcda8095ec5998fee, 0xa33930c6e1deb5, 0x8fbac60f94c28f51,
+	0xa0f581d60fcc4f26, 0x144589644a1f28fd, 0x6d008a9622a40053, 0xcde394d408405114,
+	0x470150144501d034, 0x48e32700851f45e3, 0x8aa2006848ed7169, 0x8a36004551b40128,
+	0xa3f8ac68f02a028, 0x92d2b752d2fa4600, 0x8440d3d429a91180, 0xc68f02a0a4564a6a,
+	0x34a4f113a00a3f8a, 0xc669d300a0a4f4ad, 0x941429254d08409b, 0x7e147e347e347e00,
+	0xa40d81a228da0014, 0xc68f1276a0465a6a, 0x3f8ac60fa00a3f8a, 0x96166969154a2a0a,
+	0x5a040295a0a1480, 0x29d480a2f0a368fc, 0x2d07a0f42a25a557, 0xe3775a30d0d2222d,
+	0xe30781c25f6a8f49, 0x14c5a863a4a22846, 0xa0f4ab14450b40ab, 0xa80a2f0a368fc05,
+	0x94a22800ea14a455, 0x208102a5285a000a, 0xc28fc28fc65f5a1f, 0x5a5a854051148581,
+	0x2e2d945e0a034531, 0x2650a09414a50028, 0xe147e147e347e32f, 0xa2f0a3f1a3f1c340,
+	0xfd0a0a93ba570581, 0xa9f05b3d1d9990e3, 0x3239d5d4d12e6ca6, 0xab2633a79090a5b,
+	0xfbc88cb750575c96, 0xdfacf527f491fc98, 0x49c9c68e23656a14, 0x975a85fec7236e9a,
+	0x61eadf24ad36148d, 0xb8de838e8d5eec5c, 0xe51757176ab66fcb, 0xb1e184f9b691b5fc,
+	0x2b604f1da727d5fd, 0xdccc61341ddaca39, 0x646b716c6892409f, 0x14f294e727bc6abf,
+	0x4c89652dd450c5f7, 0x6b4d8a4e9a3192d7, 0x812cd762950e6f43, 0x50a79ff37e40b899,
+	0x4a5fdcdb5ba9e6be, 0x23b17a994577d7, 0xadab75ee5881c70f, 0x48309ee6783bc55e,
+	0x57eb9f410f706ac4, 0x9118c943d9da8ae3, 0xd4d4137fb593dbb8, 0xe5b3c3c2650bb397,
+	0x5a1f7620765cb71c, 0x489c774996bbb9c8, 0x46c5da543c00ffb9, 0x695f77770bbdfb5c,
+	0x76f801bcec3892ca, 0x8f9c725b91a0f9ac, 0x9e4a3b276c724a4f, 0xf900379d84553cc3,
+	0x8e2df3cd8af8af5f, 0xe39a429f4b5418d5, 0x949f0aac8d91d41c, 0xb26c71b15a9f3ef4,
+	0x548662a8883fe52e, 0xff483b7458a66c, 0x7a9d19968929a26, 0x5f1449a7a176ccb7,
+	0xed9c76dd44778d69, 0x74a5cf7956eb00ff, 0x8c72c53a70fc2d5a, 0xfa23d7873f2ccf61,
+	0xbeedd5b60bdedc56, 0x1b3bc3aec6dda3d5, 0x5e95b4febad337ee, 0xa1e6b23de0a9885f,
+	0xb73b248b38f26fbf, 0xa90758c45662557e, 0x4c00ff7e785c6bc5, 0xfcc71f5546fb8b98,
+	0xde63cd2694a9f3f, 0xe3cfb1f9e5e3aab4, 0x5a78badc2d5287d6, 0xb08151995a228790,
+	0xdbb4d627d3475201, 0xa5e37848ea3e9945, 0x70922e18c712692b, 0x749d3bb46ed6603b,
+	0xa96db8c894bf35f0, 0x3003101299d6ebc1, 0xcedbd2a0567400ff, 0xd5f847a51e9ba31b,
+	0x3162e4db3d1e5ddb, 0x42c44bc5f22377db, 0xc69ed6c42cc3710b, 0x9bf69fe3f20eac2d,
+	0x6b53c5d65aab3d1d, 0x18ad76a7ca510848, 0x7a8c258e48dd8660, 0xc6914deba79e00ff,
+	0x9bf7133a460acedd, 0xd9436f0e31d55ce9, 0x7f77d42be87465c3, 0x4fbdddfdcdcc1781,
+	0xf6c2e593e6a8b0a7, 0xe09c776eeea8011d, 0xfeaaf58167e0a82a, 0x50c9402c13fb4873,
+	0xfa38f18c94d0a92a, 0xc8c9cb647751d354, 0x7353ea50feb00ff, 0x318f42c690e9fd1d,
+	0x146ab5fe0800ffba, 0x61e9f40a3a1dc0c9, 0xbb4d32be723e57d2, 0xc0dea1edc3d6dffd,
+	0xcc5ddb74b6d201, 0xae8725a1d353a51f, 0x27e3a0b0edd1a66b, 0xa56b7f8e8d9256f9,
+	0x750c8c6387e6b2ba, 0x6a05b76b9b1e5deb, 0x953e7ee056109bae, 0x95c973cd388362b9,
+	0xedc13140c1d35e04, 0x20c7c9735e05b05a, 0x31103ca866add7f1, 0x1e2fa4ed57eb33c6,
+	0xd1b992e78a7b1dd6, 0xfa5ccf0d80d55213, 0xae074e2669a3957e, 0x78466c93b57e3d08,
+	0x182e67b96ac7f73c, 0xd9ac767be05c4f82, 0xc6d6c61b18ab59ac, 0x63d862194b4590e1,
+	0xe7bbad2a9e00ffd0, 0x96a9f2d38103e385, 0x956ecff7583dc945, 0x20dfa7946297a926,
+	0xff3dcf3890609c, 0xaee70400aaaeb20a, 0x1f1c386d59ebf701, 0xdcd0d49c9ee48cbb,
+	0x9a739cf37ac6f50c, 0xfd607a8e21d98b92, 0xc0c5aa8dda52ed73, 0x9207ce5bd58eed39,
+	0x8db348cde919e77b, 0xffe9a39ebbddd8, 0xe1a6e60dfc02a9d6, 0x6e4b8d00ff548e91,
+	0xcd33f0040366485d, 0x746524652c8a467, 0xbc35157e6c5fc7dd, 0xe77b1de6672bd1ce,
+	0xb37d6234b0d4f9e9, 0x9eca8fd381c28560, 0xf8eff4b9dbb2f965, 0xf2b80d47665855fa,
+	0x121401f53e153907, 0xb3119fe802a9807d, 0x78fcf515ca2b962a, 0xa827b032dcc95aa7,
+	0x6e8673bbda5753c5, 0xa8aabfad96d4ec9f, 0xc3a6c29f314672c3, 0x3184fce2693ab2f,
+	0x7f073133bf6e9fd6, 0x2fb3e4852ac7abd2, 0x63b1aafe1f19475e, 0xdb67cab1c0cc4a22,
+	0x5a10bfcc1da9f3d7, 0x3dd32bc970dbad19, 0xbc51aa682e7ec3ab, 0xba83be62e0c0c8a8,
+	0xa5e7d8cd4db73a88, 0x90b3cf2b5dc4f779, 0xce4c5b5cbd230980, 0x8aa155f1413ebaa2,
+	0xbe912bce780567, 0x263ed66b1dc9c829, 0x13002984346dcde8, 0x5e63193372ddf29a,
+	0x4e27ebf0442929ad, 0x382319edf2713377, 0x350bc8a3b94abf1e, 0xffd0a77c90e587ac,
+	0x2946b53e00ff0900, 0x52efc1f57ae59855, 0x9453fae73fe38071, 0xaa495e3d9cceac6e,
+	0xa49d083a76f9e991, 0xb6d4dc46de0f1283, 0x54e90727fc533999, 0xf9f17e4a14f367ec,
+	0x42562adcaac91f25, 0xda389bd78c61c0ad, 0x499653453d3cfbe8, 0x43c998dc9ad0fadf,
+	0x236fa97dfe3372d4, 0xfafc03e79503efca, 0xf1879923c6982e53, 0x8ca6a23e00ff8861,
+	0x8e15f7c838f5f283, 0x4f3ac9f2083dd2aa, 0xf41c5bccb125ecfa, 0x815d5646d6e669e8,
+	0x20d964a3dae38c94, 0x242e31bcb15d451d, 0x77a978ae044f95f9, 0x3ab55c8b31d2c45a,
+	0x59d96888c16ecd19, 0x41b4d069fca8673b, 0x56f8afd0819059b0, 0xbe32baf1abf5adfd,
+	0x89c55e9855fae998, 0xb3477b297dd82806, 0x733a777311a8e42, 0x7aee41315fa91364,
+	0xb432642467413a7f, 0x85a76bfce3903b6c, 0x1df68522fb39c4f4, 0xc6a3a11eb92a00ff,
+	0x42fe8998fb88b638, 0xcd2b49be756ceda6, 0xf7836b7b9b39f7ab, 0xb1d48ae1fd917651,
+	0x3fc7e485c9c89fb1, 0x4c7f9d6ba5cf4f2f, 0x83db6c7b1b18b95f, 0x94586d2b45adc951,
+	0xdb145583f9e7569f, 0xc89fa415e1b4c2d8, 0xc03816cccf49f6a3, 0x6ab14f4276b00ff,
+	0x58054eea9398f9d5, 0x2da2e319e347fa92, 0xf9fe31a5fccb9157, 0xc7a796a4d0e995fe,
+	0x5f7652bc54d95866, 0xdc7106dab9eca0d6, 0xf1c3f0ae038690a, 0xb682d22b1d184e61,
+	0xc69df7339fd7c8c7, 0xfc28fca5f5519a8c, 0x47e347e38791532b, 0x1445d18640e147e1,
+	0x511437608aa228c0, 0x9a909622a400289a, 0x8fc60f80a2284a00, 0xbe1180c28fc28fc6,
+	0x286ea4f6b894b4, 0xb5a304a0465a6aa4, 0x28008aa268035014, 0xad6f04a0f0a368fc,
+	0x921a0128297d2b25, 0xa995921a0128a995, 0x9ac28fa2f1a30028, 0x4a4adf4a49eb1b01,
+	0xb401289a51143760, 0xe97d268d1f004551, 0x455102507b4c0a7f, 0x6aa4a5464a083421,
+	0xc0147e148d1f2506, 0x453da428fc281a3f, 0x941602ad52149702, 0xfcc540e95729697d,
+	0xb4b40a81a2f0a368, 0xf4ab14451d0a8a62, 0x28fc68fc68fc05a0, 0xa903a05699502a0,
+	0xefb440484b8bb4b4, 0xe30740e12f4591c6, 0x518c965631501445, 0x410d288a96028540,
+	0xa7fa93d268ddf69, 0x2050147e148d1f06, 0x144561a04e415aa5, 0x50a0142d050050a0,
+	0x50f8518cc65f0a02, 0x50147e347e34fe02, 0xa3006c265314052b, 0x8e3932a4b9837eab,
+	0x498b3e392c07dae6, 0xfbbd343f9329bf6c, 0xc3fa0f701b65a485, 0x70b5a66a92c33eb7,
+	0x49ca2cdbb99545e5, 0x3d00ffb13a46d17e, 0xfc337657d1c65e6a, 0x4fda591197eae649,
+	0x3a6efee1125b8518, 0x7c2aab51a410f7d4, 0xfaf7c051a388eb96, 0x799d47dd6e78aae6,
+	0x51a8bbc13056e218, 0xdc5eaadadfe38fd5, 0x9137a3a52dacadbe, 0xd3e7fabcf1b29c6f,
+	0x8fefdc6b99cb73b5, 0xbe52e625cd966fb2, 0xbc0d5edcf0f2ee82, 0x2d6f416b713f57e1,
+	0xa8c22023815ce3ad, 0x844febf5e9e90307, 0x487e8d56c86e696c, 0xb1e2f9877d82e0f7,
+	0xf2fb235d91417d35, 0xcda0077d618c138c, 0x727ad1b99abaa645, 0xaed50ce000ff3cbd,
+	0x638b05982493d385, 0x87fb249606d5bc8e, 0xa7ba1f4ba81d00ff, 0xf5910de7a04853af,
+	0xd8887dd91e76b7a9, 0xa450d0c7931fcc94, 0xb1578d8afab2a48e, 0x58551c39e5a5f4c0,
+	0x50b6d1ce7adcdb39, 0xffd52e9d5af76d, 0x9f41a2aaa8cf6ed6, 0x209b2d5f4ee10799,
+	0x754a63579c34f6ed, 0xbb49db225f861fe7, 0x75d25b453d4e9195, 0x8742da325f3aad4b,
+	0xcc4a87df8053303f, 0x7821569af2bef954, 0x34abd0a1c951ebcf, 0xe18f7ffa7766adf9,
+	0x55b9c3ecd63784f2, 0x86df7ac46a5e3f0c, 0xa63c8f91c8b6182e, 0x3862a6e615d39fdc,
+	0xe3026e25f34de7c7, 0xc375e4a7c29315df, 0x4b8fea67af16a93a, 0x813c22741b6ed156,
+	0xa2eea8f81e4fd2ce, 0xfcf13bb08905feb3, 0xf8fc08c6cc1bceeb, 0x33ec71f1b71bc3a7,
+	0x413caa63fe1abc59, 0xcc35cd37624953d, 0xf22fb3e843b7419b, 0xfb37c877a7f70c15,
+	0x9f4dbcc55ceb0fae, 0xaa3df17b1ff61594, 0xf4efdad546582649, 0xdee260a5de531fc8,
+	0xa639b955db1f9d9a, 0xf74d237873b551b9, 0xf267e08c2a8fa10c, 0x2799cdb45ddd67cd,
+	0xb2dae9011c109d5e, 0xbb9b59ec629acc9b, 0x8ff70748cb08961a, 0x731761e1e8bad603,
+	0x5fb4e8aa15e7c5c6, 0x6001327b24c3e5d6, 0x762e9f24eff6697d, 0x1d844b8a1cb5eca9,
+	0xa8d5b45fe411ff8, 0xa7915d33fd6000a0, 0xa3a3ac5ab73cf604, 0x55f373180a61c9b5,
+	0x7555cb005e22ae88, 0x6afcdb3310e05686, 0xe4187700ff90b155, 0x14432fcd676bfc63,
+	0x3952efd2d3dc76d4, 0x2b1dbae2faf2cb32, 0x35c73d606e4cb35c, 0x35b012780c090bc9,
+	0xc7b0233f942b6b5a, 0x2a9b536aacf4cf39, 0x2a52b6ea58ac6732, 0xb5757e3aea7391a8,
+	0xaf758c5fe5087b67, 0x7c677eddf29eb517, 0x9e9dd6faa77c9c8e, 0x82d30b21ddb870b3,
+	0xf658e38d5dc69d6b, 0x8c316e6528036f58, 0x4eaf1746e60db30a, 0x4700e0769d74cb6b,
+	0xd76a6bfc63603ace, 0x630b7d0c166c755f, 0x478faaf166e4a8f3, 0x3ace010cb952bcb3,
+	0xa36e00eed8d5f9e3, 0xb793e0c8baf6e715, 0x122f43d5b5d77aa7, 0xd91135da4ce5ac75,
+	0xb855fb3cb9e55cdb, 0xdac915313fb1e4e6, 0xcfc901dc607e28ea, 0x5d415d2badf7f9,
+	0x4cd52c0e568cd7dd, 0x3de8f432bfb259dd, 0x9a734ec738c74529, 0xa93d3103ce59fbc6,
+	0xad0ebb96477ed16, 0x9952b820e9482d56, 0x7e96a9f99e319e2d, 0xf0da6eaef548107a,
+	0xe0dfcaeaddeeceee, 0x41c75cb1d2fbdc72, 0xc776543bd890c20d, 0xfb28407776abf87e,
+	0x6f98b9e2b89e71ac, 0x9f8e43cf89f79907, 0x663ec850d56e995a, 0x4a1c6afcf5371fcf,
+	0x8c8cf144b74c47e6, 0x96d72d52ebf86ef7, 0xf7ba704dee753337, 0x1ae924498c4f9388,
+	0x9a2be811b39c93f3, 0x9006bec72375bcd4, 0xd2647b60c325b7c5, 0x668dbbf548d521e4,
+	0x5492711ba72561d5, 0x5cac6ae785eaae6, 0xbf00783f03f5262b, 0xc543fdf07ab7c789,
+	0xcbf41462162b1357, 0x2255ebf9a7d3ef13, 0x777bb4105527eed5, 0x557a9e7f12379291,
+	0xefd743df5d27337b, 0x60e7c45b5c28213e, 0x851df4c70a97f6ce, 0x890808b9358f3766,
+	0x1cfa49199963641c, 0xdd5fa7936e5ce58f, 0x1e61d81d9344fb30, 0x1fb4eb5a40963f09,
+	0xe5f8a83c821bcd0f, 0xe5a8fc93f86116ca, 0xaef8a0a991e77148, 0x7376d319365f46fe,
+	0xdee9c3b27d362b22, 0x2bc5d0fe92ef48ba, 0xff698f071c39bb, 0x8d69443a69abca0f,
+	0x15391ef3631732d7, 0xe2581bb3d873da34, 0xfff307d9504f91, 0x571e2deac62e56eb,
+	0x7f1579b647447bf1, 0xf2b433beced73b10, 0x6ebcaaafa1639024, 0x1c66152243122caf,
+	0x896fe76becf85e86, 0x577b1de394245bf6, 0xcfd5858c9b471a5e, 0xda4156eb4f895330,
+	0xfb415e1539aceab9, 0xe3b8875dc12256e3, 0xc5da7b981cd9aef2, 0xe3c81d5c99f217cb,
+	0x48820cb935fe511f, 0x31dbce35639c2740, 0xecb4063946c6118e, 0xf5c7ca9d22cb28e6,
+	0x9ffa4eafe35a3ff4, 0xd9d82b17b9e2954b, 0xda70e3369a689658, 0xb6d1e5b6aab1c7de,
+	0x35cb9f0ddb78004c, 0xcd71c8a99c83d166, 0xe3bcca849100754b, 0x3b2bf5bcde515fe7,
+	0x37a40a9e47a7ea33, 0xe7a08dccb8f58f5f, 0xde41c42b8d3df48c, 0xc78957bdcf31ac88,
+	0xbf9b8fb1b173629c, 0x396ee58fc9ed56e3, 0x822689d2cf3fdde8, 0xae10e0bf6635659d,
+	0xf54fa6e3ca68d8c2, 0xfbb67cbb35c325c5, 0x2b26aea9f4e7f0d7, 0x1a7b1832ee408e8c,
+	0xec405d1e92b7b822, 0x2f4abff500ffeec7, 0x1537399d4aa0ed2d, 0x81e52641bba8322b,
+	0xad3d35f4a3bc7f32, 0x2a749cc502c5ccdc, 0x9e6332bf8e90cf2a, 0x294390d9720a370e,
+	0x45daa3a100ff3d5e, 0x6485d0f5682d1c93, 0x5733bdbb8d046491, 0x5b4e618f18c6e595,
+	0x968a7a064201ca7d, 0x35a2389e875dc018, 0x74520d53817ea522, 0x77225cba2def2ff9,
+	0xa9f24fb2bd99552a, 0x85d2e9f31cb7dbe3, 0x5e2c52233f0e0389, 0x783d4cbdd2eff88a,
+	0x9488599eb9f1b125, 0x721c3f2647fcbb9b, 0xd9f5a00ffcfd929, 0x4ec51d0306e4baa3,
+	0xfdd0831b19a02cb6, 0x597e3e778858ecda, 0xa319570900ff2266, 0xb718b6dd114dab18,
+	0xfd7294b7a6a8f67b, 0x65eeb1aa55d0933b, 0xd23a9e80d0550d2c, 0x293d19001d7acfa9,
+	0xe93ce74aad02873f, 0xa325a0d0a1485f2, 0x284a9a00a0993428, 0xad93a6d44801a6,
+	0xfc68fc00288aa221, 0xeb1b0128fc28fc68, 0xa228004a4adf4a49, 0x1b80a2284a009a90,
+	0xd1f8d1f801501445, 0x8aa2680350f851f8, 0x35025034a3a44600, 0x45e3470150522b25,
+	0x297d2b451b30851f, 0x36004551d2848029, 0x5a3fa4f103a0288a, 0x1a290128fd90c25f,
+	0x91961a2901a89196, 0xa7f0a368fc2801a8, 0x3a34a42869500a60, 0x7ea705803a056995,
+	0x1a3f0c147ea7d534, 0x298ad1224151a528, 0x569fd2a8581d2cb, 0xe147d1f80b40e12f,
+	0x21a42846e1140045, 0xd1f88b21054a51d4, 0x518cc24051f8d1f8, 0xab14c5a883166846,
+	0x7f0128508aa2c540, 0xa3f0a3f1a3f1a, 0xb4b40050a014a328, 0x8aa2a51855008a62,
+	0x7f2181e252a02800, 0xa0f0a3f097c64f1a, 0x178ec140513b8a02, 0x8cc7fb89f9c1a326,
+	0xd3fa74b25bce8953, 0xf5f39f23fc931772, 0xb2bc0a47523704a4, 0xfa73d8c77c0ac937,
+	0x9527993499f04dd6, 0x27ba170a26f5d27f, 0x6e88f46aea871f65, 0x4e1319c7e4d892ef,
+	0x8e2a7ffdabfb497d, 0x5a118819b4c685f1, 0x1d6deaa1bae9792e, 0xc7a49bfd4f10df0c,
+	0xdeaee58b741e0967, 0xc68e2afef9c777a0, 0xe53a13e33774d305, 0x64ad3a3f40c739ce,
+	0x2b661cd426d753c7, 0x9a53bf3df7bcfb71, 0xc21f245ee64fabb1, 0xed331d074f70cca7,
+	0x7c68e9a153dfb3d2, 0x31dbf11665f25ad9, 0x9efa27f545c1b06c, 0x772445aa3b57e4bf,
+	0xb4860ec379051b0c, 0x301f2049b2b02b35, 0xb1bde538c7c062f9, 0x72f942e986500590,
+	0xa243bf3256fb5480, 0x604c659e96b48c9a, 0x63373af906aba775, 0xecb01c9e7f004d53,
+	0x4fb01508a0ca5f07, 0xeca08452b99334d7, 0xf936920abff7310c, 0x87bfe56a5a4fbf76,
+	0xf6f4dcb2bcd37a20, 0x2ae339a27ba738a6, 0x8c933144e58fa772, 0xa09bdf3631343577,
+	0xb4bece0eaa12a7f5, 0x4706f4cceba81473, 0xb9abe29c7e52388d, 0x76bf8df43ee5e7c9,
+	0x918581b2acd2f871, 0xbadd9d13d134f9bd, 0x375600ff2439860e, 0x8c2cc7598b52bb7f,
+	0xa77c8b2a00ff0c3f, 0x59aad49d7ace318f, 0x9347a596c69f887f, 0x98fd1cc26d9865aa,
+	0x3352e1c761a5dd03, 0xe164474c2b2f87c0, 0xbc1fcb52b5fe3f7f, 0x4fa59f1ca8183a7f,
+	0xec5e3056e3cdea2b, 0x996e7922e900ff7e, 0xe6fca3ca5e0400d7, 0xe65c1f74bfaa0ea3,
+	0xfbf636abb8bd51a3, 0x4bc3a9adb1e34ccf, 0x89c93b29ab547324, 0xed6a0e7a9df2ca08,
+	0x30f036002383329a, 0x19e3dcc6f5dbf029, 0x4a0449661cb18aeb, 0x33af72285beb553e,
+	0x17981b047939671e, 0x50356215c7f40023, 0x18c0289495c21f37, 0xe9283fe773472cc5,
+	0x2555ce282a425bef, 0xb29aef65ab455e52, 0xf64981b2a46a07ac, 0xeab686851ebbd80,
+	0xed7120235656a4e2, 0x86aa05647f12659, 0x381a3677a0f58f3f, 0x1460aac5bd6a7099,
+	0xff8c515754438f27, 0x470fbd7d52eb1700, 0xed6eb798c3959415, 0xa5eafb9f0a46651b,
+	0xe3c739accada559b, 0xd87806bd076cbf59, 0x394cd2c95a3fc3fc, 0x3c066c21a90eab99,
+	0x8078a7b1959ea472, 0x6eac5cefc83da3c4, 0xe5a762558a01b781, 0xc756a30d1d95523c,
+	0x3d23468a213e69a5, 0xb5d3a02ba61f9c31, 0xd79b5e3e4c3f80d, 0xfda18fc346c4db9d,
+	0xc942c5a4aef0b12b, 0x988e8d52c915f7d4, 0x25c86dc11e8b955, 0x7f4bd07e69fd1e41,
+	0xb600b8e0c6266b3e, 0xf43c23b9328cab39, 0xe11db948a51377ae, 0x404d4e73e0191f1d,
+	0xc95a7f80718e2df4, 0x515d00ff8f0c9899, 0x2eada777d768bbba, 0x9d2d627e8c88d5b,
+	0x5a5f203f6e03f309, 0x31b45e32573cd6c1, 0xe7c9050f8217b549, 0x1989ecf276aef5af,
+	0xc6ebf5497266edb6, 0xa5395fbbb8c51a7f, 0xfd6c4fcff5c430f3, 0x539532572a55f971,
+	0xbca6e53e4fb5d4a2, 0xf7c9398f782aa491, 0xba0775a9ac74f927, 0x1f837cb7316f799f,
+	0x7581f51e870efa28, 0xa275bcde706e20a8, 0xab567a0ce063750d, 0x9ed3b1aa535dcc0e,
+	0x49f8e746e29245ea, 0x182b9c6d3ac3e3ae, 0x615eeda8ca28bf62, 0x74addf325264e267,
+	0xb9191495ed8a6f3a, 0x8fe6d466d1896af6, 0x47815045b5e5d35d, 0xb057d0a6de5a6abd,
+	0x486e613c2dc92be8, 0x5bfcacb5e6f6f0fd, 0xe960b5f8c1fbd11e, 0xa4bead7aaea8501d,
+	0x4eb466d0e724edb1, 0xb231af96f2810aa0, 0xad184ff0ce1522f1, 0xcd8b34807c7f2d7b,
+	0xf1d84c32de6c2a65, 0xc86da0f93077a455, 0xbe9faff5f7b82339, 0x4e7d8ac45ddee92d,
+	0x49dbd624dfea7b0d, 0xe448ece283bc6204, 0xe6485d298abc9ee3, 0x975db8723ef146c5,
+	0x5705754b6a620f4c, 0x4ca9d985f5d3fafc, 0xfcbf6d3a00ff1c3d, 0x70f3d8327acdf4b3,
+	0x7e07c20b462cdeeb, 0x8cd4036c14b32d95, 0xdd3f092523537bfa, 0xc7ed40b9032a5371,
+	0x8ed2ecb94f9e6be0, 0xab71345c58686ecd, 0x5919b3953ea8830e, 0x58f3747f986fc8a3,
+	0x3f4770a46c74e316, 0xeb1354d31abf1e7, 0xd670457d0e0054ae, 0x290e4cfadcf4cca7,
+	0x5ee4e13afa68dd2, 0xa8c0bdac4d178cb9, 0x7ad5f9c62ef1c46d, 0x26b2294a7d5b2a7d,
+	0x865b353a0cf5d3fd, 0x9a53f7d9ca5de428, 0xd9578fa41594e6e6, 0xdcfaef4ae9f9acd2,
+	0xba9f3160055ca1aa, 0xe2e5c693cda52add, 0x68ad897d3d677bf9, 0xd58cc71e087050e3,
+	0xa64f650029836d98, 0x5163e109761c5528, 0x99e124c1cea92525, 0xefde094f703774e,
+	0xb30bcaa8e4b5e52a, 0x95b4e9554c7fd02f, 0x632bef23d686592c, 0x31bb0db642ad873f,
+	0xd5be3e52ac7f7abb, 0x568f56a78299d17c, 0x725c1816ccfe154d, 0xc2a96fb94a3fc641,
+	0xb645d5faa37e041b, 0xd1549cdc71fb8d97, 0x203940d6c8ce4bd9, 0xe3e1a9c67fe82363,
+	0xcb25acd21c637425, 0x5ba9ab4bfcc17f51, 0x6f4d0df85f39cb15, 0xc23ffc86949fc1a9,
+	0x6e0ba9fcb26845aa, 0x981e9fca9f918103, 0x4bf3c2771440664b, 0x1695f6af192d4dd8,
+	0x388dd500fffd38ed, 0x3f86bf0de0f618f5, 0xc769e79671ed3ba5, 0xc6d08d4db2efacb1,
+	0x8dbb629596a5e8f8, 0x85b4d25f7fe17abf, 0xe24bc08cade5c83a, 0x63c4b0c3b569e4d3,
+	0xefafb12e548cba6f, 0x41ddb7d2a49a7c24, 0x80cdce146906729f, 0x1f7aeb54daaef433,
+	0xfdb7c91e60c58d3f, 0x114e107f234b974, 0xf1360e4d1d38d4dc, 0xe2347a8d1fad9f9c,
+	0x5ace684d5cf9dcd2, 0x8a661ca328d0eb2f, 0x69428aa2700f1cdd, 0xa7690a80a2284a88,
+	0x1f00455114004d53, 0x851f851f8d1f8d, 0xdc48ed7129697d23, 0x74049ad344d0150,
+	0x284a006aa4a5467a, 0xa3f1a3f103a0f0a3, 0x1445d106a0f0a3f0, 0x4a9a1080a228da00,
+	0xf0a3f1a3f103a028, 0x8aa26803a6f0a3, 0x51b4015334a3286e, 0x85dfa9358d1f0045,
+	0x408db4d44801d034, 0x8f02a0a4564a6a0d, 0xd2cb29000a3f8ac6, 0x5aa4a5e500b44a9b,
+	0xa3f69fc4e0b065a, 0x7a3945310a80c25f, 0x686991c2290c50, 0x40e1775a4de3775a,
+	0x4a2fa70e40511405, 0xfd2a45d102d02a6d, 0x14851f45e32f462a, 0xad0250a720ad5200,
+	0x5a1fa520d0d2222d, 0xa2f11780d2efa545, 0xd3eec329008ac28f, 0x4aed28460b815669,
+	0x53804051142d14b4, 0x3f0c147ea7681abf, 0xa400280a3f1a3f1a, 0x3263d2527b9d8e63,
+	0x8ec21803a078f61f, 0xb892ac0da9ec0dd5, 0xd4f9e79f1ee740f9, 0x9601ef54416f3efd,
+	0x1ea4ef1ff17c1bf2, 0xc7a4f2638b1f74a0, 0x2ecf93ad4dcdc21d, 0xf8edf1fec9cbe77c,
+	0x5d6b66d7c60a3f70, 0xdf818af19a01ae14, 0x550736bfcf4cf1d, 0x73bf4721eebcd8a1,
+	0x39abf8df028415fe, 0xcf95d0938182451e, 0x476fac3d51e5cff5, 0xd859b2bd6dd0677e,
+	0xbb67f2fcb28c6bc7, 0x54cb3ec9d93e1863, 0xb4fec933cbb0c6dc, 0x2ae64fce71ddccfc,
+	0x1fc22479cc9716fb, 0xaf1f00fc76777dbc, 0x1006d918806b65ad, 0x539fe919fc0d5365,
+	0xef2ed66cd6c09f8c, 0xae5c91a495540753, 0xe2cf93ed1895cbd0, 0x13e6d55acdfd5473,
+	0xf445858bda28335e, 0x7aafc755953f3050, 0x3f6295576e7cd4c8, 0x75349678a23b9e1a,
+	0xca69e1586ed51cf7, 0x4eead466d25271a0, 0x9161605958e8453a, 0x1ce9c835f41e576e,
+	0x1412d23cd4bc3e6a, 0x4bd3f6362a97e674, 0x8d34df42920fc9b7, 0x764d53b7ec1615f4,
+	0xb47ac7180368b225, 0x524ad6637254598e, 0x64a71993d245bde3, 0x7c21c51b8b2d692f,
+	0xc03924a9890a7a2e, 0x7a4a2ba451a522cd, 0x4a3fdfbb9bde0306, 0xf58c0331b49e8c6a,
+	0xd5724fce99b38aeb, 0x6da068ad35fecdaf, 0x776e3a693157500, 0x3519ed72e75b6cad,
+	0xfe96c9ab24ca4ed5, 0x3dfdddccc73862ec, 0x69fd411802acedea, 0x69b55e8ff9ed3096,
+	0x5b49a9ac6e5501fb, 0x9ed081bdaf2b2596, 0x419d59b56797266a, 0x6060ec3a6b90238f,
+	0xfce28f774d48a40a, 0x8dd7aa77a4d79caa, 0xf5dd2e3d2a7dabb3, 0xf549702d6f09c10b,
+	0xcae456f99d394a3f, 0xcaefc696e3251f56, 0x714fac80cd0e17a2, 0xf2475b5ba29d965d,
+	0xd6f8538ff7db01c2, 0x3b084ca909acc52d, 0xc949511e9eab77b7, 0x1b0ed979c5ec3a98,
+	0xd75a0d8bebd5f82b, 0xd3e02eac2ed6b245, 0x9689a4ee6c9106f5, 0xb6e131c20119832b,
+	0x8c523345a6e35c96, 0x5fc775a08d1199b4, 0x7236a4dc92bc655a, 0x33118ce55624cd5c,
+	0x67e0a9b6e5ee9192, 0xd67c71e68aeb3803, 0xd263b8b724765429, 0x3e2e1277cceafc46,
+	0x9128d7dd34096a60, 0x7d4a7f8c71ce96bf, 0x5219b90532f6acc5, 0xece28578303577e,
+	0x79920b7e91a2c2c5, 0x84cb1a7a728e5acd, 0xddc5552463569167, 0xa0b9354fc8901a1a,
+	0xb59ceb3d409994dc, 0x8e5364db94bed66c, 0xeaa927bdd18d13f5, 0xeb777b0465061d1e,
+	0xe21c7113ae360c5d, 0xdb33524416067cb0, 0xaf07a1c1b6f677b5, 0xd3ea995d1579851d,
+	0xed5c955bddcbd18d, 0xcf959e00ff7ac6e9, 0x815eefb1a51d11eb, 0xf1912ba6cff56177,
+	0x19670d7d1b95bf55, 0x1546d7eb9d672a95, 0xbf5e49a63d05365, 0xc2cec567abf9c9f6,
+	0x234b37724d920046, 0xb459c191be6bce49, 0x9babe6949fcd1717, 0xab02d91430dc828b,
+	0xd83407009c584600, 0x8c17960f60779663, 0x6e3b2538f4e99a63, 0xa6f583cbd44be64b,
+	0xf36c39736c27a78b, 0xe46c2465da8d283, 0x7568adf5043886e7, 0x5b1add74d2525f1d,
+	0x2192fdb2948e35a1, 0x80f9f73ee695af0a, 0xa3623b4ebcbf65cb, 0x246c0df192d99993,
+	0xd671d2a40a09f257, 0x409a95c777ea58af, 0xfe187aec0b08c33, 0xbcb4618c0ff12283,
+	0x3401e32b7e188de, 0x1a117c203ed16bfc, 0x705c488bbae8ab7a, 0x8ad12945fd242f93,
+	0x9fc76e269ed25c6d, 0x9c5965b7ba259e68, 0xbbdae71c7800ffba, 0x7809ab3251c4077d,
+	0xe8a983d6bae4f53e, 0x1bcdd1c433d6ccfa, 0x3ebc57711f3cd361, 0xfb984f865575526f,
+	0xb3c96b347aa02cd7, 0xbb151ecd687d34df, 0x3b2c2302f13fd77a, 0x8d966b8be09bd6f3,
+	0xd2786ba5df7c2b0b, 0xc5350338e28ea5cc, 0x9f3a6ea2b623293b, 0x7199582b3fb67835,
+	0xda7fd0fd5baa66fc, 0x7b9b51891886fad, 0x51cfad726a9155fb, 0xaa9dd479947d76c5,
+	0x898d5fa37625c17, 0xc7c7ef838ad85365, 0x1c3bae62dfad53f1, 0xa39d7e8fea992b7d,
+	0x2a8ee7af5b2ef43b, 0x408e99985be747ca, 0x3e5d15fef35fc72b, 0x5cb673ab55f89161,
+	0x62cfa6b9d2c78d8e, 0x86422e52ecd15384, 0xf1df71c7085e862d, 0x2a532ec198b7a4e6,
+	0xd53dd53ee3067aac, 0xbf23c705afa4bcba, 0xc9ca8d500d7de45c, 0xa7635c3b753ecae5,
+	0xe839b51c4d1b69bd, 0xca0bf7f7569b5a54, 0xf52d5733420fe64b, 0x48aa3ed9320f1267,
+	0xed383803643b24ac, 0x789159e0b4fc5fc, 0xa8f4d82595e71a3c, 0x883af3f5af696ae3,
+	0x19bb0df55f473bb5, 0xd84edadfda5233ea, 0xff808e83c93cfb, 0xad2cd84d92e1e65a,
+	0x902b936567bbd5d8, 0xe4b1d6eb387082c0, 0xda95945900ff9d49, 0x5b684999ed58bb3a,
+	0xfc6a7db6e33938e5, 0x3f80d1d21ec75a72, 0xd5053757f9730685, 0x560b0fce38ccc8ca,
+	0x438f63f7ce779a61, 0xc5c35397f2b0945d, 0x52233fb93669d4e6, 0xcfad927fdb588b6b,
+	0x2ba84950213fc605, 0xaa02e3fa0bc21130, 0xe6ce3882d970c47, 0x6e5cb425daa90132,
+	0xfffa784ef72fdd, 0xa93c755d3a2c7485, 0xd75d5192aea8d366, 0xce87071717b711fc,
+	0x2acbfb63500dfc71, 0xdf660686a5e6f4ee, 0x8044ebe6e3c9162a, 0x5deb080e7721d946,
+	0x5e00ff5a8a2e8711, 0xa6f37cb5bf5a9947, 0x463342f200fff992, 0x52d01ff5c91d709b,
+	0x1417e80bc8b8853c, 0xc199f49ef35c4ece, 0xc4d5e69987f156e0, 0x7d2e66d75f12f627,
+	0x37e9bd8ea3b81e07, 0x653851b6668cd613, 0xcca8a2289a83fc36, 0x5471428ae600c509,
+	0x941a29008aa22821, 0xfc00288aa20068d3, 0x128fc28fc68fc68, 0x690a8092d2b752b4,
+	0xd3941a29004a6aa5, 0x3f000a3f8aa20068, 0xa0f097c24f1a3f1a, 0x491300342145d106,
+	0xa0288a12801a299a, 0xf0a3f0a3f1a3f103, 0xa30dd01445d106a0, 0x8ac68f1230355234,
+	0xbf536b1a3f000a3f, 0x925a699a02a0690a, 0xa80925a29a91180, 0x5680a3f0a3f1a3f,
+	0x2dad02a4a5455a5a, 0x68fc68fc8e81a218, 0x9616299c02a028fc, 0x1d80961669691580,
+	0x50f851f8d1f8d1f8, 0x81d2ab94945ea530, 0x40a04ed1945e4e0b, 0xa4c2efb49ac6efb4,
+	0x710145e147d1f861, 0x2d050a40518c9656, 0xa4f197dee7025014, 0x51140540e12fb5c7,
+	0xc2404b8bb4b40a40, 0x298a8240e1b4299c, 0x1a3f69fcc540e957, 0x45e30781c28fc25f,
+	0x46a11938811a5014, 0x5c6b555c008aa238, 0xfd1736324772c9bb, 0x6fa9f127d75f38d5,
+	0xaa7c331cb6d59659, 0x5da0b174fec0c97d, 0x8614871f0304bcaa, 0x32edf6d64eea2bb6,
+	0x38ff8e7e553988c, 0x1bbad6c2a68f35f5, 0x7fae77e3e85e42b9, 0x351f101fadf5c3fa,
+	0x437e9c6c641db4a1, 0xa4e6515493ca9ff9, 0xfe9fedc851e38803, 0x771bede2cd3dd4b2,
+	0x5f22b60a6114f129, 0xc09ac40f9200ff39, 0xb422f3f1fd022ed5, 0xeb7dfe0bcff827a7,
+	0x19d96d219dc7e172, 0x417fe647e1f6c091, 0xe794f266f9fe955c, 0xd64c7f6cb1e72a7b,
+	0x7ca6de8dd21a7a53, 0x53c89fa3ee0e9970, 0x6cdcafdadb934159, 0x1fb063091096dd8e,
+	0xe78e32aac67f47f6, 0xa4de205c879eacf2, 0xa719632aa7d5fd7c, 0x4b9158531ce5032f,
+	0xa10207cce096ec52, 0xeff642d36c4eeb63, 0x3ba547864d4e194d, 0x7a6fb80a4d9ee418,
+	0x662c4681265bae72, 0xe7d2fa85ad74fedc, 0xb676a0968331291d, 0x7f8fad69927170c3,
+	0x48b59e73a68995c2, 0x6000c30c015b52c6, 0xd42fc47224ac527a, 0xad374369ee300bd3,
+	0xc08ee552ef5ea656, 0xb60bb65b539f53d8, 0x1dbad60326ce6cb0, 0x73416baaae01723c,
+	0xe38e980a6480d35c, 0x974f666a1b758bd2, 0x1d79f928a98cad22, 0x74d34a476ac495aa,
+	0xc00884def3785615, 0xa37a0fa03062a0d4, 0x4e19d9b50b574c66, 0x15237087b8a3eb55,
+	0x7a93442d0966759b, 0xc46826d7497ba389, 0xe2c73192c0f69177, 0xeb0bdcb72d88af2a,
+	0x453dae5791f43a6c, 0xe58cd96871cb5965, 0xb19ccd7ae96e0d7d, 0xff407ddab5bb85,
+	0x4f6a596e2562a90a, 0xd6be18c9d2de3d5, 0x8f3cb81e188c8dca, 0xaa2a81d156ec95c2,
+	0xf7c28b14bae67e0f, 0xe52aea9b2d1f3b5f, 0x169ee42e6f818e9d, 0xb164c5c1ee7ad361,
+	0x31d2de0c3c418f51, 0x64aefd33dca43f3c, 0xd65aad1f56e04f65, 0xe04a1549564b86a1,
+	0x559a66fba02b7d82, 0x63cca697cf7c6e95, 0x9407f6b5c65c71dc, 0x4f9a93d473b613a0,
+	0x73ea9284a5d01715, 0xcfe40e42c3a56476, 0x71ae441ca7d5deca, 0xcab7dc26319a3550,
+	0x7182b2068a5637a, 0x2da7b925e13439ae, 0xee64696a0d05e388, 0xd4d1d39adbcf5a1f,
+	0x511a5bd25a9f8bf9, 0x4477e30a7feb91f8, 0x875dbaeb15a707c1, 0xfecd2bbd9dfc0a99,
+	0x18cf03134723db10, 0x60980d9c065aee15, 0x778883d79c31b2bb, 0xdd9b39518a52ef91,
+	0x571c00ff5819ac34, 0x3c00bd2bb743fc9b, 0x842c0c647beb5e03, 0x17cb12f1575ef30c,
+	0x329a6b1df5fa364c, 0x5fedf0c40ba58df7, 0xf18b2b263bbb3249, 0xeb15462f2bdb1124,
+	0x57f831aa2c27f41a, 0x92bad9653e68ac11, 0x851f39a77024cc48, 0x5f466a5d1eaa147a,
+	0x3ee1ada6731b7485, 0x50e981f3e48cd264, 0xafb50fad69c5a54d, 0x7b23605ce2396d95,
+	0x5084c1d69ab0d49a, 0x2ba68f9f8f7ac12c, 0xaf976dcb6bb43966, 0x5de3c7284370ab2a,
+	0x98da3cd69643c4d1, 0xda9f874f26634b59, 0x46211f5686abb20a, 0xe85807bff4b4c2fb,
+	0xf3011a47c32ded76, 0x74d3a7ce8fe73c6e, 0x1697c43b4d3e29cd, 0x6f003b9dafdb9e8,
+	0x3beed6165dab34b6, 0x416f9409f5e8bbab, 0xac290ee03eb82377, 0xbb3efb9f53cb164c,
+	0xf215becdfedca1eb, 0x4659a385e7d7a52e, 0x9f7b3f53826165cb, 0x6b9dc55f5d013f5e,
+	0xb7f30c26399ad14e, 0x3d4f3b3e0311ccd, 0x8b4f2aaef43c67d0, 0xce86e95af2b61637,
+	0x93965a5a3304cbd7, 0x1701fc04206c718, 0x66620db5d75437ae, 0x65ee19046f2b63bb,
+	0x81d9c7fc8c602b2f, 0x2e18eace26ab9415, 0xf124d43a9e995d5b, 0xccca71bcbd8a8817,
+	0x5e1f031d35260338, 0x75ebdef00d9e744d, 0xc2336b72a6f34533, 0x5b6ed879a94d0b5a,
+	0xb75ee97fefceed2c, 0x39001c55156258a0, 0xe8e1ea91a552cf15, 0x231429e90e2f525b,
+	0x3581c2f6a3df211, 0x7dda75a5871f4964, 0x9f2a00e4643b50a8, 0x728e6c37d80bad8c,
+	0xd271aa23ef9ccc2b, 0x5a8c2d1800ffc7c7, 0x4eade49a730c84d4, 0xf61fbdca0f04f578,
+	0xf18b9a2da16b585, 0xa94f81ac1cd6bcd6, 0xd1b49e4aaff3e71f, 0xd19d5b69acdd4be2,
+	0xc3fbf7d8697d3cfe, 0x90866d3654f9f38f, 0x19dd655b0dde750c, 0xee192d61953fa123,
+	0x24465ba2f9e9f7d1, 0xe9811f8b5ea5dbe7, 0xdcb4a2b0cb0f059, 0x7aa8e64a1f27f48c,
+	0x51cc8f24896c59f8, 0xe66f79af1a3acccf, 0xf883040e92fcbb3a, 0x1504a1db3cb5bebe,
+	0xc3d3169d3ffea0de, 0xa85b897f7900ff2a, 0xd3586547b5e4e2ac, 0x9db1faebbf7be59b,
+	0x2387cc270396b72a, 0x97b5a5d623773c6f, 0xbb5a0fabbb3b6f20, 0xc8d8f2816fbbaa35,
+	0xee90806852f57e52, 0xf57fab8ceb4e8a56, 0x4a854a71242545eb, 0xcecf294975a14f32,
+	0xeb7908b75bbdd333, 0x3a00fffc813cb8b7, 0xe9c0e6b771dd85cc, 0xfb0f123c3047adde,
+	0x46db893256cc1fdc, 0x6c23914c3a74eaa2, 0xdd56f923e19fca67, 0x119c7691b8c536ac,
+	0x6e1789f3f671458e, 0xb4e6a83f17696fe4, 0x7b4ecc57bb4da66c, 0xd99ae7a938f2c31d,
+	0x76eaa8d684c21e9d, 0xffc0750780a0acfc, 0xdb764c14cbae1a00, 0xb8acf547cefb1b19,
+	0x7ec23f1b192a07a6, 0xfa65303af0d3fa53, 0x37cf6ec92a45d7e4, 0xfff91384579b8217,
+	0x69b8996966b19a00, 0x55953fc9297a88a3, 0x89a21e9bdf7d8877, 0x1967fa45cef23f22,
+	0xd81e5b981bcab6a8, 0x9cf98c3eb54edf35, 0xffc90fe5bd8c5f56, 0xf36c173709fcc000,
+	0x673e229602e3c9c0, 0x404a4c4ac775e0c1, 0xee533bbe9fdb448c, 0xe37d1c548118958f,
+	0x7a3ca2a5a8515def, 0x8700ff9af2c259b8, 0x91e2c9a5f2bfe722, 0xe39ee62403281c43,
+	0x9273a56aadd3636b, 0xa8a228dad855dc54, 0x1aa9934a50829c0, 0x74d44833008aa228,
+	0x288ac68f02a0a4, 0x28fc28fc68fc68fc, 0x525223004551b401, 0xb4694a8d140025b5,
+	0xfc0028fc289a5100, 0xa80a629fc4ead69, 0x212d45481b80a228, 0x8d1f004551940034,
+	0x2a0690a7fe97d26, 0x4ed39400d448d18c, 0xf851347e14609aa6, 0x4adf4a49eb1b0153,
+	0x25034a3a446004a, 0x8fc60f80a2192535, 0xcb0128fd90c28fc6, 0xa528ea00b4b4484b,
+	0x8ac28fa2f1178002, 0x14022d2dd2d22a06, 0xd1f81d77a0285a0a, 0x6995824051f8d1f8,
+	0x9616696915803a05, 0x4b411a7f697d1480, 0xea00298aa20052f8, 0x45d162a040296950,
+	0x1f8d1f8dbf001428, 0x500c144551001485, 0x315a5a4582a26829, 0xd36a1abfd3020545,
+	0x3f1a3f1a3f000abf, 0x3455114040a3f0a, 0x558a62ab3c064301, 0x34eada5925955aa0,
+	0x81ed312683e5adde, 0xc9c82de154fecc9f, 0x9a641e928a2787f2, 0xd700ff411feddc41,
+	0x6ae78a7b24e448cd, 0x8e9197a2294fc5f4, 0xdb9d3cae515d9e25, 0xaf5a9f1ea7cf0032,
+	0x861b8833d3d42579, 0x757ed0a33eb7c7ec, 0x3cc16617510466b5, 0x29042f9f0329d59c,
+	0xfc4500ffbc7e1224, 0x8c7d4595cd7c1cea, 0x47cc8bcd92afe80b, 0x55fef43c4746709c,
+	0x245b0c2274937183, 0x1dbac2fa00ff3d9e, 0x7314e16fb0cc506a, 0x2a805803fa139ce9,
+	0x807e7085c1cd4a5d, 0x9552cace2d610500, 0xadc84c4278a748b4, 0x4f278d4251039c90,
+	0xce409626770005ef, 0x22a21cb39af37ac0, 0xbffe3ee457f7470a, 0xe8db103df3d5a0ce,
+	0xaae27f39183186e3, 0xd3d4e7e4d8252975, 0xde66d0e4e34ae931, 0xf24c783a3f3daaf4,
+	0xc11ccdfcdd0712d4, 0xa1c900aa1aabedec, 0x4de1cf1d1b0a3c89, 0x29859d5a00ff8f91,
+	0x3298e6015e883524, 0xaa28bba179bb3479, 0xdc98027863dbe439, 0x48957ea37a9f7c0a,
+	0x7d66b550146860c6, 0x45d77b233267764b, 0x8cd9ced53ee57da7, 0x7ef7e374e87a8f32,
+	0x65d47e23614fd195, 0x231b2a3d2ebf7d6a, 0x260f1efe59a58ff2, 0xc603b5c82bcbb5b4,
+	0xf62c169ae3ba6a4f, 0xb3aab10f4967a4a0, 0x5f26c6bdd4a4f40, 0x7253e5073da12d43,
+	0xb114c101d08259f9, 0xa4d386ad85ecaedb, 0x3c8f0e49953fddcf, 0xc61a1ba54c0d0187,
+	0x6e499911ecec339b, 0xcac72d6d2db62287, 0xed5ef8d8add667c4, 0xc237ddad193024d7,
+	0x4aeab8c26f65c12d, 0x29fae55263a5d27, 0xa518f5b88e3a112e, 0x739c93775b494697,
+	0xc83126c33f7dbbd2, 0xe08fb77d59e8e2d, 0xfb1ba9f6b0da9102, 0x82bb9034afca6315,
+	0x996da9acf307e2af, 0xad0536bbd06695b, 0xadf5e48a734f7ec6, 0xbd831ee613b6621b,
+	0x79c88152cbb14a6f, 0xae5b0c7a5a811c78, 0x9bac9b359b267614, 0x26b3325b74b5d671,
+	0xa73071a26e5d333d, 0x11b71e7cb447d34e, 0xb7159eef15791ec3, 0x872178462540ad89,
+	0x2346f810af79da18, 0x1eeed59eedf4f136, 0x2418c3fbe6877611, 0x594fe3d54ebf1e76,
+	0x1ea06e09cdbded9e, 0x82ab1d014ecf2863, 0x781fed902688fef1, 0xccd07ede0d7ac5f5,
+	0xd66caf54eff7dc72, 0x525c317f9e2b5be9, 0xe2f97cba57446776, 0xe9735ebef5fe0e4f,
+	0x94868d7e1b1b65c, 0xceff5a0af989e8c, 0xab3dcef5ca5f8af9, 0xcecbda003e3cd492,
+	0x74c6d82aac150972, 0x24481e9d759c8fd4, 0xf25ed64ccf31a6ca, 0x5e00ffc7a9727992,
+	0x9bb4fa2f05af7bd, 0xde6bc53547a6d7, 0xb8ae74f94314b390, 0x76706c74e6d45656,
+	0xeb01ee19c125002d, 0x360e19916581a256, 0x4df0b9d15a9f01e4, 0x9b36157eab4248f2,
+	0x91d7a50acd5bdde0, 0x761aa21a706e15c9, 0x499258063beee59d, 0x88eacc91e9a5b735,
+	0xe08b86d69c811bbd, 0x3902b3f3f7d745bd, 0x28e137bced8a6300, 0x6bdd90e701703eed,
+	0xad48d348634b5429, 0xbc3edb0acb0f9de1, 0x191288a8dba65957, 0x6ad51ee7d830b654,
+	0xc6018a12d52cdc6, 0x8553a9b2bfd5fa67, 0x2ad55c73e03cf51c, 0x23ddcf552043111d,
+	0x66dda0d7a1ce1fdf, 0x900abb3a7ff09ce0, 0xdd55e8f631828d8, 0x1fe4127f242149e1,
+	0xf9d0512ef53d576c, 0x1ab354384b0f65b, 0x5eef841baf199bf7, 0xfd66aff81ee3f23e,
+	0xde4f85b0540325b2, 0x5656b1a278a57fdc, 0x7c24ad0f63afa107, 0x62b75e96b85c2ace,
+	0x46ab9d7e2adb1118, 0x3e38aefca49d41d6, 0xde27b38ac461b386, 0xf90b4fbda7aff353,
+	0x51333df21859ce6f, 0xbb0657255c3d3752, 0xa762ed0234d35f7f, 0x9ef27e4e79b6abf0,
+	0xe9968707bb9d2a32, 0x27d917bbd5d03fc0, 0x96e41a7a70b776ca, 0x869ea6c946bd67d6,
+	0x31baf7074492c6aa, 0xb3529b6bacf6f5ed, 0xc87159dced050ed, 0x7301c15554ca6a2b,
+	0x543c7e7af82b4fd5, 0x1957ce593c8b56f7, 0x19cdd5fa7f250356, 0xabe93546a9d433b8,
+	0x2a20134f5c688e6e, 0x7beadeca4fc23f57, 0xddc8c509513d9a1a, 0xbca5f5f563b78c83,
+	0xe4846fb843da9ab4, 0x595571b7cf65be61, 0x63fc61204b02dc6d, 0xd68451ea7a8f1f70,
+	0x5fca0e8a982a8fc7, 0x3fcd7e7d917ffd27, 0x52833cf5198d1ccf, 0x23f580acc070522c,
+	0x92d06db72678c59a, 0x52e33ff2e75c3946, 0x3cd7b3611b4d5f5b, 0x7c2ca559f61795d2,
+	0xcc58a236b3906a2f, 0x1c6ed57e9fb2329f, 0xd93b57e9faf0ea1, 0xfefce7f7c113e0f2,
+	0x7ca7c83c83b6675, 0x2494e51a00ffc8b8, 0x969b5b526a955a8f, 0xed41ec5699105eee,
+	0x815ea4855a453df4, 0xaa72c561cd753b8e, 0x67bb0ac3f6fccaca, 0x8a327b1e3280557e,
+	0x8d87a9cbd51d3723, 0xa4feb6a26656864f, 0x77b1b55d857fd42f, 0xa98a2db0a3e0e6fd,
+	0xa03ed3885c30a967, 0xac7f92a0c656f3, 0x6909aba275fd3f7d, 0xa993776a253c73ca,
+	0x8d634c6ceb8ac07f, 0xc6d696a27e79b6f7, 0xb805c76857793e79, 0xb4057191a6fd4dcd,
+	0x52cdf2cff8f7b341, 0xd0074926769ebcba, 0x1fab68650ea7ed0a, 0x72932a27e1ae8b3d,
+	0x902cb764efcb4af2, 0xf6765c3df7ce0833, 0xd4cebe77c2f5815, 0xaff55b7d2ecd009e,
+	0x112fae7c14359d4a, 0x9d061776d1bbd23a, 0x5b5308a756941e47, 0x1c05a14a6f4d9dd6,
+	0x2a0288a360045d1, 0x1a3f000a3f8ac68f, 0xb5cfa4f4431a3f, 0x5194342100455114,
+	0x54049ad94d40840, 0x347e00147e148d1f, 0x210540d3147ea7d6, 0x2d355202d084b414,
+	0xe147d1f851025023, 0xa4f4536a4de30740, 0x808d925a699a02a0, 0xfc28c0b4699c360d,
+	0x92d63702a6f0a368, 0x13d28c921a01288a, 0xd3f8015014450940, 0x693d004d53f89d5a,
+	0xfa55ea1853140368, 0x68fc8590d2af52d2, 0x1669691580a2f0a3, 0xb1d3a0294a1d8096,
+	0xb4947e48d1f80b40, 0x5601a85334750a00, 0x4beba31868699196, 0x8049e12fa50fd2f8,
+	0x8a62d421a4288a51, 0x2a25ad5fa505a055, 0x147e148dbf1828fd, 0x9a51d22a051a50,
+	0x4551d42140511475, 0x9702ad8fd27b0c03, 0x45e147d1f841a0f0, 0xb35200a068501400,
+	0x7159db9a6234b900, 0x165d5d04081f891, 0xcad2faf94f7d5951, 0xad9a7a5eedf64886,
+	0x64fa8c0a3be6ae35, 0xffe8b52daf2a7f, 0x372bfca702fbe452, 0xdb45fb8b30dad827,
+	0xe1b8fba9c2d5c2cd, 0xaac048c3812654b1, 0x78feb830d6fe0d84, 0x19d31e47ae4fb7aa,
+	0xb759ebe7f7e4482a, 0xa9b4abb251a68e5a, 0x7a63d794a8a9cfc9, 0x2f0db82192f67678,
+	0x8e8171dc6d3b2b9b, 0xefd625d6f9eb0fe4, 0x9f8cfa89f5fec4bc, 0xcb9bfd5c5c73abf0,
+	0x929d57afd9dbb6f, 0x4a79aec938c62be3, 0xaf6d5c2b4d0aa3e7, 0x9bb949d41e8c2fde,
+	0x53c740b65bd0e424, 0x2dcd7d46e1f22f4d, 0x6e8aa71ec322f7cb, 0xb23b5bd3f9011cf5,
+	0x7d4cc7d99ac21ec7, 0xdcec48b02d552668, 0xa3f57564d09bce0f, 0xbffbb72d57918afc,
+	0x60d4ab616c55fa78, 0x1a4f8d1fc348ed5e, 0x98c29fdbb9f7765, 0x848e1b523cc9016c,
+	0x954f33926b5a074a, 0x52c5f10bd55edc87, 0x943e68d2b09b3157, 0xbde74698b31a342f,
+	0xb35a84aa9d8ea228, 0xd5fda7bdb57e91c9, 0x965be13637394dac, 0xd69bc486b7da637c,
+	0xb4b3065dad1f6d04, 0x661ce763b4e2f2d3, 0x6140c452338645b7, 0xa7d132a9f8a34c91,
+	0xb4ad57efc0cb026b, 0xb1716197b58ecdd0, 0x6665c282aef377d7, 0x1d4dd473cded91c2,
+	0x9be321a16cbec74, 0x681cfa696da58f51, 0x4e416952013fb0db, 0x565beb8fe4088ed3,
+	0x9d492ab8e6750b28, 0x9c42a874d384e0f4, 0x86d1e9d96bc53d27, 0xc5965a07a6070a54,
+	0x563bea384f306922, 0x31a68f9ce46c9aa5, 0x64704a33a93b25c, 0x46a9897d551eaf94,
+	0x5fabdd81ebf01a93, 0x2ac60d170c80f24d, 0x6cb76743f89fd8de, 0xa7961c95d34c2ed6,
+	0x5cedf2034096a7a4, 0x536f235665348967, 0xc885208a9aea15d3, 0xbce14a8725b880c2,
+	0x3fa30e375e3ee852, 0xb18ad498bb4d6bad, 0x3f8e3b1c9bce3ae6, 0x4080b51f144d551c,
+	0x54769b261e5be9f4, 0x4b3fdd8d0c9eafd, 0xfa79c087d4eb3d74, 0x478a78c2377b447b,
+	0x96c1cfbdde53c719, 0x9e2b6565a0912caf, 0x728600fff04a1f7b, 0x16f8b7570c3f85ed,
+	0xb713030ac706b270, 0xea197fce2bfd083d, 0x76c51aadce32fbbb, 0xee3ce0a8096e7e46,
+	0x1df324d5a402af07, 0xd86e438d3f86f398, 0x8736b7a8e58a9ce0, 0xc3d8ed3e0a2b8bc2,
+	0x14d05f23eb3d300c, 0x18d832c0ce0896a8, 0xa0bcb5d63afd3de7, 0xe5b3d87a95fe780e,
+	0xe3411d39cf44d57c, 0xba8b972a43d71015, 0xff262b47fbd23c, 0x9352cdf5423ded24,
+	0xf821c8cac7f8c4c, 0x31dd6a6df48a9ccb, 0x188e93422d5f001e, 0xd4f21a6b9ee71ff6,
+	0xc730d4ddc948d93c, 0x49498da956ad6f6f, 0x469c8fd6c323726a, 0x872749e9b7af8cbc,
+	0xcacbaf844999ed6d, 0x2c69ba22d723c891, 0x47ca7ce46564edd4, 0xe6e7943f5ad37a20,
+	0x769b9c4f6347c21f, 0xdb1793324f4ed30, 0x4c9f6354b903a0ca, 0x6d48f92360c752f3,
+	0xb79dfd6aa5e319d9, 0xc29f033807305c6e, 0xc17e491b6696e49d, 0x825434aeb9147efb,
+	0x27af9c2de4a71dc0, 0xb8359fd2e7bf8e91, 0xad02397424af365e, 0x1eab57f9c18946dc,
+	0x13e6932f32a6f347, 0x67a6582351818cd3, 0xfd73ce7315ce1849, 0x1923652352bc5045,
+	0x858c322b7cd7dace, 0x2fab3d3dceb321c9, 0x84a64ecf8151f956, 0xb7c2fdb5bfc8678a,
+	0x48be4dfd07a06d8e, 0xbbde07480ef29afa, 0x16df17506bda00ff, 0x3f0809b7e54ed52f,
+	0x1f70b704dfdc945, 0x8e7c34b58a6aaff7, 0xb2abcdb289d85c2a, 0x6d82568c7a9060b3,
+	0xeb7ee86507dca694, 0xf853861332ebf57f, 0x5bf8c36a448cb21a, 0x5ab89d1b67aa3d0c,
+	0x30f0acbed8b3b1bc, 0x61b446fe414ecf75, 0xbfeea8dfcb303996, 0x475449b8b2cf6afd,
+	0x4340cb6afd13d037, 0x6b8e6bb03dd8c42b, 0x1dbc76d330e8335b, 0x8a51108ad95a63d7,
+	0x7dce42abfcb8a78e, 0x3fdd27c3bd8df3af, 0x5b30c375658e981, 0x2cc36b0d7e1f0370,
+	0x7285d95329122852, 0xde17262ecc3d8354, 0x1b0aeed11c4593c6, 0x3a0a5aea64cd79dd,
+	0xa57fda7836f243b3, 0x806c876645e5585f, 0xc192b34a45709073, 0x7afdc165f41c0464,
+	0x937a16efe0943ad7, 0xe58d1c4d1b1143a3, 0xff3689719beda5, 0xe5588ea3c63fee09,
+	0xfc80f957f790555e, 0x82721ccdd9b5fe3a, 0xdda946febb3d1b30, 0x753702e87cd2f6e8,
+	0xfeb438a6ebfc1923, 0x4ab74559b2357924, 0xd6fdb818728e5d57, 0x23a9f3d373d553d6,
+	0x27071dc3dce5bb0d, 0x1db04c3a175aebf4, 0x957fd5ab9ecb8cea, 0xc7b5ad6039bb2545,
+	0x32d29ed69c00ffaa, 0x44b39b5a0d4773ea, 0xa8072943cc07c851, 0xaf633c75de66b5fe,
+	0xde5f451640a53f5e, 0xba2ba7c1adeaad1d, 0xb3e20cf1cf830bb6, 0x5a2f5152a7ea4c92,
+	0xd6c661d81c73c1cc, 0xe2207345aec61fe4, 0xd1b22287f7479d58, 0x314153e9147fbebf,
+	0xc66a85e79672f55f, 0xaf7f2de90addb951, 0xec788e725da5a891, 0xad6fedbcaa240d0d,
+	0x1323f67ef7a89b66, 0xe50949a5064f797f, 0xf55e58f677a5e25, 0xadaa84658d991d69,
+	0x19689fcbe4dffd28, 0x53b8e0a9f09791f9, 0x4721d7f2acf678c6, 0xc37674a3537ba4ca,
+	0x4edd953e00ff5628, 0xc02d2ffe7ce868bd, 0xcbd72d00ff4a4e54, 0x5529eece40bda9a9,
+	0xa1999fb51e47f7b3, 0x6bb72a00ff7a2339, 0xf48a3a1e43ae723c, 0x4f3eb392767255a9,
+	0x3497d3b9288d8115, 0x6d9a070b5df5f67b, 0x85e5495734878e03, 0xa2a40901538ca219,
+	0xa0f0a368fc28008a, 0x5052fa29b5a6f103, 0xa204a009298ade01, 0x8aa2a40901288a,
+	0xa3f0a3f1a3f1a3f, 0x92d2b752d2fa4600, 0x4d015034a3690a80, 0x148d1f054049ad34,
+	0x6fa5a4f58d00147e, 0x25b55252230025a5, 0x598925a29a91130, 0x250fa21851f8d1f,
+	0xa99112801a299a51, 0x3f8ac68f12801a69, 0xdae3d290c64f000a, 0x9c06a4a5c003d090,
+	0xab94b47e95163005, 0x51f85134fe02a4f4, 0x3a002d2d52a70040, 0xd1f80b40e957298a,
+	0x2dd2d22a0045e147, 0x2d2d52343b067a2f, 0x51f8d1f8d1f81d02, 0x48ab94b44a0150f8,
+	0xd202a4554a5aa505, 0x281a7f0128504a8a, 0x28250d4a61a028fc, 0x408152d2a0b40014,
+	0x8fc6ef18288aa285, 0x3f000a7f297d90c6, 0xa50028fc28fc281a, 0x38c340510f304a5a,
+	0x19f3d3f3bfcc48eb, 0x92ab0824293d0aa5, 0x292243ac86943e06, 0x50c40d1598be2efe,
+	0x9aa5c9f488791622, 0x9cc238bd7239d1e2, 0xfd03bcbac92a00ff, 0x79fd93e563cf3b4c,
+	0x27e5749a8e24e5ac, 0xdc2779c8b4d035a1, 0xcf610f70fd52b8a1, 0xc4dca6cca98d15a7,
+	0xe5c0fca471e470b, 0xb1eece1053176af4, 0x6bacc0f4ddb00476, 0x78e181e5e490a5a9,
+	0x5377ec52c24a3fc0, 0x55ed3a791d5b6da5, 0x77c7a29a7aa17c8c, 0x80b5fecb46dc5243,
+	0x81344321d3a0fb38, 0x6f76edacf4c44222, 0x7b00ff1463d092cc, 0x9a8aee8fcdae29e8,
+	0x953c3877c6258a65, 0xdc2dc7ac7afdbffb, 0x7d15f6296554f19c, 0xc39f24c9b0d2a4fe,
+	0xbebe5e6db3a050fa, 0xc713d0482ae8d7a7, 0x7643d63368fdef45, 0x189a0aba59ddfcb2,
+	0x59526164fd0a9177, 0x18f17307e5b6f2c0, 0xd958f1d6a4b51ef4, 0x994a9ffb3abc6f96,
+	0x197a2d279da22349, 0xaad6437e5c6261f7, 0x901ff7fde4714c4c, 0x70298b831770cab,
+	0x73647254057dec45, 0xd0474d229a3b9e23, 0xdc46a5a79e5c188b, 0xaba9fce6e7904f71,
+	0xd75114ee298e68cd, 0x9a3a4dd306422b9a, 0xb07499de92a426c7, 0xbb953e78ee3ed9b6,
+	0xe356b77cac14cda6, 0xbcf0d08adbe51a3c, 0xf5afe0f05c65359b, 0x1b3b33f624b495fe,
+	0x5b64a59c905aed16, 0x953e3db6d38aadfc, 0x8561a5f8c4d612d5, 0xad9ad3e1b4507adc,
+	0xbb4f532b3d3805cb, 0x636ccb8addd98d0b, 0x51a6e66c1b9fe220, 0xbe1f1e776627acb9,
+	0x5c5a75cda0d30307, 0x34cc2bee19cfe3fb, 0xabaef51f029292cb, 0x5c8fc70acc5fd441,
+	0x77a8d2e8915a9fd7, 0x3d15046de40a1776, 0x5c93205be1de5eeb, 0xd6d4e7c896759bb6,
+	0x1c8cd4dd878172a4, 0xe3d633b713eaff7, 0x15774b4e88902b86, 0xcee14691780e2f61,
+	0xe0b160b2e48e9e6b, 0x9b958ff170c9a6f6, 0x1a9bf3a57c56dc0d, 0x708c64241bf2f8ad,
+	0xf75f08d355f1816b, 0xee5fa9ab957ebb9d, 0x4bae777bb21ba988, 0xa38e07646866f7c4,
+	0xd0d42a4c0da5b606, 0x93cd0f79c66b35e5, 0x1af38380f71da149, 0x6abd271b6e72b8cd,
+	0xd56b3daedf375578, 0xeda1dec5e781e5e5, 0xc01903a131170e5f, 0x28e6c7030ff79afa,
+	0x78ceb88d5ce4b620, 0x18db1177f81baff5, 0x37f4f0d95e31301d, 0x48825376ab8cb099,
+	0xd933efe5b57ea607, 0x54cae54b6a879496, 0x607eaaf2b727eeb2, 0xd7d35a1f63c3005e,
+	0x40ceeec02e6a3f20, 0xdc02f3c48aed31c6, 0xa296ab3de3396e6d, 0x38d2b028d6539bd5,
+	0x2c5d5b53137a1c1c, 0x1907093dee1cc52a, 0x303ce65c32aaf8fc, 0x77e19254ad0fbdfb,
+	0x26d8c95cef315e6e, 0x813be5888b4b8dae, 0x15f4dd3937a06d45, 0xa49d5b9e9c1b494a,
+	0xac4247746daaf567, 0x2d5fca8d13a3da17, 0x9227569ad95491db, 0x7bc643c60db0af60,
+	0x4666840d23e2347e, 0x2639d5fa9c719503, 0x51d0630c8365604c, 0xf0945f7f3ec88f99,
+	0x61057a8530344328, 0x8551047788b4aafc, 0x79858eb450ef6ee4, 0x36dc4e4ad229a6e3,
+	0xc4819682c64fbf07, 0x8d3d79f28ec1c868, 0x7150a7fcd604493e, 0xaf1b45c5f94f8093,
+	0xeb46a5e7777207de, 0x99d227f55405399c, 0xc70b305c55469268, 0xcb403cb2d6e3006e,
+	0x7d92d058f4d28c0d, 0xc8d70e62a90cad38, 0x6f751e3f71ad67e4, 0xb5afa0d6ba857fec,
+	0x7eb491d48770b4a2, 0xa32435b1bb31aaa6, 0xed0f758e07f1d916, 0x2e2e72863a6a175f,
+	0xfb41cb1a8b7d70a4, 0x693d499a06a1e7b6, 0xb5bdd6430f76e3d1, 0x8ffaaebcb7f1b1a2,
+	0xd180b0abf4f3e08c, 0x38aaf5c7bf61d4e7, 0xe5dd38a7b78ae020, 0xcc0ead392b6eddbf,
+	0x213f5758322bad2c, 0x920cd4e1ca7ad5fb, 0xde3f41da54bda3de, 0x656d94a9f5b80f5e,
+	0x3db3f35cf3187294, 0x765143d71d343f8c, 0xcdc1c0ef86421e4f, 0xc8a4ee276d493224,
+	0xf0aaf5f6801be9fe, 0xb38a7a82e7838db9, 0x8f83fba14d629031, 0x7b893d743bdb5cbd,
+	0xe5d4b75e345ae6f1, 0xc70952afb4c75c56, 0x5aad61a7557e3ae6, 0xb600fff281cb1e49,
+	0xb95a00ff47fd5c3e, 0xf70f62b9bf4c8ac8, 0x37b7e1469aed630f, 0xa994867ef07ad30d,
+	0x9a0b52134b69eec5, 0x8fb94f8fb1b6432f, 0x5f060be8a93252f7, 0xf34fa6cba9fc91cf,
+	0xfae3fb76d4db0c49, 0x68881539c20c17d7, 0xfc23fe5c7e7d3fc9, 0xd06d22efd54e632b,
+	0xf9cd0f49f50a89dd, 0x47a5c7b6d1096b9e, 0x2e242cb599b25231, 0xcd9a570dd93d1825,
+	0xeb0f0be8339ab819, 0x6f75cb7793f8da53, 0x7675fe20c08663f3, 0xdd2724cb852bfb1b,
+	0xa7c7c6c14aa71f81, 0x735617985b9fb01a, 0x47feb9e85b1510ab, 0x4352483ad26d56fa,
+	0x74d7c81f64ebfe86, 0xa623a7ba76ddb23f, 0x9395c5a52a223fee, 0xfadf18dc8934b1fc,
+	0x7f0f5b61ee32aa66, 0x47059bdf2e339c85, 0xae6e92708c2c2aad, 0x6ee7b9fa4f2dfbc3,
+	0xc61a1a24fe8cf2cd, 0x6614eb7388f2f1f, 0xc9d1a4fae388f6b4, 0x511cd8e318afdc32,
+	0x7efb7a10749f9a1f, 0xf2f82d32d98d3b5, 0x113754f9a370dba6, 0x191deed2d6304a5b,
+	0x8c4e99496a95fec8, 0x88babbb7cae8aee3, 0xc7ae22833ebfd18d, 0xfdb33cf1fec20d73,
+	0x84a37f0bc93249e3, 0x908ce9fc7970f7c7, 0x6b620fb93c48645d, 0x99eaf7af95e69ca2,
+	0xed969f6f512862e6, 0x676097ba7c8d8e75, 0x494896663b0ec646, 0xd601d441922f3a7f,
+	0x24adc400b5b8eda8, 0xb8952b0badf4a863, 0xb66b7d8e32df2a8f, 0x39fcb75b4deeaf8c,
+	0x92d0acafb86863e0, 0x5b13fafcaadfde76, 0xa0928abb617a1dc8, 0x94a9f51878930490,
+	0x2bf0ccbeb15d73e5, 0xb4807fb28ae63746, 0x288a1231ab468a66, 0xa3f0a3f1a3f103a0,
+	0x7d2b25ad6f04a0f0, 0x355234a3002829, 0x1445094013521425, 0x51f8d1f8d1f80150,
+	0x42008aa2680350f8, 0x922604a0a4482969, 0xa3f0a3f1a300288a, 0x84001445d106a0f0,
+	0xa6288a36004551d2, 0x14fed2fb4c1a3f80, 0x1a299a5102a6f698, 0xa80925a699a1280,
+	0xeb1b0128fc281a3f, 0x6929f00094d44a49, 0xa4f5abd401aaa501, 0x8fa2f11720a55fa5,
+	0x2d2dd2d22a408ac2, 0xb40815252943a00, 0xd22a0045e147d1f8, 0x80b41428002d2dd2,
+	0x699db434fe02d0d2, 0x690128508aa20068, 0xbf4a0b48cda54dcb, 0x34fe0250fa554a5a,
+	0x95a218054051f851, 0x5a008a4b51b41868, 0xc6efb460a0a50129, 0xc60f0285bfd41e93,
+	0xdece5110280a3f8a, 0xfe148e7350501405, 0x6a8f026909ced634, 0xabd6e39ca4aa8c74,
+	0x2c3f17ac48efe3cc, 0x237945435adf7260, 0x3176af2abbad7c9e, 0x334b5add668d3fe7,
+	0x18673e0e69b9a218, 0x83bb2badf01f3f08, 0xe951e15fd52691e4, 0xe75aaf2f00ff7bee,
+	0xd4dd863612658df5, 0xfa7dbc3ffdcbea28, 0xdbb9549d5b76ca0a, 0x14c34cfb34f98ed0,
+	0x5539e4998f71716b, 0x738935f1833e00ff, 0x98699f96c33ef72, 0xb04a1fc031e8e9c0,
+	0xed2dbed242ddf3b6, 0x56cff4f17eccf254, 0x10b3ca6ef0968a34, 0xa56fcfd50f5e214e,
+	0x2aabef68b5ceee62, 0x7f6f27e4db4a0345, 0x46de3e53a4d244a5, 0x7297e5895b6a3030,
+	0xd61f971f1c4f01a9, 0xcec31f303b8cb7a0, 0x48adcd1c52217fec, 0x40a4f61896cd62a6,
+	0x1c63b3b44b53c778, 0xfbe5905f6c50a9f7, 0x1b03bdbe5103a5b7, 0x287aef1bf398747f,
+	0x905c631df3e2ada9, 0x1247a5cf7ffdfb7a, 0xd8ddcccf48409513, 0xe747906687f656fa,
+	0xcaa973567bfe11dc, 0x88b665551a3ebc8e, 0x5ee29a2d2dd5ce9e, 0xf44d568400ff1d1b,
+	0x4f11ced5fd7375ad, 0x46c677ebaca61e45, 0xcd9adca9fc8c93db, 0xecb86edf4f1b9598,
+	0xe3ac37ab77212a3d, 0x86bde74476c751f, 0x5eb57ee29f5e84d3, 0xaed4fad17db43162,
+	0x6a3d47fbcf688f40, 0xb0a33a8f6cb59cb3, 0xbe97e22a1ca527c6, 0xf722cd8539b5a669,
+	0x34048ae7189a6034, 0x2963a74d9f260fd3, 0x32fc559e6cdad403, 0x414ab75033c8c293,
+	0xbbddaa7d047a864c, 0xf6f9f268674d8e60, 0xabf4fa19e4fdc910, 0x13bd6889ec0ac3e9,
+	0xfdaa6ab607a46264, 0x6845eec678c8d47a, 0xce18cd1979bd448a, 0xf33d80f1bc48ef01,
+	0xd664a8d2e724f54e, 0x6ed3d87ab7bf2ad2, 0x8215c74696d58d63, 0xafdcc6d572950ea4,
+	0xcd293aba71c68a07, 0x2b81c3ee5d3a77a6, 0xbcdcbcb3df8ae374, 0xe2dda609d75c0f1c,
+	0x6bbd15c9ebb8e72c, 0x1a3bbdb503009575, 0xe2ea50e13b53eaf3, 0x8b66d48123ee769d,
+	0x83151887dd4dc1b9, 0xfca31efe791e49e7, 0x7162e687657c0d0d, 0xbc663a739d1fe3d4,
+	0x3d852d636ddabc1, 0x6a9777bb5947aea1, 0xe27be2b79abac59d, 0xb906cf741c7cc9bb,
+	0xf4d7435aec8d1beb, 0x6356cbb9f4549aae, 0xda4a6f00fffdcc9e, 0xd711a47ac9aa5df0,
+	0x6a0f2a95714d65bd, 0xc739e01583fbe0bb, 0xd199c54d125d133c, 0x53858403aff79c6b,
+	0xdc81d77aa53f27e6, 0x1c7a9c8c0707d709, 0x46512b788857fae7, 0x57f8a8577aba2554,
+	0x1d9700ffa6140a57, 0xa796dd6f79b5cf3f, 0xf960e26fc742f1b3, 0x8fe71c03a8bcec2c,
+	0x99cc8776b9d6f35f, 0x226adc68c5f1d09b, 0x45d5001868a36ef6, 0x576385bfdab86b93,
+	0xad4c8af14a69ec56, 0xcd38fcd82ac98778, 0xe424086e9892f773, 0x1b632982645df31c,
+	0xfc49e37d5e732487, 0xb9d603fa3982499d, 0xdda3ae7db969ace4, 0xb558a5f77eda97b8,
+	0x2b9eef091ba76eb9, 0x8e2b078f66518396, 0x1957d6bde56a1ee4, 0x6351fa7324c0addc,
+	0x8c0adc99981f1d29, 0xe758054ee5b7e31c, 0xc8120c568ce71971, 0xcb0dbb1afbcac100,
+	0x28bd6935c8f8c2a, 0xc8790e0b32ce2634, 0x4fed2d7703a851eb, 0xd7bb4fb62b64e186,
+	0xb74d92a3d2c78f1c, 0xf4be8e2918181919, 0x15e5c3aa0b49cc15, 0x24d7648a630f8c07,
+	0xef96f2ddd546c6ba, 0xc8c913b40d145d50, 0x7dd2b4aadaf38f03, 0xf8e254795f905ac,
+	0x7856925c942b4de1, 0xff677bfab4dbc1, 0xd7066b6efb215ead, 0xdfa8836f7c3a6ce1,
+	0xbf5e782cafe1122, 0x4cfc998c225c35e, 0x99aac5ed17f335f6, 0xbd2ddfeae8a245fc,
+	0x443f0a76f50d97bc, 0x8f23ea8d876f9d3f, 0xcffbf4bc3c5c3e1f, 0xf54e4e49e95fa506,
+	0xbb9bbe4f62311fea, 0x8a01bc46c5e8b48e, 0x67a8b8e7a85c7999, 0x1b4633177a593d4d,
+	0x20c42a7d7d0c3a3f, 0x6a9fd5fb563ef22a, 0x4a2bce3170ce24db, 0xecf56cb8b1cd50ca,
+	0x8a5a587b6ca49a6b, 0x54deaa5d8be5be76, 0xa91347ac866ee4a7, 0xa8f20fc2fd9c5bf2,
+	0x744c0ff00a1e0b08, 0x48cecb8707bb3535, 0x2b79aea1b7fe5f39, 0x52ab2b425b19b59e,
+	0x37bbe14049b07a5b, 0xe982b132278d1af8, 0x513fe37584b1295a, 0xf383ca4d557ebdf,
+	0x8924ceb8fbd6fc7, 0x3d3dc783228b2ede, 0x3a3c69466b53a8bd, 0xeefadf55bfa7e69b,
+	0x706c95b421de5951, 0x8ed6eb00ffb0eec3, 0xa346335cc8e9569e, 0x54c5f5a8470c4028,
+	0x20d9a97c8b5bb1bc, 0x7bb3538d3fe36e1c, 0x123c553098d119bb, 0x24e7a625cb452b32,
+	0x535fbc9ad28c56a5, 0x167a1fe521595ba1, 0x63023235767b90ed, 0xf66e1c411e4b59f9,
+	0x57e46d9a54f883ed, 0x46f0e0aa1b908370, 0x1ba470ab77f8113a, 0xd67d8c71acc6c0b0,
+	0xef95b0d6dbd3af23, 0xeb99c1c96ad3e8a9, 0xca032075d86a757f, 0x5acc2afca8cb3fe3,
+	0xb10e4c8ea31b47fc, 0x694a8fd21af9d3be, 0x9e6474bfc82a8bf2, 0xf05143557e3ba60f,
+	0x57407f07797b87ec, 0xb859518f3baecf19, 0xd19a26b64675ee41, 0xd6a5722dd72316dd,
+	0x55f98141f17eb268, 0x263e0f58492b75b8, 0xdddad271953fe7f7, 0x49aa8ee02ac94c59,
+	0xff0acfb1298ec75f, 0x7e9c71e86907ac00, 0x13e738664f868726, 0x32407b92b613c78f,
+	0x79a1a6fe280b7eb2, 0x9f0dc1f420833ce1, 0xf656133d468b9ca, 0x8c31472b15f3afc7,
+	0xb4faa9986cdb5f92, 0x6f24d9736a73ac91, 0xff47f8cfafa3b4, 0x76e7907104f3aaeb,
+	0x912963a51fc13878, 0x54faef675fa51d0e, 0xf74762192f951bab, 0x55d8698ad3c89f5b,
+	0x97b7d2d8e6910aa7, 0x697dfc742b98b12d, 0x1ce7236c9e1c4325, 0x8a84e58ecdeafd91,
+	0x94562407af575e25, 0xe943c7396418af4e, 0x73af5ce653eaaef5, 0x2db46a4e779871e7,
+	0x326fb9c8eb6fbf67, 0xa6227e044fb96fcf, 0xcae316aaf47ae5b7, 0x55ef9f4e56f9c0b8,
+	0x7ffe73eeed121bb8, 0xf9dc57dae4147a9d, 0x967a76f9a4244d6c, 0x79d095143997a629,
+	0xf8d1f801501445e1, 0x4a5adf005052f8d1, 0xa9396d6a00289a33, 0x94003421455100b4,
+	0x3f1a3f000a3f8a66, 0xef04a0f4430a3f1a, 0xa2a5086903501445, 0x7e00147e14451b80,
+	0x50f851f84beb8734, 0x4609408d14cd6803, 0xe34709d0d448ef68, 0x34a4f11330851f45,
+	0x4a498d0034a4f6b8, 0x94d44a498d0094d4, 0x50f851f8d1f85100, 0x2dad07a0284a1a02,
+	0xd2fa55ea00d5d222, 0xa2f0a368fc0e4051, 0x7a0a5455a5a05a4, 0x3f8ac6ef00144551,
+	0x686991965601280a, 0xdf01686991965601, 0x14fe52fa208d1f8d, 0x943a004549835200,
+	0xa4f5abd401284a1a, 0xf8d1f80b48a55fa5, 0xd4a0150f851f8d1, 0x4551d4ee001425,
+	0x8ddf6901a0288a3a, 0x331a3f000abf5334, 0x3886c240e147e147, 0xc71d32541c3f9a5c,
+	0xbd77e35c446f677b, 0x84bf652427b12300, 0xd4ed9deafdf57f7a, 0xe559fbcf6664c650,
+	0xea7e0097b7d49ebe, 0x2bec761cefdbb933, 0xbd3f57256bb8581f, 0xf59ef0645cfd93bb,
+	0xbdaeb20be18d9512, 0x3a5962202c237773, 0x56bdfe6ff5a83a44, 0x1b25aff3e36c185b,
+	0xdf277554d5717dbd, 0x3249784ba63dbda7, 0x3d76b792ccc9922c, 0xbea9b0aaf2f73e86,
+	0x4920158621d5fe99, 0xe9db5145c7b90c2b, 0xc1a6231dd9593d58, 0xc1ccb140b8be2979,
+	0x3df580f919c1d57f, 0x96f62d0c89d69a96, 0xdc73722ede82bf1b, 0x926358adf43a3df5,
+	0xe3b6d66c9bb6cd58, 0xbae9af92e7e3c8ef, 0x96d28df2b470165c, 0x5a5f7e7a9ebb91c1,
+	0xd69a9963e7666e39, 0x4100f211559a8d66, 0x58b74ce50f7f7dea, 0xc7f0346f9558d3a2,
+	0x1dadf4cf6f47003c, 0x9c7361aa733e565a, 0x1efb78b3ca1f237e, 0xff81d3cf4972d2,
+	0x6e7338558796a8d7, 0x6f9fd28ff2ab6251, 0x2cd5de5eb8193e0b, 0xcb90ad893db7731,
+	0xacf2e32026efa771, 0xefe60847a5c75227, 0xaf6aeaa5b58872d, 0xfb85ba29ec010ea0,
+	0xe9ea5e757e717933, 0xa879fea9fc916de7, 0x6bbddd915c789519, 0x42c4557476b7c138,
+	0xed94e37eb7a7e431, 0xf391a0a6dedc89f9, 0x771f89d663f70992, 0xcc1323ba26a2d2d3,
+	0x1df8dd1d92b053a9, 0x531c7b0ae0794605, 0x6e498e5681d7cd47, 0x949e63a54de94026,
+	0x37a53798594dc601, 0x212826a5afe728bd, 0x946e4eef466a27ea, 0xb8140d7f4243a6d6,
+	0x3799e057279992e2, 0x1ef8911bf32c86e9, 0x79e0235754b7c67f, 0x4726124f44326af6,
+	0x20de4dd3b55e57d4, 0x3146ca540c246389, 0x45c653a4e274809a, 0x7a5190f52278a6a,
+	0xee523a92e714531c, 0xa8c52acec90e4515, 0x56e1cf31aeabd2cf, 0x3b2a5b6a8e6b5b6d,
+	0x3d8eefc074781a9b, 0x70ac80d1724c776b, 0x1f14f3bcbc3222b, 0x19058fb0586bbdc7,
+	0x349bba531d577aba, 0x330ee81364116661, 0x5ecf11b8db29cd50, 0xfab8f0a46d8e4f31,
+	0xc211bb58372bfcf5, 0x65cd6a9deb1ddbcb, 0x6c32c87df19d232b, 0xc47ed6166be8315e,
+	0x798e99698694dad4, 0x813c95d7017759ef, 0xd995557064e3d45d, 0xb158cd19b781f6ad,
+	0x2431d73c15d8f2bb, 0xdf7054f8b1155dd7, 0x63fa220be626c15e, 0xbbb809116bd3b406,
+	0x64aa2a6f0de0dd9e, 0xeba09d5eef7704c1, 0xc5c9530fbea08aaa, 0x912c038feba1c97c,
+	0xe39f565de9510fb3, 0xbce63b9ecb656269, 0xc487b387de1645fc, 0x863ada9a694c1f5d,
+	0xf6c7ea7d0e8c930d, 0x7cad9f93d6362bf4, 0x6288636711c537f5, 0xdb33bdaa7c18ee69,
+	0x5f163fe32f73b527, 0x45231e3736ef795e, 0x33b6b3e99e577be0, 0xdfa2f66b32d66752,
+	0x495a0db9067e9071, 0xb219f955b824ef2f, 0x2ef1b42dfcc2953e, 0x8fd990b4aacf2ab3,
+	0xebf40af827cdcfe1, 0xe9b8a3bdbc48746b, 0xa0dc1cfb6edcf25c, 0xa4778c73debec2c5,
+	0x6758c9c9cd4f586, 0x7e600b49380d35b6, 0x96a63bf6475fc995, 0x2614df133772da35,
+	0x7782f27743d1b94b, 0x3fa39fb55dc0367, 0xeaa72757f8e90f92, 0x6cad7f5e8f1b6019,
+	0x5573ee39ea387043, 0xc6c976ee6de85c61, 0xe2c852337fd09136, 0xb1e2743f28f3714c,
+	0x7035dd1fc34ee7ed, 0x4a01b72ef36465c, 0x80b1f92c93829a63, 0x55fa313f81ddf214,
+	0xa00738e63614b90b, 0x9cdb389c715717cd, 0x1733a3aafe3f831e, 0x40e90318a0c71819,
+	0xeb7832b644f724ee, 0xc6d68ff603f94acf, 0xd9311b955477f1b7, 0xff1b06f7cf47dab2,
+	0x55bb78525fdd1e00, 0xee0739352fd0448b, 0x1260ef278879a0ec, 0xbb25eeef89aff207,
+	0x34f224dd66ea9abe, 0x70bbce3f39497d8e, 0xec9e3af3f2c8d591, 0xadd4fb446a21f361,
+	0xefa81b8fbb06a748, 0x5472ca144732924a, 0xf7fef311cb6848b3, 0x8eca196324e1a9f3,
+	0x46ac228f56a5b707, 0x292beaa8d7738271, 0xa8e6cd5b6816951e, 0x3724977acfe9e6e7,
+	0xfb94631454eb5339, 0x6bab55fac18391c7, 0x94e65a6ff8152e91, 0xea49d9c91acd1e7b,
+	0xe9b042ce55c24268, 0x2eb8022335f6999e, 0xeb0878557b1d6e0a, 0xf22db8f52abc7fd5,
+	0x529a2beea97a2bab, 0x917ab4a6a6d2ebb1, 0xd3af1f6e54801ca3, 0x325acab021349bd2,
+	0x2cfb5aad1fbcbc7f, 0x8cc36d3776aa8d72, 0xf289c4669b1b46d4, 0xe9924ab572a7dcf4,
+	0x327425ad24a1a4b9, 0x99276896e5818d0, 0x1d21870ba715c868, 0x20f687e3743f379a,
+	0x50d9ac8e9c15cff1, 0xdc5aaeca3f03f754, 0xd481d08b44593b15, 0xa4bffe104221e550,
+	0x2167081b8ff76969, 0x5debc13db47f8cf6, 0xd8e18245dcda8d15, 0xfc2de71a00ffe20f,
+	0x291f7083f9e593bb, 0xedf3b74fefebd72b, 0xdc38aa5ec918df66, 0x1b4af1a65eeabd3d,
+	0xb3851a54ba6a6cec, 0x3f78ae43ae32c217, 0x199e46e366aef4e7, 0x7afa760ec02c3a36,
+	0x3c54aed8bbb4ea8a, 0xda29ea07b863436e, 0xf6e4056abe4aba85, 0x7c938cde8afb743f,
+	0xa7b48f9a52c7e2ac, 0xcce3186169b37066, 0xa32e18a2c8e5d38b, 0x57fa877dafb2acfb,
+	0x2a5e9f91a76c3c53, 0xa03ea392e042d0ac, 0xae2f3cb3cb5e5d73, 0x2f00fff15bf8fda6,
+	0xc946b20d03f3c6cc, 0xde3f1e68a3e208ea, 0x5d68d50ad47136db, 0x9d3f87d1310e861b,
+	0xa00ec38593924230, 0x7d658f1a00ff301c, 0xbe1dbd27571cd719, 0xb81b1a58c54ef3f5,
+	0x3c00fff4b080ccf6, 0xe542d26cd60c2d54, 0x7149ad5f759c07a1, 0xe9a8d34367ca9004,
+	0x6ade98375baddebb, 0xd1f9ebf2e3701d1e, 0x462b1574af7bf318, 0x135db78cf5b4f69a,
+	0x722d2e2e2ce8f3ed, 0x4e6535e18fd43d00, 0x75fef907520749f5, 0x4cfdb7d11bf6a99e,
+	0xf42a7dfa747f0087, 0xe8e3b8cbcf70b30b, 0xe1b9476f32baae79, 0x6a193efc3ec6a9e3,
+	0x5c6e1bb7d0f255bf, 0xf9b3e18ca39662fe, 0x28cc4a068fda95d4, 0x7a9f49e387648aa2,
+	0x288aa200689ac25f, 0x1180a2771485bf01, 0xfc28001ad27a29a9, 0xb5a6f103a0f0a368,
+	0xb4d448015052fa29, 0xda34684609408d, 0xfc04a0f0a368fc28, 0xa40028297d2b0d69,
+	0x569aa604a0465a6a, 0x47e147e34701a6a4, 0x50140d69fc044ce1, 0xd284001445491302,
+	0xe97d268d1f004551, 0x69a99102a0690a7f, 0xaaa5455a5a24801a, 0xe377008a92a2d401,
+	0xa4550a8002851f45, 0x4eab69692e40ea14, 0xf4411a3f1abf03a4, 0x2a6dea140028fca5,
+	0x1686991969603d0, 0xf89d56d3f84bef73, 0x1284a1a94da0150, 0x28294a1d204551d4,
+	0x147e347e347e07a0, 0x8a92562980147e, 0xb4b40a4051b4945e, 0x569fca500404b8b,
+	0xd1f8d1f80b40e12f, 0x6c68a077d05b53f8, 0x6a1fef838d043784, 0x8f040348482371ab,
+	0x5b0e97d4d4c31e94, 0x3d7d507e48cb206a, 0x2c196f452b47b54f, 0xdc5aa4756c967177,
+	0x12d7629d0ecda8ab, 0xaef4b1f20ea2c77c, 0x4cb85b1a2ff9bc65, 0xddf614f08871e392,
+	0x7f757b754da507e8, 0x6225b7233bc935ab, 0xe56f77b4ed87dd18, 0xf2cd3c96f7342c57,
+	0xae9e5b7242b15844, 0xf4cc3758efe9937b, 0xb6e9ccee5ae4123b, 0xe6f198cf4374bec6,
+	0xc33f3dc81e4301b1, 0xfb822a12fa686cad, 0xa5b967ba9de5569e, 0xe54163185a4d1299,
+	0xa7decc4ff9f72e5a, 0xa2998bcb85cc5f4, 0xd0fa166c96e92412, 0xb013499af9a096a2,
+	0x1afb22a508c188a, 0x88ab4b55a4fe6ebb, 0x3e008eb52f774811, 0xc1eb3b55c000fffd,
+	0xc7087f6c6e33ed12, 0x5118a3339f876aea, 0x2aa5913fec8d7355, 0x32ef270b4b6d648b,
+	0x526d60b4d07d460d, 0x15d5c400fffcedc4, 0x6615c2351547dd52, 0x4e72aaf576581232,
+	0x2bcff59ecbaf76c5, 0x923489d3a9a4d6b3, 0x9d7f406fdec70947, 0x8a3e87cc669a9157,
+	0x73af178e058f0a3a, 0xca51efa9b741384f, 0xfe91bea7ac4aa897, 0x4405e8e52766f0be,
+	0x2aec9358a9fc76e4, 0xa3486bfc281c7536, 0x244773d390c4a49a, 0x519733c7ae0239d2,
+	0x932747736b9a3a0e, 0x2a6277315635b74b, 0xa4b0c74aeb6fa4f7, 0x634463847dc814f6,
+	0x5b090a3f3d289a1c, 0xe9426234d2dc788, 0x681d443d04451d4d, 0xfbe7d22713aaa4a5,
+	0xfa1947c0f90ca53e, 0x827247147aa53f74, 0xa17be17757ab790d, 0x5bbbcafce4c2a477,
+	0x9a5b823ea9ad38ea, 0x9ee623297d504e4b, 0x7e2077e77a28bab5, 0x553a7faae99dee54,
+	0x52710e1e309ddf1e, 0xe018dba839d22e47, 0x63b19182e6c229d2, 0xd25e6bf90806ca70,
+	0x5ce919b1b78c3aec, 0xada64e0f6e9532a4, 0xe7b9a6be559d34c7, 0x78cbd2919d309d1b,
+	0x57eb63cdb9593016, 0xf1ae5175fec14486, 0x662971a91a3f9291, 0x4368aa1cd3989aeb,
+	0xa7d22bd7899ae732, 0x39b6d2871435c7c8, 0x26d43a42d2caae5c, 0x73b94783d6c22ddf,
+	0xa13900589959da53, 0x5b4b460e4e97dbca, 0x4dd9a74d9dbffb95, 0x75bdc31e1c77c13c,
+	0x51deb06eee856f5a, 0x8804cb08bfb4b7e6, 0x62aab802c9733ce6, 0x8f5c5a85a3d373af,
+	0x174952f19205bec1, 0x7ff812fee9d53ee5, 0x30c686db2bcb6c6b, 0xd30983aee19fae48,
+	0x23d196eb7a49f9e3, 0x4a555e835139a52c, 0xb7c4d0528cd0b38d, 0xe604411212cfbb1,
+	0xad6e77b60afbe93d, 0x75a39ab3731ba349, 0x35dbb9d68fc0f0f2, 0xacc100c6c1482b56,
+	0x8f21ad56174a53ad, 0xaed4a6d271c6a972, 0x525db8d671bd1595, 0x29f5f98b112fe2fa,
+	0x73081f42aad41892, 0xad2634995cc529ea, 0xedbb4f165c5bdca7, 0x3bda668527f7e952,
+	0xd5d5bafcd51f3e4, 0x483261d5e06e4586, 0x2b5bf3d8bb2ba3c1, 0xaacaad2d9d2b3999,
+	0x4a70a9abf7403280, 0xd86ce74a1fbfa58d, 0x8ed39a83614766ba, 0x454bcdbd928c0b56,
+	0xd96e088022ed8b26, 0x11db12d357aa74e0, 0x1f712e89629cedb1, 0x444ede62c571f8cb,
+	0xb8124a3f0f2c6784, 0x7e6cb816b57f70ee, 0x2c136af36f84b51b, 0xd7fae51ff311f03f,
+	0x6eb256b51fea75cd, 0x184bf946a46755bc, 0xa7efb8d7f06c97c, 0x3abd22a75c5ee707,
+	0x9da232fe7c34b511, 0x37bd63a72125e477, 0x9e22a70a498ead19, 0xeaab549c1a357bbf,
+	0xa9a98c30cbe03229, 0x1bce2da874c38114, 0x8cd5d00eee54fa19, 0x46c78d574aa7a796,
+	0xf4fce31c150c644a, 0xffe099c45781a9, 0x88e1c8949b5fe10, 0xcb07d9accada53e9,
+	0x6b1727853f74e07e, 0x297659b994acd29a, 0xb75c8d3df4dd3999, 0x45f53ee51b768fbb,
+	0x4df70f3d00900b48, 0xf323af8fe985e924, 0xe7756a3d324679ae, 0x12f0dd50746a5d4d,
+	0xbb2cf4aad10d5654, 0x5c917174c771757f, 0xc07dd536b1c49595, 0xc47e982d51a0b7f,
+	0x52cb157e3cb1e70a, 0xacc2c785b3c78e8b, 0x6e23986ce6ebef7d, 0xfff1e8c8516d6e,
+	0xa66d81154751eb9f, 0xe79f93c9f0871149, 0x866e50b97b1beafc, 0xb35d6750dba9f453,
+	0xacf407d71de7445b, 0xfc532d61393b9ab9, 0x45773bbcbde5523f, 0xe74a71ab47f5052b,
+	0x2a00ffdc72070ea9, 0xf06cc8072dd4b5cb, 0xb2b9e256e78f9c7d, 0xcf9ef3d1e300ff78,
+	0xf2e4a2a9a5d600ff, 0x6f72f992bec87ffc, 0xbdbe9e8ce496a284, 0xcc6c5709f6d6462b,
+	0x6b122bce3f4ee8b9, 0x3c038724f14d467b, 0xbacd36b9062afd4b, 0x7bd24ab3f8230938,
+	0x571b5ade2b4ae514, 0x979f2d46a2e21e4b, 0x18e57d3a94530d9e, 0x1f4b72eab22a863f,
+	0x1be91a29cade6e23, 0x78569f54a9bae2a9, 0x92e4c6781f3edcd8, 0x8f91b250ebd7e96d,
+	0xc3e8ac520c58f751, 0xed1c6eb7d3fab98d, 0x7c56eb42f8aea1e7, 0xd5a063b492dc6ad5,
+	0x9f5187e13ad86802, 0x205aeead51ed54e5, 0xc11000ff5c39657e, 0x7250652101f9d5e0,
+	0xd0f7976ea8798e3a, 0xad855335ed1ca34e, 0x4f6a2e77358ca82e, 0x1b00ff9566a72769,
+	0xc60db5c8867237e, 0xb7b4d3e49f1e6364, 0xf46100c8fb864332, 0x707937c9254f8cf,
+	0xd3c8b43ed3677ce5, 0x1f06bc3150a5d4cb, 0x458e7ca969cb6b9d, 0xbec400ffa6137a3e,
+	0xcc32200ffce3ffb, 0x2fa69557a9b8c37c, 0xf8586a4fcf74a4cc, 0x876a993c4ad77b5e,
+	0xe147e12f8d9f347e, 0x4a6aa521256654, 0x8e128026a4a50829, 0x34a3a4068026a468,
+	0x51f8d1f8d1f80150, 0x4a0284a1a0250f8, 0x46d3140045334a6a, 0x8fc28fc68f02a068,
+	0xf4ad34a4f11380c2, 0x45334a6a04a0a4, 0xe307a84f51943421, 0xc0947e48e147e347,
+	0x355202502345334a, 0x47d1f8510250232d, 0xf4536a4de30740e1, 0xa0a4564a6a04a0a4,
+	0x3f40b54a9b3a0509, 0xa3f13b002d2d5234, 0x9502a0f0a3f0a3f1, 0x455a5a0e90562969,
+	0x1e93c6efb400a4a5, 0x4649ab140085bfd4, 0xe1b4299cd2c30168, 0xe12f0569fca50040,
+	0x45e147d1f80b40, 0x458a6607a0288a3a, 0x49e32fbdcf05a0a5, 0x51140590c25f6a8f,
+	0xa0a5458a660748, 0xbf4a0b40abb4a953, 0xd8468ddf01284a5a, 0xf4f61100ffee0739,
+	0x38b9a1d2e7c231a7, 0x68a0f6c9cdfb208c, 0x9fd323019237348, 0x131facf5f9ed15fe,
+	0x7c706759a41021ea, 0xdedb619fb7bd1ebc, 0x16da76ba1bbf5b4, 0xcfb0d31fa9db71be,
+	0xb7b5505b684964bd, 0x871d9f248c6cfd9f, 0x26679d1f40d9835d, 0xd258667e25693af6,
+	0x67422486b1b3b4f4, 0x3d7d1fde4487791, 0xabdc442983569cd3, 0xff7180f3648494,
+	0x1f31731e5559cdd7, 0xaef65226d30cf9c3, 0x3c3fa6e73e47d18b, 0xa9a51ced1149e5d3,
+	0xd1e56cbec41d638d, 0x9f1fbfcf2fc9465a, 0x7d1fb31eab3549e9, 0x4b45b7a1ebfc51b8,
+	0xa0cc50e927c0b97f, 0x735fe5a35ded90ee, 0xc4f1c66af6a9f1d3, 0xce6d6cd91246f4b4,
+	0x5a3f968c01dd3d16, 0x17dcefb28c62d05b, 0x2d6ead636c0f64ef, 0xb95bca4ce66bb4bd,
+	0x3f629c9ac4172bec, 0xe8f4f4c01d14dd2a, 0x923aad7151145c2a, 0xb773d02eb159dd39,
+	0x92f32435f5a8de83, 0x475ef53e4f9293cd, 0x183df4eac15a073d, 0xd4e0d53623a955be,
+	0xe742ebf71c34e72c, 0x8cd8a64cac54fef1, 0xbe3439b0a39ae249, 0x17a38a41fea1f3c3,
+	0x794635a5e358a3ae, 0x29d443ec69325034, 0xc7410a7bac14f6a4, 0xb40e7b823e89684a,
+	0xf542efb06734f99d, 0x71f703f526a34a3f, 0x12ad3f479176df4a, 0xa3a8372e7d0c2d1c,
+	0xc38c342f945e28fc, 0xa84f432afea5a8f8, 0xcbf306f86ecdad31, 0x19653e899bcd92ba,
+	0xfadbb0ca9ffe3aee, 0x7c3c47dcdb3b6951, 0xe5cc9d5d54453632, 0xcde9f5144f313da3,
+	0x843bceea526ed354, 0xa055fad00f8a2c3f, 0x9a1b723968c4ae78, 0xa7f659d43ce34095,
+	0xfd9d4fe80693da9, 0x46a5dfdb88952618, 0x6ba5a67d55c0a4d9, 0x1d9b59d5f891898d,
+	0x932251efb8c4adea, 0x7abb42812dc9352f, 0x6a3d190698a1b3e6, 0x62d984a6750c72e4,
+	0x15b905554f939333, 0x22d427a8761fcb0a, 0x82d508947e0e908c, 0x472ff8d71507ec2d,
+	0x91e63507b8106e49, 0xdb5a4f2f0a8c8eeb, 0xfe9532677b6b3cd0, 0x7647569bace66a1f,
+	0x99fe1357deac91e, 0xe78e60a4b29a2643, 0xdd6f0596d0b95ba5, 0x8b5fe0615ee9cbaf,
+	0x8e60bc70296214ad, 0x87a5ad131fead2d5, 0x125293d76c8fe5e4, 0xe08b1edd69f5585a,
+	0x462e3f593e9c45f9, 0xb4dcbefdd5dd567b, 0x417c5f80d78cdbab, 0xfea9ac232c4c2cbd,
+	0x1dbbc9b849916a24, 0xb90f9d6df6b3d2b3, 0x46198e41f4e51df4, 0x626f2e548107c0e3,
+	0xf8a4c16bea83a4fb, 0xabea8e5f3cbc78ad, 0xfc4f90c781cbc537, 0xec91a89b91b0970a,
+	0x3ddd601622dcf5da, 0x3ec1b16b2ffec46b, 0xfa7343e124079cc5, 0xde46fc8997f17655,
+	0x731ec7c6e56b9b56, 0x2378ac9935fe8103, 0x62e29227efae3b50, 0xa2a4d35ae97f673e,
+	0x7d8c3d49a59ae3fd, 0xb9123283a433c41b, 0xf1bcab333cd06bee, 0x5e00ff8f1d191f82,
+	0xd908aeed357dc6bc, 0x87849af0aa2b7d8e, 0x185d0b23155ddde6, 0xa1f3adfd9dfa4aa9,
+	0xdcb05a03d4a79ac7, 0xe77a5425cdbbc1bb, 0xb7f74b8a092aaef3, 0xf4982d59ae3c673,
+	0x4d9cb9668ce7aa20, 0x1bed7ecbd4c68dd4, 0x90c4dddda902b923, 0x491a8120bb2c73c9,
+	0xc8186a920c00f418, 0xed2f5cf13d38850b, 0xff059fec0fe205, 0xf198548d5bb85b66,
+	0xf1038f3f9643449e, 0xaa5287a2661ee334, 0x6a171ff1d02707a7, 0x2da4d5be269e6bb2,
+	0xf273d9039076eeba, 0xda34747a5660c08f, 0x6a3e56d64eaf7772, 0xe9753a9a62576e32,
+	0x3f568a486224f48, 0x8ae785ca6fcf88d2, 0x4f6119ad04c5436f, 0x55e9836713b19acb,
+	0x18099e8a3fb0e563, 0x44a34adb919c953e, 0xfc34c8f1629a8cb2, 0x258da4f50dc04d83,
+	0xc41ffe46da6eb9ab, 0x501fc0f5cea8d57a, 0xfc196e24846a3d7d, 0x7de5c883115ce46a,
+	0xf2c9c3d473a509eb, 0xd5dcbe1eec06918d, 0x1d23708700ff39cd, 0x89e185c9a4d146cd,
+	0xe8228e3abfbd7df9, 0xf27ea9f65c473df9, 0x1aba1475ba4dd1b1, 0xd32ca7b0a4727a83,
+	0x34e3e418992cbf46, 0x710cc34146f337eb, 0x8e948fb721924fef, 0x9de0f6d4571bb9a2,
+	0x412444924c4816af, 0x82b7b634f04fc797, 0x42fc32983bbdc55, 0xe527b824dcd34c83,
+	0xb726e23abde74a6e, 0xb7aff1af7c54fbba, 0x494b19d5b16567ad, 0x82d4b35be6bf4e5f,
+	0x42abf5e5fd9154f2, 0xd65c0f86510e39e6, 0x577e8d66b949f45d, 0x1cb0b0690e4ec1fb,
+	0xa47dc5297daecf31, 0xd68cd432a7abe544, 0x632f7fac9d9041d7, 0x7befa3725d95a357,
+	0x60c3e5d397f53e74, 0x852bfb1497dfaa9e, 0x86c1fb959b8d468e, 0xc1b177e5d4682b0e,
+	0x7ffb640e07cf0d57, 0x951fe5c3801bab91, 0x9eb5fc7bd0d78d58, 0x3bbd95bb606515d2,
+	0xd7e769a730cc9154, 0xc3c7541c55377b5, 0xea475ca2ea5d4f5e, 0x8fcf50ed098ee0b9,
+	0x7ed4f91158f7f324, 0xdfea4d064df79172, 0x4a51a5adc9313226, 0x5c5529f5b0341c3a,
+	0x69027eeebafdaca, 0xe48c1afa031ca98c, 0x3f00ffa120770bcd, 0xc38e3cc82bb94885,
+	0xfee0ecc8687e9b14, 0xfcbd564ec791ac95, 0x7fcf0daf122b00ff, 0x7d8e4c92d6bf4ae7,
+	0x477d521c5b434fe9, 0x3129fca5f799347e, 0x46008aa228814ced, 0x961a29004a6aa5a4,
+	0x74083a22801a891, 0x2a0695a7a9f49e3, 0x48519400d448d18c, 0x150f8511425004d,
+	0x50f851f8d1f8d1f8, 0x4809408d14cd6803, 0x347e94004d8db4d4, 0x4aad69fc0053f851,
+	0xa04d536aa4002869, 0x3f0a80925a699a02, 0xfa46000a3f0a3f1a, 0x52943421004551d2,
+	0x6a9536758a124013, 0xb002d2dd2d27280, 0x28fc4eab69fc4e, 0x5aa505a0554a5aa5,
+	0xc6efb40aa0a5554a, 0x506a0790c2efb49a, 0x4549835207a02869, 0xf4ab9434fe523800,
+	0x80a2f0a368fc05a0, 0x343b00758aa64e01, 0x347ea70580c26953, 0xa368fc05a0f451da,
+	0xe5b4a95300a4a2f0, 0x80e2006d5a5a05a0, 0x728c00b43420451d, 0xf22c6d1335277ec0,
+	0x95bf4e9fd46bc4b9, 0xff01023a10d2fc3c, 0x3eae76e5e8860a00, 0x637eb4ebf538e651,
+	0xea5fab508aa4a0f4, 0xd123bc7f2c4ca6a1, 0x14fe584eea172141, 0x1ce0dccee3fa8c46,
+	0x6c8b4473957e2c7f, 0x81c3be7ea5e5292d, 0x3bcc42e2d1d6a9fc, 0xcb53af00ffe3f8f1,
+	0x1b51c84aae95a3b1, 0x5ba942317d005b1d, 0x766c49b6a7483d50, 0xaaf4637a1c63a718,
+	0x1c4f5255b9d0b833, 0xca493632184951f1, 0x1dd53e9b8fb18a8c, 0x6a5f8fe0f46f03c6,
+	0x968c258eba566e01, 0x5cefde1f76337a20, 0xdd82a6fb3c2f8847, 0xc583aef4e7df507e,
+	0xd2cc45dbba1dad97, 0xd5ad71ae49fdabfc, 0xee494e9b347f641b, 0xa361e8b1bba39e6b,
+	0x8e122c19432efcb, 0xae1a3f3dae23566f, 0xffbea59ae5ec4e72, 0xa8002ee4809d8f00,
+	0x3bf464853fc9e5d7, 0x7dfc192f60a87723, 0x13c25354db2eb829, 0x4e18f848523b70cb,
+	0x50d39a22bdfe7f07, 0xf06ff524a730a862, 0x839026b71c2b4da8, 0xe24a19436b8afcd3,
+	0xfc01eefe91e2b811, 0xc9479d1fb8805869, 0xead839d94d1d43e, 0xce4def770c3ca578,
+	0x1f4540f46654e95b, 0x200955e0dc4a4bc3, 0xe12015272f9bd251, 0x8a96909a93935073,
+	0xdd48bb3f3aed7ec0, 0x186e25682e1f6329, 0xa7699e9dd2df9ae6, 0xa9a2e2470c50d0bf,
+	0xa2734f18d551e924, 0xf191b5ce5a32ef0, 0x5de3a737fb3127cb, 0xe840929d08f39a7a,
+	0xbcef1a3b829cb276, 0xfe84aca7a32ea937, 0x727a6bfd7d9138f5, 0xadcfab1aba8483be,
+	0x9a5b73384dc6a629, 0x140f6e320d3dc90e, 0x293e639c934c7b9, 0xce6524a94acf861b,
+	0x735e459a64585633, 0x834a5adf64c6bd59, 0xdb9ba8d29f32527c, 0x34d415779c1f8ec8,
+	0x3b253272b82eb4a, 0x71d89a86e27b1d39, 0x6f486396e7a4ce32, 0x4cededdb13cd7737,
+	0x7823e56405dd7d4b, 0xbd35b59e83f6e1c2, 0xc8c95bfa96542bdb, 0x1626733d7cc8d54c,
+	0x1d5b9daca14fce38, 0xeba749a47af3f094, 0x1f6aebfca9cb2606, 0x1ad4f8f1366aa413,
+	0xb4b58051cd75800f, 0x56c4bf3dc6f44c92, 0x9e2cbdf19fe86df, 0xb6af96bc754bcdb4,
+	0x7420f58c60e40a60, 0x2a7da79ee484b53e, 0x23c6198ac75d4653, 0xdc5eab75c7a9dae7,
+	0xf43503a0e79c2862, 0xcf740f9f839fc3bf, 0xd676c3b06bd8dd14, 0x65d67fd4e7a87cc5,
+	0xe0098efb0aecbe55, 0xf1aebdc35638c11, 0x2cd0b4a52c093485, 0x85ad91473913ab74,
+	0xa43c233346eac8af, 0x54527aea00dc2164, 0xb351e6d1f670af9d, 0xa9553c823f5ac967,
+	0x6e544888a56daace, 0xa774cd099e0c5470, 0xe3565d2087bedde1, 0x4875bf42e06017ed,
+	0xbf7aad8fbbbd3b38, 0x46da3e3c6071bc8c, 0xca35d18a4a73049d, 0x9203c841d2a6e547,
+	0x6813d73c8f3ba8c0, 0x238d3c4f404d356e, 0x7aae18781e3b3792, 0x3e2c859e3bd11295,
+	0x7df0a263978df39c, 0x435585341b82fd92, 0xb7d2c778a6571b16, 0x755ecb22f2eadf5,
+	0x7b8bd8087f2a9e03, 0x8d56641c092e2b51, 0x49aef6e438061af6, 0x91dd1623b59c6dd4,
+	0x73eb46ecf0207ee4, 0x8a4ad7868ae739ae, 0x23d7b22be4072115, 0xda51aa78ea38210d,
+	0x54d57a6f6fb0dc2e, 0x491b6a4e0d253976, 0xfc6aeab95d954c16, 0x856457eb03c8ed50,
+	0x832ab3d27ab66777, 0x46112bee34d7718c, 0x475a5054b0b31455, 0xc7b5139fce57806e,
+	0x7bfc872f2e8c47f1, 0xc153a31d55abfbc7, 0x1fc77f7a8d3f79fc, 0xf6e87cf86700ff12,
+	0x521df1fde8c5454e, 0x5e337d8c2df4f32c, 0x7fb234db70bc0d45, 0xec9afbee5f1520ad,
+	0x450cf3f24cfbd3c2, 0x387217425346b3df, 0x2e45ba5b2d51cbda, 0x1e984de455e92764,
+	0x8dd45b9c8623d3d5, 0x2952e0a6eda7b9a9, 0x7f9ef12150144589, 0x7a9f40ad9f1c945a,
+	0x7d521b998a938fa5, 0xdc3052e9c3dfc207, 0xd4bc1e86cb4bd4a0, 0x5d4bd3592aacf2f0,
+	0x438fc46eb59a8f05, 0xdfb0dd9a9a639055, 0x6a7650e8512d638d, 0x781eef23d85dc5e5,
+	0xdf8d71a80b9da9f5, 0xc1731cd091db50c5, 0x581bc9ad326e35f4, 0x8a53ebd9b9e2c975,
+	0xd4e1fd32bfcc6261, 0x384805398e6ca456, 0x89c46b34a8c6de3e, 0xd66635cf3f20fec1,
+	0x6145ecf5c12dd84d, 0x8cfb780d4f4f5d53, 0xd40d2f04e578612e, 0x9c91876757ab557a,
+	0xbedca8a6f6f75470, 0xb5a4d23f6d6c2f53, 0x5147ee7470231943, 0x4fab693bb69415f5,
+	0x986ccadf482686c8, 0xbc4de1b7b767e098, 0x5f37b2a0dee478b5, 0xc39109014925ca5,
+	0x9965bfe84adba679, 0x5de266448dfcdc8e, 0xcb3ffd9e246a3c5c, 0x5c7e3447f16887fc,
+	0xf525c5f7840ee689, 0xfdf03e6c795f9184, 0x332c70cc2aea98d4, 0xdf6307ce3142a6ab,
+	0xf9a7a3aee5b135f0, 0xf187899688b8406a, 0x59982a8ea8b1567b, 0x6e0de1ac32aa555f,
+	0xd6d3d0839e0c2aa9, 0x4075eafc71541d24, 0x8d1ee01cf3cb2f4b, 0x79985d93911152dc,
+	0x1a9e39786ad551c6, 0xfbf32b9f8c972aad, 0x1c0b2d3fed112cc7, 0xd381db8d4d0b8861,
+	0xc5f5f36cc949cd1d, 0xfb6ae5636be5517a, 0xd27bc08a2ba7c948, 0xd69c8e02a5f2e322,
+	0x47299e6184b93996, 0x14740299c28f96d6, 0x6846015052fa8666, 0x1080a2284a006aa4,
+	0x8fc68f02a0284a9a, 0x34a4f11380c28fc2, 0x925a69bd35054051, 0x14006d1aa74d0380,
+	0xd3f80150f851347e, 0x921a012829fd945a, 0xa4569aa60028a995, 0xfc28fc68fc2880a6,
+	0xb401288a92868029, 0x3a0288a36004551, 0x344de12fbdcfa4f1, 0x520250232d355200,
+	0xd2a0d404d0a62935, 0x68959256a9035451, 0xa7f2948e32f4501, 0x5207a028fc285a00,
+	0xb47e953a00454983, 0x281a7f01a9f4ab94, 0xa5455a5a05a028fc, 0xc6ef0014455107a0,
+	0xa80c28fc28fc68f, 0x342875009ad1a670, 0x92c65f8a0250a094, 0x1f851f45e377008a,
+	0xc04a51d2a0140085, 0xc7481d2045d18c3a, 0xa0cffa4fd352fa03, 0xaae63a30da5505a0,
+	0x8f5f99e7bb589c5c, 0xe06635fe0cfae9a0, 0x3b6a7d1cd7110b91, 0x3facfba87114b3a8,
+	0xdb11756b32292896, 0x1e07760a54f883c6, 0x6a8704851f85bfd4, 0xad8a0300d43ea328,
+	0x8ff1b1fcd8990f2b, 0x90149b344da537ef, 0x905dee54efb93da7, 0xbabbe2aeb0dc94aa,
+	0x526bce8d9106bdb7, 0x55aa702c6720fe62, 0x63f36cd6f9eff609, 0xb402f4a076aea774,
+	0x6d9c9cd8a1fd6c75, 0x2eb1267e9c1cf766, 0x6e966bae032f3ce6, 0x39ed905a1746a9c7,
+	0xabcc48937a6ec72c, 0x8623053df5e646f7, 0x7a7d06cec8c3fc68, 0x5a59eb676ce667d4,
+	0x1723217ce91c9dfb, 0x69e109d234f12739, 0x27e314928a81ee5b, 0xd8db21bb9359853f,
+	0xf3b7630099947e7e, 0x500fe04af3892ea9, 0xdfb86a0092c543b, 0x4f697d1ca8fc796e,
+	0x7a33f714d7410a1c, 0x62de77daf4be7003, 0x318a821b916ac668, 0x92944d5a74d45e9a,
+	0x9c2ccd8b29c64312, 0xc4ee3683a248e71f, 0x53d03745e1785a6f, 0x9136e2b0a5f2a79b,
+	0x4ba6f53752fb52bb, 0x466a7dd4fae1fe11, 0xc2684abf46adbffb, 0xeb34f95b3457897b,
+	0x85f7afa357329dd5, 0x19e7f2f19b606455, 0x8ea72cd383d8d3a6, 0xa98c23c38926dde2,
+	0xea0a5fb8e6090aab, 0xcfdd2629952f61cd, 0xab32b45d519fec3f, 0xf58e20c3ca6d65a0,
+	0xdde4ca68237319d5, 0xdc48e9dda5c18d69, 0xe28e4251263254f3, 0x4770e9f500ff9495,
+	0x6b3c49f19164485a, 0xe9914bed53a8612a, 0x38460c36db8b0c4c, 0xf0e3c00c335a54ed,
+	0x55fae7c1305c8aae, 0x71a9f441a607a80b, 0x41cc25dac452a736, 0xb26e758d4e5deb70,
+	0x99f2872b0e06822b, 0xf59de5aa3db6311b, 0x49abe40a370c27c4, 0x675696b161ecb135,
+	0xc208ca82596ff8ac, 0x463688d9fb6d1bc3, 0xe2a5de2ae8387de0, 0x9415adee55f1a728,
+	0x768d09ebeed4ad31, 0x2a3fb21d078020a0, 0xfc461986601d2bf3, 0x7f88fb17a8456a0d,
+	0x9e560fad09e5f32a, 0x49fc637aea778b22, 0xbaa2a6d5b5de12f1, 0x1e31cae646128d74,
+	0x9d6bdd8e8bdeae42, 0x89ab6bbeefaed6be, 0xbac09695a6e49ee, 0x77eb55e0027e9a57,
+	0xa0f07ae9eee6b6b2, 0x35d2ec965372d6e4, 0xb860ac1749e043e9, 0x85af5d733b6790bc,
+	0x4f1d958194d5f874, 0x52dddaef1dfa72ad, 0x6fd7d4532f2e2fde, 0xa1252a8eaa9180a1,
+	0x64483aa2cf1353cd, 0x2417058e8183aac2, 0x18db6fabd223c06d, 0x46c6213e9314f500,
+	0xf24291a9edb9d671, 0xadd3711d964cda08, 0x5cc5a823a08cb851, 0x5759337fb28d459e,
+	0xe27ae4edb69925d7, 0x39cf0870a1c818ad, 0xbedd9ac507eb1df7, 0x1146253777cba48d,
+	0x6aada515b0dbe501, 0xaaaac8b23cdb5a10, 0x2e1ee415a027310b, 0x22479a06b5b6bfd6,
+	0x8f78fc1f50881cde, 0xe477ed449a3eb5a, 0x7bb5e7cc47a91027, 0x69d6fb6b4a1d35a9,
+	0xd80ee031c46d272e, 0xccdce739ac1803f6, 0xe2b7b59e24099eab, 0x9d494ccb23acb32f,
+	0xdeda022b1df589c5, 0xdd3fc9ef44c58b5b, 0xa1f15845bbe9b51e, 0x461c8bad96955419,
+	0xf0b52a92a39dbb43, 0x30acd0dcd6fa64c3, 0x541feb3d77d049f9, 0x6bf5ec9ac75a9f5e,
+	0x1e55ea750b853d61, 0xb36ac768bd14d694, 0x6113d4d02a451bcd, 0xa23ecc4f910aef57,
+	0xe3e4a852b1258fa3, 0xd5fb3b0a4d6926b5, 0x286a06eee0fdc188, 0x52ebd1fdc3c81046,
+	0x5a3f4eee668a48c6, 0xa9eb5fdb186d47ce, 0xb349ad1fe4327f24, 0xb7f0771b7061a8b8,
+	0xd6d083c78eb656e9, 0x848f38a528f4d032, 0xeadd3efe44cc6ae5, 0xa15261f6c8ad8db2,
+	0xf4c8586347c64028, 0x8e7d2972169af969, 0xd336c97d4abf55db, 0xffc701371d0972,
+	0x113fbd97b732ab5e, 0xc7d8a1f3e52d56ed, 0xe8b9b31aac411d71, 0xb35f46bf57ae6dc2,
+	0xff0c7a83bb5de478, 0x97e56ea394952a00, 0xa1b3d6d787f7113c, 0x6f5d86118631e8c,
+	0x2c9f54defcdcd8ae, 0x8f6aab096b3d7084, 0x197df49444958c52, 0xe2b9fbef20221966,
+	0x6064117549ebdb41, 0xfc9c3c29424f5d59, 0x9fd60f8e514f8ed1, 0x5bf7b7f65566271c,
+	0x866e957afd9f7e90, 0x90b41144b3dc4ead, 0xb7e370d81877c92e, 0xc5697db74b4d2d7,
+	0xb7a47504413032ae, 0x29724e3d16c902c6, 0x7b5059cc06901697, 0xf81ffcbfb227a6a1,
+	0xdcfa824512a6b626, 0x7ffdd95126001205, 0x4f21cfc9abd2f31f, 0x59a3582b2afddd3e,
+	0x1fe7398e4d922515, 0x31cb554c79d02c8d, 0x6fcdf38f20b1845e, 0x5118f3f3c84ec941,
+	0x97d6987ff49d3974, 0xbb83d31c196d6463, 0xb215b59bca1fe3, 0xf62a7fd417a9f4c1,
+	0x41f958f0596da768, 0x20c59d06e588f14a, 0x77ca93aef0a3f53c, 0x5f9a83a6f1a3f117,
+	0xdc001445512299c2, 0x6aa400289a498352, 0x28fc288a02a04d53, 0xf29fc68fc68fc00,
+	0x4a009298a1280d2, 0x51d20400355234a3, 0x851f8d1f8d1f0045, 0x26a428690050fa21,
+	0x19826a428690280, 0xcfa4f1034c519434, 0x355200344de12fbd, 0x9ba6d44801d0a629,
+	0x147e148d1f0540, 0x94947e4a49eb87, 0x4a6a04a06846498d, 0xe147d1f84d004533,
+	0x5a1a90a20e5045, 0x7e07a02869fd2a75, 0x14cd0e4051f85134, 0x5a1a90a20e404b8b,
+	0x47e147e347e37700, 0x90562969950248e1, 0x6707a055dad4290a, 0xa58fd2a6f197de,
+	0xa0a80350147e142d, 0xa5d514a5d90128d0, 0xe983347e347e07a0, 0x25014450150f84b,
+	0x140a00299c362dad, 0x7500d28ca2a94f1e, 0x28eab4fee09e31dc, 0xe983347e347e07a0,
+	0xc28fe3470150f84b, 0x50f9633e00bba685, 0x397962b948e47304, 0x8e224eaa971507ec,
+	0x50f4e4f2906e8c55, 0x31a7b7db14acf3f, 0xf80e2bfcd7011082, 0x2498fc388a6cdedc,
+	0x8e739ebd5f666993, 0x66ee718a8e4ca5a7, 0xb08385208a4877eb, 0x63cdf527e77b3300,
+	0xd6fbdcf3dc7ea748, 0x8f22b1cc761cabde, 0x62c68a7beac95dba, 0x79ae49324e8222af,
+	0xbbcf24b8df347aee, 0x29eca8a6f478bb0a, 0x66be1d275271cb08, 0x45325f05b21754e0,
+	0xdc9656730f9c3b8d, 0x3abd3bc066301273, 0x86748b4f378d00ff, 0x4e4fec18cb470e40,
+	0xf3138e7804a436b5, 0x4635fe91fab0f301, 0x9317d3654676572e, 0x9f266751e918e19f,
+	0x1403c744addf7370, 0x3d4a8fbf7208bb81, 0x3ea3291d7ef3cba9, 0x5254294e8721d39c,
+	0x3e50571cd3a0f5a8, 0xe03977632c8500ff, 0xd80e059e7353fa75, 0xce44d23c293fa08c,
+	0x178aee17be202643, 0x6628ec9fe6a8a685, 0x8bd49c66f127ee71, 0x69d069a4c948a9f7,
+	0x777a8f736b1abfe5, 0x1a724635f2b7a6a9, 0xc6a5f44fa9dd9ae6, 0x481ad5a396319a56,
+	0xabf748a819ed1c9b, 0x4f5eedc05c9e5c9a, 0x7560c552fd14873b, 0xfd8e04b96e749b78,
+	0x4a7d637475cb6bc5, 0x66b586075de79f70, 0x49f713663b6f61b6, 0x359cb173b5fe0ffe,
+	0x34779a146abd855a, 0x410e721d4871e889, 0x73db9d6b1fb69e8, 0xd8434b4c11666b54,
+	0xb2c8f074b5fe5ff7, 0xd3154146e04e1d46, 0x6a1f1c934b23a919, 0x551a643c614a0f5c,
+	0x4971365054efef18, 0x48cd3826c539c64f, 0x8ea91823c734b011, 0x5501d49e476b6a4f,
+	0xbc57e9983d2a7dd1, 0x354bb55b68cb6982, 0x75bfcaab28f4958a, 0x203bcbb2356e58f,
+	0xca52e9daaf823e52, 0x7cf0477b6b4e08e3, 0xb55c419f871204f7, 0xb953e1949d5b532a,
+	0x5b59a29dd3f740cd, 0x91e415fde1bff53e, 0xf8a16fd77b9e5c5e, 0xc78aaef497196e0f,
+	0x71a5b75700dcc2c2, 0xea721ad7b117afd4, 0x5561bc2dda0e5fcc, 0x72849e4e5de93170,
+	0x4ace46ba9654e409, 0x734aedc8550c3a8e, 0x9d2ba7b8e6767a8c, 0x7754d4b185858d31,
+	0x1b4b5273e4182a17, 0xc96dec4a35c77180, 0x7cf95b658a50e3cf, 0x590b6ba60762b1cc,
+	0x6b5231669b088abf, 0xf28a03165818e2f7, 0xa22ddd3031de884f, 0x83e939aedeea6dab,
+	0x8ab3b9a9145d41c7, 0x2ea985f85c0465b5, 0x1cd166dbfd60ca5, 0xf10469bf0c26f257,
+	0xd7e43be8491d398e, 0x2ff32b6fb0ea6e25, 0xe74a4f3ff573e5a2, 0x499a66b5af6eaeed,
+	0x4e2bbd3d96ebe499, 0x38766681881176e6, 0xa529f54a3fc95155, 0xd7932a671d9eee05,
+	0xa2085fdc32503b73, 0xbdcfc919c0469e05, 0x9c42be36966ac369, 0xb5b3594dbd9179c8,
+	0xfb2f7107b8f4e8b, 0xb5fe1e658748879d, 0x3ea2efa4c69a635e, 0x6bd21e1ed6cb2da3,
+	0xac4656e04e817fdf, 0xd7c86a66eb7d8036, 0x67ee887a00ff5538, 0x9ad2235036ddaf98,
+	0x3dd1f9d46a6895c2, 0x8d9f4e776a47a1e8, 0xa40a59a8fb1b030, 0xae5c63d39cbb6f16,
+	0xea7e15761f2e4a4f, 0x6e8c36daec4605f0, 0xa7a0c18483286c7, 0xc966f7a2d9e5519e,
+	0xe663379251b629fc, 0xd03ee2ebb41ed4ce, 0xd643851f63ec7e11, 0xd9bd39a906233b56,
+	0xe9732efec67d2414, 0xe0f5e4f285dcac57, 0x74dfea30dffc72d6, 0xbd0cbb47c06d9555,
+	0xb8aae1e5c629ad0f, 0xa048a5afe3c297bb, 0x286baf6a0f7fda15, 0xafca2a7d3d9d243f,
+	0x76cfac64b9865e6f, 0xf98c8b35d1d58c93, 0xadc6be8e4cef7e6e, 0xb59e7e3be4b62034,
+	0xad0f1ddeb7769243, 0xe7f71c65f79fb55e, 0x4ed1b992b3e27ad8, 0xa22432e6a035ba7c,
+	0x81d4ea3df0fe3954, 0x7db81fc3a9832d6e, 0x1b2e81cfaaf5ed48, 0x648888a5f5c16195,
+	0xd607f4c16df75bda, 0x7bcbe5d49dfa7ab2, 0xdeacf385cd722f7c, 0xeb878e2b1fc7c04d,
+	0xb1db83671c97e357, 0x5bf8bb8b284b4dac, 0x122cb53e3df69401, 0xf01cbaf7e3ae91c8,
+	0x75246da99cf5fa7f, 0xd9ccd7737a37c652, 0x516fe5077563ed86, 0xfa95e09062f3a7d6,
+	0x5e6fb7b162fe949f, 0x5be4dd92e26ec7b9, 0x1485d6673c409081, 0xadd1552d28a952d9,
+	0x987e768c73f930e6, 0x5d129e89f0d48cfa, 0xfdbf7210e47c8c59, 0x92332e68ea92c06a,
+	0xe78f639c71c60946, 0xd4dd52a4417db457, 0xcea9684dfe51c7f5, 0xb8488d2696e5e82e,
+	0xe03e78812ed0d8d4, 0x4ceb37e420134e11, 0xa3f6dc5e7e703762, 0x51e815f503e41563,
+	0xf8b063cde75e5b9d, 0x28a97f93af6ddc26, 0x5df53ee52e4d3d95, 0xaa728ad3c7940753,
+	0x27677457d900ff83, 0xc9055f5268d5f3b9, 0x3f50c79b06a50fc3, 0x1692e1a8d6fa553a,
+	0x298a12c9d448d18c, 0x3a0284a9a00a009, 0xa0f0a3f0a3f1a3f1, 0x29001a52a4943404,
+	0xb5d2340540d18ca6, 0x50f851347e140025, 0x9494be9586347e02, 0x4d01d0a629355200,
+	0x8ac68f024c49ad34, 0xa228697d23600a3f, 0x840014cd28a91180, 0x8d1f8d1f004551d2,
+	0xd18c3600851f851f, 0x4d4851b4012846, 0x13d0147e148d1f25, 0x153f851f851347e,
+	0x4bab00144e9b9656, 0xc68fc6ef00b4b448, 0x5629000a7f297d90, 0x4a9b3a8503d08c92,
+	0xa3b469fc4eab00b4, 0xac14851f450b40e9, 0x7484b83a641a903, 0x148ddf01284a8a52,
+	0x25ad5200147e147e, 0x4051d25c0a07a019, 0x28fd2a258dbf140e, 0x3f0a3f1a3f1a7f01,
+	0x1475008aa228000a, 0x45d3d25c005a9a83, 0xa428692e05903a, 0xf9718736aa85bfc1,
+	0xe9a3d47afe71478e, 0x1bc3b13f0550f84b, 0xfe645ce839c3586f, 0x756f4793ea66851d,
+	0x38cf3936ec7edcbd, 0x63ab6a5f828bad18, 0x882a6bce35f4719e, 0x7c9f04c0760936f2,
+	0xd4aba7374bcdf267, 0x554ec9fc91a4d4c3, 0x953f9ec0ea416158, 0x85f1f249144867,
+	0xfeb086d6fa739cfb, 0x7617aee5338dd075, 0xbb2064b3c67f063d, 0xe891e78ae32e1f6d,
+	0xb9671c970904d9d3, 0x996375cd26a2415, 0xc855a8991fb89063, 0xdba5b115e33c5576,
+	0xceefb2433632b304, 0x2a284a93f8ed5579, 0x34c390445892cd4e, 0x3d1fe3d42eb1b2a5,
+	0xb4dd801b2101bc52, 0x536be60fd0414f9e, 0x66f7831c45db4c4f, 0x1e6b963fb9db5b40,
+	0x9de06d93c43d43f2, 0x76c7197baaf263c0, 0x3944857dae7cdc67, 0x189726c39290a519,
+	0x97cabffe10ab07a8, 0xc9813f351f9306a9, 0x34f9cfe920015a1f, 0x7fead94aef38c9c6,
+	0x387f964b5ab54fd, 0xc63822e25a0a8, 0xb620e5a8f6dcdf38, 0x794296ded3abfbd5,
+	0x2d635493514cef18, 0xafa3c928a708aa58, 0x685273c78561a518, 0xfc4befa4990e9095,
+	0xa6f7097f628a9434, 0x1b5300d79fc25f37, 0x47a7614898557bab, 0xb76634a58f4e9bd2,
+	0x595dad23ed008725, 0xf5de4e422a7feb3c, 0x3a368cd8786a4645, 0x998d5499415b111c,
+	0xe0b1eee3506dd004, 0x8d240b4f7fd5c2d2, 0x5efeeec2611e846b, 0xf938a3e52a8f9dd5,
+	0x14ba25995a8f5c49, 0xa3369a5af1885b6e, 0x7eb647b47c6ca325, 0x59eb543ca0b2d2ef,
+	0x326f654736bad3a6, 0x2baba1a7b2d1a14a, 0x93b624efd2932bce, 0x8d255de1bfea21bb,
+	0x5deb23081dc672c4, 0x30f45eb545919230, 0x817a1ae40a4669fd, 0x4938963a5663acb6,
+	0xcc8362bf6a478da5, 0x3d3bb23a2af6a419, 0x4683aef40323e539, 0x5bc5fc3043cae3f0,
+	0xda353910b44361d0, 0x6a078e973fda7ef8, 0xde8a60f49d51ade1, 0xc1c1786923ccf01d,
+	0x1341a08b965debf4, 0x89a3d3a5c28fcb2f, 0x2f91a4cdd6004f55, 0xd2b349eaf29a0319,
+	0xf191c4a56f1f5284, 0xea7df70b23ec95b6, 0x2be79fc2705cba74, 0x589b0dd604d33372,
+	0x4046fb5d24da92cf, 0xa31db6fb50a4fbac, 0xe983919cd27badf4, 0x2438b8c6d18c3a59,
+	0x5d6c9baf14214d72, 0x23f982f8ce35c700, 0xe2b19ae718d89d88, 0xf505989d8d34562d,
+	0xce9b0df1adf80faf, 0x60f2d886cb64d2b1, 0x9c347a2bee817a9c, 0xc74313a7b25acb99,
+	0x77ac7a9fb0b6325e, 0xb327383970f7870e, 0xad4679c5f3471d30, 0x3b234dd378a1c625,
+	0x3fbee7788e9129cb, 0x65d379b33c93a81a, 0xc83b52f46a4e9ed8, 0xfeb9ba6fe71647b1,
+	0x54e1b1110a42eb75, 0x4d3be8bb36b54a95, 0xf85d4cf7a76e53, 0x6726fba3acb52675,
+	0x8f99fe03c3d03e60, 0xc7ce4f3eac657a6f, 0x570afba22339cc7c, 0x4b1f5bf436e7ac39,
+	0xb3aef2fec3b1e597, 0x3fc9132389e0bffc, 0x91956e4dcda98d5a, 0x6b64953f2f4136ea,
+	0x25b626c78e4b4c6a, 0xb46ab7bfc753aa18, 0x7153da4f193bcfec, 0x2e3fe23a758a60ee,
+	0x988fad98944e4f66, 0x7a9e03a520a64db3, 0xcd9d7e2e905a2f52, 0xebabb720237c621,
+	0xc249269917679dc2, 0xd241c728c9406c8a, 0xf74ba423951a43af, 0x5547564a54d8d7db,
+	0x5542127b77d25e0a, 0xde1e8401b4913221, 0x6f77e72e28e45b5, 0x8eba1ded7b9bbfa6,
+	0xf905600c157efac0, 0xd4eb4d6d234c2dba, 0x9ebc3208d9829252, 0x8f0d1b9adedb17bd,
+	0x8fa3de9db3f9f44e, 0xca7256eb1b468d6a, 0xced676870cb5d8e9, 0x414cc59afde117b,
+	0xd8786859eded9573, 0x373f2743ace2a97a, 0xecce14e7acf15fa7, 0xaf54e19a6950223e,
+	0xc776bb43a7d6fd27, 0xe76c5551bf9e8e1c, 0x7f5f77dcbb6fd828, 0x3dce0180638f5da5,
+	0xe8b338c971a58f3a, 0xb3a1e4d65535ca68, 0x9f639cf23306c21e, 0xde8d7234b87149e9,
+	0xd8104c1a7bb27c5b, 0x4cca949a3df40427, 0xf5a1e7d033ae1b4d, 0x3c4962b946b35aa9,
+	0x4da5c3e00ec84644, 0xc1915cc69e6dbe66, 0xde26c99a23dd6215, 0xb5a0dedbc30dd411,
+	0xa767f43ec6521757, 0xa8c76b776bea5373, 0xe78eba04414003d9, 0x7e28ea7a23ef6a8,
+	0xa12c958e7a6b9be1, 0x1b1dac00ff6cb567, 0x7f2a27b13a9cb2d6, 0xc9784a23351d6acf,
+	0xe79246731adad253, 0xa6498357108cad2a, 0x54338e8c8372b7a8, 0x78303030eeed9c22,
+	0x91b74edcda52faf6, 0x334669328e556287, 0x5d6e458556a94a5d, 0xf9d71d97c146d059,
+	0x399a6a020c588854, 0xc42a7dae03e7985f, 0xdadb30bbe2ddbf6e, 0xafa3a6e0a49a85e7,
+	0xddaa4aadcf974bea, 0x549c03376c1cb5f0, 0x5184d32bfca9cf99, 0x7aa0df636aa75f2,
+	0x9c559c90a2e53427, 0x9a8298a2284adcad, 0x8d1f054049eb7369, 0xf799347e00147e14,
+	0x428aa2002829fda0, 0x342145d13b0168, 0x8d1f8d1f00455194, 0x455100d43e37851f,
+	0x504d485194003421, 0x67d2f80150144509, 0xcd28009aa6f097de, 0x8db4d44809408d14,
+	0x851f45e3470940, 0x4049e95b6948e327, 0x5223006d9a522305, 0x7e347e140025b552,
+	0x5f7a9f4b40157e14, 0x500a80c2efb49ac6, 0x8c36750a07a02869, 0xbf4a49e32f8503d0,
+	0x7a028fc285a004a, 0x7e953a002d0d4851, 0xfc281abf035094b4, 0x48abb4a95300a028,
+	0x2d00299c362d2d07, 0x2f00a58fd2a6f13b, 0xd1ec0014851f45e3, 0x4a3329ea00b4b448,
+	0x56d3f84bef730128, 0xe147d1f80150f89d, 0xb44a49ab140045, 0x6953343b004551b4,
+	0x1ef10782e60090c2, 0x5e01696e280eb43e, 0xc31ec45261f8e3ea, 0xebd6bd2c75e58afc,
+	0xf94ff20c64800a87, 0x6a440acdeb9eaef4, 0x76567345fe713a06, 0xb13bcc1b79d135ab,
+	0xa83a12557e9c73cf, 0x1b37eda717995dd9, 0x8e8c67ec86380661, 0xb6861e5b7267a53f,
+	0x8bf9288cd55bbeaf, 0x7159213f8edc0330, 0xb700557e596965c4, 0xddb925acf09f833e,
+	0x86714ba2d911d94d, 0xb15e97a8f73f9c9, 0xfffba00a2383ca46, 0x6b21c47058f1fa00,
+	0xb137b85900ff8139, 0x55c0a655572c3fec, 0xcc8f9080b9f1956d, 0x927a8ea22a2000ff,
+	0x403b776931e34eb1, 0x9f71721ea0da23f9, 0x4f962189313456d0, 0x56faeb61cf0b28ee,
+	0xdd01aeb36942a4ae, 0x9d3fa03f41bee7c0, 0xf5f4b38b8925e066, 0xcc8eca2d53310e62,
+	0x4b933b4a93bd5fc5, 0x581a54f89363149a, 0x52fae78434b90014, 0x4a6e2bab38dd2ea8,
+	0x8954e9d932aa5eb0, 0xcee31e011488ac94, 0x8479b0ca6f0afb7a, 0x2123e83415c0d9fc,
+	0xa455ede961197806, 0x30742f62a374bb3b, 0x90543b7029ae5b2e, 0xa54f728ca37d65c6,
+	0xb490064946aad04c, 0x6a7ddcdc54116b44, 0xdba49526a9d9922c, 0x41e73f2a0aafeebb,
+	0xbb322ea59f3acc4b, 0x3700b4238e4ff1bd, 0x4afe2c14af53e06e, 0x687acf741ce07610,
+	0x54f8dbe401b68c4d, 0x9aa7f20046562a57, 0x32c95037f6ac25bd, 0x774ad6acf790c6d,
+	0x55ad4782f38ce498, 0x91d647a754ee248c, 0x4389d0fa588a1b86, 0x35c73136bc0ea6d6,
+	0x2ba9d849b55ea508, 0x97a0c61f24c1eda1, 0xf9f1eec7a666f725, 0xae828ea09e075bd3,
+	0x6d35a89cdb92985a, 0xb99a732538b6510d, 0xcdf4114ba489351f, 0x78c84dda92b8b15a,
+	0x695aa48e55ad473d, 0xb94ce27dba7496d9, 0x272fcaa3db8e756, 0x38e536b284936bbd,
+	0xcd4210a863a5b53e, 0x8da00357467535f8, 0xd3dbf804b31a5cfe, 0x391b7259e58ac88a,
+	0x7534b61ad07396a9, 0x35b8dbe3e5a76e3a, 0x38e71749f8bae8d3, 0xb471c799577a9e23,
+	0xbee13696bfa3a9f5, 0xb54ad9319752cb95, 0x24d10ee875d2728f, 0xac436dbd07019ea3,
+	0xe035a1c7c57c80c3, 0x6b3b649ed1ec7a36, 0x9590c14373c5c75e, 0x3a7d6786a9cf2bc6,
+	0x9b5d9cdad6eeb9eb, 0x406e17eaea987a8f, 0x90177f8bf19a43c7, 0x78b3d47a0c847c17,
+	0x353fc7b1ef4f55d1, 0x5bf5c8f636123a73, 0x35afd7bf5f346afd, 0xed8cc070c493f8ca,
+	0xc4dfbc6a00ff0026, 0xf4b88c59188e3f5e, 0xfac5cff895d7baf9, 0xf97634b24033b99e,
+	0x69adf05fdff200c1, 0xb1f1b51c7a2d65e1, 0xe7119f8a8f3af382, 0x1522a6d24c9366d5,
+	0xf82f7a783f759638, 0xc69e5b461bed9fd7, 0xaabd9e1c6a87b7a3, 0xb8190e914a3b31c4,
+	0x92c70a4618dfd51e, 0xd24473d95dd33ae7, 0x230cc50a9959d4a7, 0xfff44ce5e34e33,
+	0x6c4da69f1c658f79, 0x76705beedb5bdb5b, 0xf2a96d6adebfcb93, 0x6d4b4a793bd4d66c,
+	0x926c5a8f133c56cf, 0x7d3629650570e097, 0xeff3be321c070746, 0x618a8103e491d0db,
+	0x112aa709c014472a, 0xf6946e4c0fde49cd, 0x91e2c821430035a6, 0xa9a485465273f962,
+	0xbed328a4002e5ce4, 0xaa477cdba5b5e5ac, 0xab16ea6eb5a3ac8a, 0x718f3574e470c770,
+	0x6bad0f7d1c3ef06e, 0x55380d33c67c6819, 0xbf4acbc78c8db673, 0x8c4f73d27ad0cb37,
+	0xe23928e8a09bbb00, 0x1dd57d3c8fb526b5, 0xc0d935b27175494d, 0x356600ff639600ff,
+	0x642fbfcc30b28f1c, 0xb31c69475635f7f5, 0xceeecc6394d6931c, 0x2bc71dcba154d689,
+	0x633889394d9ee405, 0xd3e4b9a344053dfc, 0x125aaa1cab6abed5, 0x1841a1a9fc47de8f,
+	0xe4e446aabdb143a5, 0x44ea57e6123aa977, 0x2e0b50ea1df57a32, 0x72701b953ec85107,
+	0x6f3886ce7f8f482a, 0x428f9cdbb9044966, 0xed00cf64d8557b3b, 0x8f14f9ac46c7c871,
+	0x1fedc652ebd67d98, 0x37ca5951bf5e6e04, 0xb19bd9c159a1ebd8, 0xef09eeb862b89837,
+	0xeedebffb8763224b, 0x90bc649aaaf15fbf, 0x15a1c7398ee372a7, 0x9e5c0fea86b276a6,
+	0xf3d1b25b9d2b747, 0xc910c4fb38658d7a, 0xf08f7bb991d16a24, 0x2a456a00ff326835,
+	0xc5f7fc071900d9fd, 0x500fb9914c863824, 0x5f24668bb8a3e23a, 0x6feed49c3e78329a,
+	0x8f205ea6263e324, 0x35f09f7118dd8293, 0xc00912007cdfe256, 0xd72afdfabff8c3da,
+	0xb8d595a53ddb3cda, 0x36884a5eabf473e4, 0x293e7f7a7d0cb883, 0xfeb371465197e946,
+	0x795c32f6e4c0afbf, 0x7851f500ff756044, 0xedf38fd7c72d2f1a, 0xc8c8f25623a3ae57,
+	0xb10a21d6e83dc41f, 0xd5f156fa81b871e4, 0x552534b724f6d1e, 0xb3a5c2fbc08d2149,
+	0x1c9aaa9597554e8d, 0x425b45d953f5b49b, 0xf2072d00ff83f452, 0xe791b7326a768aae,
+	0x6b76e6d2aa941ce2, 0x1065d1857ff36b99, 0xd33a82a7f6748c0c, 0x3bc61154690ef371,
+	0x5dd46b6ae613a1d7, 0x428c2aa9958634d9, 0x4551140025cda891, 0x1f851f8d1f8d1f00,
+	0x42008aa2a4210085, 0x284a9a1080a22869, 0xa3f8ac68f02a0, 0x8d003b4551d2fa46,
+	0xcd689a02a0684649, 0x47e147e34733c014, 0xa0284a5adf0840e1, 0x34210045334a6a04,
+	0x47e347e307405194, 0x48519400947e48e1, 0xa6468a66d204004d, 0x7e003b851f455102,
+	0x22829fda0f79934, 0xfc0e4051d2fa556a, 0x299a1d80a2f0a368, 0x69d014a50e40e1b4,
+	0x4be983148ddf0168, 0xa055dad4290050f8, 0x5a00289c362d2d07, 0x5a004a1fa54de377,
+	0xa5d901280a3f6950, 0xa6287580b4b49a06, 0x69fc68fc0e404b83, 0xbf4a01a4f097d207,
+	0x9206a50e40334a5a, 0x404b83a62875008a, 0x97d20769fc68fc0e, 0x180a2008a02a0f0,
+	0x342875009ad1a64e, 0x1c4487186035094, 0x678cc68fed494893, 0x5442ea8680547eef,
+	0x5a00ff3ca92a1fb0, 0x7921051bc794a1e6, 0xaedfd215f4938ceb, 0x4a2c64c518f757eb,
+	0x8ff314dca8a273b6, 0xd39b49a246feb850, 0xde5dc89177732669, 0x4e4f72329210c342,
+	0x4e8f45d65215f1a7, 0xbc1e149bcc8d6cba, 0x8839114fad99fe95, 0xa90c7b2023890c0c,
+	0x90118b39d6fa49fe, 0xacf507e82721867f, 0x7db3c42b633bb524, 0xa1bc4d0e2267471b,
+	0xf4ea0a00ff78e897, 0x182429dcdbdb13b7, 0xab8555fe01003fb0, 0x8d4d64f94040ba45,
+	0xed3e0f7cb42227f5, 0x5246daf27ea4ec33, 0xf871355f00ff8f3d, 0x2d8278901b6b2a8c,
+	0x8ce931720bc7cfb0, 0x93a8caba59f1fc11, 0xf18fef832f5f3978, 0xb425a99b70eb6fc5,
+	0x32303d49dc71078b, 0xa653c45a58e75f3f, 0x4ad0c621039b1f9f, 0x8b526a9f00fffaed,
+	0x2173985d59c938e8, 0x17b63443146da57, 0xa7b907327e062bcd, 0x8e53a9e6c3d1acb5,
+	0x95cba266bd471ea0, 0x268c275b5c2ead48, 0xeae3f4a9b7e01c57, 0x949f0a0971bcdd2a,
+	0xd7b7e79ed7275695, 0xcd63f3bead8a8da, 0xafaeb38a8c7709e, 0x1cb24c95b764d3d1,
+	0xab00ffcfebf68c15, 0xb94e66933356abf4, 0x4880ab8d0be6eb26, 0x8779d4ed5571feef,
+	0xc23df553fb3b2a79, 0x55d40f7748bad9e9, 0xd0dbcda6f30d70ab, 0xada5d6e3e0483d75,
+	0xec36438329859e46, 0xc42dadcf7f3ddc15, 0x9f267ebc70944fe6, 0xc88f6c318cb810a8,
+	0xc03d8e49ad3a7f7a, 0x44ca6cc8d5e47802, 0x45732f3ca9764eb3, 0x1fee5c25991ac78a,
+	0x45ebf9bfc73d3d2f, 0xdb2814d08699c8e5, 0x61f70e1b953fe881, 0xdae354bdc88c6d23,
+	0xb5cfdb7b4c47f8af, 0xa6cfbd990f2a9f3a, 0x14eed4b94b170d6a, 0xd3afb72d0fc0b22a,
+	0x69a09596fa54d7d4, 0x88636169459665df, 0xc1418fd5f1983b23, 0xe9932a73635cc5fc,
+	0xdddd9aa97df1cdd4, 0x1cee821d987031f8, 0x9280525752ae387d, 0xfddaebafe27b7b32,
+	0x463881acb00ffc5, 0x2da39035f5cdfbf4, 0x1b759a1995b4e93, 0x5e4e71533a9cc29e,
+	0x69fca5f7b9902245, 0xf2fc5850f84bed31, 0xf253a518695aaf0f, 0x6b7d4e6e68defd91,
+	0x858c23b39a31aa45, 0xf9ac09bd5abf6398, 0xf64165b3ed6a0e06, 0xc65383845de298ac,
+	0xb51e661527b46a32, 0x452a312d52a9a426, 0xfb74373e60f0d61c, 0xafe3760babf0dfad,
+	0x20a22b300ae0aaf3, 0x77f8c269eeb8175b, 0xfb7b8172d448a56a, 0x7fd4d4460af14741,
+	0x34fbd4caa8386715, 0xc2685f4d4aa399c3, 0x136eb856eb523596, 0x53d8a874a36a728f,
+	0x5e90bba46ed86154, 0x9ad4c7ecca4bee4a, 0x37ab49ce39ae1fa3, 0x5c7f55dceeed11c7,
+	0x93ac963076765454, 0x21cf60b4b4e666cc, 0xb05971aa8df2f199, 0x1e9bded6c88f0c9c,
+	0xa14725d76c5f65cb, 0x2c7673ab543465ea, 0xfd34adb11440f9b9, 0xc8467d60c58b54ec,
+	0xbc8e264df1592906, 0xf0dc982666a081e2, 0xca74feb669ac5a29, 0xa596da9371dc85a4,
+	0x5224175bbc2576a5, 0x7b2b8af86c2d605c, 0xc74850385b182e7f, 0x7dc12cc915d63b3d,
+	0x88267299d3580d4d, 0xad2ed33ace708fa3, 0x55eb00ffb8ca5812, 0x8f40b4a7380a53e8,
+	0x341ba5a04ba4f297, 0xc0463341f296b771, 0x1c19d8aaa9fdbdfc, 0x436e43bcb7da539f,
+	0x55fa71ba1f9c3a47, 0x2e4760caba226d38, 0xcfcdbeadf0d7813a, 0x5e84cac47086ab96,
+	0x7e92b33ba5cc3cbd, 0xb2bb590d4e675a6f, 0x3a0c4f702af1d59e, 0xa9e1a866c355821a,
+	0x7dd041b39276514e, 0x20d46a786e65c68, 0x999ce2ca5524f24a, 0x8f30b5de7e4483db,
+	0xba748ceccc9a7a3c, 0xbb3d1b3bd5943e23, 0xcbcd46ed777bdbd4, 0xe81edc72d17b8eb4,
+	0xa71887f88302f351, 0x95d7e1cc1e9bafdb, 0xf597f9b96dc820a8, 0xe720535925652b15,
+	0x2d597d07172d35f2, 0xb5722a3860939493, 0xb68c8241b4b259d0, 0x80788115fe430f32,
+	0x5a3f9e6185319e14, 0xdc3942b233e6d1d1, 0x25e1e9517d458dd5, 0xf64f484623672fc9,
+	0x27650891ed583bd4, 0xb92f3cadca3ff4a1, 0xbc550dcc0fdac1e3, 0xee27d4bedd5cb97,
+	0xbca8ad1903c3e808, 0x30077b92bb8e3b9, 0x61bdb70fce38c813, 0xa29c34a3d3337b25,
+	0x812548eb0cfd57f5, 0x780e1c4691f9c57c, 0xc9fe488ed94a7ffa, 0x3c7f06004c7ec6e7,
+	0xab8ca2db750857f, 0x96db14070f82cadb, 0x7a5d5dacdc8e1996, 0x96a353b7db2e6aae,
+	0x5144457ed5328731, 0xc74d192d204bfb1d, 0xb0c467958ee4323c, 0xeb717019ce396c01,
+	0x2ca695b761d3d29a, 0xfa00ff7dc6516cbc, 0xff344671c463d5, 0x350f3d9513d04695,
+	0xa58a7035465a6aa4, 0x66b10d1d8c6ddf3b, 0xd01afa8191e83e8e, 0x3938ca0173796cbc,
+	0x873e475a085faafc, 0x130e1f00ffb1fb75, 0x5d86b1bad35a4f3f, 0xee79ae3c8988a02c,
+	0xd5e68993a235a22b, 0xff684dd4a994d5c0, 0x29c3328f3d30700, 0x69c51db7988f663a,
+	0x93614c8c3ddbdbd9, 0xa778fe31dcc92073, 0xe019986d55006bcd, 0xf140c5515deb8f93,
+	0xdacaa8de84b8646a, 0xa7d0ccada68d86de, 0xb8a124ad5a3f9301, 0x980a8e6cf36ab415,
+	0xbd471eb992e24f35, 0x14c756f4be5e1f25, 0xfd90c28fc68f82ac, 0x1445431a3f2428,
+	0xd04c0a80a2194d53, 0x28fc289a510094d4, 0x29297d43331a3f01, 0x1460da34684601ec,
+	0x1f455100b4694a8d, 0xd24fa9358d1f0085, 0x25b5d27a6b0a8092, 0x5100b4694a8d1400,
+	0x4de30740e147d1f8, 0x689a02a0a4f4536a, 0x98a2194d530014cd, 0x30851f851f8d1f05,
+	0xb4b44a004551d210, 0x69fc68fc0e404b8b, 0x1a9402a0f097d207, 0x5aa54d9dc201284a,
+	0xf451da347ea75500, 0x80a2f0a368fc05a0, 0xe404bab69509a1d, 0x8ddf016869d014a5,
+	0x14fe52fa208d1f, 0x2dad07a01925ad52, 0x92d6af5200299c36, 0x1f851f45e377008a,
+	0x9ad1a64e012085, 0x1475009a51d22a75, 0xfc68fc68fc0e4051, 0x8ac28fa20028fc28,
+	0x70008a36c5d92900, 0xa845000d469b66a7, 0xc861b3d2f38f6f73, 0xbdd6d43fe5fd438e,
+	0xc9eb6ddc26b2b4c5, 0x9329f3690c61c3a6, 0xf6206754ab74771d, 0xc62bc514ef388ad1,
+	0x55ed3609f26e0ca9, 0xff9fc64fdffd24, 0x4b5c7e3c79a7c608, 0xe31c5b6921dc220c,
+	0xb9289654bbde73d0, 0xd39ee61cc83d138d, 0xce90e1c6e31b23c8, 0x32edc7c171957ebd,
+	0xffc1a87b69365e, 0x6cd13d95b7057984, 0x35990e60e4540980, 0x3c495cdadaa29f26,
+	0x9e134bde40c9bc21, 0xb626577adb807fd, 0x2a2315a91db90d, 0x3585cad6e4baa562,
+	0xac6776af7a9530b2, 0x8e03e7dcd246a671, 0x34c55adea8d21f78, 0xfad67b727dc37899,
+	0xf5853b8993baa25b, 0x586144558a3d35a8, 0x703ccfb8706cede4, 0x8b3977528815dc2a,
+	0xc09eab62365668eb, 0xde4eec0c5ca93fd7, 0x980eef430de2b395, 0x932d0989b9e6b8e8,
+	0x8eec95ac8a2b7d92, 0xa381b2a7494d6b9a, 0x63a0fb317b97b756, 0x7e92367724419d1f,
+	0x204674fbb41e1bf1, 0x76f8537960277107, 0x6cbfcefe6cd454ad, 0xb65b322eb270996f,
+	0x633aba05e5b9d247, 0x9c8c649d39ccec51, 0x5be62cabf6c8d992, 0xe00ff90f71b9134,
+	0x6371af666afdbfde, 0x39e29ff16e690333, 0x7e1d5951b5c36fc0, 0x88f64bf9acf42be9,
+	0x4ee5af8f85242d97, 0x9dbeb87fa4955585, 0xf218ce302b50ed49, 0xe06389b1d29ee639,
+	0xd4e5d2fa7500f42a, 0x21f524f5b07569af, 0x1b6bde9e0afa3d57, 0x800ffcbbdf1cc7d,
+	0xc5a854ebef032a3f, 0x9f5d6ba5f367331, 0x163030225f92f2a2, 0xf571d6faebf5b721,
+	0x37ac4dd06b0aec34, 0xaa484d469162a7a9, 0x9e9253cc8880024f, 0x286835bda78e17ca,
+	0x276d0397c68fc65f, 0x955c4e0da74241e1, 0x23f3fee029d3ba23, 0x428b3ab3a86a87f8,
+	0xf6543db0a5221739, 0x3d70dbb9250dd234, 0xc569ea454412bd1b, 0x2e6635a155eb6156,
+	0xa628523162b989b5, 0xc504dc90d63a4c25, 0x44475cd515c8a2a, 0xc0554d9ae2a7b0a6,
+	0x61a322a60636aa8d, 0x2a4851612242d59e, 0xbd8c40318e1b1577, 0x1a35a3fb13e1e640,
+	0xfb3752f760268ae7, 0xed6e962bee7da058, 0x5391079a3559ad99, 0xb5232f3c7a2b4e1d,
+	0x45f7b7e8baa96864, 0x9f9b5aae00ba9f6b, 0x8fdde5a2e5d3944d, 0x3fe3d8ac34c9038c,
+	0xf59e332aae760c8d, 0x498133ea582deb99, 0xdb878262bbd0589a, 0x86e188adf5c966a1,
+	0x1c0d2fb2fce2f0d, 0x9a8c0017516d55ed, 0xa2934a5fc7951c49, 0x318b9166f212b231,
+	0x2ee4a5c0a9a69e24, 0x47f9c9e99602673a, 0x5c69b34a77956ede, 0xf24eae9d26879d46,
+	0x7af1c76510c342f2, 0xe07d152338485953, 0x47b5f2710a938409, 0xc64e61f093e5e722,
+	0x52b4eee21a9949ca, 0x2db2d61faf1f4747, 0xfcb9c1fbb12247cb, 0xd9f2a743c0c46feb,
+	0xe10e2b04fe07d305, 0x6a6a2bf27a007397, 0x369ebddc59f2b1f1, 0xa2ea66f14ff68e33,
+	0xac087218021816c9, 0xb4add652574353ad, 0x27d65ae9879eeee7, 0x1f3bc56aaa7dea36,
+	0xab734d11470b574b, 0xe3d92e41d3d64c9c, 0x621885d2afe33e64, 0x91648fe5089eb22b,
+	0xc4a1759915a12fab, 0xe4d6fd2494bb755b, 0x29f5e42af15c7355, 0x846e8d895f77d2bb,
+	0x4833587eab491db7, 0x14e7bf3ee38c9517, 0x8510f375de9eb3f5, 0x84b059c591c39253,
+	0xa8dde718ba1fabbd, 0xb1927652593eceb5, 0xa069e876e49c3a9f, 0x78d4cdeabd0e7765,
+	0x72dfaaf6a8e39972, 0x96ca6d2e6add8e4c, 0x92570920a3c918bd, 0xdc91c37799a93807,
+	0xb6f4befba0af5264, 0xa4a93c74038d6423, 0xe61fdd4a0be3d0dd, 0x46e7e3c2d3658548,
+	0xbcb676b7a3ded7c7, 0xf2983415a48d8452, 0x44516fd58e0765e6, 0xe7de27f341e4386b,
+	0x73b7f5d4eb00ffb1, 0x2c69e22df3b8c578, 0xdb812a3d8aa798b, 0xf7576bfdf9bfafb4,
+	0x1dc0c9e199485396, 0x39f25a3eda73b5c7, 0x96e87a4fafe52d08, 0xde969b87198c23ed,
+	0x6ac9e83b92b3a29e, 0x6ec9f1462cf25fdf, 0xdd37e04c3a4f07b1, 0xb14cdea9f57ffaf7,
+	0xe4be5aa77428ea8, 0x6575b0b3a5b1dfa3, 0x6790c18d03f365b9, 0x1bfb85cbeb55dc03,
+	0x32bf6de563329f24, 0x6a749d29ca59511f, 0x9c0b7786d626e49, 0xf771ce4992fb6356,
+	0xdf67499a6d45c4d, 0xd35aa9b1e7a0cacf, 0xcc0799ee542a16ed, 0x859aaaf8fcf4430f,
+	0x184d5c19c9a699df, 0x8cbe8b287d720439, 0xa1f5a717afca6355, 0x63911dbecad3c06f,
+	0xbd0ce70879cebf2b, 0x48ea4e1d66953e0e, 0xd3f84fce957a3bdb, 0xe2b8dba0c71a273c,
+	0x743516d491e0dc45, 0x60e58803bbb2c459, 0x6f45e0478ed881e9, 0x8e88c191f7e6d34d,
+	0xd7df6a764eb7d82b, 0x7337f699e000ffe8, 0x1360bc80304fa835, 0xa59fe6dc32b6c44a,
+	0x612582cd4dde82c2, 0x2c57558987557bf7, 0x2b4a2aa7ec9a8abf, 0x72a3cec551c5c143,
+	0x4a1f4c1a4c65fe95, 0x8d5a805ffcc126b1, 0xa729744dfc291c8f, 0x91891fa7e1e93cb2,
+	0xaeb00ffc9d1f8d1, 0xd1f809ab9db30a3f, 0x9b06cd2824284a9a, 0x490168d3a0190540,
+	0xf5411a3f008aa2a4, 0xa40198d20f29fca5, 0x1445490d609a90a2, 0x8d1f004551d28400,
+	0x250fa21851f8d1f, 0x298a12801a299a51, 0xfc00288aa204a009, 0x4d53f84bef3369,
+	0x6846094033695014, 0x3f8ac68f0268da34, 0xd24fa9358d1f600a, 0x4a6aa5690a8092,
+	0x4be180294a1a949a, 0x51347e074851d2f8, 0x4b8b14cd0e4051f8, 0x16869d014a50e40,
+	0xf89d56d3f84bef73, 0x1c806694b44a0150, 0x295e0e4033dad429, 0x148ddf01284a1a7f,
+	0x9c362dad0250147e, 0x3d02a6dea140028, 0x4abf4a49e347b3, 0xb40a4845e147d15c,
+	0xd25c8a02d05cdab4, 0x40515294e60e4051, 0x40e147eba468fc0e, 0x57d328093a04a0b,
+	0xa8c2c8c12569674b, 0x10b714b5da5c7ea, 0x199dda9abdbf1b19, 0x95faa8ea9cb1574b,
+	0xfa55b964be72b2e1, 0xfb79f9dc1fc7d453, 0x9825d8521e49eadd, 0x2c3833fba3de0df6,
+	0x35a70f20b17bb5e9, 0xe594e7c88e711ad5, 0xf5398c3650cfc32d, 0x732146264616d1a8,
+	0x242ab6b3a5ae53d4, 0x3f4fea0318647f66, 0x31f757186a6d56a5, 0x56fafcc53f0fac46,
+	0x99b2ec9f88bea884, 0x23a517bc7f590633, 0xb9e3205c13b1ba5b, 0xccae7d91f50e7fdc,
+	0xcd6ab1a3f0d9fbeb, 0xff6419115f49526d, 0x2b75952f15497100, 0xc12dca9ae4e9c8d9,
+	0x891f41a1ec3969a4, 0x8ec163add5c694fe, 0xafe39ae4b95efe18, 0xae3eb0d072d51935,
+	0x3c2cc1fd35aad2df, 0x4bb49702418051c5, 0xc1d5a5edd425d562, 0x7b40b7c7803b8a85,
+	0x7b6b16f5d4c75a7f, 0xed3c0970ab821989, 0x6502e474c960051d, 0x870a00ff41f78791,
+	0x50793d29589bd8ce, 0x8271d1a54ed4f871, 0x92a9425ee1624d45, 0x66fe29d5d4819c33,
+	0x9796823aaba80756, 0x102ba54a9ffd2779, 0xebe696ceab3dc6ab, 0x47b051db10129761,
+	0x54f851f84b450d52, 0x1f93da63a7464a8c, 0xbdc7706b889e1430, 0xdecc6a8f51a7f718,
+	0x84ece93d46ef71c3, 0x54c6b0537bb4517a, 0xc99c918e6aa4d66d, 0x9a713ca5c92dc06d,
+	0x3adb84c9d767f6c, 0x1a29fc4ebd9fa6f1, 0xa7c148534ca7c790, 0xa52203451b553e2d,
+	0xfa2a250df220771f, 0xb187ae266e4df17a, 0xa897f96d90a322cf, 0x9368707d749f9ce6,
+	0xb6d09853cbd5e0ee, 0xb4b3865cbd23a820, 0x358c561c7a20cce6, 0xa9f4a02caa95cece,
+	0x15652a8e7154fa63, 0x384aea528ea1851, 0x36cdf1e429705358, 0xb50e1853d8084cb4,
+	0x1401ad569ada332e, 0xfdcd467674af9a80, 0x1fd6cf8a715b4dd0, 0xf9f35fb0efdfae6d,
+	0xc02865440f91dd50, 0xb6d23c632c4dbd1e, 0xb51ee7c1f8b43e39, 0xf6683435b46022c9,
+	0x7db69cbe1abb5b40, 0xa7aa2db11541b2a, 0xd9e71eb9d6e3a29b, 0x3906f2314ac9e161,
+	0x14c049003403a439, 0x11763ad2ba1d76ec, 0xd788f196abc0b154, 0xfe3a1e6d99d2e371,
+	0x7a619cbb6fa7d227, 0xec86d5e3149d4901, 0x54fef9bd6d66a874, 0x6d9af9aa9aa360f6,
+	0xd87652071af1a783, 0x149d1e3324199a75, 0xe78c0ba1368af656, 0x45d151c9a2ecb326,
+	0x8e962a194831565a, 0x4a11758d851646e5, 0xa435ad0a3f5037a6, 0x45eda127e6c1fdd1,
+	0xabf6a1470e26e9b4, 0x5ab33ddeb9966f7e, 0x70fce30cca7bcee8, 0x2c9341a50a1c4954,
+	0xed76aef52717c6bd, 0xd6d427664663c8c2, 0x720bd9f5da2fb1ce, 0x8000ff587d4e26b1,
+	0xe338053569b755ac, 0xf9dcf0a3ea3d3970, 0x91bce21cdb5ece4c, 0x7aaa3dca16e3e9d4,
+	0x30a9f400c676dd8e, 0x2684146978fb9c6b, 0x6b0c14a74ad10c90, 0xd1282447c5fca82f,
+	0x77e351abf6281fed, 0x5181bbdcb7562a52, 0x35a7b11a534f11f8, 0xa827fc86b7a2ab69,
+	0x1f5c363b5b5b93f8, 0x7aeafe5134a599a, 0xad0974063f44aff2, 0x7d50efe87b75b87c,
+	0x1f0806dd277454e6, 0x7dec9ff40e7f5a53, 0x95243ecdb2d03404, 0xc82937e80132b4a4,
+	0xdd6fa5c80b8aaec0, 0x5ce58ee0dfc61d49, 0x1a6b0dfc38caa28f, 0x59b7c68a199fda6a,
+	0xdfc45b3cb6221dfb, 0xdad296eea659bc0a, 0x87b94df6fbdf522d, 0xdec435a09fcd0fd5,
+	0x588a369ad9b43541, 0xf429fb20a8e0e5f, 0x2bdd36d22fa5fa4a, 0x7d22a6ca02867b34,
+	0x215ed40afca9ec86, 0xee5af958101fb4d2, 0x2e4fe515fec60d99, 0x54fa31f9e70bf85f,
+	0x35ad958fa3a02bba, 0x881f477640d9e573, 0x8ebc1cedd680b0ab, 0x9ff14caff7b12357,
+	0x6a0ecf4b86e0c8c1, 0x3cc1796793606c27, 0x7dc080e3397e6d64, 0x44961d589a6ecc6b,
+	0x343f0d48d19e468, 0x30f6c8c645eab9de, 0xf463bea454758ab8, 0x73f77359b94d36a9,
+	0x89a50ca99dbd56fa, 0xe19f15feadfbf756, 0x8d05d55200ff227d, 0x2de4e00234db385,
+	0x9e69a557801ebb67, 0xf3a957ea6adf9e09, 0xf624b7b773856d0c, 0xd093731aa5773bce,
+	0x5af2fea914ba58d6, 0x95316be636ed39f6, 0xb8a7869e76e57625, 0x19f2452e4ffad696,
+	0x5e83aef40fbd2c87, 0x465a95dd368d74d1, 0xe0b7e7764acbb972, 0x15a37bcaea9a8b6b,
+	0x3b17416d3bd2989f, 0xb0ac35d3cf1da08f, 0xa9a9cd509c5bd7ee, 0xe7ec28cd7cf9b672,
+	0x3c744f68d6d59585, 0x328391c44b3574e0, 0x6a8fef1fc70c17cb, 0x25d60efc0300fff5,
+	0x3dfb5b8d35d4e2d2, 0xa0ee2d8eb66545a6, 0xb5fefc0190c4808c, 0x8ee458b5021fc45f,
+	0xdfe448bab65f3f4d, 0x828c733d6344dce5, 0xe7b88ebdab533fd5, 0xbd9b1d1c73385b18,
+	0x1040d4aec036aca5, 0x24c312669d8aeded, 0x9e077834bffc124d, 0xf8129fadf2cf1f39,
+	0x6c1ad72e443ac467, 0xcc4fef2212e6138a, 0x6d36a7ee6de75a7f, 0x9171653a9f0c5529,
+	0xf59d595d7a30c69a, 0x65ed45f3295dc12b, 0x63b7b1c45ea9977f, 0x2cbd071e232db0e4,
+	0x6900ff39a3f72186, 0x86612b8c30a7f2a8, 0xdb625a00ffbc3ee0, 0x187557f9937c46cc,
+	0xfb89b8b1e7b32b2b, 0xc1bf4c03f95b9446, 0xfda95b62a3c28f1a, 0x4dec0b5b9d0c436a,
+	0xe88ae973ab57c146, 0x58ddb38e8a3c2a8f, 0x98432b9a516b1a3f, 0x34a384408d14cd28,
+	0xf851943429006d1a, 0x21851f8d1fcd0053, 0x9a90a2280153fa, 0x1ad24c008aa2a409,
+	0xfc68fc68fd00a028, 0x51d2fa0680d20f29, 0x2100455152230045, 0x1f8d1f0540519434,
+	0x4a5adf0050fa2185, 0x802a8a922604a028, 0x8fc60f80a2286942, 0x280128fd90c28fc6,
+	0x90a2a409009a90a2, 0x4cabb4a95394009a, 0x730152386d8ae607, 0x50f89d56d3f84bef,
+	0x3a0045e1270d4a01, 0x3497c201284a1a94, 0x28fc281abf035094, 0xb44a9b960605a0,
+	0x691580e6d2a6a5e5, 0x6801287d94368ddf, 0xb4299a1d80a2f0a3, 0xa070da14cd0e40e1,
+	0x287d94368ddf6901, 0xcd0e90a2f0a36801, 0x49732900a470da14, 0x1c0e4073005b8242,
+	0xa0cff386bbc6d0d4, 0x58cd3d3990db14a2, 0xaa6b528fc75d8058, 0x88dea81366b5149d,
+	0x8e6147a10a95a4b0, 0xcf80997914db452a, 0x471018fa9a504de2, 0xebcf35cf568fe512,
+	0xe8d872cc9b8dd05a, 0x71469243d7faa813, 0xbf28ac5aead2d9a6, 0x3c66be054fdb5db9,
+	0x409edb92ada51ed6, 0x57fc5ce54f0eb6a7, 0x36267f1442d777f7, 0x6abc25bd1acb93e4,
+	0x14063279666b0b12, 0xa89acda5ce3f666e, 0x91cc3f4fa8774324, 0x87fbacb0afbfb3b7,
+	0x8a17a6e798c965b9, 0xbab2deac1f7c2de9, 0xdf7c2393c3c6daa2, 0xfbfe9d1b5fec8f7,
+	0xdbe5ba7b532278f4, 0x2902c03e5539f29d, 0x8b388f227542ce28, 0xeeae87343fed11ca,
+	0xa6bd9b356d18ad49, 0xfda82c5f5f74dad6, 0x8d5a58a2639f5e71, 0xc43174e0b6f67696,
+	0x475c53f308fc8f15, 0xab04c16db39085b7, 0x7be4bed8afda317d, 0x77bb9ef066cc236f,
+	0x9e00ff15310c5331, 0x35fa366c09f8c92, 0xf8bd6c794b94c16a, 0x701f266ce9157ecb,
+	0xb450f1fac1cfbfe3, 0xc7f3ddfdaef6b94b, 0xb54f16638fae00ff, 0x6d26e61ff85bc391,
+	0x69ea071e898e0d4b, 0x71a95db6b31cde97, 0x6abf07f0e0426d2b, 0x16f89ff35846e6ed,
+	0xcb9b8bdf5ceff438, 0x8ed7b305c9ed7a85, 0xec18a174a6d2e79f, 0x3172ddf3dc9b9411,
+	0xb2d657ce70bf011b, 0x1d03f1d68acd6d66, 0x5c5eebcb58e928df, 0x314551b4b0633bb7,
+	0x2fac3515a8f70b85, 0x990a1c6f2755f62e, 0x61b293dceb8a122, 0xa8f027e05f6468a4,
+	0x43a352afda823c8, 0x352015933a25adc7, 0x2966da7d2b5554ba, 0xd3f8b93f3aee29a3,
+	0xbabd47ba4fb21a9, 0x43e1c7c5a219dd37, 0xb9ab105656834931, 0x372de039a6a818cf,
+	0xa2dc96526be40e1b, 0x4862484a4f4fefa2, 0xad1f9561a636cd31, 0xe6a70a408383c044,
+	0xd033c52b409ce23e, 0xad559821f9695e8f, 0x23b1394d32ab798e, 0xb6c65abfb5d6fa29,
+	0xf5365b71ee69b762, 0xdd17b7d08335b78c, 0x6a35a950548ca7e6, 0x67d0d092deedc918,
+	0x436f27c4a9381dbd, 0x43c65ae7a7e36248, 0x38b84852438a5cb1, 0x7123996aa5e730a6,
+	0xd26a4ded0352614d, 0x3eaf9115746c23e2, 0x4acf63013d8b226e, 0xe1a40e5620636cd7,
+	0xb5fe68a7fb5b09f5, 0xc27295883d117a32, 0xa6a907e11ac65aac, 0x8bae859adeaaf745,
+	0x38f846f43457607b, 0xa775bca289d14afb, 0xfa22c5f190e63c67, 0x547ad423c23e2b57,
+	0x311f8f61d3dcc7f0, 0x687dd187e5852bab, 0xb9a98072ac0ea737, 0x5bcc987a7f7bca87,
+	0xa849368b19293d96, 0xcbb052d2a0059067, 0x9c3515f4d4410fa9, 0x506da8a9a79e175b,
+	0x415db5b7d78d79b3, 0x1b1f33df8d524081, 0xc269a8699e54e015, 0xa40283914542a783,
+	0x2f797468a6ae5683, 0x27757b101b6e7ca6, 0x5dddb37d1ad4fafc, 0x2f1a59a47fc2b2c,
+	0xb8fb132e2d9a65ed, 0x3a7fbc8fb2b70fd7, 0xa8d891d87b345b8, 0xc8159bdfeb57d6e,
+	0xfb4ce6cb5d92b5f9, 0x74b4a9001ea01ed8, 0x5a9f738c380ede12, 0xa8ce8e5dbec9bece,
+	0x8b88417b2b067d46, 0x6847ad95f4be317f, 0xb518b18ca64cf9d8, 0x832a520b9ad57429,
+	0x5773372036ad5ffc, 0x9d3e486039268620, 0x57caa5a47dae14ab, 0x138d692ae4c3ec16,
+	0xe521d8aa565cdeaf, 0x8dfbc86000ffa955, 0x9898bbb07eccc855, 0x7a97041fbcb5863e,
+	0xff20ddafd6e71dc, 0xfaf13d103b109c2d, 0x1af98dfbc04fa7d4, 0x52ae498aa13df0db,
+	0x23f1220ff699dd19, 0xd5d8735e4fd10393, 0x508d697e9efa0e46, 0x3af2f5a7774749c3,
+	0x1ad9070d74e259ab, 0xe03f2c8cee6cea45, 0x5b620a2e2ea9850f, 0xbfae687debb92aa7,
+	0xd7c0bbbbac78f1f7, 0x548ff464d2d5455e, 0x9f818100ff4522b5, 0x8e4940b3db5201c4,
+	0x9ffb74eb1fc1a81b, 0x632bfd484ec53f3e, 0x9d05288399b4de3, 0x3f398f2b9be0361a,
+	0xb117740ac09fdf18, 0xccea4856408c6b4, 0xca369abdddd93f71, 0x33e296793bacf593,
+	0x663f143c30de58b4, 0xbc4e63f513a07e9c, 0xe34677d7948d8dd4, 0x91087dc1224dbc65,
+	0x66fa75e0aafbc024, 0x97be29fe8fdf3880, 0xdf8624eed2458f53, 0xc1cb0ba10aa6214f,
+	0xed098ed33170c02a, 0xbfb727d429b15e5c, 0x59f46c9205e2a6fb, 0xa0c69fdbf573ca47,
+	0xd26deff4ee9aa7d4, 0x57939cfa465e48dc, 0xbcf833c3a140bb5, 0x549d955e3f217bb5,
+	0x3acb659465eb919d, 0x71ebc1277ae217dd, 0xb3934688515f8617, 0x270307ef3e491289,
+	0xbe09ae49570439d3, 0x8715b5c5b291b7ce, 0x38ce73825315d0cd, 0x778200ffb8e2f439,
+	0x60ccacc2f21fbe68, 0x1f5b46cc80404491, 0xb23f4492764d3d88, 0x80dc2e12ddee42ed,
+	0x9e3ce3c0c8ed8abb, 0x368f557979ad09fd, 0xc7b779ea93937373, 0x426925ad6e483559,
+	0x76638c00884cc5b, 0x3fe55eb47f03abe, 0xd72c064acd3566cf, 0xc3c1cc9bfdd26973,
+	0xc7afd8664f3b57a9, 0xda8c35e3736b7da6, 0x71b2d8dcbc248297, 0x801dc32a39ea073a,
+	0x7d467de06f5ee9cf, 0xd6967183bfb6592b, 0x841e6c85cd442a51, 0x6617a7f5838c8c63,
+	0x7a9fee133f42365, 0x920222aa61173c89, 0x2a0c00bc7f401642, 0xee0fcd96afa2abc6,
+	0x23b7cf955cc10dd8, 0x6dad8a5fe09fbc06, 0x52ed34e55aa5e175, 0x2cc3d2ce53b3bc15,
+	0x35ac57f8e9789ea4, 0xb481572a38b391ec, 0x382528bdce8fa492, 0xe9dfcd917193e45c,
+	0xea41e5caccb01f7, 0xe115bc8a9f5ce50f, 0x2b937fda17165aed, 0x388edf964fad190c,
+	0x92bca551ea35883f, 0x7f7b9073b3d19d2b, 0x2b6ee761a5665a9f, 0xdf0d00068c2a7204,
+	0x5aa3594941e7ac88, 0xce6776d07cd38958, 0x931141aa5ff8265e, 0x2f451ca3c84bbd44,
+	0x57fad3ce013d26c9, 0x6d769b8efa16eb9f, 0xaae4fee42d6ead6f, 0x84f6b5f5b51efe54,
+	0x111c7537dfc6a404, 0xead6023de23b57f8, 0xf71f7545dadfdbdc, 0x72859f9e3e368c25,
+	0x598df667c7562cbc, 0xea66312e9fdd792f, 0x4af832deea1598d4, 0x92a78dabe1758dac,
+	0xf2cf117d46be93d6, 0xd3bcb153c7bcce6f, 0xe3795bdafed21eaf, 0x1a00ff082e72343f,
+	0xee29a9d21c7a7939, 0xa099aa76950f4ca, 0xaa288a128026a428, 0xf29fc68fc68fc00,
+	0x84001445490380d2, 0x6846d314004551d2, 0xa3f8ac68f02a0, 0xd3140045d190c64f,
+	0x364da99102a06846, 0x128fc281a3f0a80, 0x4d53001445431a3f, 0x299ad1340598a219,
+	0x50f851f8d1f85180, 0x901288a86347e02, 0x34a3a446008aa2a4, 0x35451f851d40450,
+	0xa50e404b83a641a9, 0x8ac6ef006969d014, 0x4d9d02400a3f0a3f, 0xadd2a64ee10034a3,
+	0xfa286d1abfd32a00, 0x4051f85134fe0250, 0x6607a070da14cd0e, 0xf43e1780c2295394,
+	0x140085df69358dbf, 0x1a90a20e4051f851, 0x85d3a66876005a, 0xbfd36a1a7fe97d2e,
+	0xb052147e1428000a, 0x54a1cac7a9f48c02, 0x482ef61896decd7c, 0xd9c022cbd24c8ff9,
+	0x1c4ed5b59ebececf, 0xef102d2725ccbdba, 0xa1c40700c666131, 0x28e02c295c35d5ce,
+	0x2ca9b5962ae88fe9, 0x9e6b0a4748cb1152, 0x498ae0f2bcbfbb56, 0xf4a9e776a2ee93a6,
+	0xfb72916054ece7aa, 0x8c338d0650729254, 0xa9863ae9a69fa69e, 0x323829929c8d2d1b,
+	0xdff0a0abe51e8511, 0xe68932eb5c36d582, 0xe3fd71b193020bc9, 0xc25825fbbaca5ffc,
+	0x3c0298c31896daa, 0xa24a716f314ee918, 0x6c6f0d7c86ef1c5b, 0xfd276579b952e312,
+	0xbeaea967fa54795c, 0x12686b866b1b0b1b, 0x203946c69892ab32, 0x26031b5b50b7a5f7,
+	0x260babd43aee314e, 0xeb91c3df9ec2ddd7, 0xec649383b1a5285b, 0xc791815cc1657e85,
+	0x5e000b969c6efe3, 0xb29ae23e1899721c, 0xa7b08c1c78956f04, 0x7a6207f916c0cac8,
+	0x608cf2c47c15c71f, 0x9e0d27b08c08b23c, 0xaca89209ec881a3f, 0xca72a9f2cf73007a,
+	0x3fc8867ab0d551bb, 0x4412f7aad600ff43, 0xe342c630a31b2f1b, 0x52aecca1668ce927,
+	0x479e04b7616f1331, 0x9fc246080da59f1f, 0x9aa1e2f5f7648c98, 0xc00c018241447e62,
+	0x66cc88a47d51e50f, 0x9aa7c69ffa7af935, 0xd4980b747319e5c3, 0x1fcbf8cc959edb13,
+	0xa28e972ffe4081d9, 0xac32c82a4c9969ba, 0xe75cef38c8db5501, 0x2703f8596acb148b,
+	0x3fabb222e700ff8e, 0xbf596df3d411d270, 0x292bfc38f377f272, 0x55c275b4e69e3c49,
+	0xaaaf9fc39cf7904, 0x1a0ab53775e513e, 0xa3a115204015454b, 0x85ddf2a0ac2cfb07,
+	0x8cd1da39162dad50, 0x8e537af03d6ea44a, 0x4f82dd7942a645e3, 0x78c1dfb7b8a0a652,
+	0xc08bb76d6a70fdd8, 0x643974dda4b1cf56, 0xa9d7a2bba65af553, 0xa881bd017498ac49,
+	0x5f8d3fec0c90b4a4, 0x6a559f616bb8dc66, 0x33cebec8a3a39e6f, 0xac4a65a4f912cb51,
+	0x2a50436ba8c130bc, 0xf5be41957e105ce1, 0x61c3ee83399d564, 0x8d95ba6567ccd620,
+	0x717ec66235ef6350, 0xccb7f1b634690b5b, 0x457da7abf68c51d9, 0x5f7ece2f302a8aa3,
+	0x539f6bac606c4d53, 0x47f9763e52c21657, 0xa78a67b61536af6a, 0x417053ec2bb5d417,
+	0x6a79f9140f4e91e6, 0xad8fdd4a96584367, 0xc0c6a67504a39b0e, 0xe9838cc04fa5a7fc,
+	0xc5c869aee32a204d, 0x23077237eca93db9, 0x13a7f367bc46adb7, 0xfed0371f3fa88b2a,
+	0xf9b952c53c62bbb5, 0xd8e7c071b38b3580, 0x9c6dec8009efad77, 0xabf57fdc73e5d4e1,
+	0x959dc6ae96c29d2a, 0x76686fa5b57c6cb1, 0xe3287ff6e9ad06e7, 0xe76f0785636fad15,
+	0xb431661adda1ce5c, 0x57fa01526b869ac2, 0xf656b53ecef32c4c, 0x831aa778ea556fd3,
+	0x1847d576886b3970, 0xc88aa7905ba8b935, 0x982b61bad2ad4db8, 0x94de234def20364a,
+	0x602443e6d61c63d2, 0x4b0c996b0ebb5daa, 0xdc9aebb7c4f28479, 0xa4f94159acf2e5d6,
+	0x2856faebf157f9, 0x1ff69e33520a7a8c, 0xbc733f929e567a1b, 0xe71c17a808aa6e8c,
+	0x459558a15b6bc5b0, 0x7aa72a5b0f7d5473, 0x18c3532d39895d8e, 0x23cfc75b52f8e3ce,
+	0xb358ebdb0363d53e, 0xd2f8d13b5e10a1e9, 0x36d2c48ec2914d71, 0xe3a8771c1f09b272,
+	0xfff273f9883bcd8f, 0xb3323496c27fb400, 0x91fddf11ef83fc64, 0x11fea00f60c74056,
+	0x1a415e526f9c41e9, 0x50f89d56d3f89fe2, 0x6033abf129cea076, 0xbe992458fb14fe0c,
+	0x71ca5624c7ade255, 0x9128d5fa03e17f86, 0x49935926b768892a, 0xc5c66a22cb864d3,
+	0xa6315f46710d00ff, 0x8b1e23b2691925d4, 0xb1636e6e764ffc57, 0xfedc8b3e656e3857,
+	0x7c51acbb32a99f35, 0xb9b4a6b7826e47a1, 0x4fb1a79a2bd639f2, 0x3f9cb502fcaf5f6d,
+	0xb1b9cf4d8651b969, 0x2b1d00152a2c5de9, 0x96246686dab74137, 0x3765a50f6aa54fe8,
+	0xf9e1d81736197b76, 0x6a80672b7ad4f29e, 0x70d5fa40e854da68, 0xeb49cdefc968ee48,
+	0xb9f1b1dc1dbbdc38, 0xf8d3a6573935484d, 0x7c9a7a6e970670d6, 0xac49685487d3cdcc,
+	0x5e4f6ecf0092b14a, 0x8d636cc671e9d5d5, 0xb1e5dda876efd362, 0xae993fe339f75c86,
+	0xc64cdd626d444b2f, 0xbd8db8a92c648c30, 0x7163e6ec8aefc838, 0xc4afb87ba36960a,
+	0x6d83b6d69fe50f53, 0x4e75fb3877ae7c6a, 0x48dbe41e96f9253b, 0xb137a497e5cd35b1,
+	0xd3c08f03893f6309, 0x7f4ac812095e0bd5, 0x99ed7fd22e97aee7, 0x9be6a78a7c00ffe9,
+	0x26cfb1b9ba241679, 0xffe9f487deb41b, 0x58928c7958be3401, 0x123f3ea7cde40009,
+	0x924bf1ac427e20a3, 0xe8dee69e68960bdd, 0xdbbe4ce5c9978d83, 0x9b5c23beb022f5c7,
+	0xec35d0ac92250c3f, 0x9017dd48c2cc78b9, 0xa5959e3b22feb955, 0x955beb8bf69dc115,
+	0xc7b99bfee1d197ec, 0xbcb63a87f88b2be6, 0xd1a8c45a8426d26d, 0xc7ebd8dc8811dc6f,
+	0x86f61cda82a6b923, 0xc2547e0203f1689f, 0xce655bddbad6db73, 0xaae06d545bb4259b,
+	0xc0242b23c353aef5, 0xf4eb4a7f1023c9e0, 0x7abeb71412dbd4b8, 0xc9a783531f596bd6,
+	0xb78000ffa8ef8b83, 0xacba4d8689b83662, 0xb91e5b3b876542e8, 0x6b438ebe4eaf380c,
+	0x1466871cad5045f6, 0xda05240737e041e1, 0xdcdde153bc02f408, 0x4909ab1cb18c4ffa,
+	0xcf7f90360e8b8924, 0x58e0fd25b1e85ee5, 0x2c77171d6e2ba39d, 0x3d4780f13da8eb3e,
+	0x8e36ab653ef479ab, 0xa771956efbb6517b, 0xa007992c3cc758ce, 0xe1315ee1c7f3df2b,
+	0xa6c6b46fbab021f9, 0x8c731cdccef5c245, 0x2d5ea8c15eef7890, 0xc7399f192c47e1b5,
+	0xd36f27a84f829100, 0x4be26f53293ee535, 0x57719d36ac4558b, 0x39002440363fbbdf,
+	0xb7f0ab1e89cc9aed, 0x4dc648823aa4cd58, 0x3999fbdb955bed16, 0x8f66f5f5a0fd0303,
+	0x860cc9772cfa572c, 0x7ca5a37c84b40037, 0x5ad76a135387f061, 0x10c95a5da2f2966c,
+	0x8e73bd41ef6a8b75, 0x5bea7af75fa0039, 0x9916d636785cb2eb, 0x1fdc1d430197c87c,
+	0xd959f85de7079d6e, 0xc6d4fa0e1dade6d8, 0x73da30ab22b2dc22, 0x8d6665abf583f1dc,
+	0xff38861d8fcd97, 0xd93c0ebfb5a4f5f5, 0x30d6914fe33892a2, 0x8f551ca7070f924a,
+	0xb4339d0f935d16dc, 0x46bbeb1d8f1f63e0, 0xbd5f292b3a866a73, 0x42cdac993eeeddc7,
+	0xfe1cd7d3ad2c24c5, 0x5147d2ad6534b135, 0xbd57951fe39cc78d, 0x77ce0512a8ca6456,
+	0x91230582520a7f00, 0xd8f132182e95d2ba, 0x6ba71f7c8edf5c81, 0x7eb449d8420d26d6,
+	0xfcedd6fdd3e145ee, 0x7972be2a6426d1ab, 0x59e9ef338e24476c, 0xc8c0f4f4d5b6adfa,
+	0x9f196b3495e74a3f, 0xe686975ac1fb7828, 0x5799b85b16d77069, 0xaea1dfc78e033d05,
+	0x379ec434d7aebe62, 0x47565b8acae4612, 0xe12bf12b5eebef11, 0xcfc6a0a3264d96d4,
+	0xe97eb40cd096c900, 0xd96870e58aba3dea, 0x288c541445739e3b, 0x1b0128fc28fc68fc,
+	0x194d5300144549eb, 0x4a6aa5690a80a2, 0x128fc28fc68fc28, 0x4a4adf4a431a3f,
+	0x34a30028a995a629, 0xf851347e14006d1a, 0x52fa8666347e0250, 0x24c490dcda40053,
+	0xd1f85100b469d08c, 0x7a9f49e30740e147, 0xa641330a8092d20f, 0x2800da34684601d0,
+	0xfc68fc2680c28fa2, 0x5629802afc28fc68, 0x469b3a8503d08c92, 0x80a2a4f197c20168,
+	0xe4845e147d1f81d, 0x8a6607a070da14cd, 0xf197dee70250386d, 0x288a02a0f03bada6,
+	0x8096064d835207a0, 0x77005a5a4d519a1d, 0x85bf943e48e347e3, 0xcd0e4051d2a01400,
+	0x6d8a6607a070da14, 0xbe00b6a4e6025038, 0x8a8a84a97551e14f, 0xdd8d515b43c77970,
+	0x2c5c934474499dd9, 0x2bfd38cfcd7cb82b, 0x9096c75c55bf5a13, 0xb5537bf21d7614f2,
+	0xf0f0fe3a600ba14b, 0xbd6bb34993ded333, 0x8791a5612b2bb3f0, 0xc2e4a4a4b53e456f,
+	0xa9799d3e5a194529, 0x263d00ff814133de, 0x1cde764d3dec897e, 0x30d68e669bb46dd3,
+	0x5fdf2e0fc9fb7364, 0x31de8eb7b14f616f, 0x9f4e85011a6bbc15, 0x71fb98176fbbbafe,
+	0xa544aca26a1e9c93, 0x61beb91320235872, 0xff59ae26f5a78d, 0xa8a79fca6dcba475,
+	0x57e5792e363b2aee, 0x9690a4d2bf471da1, 0xedef517e607edb6d, 0x5646b5d9b092195a,
+	0xcc6aa61f7a004342, 0x7fb72f17ed31849a, 0x878091540dfd4446, 0xa7af7a607edb4087,
+	0xff749ede3599d2, 0xe66337f278975bdf, 0x975acfa863781f18, 0x94a590332d37c621,
+	0x93e239f507f59c9d, 0x9c606424b18c44cd, 0x642db5b102973f92, 0xf018dec6488684c8,
+	0x4abcd49beb3ddf1b, 0x787070e0926bb88a, 0x71a7bea968a83235, 0x1b8122d17c9188f6,
+	0xa1dae7f632c38165, 0x79b42f9ed12dd4bc, 0xab3de8434f1b39aa, 0x8de3f9294d7c2ecd,
+	0x7c50739dab1a9eb3, 0x4fa51fe3e47895e1, 0x89549fd0a3726533, 0xbda723f575610764,
+	0xd90d1e3602b32641, 0xf32a7fe0cf48f939, 0x3f2f6969eb528ddb, 0x22d781eaf3aa3805,
+	0xca49738c1c0969ea, 0xb6c6f51dbbca47dd, 0xc9bb721ca3bb7cd0, 0xb7bb84b5d6ca5a1f,
+	0x11d77b1c374b6510, 0xdf635224e4dbd525, 0xe3a0b09b79de148a, 0xb9568b930a6be2ae,
+	0x8eed275a47998d71, 0x4dcded50914372ae, 0xcb324073ac942a8, 0x9a3b9eab7dbb6992,
+	0xd30308a9463a927d, 0x3392a8667ac6a4f0, 0x2fb06f6dd39bf457, 0x4f7bd53e88549353,
+	0xd064f34102b7756b, 0xfd4d4c4853e2ab7, 0xdd42a9cb69ce7db8, 0x8ca1dddfd67dd554,
+	0x962b77796905e118, 0xfcb87eb46a7f8b3d, 0x9ee3d8b9bc45dea9, 0x928e819cb9c3583,
+	0x87facc51fab0548e, 0xce4031b1523f662f, 0xabf7ed5891db0339, 0x89f91c595826ae61,
+	0xd38198edca55d6dc, 0x2eaf077d2d35563c, 0x59e487575deb6ba4, 0xcc3f1513f30495b4,
+	0x89b679e1b1b52a57, 0x93aaa23e5e972760, 0xdbd525d1e2b5c8b4, 0x326b70eeb0b02447,
+	0xc6a41297abd9dc46, 0x23d5fb20e7c37545, 0xc66023b4b9a3a6d6, 0xb5634c6a306cd47b,
+	0x8aeea3ccca3c9048, 0x2f4bead4b2a25c8b, 0x6eed0b9f6218a8b8, 0xa7373ac8a60e90b4,
+	0xe02aadcf0b45925a, 0xc3b965a89eb8a58a, 0x2ad65ad37d040786, 0x4d52ae9dc99a34c6,
+	0xa79f3a70d09101dc, 0xdaab76fbebfeb1d6, 0x6c77a1245cdbfb6d, 0xa1f5511f7a188eed,
+	0x3ac12b3dd32c8cea, 0x7ba972b421a79e9d, 0xc973ddbfe9a32119, 0xf9f459f07545dd1e,
+	0xd5cb6b976bf12a7f, 0x340c3ca30212b5bc, 0xad2b3e7f821c2767, 0x8a353e8df58de7f0,
+	0xc0e1cdd72be4a5e4, 0x555c73fc757800ff, 0x6d541c7527def270, 0x8e04cb43d6869e69,
+	0x1cc1f1acef54f19d, 0xbb1cfec72f3d2a7d, 0x315fcfcd9ac86d8f, 0xa495febccc5e2f77,
+	0x620dbac1dd0f6f75, 0x47fea09e07dd4dca, 0x955a47779ce5e69a, 0x3c03b55447ce6c39,
+	0xf3b545aa33d77b1c, 0xad6e3285d6b0de5d, 0x43fce15af5fc07f0, 0xfa24ecc77fa3a779,
+	0x3093527405fd862b, 0xc833d47adc8c14ab, 0x52bda3da465e4491, 0xddce082c1f60d6bb,
+	0x3deb8e247155e089, 0x7e2067b1326057d1, 0x825829c3d916db15, 0xd10b23cc93b866fa,
+	0x37b68da0de03f514, 0xf17e122363a6d34c, 0xf3246b6b9d828eeb, 0x52a2f5a04f7dd008,
+	0xec5694a46e3a1db2, 0x958fbccdf3c6a5b3, 0xbc3086d94a7f073d, 0x285608d6ad2c699e,
+	0x40781999af981d7, 0xf7e7d7627cb757e, 0x4a077051b753a808, 0xa366e04c5a3fce33,
+	0xec2149ae1d690177, 0x701e2b53346a46e1, 0xb2a8f7b0a7b7efa3, 0xb74a9f3b7080c9d2,
+	0xa0f507dd0e800a08, 0xa8024612f95127cd, 0xfedffd513e804201, 0xc575524b938014bd,
+	0xe0c888b5a63aac24, 0x48051eadad79850a, 0x46b86a4fb7f393c3, 0xf6c1132239b59aec,
+	0x35f474989f24166b, 0xe7caa3ada55ca887, 0xb326e8e247d7faa2, 0x19e866f7e35aadd3,
+	0xd811370e8af73312, 0x7ed94bb8e27a9c13, 0x6f39b761ce6ca8dd, 0x95e651aec24f6f46,
+	0x73860f8b3162e791, 0x97bc1d2db784bd7b, 0xb0c39e939bad7f33, 0xe62300ee69e3ada8,
+	0x6c6bfe7651d85b7e, 0x460b34b4a65ee507, 0xa415f49764829019, 0xeff0cb9b0f1dcbe5,
+	0x40a297ddb6f78815, 0x408f11918a711488, 0xd4645806c116e46a, 0xf6298f1518b830ea,
+	0x67ce8653222dd57e, 0xff3fe4d8f590dea, 0x7d43e870e4b9ece, 0x932a6514a55abf1e,
+	0x16a5770f9d2e477d, 0xbc99e68ec3b81f31, 0x8bc6b400ff14cf75, 0x4a29532e55002396,
+	0x9d548b620d4d72a7, 0xe436a6a23230bee1, 0x99da6ac77d909c7a, 0xe53fc60d67bf5f5e,
+	0x6545fd21bf61abad, 0x405d22216b466ef8, 0x19e58fe5f26452c6, 0x59c650656e15f93e,
+	0xcb3790f59f8be56c, 0xa857c6c76e6b45fd, 0xe31c4f56df94d5ea, 0x5dd47f0a65bda288,
+	0x2ac54fef347b9c7, 0xffc120694b9e31, 0xf4db917b94fb665f, 0x3ac55dc2b8e016a8,
+	0x513ff2f98372898e, 0x638b1b1aef0f9149, 0xeb3f00ff721f48da, 0xe1aafd52768b8c45,
+	0x44c2fc847c6b4943, 0xe61ed707d7d12ed9, 0xae2eee5b37c4cfbc, 0xb87e0e7225ef8f99,
+	0xcda6a9764fdf55fe, 0x5d382a003943f270, 0xb53ec0b8af272992, 0xa37e72b057d0dae6,
+	0xfc7c1d9d4a5b93e, 0xc37b09fe4bfeddcd, 0x8e5d817a8c4fb7a9, 0x15a39042dd62249f,
+	0x20fc31cdb229e9ca, 0x9d232cf1eea4c556, 0xe8faccca386b9ebc, 0x83da18d923c4fdd3,
+	0xf3ab4e2cc9194f1b, 0xe1f35e0364c4aa24, 0x574485554d9364e9, 0xdb691ba60763880a,
+	0x1bbcc64d8f187db8, 0xc01513947ab451c5, 0xc3bf7acded732874, 0x8f2c43530c3a863b,
+	0x656d0475377004e5, 0x8d64b57cc7f09fc, 0x7c16c96b794c5cf9, 0xd9f2c848e70b035d,
+	0xaecfb88fde372ab6, 0x178f36890ff27a0f, 0xe7f2417722f33988, 0xd2c58bbdd2df738c,
+	0xc33be319c0fb4db2, 0x957e90edf13b8e01, 0x9fb2b3a79513bfe6, 0x7d3b48902086e62d,
+	0x8fcc1c59eba1df71, 0x85bab6eaa447ebe1, 0x48929174826febcd, 0xc631fe866137acb2,
+	0x9a2e045fd1579c7a, 0x5b2e98dfc9fa5a0d, 0xade52b3d4ebf2707, 0x19952e8d855b6426,
+	0xf38c71fd01be2bd8, 0xf813ba23fc425feb, 0x9f961aa5d948cec2, 0xe386813b3f97a51c,
+	0xb4a4ccac94de9aeb, 0x93c658edaf6ff93d, 0x777b9eddb000466d, 0xa432198864e95aa9,
+	0xa4d1e3a976fa6c37, 0xc802d27c9019d696, 0x1fa73e1d1848c6a1, 0x8be2d5ea5794185,
+	0x57fb3de73a1d01da, 0xa4d46116b873a87a, 0xcf2060ef1b6ef955, 0xb650c376b51e3fca,
+	0x47467dc926133396, 0xdc169620d4982be4, 0xd2a62205375e309f, 0x91d8dda0b24dc9ef,
+	0xf4c6c6cd4c53b4da, 0x9e53705b4a34c7b1, 0x5c506aa8067e0c58, 0xc9edd15066acdb5a,
+	0xf658883a681d481d, 0xf741b601a46e2447, 0x94246ae2cf39a047, 0xc7128cdb66cbc3a4,
+	0x32827ae83dd36373, 0xe7bc8c2c3c7700ff, 0xa5ba58ebdfe719e4, 0xd5da9a878ecd2793,
+	0xa36e54761b3bf16d, 0x538cd934f4a8cfb0, 0x7f594993c998459, 0x4a58e56f4752cf86,
+	0x7ef850fc8967d126, 0xdf2d8c464f5d86b7, 0xa3c7bd5918b82d2d, 0x68e578549abc867e,
+	0x8869521564656e4, 0xe86caf3ef515c13d, 0x8a735cdeaf2054d9, 0x565883091e8a9ff3,
+	0xe75cf8150bb0bf, 0xebfca10fbdd1e32c, 0x924a1a8e67b1519a, 0x26e2de5eaead09ea,
+	0x3e150ca3abd8588e, 0x45439a61a49aa898, 0x2a0a41935520014, 0x3369fc0028fc288a,
+	0x6846015052fa41ef, 0x409b06cd2800da34, 0xd2f80150f8511405, 0x4601a6a4f483de67,
+	0x4d83661460da3468, 0xfc0028fc288a02a0, 0xd43e93d20f69fc68, 0x8c12801a299a5100,
+	0x14455100b469d0, 0xe987147e347e347e, 0xa08a92c65f8a1240, 0x40e147e147d1f81d,
+	0x5a05a070dab4b40a, 0x97dee70250386d5a, 0x142d00a58fd2a6f1, 0x350d4ab30350147e,
+	0x38658ad2ec006969, 0x69d3f84bef730152, 0x284a1a941680d247, 0x7a0a541d3a0d401,
+	0x7a9f0b40519a4951, 0xb900943e4a9bc65f, 0xa66876008ac28fa2, 0x798caac0499e97d3,
+	0x646c9bc195dd849d, 0x2140f2866a1700ff, 0xe3d9530479f9f432, 0x75b166bc8e9c837c,
+	0x25e68bb4846b9a89, 0xb593e84a9f7b0181, 0x24084b4cfb8a88a2, 0xb7cbd18689086fd5,
+	0x9b765de9efed5138, 0xaa286d5b710c450a, 0x62876ed6dc93ef38, 0xb364326545b5b46c,
+	0xcb7b1a5a71fe93fb, 0xd37d948d4948e214, 0x8cd06c5b42c7a9d1, 0x95cd0fcab0f17eb2,
+	0xb68da555f9f17de5, 0xc88354c62d4144ab, 0x9da3298a4aa71fe4, 0xe303de711b0cc77c,
+	0x660b905845fc3867, 0x8f3c9361ab6a2776, 0xdd02149a2453fa71, 0x5fc7b85552371c66,
+	0x31edb66fd653b5cf, 0xd4513f6b70c43e2f, 0x715b8e6a93161415, 0xb8a6da73ad8fd4c7,
+	0x2c7520273855f9b6, 0x8c3454993a3fee41, 0x9de78e58554b8d0d, 0xebbd3d07d94277b7,
+	0x46d98f0913f1bd9d, 0x58e9ebe309729036, 0x880131b237575717, 0x72ac50eff54f8227,
+	0x2ed6429ecd92db21, 0x6dd43dd38ca69c66, 0x952a80c7d2d6c535, 0x167f7a51fb0accd5,
+	0x8a04465cb3964e45, 0xcb01222d929afaab, 0x4c39d8a94bad6fa9, 0x6da35bf0fa9a64a8,
+	0x953428adc0f59c03, 0xa1150bfcb7b2bc1c, 0x59ee526dde369de0, 0x4fce1d2800e3d806,
+	0x967211161c5757f8, 0xaba59c46d5bc7eea, 0xe8dbc7916889ba64, 0x9a04fc77db8e78c8,
+	0xa36d8b23ba4087d0, 0x35e26db45fba02df, 0x9a3c479e31853d0a, 0x73647533bb0563bf,
+	0x24cf47ca8ff000ff, 0xd32c248e45934d6b, 0x37433e7405708e03, 0x1fe4bb68bc254953,
+	0x6e4a00ff9d7ef22a, 0x679e4d4e81bd529c, 0x9c8b6e63659d22ab, 0x529393b625066cd5,
+	0xff6792c49af992ea, 0x3ea153ae9069d600, 0x10b492ecd463b8c2, 0x994d0a3fda7504c6,
+	0xfdaaee9ff6a9f1fe, 0x5105eccdbc3f3069, 0x601c49057da60299, 0x978c21a9f34f7d8e,
+	0x1f8f5502b43e261f, 0xbd8adadc4b9d7fc4, 0x65ea5548e9c818c6, 0xb5a1a7e47e5a4f91,
+	0xd9769ad8c9aa2a9a, 0x34a6f4f4ce6a827a, 0x11fbacb8d328e8d8, 0x55b13dc8c831fa7e,
+	0x2bc355f8617e066f, 0x9ad3711bdf458a1a, 0x559ca1e8920bd552, 0x8e5324e986563e8d,
+	0xdd2fa74830ecaaf9, 0xd4d6cc3e2735a7c7, 0x87f96f1ccc334fe2, 0x6565f58edd814535,
+	0x450d1eca932a5813, 0xd4b35215f780b4b4, 0x7eee6a6f1f7682e8, 0xa4767f89a1ea6a60,
+	0x6fa9f08059aed691, 0xf7c712b714c88194, 0x3e99ab1863b41517, 0xcc2e97eee7583b69,
+	0x89aec855e991dfab, 0x77e09ebcdc75a3ad, 0xef08e684f43edac, 0x469bdac6096be8d6,
+	0xf88d5d818953e82d, 0x5656a4a8a97a4a1f, 0xbda8b19fe8147ec3, 0x2deb79024a967c3,
+	0x8e3a462ef3e9daa3, 0x7490e056ad00ffe3, 0xdadbfe747626535, 0x75af6a2cac74eab8,
+	0x62c0fb0ab9b156ea, 0xb7f65a3100ffa0de, 0xc9382c95f1c4cdb6, 0xd0f2594b93504dce,
+	0xa0c27fe8a127c7ba, 0x2fb3da937cdade30, 0x5ace64ae6afdbf62, 0xdb90d9c47ad03a98,
+	0x38cce8b18a11264b, 0x5cc1f2e5be3d45cd, 0xbbed2f2bfdfa640c, 0xd79a563d2e1b0d00,
+	0xda39341a7a5cf7a0, 0xaa2eb104b4bc2792, 0xa37855bdc739b013, 0x9f02750ca3e6ab52,
+	0xc680b593f741d415, 0x12e6fe3313637a07, 0x51a1512001753f41, 0x1010ae621b217ae6,
+	0xd6e7783b0169bbde, 0x7200ff8cba69daac, 0x34acb402c7ea4106, 0xd711e6cd5c835548,
+	0x1d69cad4fafa201c, 0x997a9b7dea15b094, 0xdd12707f739d569a, 0x9aeb5185e7c4bf30,
+	0x6f8bfc487b0b8add, 0xf4eb7339428e7f9d, 0xb6673f049de6a9f4, 0xf57f0b06167f915d,
+	0x72529e6b9d0eaabd, 0x765f1d868107873e, 0x712cb86d67a5f429, 0xd8344305ce464de8,
+	0xaa5492251253ba9, 0xe8bde8631a2ad43a, 0xe42a3dfd82902786, 0x7a2e468102b71748,
+	0x52310014d52882bd, 0x1dd49eb44be14771, 0xcd1d45a41256d16a, 0x619a2b6352730735,
+	0x7d86b90d236a4dcc, 0x43d90cdfc2777a05, 0x8b1e03168fe3cfa1, 0x8edb353ce1e8aea7,
+	0x3fbdce309ea018a, 0x1fe3cb065fc1df5c, 0x4b5cfb34e5122416, 0x9ffaa0fb974f2779,
+	0x6bda1e8f687f57e5, 0xeef0620569a26917, 0x6ee2c8c9140f28b, 0xa9de137fd9518f37,
+	0xbee4528a9a181c3b, 0xf10927f82ffb568b, 0x2e8800ffbaf7c43b, 0x51c4e7ab5bc81935,
+	0xa207aa303082ddaf, 0xc1db0a71aef003a8, 0xf7887f0cc731c6e4, 0x38b9b96459c64234,
+	0xcc274cabfbd34192, 0x63ada802724bc56d, 0xab89a79871e5231b, 0xcdd2f6698744cba6,
+	0xfa717303bb3f017a, 0x2f5cb91ddba45d57, 0x559b74b3c2de1eab, 0xa95aeb5fbd6e0081,
+	0xbb77567a3a0a5538, 0x4bd0c32b1cb8f4b9, 0xc77c9418c2cb3ded, 0x2b8a5eb9bf34f771,
+	0xfa9cd654fc33ae3d, 0x34f5c9d9a323f3d5, 0xd836eaf57f3bc40b, 0x3ae23c5431fdb2fc,
+	0x742e4de889f3689e, 0xfc153a85cca24d35, 0x7650361b50d55245, 0xff14889bde4098f9,
+	0xeaf32e1cf58e3c00, 0x710819c3a8abb096, 0x186d36a248fc03c7, 0xa2232fe761e9e4e2,
+	0x40ee2d81aa1657b6, 0xe46e2a7f18063050, 0x1ff9bdd9e2068189, 0xc76dc9a08d2249e3,
+	0x8d4de11fcf3fe1f7, 0xf122b93f9e3be2c9, 0x8be0465a4c1a1f5b, 0xfee0f31b9e7b907b,
+	0x5b2daed1433a1bb5, 0x927980634a7fe4dc, 0xf00f00ff1107fedb, 0xffc915dbc924a1,
+	0x316149bc16404176, 0x7a411796a77576f8, 0x62b77ccc70958d20, 0x31d533aff303d30f,
+	0xcff68a3aef4f74f6, 0x138b1ee03f0df08a, 0x459427c98b7b5608, 0x6400ff780063678c,
+	0x7f103a9fa78e78ad, 0xddd9ad59e1c7a8e7, 0x76337f7d8ce67e59, 0x973741acc26f8bcf,
+	0x4f2d82d950ef39db, 0x591f5b5677aab4fb, 0xf096f913c55f511d, 0xde95fe4139cb7fb3,
+	0x307f9a62dbc1f7c, 0xd31f00411d57386b, 0x4d439db8daeffb9f, 0x331add996236cd7b,
+	0xd63de15f6b06ee01, 0x76194812371f02c9, 0xd555fea19fe7a02f, 0x8c91e6cb67d34d4e,
+	0x3b2fbaf8a4c70e71, 0x73432124e7a9ca6c, 0x39aff0c3eef38fb5, 0xec32193ef71c81f8,
+	0xed390e06aa6d602e, 0x2d4d5ca977d7dc9e, 0x1f69b7e9ccac6d91, 0xa5b65c73ae3faf74,
+	0x8902c6e24dda0c6d, 0xafa723978fbc0c21, 0x2b199ae7799ed404, 0x241170caa23a1a77,
+	0xc38f9cb3f7915c39, 0x6b6daf44f881bed2, 0xa5d4b5566466eaa0, 0x3d78bf51e16893b5,
+	0xc4bde56deb7cbdfa, 0x8c1b939470bcf276, 0x2abfe589d5f3427b, 0x53f8738c3a821ff7,
+	0xbdb689b5c02c36c4, 0xb7ad2ced58854286, 0x27233e5c051d38b6, 0xcc377d188b66f6b1,
+	0xcb31c2c2b6371169, 0xb4e60890f1b63b86, 0xb423c75468e26c6f, 0x4aa7bfc731820099,
+	0xc3a2736ba306f0c0, 0x2418711b6996f272, 0x4f527edc749c9e47, 0x4212a1d1d9e85aa7,
+	0x245782caefb23141, 0xec8c354fd77a1c76, 0x1d37f7459268dd67, 0x937ff8930f7f00ff,
+	0x72148a4e4badb9d6, 0xe2c81f1c2067b2d1, 0x7ed2d94896a2c9bb, 0x979f1e981fec3c13,
+	0xaf01a12caed6c14a, 0x7b0467bc93c348e7, 0x451c4dcca84a3fed, 0x77a4ac426e922cd4,
+	0xc4d31d9be2f4c139, 0xe738e7ee2338b854, 0x5913764d9bbea5d6, 0x74985f619ee366a,
+	0x8142f9a346fea807, 0x3faf07709c1177b9, 0xcb925ca19196fa5, 0x21cbd1fb13e67117,
+	0x15dc31a97656f8eb, 0xcaa03c68550a8cd4, 0x9aa2067efabb5964, 0xcd714ff763583461,
+	0x53a69d26422ba937, 0xbeee57ed3665b214, 0xd80a562bb5b2d29f, 0x83a856fa756cc70b,
+	0x5b6554b153e39962, 0xa88419157bd47aa3, 0x630d7dd501777059, 0x467821fecb239a28,
+	0xe32f5808cb845edf, 0xffc0112784add5f, 0x6ba1fe78a56f0ffd, 0xc2ddcad25796571,
+	0x5f910ac6115931d1, 0xf96d69e305166b4c, 0xb82600ff18c332da, 0x3e56c483165e886f,
+	0x49dd5f61d423416c, 0xacf6d0dfb83f48d0, 0xb84b6a9a6a3c345a, 0x39da887b7bb8b666,
+	0x8e8a54308cae6263, 0xa3f8ac68f02a0, 0x8ada67d2fb4c1a3f, 0x1905409b06cd2800,
+	0xa3f8aa20068d3a0, 0x4a3fe87d268d1f60, 0x25004d485114604a, 0x5194340140135214,
+	0x48e147e347e30740, 0x4d48519400947e, 0xd204004d4851d204, 0x1f8d1f8d1f004551,
+	0x6848e32700851f85, 0x55386d5a5a2580a2, 0xa3b469fca5f7b900, 0x14851f450b40e9,
+	0x6876000aa74dd1ec, 0xf1a3f13b0085d3a6, 0x6801287d94dae7a6, 0x370d4a1d80a2f0a3,
+	0xd2a0294a1d80a234, 0x7d90c68fc6ef80d4, 0xa2a44129000a7f29, 0x1d809616299a1d80,
+	0x7a9f0b40e1b4299a, 0xb400943e4a9bc65f, 0x7ac785e6f75c3837, 0xeb9154f0bbd8c06d,
+	0x76b59c31978dd35b, 0x1360b6fabd7ea29, 0x6c2bfca8f4fb00e3, 0xf2c999bbccb63f52,
+	0xd5535bc159ebe9f3, 0xebc72e474cfd638c, 0x55b94d0522720c5d, 0x49d0bee22aecc018,
+	0x39903200ff462ef4, 0x338963756ef481d, 0xdd686555d4630070, 0xbb8a3146069e5c81,
+	0xa74ff07a2eb7a966, 0x90b0255c6541a6a1, 0xdaf3044782514112, 0x7f4a33a332dd5cab,
+	0x49e99287d1ecbd9, 0x383db8dece8dea65, 0xa405d421fe73853f, 0xa69e517eec7c580c,
+	0x95dac65823fa9cb2, 0x5f2490b235a9473c, 0x195b59664d863d33, 0xe3bd90a793717e4,
+	0xece9a7b76afddf72, 0x878172eec6afaf51, 0x124ab46fb8a5f76c, 0x79acc9f1f2834a30,
+	0xaa426c7c0264088d, 0x7e1aabf4c09303a3, 0xb5e2dc7171c4ed9c, 0x4f6f59222836fd34,
+	0xf7e2961a00ff236e, 0xe4aa809da84a243f, 0x3a04b1eff98cf756, 0x560100ffb5fe697c,
+	0xefc0c15849113852, 0xa5f60d35c9b3d555, 0xe0d84026090b6d6b, 0xbe69822e494d9367,
+	0x60095bb823d8da5, 0x34b226a9aec64fc7, 0x283f6269e3eea80b, 0xea7daad6fad7bf6d,
+	0xc668221b95ec9ad3, 0xc0d9a8cd5929d46a, 0x86d61cb8679864fb, 0x3790a19b726f759f,
+	0x96c509494de1b7d3, 0xd2b775aa78660555, 0xfae3f5018492e7e5, 0xd7c74bae00dcd59a,
+	0xff52ed8b58634a, 0xd559d700ff03f431, 0x5e9ec77b3855a29d, 0xed6adc7518b97b39,
+	0x5e878cc72dd1a9e, 0xd85665e6bc89b853, 0x64bf7acfb89ecb4f, 0x47759f1ed250b540,
+	0xedd9251a213cb35, 0x4973f7c04c00ff09, 0xf2a4c21e00e97d8c, 0x80e1d2d87d4cf9fb,
+	0xa0d946a24a9fc6e0, 0x9835d57afd800b37, 0x8e9d563c393e206f, 0x73059eb773f3d904,
+	0xd39a5ba2dee7f5f9, 0x1b4a53f7ef68c8a9, 0xd5538cd4b3ca9ffd, 0xaa998f42e7cfd1b1,
+	0x4c5a9f4abaa82ec4, 0xf3f727c9a26aee21, 0x1a498e06769cf34e, 0x2bd40e4a6d19442c,
+	0x55518f3b5eb12a81, 0x11b79c86bc8fd1be, 0x6f3aa5789f8aa49e, 0x478e632a0f4acda8,
+	0xe399b4661c5e56ad, 0x5913bc9deb52369e, 0xd3a4783d4728eecd, 0xf48c212b567b724f,
+	0x74379a076abb8a3c, 0xd25af700d96a59ef, 0xf750c49f6b5b91b3, 0xe57e2997f90cdb4c,
+	0x9faa79ca70088780, 0x3389902e56936c31, 0x6c9354d45cc5b49e, 0x8549a7bb5845a5ef,
+	0x39eb202b9551cc1, 0x2384a741a54fd503, 0xfef2db188dabc0e6, 0x5cd22577f964bc75,
+	0xe4e39bac9ce635c6, 0xc2b3cd4556dc2b75, 0xf54291a96b3d8e73, 0x9c49124dabd2dfe7,
+	0xc2f2861e2d61cd81, 0xb71a7cc439f3aac6, 0xa5774d4db055746b, 0x3eab9d3e38e1f9ee,
+	0x354d85c8b689e448, 0xad7a87ad5319ce24, 0xfd860c23f3569b3b, 0x1e57301cd1bded6a,
+	0xc8557ae50c35d7fc, 0x3b74c549e5473d6f, 0xad59a0e3bd55e3a8, 0x2db60ca58f47ef5b,
+	0xa9dd1159f3fd47d5, 0xa3c2fb084e943afe, 0x18a5a90f228eee94, 0x8aee9f07cb0756b0,
+	0xe34728e2a230ed93, 0x3715cfa3f5783e59, 0x997b427387b4a7b1, 0x2d54e0a02f9ce024,
+	0x1cc735aae209c621, 0x7b5d4fb57ae8d9a, 0x92a30264bad88a88, 0x230e493a3fd53a70,
+	0x33cdbf8bbdcd6a52, 0xfb51273526a81d63, 0x3ec188ad249967a8, 0x6ff9b903d8de66f5,
+	0xa9b80a17d5289a7a, 0x8a4ed591a2fb0951, 0x27544e310856cb5a, 0xd5ba1be68b21a9f1,
+	0x34471335add3f284, 0xe932ed7ef9b6b784, 0xe4578cbc5391f176, 0xe6ba25a429d57ae0,
+	0x1ecca6d30b156aa, 0x312b5099a555ada9, 0x6235b86aeea80262, 0x686c1b7171b677d6,
+	0x4fdaa0dae7bb55ce, 0x8407bf76f1400f4d, 0x6f1f67d00c9e163c, 0x24c08d74b9768fbc,
+	0x15f51364d807c967, 0x8f105c5df2b51ae3, 0xe31cd63f46e56088, 0xb557e696bd5f6735,
+	0x3de8f9ccfcce62b7, 0x2a9022816554eb33, 0x61adf5b007ae989f, 0x18ada558e6caa71e,
+	0x8a0c17b881dd573f, 0x879ed63bae2795d1, 0x7a067f1cc4793768, 0x81c2196a9bbe6afd,
+	0x76cd7aabfc13efd3, 0x1aba9c537af70be3, 0x5bb4e6ed672e3865, 0x75e7f616d2151e1b,
+	0xa9fed67a7b8d15c3, 0x57bc3db6c3f0e9a6, 0x592c2b82d7f6733, 0x56d65cf0f2a03649,
+	0x10fade29a9919a3d, 0x45f59e42c82210ea, 0xe7c7f85fc1ba0a83, 0xbcb16891f5d42d48,
+	0xf9a5f596a5d49266, 0x886b796e65456a8d, 0xff85346dad57e3c7, 0x88a540e70f7d5d00,
+	0x5ec08d1cab73e88a, 0xced4f62f6f8736b5, 0x8c7a70953882acd0, 0x5af8bb755de9c7f3,
+	0x20b7edb08cbdc905, 0x9797eaddd97304d6, 0xc344e42cc191a4d0, 0xc69f71fc410145a1,
+	0x2715db6c3cb5a6b4, 0x1b8db12dbbd64245, 0x68fdc883bb81a501, 0xbe3d4e11e697316f,
+	0x5fe478129eb322f5, 0x1a48e6a8baa6b8ee, 0xf3b115fef190f63f, 0x7e6f6069b8d598c1,
+	0xc536d56996153a45, 0x62d5d47c8c81b871, 0x2ac8ee8fab73f757, 0xc484a469de8a4839,
+	0x7ee009f010d90e51, 0xf7a8791ea78a3db4, 0x57f8d0fa62da1f3b, 0xce161c4998b3b040,
+	0x3e3250d5aef23170, 0xb6b817eb7d78ad87, 0x5f10bfad385fc6c8, 0xc639c32d976f9a34,
+	0xb0ce1ff4647adcc5, 0xf577fabaa53a1baf, 0x28e8b87ab6f0a3ac, 0x9acefcdb3b4da555,
+	0x5623e4eb6c47fd4, 0x51f5ec9f88a6a646, 0x7de81235b86a469e, 0x680dea592da32705,
+	0xaef09b2218571e4b, 0x240b76271eef2df5, 0xfe889f9eb57f104c, 0xa76a0f0b73e15295,
+	0x1be746d23a04d9e0, 0xdee15b51bffcf564, 0x5d334a698af3f0e8, 0xf939697b76ba644f,
+	0x6bfd760496c7fb57, 0x19bd1ed325fbc98, 0x38c819e663588655, 0x92ce25b13675c5f5,
+	0x833ac609c96aa744, 0xb3420bf5b1e2f2df, 0x2a09d03cdd2a38c7, 0xf21ccf34f107afe7,
+	0xa219a52235f5e6d, 0x6e87595112e44a2c, 0x4bc04f7aa5bf6e0f, 0x79c9ca30b6508392,
+	0x958ceee76f1c4da6, 0x8ed35338c833b021, 0x92f8dbaac5f1806b, 0xc9b9000be0c66665,
+	0xee055f759d3f19c7, 0xccf2225914eada5a, 0xe0153a2483f932c4, 0xc63e33b7a6f1677a,
+	0x17580c9f0ba901f8, 0x75772596a26090, 0x16d4abfc4200ff63, 0x53f901f7dbcc57e5,
+	0xd9bff07a07bd7dae, 0x5066acf5f027f26a, 0x90dc468ed18d691b, 0x2ae25969aff5f94f,
+	0x47d8de076956e696, 0x2c42eedd2abf3d38, 0xd736f2e9da51176a, 0x4ffc393e18e50add,
+	0xa3bef16b7c275fe9, 0x3ba65b2a5d9678ae, 0x303da421e3db30a7, 0x88e7f4951ea78e42,
+	0xa71dfc0e4da6490a, 0x8a5fe3ebfcf61967, 0x4f5e71c76ff813d7, 0xf38363e0ad159d0f,
+	0x93c29ff3d8e7c96c, 0xe087f8c4e33367d4, 0xce520dab3bb5888b, 0x1fdbfd3873799cc5,
+	0xcffeaad7f8718243, 0x6b677fb0c45f179f, 0xdbd773553ee91a3b, 0xc123f19df8d54a8f,
+	0xb7b8b8b49bc3cfda, 0xc16911c6f36d736, 0x5f310e62c7f14ace, 0x2448e38937067c39,
+	0xf227073f3f281fb6, 0xbac5ba9751e652fa, 0x63c4a049a559fbd4, 0x88585635e79f3e03,
+	0xad75d69c81cacd62, 0x3d0eba6fb19088cb, 0xabb2c50573c76c0d, 0x7a5f07f07d338885,
+	0xacb32de262ae8ceb, 0xbd3e05c3ca1d4368, 0x2309dfd1d22bea, 0x8c271afadc81312e,
+	0xbd628855b98f7088, 0xae2026c27c5cb3ea, 0xb2d31d57afa48e0, 0x1bcd87ef0f475bd1,
+	0xaec17d999f43d27c, 0x1f124fc3c5b5525b, 0xbf0c19badaeb892d, 0x15f40143f9197367,
+	0x8273e19035b27f9f, 0x5aa29415f7c1131c, 0xf0ea9af052fc9967, 0xfff41a7b31c5ba7d,
+	0xfcf4f7097fc09e00, 0x590556314ad9c8ab, 0xdf4953ec8110449, 0xe754392792a695a9,
+	0x7a57782e3ee17aaf, 0x5d37ca80f169aec9, 0x5f7f8fef0fefa346, 0x331a3fceb368b1ce,
+	0x4a6a682605484549, 0x8a024c9b06cd2800, 0xef3369fc0028fc28, 0x1a34a3005352fa41,
+	0x4004d485114006d, 0xa3f1a319004551d2, 0x14250d004a3fa4f0, 0x8a6694d400d084,
+	0x8d1f0540d18ca629, 0x358d1f00851f851f, 0x2935520014b5cfa8, 0x154e9ba2d904d0a6,
+	0x1780c26953343b40, 0x287d94368dbff43e, 0x9a1d80a2f0a36801, 0x93a20e404bab6950,
+	0x8dbff43e1780a234, 0xa4416901287d9436, 0x6a1a946607a028fc, 0xa2343745a903d0d2,
+	0x94368dbff43e1780, 0xa3f69505a402a7d, 0x5aa54d4b730128, 0x544dc2df69d3d272,
+	0x689b81ec26eccc63, 0xd4209e58439febe3, 0x453d70cbadd8b708, 0xfa88e5a331b8bc5e,
+	0xc4cdd4bf10974656, 0xaef4de1fe7e1ea9f, 0x87a6a6162d84ae87, 0xdf27c4c63ad2d6c,
+	0x10f7f204adf6f8ef, 0x92cb0847ade0f07e, 0xea18c7dd36b5dd4e, 0x3aea89aafc39e37a,
+	0x522bc6ebc1d86216, 0xe720b9dcf8ca2fdc, 0x2359679d9f9e27a8, 0xda6cad8fdf33db3c,
+	0xe9c03d47295fe6c0, 0x6a67760515592951, 0xc001b49333208893, 0x4d8a4f5bae19f5f7,
+	0xd8c4b2aaf3375043, 0xb7e6775cb7674b8d, 0xb410a5cadcb2403c, 0xab9515c75316ca05,
+	0x92cb0314ab56762c, 0x535f72cd1d76d041, 0x3e942f758dd79761, 0x2c57e13f4607eae8,
+	0xf4906e58f3232d11, 0xcd8f23c2a5a76acf, 0xd664bb584e0df87f, 0xf34cb3a41e72458b,
+	0xd6d66aaa9f35e736, 0xdb8bfb99643e215f, 0xb5cde351edb554eb, 0x58a8d21f16dc2ea7,
+	0x937a48f3cd7db959, 0x7f791dd62af7a6da, 0x8c6700ff3433747d, 0x21b24875fee044f4,
+	0xd7d4cffb9b3bd4fd, 0xda304b8c19e8a55b, 0xdab3947e72983b0f, 0x5abd911871f3f669,
+	0x8f485222f21b8cb4, 0xe53877b300ff45c1, 0xb2b8e86a2b7dbb9d, 0x2c55e9338ee5802c,
+	0xe9009e510025954a, 0x3725b45bab72765a, 0x54fae71f447ee41c, 0x6dc2ccd611a44bcb,
+	0xa4772d27c3fee09, 0x43af97ce2da44145, 0xfee98ab463126218, 0xe7e0b0115b100bd1,
+	0x2fb036236b51c5a1, 0xe530acfec3b15264, 0xdb86b5514a8fef89, 0xe06a9f47e03cadb9,
+	0xf02c56d466726d3c, 0x3362d3f7758d3fa3, 0x274ba99f37a7065c, 0x58381d598d15d86d,
+	0xab1c1d0e42d62de, 0x776876a1d3ee8f81, 0x27555148b2bbaab4, 0xfeebb6ac6ebb5a38,
+	0x46dba03479ea38ad, 0x23e3aaaa9094a498, 0xc5f21fc62ea57fcd, 0x761a9eca4ee3fd57,
+	0x9763f18e114656f, 0x16825b927254eb5b, 0xc1e900b2113e5e42, 0xeeac4272d66910aa,
+	0xaa68bdfe0fd8cdc8, 0x9e1117c21ceed394, 0x1c48ea59eb8fd787, 0x352dec8ef793b266,
+	0x2ef7131a6d04bd28, 0x681395fe08bc7fd4, 0xaa37fa339cb7fb3, 0x4d9e8d047a87bdb1,
+	0x520a7dd0eadfc81c, 0x6b84f94cfe93769, 0x5b337a9f746bc9ab, 0x5f2a7dc480e3ca11,
+	0xbcbe193d00ff4db4, 0xf639838497cc7ed1, 0x9ecc34f2db588749, 0xdfc4f0f0e4f9d1f5,
+	0x5fb7de375bdc1454, 0xf6a89fdc27378dc1, 0x775d95d201a43e67, 0x7a649c9167b8eb02,
+	0x259f71b0b464b766, 0x36ab0a00ff39f6c1, 0x8c3360275e461b93, 0xa78487dd4a1999e,
+	0xfee9220c6e33359d, 0xc08ddfe427c9bfcf, 0x6993cb93b2a6e27b, 0xe498323cd1bc6ae8,
+	0x28ea302067a76518, 0x6f343fa772d11cdd, 0xee8397f8a7421231, 0xb1f82e9bb66a1529,
+	0x34f4b965ac28aede, 0xee3100ab45539c1a, 0x4b557accfb4bcb2a, 0xfa891b2356915762,
+	0x8ad4f5ec69682955, 0x9692919aa09a2647, 0x86a418d3d9ddac34, 0x31d2e720c8f1428,
+	0xb08aa36e006fb90a, 0xed978d1ccded71d6, 0x39171a8deb39b323, 0x9c789136a51a8a89,
+	0xd60ec9d2d51ed7a6, 0x79d18ce929636ac0, 0x9fb535b570601923, 0x197a7fdcbd35cb91,
+	0xfb7fdd0fce4c2a3f, 0xc6a4c8017752d7e4, 0x5cf68fb1cf1cad7a, 0x2b3bee217336c357,
+	0xdb88e77a4722557e, 0xa3a01f38188baef2, 0x2597a3226f8ede07, 0xbbfc769f0e8bd9bc,
+	0xcc4b6c1adc6afc84, 0xce0ffb36b4da5f8c, 0xe1a93ab534395086, 0x238de348fda5c328,
+	0x938334f953004518, 0x22906e3a52fbaa52, 0x7be412953e8fa6e2, 0x1149157520646a7d,
+	0x782afcb859aa0a29, 0x80ba7d8ac472cb6d, 0x169925aaf1f04b8, 0x45eb3d7420c8e58f,
+	0x778aec1d55c6d415, 0x57f58e71dafda8b2, 0xd7488a93819da5f1, 0xd5d99d94d57efe71,
+	0x39404f9e313a6405, 0xc31056aaf9b953e, 0xd4d423fb2fdc0e18, 0x3ce7d50ec1f2cdba,
+	0x813dde366bac8e22, 0xffa789f340d9fa5, 0xff58e6e4d98d704a, 0xc03fef07671f6500,
+	0xe3b332e4301c218e, 0x666589119ae46e71, 0x8455737baa60f7c6, 0x49a7a9f283ca89b1,
+	0xa32b72404fbb4c24, 0xad1674eaab09f3a1, 0xd2e438d98a4abc0d, 0xce357e80ac23ecb5,
+	0x8087d2a4fe1c8b29, 0x999fbdacb83d551e, 0x8b86312ac6e9aced, 0xffb8addabe01fecf,
+	0x7f537d00ffcb9600, 0x6be827b5fcc76db6, 0x5f0a3fda7484cf0b, 0xc85db39f8a3fc6b5,
+	0x661d6d14ed597596, 0x581bd314fd5c702c, 0x31d604fcb772a407, 0xe858fba4f2c74ebc,
+	0xff8c668fc21f03, 0x3fabed1a6b2ff1b5, 0x9a1c35fee9bffbfc, 0x9d15b90f12d68bc4,
+	0x1aa21f32ec7ecae7, 0x63dee3bf91ba458e, 0xd2fe492447c3fd91, 0x36b936bbc86fcbc6,
+	0x6fbbe63a363c02d6, 0xaf5c22f0e8f0c60c, 0x9ed7bc8e7148b0fa, 0x95911c43dcc2952d,
+	0x5eef39e370033832, 0x8f6a53750b1b6f9b, 0x96a4b84a7f3cd681, 0x577bad6abd222687,
+	0xfb37d87e3f56f6b0, 0x84adc62ba6f09f51, 0xad42378ac33de39d, 0x8e00ff84de42f38d,
+	0x8f32340bbfd2ea29, 0x2471ce34fee31f47, 0xeb746f8ea2f96557, 0xa06f837be38935fe,
+	0xb2aad2bcd1bc70f9, 0x64b616e69f007537, 0xda00ff48da5e0640, 0x6b79fce75a7fe48c,
+	0x435cc32c380ba87f, 0x3110b3364692b31a, 0x19a73476e8fc28f9, 0xe57364e5d48256ca,
+	0xf4b80bb790662419, 0xe5d743de7ce1a8f7, 0x6e5ffde149afe6c0, 0x2c477bd67be0dc5a,
+	0x787d555c81cab17, 0x24b44a57637553eb, 0x7a3bd9dfabd38a7, 0x99aaf3c7f23832d2,
+	0x326ed12511d05ecd, 0x3c3843d51ec9e87e, 0xb78caa3eb2a5ac74, 0x79325659e9a77202,
+	0x750c0bdce16fe11a, 0xfc3456e018b5e619, 0x7d3fe82a02efdf6a, 0x71cffc14bdb2191c,
+	0xf9f64e2d2da89cf0, 0xf5a908fddd881f4f, 0xa585a80a698e549b, 0xdf979fdb6776b27c,
+	0xdac4dc1e7eb1d28f, 0xe8e386657b9bb10d, 0x5acbae01e8233841, 0x19606e0255896485,
+	0xfcf9fc38800141b2, 0x359e5a9fcf6859eb, 0x4917c4faecd38af1, 0xdc95cb2f1c9a161b,
+	0x4bbf3ffc64ad7f0e, 0x582e4f8265a7614d, 0x380e7f2b1cdc2ce4, 0x1217d68d4fbbdeef,
+	0x662d5264fede66f8, 0x24fe1c23409ecb0a, 0x26cff6637e789e57, 0x328031633643b669,
+	0x8748ebf43839aec3, 0xd90f7f9decc7f5b9, 0x350e2528d440666, 0x1717ee15febb1bf7,
+	0x9a4f5ec18a08f76a, 0x3fbed2ed18867130, 0x6df9fb34507c9cfd, 0x1cdbf96e928c9559,
+	0xe7ad157fae3088e, 0x9dbfedc8923d6fbf, 0x833e7b1fe72041a1, 0x373f3b426e89aef5,
+	0x8d48257586548ef7, 0xf83daff4c7b1c749, 0x471bda6b0f4fe0c1, 0x80342d19371c6363,
+	0x7f4fc6f1fec9916e, 0xee9ad3cc9fb6bace, 0x8842f8663cbdfd1, 0x9e493fabfcf7dc73,
+	0x52368a45c87ddfe2, 0x7862c891bf030062, 0x832fe2a77c3652e9, 0xb324624612eab177,
+	0x8fbbc61ee30a0867, 0x98b000ff0d00ff84, 0xb9ddce28b34a2c49, 0xb63cfb56b3bdda27,
+	0x985932daafa7cbce, 0xacf6b8039cf7fe2a, 0xeccc721b7bd66acd, 0xbe727d62c1211838,
+	0xfc6749911765a9f, 0x7d7b3080ad8cc8dd, 0x94190a64bb37946a, 0x50836a5fcf1000ff,
+	0xceb15c8e3423619e, 0xa7cd7c483c2b7243, 0xca8e4dacf93463d4, 0xa06af78714db50cf,
+	0x3754f847fd7aea0d, 0x3e37b3aa76198913, 0xefd1c78aed089e6a, 0x20e5aed1cab0ce37,
+	0x3f91555cbd471d39, 0x9cba01e345bc9f7a, 0x918b45a46c9d1f75, 0x73d898241473b4dd,
+	0x79b2766aaaa78aed, 0x87e178e54422e3b6, 0xedbb4a994486a5a0, 0x1ba075b0e248706c,
+	0xcd39e3946f102b52, 0x71eb6a2b8b15f455, 0xd8e95f520618aa0c, 0x9dad7cb2ca53a653,
+	0x82a7bf2abf7d1dc3, 0x192f90e536c511d6, 0x3824361b439334f4, 0x48899b15b723c1c1,
+	0xd4c3fe175e8a1ff1, 0xda31ddb01fa2ed05, 0x3bfd76fd5400ff00, 0x6de20d7dcd49e48a,
+	0x57d4db3409db1b3a, 0x5e91eed70fda6586, 0xe5d547e32e4de20f, 0x9dfd2867f904b8b1,
+	0x34934651b459117b, 0xa4f0a3280a80a299, 0xa4f483de67d2f801, 0x94003493064501a6,
+	0x40511425004d4851, 0xe147e147e347e307, 0xa91180a228690840, 0xa2194d530014cd28,
+	0xa3f0a3f1a3f0a80, 0x92d2b7d290c64f00, 0x4601d0a641330a80, 0xaa288a9a00da3468,
+	0x7a0a541d3a0d401, 0xa3f13b002d0d4851, 0xa80c25f4a1fa4f1, 0x1a946607a0286950,
+	0x28cda4a803d0d26a, 0xa54de32fbdcf05a0, 0xa028fc285a004a1f, 0xb30350386d8a6607,
+	0xe3477301289c3645, 0x28fc289a1d204549, 0x88cf97d41e0028fc, 0xe3f2eed23ac66bc4,
+	0xb737aaf581839e32, 0x364e6f4d8e554624, 0x4f2bb18eb25a2257, 0xa535e39086338a20,
+	0xf67db49fb61d41a7, 0x7ebe8e4e567a2423, 0xb235c151ede0f2a0, 0x4795c844abf41c09,
+	0x4352edeb73eac9ee, 0xadc7789257805c29, 0x73a748e3a7071e43, 0x9cce464c93e7768c,
+	0x53b0b50b8169e481, 0xb35cafe2f4e72038, 0xfa04c32c336fb9ad, 0xab59f29d9eeafc76,
+	0xe0c83132dc702715, 0x49ac46dd7234abd4, 0xeb3d1d878e13cb65, 0xb34474b4b1bba39a,
+	0x81dafd14ab5a512c, 0x17e4c9b8d6db91b8, 0x7a1036238c71cfd7, 0x66b62c6a1a7fad28,
+	0xc7f4c2ece492c004, 0x307d01e10884c87a, 0xc2c1992572ac162a, 0x7c38da2975558b8e,
+	0x672c95be0e333fb4, 0xfb9d310f7217aab9, 0xf90ab7a1952836d1, 0xdbad6c39e6e64c6,
+	0x9fbb4812542bda1e, 0x37718b473fab3db0, 0x48b8ba5d8dbd0e12, 0xd07d9c0238656963,
+	0xce5266bbba5ce87a, 0x9a6ace15f47a54db, 0xdd1f799348700b9c, 0x2e84f4cdf5a51aaa,
+	0xac6d533c283c8fe5, 0xb2629ba6c0217377, 0x27c5a7df8734eb48, 0x5fe8d5f9f31fd4f7,
+	0x16c8e9a9c29f716b, 0xca2afd40151d24c6, 0x196f28cdb877a9f5, 0x4edcab22f5099057,
+	0x312ddf10ea3d8959, 0xeb2a561a9b5c6a8e, 0x9aa267b28c551e77, 0x35e67d00765621e3,
+	0xff106b967dc2f8d0, 0xe6f37aba588d9600, 0xa93af24aca4aa767, 0x7895361d72d3d94b,
+	0x68d65656ef7110dd, 0xc839f1c728b20fd4, 0xb7d8ce5f9ac56afd, 0x6bcdfc784e9e5bf3,
+	0x21a4e64384f8a543, 0x8931d69a61c019d7, 0x78be30bb93923acf, 0xffc5fd53e11ec6,
+	0x3e698ebf8da852f5, 0x7952cc89fbd5e49f, 0x426970dd1f5bd677, 0x8dd16734dc103fc1,
+	0xf62f94bbb998bd1c, 0x30eade755530a4c7, 0x6a2dbc9e95fef1c7, 0xd2171bc25cd10eb,
+	0xf5634caf0727b1e5, 0xaeb807c370a4bdac, 0xc33d7b4bb87a6e69, 0x48ed4c0a94966214,
+	0x4aaa3d2e45a1704a, 0x95c28f665c1a3f48, 0x547935afd1212968, 0xabdaa36edd0fbe2d,
+	0xc7b9df0caba88746, 0xd7ca685713b468a5, 0xebe2f78bf9db37ed, 0xac2b8e331a2bee,
+	0xd499abb5f18c5c3c, 0xca39fcc5e3b5cdad, 0xce2c8ead0753519f, 0x485aa81f5d97d586,
+	0x3ad82db7c61e9c61, 0xf7e868ad9c3d57e4, 0xccd59cc61f5bfd23, 0x36b325b92447fcf2,
+	0xe34f70c05383e721, 0x3d4aab305cbcaafc, 0xb51ec6f7d871d6ba, 0x8a2dc1d8d492ba25,
+	0x5c090d7d7d806eb7, 0x12cd554058226972, 0x4680a8424059e49, 0x1bd10cbd56fb7bfd,
+	0xabf5491e8d9f6e29, 0xf64a792af053800a, 0xb837a7f4b9e8a9d, 0xd647dd48f156eb05,
+	0xec963c95d11e548e, 0x4d7157e7afe32868, 0x10397afd1f670093, 0x19537b542a52567b,
+	0x824a5f478e47db6a, 0x894bad8f1fc12b65, 0xf184a57adf4066a4, 0xf538cf589a233051,
+	0x15b4b5e86e36b3e2, 0xd5844d33b2f954a5, 0xd0a48ca9456b8688, 0xf28a5a3f381e91ad,
+	0x2ea9c9f5c860b761, 0x49628909d5e42a98, 0x51c4dd8dd36137a7, 0xdbda51176a51ebbb,
+	0xdc2da5af5fa75b92, 0x3e3930363b0b6fe9, 0x9069dfd43dd28695, 0xcdfd3de3ee4f2d0f,
+	0x3c2cc78e61766344, 0x314b4be8b027be2c, 0xb89f89fb61fd9fb9, 0x9387212cef4e1d2a,
+	0x5e4468dd2df47fc, 0xc36315b97d0c98da, 0xae3c39ca136679ba, 0xe8e6a3a8cdd67b7b,
+	0x3276af6ead8aa9d1, 0x479067f3759a43c7, 0x1f7e84d664a09dbb, 0xd16af58dbcf351b2,
+	0x67e6b1a2a0571be3, 0x6ff78ad070cb51d3, 0x94074c133d4ea9eb, 0xa6932e53e33ff127,
+	0xf500ffee1ff9960e, 0xcd743b901a2475ea, 0x17b463d4eadfcc1c, 0x318b07b04d5788dc,
+	0xf76c2c950a7c00ff, 0xff1d00ff43b67c, 0x9ad4034d8e2f9b0a, 0x8a765a8b640b9203,
+	0xbb7b1ec35b022c97, 0x5e0ebf68d595feed, 0x73d30761ecef05f7, 0x7d038f37d672857f,
+	0x55ae3159c7662bee, 0xc25ca9fcdba9fbca, 0xcf34eed8852faba4, 0x4f203e37285b1a84,
+	0xc22f6ab5d4df76a4, 0x4879568da0460b3f, 0xc769877e5014ab3c, 0x1b25eeaa781a5ceb,
+	0x754345fd730f376e, 0xef3f3813b8bd4be3, 0x8bf665da7f39e653, 0x490b8de12f3c1cdf,
+	0x6a5cdfd305d3e3d2, 0xb1aadd9fba723400, 0x8fb9e6ed8c1c6d24, 0xfe5f3f74defc2adc,
+	0xe2b3c6d5daeb66bd, 0x3bba651f6eae289b, 0x8dd64a7fe0e439af, 0x8fe0e861b54b189f,
+	0x73c6c3a3f0e3adf1, 0xb8720742f5a4667b, 0xc5fa7f90f475944b, 0x11eb61a0fd7ec226,
+	0xadf78d24730a00ff, 0xdba8a13f22de9323, 0xb500ff0bcfe446c8, 0x951810e54c71e8cf,
+	0x5a6e357a0bc993b0, 0x3d365db345ebe2f8, 0xb96a3f8068bc4417, 0xce747a9ebbefdeb6,
+	0x67158c3453c70a3f, 0xacf3678cc378608a, 0x68937f4a6d9ee89b, 0x3a2b3d071d0518f3,
+	0x499d71ba32f5c88e, 0xd6407cdcd3916c39, 0xacc6a19b1e934faf, 0xb3d5c73332bd7c30,
+	0x11dc2a7348e3775e, 0x6b828c81182e47f3, 0x33b6cb483b8eb1ab, 0x662d19d1c4072b8e,
+	0x67cd519ff126ab07, 0xa774c269f57a6a19, 0x41db4d9a909fae08, 0xeea6695349af226f,
+	0xed43b56e6b5aaac9, 0x9de456b6a8b9256, 0xf42d5fea63cda3ae, 0xf5b1e2b16bd5fe6f,
+	0x3992345445c0fba1, 0x4c157ed133681d73, 0x3eda6f047edb8c64, 0xa3d70c7fcef123f0,
+	0x36725b9184a73142, 0xf9130084278f20d3, 0x7497ef3df019af75, 0x23390366645619a7,
+	0x4557bd667cc73823, 0x4695dc98254d82bb, 0xe779a1da0930da21, 0x56555d917f2497d1,
+	0xaba65aa9ab44cea7, 0x94d13c0b0e69dea3, 0xeea0738be8f1859, 0xa99b2691dbf04a3f,
+	0xb80a795be2c2b53d, 0x512df67afd1fa103, 0x70c3aec4ac4b9e, 0xc070a08e715d256e,
+	0x79fce55a9f013f82, 0x55b333f17f6adba1, 0x63e683d4786d9849, 0xcec59e908703c23,
+	0x9aed9fbba36fd1cd, 0x85c77bd7983be674, 0xf57aaf039563c452, 0xce8e59fb3efe868f,
+	0x3062094ee1264fea, 0xcaa4b5244df04adf, 0x18ea8d4a46e7a9cc, 0x307796748d3ff401,
+	0xe830a633acca65df, 0xccd252b4e2a007d8, 0xcbfc88677ad4c7ce, 0xfbb9ed4ee1ee8e5d,
+	0xe97bdcfed44adfde, 0x1de7e0d850449209, 0x97c647783b5f013a, 0xf24866aa6b8b649a,
+	0xd149af997e0eca36, 0x76dfad49612fb8f5, 0xba809e61ad6aeaee, 0x73ea00e8a822699c,
+	0xdbb80badd6afcf93, 0xb198945518325736, 0xad3b36aec97982c2, 0xa6563acef5dcdef8,
+	0x4dc1c55d2369e6a4, 0xc545e50f3a5087c1, 0xde124c6a10694063, 0x3a015fa8b0e15249,
+	0x630d56ebcfb53ef5, 0xb18a8d66e6d026, 0x6b1badf4c17190e0, 0x894db64911baa49b,
+	0x6aceef51c7f407f2, 0xbabd57b2909d8dc5, 0xf259ac3672ae91b8, 0x9d236ef47e9f3cdb,
+	0x684df07a0ac1438a, 0x934abbf79b045ed9, 0x6b367db555630790, 0x6c164ec023f11949,
+	0xca97a0b3d6b74f61, 0x4dd849959e2b7970, 0x76c42b8e95dba31d, 0xa8e7293a5ddac9f2,
+	0xda1fc90c563c00ff, 0x8183429e33739199, 0xdb1aa19e2dd50ef8, 0x9ec712fe26be91aa,
+	0x4d5cd8396d6ae40f, 0xbdf90623bfd00636, 0x2097d6ba3da09f71, 0x63d06156b76511b3,
+	0xce0f999156bea8f2, 0xcc73c4f5cd6a704e, 0x2033ca0e4fbb32ca, 0xbcd0d7aaf591e4c0,
+	0x5f9fa3dcdac8ee30, 0x8b939719315ae74f, 0x5096db84c9b2bfbb, 0xe1a1f8956b7dfb3b,
+	0xbd79bc2dade9abf1, 0x7fdd41e640ca5db5, 0x4217f434f9bace4f, 0x15471dde4fda89e1,
+	0xe73ae4ab067a7591, 0x129e65b1de2ba104, 0x5b57b48e1c410c41, 0xb47fd4cffe4253f1,
+	0xfc512472b8215060, 0x1eb9ce9f23f2d72f, 0x1445431a3f40aabd, 0x280a80360d9a5100,
+	0xa0284a9a00a09934, 0x3fa4f0a3f1a3f103, 0x66025014250d004a, 0xd2342d004d48d190,
+	0xf851347e140025b5, 0x29fd945ad3f80150, 0x14006d1a34a30028, 0x4c511425004d4851,
+	0xa5f4411a3f1abf09, 0x454983528029fc, 0xea00b434681a943a, 0x4bef7301284a3329,
+	0x8a1680d24769d3f8, 0x40519a495107a028, 0xcf05a070da14cd0e, 0x4a1fa54de32fbd,
+	0xa95300a028fc285a, 0x196d5a9a1f8066b4, 0xaa9453d25c0a07a0, 0x49d3dcd3bb1f3ba3,
+	0x1ea7c41643761b7, 0x16d67be068b7c98c, 0xc0313782b3fb71a9, 0x3e4e1e43ded45fc5,
+	0xe84dfb748bacf86e, 0x4ae46dc5d80d0352, 0x7840b2cb53d1d8d8, 0xae9c61655ccdc9dd,
+	0x3da38a4e31a6f400, 0x20632c75b158a587, 0x599d3f00ff40ca7c, 0x4da50318653f5204,
+	0x8cdd1831e7c78062, 0xba1ac9ba057a5f9f, 0x6abdfc519542ce4b, 0xca8c3002d7223e5d,
+	0xcb9815a8aeb2b0f, 0x3c03c8783602630c, 0x26159d50855f7e64, 0x5be79f362aeeb795,
+	0x38372bc285eff096, 0xfce71a7bbc8ee7c2, 0x24145cd368da2a59, 0x736f5c2bcf0b29cd,
+	0xff0617eacba1a3, 0xad5f3ec43187625e, 0x9886ae2a7dd1cd4c, 0x1ca7e2d8d5937bb5,
+	0x24f99c6488bd8af3, 0xd46800ffcc58f1fa, 0xdbeeb5b653dd4719, 0x8d35a9ee4f5ed3ca,
+	0xa326e77adc96f1e1, 0x11c6c2a137b21779, 0x58a619cbba59017a, 0x478cf2105aedc0f3,
+	0xba7fcc97444666a5, 0x24b0636257cb2970, 0xe9c8562a3f8e910a, 0x48b4c246c573cc53,
+	0x7400ff748bd77293, 0x94fa07474d952a7f, 0xd1b259b3537400ff, 0x5545730636b26926,
+	0x66d093b3db1027d5, 0xfab45d14af3963b3, 0xbf7a0fe0ecbc968f, 0xaf17f7df5507d9a1,
+	0x19a97373ecb046fb, 0x2b22849d5d2d760f, 0xa31ea16a8ee41875, 0x64372b64b949d9c,
+	0xabadc0610792e5d1, 0x3d1491c462dd7a7d, 0x27774c30d273ad87, 0x3fb965cba8a6f5a0,
+	0x375339626b52b4ca, 0x2592945aad672175, 0x7a70ade375373c07, 0x3bf16a495f595394,
+	0xd2733dc611fe19c9, 0x7242d186343ecdbb, 0x1aad117f58936458, 0x3784ad7f1879eb0b,
+	0xa4ac4200ff2340e0, 0xf3246f939195c6ee, 0xaf7c5cec1ac38042, 0x8b5b3d6c7f57a92,
+	0xb81eab328a592ed9, 0x864b2ab29fcb8be2, 0xbdb25e0d0e8e983b, 0x723e88807712f682,
+	0xd09b1b276afdfce9, 0x63340733f6cae9ac, 0xe7183b239bbeafde, 0xe207ae1c0ae26fb7,
+	0xd9728b715ea7332a, 0xf64c8b55fe86b0e9, 0x347e2b125f9b5a63, 0x7462eb3f34419354,
+	0x5201a6f347c88de7, 0xa51845394515b56e, 0xa578cc45bb450b5a, 0x9d62a3250d827691,
+	0x4b48394d2b5ed974, 0x558d1ee4808421de, 0x3fcaf95ae769453c, 0x58bd7700ffde0f79,
+	0x1e79bd6dc46a9e1c, 0xab712ad5a95f59cd, 0xc546a790335b4e07, 0x36b35a67959e3258,
+	0xfa87f2dbfd288497, 0x53c75bebe9c86855, 0x74cb38aa54426ae5, 0xa9b51e6289b3696f,
+	0xd3956bfdd8302618, 0x34e99a2bd74d30e7, 0xc98ac3e869d7d5c9, 0x9f569578f0f7ccc6,
+	0xb99ae9cd07b5279a, 0x3397ed55dbb80033, 0x14f4b1f768a70631, 0x9995c89594ebd0d2,
+	0xab2a656ab6e3008f, 0x2951158a3b5e06f3, 0x24f5125b356d9024, 0x83f9a69100ff1e67,
+	0x79a6c0a1270dd4d4, 0x3c9628c53c35e79f, 0x829ef31b64a1f5d5, 0x8a391a4c82346eab,
+	0xd2f9e1fdab792ee5, 0xa84acff46179aeab, 0x929b773a00ff7ab2, 0xd3429e98a3a91f14,
+	0x929ccb4645f8d711, 0x4a87df60234a0f3f, 0x84626f72ab568094, 0x447635084cd48c89,
+	0x59eb489956a50f24, 0xe29773fb90101dc9, 0x29d9a8e6e5532db4, 0x5b4875da56ed7823,
+	0x6e973a233aaa0607, 0x171eb449c3f982c8, 0x71ce4222cc33aaf5, 0x70621930714bedeb,
+	0x1260f3d74c5c6205, 0x99b945ddfef3d02d, 0x10fbfcd470548c18, 0x271d5db784d53ea,
+	0x855c52d4b871329e, 0x53e9196360646a8f, 0x3d36b4c5120f6a, 0xf6a97bb54f5395fe,
+	0x8f44db1af3837680, 0x1acb76af22a66e98, 0xa032c8e64f5d9b35, 0xc01e43d068ba66fe,
+	0xf096c0d951edef39, 0x499d3f503e0e142e, 0xe9cfadc495893d7, 0x9e72d4eb767a3816,
+	0xf0a7fc9c2a250d69, 0x3a902a3528ae3ba9, 0x39a927d024a538d4, 0xa74d938c1ad29896,
+	0x2bf1d4483ca47271, 0x4c23911d5234d47a, 0x6a4853b79831bde7, 0xe321c984b784ab1b,
+	0x2718a54c6aa1f5b0, 0xe7e2cf0c6842a227, 0xe2d675fcc536c8d8, 0x3332de93e1ace146,
+	0x3483876a908e00ff, 0xe0d5bd53db78320d, 0x1133e6cb368e91b1, 0x7ff2d6fa5355e18f,
+	0xbe52e396486c29c2, 0xc4e24f85258aa023, 0x3e928d5a5774fc9f, 0xac2e29ad5451112f,
+	0x5b884bd6b6b2cdcc, 0x3643a522f0d3ddb8, 0x447600ff32e892df, 0x4a5a5edb6a45fc23,
+	0xfbb96eb4f02cf1df, 0xc10efa00ff2e77f7, 0xe9d93c1a8927495a, 0xfed8484bb023247a,
+	0xce8599ca55e79f6f, 0x80cfe6a670ad1d56, 0xd28fc38f533e25c3, 0x12b390cc5d3792a2,
+	0x996df1554fddad49, 0x1d63afb37f4900ff, 0xcdcbac5581bf48ac, 0x347f75c384bb5767,
+	0x51e9c878ac9d93d1, 0x3a131f46e796712a, 0x99bcd22ca6b6e537, 0x70575d8cb7aaf227,
+	0x47e1cc5795d08aed, 0x411edba3d454cdcd, 0xc3a68f9dd5cc35e7, 0xa681a94bc6488dd6,
+	0xffcacdf37fbc917c, 0x3cae6a46aeca9f00, 0x9a3ad5b0d96146bd, 0xf89bd3c761f4da6,
+	0x3cadf1970fac9715, 0x73c7694677510dd5, 0xc3768d0a2e6623c, 0x57e4f2cf186c089b,
+	0x801c63dd554778a8, 0x2c6f2fe721de8e6e, 0x3ec683e37a0aa71d, 0xec4d31e52cc86bf6,
+	0x356ca8a6f0aa6bdd, 0x327018803233e618, 0x76bd839e71e41839, 0xd446cfe8693e507c,
+	0x3d92d58e55bae6ed, 0x5074009793b678b8, 0xe67a0f0e7de02078, 0x7736c592aca4f7ad,
+	0x61998efa8ceb0aee, 0xb13c7649d1f56e9f, 0xa32857d6c60d4333, 0xc4500fdc3801c669,
+	0x443ea4d59d2aecf5, 0x1bc70aaed178c331, 0x91033100410e6221, 0x9f7532caac187e8c,
+	0xd6ca36d78aebda0f, 0xd38f1bb70d4001f7, 0x32bd7bf61b57fafa, 0x71b8634562ca0543,
+	0xca1ccf6e895eed86, 0x280a517edb4ab78a, 0x4d6acff16ced7b0e, 0xdb5e5bd4feded25a,
+	0xe49e61dd77e7ecaa, 0x275d189a325d2fa, 0xb691c8fce19efdd1, 0x500fedadf440dd82,
+	0x24691e7d9a6ed3ba, 0x1b2b6e0746673e8d, 0x920868816c2ed15d, 0x87eafdd301123816,
+	0xedb6e166065b334c, 0x3699946ae8311e20, 0x7ed5b32e9ec26f3d, 0x1fc728cfb9cb9b59,
+	0x391f63ee5dba7695, 0x20f5e719e039c6c, 0x1928734caa04ccda, 0x397ce95aafcfc1db,
+	0xd2e03b9235ddbbe2, 0x7a00ff76946da4c6, 0x5a726fcd1eb047ab, 0x472ecb7ff32f34ea,
+	0x189aa5456d5d4de4, 0x8c36449cd8687e51, 0x41a98bae5cf3d8e3, 0xbc8fabc389936279,
+	0x4764b65a318e030f, 0x88db9d4251a1ddfb, 0xdf08f4de1ea78e32, 0xdcc4f72453c2fa96,
+	0x8371c847b171e146, 0x5098f5cd5cf31cc7, 0xaf0346aff14d8a65, 0x7a4b1037ebaed6b7,
+	0x46dbdc88388242b2, 0xfdbd9a14c73f7617, 0x50441a89403ee9b2, 0xa723e7495e499523,
+	0x5d848966331627a, 0x7395e6567bf3e947, 0xeef2f3a14285d91a, 0xc41a00ffa1b7d7e9,
+	0x95112e70dae28ebe, 0xf2bea51370c4399, 0xdac50d5a69b35ac6, 0xd57b7a707295b149,
+	0xd3591bed5c4d5829, 0xdfca515cfbc8eb56, 0xe9cfe567841e3332, 0xe9f82c97199ea357,
+	0x5e17cbd7dc773f85, 0x282bc79891b9bb3a, 0x6a47b21d8f9bb46c, 0x2f8f5b379e844ff5,
+	0xbb243f8fce97bc4e, 0xd4d4a84aafa31ef9, 0xf02b0bdb87a8274e, 0xd94756fad47124b8,
+	0x9e24c1b96e4d4d61, 0x727db93a00ffd0e3, 0xfa3b9e93c762170e, 0xa7678ca377e17d55,
+	0x3e0de39d512255e3, 0xe4683e19924ff7de, 0xdea871e3bcaae4d, 0x4ba99b3663b5b678,
+	0x301c1b6ea3f93867, 0xdbfcb1ee15b147ec, 0xaef6f78ce4156ca3, 0xf4add8e683d6e227,
+	0xe947cbed812d992b, 0xa499d4e6515273f8, 0x28a9a199142015cd, 0x1a3f000a3f8aa200,
+	0xa40d314fed2fb4c, 0x1ad20c8026a42869, 0x14cd689a02a028, 0x150f851f8d1f851,
+	0xa0a4f483de67d2f8, 0x455100b469d08c02, 0xc014454913003421, 0xd829fc28fc68fc28,
+	0x3b004549e32f0509, 0xa0f0a3f0a3f1a3f1, 0xa0d401284a1a9402, 0x6d8a6607a0a541d3,
+	0xa6f197dee7025038, 0x147e142d00a58fd2, 0x1289c3645b30350, 0x4be10034a34d4b73,
+	0xa368fc0e4051d2f8, 0x92e65200a0f0a3f0, 0xec8291be5775008a, 0x884092a5e63a0e50,
+	0x3d49ceb9abacf658, 0xf51599d435a535cf, 0xa7001eef1fdcbf8b, 0x31ba7f49b6315e78,
+	0x8be93cc9cbacf7f8, 0x50d0dd7a0fbcba8f, 0x4ee74f92bb879626, 0x6f5642cb614f22e,
+	0xea76a3674434a49e, 0xd25cdfc673589b29, 0x30bb0559bd23c729, 0x7d2ae754700c20ef,
+	0x86ba7563ad56713a, 0x2438c86ee6cbda65, 0x9edcc2df9867567a, 0x2aa8b3c0dcfd59c,
+	0xe419bf61e657b5ef, 0xe79662cb293df574, 0x86b392da12c9a577, 0xc7ed3940e02e77de,
+	0x1e89c4d7790d1da1, 0x1512f2721322584b, 0x42e667d7f9eb837b, 0x5bf787d5f2226921,
+	0xfec9b5ce2b521fef, 0xc91456365468e2dd, 0xd8d4c7f5fa7f6ecf, 0x57f803146b4354b0,
+	0x6e9a9cfb48348f9a, 0x64d0ed74fd40446b, 0xacfe3fbcb2e2ec3f, 0x833ee9e133bcaed6,
+	0x382bdcd88036d6f9, 0x4bfccff88d3d65fc, 0xb9739c4ed6ee7fe4, 0x475396f9cc566bbd,
+	0xf7270b3ea78d15df, 0x6523b7d085f6a749, 0x9c42cd3792698ca9, 0xb5fb4d049d44b7e2,
+	0x5fe5670435f5d41e, 0x6021d13259ad48a5, 0x4c6d5bb7c5036b06, 0x553075ad15c7f260,
+	0xe09229453ce54a3f, 0xbcf025c3deacf40c, 0xfa011300ffa4cc40, 0x414fea1805235dd7,
+	0x8fa211774c8e9e5c, 0x392e4a5df3fc0598, 0xd8ee4474d5dc2d27, 0x7d0e2a35c9530faa,
+	0xe68190d4e01823e9, 0x8d45e4880da0f664, 0x3f571c3f50e52700, 0x492c63adc9bce9e3,
+	0xb5ca1fc0414f3d44, 0xadc65ce939174056, 0x76507e706675db3f, 0x71a9d097faaca08f,
+	0x253883146fcf1c6f, 0x5128029227124bb1, 0x6629fcd7e901bc34, 0xe32c00ff419ebd3f,
+	0x249f4ab3febf3eda, 0xffb18861f783b1, 0x41cc32df1c03853f, 0xd4d01f871f23eefb,
+	0xab00ff949164b98d, 0x3bb80d35f9af0f4c, 0xe3cfbf5d728ed06d, 0xae00ff2087162b52,
+	0x9805a43800fff497, 0x58f848d0488eb827, 0xe278873ba2311ccb, 0x6a7c2787b4134512,
+	0xec2c00ff4c54ccdf, 0x52a5c63fe82f423d, 0x98ac3417457b3eab, 0x1991b32189d99ad4,
+	0xcbd2ae36993ccade, 0xd2ddf46d9ce2d8df, 0x475939d7f2758a06, 0x1c1358018da4b8a7,
+	0xff8d0c83b2d25892, 0x853f00ffc0243d00, 0x76b4228e35f6582e, 0xe68e200bad6c1593,
+	0x14f5378c86332e54, 0xf9e84b6e90e5eccf, 0x64a566f9c3c80d6c, 0xd6071ee7f97f6702,
+	0x58d0fd4ca0f9e288, 0x485d57c7b146e5d2, 0x36697bb22d9f485f, 0x44b1d000ffb8c475,
+	0x4377235f6eea7d3a, 0xe67c53033f6e7585, 0xff33fd25ebbf0e, 0xabfbdff93eb3a7d6,
+	0x8d669f7afd5f7eb4, 0x9e3acaa45b569ae3, 0x326b4be567757391, 0xdcc7357896b7b19e,
+	0x53c72e53345cf0c4, 0xa3498641af74a482, 0xd2e0e4c26557149a, 0x7f46f2fedbc3d5b5,
+	0x8cd3fb7b8e614c32, 0xe3a4452cc58b636c, 0xedc8e57d9fa72e69, 0xd86e842dcf9bb457,
+	0x99491af264ec8ae7, 0x43b7ee0c225cedec, 0x92e95852545c8f93, 0x2519966b972e29b4,
+	0xc65c6d8a04fd4f41, 0xca5a28329752698d, 0xf968bde7f659401a, 0x32053d0cb86c9425,
+	0x46592d2562394d3b, 0x6a3200ff5889abfd, 0x81db2e232bf676c4, 0xa776fc8f83c473b5,
+	0xf495268d59d8a395, 0xf9a2e67b95226965, 0xc423528bfc5751c7, 0xa00ff06c4feaed3,
+	0xe567174652445b63, 0x13278dfcf5d07c24, 0x1665f09b3f14e658, 0x16b4e2a09ce29c0d,
+	0x3c573ee682cd3cc9, 0xaa42b2235a9f1fa1, 0xffcf07700c836bdf, 0x1fd4eb2fe5d2c400,
+	0x1b518a8cc37646da, 0xa089f23ed8a7567a, 0x7f2a3f8e0df07e3b, 0xf340c6230638dbd8,
+	0x97727d10b96afc57, 0xa139e7a8941923f3, 0x162cb265adb87e63, 0xebd53c0ae7f6f267,
+	0x72b16141c6fed3f9, 0xfe2047e3bf0e27a3, 0xaabdc81432ba4fb9, 0x89567a2a08409e45,
+	0xe6d3dd796cb771b7, 0x11ab32c998d69f53, 0xba2d4761b8de4e66, 0xed4f79dfbe69d687,
+	0x19cadc50e9a73a0c, 0xb3c4b6f856d9557a, 0xe325fb56458e8ce4, 0x60a0e732b32dc9ba,
+	0xebded32aa4b1652a, 0xb8e5d8e547b044ef, 0x91b8334edea826cf, 0x7c5caae977ab74b4,
+	0xfc08118eb1da649f, 0x77b566dab758f3fa, 0xe3fd58381e2dc622, 0x2a43cb69d2faf322,
+	0x22bf7be5a274ca98, 0xdbc6e4cd5ec3d595, 0xc8dc52ef6fe60761, 0x5f051d005085f0b6,
+	0xf8ec58168653175d, 0xb7aace3f13f3a88f, 0x886c0f858bcbf586, 0x55e87f3ce25af01c,
+	0xd33aab55cf4756a2, 0x2e6f3986cbd493e6, 0x9bf4e90afafa3ab0, 0xcd8ff211f7aded18,
+	0x27b4253f7cd25a8d, 0x7f2633313f6d8870, 0x11579bc4d9b5c9d, 0xa81897f3281f5781,
+	0xbc8242a782b56777, 0xb7bdcd9c51bdb9a6, 0x6ef6a9747595b41e, 0xff797f708e5b33,
+	0xa91c4a6400ffa7d6, 0xffedfb19c8b5ba, 0x61ae2f3db27cd6c4, 0xd04a9a40795fdbd7,
+	0xc3b66ddfaa6dcafe, 0xf62fedf81f1f7f1c, 0x9e513ed8f6cbde49, 0xb0d717921c857f03,
+	0x4be939e35c8acedf, 0xae5d15c8e9ea6a80, 0xb439c54340700ed3, 0x183965e30d787fe8,
+	0x1fb9aac700ff3987, 0x33f36f5f86611e62, 0x65f7cf827d6acd68, 0xd61f1871dd6d66ae,
+	0xb3dc2424e169b18f, 0xd2d0cf0394f9c021, 0xd7be0a53fb2772f6, 0x2efbd81a6bbacce0,
+	0xe4b20aeef2552698, 0x8a459e69d19f61e6, 0xde1f7c48ececbbc3, 0xed8fc8d94fe1471e,
+	0x5b564065dc9f377c, 0xe9099281775d258f, 0xddb2c4de31c39b57, 0xe20eaafba8db71ea,
+	0xad8d15cf9fa0f07d, 0xb74ce3c6eb595c5a, 0x7a1c5b2c80bb5266, 0xb6b835a6aa2b19a,
+	0xabaadce3a1a87c67, 0xf1f14830d68afcdf, 0xd635d18ef74a8559, 0xfabddd0531d9face,
+	0xc133fc64f24801af, 0x48a84fd6c25febfc, 0x5888b63b23596b1e, 0xa49ceeb2827ecc7c,
+	0xe0a47e1562de6f27, 0xb974992bf4ea3a7f, 0x2908588e46cede6d, 0x3574047704d63622,
+	0xfa96ea5d87f3d4a2, 0x7c7214ad72c3f074, 0xae741cfaa07ce0aa, 0x7913dc8e439f4faf,
+	0xfcedaaa51c30237b, 0x6d6cd6c00afa83cb, 0x8c92980749472b75, 0xcdd700ff130457b6,
+	0x97ef87cfe56d7a73, 0x738238577b66bf4f, 0x7a262b3429d5d8db, 0xda41b4b194d5c51d,
+	0x80f90b62ef477044, 0x228e06f18f6bfd48, 0xfdc7cb0bb86a71dd, 0xee946124ebc66c45,
+	0xa52778cc31a7c853, 0x7b1edb46c16d2e27, 0xdfda1e3338031a8, 0xdaebb1c4ca334d64,
+	0x4165668859176fba, 0xae94ab1d68a74af2, 0x4da7a932e8538b7a, 0xe85b3ed452eab7c7,
+	0xeafa7ff85329b39f, 0x1f47b709b01e3555, 0x36223ac5433fe3c0, 0xac966febd053ed75,
+	0x5219bb57cd25a397, 0xa70e141925d36c2a, 0x59ad1c2ed2181bbd, 0xf49e6ebf42dab9b1,
+	0xe88aaf8a6cfec8db, 0x69b27c6aed7cac84, 0xc8ae2d4d7c84df9d, 0xde0dd208c7889824,
+	0x82b8a3ec9ae0f658, 0xf986cb2a432b3265, 0x9fdfec00ff300f14, 0xa3e8d266bcc67f,
+	0xd95c1df4b726f1e7, 0xe58aedcee21dacfc, 0x6a957f7d8c8c7170, 0xdca347bb31aaa5e2,
+	0x24b234cf6a7b45da, 0x90fd5b1b9fefca6f, 0x6ed6a43a7ffc014e, 0x4299a1979b2c6357,
+	0xe77b1dcf3860f6b1, 0x53f95cd8ae6345ad, 0x17c8246d0057b4ab, 0x5af1f8833142c770,
+	0xc3da64b2bc91a33b, 0x4e9f7edd83b8930b, 0xbd3c5951ee21ab3d, 0x76e786c0c8aa4cd1,
+	0x69088bf6fa738d3d, 0xf48092dd05432c2e, 0x8a6d1602794557fa, 0x47323dc7a004391f,
+	0x930b6675e05dd64c, 0x628434971fb8fb9e, 0x8040562889ccdcdb, 0xdc1ed4076e5460a8,
+	0x2373cafc3ab59f55, 0x341539f5e507b990, 0x2b64152ab0dd31d6, 0x7def4615dfe3f5cb,
+	0x54c6881140b3caac, 0x74c4b49ee08ead7c, 0xdb1324ac2ed51d3e, 0xc4c61c13e1c6a9ca,
+	0x1df1109ee93576fb, 0x2a6c3e66226aa39e, 0x2beacfc9d8ca910c, 0xa9762caddfb34c5,
+	0xb6f6a735d7c7efab, 0xce96fbc984b85482, 0x975aada707603963, 0xbd1d4724b3784f72,
+	0x3a7d04ce1b9237da, 0x40dc9417466aaa66, 0xc215b84e3866bbbf, 0xfba51da9173d3ee9,
+	0xaf7f686353c4636d, 0xdaf263d545afaea1, 0x837f0e8590644406, 0xb46ef1f25e0353dc,
+	0xc63c154611054bc8, 0x29bee16ac773c55d, 0x4fd9ea6af8ddd269, 0xaef0d3c79eb6b1cd,
+	0x85b150f3245856a9, 0x41a99dd2a703e798, 0xe7580e508e80f515, 0xfe9247a0f4f5b127,
+	0xa4857a68107657cf, 0x8c65998899d342f0, 0x6b707b4e0140e81d, 0x35109fe95af2c217,
+	0xf62d771453072b2b, 0x637bf09c0b07c878, 0x6b5de069fc57e1a7, 0x8525eed0bda6d54d,
+	0xb5d7e1ae847d3967, 0x58df5a6de16bf857, 0xbb1190b901cf4dfb, 0xfd0b534d7bd7f77,
+	0xb1353fceee26b473, 0x68e03f6724ed2233, 0x637977c8d00c5796, 0x25368d45828a3b6e,
+	0x4a1f7a0e056d9cbb, 0x789e9bc7bd2b71af, 0x7b8b45aeadf7dc27, 0x14d74f73e8ddcbdb,
+	0xd2f73e0e0a6fa74d, 0xd92ebfbd3c7047ab, 0xd748c6c05383fa7a, 0xe507fcd890b37c2a,
+	0xfd9d76f119cf90d2, 0xf793a97f1249ac99, 0x65450efcf6d06391, 0xac15435b2dbeee1a,
+	0xb17daa528e16182c, 0x5180d4c215d600ff, 0x1a3f000a3f0a3f9a, 0x510094947ed0fb4c,
+	0x4851d20400cda441, 0x2a06846490d004d, 0x1380c28fc28fc68f, 0xa8092d23734a3f1,
+	0x84144501d0a64133, 0x51005514254d00d0, 0xf80150f851f8d1f8, 0xff032829fd945ad3,
+	0xd9,
+};
+}
+
+const AMD::EmbeddedAsset RubyTexture = {
+	RubyTextureData, 87777, 87777, AMD::EmbeddedAssetCompression::None
 };
@@ -1,90 +1,26 @@
-const char Shaders[] = 
-"#ifdef D3D12_SAMPLE_BASIC\n"
-"struct VertexShaderOutput\n"
-"{\n"
-"	float4 position : SV_POSITION;\n"
-"	float2 uv : TEXCOORD;\n"
-"};\n"
-"\n"
-"VertexShaderOutput VS_main(\n"
-"	float4 position : POSITION,\n"
-"	float2 uv : TEXCOORD)\n"
-"{\n"
-"	VertexShaderOutput output;\n"
-"\n"
-"	output.position = position;\n"
-"	output.uv = uv;\n"
-"\n"
-"	return output;\n"
-"}\n"
-"\n"
-"float4 PS_main (float4 position : SV_POSITION,\n"
-"				float2 uv : TEXCOORD) : SV_TARGET\n"
-"{\n"
-"	return float4(uv, 0, 1);\n"
-"}\n"
-"#elif D3D12_SAMPLE_CONSTANT_BUFFER\n"
-"cbuffer PerFrameConstants : register (b0)\n"
-"{\n"
-"	float4 scale;\n"
-"}\n"
-"\n"
-"struct VertexShaderOutput\n"
-"{\n"
-"	float4 position : SV_POSITION;\n"
-"	float2 uv : TEXCOORD;\n"
-"};\n"
-"\n"
-"VertexShaderOutput VS_main(\n"
-"	float4 position : POSITION,\n"
-"	float2 uv : TEXCOORD)\n"
-"{\n"
-"	VertexShaderOutput output;\n"
-"\n"
-"	output.position = position;\n"
-"	output.position.xy *= scale.x;\n"
-"	output.uv = uv;\n"
-"\n"
-"	return output;\n"
-"}\n"
-"\n"
-"float4 PS_main (float4 position : SV_POSITION,\n"
-"				float2 uv : TEXCOORD) : SV_TARGET\n"
-"{\n"
-"	return float4(uv, 0, 1);\n"
-"}\n"
-"#elif D3D12_SAMPLE_TEXTURE\n"
-"cbuffer PerFrameConstants : register (b0)\n"
-"{\n"
-"	float4 scale;\n"
-"}\n"
-"\n"
-"struct VertexShaderOutput\n"
-"{\n"
-"	float4 position : SV_POSITION;\n"
-"	float2 uv : TEXCOORD;\n"
-"};\n"
-"\n"
-"VertexShaderOutput VS_main(\n"
-"	float4 position : POSITION,\n"
-"	float2 uv : TEXCOORD)\n"
-"{\n"
-"	VertexShaderOutput output;\n"
-"\n"
-"	output.position = position;\n"
-"	output.position.xy *= scale.x;\n"
-"	output.uv = uv;\n"
-"\n"
-"	return output;\n"
-"}\n"
-"\n"
-"Texture2D<float4> anteruTexture : register(t0);\n"
-"SamplerState texureSampler      : register(s0);\n"
-"\n"
-"float4 PS_main (float4 position : SV_POSITION,\n"
-"				float2 uv : TEXCOORD) : SV_TARGET\n"
-"{\n"
-"	return anteruTexture.Sample (texureSampler, uv);\n"
-"}\n"
-"#endif\n"
-;
+// Generated by embedAsset.py from shaders.hlsl, do not edit
+#include "EmbeddedAsset.h"
+
+namespace {
+const std::uint64_t ShadersData [] = {
+	0x66656466692346f3, 0x535f323144334420, 0x41425f454c504d41, 0x757274730a434953,
+	0x6574726556207463, 0x4f72656461685378, 0xa7b0a7475707475, 0x203474616f6c6609,
+	0x6e6f697469736f70, 0x4f505f5653203a20, 0x203b4e4f49544953, 0x207675203206fe00,
+	0x4f4f43584554203a, 0xa0a3b7d0a3b4452, 0x6d5f535620930050, 0x57090037286e6961,
+	0x1d2c1300540400, 0xf008d291000540b, 0x4200aa6f11000053, 0x2e15000a090a0a3b,
+	0x3b1500b53d1500aa, 0x203d20767570001d, 0x74657272002f7675, 0x3b530036206e7275,
+	0x501200eb0a0a7d0a, 0x5001028202300a5, 0xa2c5200fb090051, 0xaa0c011e090909,
+	0x4752415460012402, 0x2006a0300b65445, 0x202c767528a0004f, 0x4b00742931202c30,
+	0x29f10194696c6523, 0x544e4154534e4f43, 0xa5245464655425f, 0x2072656666756263,
+	0x656d617246726550, 0x746e6174736e6f43, 0x69676572203a2073, 0x3062282072657473,
+	0x7320600064020121, 0xdc0f0060656c6163, 0x782e6201a804d901, 0x2e2f01043d2a2079,
+	0x5845547f9a01fc78, 0x55ff01f445525554, 0x65727574786554a2, 0x203e8303373c4432,
+	0x18757265746e61, 0x3074280af3036007, 0x6c706d61530a3b29, 0x2065746174537265,
+	0x13657275786574, 0x2003900600012011, 0x4d04510f00307328, 0x29008b2e1200ae09,
+	0x202c01f000992820, 0x230a7d0a3b297675, 0xa6669646e65,
+};
+}
+
+const AMD::EmbeddedAsset Shaders = {
+	ShadersData, 470, 1541, AMD::EmbeddedAssetCompression::Lz4
+};
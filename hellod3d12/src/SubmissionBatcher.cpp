@@ -0,0 +1,208 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+
+#include "SubmissionBatcher.h"
+
+#include <algorithm>
+#include <stdexcept>
+#include <unordered_map>
+
+namespace AMD {
+///////////////////////////////////////////////////////////////////////////////
+SubmissionBatcher::SubmissionBatcher (ID3D12Device* device)
+	: device_ (device)
+	, nextId_ (1)
+{
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int SubmissionBatcher::AddQueue (ID3D12CommandQueue* queue)
+{
+	std::lock_guard<std::mutex> lock (mutex_);
+
+	Queue entry;
+	entry.queue = queue;
+
+	if (FAILED (device_->CreateFence (0, D3D12_FENCE_FLAG_NONE,
+		IID_PPV_ARGS (&entry.fence)))) {
+		throw std::runtime_error ("Could not create submission fence");
+	}
+
+	queues_.push_back (entry);
+
+	for (auto& queue : queues_) {
+		queue.waitedValues.resize (queues_.size (), 0);
+	}
+
+	return static_cast<int> (queues_.size ()) - 1;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+SubmissionHandle SubmissionBatcher::Submit (const int queue,
+	ID3D12CommandList* commandList, const std::vector<SubmissionHandle>& dependencies)
+{
+	std::lock_guard<std::mutex> lock (mutex_);
+
+	if (queue < 0 || queue >= static_cast<int> (queues_.size ())) {
+		throw std::runtime_error ("Submission queue out of range");
+	}
+
+	Pending pending;
+	pending.id = nextId_++;
+	pending.queue = queue;
+	pending.commandList = commandList;
+	pending.dependencies = dependencies;
+	pending_.push_back (std::move (pending));
+
+	SubmissionHandle handle;
+	handle.id = pending_.back ().id;
+	handle.queue = queue;
+	return handle;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void SubmissionBatcher::Flush ()
+{
+	std::vector<Pending> pending;
+	{
+		std::lock_guard<std::mutex> lock (mutex_);
+		pending.swap (pending_);
+	}
+
+	if (pending.empty ()) {
+		return;
+	}
+
+	std::unordered_map<std::uint64_t, int> itemIndices;
+	for (int i = 0; i < static_cast<int> (pending.size ()); ++i) {
+		itemIndices [pending [i].id] = i;
+	}
+
+	// Dependencies on earlier flushes become fence waits. If the fence
+	// hasn't been signaled after the dependency yet, do it now; the queue
+	// has been given everything up to it already
+	std::vector<SubmissionItem> items (pending.size ());
+	for (std::size_t i = 0; i < pending.size (); ++i) {
+		items [i].queue = pending [i].queue;
+
+		for (const auto& dependency : pending [i].dependencies) {
+			const auto index = itemIndices.find (dependency.id);
+			if (index != itemIndices.end ()) {
+				items [i].dependencies.push_back (index->second);
+				continue;
+			}
+
+			if (dependency.queue == pending [i].queue) {
+				continue;
+			}
+
+			if (queues_ [dependency.queue].signaledId < dependency.id) {
+				Signal (dependency.queue);
+			}
+
+			FenceWait wait;
+			wait.queue = dependency.queue;
+			wait.value = queues_ [dependency.queue].signaledValue;
+			items [i].waits.push_back (wait);
+		}
+	}
+
+	const int queueCount = static_cast<int> (queues_.size ());
+	std::vector<std::uint64_t> nextFenceValues (queueCount);
+	for (int i = 0; i < queueCount; ++i) {
+		nextFenceValues [i] = queues_ [i].nextFenceValue;
+	}
+
+	const auto plan = PlanSubmissions (items, queueCount, nextFenceValues);
+
+	std::vector<ID3D12CommandList*> commandLists;
+	for (const auto& batch : plan.batches) {
+		auto& queue = queues_ [batch.queue];
+
+		for (const auto& wait : batch.waits) {
+			// Might be covered by a wait of an earlier flush
+			auto& waited = queue.waitedValues [wait.queue];
+			if (waited >= wait.value) {
+				continue;
+			}
+
+			queue.queue->Wait (queues_ [wait.queue].fence.Get (), wait.value);
+			waited = wait.value;
+			++statistics_.waitCalls;
+		}
+
+		commandLists.clear ();
+		for (const auto item : batch.items) {
+			commandLists.push_back (pending [item].commandList);
+			queue.flushedId = (std::max) (queue.flushedId, pending [item].id);
+		}
+
+		queue.queue->ExecuteCommandLists (static_cast<UINT> (commandLists.size ()),
+			commandLists.data ());
+		++statistics_.executeCalls;
+		statistics_.commandLists += static_cast<int> (commandLists.size ());
+
+		if (batch.signalValue != 0) {
+			queue.queue->Signal (queue.fence.Get (), batch.signalValue);
+			queue.signaledValue = batch.signalValue;
+			queue.signaledId = queue.flushedId;
+			++statistics_.signalCalls;
+		}
+	}
+
+	for (int i = 0; i < queueCount; ++i) {
+		queues_ [i].nextFenceValue = plan.nextFenceValues [i];
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::uint64_t SubmissionBatcher::Signal (const int queue)
+{
+	auto& entry = queues_ [queue];
+
+	// Nothing new since the last signal
+	if (entry.signaledValue != 0 && entry.signaledId == entry.flushedId) {
+		return entry.signaledValue;
+	}
+
+	const auto value = entry.nextFenceValue++;
+	entry.queue->Signal (entry.fence.Get (), value);
+	entry.signaledValue = value;
+	entry.signaledId = entry.flushedId;
+	++statistics_.signalCalls;
+
+	return value;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+ID3D12Fence* SubmissionBatcher::GetFence (const int queue) const
+{
+	return queues_ [queue].fence.Get ();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+SubmissionBatcher::Statistics SubmissionBatcher::GetStatistics () const
+{
+	return statistics_;
+}
+}
@@ -0,0 +1,140 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+
+#ifndef ANTERU_D3D12_SAMPLE_SUBMISSIONBATCHER_H_
+#define ANTERU_D3D12_SAMPLE_SUBMISSIONBATCHER_H_
+
+#include "SubmissionPlanner.h"
+
+#include <d3d12.h>
+#include <wrl.h>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace AMD {
+///////////////////////////////////////////////////////////////////////////////
+/**
+Identifies a submitted command list, to declare dependencies on it.
+*/
+struct SubmissionHandle
+{
+	std::uint64_t id = 0;
+	int queue = -1;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Collects command lists for one or more queues from any number of threads,
+and submits them in as few ExecuteCommandLists calls as possible on Flush.
+See PlanSubmissions for how they get ordered and batched.
+
+Each queue gets a fence, which is only signaled where another queue needs
+to wait, or when asked for with Signal.
+*/
+class SubmissionBatcher
+{
+public:
+	SubmissionBatcher (const SubmissionBatcher&) = delete;
+	SubmissionBatcher& operator= (const SubmissionBatcher&) = delete;
+
+	explicit SubmissionBatcher (ID3D12Device* device);
+
+	/**
+	Returns the index of the queue. Add all queues before submitting from
+	other threads.
+	*/
+	int AddQueue (ID3D12CommandQueue* queue);
+
+	/**
+	Thread-safe. The command list is executed on queue after everything in
+	dependencies. Dependencies may come from earlier flushes.
+	*/
+	SubmissionHandle Submit (const int queue, ID3D12CommandList* commandList,
+		const std::vector<SubmissionHandle>& dependencies = std::vector<SubmissionHandle> ());
+
+	/**
+	Submit everything collected since the last flush. Must not be called
+	concurrently with itself or Signal.
+	*/
+	void Flush ();
+
+	/**
+	Signal the fence of queue after everything flushed to it so far, and
+	return the value to wait for.
+	*/
+	std::uint64_t Signal (const int queue);
+
+	ID3D12Fence* GetFence (const int queue) const;
+
+	struct Statistics
+	{
+		int commandLists = 0;
+		int executeCalls = 0;
+		int signalCalls = 0;
+		int waitCalls = 0;
+	};
+
+	/**
+	Calls made by all flushes so far.
+	*/
+	Statistics GetStatistics () const;
+
+private:
+	struct Queue
+	{
+		Microsoft::WRL::ComPtr<ID3D12CommandQueue> queue;
+		Microsoft::WRL::ComPtr<ID3D12Fence> fence;
+		std::uint64_t nextFenceValue = 1;
+
+		// The last value signaled, and the highest submission id it covers
+		std::uint64_t signaledValue = 0;
+		std::uint64_t signaledId = 0;
+
+		// The highest submission id flushed to this queue
+		std::uint64_t flushedId = 0;
+
+		// The highest value waited for on the fence of each queue
+		std::vector<std::uint64_t> waitedValues;
+	};
+
+	struct Pending
+	{
+		std::uint64_t id;
+		int queue;
+		ID3D12CommandList* commandList;
+		std::vector<SubmissionHandle> dependencies;
+	};
+
+	Microsoft::WRL::ComPtr<ID3D12Device> device_;
+	std::vector<Queue> queues_;
+
+	std::mutex mutex_;
+	std::vector<Pending> pending_;
+	std::uint64_t nextId_;
+
+	Statistics statistics_;
+};
+}
+
+#endif
@@ -0,0 +1,247 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+
+#include "SubmissionPlanner.h"
+
+#include <algorithm>
+#include <functional>
+#include <queue>
+#include <stdexcept>
+
+namespace AMD {
+namespace {
+///////////////////////////////////////////////////////////////////////////////
+/**
+Topological order of the items. Among the items which are ready, the one
+passed in first goes first.
+*/
+std::vector<int> SortByDependencies (const std::vector<SubmissionItem>& items)
+{
+	const int itemCount = static_cast<int> (items.size ());
+
+	std::vector<int> pendingDependencies (itemCount, 0);
+	std::vector<std::vector<int>> dependents (itemCount);
+
+	for (int i = 0; i < itemCount; ++i) {
+		for (const auto dependency : items [i].dependencies) {
+			if (dependency < 0 || dependency >= itemCount) {
+				throw std::runtime_error ("Submission dependency out of range");
+			}
+
+			dependents [dependency].push_back (i);
+			++pendingDependencies [i];
+		}
+	}
+
+	std::priority_queue<int, std::vector<int>, std::greater<int>> ready;
+	for (int i = 0; i < itemCount; ++i) {
+		if (pendingDependencies [i] == 0) {
+			ready.push (i);
+		}
+	}
+
+	std::vector<int> order;
+	order.reserve (itemCount);
+
+	while (!ready.empty ()) {
+		const auto item = ready.top ();
+		ready.pop ();
+		order.push_back (item);
+
+		for (const auto dependent : dependents [item]) {
+			if (--pendingDependencies [dependent] == 0) {
+				ready.push (dependent);
+			}
+		}
+	}
+
+	if (static_cast<int> (order.size ()) != itemCount) {
+		throw std::runtime_error ("Submission dependencies contain a cycle");
+	}
+
+	return order;
+}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+SubmissionPlan PlanSubmissions (const std::vector<SubmissionItem>& items,
+	const int queueCount, const std::vector<std::uint64_t>& nextFenceValues)
+{
+	if (static_cast<int> (nextFenceValues.size ()) != queueCount) {
+		throw std::runtime_error ("Need one fence value per queue");
+	}
+
+	for (const auto& item : items) {
+		if (item.queue < 0 || item.queue >= queueCount) {
+			throw std::runtime_error ("Submission queue out of range");
+		}
+	}
+
+	SubmissionPlan plan;
+	plan.nextFenceValues = nextFenceValues;
+
+	// The batch each queue is currently filling, -1 if none, and the batch
+	// each item ended up in
+	std::vector<int> openBatch (queueCount, -1);
+	std::vector<int> itemBatch (items.size (), -1);
+
+	// waited [q * queueCount + p] is the highest value queue q waited for
+	// on the fence of queue p so far
+	std::vector<std::uint64_t> waited (queueCount * queueCount, 0);
+
+	// Batches in the order they are closed. A batch is closed before any
+	// batch waiting for it, so this is the order to submit them in
+	std::vector<int> closeOrder;
+
+	auto closeBatch = [&] (const int queue) -> std::uint64_t {
+		auto& batch = plan.batches [openBatch [queue]];
+		batch.signalValue = plan.nextFenceValues [queue]++;
+		closeOrder.push_back (openBatch [queue]);
+		openBatch [queue] = -1;
+		return batch.signalValue;
+	};
+
+	auto addWait = [&] (const int queue, const FenceWait& wait) {
+		auto& highest = waited [queue * queueCount + wait.queue];
+		if (highest >= wait.value) {
+			return;
+		}
+
+		highest = wait.value;
+		auto& waits = plan.batches [openBatch [queue]].waits;
+
+		// One wait per fence is enough, keep the highest value
+		for (auto& existing : waits) {
+			if (existing.queue == wait.queue) {
+				existing.value = wait.value;
+				return;
+			}
+		}
+
+		waits.push_back (wait);
+	};
+
+	// The batches of each queue, in order
+	std::vector<std::vector<int>> queueBatches (queueCount);
+
+	// Value to wait for until the batch is done. Batches closed because of
+	// a wait have no signal yet; they get one unless a later batch on the
+	// same queue has one already, so values keep increasing
+	auto getSignalValue = [&] (const int batchIndex) -> std::uint64_t {
+		const auto queue = plan.batches [batchIndex].queue;
+
+		if (openBatch [queue] == batchIndex) {
+			return closeBatch (queue);
+		}
+
+		const auto& batches = queueBatches [queue];
+		for (auto it = std::find (batches.begin (), batches.end (), batchIndex);
+			it != batches.end (); ++it) {
+			if (plan.batches [*it].signalValue != 0) {
+				return plan.batches [*it].signalValue;
+			}
+		}
+
+		auto& batch = plan.batches [batchIndex];
+		batch.signalValue = plan.nextFenceValues [queue]++;
+		return batch.signalValue;
+	};
+
+	for (const auto index : SortByDependencies (items)) {
+		const auto& item = items [index];
+		const auto queue = item.queue;
+
+		std::vector<FenceWait> waits;
+
+		for (const auto& wait : item.waits) {
+			if (wait.queue < 0 || wait.queue >= queueCount) {
+				throw std::runtime_error ("Submission wait queue out of range");
+			}
+
+			// Earlier submissions on the same queue are done first anyway
+			if (wait.queue != queue) {
+				waits.push_back (wait);
+			}
+		}
+
+		for (const auto dependency : item.dependencies) {
+			if (items [dependency].queue == queue) {
+				continue;
+			}
+
+			FenceWait wait;
+			wait.queue = items [dependency].queue;
+			wait.value = getSignalValue (itemBatch [dependency]);
+			waits.push_back (wait);
+		}
+
+		// Skip what this queue has waited for already
+		waits.erase (std::remove_if (waits.begin (), waits.end (),
+			[&] (const FenceWait& wait) {
+				return waited [queue * queueCount + wait.queue] >= wait.value;
+			}), waits.end ());
+
+		// The waits go right before the item, so the items before it
+		// can overlap with the work on the other queues
+		if (!waits.empty () && openBatch [queue] != -1) {
+			closeOrder.push_back (openBatch [queue]);
+			openBatch [queue] = -1;
+		}
+
+		if (openBatch [queue] == -1) {
+			openBatch [queue] = static_cast<int> (plan.batches.size ());
+			queueBatches [queue].push_back (openBatch [queue]);
+			plan.batches.push_back (SubmissionBatch ());
+			plan.batches.back ().queue = queue;
+		}
+
+		for (const auto& wait : waits) {
+			addWait (queue, wait);
+		}
+
+		itemBatch [index] = openBatch [queue];
+		plan.batches [openBatch [queue]].items.push_back (index);
+	}
+
+	// Nobody waits for the remaining batches, so they don't need a signal;
+	// submit them in the order they were started
+	std::vector<int> remaining;
+	for (const auto batch : openBatch) {
+		if (batch != -1) {
+			remaining.push_back (batch);
+		}
+	}
+
+	std::sort (remaining.begin (), remaining.end ());
+	closeOrder.insert (closeOrder.end (), remaining.begin (), remaining.end ());
+
+	std::vector<SubmissionBatch> batches;
+	batches.reserve (closeOrder.size ());
+	for (const auto batch : closeOrder) {
+		batches.push_back (std::move (plan.batches [batch]));
+	}
+	plan.batches.swap (batches);
+
+	return plan;
+}
+}
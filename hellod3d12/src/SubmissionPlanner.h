@@ -0,0 +1,109 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+
+#ifndef ANTERU_D3D12_SAMPLE_SUBMISSIONPLANNER_H_
+#define ANTERU_D3D12_SAMPLE_SUBMISSIONPLANNER_H_
+
+#include <cstdint>
+#include <vector>
+
+namespace AMD {
+///////////////////////////////////////////////////////////////////////////////
+/**
+Wait until the fence of queue reaches value.
+*/
+struct FenceWait
+{
+	int queue;
+	std::uint64_t value;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+One command list to submit.
+*/
+struct SubmissionItem
+{
+	int queue = 0;
+
+	/**
+	Indices of items in the same plan which must finish first.
+	*/
+	std::vector<int> dependencies;
+
+	/**
+	Fence values from earlier submissions which must be reached first.
+	*/
+	std::vector<FenceWait> waits;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+One ExecuteCommandLists call: wait for the fences, execute the items, then
+signal the queue's fence if signalValue is not 0.
+*/
+struct SubmissionBatch
+{
+	int queue = 0;
+	std::vector<FenceWait> waits;
+	std::vector<int> items;
+	std::uint64_t signalValue = 0;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+struct SubmissionPlan
+{
+	/**
+	In the order in which they have to be submitted.
+	*/
+	std::vector<SubmissionBatch> batches;
+
+	/**
+	The next free fence value of each queue after the plan.
+	*/
+	std::vector<std::uint64_t> nextFenceValues;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Plan the submission of items to queueCount queues, each of which has one
+fence whose next free value is in nextFenceValues.
+
+Items are ordered by their dependencies, otherwise they keep the order in
+which they were passed in. Consecutive items on a queue go into one batch
+unless an item depends on work on another queue. In that case, the batch on
+the other queue is closed and signaled, and the item starts a new batch
+which waits for it, so the items before it can still overlap with the
+other queue.
+
+Batches only signal if another queue waits for them, and waits already
+covered by an earlier wait on the same queue are skipped.
+
+Doesn't touch the GPU, so the result can be checked without one. Throws if
+the dependencies contain a cycle or an index is out of range.
+*/
+SubmissionPlan PlanSubmissions (const std::vector<SubmissionItem>& items,
+	const int queueCount, const std::vector<std::uint64_t>& nextFenceValues);
+}
+
+#endif
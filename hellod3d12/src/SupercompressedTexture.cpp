@@ -0,0 +1,472 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#include "SupercompressedTexture.h"
+
+#include "Lz4.h"
+#include "Parallel.h"
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+namespace AMD {
+namespace {
+const char SUPERCOMPRESSED_MAGIC [4] = { 'A', 'S', 'C', 'T' };
+const std::uint32_t SUPERCOMPRESSED_VERSION = 1;
+
+struct Header
+{
+	char magic [4];
+	std::uint32_t version;
+	std::uint32_t width;
+	std::uint32_t height;
+	std::uint32_t mipLevels;
+	std::uint32_t reserved;
+};
+
+struct LevelEntry
+{
+	std::uint32_t width;
+	std::uint32_t height;
+	std::uint64_t endpointOffset;
+	std::uint64_t indexOffset;
+	std::uint32_t endpointSize;
+	std::uint32_t indexSize;
+};
+
+// Both planes store 8 bytes per block
+const int PLANE_BYTES_PER_BLOCK = 8;
+
+// The D3D12 limits for 2D textures, which also keep the block counts in
+// range of an int
+const std::uint32_t MAXIMUM_DIMENSION = 16384;
+const std::uint32_t MAXIMUM_LEVEL_COUNT = 15;
+
+///////////////////////////////////////////////////////////////////////////////
+class BitReader
+{
+public:
+	explicit BitReader (const std::uint8_t* input)
+		: input_ (input)
+	{
+	}
+
+	std::uint32_t Read (const int bitCount)
+	{
+		std::uint32_t result = 0;
+		for (int i = 0; i < bitCount; ++i) {
+			result |= ((input_ [position_ / 8] >> (position_ % 8)) & 1u) << i;
+			++position_;
+		}
+		return result;
+	}
+
+private:
+	const std::uint8_t* input_;
+	int position_ = 0;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Split a BC7 mode 6 block into its endpoint and index plane entries.
+
+Endpoints: R0 R1 G0 G1 B0 B1 A0 A1 (7 bit each), with the p-bits stored in
+the top bit of the first two bytes. Indices: 16 nibbles, texel 0 first.
+*/
+void SplitMode6Block (const std::uint8_t* block, std::uint8_t* endpoints,
+	std::uint8_t* indices)
+{
+	BitReader reader (block);
+	if (reader.Read (7) != (1 << 6)) {
+		throw std::runtime_error ("Expected a BC7 mode 6 block");
+	}
+
+	for (int c = 0; c < 4; ++c) {
+		endpoints [c * 2 + 0] = static_cast<std::uint8_t> (reader.Read (7));
+		endpoints [c * 2 + 1] = static_cast<std::uint8_t> (reader.Read (7));
+	}
+
+	endpoints [0] |= reader.Read (1) << 7;
+	endpoints [1] |= reader.Read (1) << 7;
+
+	std::memset (indices, 0, PLANE_BYTES_PER_BLOCK);
+	for (int i = 0; i < 16; ++i) {
+		const auto index = reader.Read ((i == 0) ? 3 : 4);
+		indices [i / 2] |= static_cast<std::uint8_t> (index << ((i % 2) * 4));
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+struct Mode6Block
+{
+	// 8 bit endpoints, p-bits applied
+	int endpoint0 [4];
+	int endpoint1 [4];
+	int indices [16];
+};
+
+Mode6Block UnpackMode6Block (const std::uint8_t* endpoints, const std::uint8_t* indices)
+{
+	Mode6Block result;
+
+	const int p0 = endpoints [0] >> 7;
+	const int p1 = endpoints [1] >> 7;
+
+	for (int c = 0; c < 4; ++c) {
+		result.endpoint0 [c] = ((endpoints [c * 2 + 0] & 0x7F) << 1) | p0;
+		result.endpoint1 [c] = ((endpoints [c * 2 + 1] & 0x7F) << 1) | p1;
+	}
+
+	for (int i = 0; i < 16; ++i) {
+		result.indices [i] = (indices [i / 2] >> ((i % 2) * 4)) & 0xF;
+	}
+
+	return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Reassemble a mode 6 block. This runs for every block of every texture, so
+the fields are packed into two 64 bit words directly: the mode, endpoints and
+first p-bit fill the low word, the second p-bit and the indices the high one.
+*/
+void WriteBC7 (const std::uint8_t* endpoints, const std::uint8_t* indices,
+	std::uint8_t* output)
+{
+	std::uint64_t low = 1 << 6;
+	for (int i = 0; i < 8; ++i) {
+		low |= static_cast<std::uint64_t> (endpoints [i] & 0x7F) << (7 + i * 7);
+	}
+	low |= static_cast<std::uint64_t> (endpoints [0] >> 7) << 63;
+
+	// The first index has only 3 bits, the others follow right after it
+	std::uint64_t indexBits;
+	std::memcpy (&indexBits, indices, sizeof (indexBits));
+	indexBits = (indexBits & 0x7) | ((indexBits >> 4) << 3);
+
+	const std::uint64_t high = static_cast<std::uint64_t> (endpoints [1] >> 7) |
+		(indexBits << 1);
+
+	std::memcpy (output, &low, sizeof (low));
+	std::memcpy (output + 8, &high, sizeof (high));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+const int BC7_WEIGHTS [16] = {
+	0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64
+};
+
+std::uint16_t To565 (const int* color)
+{
+	const int r = (color [0] * 31 + 127) / 255;
+	const int g = (color [1] * 63 + 127) / 255;
+	const int b = (color [2] * 31 + 127) / 255;
+
+	return static_cast<std::uint16_t> ((r << 11) | (g << 5) | b);
+}
+
+/**
+Map the mode 6 endpoints and indices onto a BC1 color block. Each 4 bit index
+becomes the closest of the four BC1 palette weights (0, 1/3, 2/3, 1).
+*/
+void WriteBC1Color (const Mode6Block& block, std::uint8_t* output)
+{
+	auto color0 = To565 (block.endpoint0);
+	auto color1 = To565 (block.endpoint1);
+
+	// Four color mode requires color0 > color1; swapping mirrors the weights
+	const bool swap = color0 < color1;
+	if (swap) {
+		std::swap (color0, color1);
+	}
+
+	// Palette order of the steps from endpoint0 to endpoint1
+	static const std::uint32_t stepToIndex [4] = { 0, 2, 3, 1 };
+
+	std::uint32_t indexBits = 0;
+	if (color0 != color1) {
+		for (int i = 0; i < 16; ++i) {
+			int step = (BC7_WEIGHTS [block.indices [i]] * 3 + 32) / 64;
+			if (swap) {
+				step = 3 - step;
+			}
+			indexBits |= stepToIndex [step] << (i * 2);
+		}
+	}
+
+	std::memcpy (output, &color0, 2);
+	std::memcpy (output + 2, &color1, 2);
+	std::memcpy (output + 4, &indexBits, 4);
+}
+
+void WriteBC3Alpha (const Mode6Block& block, std::uint8_t* output)
+{
+	int alpha0 = block.endpoint0 [3];
+	int alpha1 = block.endpoint1 [3];
+
+	// Eight alpha mode requires alpha0 > alpha1
+	const bool swap = alpha0 < alpha1;
+	if (swap) {
+		std::swap (alpha0, alpha1);
+	}
+
+	std::uint64_t indexBits = 0;
+	if (alpha0 != alpha1) {
+		for (int i = 0; i < 16; ++i) {
+			int step = (BC7_WEIGHTS [block.indices [i]] * 7 + 32) / 64;
+			if (swap) {
+				step = 7 - step;
+			}
+			const int index = (step == 0) ? 0 : ((step == 7) ? 1 : step + 1);
+			indexBits |= static_cast<std::uint64_t> (index) << (i * 3);
+		}
+	}
+
+	output [0] = static_cast<std::uint8_t> (alpha0);
+	output [1] = static_cast<std::uint8_t> (alpha1);
+	for (int i = 0; i < 6; ++i) {
+		output [2 + i] = static_cast<std::uint8_t> (indexBits >> (i * 8));
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void TranscodeBlock (const std::uint8_t* endpoints, const std::uint8_t* indices,
+	const BlockFormat format, std::uint8_t* output)
+{
+	switch (format) {
+	case BlockFormat::BC7:
+		WriteBC7 (endpoints, indices, output);
+		break;
+
+	case BlockFormat::BC1:
+		WriteBC1Color (UnpackMode6Block (endpoints, indices), output);
+		break;
+
+	case BlockFormat::BC3:
+		{
+			const auto block = UnpackMode6Block (endpoints, indices);
+			WriteBC3Alpha (block, output);
+			WriteBC1Color (block, output + 8);
+		}
+		break;
+	}
+}
+
+int GetBlockCount (const std::uint32_t width, const std::uint32_t height)
+{
+	return static_cast<int> (((width + 3) / 4) * ((height + 3) / 4));
+}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::vector<std::uint8_t> EncodeSupercompressedTexture (const MipLevel* levels,
+	const int levelCount)
+{
+	if (levelCount <= 0) {
+		throw std::runtime_error ("Cannot encode a texture without levels");
+	}
+
+	std::vector<std::vector<std::uint8_t>> endpointPlanes (levelCount);
+	std::vector<std::vector<std::uint8_t>> indexPlanes (levelCount);
+
+	for (int level = 0; level < levelCount; ++level) {
+		const auto& input = levels [level];
+		const auto blocks = CompressImage (input.data.data (),
+			input.width, input.height, input.width * 4,
+			BlockFormat::BC7, BlockCompressionQuality::High);
+
+		const int blockCount = GetBlockCount (input.width, input.height);
+		std::vector<std::uint8_t> endpoints (blockCount * PLANE_BYTES_PER_BLOCK);
+		std::vector<std::uint8_t> indices (blockCount * PLANE_BYTES_PER_BLOCK);
+
+		for (int i = 0; i < blockCount; ++i) {
+			SplitMode6Block (blocks.data () + i * 16,
+				endpoints.data () + i * PLANE_BYTES_PER_BLOCK,
+				indices.data () + i * PLANE_BYTES_PER_BLOCK);
+		}
+
+		endpointPlanes [level] = Lz4Compress (endpoints.data (), endpoints.size ());
+		indexPlanes [level] = Lz4Compress (indices.data (), indices.size ());
+	}
+
+	Header header = {};
+	std::memcpy (header.magic, SUPERCOMPRESSED_MAGIC, sizeof (header.magic));
+	header.version = SUPERCOMPRESSED_VERSION;
+	header.width = levels [0].width;
+	header.height = levels [0].height;
+	header.mipLevels = levelCount;
+
+	std::vector<LevelEntry> entries (levelCount);
+	std::uint64_t offset = sizeof (Header) + sizeof (LevelEntry) * levelCount;
+	for (int level = 0; level < levelCount; ++level) {
+		auto& entry = entries [level];
+		entry.width = levels [level].width;
+		entry.height = levels [level].height;
+		entry.endpointOffset = offset;
+		entry.endpointSize = static_cast<std::uint32_t> (endpointPlanes [level].size ());
+		offset += entry.endpointSize;
+		entry.indexOffset = offset;
+		entry.indexSize = static_cast<std::uint32_t> (indexPlanes [level].size ());
+		offset += entry.indexSize;
+	}
+
+	std::vector<std::uint8_t> result (static_cast<std::size_t> (offset));
+	std::memcpy (result.data (), &header, sizeof (header));
+	std::memcpy (result.data () + sizeof (header), entries.data (),
+		sizeof (LevelEntry) * levelCount);
+
+	for (int level = 0; level < levelCount; ++level) {
+		std::memcpy (result.data () + entries [level].endpointOffset,
+			endpointPlanes [level].data (), endpointPlanes [level].size ());
+		std::memcpy (result.data () + entries [level].indexOffset,
+			indexPlanes [level].data (), indexPlanes [level].size ());
+	}
+
+	return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+bool GetSupercompressedTextureInfo (const void* data, const std::size_t size,
+	int* width, int* height)
+{
+	if (size < sizeof (Header)) {
+		return false;
+	}
+
+	Header header;
+	std::memcpy (&header, data, sizeof (header));
+
+	if (std::memcmp (header.magic, SUPERCOMPRESSED_MAGIC, sizeof (header.magic)) != 0 ||
+		header.version != SUPERCOMPRESSED_VERSION) {
+		return false;
+	}
+
+	*width = static_cast<int> ((std::min) (header.width, MAXIMUM_DIMENSION));
+	*height = static_cast<int> ((std::min) (header.height, MAXIMUM_DIMENSION));
+
+	return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TranscodedTexture TranscodeSupercompressedTexture (const void* data,
+	const std::size_t size, const BlockFormat targetFormat)
+{
+	const auto bytes = static_cast<const std::uint8_t*> (data);
+
+	if (size < sizeof (Header)) {
+		throw std::runtime_error ("Supercompressed texture is truncated");
+	}
+
+	Header header;
+	std::memcpy (&header, bytes, sizeof (header));
+
+	if (std::memcmp (header.magic, SUPERCOMPRESSED_MAGIC, sizeof (header.magic)) != 0 ||
+		header.version != SUPERCOMPRESSED_VERSION) {
+		throw std::runtime_error ("Not a supercompressed texture");
+	}
+
+	if (header.width == 0 || header.width > MAXIMUM_DIMENSION ||
+		header.height == 0 || header.height > MAXIMUM_DIMENSION ||
+		header.mipLevels == 0 || header.mipLevels > MAXIMUM_LEVEL_COUNT ||
+		((std::max) (header.width, header.height) >> (header.mipLevels - 1)) == 0 ||
+		sizeof (Header) + sizeof (LevelEntry) * header.mipLevels > size) {
+		throw std::runtime_error ("Supercompressed texture is corrupt");
+	}
+
+	const int levelCount = static_cast<int> (header.mipLevels);
+	std::vector<LevelEntry> entries (levelCount);
+	std::memcpy (entries.data (), bytes + sizeof (Header), sizeof (LevelEntry) * levelCount);
+
+	// The level sizes determine the plane sizes, so they must form a mip
+	// chain. The offsets come from the file, compare without adding them
+	for (int level = 0; level < levelCount; ++level) {
+		const auto& entry = entries [level];
+
+		if (entry.width != (std::max) (header.width >> level, 1u) ||
+			entry.height != (std::max) (header.height >> level, 1u) ||
+			entry.endpointOffset > size || entry.endpointSize > size - entry.endpointOffset ||
+			entry.indexOffset > size || entry.indexSize > size - entry.indexOffset) {
+			throw std::runtime_error ("Supercompressed texture is corrupt");
+		}
+	}
+
+	// Decompress the planes, one level per task. Then transcode all blocks
+	// at once, otherwise the tiny levels at the end of the chain would not
+	// keep any thread busy
+	std::vector<std::vector<std::uint8_t>> endpointPlanes (levelCount);
+	std::vector<std::vector<std::uint8_t>> indexPlanes (levelCount);
+	std::vector<int> firstBlock (levelCount + 1, 0);
+
+	for (int level = 0; level < levelCount; ++level) {
+		firstBlock [level + 1] = firstBlock [level] +
+			GetBlockCount (entries [level].width, entries [level].height);
+	}
+
+	ParallelFor (levelCount, 1, [&] (const int begin, const int end) {
+		for (int level = begin; level < end; ++level) {
+			const auto& entry = entries [level];
+			const auto planeSize = static_cast<std::size_t> (
+				firstBlock [level + 1] - firstBlock [level]) * PLANE_BYTES_PER_BLOCK;
+
+			endpointPlanes [level].resize (planeSize);
+			Lz4Decompress (bytes + entry.endpointOffset, entry.endpointSize,
+				endpointPlanes [level].data (), planeSize);
+
+			indexPlanes [level].resize (planeSize);
+			Lz4Decompress (bytes + entry.indexOffset, entry.indexSize,
+				indexPlanes [level].data (), planeSize);
+		}
+	});
+
+	TranscodedTexture result;
+	result.format = targetFormat;
+	result.width = header.width;
+	result.height = header.height;
+	result.levels.resize (levelCount);
+
+	const int blockSize = GetBlockSize (targetFormat);
+	for (int level = 0; level < levelCount; ++level) {
+		result.levels [level].resize (static_cast<std::size_t> (
+			firstBlock [level + 1] - firstBlock [level]) * blockSize);
+	}
+
+	ParallelFor (firstBlock [levelCount], 1024, [&] (const int begin, const int end) {
+		int level = 0;
+
+		for (int block = begin; block < end; ++block) {
+			while (block >= firstBlock [level + 1]) {
+				++level;
+			}
+
+			const int localBlock = block - firstBlock [level];
+			TranscodeBlock (
+				endpointPlanes [level].data () + localBlock * PLANE_BYTES_PER_BLOCK,
+				indexPlanes [level].data () + localBlock * PLANE_BYTES_PER_BLOCK,
+				targetFormat,
+				result.levels [level].data () + localBlock * blockSize);
+		}
+	});
+
+	return result;
+}
+}
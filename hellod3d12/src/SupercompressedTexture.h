@@ -0,0 +1,82 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#ifndef ANTERU_D3D12_SAMPLE_SUPERCOMPRESSEDTEXTURE_H_
+#define ANTERU_D3D12_SAMPLE_SUPERCOMPRESSEDTEXTURE_H_
+
+#include "BlockCompression.h"
+#include "MipChain.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace AMD {
+///////////////////////////////////////////////////////////////////////////////
+/**
+Supercompressed textures store every mip level as BC7 mode 6 blocks, split
+into two planes -- endpoints and indices -- which are LZ4 compressed
+separately. Splitting the planes puts similar bytes next to each other, which
+makes the LZ stage a lot more effective than on interleaved blocks.
+
+At load time, the planes are decompressed and transcoded into BC1, BC3 or
+BC7 without going through RGBA: mode 6 endpoints map directly onto BC1/BC3
+endpoints and the 4 bit indices are requantized.
+
+The file starts with a 24 byte header (magic 'ASCT', version, width, height,
+mip level count, reserved), followed by one 32 byte entry per level (width,
+height, endpoint plane offset, index plane offset, and the compressed sizes
+of both planes).
+*/
+std::vector<std::uint8_t> EncodeSupercompressedTexture (const MipLevel* levels,
+	const int levelCount);
+
+///////////////////////////////////////////////////////////////////////////////
+struct TranscodedTexture
+{
+	BlockFormat format;
+	int width;
+	int height;
+	// One entry per mip level, block rows are tightly packed
+	std::vector<std::vector<std::uint8_t>> levels;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Read the size of the top level from the header, without transcoding.
+Returns false if data does not start with a supercompressed texture header;
+the rest of the file is only validated by TranscodeSupercompressedTexture.
+*/
+bool GetSupercompressedTextureInfo (const void* data, const std::size_t size,
+	int* width, int* height);
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Decompress and transcode a supercompressed texture. Levels are decompressed
+in parallel, then all blocks of all levels are transcoded in parallel.
+Throws if the file is malformed, or the levels are not a mip chain of at
+most 16384x16384.
+*/
+TranscodedTexture TranscodeSupercompressedTexture (const void* data,
+	const std::size_t size, const BlockFormat targetFormat);
+}
+
+#endif
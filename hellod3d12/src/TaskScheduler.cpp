@@ -0,0 +1,575 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#include "TaskScheduler.h"
+
+#include "WorkStealingDeque.h"
+
+#include <algorithm>
+#include <exception>
+#include <stdexcept>
+
+#ifdef _WIN32
+#include <Windows.h>
+#else
+#include <pthread.h>
+#endif
+
+// VS2013 has no thread_local, but supports __declspec(thread) for pointers
+#if defined(_MSC_VER) && _MSC_VER < 1900
+#define AMD_THREAD_LOCAL __declspec(thread)
+#else
+#define AMD_THREAD_LOCAL thread_local
+#endif
+
+namespace AMD {
+///////////////////////////////////////////////////////////////////////////////
+struct Task
+{
+	std::function<void ()> function;
+	bool mainThread;
+
+	// Dependencies which are not done yet, plus one while the task is
+	// being submitted
+	std::atomic<int> unfinishedCount;
+
+	std::mutex mutex;
+	std::atomic<bool> done;
+	std::vector<std::shared_ptr<Task>> successors;
+	std::exception_ptr exception;
+
+	// Keeps the task alive until it has run, even if all handles are gone
+	std::shared_ptr<Task> self;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+class TaskWorker
+{
+public:
+	explicit TaskWorker (const unsigned int seed)
+		: random_ (seed | 1)
+	{
+	}
+
+	WorkStealingDeque<Task>& GetDeque ()
+	{
+		return deque_;
+	}
+
+	/**
+	xorshift, good enough to spread steal attempts.
+	*/
+	unsigned int GetRandom ()
+	{
+		random_ ^= random_ << 13;
+		random_ ^= random_ >> 17;
+		random_ ^= random_ << 5;
+		return random_;
+	}
+
+private:
+	WorkStealingDeque<Task> deque_;
+	unsigned int random_;
+};
+
+namespace {
+// Worker threads spin this often looking for work before going to sleep
+const int IDLE_SPIN_COUNT = 64;
+
+// More ranges than threads balance uneven work, without making the ranges
+// so small that the scheduling overhead shows
+const int PARALLEL_FOR_RANGES_PER_THREAD = 4;
+
+AMD_THREAD_LOCAL TaskScheduler* currentScheduler = nullptr;
+AMD_THREAD_LOCAL TaskWorker* currentWorker = nullptr;
+
+std::once_flag defaultSchedulerFlag;
+TaskScheduler* defaultScheduler = nullptr;
+TaskSchedulerOptions defaultOptions;
+
+int GetHardwareThreadCount ()
+{
+	return static_cast<int> ((std::max) (1u, std::thread::hardware_concurrency ()));
+}
+
+void PinCurrentThread (const int core)
+{
+#ifdef _WIN32
+	::SetThreadAffinityMask (::GetCurrentThread (),
+		static_cast<DWORD_PTR> (1) << (core % (sizeof (DWORD_PTR) * 8)));
+#else
+	cpu_set_t set;
+	CPU_ZERO (&set);
+	CPU_SET (core % CPU_SETSIZE, &set);
+	::pthread_setaffinity_np (::pthread_self (), sizeof (set), &set);
+#endif
+}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+bool TaskHandle::IsDone () const
+{
+	return !task_ || task_->done.load ();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TaskScheduler::TaskScheduler (const TaskSchedulerOptions& options)
+	: mainThread_ (std::this_thread::get_id ())
+	, pinThreads_ (options.pinThreads)
+	, pendingCount_ (0)
+	, sharedTaskCount_ (0)
+	, mainThreadTaskCount_ (0)
+	, sleepingCount_ (0)
+	, stop_ (false)
+	, waitingCount_ (0)
+{
+	const int workerCount = (std::max) (1, (options.workerCount < 0)
+		? GetHardwareThreadCount () - 1 : options.workerCount);
+
+	// All workers must exist before the first one starts stealing
+	for (int i = 0; i < workerCount; ++i) {
+		workers_.emplace_back (new TaskWorker (2654435761u * (i + 1)));
+	}
+
+	for (int i = 0; i < workerCount; ++i) {
+		threads_.emplace_back (&TaskScheduler::WorkerMain, this, workers_ [i].get (), i);
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TaskScheduler::~TaskScheduler ()
+{
+	WaitUntil ([this] () {
+		return pendingCount_.load () == 0;
+	});
+
+	{
+		std::lock_guard<std::mutex> lock (sleepMutex_);
+		stop_ = true;
+	}
+
+	sleepCondition_.notify_all ();
+
+	for (auto& thread : threads_) {
+		thread.join ();
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TaskScheduler& TaskScheduler::GetDefault ()
+{
+	std::call_once (defaultSchedulerFlag, [] () {
+		defaultScheduler = new TaskScheduler (defaultOptions);
+	});
+
+	return *defaultScheduler;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void TaskScheduler::SetDefaultOptions (const TaskSchedulerOptions& options)
+{
+	bool set = false;
+	std::call_once (defaultSchedulerFlag, [&] () {
+		defaultOptions = options;
+		defaultScheduler = new TaskScheduler (defaultOptions);
+		set = true;
+	});
+
+	if (!set) {
+		throw std::runtime_error ("The default task scheduler has already been created");
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int TaskScheduler::GetWorkerCount () const
+{
+	return static_cast<int> (workers_.size ());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TaskHandle TaskScheduler::Submit (std::function<void ()> function)
+{
+	return SubmitImpl (function, std::vector<TaskHandle> (), false);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TaskHandle TaskScheduler::Submit (std::function<void ()> function,
+	const std::vector<TaskHandle>& dependencies)
+{
+	return SubmitImpl (function, dependencies, false);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TaskHandle TaskScheduler::SubmitMainThread (std::function<void ()> function)
+{
+	return SubmitImpl (function, std::vector<TaskHandle> (), true);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TaskHandle TaskScheduler::SubmitMainThread (std::function<void ()> function,
+	const std::vector<TaskHandle>& dependencies)
+{
+	return SubmitImpl (function, dependencies, true);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TaskHandle TaskScheduler::SubmitImpl (std::function<void ()>& function,
+	const std::vector<TaskHandle>& dependencies, const bool mainThread)
+{
+	auto task = std::make_shared<Task> ();
+	task->function = std::move (function);
+	task->mainThread = mainThread;
+	task->unfinishedCount = 1;
+	task->done = false;
+	task->self = task;
+
+	++pendingCount_;
+
+	for (const auto& dependency : dependencies) {
+		if (!dependency.IsValid ()) {
+			continue;
+		}
+
+		std::lock_guard<std::mutex> lock (dependency.task_->mutex);
+		if (!dependency.task_->done) {
+			dependency.task_->successors.push_back (task);
+			++task->unfinishedCount;
+		}
+	}
+
+	TaskHandle result;
+	result.task_ = task;
+
+	// Dependencies may have finished in the meantime, in which case the last
+	// one to finish left the scheduling to us
+	if (--task->unfinishedCount == 0) {
+		Schedule (task.get ());
+	}
+
+	return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void TaskScheduler::Schedule (Task* task)
+{
+	if (task->mainThread) {
+		std::lock_guard<std::mutex> lock (mainThreadMutex_);
+		mainThreadTasks_.push_back (task);
+		++mainThreadTaskCount_;
+	} else if (auto worker = GetCurrentWorker ()) {
+		worker->GetDeque ().Push (task);
+	} else {
+		std::lock_guard<std::mutex> lock (sharedMutex_);
+		sharedTasks_.push_back (task);
+		++sharedTaskCount_;
+	}
+
+	// Sleepers increment their count before checking for work under the
+	// lock, so either they see the task or we see them
+	if (!task->mainThread && sleepingCount_.load () > 0) {
+		std::lock_guard<std::mutex> lock (sleepMutex_);
+		sleepCondition_.notify_one ();
+	}
+
+	if (waitingCount_.load () > 0) {
+		std::lock_guard<std::mutex> lock (waitMutex_);
+		waitCondition_.notify_all ();
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void TaskScheduler::Execute (Task* task)
+{
+	try {
+		task->function ();
+	} catch (...) {
+		task->exception = std::current_exception ();
+	}
+
+	// Release whatever the function captured as early as possible
+	task->function = nullptr;
+
+	std::vector<std::shared_ptr<Task>> successors;
+	{
+		std::lock_guard<std::mutex> lock (task->mutex);
+		task->done = true;
+		successors.swap (task->successors);
+	}
+
+	for (const auto& successor : successors) {
+		if (--successor->unfinishedCount == 0) {
+			Schedule (successor.get ());
+		}
+	}
+
+	// May destroy the task
+	const auto self = std::move (task->self);
+
+	--pendingCount_;
+
+	if (waitingCount_.load () > 0) {
+		std::lock_guard<std::mutex> lock (waitMutex_);
+		waitCondition_.notify_all ();
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Task* TaskScheduler::FindTask (TaskWorker* worker)
+{
+	if (worker) {
+		if (auto task = worker->GetDeque ().Pop ()) {
+			return task;
+		}
+	}
+
+	if (sharedTaskCount_.load () > 0) {
+		std::lock_guard<std::mutex> lock (sharedMutex_);
+		if (!sharedTasks_.empty ()) {
+			const auto task = sharedTasks_.front ();
+			sharedTasks_.pop_front ();
+			--sharedTaskCount_;
+			return task;
+		}
+	}
+
+	// Start at a random victim, so thieves don't all pile onto the same one
+	const auto count = workers_.size ();
+	const auto first = worker ? worker->GetRandom () % count : 0;
+	for (std::size_t i = 0; i < count; ++i) {
+		const auto victim = workers_ [(first + i) % count].get ();
+
+		if (victim == worker) {
+			continue;
+		}
+
+		if (auto task = victim->GetDeque ().Steal ()) {
+			return task;
+		}
+	}
+
+	return nullptr;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+bool TaskScheduler::HasQueuedTasks () const
+{
+	if (sharedTaskCount_.load () > 0) {
+		return true;
+	}
+
+	for (const auto& worker : workers_) {
+		if (!worker->GetDeque ().IsEmpty ()) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void TaskScheduler::Wait (const TaskHandle& task)
+{
+	const auto& t = task.task_;
+	if (!t) {
+		return;
+	}
+
+	WaitUntil ([&t] () {
+		return t->done.load ();
+	});
+
+	if (t->exception) {
+		std::rethrow_exception (t->exception);
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void TaskScheduler::WaitUntil (const std::function<bool ()>& condition)
+{
+	const bool isMainThread = std::this_thread::get_id () == mainThread_;
+	const auto worker = GetCurrentWorker ();
+
+	while (!condition ()) {
+		if (isMainThread && RunMainThreadTasksImpl ()) {
+			continue;
+		}
+
+		if (auto task = FindTask (worker)) {
+			Execute (task);
+			continue;
+		}
+
+		// Same protocol as the workers: announce ourselves first, then check
+		// again under the lock
+		++waitingCount_;
+		{
+			std::unique_lock<std::mutex> lock (waitMutex_);
+			waitCondition_.wait (lock, [&] () {
+				return condition () || HasQueuedTasks () ||
+					(isMainThread && mainThreadTaskCount_.load () > 0);
+			});
+		}
+		--waitingCount_;
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void TaskScheduler::RunMainThreadTasks ()
+{
+	if (std::this_thread::get_id () != mainThread_) {
+		throw std::runtime_error ("Main thread tasks must be run on the main thread");
+	}
+
+	RunMainThreadTasksImpl ();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+bool TaskScheduler::RunMainThreadTasksImpl ()
+{
+	if (mainThreadTaskCount_.load () == 0) {
+		return false;
+	}
+
+	// Only run what is ready now. Tasks scheduled by these run on the next
+	// call, so a task which resubmits itself can't keep us here forever
+	std::vector<Task*> tasks;
+	{
+		std::lock_guard<std::mutex> lock (mainThreadMutex_);
+		tasks.swap (mainThreadTasks_);
+		mainThreadTaskCount_ = 0;
+	}
+
+	for (auto task : tasks) {
+		Execute (task);
+	}
+
+	return !tasks.empty ();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void TaskScheduler::ParallelFor (const int count, const int minimumRangeSize,
+	const std::function<void (int, int)>& function)
+{
+	if (count <= 0) {
+		return;
+	}
+
+	const int threadCount = GetWorkerCount () + 1;
+	const int maximumRangeCount = (std::max) (1, (std::min) (
+		threadCount * PARALLEL_FOR_RANGES_PER_THREAD,
+		count / (std::max) (1, minimumRangeSize)));
+
+	if (maximumRangeCount == 1) {
+		function (0, count);
+		return;
+	}
+
+	const int rangeSize = (count + maximumRangeCount - 1) / maximumRangeCount;
+	const int rangeCount = (count + rangeSize - 1) / rangeSize;
+
+	// Ranges are handed out dynamically, so a helper which starts late or
+	// gets a cheap range just takes the next one
+	std::atomic<int> nextRange (0);
+	std::mutex exceptionMutex;
+	std::exception_ptr exception;
+
+	auto runRanges = [&] () {
+		for (;;) {
+			const int range = nextRange++;
+			if (range >= rangeCount) {
+				return;
+			}
+
+			try {
+				const int begin = range * rangeSize;
+				function (begin, (std::min) (count, begin + rangeSize));
+			} catch (...) {
+				std::lock_guard<std::mutex> lock (exceptionMutex);
+				if (!exception) {
+					exception = std::current_exception ();
+				}
+			}
+		}
+	};
+
+	std::vector<TaskHandle> helpers;
+	const int helperCount = (std::min) (GetWorkerCount (), rangeCount - 1);
+	helpers.reserve (helperCount);
+	for (int i = 0; i < helperCount; ++i) {
+		helpers.push_back (Submit (runRanges));
+	}
+
+	runRanges ();
+
+	for (const auto& helper : helpers) {
+		Wait (helper);
+	}
+
+	if (exception) {
+		std::rethrow_exception (exception);
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void TaskScheduler::WorkerMain (TaskWorker* worker, const int index)
+{
+	currentScheduler = this;
+	currentWorker = worker;
+
+	if (pinThreads_) {
+		PinCurrentThread ((index + 1) % GetHardwareThreadCount ());
+	}
+
+	for (;;) {
+		Task* task = nullptr;
+		for (int i = 0; i < IDLE_SPIN_COUNT && task == nullptr; ++i) {
+			task = FindTask (worker);
+
+			if (task == nullptr) {
+				std::this_thread::yield ();
+			}
+		}
+
+		if (task) {
+			Execute (task);
+			continue;
+		}
+
+		std::unique_lock<std::mutex> lock (sleepMutex_);
+		++sleepingCount_;
+		sleepCondition_.wait (lock, [this] () {
+			return stop_ || HasQueuedTasks ();
+		});
+		--sleepingCount_;
+
+		if (stop_ && !HasQueuedTasks ()) {
+			return;
+		}
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TaskWorker* TaskScheduler::GetCurrentWorker () const
+{
+	return (currentScheduler == this) ? currentWorker : nullptr;
+}
+}
@@ -0,0 +1,201 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#ifndef ANTERU_D3D12_SAMPLE_TASKSCHEDULER_H_
+#define ANTERU_D3D12_SAMPLE_TASKSCHEDULER_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace AMD {
+struct Task;
+class TaskWorker;
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Handle to a submitted task, which can be waited on or used as a dependency
+for further tasks. Handles are cheap to copy.
+
+A default constructed handle refers to no task. It counts as done, waiting
+on it returns right away and it is ignored as a dependency.
+*/
+class TaskHandle
+{
+public:
+	bool IsValid () const
+	{
+		return task_ != nullptr;
+	}
+
+	bool IsDone () const;
+
+private:
+	friend class TaskScheduler;
+
+	std::shared_ptr<Task> task_;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+struct TaskSchedulerOptions
+{
+	/**
+	Number of worker threads. Negative values use one worker per hardware
+	thread, minus one for the main thread. There is always at least one.
+	*/
+	int workerCount = -1;
+
+	/**
+	Pin worker i to hardware thread i + 1, leaving the first one to the main
+	thread.
+	*/
+	bool pinThreads = false;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Work-stealing task scheduler. Each worker owns a Chase-Lev deque; tasks
+submitted from a worker go to its own deque, where they are picked up in
+last-in, first-out order while they are still hot in the cache. Idle workers
+steal the oldest tasks of the others. Tasks submitted from other threads go
+through a shared queue.
+
+Tasks can depend on other tasks, and only start once all dependencies are
+done. Dependencies only order execution: a task still runs if one of its
+dependencies threw, the exception is rethrown by Wait on the failed task.
+
+Tasks can be bound to the main thread, which is the thread that created the
+scheduler. They run when the main thread calls RunMainThreadTasks or waits
+for a task.
+
+Waiting for a task runs other tasks in the meantime, so tasks can wait for
+the tasks they spawn without blocking a worker.
+*/
+class TaskScheduler
+{
+public:
+	TaskScheduler (const TaskScheduler&) = delete;
+	TaskScheduler& operator= (const TaskScheduler&) = delete;
+
+	explicit TaskScheduler (const TaskSchedulerOptions& options = TaskSchedulerOptions ());
+
+	/**
+	Runs all remaining tasks before returning. Must be called on the main
+	thread, as main thread tasks may still be pending.
+	*/
+	~TaskScheduler ();
+
+	/**
+	The scheduler shared by everything in the process, created on first use
+	with the options passed to SetDefaultOptions. The first call determines
+	the main thread. It is never destroyed, idle workers just sleep until
+	the process exits.
+	*/
+	static TaskScheduler& GetDefault ();
+
+	/**
+	Must be called before the first call to GetDefault, throws otherwise.
+	*/
+	static void SetDefaultOptions (const TaskSchedulerOptions& options);
+
+	int GetWorkerCount () const;
+
+	TaskHandle Submit (std::function<void ()> function);
+	TaskHandle Submit (std::function<void ()> function,
+		const std::vector<TaskHandle>& dependencies);
+
+	TaskHandle SubmitMainThread (std::function<void ()> function);
+	TaskHandle SubmitMainThread (std::function<void ()> function,
+		const std::vector<TaskHandle>& dependencies);
+
+	/**
+	Block until the task is done, running other tasks meanwhile. Rethrows
+	the exception thrown by the task, if any.
+	*/
+	void Wait (const TaskHandle& task);
+
+	/**
+	Run all main thread tasks which are ready. Must be called on the main
+	thread.
+	*/
+	void RunMainThreadTasks ();
+
+	/**
+	Split [0, count) into ranges of at least minimumRangeSize items and call
+	function (begin, end) for each range on the workers and the calling
+	thread. Blocks until all ranges are done; the first exception thrown by
+	a range is rethrown.
+	*/
+	void ParallelFor (const int count, const int minimumRangeSize,
+		const std::function<void (int, int)>& function);
+
+private:
+	TaskHandle SubmitImpl (std::function<void ()>& function,
+		const std::vector<TaskHandle>& dependencies, const bool mainThread);
+
+	void Schedule (Task* task);
+	void Execute (Task* task);
+	Task* FindTask (TaskWorker* worker);
+	bool HasQueuedTasks () const;
+	bool RunMainThreadTasksImpl ();
+	void WaitUntil (const std::function<bool ()>& condition);
+	void WorkerMain (TaskWorker* worker, const int index);
+	TaskWorker* GetCurrentWorker () const;
+
+	std::vector<std::unique_ptr<TaskWorker>> workers_;
+	std::vector<std::thread> threads_;
+	const std::thread::id mainThread_;
+
+	const bool pinThreads_;
+
+	// Tasks submitted but not done yet, including those waiting for their
+	// dependencies
+	std::atomic<int> pendingCount_;
+
+	// Tasks submitted from outside the workers
+	mutable std::mutex sharedMutex_;
+	std::deque<Task*> sharedTasks_;
+	std::atomic<int> sharedTaskCount_;
+
+	std::mutex mainThreadMutex_;
+	std::vector<Task*> mainThreadTasks_;
+	std::atomic<int> mainThreadTaskCount_;
+
+	// Idle workers sleep here until a task gets scheduled
+	std::mutex sleepMutex_;
+	std::condition_variable sleepCondition_;
+	std::atomic<int> sleepingCount_;
+	bool stop_;
+
+	// Waiting threads sleep here until a task completes or gets scheduled
+	std::mutex waitMutex_;
+	std::condition_variable waitCondition_;
+	std::atomic<int> waitingCount_;
+};
+}
+
+#endif
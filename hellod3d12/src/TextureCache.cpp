@@ -0,0 +1,378 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#include "TextureCache.h"
+
+#include "Hash.h"
+
+#include "d3dx12.h"
+#include <condition_variable>
+#include <stdexcept>
+#include <unordered_map>
+
+using namespace Microsoft::WRL;
+
+namespace AMD {
+///////////////////////////////////////////////////////////////////////////////
+TextureFactory::~TextureFactory ()
+{
+}
+
+///////////////////////////////////////////////////////////////////////////////
+D3D12TextureFactory::D3D12TextureFactory (ID3D12Device* device,
+	AssetLoader* assetLoader, ID3D12DescriptorHeap* descriptorHeap,
+	const int firstDescriptor, const int descriptorCount)
+	: device_ (device)
+	, assetLoader_ (assetLoader)
+	, descriptorHeap_ (descriptorHeap)
+{
+	descriptorSize_ = device_->GetDescriptorHandleIncrementSize (
+		D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
+
+	// Hand out the lowest slots first
+	for (int i = descriptorCount - 1; i >= 0; --i) {
+		freeDescriptors_.push_back (firstDescriptor + i);
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void D3D12TextureFactory::Create (const void* data, const std::size_t size,
+	const TextureLoadOptions& options, Callback done)
+{
+	const auto handle = assetLoader_->LoadTextureFromMemory (data, size, options);
+
+	handle.OnDone ([this, handle, done] () -> void {
+		SharedTexture texture;
+
+		try {
+			texture = CreateView (handle);
+		} catch (...) {
+			done (nullptr, std::current_exception ());
+			return;
+		}
+
+		done (&texture, nullptr);
+	});
+}
+
+///////////////////////////////////////////////////////////////////////////////
+SharedTexture D3D12TextureFactory::CreateView (const TextureHandle& handle)
+{
+	// The load is done already, this only rethrows its error
+	handle.Wait ();
+
+	SharedTexture texture;
+	texture.resource = handle.GetResource ();
+	texture.format = handle.GetFormat ();
+	texture.mipLevelCount = handle.GetMipLevelCount ();
+
+	{
+		std::lock_guard<std::mutex> lock (mutex_);
+
+		if (freeDescriptors_.empty ()) {
+			throw std::runtime_error ("Out of texture descriptors");
+		}
+
+		texture.descriptorIndex = freeDescriptors_.back ();
+		freeDescriptors_.pop_back ();
+	}
+
+	D3D12_SHADER_RESOURCE_VIEW_DESC shaderResourceViewDesc = {};
+	shaderResourceViewDesc.ViewDimension = D3D12_SRV_DIMENSION_TEXTURE2D;
+	shaderResourceViewDesc.Shader4ComponentMapping = D3D12_DEFAULT_SHADER_4_COMPONENT_MAPPING;
+	shaderResourceViewDesc.Format = texture.format;
+	shaderResourceViewDesc.Texture2D.MipLevels = texture.mipLevelCount;
+	shaderResourceViewDesc.Texture2D.MostDetailedMip = 0;
+	shaderResourceViewDesc.Texture2D.ResourceMinLODClamp = 0.0f;
+
+	device_->CreateShaderResourceView (texture.resource.Get (), &shaderResourceViewDesc,
+		CD3DX12_CPU_DESCRIPTOR_HANDLE (descriptorHeap_->GetCPUDescriptorHandleForHeapStart (),
+			texture.descriptorIndex, descriptorSize_));
+
+	texture.shaderResourceView = CD3DX12_GPU_DESCRIPTOR_HANDLE (
+		descriptorHeap_->GetGPUDescriptorHandleForHeapStart (),
+		texture.descriptorIndex, descriptorSize_);
+
+	return texture;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void D3D12TextureFactory::Destroy (const SharedTexture& texture)
+{
+	std::lock_guard<std::mutex> lock (mutex_);
+	freeDescriptors_.push_back (texture.descriptorIndex);
+}
+
+namespace {
+struct TextureKey
+{
+	std::uint64_t contentHash;
+	int maximumDimension;
+	bool blockCompression;
+	bool generateMips;
+
+	bool operator== (const TextureKey& other) const
+	{
+		return contentHash == other.contentHash &&
+			maximumDimension == other.maximumDimension &&
+			blockCompression == other.blockCompression &&
+			generateMips == other.generateMips;
+	}
+};
+
+struct TextureKeyHash
+{
+	std::size_t operator () (const TextureKey& key) const
+	{
+		// The content hash is well distributed already
+		return static_cast<std::size_t> (key.contentHash ^
+			(static_cast<std::uint64_t> (key.maximumDimension) << 2) ^
+			(key.generateMips ? 2 : 0) ^
+			(key.blockCompression ? 1 : 0));
+	}
+};
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Shared between the cache and its entries, so entries can remove themselves
+even if the cache is gone already.
+*/
+struct TextureCacheState
+{
+	TextureFactory* factory;
+
+	std::mutex mutex;
+	std::unordered_map<TextureKey, std::weak_ptr<TextureCacheEntry>, TextureKeyHash> entries;
+
+	// Loads whose factory callback has not run yet
+	int loadsInFlight = 0;
+	std::condition_variable loadCompleted;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Outcome of a load. Shared between the entry and the factory callback, as
+the entry can go away while the load is still running.
+*/
+struct TextureLoad
+{
+	std::mutex mutex;
+	std::condition_variable done;
+
+	bool isDone = false;
+	// All references were dropped before the load finished
+	bool isAbandoned = false;
+
+	SharedTexture texture;
+	std::exception_ptr error;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+struct TextureCacheEntry
+{
+	std::shared_ptr<TextureCacheState> cache;
+	TextureKey key;
+	std::shared_ptr<TextureLoad> load;
+
+	bool HasFailed () const
+	{
+		std::lock_guard<std::mutex> lock (load->mutex);
+		return load->isDone && load->error;
+	}
+
+	~TextureCacheEntry ()
+	{
+		{
+			std::lock_guard<std::mutex> lock (cache->mutex);
+
+			// A new entry for the same key may have replaced us already
+			auto it = cache->entries.find (key);
+			if (it != cache->entries.end () && it->second.expired ()) {
+				cache->entries.erase (it);
+			}
+		}
+
+		// If the load is still running, the callback destroys the texture,
+		// so whoever drops the last reference never waits for the load
+		bool destroy = false;
+		{
+			std::lock_guard<std::mutex> lock (load->mutex);
+			load->isAbandoned = !load->isDone;
+			destroy = load->isDone && !load->error;
+		}
+
+		if (destroy) {
+			cache->factory->Destroy (load->texture);
+		}
+	}
+};
+
+namespace {
+///////////////////////////////////////////////////////////////////////////////
+void CompleteLoad (TextureCacheState& cache, TextureLoad& load,
+	const SharedTexture* texture, const std::exception_ptr& error)
+{
+	bool isAbandoned;
+	{
+		std::lock_guard<std::mutex> lock (load.mutex);
+
+		if (texture) {
+			load.texture = *texture;
+		} else {
+			load.error = error;
+		}
+
+		load.isDone = true;
+		isAbandoned = load.isAbandoned;
+	}
+
+	load.done.notify_all ();
+
+	if (isAbandoned && texture) {
+		cache.factory->Destroy (*texture);
+	}
+
+	{
+		std::lock_guard<std::mutex> lock (cache.mutex);
+		--cache.loadsInFlight;
+	}
+
+	cache.loadCompleted.notify_all ();
+}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+bool TextureReference::IsReady () const
+{
+	std::lock_guard<std::mutex> lock (entry_->load->mutex);
+	return entry_->load->isDone;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+const SharedTexture& TextureReference::Get () const
+{
+	auto& load = *entry_->load;
+
+	std::unique_lock<std::mutex> lock (load.mutex);
+	load.done.wait (lock, [&load] () {
+		return load.isDone;
+	});
+
+	if (load.error) {
+		std::rethrow_exception (load.error);
+	}
+
+	return load.texture;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TextureCache::TextureCache (TextureFactory* factory)
+	: state_ (std::make_shared<TextureCacheState> ())
+{
+	state_->factory = factory;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TextureCache::~TextureCache ()
+{
+	// The callbacks still need the factory
+	std::unique_lock<std::mutex> lock (state_->mutex);
+	state_->loadCompleted.wait (lock, [this] () {
+		return state_->loadsInFlight == 0;
+	});
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TextureReference TextureCache::Acquire (const void* data, const std::size_t size,
+	const TextureLoadOptions& options)
+{
+	TextureKey key;
+	key.contentHash = HashXXH3 (data, size);
+	key.maximumDimension = options.maximumDimension;
+	key.blockCompression = options.blockCompression;
+	key.generateMips = options.generateMips;
+
+	TextureReference result;
+
+	// Destroying an entry takes the lock, so a failed entry we drop must
+	// only go away after the lock has been released
+	std::shared_ptr<TextureCacheEntry> failedEntry;
+
+	{
+		std::lock_guard<std::mutex> lock (state_->mutex);
+
+		auto it = state_->entries.find (key);
+		if (it != state_->entries.end ()) {
+			result.entry_ = it->second.lock ();
+
+			// Retry failed loads instead of handing out the same error
+			// forever
+			if (result.entry_ && result.entry_->HasFailed ()) {
+				failedEntry = std::move (result.entry_);
+			}
+
+			if (result.entry_) {
+				return result;
+			}
+		}
+
+		result.entry_ = std::make_shared<TextureCacheEntry> ();
+		result.entry_->cache = state_;
+		result.entry_->key = key;
+		result.entry_->load = std::make_shared<TextureLoad> ();
+
+		state_->entries [key] = result.entry_;
+		++state_->loadsInFlight;
+	}
+
+	// Outside of the lock, as the callback takes it and may run right away
+	const auto cache = state_;
+	const auto load = result.entry_->load;
+
+	try {
+		state_->factory->Create (data, size, options,
+			[cache, load] (const SharedTexture* texture, const std::exception_ptr& error) -> void {
+			CompleteLoad (*cache, *load, texture, error);
+		});
+	} catch (...) {
+		CompleteLoad (*cache, *load, nullptr, std::current_exception ());
+	}
+
+	return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int TextureCache::GetTextureCount () const
+{
+	std::lock_guard<std::mutex> lock (state_->mutex);
+
+	int count = 0;
+	for (const auto& entry : state_->entries) {
+		if (!entry.second.expired ()) {
+			++count;
+		}
+	}
+
+	return count;
+}
+}
@@ -0,0 +1,190 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#ifndef ANTERU_D3D12_SAMPLE_TEXTURECACHE_H_
+#define ANTERU_D3D12_SAMPLE_TEXTURECACHE_H_
+
+#include "AssetLoader.h"
+
+#include <d3d12.h>
+#include <wrl.h>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace AMD {
+///////////////////////////////////////////////////////////////////////////////
+/**
+A texture together with its shader resource view.
+*/
+struct SharedTexture
+{
+	Microsoft::WRL::ComPtr<ID3D12Resource> resource;
+	DXGI_FORMAT format;
+	int mipLevelCount;
+
+	// Slot in the descriptor heap used by the factory
+	int descriptorIndex;
+	D3D12_GPU_DESCRIPTOR_HANDLE shaderResourceView;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Creates and destroys the textures of a TextureCache. Separate from the cache,
+so the cache logic can run against a fake device.
+*/
+class TextureFactory
+{
+public:
+	/**
+	Receives the texture on success, or nullptr and the error on failure.
+	*/
+	typedef std::function<void (const SharedTexture* texture,
+		const std::exception_ptr& error)> Callback;
+
+	virtual ~TextureFactory ();
+
+	/**
+	Start loading a texture and creating its view, without blocking. done
+	must be called exactly once, from any thread, and may be called before
+	Create returns. It does little work and doesn't block.
+	*/
+	virtual void Create (const void* data, const std::size_t size,
+		const TextureLoadOptions& options, Callback done) = 0;
+
+	/**
+	Called once the last reference to a texture is gone. The GPU must be
+	done with it at this point.
+	*/
+	virtual void Destroy (const SharedTexture& texture) = 0;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Creates textures through an AssetLoader and places their views into a
+range of a shader-visible descriptor heap.
+*/
+class D3D12TextureFactory : public TextureFactory
+{
+public:
+	D3D12TextureFactory (ID3D12Device* device, AssetLoader* assetLoader,
+		ID3D12DescriptorHeap* descriptorHeap,
+		const int firstDescriptor, const int descriptorCount);
+
+	/**
+	Completes from TextureHandle::OnDone, on a loader thread.
+	*/
+	void Create (const void* data, const std::size_t size,
+		const TextureLoadOptions& options, Callback done) override;
+	void Destroy (const SharedTexture& texture) override;
+
+private:
+	SharedTexture CreateView (const TextureHandle& handle);
+
+	Microsoft::WRL::ComPtr<ID3D12Device> device_;
+	AssetLoader* assetLoader_;
+
+	Microsoft::WRL::ComPtr<ID3D12DescriptorHeap> descriptorHeap_;
+	UINT descriptorSize_;
+
+	std::mutex mutex_;
+	std::vector<int> freeDescriptors_;
+};
+
+struct TextureCacheState;
+struct TextureCacheEntry;
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Reference to a texture owned by a TextureCache. Copies share the texture; it
+gets destroyed when the last reference goes away.
+*/
+class TextureReference
+{
+public:
+	bool IsValid () const
+	{
+		return entry_ != nullptr;
+	}
+
+	/**
+	True once the load has finished, successfully or not.
+	*/
+	bool IsReady () const;
+
+	/**
+	Blocks until the load has finished, and rethrows its error if it
+	failed.
+	*/
+	const SharedTexture& Get () const;
+
+private:
+	friend class TextureCache;
+	std::shared_ptr<TextureCacheEntry> entry_;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Deduplicates textures by content.
+
+Textures are identified by the hash of their source bytes together with the
+load options, so the same image loaded from different places ends up as one
+GPU texture. Requests for a texture which is still loading share the
+in-flight load instead of starting a new one. Failed loads are not cached.
+
+Nothing blocks except TextureReference::Get and the destructor: loads
+complete through the factory callback, and if the last reference to a
+texture goes away while it is still loading, the texture is destroyed once
+the load finishes. The destructor waits for all loads in flight.
+
+The factory must outlive the cache and all references; the cache itself can
+go away while references still exist.
+*/
+class TextureCache
+{
+public:
+	TextureCache (const TextureCache&) = delete;
+	TextureCache& operator= (const TextureCache&) = delete;
+
+	explicit TextureCache (TextureFactory* factory);
+	~TextureCache ();
+
+	/**
+	data must stay valid until the returned reference is ready.
+	*/
+	TextureReference Acquire (const void* data, const std::size_t size,
+		const TextureLoadOptions& options = TextureLoadOptions ());
+
+	/**
+	Number of distinct textures which are alive or loading.
+	*/
+	int GetTextureCount () const;
+
+private:
+	std::shared_ptr<TextureCacheState> state_;
+};
+}
+
+#endif
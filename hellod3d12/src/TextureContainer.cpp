@@ -0,0 +1,286 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#include "TextureContainer.h"
+
+#include "CopyableFootprints.h"
+#include "Utility.h"
+
+#include "d3dx12.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <stdexcept>
+#include <vector>
+
+namespace AMD {
+namespace {
+const char TEXTURE_CONTAINER_MAGIC [4] = { 'A', 'T', 'E', 'X' };
+const std::uint32_t TEXTURE_CONTAINER_VERSION = 1;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void WriteTextureContainer (const char* path, const DXGI_FORMAT format,
+	const int width, const int height, const int arraySize, const int mipLevels,
+	const TextureContainerSource* sources)
+{
+	const int subresourceCount = arraySize * mipLevels;
+	if (subresourceCount <= 0) {
+		throw std::runtime_error ("Texture container needs at least one subresource");
+	}
+
+	TextureContainerHeader header = {};
+	std::memcpy (header.magic, TEXTURE_CONTAINER_MAGIC, sizeof (header.magic));
+	header.version = TEXTURE_CONTAINER_VERSION;
+	header.format = format;
+	header.width = width;
+	header.height = height;
+	header.arraySize = arraySize;
+	header.mipLevels = mipLevels;
+	header.subresourceCount = subresourceCount;
+	header.dataOffset = RoundToNextMultiple<std::uint64_t> (
+		sizeof (TextureContainerHeader) +
+		sizeof (TextureContainerSubresource) * subresourceCount,
+		D3D12_TEXTURE_DATA_PLACEMENT_ALIGNMENT);
+
+	const auto desc = CD3DX12_RESOURCE_DESC::Tex2D (format, width, height,
+		static_cast<UINT16> (arraySize), static_cast<UINT16> (mipLevels));
+
+	std::vector<D3D12_PLACED_SUBRESOURCE_FOOTPRINT> layouts (subresourceCount);
+	std::vector<UINT> rowCounts (subresourceCount);
+	std::vector<UINT64> rowSizes (subresourceCount);
+	GetCopyableFootprints (desc, 0, subresourceCount, 0,
+		layouts.data (), rowCounts.data (), rowSizes.data (), nullptr);
+
+	std::vector<TextureContainerSubresource> subresources (subresourceCount);
+	for (int i = 0; i < subresourceCount; ++i) {
+		if (sources [i].rowCount != static_cast<int> (rowCounts [i]) ||
+			sources [i].rowSize != static_cast<int> (rowSizes [i])) {
+			throw std::runtime_error ("Texture container source does not match its footprint");
+		}
+
+		auto& subresource = subresources [i];
+		subresource.offset = layouts [i].Offset;
+		subresource.width = layouts [i].Footprint.Width;
+		subresource.height = layouts [i].Footprint.Height;
+		subresource.rowPitch = layouts [i].Footprint.RowPitch;
+		subresource.rowCount = rowCounts [i];
+		subresource.rowSize = static_cast<std::uint32_t> (rowSizes [i]);
+		subresource.reserved = 0;
+	}
+
+	// Keep the padding of the last row, so the whole block can be copied
+	// with a single memcpy
+	header.dataSize = layouts.back ().Offset +
+		static_cast<std::uint64_t> (layouts.back ().Footprint.RowPitch) * rowCounts.back ();
+
+	std::vector<std::uint8_t> data (static_cast<std::size_t> (header.dataSize));
+	for (int i = 0; i < subresourceCount; ++i) {
+		const auto& subresource = subresources [i];
+		const auto input = static_cast<const std::uint8_t*> (sources [i].data);
+
+		for (std::uint32_t row = 0; row < subresource.rowCount; ++row) {
+			std::memcpy (data.data () + subresource.offset + row * subresource.rowPitch,
+				input + row * sources [i].rowPitch, subresource.rowSize);
+		}
+	}
+
+	auto file = std::fopen (path, "wb");
+	if (file == nullptr) {
+		throw std::runtime_error ("Could not open texture container for writing");
+	}
+
+	const std::vector<std::uint8_t> padding (static_cast<std::size_t> (header.dataOffset -
+		sizeof (TextureContainerHeader) -
+		sizeof (TextureContainerSubresource) * subresourceCount));
+
+	bool ok = std::fwrite (&header, sizeof (header), 1, file) == 1;
+	ok = ok && std::fwrite (subresources.data (), sizeof (TextureContainerSubresource),
+		subresources.size (), file) == subresources.size ();
+	ok = ok && std::fwrite (padding.data (), 1, padding.size (), file) == padding.size ();
+	ok = ok && std::fwrite (data.data (), 1, data.size (), file) == data.size ();
+	ok = (std::fclose (file) == 0) && ok;
+
+	if (!ok) {
+		throw std::runtime_error ("Could not write texture container");
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TextureContainer::TextureContainer (const char* path)
+	: file_ (new FileView (path))
+{
+	const auto bytes = static_cast<const std::uint8_t*> (file_->GetData ());
+	const auto size = file_->GetSize ();
+
+	if (size < sizeof (TextureContainerHeader)) {
+		throw std::runtime_error ("Texture container is truncated");
+	}
+
+	header_ = reinterpret_cast<const TextureContainerHeader*> (bytes);
+
+	if (std::memcmp (header_->magic, TEXTURE_CONTAINER_MAGIC, sizeof (header_->magic)) != 0 ||
+		header_->version != TEXTURE_CONTAINER_VERSION) {
+		throw std::runtime_error ("Not a texture container");
+	}
+
+	// Everything below is computed from these, so bound them first. The
+	// limits are the ones of resource creation
+	FormatBlockInfo blockInfo;
+	std::uint32_t mipChainLength = 1;
+	while (((std::max) (header_->width, header_->height) >> mipChainLength) > 0) {
+		++mipChainLength;
+	}
+
+	if (!GetFormatBlockInfo (static_cast<DXGI_FORMAT> (header_->format), &blockInfo) ||
+		header_->width == 0 || header_->width > D3D12_REQ_TEXTURE2D_U_OR_V_DIMENSION ||
+		header_->height == 0 || header_->height > D3D12_REQ_TEXTURE2D_U_OR_V_DIMENSION ||
+		header_->arraySize == 0 || header_->arraySize > D3D12_REQ_TEXTURE2D_ARRAY_AXIS_DIMENSION ||
+		header_->mipLevels == 0 || header_->mipLevels > mipChainLength ||
+		header_->subresourceCount != static_cast<std::uint64_t> (header_->arraySize) * header_->mipLevels) {
+		throw std::runtime_error ("Texture container is corrupt");
+	}
+
+	// Written so nothing can overflow, the offsets come from the file
+	if (sizeof (TextureContainerHeader) +
+		sizeof (TextureContainerSubresource) * static_cast<std::uint64_t> (header_->subresourceCount) > header_->dataOffset ||
+		header_->dataOffset > size ||
+		header_->dataSize > size - header_->dataOffset) {
+		throw std::runtime_error ("Texture container is corrupt");
+	}
+
+	subresources_ = reinterpret_cast<const TextureContainerSubresource*> (
+		bytes + sizeof (TextureContainerHeader));
+	data_ = bytes + header_->dataOffset;
+
+	// RecordUpload reads the whole data block, get it paged in while we
+	// validate the rest
+	file_->Prefetch (static_cast<std::size_t> (header_->dataOffset),
+		static_cast<std::size_t> (header_->dataSize));
+
+	// The layout must match what the GPU copy expects, which we can compute
+	// without a device
+	std::vector<D3D12_PLACED_SUBRESOURCE_FOOTPRINT> layouts (header_->subresourceCount);
+	std::vector<UINT> rowCounts (header_->subresourceCount);
+	std::vector<UINT64> rowSizes (header_->subresourceCount);
+	GetCopyableFootprints (GetResourceDesc (), 0, header_->subresourceCount, 0,
+		layouts.data (), rowCounts.data (), rowSizes.data (), nullptr);
+
+	for (std::uint32_t i = 0; i < header_->subresourceCount; ++i) {
+		const auto& subresource = subresources_ [i];
+
+		if (subresource.offset != layouts [i].Offset ||
+			subresource.width != layouts [i].Footprint.Width ||
+			subresource.height != layouts [i].Footprint.Height ||
+			subresource.rowPitch != layouts [i].Footprint.RowPitch ||
+			subresource.rowCount != rowCounts [i] ||
+			subresource.rowSize != rowSizes [i] ||
+			subresource.offset + static_cast<std::uint64_t> (subresource.rowPitch) *
+				subresource.rowCount > header_->dataSize) {
+			throw std::runtime_error ("Texture container is corrupt");
+		}
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TextureContainer::~TextureContainer ()
+{
+}
+
+///////////////////////////////////////////////////////////////////////////////
+const TextureContainerHeader& TextureContainer::GetHeader () const
+{
+	return *header_;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+const TextureContainerSubresource& TextureContainer::GetSubresource (const int index) const
+{
+	return subresources_ [index];
+}
+
+///////////////////////////////////////////////////////////////////////////////
+D3D12_RESOURCE_DESC TextureContainer::GetResourceDesc () const
+{
+	return CD3DX12_RESOURCE_DESC::Tex2D (
+		static_cast<DXGI_FORMAT> (header_->format),
+		header_->width, header_->height,
+		static_cast<UINT16> (header_->arraySize),
+		static_cast<UINT16> (header_->mipLevels));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+D3D12_SUBRESOURCE_DATA TextureContainer::GetSubresourceData (const int index) const
+{
+	const auto& subresource = subresources_ [index];
+
+	D3D12_SUBRESOURCE_DATA result;
+	result.pData = data_ + subresource.offset;
+	result.RowPitch = subresource.rowPitch;
+	result.SlicePitch = static_cast<LONG_PTR> (subresource.rowPitch) * subresource.rowCount;
+
+	return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::uint64_t TextureContainer::GetUploadSize () const
+{
+	return header_->dataSize;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void TextureContainer::RecordUpload (ID3D12GraphicsCommandList* commandList,
+	ID3D12Resource* destination,
+	ID3D12Resource* uploadBuffer, const std::uint64_t uploadOffset) const
+{
+	if (uploadOffset % D3D12_TEXTURE_DATA_PLACEMENT_ALIGNMENT != 0) {
+		throw std::runtime_error ("Upload offset must be placement aligned");
+	}
+
+	// The data is already laid out for the GPU, so this is one large copy.
+	// We don't read anything back, hence the empty read range.
+	const CD3DX12_RANGE readRange (0, 0);
+	void* p;
+	uploadBuffer->Map (0, &readRange, &p);
+	std::memcpy (static_cast<std::uint8_t*> (p) + uploadOffset, data_,
+		static_cast<std::size_t> (header_->dataSize));
+	const CD3DX12_RANGE writtenRange (static_cast<SIZE_T> (uploadOffset),
+		static_cast<SIZE_T> (uploadOffset + header_->dataSize));
+	uploadBuffer->Unmap (0, &writtenRange);
+
+	for (std::uint32_t i = 0; i < header_->subresourceCount; ++i) {
+		const auto& subresource = subresources_ [i];
+
+		D3D12_PLACED_SUBRESOURCE_FOOTPRINT footprint;
+		footprint.Offset = uploadOffset + subresource.offset;
+		footprint.Footprint.Format = static_cast<DXGI_FORMAT> (header_->format);
+		footprint.Footprint.Width = subresource.width;
+		footprint.Footprint.Height = subresource.height;
+		footprint.Footprint.Depth = 1;
+		footprint.Footprint.RowPitch = subresource.rowPitch;
+
+		const CD3DX12_TEXTURE_COPY_LOCATION dst (destination, i);
+		const CD3DX12_TEXTURE_COPY_LOCATION src (uploadBuffer, footprint);
+		commandList->CopyTextureRegion (&dst, 0, 0, 0, &src, nullptr);
+	}
+}
+}
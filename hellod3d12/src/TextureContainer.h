@@ -0,0 +1,149 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#ifndef ANTERU_D3D12_SAMPLE_TEXTURECONTAINER_H_
+#define ANTERU_D3D12_SAMPLE_TEXTURECONTAINER_H_
+
+#include <d3d12.h>
+#include <cstdint>
+#include <memory>
+
+namespace AMD {
+class FileView;
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Texture container file layout. All values are little-endian.
+
+The file starts with a TextureContainerHeader, followed by
+subresourceCount TextureContainerSubresource entries in D3D12 subresource
+order (all mips of array slice 0, then slice 1, ...). The subresource data
+starts at dataOffset and is laid out exactly like GetCopyableFootprints
+would place it into an upload buffer: every subresource starts at a multiple
+of D3D12_TEXTURE_DATA_PLACEMENT_ALIGNMENT and rows are
+D3D12_TEXTURE_DATA_PITCH_ALIGNMENT aligned. Loading is thus a single copy of
+the data block into the upload heap.
+
+tools/textureToContainer.py converts images into this format offline.
+*/
+struct TextureContainerHeader
+{
+	char magic [4];
+	std::uint32_t version;
+	std::uint32_t format;
+	std::uint32_t width;
+	std::uint32_t height;
+	std::uint32_t arraySize;
+	std::uint32_t mipLevels;
+	std::uint32_t subresourceCount;
+	std::uint64_t dataOffset;
+	std::uint64_t dataSize;
+};
+
+struct TextureContainerSubresource
+{
+	// Relative to dataOffset
+	std::uint64_t offset;
+	// Footprint size, rounded up to the block size for block compressed
+	// formats
+	std::uint32_t width;
+	std::uint32_t height;
+	std::uint32_t rowPitch;
+	// For block compressed formats, this is the number of block rows
+	std::uint32_t rowCount;
+	std::uint32_t rowSize;
+	std::uint32_t reserved;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Source data for one subresource when writing a container.
+*/
+struct TextureContainerSource
+{
+	const void* data;
+	std::size_t rowPitch;
+	int width;
+	int height;
+	int rowCount;
+	int rowSize;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Write a texture container. sources must contain arraySize * mipLevels
+entries in D3D12 subresource order.
+*/
+void WriteTextureContainer (const char* path, const DXGI_FORMAT format,
+	const int width, const int height, const int arraySize, const int mipLevels,
+	const TextureContainerSource* sources);
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+A memory-mapped texture container. The header is validated on load, the
+subresource data is only touched when it gets copied into the upload heap.
+Reading it from disk starts in the background right away.
+*/
+class TextureContainer
+{
+public:
+	TextureContainer (const TextureContainer&) = delete;
+	TextureContainer& operator= (const TextureContainer&) = delete;
+
+	explicit TextureContainer (const char* path);
+	~TextureContainer ();
+
+	const TextureContainerHeader& GetHeader () const;
+	const TextureContainerSubresource& GetSubresource (const int index) const;
+
+	D3D12_RESOURCE_DESC GetResourceDesc () const;
+
+	/**
+	Points into the mapped file, for uploads which need the data of each
+	subresource, for instance through TextureUploadBatch.
+	*/
+	D3D12_SUBRESOURCE_DATA GetSubresourceData (const int index) const;
+
+	/**
+	Size of the upload buffer region needed by RecordUpload.
+	*/
+	std::uint64_t GetUploadSize () const;
+
+	/**
+	Copy all subresources into uploadBuffer at uploadOffset and record the
+	copies into destination. uploadOffset must be a multiple of
+	D3D12_TEXTURE_DATA_PLACEMENT_ALIGNMENT. The destination must be in the
+	COPY_DEST state.
+	*/
+	void RecordUpload (ID3D12GraphicsCommandList* commandList,
+		ID3D12Resource* destination,
+		ID3D12Resource* uploadBuffer, const std::uint64_t uploadOffset) const;
+
+private:
+	std::unique_ptr<FileView> file_;
+	const TextureContainerHeader* header_;
+	const TextureContainerSubresource* subresources_;
+	const std::uint8_t* data_;
+};
+}
+
+#endif
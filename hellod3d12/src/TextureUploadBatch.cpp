@@ -0,0 +1,213 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#include "TextureUploadBatch.h"
+
+#include "CopyableFootprints.h"
+#include "UploadCopy.h"
+#include "Utility.h"
+
+#include "d3dx12.h"
+#include <stdexcept>
+
+namespace AMD {
+///////////////////////////////////////////////////////////////////////////////
+void TextureUploadBatch::Add (ID3D12Resource* texture,
+	const D3D12_SUBRESOURCE_DATA* subresources, const UINT subresourceCount,
+	const D3D12_RESOURCE_STATES finalState)
+{
+	const auto desc = texture->GetDesc ();
+
+	if (desc.Dimension == D3D12_RESOURCE_DIMENSION_BUFFER) {
+		throw std::runtime_error ("Texture upload batches don't support buffers");
+	}
+
+	Texture entry;
+	entry.resource = texture;
+	entry.finalState = finalState;
+	entry.firstSubresource = layouts_.size ();
+	entry.subresourceCount = subresourceCount;
+
+	// Each texture continues where the previous one ended
+	const auto baseOffset = RoundToNextMultiple<std::uint64_t> (size_,
+		D3D12_TEXTURE_DATA_PLACEMENT_ALIGNMENT);
+	std::uint64_t totalBytes = 0;
+
+	// Compute into temporaries and only append once nothing can throw any
+	// more, so a failed Add leaves the batch as it was
+	std::vector<D3D12_PLACED_SUBRESOURCE_FOOTPRINT> layouts (subresourceCount);
+	std::vector<UINT> rowCounts (subresourceCount);
+	std::vector<UINT64> rowSizes (subresourceCount);
+
+	GetCopyableFootprints (desc, 0, subresourceCount, baseOffset,
+		layouts.data (), rowCounts.data (), rowSizes.data (), &totalBytes);
+
+	textures_.reserve (textures_.size () + 1);
+	sources_.reserve (sources_.size () + subresourceCount);
+	layouts_.reserve (layouts_.size () + subresourceCount);
+	rowCounts_.reserve (rowCounts_.size () + subresourceCount);
+	rowSizes_.reserve (rowSizes_.size () + subresourceCount);
+
+	sources_.insert (sources_.end (), subresources, subresources + subresourceCount);
+	layouts_.insert (layouts_.end (), layouts.begin (), layouts.end ());
+	rowCounts_.insert (rowCounts_.end (), rowCounts.begin (), rowCounts.end ());
+	rowSizes_.insert (rowSizes_.end (), rowSizes.begin (), rowSizes.end ());
+	textures_.push_back (entry);
+
+	size_ = baseOffset + totalBytes;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void TextureUploadBatch::AddStaged (ID3D12Resource* texture,
+	ID3D12Resource* uploadBuffer, const D3D12_PLACED_SUBRESOURCE_FOOTPRINT& layout,
+	const D3D12_RESOURCE_STATES finalState)
+{
+	if (texture->GetDesc ().Dimension == D3D12_RESOURCE_DIMENSION_BUFFER) {
+		throw std::runtime_error ("Texture upload batches don't support buffers");
+	}
+
+	if (layout.Offset % D3D12_TEXTURE_DATA_PLACEMENT_ALIGNMENT != 0) {
+		throw std::runtime_error ("Staged layout must be placement aligned");
+	}
+
+	StagedTexture entry;
+	entry.resource = texture;
+	entry.uploadBuffer = uploadBuffer;
+	entry.layout = layout;
+	entry.finalState = finalState;
+	stagedTextures_.push_back (entry);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::uint64_t TextureUploadBatch::GetUploadSize () const
+{
+	return size_;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void TextureUploadBatch::Record (ID3D12GraphicsCommandList* commandList,
+	ID3D12Resource* uploadBuffer, const std::uint64_t uploadOffset)
+{
+	if (IsEmpty ()) {
+		return;
+	}
+
+	// Staged textures don't need the upload buffer, it may be missing if
+	// there is nothing else
+	if (!textures_.empty ()) {
+		if (uploadOffset % D3D12_TEXTURE_DATA_PLACEMENT_ALIGNMENT != 0) {
+			throw std::runtime_error ("Upload offset must be placement aligned");
+		}
+
+		if (uploadBuffer->GetDesc ().Width < uploadOffset + size_) {
+			throw std::runtime_error ("Upload buffer too small for batch");
+		}
+
+		// We don't read anything back, hence the empty read range
+		const CD3DX12_RANGE readRange (0, 0);
+		BYTE* data;
+		if (FAILED (uploadBuffer->Map (0, &readRange, reinterpret_cast<void**> (&data)))) {
+			throw std::runtime_error ("Could not map upload buffer");
+		}
+
+		for (std::size_t i = 0; i < layouts_.size (); ++i) {
+			const D3D12_MEMCPY_DEST destination = {
+				data + uploadOffset + layouts_ [i].Offset,
+				layouts_ [i].Footprint.RowPitch,
+				static_cast<SIZE_T> (layouts_ [i].Footprint.RowPitch) * rowCounts_ [i]
+			};
+
+			MemcpySubresourceStreaming (&destination, &sources_ [i],
+				static_cast<SIZE_T> (rowSizes_ [i]), rowCounts_ [i],
+				layouts_ [i].Footprint.Depth);
+		}
+
+		const CD3DX12_RANGE writtenRange (static_cast<SIZE_T> (uploadOffset),
+			static_cast<SIZE_T> (uploadOffset + size_));
+		uploadBuffer->Unmap (0, &writtenRange);
+	}
+
+	std::vector<D3D12_RESOURCE_BARRIER> barriers;
+	barriers.reserve (textures_.size () + stagedTextures_.size ());
+
+	for (const auto& texture : textures_) {
+		for (UINT i = 0; i < texture.subresourceCount; ++i) {
+			auto layout = layouts_ [texture.firstSubresource + i];
+			layout.Offset += uploadOffset;
+
+			const CD3DX12_TEXTURE_COPY_LOCATION destination (texture.resource, i);
+			const CD3DX12_TEXTURE_COPY_LOCATION source (uploadBuffer, layout);
+			commandList->CopyTextureRegion (&destination, 0, 0, 0, &source, nullptr);
+		}
+
+		barriers.push_back (CD3DX12_RESOURCE_BARRIER::Transition (texture.resource,
+			D3D12_RESOURCE_STATE_COPY_DEST, texture.finalState));
+	}
+
+	for (const auto& texture : stagedTextures_) {
+		const CD3DX12_TEXTURE_COPY_LOCATION destination (texture.resource, 0);
+		const CD3DX12_TEXTURE_COPY_LOCATION source (texture.uploadBuffer, texture.layout);
+		commandList->CopyTextureRegion (&destination, 0, 0, 0, &source, nullptr);
+
+		barriers.push_back (CD3DX12_RESOURCE_BARRIER::Transition (texture.resource,
+			D3D12_RESOURCE_STATE_COPY_DEST, texture.finalState));
+	}
+
+	commandList->ResourceBarrier (static_cast<UINT> (barriers.size ()), barriers.data ());
+
+	textures_.clear ();
+	stagedTextures_.clear ();
+	sources_.clear ();
+	layouts_.clear ();
+	rowCounts_.clear ();
+	rowSizes_.clear ();
+	size_ = 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Microsoft::WRL::ComPtr<ID3D12Resource> TextureUploadBatch::Record (
+	ID3D12Device* device, ID3D12GraphicsCommandList* commandList)
+{
+	Microsoft::WRL::ComPtr<ID3D12Resource> uploadBuffer;
+
+	if (textures_.empty ()) {
+		Record (commandList, nullptr, 0);
+		return uploadBuffer;
+	}
+
+	static const auto uploadHeapProperties = CD3DX12_HEAP_PROPERTIES (D3D12_HEAP_TYPE_UPLOAD);
+	const auto uploadBufferDesc = CD3DX12_RESOURCE_DESC::Buffer (size_);
+
+	if (FAILED (device->CreateCommittedResource (&uploadHeapProperties,
+		D3D12_HEAP_FLAG_NONE,
+		&uploadBufferDesc,
+		D3D12_RESOURCE_STATE_GENERIC_READ,
+		nullptr,
+		IID_PPV_ARGS (&uploadBuffer)))) {
+		throw std::runtime_error ("Could not create upload buffer");
+	}
+
+	Record (commandList, uploadBuffer.Get (), 0);
+
+	return uploadBuffer;
+}
+}
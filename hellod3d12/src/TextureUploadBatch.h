@@ -0,0 +1,126 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#ifndef ANTERU_D3D12_SAMPLE_TEXTUREUPLOADBATCH_H_
+#define ANTERU_D3D12_SAMPLE_TEXTUREUPLOADBATCH_H_
+
+#include <d3d12.h>
+#include <wrl.h>
+#include <cstdint>
+#include <vector>
+
+namespace AMD {
+///////////////////////////////////////////////////////////////////////////////
+/**
+Upload many textures at once.
+
+All subresources of all textures are placed into a single staging buffer.
+Their footprints are computed on the CPU as textures get added, so the
+staging size is known before anything gets allocated. Recording maps the
+staging buffer once, records all copies and transitions every texture with
+a single ResourceBarrier call.
+
+The source data passed to Add is not copied and must stay valid until Record
+has been called.
+*/
+class TextureUploadBatch
+{
+public:
+	/**
+	Queue all subresources of texture for upload. The texture must be in the
+	COPY_DEST state, it will be transitioned to finalState after the copy.
+	subresources must contain one entry per subresource in D3D12 subresource
+	order.
+	*/
+	void Add (ID3D12Resource* texture,
+		const D3D12_SUBRESOURCE_DATA* subresources, const UINT subresourceCount,
+		const D3D12_RESOURCE_STATES finalState);
+
+	/**
+	Queue a texture with a single subresource whose data has already been
+	written to uploadBuffer at layout, for instance by decoding straight into
+	it. Only the copy and the transition get recorded, so it needs no staging
+	memory in the batch. uploadBuffer must stay alive until the command list
+	has finished executing.
+	*/
+	void AddStaged (ID3D12Resource* texture, ID3D12Resource* uploadBuffer,
+		const D3D12_PLACED_SUBRESOURCE_FOOTPRINT& layout,
+		const D3D12_RESOURCE_STATES finalState);
+
+	/**
+	Size of the staging memory needed for everything added so far.
+	*/
+	std::uint64_t GetUploadSize () const;
+
+	bool IsEmpty () const
+	{
+		return textures_.empty () && stagedTextures_.empty ();
+	}
+
+	/**
+	Copy into uploadBuffer at uploadOffset, which must be a multiple of
+	D3D12_TEXTURE_DATA_PLACEMENT_ALIGNMENT, and record the copies and
+	barriers. The batch is empty afterwards.
+	*/
+	void Record (ID3D12GraphicsCommandList* commandList,
+		ID3D12Resource* uploadBuffer, const std::uint64_t uploadOffset);
+
+	/**
+	Create a committed upload buffer of the right size and record into it.
+	The returned buffer must be kept alive until the command list has
+	finished executing. It is nullptr if only staged textures were added.
+	*/
+	Microsoft::WRL::ComPtr<ID3D12Resource> Record (ID3D12Device* device,
+		ID3D12GraphicsCommandList* commandList);
+
+private:
+	struct Texture
+	{
+		ID3D12Resource* resource;
+		D3D12_RESOURCE_STATES finalState;
+		// Range in the subresource arrays below
+		std::size_t firstSubresource;
+		UINT subresourceCount;
+	};
+
+	struct StagedTexture
+	{
+		ID3D12Resource* resource;
+		ID3D12Resource* uploadBuffer;
+		D3D12_PLACED_SUBRESOURCE_FOOTPRINT layout;
+		D3D12_RESOURCE_STATES finalState;
+	};
+
+	std::vector<Texture> textures_;
+	std::vector<StagedTexture> stagedTextures_;
+
+	std::vector<D3D12_SUBRESOURCE_DATA> sources_;
+	// Offsets relative to the start of the batch
+	std::vector<D3D12_PLACED_SUBRESOURCE_FOOTPRINT> layouts_;
+	std::vector<UINT> rowCounts_;
+	std::vector<UINT64> rowSizes_;
+
+	std::uint64_t size_ = 0;
+};
+}
+
+#endif
@@ -0,0 +1,135 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+
+#ifndef ANTERU_D3D12_SAMPLE_TRIPLEBUFFER_H_
+#define ANTERU_D3D12_SAMPLE_TRIPLEBUFFER_H_
+
+#include <atomic>
+
+namespace AMD {
+///////////////////////////////////////////////////////////////////////////////
+/**
+Lock-free handoff of the latest value from one writer thread to one reader
+thread.
+
+The writer fills the back buffer and publishes it, the reader picks up the
+most recently published buffer. Neither side ever waits for the other: the
+writer always has a buffer it owns, and if it publishes twice before the
+reader looks, the older value is dropped.
+
+The buffer in the middle is swapped with a single atomic exchange on each
+side. The index is tagged with a bit which tells whether the middle buffer
+holds a value the reader hasn't seen yet.
+*/
+template <typename T>
+class TripleBuffer
+{
+public:
+	TripleBuffer (const TripleBuffer&) = delete;
+	TripleBuffer& operator= (const TripleBuffer&) = delete;
+
+	TripleBuffer ()
+		: middle_ (1)
+		, back_ (0)
+		, front_ (2)
+	{
+	}
+
+	/**
+	All three buffers start as a copy of value.
+	*/
+	explicit TripleBuffer (const T& value)
+		: middle_ (1)
+		, back_ (0)
+		, front_ (2)
+	{
+		buffers_ [0] = value;
+		buffers_ [1] = value;
+		buffers_ [2] = value;
+	}
+
+	/**
+	Writer only. The buffer to fill before calling Publish. Its contents are
+	whatever was written into it last time it was the back buffer.
+	*/
+	T& GetBackBuffer ()
+	{
+		return buffers_ [back_];
+	}
+
+	/**
+	Writer only. Make the back buffer available to the reader and take over
+	the middle buffer as the new back buffer.
+	*/
+	void Publish ()
+	{
+		back_ = middle_.exchange (back_ | FRESH, std::memory_order_acq_rel) & INDEX_MASK;
+	}
+
+	/**
+	Writer and reader. Whether a published buffer hasn't been picked up by
+	the reader yet.
+	*/
+	bool HasPending () const
+	{
+		return (middle_.load (std::memory_order_acquire) & FRESH) != 0;
+	}
+
+	/**
+	Reader only. Make the newest published buffer the front buffer. Returns
+	false and leaves the front buffer alone if nothing was published since
+	the last call.
+	*/
+	bool Consume ()
+	{
+		if (!HasPending ()) {
+			return false;
+		}
+
+		front_ = middle_.exchange (front_, std::memory_order_acq_rel) & INDEX_MASK;
+		return true;
+	}
+
+	/**
+	Reader only. The buffer picked up by the last successful Consume.
+	*/
+	const T& GetFrontBuffer () const
+	{
+		return buffers_ [front_];
+	}
+
+private:
+	static const int INDEX_MASK = 3;
+	static const int FRESH = 4;
+
+	T buffers_ [3];
+
+	std::atomic<int> middle_;
+
+	// Each owned by one side, so they don't need to be atomic
+	int back_;
+	int front_;
+};
+}
+
+#endif
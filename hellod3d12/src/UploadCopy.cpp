@@ -0,0 +1,304 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#include "UploadCopy.h"
+
+#include "CopyableFootprints.h"
+#include "Parallel.h"
+#include "Utility.h"
+#include "d3dx12.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <vector>
+#include <wrl.h>
+#include <emmintrin.h>
+
+namespace AMD {
+namespace {
+static const std::size_t CACHE_LINE_SIZE = 64;
+
+// Below this size, the cost of starting threads outweighs the gain
+static const std::size_t MINIMUM_BYTES_PER_THREAD = 1 << 20;
+
+///////////////////////////////////////////////////////////////////////////////
+template <bool SourceAligned>
+void StreamLines (std::uint8_t* destination, const std::uint8_t* source,
+	const std::size_t lineCount)
+{
+	for (std::size_t i = 0; i < lineCount; ++i) {
+		// Only prefetch lines of the source, which may end right after the
+		// last line we copy
+		if (i + 8 < lineCount) {
+			_mm_prefetch (reinterpret_cast<const char*> (source + 8 * CACHE_LINE_SIZE), _MM_HINT_NTA);
+		}
+
+		const auto s = reinterpret_cast<const __m128i*> (source);
+		const __m128i a = SourceAligned ? _mm_load_si128 (s + 0) : _mm_loadu_si128 (s + 0);
+		const __m128i b = SourceAligned ? _mm_load_si128 (s + 1) : _mm_loadu_si128 (s + 1);
+		const __m128i c = SourceAligned ? _mm_load_si128 (s + 2) : _mm_loadu_si128 (s + 2);
+		const __m128i d = SourceAligned ? _mm_load_si128 (s + 3) : _mm_loadu_si128 (s + 3);
+
+		const auto t = reinterpret_cast<__m128i*> (destination);
+		_mm_stream_si128 (t + 0, a);
+		_mm_stream_si128 (t + 1, b);
+		_mm_stream_si128 (t + 2, c);
+		_mm_stream_si128 (t + 3, d);
+
+		destination += CACHE_LINE_SIZE;
+		source += CACHE_LINE_SIZE;
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Copy without a trailing fence. If padTail is set, the caller guarantees the
+destination is writable up to the end of the last cache line, and the tail
+is written as a full line.
+*/
+void CopyRange (std::uint8_t* destination, const std::uint8_t* source,
+	std::size_t size, const bool padTail)
+{
+	const auto misalignment = reinterpret_cast<std::uintptr_t> (destination) & (CACHE_LINE_SIZE - 1);
+
+	if (misalignment) {
+		// Partial first line, regular stores are fine as long as we don't
+		// read the destination
+		const auto head = (std::min) (CACHE_LINE_SIZE - misalignment, size);
+		std::memcpy (destination, source, head);
+
+		destination += head;
+		source += head;
+		size -= head;
+	}
+
+	const auto lineCount = size / CACHE_LINE_SIZE;
+
+	if ((reinterpret_cast<std::uintptr_t> (source) & 15) == 0) {
+		StreamLines<true> (destination, source, lineCount);
+	} else {
+		StreamLines<false> (destination, source, lineCount);
+	}
+
+	destination += lineCount * CACHE_LINE_SIZE;
+	source += lineCount * CACHE_LINE_SIZE;
+	size -= lineCount * CACHE_LINE_SIZE;
+
+	if (size > 0) {
+		if (padTail) {
+			std::uint8_t line [CACHE_LINE_SIZE] = {};
+			std::memcpy (line, source, size);
+			StreamLines<false> (destination, line, 1);
+		} else {
+			std::memcpy (destination, source, size);
+		}
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Copy one contiguous block, split into cache line aligned chunks if it is
+large enough to be worth threading.
+*/
+void CopyContiguous (std::uint8_t* destination, const std::uint8_t* source,
+	const std::size_t size)
+{
+	const auto chunkCount = static_cast<int> (size / MINIMUM_BYTES_PER_THREAD);
+
+	if (chunkCount <= 1) {
+		CopyRange (destination, source, size, false);
+		_mm_sfence ();
+		return;
+	}
+
+	const auto chunkSize = (size + chunkCount - 1) / chunkCount;
+	const auto address = reinterpret_cast<std::uintptr_t> (destination);
+
+	// Chunk boundaries are placed on destination cache lines, so no line is
+	// shared between two threads
+	auto getBoundary = [=] (const int chunk) -> std::size_t {
+		if (chunk == 0) {
+			return 0;
+		} else if (chunk == chunkCount) {
+			return size;
+		}
+
+		return (std::min) (size, RoundToNextMultiple (
+			address + chunk * chunkSize, CACHE_LINE_SIZE) - address);
+	};
+
+	ParallelFor (chunkCount, 1, [=] (const int begin, const int end) {
+		const auto first = getBoundary (begin);
+		const auto last = getBoundary (end);
+
+		if (first < last) {
+			CopyRange (destination + first, source + first, last - first, false);
+		}
+
+		// Each thread has its own write-combining buffers to flush
+		_mm_sfence ();
+	});
+}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void StreamingCopy (void* destination, const void* source, const std::size_t size)
+{
+	CopyContiguous (static_cast<std::uint8_t*> (destination),
+		static_cast<const std::uint8_t*> (source), size);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void StreamingCopyRows (void* destination,
+	const std::size_t destinationRowPitch, const std::size_t destinationSlicePitch,
+	const void* source,
+	const std::size_t sourceRowPitch, const std::size_t sourceSlicePitch,
+	const std::size_t rowSize, const int rowCount, const int sliceCount)
+{
+	if (rowSize == 0 || rowCount <= 0 || sliceCount <= 0) {
+		return;
+	}
+
+	auto output = static_cast<std::uint8_t*> (destination);
+	auto input = static_cast<const std::uint8_t*> (source);
+
+	// Same layout on both sides: the rows including their padding form one
+	// block. This also covers the common case of tightly packed rows.
+	const auto sliceSize = sourceRowPitch * (rowCount - 1) + rowSize;
+	if (sourceRowPitch == destinationRowPitch) {
+		if (sliceCount == 1) {
+			CopyContiguous (output, input, sliceSize);
+			return;
+		} else if (sourceSlicePitch == destinationSlicePitch) {
+			CopyContiguous (output, input, sourceSlicePitch * (sliceCount - 1) + sliceSize);
+			return;
+		}
+	}
+
+	// Rows start at cache line boundaries in upload buffers, as the pitch is
+	// a multiple of 256; if the pitch is large enough, write whole lines
+	const bool padRows =
+		(reinterpret_cast<std::uintptr_t> (output) & (CACHE_LINE_SIZE - 1)) == 0 &&
+		(destinationRowPitch & (CACHE_LINE_SIZE - 1)) == 0 &&
+		(destinationSlicePitch & (CACHE_LINE_SIZE - 1)) == 0 &&
+		RoundToNextMultiple (rowSize, CACHE_LINE_SIZE) <= destinationRowPitch;
+
+	const int totalRowCount = rowCount * sliceCount;
+	const auto rowsPerThread = static_cast<int> ((std::max) (std::size_t (1),
+		MINIMUM_BYTES_PER_THREAD / rowSize));
+
+	ParallelFor (totalRowCount, rowsPerThread, [=] (const int begin, const int end) {
+		for (int i = begin; i < end; ++i) {
+			const int slice = i / rowCount;
+			const int row = i % rowCount;
+
+			// The destination may end right after the last row
+			CopyRange (output + slice * destinationSlicePitch + row * destinationRowPitch,
+				input + slice * sourceSlicePitch + row * sourceRowPitch,
+				rowSize, padRows && i != totalRowCount - 1);
+		}
+
+		_mm_sfence ();
+	});
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void MemcpySubresourceStreaming (const D3D12_MEMCPY_DEST* destination,
+	const D3D12_SUBRESOURCE_DATA* source, const SIZE_T rowSizeInBytes,
+	const UINT rowCount, const UINT sliceCount)
+{
+	StreamingCopyRows (destination->pData,
+		destination->RowPitch, destination->SlicePitch,
+		source->pData, source->RowPitch, source->SlicePitch,
+		rowSizeInBytes, rowCount, sliceCount);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+UINT64 UpdateSubresourcesStreaming (ID3D12GraphicsCommandList* commandList,
+	ID3D12Resource* destinationResource, ID3D12Resource* intermediate,
+	const UINT64 intermediateOffset, const UINT firstSubresource,
+	const UINT subresourceCount, const D3D12_SUBRESOURCE_DATA* sourceData)
+{
+	const auto destinationDesc = destinationResource->GetDesc ();
+
+	std::vector<D3D12_PLACED_SUBRESOURCE_FOOTPRINT> layouts (subresourceCount);
+	std::vector<UINT> rowCounts (subresourceCount);
+	std::vector<UINT64> rowSizes (subresourceCount);
+	UINT64 requiredSize = 0;
+
+	GetCopyableFootprints (destinationDesc, firstSubresource,
+		subresourceCount, intermediateOffset, layouts.data (), rowCounts.data (),
+		rowSizes.data (), &requiredSize);
+
+#ifdef _DEBUG
+	Microsoft::WRL::ComPtr<ID3D12Device> device;
+	destinationResource->GetDevice (IID_PPV_ARGS (&device));
+	if (!CheckCopyableFootprints (device.Get (), destinationDesc,
+		firstSubresource, subresourceCount)) {
+		throw std::runtime_error ("Footprint calculation does not match the device");
+	}
+#endif
+
+	const auto intermediateDesc = intermediate->GetDesc ();
+	if (intermediateDesc.Dimension != D3D12_RESOURCE_DIMENSION_BUFFER ||
+		intermediateDesc.Width < requiredSize + layouts [0].Offset ||
+		(destinationDesc.Dimension == D3D12_RESOURCE_DIMENSION_BUFFER &&
+			(firstSubresource != 0 || subresourceCount != 1))) {
+		throw std::runtime_error ("Invalid intermediate buffer for upload");
+	}
+
+	BYTE* data;
+	if (FAILED (intermediate->Map (0, nullptr, reinterpret_cast<void**> (&data)))) {
+		throw std::runtime_error ("Could not map intermediate buffer");
+	}
+
+	for (UINT i = 0; i < subresourceCount; ++i) {
+		const D3D12_MEMCPY_DEST destination = {
+			data + layouts [i].Offset,
+			layouts [i].Footprint.RowPitch,
+			layouts [i].Footprint.RowPitch * rowCounts [i]
+		};
+
+		MemcpySubresourceStreaming (&destination, &sourceData [i],
+			static_cast<SIZE_T> (rowSizes [i]), rowCounts [i], layouts [i].Footprint.Depth);
+	}
+
+	intermediate->Unmap (0, nullptr);
+
+	if (destinationDesc.Dimension == D3D12_RESOURCE_DIMENSION_BUFFER) {
+		commandList->CopyBufferRegion (destinationResource, 0,
+			intermediate, layouts [0].Offset, layouts [0].Footprint.Width);
+	} else {
+		for (UINT i = 0; i < subresourceCount; ++i) {
+			const CD3DX12_TEXTURE_COPY_LOCATION destinationLocation (
+				destinationResource, i + firstSubresource);
+			const CD3DX12_TEXTURE_COPY_LOCATION sourceLocation (intermediate, layouts [i]);
+			commandList->CopyTextureRegion (&destinationLocation, 0, 0, 0,
+				&sourceLocation, nullptr);
+		}
+	}
+
+	return requiredSize;
+}
+}
@@ -23,26 +23,290 @@
 #include "Utility.h"
 
 #include <stdio.h>
+#include <stdexcept>
+
+#ifdef _WIN32
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace {
+///////////////////////////////////////////////////////////////////////////////
+/**
+Size of an open file, or -1 on failure. Leaves the position at the start.
+Uses the 64-bit variants, as long is 32 bit on Windows.
+*/
+std::int64_t GetOpenFileSize (FILE* handle)
+{
+#ifdef _WIN32
+	if (::_fseeki64 (handle, 0, SEEK_END) != 0) {
+		return -1;
+	}
+
+	const std::int64_t size = ::_ftelli64 (handle);
+	return (::_fseeki64 (handle, 0, SEEK_SET) == 0) ? size : -1;
+#else
+	if (::fseeko (handle, 0, SEEK_END) != 0) {
+		return -1;
+	}
+
+	const std::int64_t size = ::ftello (handle);
+	return (::fseeko (handle, 0, SEEK_SET) == 0) ? size : -1;
+#endif
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Size the buffer once, then read everything in one go.
+*/
+bool ReadWholeFile (FILE* handle, const std::int64_t size,
+	std::vector<std::uint8_t>* result)
+{
+	if (size < 0) {
+		return false;
+	}
+
+	result->resize (static_cast<std::size_t> (size));
+	return std::fread (result->data (), 1, result->size (), handle) == result->size ();
+}
+}
 
 ///////////////////////////////////////////////////////////////////////////////
 std::vector<std::uint8_t> ReadFile (const char* filename)
 {
+	auto handle = std::fopen (filename, "rb");
+
+	if (handle == nullptr) {
+		throw std::runtime_error ("Could not open file");
+	}
+
 	std::vector<std::uint8_t> result;
-	std::uint8_t buffer[4096];
+	const bool ok = ReadWholeFile (handle, GetOpenFileSize (handle), &result);
+	std::fclose (handle);
+
+	if (!ok) {
+		throw std::runtime_error ("Could not read file");
+	}
+
+	return result;
+}
+
+namespace AMD {
+///////////////////////////////////////////////////////////////////////////////
+ByteRange ByteRange::GetRange (const std::size_t offset, const std::size_t size) const
+{
+	if (offset > this->size || size > this->size - offset) {
+		throw std::runtime_error ("Range is out of bounds");
+	}
+
+	const ByteRange result = { data + offset, size };
+	return result;
+}
+
+#ifdef _WIN32
+///////////////////////////////////////////////////////////////////////////////
+MappedFile::MappedFile (const char* filename)
+{
+	file_ = ::CreateFileA (filename, GENERIC_READ, FILE_SHARE_READ, nullptr,
+		OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+
+	if (file_ == INVALID_HANDLE_VALUE) {
+		file_ = nullptr;
+		throw std::runtime_error ("Could not open file");
+	}
+
+	LARGE_INTEGER fileSize;
+	::GetFileSizeEx (file_, &fileSize);
+	size_ = static_cast<std::size_t> (fileSize.QuadPart);
+
+	// Mapping an empty file fails, so leave data_ as nullptr in that case
+	if (size_ == 0) {
+		return;
+	}
+
+	mapping_ = ::CreateFileMappingA (file_, nullptr, PAGE_READONLY, 0, 0, nullptr);
+
+	if (mapping_ == nullptr) {
+		::CloseHandle (file_);
+		throw std::runtime_error ("Could not create file mapping");
+	}
+
+	data_ = ::MapViewOfFile (mapping_, FILE_MAP_READ, 0, 0, 0);
+
+	if (data_ == nullptr) {
+		::CloseHandle (mapping_);
+		::CloseHandle (file_);
+		throw std::runtime_error ("Could not map file");
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+MappedFile::~MappedFile ()
+{
+	if (data_) {
+		::UnmapViewOfFile (data_);
+	}
+
+	if (mapping_) {
+		::CloseHandle (mapping_);
+	}
+
+	if (file_) {
+		::CloseHandle (file_);
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void MappedFile::Prefetch (const std::size_t offset, const std::size_t size) const
+{
+	const auto range = GetRange (offset, size);
+
+	if (range.size == 0) {
+		return;
+	}
 
+	WIN32_MEMORY_RANGE_ENTRY entry;
+	entry.VirtualAddress = const_cast<std::uint8_t*> (range.data);
+	entry.NumberOfBytes = range.size;
+
+	// Failure is fine, this is only a hint
+	::PrefetchVirtualMemory (::GetCurrentProcess (), 1, &entry, 0);
+}
+#else
+///////////////////////////////////////////////////////////////////////////////
+MappedFile::MappedFile (const char* filename)
+{
+	const int fd = ::open (filename, O_RDONLY);
+
+	if (fd == -1) {
+		throw std::runtime_error ("Could not open file");
+	}
+
+	struct stat fileStatus;
+	if (::fstat (fd, &fileStatus) != 0) {
+		::close (fd);
+		throw std::runtime_error ("Could not query file size");
+	}
+
+	size_ = static_cast<std::size_t> (fileStatus.st_size);
+
+	// Mapping an empty file fails, so leave data_ as nullptr in that case
+	if (size_ > 0) {
+		void* data = ::mmap (nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+
+		if (data == MAP_FAILED) {
+			::close (fd);
+			throw std::runtime_error ("Could not map file");
+		}
+
+		data_ = data;
+	}
+
+	// The mapping keeps its own reference to the file
+	::close (fd);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+MappedFile::~MappedFile ()
+{
+	if (data_) {
+		::munmap (const_cast<void*> (data_), size_);
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void MappedFile::Prefetch (const std::size_t offset, const std::size_t size) const
+{
+	const auto range = GetRange (offset, size);
+
+	if (range.size == 0) {
+		return;
+	}
+
+	// madvise needs a page-aligned start
+	const auto pageSize = static_cast<std::uintptr_t> (::sysconf (_SC_PAGESIZE));
+	const auto begin = reinterpret_cast<std::uintptr_t> (range.data) & ~(pageSize - 1);
+	const auto end = reinterpret_cast<std::uintptr_t> (range.data) + range.size;
+
+	// Failure is fine, this is only a hint
+	::madvise (reinterpret_cast<void*> (begin), end - begin, MADV_WILLNEED);
+}
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+ByteRange MappedFile::GetRange (const std::size_t offset, const std::size_t size) const
+{
+	const ByteRange whole = { static_cast<const std::uint8_t*> (data_), size_ };
+	return whole.GetRange (offset, size);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+FileView::FileView (const char* filename)
+{
 	auto handle = std::fopen (filename, "rb");
 
-	for (;;) {
-		const auto bytesRead = std::fread (buffer, 1, sizeof (buffer), handle);
+	if (handle == nullptr) {
+		throw std::runtime_error ("Could not open file");
+	}
+
+	const auto size = GetOpenFileSize (handle);
 
-		result.insert (result.end (), buffer, buffer + bytesRead);
+	if (size >= 0 && static_cast<std::uint64_t> (size) < MAPPING_THRESHOLD) {
+		const bool ok = ReadWholeFile (handle, size, &contents_);
+		std::fclose (handle);
 
-		if (bytesRead < sizeof (buffer)) {
-			break;
+		if (!ok) {
+			throw std::runtime_error ("Could not read file");
 		}
+
+		return;
 	}
 
 	std::fclose (handle);
 
-	return result;
-}
\ No newline at end of file
+	if (size < 0) {
+		throw std::runtime_error ("Could not query file size");
+	}
+
+	mappedFile_.reset (new MappedFile (filename));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+FileView::~FileView ()
+{
+}
+
+///////////////////////////////////////////////////////////////////////////////
+const void* FileView::GetData () const
+{
+	return mappedFile_ ? mappedFile_->GetData () : contents_.data ();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::size_t FileView::GetSize () const
+{
+	return mappedFile_ ? mappedFile_->GetSize () : contents_.size ();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+ByteRange FileView::GetRange (const std::size_t offset, const std::size_t size) const
+{
+	const ByteRange whole = {
+		static_cast<const std::uint8_t*> (GetData ()), GetSize ()
+	};
+
+	return whole.GetRange (offset, size);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void FileView::Prefetch (const std::size_t offset, const std::size_t size) const
+{
+	if (mappedFile_) {
+		mappedFile_->Prefetch (offset, size);
+	}
+}
+}
@@ -23,6 +23,8 @@
 #ifndef ANTERU_D3D12_SAMPLE_UTILITY_H_
 #define ANTERU_D3D12_SAMPLE_UTILITY_H_
 
+#include <cstddef>
+#include <memory>
 #include <vector>
 #include <cstdint>
 
@@ -33,6 +35,109 @@ constexpr T RoundToNextMultiple (const T a, const T multiple)
 	return ((a + multiple - 1) / multiple) * multiple;
 }
 
+///////////////////////////////////////////////////////////////////////////////
+/**
+Read a whole file with a single read. Throws if the file cannot be opened or
+read completely.
+*/
 std::vector<std::uint8_t> ReadFile (const char* filename);
 
+namespace AMD {
+///////////////////////////////////////////////////////////////////////////////
+/**
+A non-owning view of a range of bytes, for instance a part of a file.
+*/
+struct ByteRange
+{
+	const std::uint8_t* data;
+	std::size_t size;
+
+	/**
+	Sub-range relative to this range. Throws if it does not fit.
+	*/
+	ByteRange GetRange (const std::size_t offset, const std::size_t size) const;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Read-only memory mapping of a whole file. The mapping stays valid as long as
+this object lives.
+*/
+class MappedFile
+{
+public:
+	MappedFile (const MappedFile&) = delete;
+	MappedFile& operator= (const MappedFile&) = delete;
+
+	explicit MappedFile (const char* filename);
+	~MappedFile ();
+
+	const void* GetData () const
+	{
+		return data_;
+	}
+
+	std::size_t GetSize () const
+	{
+		return size_;
+	}
+
+	ByteRange GetRange (const std::size_t offset, const std::size_t size) const;
+
+	/**
+	Ask the OS to start reading the range into memory in the background, so
+	later accesses don't stall on page faults. This is only a hint.
+	*/
+	void Prefetch (const std::size_t offset, const std::size_t size) const;
+
+private:
+	// Windows file and mapping handles. On other platforms, the mapping
+	// outlives the file descriptor and no handles are kept
+	void* file_ = nullptr;
+	void* mapping_ = nullptr;
+	const void* data_ = nullptr;
+	std::size_t size_ = 0;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Read-only contents of a whole file. Large files are memory mapped, small
+files below MAPPING_THRESHOLD are read with a single read as setting up a
+mapping costs more than copying a few pages.
+
+Loaders can parse the data in place through GetRange, no matter which way
+the file was opened.
+*/
+class FileView
+{
+public:
+	static const std::size_t MAPPING_THRESHOLD = 64 * 1024;
+
+	FileView (const FileView&) = delete;
+	FileView& operator= (const FileView&) = delete;
+
+	explicit FileView (const char* filename);
+	~FileView ();
+
+	const void* GetData () const;
+	std::size_t GetSize () const;
+
+	ByteRange GetRange (const std::size_t offset, const std::size_t size) const;
+
+	/**
+	See MappedFile::Prefetch. Does nothing if the file was read.
+	*/
+	void Prefetch (const std::size_t offset, const std::size_t size) const;
+
+	bool IsMapped () const
+	{
+		return mappedFile_ != nullptr;
+	}
+
+private:
+	std::unique_ptr<MappedFile> mappedFile_;
+	std::vector<std::uint8_t> contents_;
+};
+}
+
 #endif
\ No newline at end of file
@@ -0,0 +1,188 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#ifndef ANTERU_D3D12_SAMPLE_WORKSTEALINGDEQUE_H_
+#define ANTERU_D3D12_SAMPLE_WORKSTEALINGDEQUE_H_
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace AMD {
+///////////////////////////////////////////////////////////////////////////////
+/**
+Chase-Lev work-stealing deque of pointers. The owning thread pushes and pops
+at the bottom without taking locks, any other thread can steal from the top.
+
+The ring buffer grows as needed. Old buffers are kept until the deque is
+destroyed, as a concurrent Steal may still read from them.
+
+See "Correct and Efficient Work-Stealing for Weak Memory Models" by Le et al.
+The fences of the paper are folded into sequentially consistent operations,
+which costs next to nothing on x86 and keeps thread sanitizers informed.
+*/
+template <typename T>
+class WorkStealingDeque
+{
+public:
+	WorkStealingDeque (const WorkStealingDeque&) = delete;
+	WorkStealingDeque& operator= (const WorkStealingDeque&) = delete;
+
+	/**
+	initialCapacity must be a power of two.
+	*/
+	explicit WorkStealingDeque (const std::int64_t initialCapacity = 256)
+		: top_ (0)
+		, bottom_ (0)
+	{
+		buffers_.emplace_back (new Buffer (initialCapacity));
+		buffer_.store (buffers_.back ().get (), std::memory_order_relaxed);
+	}
+
+	/**
+	Owner only.
+	*/
+	void Push (T* item)
+	{
+		const auto bottom = bottom_.load (std::memory_order_relaxed);
+		const auto top = top_.load (std::memory_order_acquire);
+		auto buffer = buffer_.load (std::memory_order_relaxed);
+
+		if (bottom - top >= buffer->capacity) {
+			buffer = Grow (buffer, top, bottom);
+		}
+
+		buffer->Put (bottom, item);
+		bottom_.store (bottom + 1, std::memory_order_seq_cst);
+	}
+
+	/**
+	Owner only. Returns nullptr if the deque is empty.
+	*/
+	T* Pop ()
+	{
+		const auto bottom = bottom_.load (std::memory_order_relaxed) - 1;
+		const auto buffer = buffer_.load (std::memory_order_relaxed);
+		bottom_.store (bottom, std::memory_order_seq_cst);
+		auto top = top_.load (std::memory_order_seq_cst);
+
+		if (top > bottom) {
+			// Empty, restore
+			bottom_.store (bottom + 1, std::memory_order_relaxed);
+			return nullptr;
+		}
+
+		auto item = buffer->Get (bottom);
+
+		if (top == bottom) {
+			// Last item, race against thieves for it
+			if (!top_.compare_exchange_strong (top, top + 1,
+				std::memory_order_seq_cst, std::memory_order_relaxed)) {
+				item = nullptr;
+			}
+
+			bottom_.store (bottom + 1, std::memory_order_relaxed);
+		}
+
+		return item;
+	}
+
+	/**
+	Any thread. Returns nullptr if the deque is empty or another thread won
+	the race for the top item.
+	*/
+	T* Steal ()
+	{
+		auto top = top_.load (std::memory_order_seq_cst);
+		const auto bottom = bottom_.load (std::memory_order_seq_cst);
+
+		if (top >= bottom) {
+			return nullptr;
+		}
+
+		const auto item = buffer_.load (std::memory_order_acquire)->Get (top);
+
+		if (!top_.compare_exchange_strong (top, top + 1,
+			std::memory_order_seq_cst, std::memory_order_relaxed)) {
+			return nullptr;
+		}
+
+		return item;
+	}
+
+	/**
+	Any thread. The result is only a snapshot.
+	*/
+	bool IsEmpty () const
+	{
+		return top_.load (std::memory_order_seq_cst) >=
+			bottom_.load (std::memory_order_seq_cst);
+	}
+
+private:
+	struct Buffer
+	{
+		explicit Buffer (const std::int64_t capacity)
+			: capacity (capacity)
+			, items (new std::atomic<T*> [static_cast<std::size_t> (capacity)])
+		{
+		}
+
+		T* Get (const std::int64_t index) const
+		{
+			return items [index & (capacity - 1)].load (std::memory_order_relaxed);
+		}
+
+		void Put (const std::int64_t index, T* item)
+		{
+			items [index & (capacity - 1)].store (item, std::memory_order_relaxed);
+		}
+
+		// Always a power of two
+		const std::int64_t capacity;
+		std::unique_ptr<std::atomic<T*> []> items;
+	};
+
+	Buffer* Grow (Buffer* buffer, const std::int64_t top, const std::int64_t bottom)
+	{
+		buffers_.emplace_back (new Buffer (buffer->capacity * 2));
+		const auto result = buffers_.back ().get ();
+
+		for (auto i = top; i < bottom; ++i) {
+			result->Put (i, buffer->Get (i));
+		}
+
+		buffer_.store (result, std::memory_order_release);
+		return result;
+	}
+
+	std::atomic<std::int64_t> top_;
+	std::atomic<std::int64_t> bottom_;
+	std::atomic<Buffer*> buffer_;
+
+	// Only touched by the owner
+	std::vector<std::unique_ptr<Buffer>> buffers_;
+};
+}
+
+#endif
@@ -0,0 +1,449 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+
+#include "Test.h"
+
+#include "AssetLoader.h"
+#include "AssetPack.h"
+#include "DiskCache.h"
+#include "FakeD3D12.h"
+#include "FakeImageIO.h"
+#include "TestAssetPack.h"
+#include "TestFile.h"
+#include "TestImage.h"
+#include "TextureContainer.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <functional>
+#include <future>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace AMD;
+using Microsoft::WRL::ComPtr;
+
+namespace {
+const char* CACHE_DIRECTORY = "AssetLoaderTest.cache";
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Opaque, so premultiplying does not change the pixels.
+*/
+std::vector<std::uint8_t> CreateImage (const int width, const int height,
+	std::vector<std::uint8_t>* pixels = nullptr)
+{
+	const auto image = Test::CreateTestImage (width, height, false, 7);
+	if (pixels) {
+		*pixels = image;
+	}
+
+	return Test::EncodeFakeImage (image, width, height);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Load data with a fresh loader and cache, as a new run of the application
+would, and return the top level of the texture.
+*/
+std::vector<std::uint8_t> Load (const std::vector<std::uint8_t>& data,
+	const TextureLoadOptions& options = TextureLoadOptions ())
+{
+	ComPtr<Test::FakeDevice> device;
+	device.Attach (new Test::FakeDevice);
+	DiskCache cache (CACHE_DIRECTORY, 64 << 20);
+
+	AssetLoader loader (device.Get (), &cache);
+	auto handle = loader.LoadTextureFromMemory (data.data (), data.size (), options);
+	handle.Wait ();
+
+	return static_cast<Test::FakeResource*> (handle.GetResource ())->ReadSubresource (0);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::string GetOnlyCacheEntry ()
+{
+	std::string result;
+	int count = 0;
+
+	for (const auto& entry : std::filesystem::directory_iterator (CACHE_DIRECTORY)) {
+		if (entry.is_regular_file ()) {
+			result = entry.path ().string ();
+			++count;
+		}
+	}
+
+	if (count != 1) {
+		throw std::runtime_error ("Expected exactly one cache entry");
+	}
+
+	return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void ResetCache ()
+{
+	std::filesystem::remove_all (CACHE_DIRECTORY);
+}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TEST (LoadsUncompressed)
+{
+	std::vector<std::uint8_t> pixels;
+	const auto data = CreateImage (64, 32, &pixels);
+
+	ComPtr<Test::FakeDevice> device;
+	device.Attach (new Test::FakeDevice);
+	AssetLoader loader (device.Get ());
+
+	TextureLoadOptions options;
+	options.blockCompression = false;
+	auto handle = loader.LoadTextureFromMemory (data.data (), data.size (), options);
+	handle.Wait ();
+
+	CHECK (handle.IsReady ());
+	CHECK_EQUAL (DXGI_FORMAT_R8G8B8A8_UNORM_SRGB, handle.GetFormat ());
+	CHECK_EQUAL (7, handle.GetMipLevelCount ());
+
+	auto resource = static_cast<Test::FakeResource*> (handle.GetResource ());
+	CHECK (resource->ReadSubresource (0) == pixels);
+	CHECK_EQUAL (4, resource->ReadSubresource (6).size ());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TEST (LoadsFromAssetPack)
+{
+	std::vector<std::uint8_t> pixels [2];
+	std::vector<Test::TestAsset> assets;
+	assets.push_back ({ "stored.rgba", CreateImage (64, 32, &pixels [0]), false });
+	assets.push_back ({ "compressed.rgba", CreateImage (16, 16, &pixels [1]), true });
+	Test::WriteFileBytes ("AssetLoaderTest.apak", Test::CreateAssetPack (assets));
+
+	AssetPack pack ("AssetLoaderTest.apak");
+
+	ComPtr<Test::FakeDevice> device;
+	device.Attach (new Test::FakeDevice);
+	AssetLoader loader (device.Get ());
+
+	TextureLoadOptions options;
+	options.blockCompression = false;
+
+	for (int i = 0; i < 2; ++i) {
+		auto handle = loader.LoadTextureFromPack (pack, assets [i].name.c_str (), options);
+		handle.Wait ();
+
+		auto resource = static_cast<Test::FakeResource*> (handle.GetResource ());
+		CHECK (resource->ReadSubresource (0) == pixels [i]);
+	}
+
+	CHECK_THROWS (loader.LoadTextureFromPack (pack, "missing.rgba", options));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TEST (LoadsBlockCompressed)
+{
+	const auto data = CreateImage (64, 32);
+
+	ComPtr<Test::FakeDevice> device;
+	device.Attach (new Test::FakeDevice);
+	AssetLoader loader (device.Get ());
+
+	auto handle = loader.LoadTextureFromMemory (data.data (), data.size ());
+	handle.Wait ();
+
+	CHECK_EQUAL (DXGI_FORMAT_BC1_UNORM_SRGB, handle.GetFormat ());
+	CHECK_EQUAL (7, handle.GetMipLevelCount ());
+
+	// 16x8 blocks of 8 bytes
+	auto resource = static_cast<Test::FakeResource*> (handle.GetResource ());
+	CHECK_EQUAL (16 * 8 * 8, resource->ReadSubresource (0).size ());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TEST (InvalidImagesFail)
+{
+	auto data = CreateImage (16, 16);
+	data.resize (data.size () - 1);
+
+	ComPtr<Test::FakeDevice> device;
+	device.Attach (new Test::FakeDevice);
+	AssetLoader loader (device.Get ());
+
+	bool called = false;
+	auto handle = loader.LoadTextureFromMemory (data.data (), data.size ());
+	CHECK_THROWS (handle.Wait ());
+	handle.OnDone ([&called] () { called = true; });
+
+	CHECK (called);
+	CHECK (handle.GetStatus () == TextureHandle::Status::Failed);
+	CHECK (handle.GetResource () == nullptr);
+	CHECK_THROWS (loader.LoadTextureFromFile ("AssetLoaderTest.missing").Wait ());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TEST (StagingBudgetBlocksWhenExhausted)
+{
+	StagingBudget budget (100);
+	budget.Acquire (60);
+
+	std::atomic<bool> acquired { false };
+	std::thread waiter ([&budget, &acquired] () {
+		budget.Acquire (60);
+		acquired = true;
+	});
+
+	std::this_thread::sleep_for (std::chrono::milliseconds (50));
+	CHECK (!acquired);
+
+	budget.Release (60);
+	waiter.join ();
+	CHECK (acquired);
+	budget.Release (60);
+
+	// Larger than the whole budget, but nothing else is in use
+	budget.Acquire (1000);
+	budget.Release (1000);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Start many loads at once with a staging budget smaller than most of the
+textures, so the decoders keep stalling on it. Every load must still finish,
+with its own pixels, and the loader must finish the ones still in flight
+when it gets destroyed.
+*/
+TEST (LoadsManyThroughSmallBudget)
+{
+	const int count = 32;
+
+	std::vector<std::vector<std::uint8_t>> data (count);
+	std::vector<std::vector<std::uint8_t>> pixels (count);
+	for (int i = 0; i < count; ++i) {
+		data [i] = CreateImage (16 + 8 * (i % 8), 16 + 4 * (i % 5), &pixels [i]);
+	}
+
+	ComPtr<Test::FakeDevice> device;
+	device.Attach (new Test::FakeDevice);
+
+	const auto decodeCount = Test::fakeImageDecodeCount.load ();
+	std::atomic<int> doneCount { 0 };
+	std::vector<TextureHandle> handles;
+
+	{
+		AssetLoader loader (device.Get (), nullptr, 16 << 10);
+
+		TextureLoadOptions options;
+		options.blockCompression = false;
+
+		for (int i = 0; i < count; ++i) {
+			handles.push_back (loader.LoadTextureFromMemory (data [i].data (),
+				data [i].size (), options));
+			handles.back ().OnDone ([&doneCount] () { ++doneCount; });
+		}
+	}
+
+	CHECK_EQUAL (count, doneCount.load ());
+	CHECK_EQUAL (decodeCount + count, Test::fakeImageDecodeCount.load ());
+
+	for (int i = 0; i < count; ++i) {
+		CHECK (handles [i].IsReady ());
+
+		auto resource = static_cast<Test::FakeResource*> (handles [i].GetResource ());
+		CHECK (resource->ReadSubresource (0) == pixels [i]);
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+By the time a handle reports it is done, the copy has executed. Copies of
+the handle share the load, and callbacks added afterwards run right away.
+*/
+TEST (HandlesBecomeReadyOnce)
+{
+	std::vector<std::uint8_t> pixels;
+	const auto data = CreateImage (64, 64, &pixels);
+
+	ComPtr<Test::FakeDevice> device;
+	device.Attach (new Test::FakeDevice);
+	AssetLoader loader (device.Get ());
+
+	TextureLoadOptions options;
+	options.blockCompression = false;
+	const auto handle = loader.LoadTextureFromMemory (data.data (), data.size (), options);
+	const auto copy = handle;
+
+	std::atomic<int> callCount { 0 };
+	std::promise<bool> readyInCallback;
+	handle.OnDone ([&handle, &pixels, &callCount, &readyInCallback] () {
+		auto resource = static_cast<Test::FakeResource*> (handle.GetResource ());
+		readyInCallback.set_value (handle.IsReady () &&
+			resource->ReadSubresource (0) == pixels);
+		++callCount;
+	});
+
+	copy.Wait ();
+	CHECK (readyInCallback.get_future ().get ());
+	CHECK (copy.IsReady ());
+	CHECK (copy.GetResource () == handle.GetResource ());
+
+	bool calledRightAway = false;
+	copy.OnDone ([&calledRightAway] () { calledRightAway = true; });
+	CHECK (calledRightAway);
+
+	loader.LoadTextureFromMemory (data.data (), data.size (), options).Wait ();
+	CHECK_EQUAL (1, callCount.load ());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TEST (CacheHitSkipsDecoding)
+{
+	ResetCache ();
+	const auto data = CreateImage (64, 64);
+
+	const auto decodeCount = Test::fakeImageDecodeCount.load ();
+	const auto decoded = Load (data);
+	CHECK_EQUAL (decodeCount + 1, Test::fakeImageDecodeCount.load ());
+
+	const auto cached = Load (data);
+	CHECK_EQUAL (decodeCount + 1, Test::fakeImageDecodeCount.load ());
+	CHECK (cached == decoded);
+
+	// Different options are a different entry
+	TextureLoadOptions options;
+	options.maximumDimension = 32;
+	Load (data, options);
+	CHECK_EQUAL (decodeCount + 2, Test::fakeImageDecodeCount.load ());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Damage the cache entry between runs. The loader must fall back to decoding,
+produce the same texture and replace the entry, so the run after that hits
+the cache again.
+*/
+TEST (CorruptCacheEntriesAreReplaced)
+{
+	const auto data = CreateImage (64, 64);
+
+	typedef std::function<void (std::vector<std::uint8_t>&)> Corruption;
+	const Corruption corruptions [] = {
+		[] (std::vector<std::uint8_t>& entry) { entry.clear (); },
+		[] (std::vector<std::uint8_t>& entry) { entry.resize (10); },
+		[] (std::vector<std::uint8_t>& entry) {
+			entry.resize (sizeof (TextureContainerHeader));
+		},
+		[] (std::vector<std::uint8_t>& entry) { entry.resize (entry.size () / 2); },
+		[] (std::vector<std::uint8_t>& entry) { entry.pop_back (); },
+		[] (std::vector<std::uint8_t>& entry) { entry [0] ^= 0xFF; },
+		[] (std::vector<std::uint8_t>& entry) {
+			TextureContainerHeader header;
+			std::memcpy (&header, entry.data (), sizeof (header));
+			header.mipLevels = 40;
+			std::memcpy (entry.data (), &header, sizeof (header));
+		},
+		[] (std::vector<std::uint8_t>& entry) {
+			TextureContainerHeader header;
+			std::memcpy (&header, entry.data (), sizeof (header));
+			header.dataOffset = ~0ull - 8;
+			std::memcpy (entry.data (), &header, sizeof (header));
+		}
+	};
+
+	ResetCache ();
+	const auto reference = Load (data);
+
+	for (const auto& corrupt : corruptions) {
+		const auto path = GetOnlyCacheEntry ();
+		auto entry = Test::ReadFileBytes (path.c_str ());
+		corrupt (entry);
+		Test::WriteFileBytes (path.c_str (), entry);
+
+		const auto decodeCount = Test::fakeImageDecodeCount.load ();
+		CHECK (Load (data) == reference);
+		CHECK_EQUAL (decodeCount + 1, Test::fakeImageDecodeCount.load ());
+
+		CHECK (Load (data) == reference);
+		CHECK_EQUAL (decodeCount + 1, Test::fakeImageDecodeCount.load ());
+	}
+
+	ResetCache ();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Opaque images which need no conversion are decoded straight into the upload
+buffer. Anything else goes through system memory.
+*/
+TEST (UnconvertedImagesDecodeIntoUploadBuffer)
+{
+	ComPtr<Test::FakeDevice> device;
+	device.Attach (new Test::FakeDevice);
+	AssetLoader loader (device.Get ());
+
+	TextureLoadOptions options;
+	options.blockCompression = false;
+	options.generateMips = false;
+
+	auto load = [&loader] (const std::vector<std::uint8_t>& data,
+		const TextureLoadOptions& options, bool* decodedInto) {
+		const auto decodeIntoCount = Test::fakeImageDecodeIntoCount.load ();
+		auto handle = loader.LoadTextureFromMemory (data.data (), data.size (), options);
+		handle.Wait ();
+		*decodedInto = Test::fakeImageDecodeIntoCount.load () != decodeIntoCount;
+		CHECK_EQUAL (1, handle.GetMipLevelCount ());
+		return handle;
+	};
+
+	// Rows of 30 pixels get padded to the pitch of the footprint
+	std::vector<std::uint8_t> pixels;
+	const auto data = CreateImage (30, 17, &pixels);
+
+	bool decodedInto;
+	auto handle = load (data, options, &decodedInto);
+	CHECK (decodedInto);
+	CHECK_EQUAL (DXGI_FORMAT_R8G8B8A8_UNORM_SRGB, handle.GetFormat ());
+	CHECK (static_cast<Test::FakeResource*> (handle.GetResource ())->ReadSubresource (0) == pixels);
+
+	// Alpha has to be premultiplied
+	const auto translucent = Test::EncodeFakeImage (
+		Test::CreateTestImage (30, 17, true, 7), 30, 17);
+	load (translucent, options, &decodedInto);
+	CHECK (!decodedInto);
+
+	// Too large
+	auto fitted = options;
+	fitted.maximumDimension = 16;
+	load (data, fitted, &decodedInto);
+	CHECK (!decodedInto);
+
+	// Block compressed
+	auto compressed = options;
+	compressed.blockCompression = true;
+	handle = load (CreateImage (32, 16), compressed, &decodedInto);
+	CHECK (!decodedInto);
+	CHECK_EQUAL (DXGI_FORMAT_BC1_UNORM_SRGB, handle.GetFormat ());
+}
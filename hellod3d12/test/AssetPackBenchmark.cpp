@@ -0,0 +1,122 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#include "Benchmark.h"
+
+#include "AssetPack.h"
+#include "TestAssetPack.h"
+#include "TestFile.h"
+#include "TestImage.h"
+
+#include <cstdio>
+#include <string>
+
+using namespace AMD;
+
+namespace {
+const char* PACK_PATH = "AssetPackBenchmark.apak";
+
+///////////////////////////////////////////////////////////////////////////////
+void BenchmarkLookup ()
+{
+	const int entryCount = 4096;
+
+	std::vector<Test::TestAsset> assets;
+	std::vector<std::string> names, missing;
+	for (int i = 0; i < entryCount; ++i) {
+		names.push_back ("textures/level" + std::to_string (i % 16) +
+			"/asset" + std::to_string (i) + ".jpg");
+		missing.push_back (names.back () + ".missing");
+		assets.push_back ({ names.back (), std::vector<std::uint8_t> (16), false });
+	}
+
+	Test::WriteFileBytes (PACK_PATH, Test::CreateAssetPack (assets));
+	AssetPack pack (PACK_PATH);
+
+	volatile int sink = 0;
+
+	Test::Report ("4096 lookups, found", Test::Measure ([&] () {
+		for (const auto& name : names) {
+			sink = sink + pack.Find (name.c_str ());
+		}
+	}, 20));
+
+	Test::Report ("4096 lookups, missing", Test::Measure ([&] () {
+		for (const auto& name : missing) {
+			sink = sink + pack.Find (name.c_str ());
+		}
+	}, 20));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void BenchmarkDecompression ()
+{
+	const int entryCount = 64;
+
+	std::vector<Test::TestAsset> assets;
+	std::vector<int> indices;
+	std::size_t size = 0;
+	for (int i = 0; i < entryCount; ++i) {
+		assets.push_back ({ "image" + std::to_string (i),
+			Test::CreateTestImage (256, 256, true, i), true });
+		size += assets.back ().data.size ();
+	}
+
+	Test::WriteFileBytes (PACK_PATH, Test::CreateAssetPack (assets));
+	AssetPack pack (PACK_PATH);
+	for (const auto& asset : assets) {
+		indices.push_back (pack.Find (asset.name.c_str ()));
+	}
+
+	volatile std::size_t sink = 0;
+
+	Test::Report ("64 x 256 KiB LZ4, one after the other", Test::Measure ([&] () {
+		for (const auto index : indices) {
+			sink = sink + pack.Load (index).GetSize ();
+		}
+	}), static_cast<double> (size));
+
+	Test::Report ("64 x 256 KiB LZ4, in parallel", Test::Measure ([&] () {
+		sink = sink + pack.Load (indices).size ();
+	}), static_cast<double> (size));
+}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Name lookups in a pack with 4096 entries, and decompression of 64 entries
+one at a time and with AssetPack::Load, which decompresses in parallel. The
+pack is in the page cache, so this measures the CPU cost only. Run from the
+build directory.
+
+On a single core test machine a lookup takes about 150 ns, and both ways of
+decompressing run at about 1.2 GiB/s, as there is nothing to parallelize on.
+*/
+int main ()
+{
+	BenchmarkLookup ();
+	BenchmarkDecompression ();
+
+	std::remove (PACK_PATH);
+
+	return 0;
+}
@@ -0,0 +1,271 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#include "Test.h"
+
+#include "AssetPack.h"
+#include "TestAssetPack.h"
+#include "TestFile.h"
+#include "TestImage.h"
+
+#include <cstring>
+#include <functional>
+#include <string>
+#include <vector>
+
+using namespace AMD;
+
+namespace {
+const char* PACK_PATH = "AssetPackTest.apak";
+
+///////////////////////////////////////////////////////////////////////////////
+std::vector<Test::TestAsset> CreateAssets ()
+{
+	std::vector<Test::TestAsset> result;
+	result.push_back ({ "shaders.hlsl", std::vector<std::uint8_t> (5000, 'x'), true });
+	result.push_back ({ "textures/ruby.jpg", Test::CreateRandomBytes (10000), false });
+	result.push_back ({ "textures/noise.raw", Test::CreateRandomBytes (777, 2), true });
+	result.push_back ({ "empty", std::vector<std::uint8_t> (), false });
+	result.push_back ({ "image.rgba", Test::CreateTestImage (64, 64, true), true });
+	return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void CheckEqual (const std::vector<std::uint8_t>& expected, const AssetData& data)
+{
+	CHECK_EQUAL (expected.size (), data.GetSize ());
+	CHECK (expected.empty () ||
+		std::memcmp (expected.data (), data.GetData (), expected.size ()) == 0);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Write a pack in which the entry at index has been changed by corrupt.
+*/
+void WriteCorruptPack (const int index,
+	const std::function<void (AssetPackEntry&)>& corrupt)
+{
+	auto bytes = Test::CreateAssetPack (CreateAssets ());
+
+	AssetPackEntry entry;
+	const auto offset = sizeof (AssetPackHeader) + sizeof (AssetPackEntry) * index;
+	std::memcpy (&entry, bytes.data () + offset, sizeof (entry));
+	corrupt (entry);
+	std::memcpy (bytes.data () + offset, &entry, sizeof (entry));
+
+	Test::WriteFileBytes (PACK_PATH, bytes);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void WriteCorruptPack (const char* name,
+	const std::function<void (AssetPackEntry&)>& corrupt)
+{
+	Test::WriteFileBytes (PACK_PATH, Test::CreateAssetPack (CreateAssets ()));
+
+	int index;
+	{
+		AssetPack pack (PACK_PATH);
+		index = pack.Find (name);
+	}
+
+	WriteCorruptPack (index, corrupt);
+}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TEST (LoadsEntries)
+{
+	const auto assets = CreateAssets ();
+	Test::WriteFileBytes (PACK_PATH, Test::CreateAssetPack (assets));
+
+	AssetPack pack (PACK_PATH);
+	CHECK_EQUAL (static_cast<int> (assets.size ()), pack.GetEntryCount ());
+
+	for (const auto& asset : assets) {
+		const auto index = pack.Find (asset.name.c_str ());
+		CHECK (index >= 0);
+
+		const auto name = pack.GetName (index);
+		CHECK (std::string (reinterpret_cast<const char*> (name.data), name.size) == asset.name);
+
+		CheckEqual (asset.data, pack.Load (index));
+		CheckEqual (asset.data, pack.Load (asset.name.c_str ()));
+
+		const auto& entry = pack.GetEntry (index);
+		if (entry.compression == AssetPackCompression::None) {
+			// Used in place from the mapping
+			CHECK (pack.Load (index).GetData () == pack.GetStoredData (index).data);
+			CHECK_EQUAL (0, entry.offset % 64);
+		} else {
+			CHECK (asset.compress);
+		}
+
+		std::vector<std::uint8_t> destination (asset.data.size ());
+		pack.LoadInto (index, destination.data (), destination.size ());
+		CHECK (destination == asset.data);
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TEST (CopiesStayValid)
+{
+	const auto assets = CreateAssets ();
+	Test::WriteFileBytes (PACK_PATH, Test::CreateAssetPack (assets));
+
+	AssetPack pack (PACK_PATH);
+	auto copy = pack.Load ("image.rgba");
+	{
+		const auto original = pack.Load ("image.rgba");
+		copy = original;
+	}
+
+	CheckEqual (assets [4].data, copy);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TEST (MissingEntries)
+{
+	Test::WriteFileBytes (PACK_PATH, Test::CreateAssetPack (CreateAssets ()));
+
+	AssetPack pack (PACK_PATH);
+	CHECK_EQUAL (-1, pack.Find (""));
+	CHECK_EQUAL (-1, pack.Find ("ruby.jpg"));
+	CHECK_EQUAL (-1, pack.Find ("textures/ruby.jp"));
+	CHECK_EQUAL (-1, pack.Find ("Shaders.hlsl"));
+	CHECK_THROWS (pack.Load ("missing"));
+
+	std::vector<std::uint8_t> destination (10);
+	CHECK_THROWS (pack.LoadInto (pack.Find ("shaders.hlsl"), destination.data (),
+		destination.size ()));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TEST (EmptyPack)
+{
+	Test::WriteFileBytes (PACK_PATH, Test::CreateAssetPack (std::vector<Test::TestAsset> ()));
+
+	AssetPack pack (PACK_PATH);
+	CHECK_EQUAL (0, pack.GetEntryCount ());
+	CHECK_EQUAL (-1, pack.Find ("shaders.hlsl"));
+	CHECK (pack.Load (std::vector<int> ()).empty ());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TEST (LoadsSeveral)
+{
+	// Enough entries to be spread over several threads
+	std::vector<Test::TestAsset> assets;
+	for (int i = 0; i < 64; ++i) {
+		assets.push_back ({ "asset" + std::to_string (i),
+			Test::CreateTestImage (32, 32 + i, false, i), i % 3 != 0 });
+	}
+
+	Test::WriteFileBytes (PACK_PATH, Test::CreateAssetPack (assets, 4096));
+
+	AssetPack pack (PACK_PATH);
+	std::vector<int> indices;
+	for (const auto& asset : assets) {
+		indices.push_back (pack.Find (asset.name.c_str ()));
+	}
+	// Duplicates are loaded twice
+	indices.push_back (indices [1]);
+
+	const auto loaded = pack.Load (indices);
+	CHECK_EQUAL (indices.size (), loaded.size ());
+	for (std::size_t i = 0; i < assets.size (); ++i) {
+		CheckEqual (assets [i].data, loaded [i]);
+	}
+	CheckEqual (assets [1].data, loaded.back ());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TEST (RejectsCorruptHeaders)
+{
+	const auto bytes = Test::CreateAssetPack (CreateAssets ());
+
+	// Truncated header
+	Test::WriteFileBytes (PACK_PATH, std::vector<std::uint8_t> (bytes.begin (),
+		bytes.begin () + sizeof (AssetPackHeader) - 1));
+	CHECK_THROWS (AssetPack pack (PACK_PATH));
+
+	const auto checkCorrupt = [&] (const std::function<void (AssetPackHeader&)>& corrupt) {
+		auto corrupted = bytes;
+		AssetPackHeader header;
+		std::memcpy (&header, corrupted.data (), sizeof (header));
+		corrupt (header);
+		std::memcpy (corrupted.data (), &header, sizeof (header));
+		Test::WriteFileBytes (PACK_PATH, corrupted);
+		CHECK_THROWS (AssetPack pack (PACK_PATH));
+	};
+
+	checkCorrupt ([] (AssetPackHeader& h) { h.magic [0] = 'X'; });
+	checkCorrupt ([] (AssetPackHeader& h) { h.version = 2; });
+	checkCorrupt ([] (AssetPackHeader& h) { h.alignment = 0; });
+	checkCorrupt ([] (AssetPackHeader& h) { h.indexOffset = 4; });
+	checkCorrupt ([] (AssetPackHeader& h) { h.indexOffset = 1 << 20; });
+	checkCorrupt ([] (AssetPackHeader& h) { h.entryCount = 1 << 20; });
+	checkCorrupt ([] (AssetPackHeader& h) { h.namesOffset = 1 << 20; });
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TEST (RejectsCorruptEntries)
+{
+	// Not sorted by hash
+	WriteCorruptPack (0, [] (AssetPackEntry& e) { e.nameHash = ~0ull; });
+	CHECK_THROWS (AssetPack pack (PACK_PATH));
+	WriteCorruptPack ("textures/ruby.jpg", [] (AssetPackEntry& e) { e.offset = 1ull << 40; });
+	CHECK_THROWS (AssetPack pack (PACK_PATH));
+	WriteCorruptPack ("textures/ruby.jpg", [] (AssetPackEntry& e) { e.offset += 1; });
+	CHECK_THROWS (AssetPack pack (PACK_PATH));
+	WriteCorruptPack ("textures/ruby.jpg", [] (AssetPackEntry& e) { e.storedSize = 1ull << 40; });
+	CHECK_THROWS (AssetPack pack (PACK_PATH));
+	WriteCorruptPack ("textures/ruby.jpg", [] (AssetPackEntry& e) { e.size += 1; });
+	CHECK_THROWS (AssetPack pack (PACK_PATH));
+	WriteCorruptPack ("textures/ruby.jpg", [] (AssetPackEntry& e) { e.nameOffset = 1 << 20; });
+	CHECK_THROWS (AssetPack pack (PACK_PATH));
+	WriteCorruptPack ("textures/ruby.jpg", [] (AssetPackEntry& e) {
+		e.compression = static_cast<AssetPackCompression> (7);
+	});
+	CHECK_THROWS (AssetPack pack (PACK_PATH));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TEST (RejectsImpossibleLz4Sizes)
+{
+	// Larger than the stored data can decompress to, which would otherwise
+	// only fail after allocating size bytes
+	WriteCorruptPack ("shaders.hlsl", [] (AssetPackEntry& e) {
+		e.size = e.storedSize * 255 + 1;
+	});
+	CHECK_THROWS (AssetPack pack (PACK_PATH));
+
+	WriteCorruptPack ("shaders.hlsl", [] (AssetPackEntry& e) { e.size = ~0ull; });
+	CHECK_THROWS (AssetPack pack (PACK_PATH));
+
+	WriteCorruptPack ("shaders.hlsl", [] (AssetPackEntry& e) { e.storedSize = 0; });
+	CHECK_THROWS (AssetPack pack (PACK_PATH));
+
+	// Possible, but wrong, sizes pass validation and fail on load
+	WriteCorruptPack ("shaders.hlsl", [] (AssetPackEntry& e) { e.size += 1; });
+	AssetPack pack (PACK_PATH);
+	CHECK_THROWS (pack.Load ("shaders.hlsl"));
+}
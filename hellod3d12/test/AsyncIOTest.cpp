@@ -0,0 +1,170 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+
+#include "Test.h"
+
+#include "AsyncIO.h"
+#include "TestFile.h"
+#include "TestImage.h"
+
+#include <atomic>
+#include <cstring>
+#include <functional>
+#include <vector>
+
+using namespace AMD;
+
+namespace {
+const AsyncIOEngine::Backend BACKENDS [] = {
+	AsyncIOEngine::Backend::ThreadPool,
+	AsyncIOEngine::Backend::IoUring
+};
+
+///////////////////////////////////////////////////////////////////////////////
+std::vector<std::uint8_t> WriteTestFile (const std::size_t size)
+{
+	auto contents = Test::CreateRandomBytes (size);
+	Test::WriteFileBytes ("AsyncIOTest.bin", contents);
+	return contents;
+}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Read the whole file in chunks with many reads in flight. If io_uring is not
+available, the second engine uses the thread pool too.
+*/
+TEST (ReadsMatchFile)
+{
+	const std::size_t chunkSize = 64 << 10;
+	const auto contents = WriteTestFile (100 * chunkSize);
+
+	for (const auto backend : BACKENDS) {
+		for (const bool directIo : { false, true }) {
+			AsyncIOEngine engine (8, backend);
+			AsyncFile file ("AsyncIOTest.bin", directIo);
+			AlignedBuffer buffer (contents.size ());
+			std::memset (buffer.GetData (), 0, buffer.GetSize ());
+
+			std::atomic<std::size_t> total (0);
+			std::atomic<int> failures (0);
+			for (std::size_t offset = 0; offset < contents.size (); offset += chunkSize) {
+				engine.Read (file, buffer.GetData () + offset, offset, chunkSize,
+					[&] (const std::size_t bytesRead, const bool success) {
+					total += bytesRead;
+					if (!success) {
+						++failures;
+					}
+				});
+			}
+
+			engine.WaitIdle ();
+
+			CHECK_EQUAL (0, failures.load ());
+			CHECK_EQUAL (contents.size (), total.load ());
+			CHECK (std::memcmp (buffer.GetData (), contents.data (), contents.size ()) == 0);
+		}
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TEST (ReadPastEndIsShort)
+{
+	const auto contents = WriteTestFile (10000);
+
+	for (const auto backend : BACKENDS) {
+		AsyncIOEngine engine (4, backend);
+		AsyncFile file ("AsyncIOTest.bin");
+		std::vector<std::uint8_t> buffer (16384);
+
+		CHECK_EQUAL (10000, engine.Read (file, buffer.data (), 0, buffer.size ()).get ());
+		CHECK (std::memcmp (buffer.data (), contents.data (), contents.size ()) == 0);
+
+		CHECK_EQUAL (0, engine.Read (file, buffer.data (), 20000, 100).get ());
+	}
+
+	// The tail of a direct file is not aligned, it must still be read
+	for (const auto backend : BACKENDS) {
+		AsyncIOEngine engine (4, backend);
+		AsyncFile file ("AsyncIOTest.bin", true);
+		AlignedBuffer buffer (16384);
+
+		CHECK_EQUAL (10000, engine.Read (file, buffer.GetData (), 0, buffer.GetSize ()).get ());
+		CHECK (std::memcmp (buffer.GetData (), contents.data (), contents.size ()) == 0);
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+With a queue depth of 1, every callback issues the next read while its own
+read still counts as in flight unless the slot is freed before the call.
+*/
+TEST (CallbacksCanSubmitReads)
+{
+	const std::size_t chunkSize = 4096;
+	const int chunkCount = 64;
+	const auto contents = WriteTestFile (chunkCount * chunkSize);
+
+	for (const auto backend : BACKENDS) {
+		AsyncIOEngine engine (1, backend);
+		AsyncFile file ("AsyncIOTest.bin");
+		std::vector<std::uint8_t> buffer (contents.size ());
+
+		std::atomic<int> completed (0);
+		std::function<void (int)> readChunk = [&] (const int chunk) {
+			engine.Read (file, buffer.data () + chunk * chunkSize, chunk * chunkSize,
+				chunkSize, [&, chunk] (const std::size_t, const bool) {
+				++completed;
+				if (chunk + 1 < chunkCount) {
+					readChunk (chunk + 1);
+				}
+			});
+		};
+
+		readChunk (0);
+
+		// Callbacks that submit keep the engine busy until the chain ends
+		engine.WaitIdle ();
+
+		CHECK_EQUAL (chunkCount, completed.load ());
+		CHECK (buffer == contents);
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TEST (DirectReadsMustBeAligned)
+{
+	WriteTestFile (16384);
+
+	AsyncIOEngine engine (4);
+	AsyncFile file ("AsyncIOTest.bin", true);
+	AlignedBuffer buffer (8192);
+
+	auto ignore = [] (const std::size_t, const bool) {};
+	CHECK_THROWS (engine.Read (file, buffer.GetData () + 1, 0, 4096, ignore));
+	CHECK_THROWS (engine.Read (file, buffer.GetData (), 1, 4096, ignore));
+	CHECK_THROWS (engine.Read (file, buffer.GetData (), 0, 100, ignore));
+
+	CHECK_THROWS (AsyncIOEngine (0));
+	CHECK_THROWS (AsyncFile ("AsyncIOTest.missing"));
+}
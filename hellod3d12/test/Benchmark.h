@@ -0,0 +1,69 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+
+#ifndef ANTERU_D3D12_SAMPLE_TEST_BENCHMARK_H_
+#define ANTERU_D3D12_SAMPLE_TEST_BENCHMARK_H_
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+
+namespace AMD {
+namespace Test {
+///////////////////////////////////////////////////////////////////////////////
+/**
+Run function repeatedly and return the fastest run in seconds. The first run
+is a warm-up and doesn't count.
+*/
+template <typename Function>
+double Measure (Function function, const int runs = 5)
+{
+	function ();
+
+	double best = 1e30;
+	for (int i = 0; i < runs; ++i) {
+		const auto start = std::chrono::steady_clock::now ();
+		function ();
+		const std::chrono::duration<double> elapsed =
+			std::chrono::steady_clock::now () - start;
+		best = (std::min) (best, elapsed.count ());
+	}
+
+	return best;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+inline void Report (const char* name, const double seconds,
+	const double bytes = 0)
+{
+	if (bytes > 0) {
+		std::printf ("%-48s %10.3f ms %10.2f GiB/s\n", name, seconds * 1e3,
+			bytes / seconds / (1 << 30));
+	} else {
+		std::printf ("%-48s %10.3f ms\n", name, seconds * 1e3);
+	}
+}
+}
+}
+
+#endif
@@ -0,0 +1,86 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+
+#include "Benchmark.h"
+
+#include "BlockCompression.h"
+#include "BlockDecoder.h"
+#include "TestImage.h"
+
+#include <string>
+
+using namespace AMD;
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Throughput and PSNR of every format and quality, on a 1024x1024 photo-like
+image, with alpha for BC3 and BC7.
+*/
+int main ()
+{
+	const int size = 1024;
+	const auto opaque = Test::CreateTestImage (size, size, false);
+	const auto transparent = Test::CreateTestImage (size, size, true);
+
+	const struct
+	{
+		const char* name;
+		BlockFormat format;
+	} formats [] = {
+		{ "BC1", BlockFormat::BC1 },
+		{ "BC3", BlockFormat::BC3 },
+		{ "BC7", BlockFormat::BC7 }
+	};
+
+	const struct
+	{
+		const char* name;
+		BlockCompressionQuality quality;
+	} qualities [] = {
+		{ "fast", BlockCompressionQuality::Fast },
+		{ "normal", BlockCompressionQuality::Normal },
+		{ "high", BlockCompressionQuality::High }
+	};
+
+	for (const auto& format : formats) {
+		const auto& image = (format.format == BlockFormat::BC1) ? opaque : transparent;
+		const int channelCount = (format.format == BlockFormat::BC1) ? 3 : 4;
+
+		for (const auto& quality : qualities) {
+			std::vector<std::uint8_t> blocks;
+			const auto seconds = Test::Measure ([&] () {
+				blocks = CompressImage (image.data (), size, size, size * 4,
+					format.format, quality.quality);
+			}, 3);
+
+			const auto psnr = Test::ComputePsnr (image,
+				Test::DecompressImage (blocks, size, size, format.format), channelCount);
+
+			std::printf ("%s %-6s %10.2f ms %8.2f MPixel/s %8.2f dB\n",
+				format.name, quality.name, seconds * 1e3,
+				size * size / seconds / 1e6, psnr);
+		}
+	}
+
+	return 0;
+}
@@ -0,0 +1,200 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+
+#include "Test.h"
+
+#include "BlockCompression.h"
+#include "BlockDecoder.h"
+#include "TestImage.h"
+
+using namespace AMD;
+
+namespace {
+///////////////////////////////////////////////////////////////////////////////
+double CompressAndMeasure (const std::vector<std::uint8_t>& image,
+	const int width, const int height, const BlockFormat format,
+	const BlockCompressionQuality quality, const int channelCount)
+{
+	const auto blocks = CompressImage (image.data (), width, height, width * 4,
+		format, quality);
+	return Test::ComputePsnr (image,
+		Test::DecompressImage (blocks, width, height, format), channelCount);
+}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TEST (SolidColorIsExact)
+{
+	// Representable in 565
+	std::vector<std::uint8_t> image (8 * 8 * 4);
+	for (std::size_t i = 0; i < image.size (); i += 4) {
+		image [i + 0] = 255;
+		image [i + 1] = 130;
+		image [i + 2] = 0;
+		image [i + 3] = 255;
+	}
+
+	const BlockCompressionQuality qualities [] = {
+		BlockCompressionQuality::Fast,
+		BlockCompressionQuality::Normal,
+		BlockCompressionQuality::High
+	};
+
+	for (const auto quality : qualities) {
+		CHECK_EQUAL (99.0, CompressAndMeasure (image, 8, 8, BlockFormat::BC1, quality, 4));
+		CHECK_EQUAL (99.0, CompressAndMeasure (image, 8, 8, BlockFormat::BC3, quality, 4));
+	}
+
+	// BC7 mode 6 shares the p-bit across channels, so it can be one off
+	const auto blocks = CompressImage (image.data (), 8, 8, 32,
+		BlockFormat::BC7, BlockCompressionQuality::Normal);
+	const auto decoded = Test::DecompressImage (blocks, 8, 8, BlockFormat::BC7);
+	for (std::size_t i = 0; i < image.size (); ++i) {
+		CHECK_NEAR (static_cast<int> (image [i]), static_cast<int> (decoded [i]), 1);
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TEST (PartialBlocksReplicateEdges)
+{
+	std::vector<std::uint8_t> image (5 * 3 * 4, 255);
+	for (int y = 0; y < 3; ++y) {
+		for (int x = 0; x < 5; ++x) {
+			image [(y * 5 + x) * 4 + 0] = static_cast<std::uint8_t> (x * 40);
+			image [(y * 5 + x) * 4 + 1] = static_cast<std::uint8_t> (255 - x * 40);
+		}
+	}
+
+	const auto blocks = CompressImage (image.data (), 5, 3, 5 * 4,
+		BlockFormat::BC1, BlockCompressionQuality::Normal);
+
+	CHECK_EQUAL (2 * 1 * 8, static_cast<int> (blocks.size ()));
+	CHECK (Test::ComputePsnr (image,
+		Test::DecompressImage (blocks, 5, 3, BlockFormat::BC1), 3) > 30);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Quality floors on a photo-like image; these also catch encoder/decoder
+mismatches, which drop the PSNR far below.
+*/
+TEST (ColorQuality)
+{
+	const int size = 512;
+	const auto image = Test::CreateTestImage (size, size, false);
+
+	const auto fast = CompressAndMeasure (image, size, size,
+		BlockFormat::BC1, BlockCompressionQuality::Fast, 3);
+	const auto normal = CompressAndMeasure (image, size, size,
+		BlockFormat::BC1, BlockCompressionQuality::Normal, 3);
+	const auto high = CompressAndMeasure (image, size, size,
+		BlockFormat::BC1, BlockCompressionQuality::High, 3);
+	const auto bc7 = CompressAndMeasure (image, size, size,
+		BlockFormat::BC7, BlockCompressionQuality::Normal, 3);
+
+	CHECK (fast > 28);
+	CHECK (normal > 37);
+	CHECK (high > normal + 0.2);
+	CHECK (bc7 > 40);
+	CHECK (bc7 > high);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TEST (AlphaQuality)
+{
+	const int size = 512;
+	const auto image = Test::CreateTestImage (size, size, true);
+
+	const auto normal = CompressAndMeasure (image, size, size,
+		BlockFormat::BC3, BlockCompressionQuality::Normal, 4);
+	const auto high = CompressAndMeasure (image, size, size,
+		BlockFormat::BC3, BlockCompressionQuality::High, 4);
+	const auto bc7 = CompressAndMeasure (image, size, size,
+		BlockFormat::BC7, BlockCompressionQuality::High, 4);
+
+	CHECK (normal > 38);
+	CHECK (high > normal);
+	CHECK (bc7 > 40);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+An anti-aliased cutout edge: 0 and 255 next to a few intermediate values.
+The six alpha mode stores the extremes exactly.
+*/
+TEST (HighUsesSixAlphaMode)
+{
+	std::vector<std::uint8_t> image (4 * 4 * 4, 128);
+	const std::uint8_t alphas [16] = {
+		0, 0, 0, 0,
+		0, 90, 100, 255,
+		0, 110, 120, 255,
+		255, 255, 255, 255
+	};
+
+	for (int i = 0; i < 16; ++i) {
+		image [i * 4 + 3] = alphas [i];
+	}
+
+	const auto normal = CompressImage (image.data (), 4, 4, 16,
+		BlockFormat::BC3, BlockCompressionQuality::Normal);
+	const auto high = CompressImage (image.data (), 4, 4, 16,
+		BlockFormat::BC3, BlockCompressionQuality::High);
+
+	// alpha0 <= alpha1 selects the six alpha mode
+	CHECK (normal [0] > normal [1]);
+	CHECK (high [0] <= high [1]);
+
+	const auto normalDecoded = Test::DecompressImage (normal, 4, 4, BlockFormat::BC3);
+	const auto highDecoded = Test::DecompressImage (high, 4, 4, BlockFormat::BC3);
+	CHECK (Test::ComputePsnr (image, highDecoded, 4) > Test::ComputePsnr (image, normalDecoded, 4));
+
+	for (int i = 0; i < 16; ++i) {
+		if (alphas [i] == 0 || alphas [i] == 255) {
+			CHECK_EQUAL (static_cast<int> (alphas [i]), static_cast<int> (highDecoded [i * 4 + 3]));
+		}
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TEST (ChooseFormat)
+{
+	auto image = Test::CreateTestImage (16, 16, false);
+
+	CHECK (ChooseBlockFormat (image.data (), 16, 16, 64,
+		BlockCompressionQuality::Normal) == BlockFormat::BC1);
+	CHECK (ChooseBlockFormat (image.data (), 16, 16, 64,
+		BlockCompressionQuality::High) == BlockFormat::BC7);
+
+	image [15 * 64 + 15 * 4 + 3] = 254;
+	CHECK (ChooseBlockFormat (image.data (), 16, 16, 64,
+		BlockCompressionQuality::Normal) == BlockFormat::BC3);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TEST (EmptyImageThrows)
+{
+	std::uint8_t pixel [4] = {};
+	CHECK_THROWS (CompressImage (pixel, 0, 1, 4, BlockFormat::BC1,
+		BlockCompressionQuality::Normal));
+}
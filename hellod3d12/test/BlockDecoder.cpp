@@ -0,0 +1,227 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+
+#include "BlockDecoder.h"
+
+#include <cstring>
+#include <stdexcept>
+
+namespace AMD {
+namespace Test {
+namespace {
+///////////////////////////////////////////////////////////////////////////////
+void Expand565 (const std::uint16_t color, int* rgb)
+{
+	const int r = (color >> 11) & 31;
+	const int g = (color >> 5) & 63;
+	const int b = color & 31;
+
+	rgb [0] = (r << 3) | (r >> 2);
+	rgb [1] = (g << 2) | (g >> 4);
+	rgb [2] = (b << 3) | (b >> 2);
+}
+
+/**
+Decode the color part of a BC1/BC3 block into texels [16][4], alpha is left
+untouched unless BC1 selects the transparent entry.
+*/
+void DecodeColorBlock (const std::uint8_t* block, const bool allowThreeColor,
+	std::uint8_t texels [16][4])
+{
+	std::uint16_t color0, color1;
+	std::uint32_t indices;
+	std::memcpy (&color0, block, 2);
+	std::memcpy (&color1, block + 2, 2);
+	std::memcpy (&indices, block + 4, 4);
+
+	int palette [4][4];
+	Expand565 (color0, palette [0]);
+	Expand565 (color1, palette [1]);
+	palette [0][3] = palette [1][3] = palette [2][3] = palette [3][3] = 255;
+
+	for (int c = 0; c < 3; ++c) {
+		if (color0 > color1 || !allowThreeColor) {
+			palette [2][c] = (2 * palette [0][c] + palette [1][c] + 1) / 3;
+			palette [3][c] = (palette [0][c] + 2 * palette [1][c] + 1) / 3;
+		} else {
+			palette [2][c] = (palette [0][c] + palette [1][c]) / 2;
+			palette [3][c] = 0;
+		}
+	}
+
+	if (color0 <= color1 && allowThreeColor) {
+		palette [3][3] = 0;
+	}
+
+	for (int i = 0; i < 16; ++i) {
+		const int index = (indices >> (i * 2)) & 3;
+		for (int c = 0; c < 3; ++c) {
+			texels [i][c] = static_cast<std::uint8_t> (palette [index][c]);
+		}
+
+		if (allowThreeColor) {
+			texels [i][3] = static_cast<std::uint8_t> (palette [index][3]);
+		}
+	}
+}
+
+void DecodeAlphaBlock (const std::uint8_t* block, std::uint8_t texels [16][4])
+{
+	const int alpha0 = block [0];
+	const int alpha1 = block [1];
+
+	int palette [8] = { alpha0, alpha1 };
+	if (alpha0 > alpha1) {
+		for (int i = 1; i < 7; ++i) {
+			palette [1 + i] = ((7 - i) * alpha0 + i * alpha1 + 3) / 7;
+		}
+	} else {
+		for (int i = 1; i < 5; ++i) {
+			palette [1 + i] = ((5 - i) * alpha0 + i * alpha1 + 2) / 5;
+		}
+		palette [6] = 0;
+		palette [7] = 255;
+	}
+
+	std::uint64_t indices = 0;
+	for (int i = 0; i < 6; ++i) {
+		indices |= static_cast<std::uint64_t> (block [2 + i]) << (i * 8);
+	}
+
+	for (int i = 0; i < 16; ++i) {
+		texels [i][3] = static_cast<std::uint8_t> (palette [(indices >> (i * 3)) & 7]);
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+class BitReader
+{
+public:
+	explicit BitReader (const std::uint8_t* block)
+		: block_ (block)
+	{
+	}
+
+	int Read (const int bitCount)
+	{
+		int result = 0;
+		for (int i = 0; i < bitCount; ++i) {
+			result |= ((block_ [position_ / 8] >> (position_ % 8)) & 1) << i;
+			++position_;
+		}
+
+		return result;
+	}
+
+private:
+	const std::uint8_t* block_;
+	int position_ = 0;
+};
+
+void DecodeBC7Block (const std::uint8_t* block, std::uint8_t texels [16][4])
+{
+	static const int weights [16] = {
+		0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64
+	};
+
+	BitReader reader (block);
+	if (reader.Read (7) != (1 << 6)) {
+		throw std::runtime_error ("Only BC7 mode 6 is supported");
+	}
+
+	int endpoints [2][4];
+	for (int c = 0; c < 4; ++c) {
+		endpoints [0][c] = reader.Read (7);
+		endpoints [1][c] = reader.Read (7);
+	}
+
+	const int p0 = reader.Read (1);
+	const int p1 = reader.Read (1);
+	for (int c = 0; c < 4; ++c) {
+		endpoints [0][c] = (endpoints [0][c] << 1) | p0;
+		endpoints [1][c] = (endpoints [1][c] << 1) | p1;
+	}
+
+	for (int i = 0; i < 16; ++i) {
+		const int index = reader.Read (i == 0 ? 3 : 4);
+		for (int c = 0; c < 4; ++c) {
+			texels [i][c] = static_cast<std::uint8_t> (((64 - weights [index]) * endpoints [0][c] +
+				weights [index] * endpoints [1][c] + 32) >> 6);
+		}
+	}
+}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::vector<std::uint8_t> DecompressImage (const std::vector<std::uint8_t>& blocks,
+	const int width, const int height, const BlockFormat format)
+{
+	const int blocksWide = (width + 3) / 4;
+	const int blocksHigh = (height + 3) / 4;
+	const int blockSize = GetBlockSize (format);
+
+	if (blocks.size () != static_cast<std::size_t> (blocksWide) * blocksHigh * blockSize) {
+		throw std::runtime_error ("Block data has the wrong size");
+	}
+
+	std::vector<std::uint8_t> result (static_cast<std::size_t> (width) * height * 4);
+
+	for (int blockY = 0; blockY < blocksHigh; ++blockY) {
+		for (int blockX = 0; blockX < blocksWide; ++blockX) {
+			const std::uint8_t* block = blocks.data () +
+				(static_cast<std::size_t> (blockY) * blocksWide + blockX) * blockSize;
+
+			std::uint8_t texels [16][4];
+			std::memset (texels, 255, sizeof (texels));
+
+			switch (format) {
+			case BlockFormat::BC1:
+				DecodeColorBlock (block, true, texels);
+				break;
+
+			case BlockFormat::BC3:
+				DecodeAlphaBlock (block, texels);
+				DecodeColorBlock (block + 8, false, texels);
+				break;
+
+			case BlockFormat::BC7:
+				DecodeBC7Block (block, texels);
+				break;
+			}
+
+			for (int i = 0; i < 16; ++i) {
+				const int x = blockX * 4 + i % 4;
+				const int y = blockY * 4 + i / 4;
+
+				if (x < width && y < height) {
+					std::memcpy (result.data () + (static_cast<std::size_t> (y) * width + x) * 4,
+						texels [i], 4);
+				}
+			}
+		}
+	}
+
+	return result;
+}
+}
+}
@@ -0,0 +1,47 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+
+#ifndef ANTERU_D3D12_SAMPLE_TEST_BLOCKDECODER_H_
+#define ANTERU_D3D12_SAMPLE_TEST_BLOCKDECODER_H_
+
+#include "BlockCompression.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace AMD {
+namespace Test {
+///////////////////////////////////////////////////////////////////////////////
+/**
+Reference decoder for the blocks written by CompressImage, following the
+D3D11 functional specification. BC1 handles both color modes; BC7 only
+decodes mode 6 and throws for other modes.
+
+Returns a width x height RGBA8 image.
+*/
+std::vector<std::uint8_t> DecompressImage (const std::vector<std::uint8_t>& blocks,
+	const int width, const int height, const BlockFormat format);
+}
+}
+
+#endif
@@ -0,0 +1,155 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+
+
+#include "Benchmark.h"
+
+#include "CommandBundle.h"
+#include "FakeD3D12.h"
+#include "Hash.h"
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+using namespace AMD;
+using Microsoft::WRL::ComPtr;
+
+namespace {
+const int FRAME_COUNT = 1000;
+const int QUEUE_SLOT_COUNT = 3;
+
+///////////////////////////////////////////////////////////////////////////////
+struct Scene
+{
+	ID3D12RootSignature rootSignature;
+	ID3D12PipelineState pipelineState;
+	D3D12_VERTEX_BUFFER_VIEW vertexBufferView;
+	D3D12_INDEX_BUFFER_VIEW indexBufferView;
+	int drawCount;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+The draws of D3D12Quad, drawCount times.
+*/
+void RecordDraws (const Scene& scene, ID3D12GraphicsCommandList* commandList)
+{
+	for (int i = 0; i < scene.drawCount; ++i) {
+		commandList->SetPipelineState (const_cast<ID3D12PipelineState*> (&scene.pipelineState));
+		commandList->IASetPrimitiveTopology (D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+		commandList->IASetVertexBuffers (0, 1, &scene.vertexBufferView);
+		commandList->IASetIndexBuffer (&scene.indexBufferView);
+		commandList->DrawIndexedInstanced (6, 1, 0, 0, 0);
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::uint64_t GetInputKey (const Scene& scene)
+{
+	const std::uint64_t inputs [] = {
+		reinterpret_cast<std::uintptr_t> (&scene.pipelineState),
+		scene.vertexBufferView.BufferLocation,
+		scene.vertexBufferView.SizeInBytes,
+		scene.vertexBufferView.StrideInBytes,
+		scene.indexBufferView.BufferLocation,
+		scene.indexBufferView.SizeInBytes,
+		static_cast<std::uint64_t> (scene.indexBufferView.Format)
+	};
+
+	return HashFNV1a (inputs, sizeof (inputs));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Start a new frame on commandList and set the root signature, which bundles
+inherit.
+*/
+void BeginFrame (Scene& scene, Test::FakeCommandList& commandList)
+{
+	commandList.Close ();
+	commandList.Reset (nullptr, nullptr);
+	commandList.SetGraphicsRootSignature (&scene.rootSignature);
+}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Record FRAME_COUNT frames of a static scene onto a direct command list, once
+with the draws recorded directly every frame, as the samples did before, and
+once replaying them from a CommandBundle per queue slot, as D3D12Quad does
+now. Reports the API calls the direct list sees per frame and the time for
+all frames; the command list stub logs every call, so the time is mostly
+per-call overhead, like in a real driver. Run from the build directory.
+*/
+int main ()
+{
+	const int drawCounts [] = { 1, 16, 256 };
+
+	ComPtr<Test::FakeDevice> device;
+	device.Attach (new Test::FakeDevice);
+
+	for (const auto drawCount : drawCounts) {
+		Scene scene;
+		scene.vertexBufferView = { 0x10000, 80, 20 };
+		scene.indexBufferView = { 0x20000, 24, DXGI_FORMAT_R32_UINT };
+		scene.drawCount = drawCount;
+
+		Test::FakeCommandList commandList (D3D12_COMMAND_LIST_TYPE_DIRECT);
+		const auto label = std::to_string (drawCount) + " draws";
+
+		std::size_t directCalls = 0;
+		const auto directTime = Test::Measure ([&] () {
+			for (int frame = 0; frame < FRAME_COUNT; ++frame) {
+				BeginFrame (scene, commandList);
+				RecordDraws (scene, &commandList);
+			}
+			directCalls = commandList.GetCalls ().size ();
+		});
+
+		CommandBundle bundle (device.Get (), QUEUE_SLOT_COUNT,
+			[&scene] (ID3D12GraphicsCommandList* bundleList) {
+			RecordDraws (scene, bundleList);
+		});
+
+		std::size_t bundleCalls = 0;
+		const auto bundleTime = Test::Measure ([&] () {
+			for (int frame = 0; frame < FRAME_COUNT; ++frame) {
+				BeginFrame (scene, commandList);
+				bundle.Execute (&commandList, frame % QUEUE_SLOT_COUNT,
+					GetInputKey (scene));
+			}
+			bundleCalls = commandList.GetCalls ().size ();
+		});
+
+		std::printf ("%s: %d API calls per frame direct, %d with a bundle, "
+			"%d bundle recordings\n", label.c_str (),
+			static_cast<int> (directCalls), static_cast<int> (bundleCalls),
+			bundle.GetRecordCount ());
+
+		Test::Report ((label + ", direct").c_str (), directTime);
+		Test::Report ((label + ", bundle").c_str (), bundleTime);
+	}
+
+	return 0;
+}
@@ -0,0 +1,197 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+
+
+#include "Test.h"
+
+#include "CommandBundle.h"
+#include "FakeD3D12.h"
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace AMD;
+using Microsoft::WRL::ComPtr;
+
+namespace {
+const std::vector<std::string> DRAW_CALLS = {
+	"SetPipelineState", "IASetPrimitiveTopology", "IASetVertexBuffers",
+	"IASetIndexBuffer", "DrawIndexedInstanced"
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+What D3D12Quad records into its bundle.
+*/
+void RecordDraw (ID3D12GraphicsCommandList* bundle)
+{
+	static ID3D12PipelineState pipelineState;
+	const D3D12_VERTEX_BUFFER_VIEW vertexBufferView = { 0x10000, 80, 20 };
+	const D3D12_INDEX_BUFFER_VIEW indexBufferView = { 0x20000, 24, DXGI_FORMAT_R32_UINT };
+
+	bundle->SetPipelineState (&pipelineState);
+	bundle->IASetPrimitiveTopology (D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+	bundle->IASetVertexBuffers (0, 1, &vertexBufferView);
+	bundle->IASetIndexBuffer (&indexBufferView);
+	bundle->DrawIndexedInstanced (6, 1, 0, 0, 0);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+ComPtr<Test::FakeDevice> CreateDevice ()
+{
+	ComPtr<Test::FakeDevice> device;
+	device.Attach (new Test::FakeDevice);
+	return device;
+}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TEST (RecordsEachSlotOnce)
+{
+	auto device = CreateDevice ();
+	CommandBundle bundle (device.Get (), 3, RecordDraw);
+	Test::FakeCommandList commandList (D3D12_COMMAND_LIST_TYPE_DIRECT);
+
+	for (int frame = 0; frame < 30; ++frame) {
+		commandList.Close ();
+		commandList.Reset (nullptr, nullptr);
+
+		bundle.Execute (&commandList, frame % 3, 42);
+
+		// Only the replay ends up on the direct list
+		CHECK (commandList.GetCalls () == std::vector<std::string> { "ExecuteBundle" });
+	}
+
+	CHECK_EQUAL (3, bundle.GetRecordCount ());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TEST (RecordsIntoClosedBundles)
+{
+	auto device = CreateDevice ();
+	std::vector<Test::FakeCommandList*> recorded;
+
+	CommandBundle bundle (device.Get (), 2,
+		[&recorded] (ID3D12GraphicsCommandList* commandList) {
+		recorded.push_back (static_cast<Test::FakeCommandList*> (commandList));
+		RecordDraw (commandList);
+	});
+
+	// Executing an open bundle throws, so this also checks Close was called
+	Test::FakeCommandList commandList (D3D12_COMMAND_LIST_TYPE_DIRECT);
+	bundle.Execute (&commandList, 0);
+	bundle.Execute (&commandList, 1);
+
+	CHECK_EQUAL (2, recorded.size ());
+	CHECK (recorded [0] != recorded [1]);
+
+	for (const auto list : recorded) {
+		CHECK (list->GetType () == D3D12_COMMAND_LIST_TYPE_BUNDLE);
+		CHECK (list->GetCalls () == DRAW_CALLS);
+	}
+
+	// Re-recording reuses the slot's bundle
+	bundle.Invalidate ();
+	bundle.Execute (&commandList, 0);
+	CHECK_EQUAL (3, recorded.size ());
+	CHECK (recorded [2] == recorded [0]);
+	CHECK (recorded [2]->GetCalls () == DRAW_CALLS);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TEST (InputKeyChangeRecordsAgain)
+{
+	auto device = CreateDevice ();
+	CommandBundle bundle (device.Get (), 3, RecordDraw);
+	Test::FakeCommandList commandList (D3D12_COMMAND_LIST_TYPE_DIRECT);
+
+	for (int slot = 0; slot < 3; ++slot) {
+		bundle.Execute (&commandList, slot, 1);
+	}
+	CHECK_EQUAL (3, bundle.GetRecordCount ());
+
+	// Each slot picks up the change on its own next use
+	bundle.Execute (&commandList, 0, 2);
+	CHECK_EQUAL (4, bundle.GetRecordCount ());
+	bundle.Execute (&commandList, 1, 1);
+	CHECK_EQUAL (4, bundle.GetRecordCount ());
+	bundle.Execute (&commandList, 1, 2);
+	bundle.Execute (&commandList, 2, 2);
+	CHECK_EQUAL (6, bundle.GetRecordCount ());
+
+	for (int slot = 0; slot < 3; ++slot) {
+		bundle.Execute (&commandList, slot, 2);
+	}
+	CHECK_EQUAL (6, bundle.GetRecordCount ());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TEST (InvalidateRecordsAllSlotsAgain)
+{
+	auto device = CreateDevice ();
+	CommandBundle bundle (device.Get (), 3, RecordDraw);
+	Test::FakeCommandList commandList (D3D12_COMMAND_LIST_TYPE_DIRECT);
+
+	for (int slot = 0; slot < 3; ++slot) {
+		bundle.Execute (&commandList, slot);
+	}
+
+	bundle.Invalidate ();
+	// Nothing happens until a slot gets used
+	CHECK_EQUAL (3, bundle.GetRecordCount ());
+
+	for (int round = 0; round < 2; ++round) {
+		for (int slot = 0; slot < 3; ++slot) {
+			bundle.Execute (&commandList, slot);
+		}
+	}
+
+	CHECK_EQUAL (6, bundle.GetRecordCount ());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TEST (FailedRecordingCanBeRetried)
+{
+	auto device = CreateDevice ();
+	bool fail = true;
+
+	CommandBundle bundle (device.Get (), 1,
+		[&fail] (ID3D12GraphicsCommandList* commandList) {
+		RecordDraw (commandList);
+		if (fail) {
+			throw std::runtime_error ("Recording failed");
+		}
+	});
+
+	Test::FakeCommandList commandList (D3D12_COMMAND_LIST_TYPE_DIRECT);
+	CHECK_THROWS (bundle.Execute (&commandList, 0));
+	CHECK_EQUAL (0, bundle.GetRecordCount ());
+	CHECK (commandList.GetCalls ().empty ());
+
+	// The bundle was closed, so it can be reset, and is still invalid
+	fail = false;
+	bundle.Execute (&commandList, 0);
+	CHECK_EQUAL (1, bundle.GetRecordCount ());
+	CHECK (commandList.GetCalls () == std::vector<std::string> { "ExecuteBundle" });
+}
@@ -0,0 +1,301 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+
+#include "Test.h"
+
+#include "CopyableFootprints.h"
+
+#include <vector>
+
+using namespace AMD;
+
+namespace {
+///////////////////////////////////////////////////////////////////////////////
+D3D12_RESOURCE_DESC CreateTextureDesc (const D3D12_RESOURCE_DIMENSION dimension,
+	const DXGI_FORMAT format, const UINT64 width, const UINT height,
+	const UINT16 depthOrArraySize, const UINT16 mipLevels)
+{
+	D3D12_RESOURCE_DESC desc = {};
+	desc.Dimension = dimension;
+	desc.Format = format;
+	desc.Width = width;
+	desc.Height = height;
+	desc.DepthOrArraySize = depthOrArraySize;
+	desc.MipLevels = mipLevels;
+	desc.SampleDesc.Count = 1;
+	return desc;
+}
+
+D3D12_RESOURCE_DESC CreateTexture2DDesc (const DXGI_FORMAT format,
+	const UINT64 width, const UINT height, const UINT16 arraySize, const UINT16 mipLevels)
+{
+	return CreateTextureDesc (D3D12_RESOURCE_DIMENSION_TEXTURE2D, format,
+		width, height, arraySize, mipLevels);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+struct Footprints
+{
+	std::vector<D3D12_PLACED_SUBRESOURCE_FOOTPRINT> layouts;
+	std::vector<UINT> rowCounts;
+	std::vector<UINT64> rowSizes;
+	UINT64 totalBytes = 0;
+};
+
+Footprints Compute (const D3D12_RESOURCE_DESC& desc, const UINT firstSubresource,
+	const UINT subresourceCount, const UINT64 baseOffset = 0)
+{
+	Footprints result;
+	result.layouts.resize (subresourceCount);
+	result.rowCounts.resize (subresourceCount);
+	result.rowSizes.resize (subresourceCount);
+
+	GetCopyableFootprints (desc, firstSubresource, subresourceCount, baseOffset,
+		result.layouts.data (), result.rowCounts.data (), result.rowSizes.data (),
+		&result.totalBytes);
+
+	return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Answers GetCopyableFootprints with the CPU implementation, optionally with
+the row pitch off by one alignment step, to test CheckCopyableFootprints.
+*/
+class FootprintDevice : public ID3D12Device
+{
+public:
+	explicit FootprintDevice (const bool wrongPitch)
+		: wrongPitch_ (wrongPitch)
+	{
+	}
+
+	void GetCopyableFootprints (const D3D12_RESOURCE_DESC* desc, UINT firstSubresource,
+		UINT subresourceCount, UINT64 baseOffset,
+		D3D12_PLACED_SUBRESOURCE_FOOTPRINT* layouts, UINT* rowCounts,
+		UINT64* rowSizes, UINT64* totalBytes) override
+	{
+		AMD::GetCopyableFootprints (*desc, firstSubresource, subresourceCount,
+			baseOffset, layouts, rowCounts, rowSizes, totalBytes);
+
+		if (wrongPitch_) {
+			layouts [0].Footprint.RowPitch += D3D12_TEXTURE_DATA_PITCH_ALIGNMENT;
+		}
+	}
+
+private:
+	bool wrongPitch_;
+};
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TEST (Plain)
+{
+	// 256 * 4 is pitch aligned already
+	CHECK_EQUAL (256 * 256 * 4, GetUploadBufferSize (
+		CreateTexture2DDesc (DXGI_FORMAT_R8G8B8A8_UNORM, 256, 256, 1, 1), 0, 1));
+
+	// 100 * 4 gets padded to 512, but not the last row
+	const auto footprints = Compute (
+		CreateTexture2DDesc (DXGI_FORMAT_R8G8B8A8_UNORM, 100, 100, 1, 1), 0, 1);
+	CHECK_EQUAL (0, footprints.layouts [0].Offset);
+	CHECK_EQUAL (DXGI_FORMAT_R8G8B8A8_UNORM, footprints.layouts [0].Footprint.Format);
+	CHECK_EQUAL (100, footprints.layouts [0].Footprint.Width);
+	CHECK_EQUAL (100, footprints.layouts [0].Footprint.Height);
+	CHECK_EQUAL (1, footprints.layouts [0].Footprint.Depth);
+	CHECK_EQUAL (512, footprints.layouts [0].Footprint.RowPitch);
+	CHECK_EQUAL (100, footprints.rowCounts [0]);
+	CHECK_EQUAL (400, footprints.rowSizes [0]);
+	CHECK_EQUAL (512 * 99 + 400, footprints.totalBytes);
+
+	// Different texel sizes
+	CHECK_EQUAL (16 * 16, Compute (
+		CreateTexture2DDesc (DXGI_FORMAT_R32G32B32A32_FLOAT, 16, 1, 1, 1), 0, 1).rowSizes [0]);
+	CHECK_EQUAL (30, Compute (
+		CreateTexture2DDesc (DXGI_FORMAT_R16_UNORM, 15, 1, 1, 1), 0, 1).rowSizes [0]);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TEST (MipChain)
+{
+	// 0 mip levels is a full chain, 11 levels for 1280x720
+	const auto footprints = Compute (
+		CreateTexture2DDesc (DXGI_FORMAT_R8G8B8A8_UNORM_SRGB, 1280, 720, 1, 0), 0, 11);
+
+	CHECK_EQUAL (5120, footprints.layouts [0].Footprint.RowPitch);
+	CHECK_EQUAL (720, footprints.rowCounts [0]);
+	CHECK_EQUAL (5120 * 720, footprints.layouts [1].Offset);
+	CHECK_EQUAL (640, footprints.layouts [1].Footprint.Width);
+
+	// 40x22
+	CHECK_EQUAL (40, footprints.layouts [5].Footprint.Width);
+	CHECK_EQUAL (22, footprints.layouts [5].Footprint.Height);
+	CHECK_EQUAL (160, footprints.rowSizes [5]);
+	CHECK_EQUAL (256, footprints.layouts [5].Footprint.RowPitch);
+
+	CHECK_EQUAL (1, footprints.layouts [10].Footprint.Width);
+	CHECK_EQUAL (1, footprints.layouts [10].Footprint.Height);
+
+	for (const auto& layout : footprints.layouts) {
+		CHECK_EQUAL (0, layout.Offset % D3D12_TEXTURE_DATA_PLACEMENT_ALIGNMENT);
+	}
+
+	CHECK_EQUAL (footprints.layouts [10].Offset + 4, footprints.totalBytes);
+
+	CHECK_THROWS (Compute (
+		CreateTexture2DDesc (DXGI_FORMAT_R8G8B8A8_UNORM, 4, 4, 1, 1), 0, 2));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TEST (BlockCompressed)
+{
+	const auto footprints = Compute (
+		CreateTexture2DDesc (DXGI_FORMAT_BC1_UNORM_SRGB, 1280, 720, 1, 0), 0, 11);
+
+	// 320x180 blocks of 8 bytes
+	CHECK_EQUAL (320 * 8, footprints.rowSizes [0]);
+	CHECK_EQUAL (180, footprints.rowCounts [0]);
+	CHECK_EQUAL (2560, footprints.layouts [0].Footprint.RowPitch);
+
+	// Mip 6 is 20x11, which is 5x3 blocks; the footprint covers whole blocks
+	CHECK_EQUAL (20, footprints.layouts [6].Footprint.Width);
+	CHECK_EQUAL (12, footprints.layouts [6].Footprint.Height);
+	CHECK_EQUAL (3, footprints.rowCounts [6]);
+	CHECK_EQUAL (40, footprints.rowSizes [6]);
+
+	// The 1x1 level still takes a full block
+	CHECK_EQUAL (4, footprints.layouts [10].Footprint.Width);
+	CHECK_EQUAL (4, footprints.layouts [10].Footprint.Height);
+	CHECK_EQUAL (1, footprints.rowCounts [10]);
+	CHECK_EQUAL (8, footprints.rowSizes [10]);
+
+	// 16 byte blocks
+	const auto bc7 = Compute (
+		CreateTexture2DDesc (DXGI_FORMAT_BC7_UNORM, 64, 64, 1, 1), 0, 1);
+	CHECK_EQUAL (256, bc7.rowSizes [0]);
+	CHECK_EQUAL (16, bc7.rowCounts [0]);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TEST (Array)
+{
+	// Subresource order is all mips of slice 0, then slice 1, ...
+	const auto desc = CreateTexture2DDesc (DXGI_FORMAT_BC7_UNORM, 64, 64, 3, 2);
+	const auto footprints = Compute (desc, 0, 6);
+
+	CHECK_EQUAL (256, footprints.rowSizes [0]);
+	CHECK_EQUAL (4096, footprints.layouts [1].Offset);
+	CHECK_EQUAL (128, footprints.rowSizes [1]);
+	CHECK_EQUAL (4096 + 2048, footprints.layouts [2].Offset);
+	CHECK_EQUAL (64, footprints.layouts [2].Footprint.Width);
+	CHECK_EQUAL (32, footprints.layouts [3].Footprint.Width);
+	CHECK_EQUAL (footprints.layouts [5].Offset + 256 * 7 + 128, footprints.totalBytes);
+
+	// A range starting in the middle is placed from 0
+	const auto range = Compute (desc, 3, 2);
+	CHECK_EQUAL (0, range.layouts [0].Offset);
+	CHECK_EQUAL (32, range.layouts [0].Footprint.Width);
+	CHECK_EQUAL (64, range.layouts [1].Footprint.Width);
+
+	CHECK_THROWS (Compute (desc, 5, 2));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TEST (BaseOffset)
+{
+	const auto desc = CreateTexture2DDesc (DXGI_FORMAT_R8G8B8A8_UNORM, 100, 30, 2, 0);
+	const UINT subresourceCount = 2 * 7;
+
+	const auto base = Compute (desc, 0, subresourceCount);
+	const auto offset = Compute (desc, 0, subresourceCount, 1024);
+
+	// Everything moves by the base offset, the total does not include it
+	for (UINT i = 0; i < subresourceCount; ++i) {
+		CHECK_EQUAL (base.layouts [i].Offset + 1024, offset.layouts [i].Offset);
+		CHECK_EQUAL (base.layouts [i].Footprint.RowPitch, offset.layouts [i].Footprint.RowPitch);
+		CHECK_EQUAL (base.rowCounts [i], offset.rowCounts [i]);
+	}
+
+	CHECK_EQUAL (base.totalBytes, offset.totalBytes);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TEST (VolumeAndOneDimensional)
+{
+	const auto volume = Compute (CreateTextureDesc (D3D12_RESOURCE_DIMENSION_TEXTURE3D,
+		DXGI_FORMAT_R16G16B16A16_TYPELESS, 16, 16, 8, 0), 0, 5);
+
+	CHECK_EQUAL (8, volume.layouts [0].Footprint.Depth);
+	CHECK_EQUAL (256, volume.layouts [0].Footprint.RowPitch);
+	CHECK_EQUAL (256 * 16 * 8, volume.layouts [1].Offset);
+	CHECK_EQUAL (4, volume.layouts [1].Footprint.Depth);
+	CHECK_EQUAL (1, volume.layouts [4].Footprint.Depth);
+
+	const auto line = Compute (CreateTextureDesc (D3D12_RESOURCE_DIMENSION_TEXTURE1D,
+		DXGI_FORMAT_R8_UNORM, 300, 1, 1, 0), 0, 9);
+
+	CHECK_EQUAL (512, line.layouts [0].Footprint.RowPitch);
+	CHECK_EQUAL (512, line.layouts [1].Offset);
+	CHECK_EQUAL (1, line.layouts [8].Footprint.Width);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TEST (Buffer)
+{
+	const auto desc = CreateTextureDesc (D3D12_RESOURCE_DIMENSION_BUFFER,
+		DXGI_FORMAT_UNKNOWN, 1000, 1, 1, 1);
+
+	CHECK_EQUAL (1000, GetUploadBufferSize (desc, 0, 1));
+	CHECK_THROWS (Compute (desc, 1, 1));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TEST (PlanarFormatsAreRejected)
+{
+	FormatBlockInfo info;
+	CHECK (!GetFormatBlockInfo (DXGI_FORMAT_D24_UNORM_S8_UINT, &info));
+	CHECK (!GetFormatBlockInfo (DXGI_FORMAT_R32G8X24_TYPELESS, &info));
+	CHECK (!GetFormatBlockInfo (DXGI_FORMAT_NV12, &info));
+	CHECK (!GetFormatBlockInfo (DXGI_FORMAT_UNKNOWN, &info));
+
+	CHECK_THROWS (GetUploadBufferSize (
+		CreateTexture2DDesc (DXGI_FORMAT_D24_UNORM_S8_UINT, 4, 4, 1, 1), 0, 1));
+	CHECK_THROWS (GetUploadBufferSize (
+		CreateTexture2DDesc (DXGI_FORMAT_NV12, 4, 4, 1, 1), 0, 1));
+
+	// Single plane depth works
+	CHECK (GetFormatBlockInfo (DXGI_FORMAT_D32_FLOAT, &info));
+	CHECK_EQUAL (4, info.bytesPerBlock);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TEST (CheckAgainstDevice)
+{
+	const auto desc = CreateTexture2DDesc (DXGI_FORMAT_BC3_UNORM, 100, 60, 2, 0);
+
+	FootprintDevice matching (false);
+	CHECK (CheckCopyableFootprints (&matching, desc, 0, 14));
+
+	FootprintDevice wrong (true);
+	CHECK (!CheckCopyableFootprints (&wrong, desc, 0, 14));
+}
@@ -0,0 +1,299 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#include "Test.h"
+
+#include "Coroutine.h"
+#include "FakeD3D12.h"
+#include "FakeImageIO.h"
+#include "TestFile.h"
+#include "TestImage.h"
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+
+using namespace AMD;
+using Microsoft::WRL::ComPtr;
+
+namespace {
+///////////////////////////////////////////////////////////////////////////////
+/**
+A GPU fence the test signals by hand, with the service and scheduler the
+coroutines resume on. The scheduler is declared first, so the service, which
+hands continuations to it, is destroyed before it.
+*/
+struct SimulatedGpu
+{
+	std::atomic<std::uint64_t> completedValue { 0 };
+	FunctionFenceSource source { [this] () { return completedValue.load (); } };
+
+	TaskScheduler scheduler { CreateOptions () };
+	FenceService service { scheduler, std::chrono::microseconds (50) };
+	AwaitableFence fence { service, source };
+
+	static TaskSchedulerOptions CreateOptions ()
+	{
+		TaskSchedulerOptions options;
+		options.workerCount = 2;
+		return options;
+	}
+
+	/**
+	Count up to value in the background, like a GPU working through a queue.
+	*/
+	std::thread Run (const std::uint64_t value)
+	{
+		return std::thread ([this, value] () {
+			while (completedValue.load () < value) {
+				std::this_thread::sleep_for (std::chrono::microseconds (100));
+				++completedValue;
+			}
+		});
+	}
+};
+
+///////////////////////////////////////////////////////////////////////////////
+bool WaitFor (const std::function<bool ()>& condition)
+{
+	const auto timeout = std::chrono::steady_clock::now () + std::chrono::seconds (10);
+	while (!condition ()) {
+		if (std::chrono::steady_clock::now () > timeout) {
+			return false;
+		}
+		std::this_thread::yield ();
+	}
+
+	return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AsyncTask<std::uint64_t> WaitForFence (AwaitableFence fence, const std::uint64_t value,
+	std::thread::id* resumedOn = nullptr)
+{
+	co_await fence.Value (value);
+
+	if (resumedOn) {
+		*resumedOn = std::this_thread::get_id ();
+	}
+
+	co_return value;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AsyncTask<std::uint64_t> Chain (SimulatedGpu& gpu, const std::uint64_t value)
+{
+	const auto a = co_await WaitForFence (gpu.fence, value);
+	co_await Resume (gpu.scheduler);
+	const auto b = co_await WaitForFence (gpu.fence, value + 1);
+	co_return a + b;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AsyncTask<void> Detached (AwaitableFence fence, const std::uint64_t value,
+	std::atomic<int>& doneCount)
+{
+	co_await fence.Value (value);
+	++doneCount;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AsyncTask<void> FailAfter (AwaitableFence fence, const std::uint64_t value)
+{
+	co_await fence.Value (value);
+	throw std::runtime_error ("Failed after the fence");
+}
+
+///////////////////////////////////////////////////////////////////////////////
+AsyncTask<bool> CatchFailure (AwaitableFence fence, const std::uint64_t value)
+{
+	try {
+		co_await FailAfter (fence, value);
+	} catch (const std::runtime_error&) {
+		co_return true;
+	}
+
+	co_return false;
+}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TEST (SignaledFenceDoesNotSuspend)
+{
+	SimulatedGpu gpu;
+	gpu.completedValue = 10;
+
+	std::thread::id resumedOn;
+	auto task = WaitForFence (gpu.fence, 5, &resumedOn);
+
+	// Ran to completion inside the call
+	CHECK (task.IsDone ());
+	CHECK (resumedOn == std::this_thread::get_id ());
+	CHECK_EQUAL (0, gpu.service.GetPendingCount ());
+	CHECK_EQUAL (5, BlockingWait (task));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TEST (ResumesOnWorkerOnceSignaled)
+{
+	SimulatedGpu gpu;
+
+	std::thread::id resumedOn;
+	auto task = WaitForFence (gpu.fence, 3, &resumedOn);
+
+	CHECK (!task.IsDone ());
+	CHECK_EQUAL (1, gpu.service.GetPendingCount ());
+
+	gpu.completedValue = 2;
+	std::this_thread::sleep_for (std::chrono::milliseconds (5));
+	CHECK (!task.IsDone ());
+
+	gpu.completedValue = 3;
+	CHECK_EQUAL (3, BlockingWait (task));
+	CHECK (resumedOn != std::this_thread::get_id ());
+	CHECK_EQUAL (0, gpu.service.GetPendingCount ());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TEST (ChainedCoroutines)
+{
+	SimulatedGpu gpu;
+
+	std::vector<AsyncTask<std::uint64_t>> tasks;
+	for (std::uint64_t i = 0; i < 1000; ++i) {
+		tasks.push_back (Chain (gpu, 1 + i % 50));
+	}
+
+	auto signaler = gpu.Run (51);
+
+	std::uint64_t sum = 0, expected = 0;
+	for (std::uint64_t i = 0; i < tasks.size (); ++i) {
+		sum += BlockingWait (tasks [i]);
+		expected += 2 * (1 + i % 50) + 1;
+	}
+
+	signaler.join ();
+	CHECK_EQUAL (expected, sum);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Tasks dropped right away keep running and free their frames once done,
+which the leak checker of an address sanitizer build verifies.
+*/
+TEST (DetachedCoroutines)
+{
+	SimulatedGpu gpu;
+	std::atomic<int> doneCount (0);
+
+	for (std::uint64_t i = 0; i < 1000; ++i) {
+		Detached (gpu.fence, 1 + i % 50, doneCount);
+	}
+
+	// Some complete before the task is dropped
+	gpu.completedValue = 1;
+	for (int i = 0; i < 100; ++i) {
+		Detached (gpu.fence, 1, doneCount);
+	}
+
+	auto signaler = gpu.Run (50);
+	signaler.join ();
+
+	CHECK (WaitFor ([&] () { return doneCount.load () == 1100; }));
+	CHECK (WaitFor ([&] () { return gpu.service.GetPendingCount () == 0; }));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TEST (ExceptionsPropagate)
+{
+	SimulatedGpu gpu;
+
+	auto caught = CatchFailure (gpu.fence, 2);
+	auto uncaught = FailAfter (gpu.fence, 2);
+
+	// Thrown before suspending
+	gpu.completedValue = 5;
+	auto immediate = FailAfter (gpu.fence, 2);
+	CHECK (immediate.IsDone ());
+	CHECK_THROWS (BlockingWait (immediate));
+
+	CHECK (BlockingWait (caught));
+	CHECK_THROWS (BlockingWait (uncaught));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TEST (MovedFromTask)
+{
+	SimulatedGpu gpu;
+
+	auto task = WaitForFence (gpu.fence, 1);
+	CHECK (task.IsValid ());
+
+	auto moved = std::move (task);
+	CHECK (!task.IsValid ());
+	CHECK (!task.IsDone ());
+	CHECK (moved.IsValid ());
+
+	gpu.completedValue = 1;
+	CHECK_EQUAL (1, BlockingWait (moved));
+	CHECK (moved.IsDone ());
+
+	// Assigning over a task which is still running detaches it
+	moved = WaitForFence (gpu.fence, 2);
+	moved = WaitForFence (gpu.fence, 1);
+	CHECK (moved.IsDone ());
+	gpu.completedValue = 2;
+	CHECK (WaitFor ([&] () { return gpu.service.GetPendingCount () == 0; }));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TEST (AwaitsTextureLoads)
+{
+	SimulatedGpu gpu;
+
+	ComPtr<Test::FakeDevice> device;
+	device.Attach (new Test::FakeDevice);
+	AssetLoader loader (device.Get ());
+
+	const auto pixels = Test::CreateTestImage (16, 16, false);
+	Test::WriteFileBytes ("CoroutineTest.image", Test::EncodeFakeImage (pixels, 16, 16));
+
+	auto load = [] (AssetLoader& loader, TaskScheduler& scheduler) -> AsyncTask<int> {
+		const auto texture = co_await LoadTextureAsync (loader, "CoroutineTest.image",
+			TextureLoadOptions (), scheduler);
+
+		try {
+			co_await LoadTextureAsync (loader, "CoroutineTest.missing",
+				TextureLoadOptions (), scheduler);
+		} catch (const std::exception&) {
+			co_return texture.GetMipLevelCount ();
+		}
+
+		co_return 0;
+	} (loader, gpu.scheduler);
+
+	CHECK_EQUAL (5, BlockingWait (load));
+}
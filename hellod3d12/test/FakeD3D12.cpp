@@ -0,0 +1,511 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+
+#include "FakeD3D12.h"
+
+#include "CopyableFootprints.h"
+
+#include <cstring>
+#include <stdexcept>
+
+namespace AMD {
+namespace Test {
+///////////////////////////////////////////////////////////////////////////////
+FakeResource::FakeResource (const D3D12_RESOURCE_DESC& desc)
+	: desc_ (desc)
+{
+	if (desc.Dimension == D3D12_RESOURCE_DIMENSION_BUFFER) {
+		memory_.resize (static_cast<std::size_t> (desc.Width));
+		return;
+	}
+
+	const UINT subresourceCount = desc.MipLevels *
+		(desc.Dimension == D3D12_RESOURCE_DIMENSION_TEXTURE3D ? 1 : desc.DepthOrArraySize);
+
+	layouts_.resize (subresourceCount);
+	rowCounts_.resize (subresourceCount);
+	rowSizes_.resize (subresourceCount);
+
+	UINT64 totalBytes = 0;
+	AMD::GetCopyableFootprints (desc, 0, subresourceCount, 0,
+		layouts_.data (), rowCounts_.data (), rowSizes_.data (), &totalBytes);
+	memory_.resize (static_cast<std::size_t> (totalBytes));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+HRESULT FakeResource::Map (UINT, const D3D12_RANGE*, void** data)
+{
+	if (desc_.Dimension != D3D12_RESOURCE_DIMENSION_BUFFER) {
+		*data = nullptr;
+		return E_INVALIDARG;
+	}
+
+	*data = memory_.data ();
+	return S_OK;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+D3D12_RESOURCE_DESC FakeResource::GetDesc ()
+{
+	return desc_;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::vector<std::uint8_t> FakeResource::ReadSubresource (const UINT subresource) const
+{
+	const auto& layout = layouts_ [subresource];
+	const auto rowSize = static_cast<std::size_t> (rowSizes_ [subresource]);
+	const auto rowCount = rowCounts_ [subresource] * layout.Footprint.Depth;
+
+	std::vector<std::uint8_t> result (rowSize * rowCount);
+	for (UINT row = 0; row < rowCount; ++row) {
+		std::memcpy (result.data () + row * rowSize,
+			memory_.data () + layout.Offset + row * layout.Footprint.RowPitch, rowSize);
+	}
+
+	return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+UINT64 FakeFence::GetCompletedValue ()
+{
+	std::lock_guard<std::mutex> lock (mutex_);
+	return completedValue_;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+HRESULT FakeFence::SetEventOnCompletion (UINT64 value, HANDLE event)
+{
+	std::lock_guard<std::mutex> lock (mutex_);
+
+	if (completedValue_ >= value) {
+		SetEvent (event);
+	} else {
+		waits_.push_back (std::make_pair (value, event));
+	}
+
+	return S_OK;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+HRESULT FakeFence::Signal (UINT64 value)
+{
+	std::lock_guard<std::mutex> lock (mutex_);
+	completedValue_ = value;
+
+	for (auto it = waits_.begin (); it != waits_.end ();) {
+		if (it->first <= value) {
+			SetEvent (it->second);
+			it = waits_.erase (it);
+		} else {
+			++it;
+		}
+	}
+
+	return S_OK;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+HRESULT FakeCommandList::Close ()
+{
+	if (!isOpen_) {
+		return E_FAIL;
+	}
+
+	isOpen_ = false;
+	return S_OK;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+HRESULT FakeCommandList::Reset (ID3D12CommandAllocator*, ID3D12PipelineState*)
+{
+	if (isOpen_) {
+		return E_FAIL;
+	}
+
+	isOpen_ = true;
+	commands_.clear ();
+	barriers_.clear ();
+	calls_.clear ();
+	return S_OK;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void FakeCommandList::CopyBufferRegion (ID3D12Resource* destination,
+	UINT64 destinationOffset, ID3D12Resource* source, UINT64 sourceOffset,
+	UINT64 size)
+{
+	auto to = static_cast<FakeResource*> (destination);
+	auto from = static_cast<FakeResource*> (source);
+
+	commands_.push_back ([=] () {
+		if (destinationOffset + size > to->GetMemory ().size () ||
+			sourceOffset + size > from->GetMemory ().size ()) {
+			throw std::runtime_error ("Buffer copy out of bounds");
+		}
+
+		std::memcpy (to->GetMemory ().data () + destinationOffset,
+			from->GetMemory ().data () + sourceOffset, static_cast<std::size_t> (size));
+	});
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Only whole subresource copies from a placed footprint are supported, which
+is all the loaders record.
+*/
+void FakeCommandList::CopyTextureRegion (const D3D12_TEXTURE_COPY_LOCATION* destination,
+	UINT x, UINT y, UINT z, const D3D12_TEXTURE_COPY_LOCATION* source,
+	const D3D12_BOX* box)
+{
+	if (x != 0 || y != 0 || z != 0 || box != nullptr ||
+		destination->Type != D3D12_TEXTURE_COPY_TYPE_SUBRESOURCE_INDEX ||
+		source->Type != D3D12_TEXTURE_COPY_TYPE_PLACED_FOOTPRINT) {
+		throw std::runtime_error ("Unsupported texture copy");
+	}
+
+	auto to = static_cast<FakeResource*> (destination->pResource);
+	auto from = static_cast<FakeResource*> (source->pResource);
+	const auto subresource = destination->SubresourceIndex;
+	const auto sourceFootprint = source->PlacedFootprint;
+
+	commands_.push_back ([=] () {
+		const auto& destinationFootprint = to->GetFootprint (subresource);
+		if (sourceFootprint.Footprint.Width != destinationFootprint.Footprint.Width ||
+			sourceFootprint.Footprint.Height != destinationFootprint.Footprint.Height ||
+			sourceFootprint.Footprint.Depth != destinationFootprint.Footprint.Depth ||
+			sourceFootprint.Footprint.Format != destinationFootprint.Footprint.Format) {
+			throw std::runtime_error ("Footprint does not match the texture");
+		}
+
+		const auto rowSize = to->GetRowSize (subresource);
+		const auto rowCount = to->GetRowCount (subresource) * sourceFootprint.Footprint.Depth;
+
+		const auto end = sourceFootprint.Offset +
+			static_cast<UINT64> (sourceFootprint.Footprint.RowPitch) * (rowCount - 1) + rowSize;
+		if (end > from->GetMemory ().size ()) {
+			throw std::runtime_error ("Texture copy reads past the buffer");
+		}
+
+		for (UINT row = 0; row < rowCount; ++row) {
+			std::memcpy (to->GetMemory ().data () + destinationFootprint.Offset +
+					static_cast<std::size_t> (destinationFootprint.Footprint.RowPitch) * row,
+				from->GetMemory ().data () + sourceFootprint.Offset +
+					static_cast<std::size_t> (sourceFootprint.Footprint.RowPitch) * row,
+				static_cast<std::size_t> (rowSize));
+		}
+	});
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void FakeCommandList::ResourceBarrier (UINT count, const D3D12_RESOURCE_BARRIER* barriers)
+{
+	barriers_.insert (barriers_.end (), barriers, barriers + count);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void FakeCommandList::ExecuteBundle (ID3D12GraphicsCommandList* bundle)
+{
+	if (type_ == D3D12_COMMAND_LIST_TYPE_BUNDLE) {
+		throw std::runtime_error ("Bundles cannot execute bundles");
+	}
+
+	if (static_cast<FakeCommandList*> (bundle)->isOpen_) {
+		throw std::runtime_error ("Bundle must be closed before execution");
+	}
+
+	calls_.push_back ("ExecuteBundle");
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void FakeCommandList::SetPipelineState (ID3D12PipelineState*)
+{
+	calls_.push_back ("SetPipelineState");
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void FakeCommandList::SetGraphicsRootSignature (ID3D12RootSignature*)
+{
+	calls_.push_back ("SetGraphicsRootSignature");
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void FakeCommandList::IASetPrimitiveTopology (D3D12_PRIMITIVE_TOPOLOGY)
+{
+	calls_.push_back ("IASetPrimitiveTopology");
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void FakeCommandList::IASetVertexBuffers (UINT, UINT, const D3D12_VERTEX_BUFFER_VIEW*)
+{
+	calls_.push_back ("IASetVertexBuffers");
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void FakeCommandList::IASetIndexBuffer (const D3D12_INDEX_BUFFER_VIEW*)
+{
+	calls_.push_back ("IASetIndexBuffer");
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void FakeCommandList::DrawIndexedInstanced (UINT, UINT, UINT, INT, UINT)
+{
+	calls_.push_back ("DrawIndexedInstanced");
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void FakeCommandList::Execute ()
+{
+	if (isOpen_) {
+		throw std::runtime_error ("Command list must be closed before execution");
+	}
+
+	for (const auto& command : commands_) {
+		command ();
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+HRESULT FakeRenderPassCommandList::QueryInterface (REFIID id, void** object)
+{
+	if (nativeRenderPasses_ && id == StubUuidOf<ID3D12GraphicsCommandList4> ()) {
+		AddRef ();
+		*object = static_cast<ID3D12GraphicsCommandList4*> (this);
+		return S_OK;
+	}
+
+	return ID3D12GraphicsCommandList4::QueryInterface (id, object);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void FakeRenderPassCommandList::OMSetRenderTargets (UINT count,
+	const D3D12_CPU_DESCRIPTOR_HANDLE* views, BOOL singleHandle,
+	const D3D12_CPU_DESCRIPTOR_HANDLE* depthStencilView)
+{
+	if (singleHandle) {
+		throw std::runtime_error ("Single handle render targets are not supported");
+	}
+
+	auto& call = AddCall (CallType::SetRenderTargets);
+	for (UINT i = 0; i < count; ++i) {
+		call.renderTargetViews.push_back (views [i].ptr);
+	}
+
+	call.depthStencilView = depthStencilView ? depthStencilView->ptr : 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void FakeRenderPassCommandList::ClearDepthStencilView (D3D12_CPU_DESCRIPTOR_HANDLE view,
+	D3D12_CLEAR_FLAGS flags, FLOAT depth, UINT8 stencil, UINT rectCount, const D3D12_RECT*)
+{
+	if (rectCount != 0) {
+		throw std::runtime_error ("Clear rectangles are not supported");
+	}
+
+	auto& call = AddCall (CallType::ClearDepthStencil);
+	call.depthStencilView = view.ptr;
+	call.clearFlags = flags;
+	call.clearDepth = depth;
+	call.clearStencil = stencil;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void FakeRenderPassCommandList::ClearRenderTargetView (D3D12_CPU_DESCRIPTOR_HANDLE view,
+	const FLOAT* color, UINT rectCount, const D3D12_RECT*)
+{
+	if (rectCount != 0) {
+		throw std::runtime_error ("Clear rectangles are not supported");
+	}
+
+	auto& call = AddCall (CallType::ClearRenderTarget);
+	call.renderTargetViews.push_back (view.ptr);
+	std::memcpy (call.clearColor, color, sizeof (call.clearColor));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void FakeRenderPassCommandList::DiscardResource (ID3D12Resource* resource,
+	const void* region)
+{
+	if (resource == nullptr || region != nullptr) {
+		throw std::runtime_error ("Only whole resources can be discarded");
+	}
+
+	AddCall (CallType::Discard).resource = resource;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void FakeRenderPassCommandList::BeginRenderPass (UINT count,
+	const D3D12_RENDER_PASS_RENDER_TARGET_DESC* renderTargets,
+	const D3D12_RENDER_PASS_DEPTH_STENCIL_DESC* depthStencil,
+	D3D12_RENDER_PASS_FLAGS)
+{
+	auto& call = AddCall (CallType::BeginRenderPass);
+	call.renderTargets.assign (renderTargets, renderTargets + count);
+
+	if (depthStencil) {
+		call.hasDepthStencil = true;
+		call.depthStencil = *depthStencil;
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void FakeRenderPassCommandList::EndRenderPass ()
+{
+	AddCall (CallType::EndRenderPass);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+FakeRenderPassCommandList::Call& FakeRenderPassCommandList::AddCall (
+	const CallType type)
+{
+	calls_.push_back (Call ());
+	calls_.back ().type = type;
+	return calls_.back ();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void FakeCommandQueue::ExecuteCommandLists (UINT count, ID3D12CommandList* const* lists)
+{
+	for (UINT i = 0; i < count; ++i) {
+		static_cast<FakeCommandList*> (lists [i])->Execute ();
+	}
+
+	++executeCount_;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+HRESULT FakeCommandQueue::Signal (ID3D12Fence* fence, UINT64 value)
+{
+	return fence->Signal (value);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+HRESULT FakeDevice::CreateCommandQueue (const D3D12_COMMAND_QUEUE_DESC*,
+	REFIID, void** object)
+{
+	*object = static_cast<ID3D12CommandQueue*> (new FakeCommandQueue);
+	return S_OK;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+HRESULT FakeDevice::CreateCommandAllocator (D3D12_COMMAND_LIST_TYPE,
+	REFIID, void** object)
+{
+	*object = new ID3D12CommandAllocator;
+	return S_OK;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+HRESULT FakeDevice::CreateCommandList (UINT, D3D12_COMMAND_LIST_TYPE type,
+	ID3D12CommandAllocator*, ID3D12PipelineState*, REFIID, void** object)
+{
+	*object = static_cast<ID3D12GraphicsCommandList*> (new FakeCommandList (type));
+	return S_OK;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+HRESULT FakeDevice::CreateCommittedResource (const D3D12_HEAP_PROPERTIES*,
+	D3D12_HEAP_FLAGS, const D3D12_RESOURCE_DESC* desc, D3D12_RESOURCE_STATES,
+	const D3D12_CLEAR_VALUE*, REFIID, void** object)
+{
+	try {
+		*object = static_cast<ID3D12Resource*> (new FakeResource (*desc));
+	} catch (...) {
+		*object = nullptr;
+		return E_INVALIDARG;
+	}
+
+	if (desc->Dimension != D3D12_RESOURCE_DIMENSION_BUFFER) {
+		++textureCount_;
+	}
+
+	return S_OK;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+HRESULT FakeDevice::CreateFence (UINT64 initialValue, D3D12_FENCE_FLAGS,
+	REFIID, void** object)
+{
+	*object = static_cast<ID3D12Fence*> (new FakeFence (initialValue));
+	return S_OK;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+D3D12_RESOURCE_ALLOCATION_INFO FakeDevice::GetResourceAllocationInfo (UINT,
+	UINT count, const D3D12_RESOURCE_DESC* descs)
+{
+	if (count != 1) {
+		throw std::runtime_error ("Only one resource at a time is supported");
+	}
+
+	UINT64 size = descs->Width;
+	if (descs->Dimension != D3D12_RESOURCE_DIMENSION_BUFFER) {
+		const UINT subresourceCount = descs->MipLevels *
+			(descs->Dimension == D3D12_RESOURCE_DIMENSION_TEXTURE3D ? 1 : descs->DepthOrArraySize);
+		AMD::GetCopyableFootprints (*descs, 0, subresourceCount, 0,
+			nullptr, nullptr, nullptr, &size);
+	}
+
+	D3D12_RESOURCE_ALLOCATION_INFO info;
+	info.Alignment = D3D12_DEFAULT_RESOURCE_PLACEMENT_ALIGNMENT;
+	info.SizeInBytes = (size + info.Alignment - 1) / info.Alignment * info.Alignment;
+	return info;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+HRESULT FakeDevice::CreateHeap (const D3D12_HEAP_DESC* desc, REFIID, void** object)
+{
+	*object = static_cast<ID3D12Heap*> (new FakeHeap (*desc));
+	++heapCount_;
+	return S_OK;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+HRESULT FakeDevice::CreatePlacedResource (ID3D12Heap* heap, UINT64 offset,
+	const D3D12_RESOURCE_DESC* desc, D3D12_RESOURCE_STATES, const D3D12_CLEAR_VALUE*,
+	REFIID, void** object)
+{
+	*object = nullptr;
+
+	const auto info = GetResourceAllocationInfo (0, 1, desc);
+	if (offset % info.Alignment != 0 ||
+		offset + info.SizeInBytes > heap->GetDesc ().SizeInBytes) {
+		return E_INVALIDARG;
+	}
+
+	*object = static_cast<ID3D12Resource*> (new FakeResource (*desc));
+	++placedResourceCount_;
+	return S_OK;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void FakeDevice::GetCopyableFootprints (const D3D12_RESOURCE_DESC* desc,
+	UINT firstSubresource, UINT subresourceCount, UINT64 baseOffset,
+	D3D12_PLACED_SUBRESOURCE_FOOTPRINT* layouts, UINT* rowCounts,
+	UINT64* rowSizes, UINT64* totalBytes)
+{
+	AMD::GetCopyableFootprints (*desc, firstSubresource, subresourceCount,
+		baseOffset, layouts, rowCounts, rowSizes, totalBytes);
+}
+}
+}
@@ -0,0 +1,353 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+
+#ifndef ANTERU_D3D12_SAMPLE_TEST_FAKED3D12_H_
+#define ANTERU_D3D12_SAMPLE_TEST_FAKED3D12_H_
+
+#include <d3d12.h>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace AMD {
+namespace Test {
+///////////////////////////////////////////////////////////////////////////////
+/**
+A resource backed by system memory. Buffers hold Width bytes. Textures hold
+all subresources in the layout GetCopyableFootprints returns for them, so
+tests can read back what was copied into them.
+*/
+class FakeResource : public ID3D12Resource
+{
+public:
+	explicit FakeResource (const D3D12_RESOURCE_DESC& desc);
+
+	HRESULT Map (UINT, const D3D12_RANGE*, void** data) override;
+	D3D12_RESOURCE_DESC GetDesc () override;
+
+	std::vector<std::uint8_t>& GetMemory ()
+	{
+		return memory_;
+	}
+
+	const D3D12_PLACED_SUBRESOURCE_FOOTPRINT& GetFootprint (const UINT subresource) const
+	{
+		return layouts_ [subresource];
+	}
+
+	UINT GetRowCount (const UINT subresource) const
+	{
+		return rowCounts_ [subresource];
+	}
+
+	UINT64 GetRowSize (const UINT subresource) const
+	{
+		return rowSizes_ [subresource];
+	}
+
+	/**
+	Copy of the subresource without row padding.
+	*/
+	std::vector<std::uint8_t> ReadSubresource (const UINT subresource) const;
+
+private:
+	D3D12_RESOURCE_DESC desc_;
+	std::vector<std::uint8_t> memory_;
+	std::vector<D3D12_PLACED_SUBRESOURCE_FOOTPRINT> layouts_;
+	std::vector<UINT> rowCounts_;
+	std::vector<UINT64> rowSizes_;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Completes as soon as it gets signaled, and sets waiting events right away.
+*/
+class FakeFence : public ID3D12Fence
+{
+public:
+	explicit FakeFence (const UINT64 initialValue)
+		: completedValue_ (initialValue)
+	{
+	}
+
+	UINT64 GetCompletedValue () override;
+	HRESULT SetEventOnCompletion (UINT64 value, HANDLE event) override;
+	HRESULT Signal (UINT64 value) override;
+
+private:
+	std::mutex mutex_;
+	UINT64 completedValue_;
+	std::vector<std::pair<UINT64, HANDLE>> waits_;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+class FakeHeap : public ID3D12Heap
+{
+public:
+	explicit FakeHeap (const D3D12_HEAP_DESC& desc)
+		: desc_ (desc)
+	{
+	}
+
+	D3D12_HEAP_DESC GetDesc () override
+	{
+		return desc_;
+	}
+
+private:
+	D3D12_HEAP_DESC desc_;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Records copies and barriers. The copies are carried out when the list gets
+executed on a FakeCommandQueue.
+
+Draw state, draw and bundle calls are logged by name, so tests can check how
+many API calls a frame makes and what went into a bundle. Reset clears all of
+it.
+*/
+class FakeCommandList : public ID3D12GraphicsCommandList
+{
+public:
+	explicit FakeCommandList (const D3D12_COMMAND_LIST_TYPE type)
+		: type_ (type)
+	{
+	}
+
+	D3D12_COMMAND_LIST_TYPE GetType () override
+	{
+		return type_;
+	}
+
+	HRESULT Close () override;
+	HRESULT Reset (ID3D12CommandAllocator*, ID3D12PipelineState*) override;
+
+	void CopyBufferRegion (ID3D12Resource* destination, UINT64 destinationOffset,
+		ID3D12Resource* source, UINT64 sourceOffset, UINT64 size) override;
+	void CopyTextureRegion (const D3D12_TEXTURE_COPY_LOCATION* destination,
+		UINT x, UINT y, UINT z, const D3D12_TEXTURE_COPY_LOCATION* source,
+		const D3D12_BOX* box) override;
+	void ResourceBarrier (UINT count, const D3D12_RESOURCE_BARRIER* barriers) override;
+
+	/**
+	Throws if bundle is still open, or if this list is a bundle itself.
+	*/
+	void ExecuteBundle (ID3D12GraphicsCommandList* bundle) override;
+	void SetPipelineState (ID3D12PipelineState*) override;
+	void SetGraphicsRootSignature (ID3D12RootSignature*) override;
+	void IASetPrimitiveTopology (D3D12_PRIMITIVE_TOPOLOGY) override;
+	void IASetVertexBuffers (UINT, UINT, const D3D12_VERTEX_BUFFER_VIEW*) override;
+	void IASetIndexBuffer (const D3D12_INDEX_BUFFER_VIEW*) override;
+	void DrawIndexedInstanced (UINT, UINT, UINT, INT, UINT) override;
+
+	/**
+	Run the recorded copies. Throws if the list is still open.
+	*/
+	void Execute ();
+
+	int GetCopyCount () const
+	{
+		return static_cast<int> (commands_.size ());
+	}
+
+	const std::vector<D3D12_RESOURCE_BARRIER>& GetBarriers () const
+	{
+		return barriers_;
+	}
+
+	const std::vector<std::string>& GetCalls () const
+	{
+		return calls_;
+	}
+
+private:
+	D3D12_COMMAND_LIST_TYPE type_;
+	bool isOpen_ = true;
+	std::vector<std::function<void ()>> commands_;
+	std::vector<D3D12_RESOURCE_BARRIER> barriers_;
+	std::vector<std::string> calls_;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Records render target bindings, clears, discards and render passes, so tests
+can check how load and store operations get translated. QueryInterface only
+returns ID3D12GraphicsCommandList4 if the list supports native render
+passes, otherwise it stands in for a list of an older runtime.
+*/
+class FakeRenderPassCommandList : public ID3D12GraphicsCommandList4
+{
+public:
+	enum class CallType
+	{
+		SetRenderTargets,
+		ClearRenderTarget,
+		ClearDepthStencil,
+		Discard,
+		BeginRenderPass,
+		EndRenderPass
+	};
+
+	/**
+	Only the members of the call's type are set.
+	*/
+	struct Call
+	{
+		CallType type;
+
+		// SetRenderTargets, and the view to clear. 0 if there is no depth
+		// stencil view
+		std::vector<SIZE_T> renderTargetViews;
+		SIZE_T depthStencilView = 0;
+
+		ID3D12Resource* resource = nullptr;
+
+		float clearColor [4] = {};
+		D3D12_CLEAR_FLAGS clearFlags = static_cast<D3D12_CLEAR_FLAGS> (0);
+		float clearDepth = 0;
+		UINT8 clearStencil = 0;
+
+		std::vector<D3D12_RENDER_PASS_RENDER_TARGET_DESC> renderTargets;
+		bool hasDepthStencil = false;
+		D3D12_RENDER_PASS_DEPTH_STENCIL_DESC depthStencil = {};
+	};
+
+	explicit FakeRenderPassCommandList (const bool nativeRenderPasses)
+		: nativeRenderPasses_ (nativeRenderPasses)
+	{
+	}
+
+	HRESULT QueryInterface (REFIID id, void** object) override;
+
+	void OMSetRenderTargets (UINT count, const D3D12_CPU_DESCRIPTOR_HANDLE* views,
+		BOOL singleHandle, const D3D12_CPU_DESCRIPTOR_HANDLE* depthStencilView) override;
+	void ClearDepthStencilView (D3D12_CPU_DESCRIPTOR_HANDLE view, D3D12_CLEAR_FLAGS flags,
+		FLOAT depth, UINT8 stencil, UINT rectCount, const D3D12_RECT*) override;
+	void ClearRenderTargetView (D3D12_CPU_DESCRIPTOR_HANDLE view, const FLOAT* color,
+		UINT rectCount, const D3D12_RECT*) override;
+	void DiscardResource (ID3D12Resource* resource, const void* region) override;
+
+	void BeginRenderPass (UINT count, const D3D12_RENDER_PASS_RENDER_TARGET_DESC* renderTargets,
+		const D3D12_RENDER_PASS_DEPTH_STENCIL_DESC* depthStencil,
+		D3D12_RENDER_PASS_FLAGS flags) override;
+	void EndRenderPass () override;
+
+	const std::vector<Call>& GetCalls () const
+	{
+		return calls_;
+	}
+
+	void ClearCalls ()
+	{
+		calls_.clear ();
+	}
+
+private:
+	Call& AddCall (const CallType type);
+
+	bool nativeRenderPasses_;
+	std::vector<Call> calls_;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Executes command lists on the calling thread, so work is done by the time
+ExecuteCommandLists returns, and signals fences right away.
+*/
+class FakeCommandQueue : public ID3D12CommandQueue
+{
+public:
+	void ExecuteCommandLists (UINT count, ID3D12CommandList* const* lists) override;
+	HRESULT Signal (ID3D12Fence* fence, UINT64 value) override;
+
+	int GetExecuteCount () const
+	{
+		return executeCount_;
+	}
+
+private:
+	std::atomic<int> executeCount_ { 0 };
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Creates the fakes above. Counters can be read from any thread.
+
+Resources need 64 KiB aligned memory for their copyable footprint. Placed
+resources get memory of their own, so aliasing them doesn't share contents,
+but they must fit into their heap.
+*/
+class FakeDevice : public ID3D12Device
+{
+public:
+	HRESULT CreateCommandQueue (const D3D12_COMMAND_QUEUE_DESC* desc,
+		REFIID, void** object) override;
+	HRESULT CreateCommandAllocator (D3D12_COMMAND_LIST_TYPE,
+		REFIID, void** object) override;
+	HRESULT CreateCommandList (UINT, D3D12_COMMAND_LIST_TYPE type,
+		ID3D12CommandAllocator*, ID3D12PipelineState*, REFIID, void** object) override;
+	HRESULT CreateCommittedResource (const D3D12_HEAP_PROPERTIES*, D3D12_HEAP_FLAGS,
+		const D3D12_RESOURCE_DESC* desc, D3D12_RESOURCE_STATES, const D3D12_CLEAR_VALUE*,
+		REFIID, void** object) override;
+	HRESULT CreateFence (UINT64 initialValue, D3D12_FENCE_FLAGS,
+		REFIID, void** object) override;
+	D3D12_RESOURCE_ALLOCATION_INFO GetResourceAllocationInfo (UINT, UINT count,
+		const D3D12_RESOURCE_DESC* descs) override;
+	HRESULT CreateHeap (const D3D12_HEAP_DESC* desc, REFIID, void** object) override;
+	HRESULT CreatePlacedResource (ID3D12Heap* heap, UINT64 offset,
+		const D3D12_RESOURCE_DESC* desc, D3D12_RESOURCE_STATES, const D3D12_CLEAR_VALUE*,
+		REFIID, void** object) override;
+	void GetCopyableFootprints (const D3D12_RESOURCE_DESC* desc,
+		UINT firstSubresource, UINT subresourceCount, UINT64 baseOffset,
+		D3D12_PLACED_SUBRESOURCE_FOOTPRINT* layouts, UINT* rowCounts,
+		UINT64* rowSizes, UINT64* totalBytes) override;
+
+	int GetTextureCount () const
+	{
+		return textureCount_;
+	}
+
+	int GetHeapCount () const
+	{
+		return heapCount_;
+	}
+
+	int GetPlacedResourceCount () const
+	{
+		return placedResourceCount_;
+	}
+
+private:
+	std::atomic<int> textureCount_ { 0 };
+	std::atomic<int> heapCount_ { 0 };
+	std::atomic<int> placedResourceCount_ { 0 };
+};
+}
+}
+
+#endif
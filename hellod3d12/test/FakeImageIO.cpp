@@ -0,0 +1,125 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+
+#include "FakeImageIO.h"
+
+#include "ImageIO.h"
+#include "ImageResampler.h"
+
+#include <cstring>
+#include <stdexcept>
+
+namespace AMD {
+namespace Test {
+namespace {
+const std::size_t HEADER_SIZE = 12;
+}
+
+std::atomic<int> fakeImageDecodeCount (0);
+std::atomic<int> fakeImageDecodeIntoCount (0);
+
+///////////////////////////////////////////////////////////////////////////////
+std::vector<std::uint8_t> EncodeFakeImage (const std::vector<std::uint8_t>& pixels,
+	const int width, const int height)
+{
+	std::vector<std::uint8_t> result (HEADER_SIZE + pixels.size ());
+	std::memcpy (result.data (), "RGBA", 4);
+	std::memcpy (result.data () + 4, &width, 4);
+	std::memcpy (result.data () + 8, &height, 4);
+	if (!pixels.empty ()) {
+		std::memcpy (result.data () + HEADER_SIZE, pixels.data (), pixels.size ());
+	}
+	return result;
+}
+}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+ImageInfo GetImageInfoFromMemory (const void* data, const std::size_t size)
+{
+	if (size < AMD::Test::HEADER_SIZE || std::memcmp (data, "RGBA", 4) != 0) {
+		throw std::runtime_error ("Not a fake image");
+	}
+
+	ImageInfo info;
+	std::memcpy (&info.width, static_cast<const std::uint8_t*> (data) + 4, 4);
+	std::memcpy (&info.height, static_cast<const std::uint8_t*> (data) + 8, 4);
+	info.bytesPerPixel = 4;
+	info.hasAlpha = false;
+
+	if (info.width <= 0 || info.height <= 0 ||
+		size - AMD::Test::HEADER_SIZE != static_cast<std::size_t> (info.width) * info.height * 4) {
+		throw std::runtime_error ("Fake image is truncated");
+	}
+
+	const auto pixels = static_cast<const std::uint8_t*> (data) + AMD::Test::HEADER_SIZE;
+	for (std::size_t i = 3; i < size - AMD::Test::HEADER_SIZE; i += 4) {
+		info.hasAlpha = info.hasAlpha || pixels [i] != 255;
+	}
+
+	return info;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::vector<std::uint8_t> LoadImageFromMemoryFitted (const void* data, const std::size_t size,
+	const int maximumDimension, int* width, int* height)
+{
+	const auto info = GetImageInfoFromMemory (data, size);
+	const auto pixels = static_cast<const std::uint8_t*> (data) + AMD::Test::HEADER_SIZE;
+
+	AMD::GetFittedImageSize (info.width, info.height, maximumDimension, width, height);
+	++AMD::Test::fakeImageDecodeCount;
+
+	std::vector<std::uint8_t> result (static_cast<std::size_t> (*width) * *height * 4);
+
+	if (*width == info.width && *height == info.height) {
+		std::memcpy (result.data (), pixels, result.size ());
+	} else {
+		AMD::ResampleImage (pixels, info.width, info.height, info.width * 4,
+			result.data (), *width, *height, *width * 4,
+			AMD::ResampleFilter::Mitchell, AMD::AlphaMode::Straight);
+	}
+
+	return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void LoadImageFromMemoryInto (const void* data, const std::size_t size,
+	void* destination, const std::size_t rowPitch, const std::size_t destinationSize)
+{
+	const auto info = GetImageInfoFromMemory (data, size);
+	const auto pixels = static_cast<const std::uint8_t*> (data) + AMD::Test::HEADER_SIZE;
+	const auto rowSize = static_cast<std::size_t> (info.width) * 4;
+
+	if (rowPitch < rowSize || destinationSize < rowPitch * (info.height - 1) + rowSize) {
+		throw std::runtime_error ("Destination too small for image");
+	}
+
+	++AMD::Test::fakeImageDecodeCount;
+	++AMD::Test::fakeImageDecodeIntoCount;
+
+	for (int row = 0; row < info.height; ++row) {
+		std::memcpy (static_cast<std::uint8_t*> (destination) + row * rowPitch,
+			pixels + row * rowSize, rowSize);
+	}
+}
@@ -0,0 +1,56 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+
+#ifndef ANTERU_D3D12_SAMPLE_TEST_FAKEIMAGEIO_H_
+#define ANTERU_D3D12_SAMPLE_TEST_FAKEIMAGEIO_H_
+
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+namespace AMD {
+namespace Test {
+///////////////////////////////////////////////////////////////////////////////
+/**
+ImageIO decodes through WIC, which does not exist on Linux. FakeImageIO.cpp
+implements the memory functions of ImageIO.h for a trivial format instead:
+the magic "RGBA", width and height as 32-bit integers and the pixels, tightly
+packed. Images count as having alpha if any pixel is not opaque. Link it
+into tests which run the asset loader.
+*/
+std::vector<std::uint8_t> EncodeFakeImage (const std::vector<std::uint8_t>& pixels,
+	const int width, const int height);
+
+/**
+Number of images decoded so far, to tell cache hits from misses.
+*/
+extern std::atomic<int> fakeImageDecodeCount;
+
+/**
+Number of those which were decoded into caller memory.
+*/
+extern std::atomic<int> fakeImageDecodeIntoCount;
+}
+}
+
+#endif
@@ -0,0 +1,202 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#include "Test.h"
+
+#include "FenceService.h"
+#include "TaskScheduler.h"
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace AMD;
+
+namespace {
+///////////////////////////////////////////////////////////////////////////////
+TaskSchedulerOptions CreateOptions ()
+{
+	TaskSchedulerOptions options;
+	options.workerCount = 2;
+	return options;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+A fence signaled by the test.
+*/
+struct SimulatedFence
+{
+	std::atomic<std::uint64_t> completedValue { 0 };
+	FunctionFenceSource source { [this] () { return completedValue.load (); } };
+};
+
+///////////////////////////////////////////////////////////////////////////////
+bool WaitFor (const std::function<bool ()>& condition)
+{
+	const auto timeout = std::chrono::steady_clock::now () + std::chrono::seconds (10);
+	while (!condition ()) {
+		if (std::chrono::steady_clock::now () > timeout) {
+			return false;
+		}
+		std::this_thread::yield ();
+	}
+
+	return true;
+}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TEST (ReachedValueRunsRightAway)
+{
+	TaskScheduler scheduler (CreateOptions ());
+	FenceService service (scheduler);
+	SimulatedFence fence;
+	fence.completedValue = 4;
+
+	std::atomic<int> runCount (0);
+	service.WhenReached (fence.source, 4, [&] () { ++runCount; });
+	service.WhenReached (fence.source, 0, [&] () { ++runCount; });
+
+	CHECK_EQUAL (0, service.GetPendingCount ());
+	CHECK (WaitFor ([&] () { return runCount.load () == 2; }));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TEST (RunsOnlyReachedWaits)
+{
+	TaskScheduler scheduler (CreateOptions ());
+	FenceService service (scheduler, std::chrono::microseconds (50));
+	SimulatedFence fences [2];
+
+	std::atomic<int> ran [2][5] = {};
+	for (int f = 0; f < 2; ++f) {
+		// Out of order, the service sorts them
+		for (const int value : { 3, 1, 5, 2, 4 }) {
+			service.WhenReached (fences [f].source, value, [&ran, f, value] () {
+				++ran [f][value - 1];
+			});
+		}
+	}
+	CHECK_EQUAL (10, service.GetPendingCount ());
+
+	fences [0].completedValue = 3;
+	CHECK (WaitFor ([&] () { return service.GetPendingCount () == 7; }));
+	CHECK (WaitFor ([&] () { return ran [0][2].load () == 1; }));
+
+	// Give it a few more polls to run anything it shouldn't
+	std::this_thread::sleep_for (std::chrono::milliseconds (5));
+	for (int value = 1; value <= 5; ++value) {
+		CHECK_EQUAL (value <= 3 ? 1 : 0, ran [0][value - 1].load ());
+		CHECK_EQUAL (0, ran [1][value - 1].load ());
+	}
+
+	fences [0].completedValue = 10;
+	fences [1].completedValue = 10;
+	CHECK (WaitFor ([&] () { return service.GetPendingCount () == 0; }));
+	CHECK (WaitFor ([&] () {
+		int total = 0;
+		for (const auto& fence : ran) {
+			for (const auto& count : fence) {
+				total += count.load ();
+			}
+		}
+		return total == 10;
+	}));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Waits are added from several threads while simulated GPUs signal the fences.
+Every continuation must run exactly once.
+*/
+TEST (StressManyWaits)
+{
+	TaskScheduler scheduler (CreateOptions ());
+	FenceService service (scheduler, std::chrono::microseconds (50));
+
+	const int fenceCount = 4, waitCount = 2000, finalValue = 100;
+	SimulatedFence fences [fenceCount];
+	std::vector<std::atomic<int>> runCounts (fenceCount * waitCount);
+
+	std::vector<std::thread> threads;
+	for (int f = 0; f < fenceCount; ++f) {
+		threads.emplace_back ([&, f] () {
+			for (int i = 0; i < waitCount; ++i) {
+				const auto index = f * waitCount + i;
+				service.WhenReached (fences [f].source, 1 + i % finalValue, [&runCounts, index] () {
+					++runCounts [index];
+				});
+			}
+		});
+
+		threads.emplace_back ([&, f] () {
+			for (int value = 1; value <= finalValue; ++value) {
+				std::this_thread::sleep_for (std::chrono::microseconds (20));
+				fences [f].completedValue = value;
+			}
+		});
+	}
+
+	for (auto& thread : threads) {
+		thread.join ();
+	}
+
+	CHECK (WaitFor ([&] () { return service.GetPendingCount () == 0; }));
+	CHECK (WaitFor ([&] () {
+		for (const auto& count : runCounts) {
+			if (count.load () == 0) {
+				return false;
+			}
+		}
+		return true;
+	}));
+
+	int wrong = 0;
+	for (const auto& count : runCounts) {
+		wrong += count.load () != 1;
+	}
+	CHECK_EQUAL (0, wrong);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TEST (DropsPendingWaitsOnDestruction)
+{
+	TaskScheduler scheduler (CreateOptions ());
+	SimulatedFence fence;
+	auto ran = std::make_shared<std::atomic<int>> (0);
+
+	{
+		FenceService service (scheduler);
+		service.WhenReached (fence.source, 1, [ran] () { ++*ran; });
+		CHECK_EQUAL (1, service.GetPendingCount ());
+	}
+
+	fence.completedValue = 1;
+	std::this_thread::sleep_for (std::chrono::milliseconds (5));
+	CHECK_EQUAL (0, ran->load ());
+	// The dropped continuation has been destroyed
+	CHECK_EQUAL (1, ran.use_count ());
+}
@@ -0,0 +1,93 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+
+#include "Benchmark.h"
+
+#include "TestFile.h"
+#include "TestImage.h"
+#include "Utility.h"
+
+#include <cstdio>
+#include <string>
+
+using namespace AMD;
+
+namespace {
+///////////////////////////////////////////////////////////////////////////////
+/**
+Touch one byte per page, so a mapping has to fault everything in.
+*/
+int TouchPages (const void* data, const std::size_t size)
+{
+	auto bytes = static_cast<const std::uint8_t*> (data);
+	int sum = 0;
+	for (std::size_t i = 0; i < size; i += 4096) {
+		sum += bytes [i];
+	}
+
+	return sum;
+}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Open a file and touch all of its pages, by reading it into memory and by
+mapping it, for sizes around FileView::MAPPING_THRESHOLD. The files are in
+the page cache, so this measures the setup and fault cost rather than the
+disk. Run from the build directory.
+
+On a Linux test machine reading wins up to 64 KiB and mapping from 256 KiB
+on, which is where the threshold comes from.
+*/
+int main ()
+{
+	const std::size_t sizes [] = { 4 << 10, 16 << 10, 64 << 10, 256 << 10,
+		1 << 20, 16 << 20 };
+
+	volatile int sink = 0;
+
+	for (const auto size : sizes) {
+		Test::WriteFileBytes ("FileViewBenchmark.bin", Test::CreateRandomBytes (size));
+
+		const auto label = std::to_string (size >> 10) + " KiB";
+
+		Test::Report ((label + ", read").c_str (), Test::Measure ([&] () {
+			const auto contents = ReadFile ("FileViewBenchmark.bin");
+			sink = sink + TouchPages (contents.data (), contents.size ());
+		}, 50), size);
+
+		Test::Report ((label + ", mapped").c_str (), Test::Measure ([&] () {
+			MappedFile file ("FileViewBenchmark.bin");
+			sink = sink + TouchPages (file.GetData (), file.GetSize ());
+		}, 50), size);
+
+		Test::Report ((label + ", FileView").c_str (), Test::Measure ([&] () {
+			FileView file ("FileViewBenchmark.bin");
+			sink = sink + TouchPages (file.GetData (), file.GetSize ());
+		}, 50), size);
+	}
+
+	std::remove ("FileViewBenchmark.bin");
+
+	return 0;
+}
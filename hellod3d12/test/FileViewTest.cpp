@@ -0,0 +1,169 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+
+#include "Test.h"
+
+#include "TestFile.h"
+#include "TestImage.h"
+#include "Utility.h"
+
+#include <cstring>
+#include <limits>
+#include <vector>
+
+using namespace AMD;
+
+namespace {
+///////////////////////////////////////////////////////////////////////////////
+bool HasContents (const FileView& view, const std::vector<std::uint8_t>& expected)
+{
+	return view.GetSize () == expected.size () &&
+		(expected.empty () ||
+			std::memcmp (view.GetData (), expected.data (), expected.size ()) == 0);
+}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TEST (ByteRangeBounds)
+{
+	const std::uint8_t bytes [16] = {};
+	const ByteRange range = { bytes, 16 };
+
+	CHECK (range.GetRange (0, 16).data == bytes);
+	CHECK (range.GetRange (4, 8).data == bytes + 4);
+	CHECK_EQUAL (8, range.GetRange (4, 8).size);
+
+	// Empty ranges at the end are fine
+	CHECK_EQUAL (0, range.GetRange (16, 0).size);
+
+	CHECK_THROWS (range.GetRange (0, 17));
+	CHECK_THROWS (range.GetRange (17, 0));
+	CHECK_THROWS (range.GetRange (15, 2));
+
+	// offset + size wraps around
+	const auto maximum = (std::numeric_limits<std::size_t>::max) ();
+	CHECK_THROWS (range.GetRange (8, maximum));
+	CHECK_THROWS (range.GetRange (maximum, 1));
+
+	// Nested ranges are relative to their parent
+	const auto inner = range.GetRange (4, 8);
+	CHECK (inner.GetRange (2, 6).data == bytes + 6);
+	CHECK_THROWS (inner.GetRange (2, 7));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TEST (SmallFilesAreRead)
+{
+	const std::size_t sizes [] = { 1, 4096, FileView::MAPPING_THRESHOLD - 1 };
+
+	for (const auto size : sizes) {
+		const auto contents = Test::CreateRandomBytes (size, static_cast<unsigned int> (size));
+		Test::WriteFileBytes ("FileViewTest.bin", contents);
+
+		FileView view ("FileViewTest.bin");
+		CHECK (!view.IsMapped ());
+		CHECK (HasContents (view, contents));
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TEST (LargeFilesAreMapped)
+{
+	const std::size_t sizes [] = { FileView::MAPPING_THRESHOLD,
+		FileView::MAPPING_THRESHOLD + 1, 1 << 20 };
+
+	for (const auto size : sizes) {
+		const auto contents = Test::CreateRandomBytes (size, static_cast<unsigned int> (size));
+		Test::WriteFileBytes ("FileViewTest.bin", contents);
+
+		FileView view ("FileViewTest.bin");
+		CHECK (view.IsMapped ());
+		CHECK (HasContents (view, contents));
+
+		// Just a hint, but it must accept the whole file and reject the rest
+		view.Prefetch (0, size);
+		CHECK_THROWS (view.Prefetch (1, size));
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TEST (EmptyFile)
+{
+	Test::WriteFileBytes ("FileViewTest.bin", std::vector<std::uint8_t> ());
+
+	FileView view ("FileViewTest.bin");
+	CHECK (!view.IsMapped ());
+	CHECK_EQUAL (0, view.GetSize ());
+	CHECK_EQUAL (0, view.GetRange (0, 0).size);
+	CHECK_THROWS (view.GetRange (0, 1));
+
+	// Empty files cannot be mapped, MappedFile handles them anyway
+	MappedFile mapped ("FileViewTest.bin");
+	CHECK_EQUAL (0, mapped.GetSize ());
+	CHECK_EQUAL (0, mapped.GetRange (0, 0).size);
+	mapped.Prefetch (0, 0);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TEST (GetRangeBounds)
+{
+	// Both sides of the threshold must behave the same
+	const std::size_t sizes [] = { 1000, FileView::MAPPING_THRESHOLD + 1000 };
+
+	for (const auto size : sizes) {
+		const auto contents = Test::CreateRandomBytes (size, 3);
+		Test::WriteFileBytes ("FileViewTest.bin", contents);
+
+		FileView view ("FileViewTest.bin");
+
+		const auto tail = view.GetRange (size - 10, 10);
+		CHECK (std::memcmp (tail.data, contents.data () + size - 10, 10) == 0);
+		CHECK_EQUAL (0, view.GetRange (size, 0).size);
+
+		CHECK_THROWS (view.GetRange (size - 10, 11));
+		CHECK_THROWS (view.GetRange (size + 1, 0));
+		CHECK_THROWS (view.GetRange (1, (std::numeric_limits<std::size_t>::max) ()));
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TEST (MappedFileMatchesReadFile)
+{
+	const auto contents = Test::CreateRandomBytes (100000, 4);
+	Test::WriteFileBytes ("FileViewTest.bin", contents);
+
+	MappedFile mapped ("FileViewTest.bin");
+	CHECK_EQUAL (contents.size (), mapped.GetSize ());
+	CHECK (std::memcmp (mapped.GetData (), contents.data (), contents.size ()) == 0);
+	CHECK (ReadFile ("FileViewTest.bin") == contents);
+
+	CHECK_THROWS (mapped.GetRange (50000, 50001));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TEST (MissingFileThrows)
+{
+	CHECK_THROWS (FileView ("FileViewTest.missing"));
+	CHECK_THROWS (MappedFile ("FileViewTest.missing"));
+	CHECK_THROWS (ReadFile ("FileViewTest.missing"));
+}
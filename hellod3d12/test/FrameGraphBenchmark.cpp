@@ -0,0 +1,144 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+
+
+#include "Benchmark.h"
+
+#include "FrameGraph.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace AMD;
+
+namespace {
+///////////////////////////////////////////////////////////////////////////////
+/**
+A post-processing style chain: every pass reads a few of the recent outputs
+and writes a new render target or UAV texture, and the last one writes the
+back buffer.
+*/
+void CreateFrame (const int passCount, std::vector<FrameGraphPassDesc>& passes,
+	std::vector<FrameGraphResourceDesc>& resources)
+{
+	std::mt19937 random (passCount);
+
+	FrameGraphResourceDesc backBuffer;
+	backBuffer.imported = true;
+	backBuffer.initialState = D3D12_RESOURCE_STATE_COMMON;
+	backBuffer.hasFinalState = true;
+	backBuffer.finalState = D3D12_RESOURCE_STATE_COMMON;
+	resources.push_back (backBuffer);
+
+	for (int i = 0; i < passCount; ++i) {
+		const bool renderTarget = random () % 2 == 0;
+
+		FrameGraphResourceDesc output;
+		output.heapType = renderTarget ? TransientHeapType::RenderTargetTexture
+			: TransientHeapType::Texture;
+		output.size = (64 << 10) * (1 + random () % 128);
+		output.alignment = 64 << 10;
+		output.initialState = renderTarget ? D3D12_RESOURCE_STATE_RENDER_TARGET
+			: D3D12_RESOURCE_STATE_COMMON;
+		resources.push_back (output);
+
+		FrameGraphPassDesc pass;
+		for (int k = random () % 4; k > 0 && i > 0; --k) {
+			const int input = i - random () % (std::min) (i, 8);
+			bool used = false;
+			for (const auto& read : pass.reads) {
+				used = used || read.resource == input;
+			}
+			if (!used) {
+				pass.reads.push_back ({ input, D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE });
+			}
+		}
+
+		const bool last = i == passCount - 1;
+		pass.writes.push_back ({ last ? 0 : i + 1, renderTarget || last
+			? D3D12_RESOURCE_STATE_RENDER_TARGET : D3D12_RESOURCE_STATE_UNORDERED_ACCESS });
+		passes.push_back (pass);
+	}
+}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Compile frame graphs of 16, 64 and 256 passes, and report how much transient
+memory aliasing saves and how close the packing gets to the memory in use at
+the busiest pass, which no packing can beat. Run from the build directory.
+*/
+int main ()
+{
+	const int passCounts [] = { 16, 64, 256 };
+
+	for (const auto passCount : passCounts) {
+		std::vector<FrameGraphPassDesc> passes;
+		std::vector<FrameGraphResourceDesc> resources;
+		CreateFrame (passCount, passes, resources);
+
+		CompiledFrameGraph compiled;
+		const auto label = std::to_string (passCount) + " passes";
+
+		Test::Report ((label + ", compile").c_str (), Test::Measure ([&] () {
+			compiled = CompileFrameGraph (passes, resources);
+		}, 20));
+
+		std::uint64_t aliased = 0;
+		std::uint64_t unaliased = 0;
+		std::uint64_t lowerBound = 0;
+
+		for (int type = 0; type < 3; ++type) {
+			aliased += compiled.heapSizes [type];
+
+			std::vector<std::uint64_t> live (compiled.passes.size (), 0);
+			for (std::size_t i = 0; i < resources.size (); ++i) {
+				const auto& placement = compiled.placements [i];
+				if (resources [i].imported || placement.firstPass == -1 ||
+					static_cast<int> (resources [i].heapType) != type) {
+					continue;
+				}
+
+				unaliased += resources [i].size;
+				for (int pass = placement.firstPass; pass <= placement.lastPass; ++pass) {
+					live [pass] += resources [i].size;
+				}
+			}
+
+			std::uint64_t busiest = 0;
+			for (const auto size : live) {
+				busiest = (std::max) (busiest, size);
+			}
+			lowerBound += busiest;
+		}
+
+		std::printf ("%-48s %10.1f MiB, %.1f MiB unaliased, %.3fx the lower bound\n",
+			(label + ", transient memory").c_str (), aliased / 1048576.0, unaliased / 1048576.0,
+			static_cast<double> (aliased) / lowerBound);
+	}
+
+	return 0;
+}
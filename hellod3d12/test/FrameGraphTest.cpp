@@ -0,0 +1,889 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+
+
+#include "Test.h"
+
+#include "FakeD3D12.h"
+#include "FrameGraph.h"
+
+#include <algorithm>
+#include <map>
+#include <random>
+#include <vector>
+
+using namespace AMD;
+using Microsoft::WRL::ComPtr;
+
+namespace {
+const D3D12_RESOURCE_STATES COMMON = D3D12_RESOURCE_STATE_COMMON;
+const D3D12_RESOURCE_STATES RENDER_TARGET = D3D12_RESOURCE_STATE_RENDER_TARGET;
+const D3D12_RESOURCE_STATES UNORDERED_ACCESS = D3D12_RESOURCE_STATE_UNORDERED_ACCESS;
+const D3D12_RESOURCE_STATES DEPTH_WRITE = D3D12_RESOURCE_STATE_DEPTH_WRITE;
+const D3D12_RESOURCE_STATES DEPTH_READ = D3D12_RESOURCE_STATE_DEPTH_READ;
+const D3D12_RESOURCE_STATES NON_PIXEL_SHADER_RESOURCE = D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE;
+const D3D12_RESOURCE_STATES PIXEL_SHADER_RESOURCE = D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE;
+const D3D12_RESOURCE_STATES COPY_DEST = D3D12_RESOURCE_STATE_COPY_DEST;
+const D3D12_RESOURCE_STATES COPY_SOURCE = D3D12_RESOURCE_STATE_COPY_SOURCE;
+
+const std::uint64_t KiB64 = 64 << 10;
+
+const int READ_ONLY_STATES = D3D12_RESOURCE_STATE_VERTEX_AND_CONSTANT_BUFFER
+	| D3D12_RESOURCE_STATE_INDEX_BUFFER
+	| D3D12_RESOURCE_STATE_DEPTH_READ
+	| D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE
+	| D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE
+	| D3D12_RESOURCE_STATE_INDIRECT_ARGUMENT
+	| D3D12_RESOURCE_STATE_COPY_SOURCE;
+
+///////////////////////////////////////////////////////////////////////////////
+bool IsReadOnly (const int state)
+{
+	return state != COMMON && (state & ~READ_ONLY_STATES) == 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+FrameGraphPassDesc Pass (const std::vector<PassResourceUse>& reads,
+	const std::vector<PassResourceUse>& writes, const bool sideEffects = false)
+{
+	FrameGraphPassDesc desc;
+	desc.reads = reads;
+	desc.writes = writes;
+	desc.sideEffects = sideEffects;
+	return desc;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+FrameGraphResourceDesc Imported (const D3D12_RESOURCE_STATES state,
+	const bool hasFinalState = false, const D3D12_RESOURCE_STATES finalState = COMMON)
+{
+	FrameGraphResourceDesc desc;
+	desc.imported = true;
+	desc.initialState = state;
+	desc.hasFinalState = hasFinalState;
+	desc.finalState = finalState;
+	return desc;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+FrameGraphResourceDesc Transient (const TransientHeapType heapType,
+	const std::uint64_t size, const D3D12_RESOURCE_STATES state = COMMON,
+	const std::uint64_t alignment = KiB64)
+{
+	FrameGraphResourceDesc desc;
+	desc.heapType = heapType;
+	desc.size = size;
+	desc.alignment = alignment;
+	desc.initialState = state;
+	return desc;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::vector<int> GetKeptPasses (const CompiledFrameGraph& compiled)
+{
+	std::vector<int> kept;
+	for (const auto& pass : compiled.passes) {
+		kept.push_back (pass.pass);
+	}
+
+	return kept;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+bool Overlaps (const std::uint64_t offsetA, const std::uint64_t sizeA,
+	const std::uint64_t offsetB, const std::uint64_t sizeB)
+{
+	return offsetA < offsetB + sizeB && offsetB < offsetA + sizeA;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Check that only passes nothing needs were culled.
+*/
+void CheckCulling (const std::vector<FrameGraphPassDesc>& passes,
+	const std::vector<FrameGraphResourceDesc>& resources,
+	const CompiledFrameGraph& compiled)
+{
+	const int passCount = static_cast<int> (passes.size ());
+
+	std::vector<bool> kept (passCount, false);
+	for (const auto& pass : compiled.passes) {
+		if (pass.pass != -1) {
+			kept [pass.pass] = true;
+		}
+	}
+
+	auto reads = [&] (const int pass, const int resource) {
+		for (const auto& use : passes [pass].reads) {
+			if (use.resource == resource) {
+				return true;
+			}
+		}
+		return false;
+	};
+
+	auto writes = [&] (const int pass, const int resource) {
+		for (const auto& use : passes [pass].writes) {
+			if (use.resource == resource) {
+				return true;
+			}
+		}
+		return false;
+	};
+
+	// Whatever a kept pass reads was written by a kept pass
+	for (int pass = 0; pass < passCount; ++pass) {
+		if (!kept [pass]) {
+			continue;
+		}
+
+		for (const auto& use : passes [pass].reads) {
+			for (int writer = pass - 1; writer >= 0; --writer) {
+				if (writes (writer, use.resource)) {
+					CHECK (kept [writer]);
+					break;
+				}
+			}
+		}
+	}
+
+	// A culled pass has no effect on anything kept
+	for (int pass = 0; pass < passCount; ++pass) {
+		if (kept [pass]) {
+			continue;
+		}
+
+		CHECK (!passes [pass].sideEffects);
+
+		for (const auto& use : passes [pass].writes) {
+			CHECK (!resources [use.resource].imported);
+
+			for (int later = pass + 1; later < passCount; ++later) {
+				if (!kept [later]) {
+					continue;
+				}
+
+				CHECK (!reads (later, use.resource));
+				if (writes (later, use.resource)) {
+					break;
+				}
+			}
+		}
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Replay the barriers of compiled, and check every pass finds its resources
+in the states it needs, transient resources have their memory activated by
+exactly one aliasing barrier before their first pass and get discarded if
+the first pass renders to them, and everything ends up in its final state.
+*/
+void CheckBarriers (const std::vector<FrameGraphPassDesc>& passes,
+	const std::vector<FrameGraphResourceDesc>& resources,
+	const CompiledFrameGraph& compiled)
+{
+	const int resourceCount = static_cast<int> (resources.size ());
+
+	std::vector<D3D12_RESOURCE_STATES> states (resourceCount);
+	for (int i = 0; i < resourceCount; ++i) {
+		states [i] = resources [i].initialState;
+	}
+
+	std::vector<int> aliasingCount (resourceCount, 0);
+
+	for (int index = 0; index < static_cast<int> (compiled.passes.size ()); ++index) {
+		const auto& pass = compiled.passes [index];
+
+		for (const auto& aliasing : pass.aliasingBarriers) {
+			CHECK (!resources [aliasing.after].imported);
+			CHECK_EQUAL (index, compiled.placements [aliasing.after].firstPass);
+			++aliasingCount [aliasing.after];
+
+			if (aliasing.before != -1) {
+				const auto& before = compiled.placements [aliasing.before];
+				const auto& after = compiled.placements [aliasing.after];
+
+				CHECK (!resources [aliasing.before].imported);
+				CHECK (resources [aliasing.before].heapType == resources [aliasing.after].heapType);
+				CHECK (before.lastPass < index);
+				CHECK (Overlaps (before.offset, resources [aliasing.before].size,
+					after.offset, resources [aliasing.after].size));
+			}
+		}
+
+		for (const auto& transition : pass.beginTransitions) {
+			CHECK_EQUAL (transition.before, states [transition.resource]);
+			CHECK (transition.before != transition.after || transition.after == UNORDERED_ACCESS);
+			states [transition.resource] = transition.after;
+		}
+
+		if (pass.pass != -1) {
+			std::map<int, int> needed;
+			for (const auto& use : passes [pass.pass].reads) {
+				needed [use.resource] |= use.state;
+			}
+			for (const auto& use : passes [pass.pass].writes) {
+				needed [use.resource] |= use.state;
+			}
+
+			for (const auto& use : needed) {
+				const auto state = states [use.first];
+				if (IsReadOnly (use.second)) {
+					CHECK (IsReadOnly (state) && (state & use.second) == use.second);
+				} else {
+					CHECK_EQUAL (use.second, state);
+				}
+			}
+		}
+
+		for (const auto resource : pass.discards) {
+			CHECK (resources [resource].heapType == TransientHeapType::RenderTargetTexture);
+			CHECK (states [resource] == RENDER_TARGET || states [resource] == DEPTH_WRITE);
+		}
+
+		for (const auto& transition : pass.endTransitions) {
+			CHECK_EQUAL (transition.before, states [transition.resource]);
+			states [transition.resource] = transition.after;
+		}
+	}
+
+	for (int i = 0; i < resourceCount; ++i) {
+		CHECK_EQUAL (compiled.finalStates [i], states [i]);
+
+		if (resources [i].imported) {
+			if (resources [i].hasFinalState) {
+				CHECK_EQUAL (resources [i].finalState, states [i]);
+			}
+			continue;
+		}
+
+		// Transient resources are left as they were created
+		CHECK_EQUAL (resources [i].initialState, states [i]);
+		CHECK_EQUAL (compiled.placements [i].firstPass != -1 ? 1 : 0, aliasingCount [i]);
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Transient resources of one heap type which are in use at the same time
+must not share memory.
+*/
+void CheckPlacements (const std::vector<FrameGraphResourceDesc>& resources,
+	const CompiledFrameGraph& compiled)
+{
+	const int resourceCount = static_cast<int> (resources.size ());
+
+	for (int a = 0; a < resourceCount; ++a) {
+		const auto& placementA = compiled.placements [a];
+		if (resources [a].imported || placementA.firstPass == -1) {
+			continue;
+		}
+
+		CHECK_EQUAL (0, placementA.offset % resources [a].alignment);
+		CHECK (placementA.offset + resources [a].size <=
+			compiled.heapSizes [static_cast<int> (resources [a].heapType)]);
+
+		for (int b = a + 1; b < resourceCount; ++b) {
+			const auto& placementB = compiled.placements [b];
+			if (resources [b].imported || placementB.firstPass == -1 ||
+				resources [b].heapType != resources [a].heapType) {
+				continue;
+			}
+
+			const bool live = placementA.firstPass <= placementB.lastPass &&
+				placementB.firstPass <= placementA.lastPass;
+			CHECK (!live || !Overlaps (placementA.offset, resources [a].size,
+				placementB.offset, resources [b].size));
+		}
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void CheckCompiled (const std::vector<FrameGraphPassDesc>& passes,
+	const std::vector<FrameGraphResourceDesc>& resources,
+	const CompiledFrameGraph& compiled)
+{
+	CheckCulling (passes, resources, compiled);
+	CheckBarriers (passes, resources, compiled);
+	CheckPlacements (resources, compiled);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Check that no two requests in use at the same time overlap, and return the
+size of the largest set of requests in use at the same time, which no
+packing can go below.
+*/
+std::uint64_t CheckPacking (const std::vector<TransientAllocationRequest>& requests,
+	const std::vector<std::uint64_t>& offsets, const std::uint64_t size)
+{
+	const auto count = requests.size ();
+	CHECK_EQUAL (count, offsets.size ());
+
+	int passCount = 0;
+	for (std::size_t i = 0; i < count; ++i) {
+		CHECK_EQUAL (0, offsets [i] % requests [i].alignment);
+		CHECK (offsets [i] + requests [i].size <= size);
+		passCount = (std::max) (passCount, requests [i].end + 1);
+
+		for (std::size_t j = i + 1; j < count; ++j) {
+			const bool live = requests [i].begin <= requests [j].end &&
+				requests [j].begin <= requests [i].end;
+			CHECK (!live || !Overlaps (offsets [i], requests [i].size,
+				offsets [j], requests [j].size));
+		}
+	}
+
+	std::uint64_t lowerBound = 0;
+	for (int pass = 0; pass < passCount; ++pass) {
+		std::uint64_t live = 0;
+		for (const auto& request : requests) {
+			if (request.begin <= pass && pass <= request.end) {
+				live += request.size;
+			}
+		}
+		lowerBound = (std::max) (lowerBound, live);
+	}
+
+	CHECK (size >= lowerBound);
+	return lowerBound;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void CreateRandomGraph (std::mt19937& random, const int resourceCount,
+	const int passCount, std::vector<FrameGraphPassDesc>& passes,
+	std::vector<FrameGraphResourceDesc>& resources)
+{
+	const D3D12_RESOURCE_STATES readStates [] = {
+		PIXEL_SHADER_RESOURCE, NON_PIXEL_SHADER_RESOURCE, COPY_SOURCE, DEPTH_READ,
+		static_cast<D3D12_RESOURCE_STATES> (PIXEL_SHADER_RESOURCE | NON_PIXEL_SHADER_RESOURCE)
+	};
+	const D3D12_RESOURCE_STATES writeStates [] = {
+		RENDER_TARGET, UNORDERED_ACCESS, DEPTH_WRITE, COPY_DEST
+	};
+
+	resources.clear ();
+	passes.clear ();
+
+	for (int i = 0; i < resourceCount; ++i) {
+		if (random () % 4 == 0) {
+			resources.push_back (Imported (random () % 2 ? COMMON : PIXEL_SHADER_RESOURCE,
+				random () % 2 == 0, random () % 2 ? COMMON : RENDER_TARGET));
+		} else {
+			const auto heapType = static_cast<TransientHeapType> (random () % 3);
+			const auto state = heapType != TransientHeapType::RenderTargetTexture
+				? COMMON : (random () % 2 ? RENDER_TARGET : DEPTH_WRITE);
+			resources.push_back (Transient (heapType, KiB64 * (1 + random () % 32), state,
+				random () % 10 == 0 ? 64 * KiB64 : KiB64));
+		}
+	}
+
+	for (int i = 0; i < passCount; ++i) {
+		FrameGraphPassDesc pass;
+		std::vector<bool> used (resourceCount, false);
+
+		for (int k = 1 + random () % 2; k > 0; --k) {
+			const int resource = random () % resourceCount;
+			if (used [resource]) {
+				continue;
+			}
+			used [resource] = true;
+
+			const auto state = writeStates [random () % 4];
+			pass.writes.push_back ({ resource, state });
+
+			// A partial update
+			if (state == UNORDERED_ACCESS && random () % 3 == 0) {
+				pass.reads.push_back ({ resource, UNORDERED_ACCESS });
+			}
+		}
+
+		for (int k = random () % 4; k > 0; --k) {
+			const int resource = random () % resourceCount;
+			if (!used [resource]) {
+				used [resource] = true;
+				pass.reads.push_back ({ resource, readStates [random () % 5] });
+			}
+		}
+
+		pass.sideEffects = random () % 15 == 0;
+		passes.push_back (pass);
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+D3D12_RESOURCE_DESC TextureDesc (const UINT width, const UINT height,
+	const DXGI_FORMAT format, const D3D12_RESOURCE_FLAGS flags)
+{
+	D3D12_RESOURCE_DESC desc = {};
+	desc.Dimension = D3D12_RESOURCE_DIMENSION_TEXTURE2D;
+	desc.Width = width;
+	desc.Height = height;
+	desc.DepthOrArraySize = 1;
+	desc.MipLevels = 1;
+	desc.Format = format;
+	desc.SampleDesc.Count = 1;
+	desc.Flags = flags;
+	return desc;
+}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TEST (PacksByLifetime)
+{
+	std::vector<std::uint64_t> offsets;
+
+	// Each only lives during one pass, so everything goes to offset 0
+	std::vector<TransientAllocationRequest> chain;
+	for (int i = 0; i < 8; ++i) {
+		chain.push_back ({ KiB64 * (1 + i % 3), KiB64, i, i });
+	}
+	CHECK_EQUAL (3 * KiB64, PackTransientAllocations (chain, offsets));
+	for (const auto offset : offsets) {
+		CHECK_EQUAL (0, offset);
+	}
+
+	// All in use at once
+	std::vector<TransientAllocationRequest> overlapping;
+	for (int i = 0; i < 5; ++i) {
+		overlapping.push_back ({ KiB64 * (i + 1), KiB64, 0, 3 });
+	}
+	CHECK_EQUAL (15 * KiB64, PackTransientAllocations (overlapping, offsets));
+	CheckPacking (overlapping, offsets, 15 * KiB64);
+
+	// The third one fits into the memory of the first
+	const std::vector<TransientAllocationRequest> gap = {
+		{ 2 * KiB64, KiB64, 0, 1 }, { 2 * KiB64, KiB64, 1, 2 }, { 2 * KiB64, KiB64, 2, 3 }
+	};
+	CHECK_EQUAL (4 * KiB64, PackTransientAllocations (gap, offsets));
+	CHECK_EQUAL (offsets [0], offsets [2]);
+
+	// The larger one is placed first, at an aligned offset
+	const std::vector<TransientAllocationRequest> aligned = {
+		{ KiB64, KiB64, 0, 1 }, { 4 * KiB64, 64 * KiB64, 0, 1 }
+	};
+	const auto size = PackTransientAllocations (aligned, offsets);
+	CHECK_EQUAL (0, offsets [1] % (64 * KiB64));
+	CHECK (offsets [0] >= 4 * KiB64);
+	CHECK_EQUAL (offsets [0] + KiB64, size);
+
+	CHECK_EQUAL (0, PackTransientAllocations ({}, offsets));
+	CHECK (offsets.empty ());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+No overlaps, and on average close to the memory in use at the busiest
+pass, which no packing can beat.
+*/
+TEST (RandomPackingIsTight)
+{
+	std::mt19937 random (7);
+	std::vector<std::uint64_t> offsets;
+	double ratioSum = 0;
+	const int rounds = 2000;
+
+	for (int round = 0; round < rounds; ++round) {
+		const int count = 1 + random () % 40;
+		const int passCount = 1 + random () % 30;
+
+		std::vector<TransientAllocationRequest> requests;
+		for (int i = 0; i < count; ++i) {
+			TransientAllocationRequest request;
+			request.size = KiB64 * (1 + random () % 64);
+			request.alignment = random () % 8 == 0 ? 64 * KiB64 : KiB64;
+			request.begin = random () % passCount;
+			request.end = request.begin + random () % (passCount - request.begin);
+			requests.push_back (request);
+		}
+
+		const auto size = PackTransientAllocations (requests, offsets);
+		const auto lowerBound = CheckPacking (requests, offsets, size);
+		ratioSum += static_cast<double> (size) / lowerBound;
+	}
+
+	CHECK (ratioSum / rounds < 1.25);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TEST (CullsUnusedPasses)
+{
+	// 0 back buffer, 1 albedo, 2 depth, 3 lit, 4 debug, 5 readback
+	const std::vector<FrameGraphResourceDesc> resources = {
+		Imported (COMMON, true, COMMON),
+		Transient (TransientHeapType::RenderTargetTexture, 8 * KiB64, RENDER_TARGET),
+		Transient (TransientHeapType::RenderTargetTexture, 4 * KiB64, DEPTH_WRITE),
+		Transient (TransientHeapType::RenderTargetTexture, 8 * KiB64, RENDER_TARGET),
+		Transient (TransientHeapType::Texture, 2 * KiB64),
+		Transient (TransientHeapType::Buffer, KiB64)
+	};
+
+	const std::vector<FrameGraphPassDesc> passes = {
+		Pass ({}, { { 1, RENDER_TARGET }, { 2, DEPTH_WRITE } }),
+		Pass ({ { 1, PIXEL_SHADER_RESOURCE }, { 2, DEPTH_READ } }, { { 3, RENDER_TARGET } }),
+		// A debug view nobody looks at
+		Pass ({ { 3, PIXEL_SHADER_RESOURCE } }, { { 4, UNORDERED_ACCESS } }),
+		Pass ({ { 4, NON_PIXEL_SHADER_RESOURCE } }, { { 5, UNORDERED_ACCESS } }),
+		Pass ({ { 3, PIXEL_SHADER_RESOURCE } }, { { 0, RENDER_TARGET } }),
+		// Reads back, so it stays
+		Pass ({ { 1, COPY_SOURCE } }, { { 5, COPY_DEST } }, true)
+	};
+
+	const auto compiled = CompileFrameGraph (passes, resources);
+	CheckCompiled (passes, resources, compiled);
+
+	CHECK (GetKeptPasses (compiled) == (std::vector<int> { 0, 1, 4, 5 }));
+	CHECK_EQUAL (-1, compiled.placements [4].firstPass);
+
+	// Both render targets of the first pass get initialized
+	CHECK_EQUAL (2, compiled.passes [0].discards.size ());
+
+	// The back buffer goes back to COMMON after the last pass
+	bool found = false;
+	for (const auto& transition : compiled.passes.back ().endTransitions) {
+		found = found || (transition.resource == 0 && transition.after == COMMON);
+	}
+	CHECK (found);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TEST (OverwritesCullEarlierWriters)
+{
+	const std::vector<FrameGraphResourceDesc> resources = {
+		Imported (COMMON), Transient (TransientHeapType::Texture, KiB64)
+	};
+
+	std::vector<FrameGraphPassDesc> passes = {
+		Pass ({}, { { 1, UNORDERED_ACCESS } }),
+		Pass ({}, { { 1, UNORDERED_ACCESS } }),
+		Pass ({ { 1, NON_PIXEL_SHADER_RESOURCE } }, { { 0, UNORDERED_ACCESS } }),
+		// Imported resources are never culled, even if overwritten
+		Pass ({}, { { 0, COPY_DEST } })
+	};
+
+	auto compiled = CompileFrameGraph (passes, resources);
+	CheckCompiled (passes, resources, compiled);
+	CHECK (GetKeptPasses (compiled) == (std::vector<int> { 1, 2, 3 }));
+
+	// Unless the second pass only updates part of it
+	passes [1] = Pass ({ { 1, UNORDERED_ACCESS } }, { { 1, UNORDERED_ACCESS } });
+	compiled = CompileFrameGraph (passes, resources);
+	CheckCompiled (passes, resources, compiled);
+	CHECK (GetKeptPasses (compiled) == (std::vector<int> { 0, 1, 2, 3 }));
+
+	// A UAV barrier between the two writes
+	CHECK_EQUAL (1, compiled.passes [1].beginTransitions.size ());
+	CHECK_EQUAL (UNORDERED_ACCESS, compiled.passes [1].beginTransitions [0].before);
+	CHECK_EQUAL (UNORDERED_ACCESS, compiled.passes [1].beginTransitions [0].after);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+A chain of passes, each reading the render target of the one before. Only
+two are in use at any time, so they alternate between two places, and each
+aliasing barrier names the resource which had the memory before.
+*/
+TEST (ChainAliasesMemory)
+{
+	std::vector<FrameGraphResourceDesc> resources = {
+		Imported (COMMON, true, PIXEL_SHADER_RESOURCE)
+	};
+	std::vector<FrameGraphPassDesc> passes;
+
+	for (int i = 0; i < 10; ++i) {
+		resources.push_back (Transient (TransientHeapType::RenderTargetTexture,
+			4 * KiB64, RENDER_TARGET));
+
+		std::vector<PassResourceUse> reads;
+		if (i > 0) {
+			reads.push_back ({ i, PIXEL_SHADER_RESOURCE });
+		}
+		passes.push_back (Pass (reads, { { i + 1, RENDER_TARGET } }));
+	}
+	passes.push_back (Pass ({ { 10, PIXEL_SHADER_RESOURCE } }, { { 0, RENDER_TARGET } }));
+
+	const auto compiled = CompileFrameGraph (passes, resources);
+	CheckCompiled (passes, resources, compiled);
+
+	CHECK_EQUAL (8 * KiB64, compiled.heapSizes [static_cast<int> (TransientHeapType::RenderTargetTexture)]);
+	CHECK_EQUAL (0, compiled.heapSizes [static_cast<int> (TransientHeapType::Texture)]);
+
+	int named = 0;
+	for (const auto& pass : compiled.passes) {
+		for (const auto& aliasing : pass.aliasingBarriers) {
+			if (aliasing.before != -1) {
+				CHECK_EQUAL (aliasing.after - 2, aliasing.before);
+				++named;
+			}
+		}
+	}
+
+	// All but the first two
+	CHECK_EQUAL (8, named);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+The large resource took over the memory of two smaller ones, so its
+aliasing barrier can't name a single one before it.
+*/
+TEST (AliasingSeveralPreviousResources)
+{
+	const std::vector<FrameGraphResourceDesc> resources = {
+		Imported (COMMON),
+		Transient (TransientHeapType::Texture, 2 * KiB64),
+		Transient (TransientHeapType::Texture, 2 * KiB64),
+		Transient (TransientHeapType::Texture, 4 * KiB64)
+	};
+
+	const std::vector<FrameGraphPassDesc> passes = {
+		Pass ({}, { { 1, UNORDERED_ACCESS }, { 2, UNORDERED_ACCESS } }),
+		Pass ({ { 1, NON_PIXEL_SHADER_RESOURCE }, { 2, NON_PIXEL_SHADER_RESOURCE } },
+			{ { 0, UNORDERED_ACCESS } }),
+		Pass ({}, { { 3, UNORDERED_ACCESS } }),
+		Pass ({ { 3, NON_PIXEL_SHADER_RESOURCE } }, { { 0, UNORDERED_ACCESS } })
+	};
+
+	const auto compiled = CompileFrameGraph (passes, resources);
+	CheckCompiled (passes, resources, compiled);
+
+	CHECK_EQUAL (4 * KiB64, compiled.heapSizes [static_cast<int> (TransientHeapType::Texture)]);
+	CHECK_EQUAL (1, compiled.passes [2].aliasingBarriers.size ());
+	CHECK_EQUAL (3, compiled.passes [2].aliasingBarriers [0].after);
+	CHECK_EQUAL (-1, compiled.passes [2].aliasingBarriers [0].before);
+
+	// Not render targets, so no discards
+	CHECK (compiled.passes [2].discards.empty ());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TEST (EmptyGraphOnlyTransitions)
+{
+	const std::vector<FrameGraphResourceDesc> resources = {
+		Imported (RENDER_TARGET, true, COMMON)
+	};
+
+	const auto compiled = CompileFrameGraph ({}, resources);
+	CheckCompiled ({}, resources, compiled);
+
+	CHECK_EQUAL (1, compiled.passes.size ());
+	CHECK_EQUAL (-1, compiled.passes [0].pass);
+	CHECK_EQUAL (1, compiled.passes [0].endTransitions.size ());
+
+	CHECK (CompileFrameGraph ({}, { Imported (COMMON) }).passes.empty ());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TEST (InvalidGraphsThrow)
+{
+	const std::vector<FrameGraphResourceDesc> resources = { Imported (COMMON) };
+
+	CHECK_THROWS (CompileFrameGraph ({ Pass ({ { 0, PIXEL_SHADER_RESOURCE } },
+		{ { 0, RENDER_TARGET } }) }, resources));
+	CHECK_THROWS (CompileFrameGraph ({ Pass ({ { 1, PIXEL_SHADER_RESOURCE } }, {}) }, resources));
+	CHECK_THROWS (CompileFrameGraph ({ Pass ({}, { { -1, RENDER_TARGET } }) }, resources));
+
+	// Reading in two states combines them
+	const auto compiled = CompileFrameGraph ({ Pass ({ { 0, PIXEL_SHADER_RESOURCE },
+		{ 0, NON_PIXEL_SHADER_RESOURCE } }, {}, true) }, resources);
+	CHECK_EQUAL (1, compiled.passes [0].beginTransitions.size ());
+	CHECK_EQUAL (PIXEL_SHADER_RESOURCE | NON_PIXEL_SHADER_RESOURCE,
+		compiled.passes [0].beginTransitions [0].after);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TEST (RandomGraphsCompile)
+{
+	std::mt19937 random (1234);
+	std::vector<FrameGraphPassDesc> passes;
+	std::vector<FrameGraphResourceDesc> resources;
+
+	for (int round = 0; round < 5000; ++round) {
+		CreateRandomGraph (random, 1 + random () % 16, random () % 24, passes, resources);
+		const auto compiled = CompileFrameGraph (passes, resources);
+		CheckCompiled (passes, resources, compiled);
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+A deferred frame recorded through FrameGraph. The record functions note
+where the begin barriers end, so the barriers the command lists got can be
+replayed pass by pass. Every other frame adds a debug pass; without it, the
+debug output is culled.
+*/
+TEST (RecordsDeferredFrames)
+{
+	ComPtr<Test::FakeDevice> device;
+	device.Attach (new Test::FakeDevice);
+
+	SubmissionBatcher batcher (device.Get ());
+	ComPtr<ID3D12CommandQueue> queue;
+	queue.Attach (new Test::FakeCommandQueue);
+	const auto queueIndex = batcher.AddQueue (queue.Get ());
+
+	FrameGraph graph (device.Get (), batcher, queueIndex, 2);
+
+	ComPtr<ID3D12Resource> backBuffers [2];
+	for (auto& backBuffer : backBuffers) {
+		backBuffer.Attach (new ID3D12Resource);
+	}
+
+	int placedAfterWarmUp = 0;
+	int heapsAfterWarmUp = 0;
+
+	for (int frame = 0; frame < 6; ++frame) {
+		const int slot = frame % 2;
+		const bool debug = frame == 3;
+
+		const auto present = COMMON;
+		const int backBuffer = graph.ImportResource (backBuffers [slot].Get (), present, &present);
+
+		const auto albedo = graph.CreateTransientResource (TextureDesc (256, 128,
+			DXGI_FORMAT_R8G8B8A8_UNORM, D3D12_RESOURCE_FLAG_ALLOW_RENDER_TARGET));
+		const auto normals = graph.CreateTransientResource (TextureDesc (256, 128,
+			DXGI_FORMAT_R8G8B8A8_UNORM, D3D12_RESOURCE_FLAG_ALLOW_RENDER_TARGET));
+		const auto lit = graph.CreateTransientResource (TextureDesc (256, 128,
+			DXGI_FORMAT_R8G8B8A8_UNORM, D3D12_RESOURCE_FLAG_ALLOW_RENDER_TARGET));
+		const auto bloom = graph.CreateTransientResource (TextureDesc (128, 64,
+			DXGI_FORMAT_R8G8B8A8_UNORM, D3D12_RESOURCE_FLAG_ALLOW_RENDER_TARGET));
+		const auto occlusion = graph.CreateTransientResource (TextureDesc (256, 128,
+			DXGI_FORMAT_R8G8B8A8_UNORM, D3D12_RESOURCE_FLAG_ALLOW_UNORDERED_ACCESS));
+		const auto debugOutput = graph.CreateTransientResource (TextureDesc (256, 128,
+			DXGI_FORMAT_R8G8B8A8_UNORM, D3D12_RESOURCE_FLAG_ALLOW_RENDER_TARGET));
+
+		std::vector<FrameGraphPassDesc> descs = {
+			Pass ({}, { { albedo, RENDER_TARGET }, { normals, RENDER_TARGET } }),
+			Pass ({ { normals, NON_PIXEL_SHADER_RESOURCE } }, { { occlusion, UNORDERED_ACCESS } }),
+			Pass ({ { albedo, PIXEL_SHADER_RESOURCE }, { normals, PIXEL_SHADER_RESOURCE },
+				{ occlusion, PIXEL_SHADER_RESOURCE } }, { { lit, RENDER_TARGET } }),
+			Pass ({ { lit, PIXEL_SHADER_RESOURCE } }, { { bloom, RENDER_TARGET } }),
+			Pass ({ { lit, PIXEL_SHADER_RESOURCE }, { bloom, PIXEL_SHADER_RESOURCE } },
+				{ { backBuffer, RENDER_TARGET } }),
+			Pass ({ { normals, PIXEL_SHADER_RESOURCE } }, { { debugOutput, RENDER_TARGET } })
+		};
+
+		if (debug) {
+			descs.push_back (Pass ({ { debugOutput, PIXEL_SHADER_RESOURCE } },
+				{ { backBuffer, RENDER_TARGET } }));
+		}
+
+		struct RecordedPass
+		{
+			Test::FakeCommandList* commandList = nullptr;
+			std::size_t beginBarrierCount = 0;
+		};
+
+		std::vector<RecordedPass> recorded (descs.size ());
+		std::vector<ID3D12Resource*> objects;
+
+		for (std::size_t i = 0; i < descs.size (); ++i) {
+			graph.AddPass (descs [i], [&recorded, i] (ID3D12GraphicsCommandList* commandList,
+				const FrameGraph&) {
+				auto list = static_cast<Test::FakeCommandList*> (commandList);
+				recorded [i].commandList = list;
+				recorded [i].beginBarrierCount = list->GetBarriers ().size ();
+			});
+		}
+
+		graph.Record (slot);
+
+		for (int i = 0; i <= debugOutput; ++i) {
+			objects.push_back (graph.GetResource (i));
+		}
+
+		auto find = [&objects] (ID3D12Resource* object) {
+			const auto it = std::find (objects.begin (), objects.end (), object);
+			CHECK (it != objects.end ());
+			return static_cast<int> (it - objects.begin ());
+		};
+
+		// Transients start out in the state they were created in
+		std::vector<int> states = { present, RENDER_TARGET, RENDER_TARGET, RENDER_TARGET,
+			RENDER_TARGET, COMMON, RENDER_TARGET };
+		std::vector<bool> active (objects.size (), false);
+
+		auto replay = [&] (const D3D12_RESOURCE_BARRIER& barrier) {
+			if (barrier.Type == D3D12_RESOURCE_BARRIER_TYPE_ALIASING) {
+				const auto after = find (barrier.Aliasing.pResourceAfter);
+				CHECK (!active [after]);
+				active [after] = true;
+			} else if (barrier.Type == D3D12_RESOURCE_BARRIER_TYPE_TRANSITION) {
+				const auto resource = find (barrier.Transition.pResource);
+				CHECK_EQUAL (states [resource], barrier.Transition.StateBefore);
+				states [resource] = barrier.Transition.StateAfter;
+			}
+		};
+
+		for (std::size_t i = 0; i < descs.size (); ++i) {
+			const auto& pass = recorded [i];
+
+			// The debug output only gets recorded if something shows it
+			if (i == 5 && !debug) {
+				CHECK (pass.commandList == nullptr);
+				continue;
+			}
+
+			CHECK (pass.commandList != nullptr);
+			const auto& barriers = pass.commandList->GetBarriers ();
+
+			for (std::size_t b = 0; b < pass.beginBarrierCount; ++b) {
+				replay (barriers [b]);
+			}
+
+			for (const auto& use : descs [i].writes) {
+				CHECK_EQUAL (use.state, states [use.resource]);
+				CHECK (use.resource == backBuffer || active [use.resource]);
+			}
+
+			for (const auto& use : descs [i].reads) {
+				CHECK ((states [use.resource] & use.state) == use.state);
+			}
+
+			for (std::size_t b = pass.beginBarrierCount; b < barriers.size (); ++b) {
+				replay (barriers [b]);
+			}
+		}
+
+		CHECK_EQUAL (present, states [backBuffer]);
+		CHECK_EQUAL (RENDER_TARGET, states [lit]);
+		CHECK_EQUAL (COMMON, states [occlusion]);
+
+		const auto& statistics = graph.GetStatistics ();
+		CHECK_EQUAL (debug ? 0 : 1, statistics.culledPasses);
+		CHECK (statistics.transientMemory < statistics.unaliasedTransientMemory);
+
+		graph.Submit ({});
+		batcher.Flush ();
+
+		// Both slots have their resources after the first two frames
+		if (frame == 1) {
+			placedAfterWarmUp = device->GetPlacedResourceCount ();
+			heapsAfterWarmUp = device->GetHeapCount ();
+		} else if (frame == 2) {
+			CHECK_EQUAL (placedAfterWarmUp, device->GetPlacedResourceCount ());
+			CHECK_EQUAL (heapsAfterWarmUp, device->GetHeapCount ());
+		}
+	}
+}
@@ -0,0 +1,181 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#include "Test.h"
+
+#include "FramePipeline.h"
+
+#include <chrono>
+#include <cstdint>
+#include <stdexcept>
+#include <thread>
+
+using namespace AMD;
+
+namespace {
+///////////////////////////////////////////////////////////////////////////////
+/**
+Every step writes the step number into all fields, so a snapshot mixed from
+two steps would have fields which disagree.
+*/
+struct State
+{
+	std::int64_t step = 0;
+	std::int64_t values [16] = {};
+
+	bool IsConsistent () const
+	{
+		for (const auto value : values) {
+			if (value != step) {
+				return false;
+			}
+		}
+
+		return true;
+	}
+};
+
+///////////////////////////////////////////////////////////////////////////////
+void Step (State& state)
+{
+	++state.step;
+	for (auto& value : state.values) {
+		value = state.step;
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+FramePipelineOptions CreateOptions (const FramePacing pacing,
+	const std::chrono::microseconds step = std::chrono::microseconds (16667))
+{
+	FramePipelineOptions options;
+	options.pacing = pacing;
+	options.simulationStep = step;
+	return options;
+}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TEST (LockstepRendersEverySnapshot)
+{
+	FramePipeline<State> pipeline (CreateOptions (FramePacing::Lockstep), State (), Step);
+
+	for (std::int64_t frame = 1; frame <= 2000; ++frame) {
+		const auto& snapshot = pipeline.AcquireSnapshot ();
+		CHECK_EQUAL (frame, snapshot.step);
+		CHECK (snapshot.IsConsistent ());
+		CHECK_EQUAL (static_cast<std::uint64_t> (frame), pipeline.GetSequence ());
+		CHECK (pipeline.GetLatency ().count () >= 0);
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TEST (LockstepSimulationWaitsForRenderer)
+{
+	std::atomic<int> stepCount (0);
+	FramePipeline<State> pipeline (CreateOptions (FramePacing::Lockstep), State (),
+		[&] (State& state) {
+		Step (state);
+		++stepCount;
+	});
+
+	// One step published, one in flight at most
+	std::this_thread::sleep_for (std::chrono::milliseconds (20));
+	CHECK (stepCount.load () <= 2);
+
+	pipeline.AcquireSnapshot ();
+	std::this_thread::sleep_for (std::chrono::milliseconds (20));
+	CHECK (stepCount.load () <= 3);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TEST (FixedStepNeverWaitsForSimulation)
+{
+	const auto step = std::chrono::microseconds (500);
+	FramePipeline<State> pipeline (CreateOptions (FramePacing::FixedStep, step), State (), Step);
+
+	// The initial state until the first step is published
+	const auto& initial = pipeline.AcquireSnapshot ();
+	CHECK (initial.step <= 1);
+
+	std::int64_t last = 0;
+	bool isConsistent = true, isMonotonic = true;
+	const auto end = std::chrono::steady_clock::now () + std::chrono::milliseconds (50);
+
+	while (std::chrono::steady_clock::now () < end) {
+		const auto& snapshot = pipeline.AcquireSnapshot ();
+		isConsistent = isConsistent && snapshot.IsConsistent ();
+		isMonotonic = isMonotonic && snapshot.step >= last;
+		last = snapshot.step;
+	}
+
+	CHECK (isConsistent);
+	CHECK (isMonotonic);
+	// 100 steps fit into the time, leave plenty of room for a slow machine
+	CHECK (last > 10);
+	CHECK (last <= 110);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TEST (SimulationErrorsAreRethrown)
+{
+	FramePipeline<State> pipeline (CreateOptions (FramePacing::Lockstep), State (),
+		[] (State& state) {
+		if (state.step == 3) {
+			throw std::runtime_error ("Simulation failed");
+		}
+		Step (state);
+	});
+
+	CHECK_EQUAL (1, pipeline.AcquireSnapshot ().step);
+	CHECK_EQUAL (2, pipeline.AcquireSnapshot ().step);
+	CHECK_EQUAL (3, pipeline.AcquireSnapshot ().step);
+	CHECK_THROWS (pipeline.AcquireSnapshot ());
+	CHECK_THROWS (pipeline.AcquireSnapshot ());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TEST (StopReleasesRenderer)
+{
+	FramePipeline<State> pipeline (CreateOptions (FramePacing::Lockstep), State (), Step);
+	pipeline.AcquireSnapshot ();
+
+	std::thread stopper ([&] () {
+		std::this_thread::sleep_for (std::chrono::milliseconds (5));
+		pipeline.Stop ();
+	});
+
+	// Either the pending step or the last one, but it must not hang
+	for (int i = 0; i < 3; ++i) {
+		const auto& snapshot = pipeline.AcquireSnapshot ();
+		CHECK (snapshot.step >= 1);
+	}
+
+	stopper.join ();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TEST (RejectsInvalidStep)
+{
+	CHECK_THROWS (FramePipeline<State> pipeline (CreateOptions (FramePacing::FixedStep,
+		std::chrono::microseconds (0)), State (), Step));
+}
@@ -0,0 +1,82 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+
+#include "Benchmark.h"
+
+#include "ImageResampler.h"
+#include "TestImage.h"
+
+#include <string>
+#include <vector>
+
+using namespace AMD;
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Typical load time resizes: fitting a 4096x4096 image into 2048 and 1024, and
+upscaling 1024x1024 to 2048x2048. Throughput is in input bytes.
+*/
+int main ()
+{
+	const auto large = Test::CreateTestImage (4096, 4096, true);
+	const auto small = Test::CreateTestImage (1024, 1024, true);
+
+	const struct
+	{
+		const char* name;
+		ResampleFilter filter;
+	} filters [] = {
+		{ "Mitchell", ResampleFilter::Mitchell },
+		{ "Lanczos3", ResampleFilter::Lanczos3 }
+	};
+
+	const struct
+	{
+		const char* name;
+		const std::vector<std::uint8_t>& input;
+		int inputSize;
+		int outputSize;
+	} cases [] = {
+		{ "4096 to 2048", large, 4096, 2048 },
+		{ "4096 to 1024", large, 4096, 1024 },
+		{ "1024 to 2048", small, 1024, 2048 }
+	};
+
+	for (const auto& resize : cases) {
+		std::vector<std::uint8_t> output (
+			static_cast<std::size_t> (resize.outputSize) * resize.outputSize * 4);
+
+		for (const auto& filter : filters) {
+			const auto name = std::string (resize.name) + " (" + filter.name + ")";
+			Test::Report (name.c_str (), Test::Measure ([&] () {
+				ResampleImage (resize.input.data (), resize.inputSize, resize.inputSize,
+					resize.inputSize * 4,
+					output.data (), resize.outputSize, resize.outputSize,
+					resize.outputSize * 4,
+					filter.filter, AlphaMode::Straight);
+			}, 3), resize.input.size ());
+		}
+	}
+
+	return 0;
+}
@@ -0,0 +1,225 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+
+#include "Test.h"
+
+#include "ImageResampler.h"
+#include "TestImage.h"
+
+#include <cmath>
+#include <cstdlib>
+#include <vector>
+
+using namespace AMD;
+
+namespace {
+const ResampleFilter FILTERS [] = { ResampleFilter::Mitchell, ResampleFilter::Lanczos3 };
+const AlphaMode ALPHA_MODES [] = { AlphaMode::Straight, AlphaMode::Premultiplied };
+
+///////////////////////////////////////////////////////////////////////////////
+std::vector<std::uint8_t> Resample (const std::vector<std::uint8_t>& input,
+	const int inputWidth, const int inputHeight,
+	const int outputWidth, const int outputHeight,
+	const ResampleFilter filter, const AlphaMode alphaMode)
+{
+	std::vector<std::uint8_t> output (static_cast<std::size_t> (outputWidth) * outputHeight * 4);
+	ResampleImage (input.data (), inputWidth, inputHeight, inputWidth * 4,
+		output.data (), outputWidth, outputHeight, outputWidth * 4,
+		filter, alphaMode);
+	return output;
+}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TEST (FittedSize)
+{
+	int width, height;
+
+	GetFittedImageSize (1280, 720, 1024, &width, &height);
+	CHECK_EQUAL (1024, width);
+	CHECK_EQUAL (576, height);
+
+	GetFittedImageSize (720, 1280, 1024, &width, &height);
+	CHECK_EQUAL (576, width);
+	CHECK_EQUAL (1024, height);
+
+	// Fits already
+	GetFittedImageSize (1280, 720, 2048, &width, &height);
+	CHECK_EQUAL (1280, width);
+	CHECK_EQUAL (720, height);
+
+	// The short side never drops to zero
+	GetFittedImageSize (10000, 3, 1000, &width, &height);
+	CHECK_EQUAL (1000, width);
+	CHECK_EQUAL (1, height);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TEST (SameSizeIsIdentity)
+{
+	// Lanczos is interpolating, Mitchell with B = 1/3 is not
+	const auto image = Test::CreateTestImage (67, 31, true);
+	CHECK (Resample (image, 67, 31, 67, 31, ResampleFilter::Lanczos3,
+		AlphaMode::Premultiplied) == image);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TEST (SolidColorStaysSolid)
+{
+	std::vector<std::uint8_t> image (97 * 53 * 4);
+	const std::uint8_t color [4] = { 200, 30, 90, 128 };
+	for (std::size_t i = 0; i < image.size (); ++i) {
+		image [i] = color [i % 4];
+	}
+
+	const int sizes [][2] = { { 40, 20 }, { 300, 100 }, { 1, 1 }, { 97, 7 } };
+
+	for (const auto filter : FILTERS) {
+		for (const auto alphaMode : ALPHA_MODES) {
+			for (const auto& size : sizes) {
+				const auto output = Resample (image, 97, 53, size [0], size [1],
+					filter, alphaMode);
+
+				for (std::size_t i = 0; i < output.size (); ++i) {
+					CHECK_EQUAL (color [i % 4], output [i]);
+				}
+			}
+		}
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Transparent texels may have any color, with straight alpha it must not show
+up in the visible texels next to them.
+*/
+TEST (StraightAlphaDoesNotBleed)
+{
+	const int width = 64, height = 16;
+	std::vector<std::uint8_t> image (width * height * 4);
+
+	for (int y = 0; y < height; ++y) {
+		for (int x = 0; x < width; ++x) {
+			std::uint8_t* pixel = image.data () + (y * width + x) * 4;
+			const bool visible = x < width / 2;
+			pixel [0] = visible ? 255 : 0;
+			pixel [1] = visible ? 0 : 255;
+			pixel [2] = 0;
+			pixel [3] = visible ? 255 : 0;
+		}
+	}
+
+	for (const auto filter : FILTERS) {
+		const auto output = Resample (image, width, height, 16, 4,
+			filter, AlphaMode::Straight);
+
+		for (std::size_t i = 0; i < output.size (); i += 4) {
+			if (output [i + 3] > 0) {
+				CHECK (output [i + 0] > 250);
+				CHECK (output [i + 1] < 5);
+			}
+		}
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TEST (DownsamplingKeepsAverage)
+{
+	const auto image = Test::CreateTestImage (256, 128, false);
+
+	// Filtering happens in linear space, so that is where the average is
+	// kept
+	const auto average = [] (const std::vector<std::uint8_t>& pixels, const int c) {
+		double sum = 0;
+		for (std::size_t i = c; i < pixels.size (); i += 4) {
+			const double value = pixels [i] / 255.0;
+			sum += (value <= 0.04045) ? value / 12.92 : std::pow ((value + 0.055) / 1.055, 2.4);
+		}
+		return sum / (pixels.size () / 4);
+	};
+
+	for (const auto filter : FILTERS) {
+		const auto output = Resample (image, 256, 128, 64, 32,
+			filter, AlphaMode::Premultiplied);
+
+		for (int c = 0; c < 3; ++c) {
+			CHECK_NEAR (average (image, c), average (output, c), 0.005);
+		}
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TEST (UpsamplingIsSmooth)
+{
+	// A linear ramp stays monotonic when magnified, apart from ringing at
+	// the borders, which the filters clamp
+	std::vector<std::uint8_t> image (16 * 4);
+	for (int x = 0; x < 16; ++x) {
+		image [x * 4 + 0] = image [x * 4 + 1] = image [x * 4 + 2] =
+			static_cast<std::uint8_t> (x * 16);
+		image [x * 4 + 3] = 255;
+	}
+
+	for (const auto filter : FILTERS) {
+		const auto output = Resample (image, 16, 1, 64, 1,
+			filter, AlphaMode::Premultiplied);
+
+		for (int x = 1; x < 64; ++x) {
+			CHECK (output [x * 4] + 1 >= output [(x - 1) * 4]);
+		}
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TEST (RespectsRowPitch)
+{
+	const auto image = Test::CreateTestImage (30, 20, true);
+
+	// Pad input and output rows, the output padding must stay untouched
+	const std::size_t inputPitch = 30 * 4 + 12;
+	const std::size_t outputPitch = 15 * 4 + 20;
+	std::vector<std::uint8_t> paddedInput (inputPitch * 20, 0xCD);
+	for (int y = 0; y < 20; ++y) {
+		std::copy (image.begin () + y * 30 * 4, image.begin () + (y + 1) * 30 * 4,
+			paddedInput.begin () + y * inputPitch);
+	}
+
+	std::vector<std::uint8_t> paddedOutput (outputPitch * 10, 0xAB);
+	ResampleImage (paddedInput.data (), 30, 20, inputPitch,
+		paddedOutput.data (), 15, 10, outputPitch,
+		ResampleFilter::Lanczos3, AlphaMode::Straight);
+
+	const auto expected = Resample (image, 30, 20, 15, 10,
+		ResampleFilter::Lanczos3, AlphaMode::Straight);
+
+	for (int y = 0; y < 10; ++y) {
+		for (std::size_t x = 0; x < outputPitch; ++x) {
+			const auto value = paddedOutput [y * outputPitch + x];
+			if (x < 15 * 4) {
+				CHECK_EQUAL (expected [y * 15 * 4 + x], value);
+			} else {
+				CHECK_EQUAL (0xAB, value);
+			}
+		}
+	}
+}
@@ -0,0 +1,156 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+
+#include "Test.h"
+
+#include "Lz4.h"
+#include "TestFile.h"
+#include "TestImage.h"
+
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+using namespace AMD;
+
+namespace {
+///////////////////////////////////////////////////////////////////////////////
+void CheckRoundTrip (const std::vector<std::uint8_t>& data)
+{
+	const auto compressed = Lz4Compress (data.data (), data.size ());
+
+	std::vector<std::uint8_t> output (data.size ());
+	Lz4Decompress (compressed.data (), compressed.size (), output.data (), output.size ());
+	CHECK (output == data);
+}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TEST (EmptyInput)
+{
+	const auto compressed = Lz4Compress (nullptr, 0);
+	CHECK_EQUAL (1, compressed.size ());
+
+	// Nothing to write, so there is no output buffer
+	Lz4Decompress (compressed.data (), compressed.size (), nullptr, 0);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TEST (RoundTrip)
+{
+	// Around the minimum sizes for a match
+	for (std::size_t size = 1; size < 40; ++size) {
+		CheckRoundTrip (std::vector<std::uint8_t> (size, 'a'));
+		CheckRoundTrip (Test::CreateRandomBytes (size, static_cast<unsigned int> (size)));
+	}
+
+	CheckRoundTrip (Test::CreateRandomBytes (100000));
+	CheckRoundTrip (Test::CreateTestImage (256, 256, true));
+
+	// Long literal runs and long, overlapping matches
+	std::vector<std::uint8_t> mixed = Test::CreateRandomBytes (1000);
+	mixed.resize (mixed.size () + 5000, 7);
+	const auto tail = Test::CreateRandomBytes (300, 2);
+	mixed.insert (mixed.end (), tail.begin (), tail.end ());
+	CheckRoundTrip (mixed);
+
+	// Matches further away than the maximum offset must not be used
+	std::vector<std::uint8_t> far = Test::CreateRandomBytes (70000, 3);
+	far.insert (far.end (), far.begin (), far.begin () + 1000);
+	CheckRoundTrip (far);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TEST (RepetitiveInputCompresses)
+{
+	const std::vector<std::uint8_t> data (65536, 42);
+	CHECK (Lz4Compress (data.data (), data.size ()).size () < 512);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TEST (RejectsMalformedInput)
+{
+	std::vector<std::uint8_t> data (1000);
+	for (std::size_t i = 0; i < data.size (); ++i) {
+		data [i] = static_cast<std::uint8_t> (i % 13);
+	}
+
+	const auto compressed = Lz4Compress (data.data (), data.size ());
+	std::vector<std::uint8_t> output (data.size ());
+
+	// Wrong output size
+	CHECK_THROWS (Lz4Decompress (compressed.data (), compressed.size (),
+		output.data (), output.size () - 1));
+	output.resize (data.size () + 1);
+	CHECK_THROWS (Lz4Decompress (compressed.data (), compressed.size (),
+		output.data (), output.size ()));
+	output.resize (data.size ());
+
+	// Every truncation must throw, not read past the end
+	for (std::size_t size = 0; size < compressed.size (); ++size) {
+		CHECK_THROWS (Lz4Decompress (compressed.data (), size,
+			output.data (), output.size ()));
+	}
+
+	// A match before the start of the output
+	const std::uint8_t badOffset [] = { 0x10, 'a', 0x02, 0x00, 0x50, 'a', 'a', 'a', 'a', 'a' };
+	output.resize (10);
+	CHECK_THROWS (Lz4Decompress (badOffset, sizeof (badOffset), output.data (), output.size ()));
+
+	// Offset 0 is invalid
+	const std::uint8_t zeroOffset [] = { 0x10, 'a', 0x00, 0x00, 0x50, 'a', 'a', 'a', 'a', 'a' };
+	CHECK_THROWS (Lz4Decompress (zeroOffset, sizeof (zeroOffset), output.data (), output.size ()));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Decompresses the output of the compressor in tools/embedAsset.py, written by
+writeToolLz4.py. ctest sets the directory when Python is available, otherwise
+there is nothing to check.
+*/
+TEST (DecompressesToolOutput)
+{
+	const char* directory = std::getenv ("LZ4_TOOL_OUTPUT");
+	if (directory == nullptr) {
+		return;
+	}
+
+	const char* cases [] = {
+		"Empty", "OneByte", "BelowMatchLimit", "AtMatchLimit",
+		"Run", "Pattern", "Random", "SmallAlphabet", "FarRepeat"
+	};
+
+	for (const char* name : cases) {
+		const std::string path = std::string (directory) + "/" + name;
+		const auto data = Test::ReadFileBytes ((path + ".bin").c_str ());
+		const auto compressed = Test::ReadFileBytes ((path + ".lz4").c_str ());
+
+		std::vector<std::uint8_t> output (data.size ());
+		Lz4Decompress (compressed.data (), compressed.size (),
+			output.data (), output.size ());
+		CHECK (output == data);
+
+		// Both compressors use the same matcher
+		CHECK (compressed == Lz4Compress (data.data (), data.size ()));
+	}
+}
@@ -0,0 +1,85 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+
+#include "Benchmark.h"
+
+#include "MipChain.h"
+#include "PixelConversion.h"
+
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace AMD;
+
+///////////////////////////////////////////////////////////////////////////////
+int main ()
+{
+	const int sizes [][2] = { { 2048, 2048 }, { 2047, 1023 } };
+
+	for (const auto& size : sizes) {
+		const int width = size [0];
+		const int height = size [1];
+
+		std::mt19937 random (1);
+		std::vector<std::uint8_t> image (static_cast<std::size_t> (width) * height * 4);
+		for (auto& c : image) {
+			c = static_cast<std::uint8_t> (random ());
+		}
+
+		const struct
+		{
+			const char* name;
+			MipFilter filter;
+		} filters [] = { { "box", MipFilter::Box }, { "kaiser", MipFilter::Kaiser } };
+
+		const struct
+		{
+			const char* name;
+			SimdLevel level;
+		} levels [] = { { "SSE2", SimdLevel::SSSE3 }, { "AVX", SimdLevel::AVX2 } };
+
+		for (const auto& filter : filters) {
+			for (const auto& level : levels) {
+				if (level.level > GetMaximumSimdLevel ()) {
+					continue;
+				}
+
+				SetPixelConversionSimdLevel (level.level);
+
+				const auto seconds = Test::Measure ([&] () {
+					GenerateMipChain (image.data (), width, height, width * 4,
+						AlphaMode::Straight, filter.filter);
+				});
+
+				const auto name = std::to_string (width) + "x" + std::to_string (height) +
+					" " + filter.name + " " + level.name;
+				// Throughput relative to the size of level 0
+				Test::Report (name.c_str (), seconds, static_cast<double> (image.size ()));
+			}
+		}
+	}
+
+	return 0;
+}
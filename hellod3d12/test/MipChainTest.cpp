@@ -0,0 +1,279 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+
+#include "Test.h"
+
+#include "MipChain.h"
+#include "PixelConversion.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+using namespace AMD;
+
+namespace {
+///////////////////////////////////////////////////////////////////////////////
+std::vector<std::uint8_t> CreateRandomImage (const int width, const int height,
+	const unsigned int seed)
+{
+	std::mt19937 random (seed);
+	std::vector<std::uint8_t> result (static_cast<std::size_t> (width) * height * 4);
+	for (auto& c : result) {
+		c = static_cast<std::uint8_t> (random ());
+	}
+
+	return result;
+}
+
+std::vector<std::uint8_t> CreateSolidImage (const int width, const int height,
+	const std::uint8_t r, const std::uint8_t g, const std::uint8_t b, const std::uint8_t a)
+{
+	std::vector<std::uint8_t> result (static_cast<std::size_t> (width) * height * 4);
+	for (std::size_t i = 0; i < result.size (); i += 4) {
+		result [i + 0] = r;
+		result [i + 1] = g;
+		result [i + 2] = b;
+		result [i + 3] = a;
+	}
+
+	return result;
+}
+
+float SrgbToLinear (const std::uint8_t value)
+{
+	const float c = value / 255.0f;
+	return (c <= 0.04045f) ? c / 12.92f : std::pow ((c + 0.055f) / 1.055f, 2.4f);
+}
+
+/**
+Mean linear value of one channel.
+*/
+double GetMean (const std::vector<std::uint8_t>& pixels, const int channel)
+{
+	double sum = 0;
+	for (std::size_t i = channel; i < pixels.size (); i += 4) {
+		sum += SrgbToLinear (pixels [i]);
+	}
+
+	return sum / (pixels.size () / 4);
+}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TEST (MipLevelCount)
+{
+	CHECK_EQUAL (1, GetMipLevelCount (1, 1));
+	CHECK_EQUAL (2, GetMipLevelCount (2, 1));
+	CHECK_EQUAL (2, GetMipLevelCount (3, 3));
+	CHECK_EQUAL (3, GetMipLevelCount (4, 1));
+	CHECK_EQUAL (11, GetMipLevelCount (1024, 768));
+	CHECK_EQUAL (11, GetMipLevelCount (1025, 3));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TEST (LevelSizesRoundDown)
+{
+	const auto image = CreateRandomImage (13, 6, 1);
+	const auto chain = GenerateMipChain (image.data (), 13, 6, 13 * 4,
+		AlphaMode::Premultiplied);
+
+	const int expected [][2] = { { 6, 3 }, { 3, 1 }, { 1, 1 } };
+	CHECK_EQUAL (3, static_cast<int> (chain.size ()));
+
+	for (int i = 0; i < 3; ++i) {
+		CHECK_EQUAL (expected [i][0], chain [i].width);
+		CHECK_EQUAL (expected [i][1], chain [i].height);
+		CHECK_EQUAL (expected [i][0] * expected [i][1] * 4,
+			static_cast<int> (chain [i].data.size ()));
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TEST (SolidColorStaysSolid)
+{
+	const MipFilter filters [] = { MipFilter::Box, MipFilter::Kaiser };
+
+	for (const auto filter : filters) {
+		const auto image = CreateSolidImage (37, 21, 200, 100, 30, 255);
+		const auto chain = GenerateMipChain (image.data (), 37, 21, 37 * 4,
+			AlphaMode::Straight, filter);
+
+		for (const auto& level : chain) {
+			for (std::size_t i = 0; i < level.data.size (); i += 4) {
+				CHECK_EQUAL (200, level.data [i + 0]);
+				CHECK_EQUAL (100, level.data [i + 1]);
+				CHECK_EQUAL (30, level.data [i + 2]);
+				CHECK_EQUAL (255, level.data [i + 3]);
+			}
+		}
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+A 3x1 image shrinks to one texel, which must average all three inputs. A
+plain 2x2 box would only look at the first two.
+*/
+TEST (OddSizeKeepsLastColumn)
+{
+	std::vector<std::uint8_t> image = CreateSolidImage (3, 1, 0, 0, 0, 255);
+	image [8] = 255;
+
+	const auto chain = GenerateMipChain (image.data (), 3, 1, 3 * 4,
+		AlphaMode::Premultiplied);
+	CHECK_EQUAL (1, static_cast<int> (chain.size ()));
+
+	// linear 1/3 is sRGB 155.9
+	CHECK_NEAR (1.0 / 3, SrgbToLinear (chain [0].data [0]), 0.005);
+
+	// Same vertically, with the last row
+	image = CreateSolidImage (1, 5, 0, 0, 0, 255);
+	image [16 + 1] = 255;
+
+	const auto column = GenerateMipChain (image.data (), 1, 5, 4,
+		AlphaMode::Premultiplied);
+	CHECK_EQUAL (2, static_cast<int> (column.size ()));
+	CHECK_EQUAL (2, column [0].height);
+	// Output texel 1 covers input rows 2.5 to 5
+	CHECK_EQUAL (0, column [0].data [1]);
+	CHECK_NEAR (0.4, SrgbToLinear (column [0].data [4 + 1]), 0.005);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+The box filter covers every input texel with a total weight of exactly one
+output texel, so the mean intensity is preserved for any size.
+*/
+TEST (BoxPreservesMean)
+{
+	const int sizes [][2] = { { 64, 64 }, { 63, 17 }, { 9, 7 }, { 5, 128 } };
+
+	for (const auto& size : sizes) {
+		const auto image = CreateRandomImage (size [0], size [1], size [0] * 1000 + size [1]);
+		const auto chain = GenerateMipChain (image.data (), size [0], size [1],
+			size [0] * 4, AlphaMode::Premultiplied);
+
+		for (int channel = 0; channel < 3; ++channel) {
+			CHECK_NEAR (GetMean (image, channel), GetMean (chain [0].data, channel), 0.004);
+		}
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TEST (StraightAlphaDoesNotBleed)
+{
+	// Opaque red next to transparent green
+	std::vector<std::uint8_t> image = {
+		255, 0, 0, 255,
+		0, 255, 0, 0
+	};
+
+	const auto chain = GenerateMipChain (image.data (), 2, 1, 8,
+		AlphaMode::Straight);
+
+	CHECK_EQUAL (255, chain [0].data [0]);
+	CHECK_EQUAL (0, chain [0].data [1]);
+	CHECK_EQUAL (0, chain [0].data [2]);
+	CHECK_NEAR (128, chain [0].data [3], 1);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Downsample a horizontal sine wave and return the contrast of level 1, in
+sRGB values.
+*/
+int GetSineContrast (const double period, const MipFilter filter)
+{
+	const int width = 240;
+	const int height = 4;
+	std::vector<std::uint8_t> image (width * height * 4);
+
+	for (int y = 0; y < height; ++y) {
+		for (int x = 0; x < width; ++x) {
+			const double v = 0.5 + 0.5 * std::sin (2 * 3.14159265358979 * (x + 0.5) / period);
+			const auto c = static_cast<std::uint8_t> (255 * std::pow (v, 1 / 2.2) + 0.5);
+
+			auto pixel = image.data () + (y * width + x) * 4;
+			pixel [0] = pixel [1] = pixel [2] = c;
+			pixel [3] = 255;
+		}
+	}
+
+	const auto chain = GenerateMipChain (image.data (), width, height, width * 4,
+		AlphaMode::Premultiplied, filter);
+
+	int minimum = 255, maximum = 0;
+	// Skip the borders, which are clamped
+	for (int x = 8; x < chain [0].width - 8; ++x) {
+		minimum = (std::min) (minimum, static_cast<int> (chain [0].data [x * 4]));
+		maximum = (std::max) (maximum, static_cast<int> (chain [0].data [x * 4]));
+	}
+
+	return maximum - minimum;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Kaiser keeps more of the detail which level 1 can still represent, and
+suppresses more of the detail at its Nyquist limit, which would alias.
+*/
+TEST (KaiserIsSharperThanBox)
+{
+	CHECK (GetSineContrast (10, MipFilter::Kaiser) > GetSineContrast (10, MipFilter::Box));
+	CHECK (GetSineContrast (4, MipFilter::Kaiser) < GetSineContrast (4, MipFilter::Box));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TEST (AVXMatchesSSE2)
+{
+	if (GetMaximumSimdLevel () != SimdLevel::AVX2) {
+		return;
+	}
+
+	const MipFilter filters [] = { MipFilter::Box, MipFilter::Kaiser };
+	const int sizes [][2] = { { 256, 256 }, { 97, 31 }, { 3, 200 } };
+
+	for (const auto filter : filters) {
+		for (const auto& size : sizes) {
+			const auto image = CreateRandomImage (size [0], size [1], 7);
+
+			SetPixelConversionSimdLevel (SimdLevel::SSSE3);
+			const auto sse = GenerateMipChain (image.data (), size [0], size [1],
+				size [0] * 4, AlphaMode::Straight, filter);
+
+			SetPixelConversionSimdLevel (SimdLevel::AVX2);
+			const auto avx = GenerateMipChain (image.data (), size [0], size [1],
+				size [0] * 4, AlphaMode::Straight, filter);
+
+			CHECK_EQUAL (sse.size (), avx.size ());
+			for (std::size_t i = 0; i < sse.size (); ++i) {
+				CHECK (sse [i].data == avx [i].data);
+			}
+		}
+	}
+
+	SetPixelConversionSimdLevel (GetMaximumSimdLevel ());
+}
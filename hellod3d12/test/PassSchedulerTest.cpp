@@ -0,0 +1,497 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+
+
+#include "Test.h"
+
+#include "PassScheduler.h"
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+using namespace AMD;
+
+namespace {
+const D3D12_RESOURCE_STATES COMMON = D3D12_RESOURCE_STATE_COMMON;
+const D3D12_RESOURCE_STATES RENDER_TARGET = D3D12_RESOURCE_STATE_RENDER_TARGET;
+const D3D12_RESOURCE_STATES UNORDERED_ACCESS = D3D12_RESOURCE_STATE_UNORDERED_ACCESS;
+const D3D12_RESOURCE_STATES DEPTH_WRITE = D3D12_RESOURCE_STATE_DEPTH_WRITE;
+const D3D12_RESOURCE_STATES DEPTH_READ = D3D12_RESOURCE_STATE_DEPTH_READ;
+const D3D12_RESOURCE_STATES NON_PIXEL_SHADER_RESOURCE = D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE;
+const D3D12_RESOURCE_STATES PIXEL_SHADER_RESOURCE = D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE;
+const D3D12_RESOURCE_STATES VERTEX_AND_CONSTANT_BUFFER = D3D12_RESOURCE_STATE_VERTEX_AND_CONSTANT_BUFFER;
+const D3D12_RESOURCE_STATES COPY_DEST = D3D12_RESOURCE_STATE_COPY_DEST;
+const D3D12_RESOURCE_STATES COPY_SOURCE = D3D12_RESOURCE_STATE_COPY_SOURCE;
+
+const int READ_ONLY_STATES = D3D12_RESOURCE_STATE_VERTEX_AND_CONSTANT_BUFFER
+	| D3D12_RESOURCE_STATE_INDEX_BUFFER
+	| D3D12_RESOURCE_STATE_DEPTH_READ
+	| D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE
+	| D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE
+	| D3D12_RESOURCE_STATE_INDIRECT_ARGUMENT
+	| D3D12_RESOURCE_STATE_COPY_SOURCE;
+
+///////////////////////////////////////////////////////////////////////////////
+ScheduledPassDesc Pass (const QueueType queueType,
+	const std::vector<PassResourceUse>& uses)
+{
+	ScheduledPassDesc desc;
+	desc.queueType = queueType;
+	desc.uses = uses;
+	return desc;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+bool IsReadOnly (const D3D12_RESOURCE_STATES state)
+{
+	return state != COMMON && (state & ~READ_ONLY_STATES) == 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Resources pass reads or writes while it runs, including its transitions,
+which count as writes.
+*/
+std::vector<int> GetAccesses (const ScheduledPass& pass,
+	const std::vector<ScheduledPassDesc>& descs, const int resourceCount,
+	std::vector<bool>& writes)
+{
+	std::vector<int> accesses;
+	writes.assign (resourceCount, false);
+
+	auto add = [&] (const int resource, const bool write) {
+		accesses.push_back (resource);
+		writes [resource] = writes [resource] || write;
+	};
+
+	for (const auto& transition : pass.beginTransitions) {
+		add (transition.resource, true);
+	}
+
+	for (const auto& transition : pass.endTransitions) {
+		add (transition.resource, true);
+	}
+
+	if (pass.pass != -1) {
+		for (const auto& use : descs [pass.pass].uses) {
+			add (use.resource, !IsReadOnly (use.state));
+		}
+	}
+
+	return accesses;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Run schedule on a simulated GPU. Each queue runs its passes in order, one at
+a time, and a pass starts once its dependencies have finished. At every
+step, one of the queues which can start a pass or finish its running pass
+is picked at random, so any overlap the GPU could produce may come up.
+
+Checks that transitions start from the state the resource is in and are
+supported by their queue, that every pass finds its resources in the state
+it needs, that no two passes running at the same time access a resource
+if either writes it, and that the final states match.
+*/
+void Simulate (const std::vector<ScheduledPassDesc>& descs,
+	const std::vector<QueueType>& queueTypes,
+	const std::vector<D3D12_RESOURCE_STATES>& initialStates,
+	const PassSchedule& schedule, std::mt19937& random)
+{
+	const auto queueCount = static_cast<int> (queueTypes.size ());
+	const auto resourceCount = static_cast<int> (initialStates.size ());
+	const auto& passes = schedule.passes;
+
+	std::vector<std::vector<int>> queues (queueCount);
+	for (int i = 0; i < static_cast<int> (passes.size ()); ++i) {
+		for (const auto dependency : passes [i].dependencies) {
+			CHECK (dependency < i);
+			CHECK (passes [dependency].queue != passes [i].queue);
+		}
+
+		queues [passes [i].queue].push_back (i);
+	}
+
+	auto states = initialStates;
+
+	auto transition = [&] (const ResourceTransition& transition, const QueueType queueType) {
+		CHECK_EQUAL (transition.before, states [transition.resource]);
+		CHECK (IsStateSupported (queueType, transition.before));
+		CHECK (IsStateSupported (queueType, transition.after));
+		states [transition.resource] = transition.after;
+	};
+
+	std::vector<std::size_t> next (queueCount, 0);
+	std::vector<int> running (queueCount, -1);
+	std::vector<bool> finished (passes.size (), false);
+
+	for (;;) {
+		// Queue q finishes its pass, or queueCount + q starts the next one
+		std::vector<int> steps;
+		for (int queue = 0; queue < queueCount; ++queue) {
+			if (running [queue] != -1) {
+				steps.push_back (queue);
+				continue;
+			}
+
+			if (next [queue] == queues [queue].size ()) {
+				continue;
+			}
+
+			bool canStart = true;
+			for (const auto dependency : passes [queues [queue][next [queue]]].dependencies) {
+				canStart = canStart && finished [dependency];
+			}
+
+			if (canStart) {
+				steps.push_back (queueCount + queue);
+			}
+		}
+
+		if (steps.empty ()) {
+			break;
+		}
+
+		const auto step = steps [random () % steps.size ()];
+		const auto queue = step % queueCount;
+		const auto queueType = queueTypes [queue];
+
+		if (step < queueCount) {
+			const auto& pass = passes [running [queue]];
+			for (const auto& end : pass.endTransitions) {
+				transition (end, queueType);
+			}
+
+			finished [running [queue]] = true;
+			running [queue] = -1;
+			continue;
+		}
+
+		const auto index = queues [queue][next [queue]++];
+		const auto& pass = passes [index];
+
+		std::vector<bool> writes;
+		const auto accesses = GetAccesses (pass, descs, resourceCount, writes);
+
+		for (int other = 0; other < queueCount; ++other) {
+			if (running [other] == -1) {
+				continue;
+			}
+
+			std::vector<bool> otherWrites;
+			for (const auto resource : GetAccesses (passes [running [other]], descs,
+				resourceCount, otherWrites)) {
+				for (const auto access : accesses) {
+					CHECK (access != resource || (!writes [resource] && !otherWrites [resource]));
+				}
+			}
+		}
+
+		for (const auto& begin : pass.beginTransitions) {
+			transition (begin, queueType);
+		}
+
+		if (pass.pass != -1) {
+			for (const auto& use : descs [pass.pass].uses) {
+				CHECK (IsStateSupported (queueType, use.state));
+
+				const auto state = states [use.resource];
+				CHECK (state == use.state ||
+					(IsReadOnly (state) && IsReadOnly (use.state) && (state & use.state) == use.state));
+			}
+		}
+
+		running [queue] = index;
+	}
+
+	for (std::size_t i = 0; i < passes.size (); ++i) {
+		CHECK (finished [i]);
+	}
+
+	for (int resource = 0; resource < resourceCount; ++resource) {
+		CHECK_EQUAL (schedule.finalStates [resource], states [resource]);
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void SimulateMany (const std::vector<ScheduledPassDesc>& descs,
+	const std::vector<QueueType>& queueTypes,
+	const std::vector<D3D12_RESOURCE_STATES>& initialStates,
+	const PassSchedule& schedule)
+{
+	std::mt19937 random (1);
+	for (int i = 0; i < 100; ++i) {
+		Simulate (descs, queueTypes, initialStates, schedule, random);
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Depth pre-pass, async particle simulation, shadows, the main pass and an
+async post-process reading the color buffer.
+*/
+std::vector<ScheduledPassDesc> CreateTypicalFrame ()
+{
+	// 0 particles, 1 depth, 2 shadow map, 3 color, 4 post-process output
+	return {
+		Pass (QueueType::Graphics, { { 1, DEPTH_WRITE } }),
+		Pass (QueueType::Compute, { { 0, UNORDERED_ACCESS } }),
+		Pass (QueueType::Graphics, { { 2, DEPTH_WRITE } }),
+		Pass (QueueType::Graphics, { { 0, VERTEX_AND_CONSTANT_BUFFER },
+			{ 3, RENDER_TARGET }, { 2, PIXEL_SHADER_RESOURCE }, { 1, DEPTH_READ } }),
+		Pass (QueueType::Compute, { { 3, NON_PIXEL_SHADER_RESOURCE },
+			{ 4, UNORDERED_ACCESS } })
+	};
+}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TEST (TypicalFrameOverlapsCompute)
+{
+	const auto passes = CreateTypicalFrame ();
+	const std::vector<QueueType> queueTypes = { QueueType::Graphics, QueueType::Compute };
+	const std::vector<D3D12_RESOURCE_STATES> initialStates (5, COMMON);
+
+	const auto schedule = SchedulePasses (passes, queueTypes, initialStates);
+
+	CHECK_EQUAL (5, schedule.passes.size ());
+
+	// Particles overlap depth and shadows
+	CHECK_EQUAL (1, schedule.passes [1].queue);
+	CHECK (schedule.passes [1].dependencies.empty ());
+
+	// The main pass waits for the particles
+	CHECK (schedule.passes [3].dependencies == std::vector<int> { 1 });
+
+	// The compute queue can't transition from RENDER_TARGET, so the main
+	// pass does it at its end
+	CHECK_EQUAL (1, schedule.passes [3].endTransitions.size ());
+	CHECK_EQUAL (RENDER_TARGET, schedule.passes [3].endTransitions [0].before);
+	CHECK_EQUAL (NON_PIXEL_SHADER_RESOURCE, schedule.passes [3].endTransitions [0].after);
+	CHECK (schedule.passes [4].dependencies == std::vector<int> { 3 });
+	CHECK (schedule.passes [4].beginTransitions.size () == 1);
+	CHECK_EQUAL (4, schedule.passes [4].beginTransitions [0].resource);
+
+	SimulateMany (passes, queueTypes, initialStates, schedule);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TEST (WithoutComputeQueueEverythingRunsOnGraphics)
+{
+	const auto passes = CreateTypicalFrame ();
+	const std::vector<QueueType> queueTypes = { QueueType::Graphics };
+	const std::vector<D3D12_RESOURCE_STATES> initialStates (5, COMMON);
+
+	const auto schedule = SchedulePasses (passes, queueTypes, initialStates);
+
+	CHECK_EQUAL (5, schedule.passes.size ());
+	for (const auto& pass : schedule.passes) {
+		CHECK_EQUAL (0, pass.queue);
+		CHECK (pass.dependencies.empty ());
+		CHECK (pass.endTransitions.empty ());
+	}
+
+	// The post-process transitions the color buffer itself
+	CHECK_EQUAL (2, schedule.passes [4].beginTransitions.size ());
+
+	SimulateMany (passes, queueTypes, initialStates, schedule);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TEST (ComputeQueueRejectsGraphicsStates)
+{
+	const std::vector<QueueType> queueTypes = { QueueType::Graphics, QueueType::Compute };
+
+	CHECK_THROWS (SchedulePasses ({ Pass (QueueType::Compute, { { 0, RENDER_TARGET } }) },
+		queueTypes, { COMMON }));
+	CHECK_THROWS (SchedulePasses ({ Pass (QueueType::Compute, { { 0, PIXEL_SHADER_RESOURCE } }) },
+		queueTypes, { COMMON }));
+	CHECK_THROWS (SchedulePasses ({ Pass (QueueType::Compute, { { 0, DEPTH_READ } }) },
+		queueTypes, { COMMON }));
+
+	// Fine when the pass ends up on the graphics queue
+	SchedulePasses ({ Pass (QueueType::Compute, { { 0, RENDER_TARGET } }) },
+		{ QueueType::Graphics }, { COMMON });
+
+	CHECK_THROWS (SchedulePasses ({}, { QueueType::Compute }, {}));
+	CHECK_THROWS (SchedulePasses ({ Pass (QueueType::Graphics, { { 1, COPY_DEST } }) },
+		queueTypes, { COMMON }));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+The resource starts out as a render target, and no earlier pass can move it
+to a state the compute queue supports, so an extra pass on the graphics
+queue has to.
+*/
+TEST (ExtraPassTransitionsForCompute)
+{
+	const std::vector<ScheduledPassDesc> passes = {
+		Pass (QueueType::Compute, { { 0, NON_PIXEL_SHADER_RESOURCE }, { 1, UNORDERED_ACCESS } })
+	};
+	const std::vector<QueueType> queueTypes = { QueueType::Graphics, QueueType::Compute };
+	const std::vector<D3D12_RESOURCE_STATES> initialStates = { RENDER_TARGET, COMMON };
+
+	const auto schedule = SchedulePasses (passes, queueTypes, initialStates);
+
+	CHECK_EQUAL (2, schedule.passes.size ());
+
+	const auto& extra = schedule.passes [0];
+	CHECK_EQUAL (-1, extra.pass);
+	CHECK_EQUAL (0, extra.queue);
+	CHECK_EQUAL (1, extra.beginTransitions.size ());
+	CHECK_EQUAL (0, extra.beginTransitions [0].resource);
+	CHECK_EQUAL (RENDER_TARGET, extra.beginTransitions [0].before);
+	CHECK_EQUAL (NON_PIXEL_SHADER_RESOURCE, extra.beginTransitions [0].after);
+
+	// The compute queue does the transition it supports itself
+	const auto& pass = schedule.passes [1];
+	CHECK_EQUAL (1, pass.queue);
+	CHECK (pass.dependencies == std::vector<int> { 0 });
+	CHECK_EQUAL (1, pass.beginTransitions.size ());
+	CHECK_EQUAL (1, pass.beginTransitions [0].resource);
+
+	SimulateMany (passes, queueTypes, initialStates, schedule);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Two graphics queues read the render target, so neither can transition it at
+its end for the compute pass and it takes an extra pass which waits for
+both.
+*/
+TEST (ExtraPassWaitsForAllReaders)
+{
+	const std::vector<ScheduledPassDesc> passes = {
+		Pass (QueueType::Graphics, { { 0, RENDER_TARGET } }),
+		Pass (QueueType::Graphics, { { 0, PIXEL_SHADER_RESOURCE } }),
+		[] () {
+			auto pass = Pass (QueueType::Graphics, { { 0, PIXEL_SHADER_RESOURCE } });
+			pass.queueIndex = 1;
+			return pass;
+		} (),
+		Pass (QueueType::Compute, { { 0, NON_PIXEL_SHADER_RESOURCE } })
+	};
+	const std::vector<QueueType> queueTypes = {
+		QueueType::Graphics, QueueType::Graphics, QueueType::Compute
+	};
+	const std::vector<D3D12_RESOURCE_STATES> initialStates = { COMMON };
+
+	const auto schedule = SchedulePasses (passes, queueTypes, initialStates);
+
+	CHECK_EQUAL (5, schedule.passes.size ());
+	CHECK_EQUAL (-1, schedule.passes [3].pass);
+	CHECK_EQUAL (0, schedule.passes [3].queue);
+	CHECK (schedule.passes [3].dependencies == std::vector<int> { 2 });
+	CHECK (std::find (schedule.passes [4].dependencies.begin (),
+		schedule.passes [4].dependencies.end (), 3) != schedule.passes [4].dependencies.end ());
+
+	SimulateMany (passes, queueTypes, initialStates, schedule);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TEST (UnorderedAccessOnOneQueueNeedsBarrier)
+{
+	const std::vector<ScheduledPassDesc> passes = {
+		Pass (QueueType::Compute, { { 0, UNORDERED_ACCESS } }),
+		Pass (QueueType::Compute, { { 0, UNORDERED_ACCESS } })
+	};
+	const std::vector<QueueType> queueTypes = { QueueType::Graphics, QueueType::Compute };
+
+	const auto schedule = SchedulePasses (passes, queueTypes, { UNORDERED_ACCESS });
+
+	CHECK (schedule.passes [0].beginTransitions.empty ());
+	CHECK_EQUAL (1, schedule.passes [1].beginTransitions.size ());
+	CHECK_EQUAL (UNORDERED_ACCESS, schedule.passes [1].beginTransitions [0].before);
+	CHECK_EQUAL (UNORDERED_ACCESS, schedule.passes [1].beginTransitions [0].after);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Random passes on random queue setups, each schedule run on many timelines.
+Resources start in any state, including graphics-only ones, so compute
+passes regularly need end transitions or extra passes.
+*/
+TEST (RandomSchedulesRunOnAnyTimeline)
+{
+	const D3D12_RESOURCE_STATES graphicsStates [] = {
+		RENDER_TARGET, UNORDERED_ACCESS, NON_PIXEL_SHADER_RESOURCE, PIXEL_SHADER_RESOURCE,
+		VERTEX_AND_CONSTANT_BUFFER, DEPTH_WRITE, DEPTH_READ, COPY_DEST, COPY_SOURCE,
+		static_cast<D3D12_RESOURCE_STATES> (NON_PIXEL_SHADER_RESOURCE | PIXEL_SHADER_RESOURCE)
+	};
+	const D3D12_RESOURCE_STATES computeStates [] = {
+		UNORDERED_ACCESS, NON_PIXEL_SHADER_RESOURCE, VERTEX_AND_CONSTANT_BUFFER,
+		COPY_DEST, COPY_SOURCE
+	};
+
+	std::mt19937 random (7);
+	int extraPassCount = 0;
+	int endTransitionCount = 0;
+
+	for (int round = 0; round < 2000; ++round) {
+		std::vector<QueueType> queueTypes = { QueueType::Graphics };
+		for (int i = random () % 4; i > 0; --i) {
+			queueTypes.push_back (random () % 3 ? QueueType::Compute : QueueType::Graphics);
+		}
+
+		const int resourceCount = 1 + random () % 6;
+		std::vector<D3D12_RESOURCE_STATES> initialStates (resourceCount);
+		for (auto& state : initialStates) {
+			state = graphicsStates [random () % 10];
+		}
+
+		std::vector<ScheduledPassDesc> passes (1 + random () % 12);
+		for (auto& pass : passes) {
+			const bool compute = random () % 2 == 0;
+			pass.queueType = compute ? QueueType::Compute : QueueType::Graphics;
+			pass.queueIndex = random () % 2;
+
+			// Each resource at most once per pass
+			std::vector<bool> used (resourceCount, false);
+			for (int i = 1 + random () % 3; i > 0; --i) {
+				const int resource = random () % resourceCount;
+				if (!used [resource]) {
+					used [resource] = true;
+					pass.uses.push_back ({ resource,
+						compute ? computeStates [random () % 5] : graphicsStates [random () % 10] });
+				}
+			}
+		}
+
+		const auto schedule = SchedulePasses (passes, queueTypes, initialStates);
+
+		for (const auto& pass : schedule.passes) {
+			extraPassCount += pass.pass == -1;
+			endTransitionCount += static_cast<int> (pass.endTransitions.size ());
+		}
+
+		for (int timeline = 0; timeline < 10; ++timeline) {
+			Simulate (passes, queueTypes, initialStates, schedule, random);
+		}
+	}
+
+	// Both ways of handing off a transition came up
+	CHECK (extraPassCount > 0);
+	CHECK (endTransitionCount > 0);
+}
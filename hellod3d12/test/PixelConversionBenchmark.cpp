@@ -0,0 +1,107 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+
+#include "Benchmark.h"
+
+#include "PixelConversion.h"
+#include "TestImage.h"
+
+#include <string>
+#include <vector>
+
+using namespace AMD;
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Every conversion at every SIMD level the machine supports, on a 2048x2048
+image. Throughput is measured in input bytes.
+*/
+int main ()
+{
+	const std::size_t pixelCount = 2048 * 2048;
+
+	const auto rgba = Test::CreateRandomBytes (pixelCount * 4);
+	const auto rgb = Test::CreateRandomBytes (pixelCount * 3);
+	std::vector<float> linear (pixelCount * 4);
+	std::vector<std::uint16_t> halfs (pixelCount * 4);
+	std::vector<std::uint8_t> output (pixelCount * 4);
+	std::vector<std::uint8_t> pixels;
+
+	ConvertSrgbToLinear (rgba.data (), linear.data (), pixelCount);
+	ConvertUnormToHalf (rgba.data (), halfs.data (), pixelCount * 4);
+
+	const struct
+	{
+		const char* name;
+		SimdLevel level;
+	} levels [] = {
+		{ "scalar", SimdLevel::Scalar },
+		{ "SSSE3", SimdLevel::SSSE3 },
+		{ "AVX2", SimdLevel::AVX2 }
+	};
+
+	for (const auto& level : levels) {
+		if (level.level > GetMaximumSimdLevel ()) {
+			continue;
+		}
+
+		SetPixelConversionSimdLevel (level.level);
+		const std::string suffix = std::string (" (") + level.name + ")";
+
+		Test::Report (("RGB to RGBA" + suffix).c_str (), Test::Measure ([&] () {
+			ConvertRgbToRgba (rgb.data (), output.data (), pixelCount);
+		}), rgb.size ());
+
+		Test::Report (("sRGB to linear" + suffix).c_str (), Test::Measure ([&] () {
+			ConvertSrgbToLinear (rgba.data (), linear.data (), pixelCount);
+		}), rgba.size ());
+
+		Test::Report (("Linear to sRGB" + suffix).c_str (), Test::Measure ([&] () {
+			ConvertLinearToSrgb (linear.data (), output.data (), pixelCount);
+		}), linear.size () * sizeof (float));
+
+		Test::Report (("Premultiply" + suffix).c_str (), Test::Measure ([&] () {
+			pixels = rgba;
+			PremultiplyAlpha (pixels.data (), pixelCount);
+		}), rgba.size ());
+
+		Test::Report (("Premultiply sRGB" + suffix).c_str (), Test::Measure ([&] () {
+			pixels = rgba;
+			PremultiplyAlphaSrgb (pixels.data (), pixelCount);
+		}), rgba.size ());
+
+		Test::Report (("UNORM to half" + suffix).c_str (), Test::Measure ([&] () {
+			ConvertUnormToHalf (rgba.data (), halfs.data (), pixelCount * 4);
+		}), rgba.size ());
+
+		Test::Report (("Half to UNORM" + suffix).c_str (), Test::Measure ([&] () {
+			ConvertHalfToUnorm (halfs.data (), output.data (), pixelCount * 4);
+		}), halfs.size () * sizeof (std::uint16_t));
+
+		Test::Report (("Extract RG" + suffix).c_str (), Test::Measure ([&] () {
+			ExtractChannels (rgba.data (), output.data (), pixelCount, 2);
+		}), rgba.size ());
+	}
+
+	return 0;
+}
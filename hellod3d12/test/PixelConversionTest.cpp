@@ -0,0 +1,299 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+
+#include "Test.h"
+
+#include "PixelConversion.h"
+#include "TestImage.h"
+
+#include <cmath>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <vector>
+
+using namespace AMD;
+
+namespace {
+const SimdLevel SIMD_LEVELS [] = { SimdLevel::Scalar, SimdLevel::SSSE3, SimdLevel::AVX2 };
+
+// Around the vector widths, so both the main loops and the tails get hit
+const std::size_t PIXEL_COUNTS [] = { 0, 1, 3, 4, 5, 7, 8, 9, 15, 16, 17, 31, 33, 100, 1001 };
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Restores the default SIMD level when a test is done, even if it fails.
+*/
+class ScopedSimdLevel
+{
+public:
+	explicit ScopedSimdLevel (const SimdLevel level)
+	{
+		SetPixelConversionSimdLevel (level);
+	}
+
+	~ScopedSimdLevel ()
+	{
+		SetPixelConversionSimdLevel (GetMaximumSimdLevel ());
+	}
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Run convert at every SIMD level the machine supports and check that the
+output bytes match the scalar reference.
+*/
+void CheckAllLevelsMatch (const std::function<std::vector<std::uint8_t> ()>& convert)
+{
+	std::vector<std::uint8_t> reference;
+	{
+		ScopedSimdLevel scalar (SimdLevel::Scalar);
+		reference = convert ();
+	}
+
+	for (const auto level : SIMD_LEVELS) {
+		if (level > GetMaximumSimdLevel ()) {
+			continue;
+		}
+
+		ScopedSimdLevel simd (level);
+		CHECK (convert () == reference);
+	}
+}
+
+template <typename T>
+std::vector<std::uint8_t> ToBytes (const std::vector<T>& values)
+{
+	std::vector<std::uint8_t> result (values.size () * sizeof (T));
+	if (!values.empty ()) {
+		std::memcpy (result.data (), values.data (), result.size ());
+	}
+	return result;
+}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TEST (RgbToRgbaMatchesScalar)
+{
+	for (const auto count : PIXEL_COUNTS) {
+		const auto input = Test::CreateRandomBytes (count * 3);
+
+		CheckAllLevelsMatch ([&] () {
+			std::vector<std::uint8_t> output (count * 4);
+			ConvertRgbToRgba (input.data (), output.data (), count);
+			return output;
+		});
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TEST (SrgbConversionsMatchScalar)
+{
+	for (const auto count : PIXEL_COUNTS) {
+		const auto input = Test::CreateRandomBytes (count * 4);
+
+		// Include values outside of 0..1, which must be clamped
+		std::vector<float> linear (count * 4);
+		for (std::size_t i = 0; i < linear.size (); ++i) {
+			linear [i] = (static_cast<int> (input [i]) - 10) / 230.0f;
+		}
+
+		CheckAllLevelsMatch ([&] () {
+			std::vector<float> output (count * 4);
+			ConvertSrgbToLinear (input.data (), output.data (), count);
+			return ToBytes (output);
+		});
+
+		CheckAllLevelsMatch ([&] () {
+			std::vector<std::uint8_t> output (count * 4);
+			ConvertLinearToSrgb (linear.data (), output.data (), count);
+			return output;
+		});
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+NaN must become zero at every level, infinities clamp like any other value
+outside of 0..1.
+*/
+TEST (LinearToSrgbClampsNaN)
+{
+	const float specials [] = {
+		std::numeric_limits<float>::quiet_NaN (),
+		-std::numeric_limits<float>::quiet_NaN (),
+		std::numeric_limits<float>::infinity (),
+		-std::numeric_limits<float>::infinity (),
+		0.5f
+	};
+
+	for (const auto count : PIXEL_COUNTS) {
+		std::vector<float> linear (count * 4);
+		for (std::size_t i = 0; i < linear.size (); ++i) {
+			linear [i] = specials [i % 5];
+		}
+
+		CheckAllLevelsMatch ([&] () {
+			std::vector<std::uint8_t> output (count * 4);
+			ConvertLinearToSrgb (linear.data (), output.data (), count);
+
+			for (std::size_t i = 0; i < output.size (); ++i) {
+				if (std::isnan (linear [i])) {
+					CHECK_EQUAL (0, output [i]);
+				}
+			}
+
+			return output;
+		});
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TEST (SrgbRoundTripIsExact)
+{
+	std::vector<std::uint8_t> input (256 * 4);
+	for (std::size_t i = 0; i < input.size (); ++i) {
+		input [i] = static_cast<std::uint8_t> (i / 4);
+	}
+
+	for (const auto level : SIMD_LEVELS) {
+		ScopedSimdLevel simd (level);
+
+		std::vector<float> linear (input.size ());
+		std::vector<std::uint8_t> output (input.size ());
+		ConvertSrgbToLinear (input.data (), linear.data (), 256);
+		ConvertLinearToSrgb (linear.data (), output.data (), 256);
+
+		CHECK (output == input);
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TEST (PremultiplyMatchesScalar)
+{
+	for (const auto count : PIXEL_COUNTS) {
+		const auto input = Test::CreateRandomBytes (count * 4);
+
+		CheckAllLevelsMatch ([&] () {
+			auto pixels = input;
+			PremultiplyAlpha (pixels.data (), count);
+			return pixels;
+		});
+
+		CheckAllLevelsMatch ([&] () {
+			auto pixels = input;
+			PremultiplyAlphaSrgb (pixels.data (), count);
+			return pixels;
+		});
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TEST (PremultiplyRoundsCorrectly)
+{
+	// Every color/alpha pair
+	std::vector<std::uint8_t> input (256 * 256 * 4);
+	for (int a = 0; a < 256; ++a) {
+		for (int c = 0; c < 256; ++c) {
+			std::uint8_t* pixel = input.data () + (a * 256 + c) * 4;
+			pixel [0] = pixel [1] = pixel [2] = static_cast<std::uint8_t> (c);
+			pixel [3] = static_cast<std::uint8_t> (a);
+		}
+	}
+
+	for (const auto level : SIMD_LEVELS) {
+		ScopedSimdLevel simd (level);
+
+		auto pixels = input;
+		PremultiplyAlpha (pixels.data (), 256 * 256);
+
+		for (std::size_t i = 0; i < pixels.size (); ++i) {
+			const int alpha = input [i | 3];
+			const int expected = (i % 4 == 3) ? alpha :
+				static_cast<int> (std::lround (input [i] * alpha / 255.0));
+			CHECK_EQUAL (expected, pixels [i]);
+		}
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TEST (HalfConversionsMatchScalar)
+{
+	for (const auto count : PIXEL_COUNTS) {
+		const auto input = Test::CreateRandomBytes (count * 4);
+
+		CheckAllLevelsMatch ([&] () {
+			std::vector<std::uint16_t> output (count * 4);
+			ConvertUnormToHalf (input.data (), output.data (), count * 4);
+			return ToBytes (output);
+		});
+	}
+
+	// Every half value, including denormals, infinities and NaNs
+	std::vector<std::uint16_t> halfs (65536);
+	for (std::size_t i = 0; i < halfs.size (); ++i) {
+		halfs [i] = static_cast<std::uint16_t> (i);
+	}
+
+	CheckAllLevelsMatch ([&] () {
+		std::vector<std::uint8_t> output (halfs.size ());
+		ConvertHalfToUnorm (halfs.data (), output.data (), halfs.size ());
+		return output;
+	});
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TEST (HalfRoundTripIsExact)
+{
+	std::vector<std::uint8_t> input (256);
+	for (std::size_t i = 0; i < input.size (); ++i) {
+		input [i] = static_cast<std::uint8_t> (i);
+	}
+
+	for (const auto level : SIMD_LEVELS) {
+		ScopedSimdLevel simd (level);
+
+		std::vector<std::uint16_t> halfs (input.size ());
+		std::vector<std::uint8_t> output (input.size ());
+		ConvertUnormToHalf (input.data (), halfs.data (), input.size ());
+		ConvertHalfToUnorm (halfs.data (), output.data (), input.size ());
+
+		CHECK (output == input);
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TEST (ExtractChannelsMatchesScalar)
+{
+	for (const auto count : PIXEL_COUNTS) {
+		const auto input = Test::CreateRandomBytes (count * 4);
+
+		for (int channelCount = 1; channelCount <= 2; ++channelCount) {
+			CheckAllLevelsMatch ([&] () {
+				std::vector<std::uint8_t> output (count * channelCount);
+				ExtractChannels (input.data (), output.data (), count, channelCount);
+				return output;
+			});
+		}
+	}
+}
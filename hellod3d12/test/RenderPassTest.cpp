@@ -0,0 +1,453 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+
+
+#include "Test.h"
+
+#include "FakeD3D12.h"
+#include "RenderPass.h"
+
+#include <functional>
+#include <vector>
+
+using namespace AMD;
+
+namespace {
+typedef Test::FakeRenderPassCommandList::Call Call;
+typedef Test::FakeRenderPassCommandList::CallType CallType;
+
+const RenderPassLoadOp LOAD_OPS [] = {
+	RenderPassLoadOp::Load, RenderPassLoadOp::Clear, RenderPassLoadOp::Discard
+};
+
+const RenderPassStoreOp STORE_OPS [] = {
+	RenderPassStoreOp::Store, RenderPassStoreOp::Discard
+};
+
+ID3D12Resource renderTargetResources [2];
+ID3D12Resource depthStencilResource;
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Call function with every combination of up to two render targets and a
+depth stencil, either none, depth only or with stencil, and all their load
+and store operations. Depth only formats get all stencil operations too, as
+they must be ignored.
+*/
+void ForEachDesc (const std::function<void (const RenderPassDesc&)>& function)
+{
+	const DXGI_FORMAT depthFormats [] = {
+		DXGI_FORMAT_UNKNOWN, DXGI_FORMAT_D32_FLOAT, DXGI_FORMAT_D24_UNORM_S8_UINT
+	};
+
+	for (int renderTargetCount = 0; renderTargetCount <= 2; ++renderTargetCount) {
+		int renderTargetCombinations = 1;
+		for (int i = 0; i < renderTargetCount; ++i) {
+			renderTargetCombinations *= 6;
+		}
+
+		for (int combination = 0; combination < renderTargetCombinations; ++combination) {
+			RenderPassDesc desc;
+
+			for (int i = 0, ops = combination; i < renderTargetCount; ++i, ops /= 6) {
+				RenderPassRenderTarget renderTarget;
+				renderTarget.view.ptr = 0x100 + i;
+				renderTarget.resource = &renderTargetResources [i];
+				renderTarget.format = DXGI_FORMAT_R8G8B8A8_UNORM;
+				renderTarget.loadOp = LOAD_OPS [ops % 6 / 2];
+				renderTarget.storeOp = STORE_OPS [ops % 2];
+				renderTarget.clearColor [0] = 0.25f * i;
+				desc.renderTargets.push_back (renderTarget);
+			}
+
+			for (const auto format : depthFormats) {
+				if (format == DXGI_FORMAT_UNKNOWN) {
+					function (desc);
+					continue;
+				}
+
+				for (int ops = 0; ops < 36; ++ops) {
+					desc.hasDepthStencil = true;
+
+					auto& depthStencil = desc.depthStencil;
+					depthStencil.view.ptr = 0x200;
+					depthStencil.resource = &depthStencilResource;
+					depthStencil.format = format;
+					depthStencil.depthLoadOp = LOAD_OPS [ops / 12];
+					depthStencil.depthStoreOp = STORE_OPS [ops / 6 % 2];
+					depthStencil.stencilLoadOp = LOAD_OPS [ops / 2 % 3];
+					depthStencil.stencilStoreOp = STORE_OPS [ops % 2];
+					depthStencil.clearDepth = 0.5f;
+					depthStencil.clearStencil = 3;
+
+					function (desc);
+				}
+
+				desc.hasDepthStencil = false;
+			}
+		}
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+What the render targets and depth stencil planes contain, as far as the
+emulated pass is concerned.
+*/
+enum class Contents
+{
+	Previous,
+	Cleared,
+	Rendered,
+	Undefined
+};
+
+///////////////////////////////////////////////////////////////////////////////
+struct Planes
+{
+	std::vector<Contents> renderTargets;
+	Contents depth;
+	Contents stencil;
+	bool hasStencil;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Apply the clears and discards in calls to planes. Binding the render
+targets is only allowed if bind is set, and then required.
+*/
+void Replay (const RenderPassDesc& desc, const std::vector<Call>& calls,
+	Planes& planes, const bool bind)
+{
+	int bindCount = 0;
+
+	for (const auto& call : calls) {
+		switch (call.type) {
+		case CallType::SetRenderTargets:
+			++bindCount;
+			CHECK_EQUAL (desc.renderTargets.size (), call.renderTargetViews.size ());
+			for (std::size_t i = 0; i < desc.renderTargets.size (); ++i) {
+				CHECK_EQUAL (desc.renderTargets [i].view.ptr, call.renderTargetViews [i]);
+			}
+			CHECK_EQUAL (desc.hasDepthStencil ? desc.depthStencil.view.ptr : 0,
+				call.depthStencilView);
+			break;
+
+		case CallType::ClearRenderTarget:
+		{
+			bool found = false;
+			for (std::size_t i = 0; i < desc.renderTargets.size (); ++i) {
+				if (desc.renderTargets [i].view.ptr == call.renderTargetViews [0]) {
+					CHECK_EQUAL (desc.renderTargets [i].clearColor [0], call.clearColor [0]);
+					CHECK_EQUAL (desc.renderTargets [i].clearColor [3], call.clearColor [3]);
+					planes.renderTargets [i] = Contents::Cleared;
+					found = true;
+				}
+			}
+			CHECK (found);
+			break;
+		}
+
+		case CallType::ClearDepthStencil:
+			CHECK (desc.hasDepthStencil);
+			CHECK_EQUAL (desc.depthStencil.view.ptr, call.depthStencilView);
+			CHECK (call.clearFlags != 0);
+
+			if (call.clearFlags & D3D12_CLEAR_FLAG_DEPTH) {
+				CHECK_EQUAL (desc.depthStencil.clearDepth, call.clearDepth);
+				planes.depth = Contents::Cleared;
+			}
+
+			if (call.clearFlags & D3D12_CLEAR_FLAG_STENCIL) {
+				CHECK (planes.hasStencil);
+				CHECK_EQUAL (desc.depthStencil.clearStencil, call.clearStencil);
+				planes.stencil = Contents::Cleared;
+			}
+			break;
+
+		case CallType::Discard:
+			if (desc.hasDepthStencil && call.resource == desc.depthStencil.resource) {
+				planes.depth = Contents::Undefined;
+				planes.stencil = Contents::Undefined;
+			} else {
+				bool found = false;
+				for (std::size_t i = 0; i < desc.renderTargets.size (); ++i) {
+					if (desc.renderTargets [i].resource == call.resource) {
+						planes.renderTargets [i] = Contents::Undefined;
+						found = true;
+					}
+				}
+				CHECK (found);
+			}
+			break;
+
+		default:
+			// No native render pass calls when emulating
+			CHECK (false);
+		}
+	}
+
+	CHECK_EQUAL (bind ? 1 : 0, bindCount);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Contents AfterLoad (const RenderPassLoadOp op, const bool canDiscard)
+{
+	switch (op) {
+	case RenderPassLoadOp::Clear:
+		return Contents::Cleared;
+
+	case RenderPassLoadOp::Discard:
+		return canDiscard ? Contents::Undefined : Contents::Previous;
+
+	default:
+		return Contents::Previous;
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+D3D12_RENDER_PASS_BEGINNING_ACCESS_TYPE GetExpectedBeginning (const RenderPassLoadOp op)
+{
+	switch (op) {
+	case RenderPassLoadOp::Clear:
+		return D3D12_RENDER_PASS_BEGINNING_ACCESS_TYPE_CLEAR;
+
+	case RenderPassLoadOp::Discard:
+		return D3D12_RENDER_PASS_BEGINNING_ACCESS_TYPE_DISCARD;
+
+	default:
+		return D3D12_RENDER_PASS_BEGINNING_ACCESS_TYPE_PRESERVE;
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+D3D12_RENDER_PASS_ENDING_ACCESS_TYPE GetExpectedEnding (const RenderPassStoreOp op)
+{
+	return op == RenderPassStoreOp::Discard
+		? D3D12_RENDER_PASS_ENDING_ACCESS_TYPE_DISCARD
+		: D3D12_RENDER_PASS_ENDING_ACCESS_TYPE_PRESERVE;
+}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Replays what the emulated pass records and checks what every render target
+and depth stencil plane contains after the pass begins and ends. A discard
+must be recorded wherever it's allowed, as that is the point of it, but
+never lose a plane which is loaded or stored. DiscardResource drops both
+planes of a depth stencil, so with stencil it's only recorded if the other
+plane isn't loaded, or not stored at the end.
+*/
+TEST (EmulatedPassesApplyAllOperations)
+{
+	int count = 0;
+
+	ForEachDesc ([&count] (const RenderPassDesc& desc) {
+		Test::FakeRenderPassCommandList commandList (false);
+		++count;
+
+		Planes planes;
+		planes.renderTargets.assign (desc.renderTargets.size (), Contents::Previous);
+		planes.depth = Contents::Previous;
+		planes.stencil = Contents::Previous;
+		planes.hasStencil = desc.depthStencil.format == DXGI_FORMAT_D24_UNORM_S8_UINT;
+
+		BeginRenderPass (&commandList, desc, RenderPassMode::Emulated);
+		Replay (desc, commandList.GetCalls (), planes, true);
+
+		for (std::size_t i = 0; i < desc.renderTargets.size (); ++i) {
+			CHECK (planes.renderTargets [i] == AfterLoad (desc.renderTargets [i].loadOp, true));
+		}
+
+		if (desc.hasDepthStencil) {
+			const auto& depthStencil = desc.depthStencil;
+
+			if (planes.hasStencil) {
+				CHECK (planes.depth == AfterLoad (depthStencil.depthLoadOp,
+					depthStencil.stencilLoadOp != RenderPassLoadOp::Load));
+				CHECK (planes.stencil == AfterLoad (depthStencil.stencilLoadOp,
+					depthStencil.depthLoadOp != RenderPassLoadOp::Load));
+			} else {
+				CHECK (planes.depth == AfterLoad (depthStencil.depthLoadOp, true));
+			}
+		}
+
+		// Everything gets drawn to
+		for (auto& contents : planes.renderTargets) {
+			contents = Contents::Rendered;
+		}
+		planes.depth = Contents::Rendered;
+		planes.stencil = Contents::Rendered;
+
+		commandList.ClearCalls ();
+		EndRenderPass (&commandList, desc, RenderPassMode::Emulated);
+		Replay (desc, commandList.GetCalls (), planes, false);
+
+		for (std::size_t i = 0; i < desc.renderTargets.size (); ++i) {
+			CHECK (planes.renderTargets [i] == (desc.renderTargets [i].storeOp == RenderPassStoreOp::Discard
+				? Contents::Undefined : Contents::Rendered));
+		}
+
+		if (desc.hasDepthStencil) {
+			const auto& depthStencil = desc.depthStencil;
+			const auto discarded = depthStencil.depthStoreOp == RenderPassStoreOp::Discard &&
+				(!planes.hasStencil || depthStencil.stencilStoreOp == RenderPassStoreOp::Discard);
+			const auto expected = discarded ? Contents::Undefined : Contents::Rendered;
+
+			CHECK (planes.depth == expected);
+			if (planes.hasStencil) {
+				CHECK (planes.stencil == expected);
+			}
+		}
+	});
+
+	// 0, 6 or 36 render target combinations, each without a depth stencil
+	// and with 36 for each of the two formats
+	CHECK_EQUAL (43 * 73, count);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TEST (NativePassesPassOperationsOn)
+{
+	ForEachDesc ([] (const RenderPassDesc& desc) {
+		Test::FakeRenderPassCommandList commandList (true);
+
+		BeginRenderPass (&commandList, desc, RenderPassMode::Native);
+
+		const auto& calls = commandList.GetCalls ();
+		CHECK_EQUAL (1, calls.size ());
+		CHECK (calls [0].type == CallType::BeginRenderPass);
+
+		const auto& begin = calls [0];
+		CHECK_EQUAL (desc.renderTargets.size (), begin.renderTargets.size ());
+
+		for (std::size_t i = 0; i < desc.renderTargets.size (); ++i) {
+			const auto& expected = desc.renderTargets [i];
+			const auto& actual = begin.renderTargets [i];
+
+			CHECK_EQUAL (expected.view.ptr, actual.cpuDescriptor.ptr);
+			CHECK_EQUAL (GetExpectedBeginning (expected.loadOp), actual.BeginningAccess.Type);
+			CHECK_EQUAL (GetExpectedEnding (expected.storeOp), actual.EndingAccess.Type);
+
+			if (expected.loadOp == RenderPassLoadOp::Clear) {
+				const auto& clearValue = actual.BeginningAccess.Clear.ClearValue;
+				CHECK_EQUAL (expected.format, clearValue.Format);
+				for (int c = 0; c < 4; ++c) {
+					CHECK_EQUAL (expected.clearColor [c], clearValue.Color [c]);
+				}
+			}
+		}
+
+		CHECK (begin.hasDepthStencil == desc.hasDepthStencil);
+
+		if (desc.hasDepthStencil) {
+			const auto& expected = desc.depthStencil;
+			const auto& actual = begin.depthStencil;
+
+			CHECK_EQUAL (expected.view.ptr, actual.cpuDescriptor.ptr);
+			CHECK_EQUAL (GetExpectedBeginning (expected.depthLoadOp), actual.DepthBeginningAccess.Type);
+			CHECK_EQUAL (GetExpectedEnding (expected.depthStoreOp), actual.DepthEndingAccess.Type);
+
+			if (expected.depthLoadOp == RenderPassLoadOp::Clear) {
+				const auto& clearValue = actual.DepthBeginningAccess.Clear.ClearValue;
+				CHECK_EQUAL (expected.format, clearValue.Format);
+				CHECK_EQUAL (expected.clearDepth, clearValue.DepthStencil.Depth);
+			}
+
+			if (expected.format == DXGI_FORMAT_D24_UNORM_S8_UINT) {
+				CHECK_EQUAL (GetExpectedBeginning (expected.stencilLoadOp),
+					actual.StencilBeginningAccess.Type);
+				CHECK_EQUAL (GetExpectedEnding (expected.stencilStoreOp),
+					actual.StencilEndingAccess.Type);
+
+				if (expected.stencilLoadOp == RenderPassLoadOp::Clear) {
+					const auto& clearValue = actual.StencilBeginningAccess.Clear.ClearValue;
+					CHECK_EQUAL (expected.format, clearValue.Format);
+					CHECK_EQUAL (expected.clearStencil, clearValue.DepthStencil.Stencil);
+				}
+			} else {
+				// Whatever the stencil operations say
+				CHECK_EQUAL (D3D12_RENDER_PASS_BEGINNING_ACCESS_TYPE_NO_ACCESS,
+					actual.StencilBeginningAccess.Type);
+				CHECK_EQUAL (D3D12_RENDER_PASS_ENDING_ACCESS_TYPE_NO_ACCESS,
+					actual.StencilEndingAccess.Type);
+			}
+		}
+
+		// The store operations went to BeginRenderPass already
+		commandList.ClearCalls ();
+		EndRenderPass (&commandList, desc, RenderPassMode::Native);
+		CHECK_EQUAL (1, commandList.GetCalls ().size ());
+		CHECK (commandList.GetCalls () [0].type == CallType::EndRenderPass);
+	});
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TEST (ModeDependsOnCommandList)
+{
+	Test::FakeRenderPassCommandList native (true);
+	Test::FakeRenderPassCommandList older (false);
+
+	CHECK (GetRenderPassMode (&native) == RenderPassMode::Native);
+	CHECK (GetRenderPassMode (&older) == RenderPassMode::Emulated);
+
+	RenderPassDesc desc;
+	desc.renderTargets.resize (1);
+	CHECK_THROWS (BeginRenderPass (&older, desc, RenderPassMode::Native));
+
+	// Emulating works everywhere
+	BeginRenderPass (&native, desc, RenderPassMode::Emulated);
+	CHECK (native.GetCalls () [0].type == CallType::SetRenderTargets);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TEST (InvalidDescsThrow)
+{
+	Test::FakeRenderPassCommandList commandList (true);
+
+	for (const auto mode : { RenderPassMode::Native, RenderPassMode::Emulated }) {
+		RenderPassDesc desc;
+		desc.renderTargets.resize (9);
+		CHECK_THROWS (BeginRenderPass (&commandList, desc, mode));
+
+		// Discarding needs the resource
+		desc.renderTargets.resize (1);
+		desc.renderTargets [0].storeOp = RenderPassStoreOp::Discard;
+		CHECK_THROWS (BeginRenderPass (&commandList, desc, mode));
+		desc.renderTargets [0].storeOp = RenderPassStoreOp::Store;
+		desc.renderTargets [0].loadOp = RenderPassLoadOp::Discard;
+		CHECK_THROWS (BeginRenderPass (&commandList, desc, mode));
+
+		desc.renderTargets.clear ();
+		desc.hasDepthStencil = true;
+		desc.depthStencil.format = DXGI_FORMAT_D24_UNORM_S8_UINT;
+		desc.depthStencil.stencilStoreOp = RenderPassStoreOp::Discard;
+		CHECK_THROWS (BeginRenderPass (&commandList, desc, mode));
+
+		// Unless there is no stencil to discard
+		desc.depthStencil.format = DXGI_FORMAT_D32_FLOAT;
+		BeginRenderPass (&commandList, desc, mode);
+		desc.depthStencil.depthLoadOp = RenderPassLoadOp::Discard;
+		CHECK_THROWS (BeginRenderPass (&commandList, desc, mode));
+	}
+}
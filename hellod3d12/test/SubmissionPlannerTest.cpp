@@ -0,0 +1,311 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+
+
+#include "Test.h"
+
+#include "SubmissionPlanner.h"
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+using namespace AMD;
+
+namespace {
+///////////////////////////////////////////////////////////////////////////////
+SubmissionItem Item (const int queue, const std::vector<int>& dependencies = {})
+{
+	SubmissionItem item;
+	item.queue = queue;
+	item.dependencies = dependencies;
+	return item;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int CountWaits (const SubmissionPlan& plan)
+{
+	int count = 0;
+	for (const auto& batch : plan.batches) {
+		count += static_cast<int> (batch.waits.size ());
+	}
+
+	return count;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Run plan on a simulated GPU. Each queue executes its batches in submission
+order, once the fences it waits for are reached, and the next batch to run
+is picked at random from all queues which can make progress, so any timing
+the GPU could produce may come up.
+
+Fails if an item runs before its dependencies, a wait refers to a value no
+earlier batch signals, signal values don't increase, or the queues
+deadlock before all items ran.
+*/
+void Simulate (const std::vector<SubmissionItem>& items, const SubmissionPlan& plan,
+	const std::vector<std::uint64_t>& nextFenceValues, std::mt19937& random)
+{
+	const auto queueCount = static_cast<int> (nextFenceValues.size ());
+
+	std::vector<std::vector<const SubmissionBatch*>> queues (queueCount);
+	auto signaled = nextFenceValues;
+	for (auto& value : signaled) {
+		--value;
+	}
+
+	for (const auto& batch : plan.batches) {
+		for (const auto& wait : batch.waits) {
+			CHECK (wait.queue != batch.queue);
+			CHECK (wait.value <= signaled [wait.queue]);
+		}
+
+		if (batch.signalValue != 0) {
+			CHECK_EQUAL (signaled [batch.queue] + 1, batch.signalValue);
+			signaled [batch.queue] = batch.signalValue;
+		}
+
+		queues [batch.queue].push_back (&batch);
+	}
+
+	for (int queue = 0; queue < queueCount; ++queue) {
+		CHECK_EQUAL (signaled [queue] + 1, plan.nextFenceValues [queue]);
+	}
+
+	// The fences start out at the value before the first free one
+	std::vector<std::uint64_t> fences (nextFenceValues);
+	for (auto& value : fences) {
+		--value;
+	}
+
+	std::vector<std::size_t> next (queueCount, 0);
+	std::vector<bool> done (items.size (), false);
+	std::size_t doneCount = 0;
+
+	for (;;) {
+		std::vector<int> ready;
+		for (int queue = 0; queue < queueCount; ++queue) {
+			if (next [queue] == queues [queue].size ()) {
+				continue;
+			}
+
+			bool canRun = true;
+			for (const auto& wait : queues [queue][next [queue]]->waits) {
+				canRun = canRun && fences [wait.queue] >= wait.value;
+			}
+
+			if (canRun) {
+				ready.push_back (queue);
+			}
+		}
+
+		if (ready.empty ()) {
+			break;
+		}
+
+		const auto queue = ready [random () % ready.size ()];
+		const auto batch = queues [queue][next [queue]++];
+
+		for (const auto item : batch->items) {
+			CHECK (items [item].queue == queue);
+			CHECK (!done [item]);
+
+			for (const auto dependency : items [item].dependencies) {
+				CHECK (done [dependency]);
+			}
+
+			done [item] = true;
+			++doneCount;
+		}
+
+		if (batch->signalValue != 0) {
+			fences [queue] = batch->signalValue;
+		}
+	}
+
+	CHECK_EQUAL (items.size (), doneCount);
+}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TEST (SingleQueueIsOneBatch)
+{
+	const std::vector<SubmissionItem> items (5, Item (0));
+	const auto plan = PlanSubmissions (items, 1, { 1 });
+
+	CHECK_EQUAL (1, plan.batches.size ());
+	CHECK (plan.batches [0].items == (std::vector<int> { 0, 1, 2, 3, 4 }));
+	CHECK (plan.batches [0].waits.empty ());
+
+	// Nobody waits for it
+	CHECK_EQUAL (0, plan.batches [0].signalValue);
+	CHECK_EQUAL (1, plan.nextFenceValues [0]);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TEST (CrossQueueDependenciesSignalAndWait)
+{
+	// Graphics, then compute, then graphics again
+	const std::vector<SubmissionItem> items = { Item (0), Item (1, { 0 }), Item (0, { 1 }) };
+	const auto plan = PlanSubmissions (items, 2, { 5, 7 });
+
+	CHECK_EQUAL (3, plan.batches.size ());
+
+	CHECK_EQUAL (0, plan.batches [0].queue);
+	CHECK (plan.batches [0].waits.empty ());
+	CHECK_EQUAL (5, plan.batches [0].signalValue);
+
+	CHECK_EQUAL (1, plan.batches [1].queue);
+	CHECK_EQUAL (1, plan.batches [1].waits.size ());
+	CHECK_EQUAL (0, plan.batches [1].waits [0].queue);
+	CHECK_EQUAL (5, plan.batches [1].waits [0].value);
+	CHECK_EQUAL (7, plan.batches [1].signalValue);
+
+	CHECK_EQUAL (0, plan.batches [2].queue);
+	CHECK_EQUAL (1, plan.batches [2].waits.size ());
+	CHECK_EQUAL (1, plan.batches [2].waits [0].queue);
+	CHECK_EQUAL (7, plan.batches [2].waits [0].value);
+	CHECK_EQUAL (0, plan.batches [2].signalValue);
+
+	CHECK_EQUAL (6, plan.nextFenceValues [0]);
+	CHECK_EQUAL (8, plan.nextFenceValues [1]);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+The second compute item waits for graphics, so it must not be merged into
+the batch of the first one, which can start right away.
+*/
+TEST (WaitingItemStartsNewBatch)
+{
+	const std::vector<SubmissionItem> items = { Item (1), Item (0), Item (1, { 1 }) };
+	const auto plan = PlanSubmissions (items, 2, { 1, 1 });
+
+	CHECK_EQUAL (3, plan.batches.size ());
+	CHECK (plan.batches [0].waits.empty ());
+	CHECK (plan.batches [2].items == std::vector<int> { 2 });
+	CHECK_EQUAL (1, plan.batches [2].waits.size ());
+
+	std::mt19937 random (1);
+	Simulate (items, plan, { 1, 1 }, random);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TEST (RedundantWaitsAreSkipped)
+{
+	// The second compute item is covered by the wait of the first one
+	const std::vector<SubmissionItem> items = {
+		Item (0), Item (1, { 0 }), Item (0), Item (1, { 0 })
+	};
+	const auto plan = PlanSubmissions (items, 2, { 1, 1 });
+
+	CHECK_EQUAL (1, CountWaits (plan));
+
+	std::mt19937 random (1);
+	Simulate (items, plan, { 1, 1 }, random);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TEST (DependenciesOverrideOrder)
+{
+	const std::vector<SubmissionItem> items = { Item (0, { 2 }), Item (0), Item (0) };
+	const auto plan = PlanSubmissions (items, 1, { 1 });
+
+	CHECK_EQUAL (1, plan.batches.size ());
+	CHECK (plan.batches [0].items == (std::vector<int> { 1, 2, 0 }));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TEST (ExternalWaitsArePassedOn)
+{
+	auto item = Item (0);
+	item.waits.push_back ({ 1, 3 });
+	const std::vector<SubmissionItem> items = { item };
+	const auto plan = PlanSubmissions (items, 2, { 1, 4 });
+
+	CHECK_EQUAL (1, plan.batches.size ());
+	CHECK_EQUAL (1, plan.batches [0].waits.size ());
+	CHECK_EQUAL (1, plan.batches [0].waits [0].queue);
+	CHECK_EQUAL (3, plan.batches [0].waits [0].value);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TEST (InvalidPlansThrow)
+{
+	// Cycles on one queue, across queues, and through a chain
+	CHECK_THROWS (PlanSubmissions ({ Item (0, { 0 }) }, 1, { 1 }));
+	CHECK_THROWS (PlanSubmissions ({ Item (0, { 1 }), Item (1, { 0 }) }, 2, { 1, 1 }));
+	CHECK_THROWS (PlanSubmissions ({ Item (0, { 2 }), Item (1, { 0 }), Item (0, { 1 }),
+		Item (1) }, 2, { 1, 1 }));
+
+	// Indices out of range
+	CHECK_THROWS (PlanSubmissions ({ Item (2) }, 2, { 1, 1 }));
+	CHECK_THROWS (PlanSubmissions ({ Item (-1) }, 2, { 1, 1 }));
+	CHECK_THROWS (PlanSubmissions ({ Item (0, { 1 }) }, 1, { 1 }));
+	CHECK_THROWS (PlanSubmissions ({ Item (0, { -1 }) }, 1, { 1 }));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Random acyclic dependency graphs, with the items shuffled so dependencies
+may point forward, each run on several random timelines.
+*/
+TEST (RandomPlansRunOnAnyTimeline)
+{
+	std::mt19937 random (42);
+
+	for (int round = 0; round < 2000; ++round) {
+		const int queueCount = 1 + random () % 4;
+		const int itemCount = 1 + random () % 30;
+
+		std::vector<int> order (itemCount);
+		for (int i = 0; i < itemCount; ++i) {
+			order [i] = i;
+		}
+		std::shuffle (order.begin (), order.end (), random);
+
+		// Item i of the generated order is at order [i] and only depends on
+		// items before it, so there is no cycle
+		std::vector<SubmissionItem> items (itemCount);
+		for (int i = 0; i < itemCount; ++i) {
+			auto& item = items [order [i]];
+			item.queue = random () % queueCount;
+
+			for (int d = random () % 3; d > 0 && i > 0; --d) {
+				item.dependencies.push_back (order [random () % i]);
+			}
+		}
+
+		std::vector<std::uint64_t> nextFenceValues (queueCount);
+		for (auto& value : nextFenceValues) {
+			value = 1 + random () % 100;
+		}
+
+		const auto plan = PlanSubmissions (items, queueCount, nextFenceValues);
+
+		for (int timeline = 0; timeline < 4; ++timeline) {
+			Simulate (items, plan, nextFenceValues, random);
+		}
+	}
+}
@@ -0,0 +1,86 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+
+#include "Benchmark.h"
+
+#include "Lz4.h"
+#include "SupercompressedTexture.h"
+#include "TestImage.h"
+
+using namespace AMD;
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+File size compared to plain BC7 and LZ4 compressed BC7, and transcode
+throughput into each target format, for a 2048x2048 texture with mips.
+*/
+int main ()
+{
+	const int size = 2048;
+
+	MipLevel top;
+	top.width = size;
+	top.height = size;
+	top.data = Test::CreateTestImage (size, size, true);
+
+	std::vector<MipLevel> levels;
+	auto chain = GenerateMipChain (top.data.data (), size, size, size * 4,
+		AlphaMode::Straight);
+	levels.push_back (std::move (top));
+	for (auto& level : chain) {
+		levels.push_back (std::move (level));
+	}
+
+	const auto encoded = EncodeSupercompressedTexture (levels.data (),
+		static_cast<int> (levels.size ()));
+
+	const auto bc7 = TranscodeSupercompressedTexture (encoded.data (),
+		encoded.size (), BlockFormat::BC7);
+	std::vector<std::uint8_t> bc7Data;
+	for (const auto& level : bc7.levels) {
+		bc7Data.insert (bc7Data.end (), level.begin (), level.end ());
+	}
+
+	std::printf ("BC7 %zu bytes, LZ4 BC7 %zu bytes, supercompressed %zu bytes\n",
+		bc7Data.size (), Lz4Compress (bc7Data.data (), bc7Data.size ()).size (),
+		encoded.size ());
+
+	const struct
+	{
+		const char* name;
+		BlockFormat format;
+	} formats [] = {
+		{ "Transcode to BC1", BlockFormat::BC1 },
+		{ "Transcode to BC3", BlockFormat::BC3 },
+		{ "Transcode to BC7", BlockFormat::BC7 }
+	};
+
+	for (const auto& format : formats) {
+		Test::Report (format.name, Test::Measure ([&] () {
+			TranscodeSupercompressedTexture (encoded.data (), encoded.size (),
+				format.format);
+		}), encoded.size ());
+	}
+
+	return 0;
+}
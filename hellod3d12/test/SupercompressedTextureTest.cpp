@@ -0,0 +1,188 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+
+#include "Test.h"
+
+#include "BlockDecoder.h"
+#include "SupercompressedTexture.h"
+#include "TestImage.h"
+
+#include <cstring>
+#include <vector>
+
+using namespace AMD;
+
+namespace {
+///////////////////////////////////////////////////////////////////////////////
+std::vector<MipLevel> CreateLevels (const int width, const int height)
+{
+	MipLevel top;
+	top.width = width;
+	top.height = height;
+	top.data = Test::CreateTestImage (width, height, true);
+
+	std::vector<MipLevel> levels;
+	auto chain = GenerateMipChain (top.data.data (), width, height, width * 4,
+		AlphaMode::Straight);
+	levels.push_back (std::move (top));
+	for (auto& level : chain) {
+		levels.push_back (std::move (level));
+	}
+
+	return levels;
+}
+
+// Offsets into the file, see SupercompressedTexture.h
+const std::size_t HEADER_SIZE = 24;
+const std::size_t LEVEL_ENTRY_SIZE = 32;
+
+void Write32 (std::vector<std::uint8_t>& data, const std::size_t offset, const std::uint32_t value)
+{
+	std::memcpy (data.data () + offset, &value, sizeof (value));
+}
+
+void Write64 (std::vector<std::uint8_t>& data, const std::size_t offset, const std::uint64_t value)
+{
+	std::memcpy (data.data () + offset, &value, sizeof (value));
+}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TEST (Info)
+{
+	const auto levels = CreateLevels (64, 32);
+	const auto encoded = EncodeSupercompressedTexture (levels.data (),
+		static_cast<int> (levels.size ()));
+
+	int width = 0, height = 0;
+	CHECK (GetSupercompressedTextureInfo (encoded.data (), encoded.size (), &width, &height));
+	CHECK_EQUAL (64, width);
+	CHECK_EQUAL (32, height);
+
+	// Too short, and some other file
+	CHECK (!GetSupercompressedTextureInfo (encoded.data (), HEADER_SIZE - 1, &width, &height));
+	const auto image = Test::CreateRandomBytes (64);
+	CHECK (!GetSupercompressedTextureInfo (image.data (), image.size (), &width, &height));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+The planes store BC7 mode 6 blocks, transcoding back to BC7 must reproduce
+them exactly.
+*/
+TEST (BC7IsBitExact)
+{
+	const auto levels = CreateLevels (64, 40);
+	const auto encoded = EncodeSupercompressedTexture (levels.data (),
+		static_cast<int> (levels.size ()));
+
+	const auto texture = TranscodeSupercompressedTexture (encoded.data (),
+		encoded.size (), BlockFormat::BC7);
+	CHECK_EQUAL (64, texture.width);
+	CHECK_EQUAL (40, texture.height);
+	CHECK_EQUAL (levels.size (), texture.levels.size ());
+
+	for (std::size_t i = 0; i < levels.size (); ++i) {
+		const auto& level = levels [i];
+		CHECK (texture.levels [i] == CompressImage (level.data.data (),
+			level.width, level.height, level.width * 4,
+			BlockFormat::BC7, BlockCompressionQuality::High));
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TEST (TranscodeQuality)
+{
+	const auto levels = CreateLevels (256, 256);
+	const auto encoded = EncodeSupercompressedTexture (levels.data (),
+		static_cast<int> (levels.size ()));
+
+	const auto bc1 = TranscodeSupercompressedTexture (encoded.data (),
+		encoded.size (), BlockFormat::BC1);
+	const auto bc3 = TranscodeSupercompressedTexture (encoded.data (),
+		encoded.size (), BlockFormat::BC3);
+
+	// Requantizing loses a bit over encoding directly, but not much
+	const auto& top = levels [0].data;
+	CHECK (Test::ComputePsnr (top, Test::DecompressImage (bc1.levels [0],
+		256, 256, BlockFormat::BC1), 3) > 30);
+	CHECK (Test::ComputePsnr (top, Test::DecompressImage (bc3.levels [0],
+		256, 256, BlockFormat::BC3), 4) > 30);
+
+	// Smaller than the BC7 data it stores
+	std::size_t bc7Size = 0;
+	for (const auto& level : levels) {
+		bc7Size += ((level.width + 3) / 4) * ((level.height + 3) / 4) * 16;
+	}
+	CHECK (encoded.size () < bc7Size);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TEST (RejectsCorruptFiles)
+{
+	const auto levels = CreateLevels (32, 32);
+	const auto encoded = EncodeSupercompressedTexture (levels.data (),
+		static_cast<int> (levels.size ()));
+
+	const auto transcode = [] (const std::vector<std::uint8_t>& data) {
+		TranscodeSupercompressedTexture (data.data (), data.size (), BlockFormat::BC7);
+	};
+
+	for (std::size_t size = 0; size < encoded.size (); size += 7) {
+		CHECK_THROWS (transcode (std::vector<std::uint8_t> (encoded.begin (),
+			encoded.begin () + size)));
+	}
+
+	auto data = encoded;
+	data [0] = 'X';
+	CHECK_THROWS (transcode (data));
+
+	// Sizes which would overflow the block counts
+	data = encoded;
+	Write32 (data, 8, 0x40000000);
+	CHECK_THROWS (transcode (data));
+
+	data = encoded;
+	Write32 (data, 16, 0xFFFFFFFF);
+	CHECK_THROWS (transcode (data));
+
+	// More levels than the chain has
+	data = encoded;
+	Write32 (data, 16, 7);
+	CHECK_THROWS (transcode (data));
+
+	// A level which is not half the size of the previous one
+	data = encoded;
+	Write32 (data, HEADER_SIZE + LEVEL_ENTRY_SIZE + 0, 32);
+	CHECK_THROWS (transcode (data));
+
+	// Offset + size wraps around
+	data = encoded;
+	Write64 (data, HEADER_SIZE + 8, ~static_cast<std::uint64_t> (0) - 15);
+	CHECK_THROWS (transcode (data));
+
+	// The last plane is cut off
+	data = encoded;
+	data.resize (data.size () - 5);
+	CHECK_THROWS (transcode (data));
+}
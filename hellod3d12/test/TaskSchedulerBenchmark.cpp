@@ -0,0 +1,198 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#include "Benchmark.h"
+
+#include "TaskScheduler.h"
+#include "WorkStealingDeque.h"
+
+#include <algorithm>
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace AMD;
+
+namespace {
+///////////////////////////////////////////////////////////////////////////////
+int Fibonacci (TaskScheduler& scheduler, const int n)
+{
+	if (n < 12) {
+		return n < 2 ? n : Fibonacci (scheduler, n - 1) + Fibonacci (scheduler, n - 2);
+	}
+
+	int a = 0;
+	const auto task = scheduler.Submit ([&] () {
+		a = Fibonacci (scheduler, n - 1);
+	});
+	const int b = Fibonacci (scheduler, n - 2);
+	scheduler.Wait (task);
+
+	return a + b;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+What ParallelFor did before the task scheduler: one thread per range.
+*/
+template <typename Function>
+void ThreadPerRangeFor (const int count, const int minimumRangeSize, Function function)
+{
+	const int threadCount = static_cast<int> ((std::max) (1u, std::thread::hardware_concurrency ()));
+	const int rangeCount = (std::max) (1, (std::min) (threadCount,
+		count / (std::max) (1, minimumRangeSize)));
+
+	if (rangeCount == 1) {
+		function (0, count);
+		return;
+	}
+
+	const int rangeSize = (count + rangeCount - 1) / rangeCount;
+	const auto runRange = [&] (const int range) {
+		const int begin = range * rangeSize;
+		const int end = (std::min) (count, begin + rangeSize);
+		if (begin < end) {
+			function (begin, end);
+		}
+	};
+
+	std::vector<std::thread> threads;
+	for (int i = 1; i < rangeCount; ++i) {
+		threads.emplace_back (runRange, i);
+	}
+
+	runRange (0);
+
+	for (auto& thread : threads) {
+		thread.join ();
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void BenchmarkDeque ()
+{
+	const int itemCount = 1 << 20;
+	std::vector<int> items (itemCount);
+	WorkStealingDeque<int> deque;
+
+	volatile int* sink = nullptr;
+
+	Test::Report ("Deque, 1M push and pop", Test::Measure ([&] () {
+		for (auto& item : items) {
+			deque.Push (&item);
+		}
+		while (auto item = deque.Pop ()) {
+			sink = item;
+		}
+	}));
+
+	Test::Report ("Deque, 1M push and steal", Test::Measure ([&] () {
+		for (auto& item : items) {
+			deque.Push (&item);
+		}
+		while (auto item = deque.Steal ()) {
+			sink = item;
+		}
+	}));
+
+	(void) sink;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void BenchmarkScheduler (const int workerCount)
+{
+	TaskSchedulerOptions options;
+	options.workerCount = workerCount;
+	TaskScheduler scheduler (options);
+
+	const auto prefix = std::to_string (workerCount) + " workers, ";
+	const int taskCount = 100000;
+	std::atomic<int> counter (0);
+
+	Test::Report ((prefix + "100k tasks from the main thread").c_str (), Test::Measure ([&] () {
+		std::vector<TaskHandle> tasks;
+		tasks.reserve (taskCount);
+		for (int i = 0; i < taskCount; ++i) {
+			tasks.push_back (scheduler.Submit ([&] () { ++counter; }));
+		}
+		for (const auto& task : tasks) {
+			scheduler.Wait (task);
+		}
+	}));
+
+	Test::Report ((prefix + "100k tasks from a worker").c_str (), Test::Measure ([&] () {
+		scheduler.Wait (scheduler.Submit ([&] () {
+			std::vector<TaskHandle> tasks;
+			tasks.reserve (taskCount);
+			for (int i = 0; i < taskCount; ++i) {
+				tasks.push_back (scheduler.Submit ([&] () { ++counter; }));
+			}
+			for (const auto& task : tasks) {
+				scheduler.Wait (task);
+			}
+		}));
+	}));
+
+	volatile int sink = 0;
+	Test::Report ((prefix + "nested tasks, Fibonacci (27)").c_str (), Test::Measure ([&] () {
+		sink = Fibonacci (scheduler, 27);
+	}));
+
+	// Small ranges show the overhead, large ones the throughput
+	std::vector<float> data (1 << 20, 1.0f);
+	const auto body = [&] (const int begin, const int end) {
+		for (int i = begin; i < end; ++i) {
+			data [i] = data [i] * 0.5f + 1.0f;
+		}
+	};
+
+	for (const int count : { 256, 16384, 1 << 20 }) {
+		const auto size = std::to_string (count);
+
+		Test::Report ((prefix + "ParallelFor over " + size).c_str (), Test::Measure ([&] () {
+			scheduler.ParallelFor (count, 16, body);
+		}, 50), count * sizeof (float));
+
+		Test::Report ((prefix + "thread per range over " + size).c_str (), Test::Measure ([&] () {
+			ThreadPerRangeFor (count, 16, body);
+		}, 50), count * sizeof (float));
+	}
+}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Deque operations without contention, task submission and waiting from inside
+and outside the workers, nested tasks, and ParallelFor against starting one
+thread per range. Run from the build directory.
+*/
+int main ()
+{
+	BenchmarkDeque ();
+
+	for (const int workerCount : { 1, 4 }) {
+		BenchmarkScheduler (workerCount);
+	}
+
+	return 0;
+}
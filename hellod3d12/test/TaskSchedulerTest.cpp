@@ -0,0 +1,311 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#include "Test.h"
+
+#include "TaskScheduler.h"
+
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace AMD;
+
+namespace {
+///////////////////////////////////////////////////////////////////////////////
+TaskSchedulerOptions CreateOptions (const int workerCount)
+{
+	TaskSchedulerOptions options;
+	options.workerCount = workerCount;
+	return options;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Spawns a task per level down to a cut-off, and waits for it from inside
+another task, so waiting workers have to run other tasks.
+*/
+int Fibonacci (TaskScheduler& scheduler, const int n)
+{
+	if (n < 12) {
+		return n < 2 ? n : Fibonacci (scheduler, n - 1) + Fibonacci (scheduler, n - 2);
+	}
+
+	int a = 0;
+	const auto task = scheduler.Submit ([&] () {
+		a = Fibonacci (scheduler, n - 1);
+	});
+	const int b = Fibonacci (scheduler, n - 2);
+	scheduler.Wait (task);
+
+	return a + b;
+}
+
+const int WORKER_COUNTS [] = { 1, 2, 4, 8 };
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TEST (RunsEveryTask)
+{
+	for (const auto workerCount : WORKER_COUNTS) {
+		TaskScheduler scheduler (CreateOptions (workerCount));
+		CHECK_EQUAL (workerCount, scheduler.GetWorkerCount ());
+
+		std::atomic<int> counter (0);
+		std::vector<TaskHandle> tasks;
+		for (int i = 0; i < 10000; ++i) {
+			tasks.push_back (scheduler.Submit ([&] () { ++counter; }));
+		}
+
+		for (const auto& task : tasks) {
+			scheduler.Wait (task);
+			CHECK (task.IsDone ());
+		}
+		CHECK_EQUAL (10000, counter.load ());
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TEST (NestedTasks)
+{
+	for (const auto workerCount : WORKER_COUNTS) {
+		TaskScheduler scheduler (CreateOptions (workerCount));
+		CHECK_EQUAL (28657, Fibonacci (scheduler, 23));
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TEST (Dependencies)
+{
+	for (const auto workerCount : WORKER_COUNTS) {
+		TaskScheduler scheduler (CreateOptions (workerCount));
+
+		// Layers of tasks, each of which depends on all of the previous layer
+		const int layerCount = 20, layerSize = 10;
+		std::atomic<int> doneCounts [layerCount] = {};
+		std::atomic<int> violations (0);
+
+		std::vector<TaskHandle> previous;
+		for (int layer = 0; layer < layerCount; ++layer) {
+			std::vector<TaskHandle> current;
+			for (int i = 0; i < layerSize; ++i) {
+				current.push_back (scheduler.Submit ([&, layer] () {
+					if (layer > 0 && doneCounts [layer - 1].load () != layerSize) {
+						++violations;
+					}
+					++doneCounts [layer];
+				}, previous));
+			}
+			previous = current;
+		}
+
+		for (const auto& task : previous) {
+			scheduler.Wait (task);
+		}
+
+		CHECK_EQUAL (0, violations.load ());
+		CHECK_EQUAL (layerSize, doneCounts [layerCount - 1].load ());
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TEST (InvalidHandlesCountAsDone)
+{
+	TaskScheduler scheduler (CreateOptions (2));
+
+	const TaskHandle invalid;
+	CHECK (!invalid.IsValid ());
+	CHECK (invalid.IsDone ());
+	scheduler.Wait (invalid);
+
+	bool ran = false;
+	const auto task = scheduler.Submit ([&ran] () { ran = true; }, { invalid });
+	scheduler.Wait (task);
+	CHECK (ran);
+	CHECK (task.IsDone ());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TEST (MainThreadTasks)
+{
+	TaskScheduler scheduler (CreateOptions (4));
+	const auto mainThread = std::this_thread::get_id ();
+
+	std::atomic<int> runCount (0);
+	std::atomic<int> wrongThreadCount (0);
+	std::vector<TaskHandle> tasks;
+
+	// Main thread tasks which depend on worker tasks
+	for (int i = 0; i < 100; ++i) {
+		const auto work = scheduler.Submit ([] () { std::this_thread::yield (); });
+		tasks.push_back (scheduler.SubmitMainThread ([&] () {
+			if (std::this_thread::get_id () != mainThread) {
+				++wrongThreadCount;
+			}
+			++runCount;
+		}, { work }));
+	}
+
+	// A worker waiting for a main thread task must not deadlock
+	const auto mainTask = scheduler.SubmitMainThread ([&] () { ++runCount; });
+	scheduler.Wait (scheduler.Submit ([&] () { scheduler.Wait (mainTask); }));
+
+	for (const auto& task : tasks) {
+		scheduler.Wait (task);
+	}
+
+	CHECK_EQUAL (101, runCount.load ());
+	CHECK_EQUAL (0, wrongThreadCount.load ());
+
+	bool threw = false;
+	std::thread ([&] () {
+		try {
+			scheduler.RunMainThreadTasks ();
+		} catch (const std::runtime_error&) {
+			threw = true;
+		}
+	}).join ();
+	CHECK (threw);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TEST (Exceptions)
+{
+	TaskScheduler scheduler (CreateOptions (2));
+
+	const auto failing = scheduler.Submit ([] () {
+		throw std::runtime_error ("Task failed");
+	});
+
+	// Dependents still run
+	bool ran = false;
+	scheduler.Wait (scheduler.Submit ([&] () { ran = true; }, { failing }));
+	CHECK (ran);
+
+	CHECK_THROWS (scheduler.Wait (failing));
+	// Every wait rethrows
+	CHECK_THROWS (scheduler.Wait (failing));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TEST (SubmitsFromOtherThreads)
+{
+	std::atomic<int> counter (0);
+	{
+		TaskScheduler scheduler (CreateOptions (2));
+
+		std::vector<std::thread> threads;
+		for (int t = 0; t < 4; ++t) {
+			threads.emplace_back ([&] () {
+				for (int i = 0; i < 1000; ++i) {
+					scheduler.Submit ([&] () { ++counter; });
+				}
+			});
+		}
+
+		for (auto& thread : threads) {
+			thread.join ();
+		}
+
+		scheduler.SubmitMainThread ([&] () { ++counter; });
+
+		// The destructor runs the rest
+	}
+
+	CHECK_EQUAL (4001, counter.load ());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TEST (ParallelForCoversRange)
+{
+	for (const auto workerCount : WORKER_COUNTS) {
+		TaskScheduler scheduler (CreateOptions (workerCount));
+
+		for (const int count : { 0, 1, 7, 1000, 100000 }) {
+			for (const int minimumRangeSize : { 1, 16, 5000 }) {
+				std::vector<std::atomic<int>> hits (count);
+				std::atomic<int> tooSmall (0);
+
+				scheduler.ParallelFor (count, minimumRangeSize, [&] (const int begin, const int end) {
+					// Only the range containing the end may be short
+					if (end - begin < minimumRangeSize && end != count) {
+						++tooSmall;
+					}
+
+					for (int i = begin; i < end; ++i) {
+						++hits [i];
+					}
+				});
+
+				int wrong = 0;
+				for (const auto& hit : hits) {
+					wrong += hit.load () != 1;
+				}
+				CHECK_EQUAL (0, wrong);
+				CHECK_EQUAL (0, tooSmall.load ());
+			}
+		}
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TEST (NestedParallelFor)
+{
+	TaskScheduler scheduler (CreateOptions (4));
+
+	std::vector<std::atomic<int>> hits (100 * 100);
+	scheduler.ParallelFor (100, 3, [&] (const int begin, const int end) {
+		for (int i = begin; i < end; ++i) {
+			scheduler.ParallelFor (100, 7, [&] (const int innerBegin, const int innerEnd) {
+				for (int j = innerBegin; j < innerEnd; ++j) {
+					++hits [i * 100 + j];
+				}
+			});
+		}
+	});
+
+	int wrong = 0;
+	for (const auto& hit : hits) {
+		wrong += hit.load () != 1;
+	}
+	CHECK_EQUAL (0, wrong);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TEST (ParallelForRethrows)
+{
+	TaskScheduler scheduler (CreateOptions (4));
+
+	CHECK_THROWS (scheduler.ParallelFor (100, 1, [] (const int begin, const int end) {
+		if (begin <= 50 && 50 < end) {
+			throw std::runtime_error ("Range failed");
+		}
+	}));
+
+	// Still usable afterwards
+	std::atomic<int> total (0);
+	scheduler.ParallelFor (100, 1, [&] (const int begin, const int end) {
+		total += end - begin;
+	});
+	CHECK_EQUAL (100, total.load ());
+}
@@ -0,0 +1,102 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+
+#include "Test.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+namespace AMD {
+namespace Test {
+namespace {
+struct TestCase
+{
+	const char* name;
+	TestFunction function;
+};
+
+std::vector<TestCase>& GetTests ()
+{
+	static std::vector<TestCase> tests;
+	return tests;
+}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Failure::Failure (const char* file, const int line, const std::string& message)
+	: std::runtime_error (std::string (file) + ":" + std::to_string (line) +
+		": " + message)
+{
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Registration::Registration (const char* name, TestFunction function)
+{
+	TestCase test = { name, function };
+	GetTests ().push_back (test);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int RunTests (const char* filter)
+{
+	int failed = 0;
+	int run = 0;
+
+	for (const auto& test : GetTests ()) {
+		if (filter && ::strstr (test.name, filter) == nullptr) {
+			continue;
+		}
+
+		++run;
+		const auto start = std::chrono::steady_clock::now ();
+
+		try {
+			test.function ();
+
+			const auto elapsed = std::chrono::duration<double, std::milli> (
+				std::chrono::steady_clock::now () - start).count ();
+			std::printf ("[ OK ] %s (%.1f ms)\n", test.name, elapsed);
+		} catch (const std::exception& e) {
+			std::printf ("[FAIL] %s\n       %s\n", test.name, e.what ());
+			++failed;
+		} catch (...) {
+			std::printf ("[FAIL] %s\n       unknown exception\n", test.name);
+			++failed;
+		}
+
+		std::fflush (stdout);
+	}
+
+	std::printf ("%d of %d tests passed\n", run - failed, run);
+	return failed;
+}
+}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main (int argc, char* argv [])
+{
+	return AMD::Test::RunTests (argc > 1 ? argv [1] : nullptr) == 0 ? 0 : 1;
+}
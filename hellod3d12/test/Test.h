@@ -0,0 +1,105 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+
+#ifndef ANTERU_D3D12_SAMPLE_TEST_TEST_H_
+#define ANTERU_D3D12_SAMPLE_TEST_TEST_H_
+
+#include <cmath>
+#include <stdexcept>
+#include <string>
+
+namespace AMD {
+namespace Test {
+///////////////////////////////////////////////////////////////////////////////
+/**
+Thrown by the CHECK macros. Tests run in the order they are declared in; a
+failure stops the current test and the runner continues with the next one.
+*/
+class Failure : public std::runtime_error
+{
+public:
+	Failure (const char* file, const int line, const std::string& message);
+};
+
+typedef void (*TestFunction) ();
+
+struct Registration
+{
+	Registration (const char* name, TestFunction function);
+};
+
+/**
+Run all tests whose name contains filter, or all tests if filter is null.
+Returns the number of failed tests.
+*/
+int RunTests (const char* filter);
+}
+}
+
+#define TEST(name) \
+	static void name (); \
+	static const ::AMD::Test::Registration name##Registration (#name, &name); \
+	static void name ()
+
+#define CHECK(expression) \
+	do { \
+		if (!(expression)) { \
+			throw ::AMD::Test::Failure (__FILE__, __LINE__, #expression); \
+		} \
+	} while (0)
+
+#define CHECK_EQUAL(expected, actual) \
+	do { \
+		if (!((expected) == (actual))) { \
+			throw ::AMD::Test::Failure (__FILE__, __LINE__, \
+				std::string (#actual " is ") + std::to_string (actual) + \
+				", expected " + std::to_string (expected)); \
+		} \
+	} while (0)
+
+#define CHECK_NEAR(expected, actual, tolerance) \
+	do { \
+		if (!(std::abs ((expected) - (actual)) <= (tolerance))) { \
+			throw ::AMD::Test::Failure (__FILE__, __LINE__, \
+				std::string (#actual " is ") + std::to_string (actual) + \
+				", expected " + std::to_string (expected)); \
+		} \
+	} while (0)
+
+#define CHECK_THROWS(expression) \
+	do { \
+		bool threw = false; \
+		try { \
+			expression; \
+		} catch (const ::AMD::Test::Failure&) { \
+			throw; \
+		} catch (...) { \
+			threw = true; \
+		} \
+		if (!threw) { \
+			throw ::AMD::Test::Failure (__FILE__, __LINE__, \
+				#expression " did not throw"); \
+		} \
+	} while (0)
+
+#endif
@@ -0,0 +1,120 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#include "TestAssetPack.h"
+
+#include "AssetPack.h"
+#include "Hash.h"
+#include "Lz4.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace AMD {
+namespace Test {
+namespace {
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+void Append (std::vector<std::uint8_t>& output, const T& value)
+{
+	const auto offset = output.size ();
+	output.resize (offset + sizeof (T));
+	std::memcpy (output.data () + offset, &value, sizeof (T));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void Pad (std::vector<std::uint8_t>& output, const std::uint32_t alignment)
+{
+	output.resize ((output.size () + alignment - 1) / alignment * alignment);
+}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::vector<std::uint8_t> CreateAssetPack (const std::vector<TestAsset>& assets,
+	const std::uint32_t alignment)
+{
+	std::vector<AssetPackEntry> entries;
+	std::vector<std::vector<std::uint8_t>> stored;
+	std::vector<std::uint8_t> names;
+
+	for (const auto& asset : assets) {
+		AssetPackEntry entry = {};
+		entry.nameHash = HashFNV1a (asset.name.data (), asset.name.size ());
+		entry.nameOffset = static_cast<std::uint32_t> (names.size ());
+		entry.nameLength = static_cast<std::uint32_t> (asset.name.size ());
+		entry.size = asset.data.size ();
+
+		if (asset.compress) {
+			entry.compression = AssetPackCompression::Lz4;
+			stored.push_back (Lz4Compress (asset.data.data (), asset.data.size ()));
+		} else {
+			entry.compression = AssetPackCompression::None;
+			stored.push_back (asset.data);
+		}
+
+		entry.storedSize = stored.back ().size ();
+		entries.push_back (entry);
+		names.insert (names.end (), asset.name.begin (), asset.name.end ());
+	}
+
+	// The index is sorted by hash, the data is stored in the same order
+	std::vector<std::size_t> order (entries.size ());
+	for (std::size_t i = 0; i < order.size (); ++i) {
+		order [i] = i;
+	}
+
+	std::stable_sort (order.begin (), order.end (),
+		[&] (const std::size_t a, const std::size_t b) {
+		return entries [a].nameHash < entries [b].nameHash;
+	});
+
+	AssetPackHeader header = {};
+	std::memcpy (header.magic, "APAK", sizeof (header.magic));
+	header.version = 1;
+	header.entryCount = static_cast<std::uint32_t> (entries.size ());
+	header.alignment = alignment;
+	header.indexOffset = sizeof (AssetPackHeader);
+	header.namesOffset = header.indexOffset + sizeof (AssetPackEntry) * entries.size ();
+
+	std::size_t offset = static_cast<std::size_t> (header.namesOffset) + names.size ();
+	for (const auto i : order) {
+		offset = (offset + alignment - 1) / alignment * alignment;
+		entries [i].offset = offset;
+		offset += stored [i].size ();
+	}
+
+	std::vector<std::uint8_t> result;
+	Append (result, header);
+	for (const auto i : order) {
+		Append (result, entries [i]);
+	}
+	result.insert (result.end (), names.begin (), names.end ());
+
+	for (const auto i : order) {
+		Pad (result, alignment);
+		result.insert (result.end (), stored [i].begin (), stored [i].end ());
+	}
+
+	return result;
+}
+}
+}
@@ -0,0 +1,56 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+
+#include "TestFile.h"
+
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+
+namespace AMD {
+namespace Test {
+///////////////////////////////////////////////////////////////////////////////
+std::vector<std::uint8_t> ReadFileBytes (const char* path)
+{
+	std::ifstream input (path, std::ios::binary);
+	if (!input) {
+		throw std::runtime_error ("Could not open file for reading");
+	}
+
+	return std::vector<std::uint8_t> (std::istreambuf_iterator<char> (input),
+		std::istreambuf_iterator<char> ());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void WriteFileBytes (const char* path, const std::vector<std::uint8_t>& bytes)
+{
+	std::ofstream output (path, std::ios::binary | std::ios::trunc);
+	output.write (reinterpret_cast<const char*> (bytes.data ()),
+		static_cast<std::streamsize> (bytes.size ()));
+
+	if (!output) {
+		throw std::runtime_error ("Could not write file");
+	}
+}
+}
+}
@@ -0,0 +1,143 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+
+#include "TestImage.h"
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+namespace AMD {
+namespace Test {
+///////////////////////////////////////////////////////////////////////////////
+std::vector<std::uint8_t> CreateTestImage (const int width, const int height,
+	const bool withAlpha, const unsigned int seed)
+{
+	std::mt19937 random (seed);
+	std::uniform_real_distribution<float> unit (0, 1);
+	std::normal_distribution<float> noise (0, 2);
+
+	// A few low frequency waves per channel
+	float frequencies [3][4][2], phases [3][4];
+	for (int c = 0; c < 3; ++c) {
+		for (int w = 0; w < 4; ++w) {
+			frequencies [c][w][0] = unit (random) * 12 / width;
+			frequencies [c][w][1] = unit (random) * 12 / height;
+			phases [c][w] = unit (random) * 6.283f;
+		}
+	}
+
+	struct Circle
+	{
+		float x, y, radius;
+		float color [4];
+	};
+
+	std::vector<Circle> circles (12);
+	for (auto& circle : circles) {
+		circle.x = unit (random) * width;
+		circle.y = unit (random) * height;
+		circle.radius = (0.03f + unit (random) * 0.12f) * (std::min) (width, height);
+		for (auto& c : circle.color) {
+			c = unit (random) * 255;
+		}
+	}
+
+	std::vector<std::uint8_t> result (static_cast<std::size_t> (width) * height * 4);
+
+	for (int y = 0; y < height; ++y) {
+		for (int x = 0; x < width; ++x) {
+			float color [4];
+			for (int c = 0; c < 3; ++c) {
+				float value = 128;
+				for (int w = 0; w < 4; ++w) {
+					value += 30 * std::sin (6.283f * (frequencies [c][w][0] * x +
+						frequencies [c][w][1] * y) + phases [c][w]);
+				}
+				color [c] = value;
+			}
+
+			// Soft horizontal alpha ramp
+			color [3] = withAlpha ? 255.0f * x / width : 255;
+
+			for (const auto& circle : circles) {
+				const float dx = x - circle.x, dy = y - circle.y;
+				if (dx * dx + dy * dy < circle.radius * circle.radius) {
+					for (int c = 0; c < 3; ++c) {
+						color [c] = circle.color [c];
+					}
+
+					if (withAlpha) {
+						color [3] = circle.color [3] < 128 ? 0.0f : 255.0f;
+					}
+				}
+			}
+
+			std::uint8_t* pixel = result.data () + (static_cast<std::size_t> (y) * width + x) * 4;
+			for (int c = 0; c < 4; ++c) {
+				const float value = (c < 3) ? color [c] + noise (random) : color [c];
+				pixel [c] = static_cast<std::uint8_t> (
+					(std::min) (255.0f, (std::max) (0.0f, value + 0.5f)));
+			}
+		}
+	}
+
+	return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::vector<std::uint8_t> CreateRandomBytes (const std::size_t size,
+	const unsigned int seed)
+{
+	std::mt19937 random (seed);
+	std::vector<std::uint8_t> result (size);
+	for (auto& b : result) {
+		b = static_cast<std::uint8_t> (random ());
+	}
+
+	return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+double ComputePsnr (const std::vector<std::uint8_t>& reference,
+	const std::vector<std::uint8_t>& image, const int channelCount)
+{
+	double sum = 0;
+	std::size_t count = 0;
+
+	for (std::size_t i = 0; i < reference.size (); i += 4) {
+		for (int c = 0; c < channelCount; ++c) {
+			const double d = static_cast<double> (reference [i + c]) - image [i + c];
+			sum += d * d;
+			++count;
+		}
+	}
+
+	if (sum == 0) {
+		return 99;
+	}
+
+	return 10 * std::log10 (255.0 * 255.0 / (sum / count));
+}
+}
+}
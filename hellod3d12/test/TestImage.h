@@ -0,0 +1,57 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+
+#ifndef ANTERU_D3D12_SAMPLE_TEST_TESTIMAGE_H_
+#define ANTERU_D3D12_SAMPLE_TEST_TESTIMAGE_H_
+
+#include <cstdint>
+#include <vector>
+
+namespace AMD {
+namespace Test {
+///////////////////////////////////////////////////////////////////////////////
+/**
+A synthetic RGBA8 image which compresses roughly like a photo: smooth
+gradients, a few hard edged shapes and a little noise. With withAlpha, alpha
+has soft and hard transitions as well, otherwise it is 255.
+*/
+std::vector<std::uint8_t> CreateTestImage (const int width, const int height,
+	const bool withAlpha, const unsigned int seed = 1);
+
+/**
+Uniformly random bytes.
+*/
+std::vector<std::uint8_t> CreateRandomBytes (const std::size_t size,
+	const unsigned int seed = 1);
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Peak signal to noise ratio in dB over the first channelCount channels of
+two RGBA8 images of the same size.
+*/
+double ComputePsnr (const std::vector<std::uint8_t>& reference,
+	const std::vector<std::uint8_t>& image, const int channelCount);
+}
+}
+
+#endif
@@ -0,0 +1,368 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+
+#include "Test.h"
+
+#include "FakeD3D12.h"
+#include "FakeImageIO.h"
+#include "TestImage.h"
+#include "TextureCache.h"
+
+#include <atomic>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace AMD;
+using Microsoft::WRL::ComPtr;
+
+namespace {
+///////////////////////////////////////////////////////////////////////////////
+/**
+Keeps all loads pending until the test completes them.
+*/
+class ManualFactory : public TextureFactory
+{
+public:
+	void Create (const void* data, const std::size_t, const TextureLoadOptions&,
+		Callback done) override
+	{
+		std::lock_guard<std::mutex> lock (mutex_);
+		pending_.push_back (Load { static_cast<const char*> (data), done });
+	}
+
+	void Destroy (const SharedTexture&) override
+	{
+		++destroyCount;
+	}
+
+	int GetPendingCount ()
+	{
+		std::lock_guard<std::mutex> lock (mutex_);
+		return static_cast<int> (pending_.size ());
+	}
+
+	/**
+	Complete the oldest load. Data starting with '!' fails.
+	*/
+	void CompleteNext ()
+	{
+		Load load;
+		{
+			std::lock_guard<std::mutex> lock (mutex_);
+			load = pending_.front ();
+			pending_.erase (pending_.begin ());
+		}
+
+		if (load.data [0] == '!') {
+			load.done (nullptr, std::make_exception_ptr (std::runtime_error ("Bad data")));
+			return;
+		}
+
+		SharedTexture texture = {};
+		texture.descriptorIndex = ++createCount;
+		load.done (&texture, nullptr);
+	}
+
+	std::atomic<int> createCount { 0 };
+	std::atomic<int> destroyCount { 0 };
+
+private:
+	struct Load
+	{
+		const char* data;
+		Callback done;
+	};
+
+	std::mutex mutex_;
+	std::vector<Load> pending_;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Completes inside Create, as a factory does if the texture was loaded already.
+*/
+class ImmediateFactory : public TextureFactory
+{
+public:
+	void Create (const void*, const std::size_t, const TextureLoadOptions&,
+		Callback done) override
+	{
+		SharedTexture texture = {};
+		texture.descriptorIndex = ++createCount;
+		done (&texture, nullptr);
+	}
+
+	void Destroy (const SharedTexture&) override
+	{
+		++destroyCount;
+	}
+
+	std::atomic<int> createCount { 0 };
+	std::atomic<int> destroyCount { 0 };
+};
+
+const char IMAGE_A [] = "image a";
+const char IMAGE_A_COPY [] = "image a";
+const char IMAGE_B [] = "image b";
+const char BAD_IMAGE [] = "!bad";
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TEST (SameContentSharesLoad)
+{
+	ManualFactory factory;
+	TextureCache cache (&factory);
+
+	auto a = cache.Acquire (IMAGE_A, sizeof (IMAGE_A));
+	auto copy = cache.Acquire (IMAGE_A_COPY, sizeof (IMAGE_A_COPY));
+
+	CHECK_EQUAL (1, factory.GetPendingCount ());
+	CHECK_EQUAL (1, cache.GetTextureCount ());
+	CHECK (!a.IsReady ());
+
+	factory.CompleteNext ();
+
+	CHECK (a.IsReady ());
+	CHECK (copy.IsReady ());
+	CHECK_EQUAL (1, a.Get ().descriptorIndex);
+	CHECK_EQUAL (1, copy.Get ().descriptorIndex);
+
+	// Different content or options are different textures
+	TextureLoadOptions options;
+	options.maximumDimension = 16;
+	auto b = cache.Acquire (IMAGE_B, sizeof (IMAGE_B));
+	auto small = cache.Acquire (IMAGE_A, sizeof (IMAGE_A), options);
+	CHECK_EQUAL (2, factory.GetPendingCount ());
+	CHECK_EQUAL (3, cache.GetTextureCount ());
+
+	factory.CompleteNext ();
+	factory.CompleteNext ();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TEST (LastReferenceDestroys)
+{
+	ManualFactory factory;
+	TextureCache cache (&factory);
+
+	auto a = cache.Acquire (IMAGE_A, sizeof (IMAGE_A));
+	factory.CompleteNext ();
+	auto copy = a;
+
+	a = TextureReference ();
+	CHECK_EQUAL (0, factory.destroyCount.load ());
+	CHECK_EQUAL (1, cache.GetTextureCount ());
+
+	copy = TextureReference ();
+	CHECK_EQUAL (1, factory.destroyCount.load ());
+	CHECK_EQUAL (0, cache.GetTextureCount ());
+
+	// Loaded again from scratch
+	a = cache.Acquire (IMAGE_A, sizeof (IMAGE_A));
+	CHECK_EQUAL (1, factory.GetPendingCount ());
+	factory.CompleteNext ();
+	CHECK_EQUAL (2, a.Get ().descriptorIndex);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Dropping the last reference to a texture which is still loading must not
+wait for the load; the texture is destroyed once it arrives.
+*/
+TEST (DroppingPendingLoadDoesNotBlock)
+{
+	ManualFactory factory;
+	TextureCache cache (&factory);
+
+	{
+		auto a = cache.Acquire (IMAGE_A, sizeof (IMAGE_A));
+	}
+
+	CHECK_EQUAL (0, cache.GetTextureCount ());
+	CHECK_EQUAL (1, factory.GetPendingCount ());
+	CHECK_EQUAL (0, factory.destroyCount.load ());
+
+	// A new request does not reuse the abandoned load
+	auto again = cache.Acquire (IMAGE_A, sizeof (IMAGE_A));
+	CHECK_EQUAL (2, factory.GetPendingCount ());
+
+	factory.CompleteNext ();
+	CHECK_EQUAL (1, factory.destroyCount.load ());
+	CHECK (!again.IsReady ());
+
+	factory.CompleteNext ();
+	CHECK (again.IsReady ());
+	CHECK_EQUAL (1, factory.destroyCount.load ());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TEST (FailedLoadsAreRetried)
+{
+	ManualFactory factory;
+	TextureCache cache (&factory);
+
+	auto bad = cache.Acquire (BAD_IMAGE, sizeof (BAD_IMAGE));
+	factory.CompleteNext ();
+
+	CHECK (bad.IsReady ());
+	CHECK_THROWS (bad.Get ());
+
+	auto retry = cache.Acquire (BAD_IMAGE, sizeof (BAD_IMAGE));
+	CHECK_EQUAL (1, factory.GetPendingCount ());
+	CHECK (!retry.IsReady ());
+	factory.CompleteNext ();
+	CHECK_THROWS (retry.Get ());
+
+	// Failed loads have nothing to destroy
+	bad = TextureReference ();
+	retry = TextureReference ();
+	CHECK_EQUAL (0, factory.destroyCount.load ());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TEST (GetWaitsForLoad)
+{
+	ManualFactory factory;
+	TextureCache cache (&factory);
+
+	auto a = cache.Acquire (IMAGE_A, sizeof (IMAGE_A));
+
+	std::thread completer ([&factory] () {
+		std::this_thread::sleep_for (std::chrono::milliseconds (20));
+		factory.CompleteNext ();
+	});
+
+	CHECK_EQUAL (1, a.Get ().descriptorIndex);
+	completer.join ();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TEST (ReferencesOutliveCache)
+{
+	ManualFactory factory;
+	TextureReference a;
+
+	{
+		TextureCache cache (&factory);
+		a = cache.Acquire (IMAGE_A, sizeof (IMAGE_A));
+		factory.CompleteNext ();
+	}
+
+	CHECK_EQUAL (1, a.Get ().descriptorIndex);
+	CHECK_EQUAL (0, factory.destroyCount.load ());
+
+	a = TextureReference ();
+	CHECK_EQUAL (1, factory.destroyCount.load ());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TEST (ConcurrentAcquire)
+{
+	ImmediateFactory factory;
+
+	{
+		TextureCache cache (&factory);
+		std::vector<TextureReference> references (32);
+
+		std::vector<std::thread> threads;
+		for (int i = 0; i < 32; ++i) {
+			threads.emplace_back ([&, i] () {
+				const char* image = (i % 2) ? IMAGE_A : IMAGE_A_COPY;
+				for (int j = 0; j < 100; ++j) {
+					references [i] = cache.Acquire (image, sizeof (IMAGE_A));
+					references [i].Get ();
+				}
+			});
+		}
+
+		for (auto& thread : threads) {
+			thread.join ();
+		}
+
+		CHECK_EQUAL (1, cache.GetTextureCount ());
+		for (const auto& reference : references) {
+			CHECK_EQUAL (references [0].Get ().descriptorIndex, reference.Get ().descriptorIndex);
+		}
+	}
+
+	// Every texture that was created was destroyed exactly once
+	CHECK_EQUAL (factory.createCount.load (), factory.destroyCount.load ());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+The D3D12 factory against the fake device, through a real AssetLoader.
+*/
+TEST (LoadsThroughD3D12Factory)
+{
+	ComPtr<Test::FakeDevice> device;
+	device.Attach (new Test::FakeDevice);
+	ComPtr<ID3D12DescriptorHeap> descriptorHeap;
+	descriptorHeap.Attach (new ID3D12DescriptorHeap);
+
+	const auto a = Test::EncodeFakeImage (Test::CreateTestImage (32, 32, false, 1), 32, 32);
+	const auto b = Test::EncodeFakeImage (Test::CreateTestImage (16, 8, false, 2), 16, 8);
+	const auto c = Test::EncodeFakeImage (Test::CreateTestImage (8, 8, false, 3), 8, 8);
+	const auto bad = std::vector<std::uint8_t> (a.begin (), a.begin () + 20);
+
+	AssetLoader loader (device.Get ());
+	D3D12TextureFactory factory (device.Get (), &loader, descriptorHeap.Get (), 10, 2);
+
+	{
+		TextureCache cache (&factory);
+
+		auto first = cache.Acquire (a.data (), a.size ());
+		auto second = cache.Acquire (b.data (), b.size ());
+
+		const auto& texture = first.Get ();
+		CHECK (texture.resource != nullptr);
+		CHECK_EQUAL (DXGI_FORMAT_BC1_UNORM_SRGB, texture.format);
+		CHECK_EQUAL (6, texture.mipLevelCount);
+		CHECK_EQUAL (6, texture.resource->GetDesc ().MipLevels);
+
+		// Lowest slots first
+		CHECK ((first.Get ().descriptorIndex == 10 && second.Get ().descriptorIndex == 11) ||
+			(first.Get ().descriptorIndex == 11 && second.Get ().descriptorIndex == 10));
+
+		// Both descriptors are in use
+		auto third = cache.Acquire (c.data (), c.size ());
+		CHECK_THROWS (third.Get ());
+
+		// Dropping a texture returns its descriptor
+		const auto freed = second.Get ().descriptorIndex;
+		second = TextureReference ();
+		auto fourth = cache.Acquire (b.data (), b.size (), TextureLoadOptions ());
+		CHECK_EQUAL (freed, fourth.Get ().descriptorIndex);
+
+		auto failed = cache.Acquire (bad.data (), bad.size ());
+		CHECK_THROWS (failed.Get ());
+
+		// Drop while loading, the cache waits for it on destruction
+		first = TextureReference ();
+		cache.Acquire (c.data (), c.size ());
+	}
+
+	CHECK_EQUAL (5, device->GetTextureCount ());
+}
@@ -0,0 +1,343 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+
+#include "Test.h"
+
+#include "TestFile.h"
+#include "TextureContainer.h"
+
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <vector>
+
+using namespace AMD;
+
+namespace {
+const char CONTAINER_PATH [] = "TextureContainerTest.atex";
+
+///////////////////////////////////////////////////////////////////////////////
+std::uint8_t GetPattern (const int x, const int y, const int c, const int subresource)
+{
+	return static_cast<std::uint8_t> (x * 7 + y * 11 + c * 31 + subresource * 57);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Write a container with the given rows per subresource, filled with
+GetPattern. rowSizes are in bytes, rowCounts in rows or block rows.
+*/
+void WritePatternContainer (const DXGI_FORMAT format, const int width, const int height,
+	const int arraySize, const int mipLevels,
+	const std::function<void (int, int*, int*)>& getRows)
+{
+	const int subresourceCount = arraySize * mipLevels;
+	std::vector<std::vector<std::uint8_t>> data (subresourceCount);
+	std::vector<TextureContainerSource> sources (subresourceCount);
+
+	for (int i = 0; i < subresourceCount; ++i) {
+		int rowSize, rowCount;
+		getRows (i % mipLevels, &rowSize, &rowCount);
+
+		data [i].resize (static_cast<std::size_t> (rowSize) * rowCount);
+		for (int y = 0; y < rowCount; ++y) {
+			for (int x = 0; x < rowSize; ++x) {
+				data [i][y * rowSize + x] = GetPattern (x, y, 0, i);
+			}
+		}
+
+		sources [i].data = data [i].data ();
+		sources [i].rowPitch = rowSize;
+		sources [i].width = (std::max) (width >> (i % mipLevels), 1);
+		sources [i].height = (std::max) (height >> (i % mipLevels), 1);
+		sources [i].rowCount = rowCount;
+		sources [i].rowSize = rowSize;
+	}
+
+	WriteTextureContainer (CONTAINER_PATH, format, width, height,
+		arraySize, mipLevels, sources.data ());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void WriteRgbaContainer ()
+{
+	// 2 slices of 19x10 with 5 mip levels
+	WritePatternContainer (DXGI_FORMAT_R8G8B8A8_UNORM, 19, 10, 2, 5,
+		[] (const int level, int* rowSize, int* rowCount) {
+			*rowSize = (std::max) (19 >> level, 1) * 4;
+			*rowCount = (std::max) (10 >> level, 1);
+		});
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void CheckPattern (const TextureContainer& container)
+{
+	for (std::uint32_t i = 0; i < container.GetHeader ().subresourceCount; ++i) {
+		const auto& subresource = container.GetSubresource (i);
+		const auto data = container.GetSubresourceData (i);
+
+		for (std::uint32_t y = 0; y < subresource.rowCount; ++y) {
+			const auto row = static_cast<const std::uint8_t*> (data.pData) + y * data.RowPitch;
+			for (std::uint32_t x = 0; x < subresource.rowSize; ++x) {
+				CHECK_EQUAL (GetPattern (x, y, 0, i), row [x]);
+			}
+		}
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Apply corrupt to a valid container and check that loading it throws.
+*/
+void CheckRejected (const std::function<void (std::vector<std::uint8_t>&)>& corrupt)
+{
+	WriteRgbaContainer ();
+	auto bytes = Test::ReadFileBytes (CONTAINER_PATH);
+	corrupt (bytes);
+	Test::WriteFileBytes (CONTAINER_PATH, bytes);
+
+	CHECK_THROWS (TextureContainer container (CONTAINER_PATH));
+}
+
+TextureContainerHeader& GetHeader (std::vector<std::uint8_t>& bytes)
+{
+	return *reinterpret_cast<TextureContainerHeader*> (bytes.data ());
+}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TEST (RoundTrip)
+{
+	WriteRgbaContainer ();
+	TextureContainer container (CONTAINER_PATH);
+
+	const auto& header = container.GetHeader ();
+	CHECK_EQUAL (DXGI_FORMAT_R8G8B8A8_UNORM, header.format);
+	CHECK_EQUAL (19, header.width);
+	CHECK_EQUAL (10, header.height);
+	CHECK_EQUAL (2, header.arraySize);
+	CHECK_EQUAL (5, header.mipLevels);
+	CHECK_EQUAL (10, header.subresourceCount);
+	CHECK_EQUAL (0, header.dataOffset % D3D12_TEXTURE_DATA_PLACEMENT_ALIGNMENT);
+
+	// Slice 1, mip 4 is 1x1
+	CHECK_EQUAL (1, container.GetSubresource (9).width);
+	CHECK_EQUAL (1, container.GetSubresource (9).height);
+	CHECK_EQUAL (256, container.GetSubresource (9).rowPitch);
+
+	const auto desc = container.GetResourceDesc ();
+	CHECK_EQUAL (19, desc.Width);
+	CHECK_EQUAL (2, desc.DepthOrArraySize);
+	CHECK_EQUAL (5, desc.MipLevels);
+
+	CheckPattern (container);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TEST (BlockCompressedRoundTrip)
+{
+	// 13x7 BC1 is 4x2 blocks, mip 1 (6x3) is 2x1 blocks, mip 2 (3x1) 1x1
+	WritePatternContainer (DXGI_FORMAT_BC1_UNORM, 13, 7, 1, 3,
+		[] (const int level, int* rowSize, int* rowCount) {
+			*rowSize = (((std::max) (13 >> level, 1) + 3) / 4) * 8;
+			*rowCount = ((std::max) (7 >> level, 1) + 3) / 4;
+		});
+
+	TextureContainer container (CONTAINER_PATH);
+	CHECK_EQUAL (16, container.GetSubresource (0).width);
+	CHECK_EQUAL (8, container.GetSubresource (0).height);
+	CHECK_EQUAL (2, container.GetSubresource (0).rowCount);
+	CHECK_EQUAL (4, container.GetSubresource (2).width);
+	CHECK_EQUAL (1, container.GetSubresource (2).rowCount);
+
+	CheckPattern (container);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TEST (WriteRejectsMismatchedSources)
+{
+	CHECK_THROWS (WritePatternContainer (DXGI_FORMAT_R8G8B8A8_UNORM, 8, 8, 1, 1,
+		[] (const int, int* rowSize, int* rowCount) {
+			*rowSize = 8 * 3;
+			*rowCount = 8;
+		}));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TEST (RejectsTruncated)
+{
+	CheckRejected ([] (std::vector<std::uint8_t>& bytes) {
+		bytes.resize (sizeof (TextureContainerHeader) - 1);
+	});
+
+	CheckRejected ([] (std::vector<std::uint8_t>& bytes) {
+		bytes.resize (bytes.size () - 1);
+	});
+
+	CheckRejected ([] (std::vector<std::uint8_t>& bytes) {
+		bytes.resize (static_cast<std::size_t> (GetHeader (bytes).dataOffset));
+	});
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TEST (RejectsBadMagicAndVersion)
+{
+	CheckRejected ([] (std::vector<std::uint8_t>& bytes) {
+		GetHeader (bytes).magic [0] = 'X';
+	});
+
+	CheckRejected ([] (std::vector<std::uint8_t>& bytes) {
+		GetHeader (bytes).version = 2;
+	});
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TEST (RejectsOverflowingOffsets)
+{
+	// dataOffset + dataSize wraps around to a small value
+	CheckRejected ([] (std::vector<std::uint8_t>& bytes) {
+		auto& header = GetHeader (bytes);
+		header.dataOffset = ~static_cast<std::uint64_t> (0) - 255;
+		header.dataSize = 512;
+	});
+
+	CheckRejected ([] (std::vector<std::uint8_t>& bytes) {
+		GetHeader (bytes).dataSize = ~static_cast<std::uint64_t> (0);
+	});
+
+	// Header and subresource table overlap the data
+	CheckRejected ([] (std::vector<std::uint8_t>& bytes) {
+		GetHeader (bytes).dataOffset = sizeof (TextureContainerHeader);
+	});
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TEST (RejectsBadCounts)
+{
+	// 65536 * 65536 is 0 in 32 bit
+	CheckRejected ([] (std::vector<std::uint8_t>& bytes) {
+		auto& header = GetHeader (bytes);
+		header.arraySize = 65536;
+		header.mipLevels = 65536;
+		header.subresourceCount = 0;
+	});
+
+	CheckRejected ([] (std::vector<std::uint8_t>& bytes) {
+		GetHeader (bytes).subresourceCount = 9;
+	});
+
+	// 19x10 has at most 5 mip levels
+	CheckRejected ([] (std::vector<std::uint8_t>& bytes) {
+		auto& header = GetHeader (bytes);
+		header.arraySize = 1;
+		header.mipLevels = 10;
+	});
+
+	CheckRejected ([] (std::vector<std::uint8_t>& bytes) {
+		GetHeader (bytes).arraySize = 0;
+	});
+
+	CheckRejected ([] (std::vector<std::uint8_t>& bytes) {
+		GetHeader (bytes).width = 0;
+	});
+
+	CheckRejected ([] (std::vector<std::uint8_t>& bytes) {
+		GetHeader (bytes).height = D3D12_REQ_TEXTURE2D_U_OR_V_DIMENSION + 1;
+	});
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TEST (RejectsBadFormat)
+{
+	CheckRejected ([] (std::vector<std::uint8_t>& bytes) {
+		GetHeader (bytes).format = DXGI_FORMAT_UNKNOWN;
+	});
+
+	CheckRejected ([] (std::vector<std::uint8_t>& bytes) {
+		GetHeader (bytes).format = DXGI_FORMAT_D24_UNORM_S8_UINT;
+	});
+
+	CheckRejected ([] (std::vector<std::uint8_t>& bytes) {
+		GetHeader (bytes).format = 0x7FFFFFFF;
+	});
+
+	// Valid, but the subresource table was written for 4 byte texels
+	CheckRejected ([] (std::vector<std::uint8_t>& bytes) {
+		GetHeader (bytes).format = DXGI_FORMAT_R16G16B16A16_FLOAT;
+	});
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TEST (RejectsBadSubresource)
+{
+	CheckRejected ([] (std::vector<std::uint8_t>& bytes) {
+		auto subresources = reinterpret_cast<TextureContainerSubresource*> (
+			bytes.data () + sizeof (TextureContainerHeader));
+		subresources [3].offset += D3D12_TEXTURE_DATA_PLACEMENT_ALIGNMENT;
+	});
+
+	CheckRejected ([] (std::vector<std::uint8_t>& bytes) {
+		auto subresources = reinterpret_cast<TextureContainerSubresource*> (
+			bytes.data () + sizeof (TextureContainerHeader));
+		subresources [0].rowCount = 0xFFFFFFFF;
+	});
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Reads the output of tools/textureToContainer.py, written by
+writeToolContainer.py. ctest sets the path when Python with numpy and Pillow
+is available, otherwise there is nothing to check.
+*/
+TEST (ReadsToolOutput)
+{
+	const char* path = std::getenv ("TEXTURE_CONTAINER_TOOL_OUTPUT");
+	if (path == nullptr) {
+		return;
+	}
+
+	TextureContainer container (path);
+
+	const auto& header = container.GetHeader ();
+	CHECK_EQUAL (DXGI_FORMAT_R8G8B8A8_UNORM_SRGB, header.format);
+	CHECK_EQUAL (37, header.width);
+	CHECK_EQUAL (23, header.height);
+	CHECK_EQUAL (1, header.arraySize);
+	CHECK_EQUAL (6, header.mipLevels);
+
+	const auto data = container.GetSubresourceData (0);
+	for (int y = 0; y < 23; ++y) {
+		const auto row = static_cast<const std::uint8_t*> (data.pData) + y * data.RowPitch;
+		for (int x = 0; x < 37; ++x) {
+			CHECK_EQUAL ((x * 7) % 256, row [x * 4 + 0]);
+			CHECK_EQUAL ((y * 11) % 256, row [x * 4 + 1]);
+			CHECK_EQUAL (((x + y) * 3) % 256, row [x * 4 + 2]);
+			CHECK_EQUAL (255, row [x * 4 + 3]);
+		}
+	}
+
+	// The last mip is an opaque average
+	const auto last = static_cast<const std::uint8_t*> (container.GetSubresourceData (5).pData);
+	CHECK_EQUAL (1, container.GetSubresource (5).width);
+	CHECK_EQUAL (255, last [3]);
+}
@@ -0,0 +1,276 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+
+#include "Test.h"
+
+#include "TextureUploadBatch.h"
+
+#include <cstring>
+#include <vector>
+
+using namespace AMD;
+
+namespace {
+///////////////////////////////////////////////////////////////////////////////
+/**
+A resource which only has a description. Buffers are backed by memory, so
+the batch can map and fill them.
+*/
+class FakeResource : public ID3D12Resource
+{
+public:
+	explicit FakeResource (const D3D12_RESOURCE_DESC& desc)
+		: desc_ (desc)
+	{
+		if (desc.Dimension == D3D12_RESOURCE_DIMENSION_BUFFER) {
+			memory_.resize (static_cast<std::size_t> (desc.Width));
+		}
+	}
+
+	HRESULT Map (UINT, const D3D12_RANGE*, void** data) override
+	{
+		*data = memory_.data ();
+		return S_OK;
+	}
+
+	D3D12_RESOURCE_DESC GetDesc () override
+	{
+		return desc_;
+	}
+
+	const std::vector<unsigned char>& GetMemory () const
+	{
+		return memory_;
+	}
+
+private:
+	D3D12_RESOURCE_DESC desc_;
+	std::vector<unsigned char> memory_;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+class RecordingCommandList : public ID3D12GraphicsCommandList
+{
+public:
+	void CopyTextureRegion (const D3D12_TEXTURE_COPY_LOCATION* destination,
+		UINT, UINT, UINT, const D3D12_TEXTURE_COPY_LOCATION* source,
+		const D3D12_BOX*) override
+	{
+		copies.push_back (Copy { destination->pResource,
+			destination->SubresourceIndex, source->pResource, source->PlacedFootprint });
+	}
+
+	void ResourceBarrier (UINT count, const D3D12_RESOURCE_BARRIER*) override
+	{
+		++barrierCalls;
+		barrierCount += count;
+	}
+
+	struct Copy
+	{
+		ID3D12Resource* resource;
+		UINT subresource;
+		ID3D12Resource* source;
+		D3D12_PLACED_SUBRESOURCE_FOOTPRINT footprint;
+	};
+
+	std::vector<Copy> copies;
+	int barrierCalls = 0;
+	UINT barrierCount = 0;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+D3D12_RESOURCE_DESC CreateTextureDesc (const DXGI_FORMAT format,
+	const UINT64 width, const UINT height)
+{
+	D3D12_RESOURCE_DESC desc = {};
+	desc.Dimension = D3D12_RESOURCE_DIMENSION_TEXTURE2D;
+	desc.Format = format;
+	desc.Width = width;
+	desc.Height = height;
+	desc.DepthOrArraySize = 1;
+	desc.MipLevels = 1;
+	desc.SampleDesc.Count = 1;
+	return desc;
+}
+
+D3D12_RESOURCE_DESC CreateBufferDesc (const UINT64 size)
+{
+	D3D12_RESOURCE_DESC desc = {};
+	desc.Dimension = D3D12_RESOURCE_DIMENSION_BUFFER;
+	desc.Format = DXGI_FORMAT_UNKNOWN;
+	desc.Width = size;
+	desc.Height = 1;
+	desc.DepthOrArraySize = 1;
+	desc.MipLevels = 1;
+	desc.SampleDesc.Count = 1;
+	return desc;
+}
+
+D3D12_SUBRESOURCE_DATA CreateSubresource (const std::vector<unsigned char>& data,
+	const LONG_PTR rowPitch)
+{
+	D3D12_SUBRESOURCE_DATA result;
+	result.pData = data.data ();
+	result.RowPitch = rowPitch;
+	result.SlicePitch = static_cast<LONG_PTR> (data.size ());
+	return result;
+}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TEST (RecordsAllTextures)
+{
+	FakeResource first (CreateTextureDesc (DXGI_FORMAT_R8G8B8A8_UNORM, 16, 4));
+	FakeResource second (CreateTextureDesc (DXGI_FORMAT_R8_UNORM, 3, 2));
+
+	std::vector<unsigned char> firstData (16 * 4 * 4), secondData (3 * 2);
+	for (std::size_t i = 0; i < firstData.size (); ++i) {
+		firstData [i] = static_cast<unsigned char> (i);
+	}
+	for (std::size_t i = 0; i < secondData.size (); ++i) {
+		secondData [i] = static_cast<unsigned char> (200 + i);
+	}
+
+	TextureUploadBatch batch;
+	CHECK (batch.IsEmpty ());
+
+	const auto firstSource = CreateSubresource (firstData, 64);
+	batch.Add (&first, &firstSource, 1, D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE);
+	const auto secondSource = CreateSubresource (secondData, 3);
+	batch.Add (&second, &secondSource, 1, D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE);
+
+	// The second texture starts at the next placement boundary after the
+	// 4 rows of the first one
+	CHECK_EQUAL (1024 + 256 + 3, batch.GetUploadSize ());
+
+	FakeResource upload (CreateBufferDesc (4096));
+	RecordingCommandList commandList;
+	batch.Record (&commandList, &upload, 512);
+
+	CHECK (batch.IsEmpty ());
+	CHECK_EQUAL (0, batch.GetUploadSize ());
+	CHECK_EQUAL (2, commandList.copies.size ());
+	CHECK_EQUAL (512, commandList.copies [0].footprint.Offset);
+	CHECK_EQUAL (512 + 1024, commandList.copies [1].footprint.Offset);
+	CHECK_EQUAL (1, commandList.barrierCalls);
+	CHECK_EQUAL (2, commandList.barrierCount);
+
+	const auto& memory = upload.GetMemory ();
+	CHECK (std::memcmp (memory.data () + 512, firstData.data (), 64) == 0);
+	CHECK (std::memcmp (memory.data () + 512 + 3 * 256, firstData.data () + 3 * 64, 64) == 0);
+	CHECK (std::memcmp (memory.data () + 512 + 1024, secondData.data (), 3) == 0);
+	CHECK (std::memcmp (memory.data () + 512 + 1024 + 256, secondData.data () + 3, 3) == 0);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TEST (FailedAddLeavesBatchUnchanged)
+{
+	FakeResource texture (CreateTextureDesc (DXGI_FORMAT_R8G8B8A8_UNORM, 4, 4));
+	// Planar formats are not supported by the footprint computation
+	FakeResource planar (CreateTextureDesc (DXGI_FORMAT_D24_UNORM_S8_UINT, 4, 4));
+	FakeResource buffer (CreateBufferDesc (64));
+
+	std::vector<unsigned char> data (4 * 4 * 4, 7);
+	const auto source = CreateSubresource (data, 16);
+
+	TextureUploadBatch batch;
+	batch.Add (&texture, &source, 1, D3D12_RESOURCE_STATE_COMMON);
+	const auto size = batch.GetUploadSize ();
+
+	CHECK_THROWS (batch.Add (&planar, &source, 1, D3D12_RESOURCE_STATE_COMMON));
+	CHECK_THROWS (batch.Add (&buffer, &source, 1, D3D12_RESOURCE_STATE_COMMON));
+	// More subresources than the texture has
+	const D3D12_SUBRESOURCE_DATA sources [2] = { source, source };
+	CHECK_THROWS (batch.Add (&texture, sources, 2, D3D12_RESOURCE_STATE_COMMON));
+
+	CHECK_EQUAL (size, batch.GetUploadSize ());
+
+	// The batch is still usable, and only records the texture that was added
+	batch.Add (&texture, &source, 1, D3D12_RESOURCE_STATE_COMMON);
+
+	FakeResource upload (CreateBufferDesc (batch.GetUploadSize ()));
+	RecordingCommandList commandList;
+	batch.Record (&commandList, &upload, 0);
+
+	CHECK_EQUAL (2, commandList.copies.size ());
+	CHECK_EQUAL (1, commandList.barrierCalls);
+	CHECK_EQUAL (2, commandList.barrierCount);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Staged textures are copied from their own buffer, without going through
+the batch's staging memory, and share the barrier call with the others.
+*/
+TEST (StagedTexturesOnlyRecordCopies)
+{
+	FakeResource texture (CreateTextureDesc (DXGI_FORMAT_R8G8B8A8_UNORM, 4, 4));
+	FakeResource staged (CreateTextureDesc (DXGI_FORMAT_R8G8B8A8_UNORM, 30, 2));
+	FakeResource stagedUpload (CreateBufferDesc (512 + 256 + 120));
+
+	D3D12_PLACED_SUBRESOURCE_FOOTPRINT layout = {};
+	layout.Offset = 512;
+	layout.Footprint.Format = DXGI_FORMAT_R8G8B8A8_UNORM;
+	layout.Footprint.Width = 30;
+	layout.Footprint.Height = 2;
+	layout.Footprint.Depth = 1;
+	layout.Footprint.RowPitch = 256;
+
+	TextureUploadBatch batch;
+	batch.AddStaged (&staged, &stagedUpload, layout, D3D12_RESOURCE_STATE_COMMON);
+	CHECK (!batch.IsEmpty ());
+	CHECK_EQUAL (0, batch.GetUploadSize ());
+
+	// Nothing to copy into an upload buffer
+	RecordingCommandList stagedOnly;
+	batch.Record (&stagedOnly, nullptr, 0);
+	CHECK (batch.IsEmpty ());
+	CHECK_EQUAL (1, stagedOnly.copies.size ());
+	CHECK (stagedOnly.copies [0].source == &stagedUpload);
+	CHECK_EQUAL (512, stagedOnly.copies [0].footprint.Offset);
+	CHECK_EQUAL (1, stagedOnly.barrierCount);
+
+	std::vector<unsigned char> data (4 * 4 * 4, 7);
+	const auto source = CreateSubresource (data, 16);
+	batch.Add (&texture, &source, 1, D3D12_RESOURCE_STATE_COMMON);
+	batch.AddStaged (&staged, &stagedUpload, layout, D3D12_RESOURCE_STATE_COMMON);
+
+	FakeResource upload (CreateBufferDesc (batch.GetUploadSize ()));
+	RecordingCommandList commandList;
+	batch.Record (&commandList, &upload, 0);
+
+	CHECK_EQUAL (2, commandList.copies.size ());
+	CHECK (commandList.copies [0].source == &upload);
+	CHECK (commandList.copies [1].resource == &staged);
+	CHECK (commandList.copies [1].source == &stagedUpload);
+	CHECK_EQUAL (1, commandList.barrierCalls);
+	CHECK_EQUAL (2, commandList.barrierCount);
+
+	// Staged layouts must be placement aligned, and buffers can't be staged
+	layout.Offset = 256;
+	CHECK_THROWS (batch.AddStaged (&staged, &stagedUpload, layout, D3D12_RESOURCE_STATE_COMMON));
+	layout.Offset = 0;
+	CHECK_THROWS (batch.AddStaged (&stagedUpload, &stagedUpload, layout, D3D12_RESOURCE_STATE_COMMON));
+	CHECK (batch.IsEmpty ());
+}
@@ -0,0 +1,152 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#include "Test.h"
+
+#include "TripleBuffer.h"
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+
+using namespace AMD;
+
+namespace {
+///////////////////////////////////////////////////////////////////////////////
+/**
+Large enough that a torn read would show up as words which disagree.
+*/
+struct Payload
+{
+	std::uint64_t words [32];
+
+	void Fill (const std::uint64_t value)
+	{
+		for (auto& word : words) {
+			word = value;
+		}
+	}
+
+	bool IsConsistent () const
+	{
+		for (const auto word : words) {
+			if (word != words [0]) {
+				return false;
+			}
+		}
+
+		return true;
+	}
+};
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TEST (HandsOverTheLatestValue)
+{
+	TripleBuffer<int> buffer (7);
+	CHECK (!buffer.HasPending ());
+	CHECK (!buffer.Consume ());
+	CHECK_EQUAL (7, buffer.GetFrontBuffer ());
+
+	buffer.GetBackBuffer () = 1;
+	buffer.Publish ();
+	CHECK (buffer.HasPending ());
+	CHECK (buffer.Consume ());
+	CHECK_EQUAL (1, buffer.GetFrontBuffer ());
+	CHECK (!buffer.HasPending ());
+
+	// Nothing new, the front buffer stays
+	CHECK (!buffer.Consume ());
+	CHECK_EQUAL (1, buffer.GetFrontBuffer ());
+
+	// The older value is dropped
+	buffer.GetBackBuffer () = 2;
+	buffer.Publish ();
+	buffer.GetBackBuffer () = 3;
+	buffer.Publish ();
+	CHECK (buffer.Consume ());
+	CHECK_EQUAL (3, buffer.GetFrontBuffer ());
+	CHECK (!buffer.Consume ());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TEST (WriterNeverGetsTheFrontBuffer)
+{
+	TripleBuffer<int> buffer (0);
+
+	for (int i = 1; i < 100; ++i) {
+		buffer.GetBackBuffer () = i;
+		buffer.Publish ();
+
+		if (i % 3 == 0) {
+			CHECK (buffer.Consume ());
+			CHECK_EQUAL (i, buffer.GetFrontBuffer ());
+		}
+
+		CHECK (&buffer.GetBackBuffer () != &buffer.GetFrontBuffer ());
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+A writer publishes as fast as it can while a reader consumes. Every value
+the reader sees must be complete and newer than the one before. Run under
+ThreadSanitizer to check the memory ordering.
+*/
+TEST (StressConcurrentHandoff)
+{
+	const std::uint64_t publishCount = 200000;
+
+	Payload initial;
+	initial.Fill (0);
+	TripleBuffer<Payload> buffer (initial);
+
+	std::thread writer ([&] () {
+		for (std::uint64_t i = 1; i <= publishCount; ++i) {
+			buffer.GetBackBuffer ().Fill (i);
+			buffer.Publish ();
+		}
+	});
+
+	std::uint64_t last = 0, consumeCount = 0;
+	bool isConsistent = true, isIncreasing = true;
+
+	while (last < publishCount) {
+		if (!buffer.Consume ()) {
+			std::this_thread::yield ();
+			continue;
+		}
+
+		const auto& front = buffer.GetFrontBuffer ();
+		isConsistent = isConsistent && front.IsConsistent ();
+		isIncreasing = isIncreasing && front.words [0] > last;
+		last = front.words [0];
+		++consumeCount;
+	}
+
+	writer.join ();
+
+	CHECK (isConsistent);
+	CHECK (isIncreasing);
+	CHECK (consumeCount > 0);
+	CHECK (!buffer.HasPending ());
+}
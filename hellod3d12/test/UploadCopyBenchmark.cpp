@@ -0,0 +1,104 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+
+#include "Benchmark.h"
+
+#include "TestImage.h"
+#include "UploadCopy.h"
+
+#include <cstring>
+#include <vector>
+
+using namespace AMD;
+
+namespace {
+///////////////////////////////////////////////////////////////////////////////
+/**
+What MemcpySubresource from d3dx12.h does.
+*/
+void CopyRows (std::uint8_t* destination, const std::size_t destinationRowPitch,
+	const std::uint8_t* source, const std::size_t sourceRowPitch,
+	const std::size_t rowSize, const int rowCount)
+{
+	for (int y = 0; y < rowCount; ++y) {
+		std::memcpy (destination + y * destinationRowPitch,
+			source + y * sourceRowPitch, rowSize);
+	}
+}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Plain and streaming copies of a 4096x4096 RGBA texture, with matching and
+with different row pitches.
+
+The destination here is ordinary write-back memory, where the streaming copy
+is expected to lose: non-temporal stores skip the cache, and the destination
+is not read back anyway. Against a mapped upload heap, which is
+write-combined, the streaming copy is the faster one. Run this on the target
+machine to see the difference for write-back memory there.
+*/
+int main ()
+{
+	const std::size_t rowSize = 4096 * 4;
+	const int rowCount = 4096;
+	const std::size_t size = rowSize * rowCount;
+
+	const auto source = Test::CreateRandomBytes (size);
+	std::vector<std::uint8_t> destination (size + 256 * rowCount);
+
+	Test::Report ("memcpy", Test::Measure ([&] () {
+		std::memcpy (destination.data (), source.data (), size);
+	}), size);
+
+	Test::Report ("StreamingCopy", Test::Measure ([&] () {
+		StreamingCopy (destination.data (), source.data (), size);
+	}), size);
+
+	Test::Report ("Rows, same pitch (memcpy)", Test::Measure ([&] () {
+		CopyRows (destination.data (), rowSize, source.data (), rowSize, rowSize, rowCount);
+	}), size);
+
+	Test::Report ("Rows, same pitch (streaming)", Test::Measure ([&] () {
+		StreamingCopyRows (destination.data (), rowSize, size,
+			source.data (), rowSize, size, rowSize, rowCount, 1);
+	}), size);
+
+	// Source rows which are not a multiple of the pitch alignment, as for
+	// any texture whose width * 4 is not a multiple of 256
+	const std::size_t tightRowSize = rowSize - 100;
+	const std::size_t alignedPitch = rowSize;
+
+	Test::Report ("Rows, padded pitch (memcpy)", Test::Measure ([&] () {
+		CopyRows (destination.data (), alignedPitch, source.data (), tightRowSize,
+			tightRowSize, rowCount);
+	}), tightRowSize * rowCount);
+
+	Test::Report ("Rows, padded pitch (streaming)", Test::Measure ([&] () {
+		StreamingCopyRows (destination.data (), alignedPitch, alignedPitch * rowCount,
+			source.data (), tightRowSize, tightRowSize * rowCount,
+			tightRowSize, rowCount, 1);
+	}), tightRowSize * rowCount);
+
+	return 0;
+}
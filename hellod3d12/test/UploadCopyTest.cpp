@@ -0,0 +1,134 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+
+#include "Test.h"
+
+#include "TestImage.h"
+#include "UploadCopy.h"
+
+#include <cstring>
+#include <random>
+#include <vector>
+
+using namespace AMD;
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Any alignment of source and destination, and sizes around the cache line
+size: the bytes around the destination must stay untouched.
+*/
+TEST (StreamingCopyIsExact)
+{
+	const auto source = Test::CreateRandomBytes (1 << 20);
+	std::vector<std::uint8_t> destination ((1 << 20) + 256);
+
+	std::mt19937 random (1);
+	for (int i = 0; i < 300; ++i) {
+		const std::size_t sourceOffset = random () % 100;
+		const std::size_t destinationOffset = random () % 100;
+		const std::size_t size = (i < 200) ? random () % 300 : random () % ((1 << 20) - 100);
+
+		std::fill (destination.begin (), destination.end (), 0xCD);
+		StreamingCopy (destination.data () + destinationOffset,
+			source.data () + sourceOffset, size);
+
+		CHECK (std::memcmp (destination.data () + destinationOffset,
+			source.data () + sourceOffset, size) == 0);
+		for (std::size_t j = 0; j < destinationOffset; ++j) {
+			CHECK_EQUAL (0xCD, destination [j]);
+		}
+		CHECK_EQUAL (0xCD, destination [destinationOffset + size]);
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Compare against a plain row by row copy, for pitched and contiguous layouts.
+Only the row contents are compared, the padding is undefined.
+*/
+TEST (StreamingCopyRowsMatchesMemcpy)
+{
+	std::mt19937 random (2);
+
+	for (int i = 0; i < 200; ++i) {
+		const std::size_t rowSize = 1 + random () % 3000;
+		const int rowCount = 1 + random () % 40;
+		const int sliceCount = 1 + random () % 3;
+
+		const std::size_t sourceRowPitch = rowSize + ((random () % 2) ? 0 : random () % 100);
+		std::size_t destinationRowPitch = ((rowSize + 255) / 256) * 256;
+		if (random () % 4 == 0) {
+			destinationRowPitch = sourceRowPitch;
+		}
+
+		const std::size_t sourceSlicePitch = sourceRowPitch * rowCount;
+		const std::size_t destinationSlicePitch = destinationRowPitch * rowCount;
+
+		const auto source = Test::CreateRandomBytes (sourceSlicePitch * sliceCount, i);
+		std::vector<std::uint8_t> destination (destinationSlicePitch * sliceCount + 64);
+
+		StreamingCopyRows (destination.data (), destinationRowPitch, destinationSlicePitch,
+			source.data (), sourceRowPitch, sourceSlicePitch,
+			rowSize, rowCount, sliceCount);
+
+		for (int slice = 0; slice < sliceCount; ++slice) {
+			for (int row = 0; row < rowCount; ++row) {
+				CHECK (std::memcmp (
+					destination.data () + slice * destinationSlicePitch + row * destinationRowPitch,
+					source.data () + slice * sourceSlicePitch + row * sourceRowPitch,
+					rowSize) == 0);
+			}
+		}
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Upload buffers are sized to end right after the last row, as reported by
+GetCopyableFootprints, so the last row must not be padded.
+*/
+TEST (StreamingCopyRowsStopsAtLastRow)
+{
+	const std::size_t rowSize = 100, rowPitch = 256;
+	const int rowCount = 4, sliceCount = 2;
+	const std::size_t size = rowPitch * (rowCount * sliceCount - 1) + rowSize;
+
+	const auto source = Test::CreateRandomBytes (rowSize * rowCount * sliceCount);
+	std::vector<std::uint8_t> buffer (size + 256, 0xCD);
+
+	// Padding is only used for cache line aligned destinations
+	auto destination = buffer.data ();
+	while (reinterpret_cast<std::uintptr_t> (destination) % 64 != 0) {
+		++destination;
+	}
+
+	StreamingCopyRows (destination, rowPitch, rowPitch * rowCount,
+		source.data (), rowSize, rowSize * rowCount,
+		rowSize, rowCount, sliceCount);
+
+	CHECK (std::memcmp (destination + size - rowSize,
+		source.data () + source.size () - rowSize, rowSize) == 0);
+	for (std::size_t i = size; i < size + 64; ++i) {
+		CHECK_EQUAL (0xCD, destination [i]);
+	}
+}
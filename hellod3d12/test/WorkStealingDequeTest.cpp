@@ -0,0 +1,135 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#include "Test.h"
+
+#include "WorkStealingDeque.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace AMD;
+
+///////////////////////////////////////////////////////////////////////////////
+TEST (OwnerPopsInReverseOrder)
+{
+	int items [4];
+	WorkStealingDeque<int> deque;
+	CHECK (deque.IsEmpty ());
+	CHECK (deque.Pop () == nullptr);
+	CHECK (deque.Steal () == nullptr);
+
+	for (auto& item : items) {
+		deque.Push (&item);
+	}
+
+	CHECK (!deque.IsEmpty ());
+	CHECK (deque.Pop () == &items [3]);
+	CHECK (deque.Pop () == &items [2]);
+
+	// Thieves take the oldest
+	CHECK (deque.Steal () == &items [0]);
+	CHECK (deque.Pop () == &items [1]);
+	CHECK (deque.Pop () == nullptr);
+	CHECK (deque.IsEmpty ());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+TEST (Grows)
+{
+	std::vector<int> items (1000);
+	WorkStealingDeque<int> deque (2);
+
+	// Wrap around before growing, so the copy has to handle the ring
+	deque.Push (&items [0]);
+	CHECK (deque.Steal () == &items [0]);
+
+	for (std::size_t i = 1; i < items.size (); ++i) {
+		deque.Push (&items [i]);
+	}
+
+	CHECK (deque.Steal () == &items [1]);
+	for (std::size_t i = items.size () - 1; i > 1; --i) {
+		CHECK (deque.Pop () == &items [i]);
+	}
+	CHECK (deque.IsEmpty ());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+The owner pushes and pops while three thieves steal, starting from a tiny
+buffer so it grows under contention. Every item must be taken exactly once.
+*/
+TEST (StressEveryItemTakenOnce)
+{
+	const int itemCount = 100000;
+	std::vector<int> items (itemCount);
+	std::vector<std::atomic<int>> taken (itemCount);
+
+	WorkStealingDeque<int> deque (2);
+	std::atomic<bool> done (false);
+
+	const auto take = [&] (int* item) {
+		taken [item - items.data ()].fetch_add (1);
+	};
+
+	std::vector<std::thread> thieves;
+	for (int i = 0; i < 3; ++i) {
+		thieves.emplace_back ([&] () {
+			while (!done.load ()) {
+				if (auto item = deque.Steal ()) {
+					take (item);
+				} else {
+					std::this_thread::yield ();
+				}
+			}
+		});
+	}
+
+	for (int i = 0; i < itemCount; ++i) {
+		deque.Push (&items [i]);
+
+		// Keep the deque short now and then, so the owner races the
+		// thieves for the last item
+		if (i % 3 == 0) {
+			if (auto item = deque.Pop ()) {
+				take (item);
+			}
+		}
+	}
+
+	while (auto item = deque.Pop ()) {
+		take (item);
+	}
+
+	done.store (true);
+	for (auto& thief : thieves) {
+		thief.join ();
+	}
+
+	int wrong = 0;
+	for (const auto& count : taken) {
+		wrong += count.load () != 1;
+	}
+	CHECK_EQUAL (0, wrong);
+}
@@ -0,0 +1,251 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+/**
+The subset of the Windows headers the D3D12 stub and the sources under test
+need, so they compile on Linux. Events are implemented for real, as the
+loaders wait on them.
+*/
+
+#ifndef ANTERU_D3D12_SAMPLE_TEST_STUB_WINDOWS_H_
+#define ANTERU_D3D12_SAMPLE_TEST_STUB_WINDOWS_H_
+
+#include <chrono>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <new>
+#include <type_traits>
+
+typedef int BOOL;
+typedef unsigned char BYTE;
+typedef std::uint8_t UINT8;
+typedef std::uint16_t UINT16;
+typedef unsigned int UINT;
+typedef std::uint64_t UINT64;
+typedef int INT;
+typedef long LONG;
+typedef unsigned long DWORD;
+typedef float FLOAT;
+typedef std::size_t SIZE_T;
+typedef std::intptr_t LONG_PTR;
+typedef std::uintptr_t ULONG_PTR;
+typedef std::int32_t HRESULT;
+typedef void* HANDLE;
+typedef const char* LPCSTR;
+
+#define TRUE 1
+#define FALSE 0
+
+#define S_OK (static_cast<HRESULT> (0))
+#define E_FAIL (static_cast<HRESULT> (0x80004005))
+#define E_NOINTERFACE (static_cast<HRESULT> (0x80004002))
+#define E_NOTIMPL (static_cast<HRESULT> (0x80004001))
+#define E_INVALIDARG (static_cast<HRESULT> (0x80070057))
+#define E_OUTOFMEMORY (static_cast<HRESULT> (0x8007000E))
+
+#define SUCCEEDED(hr) (static_cast<HRESULT> (hr) >= 0)
+#define FAILED(hr) (static_cast<HRESULT> (hr) < 0)
+
+#define INFINITE 0xFFFFFFFF
+#define WAIT_OBJECT_0 0
+#define WAIT_TIMEOUT 258
+
+// SAL annotations and declspecs
+#define _In_
+#define _In_opt_
+#define _In_range_(a, b)
+#define _In_reads_(n)
+#define _In_reads_opt_(n)
+#define _Out_
+#define _Out_opt_
+#define _Out_writes_(n)
+#define _Out_writes_opt_(n)
+#define _Inout_
+#define DECLSPEC_SELECTANY
+#define __debugbreak() __builtin_trap ()
+
+struct RECT
+{
+	LONG left;
+	LONG top;
+	LONG right;
+	LONG bottom;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+Interface IDs are the address of a per-type tag, which is unique enough to
+tell interfaces apart in QueryInterface.
+*/
+struct GUID
+{
+	const void* tag;
+};
+
+typedef GUID IID;
+typedef const GUID& REFIID;
+
+inline bool operator== (const GUID& a, const GUID& b)
+{
+	return a.tag == b.tag;
+}
+
+template <typename T>
+REFIID StubUuidOf ()
+{
+	static const char tag = 0;
+	static const GUID guid = { &tag };
+	return guid;
+}
+
+template <typename T>
+REFIID StubUuidOfPointer (T**)
+{
+	return StubUuidOf<T> ();
+}
+
+#define __uuidof(x) StubUuidOf<std::remove_cv<std::remove_reference<decltype (x)>::type>::type> ()
+#define IID_PPV_ARGS(pp) StubUuidOfPointer (pp), reinterpret_cast<void**> (pp)
+
+///////////////////////////////////////////////////////////////////////////////
+struct IUnknown
+{
+	virtual ~IUnknown ()
+	{
+	}
+
+	virtual HRESULT QueryInterface (REFIID, void** object)
+	{
+		*object = nullptr;
+		return E_NOINTERFACE;
+	}
+
+	virtual UINT AddRef ()
+	{
+		return ++referenceCount_;
+	}
+
+	virtual UINT Release ()
+	{
+		const auto count = --referenceCount_;
+		if (count == 0) {
+			delete this;
+		}
+
+		return count;
+	}
+
+	template <typename T>
+	HRESULT QueryInterface (T** object)
+	{
+		return QueryInterface (StubUuidOf<T> (), reinterpret_cast<void**> (object));
+	}
+
+private:
+	std::atomic<UINT> referenceCount_ { 1 };
+};
+
+///////////////////////////////////////////////////////////////////////////////
+inline HANDLE GetProcessHeap ()
+{
+	return nullptr;
+}
+
+inline void* HeapAlloc (HANDLE, DWORD, SIZE_T size)
+{
+	return ::operator new (size);
+}
+
+inline BOOL HeapFree (HANDLE, DWORD, void* memory)
+{
+	::operator delete (memory);
+	return TRUE;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+struct StubEvent
+{
+	std::mutex mutex;
+	std::condition_variable signaled;
+	bool isSignaled = false;
+	bool manualReset = false;
+};
+
+inline HANDLE CreateEvent (void*, const BOOL manualReset, const BOOL initialState, LPCSTR)
+{
+	auto event = new StubEvent;
+	event->manualReset = manualReset != FALSE;
+	event->isSignaled = initialState != FALSE;
+	return event;
+}
+
+inline BOOL SetEvent (HANDLE handle)
+{
+	auto event = static_cast<StubEvent*> (handle);
+	{
+		std::lock_guard<std::mutex> lock (event->mutex);
+		event->isSignaled = true;
+	}
+
+	event->signaled.notify_all ();
+	return TRUE;
+}
+
+inline BOOL ResetEvent (HANDLE handle)
+{
+	auto event = static_cast<StubEvent*> (handle);
+	std::lock_guard<std::mutex> lock (event->mutex);
+	event->isSignaled = false;
+	return TRUE;
+}
+
+inline DWORD WaitForSingleObject (HANDLE handle, const DWORD milliseconds)
+{
+	auto event = static_cast<StubEvent*> (handle);
+	std::unique_lock<std::mutex> lock (event->mutex);
+
+	const auto isSignaled = [event] () { return event->isSignaled; };
+	if (milliseconds == INFINITE) {
+		event->signaled.wait (lock, isSignaled);
+	} else if (!event->signaled.wait_for (lock,
+		std::chrono::milliseconds (milliseconds), isSignaled)) {
+		return WAIT_TIMEOUT;
+	}
+
+	if (!event->manualReset) {
+		event->isSignaled = false;
+	}
+
+	return WAIT_OBJECT_0;
+}
+
+inline BOOL CloseHandle (HANDLE handle)
+{
+	delete static_cast<StubEvent*> (handle);
+	return TRUE;
+}
+
+#endif
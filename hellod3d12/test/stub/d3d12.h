@@ -0,0 +1,1125 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+
+/**
+The subset of d3d12.h used by the sample's sources and d3dx12.h, so the
+platform independent parts build on Linux. Enumerations and structures match
+the Windows SDK; interfaces only declare the methods the sources call, with
+default implementations that do nothing, so the fakes in the tests override
+just what they check.
+*/
+
+#ifndef ANTERU_D3D12_SAMPLE_TEST_STUB_D3D12_H_
+#define ANTERU_D3D12_SAMPLE_TEST_STUB_D3D12_H_
+
+#include "Windows.h"
+#include "dxgiformat.h"
+
+#define D3D12_DEFAULT_DEPTH_BIAS 0
+#define D3D12_DEFAULT_DEPTH_BIAS_CLAMP 0.0f
+#define D3D12_DEFAULT_SLOPE_SCALED_DEPTH_BIAS 0.0f
+#define D3D12_DEFAULT_STENCIL_READ_MASK 0xff
+#define D3D12_DEFAULT_STENCIL_WRITE_MASK 0xff
+#define D3D12_DEFAULT_RESOURCE_PLACEMENT_ALIGNMENT 65536
+#define D3D12_DEFAULT_MSAA_RESOURCE_PLACEMENT_ALIGNMENT 4194304
+#define D3D12_DEFAULT_SHADER_4_COMPONENT_MAPPING 0x1688
+#define D3D12_DESCRIPTOR_RANGE_OFFSET_APPEND 0xffffffff
+#define D3D12_FLOAT32_MAX 3.402823466e+38f
+#define D3D12_REQ_SUBRESOURCES 30720
+#define D3D12_REQ_MIP_LEVELS 15
+#define D3D12_REQ_TEXTURE2D_ARRAY_AXIS_DIMENSION 2048
+#define D3D12_REQ_TEXTURE2D_U_OR_V_DIMENSION 16384
+#define D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES 0xffffffff
+#define D3D12_SIMULTANEOUS_RENDER_TARGET_COUNT 8
+#define D3D12_TEXTURE_DATA_PITCH_ALIGNMENT 256
+#define D3D12_TEXTURE_DATA_PLACEMENT_ALIGNMENT 512
+
+///////////////////////////////////////////////////////////////////////////////
+// Enumerations
+enum D3D12_BLEND
+{
+	D3D12_BLEND_ZERO = 1,
+	D3D12_BLEND_ONE = 2
+};
+
+enum D3D12_BLEND_OP
+{
+	D3D12_BLEND_OP_ADD = 1
+};
+
+enum D3D12_LOGIC_OP
+{
+	D3D12_LOGIC_OP_CLEAR = 0,
+	D3D12_LOGIC_OP_NOOP = 4
+};
+
+enum D3D12_COLOR_WRITE_ENABLE
+{
+	D3D12_COLOR_WRITE_ENABLE_ALL = 15
+};
+
+enum D3D12_FILL_MODE
+{
+	D3D12_FILL_MODE_WIREFRAME = 2,
+	D3D12_FILL_MODE_SOLID = 3
+};
+
+enum D3D12_CULL_MODE
+{
+	D3D12_CULL_MODE_NONE = 1,
+	D3D12_CULL_MODE_FRONT = 2,
+	D3D12_CULL_MODE_BACK = 3
+};
+
+enum D3D12_CONSERVATIVE_RASTERIZATION_MODE
+{
+	D3D12_CONSERVATIVE_RASTERIZATION_MODE_OFF = 0,
+	D3D12_CONSERVATIVE_RASTERIZATION_MODE_ON = 1
+};
+
+enum D3D12_COMPARISON_FUNC
+{
+	D3D12_COMPARISON_FUNC_NEVER = 1,
+	D3D12_COMPARISON_FUNC_LESS = 2,
+	D3D12_COMPARISON_FUNC_EQUAL = 3,
+	D3D12_COMPARISON_FUNC_LESS_EQUAL = 4,
+	D3D12_COMPARISON_FUNC_GREATER = 5,
+	D3D12_COMPARISON_FUNC_NOT_EQUAL = 6,
+	D3D12_COMPARISON_FUNC_GREATER_EQUAL = 7,
+	D3D12_COMPARISON_FUNC_ALWAYS = 8
+};
+
+enum D3D12_DEPTH_WRITE_MASK
+{
+	D3D12_DEPTH_WRITE_MASK_ZERO = 0,
+	D3D12_DEPTH_WRITE_MASK_ALL = 1
+};
+
+enum D3D12_STENCIL_OP
+{
+	D3D12_STENCIL_OP_KEEP = 1
+};
+
+enum D3D12_FILTER
+{
+	D3D12_FILTER_MIN_MAG_MIP_POINT = 0,
+	D3D12_FILTER_MIN_MAG_MIP_LINEAR = 0x15,
+	D3D12_FILTER_ANISOTROPIC = 0x55
+};
+
+enum D3D12_TEXTURE_ADDRESS_MODE
+{
+	D3D12_TEXTURE_ADDRESS_MODE_WRAP = 1,
+	D3D12_TEXTURE_ADDRESS_MODE_MIRROR = 2,
+	D3D12_TEXTURE_ADDRESS_MODE_CLAMP = 3
+};
+
+enum D3D12_STATIC_BORDER_COLOR
+{
+	D3D12_STATIC_BORDER_COLOR_TRANSPARENT_BLACK = 0,
+	D3D12_STATIC_BORDER_COLOR_OPAQUE_BLACK = 1,
+	D3D12_STATIC_BORDER_COLOR_OPAQUE_WHITE = 2
+};
+
+enum D3D12_SHADER_VISIBILITY
+{
+	D3D12_SHADER_VISIBILITY_ALL = 0,
+	D3D12_SHADER_VISIBILITY_VERTEX = 1,
+	D3D12_SHADER_VISIBILITY_PIXEL = 5
+};
+
+enum D3D12_DESCRIPTOR_RANGE_TYPE
+{
+	D3D12_DESCRIPTOR_RANGE_TYPE_SRV = 0,
+	D3D12_DESCRIPTOR_RANGE_TYPE_UAV = 1,
+	D3D12_DESCRIPTOR_RANGE_TYPE_CBV = 2,
+	D3D12_DESCRIPTOR_RANGE_TYPE_SAMPLER = 3
+};
+
+enum D3D12_ROOT_PARAMETER_TYPE
+{
+	D3D12_ROOT_PARAMETER_TYPE_DESCRIPTOR_TABLE = 0,
+	D3D12_ROOT_PARAMETER_TYPE_32BIT_CONSTANTS = 1,
+	D3D12_ROOT_PARAMETER_TYPE_CBV = 2,
+	D3D12_ROOT_PARAMETER_TYPE_SRV = 3,
+	D3D12_ROOT_PARAMETER_TYPE_UAV = 4
+};
+
+enum D3D12_ROOT_SIGNATURE_FLAGS
+{
+	D3D12_ROOT_SIGNATURE_FLAG_NONE = 0,
+	D3D12_ROOT_SIGNATURE_FLAG_ALLOW_INPUT_ASSEMBLER_INPUT_LAYOUT = 0x1
+};
+
+enum D3D12_HEAP_TYPE
+{
+	D3D12_HEAP_TYPE_DEFAULT = 1,
+	D3D12_HEAP_TYPE_UPLOAD = 2,
+	D3D12_HEAP_TYPE_READBACK = 3,
+	D3D12_HEAP_TYPE_CUSTOM = 4
+};
+
+enum D3D12_CPU_PAGE_PROPERTY
+{
+	D3D12_CPU_PAGE_PROPERTY_UNKNOWN = 0,
+	D3D12_CPU_PAGE_PROPERTY_NOT_AVAILABLE = 1,
+	D3D12_CPU_PAGE_PROPERTY_WRITE_COMBINE = 2,
+	D3D12_CPU_PAGE_PROPERTY_WRITE_BACK = 3
+};
+
+enum D3D12_MEMORY_POOL
+{
+	D3D12_MEMORY_POOL_UNKNOWN = 0,
+	D3D12_MEMORY_POOL_L0 = 1,
+	D3D12_MEMORY_POOL_L1 = 2
+};
+
+enum D3D12_HEAP_FLAGS
+{
+	D3D12_HEAP_FLAG_NONE = 0,
+	D3D12_HEAP_FLAG_SHARED = 0x1,
+	D3D12_HEAP_FLAG_DENY_BUFFERS = 0x4,
+	D3D12_HEAP_FLAG_ALLOW_DISPLAY = 0x8,
+	D3D12_HEAP_FLAG_SHARED_CROSS_ADAPTER = 0x20,
+	D3D12_HEAP_FLAG_DENY_RT_DS_TEXTURES = 0x40,
+	D3D12_HEAP_FLAG_DENY_NON_RT_DS_TEXTURES = 0x80,
+	D3D12_HEAP_FLAG_ALLOW_ALL_BUFFERS_AND_TEXTURES = 0,
+	D3D12_HEAP_FLAG_ALLOW_ONLY_BUFFERS = 0xc0,
+	D3D12_HEAP_FLAG_ALLOW_ONLY_NON_RT_DS_TEXTURES = 0x44,
+	D3D12_HEAP_FLAG_ALLOW_ONLY_RT_DS_TEXTURES = 0x84
+};
+
+inline D3D12_HEAP_FLAGS operator| (const D3D12_HEAP_FLAGS a, const D3D12_HEAP_FLAGS b)
+{
+	return static_cast<D3D12_HEAP_FLAGS> (static_cast<int> (a) | static_cast<int> (b));
+}
+
+enum D3D12_RESOURCE_DIMENSION
+{
+	D3D12_RESOURCE_DIMENSION_UNKNOWN = 0,
+	D3D12_RESOURCE_DIMENSION_BUFFER = 1,
+	D3D12_RESOURCE_DIMENSION_TEXTURE1D = 2,
+	D3D12_RESOURCE_DIMENSION_TEXTURE2D = 3,
+	D3D12_RESOURCE_DIMENSION_TEXTURE3D = 4
+};
+
+enum D3D12_TEXTURE_LAYOUT
+{
+	D3D12_TEXTURE_LAYOUT_UNKNOWN = 0,
+	D3D12_TEXTURE_LAYOUT_ROW_MAJOR = 1,
+	D3D12_TEXTURE_LAYOUT_64KB_UNDEFINED_SWIZZLE = 2,
+	D3D12_TEXTURE_LAYOUT_64KB_STANDARD_SWIZZLE = 3
+};
+
+enum D3D12_RESOURCE_FLAGS
+{
+	D3D12_RESOURCE_FLAG_NONE = 0,
+	D3D12_RESOURCE_FLAG_ALLOW_RENDER_TARGET = 0x1,
+	D3D12_RESOURCE_FLAG_ALLOW_DEPTH_STENCIL = 0x2,
+	D3D12_RESOURCE_FLAG_ALLOW_UNORDERED_ACCESS = 0x4,
+	D3D12_RESOURCE_FLAG_DENY_SHADER_RESOURCE = 0x8
+};
+
+inline D3D12_RESOURCE_FLAGS operator| (const D3D12_RESOURCE_FLAGS a, const D3D12_RESOURCE_FLAGS b)
+{
+	return static_cast<D3D12_RESOURCE_FLAGS> (static_cast<int> (a) | static_cast<int> (b));
+}
+
+enum D3D12_RESOURCE_STATES
+{
+	D3D12_RESOURCE_STATE_COMMON = 0,
+	D3D12_RESOURCE_STATE_VERTEX_AND_CONSTANT_BUFFER = 0x1,
+	D3D12_RESOURCE_STATE_INDEX_BUFFER = 0x2,
+	D3D12_RESOURCE_STATE_RENDER_TARGET = 0x4,
+	D3D12_RESOURCE_STATE_UNORDERED_ACCESS = 0x8,
+	D3D12_RESOURCE_STATE_DEPTH_WRITE = 0x10,
+	D3D12_RESOURCE_STATE_DEPTH_READ = 0x20,
+	D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE = 0x40,
+	D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE = 0x80,
+	D3D12_RESOURCE_STATE_STREAM_OUT = 0x100,
+	D3D12_RESOURCE_STATE_INDIRECT_ARGUMENT = 0x200,
+	D3D12_RESOURCE_STATE_COPY_DEST = 0x400,
+	D3D12_RESOURCE_STATE_COPY_SOURCE = 0x800,
+	D3D12_RESOURCE_STATE_RESOLVE_DEST = 0x1000,
+	D3D12_RESOURCE_STATE_RESOLVE_SOURCE = 0x2000,
+	D3D12_RESOURCE_STATE_GENERIC_READ = 0xac3,
+	D3D12_RESOURCE_STATE_PRESENT = 0,
+	D3D12_RESOURCE_STATE_PREDICATION = 0x200
+};
+
+inline D3D12_RESOURCE_STATES operator| (const D3D12_RESOURCE_STATES a, const D3D12_RESOURCE_STATES b)
+{
+	return static_cast<D3D12_RESOURCE_STATES> (static_cast<int> (a) | static_cast<int> (b));
+}
+
+inline D3D12_RESOURCE_STATES operator& (const D3D12_RESOURCE_STATES a, const D3D12_RESOURCE_STATES b)
+{
+	return static_cast<D3D12_RESOURCE_STATES> (static_cast<int> (a) & static_cast<int> (b));
+}
+
+inline D3D12_RESOURCE_STATES operator~ (const D3D12_RESOURCE_STATES a)
+{
+	return static_cast<D3D12_RESOURCE_STATES> (~static_cast<int> (a));
+}
+
+inline D3D12_RESOURCE_STATES& operator|= (D3D12_RESOURCE_STATES& a, const D3D12_RESOURCE_STATES b)
+{
+	return a = a | b;
+}
+
+inline D3D12_RESOURCE_STATES& operator&= (D3D12_RESOURCE_STATES& a, const D3D12_RESOURCE_STATES b)
+{
+	return a = a & b;
+}
+
+enum D3D12_RESOURCE_BARRIER_TYPE
+{
+	D3D12_RESOURCE_BARRIER_TYPE_TRANSITION = 0,
+	D3D12_RESOURCE_BARRIER_TYPE_ALIASING = 1,
+	D3D12_RESOURCE_BARRIER_TYPE_UAV = 2
+};
+
+enum D3D12_RESOURCE_BARRIER_FLAGS
+{
+	D3D12_RESOURCE_BARRIER_FLAG_NONE = 0,
+	D3D12_RESOURCE_BARRIER_FLAG_BEGIN_ONLY = 0x1,
+	D3D12_RESOURCE_BARRIER_FLAG_END_ONLY = 0x2
+};
+
+enum D3D12_TEXTURE_COPY_TYPE
+{
+	D3D12_TEXTURE_COPY_TYPE_SUBRESOURCE_INDEX = 0,
+	D3D12_TEXTURE_COPY_TYPE_PLACED_FOOTPRINT = 1
+};
+
+enum D3D12_COMMAND_LIST_TYPE
+{
+	D3D12_COMMAND_LIST_TYPE_DIRECT = 0,
+	D3D12_COMMAND_LIST_TYPE_BUNDLE = 1,
+	D3D12_COMMAND_LIST_TYPE_COMPUTE = 2,
+	D3D12_COMMAND_LIST_TYPE_COPY = 3
+};
+
+enum D3D12_COMMAND_QUEUE_FLAGS
+{
+	D3D12_COMMAND_QUEUE_FLAG_NONE = 0,
+	D3D12_COMMAND_QUEUE_FLAG_DISABLE_GPU_TIMEOUT = 0x1
+};
+
+enum D3D12_COMMAND_QUEUE_PRIORITY
+{
+	D3D12_COMMAND_QUEUE_PRIORITY_NORMAL = 0,
+	D3D12_COMMAND_QUEUE_PRIORITY_HIGH = 100
+};
+
+enum D3D12_FENCE_FLAGS
+{
+	D3D12_FENCE_FLAG_NONE = 0
+};
+
+enum D3D12_DESCRIPTOR_HEAP_TYPE
+{
+	D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV = 0,
+	D3D12_DESCRIPTOR_HEAP_TYPE_SAMPLER = 1,
+	D3D12_DESCRIPTOR_HEAP_TYPE_RTV = 2,
+	D3D12_DESCRIPTOR_HEAP_TYPE_DSV = 3
+};
+
+enum D3D12_DESCRIPTOR_HEAP_FLAGS
+{
+	D3D12_DESCRIPTOR_HEAP_FLAG_NONE = 0,
+	D3D12_DESCRIPTOR_HEAP_FLAG_SHADER_VISIBLE = 0x1
+};
+
+enum D3D12_SRV_DIMENSION
+{
+	D3D12_SRV_DIMENSION_UNKNOWN = 0,
+	D3D12_SRV_DIMENSION_BUFFER = 1,
+	D3D12_SRV_DIMENSION_TEXTURE2D = 4
+};
+
+enum D3D12_CLEAR_FLAGS
+{
+	D3D12_CLEAR_FLAG_DEPTH = 0x1,
+	D3D12_CLEAR_FLAG_STENCIL = 0x2
+};
+
+inline D3D12_CLEAR_FLAGS operator| (const D3D12_CLEAR_FLAGS a, const D3D12_CLEAR_FLAGS b)
+{
+	return static_cast<D3D12_CLEAR_FLAGS> (static_cast<int> (a) | static_cast<int> (b));
+}
+
+enum D3D12_FEATURE
+{
+	D3D12_FEATURE_D3D12_OPTIONS = 0,
+	D3D12_FEATURE_FORMAT_SUPPORT = 2,
+	D3D12_FEATURE_FORMAT_INFO = 12
+};
+
+enum D3D12_PRIMITIVE_TOPOLOGY
+{
+	D3D_PRIMITIVE_TOPOLOGY_UNDEFINED = 0,
+	D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST = 4
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// Structures
+typedef RECT D3D12_RECT;
+typedef UINT64 D3D12_GPU_VIRTUAL_ADDRESS;
+
+struct D3D12_BOX
+{
+	UINT left;
+	UINT top;
+	UINT front;
+	UINT right;
+	UINT bottom;
+	UINT back;
+};
+
+struct D3D12_VIEWPORT
+{
+	FLOAT TopLeftX;
+	FLOAT TopLeftY;
+	FLOAT Width;
+	FLOAT Height;
+	FLOAT MinDepth;
+	FLOAT MaxDepth;
+};
+
+struct D3D12_RANGE
+{
+	SIZE_T Begin;
+	SIZE_T End;
+};
+
+struct D3D12_RENDER_TARGET_BLEND_DESC
+{
+	BOOL BlendEnable;
+	BOOL LogicOpEnable;
+	D3D12_BLEND SrcBlend;
+	D3D12_BLEND DestBlend;
+	D3D12_BLEND_OP BlendOp;
+	D3D12_BLEND SrcBlendAlpha;
+	D3D12_BLEND DestBlendAlpha;
+	D3D12_BLEND_OP BlendOpAlpha;
+	D3D12_LOGIC_OP LogicOp;
+	UINT8 RenderTargetWriteMask;
+};
+
+struct D3D12_BLEND_DESC
+{
+	BOOL AlphaToCoverageEnable;
+	BOOL IndependentBlendEnable;
+	D3D12_RENDER_TARGET_BLEND_DESC RenderTarget [8];
+};
+
+struct D3D12_RASTERIZER_DESC
+{
+	D3D12_FILL_MODE FillMode;
+	D3D12_CULL_MODE CullMode;
+	BOOL FrontCounterClockwise;
+	INT DepthBias;
+	FLOAT DepthBiasClamp;
+	FLOAT SlopeScaledDepthBias;
+	BOOL DepthClipEnable;
+	BOOL MultisampleEnable;
+	BOOL AntialiasedLineEnable;
+	UINT ForcedSampleCount;
+	D3D12_CONSERVATIVE_RASTERIZATION_MODE ConservativeRaster;
+};
+
+struct D3D12_DEPTH_STENCILOP_DESC
+{
+	D3D12_STENCIL_OP StencilFailOp;
+	D3D12_STENCIL_OP StencilDepthFailOp;
+	D3D12_STENCIL_OP StencilPassOp;
+	D3D12_COMPARISON_FUNC StencilFunc;
+};
+
+struct D3D12_DEPTH_STENCIL_DESC
+{
+	BOOL DepthEnable;
+	D3D12_DEPTH_WRITE_MASK DepthWriteMask;
+	D3D12_COMPARISON_FUNC DepthFunc;
+	BOOL StencilEnable;
+	UINT8 StencilReadMask;
+	UINT8 StencilWriteMask;
+	D3D12_DEPTH_STENCILOP_DESC FrontFace;
+	D3D12_DEPTH_STENCILOP_DESC BackFace;
+};
+
+struct D3D12_DESCRIPTOR_RANGE
+{
+	D3D12_DESCRIPTOR_RANGE_TYPE RangeType;
+	UINT NumDescriptors;
+	UINT BaseShaderRegister;
+	UINT RegisterSpace;
+	UINT OffsetInDescriptorsFromTableStart;
+};
+
+struct D3D12_ROOT_DESCRIPTOR_TABLE
+{
+	UINT NumDescriptorRanges;
+	const D3D12_DESCRIPTOR_RANGE* pDescriptorRanges;
+};
+
+struct D3D12_ROOT_CONSTANTS
+{
+	UINT ShaderRegister;
+	UINT RegisterSpace;
+	UINT Num32BitValues;
+};
+
+struct D3D12_ROOT_DESCRIPTOR
+{
+	UINT ShaderRegister;
+	UINT RegisterSpace;
+};
+
+struct D3D12_ROOT_PARAMETER
+{
+	D3D12_ROOT_PARAMETER_TYPE ParameterType;
+	union
+	{
+		D3D12_ROOT_DESCRIPTOR_TABLE DescriptorTable;
+		D3D12_ROOT_CONSTANTS Constants;
+		D3D12_ROOT_DESCRIPTOR Descriptor;
+	};
+	D3D12_SHADER_VISIBILITY ShaderVisibility;
+};
+
+struct D3D12_STATIC_SAMPLER_DESC
+{
+	D3D12_FILTER Filter;
+	D3D12_TEXTURE_ADDRESS_MODE AddressU;
+	D3D12_TEXTURE_ADDRESS_MODE AddressV;
+	D3D12_TEXTURE_ADDRESS_MODE AddressW;
+	FLOAT MipLODBias;
+	UINT MaxAnisotropy;
+	D3D12_COMPARISON_FUNC ComparisonFunc;
+	D3D12_STATIC_BORDER_COLOR BorderColor;
+	FLOAT MinLOD;
+	FLOAT MaxLOD;
+	UINT ShaderRegister;
+	UINT RegisterSpace;
+	D3D12_SHADER_VISIBILITY ShaderVisibility;
+};
+
+struct D3D12_ROOT_SIGNATURE_DESC
+{
+	UINT NumParameters;
+	const D3D12_ROOT_PARAMETER* pParameters;
+	UINT NumStaticSamplers;
+	const D3D12_STATIC_SAMPLER_DESC* pStaticSamplers;
+	D3D12_ROOT_SIGNATURE_FLAGS Flags;
+};
+
+struct D3D12_CPU_DESCRIPTOR_HANDLE
+{
+	SIZE_T ptr;
+};
+
+struct D3D12_GPU_DESCRIPTOR_HANDLE
+{
+	UINT64 ptr;
+};
+
+struct D3D12_VERTEX_BUFFER_VIEW
+{
+	D3D12_GPU_VIRTUAL_ADDRESS BufferLocation;
+	UINT SizeInBytes;
+	UINT StrideInBytes;
+};
+
+struct D3D12_INDEX_BUFFER_VIEW
+{
+	D3D12_GPU_VIRTUAL_ADDRESS BufferLocation;
+	UINT SizeInBytes;
+	DXGI_FORMAT Format;
+};
+
+struct D3D12_HEAP_PROPERTIES
+{
+	D3D12_HEAP_TYPE Type;
+	D3D12_CPU_PAGE_PROPERTY CPUPageProperty;
+	D3D12_MEMORY_POOL MemoryPoolPreference;
+	UINT CreationNodeMask;
+	UINT VisibleNodeMask;
+};
+
+struct D3D12_HEAP_DESC
+{
+	UINT64 SizeInBytes;
+	D3D12_HEAP_PROPERTIES Properties;
+	UINT64 Alignment;
+	D3D12_HEAP_FLAGS Flags;
+};
+
+struct DXGI_SAMPLE_DESC
+{
+	UINT Count;
+	UINT Quality;
+};
+
+struct D3D12_RESOURCE_DESC
+{
+	D3D12_RESOURCE_DIMENSION Dimension;
+	UINT64 Alignment;
+	UINT64 Width;
+	UINT Height;
+	UINT16 DepthOrArraySize;
+	UINT16 MipLevels;
+	DXGI_FORMAT Format;
+	DXGI_SAMPLE_DESC SampleDesc;
+	D3D12_TEXTURE_LAYOUT Layout;
+	D3D12_RESOURCE_FLAGS Flags;
+};
+
+struct D3D12_RESOURCE_ALLOCATION_INFO
+{
+	UINT64 SizeInBytes;
+	UINT64 Alignment;
+};
+
+struct D3D12_DEPTH_STENCIL_VALUE
+{
+	FLOAT Depth;
+	UINT8 Stencil;
+};
+
+struct D3D12_CLEAR_VALUE
+{
+	DXGI_FORMAT Format;
+	union
+	{
+		FLOAT Color [4];
+		D3D12_DEPTH_STENCIL_VALUE DepthStencil;
+	};
+};
+
+struct D3D12_RESOURCE_TRANSITION_BARRIER
+{
+	struct ID3D12Resource* pResource;
+	UINT Subresource;
+	D3D12_RESOURCE_STATES StateBefore;
+	D3D12_RESOURCE_STATES StateAfter;
+};
+
+struct D3D12_RESOURCE_ALIASING_BARRIER
+{
+	struct ID3D12Resource* pResourceBefore;
+	struct ID3D12Resource* pResourceAfter;
+};
+
+struct D3D12_RESOURCE_UAV_BARRIER
+{
+	struct ID3D12Resource* pResource;
+};
+
+struct D3D12_RESOURCE_BARRIER
+{
+	D3D12_RESOURCE_BARRIER_TYPE Type;
+	D3D12_RESOURCE_BARRIER_FLAGS Flags;
+	union
+	{
+		D3D12_RESOURCE_TRANSITION_BARRIER Transition;
+		D3D12_RESOURCE_ALIASING_BARRIER Aliasing;
+		D3D12_RESOURCE_UAV_BARRIER UAV;
+	};
+};
+
+struct D3D12_SUBRESOURCE_FOOTPRINT
+{
+	DXGI_FORMAT Format;
+	UINT Width;
+	UINT Height;
+	UINT Depth;
+	UINT RowPitch;
+};
+
+struct D3D12_PLACED_SUBRESOURCE_FOOTPRINT
+{
+	UINT64 Offset;
+	D3D12_SUBRESOURCE_FOOTPRINT Footprint;
+};
+
+struct D3D12_TEXTURE_COPY_LOCATION
+{
+	struct ID3D12Resource* pResource;
+	D3D12_TEXTURE_COPY_TYPE Type;
+	union
+	{
+		D3D12_PLACED_SUBRESOURCE_FOOTPRINT PlacedFootprint;
+		UINT SubresourceIndex;
+	};
+};
+
+struct D3D12_SUBRESOURCE_DATA
+{
+	const void* pData;
+	LONG_PTR RowPitch;
+	LONG_PTR SlicePitch;
+};
+
+struct D3D12_MEMCPY_DEST
+{
+	void* pData;
+	SIZE_T RowPitch;
+	SIZE_T SlicePitch;
+};
+
+struct D3D12_SUBRESOURCE_TILING
+{
+	UINT WidthInTiles;
+	UINT16 HeightInTiles;
+	UINT16 DepthInTiles;
+	UINT StartTileIndexInOverallResource;
+};
+
+struct D3D12_TILE_SHAPE
+{
+	UINT WidthInTexels;
+	UINT HeightInTexels;
+	UINT DepthInTexels;
+};
+
+struct D3D12_PACKED_MIP_INFO
+{
+	UINT8 NumStandardMips;
+	UINT8 NumPackedMips;
+	UINT NumTilesForPackedMips;
+	UINT StartTileIndexInOverallResource;
+};
+
+struct D3D12_TILED_RESOURCE_COORDINATE
+{
+	UINT X;
+	UINT Y;
+	UINT Z;
+	UINT Subresource;
+};
+
+struct D3D12_TILE_REGION_SIZE
+{
+	UINT NumTiles;
+	BOOL UseBox;
+	UINT Width;
+	UINT16 Height;
+	UINT16 Depth;
+};
+
+struct D3D12_FEATURE_DATA_FORMAT_INFO
+{
+	DXGI_FORMAT Format;
+	UINT8 PlaneCount;
+};
+
+struct D3D12_COMMAND_QUEUE_DESC
+{
+	D3D12_COMMAND_LIST_TYPE Type;
+	INT Priority;
+	D3D12_COMMAND_QUEUE_FLAGS Flags;
+	UINT NodeMask;
+};
+
+struct D3D12_DESCRIPTOR_HEAP_DESC
+{
+	D3D12_DESCRIPTOR_HEAP_TYPE Type;
+	UINT NumDescriptors;
+	D3D12_DESCRIPTOR_HEAP_FLAGS Flags;
+	UINT NodeMask;
+};
+
+struct D3D12_TEX2D_SRV
+{
+	UINT MostDetailedMip;
+	UINT MipLevels;
+	UINT PlaneSlice;
+	FLOAT ResourceMinLODClamp;
+};
+
+struct D3D12_SHADER_RESOURCE_VIEW_DESC
+{
+	DXGI_FORMAT Format;
+	D3D12_SRV_DIMENSION ViewDimension;
+	UINT Shader4ComponentMapping;
+	union
+	{
+		D3D12_TEX2D_SRV Texture2D;
+	};
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// Render passes, from the Windows 10 October 2018 Update SDK
+enum D3D12_RENDER_PASS_BEGINNING_ACCESS_TYPE
+{
+	D3D12_RENDER_PASS_BEGINNING_ACCESS_TYPE_DISCARD = 0,
+	D3D12_RENDER_PASS_BEGINNING_ACCESS_TYPE_PRESERVE = 1,
+	D3D12_RENDER_PASS_BEGINNING_ACCESS_TYPE_CLEAR = 2,
+	D3D12_RENDER_PASS_BEGINNING_ACCESS_TYPE_NO_ACCESS = 3
+};
+
+enum D3D12_RENDER_PASS_ENDING_ACCESS_TYPE
+{
+	D3D12_RENDER_PASS_ENDING_ACCESS_TYPE_DISCARD = 0,
+	D3D12_RENDER_PASS_ENDING_ACCESS_TYPE_PRESERVE = 1,
+	D3D12_RENDER_PASS_ENDING_ACCESS_TYPE_RESOLVE = 2,
+	D3D12_RENDER_PASS_ENDING_ACCESS_TYPE_NO_ACCESS = 3
+};
+
+enum D3D12_RENDER_PASS_FLAGS
+{
+	D3D12_RENDER_PASS_FLAG_NONE = 0,
+	D3D12_RENDER_PASS_FLAG_ALLOW_UAV_WRITES = 0x1,
+	D3D12_RENDER_PASS_FLAG_SUSPENDING_PASS = 0x2,
+	D3D12_RENDER_PASS_FLAG_RESUMING_PASS = 0x4
+};
+
+struct D3D12_RENDER_PASS_BEGINNING_ACCESS_CLEAR_PARAMETERS
+{
+	D3D12_CLEAR_VALUE ClearValue;
+};
+
+struct D3D12_RENDER_PASS_BEGINNING_ACCESS
+{
+	D3D12_RENDER_PASS_BEGINNING_ACCESS_TYPE Type;
+	union
+	{
+		D3D12_RENDER_PASS_BEGINNING_ACCESS_CLEAR_PARAMETERS Clear;
+	};
+};
+
+struct D3D12_RENDER_PASS_ENDING_ACCESS
+{
+	D3D12_RENDER_PASS_ENDING_ACCESS_TYPE Type;
+};
+
+struct D3D12_RENDER_PASS_RENDER_TARGET_DESC
+{
+	D3D12_CPU_DESCRIPTOR_HANDLE cpuDescriptor;
+	D3D12_RENDER_PASS_BEGINNING_ACCESS BeginningAccess;
+	D3D12_RENDER_PASS_ENDING_ACCESS EndingAccess;
+};
+
+struct D3D12_RENDER_PASS_DEPTH_STENCIL_DESC
+{
+	D3D12_CPU_DESCRIPTOR_HANDLE cpuDescriptor;
+	D3D12_RENDER_PASS_BEGINNING_ACCESS DepthBeginningAccess;
+	D3D12_RENDER_PASS_BEGINNING_ACCESS StencilBeginningAccess;
+	D3D12_RENDER_PASS_ENDING_ACCESS DepthEndingAccess;
+	D3D12_RENDER_PASS_ENDING_ACCESS StencilEndingAccess;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// Interfaces
+struct ID3D12Device;
+
+struct ID3D12Object : public IUnknown
+{
+};
+
+struct ID3D12DeviceChild : public ID3D12Object
+{
+	virtual HRESULT GetDevice (REFIID, void** device)
+	{
+		*device = nullptr;
+		return E_NOTIMPL;
+	}
+};
+
+struct ID3D12Pageable : public ID3D12DeviceChild
+{
+};
+
+struct ID3D12Heap : public ID3D12Pageable
+{
+	virtual D3D12_HEAP_DESC GetDesc ()
+	{
+		return D3D12_HEAP_DESC ();
+	}
+};
+
+struct ID3D12Resource : public ID3D12Pageable
+{
+	virtual HRESULT Map (UINT, const D3D12_RANGE*, void** data)
+	{
+		*data = nullptr;
+		return E_NOTIMPL;
+	}
+
+	virtual void Unmap (UINT, const D3D12_RANGE*)
+	{
+	}
+
+	virtual D3D12_RESOURCE_DESC GetDesc ()
+	{
+		return D3D12_RESOURCE_DESC ();
+	}
+};
+
+struct ID3D12CommandAllocator : public ID3D12Pageable
+{
+	virtual HRESULT Reset ()
+	{
+		return S_OK;
+	}
+};
+
+struct ID3D12Fence : public ID3D12Pageable
+{
+	virtual UINT64 GetCompletedValue ()
+	{
+		return 0;
+	}
+
+	virtual HRESULT SetEventOnCompletion (UINT64, HANDLE)
+	{
+		return E_NOTIMPL;
+	}
+
+	virtual HRESULT Signal (UINT64)
+	{
+		return E_NOTIMPL;
+	}
+};
+
+struct ID3D12DescriptorHeap : public ID3D12Pageable
+{
+	virtual D3D12_CPU_DESCRIPTOR_HANDLE GetCPUDescriptorHandleForHeapStart ()
+	{
+		return D3D12_CPU_DESCRIPTOR_HANDLE ();
+	}
+
+	virtual D3D12_GPU_DESCRIPTOR_HANDLE GetGPUDescriptorHandleForHeapStart ()
+	{
+		return D3D12_GPU_DESCRIPTOR_HANDLE ();
+	}
+};
+
+struct ID3D12PipelineState : public ID3D12Pageable
+{
+};
+
+struct ID3D12RootSignature : public ID3D12DeviceChild
+{
+};
+
+struct ID3D12CommandList : public ID3D12DeviceChild
+{
+	virtual D3D12_COMMAND_LIST_TYPE GetType ()
+	{
+		return D3D12_COMMAND_LIST_TYPE_DIRECT;
+	}
+};
+
+struct ID3D12GraphicsCommandList : public ID3D12CommandList
+{
+	virtual HRESULT Close ()
+	{
+		return S_OK;
+	}
+
+	virtual HRESULT Reset (ID3D12CommandAllocator*, ID3D12PipelineState*)
+	{
+		return S_OK;
+	}
+
+	virtual void CopyBufferRegion (ID3D12Resource*, UINT64, ID3D12Resource*, UINT64, UINT64)
+	{
+	}
+
+	virtual void CopyTextureRegion (const D3D12_TEXTURE_COPY_LOCATION*, UINT, UINT, UINT,
+		const D3D12_TEXTURE_COPY_LOCATION*, const D3D12_BOX*)
+	{
+	}
+
+	virtual void ResourceBarrier (UINT, const D3D12_RESOURCE_BARRIER*)
+	{
+	}
+
+	virtual void ExecuteBundle (ID3D12GraphicsCommandList*)
+	{
+	}
+
+	virtual void SetPipelineState (ID3D12PipelineState*)
+	{
+	}
+
+	virtual void SetGraphicsRootSignature (ID3D12RootSignature*)
+	{
+	}
+
+	virtual void IASetPrimitiveTopology (D3D12_PRIMITIVE_TOPOLOGY)
+	{
+	}
+
+	virtual void IASetVertexBuffers (UINT, UINT, const D3D12_VERTEX_BUFFER_VIEW*)
+	{
+	}
+
+	virtual void IASetIndexBuffer (const D3D12_INDEX_BUFFER_VIEW*)
+	{
+	}
+
+	virtual void DrawIndexedInstanced (UINT, UINT, UINT, INT, UINT)
+	{
+	}
+
+	virtual void OMSetRenderTargets (UINT, const D3D12_CPU_DESCRIPTOR_HANDLE*, BOOL,
+		const D3D12_CPU_DESCRIPTOR_HANDLE*)
+	{
+	}
+
+	virtual void ClearDepthStencilView (D3D12_CPU_DESCRIPTOR_HANDLE, D3D12_CLEAR_FLAGS,
+		FLOAT, UINT8, UINT, const D3D12_RECT*)
+	{
+	}
+
+	virtual void ClearRenderTargetView (D3D12_CPU_DESCRIPTOR_HANDLE, const FLOAT*,
+		UINT, const D3D12_RECT*)
+	{
+	}
+
+	virtual void DiscardResource (ID3D12Resource*, const void*)
+	{
+	}
+
+	virtual void SetMarker (UINT, const void*, UINT)
+	{
+	}
+};
+
+#define __ID3D12GraphicsCommandList4_INTERFACE_DEFINED__
+
+struct ID3D12GraphicsCommandList4 : public ID3D12GraphicsCommandList
+{
+	virtual void BeginRenderPass (UINT, const D3D12_RENDER_PASS_RENDER_TARGET_DESC*,
+		const D3D12_RENDER_PASS_DEPTH_STENCIL_DESC*, D3D12_RENDER_PASS_FLAGS)
+	{
+	}
+
+	virtual void EndRenderPass ()
+	{
+	}
+};
+
+struct ID3D12CommandQueue : public ID3D12Pageable
+{
+	virtual void ExecuteCommandLists (UINT, ID3D12CommandList* const*)
+	{
+	}
+
+	virtual HRESULT Signal (ID3D12Fence*, UINT64)
+	{
+		return S_OK;
+	}
+
+	virtual HRESULT Wait (ID3D12Fence*, UINT64)
+	{
+		return S_OK;
+	}
+};
+
+struct ID3D12Device : public ID3D12Object
+{
+	virtual HRESULT CheckFeatureSupport (D3D12_FEATURE, void*, UINT)
+	{
+		return E_NOTIMPL;
+	}
+
+	virtual HRESULT CreateCommandQueue (const D3D12_COMMAND_QUEUE_DESC*, REFIID, void** object)
+	{
+		*object = nullptr;
+		return E_NOTIMPL;
+	}
+
+	virtual HRESULT CreateCommandAllocator (D3D12_COMMAND_LIST_TYPE, REFIID, void** object)
+	{
+		*object = nullptr;
+		return E_NOTIMPL;
+	}
+
+	virtual HRESULT CreateCommandList (UINT, D3D12_COMMAND_LIST_TYPE, ID3D12CommandAllocator*,
+		ID3D12PipelineState*, REFIID, void** object)
+	{
+		*object = nullptr;
+		return E_NOTIMPL;
+	}
+
+	virtual HRESULT CreateDescriptorHeap (const D3D12_DESCRIPTOR_HEAP_DESC*, REFIID, void** object)
+	{
+		*object = nullptr;
+		return E_NOTIMPL;
+	}
+
+	virtual UINT GetDescriptorHandleIncrementSize (D3D12_DESCRIPTOR_HEAP_TYPE)
+	{
+		return 32;
+	}
+
+	virtual void CreateShaderResourceView (ID3D12Resource*, const D3D12_SHADER_RESOURCE_VIEW_DESC*,
+		D3D12_CPU_DESCRIPTOR_HANDLE)
+	{
+	}
+
+	virtual D3D12_RESOURCE_ALLOCATION_INFO GetResourceAllocationInfo (UINT, UINT,
+		const D3D12_RESOURCE_DESC*)
+	{
+		return D3D12_RESOURCE_ALLOCATION_INFO ();
+	}
+
+	virtual HRESULT CreateCommittedResource (const D3D12_HEAP_PROPERTIES*, D3D12_HEAP_FLAGS,
+		const D3D12_RESOURCE_DESC*, D3D12_RESOURCE_STATES, const D3D12_CLEAR_VALUE*,
+		REFIID, void** object)
+	{
+		*object = nullptr;
+		return E_NOTIMPL;
+	}
+
+	virtual HRESULT CreateHeap (const D3D12_HEAP_DESC*, REFIID, void** object)
+	{
+		*object = nullptr;
+		return E_NOTIMPL;
+	}
+
+	virtual HRESULT CreatePlacedResource (ID3D12Heap*, UINT64, const D3D12_RESOURCE_DESC*,
+		D3D12_RESOURCE_STATES, const D3D12_CLEAR_VALUE*, REFIID, void** object)
+	{
+		*object = nullptr;
+		return E_NOTIMPL;
+	}
+
+	virtual HRESULT CreateFence (UINT64, D3D12_FENCE_FLAGS, REFIID, void** object)
+	{
+		*object = nullptr;
+		return E_NOTIMPL;
+	}
+
+	virtual void GetCopyableFootprints (const D3D12_RESOURCE_DESC*, UINT, UINT, UINT64,
+		D3D12_PLACED_SUBRESOURCE_FOOTPRINT*, UINT*, UINT64*, UINT64*)
+	{
+	}
+};
+
+#endif
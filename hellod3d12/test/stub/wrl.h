@@ -0,0 +1,191 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+
+/**
+A minimal Microsoft::WRL::ComPtr for the D3D12 stub.
+*/
+
+#ifndef ANTERU_D3D12_SAMPLE_TEST_STUB_WRL_H_
+#define ANTERU_D3D12_SAMPLE_TEST_STUB_WRL_H_
+
+#include <cstddef>
+#include <utility>
+
+namespace Microsoft {
+namespace WRL {
+template <typename T>
+class ComPtr
+{
+public:
+	typedef T InterfaceType;
+
+	ComPtr ()
+	{
+	}
+
+	ComPtr (std::nullptr_t)
+	{
+	}
+
+	ComPtr (T* p)
+		: p_ (p)
+	{
+		AddRef ();
+	}
+
+	ComPtr (const ComPtr& other)
+		: p_ (other.p_)
+	{
+		AddRef ();
+	}
+
+	template <typename U>
+	ComPtr (const ComPtr<U>& other)
+		: p_ (other.Get ())
+	{
+		AddRef ();
+	}
+
+	ComPtr (ComPtr&& other)
+		: p_ (other.p_)
+	{
+		other.p_ = nullptr;
+	}
+
+	~ComPtr ()
+	{
+		Reset ();
+	}
+
+	ComPtr& operator= (ComPtr other)
+	{
+		std::swap (p_, other.p_);
+		return *this;
+	}
+
+	ComPtr& operator= (std::nullptr_t)
+	{
+		Reset ();
+		return *this;
+	}
+
+	T* Get () const
+	{
+		return p_;
+	}
+
+	T* operator-> () const
+	{
+		return p_;
+	}
+
+	explicit operator bool () const
+	{
+		return p_ != nullptr;
+	}
+
+	T** operator& ()
+	{
+		Reset ();
+		return &p_;
+	}
+
+	T* const* GetAddressOf () const
+	{
+		return &p_;
+	}
+
+	T** GetAddressOf ()
+	{
+		return &p_;
+	}
+
+	T** ReleaseAndGetAddressOf ()
+	{
+		Reset ();
+		return &p_;
+	}
+
+	T* Detach ()
+	{
+		auto p = p_;
+		p_ = nullptr;
+		return p;
+	}
+
+	void Attach (T* p)
+	{
+		Reset ();
+		p_ = p;
+	}
+
+	unsigned long Reset ()
+	{
+		if (p_) {
+			auto p = p_;
+			p_ = nullptr;
+			return p->Release ();
+		}
+
+		return 0;
+	}
+
+	template <typename U>
+	long As (ComPtr<U>* other) const
+	{
+		return p_->QueryInterface (StubUuidOf<U> (),
+			reinterpret_cast<void**> (other->ReleaseAndGetAddressOf ()));
+	}
+
+private:
+	void AddRef ()
+	{
+		if (p_) {
+			p_->AddRef ();
+		}
+	}
+
+	T* p_ = nullptr;
+};
+
+template <typename T, typename U>
+bool operator== (const ComPtr<T>& a, const ComPtr<U>& b)
+{
+	return a.Get () == b.Get ();
+}
+
+template <typename T>
+bool operator== (const ComPtr<T>& a, std::nullptr_t)
+{
+	return a.Get () == nullptr;
+}
+
+template <typename T>
+bool operator!= (const ComPtr<T>& a, std::nullptr_t)
+{
+	return a.Get () != nullptr;
+}
+}
+}
+
+#endif
@@ -0,0 +1,22 @@
+# Write a texture container with tools/textureToContainer.py for
+# TextureContainerTest. The image is a pattern the test recomputes:
+# (x * 7, y * 11, (x + y) * 3, 255), all modulo 256, sized 37x23.
+#
+#   writeToolContainer.py toolsDirectory output
+import sys
+
+import numpy
+
+sys.path.insert (0, sys.argv [1])
+import textureToContainer
+
+WIDTH = 37
+HEIGHT = 23
+
+if __name__=='__main__':
+    y, x = numpy.mgrid [0:HEIGHT, 0:WIDTH]
+    pixels = numpy.stack ([x * 7, y * 11, (x + y) * 3, numpy.full_like (x, 255)], axis=2)
+    pixels = (pixels % 256).astype (numpy.uint8)
+
+    textureToContainer.WriteContainer (sys.argv [2],
+        textureToContainer.GenerateMips (pixels, True))
@@ -0,0 +1,40 @@
+# Compress test inputs with the LZ4 compressor in tools/embedAsset.py for
+# Lz4Test, which decompresses them with Lz4Decompress. Each case is written
+# as name.bin (the input) and name.lz4 (the compressed block).
+#
+#   writeToolLz4.py toolsDirectory outputDirectory
+import os
+import random
+import sys
+
+sys.path.insert (0, sys.argv [1])
+import embedAsset
+
+def CreateCases ():
+    generator = random.Random (42)
+    randomBytes = lambda size: bytes (generator.getrandbits (8) for _ in range (size))
+
+    far = randomBytes (70000)
+
+    return {
+        'Empty': b'',
+        'OneByte': b'a',
+        # Just below and at the size where the compressor starts matching
+        'BelowMatchLimit': b'abcdefghijkl',
+        'AtMatchLimit': b'a' * 13,
+        'Run': b'a' * 100000,
+        'Pattern': bytes (range (256)) * 300,
+        'Random': randomBytes (5000),
+        'SmallAlphabet': bytes (generator.choice (b'abc') for _ in range (70000)),
+        # A repeat further away than the maximum offset
+        'FarRepeat': far + far [:1000]
+    }
+
+if __name__=='__main__':
+    os.makedirs (sys.argv [2], exist_ok=True)
+
+    for name, data in CreateCases ().items ():
+        with open (os.path.join (sys.argv [2], name + '.bin'), 'wb') as output:
+            output.write (data)
+        with open (os.path.join (sys.argv [2], name + '.lz4'), 'wb') as output:
+            output.write (embedAsset.Lz4Compress (data))
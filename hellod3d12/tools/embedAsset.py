@@ -0,0 +1,128 @@
+# Embed a file into a C++ header as an AMD::EmbeddedAsset (see
+# src/EmbeddedAsset.h). The data is written as 64-bit little-endian words,
+# which is about a third of the size of a byte-per-literal array, parses much
+# faster and has no string literal length limits. With --lz4, the data is
+# stored as an LZ4 block if that saves at least --min-savings percent (default
+# 10); EmbeddedAssetView decompresses it at runtime. Replaces binaryToHeader.py
+# and sourceToHeader.py. No dependencies beyond the standard library.
+import os
+import struct
+import sys
+
+# Must match src/Lz4.cpp
+MIN_MATCH = 4
+LAST_LITERALS = 5
+MATCH_FIND_LIMIT = 12
+MAX_OFFSET = 65535
+HASH_BITS = 12
+
+WORDS_PER_LINE = 4
+
+def WriteLength (output, length):
+    while length >= 255:
+        output.append (255)
+        length -= 255
+    output.append (length)
+
+def WriteSequence (output, literals, offset, matchLength):
+    literalToken = min (len (literals), 15)
+    matchToken = 0 if matchLength == 0 else min (matchLength - MIN_MATCH, 15)
+    output.append ((literalToken << 4) | matchToken)
+
+    if len (literals) >= 15:
+        WriteLength (output, len (literals) - 15)
+    output.extend (literals)
+
+    # The last sequence has no match part
+    if matchLength == 0:
+        return
+
+    output.extend (struct.pack ('<H', offset))
+    if matchLength - MIN_MATCH >= 15:
+        WriteLength (output, matchLength - MIN_MATCH - 15)
+
+def Lz4Compress (data):
+    # Same greedy matcher as Lz4Compress in src/Lz4.cpp, so the output can be
+    # decoded by Lz4Decompress (or any other LZ4 block decoder)
+    output = bytearray ()
+    hashTable = {}
+    position = 0
+    anchor = 0
+    size = len (data)
+
+    if size > MATCH_FIND_LIMIT:
+        matchLimit = size - LAST_LITERALS
+
+        while position < size - MATCH_FIND_LIMIT:
+            sequence = data [position:position + 4]
+            hash = ((struct.unpack ('<I', sequence) [0] * 2654435761) & 0xFFFFFFFF) >> (32 - HASH_BITS)
+            candidate = hashTable.get (hash)
+            hashTable [hash] = position
+
+            if candidate is None or position - candidate > MAX_OFFSET or \
+                data [candidate:candidate + 4] != sequence:
+                position += 1
+                continue
+
+            matchLength = MIN_MATCH
+            while position + matchLength < matchLimit and \
+                data [candidate + matchLength] == data [position + matchLength]:
+                matchLength += 1
+
+            WriteSequence (output, data [anchor:position], position - candidate, matchLength)
+            position += matchLength
+            anchor = position
+
+    WriteSequence (output, data [anchor:], 0, 0)
+    return bytes (output)
+
+def EmbedAsset (data, variableName, sourceName, compress, minSavings):
+    stored = data
+    compression = 'None'
+    if compress:
+        compressed = Lz4Compress (data)
+        if len (compressed) * 100 <= len (data) * (100 - minSavings):
+            stored = compressed
+            compression = 'Lz4'
+
+    padded = stored + bytes (-len (stored) % 8)
+    words = struct.unpack ('<{}Q'.format (len (padded) // 8), padded)
+
+    lines = ['// Generated by embedAsset.py from {}, do not edit'.format (sourceName),
+        '#include "EmbeddedAsset.h"',
+        '',
+        'namespace {',
+        'const std::uint64_t {}Data [] = {{'.format (variableName)]
+    for i in range (0, len (words), WORDS_PER_LINE):
+        lines.append ('\t' + ', '.join (hex (w) for w in words [i:i + WORDS_PER_LINE]) + ',')
+    # Empty arrays are not allowed
+    if not words:
+        lines.append ('\t0')
+    lines.extend (['};',
+        '}',
+        '',
+        'const AMD::EmbeddedAsset {} = {{'.format (variableName),
+        '\t{}Data, {}, {}, AMD::EmbeddedAssetCompression::{}'.format (
+            variableName, len (stored), len (data), compression),
+        '};',
+        ''])
+    return '\n'.join (lines)
+
+if __name__=='__main__':
+    arguments = [a for a in sys.argv [1:] if not a.startswith ('--')]
+    options = dict (a [2:].partition ('=') [::2] for a in sys.argv [1:] if a.startswith ('--'))
+
+    if len (arguments) < 2:
+        print ('Usage: embedAsset.py input variableName [output] [--lz4] [--min-savings=10]')
+        sys.exit (1)
+
+    header = EmbedAsset (open (arguments [0], 'rb').read (), arguments [1],
+        os.path.basename (arguments [0]), 'lz4' in options,
+        int (options.get ('min-savings', 10)))
+
+    if len (arguments) > 2:
+        # Binary mode, so the output does not depend on the host line endings
+        with open (arguments [2], 'wb') as output:
+            output.write (header.encode ('utf-8'))
+    else:
+        sys.stdout.write (header)
@@ -0,0 +1,98 @@
+# Pack all files below a directory into an asset pack read by AssetPack (see
+# src/AssetPack.h for the layout). Entry names are the paths relative to the
+# directory, using forward slashes. With --lz4, entries are stored as LZ4
+# blocks if that saves at least --min-savings percent (default 10); the
+# others stay uncompressed so they can be used in place. Uses the lz4 package
+# for compression if it is installed, otherwise the compressor from
+# embedAsset.py.
+import os
+import struct
+import sys
+
+try:
+    import lz4.block
+    def Lz4Compress (data):
+        return lz4.block.compress (data, store_size=False)
+except ImportError:
+    from embedAsset import Lz4Compress
+
+VERSION = 1
+HEADER_SIZE = 32
+ENTRY_SIZE = 48
+
+COMPRESSION_NONE = 0
+COMPRESSION_LZ4 = 1
+
+def RoundToNextMultiple (value, multiple):
+    return ((value + multiple - 1) // multiple) * multiple
+
+def HashFNV1a (data):
+    hash = 0xCBF29CE484222325
+    for byte in data:
+        hash = ((hash ^ byte) * 0x100000001B3) & 0xFFFFFFFFFFFFFFFF
+    return hash
+
+def CollectFiles (directory):
+    result = []
+    for root, _, files in os.walk (directory):
+        for filename in files:
+            path = os.path.join (root, filename)
+            result.append ((os.path.relpath (path, directory).replace (os.sep, '/'), path))
+    # Sorted, so the same input always gives the same pack
+    return sorted (result)
+
+def WritePack (filename, files, compress, minSavings, alignment):
+    entries = []
+    names = bytearray ()
+    for name, path in files:
+        encodedName = name.encode ('utf-8')
+        data = open (path, 'rb').read ()
+        stored = data
+        compression = COMPRESSION_NONE
+        if compress and data:
+            compressed = Lz4Compress (data)
+            if len (compressed) * 100 <= len (data) * (100 - minSavings):
+                stored = compressed
+                compression = COMPRESSION_LZ4
+        entries.append ([HashFNV1a (encodedName), len (names), len (encodedName),
+            stored, len (data), compression])
+        names.extend (encodedName)
+
+    # Entries with equal hashes are told apart by their name
+    entries.sort (key=lambda e: e [0])
+
+    indexOffset = HEADER_SIZE
+    namesOffset = indexOffset + ENTRY_SIZE * len (entries)
+    dataOffset = RoundToNextMultiple (namesOffset + len (names), alignment)
+
+    index = bytearray ()
+    data = bytearray ()
+    for hash, nameOffset, nameLength, stored, size, compression in entries:
+        data.extend (bytes (RoundToNextMultiple (len (data), alignment) - len (data)))
+        index.extend (struct.pack ('<QQQQIIII', hash, dataOffset + len (data), len (stored),
+            size, nameOffset, nameLength, compression, 0))
+        data.extend (stored)
+
+    with open (filename, 'wb') as output:
+        output.write (struct.pack ('<4sIIIQQ', b'APAK', VERSION, len (entries), alignment,
+            indexOffset, namesOffset))
+        output.write (index)
+        output.write (names)
+        output.write (bytes (dataOffset - namesOffset - len (names)))
+        output.write (data)
+
+    storedSize = sum (len (e [3]) for e in entries)
+    totalSize = sum (e [4] for e in entries)
+    print ('Packed {} files, {} bytes stored for {} bytes of data'.format (
+        len (entries), storedSize, totalSize))
+
+if __name__=='__main__':
+    arguments = [a for a in sys.argv [1:] if not a.startswith ('--')]
+    options = dict (a [2:].partition ('=') [::2] for a in sys.argv [1:] if a.startswith ('--'))
+
+    if len (arguments) < 2:
+        print ('Usage: packAssets.py output directory [--lz4] [--min-savings=10] [--alignment=64]')
+        sys.exit (1)
+
+    WritePack (arguments [0], CollectFiles (arguments [1]), 'lz4' in options,
+        int (options.get ('min-savings', 10)), int (options.get ('alignment', 64)))
@@ -0,0 +1,85 @@
+# Convert an image into the texture container format read by
+# TextureContainer (see src/TextureContainer.h for the layout). The image is
+# stored as R8G8B8A8_UNORM_SRGB with a full mip chain, filtered in linear
+# space. Requires Pillow and numpy.
+import struct
+import sys
+
+import numpy
+from PIL import Image
+
+DXGI_FORMAT_R8G8B8A8_UNORM_SRGB = 29
+PITCH_ALIGNMENT = 256
+PLACEMENT_ALIGNMENT = 512
+
+def RoundToNextMultiple (value, multiple):
+    return ((value + multiple - 1) // multiple) * multiple
+
+def SrgbToLinear (c):
+    return numpy.where (c <= 0.04045, c / 12.92, ((c + 0.055) / 1.055) ** 2.4)
+
+def LinearToSrgb (c):
+    return numpy.where (c <= 0.0031308, c * 12.92, 1.055 * c ** (1 / 2.4) - 0.055)
+
+def Downsample (image):
+    # 2x2 box filter, odd sizes clamp the last row/column
+    height, width = image.shape [:2]
+    ys = numpy.minimum (numpy.arange (max (1, height // 2)) * 2 + numpy.array ([[0], [1]]), height - 1)
+    xs = numpy.minimum (numpy.arange (max (1, width // 2)) * 2 + numpy.array ([[0], [1]]), width - 1)
+    return (image [ys [0]] [:, xs [0]] + image [ys [0]] [:, xs [1]] +
+            image [ys [1]] [:, xs [0]] + image [ys [1]] [:, xs [1]]) / 4
+
+def ToBytes (image):
+    alpha = image [..., 3:4]
+    # Undo the alpha weighting, transparent texels stay black
+    color = numpy.divide (image [..., :3], alpha, out=numpy.zeros_like (image [..., :3]), where=alpha > 0)
+    result = numpy.concatenate ([LinearToSrgb (numpy.clip (color, 0, 1)), numpy.clip (alpha, 0, 1)], axis=2)
+    return (result * 255 + 0.5).astype (numpy.uint8)
+
+def GenerateMips (pixels, generateMips):
+    levels = [pixels]
+    if not generateMips:
+        return levels
+
+    image = pixels.astype (numpy.float64) / 255
+    image = numpy.concatenate ([SrgbToLinear (image [..., :3]) * image [..., 3:4], image [..., 3:4]], axis=2)
+
+    while image.shape [0] > 1 or image.shape [1] > 1:
+        image = Downsample (image)
+        levels.append (ToBytes (image))
+
+    return levels
+
+def WriteContainer (filename, levels):
+    height, width = levels [0].shape [:2]
+    headerSize = 48 + 32 * len (levels)
+    dataOffset = RoundToNextMultiple (headerSize, PLACEMENT_ALIGNMENT)
+
+    subresources = []
+    data = bytearray ()
+    for level in levels:
+        levelHeight, levelWidth = level.shape [:2]
+        rowSize = levelWidth * 4
+        rowPitch = RoundToNextMultiple (rowSize, PITCH_ALIGNMENT)
+        data.extend (bytes (RoundToNextMultiple (len (data), PLACEMENT_ALIGNMENT) - len (data)))
+        subresources.append (struct.pack ('<QIIIIII', len (data), levelWidth, levelHeight,
+            rowPitch, levelHeight, rowSize, 0))
+        for row in level:
+            data.extend (row.tobytes ())
+            data.extend (bytes (rowPitch - rowSize))
+
+    with open (filename, 'wb') as output:
+        output.write (struct.pack ('<4sIIIIIIIQQ', b'ATEX', 1, DXGI_FORMAT_R8G8B8A8_UNORM_SRGB,
+            width, height, 1, len (levels), len (levels), dataOffset, len (data)))
+        for subresource in subresources:
+            output.write (subresource)
+        output.write (bytes (dataOffset - headerSize))
+        output.write (data)
+
+if __name__=='__main__':
+    if len (sys.argv) < 3:
+        print ('Usage: textureToContainer.py input output [--no-mips]')
+        sys.exit (1)
+
+    pixels = numpy.asarray (Image.open (sys.argv [1]).convert ('RGBA'))
+    WriteContainer (sys.argv [2], GenerateMips (pixels, '--no-mips' not in sys.argv))